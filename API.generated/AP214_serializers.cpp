@@ -0,0 +1,6 @@
+//
+// Explicit instantiations of aggregation serializers of AP214.h
+// Compile this file once and define RDF_EXPRESS_EXTERN_SERIALIZERS in other translation units, so they do not instantiate serializers
+//
+#define RDF_EXPRESS_INSTANTIATE_SERIALIZERS
+#include    "AP214.h"
@@ -0,0 +1,1639 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_SPLIT_H
+#define __RDF_LTD__IFC4_SPLIT_H
+
+#include    "IfcActionRequest.h"
+#include    "IfcActor.h"
+#include    "IfcActorRole.h"
+#include    "IfcActuator.h"
+#include    "IfcActuatorType.h"
+#include    "IfcAddress.h"
+#include    "IfcAdvancedBrep.h"
+#include    "IfcAdvancedBrepWithVoids.h"
+#include    "IfcAdvancedFace.h"
+#include    "IfcAirTerminal.h"
+#include    "IfcAirTerminalBox.h"
+#include    "IfcAirTerminalBoxType.h"
+#include    "IfcAirTerminalType.h"
+#include    "IfcAirToAirHeatRecovery.h"
+#include    "IfcAirToAirHeatRecoveryType.h"
+#include    "IfcAlarm.h"
+#include    "IfcAlarmType.h"
+#include    "IfcAnnotation.h"
+#include    "IfcAnnotationFillArea.h"
+#include    "IfcApplication.h"
+#include    "IfcAppliedValue.h"
+#include    "IfcApproval.h"
+#include    "IfcApprovalRelationship.h"
+#include    "IfcArbitraryClosedProfileDef.h"
+#include    "IfcArbitraryOpenProfileDef.h"
+#include    "IfcArbitraryProfileDefWithVoids.h"
+#include    "IfcAsset.h"
+#include    "IfcAsymmetricIShapeProfileDef.h"
+#include    "IfcAudioVisualAppliance.h"
+#include    "IfcAudioVisualApplianceType.h"
+#include    "IfcAxis1Placement.h"
+#include    "IfcAxis2Placement2D.h"
+#include    "IfcAxis2Placement3D.h"
+#include    "IfcBeam.h"
+#include    "IfcBeamStandardCase.h"
+#include    "IfcBeamType.h"
+#include    "IfcBlobTexture.h"
+#include    "IfcBlock.h"
+#include    "IfcBoiler.h"
+#include    "IfcBoilerType.h"
+#include    "IfcBooleanClippingResult.h"
+#include    "IfcBooleanResult.h"
+#include    "IfcBoundaryCondition.h"
+#include    "IfcBoundaryCurve.h"
+#include    "IfcBoundaryEdgeCondition.h"
+#include    "IfcBoundaryFaceCondition.h"
+#include    "IfcBoundaryNodeCondition.h"
+#include    "IfcBoundaryNodeConditionWarping.h"
+#include    "IfcBoundedCurve.h"
+#include    "IfcBoundedSurface.h"
+#include    "IfcBoundingBox.h"
+#include    "IfcBoxedHalfSpace.h"
+#include    "IfcBSplineCurve.h"
+#include    "IfcBSplineCurveWithKnots.h"
+#include    "IfcBSplineSurface.h"
+#include    "IfcBSplineSurfaceWithKnots.h"
+#include    "IfcBuilding.h"
+#include    "IfcBuildingElement.h"
+#include    "IfcBuildingElementPart.h"
+#include    "IfcBuildingElementPartType.h"
+#include    "IfcBuildingElementProxy.h"
+#include    "IfcBuildingElementProxyType.h"
+#include    "IfcBuildingElementType.h"
+#include    "IfcBuildingStorey.h"
+#include    "IfcBuildingSystem.h"
+#include    "IfcBurner.h"
+#include    "IfcBurnerType.h"
+#include    "IfcCableCarrierFitting.h"
+#include    "IfcCableCarrierFittingType.h"
+#include    "IfcCableCarrierSegment.h"
+#include    "IfcCableCarrierSegmentType.h"
+#include    "IfcCableFitting.h"
+#include    "IfcCableFittingType.h"
+#include    "IfcCableSegment.h"
+#include    "IfcCableSegmentType.h"
+#include    "IfcCartesianPoint.h"
+#include    "IfcCartesianPointList.h"
+#include    "IfcCartesianPointList2D.h"
+#include    "IfcCartesianPointList3D.h"
+#include    "IfcCartesianTransformationOperator.h"
+#include    "IfcCartesianTransformationOperator2D.h"
+#include    "IfcCartesianTransformationOperator2DnonUniform.h"
+#include    "IfcCartesianTransformationOperator3D.h"
+#include    "IfcCartesianTransformationOperator3DnonUniform.h"
+#include    "IfcCenterLineProfileDef.h"
+#include    "IfcChiller.h"
+#include    "IfcChillerType.h"
+#include    "IfcChimney.h"
+#include    "IfcChimneyType.h"
+#include    "IfcCircle.h"
+#include    "IfcCircleHollowProfileDef.h"
+#include    "IfcCircleProfileDef.h"
+#include    "IfcCivilElement.h"
+#include    "IfcCivilElementType.h"
+#include    "IfcClassification.h"
+#include    "IfcClassificationReference.h"
+#include    "IfcClosedShell.h"
+#include    "IfcCoil.h"
+#include    "IfcCoilType.h"
+#include    "IfcColourRgb.h"
+#include    "IfcColourRgbList.h"
+#include    "IfcColourSpecification.h"
+#include    "IfcColumn.h"
+#include    "IfcColumnStandardCase.h"
+#include    "IfcColumnType.h"
+#include    "IfcCommunicationsAppliance.h"
+#include    "IfcCommunicationsApplianceType.h"
+#include    "IfcComplexProperty.h"
+#include    "IfcComplexPropertyTemplate.h"
+#include    "IfcCompositeCurve.h"
+#include    "IfcCompositeCurveOnSurface.h"
+#include    "IfcCompositeCurveSegment.h"
+#include    "IfcCompositeProfileDef.h"
+#include    "IfcCompressor.h"
+#include    "IfcCompressorType.h"
+#include    "IfcCondenser.h"
+#include    "IfcCondenserType.h"
+#include    "IfcConic.h"
+#include    "IfcConnectedFaceSet.h"
+#include    "IfcConnectionCurveGeometry.h"
+#include    "IfcConnectionGeometry.h"
+#include    "IfcConnectionPointEccentricity.h"
+#include    "IfcConnectionPointGeometry.h"
+#include    "IfcConnectionSurfaceGeometry.h"
+#include    "IfcConnectionVolumeGeometry.h"
+#include    "IfcConstraint.h"
+#include    "IfcConstructionEquipmentResource.h"
+#include    "IfcConstructionEquipmentResourceType.h"
+#include    "IfcConstructionMaterialResource.h"
+#include    "IfcConstructionMaterialResourceType.h"
+#include    "IfcConstructionProductResource.h"
+#include    "IfcConstructionProductResourceType.h"
+#include    "IfcConstructionResource.h"
+#include    "IfcConstructionResourceType.h"
+#include    "IfcContext.h"
+#include    "IfcContextDependentUnit.h"
+#include    "IfcControl.h"
+#include    "IfcController.h"
+#include    "IfcControllerType.h"
+#include    "IfcConversionBasedUnit.h"
+#include    "IfcConversionBasedUnitWithOffset.h"
+#include    "IfcCooledBeam.h"
+#include    "IfcCooledBeamType.h"
+#include    "IfcCoolingTower.h"
+#include    "IfcCoolingTowerType.h"
+#include    "IfcCoordinateOperation.h"
+#include    "IfcCoordinateReferenceSystem.h"
+#include    "IfcCostItem.h"
+#include    "IfcCostSchedule.h"
+#include    "IfcCostValue.h"
+#include    "IfcCovering.h"
+#include    "IfcCoveringType.h"
+#include    "IfcCrewResource.h"
+#include    "IfcCrewResourceType.h"
+#include    "IfcCsgPrimitive3D.h"
+#include    "IfcCsgSolid.h"
+#include    "IfcCShapeProfileDef.h"
+#include    "IfcCurrencyRelationship.h"
+#include    "IfcCurtainWall.h"
+#include    "IfcCurtainWallType.h"
+#include    "IfcCurve.h"
+#include    "IfcCurveBoundedPlane.h"
+#include    "IfcCurveBoundedSurface.h"
+#include    "IfcCurveStyle.h"
+#include    "IfcCurveStyleFont.h"
+#include    "IfcCurveStyleFontAndScaling.h"
+#include    "IfcCurveStyleFontPattern.h"
+#include    "IfcCylindricalSurface.h"
+#include    "IfcDamper.h"
+#include    "IfcDamperType.h"
+#include    "IfcDerivedProfileDef.h"
+#include    "IfcDerivedUnit.h"
+#include    "IfcDerivedUnitElement.h"
+#include    "IfcDimensionalExponents.h"
+#include    "IfcDirection.h"
+#include    "IfcDiscreteAccessory.h"
+#include    "IfcDiscreteAccessoryType.h"
+#include    "IfcDistributionChamberElement.h"
+#include    "IfcDistributionChamberElementType.h"
+#include    "IfcDistributionCircuit.h"
+#include    "IfcDistributionControlElement.h"
+#include    "IfcDistributionControlElementType.h"
+#include    "IfcDistributionElement.h"
+#include    "IfcDistributionElementType.h"
+#include    "IfcDistributionFlowElement.h"
+#include    "IfcDistributionFlowElementType.h"
+#include    "IfcDistributionPort.h"
+#include    "IfcDistributionSystem.h"
+#include    "IfcDocumentInformation.h"
+#include    "IfcDocumentInformationRelationship.h"
+#include    "IfcDocumentReference.h"
+#include    "IfcDoor.h"
+#include    "IfcDoorLiningProperties.h"
+#include    "IfcDoorPanelProperties.h"
+#include    "IfcDoorStandardCase.h"
+#include    "IfcDoorStyle.h"
+#include    "IfcDoorType.h"
+#include    "IfcDraughtingPreDefinedColour.h"
+#include    "IfcDraughtingPreDefinedCurveFont.h"
+#include    "IfcDuctFitting.h"
+#include    "IfcDuctFittingType.h"
+#include    "IfcDuctSegment.h"
+#include    "IfcDuctSegmentType.h"
+#include    "IfcDuctSilencer.h"
+#include    "IfcDuctSilencerType.h"
+#include    "IfcEdge.h"
+#include    "IfcEdgeCurve.h"
+#include    "IfcEdgeLoop.h"
+#include    "IfcElectricAppliance.h"
+#include    "IfcElectricApplianceType.h"
+#include    "IfcElectricDistributionBoard.h"
+#include    "IfcElectricDistributionBoardType.h"
+#include    "IfcElectricFlowStorageDevice.h"
+#include    "IfcElectricFlowStorageDeviceType.h"
+#include    "IfcElectricGenerator.h"
+#include    "IfcElectricGeneratorType.h"
+#include    "IfcElectricMotor.h"
+#include    "IfcElectricMotorType.h"
+#include    "IfcElectricTimeControl.h"
+#include    "IfcElectricTimeControlType.h"
+#include    "IfcElement.h"
+#include    "IfcElementarySurface.h"
+#include    "IfcElementAssembly.h"
+#include    "IfcElementAssemblyType.h"
+#include    "IfcElementComponent.h"
+#include    "IfcElementComponentType.h"
+#include    "IfcElementQuantity.h"
+#include    "IfcElementType.h"
+#include    "IfcEllipse.h"
+#include    "IfcEllipseProfileDef.h"
+#include    "IfcEnergyConversionDevice.h"
+#include    "IfcEnergyConversionDeviceType.h"
+#include    "IfcEngine.h"
+#include    "IfcEngineType.h"
+#include    "IfcEvaporativeCooler.h"
+#include    "IfcEvaporativeCoolerType.h"
+#include    "IfcEvaporator.h"
+#include    "IfcEvaporatorType.h"
+#include    "IfcEvent.h"
+#include    "IfcEventTime.h"
+#include    "IfcEventType.h"
+#include    "IfcExtendedProperties.h"
+#include    "IfcExternalInformation.h"
+#include    "IfcExternallyDefinedHatchStyle.h"
+#include    "IfcExternallyDefinedSurfaceStyle.h"
+#include    "IfcExternallyDefinedTextFont.h"
+#include    "IfcExternalReference.h"
+#include    "IfcExternalReferenceRelationship.h"
+#include    "IfcExternalSpatialElement.h"
+#include    "IfcExternalSpatialStructureElement.h"
+#include    "IfcExtrudedAreaSolid.h"
+#include    "IfcExtrudedAreaSolidTapered.h"
+#include    "IfcFace.h"
+#include    "IfcFaceBasedSurfaceModel.h"
+#include    "IfcFaceBound.h"
+#include    "IfcFaceOuterBound.h"
+#include    "IfcFaceSurface.h"
+#include    "IfcFacetedBrep.h"
+#include    "IfcFacetedBrepWithVoids.h"
+#include    "IfcFailureConnectionCondition.h"
+#include    "IfcFan.h"
+#include    "IfcFanType.h"
+#include    "IfcFastener.h"
+#include    "IfcFastenerType.h"
+#include    "IfcFeatureElement.h"
+#include    "IfcFeatureElementAddition.h"
+#include    "IfcFeatureElementSubtraction.h"
+#include    "IfcFillAreaStyle.h"
+#include    "IfcFillAreaStyleHatching.h"
+#include    "IfcFillAreaStyleTiles.h"
+#include    "IfcFilter.h"
+#include    "IfcFilterType.h"
+#include    "IfcFireSuppressionTerminal.h"
+#include    "IfcFireSuppressionTerminalType.h"
+#include    "IfcFixedReferenceSweptAreaSolid.h"
+#include    "IfcFlowController.h"
+#include    "IfcFlowControllerType.h"
+#include    "IfcFlowFitting.h"
+#include    "IfcFlowFittingType.h"
+#include    "IfcFlowInstrument.h"
+#include    "IfcFlowInstrumentType.h"
+#include    "IfcFlowMeter.h"
+#include    "IfcFlowMeterType.h"
+#include    "IfcFlowMovingDevice.h"
+#include    "IfcFlowMovingDeviceType.h"
+#include    "IfcFlowSegment.h"
+#include    "IfcFlowSegmentType.h"
+#include    "IfcFlowStorageDevice.h"
+#include    "IfcFlowStorageDeviceType.h"
+#include    "IfcFlowTerminal.h"
+#include    "IfcFlowTerminalType.h"
+#include    "IfcFlowTreatmentDevice.h"
+#include    "IfcFlowTreatmentDeviceType.h"
+#include    "IfcFooting.h"
+#include    "IfcFootingType.h"
+#include    "IfcFurnishingElement.h"
+#include    "IfcFurnishingElementType.h"
+#include    "IfcFurniture.h"
+#include    "IfcFurnitureType.h"
+#include    "IfcGeographicElement.h"
+#include    "IfcGeographicElementType.h"
+#include    "IfcGeometricCurveSet.h"
+#include    "IfcGeometricRepresentationContext.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "IfcGeometricRepresentationSubContext.h"
+#include    "IfcGeometricSet.h"
+#include    "IfcGrid.h"
+#include    "IfcGridAxis.h"
+#include    "IfcGridPlacement.h"
+#include    "IfcGroup.h"
+#include    "IfcHalfSpaceSolid.h"
+#include    "IfcHeatExchanger.h"
+#include    "IfcHeatExchangerType.h"
+#include    "IfcHumidifier.h"
+#include    "IfcHumidifierType.h"
+#include    "IfcImageTexture.h"
+#include    "IfcIndexedColourMap.h"
+#include    "IfcIndexedPolyCurve.h"
+#include    "IfcIndexedPolygonalFace.h"
+#include    "IfcIndexedPolygonalFaceWithVoids.h"
+#include    "IfcIndexedTextureMap.h"
+#include    "IfcIndexedTriangleTextureMap.h"
+#include    "IfcInterceptor.h"
+#include    "IfcInterceptorType.h"
+#include    "IfcIntersectionCurve.h"
+#include    "IfcInventory.h"
+#include    "IfcIrregularTimeSeries.h"
+#include    "IfcIrregularTimeSeriesValue.h"
+#include    "IfcIShapeProfileDef.h"
+#include    "IfcJunctionBox.h"
+#include    "IfcJunctionBoxType.h"
+#include    "IfcLaborResource.h"
+#include    "IfcLaborResourceType.h"
+#include    "IfcLagTime.h"
+#include    "IfcLamp.h"
+#include    "IfcLampType.h"
+#include    "IfcLibraryInformation.h"
+#include    "IfcLibraryReference.h"
+#include    "IfcLightDistributionData.h"
+#include    "IfcLightFixture.h"
+#include    "IfcLightFixtureType.h"
+#include    "IfcLightIntensityDistribution.h"
+#include    "IfcLightSource.h"
+#include    "IfcLightSourceAmbient.h"
+#include    "IfcLightSourceDirectional.h"
+#include    "IfcLightSourceGoniometric.h"
+#include    "IfcLightSourcePositional.h"
+#include    "IfcLightSourceSpot.h"
+#include    "IfcLine.h"
+#include    "IfcLocalPlacement.h"
+#include    "IfcLoop.h"
+#include    "IfcLShapeProfileDef.h"
+#include    "IfcManifoldSolidBrep.h"
+#include    "IfcMapConversion.h"
+#include    "IfcMappedItem.h"
+#include    "IfcMaterial.h"
+#include    "IfcMaterialClassificationRelationship.h"
+#include    "IfcMaterialConstituent.h"
+#include    "IfcMaterialConstituentSet.h"
+#include    "IfcMaterialDefinition.h"
+#include    "IfcMaterialDefinitionRepresentation.h"
+#include    "IfcMaterialLayer.h"
+#include    "IfcMaterialLayerSet.h"
+#include    "IfcMaterialLayerSetUsage.h"
+#include    "IfcMaterialLayerWithOffsets.h"
+#include    "IfcMaterialList.h"
+#include    "IfcMaterialProfile.h"
+#include    "IfcMaterialProfileSet.h"
+#include    "IfcMaterialProfileSetUsage.h"
+#include    "IfcMaterialProfileSetUsageTapering.h"
+#include    "IfcMaterialProfileWithOffsets.h"
+#include    "IfcMaterialProperties.h"
+#include    "IfcMaterialRelationship.h"
+#include    "IfcMaterialUsageDefinition.h"
+#include    "IfcMeasureWithUnit.h"
+#include    "IfcMechanicalFastener.h"
+#include    "IfcMechanicalFastenerType.h"
+#include    "IfcMedicalDevice.h"
+#include    "IfcMedicalDeviceType.h"
+#include    "IfcMember.h"
+#include    "IfcMemberStandardCase.h"
+#include    "IfcMemberType.h"
+#include    "IfcMetric.h"
+#include    "IfcMirroredProfileDef.h"
+#include    "IfcMonetaryUnit.h"
+#include    "IfcMotorConnection.h"
+#include    "IfcMotorConnectionType.h"
+#include    "IfcNamedUnit.h"
+#include    "IfcObject.h"
+#include    "IfcObjectDefinition.h"
+#include    "IfcObjective.h"
+#include    "IfcObjectPlacement.h"
+#include    "IfcOccupant.h"
+#include    "IfcOffsetCurve2D.h"
+#include    "IfcOffsetCurve3D.h"
+#include    "IfcOpeningElement.h"
+#include    "IfcOpeningStandardCase.h"
+#include    "IfcOpenShell.h"
+#include    "IfcOrganization.h"
+#include    "IfcOrganizationRelationship.h"
+#include    "IfcOrientedEdge.h"
+#include    "IfcOuterBoundaryCurve.h"
+#include    "IfcOutlet.h"
+#include    "IfcOutletType.h"
+#include    "IfcOwnerHistory.h"
+#include    "IfcParameterizedProfileDef.h"
+#include    "IfcPath.h"
+#include    "IfcPcurve.h"
+#include    "IfcPerformanceHistory.h"
+#include    "IfcPermeableCoveringProperties.h"
+#include    "IfcPermit.h"
+#include    "IfcPerson.h"
+#include    "IfcPersonAndOrganization.h"
+#include    "IfcPhysicalComplexQuantity.h"
+#include    "IfcPhysicalQuantity.h"
+#include    "IfcPhysicalSimpleQuantity.h"
+#include    "IfcPile.h"
+#include    "IfcPileType.h"
+#include    "IfcPipeFitting.h"
+#include    "IfcPipeFittingType.h"
+#include    "IfcPipeSegment.h"
+#include    "IfcPipeSegmentType.h"
+#include    "IfcPixelTexture.h"
+#include    "IfcPlacement.h"
+#include    "IfcPlanarBox.h"
+#include    "IfcPlanarExtent.h"
+#include    "IfcPlane.h"
+#include    "IfcPlate.h"
+#include    "IfcPlateStandardCase.h"
+#include    "IfcPlateType.h"
+#include    "IfcPoint.h"
+#include    "IfcPointOnCurve.h"
+#include    "IfcPointOnSurface.h"
+#include    "IfcPolygonalBoundedHalfSpace.h"
+#include    "IfcPolygonalFaceSet.h"
+#include    "IfcPolyline.h"
+#include    "IfcPolyLoop.h"
+#include    "IfcPort.h"
+#include    "IfcPostalAddress.h"
+#include    "IfcPreDefinedColour.h"
+#include    "IfcPreDefinedCurveFont.h"
+#include    "IfcPreDefinedItem.h"
+#include    "IfcPreDefinedProperties.h"
+#include    "IfcPreDefinedPropertySet.h"
+#include    "IfcPreDefinedTextFont.h"
+#include    "IfcPresentationItem.h"
+#include    "IfcPresentationLayerAssignment.h"
+#include    "IfcPresentationLayerWithStyle.h"
+#include    "IfcPresentationStyle.h"
+#include    "IfcPresentationStyleAssignment.h"
+#include    "IfcProcedure.h"
+#include    "IfcProcedureType.h"
+#include    "IfcProcess.h"
+#include    "IfcProduct.h"
+#include    "IfcProductDefinitionShape.h"
+#include    "IfcProductRepresentation.h"
+#include    "IfcProfileDef.h"
+#include    "IfcProfileProperties.h"
+#include    "IfcProject.h"
+#include    "IfcProjectedCRS.h"
+#include    "IfcProjectionElement.h"
+#include    "IfcProjectLibrary.h"
+#include    "IfcProjectOrder.h"
+#include    "IfcProperty.h"
+#include    "IfcPropertyAbstraction.h"
+#include    "IfcPropertyBoundedValue.h"
+#include    "IfcPropertyDefinition.h"
+#include    "IfcPropertyDependencyRelationship.h"
+#include    "IfcPropertyEnumeratedValue.h"
+#include    "IfcPropertyEnumeration.h"
+#include    "IfcPropertyListValue.h"
+#include    "IfcPropertyReferenceValue.h"
+#include    "IfcPropertySet.h"
+#include    "IfcPropertySetDefinition.h"
+#include    "IfcPropertySetTemplate.h"
+#include    "IfcPropertySingleValue.h"
+#include    "IfcPropertyTableValue.h"
+#include    "IfcPropertyTemplate.h"
+#include    "IfcPropertyTemplateDefinition.h"
+#include    "IfcProtectiveDevice.h"
+#include    "IfcProtectiveDeviceTrippingUnit.h"
+#include    "IfcProtectiveDeviceTrippingUnitType.h"
+#include    "IfcProtectiveDeviceType.h"
+#include    "IfcProxy.h"
+#include    "IfcPump.h"
+#include    "IfcPumpType.h"
+#include    "IfcQuantityArea.h"
+#include    "IfcQuantityCount.h"
+#include    "IfcQuantityLength.h"
+#include    "IfcQuantitySet.h"
+#include    "IfcQuantityTime.h"
+#include    "IfcQuantityVolume.h"
+#include    "IfcQuantityWeight.h"
+#include    "IfcRailing.h"
+#include    "IfcRailingType.h"
+#include    "IfcRamp.h"
+#include    "IfcRampFlight.h"
+#include    "IfcRampFlightType.h"
+#include    "IfcRampType.h"
+#include    "IfcRationalBSplineCurveWithKnots.h"
+#include    "IfcRationalBSplineSurfaceWithKnots.h"
+#include    "IfcRectangleHollowProfileDef.h"
+#include    "IfcRectangleProfileDef.h"
+#include    "IfcRectangularPyramid.h"
+#include    "IfcRectangularTrimmedSurface.h"
+#include    "IfcRecurrencePattern.h"
+#include    "IfcReference.h"
+#include    "IfcRegularTimeSeries.h"
+#include    "IfcReinforcementBarProperties.h"
+#include    "IfcReinforcementDefinitionProperties.h"
+#include    "IfcReinforcingBar.h"
+#include    "IfcReinforcingBarType.h"
+#include    "IfcReinforcingElement.h"
+#include    "IfcReinforcingElementType.h"
+#include    "IfcReinforcingMesh.h"
+#include    "IfcReinforcingMeshType.h"
+#include    "IfcRelAggregates.h"
+#include    "IfcRelAssigns.h"
+#include    "IfcRelAssignsToActor.h"
+#include    "IfcRelAssignsToControl.h"
+#include    "IfcRelAssignsToGroup.h"
+#include    "IfcRelAssignsToGroupByFactor.h"
+#include    "IfcRelAssignsToProcess.h"
+#include    "IfcRelAssignsToProduct.h"
+#include    "IfcRelAssignsToResource.h"
+#include    "IfcRelAssociates.h"
+#include    "IfcRelAssociatesApproval.h"
+#include    "IfcRelAssociatesClassification.h"
+#include    "IfcRelAssociatesConstraint.h"
+#include    "IfcRelAssociatesDocument.h"
+#include    "IfcRelAssociatesLibrary.h"
+#include    "IfcRelAssociatesMaterial.h"
+#include    "IfcRelationship.h"
+#include    "IfcRelConnects.h"
+#include    "IfcRelConnectsElements.h"
+#include    "IfcRelConnectsPathElements.h"
+#include    "IfcRelConnectsPorts.h"
+#include    "IfcRelConnectsPortToElement.h"
+#include    "IfcRelConnectsStructuralActivity.h"
+#include    "IfcRelConnectsStructuralMember.h"
+#include    "IfcRelConnectsWithEccentricity.h"
+#include    "IfcRelConnectsWithRealizingElements.h"
+#include    "IfcRelContainedInSpatialStructure.h"
+#include    "IfcRelCoversBldgElements.h"
+#include    "IfcRelCoversSpaces.h"
+#include    "IfcRelDeclares.h"
+#include    "IfcRelDecomposes.h"
+#include    "IfcRelDefines.h"
+#include    "IfcRelDefinesByObject.h"
+#include    "IfcRelDefinesByProperties.h"
+#include    "IfcRelDefinesByTemplate.h"
+#include    "IfcRelDefinesByType.h"
+#include    "IfcRelFillsElement.h"
+#include    "IfcRelFlowControlElements.h"
+#include    "IfcRelInterferesElements.h"
+#include    "IfcRelNests.h"
+#include    "IfcRelProjectsElement.h"
+#include    "IfcRelReferencedInSpatialStructure.h"
+#include    "IfcRelSequence.h"
+#include    "IfcRelServicesBuildings.h"
+#include    "IfcRelSpaceBoundary.h"
+#include    "IfcRelSpaceBoundary1stLevel.h"
+#include    "IfcRelSpaceBoundary2ndLevel.h"
+#include    "IfcRelVoidsElement.h"
+#include    "IfcReparametrisedCompositeCurveSegment.h"
+#include    "IfcRepresentation.h"
+#include    "IfcRepresentationContext.h"
+#include    "IfcRepresentationItem.h"
+#include    "IfcRepresentationMap.h"
+#include    "IfcResource.h"
+#include    "IfcResourceApprovalRelationship.h"
+#include    "IfcResourceConstraintRelationship.h"
+#include    "IfcResourceLevelRelationship.h"
+#include    "IfcResourceTime.h"
+#include    "IfcRevolvedAreaSolid.h"
+#include    "IfcRevolvedAreaSolidTapered.h"
+#include    "IfcRightCircularCone.h"
+#include    "IfcRightCircularCylinder.h"
+#include    "IfcRoof.h"
+#include    "IfcRoofType.h"
+#include    "IfcRoot.h"
+#include    "IfcRoundedRectangleProfileDef.h"
+#include    "IfcSanitaryTerminal.h"
+#include    "IfcSanitaryTerminalType.h"
+#include    "IfcSchedulingTime.h"
+#include    "IfcSeamCurve.h"
+#include    "IfcSectionedSpine.h"
+#include    "IfcSectionProperties.h"
+#include    "IfcSectionReinforcementProperties.h"
+#include    "IfcSensor.h"
+#include    "IfcSensorType.h"
+#include    "IfcShadingDevice.h"
+#include    "IfcShadingDeviceType.h"
+#include    "IfcShapeAspect.h"
+#include    "IfcShapeModel.h"
+#include    "IfcShapeRepresentation.h"
+#include    "IfcShellBasedSurfaceModel.h"
+#include    "IfcSimpleProperty.h"
+#include    "IfcSimplePropertyTemplate.h"
+#include    "IfcSite.h"
+#include    "IfcSIUnit.h"
+#include    "IfcSlab.h"
+#include    "IfcSlabElementedCase.h"
+#include    "IfcSlabStandardCase.h"
+#include    "IfcSlabType.h"
+#include    "IfcSlippageConnectionCondition.h"
+#include    "IfcSolarDevice.h"
+#include    "IfcSolarDeviceType.h"
+#include    "IfcSolidModel.h"
+#include    "IfcSpace.h"
+#include    "IfcSpaceHeater.h"
+#include    "IfcSpaceHeaterType.h"
+#include    "IfcSpaceType.h"
+#include    "IfcSpatialElement.h"
+#include    "IfcSpatialElementType.h"
+#include    "IfcSpatialStructureElement.h"
+#include    "IfcSpatialStructureElementType.h"
+#include    "IfcSpatialZone.h"
+#include    "IfcSpatialZoneType.h"
+#include    "IfcSphere.h"
+#include    "IfcSphericalSurface.h"
+#include    "IfcStackTerminal.h"
+#include    "IfcStackTerminalType.h"
+#include    "IfcStair.h"
+#include    "IfcStairFlight.h"
+#include    "IfcStairFlightType.h"
+#include    "IfcStairType.h"
+#include    "IfcStructuralAction.h"
+#include    "IfcStructuralActivity.h"
+#include    "IfcStructuralAnalysisModel.h"
+#include    "IfcStructuralConnection.h"
+#include    "IfcStructuralConnectionCondition.h"
+#include    "IfcStructuralCurveAction.h"
+#include    "IfcStructuralCurveConnection.h"
+#include    "IfcStructuralCurveMember.h"
+#include    "IfcStructuralCurveMemberVarying.h"
+#include    "IfcStructuralCurveReaction.h"
+#include    "IfcStructuralItem.h"
+#include    "IfcStructuralLinearAction.h"
+#include    "IfcStructuralLoad.h"
+#include    "IfcStructuralLoadCase.h"
+#include    "IfcStructuralLoadConfiguration.h"
+#include    "IfcStructuralLoadGroup.h"
+#include    "IfcStructuralLoadLinearForce.h"
+#include    "IfcStructuralLoadOrResult.h"
+#include    "IfcStructuralLoadPlanarForce.h"
+#include    "IfcStructuralLoadSingleDisplacement.h"
+#include    "IfcStructuralLoadSingleDisplacementDistortion.h"
+#include    "IfcStructuralLoadSingleForce.h"
+#include    "IfcStructuralLoadSingleForceWarping.h"
+#include    "IfcStructuralLoadStatic.h"
+#include    "IfcStructuralLoadTemperature.h"
+#include    "IfcStructuralMember.h"
+#include    "IfcStructuralPlanarAction.h"
+#include    "IfcStructuralPointAction.h"
+#include    "IfcStructuralPointConnection.h"
+#include    "IfcStructuralPointReaction.h"
+#include    "IfcStructuralReaction.h"
+#include    "IfcStructuralResultGroup.h"
+#include    "IfcStructuralSurfaceAction.h"
+#include    "IfcStructuralSurfaceConnection.h"
+#include    "IfcStructuralSurfaceMember.h"
+#include    "IfcStructuralSurfaceMemberVarying.h"
+#include    "IfcStructuralSurfaceReaction.h"
+#include    "IfcStyledItem.h"
+#include    "IfcStyledRepresentation.h"
+#include    "IfcStyleModel.h"
+#include    "IfcSubContractResource.h"
+#include    "IfcSubContractResourceType.h"
+#include    "IfcSubedge.h"
+#include    "IfcSurface.h"
+#include    "IfcSurfaceCurve.h"
+#include    "IfcSurfaceCurveSweptAreaSolid.h"
+#include    "IfcSurfaceFeature.h"
+#include    "IfcSurfaceOfLinearExtrusion.h"
+#include    "IfcSurfaceOfRevolution.h"
+#include    "IfcSurfaceReinforcementArea.h"
+#include    "IfcSurfaceStyle.h"
+#include    "IfcSurfaceStyleLighting.h"
+#include    "IfcSurfaceStyleRefraction.h"
+#include    "IfcSurfaceStyleRendering.h"
+#include    "IfcSurfaceStyleShading.h"
+#include    "IfcSurfaceStyleWithTextures.h"
+#include    "IfcSurfaceTexture.h"
+#include    "IfcSweptAreaSolid.h"
+#include    "IfcSweptDiskSolid.h"
+#include    "IfcSweptDiskSolidPolygonal.h"
+#include    "IfcSweptSurface.h"
+#include    "IfcSwitchingDevice.h"
+#include    "IfcSwitchingDeviceType.h"
+#include    "IfcSystem.h"
+#include    "IfcSystemFurnitureElement.h"
+#include    "IfcSystemFurnitureElementType.h"
+#include    "IfcTable.h"
+#include    "IfcTableColumn.h"
+#include    "IfcTableRow.h"
+#include    "IfcTank.h"
+#include    "IfcTankType.h"
+#include    "IfcTask.h"
+#include    "IfcTaskTime.h"
+#include    "IfcTaskTimeRecurring.h"
+#include    "IfcTaskType.h"
+#include    "IfcTelecomAddress.h"
+#include    "IfcTendon.h"
+#include    "IfcTendonAnchor.h"
+#include    "IfcTendonAnchorType.h"
+#include    "IfcTendonType.h"
+#include    "IfcTessellatedFaceSet.h"
+#include    "IfcTessellatedItem.h"
+#include    "IfcTextLiteral.h"
+#include    "IfcTextLiteralWithExtent.h"
+#include    "IfcTextStyle.h"
+#include    "IfcTextStyleFontModel.h"
+#include    "IfcTextStyleForDefinedFont.h"
+#include    "IfcTextStyleTextModel.h"
+#include    "IfcTextureCoordinate.h"
+#include    "IfcTextureCoordinateGenerator.h"
+#include    "IfcTextureMap.h"
+#include    "IfcTextureVertex.h"
+#include    "IfcTextureVertexList.h"
+#include    "IfcTimePeriod.h"
+#include    "IfcTimeSeries.h"
+#include    "IfcTimeSeriesValue.h"
+#include    "IfcTopologicalRepresentationItem.h"
+#include    "IfcTopologyRepresentation.h"
+#include    "IfcToroidalSurface.h"
+#include    "IfcTransformer.h"
+#include    "IfcTransformerType.h"
+#include    "IfcTransportElement.h"
+#include    "IfcTransportElementType.h"
+#include    "IfcTrapeziumProfileDef.h"
+#include    "IfcTriangulatedFaceSet.h"
+#include    "IfcTrimmedCurve.h"
+#include    "IfcTShapeProfileDef.h"
+#include    "IfcTubeBundle.h"
+#include    "IfcTubeBundleType.h"
+#include    "IfcTypeObject.h"
+#include    "IfcTypeProcess.h"
+#include    "IfcTypeProduct.h"
+#include    "IfcTypeResource.h"
+#include    "IfcUnitaryControlElement.h"
+#include    "IfcUnitaryControlElementType.h"
+#include    "IfcUnitaryEquipment.h"
+#include    "IfcUnitaryEquipmentType.h"
+#include    "IfcUnitAssignment.h"
+#include    "IfcUShapeProfileDef.h"
+#include    "IfcValve.h"
+#include    "IfcValveType.h"
+#include    "IfcVector.h"
+#include    "IfcVertex.h"
+#include    "IfcVertexLoop.h"
+#include    "IfcVertexPoint.h"
+#include    "IfcVibrationIsolator.h"
+#include    "IfcVibrationIsolatorType.h"
+#include    "IfcVirtualElement.h"
+#include    "IfcVirtualGridIntersection.h"
+#include    "IfcVoidingFeature.h"
+#include    "IfcWall.h"
+#include    "IfcWallElementedCase.h"
+#include    "IfcWallStandardCase.h"
+#include    "IfcWallType.h"
+#include    "IfcWasteTerminal.h"
+#include    "IfcWasteTerminalType.h"
+#include    "IfcWindow.h"
+#include    "IfcWindowLiningProperties.h"
+#include    "IfcWindowPanelProperties.h"
+#include    "IfcWindowStandardCase.h"
+#include    "IfcWindowStyle.h"
+#include    "IfcWindowType.h"
+#include    "IfcWorkCalendar.h"
+#include    "IfcWorkControl.h"
+#include    "IfcWorkPlan.h"
+#include    "IfcWorkSchedule.h"
+#include    "IfcWorkTime.h"
+#include    "IfcZone.h"
+#include    "IfcZShapeProfileDef.h"
+
+namespace IFC4
+{
+    //
+    // Explicit instantiations of aggregation serializers with generated aggregation types as TList
+    // Compile IFC4_serializers.cpp once and define RDF_EXPRESS_EXTERN_SERIALIZERS in other translation units
+    //
+#if defined(RDF_EXPRESS_INSTANTIATE_SERIALIZERS)
+#define RDF_EXPRESS_SERIALIZER template class
+#elif defined(RDF_EXPRESS_EXTERN_SERIALIZERS)
+#define RDF_EXPRESS_SERIALIZER extern template class
+#endif
+#ifdef RDF_EXPRESS_SERIALIZER
+    RDF_EXPRESS_SERIALIZER AggrSerializerSimple<IfcArcIndex, IfcPositiveInteger, sdaiINTEGER>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSimple<IfcComplexNumber, double, sdaiREAL>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<IfcPropertySetDefinitionSet, IfcPropertySetDefinition>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAssigns, IfcRelAssigns>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelNests, IfcRelNests>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelDeclares, IfcRelDeclares>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAggregates, IfcRelAggregates>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAssociates, IfcRelAssociates>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelDefinesByObject, IfcRelDefinesByObject>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelDefinesByType, IfcRelDefinesByType>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelDefinesByProperties, IfcRelDefinesByProperties>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAssignsToControl, IfcRelAssignsToControl>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAssignsToActor, IfcRelAssignsToActor>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcExternalReferenceRelationship, IfcExternalReferenceRelationship>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAssignsToProduct, IfcRelAssignsToProduct>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelFillsElement, IfcRelFillsElement>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelConnectsElements, IfcRelConnectsElements>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelInterferesElements, IfcRelInterferesElements>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelProjectsElement, IfcRelProjectsElement>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelReferencedInSpatialStructure, IfcRelReferencedInSpatialStructure>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelVoidsElement, IfcRelVoidsElement>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelConnectsWithRealizingElements, IfcRelConnectsWithRealizingElements>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelSpaceBoundary, IfcRelSpaceBoundary>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelContainedInSpatialStructure, IfcRelContainedInSpatialStructure>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelCoversBldgElements, IfcRelCoversBldgElements>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelConnectsPortToElement, IfcRelConnectsPortToElement>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelFlowControlElements, IfcRelFlowControlElements>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcRepresentationMap, IfcRepresentationMap>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcPerson, IfcPerson>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcOrganization, IfcOrganization>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcPresentationLayerAssignment, IfcPresentationLayerAssignment>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcStyledItem, IfcStyledItem>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcClosedShell, IfcClosedShell>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcFaceBound, IfcFaceBound>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcTextureMap, IfcTextureMap>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcCurve, IfcCurve>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcAppliedValue, IfcAppliedValue>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAssociatesApproval, IfcRelAssociatesApproval>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcResourceApprovalRelationship, IfcResourceApprovalRelationship>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcApprovalRelationship, IfcApprovalRelationship>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcApproval, IfcApproval>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcProfileProperties, IfcProfileProperties>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAssignsToGroup, IfcRelAssignsToGroup>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcDirection, IfcDirection>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerText<ListOfIfcIdentifier, IfcIdentifier, sdaiSTRING>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcTextureCoordinate, IfcTextureCoordinate>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcSurfaceStyleWithTextures, IfcSurfaceStyleWithTextures>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcCompositeCurveSegment, IfcCompositeCurveSegment>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcSurface, IfcSurface>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcCartesianPoint, IfcCartesianPoint>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerAggr<ListOfListOfIfcCartesianPoint, ListOfIfcCartesianPoint, ListOfIfcCartesianPointSerializer<ListOfIfcCartesianPoint>>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerAggr<ArrayOfArrayOfIfcCartesianPoint, ArrayOfIfcCartesianPoint, ArrayOfIfcCartesianPointSerializer<ArrayOfIfcCartesianPoint>>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelServicesBuildings, IfcRelServicesBuildings>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerAggr<ListOfListOfIfcLengthMeasure, ListOfIfcLengthMeasure, ListOfIfcLengthMeasureSerializer<ListOfIfcLengthMeasure>>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAssociatesClassification, IfcRelAssociatesClassification>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcClassificationReference, IfcClassificationReference>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcFace, IfcFace>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerAggr<ListOfListOfIfcNormalisedRatioMeasure, ListOfIfcNormalisedRatioMeasure, ListOfIfcNormalisedRatioMeasureSerializer<ListOfIfcNormalisedRatioMeasure>>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcPropertySet, IfcPropertySet>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcPropertyDependencyRelationship, IfcPropertyDependencyRelationship>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcComplexProperty, IfcComplexProperty>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcResourceConstraintRelationship, IfcResourceConstraintRelationship>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcProperty, IfcProperty>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcComplexPropertyTemplate, IfcComplexPropertyTemplate>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcPropertySetTemplate, IfcPropertySetTemplate>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcPropertyTemplate, IfcPropertyTemplate>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcCompositeCurve, IfcCompositeCurve>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcProfileDef, IfcProfileDef>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAssignsToResource, IfcRelAssignsToResource>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRepresentationContext, IfcRepresentationContext>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcCoordinateOperation, IfcCoordinateOperation>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcCostValue, IfcCostValue>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcPhysicalQuantity, IfcPhysicalQuantity>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelCoversSpaces, IfcRelCoversSpaces>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcBoundaryCurve, IfcBoundaryCurve>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcCurveStyleFontPattern, IfcCurveStyleFontPattern>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcDerivedUnitElement, IfcDerivedUnitElement>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelConnectsPorts, IfcRelConnectsPorts>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<SetOfIfcActorSelect, IfcActorSelect>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAssociatesDocument, IfcRelAssociatesDocument>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcDocumentReference, IfcDocumentReference>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcDocumentInformationRelationship, IfcDocumentInformationRelationship>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcDocumentInformation, IfcDocumentInformation>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcTypeObject, IfcTypeObject>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelDefinesByTemplate, IfcRelDefinesByTemplate>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcOrientedEdge, IfcOrientedEdge>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelSequence, IfcRelSequence>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAssignsToProcess, IfcRelAssignsToProcess>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<SetOfIfcResourceObjectSelect, IfcResourceObjectSelect>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcConnectedFaceSet, IfcConnectedFaceSet>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<SetOfIfcFillStyleSelect, IfcFillStyleSelect>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcVector, IfcVector>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<SetOfIfcGeometricSetSelect, IfcGeometricSetSelect>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRepresentation, IfcRepresentation>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcGeometricRepresentationSubContext, IfcGeometricRepresentationSubContext>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcGridAxis, IfcGridAxis>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcGrid, IfcGrid>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcVirtualGridIntersection, IfcVirtualGridIntersection>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcProduct, IfcProduct>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcLocalPlacement, IfcLocalPlacement>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<ListOfIfcSegmentIndexSelect, IfcSegmentIndexSelect>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcPolygonalFaceSet, IfcPolygonalFaceSet>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerAggr<ListOfListOfIfcPositiveInteger, ListOfIfcPositiveInteger, ListOfIfcPositiveIntegerSerializer<ListOfIfcPositiveInteger>>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcSurfaceTexture, IfcSurfaceTexture>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcPcurve, IfcPcurve>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcIrregularTimeSeriesValue, IfcIrregularTimeSeriesValue>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<ListOfIfcValue, IfcValue>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAssociatesLibrary, IfcRelAssociatesLibrary>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcLibraryReference, IfcLibraryReference>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcLightDistributionData, IfcLightDistributionData>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelAssociatesMaterial, IfcRelAssociatesMaterial>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcMaterialProperties, IfcMaterialProperties>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcMaterialDefinitionRepresentation, IfcMaterialDefinitionRepresentation>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcMaterialRelationship, IfcMaterialRelationship>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<SetOfIfcClassificationSelect, IfcClassificationSelect>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcMaterialConstituent, IfcMaterialConstituent>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcMaterialLayer, IfcMaterialLayer>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcMaterial, IfcMaterial>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcMaterialProfile, IfcMaterialProfile>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcConstraint, IfcConstraint>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcActorRole, IfcActorRole>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcAddress, IfcAddress>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcOrganizationRelationship, IfcOrganizationRelationship>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcPersonAndOrganization, IfcPersonAndOrganization>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcPhysicalComplexQuantity, IfcPhysicalComplexQuantity>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerText<ListOfIfcBinary, IfcBinary, sdaiBINARY>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcIndexedColourMap, IfcIndexedColourMap>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcIndexedTextureMap, IfcIndexedTextureMap>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcIndexedPolygonalFace, IfcIndexedPolygonalFace>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<SetOfIfcLayeredItem, IfcLayeredItem>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcPresentationStyle, IfcPresentationStyle>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<SetOfIfcPresentationStyleSelect, IfcPresentationStyleSelect>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcShapeAspect, IfcShapeAspect>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerAggr<ListOfListOfIfcReal, ListOfIfcReal, ListOfIfcRealSerializer<ListOfIfcReal>>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerAggr<ArrayOfArrayOfIfcReal, ArrayOfIfcReal, ArrayOfIfcRealSerializer<ArrayOfIfcReal>>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcTimePeriod, IfcTimePeriod>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcTimeSeriesValue, IfcTimeSeriesValue>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcSectionReinforcementProperties, IfcSectionReinforcementProperties>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<ListOfIfcBendingParameterSelect, IfcBendingParameterSelect>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcObjectDefinition, IfcObjectDefinition>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<SetOfIfcDefinitionSelect, IfcDefinitionSelect>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcElement, IfcElement>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcCovering, IfcCovering>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcObject, IfcObject>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcDistributionControlElement, IfcDistributionControlElement>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcSpatialElement, IfcSpatialElement>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelSpaceBoundary1stLevel, IfcRelSpaceBoundary1stLevel>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelSpaceBoundary2ndLevel, IfcRelSpaceBoundary2ndLevel>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRepresentationItem, IfcRepresentationItem>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcProductRepresentation, IfcProductRepresentation>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcMappedItem, IfcMappedItem>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcAxis2Placement3D, IfcAxis2Placement3D>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcReinforcementBarProperties, IfcReinforcementBarProperties>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcShapeModel, IfcShapeModel>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<SetOfIfcShell, IfcShell>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelConnectsStructuralActivity, IfcRelConnectsStructuralActivity>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcStructuralLoadGroup, IfcStructuralLoadGroup>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcStructuralResultGroup, IfcStructuralResultGroup>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcRelConnectsStructuralMember, IfcRelConnectsStructuralMember>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcStructuralAnalysisModel, IfcStructuralAnalysisModel>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcStructuralLoadOrResult, IfcStructuralLoadOrResult>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<SetOfIfcStyleAssignmentSelect, IfcStyleAssignmentSelect>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<SetOfIfcSurfaceStyleElementSelect, IfcSurfaceStyleElementSelect>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcTableRow, IfcTableRow>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcTableColumn, IfcTableColumn>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<ListOfIfcTextureVertex, IfcTextureVertex>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerAggr<ListOfListOfIfcParameterValue, ListOfIfcParameterValue, ListOfIfcParameterValueSerializer<ListOfIfcParameterValue>>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<SetOfIfcTrimmingSelect, IfcTrimmingSelect>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<SetOfIfcUnit, IfcUnit>;
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<SetOfIfcWorkTime, IfcWorkTime>;
+#undef RDF_EXPRESS_SERIALIZER
+#endif
+
+    /// <summary>
+    /// Calls visitor with object of the exact entity class of the instance: visitor(IfcWall), visitor(IfcDoor)...
+    /// Dispatches by entity ordinal, overloads of visitor for supertypes accept sub-entities by conversion
+    /// Returns false if the instance is NULL or its entity is not from this schema
+    /// </summary>
+    template <typename TVisitor> bool Visit(SdaiInstance instance, TVisitor&& visitor)
+    {
+        if (!instance) {
+            return false;
+        }
+
+        switch (EntityTypeTable::GetTypeOrdinal(instance)) {
+            case 0: visitor(Entity::Unchecked<IfcActionRequest>(instance)); return true;
+            case 1: visitor(Entity::Unchecked<IfcActor>(instance)); return true;
+            case 2: visitor(Entity::Unchecked<IfcActorRole>(instance)); return true;
+            case 3: visitor(Entity::Unchecked<IfcActuator>(instance)); return true;
+            case 4: visitor(Entity::Unchecked<IfcActuatorType>(instance)); return true;
+            case 6: visitor(Entity::Unchecked<IfcAdvancedBrep>(instance)); return true;
+            case 7: visitor(Entity::Unchecked<IfcAdvancedBrepWithVoids>(instance)); return true;
+            case 8: visitor(Entity::Unchecked<IfcAdvancedFace>(instance)); return true;
+            case 9: visitor(Entity::Unchecked<IfcAirTerminal>(instance)); return true;
+            case 10: visitor(Entity::Unchecked<IfcAirTerminalBox>(instance)); return true;
+            case 11: visitor(Entity::Unchecked<IfcAirTerminalBoxType>(instance)); return true;
+            case 12: visitor(Entity::Unchecked<IfcAirTerminalType>(instance)); return true;
+            case 13: visitor(Entity::Unchecked<IfcAirToAirHeatRecovery>(instance)); return true;
+            case 14: visitor(Entity::Unchecked<IfcAirToAirHeatRecoveryType>(instance)); return true;
+            case 15: visitor(Entity::Unchecked<IfcAlarm>(instance)); return true;
+            case 16: visitor(Entity::Unchecked<IfcAlarmType>(instance)); return true;
+            case 17: visitor(Entity::Unchecked<IfcAnnotation>(instance)); return true;
+            case 18: visitor(Entity::Unchecked<IfcAnnotationFillArea>(instance)); return true;
+            case 19: visitor(Entity::Unchecked<IfcApplication>(instance)); return true;
+            case 20: visitor(Entity::Unchecked<IfcAppliedValue>(instance)); return true;
+            case 21: visitor(Entity::Unchecked<IfcApproval>(instance)); return true;
+            case 22: visitor(Entity::Unchecked<IfcApprovalRelationship>(instance)); return true;
+            case 23: visitor(Entity::Unchecked<IfcArbitraryClosedProfileDef>(instance)); return true;
+            case 24: visitor(Entity::Unchecked<IfcArbitraryOpenProfileDef>(instance)); return true;
+            case 25: visitor(Entity::Unchecked<IfcArbitraryProfileDefWithVoids>(instance)); return true;
+            case 26: visitor(Entity::Unchecked<IfcAsset>(instance)); return true;
+            case 27: visitor(Entity::Unchecked<IfcAsymmetricIShapeProfileDef>(instance)); return true;
+            case 28: visitor(Entity::Unchecked<IfcAudioVisualAppliance>(instance)); return true;
+            case 29: visitor(Entity::Unchecked<IfcAudioVisualApplianceType>(instance)); return true;
+            case 30: visitor(Entity::Unchecked<IfcAxis1Placement>(instance)); return true;
+            case 31: visitor(Entity::Unchecked<IfcAxis2Placement2D>(instance)); return true;
+            case 32: visitor(Entity::Unchecked<IfcAxis2Placement3D>(instance)); return true;
+            case 33: visitor(Entity::Unchecked<IfcBeam>(instance)); return true;
+            case 34: visitor(Entity::Unchecked<IfcBeamStandardCase>(instance)); return true;
+            case 35: visitor(Entity::Unchecked<IfcBeamType>(instance)); return true;
+            case 36: visitor(Entity::Unchecked<IfcBlobTexture>(instance)); return true;
+            case 37: visitor(Entity::Unchecked<IfcBlock>(instance)); return true;
+            case 38: visitor(Entity::Unchecked<IfcBoiler>(instance)); return true;
+            case 39: visitor(Entity::Unchecked<IfcBoilerType>(instance)); return true;
+            case 40: visitor(Entity::Unchecked<IfcBooleanClippingResult>(instance)); return true;
+            case 41: visitor(Entity::Unchecked<IfcBooleanResult>(instance)); return true;
+            case 43: visitor(Entity::Unchecked<IfcBoundaryCurve>(instance)); return true;
+            case 44: visitor(Entity::Unchecked<IfcBoundaryEdgeCondition>(instance)); return true;
+            case 45: visitor(Entity::Unchecked<IfcBoundaryFaceCondition>(instance)); return true;
+            case 46: visitor(Entity::Unchecked<IfcBoundaryNodeCondition>(instance)); return true;
+            case 47: visitor(Entity::Unchecked<IfcBoundaryNodeConditionWarping>(instance)); return true;
+            case 50: visitor(Entity::Unchecked<IfcBoundingBox>(instance)); return true;
+            case 51: visitor(Entity::Unchecked<IfcBoxedHalfSpace>(instance)); return true;
+            case 53: visitor(Entity::Unchecked<IfcBSplineCurveWithKnots>(instance)); return true;
+            case 55: visitor(Entity::Unchecked<IfcBSplineSurfaceWithKnots>(instance)); return true;
+            case 56: visitor(Entity::Unchecked<IfcBuilding>(instance)); return true;
+            case 58: visitor(Entity::Unchecked<IfcBuildingElementPart>(instance)); return true;
+            case 59: visitor(Entity::Unchecked<IfcBuildingElementPartType>(instance)); return true;
+            case 60: visitor(Entity::Unchecked<IfcBuildingElementProxy>(instance)); return true;
+            case 61: visitor(Entity::Unchecked<IfcBuildingElementProxyType>(instance)); return true;
+            case 63: visitor(Entity::Unchecked<IfcBuildingStorey>(instance)); return true;
+            case 64: visitor(Entity::Unchecked<IfcBuildingSystem>(instance)); return true;
+            case 65: visitor(Entity::Unchecked<IfcBurner>(instance)); return true;
+            case 66: visitor(Entity::Unchecked<IfcBurnerType>(instance)); return true;
+            case 67: visitor(Entity::Unchecked<IfcCableCarrierFitting>(instance)); return true;
+            case 68: visitor(Entity::Unchecked<IfcCableCarrierFittingType>(instance)); return true;
+            case 69: visitor(Entity::Unchecked<IfcCableCarrierSegment>(instance)); return true;
+            case 70: visitor(Entity::Unchecked<IfcCableCarrierSegmentType>(instance)); return true;
+            case 71: visitor(Entity::Unchecked<IfcCableFitting>(instance)); return true;
+            case 72: visitor(Entity::Unchecked<IfcCableFittingType>(instance)); return true;
+            case 73: visitor(Entity::Unchecked<IfcCableSegment>(instance)); return true;
+            case 74: visitor(Entity::Unchecked<IfcCableSegmentType>(instance)); return true;
+            case 75: visitor(Entity::Unchecked<IfcCartesianPoint>(instance)); return true;
+            case 77: visitor(Entity::Unchecked<IfcCartesianPointList2D>(instance)); return true;
+            case 78: visitor(Entity::Unchecked<IfcCartesianPointList3D>(instance)); return true;
+            case 80: visitor(Entity::Unchecked<IfcCartesianTransformationOperator2D>(instance)); return true;
+            case 81: visitor(Entity::Unchecked<IfcCartesianTransformationOperator2DnonUniform>(instance)); return true;
+            case 82: visitor(Entity::Unchecked<IfcCartesianTransformationOperator3D>(instance)); return true;
+            case 83: visitor(Entity::Unchecked<IfcCartesianTransformationOperator3DnonUniform>(instance)); return true;
+            case 84: visitor(Entity::Unchecked<IfcCenterLineProfileDef>(instance)); return true;
+            case 85: visitor(Entity::Unchecked<IfcChiller>(instance)); return true;
+            case 86: visitor(Entity::Unchecked<IfcChillerType>(instance)); return true;
+            case 87: visitor(Entity::Unchecked<IfcChimney>(instance)); return true;
+            case 88: visitor(Entity::Unchecked<IfcChimneyType>(instance)); return true;
+            case 89: visitor(Entity::Unchecked<IfcCircle>(instance)); return true;
+            case 90: visitor(Entity::Unchecked<IfcCircleHollowProfileDef>(instance)); return true;
+            case 91: visitor(Entity::Unchecked<IfcCircleProfileDef>(instance)); return true;
+            case 92: visitor(Entity::Unchecked<IfcCivilElement>(instance)); return true;
+            case 93: visitor(Entity::Unchecked<IfcCivilElementType>(instance)); return true;
+            case 94: visitor(Entity::Unchecked<IfcClassification>(instance)); return true;
+            case 95: visitor(Entity::Unchecked<IfcClassificationReference>(instance)); return true;
+            case 96: visitor(Entity::Unchecked<IfcClosedShell>(instance)); return true;
+            case 97: visitor(Entity::Unchecked<IfcCoil>(instance)); return true;
+            case 98: visitor(Entity::Unchecked<IfcCoilType>(instance)); return true;
+            case 99: visitor(Entity::Unchecked<IfcColourRgb>(instance)); return true;
+            case 100: visitor(Entity::Unchecked<IfcColourRgbList>(instance)); return true;
+            case 102: visitor(Entity::Unchecked<IfcColumn>(instance)); return true;
+            case 103: visitor(Entity::Unchecked<IfcColumnStandardCase>(instance)); return true;
+            case 104: visitor(Entity::Unchecked<IfcColumnType>(instance)); return true;
+            case 105: visitor(Entity::Unchecked<IfcCommunicationsAppliance>(instance)); return true;
+            case 106: visitor(Entity::Unchecked<IfcCommunicationsApplianceType>(instance)); return true;
+            case 107: visitor(Entity::Unchecked<IfcComplexProperty>(instance)); return true;
+            case 108: visitor(Entity::Unchecked<IfcComplexPropertyTemplate>(instance)); return true;
+            case 109: visitor(Entity::Unchecked<IfcCompositeCurve>(instance)); return true;
+            case 110: visitor(Entity::Unchecked<IfcCompositeCurveOnSurface>(instance)); return true;
+            case 111: visitor(Entity::Unchecked<IfcCompositeCurveSegment>(instance)); return true;
+            case 112: visitor(Entity::Unchecked<IfcCompositeProfileDef>(instance)); return true;
+            case 113: visitor(Entity::Unchecked<IfcCompressor>(instance)); return true;
+            case 114: visitor(Entity::Unchecked<IfcCompressorType>(instance)); return true;
+            case 115: visitor(Entity::Unchecked<IfcCondenser>(instance)); return true;
+            case 116: visitor(Entity::Unchecked<IfcCondenserType>(instance)); return true;
+            case 118: visitor(Entity::Unchecked<IfcConnectedFaceSet>(instance)); return true;
+            case 119: visitor(Entity::Unchecked<IfcConnectionCurveGeometry>(instance)); return true;
+            case 121: visitor(Entity::Unchecked<IfcConnectionPointEccentricity>(instance)); return true;
+            case 122: visitor(Entity::Unchecked<IfcConnectionPointGeometry>(instance)); return true;
+            case 123: visitor(Entity::Unchecked<IfcConnectionSurfaceGeometry>(instance)); return true;
+            case 124: visitor(Entity::Unchecked<IfcConnectionVolumeGeometry>(instance)); return true;
+            case 126: visitor(Entity::Unchecked<IfcConstructionEquipmentResource>(instance)); return true;
+            case 127: visitor(Entity::Unchecked<IfcConstructionEquipmentResourceType>(instance)); return true;
+            case 128: visitor(Entity::Unchecked<IfcConstructionMaterialResource>(instance)); return true;
+            case 129: visitor(Entity::Unchecked<IfcConstructionMaterialResourceType>(instance)); return true;
+            case 130: visitor(Entity::Unchecked<IfcConstructionProductResource>(instance)); return true;
+            case 131: visitor(Entity::Unchecked<IfcConstructionProductResourceType>(instance)); return true;
+            case 135: visitor(Entity::Unchecked<IfcContextDependentUnit>(instance)); return true;
+            case 137: visitor(Entity::Unchecked<IfcController>(instance)); return true;
+            case 138: visitor(Entity::Unchecked<IfcControllerType>(instance)); return true;
+            case 139: visitor(Entity::Unchecked<IfcConversionBasedUnit>(instance)); return true;
+            case 140: visitor(Entity::Unchecked<IfcConversionBasedUnitWithOffset>(instance)); return true;
+            case 141: visitor(Entity::Unchecked<IfcCooledBeam>(instance)); return true;
+            case 142: visitor(Entity::Unchecked<IfcCooledBeamType>(instance)); return true;
+            case 143: visitor(Entity::Unchecked<IfcCoolingTower>(instance)); return true;
+            case 144: visitor(Entity::Unchecked<IfcCoolingTowerType>(instance)); return true;
+            case 147: visitor(Entity::Unchecked<IfcCostItem>(instance)); return true;
+            case 148: visitor(Entity::Unchecked<IfcCostSchedule>(instance)); return true;
+            case 149: visitor(Entity::Unchecked<IfcCostValue>(instance)); return true;
+            case 150: visitor(Entity::Unchecked<IfcCovering>(instance)); return true;
+            case 151: visitor(Entity::Unchecked<IfcCoveringType>(instance)); return true;
+            case 152: visitor(Entity::Unchecked<IfcCrewResource>(instance)); return true;
+            case 153: visitor(Entity::Unchecked<IfcCrewResourceType>(instance)); return true;
+            case 155: visitor(Entity::Unchecked<IfcCsgSolid>(instance)); return true;
+            case 156: visitor(Entity::Unchecked<IfcCShapeProfileDef>(instance)); return true;
+            case 157: visitor(Entity::Unchecked<IfcCurrencyRelationship>(instance)); return true;
+            case 158: visitor(Entity::Unchecked<IfcCurtainWall>(instance)); return true;
+            case 159: visitor(Entity::Unchecked<IfcCurtainWallType>(instance)); return true;
+            case 161: visitor(Entity::Unchecked<IfcCurveBoundedPlane>(instance)); return true;
+            case 162: visitor(Entity::Unchecked<IfcCurveBoundedSurface>(instance)); return true;
+            case 163: visitor(Entity::Unchecked<IfcCurveStyle>(instance)); return true;
+            case 164: visitor(Entity::Unchecked<IfcCurveStyleFont>(instance)); return true;
+            case 165: visitor(Entity::Unchecked<IfcCurveStyleFontAndScaling>(instance)); return true;
+            case 166: visitor(Entity::Unchecked<IfcCurveStyleFontPattern>(instance)); return true;
+            case 167: visitor(Entity::Unchecked<IfcCylindricalSurface>(instance)); return true;
+            case 168: visitor(Entity::Unchecked<IfcDamper>(instance)); return true;
+            case 169: visitor(Entity::Unchecked<IfcDamperType>(instance)); return true;
+            case 170: visitor(Entity::Unchecked<IfcDerivedProfileDef>(instance)); return true;
+            case 171: visitor(Entity::Unchecked<IfcDerivedUnit>(instance)); return true;
+            case 172: visitor(Entity::Unchecked<IfcDerivedUnitElement>(instance)); return true;
+            case 173: visitor(Entity::Unchecked<IfcDimensionalExponents>(instance)); return true;
+            case 174: visitor(Entity::Unchecked<IfcDirection>(instance)); return true;
+            case 175: visitor(Entity::Unchecked<IfcDiscreteAccessory>(instance)); return true;
+            case 176: visitor(Entity::Unchecked<IfcDiscreteAccessoryType>(instance)); return true;
+            case 177: visitor(Entity::Unchecked<IfcDistributionChamberElement>(instance)); return true;
+            case 178: visitor(Entity::Unchecked<IfcDistributionChamberElementType>(instance)); return true;
+            case 179: visitor(Entity::Unchecked<IfcDistributionCircuit>(instance)); return true;
+            case 180: visitor(Entity::Unchecked<IfcDistributionControlElement>(instance)); return true;
+            case 182: visitor(Entity::Unchecked<IfcDistributionElement>(instance)); return true;
+            case 183: visitor(Entity::Unchecked<IfcDistributionElementType>(instance)); return true;
+            case 184: visitor(Entity::Unchecked<IfcDistributionFlowElement>(instance)); return true;
+            case 186: visitor(Entity::Unchecked<IfcDistributionPort>(instance)); return true;
+            case 187: visitor(Entity::Unchecked<IfcDistributionSystem>(instance)); return true;
+            case 188: visitor(Entity::Unchecked<IfcDocumentInformation>(instance)); return true;
+            case 189: visitor(Entity::Unchecked<IfcDocumentInformationRelationship>(instance)); return true;
+            case 190: visitor(Entity::Unchecked<IfcDocumentReference>(instance)); return true;
+            case 191: visitor(Entity::Unchecked<IfcDoor>(instance)); return true;
+            case 192: visitor(Entity::Unchecked<IfcDoorLiningProperties>(instance)); return true;
+            case 193: visitor(Entity::Unchecked<IfcDoorPanelProperties>(instance)); return true;
+            case 194: visitor(Entity::Unchecked<IfcDoorStandardCase>(instance)); return true;
+            case 195: visitor(Entity::Unchecked<IfcDoorStyle>(instance)); return true;
+            case 196: visitor(Entity::Unchecked<IfcDoorType>(instance)); return true;
+            case 197: visitor(Entity::Unchecked<IfcDraughtingPreDefinedColour>(instance)); return true;
+            case 198: visitor(Entity::Unchecked<IfcDraughtingPreDefinedCurveFont>(instance)); return true;
+            case 199: visitor(Entity::Unchecked<IfcDuctFitting>(instance)); return true;
+            case 200: visitor(Entity::Unchecked<IfcDuctFittingType>(instance)); return true;
+            case 201: visitor(Entity::Unchecked<IfcDuctSegment>(instance)); return true;
+            case 202: visitor(Entity::Unchecked<IfcDuctSegmentType>(instance)); return true;
+            case 203: visitor(Entity::Unchecked<IfcDuctSilencer>(instance)); return true;
+            case 204: visitor(Entity::Unchecked<IfcDuctSilencerType>(instance)); return true;
+            case 205: visitor(Entity::Unchecked<IfcEdge>(instance)); return true;
+            case 206: visitor(Entity::Unchecked<IfcEdgeCurve>(instance)); return true;
+            case 207: visitor(Entity::Unchecked<IfcEdgeLoop>(instance)); return true;
+            case 208: visitor(Entity::Unchecked<IfcElectricAppliance>(instance)); return true;
+            case 209: visitor(Entity::Unchecked<IfcElectricApplianceType>(instance)); return true;
+            case 210: visitor(Entity::Unchecked<IfcElectricDistributionBoard>(instance)); return true;
+            case 211: visitor(Entity::Unchecked<IfcElectricDistributionBoardType>(instance)); return true;
+            case 212: visitor(Entity::Unchecked<IfcElectricFlowStorageDevice>(instance)); return true;
+            case 213: visitor(Entity::Unchecked<IfcElectricFlowStorageDeviceType>(instance)); return true;
+            case 214: visitor(Entity::Unchecked<IfcElectricGenerator>(instance)); return true;
+            case 215: visitor(Entity::Unchecked<IfcElectricGeneratorType>(instance)); return true;
+            case 216: visitor(Entity::Unchecked<IfcElectricMotor>(instance)); return true;
+            case 217: visitor(Entity::Unchecked<IfcElectricMotorType>(instance)); return true;
+            case 218: visitor(Entity::Unchecked<IfcElectricTimeControl>(instance)); return true;
+            case 219: visitor(Entity::Unchecked<IfcElectricTimeControlType>(instance)); return true;
+            case 222: visitor(Entity::Unchecked<IfcElementAssembly>(instance)); return true;
+            case 223: visitor(Entity::Unchecked<IfcElementAssemblyType>(instance)); return true;
+            case 226: visitor(Entity::Unchecked<IfcElementQuantity>(instance)); return true;
+            case 228: visitor(Entity::Unchecked<IfcEllipse>(instance)); return true;
+            case 229: visitor(Entity::Unchecked<IfcEllipseProfileDef>(instance)); return true;
+            case 230: visitor(Entity::Unchecked<IfcEnergyConversionDevice>(instance)); return true;
+            case 232: visitor(Entity::Unchecked<IfcEngine>(instance)); return true;
+            case 233: visitor(Entity::Unchecked<IfcEngineType>(instance)); return true;
+            case 234: visitor(Entity::Unchecked<IfcEvaporativeCooler>(instance)); return true;
+            case 235: visitor(Entity::Unchecked<IfcEvaporativeCoolerType>(instance)); return true;
+            case 236: visitor(Entity::Unchecked<IfcEvaporator>(instance)); return true;
+            case 237: visitor(Entity::Unchecked<IfcEvaporatorType>(instance)); return true;
+            case 238: visitor(Entity::Unchecked<IfcEvent>(instance)); return true;
+            case 239: visitor(Entity::Unchecked<IfcEventTime>(instance)); return true;
+            case 240: visitor(Entity::Unchecked<IfcEventType>(instance)); return true;
+            case 243: visitor(Entity::Unchecked<IfcExternallyDefinedHatchStyle>(instance)); return true;
+            case 244: visitor(Entity::Unchecked<IfcExternallyDefinedSurfaceStyle>(instance)); return true;
+            case 245: visitor(Entity::Unchecked<IfcExternallyDefinedTextFont>(instance)); return true;
+            case 247: visitor(Entity::Unchecked<IfcExternalReferenceRelationship>(instance)); return true;
+            case 248: visitor(Entity::Unchecked<IfcExternalSpatialElement>(instance)); return true;
+            case 250: visitor(Entity::Unchecked<IfcExtrudedAreaSolid>(instance)); return true;
+            case 251: visitor(Entity::Unchecked<IfcExtrudedAreaSolidTapered>(instance)); return true;
+            case 252: visitor(Entity::Unchecked<IfcFace>(instance)); return true;
+            case 253: visitor(Entity::Unchecked<IfcFaceBasedSurfaceModel>(instance)); return true;
+            case 254: visitor(Entity::Unchecked<IfcFaceBound>(instance)); return true;
+            case 255: visitor(Entity::Unchecked<IfcFaceOuterBound>(instance)); return true;
+            case 256: visitor(Entity::Unchecked<IfcFaceSurface>(instance)); return true;
+            case 257: visitor(Entity::Unchecked<IfcFacetedBrep>(instance)); return true;
+            case 258: visitor(Entity::Unchecked<IfcFacetedBrepWithVoids>(instance)); return true;
+            case 259: visitor(Entity::Unchecked<IfcFailureConnectionCondition>(instance)); return true;
+            case 260: visitor(Entity::Unchecked<IfcFan>(instance)); return true;
+            case 261: visitor(Entity::Unchecked<IfcFanType>(instance)); return true;
+            case 262: visitor(Entity::Unchecked<IfcFastener>(instance)); return true;
+            case 263: visitor(Entity::Unchecked<IfcFastenerType>(instance)); return true;
+            case 267: visitor(Entity::Unchecked<IfcFillAreaStyle>(instance)); return true;
+            case 268: visitor(Entity::Unchecked<IfcFillAreaStyleHatching>(instance)); return true;
+            case 269: visitor(Entity::Unchecked<IfcFillAreaStyleTiles>(instance)); return true;
+            case 270: visitor(Entity::Unchecked<IfcFilter>(instance)); return true;
+            case 271: visitor(Entity::Unchecked<IfcFilterType>(instance)); return true;
+            case 272: visitor(Entity::Unchecked<IfcFireSuppressionTerminal>(instance)); return true;
+            case 273: visitor(Entity::Unchecked<IfcFireSuppressionTerminalType>(instance)); return true;
+            case 274: visitor(Entity::Unchecked<IfcFixedReferenceSweptAreaSolid>(instance)); return true;
+            case 275: visitor(Entity::Unchecked<IfcFlowController>(instance)); return true;
+            case 277: visitor(Entity::Unchecked<IfcFlowFitting>(instance)); return true;
+            case 279: visitor(Entity::Unchecked<IfcFlowInstrument>(instance)); return true;
+            case 280: visitor(Entity::Unchecked<IfcFlowInstrumentType>(instance)); return true;
+            case 281: visitor(Entity::Unchecked<IfcFlowMeter>(instance)); return true;
+            case 282: visitor(Entity::Unchecked<IfcFlowMeterType>(instance)); return true;
+            case 283: visitor(Entity::Unchecked<IfcFlowMovingDevice>(instance)); return true;
+            case 285: visitor(Entity::Unchecked<IfcFlowSegment>(instance)); return true;
+            case 287: visitor(Entity::Unchecked<IfcFlowStorageDevice>(instance)); return true;
+            case 289: visitor(Entity::Unchecked<IfcFlowTerminal>(instance)); return true;
+            case 291: visitor(Entity::Unchecked<IfcFlowTreatmentDevice>(instance)); return true;
+            case 293: visitor(Entity::Unchecked<IfcFooting>(instance)); return true;
+            case 294: visitor(Entity::Unchecked<IfcFootingType>(instance)); return true;
+            case 295: visitor(Entity::Unchecked<IfcFurnishingElement>(instance)); return true;
+            case 296: visitor(Entity::Unchecked<IfcFurnishingElementType>(instance)); return true;
+            case 297: visitor(Entity::Unchecked<IfcFurniture>(instance)); return true;
+            case 298: visitor(Entity::Unchecked<IfcFurnitureType>(instance)); return true;
+            case 299: visitor(Entity::Unchecked<IfcGeographicElement>(instance)); return true;
+            case 300: visitor(Entity::Unchecked<IfcGeographicElementType>(instance)); return true;
+            case 301: visitor(Entity::Unchecked<IfcGeometricCurveSet>(instance)); return true;
+            case 302: visitor(Entity::Unchecked<IfcGeometricRepresentationContext>(instance)); return true;
+            case 304: visitor(Entity::Unchecked<IfcGeometricRepresentationSubContext>(instance)); return true;
+            case 305: visitor(Entity::Unchecked<IfcGeometricSet>(instance)); return true;
+            case 306: visitor(Entity::Unchecked<IfcGrid>(instance)); return true;
+            case 307: visitor(Entity::Unchecked<IfcGridAxis>(instance)); return true;
+            case 308: visitor(Entity::Unchecked<IfcGridPlacement>(instance)); return true;
+            case 309: visitor(Entity::Unchecked<IfcGroup>(instance)); return true;
+            case 310: visitor(Entity::Unchecked<IfcHalfSpaceSolid>(instance)); return true;
+            case 311: visitor(Entity::Unchecked<IfcHeatExchanger>(instance)); return true;
+            case 312: visitor(Entity::Unchecked<IfcHeatExchangerType>(instance)); return true;
+            case 313: visitor(Entity::Unchecked<IfcHumidifier>(instance)); return true;
+            case 314: visitor(Entity::Unchecked<IfcHumidifierType>(instance)); return true;
+            case 315: visitor(Entity::Unchecked<IfcImageTexture>(instance)); return true;
+            case 316: visitor(Entity::Unchecked<IfcIndexedColourMap>(instance)); return true;
+            case 317: visitor(Entity::Unchecked<IfcIndexedPolyCurve>(instance)); return true;
+            case 318: visitor(Entity::Unchecked<IfcIndexedPolygonalFace>(instance)); return true;
+            case 319: visitor(Entity::Unchecked<IfcIndexedPolygonalFaceWithVoids>(instance)); return true;
+            case 321: visitor(Entity::Unchecked<IfcIndexedTriangleTextureMap>(instance)); return true;
+            case 322: visitor(Entity::Unchecked<IfcInterceptor>(instance)); return true;
+            case 323: visitor(Entity::Unchecked<IfcInterceptorType>(instance)); return true;
+            case 324: visitor(Entity::Unchecked<IfcIntersectionCurve>(instance)); return true;
+            case 325: visitor(Entity::Unchecked<IfcInventory>(instance)); return true;
+            case 326: visitor(Entity::Unchecked<IfcIrregularTimeSeries>(instance)); return true;
+            case 327: visitor(Entity::Unchecked<IfcIrregularTimeSeriesValue>(instance)); return true;
+            case 328: visitor(Entity::Unchecked<IfcIShapeProfileDef>(instance)); return true;
+            case 329: visitor(Entity::Unchecked<IfcJunctionBox>(instance)); return true;
+            case 330: visitor(Entity::Unchecked<IfcJunctionBoxType>(instance)); return true;
+            case 331: visitor(Entity::Unchecked<IfcLaborResource>(instance)); return true;
+            case 332: visitor(Entity::Unchecked<IfcLaborResourceType>(instance)); return true;
+            case 333: visitor(Entity::Unchecked<IfcLagTime>(instance)); return true;
+            case 334: visitor(Entity::Unchecked<IfcLamp>(instance)); return true;
+            case 335: visitor(Entity::Unchecked<IfcLampType>(instance)); return true;
+            case 336: visitor(Entity::Unchecked<IfcLibraryInformation>(instance)); return true;
+            case 337: visitor(Entity::Unchecked<IfcLibraryReference>(instance)); return true;
+            case 338: visitor(Entity::Unchecked<IfcLightDistributionData>(instance)); return true;
+            case 339: visitor(Entity::Unchecked<IfcLightFixture>(instance)); return true;
+            case 340: visitor(Entity::Unchecked<IfcLightFixtureType>(instance)); return true;
+            case 341: visitor(Entity::Unchecked<IfcLightIntensityDistribution>(instance)); return true;
+            case 343: visitor(Entity::Unchecked<IfcLightSourceAmbient>(instance)); return true;
+            case 344: visitor(Entity::Unchecked<IfcLightSourceDirectional>(instance)); return true;
+            case 345: visitor(Entity::Unchecked<IfcLightSourceGoniometric>(instance)); return true;
+            case 346: visitor(Entity::Unchecked<IfcLightSourcePositional>(instance)); return true;
+            case 347: visitor(Entity::Unchecked<IfcLightSourceSpot>(instance)); return true;
+            case 348: visitor(Entity::Unchecked<IfcLine>(instance)); return true;
+            case 349: visitor(Entity::Unchecked<IfcLocalPlacement>(instance)); return true;
+            case 350: visitor(Entity::Unchecked<IfcLoop>(instance)); return true;
+            case 351: visitor(Entity::Unchecked<IfcLShapeProfileDef>(instance)); return true;
+            case 353: visitor(Entity::Unchecked<IfcMapConversion>(instance)); return true;
+            case 354: visitor(Entity::Unchecked<IfcMappedItem>(instance)); return true;
+            case 355: visitor(Entity::Unchecked<IfcMaterial>(instance)); return true;
+            case 356: visitor(Entity::Unchecked<IfcMaterialClassificationRelationship>(instance)); return true;
+            case 357: visitor(Entity::Unchecked<IfcMaterialConstituent>(instance)); return true;
+            case 358: visitor(Entity::Unchecked<IfcMaterialConstituentSet>(instance)); return true;
+            case 360: visitor(Entity::Unchecked<IfcMaterialDefinitionRepresentation>(instance)); return true;
+            case 361: visitor(Entity::Unchecked<IfcMaterialLayer>(instance)); return true;
+            case 362: visitor(Entity::Unchecked<IfcMaterialLayerSet>(instance)); return true;
+            case 363: visitor(Entity::Unchecked<IfcMaterialLayerSetUsage>(instance)); return true;
+            case 364: visitor(Entity::Unchecked<IfcMaterialLayerWithOffsets>(instance)); return true;
+            case 365: visitor(Entity::Unchecked<IfcMaterialList>(instance)); return true;
+            case 366: visitor(Entity::Unchecked<IfcMaterialProfile>(instance)); return true;
+            case 367: visitor(Entity::Unchecked<IfcMaterialProfileSet>(instance)); return true;
+            case 368: visitor(Entity::Unchecked<IfcMaterialProfileSetUsage>(instance)); return true;
+            case 369: visitor(Entity::Unchecked<IfcMaterialProfileSetUsageTapering>(instance)); return true;
+            case 370: visitor(Entity::Unchecked<IfcMaterialProfileWithOffsets>(instance)); return true;
+            case 371: visitor(Entity::Unchecked<IfcMaterialProperties>(instance)); return true;
+            case 372: visitor(Entity::Unchecked<IfcMaterialRelationship>(instance)); return true;
+            case 374: visitor(Entity::Unchecked<IfcMeasureWithUnit>(instance)); return true;
+            case 375: visitor(Entity::Unchecked<IfcMechanicalFastener>(instance)); return true;
+            case 376: visitor(Entity::Unchecked<IfcMechanicalFastenerType>(instance)); return true;
+            case 377: visitor(Entity::Unchecked<IfcMedicalDevice>(instance)); return true;
+            case 378: visitor(Entity::Unchecked<IfcMedicalDeviceType>(instance)); return true;
+            case 379: visitor(Entity::Unchecked<IfcMember>(instance)); return true;
+            case 380: visitor(Entity::Unchecked<IfcMemberStandardCase>(instance)); return true;
+            case 381: visitor(Entity::Unchecked<IfcMemberType>(instance)); return true;
+            case 382: visitor(Entity::Unchecked<IfcMetric>(instance)); return true;
+            case 383: visitor(Entity::Unchecked<IfcMirroredProfileDef>(instance)); return true;
+            case 384: visitor(Entity::Unchecked<IfcMonetaryUnit>(instance)); return true;
+            case 385: visitor(Entity::Unchecked<IfcMotorConnection>(instance)); return true;
+            case 386: visitor(Entity::Unchecked<IfcMotorConnectionType>(instance)); return true;
+            case 390: visitor(Entity::Unchecked<IfcObjective>(instance)); return true;
+            case 392: visitor(Entity::Unchecked<IfcOccupant>(instance)); return true;
+            case 393: visitor(Entity::Unchecked<IfcOffsetCurve2D>(instance)); return true;
+            case 394: visitor(Entity::Unchecked<IfcOffsetCurve3D>(instance)); return true;
+            case 395: visitor(Entity::Unchecked<IfcOpeningElement>(instance)); return true;
+            case 396: visitor(Entity::Unchecked<IfcOpeningStandardCase>(instance)); return true;
+            case 397: visitor(Entity::Unchecked<IfcOpenShell>(instance)); return true;
+            case 398: visitor(Entity::Unchecked<IfcOrganization>(instance)); return true;
+            case 399: visitor(Entity::Unchecked<IfcOrganizationRelationship>(instance)); return true;
+            case 400: visitor(Entity::Unchecked<IfcOrientedEdge>(instance)); return true;
+            case 401: visitor(Entity::Unchecked<IfcOuterBoundaryCurve>(instance)); return true;
+            case 402: visitor(Entity::Unchecked<IfcOutlet>(instance)); return true;
+            case 403: visitor(Entity::Unchecked<IfcOutletType>(instance)); return true;
+            case 404: visitor(Entity::Unchecked<IfcOwnerHistory>(instance)); return true;
+            case 406: visitor(Entity::Unchecked<IfcPath>(instance)); return true;
+            case 407: visitor(Entity::Unchecked<IfcPcurve>(instance)); return true;
+            case 408: visitor(Entity::Unchecked<IfcPerformanceHistory>(instance)); return true;
+            case 409: visitor(Entity::Unchecked<IfcPermeableCoveringProperties>(instance)); return true;
+            case 410: visitor(Entity::Unchecked<IfcPermit>(instance)); return true;
+            case 411: visitor(Entity::Unchecked<IfcPerson>(instance)); return true;
+            case 412: visitor(Entity::Unchecked<IfcPersonAndOrganization>(instance)); return true;
+            case 413: visitor(Entity::Unchecked<IfcPhysicalComplexQuantity>(instance)); return true;
+            case 416: visitor(Entity::Unchecked<IfcPile>(instance)); return true;
+            case 417: visitor(Entity::Unchecked<IfcPileType>(instance)); return true;
+            case 418: visitor(Entity::Unchecked<IfcPipeFitting>(instance)); return true;
+            case 419: visitor(Entity::Unchecked<IfcPipeFittingType>(instance)); return true;
+            case 420: visitor(Entity::Unchecked<IfcPipeSegment>(instance)); return true;
+            case 421: visitor(Entity::Unchecked<IfcPipeSegmentType>(instance)); return true;
+            case 422: visitor(Entity::Unchecked<IfcPixelTexture>(instance)); return true;
+            case 424: visitor(Entity::Unchecked<IfcPlanarBox>(instance)); return true;
+            case 425: visitor(Entity::Unchecked<IfcPlanarExtent>(instance)); return true;
+            case 426: visitor(Entity::Unchecked<IfcPlane>(instance)); return true;
+            case 427: visitor(Entity::Unchecked<IfcPlate>(instance)); return true;
+            case 428: visitor(Entity::Unchecked<IfcPlateStandardCase>(instance)); return true;
+            case 429: visitor(Entity::Unchecked<IfcPlateType>(instance)); return true;
+            case 431: visitor(Entity::Unchecked<IfcPointOnCurve>(instance)); return true;
+            case 432: visitor(Entity::Unchecked<IfcPointOnSurface>(instance)); return true;
+            case 433: visitor(Entity::Unchecked<IfcPolygonalBoundedHalfSpace>(instance)); return true;
+            case 434: visitor(Entity::Unchecked<IfcPolygonalFaceSet>(instance)); return true;
+            case 435: visitor(Entity::Unchecked<IfcPolyline>(instance)); return true;
+            case 436: visitor(Entity::Unchecked<IfcPolyLoop>(instance)); return true;
+            case 438: visitor(Entity::Unchecked<IfcPostalAddress>(instance)); return true;
+            case 446: visitor(Entity::Unchecked<IfcPresentationLayerAssignment>(instance)); return true;
+            case 447: visitor(Entity::Unchecked<IfcPresentationLayerWithStyle>(instance)); return true;
+            case 449: visitor(Entity::Unchecked<IfcPresentationStyleAssignment>(instance)); return true;
+            case 450: visitor(Entity::Unchecked<IfcProcedure>(instance)); return true;
+            case 451: visitor(Entity::Unchecked<IfcProcedureType>(instance)); return true;
+            case 454: visitor(Entity::Unchecked<IfcProductDefinitionShape>(instance)); return true;
+            case 456: visitor(Entity::Unchecked<IfcProfileDef>(instance)); return true;
+            case 457: visitor(Entity::Unchecked<IfcProfileProperties>(instance)); return true;
+            case 458: visitor(Entity::Unchecked<IfcProject>(instance)); return true;
+            case 459: visitor(Entity::Unchecked<IfcProjectedCRS>(instance)); return true;
+            case 460: visitor(Entity::Unchecked<IfcProjectionElement>(instance)); return true;
+            case 461: visitor(Entity::Unchecked<IfcProjectLibrary>(instance)); return true;
+            case 462: visitor(Entity::Unchecked<IfcProjectOrder>(instance)); return true;
+            case 465: visitor(Entity::Unchecked<IfcPropertyBoundedValue>(instance)); return true;
+            case 467: visitor(Entity::Unchecked<IfcPropertyDependencyRelationship>(instance)); return true;
+            case 468: visitor(Entity::Unchecked<IfcPropertyEnumeratedValue>(instance)); return true;
+            case 469: visitor(Entity::Unchecked<IfcPropertyEnumeration>(instance)); return true;
+            case 470: visitor(Entity::Unchecked<IfcPropertyListValue>(instance)); return true;
+            case 471: visitor(Entity::Unchecked<IfcPropertyReferenceValue>(instance)); return true;
+            case 472: visitor(Entity::Unchecked<IfcPropertySet>(instance)); return true;
+            case 474: visitor(Entity::Unchecked<IfcPropertySetTemplate>(instance)); return true;
+            case 475: visitor(Entity::Unchecked<IfcPropertySingleValue>(instance)); return true;
+            case 476: visitor(Entity::Unchecked<IfcPropertyTableValue>(instance)); return true;
+            case 479: visitor(Entity::Unchecked<IfcProtectiveDevice>(instance)); return true;
+            case 480: visitor(Entity::Unchecked<IfcProtectiveDeviceTrippingUnit>(instance)); return true;
+            case 481: visitor(Entity::Unchecked<IfcProtectiveDeviceTrippingUnitType>(instance)); return true;
+            case 482: visitor(Entity::Unchecked<IfcProtectiveDeviceType>(instance)); return true;
+            case 483: visitor(Entity::Unchecked<IfcProxy>(instance)); return true;
+            case 484: visitor(Entity::Unchecked<IfcPump>(instance)); return true;
+            case 485: visitor(Entity::Unchecked<IfcPumpType>(instance)); return true;
+            case 486: visitor(Entity::Unchecked<IfcQuantityArea>(instance)); return true;
+            case 487: visitor(Entity::Unchecked<IfcQuantityCount>(instance)); return true;
+            case 488: visitor(Entity::Unchecked<IfcQuantityLength>(instance)); return true;
+            case 490: visitor(Entity::Unchecked<IfcQuantityTime>(instance)); return true;
+            case 491: visitor(Entity::Unchecked<IfcQuantityVolume>(instance)); return true;
+            case 492: visitor(Entity::Unchecked<IfcQuantityWeight>(instance)); return true;
+            case 493: visitor(Entity::Unchecked<IfcRailing>(instance)); return true;
+            case 494: visitor(Entity::Unchecked<IfcRailingType>(instance)); return true;
+            case 495: visitor(Entity::Unchecked<IfcRamp>(instance)); return true;
+            case 496: visitor(Entity::Unchecked<IfcRampFlight>(instance)); return true;
+            case 497: visitor(Entity::Unchecked<IfcRampFlightType>(instance)); return true;
+            case 498: visitor(Entity::Unchecked<IfcRampType>(instance)); return true;
+            case 499: visitor(Entity::Unchecked<IfcRationalBSplineCurveWithKnots>(instance)); return true;
+            case 500: visitor(Entity::Unchecked<IfcRationalBSplineSurfaceWithKnots>(instance)); return true;
+            case 501: visitor(Entity::Unchecked<IfcRectangleHollowProfileDef>(instance)); return true;
+            case 502: visitor(Entity::Unchecked<IfcRectangleProfileDef>(instance)); return true;
+            case 503: visitor(Entity::Unchecked<IfcRectangularPyramid>(instance)); return true;
+            case 504: visitor(Entity::Unchecked<IfcRectangularTrimmedSurface>(instance)); return true;
+            case 505: visitor(Entity::Unchecked<IfcRecurrencePattern>(instance)); return true;
+            case 506: visitor(Entity::Unchecked<IfcReference>(instance)); return true;
+            case 507: visitor(Entity::Unchecked<IfcRegularTimeSeries>(instance)); return true;
+            case 508: visitor(Entity::Unchecked<IfcReinforcementBarProperties>(instance)); return true;
+            case 509: visitor(Entity::Unchecked<IfcReinforcementDefinitionProperties>(instance)); return true;
+            case 510: visitor(Entity::Unchecked<IfcReinforcingBar>(instance)); return true;
+            case 511: visitor(Entity::Unchecked<IfcReinforcingBarType>(instance)); return true;
+            case 514: visitor(Entity::Unchecked<IfcReinforcingMesh>(instance)); return true;
+            case 515: visitor(Entity::Unchecked<IfcReinforcingMeshType>(instance)); return true;
+            case 516: visitor(Entity::Unchecked<IfcRelAggregates>(instance)); return true;
+            case 518: visitor(Entity::Unchecked<IfcRelAssignsToActor>(instance)); return true;
+            case 519: visitor(Entity::Unchecked<IfcRelAssignsToControl>(instance)); return true;
+            case 520: visitor(Entity::Unchecked<IfcRelAssignsToGroup>(instance)); return true;
+            case 521: visitor(Entity::Unchecked<IfcRelAssignsToGroupByFactor>(instance)); return true;
+            case 522: visitor(Entity::Unchecked<IfcRelAssignsToProcess>(instance)); return true;
+            case 523: visitor(Entity::Unchecked<IfcRelAssignsToProduct>(instance)); return true;
+            case 524: visitor(Entity::Unchecked<IfcRelAssignsToResource>(instance)); return true;
+            case 526: visitor(Entity::Unchecked<IfcRelAssociatesApproval>(instance)); return true;
+            case 527: visitor(Entity::Unchecked<IfcRelAssociatesClassification>(instance)); return true;
+            case 528: visitor(Entity::Unchecked<IfcRelAssociatesConstraint>(instance)); return true;
+            case 529: visitor(Entity::Unchecked<IfcRelAssociatesDocument>(instance)); return true;
+            case 530: visitor(Entity::Unchecked<IfcRelAssociatesLibrary>(instance)); return true;
+            case 531: visitor(Entity::Unchecked<IfcRelAssociatesMaterial>(instance)); return true;
+            case 534: visitor(Entity::Unchecked<IfcRelConnectsElements>(instance)); return true;
+            case 535: visitor(Entity::Unchecked<IfcRelConnectsPathElements>(instance)); return true;
+            case 536: visitor(Entity::Unchecked<IfcRelConnectsPorts>(instance)); return true;
+            case 537: visitor(Entity::Unchecked<IfcRelConnectsPortToElement>(instance)); return true;
+            case 538: visitor(Entity::Unchecked<IfcRelConnectsStructuralActivity>(instance)); return true;
+            case 539: visitor(Entity::Unchecked<IfcRelConnectsStructuralMember>(instance)); return true;
+            case 540: visitor(Entity::Unchecked<IfcRelConnectsWithEccentricity>(instance)); return true;
+            case 541: visitor(Entity::Unchecked<IfcRelConnectsWithRealizingElements>(instance)); return true;
+            case 542: visitor(Entity::Unchecked<IfcRelContainedInSpatialStructure>(instance)); return true;
+            case 543: visitor(Entity::Unchecked<IfcRelCoversBldgElements>(instance)); return true;
+            case 544: visitor(Entity::Unchecked<IfcRelCoversSpaces>(instance)); return true;
+            case 545: visitor(Entity::Unchecked<IfcRelDeclares>(instance)); return true;
+            case 548: visitor(Entity::Unchecked<IfcRelDefinesByObject>(instance)); return true;
+            case 549: visitor(Entity::Unchecked<IfcRelDefinesByProperties>(instance)); return true;
+            case 550: visitor(Entity::Unchecked<IfcRelDefinesByTemplate>(instance)); return true;
+            case 551: visitor(Entity::Unchecked<IfcRelDefinesByType>(instance)); return true;
+            case 552: visitor(Entity::Unchecked<IfcRelFillsElement>(instance)); return true;
+            case 553: visitor(Entity::Unchecked<IfcRelFlowControlElements>(instance)); return true;
+            case 554: visitor(Entity::Unchecked<IfcRelInterferesElements>(instance)); return true;
+            case 555: visitor(Entity::Unchecked<IfcRelNests>(instance)); return true;
+            case 556: visitor(Entity::Unchecked<IfcRelProjectsElement>(instance)); return true;
+            case 557: visitor(Entity::Unchecked<IfcRelReferencedInSpatialStructure>(instance)); return true;
+            case 558: visitor(Entity::Unchecked<IfcRelSequence>(instance)); return true;
+            case 559: visitor(Entity::Unchecked<IfcRelServicesBuildings>(instance)); return true;
+            case 560: visitor(Entity::Unchecked<IfcRelSpaceBoundary>(instance)); return true;
+            case 561: visitor(Entity::Unchecked<IfcRelSpaceBoundary1stLevel>(instance)); return true;
+            case 562: visitor(Entity::Unchecked<IfcRelSpaceBoundary2ndLevel>(instance)); return true;
+            case 563: visitor(Entity::Unchecked<IfcRelVoidsElement>(instance)); return true;
+            case 564: visitor(Entity::Unchecked<IfcReparametrisedCompositeCurveSegment>(instance)); return true;
+            case 568: visitor(Entity::Unchecked<IfcRepresentationMap>(instance)); return true;
+            case 570: visitor(Entity::Unchecked<IfcResourceApprovalRelationship>(instance)); return true;
+            case 571: visitor(Entity::Unchecked<IfcResourceConstraintRelationship>(instance)); return true;
+            case 573: visitor(Entity::Unchecked<IfcResourceTime>(instance)); return true;
+            case 574: visitor(Entity::Unchecked<IfcRevolvedAreaSolid>(instance)); return true;
+            case 575: visitor(Entity::Unchecked<IfcRevolvedAreaSolidTapered>(instance)); return true;
+            case 576: visitor(Entity::Unchecked<IfcRightCircularCone>(instance)); return true;
+            case 577: visitor(Entity::Unchecked<IfcRightCircularCylinder>(instance)); return true;
+            case 578: visitor(Entity::Unchecked<IfcRoof>(instance)); return true;
+            case 579: visitor(Entity::Unchecked<IfcRoofType>(instance)); return true;
+            case 581: visitor(Entity::Unchecked<IfcRoundedRectangleProfileDef>(instance)); return true;
+            case 582: visitor(Entity::Unchecked<IfcSanitaryTerminal>(instance)); return true;
+            case 583: visitor(Entity::Unchecked<IfcSanitaryTerminalType>(instance)); return true;
+            case 585: visitor(Entity::Unchecked<IfcSeamCurve>(instance)); return true;
+            case 586: visitor(Entity::Unchecked<IfcSectionedSpine>(instance)); return true;
+            case 587: visitor(Entity::Unchecked<IfcSectionProperties>(instance)); return true;
+            case 588: visitor(Entity::Unchecked<IfcSectionReinforcementProperties>(instance)); return true;
+            case 589: visitor(Entity::Unchecked<IfcSensor>(instance)); return true;
+            case 590: visitor(Entity::Unchecked<IfcSensorType>(instance)); return true;
+            case 591: visitor(Entity::Unchecked<IfcShadingDevice>(instance)); return true;
+            case 592: visitor(Entity::Unchecked<IfcShadingDeviceType>(instance)); return true;
+            case 593: visitor(Entity::Unchecked<IfcShapeAspect>(instance)); return true;
+            case 595: visitor(Entity::Unchecked<IfcShapeRepresentation>(instance)); return true;
+            case 596: visitor(Entity::Unchecked<IfcShellBasedSurfaceModel>(instance)); return true;
+            case 598: visitor(Entity::Unchecked<IfcSimplePropertyTemplate>(instance)); return true;
+            case 599: visitor(Entity::Unchecked<IfcSite>(instance)); return true;
+            case 600: visitor(Entity::Unchecked<IfcSIUnit>(instance)); return true;
+            case 601: visitor(Entity::Unchecked<IfcSlab>(instance)); return true;
+            case 602: visitor(Entity::Unchecked<IfcSlabElementedCase>(instance)); return true;
+            case 603: visitor(Entity::Unchecked<IfcSlabStandardCase>(instance)); return true;
+            case 604: visitor(Entity::Unchecked<IfcSlabType>(instance)); return true;
+            case 605: visitor(Entity::Unchecked<IfcSlippageConnectionCondition>(instance)); return true;
+            case 606: visitor(Entity::Unchecked<IfcSolarDevice>(instance)); return true;
+            case 607: visitor(Entity::Unchecked<IfcSolarDeviceType>(instance)); return true;
+            case 609: visitor(Entity::Unchecked<IfcSpace>(instance)); return true;
+            case 610: visitor(Entity::Unchecked<IfcSpaceHeater>(instance)); return true;
+            case 611: visitor(Entity::Unchecked<IfcSpaceHeaterType>(instance)); return true;
+            case 612: visitor(Entity::Unchecked<IfcSpaceType>(instance)); return true;
+            case 617: visitor(Entity::Unchecked<IfcSpatialZone>(instance)); return true;
+            case 618: visitor(Entity::Unchecked<IfcSpatialZoneType>(instance)); return true;
+            case 619: visitor(Entity::Unchecked<IfcSphere>(instance)); return true;
+            case 620: visitor(Entity::Unchecked<IfcSphericalSurface>(instance)); return true;
+            case 621: visitor(Entity::Unchecked<IfcStackTerminal>(instance)); return true;
+            case 622: visitor(Entity::Unchecked<IfcStackTerminalType>(instance)); return true;
+            case 623: visitor(Entity::Unchecked<IfcStair>(instance)); return true;
+            case 624: visitor(Entity::Unchecked<IfcStairFlight>(instance)); return true;
+            case 625: visitor(Entity::Unchecked<IfcStairFlightType>(instance)); return true;
+            case 626: visitor(Entity::Unchecked<IfcStairType>(instance)); return true;
+            case 629: visitor(Entity::Unchecked<IfcStructuralAnalysisModel>(instance)); return true;
+            case 632: visitor(Entity::Unchecked<IfcStructuralCurveAction>(instance)); return true;
+            case 633: visitor(Entity::Unchecked<IfcStructuralCurveConnection>(instance)); return true;
+            case 634: visitor(Entity::Unchecked<IfcStructuralCurveMember>(instance)); return true;
+            case 635: visitor(Entity::Unchecked<IfcStructuralCurveMemberVarying>(instance)); return true;
+            case 636: visitor(Entity::Unchecked<IfcStructuralCurveReaction>(instance)); return true;
+            case 638: visitor(Entity::Unchecked<IfcStructuralLinearAction>(instance)); return true;
+            case 640: visitor(Entity::Unchecked<IfcStructuralLoadCase>(instance)); return true;
+            case 641: visitor(Entity::Unchecked<IfcStructuralLoadConfiguration>(instance)); return true;
+            case 642: visitor(Entity::Unchecked<IfcStructuralLoadGroup>(instance)); return true;
+            case 643: visitor(Entity::Unchecked<IfcStructuralLoadLinearForce>(instance)); return true;
+            case 645: visitor(Entity::Unchecked<IfcStructuralLoadPlanarForce>(instance)); return true;
+            case 646: visitor(Entity::Unchecked<IfcStructuralLoadSingleDisplacement>(instance)); return true;
+            case 647: visitor(Entity::Unchecked<IfcStructuralLoadSingleDisplacementDistortion>(instance)); return true;
+            case 648: visitor(Entity::Unchecked<IfcStructuralLoadSingleForce>(instance)); return true;
+            case 649: visitor(Entity::Unchecked<IfcStructuralLoadSingleForceWarping>(instance)); return true;
+            case 651: visitor(Entity::Unchecked<IfcStructuralLoadTemperature>(instance)); return true;
+            case 653: visitor(Entity::Unchecked<IfcStructuralPlanarAction>(instance)); return true;
+            case 654: visitor(Entity::Unchecked<IfcStructuralPointAction>(instance)); return true;
+            case 655: visitor(Entity::Unchecked<IfcStructuralPointConnection>(instance)); return true;
+            case 656: visitor(Entity::Unchecked<IfcStructuralPointReaction>(instance)); return true;
+            case 658: visitor(Entity::Unchecked<IfcStructuralResultGroup>(instance)); return true;
+            case 659: visitor(Entity::Unchecked<IfcStructuralSurfaceAction>(instance)); return true;
+            case 660: visitor(Entity::Unchecked<IfcStructuralSurfaceConnection>(instance)); return true;
+            case 661: visitor(Entity::Unchecked<IfcStructuralSurfaceMember>(instance)); return true;
+            case 662: visitor(Entity::Unchecked<IfcStructuralSurfaceMemberVarying>(instance)); return true;
+            case 663: visitor(Entity::Unchecked<IfcStructuralSurfaceReaction>(instance)); return true;
+            case 664: visitor(Entity::Unchecked<IfcStyledItem>(instance)); return true;
+            case 665: visitor(Entity::Unchecked<IfcStyledRepresentation>(instance)); return true;
+            case 667: visitor(Entity::Unchecked<IfcSubContractResource>(instance)); return true;
+            case 668: visitor(Entity::Unchecked<IfcSubContractResourceType>(instance)); return true;
+            case 669: visitor(Entity::Unchecked<IfcSubedge>(instance)); return true;
+            case 671: visitor(Entity::Unchecked<IfcSurfaceCurve>(instance)); return true;
+            case 672: visitor(Entity::Unchecked<IfcSurfaceCurveSweptAreaSolid>(instance)); return true;
+            case 673: visitor(Entity::Unchecked<IfcSurfaceFeature>(instance)); return true;
+            case 674: visitor(Entity::Unchecked<IfcSurfaceOfLinearExtrusion>(instance)); return true;
+            case 675: visitor(Entity::Unchecked<IfcSurfaceOfRevolution>(instance)); return true;
+            case 676: visitor(Entity::Unchecked<IfcSurfaceReinforcementArea>(instance)); return true;
+            case 677: visitor(Entity::Unchecked<IfcSurfaceStyle>(instance)); return true;
+            case 678: visitor(Entity::Unchecked<IfcSurfaceStyleLighting>(instance)); return true;
+            case 679: visitor(Entity::Unchecked<IfcSurfaceStyleRefraction>(instance)); return true;
+            case 680: visitor(Entity::Unchecked<IfcSurfaceStyleRendering>(instance)); return true;
+            case 681: visitor(Entity::Unchecked<IfcSurfaceStyleShading>(instance)); return true;
+            case 682: visitor(Entity::Unchecked<IfcSurfaceStyleWithTextures>(instance)); return true;
+            case 685: visitor(Entity::Unchecked<IfcSweptDiskSolid>(instance)); return true;
+            case 686: visitor(Entity::Unchecked<IfcSweptDiskSolidPolygonal>(instance)); return true;
+            case 688: visitor(Entity::Unchecked<IfcSwitchingDevice>(instance)); return true;
+            case 689: visitor(Entity::Unchecked<IfcSwitchingDeviceType>(instance)); return true;
+            case 690: visitor(Entity::Unchecked<IfcSystem>(instance)); return true;
+            case 691: visitor(Entity::Unchecked<IfcSystemFurnitureElement>(instance)); return true;
+            case 692: visitor(Entity::Unchecked<IfcSystemFurnitureElementType>(instance)); return true;
+            case 693: visitor(Entity::Unchecked<IfcTable>(instance)); return true;
+            case 694: visitor(Entity::Unchecked<IfcTableColumn>(instance)); return true;
+            case 695: visitor(Entity::Unchecked<IfcTableRow>(instance)); return true;
+            case 696: visitor(Entity::Unchecked<IfcTank>(instance)); return true;
+            case 697: visitor(Entity::Unchecked<IfcTankType>(instance)); return true;
+            case 698: visitor(Entity::Unchecked<IfcTask>(instance)); return true;
+            case 699: visitor(Entity::Unchecked<IfcTaskTime>(instance)); return true;
+            case 700: visitor(Entity::Unchecked<IfcTaskTimeRecurring>(instance)); return true;
+            case 701: visitor(Entity::Unchecked<IfcTaskType>(instance)); return true;
+            case 702: visitor(Entity::Unchecked<IfcTelecomAddress>(instance)); return true;
+            case 703: visitor(Entity::Unchecked<IfcTendon>(instance)); return true;
+            case 704: visitor(Entity::Unchecked<IfcTendonAnchor>(instance)); return true;
+            case 705: visitor(Entity::Unchecked<IfcTendonAnchorType>(instance)); return true;
+            case 706: visitor(Entity::Unchecked<IfcTendonType>(instance)); return true;
+            case 709: visitor(Entity::Unchecked<IfcTextLiteral>(instance)); return true;
+            case 710: visitor(Entity::Unchecked<IfcTextLiteralWithExtent>(instance)); return true;
+            case 711: visitor(Entity::Unchecked<IfcTextStyle>(instance)); return true;
+            case 712: visitor(Entity::Unchecked<IfcTextStyleFontModel>(instance)); return true;
+            case 713: visitor(Entity::Unchecked<IfcTextStyleForDefinedFont>(instance)); return true;
+            case 714: visitor(Entity::Unchecked<IfcTextStyleTextModel>(instance)); return true;
+            case 716: visitor(Entity::Unchecked<IfcTextureCoordinateGenerator>(instance)); return true;
+            case 717: visitor(Entity::Unchecked<IfcTextureMap>(instance)); return true;
+            case 718: visitor(Entity::Unchecked<IfcTextureVertex>(instance)); return true;
+            case 719: visitor(Entity::Unchecked<IfcTextureVertexList>(instance)); return true;
+            case 720: visitor(Entity::Unchecked<IfcTimePeriod>(instance)); return true;
+            case 722: visitor(Entity::Unchecked<IfcTimeSeriesValue>(instance)); return true;
+            case 724: visitor(Entity::Unchecked<IfcTopologyRepresentation>(instance)); return true;
+            case 725: visitor(Entity::Unchecked<IfcToroidalSurface>(instance)); return true;
+            case 726: visitor(Entity::Unchecked<IfcTransformer>(instance)); return true;
+            case 727: visitor(Entity::Unchecked<IfcTransformerType>(instance)); return true;
+            case 728: visitor(Entity::Unchecked<IfcTransportElement>(instance)); return true;
+            case 729: visitor(Entity::Unchecked<IfcTransportElementType>(instance)); return true;
+            case 730: visitor(Entity::Unchecked<IfcTrapeziumProfileDef>(instance)); return true;
+            case 731: visitor(Entity::Unchecked<IfcTriangulatedFaceSet>(instance)); return true;
+            case 732: visitor(Entity::Unchecked<IfcTrimmedCurve>(instance)); return true;
+            case 733: visitor(Entity::Unchecked<IfcTShapeProfileDef>(instance)); return true;
+            case 734: visitor(Entity::Unchecked<IfcTubeBundle>(instance)); return true;
+            case 735: visitor(Entity::Unchecked<IfcTubeBundleType>(instance)); return true;
+            case 736: visitor(Entity::Unchecked<IfcTypeObject>(instance)); return true;
+            case 738: visitor(Entity::Unchecked<IfcTypeProduct>(instance)); return true;
+            case 740: visitor(Entity::Unchecked<IfcUnitaryControlElement>(instance)); return true;
+            case 741: visitor(Entity::Unchecked<IfcUnitaryControlElementType>(instance)); return true;
+            case 742: visitor(Entity::Unchecked<IfcUnitaryEquipment>(instance)); return true;
+            case 743: visitor(Entity::Unchecked<IfcUnitaryEquipmentType>(instance)); return true;
+            case 744: visitor(Entity::Unchecked<IfcUnitAssignment>(instance)); return true;
+            case 745: visitor(Entity::Unchecked<IfcUShapeProfileDef>(instance)); return true;
+            case 746: visitor(Entity::Unchecked<IfcValve>(instance)); return true;
+            case 747: visitor(Entity::Unchecked<IfcValveType>(instance)); return true;
+            case 748: visitor(Entity::Unchecked<IfcVector>(instance)); return true;
+            case 749: visitor(Entity::Unchecked<IfcVertex>(instance)); return true;
+            case 750: visitor(Entity::Unchecked<IfcVertexLoop>(instance)); return true;
+            case 751: visitor(Entity::Unchecked<IfcVertexPoint>(instance)); return true;
+            case 752: visitor(Entity::Unchecked<IfcVibrationIsolator>(instance)); return true;
+            case 753: visitor(Entity::Unchecked<IfcVibrationIsolatorType>(instance)); return true;
+            case 754: visitor(Entity::Unchecked<IfcVirtualElement>(instance)); return true;
+            case 755: visitor(Entity::Unchecked<IfcVirtualGridIntersection>(instance)); return true;
+            case 756: visitor(Entity::Unchecked<IfcVoidingFeature>(instance)); return true;
+            case 757: visitor(Entity::Unchecked<IfcWall>(instance)); return true;
+            case 758: visitor(Entity::Unchecked<IfcWallElementedCase>(instance)); return true;
+            case 759: visitor(Entity::Unchecked<IfcWallStandardCase>(instance)); return true;
+            case 760: visitor(Entity::Unchecked<IfcWallType>(instance)); return true;
+            case 761: visitor(Entity::Unchecked<IfcWasteTerminal>(instance)); return true;
+            case 762: visitor(Entity::Unchecked<IfcWasteTerminalType>(instance)); return true;
+            case 763: visitor(Entity::Unchecked<IfcWindow>(instance)); return true;
+            case 764: visitor(Entity::Unchecked<IfcWindowLiningProperties>(instance)); return true;
+            case 765: visitor(Entity::Unchecked<IfcWindowPanelProperties>(instance)); return true;
+            case 766: visitor(Entity::Unchecked<IfcWindowStandardCase>(instance)); return true;
+            case 767: visitor(Entity::Unchecked<IfcWindowStyle>(instance)); return true;
+            case 768: visitor(Entity::Unchecked<IfcWindowType>(instance)); return true;
+            case 769: visitor(Entity::Unchecked<IfcWorkCalendar>(instance)); return true;
+            case 771: visitor(Entity::Unchecked<IfcWorkPlan>(instance)); return true;
+            case 772: visitor(Entity::Unchecked<IfcWorkSchedule>(instance)); return true;
+            case 773: visitor(Entity::Unchecked<IfcWorkTime>(instance)); return true;
+            case 774: visitor(Entity::Unchecked<IfcZone>(instance)); return true;
+            case 775: visitor(Entity::Unchecked<IfcZShapeProfileDef>(instance)); return true;
+            default: return false;
+        }
+    }
+}
+
+#endif //__RDF_LTD__IFC4_SPLIT_H
@@ -0,0 +1,15200 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers)
+//
+#ifndef __RDF_LTD__IFC4_H
+#define __RDF_LTD__IFC4_H
+
+#include    <assert.h>
+#include    <stdint.h>
+#include    <stddef.h>
+#include    <stdio.h>
+#include    <string.h>
+#include    <math.h>
+#include    <iterator>
+#include    <list>
+#include    <string>
+#include    <vector>
+#include    <unordered_map>
+#include    <unordered_set>
+#include    <memory>
+#include    <type_traits>
+#include    <utility>
+#include    <atomic>
+#include    <mutex>
+#include    <thread>
+#include    <algorithm>
+#if __cplusplus >= 201703L || _MSVC_LANG >= 201703L
+#include    <optional>
+#include    <string_view>
+#endif
+#if __cplusplus >= 202002L || _MSVC_LANG >= 202002L
+#include    <span>
+#endif
+
+#include	"ifcengine.h"
+
+#if !defined(_WIN32) && !defined(_stricmp)
+#include    <strings.h>
+#define _stricmp strcasecmp
+#endif
+
+//
+// Container of generated aggregation types (ListOf..., SetOf...)
+// Define as std::list before including the header to get list based aggregations
+//
+#ifndef RDF_EXPRESS_AGGREGATION_CONTAINER
+#define RDF_EXPRESS_AGGREGATION_CONTAINER std::vector
+#endif
+
+//
+// Layout of entity classes
+// Define RDF_EXPRESS_FLAT_ENTITIES before including the header to derive entity classes from their first supertype without virtual inheritance,
+// objects then have size of SdaiInstance and are trivially copyable, other supertypes are reached by conversion operators
+// Define it the same way in all translation units of a program
+//
+#ifdef RDF_EXPRESS_FLAT_ENTITIES
+#define RDF_EXPRESS_VIRTUAL
+#define RDF_EXPRESS_SUPERTYPE(supertype)
+#else
+#define RDF_EXPRESS_VIRTUAL                 virtual
+#define RDF_EXPRESS_SUPERTYPE(supertype)    , public virtual supertype
+#endif
+
+//
+// Accessor instrumentation
+// Define RDF_EXPRESS_INSTRUMENT before including the header to count calls and cycles of generated accessors per attribute, see DumpAccessorProfile
+// Without it the probes expand to nothing
+//
+#ifdef RDF_EXPRESS_INSTRUMENT
+#if defined(_M_X64) || defined(_M_IX86)
+#include    <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include    <x86intrin.h>
+#else
+#include    <chrono>
+#endif
+#define RDF_EXPRESS_PROBE(attrOrdinal)                  AccessorProbe accessorProbe_(attrOrdinal)
+#else
+#define RDF_EXPRESS_PROBE(attrOrdinal)
+#endif
+
+//
+// Matrix composition of PlacementTable
+// Uses AVX when the compiler targets it (/arch:AVX, -mavx), SSE2 on other x86 and x64 targets
+// Define RDF_EXPRESS_NO_SIMD before including the header to compose matrices with scalar code
+//
+#if !defined(RDF_EXPRESS_NO_SIMD) && defined(__AVX__)
+#include    <immintrin.h>
+#define RDF_EXPRESS_SIMD_AVX
+#elif !defined(RDF_EXPRESS_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include    <emmintrin.h>
+#define RDF_EXPRESS_SIMD_SSE2
+#endif
+
+namespace IFC4
+{
+    ///
+    typedef int_t SdaiModel;
+    typedef int_t SdaiInstance;
+
+    typedef const char* TextValue;
+    typedef int_t       IntValue;
+
+    class StringValue : public std::string
+    {
+    public:
+        StringValue(TextValue str) : std::string(str) {}
+        operator const char* () const { return c_str(); }
+    };
+
+    /// <summary>
+    /// Value or NULL, the value is stored inline without heap allocation
+    /// Copy and move are trivial when they are trivial for T
+    /// </summary>
+    template <typename T> class Nullable
+    {
+    protected:
+        T    m_value;
+        bool m_hasValue;
+
+    public:
+        Nullable() : m_value(), m_hasValue(false) {}
+        Nullable(T value) : m_value(value), m_hasValue(true) {}
+
+        bool IsNull() const { return !m_hasValue; }
+        T Value() const { assert(m_hasValue); if (m_hasValue) return m_value; else return (T) 0; }
+
+#if __cplusplus >= 201703L || _MSVC_LANG >= 201703L
+        Nullable(const std::optional<T>& value) : m_value(value ? *value : T()), m_hasValue(value.has_value()) {}
+        operator std::optional<T>() const { if (m_hasValue) return m_value; else return std::nullopt; }
+#endif
+    };
+
+    static_assert(std::is_trivially_copyable<Nullable<double>>::value, "Nullable of scalar must be trivially copyable");
+
+#ifdef __cpp_lib_string_view
+    /// <summary>
+    /// View of text returned by the engine, empty for NULL
+    /// The engine owns the text, it stays valid while the model is open and the attribute is not changed
+    /// Copy the text or intern it to TextArena to keep it longer
+    /// </summary>
+    inline std::string_view TextView(TextValue text) { return text ? std::string_view(text) : std::string_view(); }
+
+    /// <summary>
+    /// Keeps one copy of each distinct text in large blocks, so copying texts does not allocate memory per text
+    /// Views returned by Intern are NUL terminated and valid until the arena is destroyed
+    /// </summary>
+    class TextArena
+    {
+    public:
+        explicit TextArena(size_t blockSize = 64 * 1024) : m_blockSize(blockSize), m_next(NULL), m_free(0), m_count(0), m_slots(64) {}
+        TextArena(const TextArena&) = delete;
+        TextArena& operator=(const TextArena&) = delete;
+
+        std::string_view Intern(TextValue text) { return Intern(TextView(text)); }
+
+        std::string_view Intern(std::string_view text)
+        {
+            size_t mask = m_slots.size() - 1;
+            for (size_t i = std::hash<std::string_view>()(text) & mask; ; i = (i + 1) & mask) {
+                if (m_slots[i].data() == NULL) {
+                    std::string_view copy = Copy(text);
+                    m_slots[i] = copy;
+                    if (++m_count * 2 > m_slots.size()) {
+                        Rehash();
+                    }
+                    return copy;
+                }
+                if (m_slots[i] == text) {
+                    return m_slots[i];
+                }
+            }
+        }
+
+        /// <summary>
+        /// Number of distinct texts
+        /// </summary>
+        size_t Count() const { return m_count; }
+
+    private:
+        std::string_view Copy(std::string_view text)
+        {
+            size_t size = text.size() + 1;
+            if (size > m_free) {
+                size_t blockSize = size > m_blockSize ? size : m_blockSize;
+                m_blocks.push_back(std::unique_ptr<char[]>(new char[blockSize]));
+                m_next = m_blocks.back().get();
+                m_free = blockSize;
+            }
+            char* copy = m_next;
+            text.copy(copy, text.size());
+            copy[text.size()] = 0;
+            m_next += size;
+            m_free -= size;
+            return std::string_view(copy, text.size());
+        }
+
+        void Rehash()
+        {
+            std::vector<std::string_view> slots(m_slots.size() * 2);
+            size_t mask = slots.size() - 1;
+            for (auto const& text : m_slots) {
+                if (text.data() != NULL) {
+                    size_t i = std::hash<std::string_view>()(text) & mask;
+                    while (slots[i].data() != NULL) {
+                        i = (i + 1) & mask;
+                    }
+                    slots[i] = text;
+                }
+            }
+            m_slots.swap(slots);
+        }
+
+    private:
+        size_t                                  m_blockSize;
+        std::vector<std::unique_ptr<char[]>>    m_blocks;
+        char*                                   m_next;
+        size_t                                  m_free;
+        size_t                                  m_count;
+        std::vector<std::string_view>           m_slots;    //open addressing, empty slot has NULL data
+    };
+
+    /// <summary>
+    /// List of texts interned to TextArena, may be used as TList of text aggregation getters
+    /// </summary>
+    class InternedTextList : public std::vector<std::string_view>
+    {
+    public:
+        explicit InternedTextList(TextArena& arena) : m_arena(&arena) {}
+
+        void push_back(TextValue text) { std::vector<std::string_view>::push_back(m_arena->Intern(text)); }
+
+    private:
+        TextArena* m_arena;
+    };
+#endif
+
+    /// <summary>
+    /// Sets encoding of sdaiSTRING texts of the model, with UTF8 text getters and putters pass UTF-8 without codepage conversion
+    /// UTF-8 getters (get_*_utf8, Utf8Buffer) return UTF-8 with any encoding of the model
+    /// NULL model sets encoding of models created after the call
+    /// </summary>
+    inline bool SetTextEncoding(SdaiModel model, enum_string_encoding encoding = enum_string_encoding::UTF8) { return engiSetStringEncoding(model, encoding) != 0; }
+
+    /// <summary>
+    /// Growable buffer of UTF-8 text
+    /// Reuse one buffer to read many texts without memory allocation per call, the text is valid until the next read to the buffer
+    /// </summary>
+    class Utf8Buffer
+    {
+    public:
+        explicit Utf8Buffer(size_t capacity = 256) : m_data(capacity ? capacity : 1), m_size(0) {}
+
+        /// <summary>
+        /// Reads text attribute by name with sdaiGetAttrBNUnicode, the buffer grows when the text does not fit
+        /// sdaiGetAttrBNUnicode returns size of UTF-8 text with the terminating zero and writes the text if it fits, 0 if the attribute is not set
+        /// Returns NULL if the attribute is not set
+        /// </summary>
+        const char* GetAttr(SdaiInstance instance, TextValue attrName)
+        {
+            m_size = 0;
+            if (!instance || !attrName) {
+                return NULL;
+            }
+
+            int_t size = sdaiGetAttrBNUnicode(instance, attrName, m_data.data(), (int_t) m_data.size());
+            if (size > (int_t) m_data.size()) {
+                m_data.resize((size_t) size);
+                size = sdaiGetAttrBNUnicode(instance, attrName, m_data.data(), (int_t) m_data.size());
+            }
+            if (size <= 0 || size > (int_t) m_data.size()) {
+                return NULL;
+            }
+
+            m_size = (size_t) size - 1;
+            return c_str();
+        }
+
+        /// <summary>
+        /// Copies text to the buffer, returns NULL for NULL text
+        /// </summary>
+        const char* Assign(TextValue text)
+        {
+            if (!text) {
+                m_size = 0;
+                return NULL;
+            }
+            m_size = strlen(text);
+            if (m_size >= m_data.size()) {
+                m_data.resize(m_size + 1);
+            }
+            memcpy(m_data.data(), text, m_size + 1);
+            return c_str();
+        }
+
+        const char* c_str() const { return (const char*) m_data.data(); }
+        size_t size() const { return m_size; }
+#ifdef __cpp_lib_string_view
+        std::string_view view() const { return std::string_view(c_str(), m_size); }
+#endif
+
+    private:
+        std::vector<unsigned char>  m_data;
+        size_t                      m_size;   //without terminating zero
+    };
+
+    /// <summary>
+    /// Buffer of the calling thread used by UTF-8 getters without buffer argument
+    /// </summary>
+    inline Utf8Buffer& ThreadUtf8Buffer() { static thread_local Utf8Buffer buffer; return buffer; }
+
+    /// <summary>
+    /// Perfect hash of enumeration values, computed by the generator
+    /// Each value falls into its own slot, so decoding takes one hash and one string compare
+    /// </summary>
+    struct EnumerationHash
+    {
+        TextValue*      values;
+        const short*    slots;  //index in values or -1, size is mask + 1
+        uint32_t        seed;
+        uint32_t        mask;
+    };
+
+    //
+    // FNV-1a of upper case ASCII, the generator uses the same function to find the seed
+    //
+    constexpr uint32_t EnumerationHashSlot(TextValue value, uint32_t seed, uint32_t mask)
+    {
+        uint32_t h = 2166136261u ^ seed;
+        for (; *value; value++) {
+            unsigned char c = (unsigned char) *value;
+            if (c >= 'a' && c <= 'z') {
+                c = (unsigned char) (c - 'a' + 'A');
+            }
+            h = (h ^ c) * 16777619u;
+        }
+        return (h ^ (h >> 15)) & mask;
+    }
+
+    //
+    //
+    enum class LOGICAL_VALUE { False = 0, True, Unknown };
+    inline TextValue LOGICAL_VALUE_[] = {"F", "T", "U", NULL};
+    inline constexpr short LOGICAL_VALUE_slots[] = {2, -1, -1, 1, -1, -1, 0, -1};
+    inline constexpr EnumerationHash LOGICAL_VALUE_hash = {LOGICAL_VALUE_, LOGICAL_VALUE_slots, 0u, 7u};
+
+    //
+    //
+    inline int EnumerationNameToIndex(const EnumerationHash& hash, TextValue value)
+    {
+        if (value) {
+            int i = hash.slots[EnumerationHashSlot(value, hash.seed, hash.mask)];
+            if (i >= 0 && 0 == _stricmp(value, hash.values[i])) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    /// <summary>
+    /// Entity and attribute names of generated accessors, indexed by attribute ordinal
+    /// </summary>
+    struct AttributeName
+    {
+        TextValue entityName;
+        TextValue attrName;
+    };
+
+    inline const AttributeName* SchemaAttributes(IntValue& count); //generated after entities
+
+    /// <summary>
+    /// Generation of model handles, changes when a model is closed
+    /// The engine may give the handle of a closed model to a new model, per-model caches of generated wrappers are dropped when the generation changes
+    /// </summary>
+    inline std::atomic<uint32_t>& ModelGeneration() { static std::atomic<uint32_t> generation(0); return generation; }
+
+    /// <summary>
+    /// Drops attribute and entity handles cached by generated wrappers in all threads
+    /// CloseModel calls it, call it after sdaiCloseModel when a model is closed with the engine API
+    /// </summary>
+    inline void ForgetModels() { ModelGeneration().fetch_add(1); }
+
+    /// <summary>
+    /// Closes the model and drops handles cached for it by generated wrappers
+    /// </summary>
+    inline void CloseModel(SdaiModel model) { sdaiCloseModel(model); ForgetModels(); }
+
+    /// <summary>
+    /// Resolves SdaiAttr handles of generated accessors once per model, so accessors do not look up attributes by name on every call
+    /// Handles of all models are dropped when a model is closed, see ForgetModels
+    /// The cache is keyed by model handle: after sdaiCloseModel without ForgetModels the engine may give the handle to a new model
+    /// of another schema, and accessors would pass handles of the closed model's attributes to it
+    /// </summary>
+    class AttributeCache
+    {
+    public:
+        static SdaiAttr Get(SdaiInstance instance, IntValue ordinal)
+        {
+            if (!instance) {
+                return NULL;
+            }
+
+            thread_local AttributeCache cache;
+
+            SdaiModel model = sdaiGetInstanceModel(instance);
+            uint32_t generation = ModelGeneration().load(std::memory_order_relaxed);
+            if (model != cache.m_model || generation != cache.m_generation) {
+                cache.SetModel(model, generation);
+            }
+
+            SdaiAttr& attr = (*cache.m_attrs)[ordinal];
+            if (!attr) {
+                attr = cache.Resolve(ordinal);
+            }
+            return attr;
+        }
+
+    private:
+        AttributeCache() : m_model(0), m_generation(0), m_attrs(NULL) {}
+
+        void SetModel(SdaiModel model, uint32_t generation)
+        {
+            if (generation != m_generation) {
+                m_models.clear();
+                m_generation = generation;
+            }
+
+            m_model = model;
+            m_attrs = &m_models[model];
+            if (m_attrs->empty()) {
+                IntValue count = 0;
+                SchemaAttributes(count);
+                m_attrs->resize(count, NULL);
+            }
+        }
+
+        SdaiAttr Resolve(IntValue ordinal)
+        {
+            IntValue count = 0;
+            const AttributeName& name = SchemaAttributes(count)[ordinal];
+            SdaiEntity entity = sdaiGetEntity(m_model, name.entityName);
+            return entity ? sdaiGetAttrDefinition(entity, name.attrName) : NULL;
+        }
+
+    private:
+        SdaiModel                                               m_model;
+        uint32_t                                                m_generation;
+        std::vector<SdaiAttr>*                                  m_attrs;
+        std::unordered_map<SdaiModel, std::vector<SdaiAttr>>    m_models;
+    };
+
+#ifdef RDF_EXPRESS_INSTRUMENT
+    /// <summary>
+    /// Calls and cycles of generated accessors by attribute ordinal, collected when RDF_EXPRESS_INSTRUMENT is defined
+    /// Each thread counts into its own table without locks, tables of finished threads are taken over by new threads
+    /// </summary>
+    class AccessorProfile
+    {
+    public:
+        static uint64_t Now()
+        {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+        }
+
+        static void Add(IntValue attrOrdinal, uint64_t cycles)
+        {
+            //only the owning thread writes, relaxed load and store is a plain increment
+            Counter& counter = ThreadTable().counters[attrOrdinal];
+            counter.calls.store(counter.calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            counter.cycles.store(counter.cycles.load(std::memory_order_relaxed) + cycles, std::memory_order_relaxed);
+        }
+
+        //calls of accessors of the attribute counted by all threads so far
+        static uint64_t Calls(IntValue attrOrdinal)
+        {
+            uint64_t calls = 0;
+            Tables& tables = AllTables();
+            std::lock_guard<std::mutex> lock(tables.mutex);
+            for (auto& table : tables.list) {
+                calls += table->counters[attrOrdinal].calls.load(std::memory_order_relaxed);
+            }
+            return calls;
+        }
+
+        static void Dump(FILE* file)
+        {
+            IntValue count = 0;
+            const AttributeName* names = SchemaAttributes(count);
+
+            std::vector<uint64_t> calls(count, 0);
+            std::vector<uint64_t> cycles(count, 0);
+            {
+                Tables& tables = AllTables();
+                std::lock_guard<std::mutex> lock(tables.mutex);
+                for (auto& table : tables.list) {
+                    for (IntValue i = 0; i < count; i++) {
+                        calls[i] += table->counters[i].calls.load(std::memory_order_relaxed);
+                        cycles[i] += table->counters[i].cycles.load(std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            std::vector<IntValue> order;
+            for (IntValue i = 0; i < count; i++) {
+                if (calls[i]) {
+                    order.push_back(i);
+                }
+            }
+            std::sort(order.begin(), order.end(), [&](IntValue i1, IntValue i2) { return cycles[i1] > cycles[i2]; });
+
+            fprintf(file, "%-64s %14s %16s %12s\n", "attribute", "calls", "cycles", "cycles/call");
+            for (IntValue i : order) {
+                char name[256];
+                snprintf(name, sizeof(name), "%s.%s", names[i].entityName, names[i].attrName);
+                fprintf(file, "%-64s %14llu %16llu %12.1f\n", name, (unsigned long long) calls[i], (unsigned long long) cycles[i], (double) cycles[i] / (double) calls[i]);
+            }
+        }
+
+    private:
+        struct Counter
+        {
+            std::atomic<uint64_t>   calls;
+            std::atomic<uint64_t>   cycles;
+        };
+
+        struct Table
+        {
+            std::unique_ptr<Counter[]>  counters;
+            bool                        inUse;
+        };
+
+        struct Tables
+        {
+            std::mutex                              mutex;
+            std::vector<std::unique_ptr<Table>>     list;
+        };
+
+        struct ThreadOwner
+        {
+            Table* table;
+
+            ThreadOwner() : table(Acquire()) {}
+            ~ThreadOwner() { Release(table); }
+        };
+
+        static Tables& AllTables()
+        {
+            static Tables tables;
+            return tables;
+        }
+
+        static Table& ThreadTable()
+        {
+            thread_local ThreadOwner owner;
+            return *owner.table;
+        }
+
+        static Table* Acquire()
+        {
+            Tables& tables = AllTables();
+            std::lock_guard<std::mutex> lock(tables.mutex);
+
+            for (auto& table : tables.list) {
+                if (!table->inUse) {
+                    table->inUse = true;
+                    return table.get();
+                }
+            }
+
+            IntValue count = 0;
+            SchemaAttributes(count);
+
+            tables.list.push_back(std::unique_ptr<Table>(new Table()));
+            Table* table = tables.list.back().get();
+            table->counters.reset(new Counter[count]());
+            table->inUse = true;
+            return table;
+        }
+
+        static void Release(Table* table)
+        {
+            Tables& tables = AllTables();
+            std::lock_guard<std::mutex> lock(tables.mutex);
+            table->inUse = false;
+        }
+    };
+
+    /// <summary>
+    /// Adds the call and cycles of enclosing accessor to AccessorProfile, see RDF_EXPRESS_PROBE
+    /// Attribute ordinal -1 is not counted, it is used by selectors not returned by entity accessors
+    /// </summary>
+    class AccessorProbe
+    {
+    public:
+        AccessorProbe(IntValue attrOrdinal) : m_attrOrdinal(attrOrdinal), m_start(attrOrdinal >= 0 ? AccessorProfile::Now() : 0) {}
+        ~AccessorProbe() { if (m_attrOrdinal >= 0) { AccessorProfile::Add(m_attrOrdinal, AccessorProfile::Now() - m_start); } }
+
+        AccessorProbe(const AccessorProbe&) = delete;
+        AccessorProbe& operator=(const AccessorProbe&) = delete;
+
+    private:
+        IntValue    m_attrOrdinal;
+        uint64_t    m_start;
+    };
+#endif
+
+    /// <summary>
+    /// Writes calls and cycles of generated accessors per attribute, most expensive first
+    /// Cycles are time stamp counter ticks on x86 and nanoseconds elsewhere
+    /// Select attributes are counted by is_, get_, put_ and as_ methods of selectors returned by entity accessors
+    /// </summary>
+    inline void DumpAccessorProfile(FILE* file)
+    {
+#ifdef RDF_EXPRESS_INSTRUMENT
+        AccessorProfile::Dump(file);
+#else
+        fprintf(file, "Accessor profile is not collected, define RDF_EXPRESS_INSTRUMENT\n");
+#endif
+    }
+
+    /// <summary>
+    /// Entity of the schema and its direct supertypes, indexed by entity ordinal
+    /// </summary>
+    struct EntityDefinition
+    {
+        TextValue   name;
+        IntValue    supertypes; //index in SchemaSupertypes_ of the -1 terminated list of supertype ordinals
+    };
+
+    inline const EntityDefinition* SchemaEntities(IntValue& count); //generated after entities
+    inline const IntValue* SchemaSupertypes(); //generated after entities
+    template <typename TVisitor> bool Visit(SdaiInstance instance, TVisitor&& visitor); //generated after entities
+
+    /// <summary>
+    /// Answers kind-of questions by entity ordinals, using bitset of all supertypes of each schema entity
+    /// </summary>
+    class EntityLattice
+    {
+    public:
+        static const EntityLattice& Get()
+        {
+            static const EntityLattice lattice;
+            return lattice;
+        }
+
+        bool IsKindOf(IntValue typeOrdinal, IntValue entityOrdinal) const
+        {
+            return (m_bits[typeOrdinal * m_words + entityOrdinal / 64] >> (entityOrdinal % 64)) & 1;
+        }
+
+    private:
+        EntityLattice()
+        {
+            SchemaEntities(m_count);
+            m_words = (m_count + 63) / 64;
+            m_bits.resize(m_count * m_words, 0);
+
+            std::vector<bool> done(m_count, false);
+            for (IntValue i = 0; i < m_count; i++) {
+                AddSupertypes(i, done);
+            }
+        }
+
+        void AddSupertypes(IntValue ordinal, std::vector<bool>& done)
+        {
+            if (done[ordinal]) {
+                return;
+            }
+            done[ordinal] = true;
+
+            uint64_t* bits = &m_bits[ordinal * m_words];
+            bits[ordinal / 64] |= uint64_t(1) << (ordinal % 64);
+
+            IntValue count = 0;
+            for (const IntValue* parent = SchemaSupertypes() + SchemaEntities(count)[ordinal].supertypes; *parent >= 0; parent++) {
+                AddSupertypes(*parent, done);
+                const uint64_t* parentBits = &m_bits[*parent * m_words];
+                for (IntValue w = 0; w < m_words; w++) {
+                    bits[w] |= parentBits[w];
+                }
+            }
+        }
+
+    private:
+        IntValue                m_count;
+        IntValue                m_words;
+        std::vector<uint64_t>   m_bits;
+    };
+
+    /// <summary>
+    /// Maps SdaiEntity of instances to entity ordinals, built once per model
+    /// Entity handles are opaque to the wrappers, so the table is a vector indexed by hash of the handle, at most half full
+    /// Tables of all models are dropped when a model is closed, see ForgetModels
+    /// </summary>
+    class EntityTypeTable
+    {
+    public:
+        //ordinal of the exact entity of the instance, -1 if the entity is not from this schema
+        static IntValue GetTypeOrdinal(SdaiInstance instance)
+        {
+            thread_local EntityTypeTable table;
+
+            SdaiModel model = sdaiGetInstanceModel(instance);
+            uint32_t generation = ModelGeneration().load(std::memory_order_relaxed);
+            if (model != table.m_model || generation != table.m_generation) {
+                table.SetModel(model, generation);
+            }
+
+            return table.GetOrdinal(sdaiGetInstanceType(instance));
+        }
+
+        static bool IsKindOf(SdaiInstance instance, IntValue entityOrdinal)
+        {
+            IntValue typeOrdinal = GetTypeOrdinal(instance);
+            if (typeOrdinal < 0) {
+                //the instance type is not from this schema
+                IntValue count = 0;
+                return sdaiIsKindOfBN(instance, SchemaEntities(count)[entityOrdinal].name) != 0;
+            }
+
+            return EntityLattice::Get().IsKindOf(typeOrdinal, entityOrdinal);
+        }
+
+    private:
+        struct Slot
+        {
+            SdaiEntity  entity;     //0 for empty slot
+            IntValue    ordinal;    //-1 for empty slot
+        };
+
+        typedef std::vector<Slot> Ordinals;
+
+        EntityTypeTable() : m_model(0), m_generation(0), m_types(NULL), m_lastType(0), m_lastOrdinal(-1) {}
+
+        void SetModel(SdaiModel model, uint32_t generation)
+        {
+            if (generation != m_generation) {
+                m_models.clear();
+                m_generation = generation;
+            }
+
+            m_model = model;
+            m_lastType = 0;
+            m_lastOrdinal = -1;
+
+            m_types = &m_models[model];
+            if (m_types->empty()) {
+                IntValue count = 0;
+                const EntityDefinition* entities = SchemaEntities(count);
+                size_t size = 16;
+                while (size < 2 * (size_t) count) {
+                    size *= 2;
+                }
+                m_types->assign(size, Slot{ 0, -1 });
+                for (IntValue i = 0; i < count; i++) {
+                    SdaiEntity entity = sdaiGetEntity(model, entities[i].name);
+                    if (entity) {
+                        Slot& slot = Find(entity);
+                        slot.entity = entity;
+                        slot.ordinal = i;
+                    }
+                }
+            }
+        }
+
+        IntValue GetOrdinal(SdaiEntity type)
+        {
+            if (type != m_lastType) {
+                m_lastType = type;
+                m_lastOrdinal = Find(type).ordinal;
+            }
+            return m_lastOrdinal;
+        }
+
+        //slot of the entity or empty slot where it would be
+        Slot& Find(SdaiEntity entity)
+        {
+            size_t mask = m_types->size() - 1;
+            uint64_t h = (uint64_t) entity * 0x9E3779B97F4A7C15ull;
+            for (size_t i = (size_t) (h >> 32) & mask; ; i = (i + 1) & mask) {
+                Slot& slot = (*m_types)[i];
+                if (slot.entity == entity || slot.entity == 0) {
+                    return slot;
+                }
+            }
+        }
+
+    private:
+        SdaiModel                                   m_model;
+        uint32_t                                    m_generation;
+        Ordinals*                                   m_types;
+        SdaiEntity                                  m_lastType;
+        IntValue                                    m_lastOrdinal;
+        std::unordered_map<SdaiModel, Ordinals>     m_models;
+    };
+
+    inline const TextValue* SchemaTypePaths(IntValue& count); //generated after entities
+
+    /// <summary>
+    /// Maps ADB type paths to indices in SchemaTypePaths_, so SELECT probes compare integers
+    /// Paths are interned on first use, case-insensitive
+    /// </summary>
+    class TypePathTable
+    {
+    public:
+        static IntValue Get(TextValue path)
+        {
+            if (!path) {
+                return -1;
+            }
+
+            thread_local TypePathTable table;
+
+            auto it = table.m_ids.find(path);
+            return (it != table.m_ids.end()) ? it->second : -1;
+        }
+
+        static TextValue Name(IntValue typePath)
+        {
+            IntValue count = 0;
+            return SchemaTypePaths(count)[typePath];
+        }
+
+    private:
+        struct Hash
+        {
+            size_t operator()(TextValue path) const { return EnumerationHashSlot(path, 0, 0xFFFFFFFFu); }
+        };
+
+        struct Equal
+        {
+            bool operator()(TextValue path1, TextValue path2) const { return 0 == _stricmp(path1, path2); }
+        };
+
+        TypePathTable()
+        {
+            IntValue count = 0;
+            const TextValue* paths = SchemaTypePaths(count);
+            for (IntValue i = 0; i < count; i++) {
+                m_ids[paths[i]] = i;
+            }
+        }
+
+    private:
+        std::unordered_map<TextValue, IntValue, Hash, Equal> m_ids;
+    };
+
+    /// <summary>
+    /// Per-thread pool of ADBs owned by Select objects
+    /// Empty ADBs used to read SELECT values are reused, ADBs created to put a value are deleted when the last owner releases them
+    /// A Select object and its copies may be passed to another thread and destroyed there, but not used by two threads at once:
+    /// the ADB released on a foreign thread is deleted and its record goes back to the owning pool, which outlives its thread until all records are back
+    /// </summary>
+    class ADBPool
+    {
+    public:
+        struct Ref
+        {
+            void*       adb;
+            IntValue    refs;
+            bool        reusable;
+            ADBPool*    owner;
+            Ref*        next;
+        };
+
+        static ADBPool& Get()
+        {
+            struct ThreadPool
+            {
+                ADBPool* pool = new ADBPool();
+                ~ThreadPool() { pool->Detach(); }
+            };
+            thread_local ThreadPool threadPool;
+            return *threadPool.pool;
+        }
+
+        //
+        // Empty ADB to read a value into
+        //
+        Ref* Empty()
+        {
+            Ref* ref = m_emptyADBs;
+            if (ref) {
+                m_emptyADBs = ref->next;
+                m_issued++;
+            }
+            else {
+                ref = NewRef();
+                ref->adb = sdaiCreateEmptyADB();
+                ref->reusable = true;
+            }
+            ref->refs = 1;
+            ref->next = NULL;
+            return ref;
+        }
+
+        //
+        // Takes ownership of ADB created by sdaiCreateADB
+        //
+        Ref* Own(void* adb)
+        {
+            Ref* ref = NewRef();
+            ref->adb = adb;
+            ref->reusable = false;
+            ref->refs = 1;
+            ref->next = NULL;
+            return ref;
+        }
+
+        void Release(Ref* ref)
+        {
+            if (--ref->refs > 0) {
+                return;
+            }
+
+            if (ref->owner != this) {
+                ref->owner->ReleaseForeign(ref);
+            }
+            else if (ref->reusable) {
+                ref->next = m_emptyADBs;
+                m_emptyADBs = ref;
+                m_issued--;
+            }
+            else {
+                sdaiDeleteADB(ref->adb);
+                ref->adb = NULL;
+                ref->next = m_freeRefs;
+                m_freeRefs = ref;
+                m_issued--;
+            }
+        }
+
+    private:
+        ADBPool() : m_emptyADBs(NULL), m_freeRefs(NULL), m_issued(0), m_foreignRefs(NULL), m_pending(0) {}
+
+        //
+        // Called on the thread that released the last copy, the owner takes the record back in NewRef
+        //
+        void ReleaseForeign(Ref* ref)
+        {
+            sdaiDeleteADB(ref->adb);
+            ref->adb = NULL;
+
+            Ref* head = m_foreignRefs.load(std::memory_order_relaxed);
+            do {
+                ref->next = head;
+            } while (!m_foreignRefs.compare_exchange_weak(head, ref, std::memory_order_release, std::memory_order_relaxed));
+
+            //the pool is deleted by the last foreign release after its thread has finished
+            if (m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete this;
+            }
+        }
+
+        //
+        // Called when the thread finishes, m_pending counts records still owned by Select objects on other threads
+        //
+        void Detach()
+        {
+            for (Ref* ref = m_emptyADBs; ref; ref = ref->next) {
+                sdaiDeleteADB(ref->adb);
+            }
+            m_emptyADBs = NULL;
+
+            if (m_pending.fetch_add(m_issued, std::memory_order_acq_rel) + m_issued == 0) {
+                delete this;
+            }
+        }
+
+        Ref* NewRef()
+        {
+            if (!m_freeRefs) {
+                m_freeRefs = m_foreignRefs.exchange(NULL, std::memory_order_acquire);
+            }
+            if (!m_freeRefs) {
+                const int BLOCK_SIZE = 64;
+                m_blocks.push_back(std::unique_ptr<Ref[]>(new Ref[BLOCK_SIZE]));
+                for (int i = 0; i < BLOCK_SIZE; i++) {
+                    m_blocks.back()[i].next = m_freeRefs;
+                    m_freeRefs = &m_blocks.back()[i];
+                }
+            }
+
+            Ref* ref = m_freeRefs;
+            m_freeRefs = ref->next;
+            ref->owner = this;
+            m_issued++;
+            return ref;
+        }
+
+    private:
+        Ref*                                    m_emptyADBs;
+        Ref*                                    m_freeRefs;
+        std::vector<std::unique_ptr<Ref[]>>     m_blocks;
+        IntValue                                m_issued;       //records held by Select objects, counted on the owning thread only
+        std::atomic<Ref*>                       m_foreignRefs;  //records released on other threads
+        std::atomic<IntValue>                   m_pending;      //minus foreign releases, plus m_issued once the thread has finished
+    };
+
+    /// <summary>
+    /// Helper class to handle and access SELECT instance data
+    /// Type paths are passed as indices in SchemaTypePaths_ and entity types as entity ordinals, -1 means any type
+    /// </summary>
+    class Select
+    {
+    protected:
+        SdaiInstance m_instance;
+        IntValue m_attrOrdinal; //attribute of m_instance holding the value, -1 if the value is not read from an attribute
+
+    private:
+        void* m_adb;
+        ADBPool::Ref* m_adbRef;
+        IntValue m_typePath; //cached index of ADB type path, -2 if not known yet
+        Select* m_outerSelect;
+
+    public:
+        void* ADB()
+        {
+            if (m_outerSelect) {
+                return m_outerSelect->ADB();
+            }
+
+            if (!m_adb && m_instance && m_attrOrdinal >= 0) {
+                ADBPool::Ref* ref = ADBPool::Get().Empty();
+                if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiADB, ref->adb)) {
+                    m_adb = ref->adb;
+                    m_adbRef = ref;
+                    m_typePath = -2;
+                }
+                else {
+                    ADBPool::Get().Release(ref);
+                }
+            }
+
+            return m_adb;
+        }
+
+#ifdef RDF_EXPRESS_INSTRUMENT
+        //ordinal of the attribute whose entity accessor returned the selector, calls of the selector are counted for it
+        IntValue ProbeAttr() { return m_outerSelect ? m_outerSelect->ProbeAttr() : m_attrOrdinal; }
+#endif
+
+        Select(const Select& src)
+            : m_instance(src.m_instance), m_attrOrdinal(src.m_attrOrdinal), m_adb(src.m_adb), m_adbRef(src.m_adbRef), m_typePath(src.m_typePath), m_outerSelect(src.m_outerSelect)
+        {
+            if (m_adbRef) {
+                m_adbRef->refs++;
+            }
+        }
+
+        Select& operator=(const Select& src)
+        {
+            if (src.m_adbRef) {
+                src.m_adbRef->refs++;
+            }
+            ReleaseADB();
+
+            m_instance = src.m_instance;
+            m_attrOrdinal = src.m_attrOrdinal;
+            m_adb = src.m_adb;
+            m_adbRef = src.m_adbRef;
+            m_typePath = src.m_typePath;
+            m_outerSelect = src.m_outerSelect;
+            return *this;
+        }
+
+        ~Select()
+        {
+            ReleaseADB();
+        }
+
+    protected:
+        Select(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL)
+            : m_instance(instance), m_attrOrdinal(attrOrdinal), m_adb(adb), m_adbRef(NULL), m_typePath(-2), m_outerSelect(NULL)
+        {
+            assert(instance);
+        }
+
+        Select(Select* outer)
+            : m_instance(0), m_attrOrdinal(-1), m_adb(NULL), m_adbRef(NULL), m_typePath(-2), m_outerSelect(outer)
+        {
+            assert(outer);
+            if (m_outerSelect) {
+                m_instance = m_outerSelect->m_instance;
+            }
+        }
+
+        void SetADB(void* adb)
+        {
+            if (m_outerSelect) {
+                m_outerSelect->SetADB(adb);
+            }
+            else {
+                ReleaseADB();
+
+                if (m_instance && m_attrOrdinal >= 0) {
+                    //the value is copied to the attribute, next read will get it from there
+                    sdaiPutAttr(m_instance, getAttrDefinition(), sdaiADB, adb);
+                    sdaiDeleteADB(adb);
+                }
+                else {
+                    m_adb = adb;
+                    m_adbRef = ADBPool::Get().Own(adb);
+                }
+            }
+        }
+
+        //definition of the attribute holding the value, resolved once per model
+        SdaiAttr getAttrDefinition() { return (m_attrOrdinal >= 0) ? AttributeCache::Get(m_instance, m_attrOrdinal) : NULL; }
+
+        //name of the attribute holding the value, for by-name functions of the engine
+        TextValue getAttrName() { IntValue count = 0; return (m_attrOrdinal >= 0) ? SchemaAttributes(count)[m_attrOrdinal].attrName : NULL; }
+
+        void ReleaseADB()
+        {
+            if (m_adbRef) {
+                ADBPool::Get().Release(m_adbRef);
+                m_adbRef = NULL;
+            }
+            m_adb = NULL;
+            m_typePath = -2;
+        }
+
+        //
+        IntValue ADBTypePath()
+        {
+            if (m_outerSelect) {
+                return m_outerSelect->ADBTypePath();
+            }
+
+            void* adb = ADB();
+            if (m_typePath == -2) {
+                m_typePath = adb ? TypePathTable::Get(sdaiGetADBTypePath(adb, 0)) : -1;
+            }
+            return m_typePath;
+        }
+
+        //
+        bool IsTypePath(IntValue typePath)
+        {
+            return typePath < 0 || typePath == ADBTypePath();
+        }
+
+        //
+        void* CreateADB(IntValue sdaiType, const void* value, IntValue typePath)
+        {
+            void* adb = sdaiCreateADB(sdaiType, value);
+            sdaiPutADBTypePath(adb, 1, TypePathTable::Name(typePath));
+            return adb;
+        }
+
+        //
+        template <typename T> Nullable<T> getSimpleValue(IntValue typePath, IntValue sdaiType)
+        {
+            Nullable<T> ret;
+            if (void* adb = ADB()) {
+                if (IsTypePath(typePath)) {
+                    T val = (T) 0;
+                    if (sdaiGetADBValue(adb, sdaiType, &val)) {
+                        ret = val;
+                    }
+                }
+            }
+            return ret;
+        }
+
+        //
+        template <typename T> void putSimpleValue(IntValue typePath, IntValue sdaiType, T value)
+        {
+            SetADB(CreateADB(sdaiType, &value, typePath));
+        }
+
+        //
+        TextValue getTextValue(IntValue typePath, IntValue sdaiType)
+        {
+            TextValue ret = NULL;
+            if (void* adb = ADB()) {
+                if (IsTypePath(typePath)) {
+                    if (!sdaiGetADBValue(adb, sdaiType, &ret)) {
+                        ret = NULL;
+                    }
+                }
+            }
+            return ret;
+        }
+
+        //
+        void putTextValue(IntValue typePath, IntValue sdaiType, TextValue value)
+        {
+            SetADB(CreateADB(sdaiType, value, typePath));
+        }
+
+        //
+        int getEnumerationValue(IntValue typePath, const EnumerationHash& rEnumHash)
+        {
+            int ret = -1;
+            if (void* adb = ADB()) {
+                if (IsTypePath(typePath)) {
+                    TextValue value = NULL;
+                    if (sdaiGetADBValue(adb, sdaiENUM, &value)) {
+                        ret = EnumerationNameToIndex(rEnumHash, value);
+                    }
+                }
+            }
+            return ret;
+        }
+
+        //
+        void putEnumerationValue(IntValue typePath, TextValue value)
+        {
+            SetADB(CreateADB(sdaiENUM, value, typePath));
+        }
+
+        //
+        SdaiInstance getEntityInstance(IntValue entityOrdinal)
+        {
+            SdaiInstance ret = 0;
+            if (auto adb = ADB()) {
+                SdaiInstance inst = 0;
+                if (sdaiGetADBValue(adb, sdaiINSTANCE, &inst) && inst) {
+                    if (entityOrdinal < 0 || EntityTypeTable::IsKindOf(inst, entityOrdinal)) {
+                        ret = inst;
+                    }
+                }
+            }
+            return ret;
+        }
+
+        //
+        void putEntityInstance(IntValue entityOrdinal, SdaiInstance inst)
+        {
+            if (inst == 0 || EntityTypeTable::IsKindOf(inst, entityOrdinal)) {
+                auto adb = sdaiCreateADB(sdaiINSTANCE, (void*) inst);
+                SetADB(adb);
+            }
+            else {
+                assert(0);
+            }
+        }
+
+        //
+        SdaiAggr getAggrValue(IntValue typePath)
+        {
+            SdaiAggr ret = NULL;
+            if (void* adb = ADB()) {
+                if (IsTypePath(typePath)) {
+                    if (!sdaiGetADBValue(adb, sdaiAGGR, &ret)) {
+                        ret = NULL;
+                    }
+                }
+            }
+            return ret;
+        }
+
+        //
+        void putAggrValue(IntValue typePath, SdaiAggr value)
+        {
+            SetADB(CreateADB(sdaiAGGR, value, typePath));
+        }
+
+        //
+        bool IsADBType(IntValue typePath)
+        {
+            return ADB() && typePath == ADBTypePath();
+        }
+
+        bool IsADBEntity(IntValue entityOrdinal)
+        {
+            if (void* adb = ADB()) {
+                IntValue inst = 0;
+                if (sdaiGetADBValue(adb, sdaiINSTANCE, &inst) && inst) {
+                    if (EntityTypeTable::IsKindOf(inst, entityOrdinal)) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+    };
+
+    /// <summary>
+    /// Aggregations templates
+    /// </summary>
+    /// 
+
+    template <typename T> using AggrContainer = RDF_EXPRESS_AGGREGATION_CONTAINER<T>;
+
+    //
+    // Pre-sizes containers that support reserve(), no-op for others
+    //
+    template <typename TList> auto ReserveAggrImpl(TList& lst, IntValue count, int) -> decltype(lst.reserve(0), void())
+    {
+        lst.reserve(lst.size() + (size_t) count);
+    }
+
+    template <typename TList> void ReserveAggrImpl(TList&, IntValue, long) {}
+
+    template <typename TList> void ReserveAggr(TList& lst, IntValue count) { ReserveAggrImpl(lst, count, 0); }
+
+    template <typename TArrayElem, typename TList> void ArrayToList(TArrayElem arrayElems[], IntValue numOfElems, TList& lst)
+    {
+        ReserveAggr(lst, numOfElems);
+        for (IntValue i = 0; i < numOfElems; i++) {
+            lst.push_back(arrayElems[i]);
+        }
+    }
+
+    //
+    // Iterable view of C array, lets serializers write the array without copying it to a list
+    //
+    template <typename TArrayElem> struct ArrayRange
+    {
+        TArrayElem* first;
+        size_t      count;
+
+        TArrayElem* begin() const { return first; }
+        TArrayElem* end() const { return first + count; }
+    };
+
+    /// <summary>
+    /// Reads aggregation of aggregations of numbers into flat buffer, inner aggregation i goes to buffer[i * stride]...buffer[i * stride + stride - 1]
+    /// Shorter inner aggregations are padded with 0, longer ones are truncated, inner aggregations that do not fit the buffer are not read
+    /// Returns number of inner aggregations, call with NULL buffer to get the number only
+    /// </summary>
+    template <typename TElem, typename TSdaiElem, IntValue sdaiType> IntValue FlatAggrFromAttr(SdaiInstance instance, SdaiAttr attr, TElem* buffer, size_t size, size_t stride)
+    {
+        assert(sdaiType == sdaiINTEGER || sdaiType == sdaiREAL);
+
+        SdaiAggr aggr = NULL;
+        if (!sdaiGetAttr(instance, attr, sdaiAGGR, &aggr) || !aggr) {
+            return 0;
+        }
+
+        IntValue cnt = sdaiGetMemberCount(aggr);
+        if (!buffer || !stride) {
+            return cnt;
+        }
+
+        IntValue rows = (size / stride < (size_t) cnt) ? (IntValue) (size / stride) : cnt;
+        for (IntValue i = 0; i < rows; i++) {
+            SdaiAggr nested = NULL;
+            sdaiGetAggrByIndex(aggr, i, sdaiAGGR, &nested);
+            IntValue nestedCnt = nested ? sdaiGetMemberCount(nested) : 0;
+
+            TElem* row = buffer + i * stride;
+            for (size_t j = 0; j < stride; j++) {
+                TSdaiElem val = 0;
+                if ((IntValue) j < nestedCnt) {
+                    sdaiGetAggrByIndex(nested, (IntValue) j, sdaiType, &val);
+                }
+                row[j] = (TElem) val;
+            }
+        }
+
+        return cnt;
+    }
+
+    //
+    // Reads all inner aggregations into flat vector, see FlatAggrFromAttr
+    //
+    template <typename TElem, typename TSdaiElem, IntValue sdaiType> IntValue FlatAggrFromAttr(SdaiInstance instance, SdaiAttr attr, std::vector<TElem>& flat, size_t stride)
+    {
+        IntValue cnt = FlatAggrFromAttr<TElem, TSdaiElem, sdaiType>(instance, attr, (TElem*) NULL, 0, stride);
+        flat.resize(cnt * stride);
+        return FlatAggrFromAttr<TElem, TSdaiElem, sdaiType>(instance, attr, flat.data(), flat.size(), stride);
+    }
+
+    /// <summary>
+    /// Writes flat buffer as aggregation of aggregations of numbers, buffer[i * stride]...buffer[i * stride + stride - 1] go to inner aggregation i
+    /// Trailing elements that do not fill whole inner aggregation are not written
+    /// </summary>
+    template <typename TElem, typename TSdaiElem, IntValue sdaiType> SdaiAggr FlatAggrToAttr(SdaiInstance instance, SdaiAttr attr, const TElem* buffer, size_t size, size_t stride)
+    {
+        assert(sdaiType == sdaiINTEGER || sdaiType == sdaiREAL);
+
+        SdaiAggr aggr = sdaiCreateAggr(instance, attr);
+        if (!buffer || !stride) {
+            return aggr;
+        }
+
+        size_t rows = size / stride;
+        for (size_t i = 0; i < rows; i++) {
+            SdaiAggr nested = sdaiCreateAggr(instance, NULL);
+            const TElem* row = buffer + i * stride;
+            for (size_t j = 0; j < stride; j++) {
+                TSdaiElem val = (TSdaiElem) row[j];
+                sdaiAppend(nested, sdaiType, &val);
+            }
+            sdaiAppend(aggr, sdaiAGGR, nested);
+        }
+
+        return aggr;
+    }
+
+    /// <summary>
+    /// Base of aggregation serializers, TSerializer is the derived serializer class
+    /// Serializers have no state and no virtual methods, nested serializers are called directly and can be inlined into the loops of outer ones
+    /// </summary>
+    template <typename TList, typename TSerializer> class AggrSerializer
+    {
+    public:
+        //
+        static void FromAttr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+        {
+            SdaiAggr aggr = NULL;
+            sdaiGetAttr(instance, attr, sdaiAGGR, &aggr);
+            if (aggr) {
+                TSerializer::FromSdaiAggr(lst, instance, aggr);
+            }
+        }
+    };
+
+    /// <summary>
+    /// 
+    /// </summary>
+    template <typename TList, typename TElem, IntValue sdaiType> class AggrSerializerSimple : public AggrSerializer<TList, AggrSerializerSimple<TList, TElem, sdaiType>>
+    {
+        static_assert(sdaiType == sdaiINTEGER || sdaiType == sdaiREAL || sdaiType == sdaiBOOLEAN, "simple type");
+
+    public:
+
+        //
+        static void FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr);
+
+        //
+        static SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr);
+
+        //TRange may be TList or any range of convertible elements
+        template <typename TRange> static SdaiAggr RangeToSdaiAggr(TRange& range, SdaiInstance instance, SdaiAttr attr)
+        {
+            SdaiAggr aggr = sdaiCreateAggr(instance, attr);
+            for (auto const& v : range) {
+                TElem val = v;
+                sdaiAppend(aggr, sdaiType, &val);
+            }
+            return aggr;
+        }
+    };
+
+    template <typename TList, typename TElem, IntValue sdaiType> void AggrSerializerSimple<TList, TElem, sdaiType>::FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr)
+    {
+        IntValue  cnt = sdaiGetMemberCount(aggr);
+        ReserveAggr(lst, cnt);
+        for (IntValue i = 0; i < cnt; i++) {
+            TElem val = 0;
+            sdaiGetAggrByIndex(aggr, i, sdaiType, &val);
+            lst.push_back(val);
+        }
+    }
+
+    template <typename TList, typename TElem, IntValue sdaiType> SdaiAggr AggrSerializerSimple<TList, TElem, sdaiType>::ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+    {
+        return RangeToSdaiAggr(lst, instance, attr);
+    }
+
+    /// <summary>
+    /// 
+    /// </summary>
+    template <typename TList, typename TElem, IntValue sdaiType> class AggrSerializerText : public AggrSerializer<TList, AggrSerializerText<TList, TElem, sdaiType>>
+    {
+        static_assert(sdaiType == sdaiSTRING || sdaiType == sdaiBINARY, "text type");
+
+    public:
+
+        static void FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr);
+
+        static SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr);
+
+        //TRange may be TList or any range of convertible elements
+        template <typename TRange> static SdaiAggr RangeToSdaiAggr(TRange& range, SdaiInstance instance, SdaiAttr attr)
+        {
+            SdaiAggr aggr = sdaiCreateAggr(instance, attr);
+            for (auto& val : range) {
+                TextValue v = val;
+                sdaiAppend(aggr, sdaiType, v);
+            }
+            return aggr;
+        }
+    };
+
+    template <typename TList, typename TElem, IntValue sdaiType> void AggrSerializerText<TList, TElem, sdaiType>::FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr)
+    {
+        IntValue  cnt = sdaiGetMemberCount(aggr);
+        ReserveAggr(lst, cnt);
+        for (IntValue i = 0; i < cnt; i++) {
+            TextValue val;
+            sdaiGetAggrByIndex(aggr, i, sdaiType, &val);
+            lst.push_back(val);
+        }
+    }
+
+    template <typename TList, typename TElem, IntValue sdaiType> SdaiAggr AggrSerializerText<TList, TElem, sdaiType>::ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+    {
+        return RangeToSdaiAggr(lst, instance, attr);
+    }
+
+    /// <summary>
+    /// 
+    /// </summary>
+    template <typename TList, typename TElem> class AggrSerializerInstance : public AggrSerializer<TList, AggrSerializerInstance<TList, TElem>>
+    {
+    public:
+        //
+        static void FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr);
+
+        //
+        static SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr);
+
+        //TRange may be TList or any range of convertible elements
+        template <typename TRange> static SdaiAggr RangeToSdaiAggr(TRange& range, SdaiInstance instance, SdaiAttr attr)
+        {
+            auto aggr = sdaiCreateAggr(instance, attr);
+            for (auto& val : range) {
+                SdaiInstance v = val;
+                sdaiAppend(aggr, sdaiINSTANCE, (void*) v);
+            }
+            return aggr;
+        }
+    };
+
+    template <typename TList, typename TElem> void AggrSerializerInstance<TList, TElem>::FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr)
+    {
+        auto  cnt = sdaiGetMemberCount(aggr);
+        ReserveAggr(lst, cnt);
+        for (IntValue i = 0; i < cnt; i++) {
+            SdaiInstance val = 0;
+            sdaiGetAggrByIndex(aggr, i, sdaiINSTANCE, &val);
+            TElem elem(val);
+            if (val) {
+                lst.push_back(val);
+            }
+        }
+    }
+
+    template <typename TList, typename TElem> SdaiAggr AggrSerializerInstance<TList, TElem>::ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+    {
+        return RangeToSdaiAggr(lst, instance, attr);
+    }
+
+
+    /// <summary>
+    /// 
+    /// </summary>
+    template <typename TList, typename TElem, const EnumerationHash* rEnumHash, IntValue sdaiType> class AggrSerializerEnum : public AggrSerializer<TList, AggrSerializerEnum<TList, TElem, rEnumHash, sdaiType>>
+    {
+        static_assert(sdaiType == sdaiENUM || sdaiType == sdaiLOGICAL, "enumeration type");
+
+    public:
+
+        //
+        static void FromSdaiAggr(TList& lst, SdaiInstance /*instance*/, SdaiAggr aggr);
+
+        //
+        static SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr);
+
+        //TRange may be TList or any range of convertible elements
+        template <typename TRange> static SdaiAggr RangeToSdaiAggr(TRange& range, SdaiInstance instance, SdaiAttr attr)
+        {
+            SdaiAggr aggr = sdaiCreateAggr(instance, attr);
+            for (auto const& val : range) {
+                TextValue value = rEnumHash->values[(IntValue) val];
+                sdaiAppend(aggr, sdaiType, value);
+            }
+            return aggr;
+        }
+    };
+
+    template <typename TList, typename TElem, const EnumerationHash* rEnumHash, IntValue sdaiType> void AggrSerializerEnum<TList, TElem, rEnumHash, sdaiType>::FromSdaiAggr(TList& lst, SdaiInstance /*instance*/, SdaiAggr aggr)
+    {
+        IntValue  cnt = sdaiGetMemberCount(aggr);
+        ReserveAggr(lst, cnt);
+        for (IntValue i = 0; i < cnt; i++) {
+            TextValue value = NULL;
+            sdaiGetAggrByIndex(aggr, i, sdaiType, &value);
+            int val = EnumerationNameToIndex(*rEnumHash, value);
+            if (val >= 0) {
+                lst.push_back((TElem) val);
+            }
+        }
+    }
+
+    template <typename TList, typename TElem, const EnumerationHash* rEnumHash, IntValue sdaiType> SdaiAggr AggrSerializerEnum<TList, TElem, rEnumHash, sdaiType>::ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+    {
+        return RangeToSdaiAggr(lst, instance, attr);
+    }
+
+    /// <summary>
+    /// 
+    /// </summary>
+    template <typename TList, typename TNestedAggr, typename TNestedSerializer> class AggrSerializerAggr : public AggrSerializer<TList, AggrSerializerAggr<TList, TNestedAggr, TNestedSerializer>>
+    {
+    public:
+        //
+        static void FromSdaiAggr(TList& lst, SdaiInstance instance, SdaiAggr aggr);
+
+        //
+        static SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr);
+
+        //TRange may be TList or any range of convertible elements
+        template <typename TRange> static SdaiAggr RangeToSdaiAggr(TRange& range, SdaiInstance instance, SdaiAttr attr)
+        {
+            SdaiAggr aggr = sdaiCreateAggr(instance, attr);
+            for (auto& val : range) {
+                SdaiAggr nested = TNestedSerializer::RangeToSdaiAggr(val, instance, NULL);
+                sdaiAppend(aggr, sdaiAGGR, nested);
+            }
+            return aggr;
+        }
+    };
+
+    template <typename TList, typename TNestedAggr, typename TNestedSerializer> void AggrSerializerAggr<TList, TNestedAggr, TNestedSerializer>::FromSdaiAggr(TList& lst, SdaiInstance instance, SdaiAggr aggr)
+    {
+        IntValue  cnt = sdaiGetMemberCount(aggr);
+        ReserveAggr(lst, cnt);
+        for (IntValue i = 0; i < cnt; i++) {
+            SdaiAggr nested = 0;
+            sdaiGetAggrByIndex(aggr, i, sdaiAGGR, &nested);
+            if (nested) {
+                lst.push_back(TNestedAggr());
+                TNestedSerializer::FromSdaiAggr(lst.back(), instance, nested);
+            }
+        }
+    }
+
+    template <typename TList, typename TNestedAggr, typename TNestedSerializer> SdaiAggr AggrSerializerAggr<TList, TNestedAggr, TNestedSerializer>::ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+    {
+        return RangeToSdaiAggr(lst, instance, attr);
+    }
+
+    template <typename TList, typename TElem> class AggrSerializerSelect : public AggrSerializer<TList, AggrSerializerSelect<TList, TElem>>
+    {
+    public:
+        //
+        static void FromSdaiAggr(TList& lst, SdaiInstance instance, SdaiAggr aggr);
+
+        //
+        static SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr);
+
+        //TRange may be TList or any range of convertible elements
+        template <typename TRange> static SdaiAggr RangeToSdaiAggr(TRange& range, SdaiInstance instance, SdaiAttr attr)
+        {
+            SdaiAggr aggr = sdaiCreateAggr(instance, attr);
+            for (auto& val : range) {
+                void* adb = val.ADB();
+                if (adb) {
+                    sdaiAppend(aggr, sdaiADB, adb);
+                }
+            }
+            return aggr;
+        }
+    };
+
+    template <typename TList, typename TElem> void AggrSerializerSelect<TList, TElem>::FromSdaiAggr(TList& lst, SdaiInstance instance, SdaiAggr aggr)
+    {
+        IntValue  cnt = sdaiGetMemberCount(aggr);
+        ReserveAggr(lst, cnt);
+        for (IntValue i = 0; i < cnt; i++) {
+            void* adb = 0;
+            sdaiGetAggrByIndex(aggr, i, sdaiADB, &adb);
+            if (adb) {
+                lst.push_back(TElem(instance, -1, adb));
+            }
+        }
+    }
+
+    template <typename TList, typename TElem> SdaiAggr AggrSerializerSelect<TList, TElem>::ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+    {
+        return RangeToSdaiAggr(lst, instance, attr);
+    }
+
+
+    /// <summary>
+    /// Access to attribute by ordinal, specialized for each attribute of generated entity classes, see Entity::GetAttr
+    /// </summary>
+    template <IntValue attrOrdinal> struct AttrAccessor;
+
+    template <typename TEntity, IntValue entityOrdinal_> struct AttrAccessorOf
+    {
+        typedef TEntity EntityType;
+        static constexpr IntValue entityOrdinal = entityOrdinal_;
+    };
+
+    //
+    // Specialization of AttrAccessor forwarding to get_ and put_ accessors of the attribute
+    // Define RDF_EXPRESS_NO_ATTR_ACCESSORS before including the header to skip them and save compile time when GetAttr<ordinal> and PutAttr<ordinal> are not used
+    //
+#ifdef RDF_EXPRESS_NO_ATTR_ACCESSORS
+#define RDF_EXPRESS_ATTR_ACCESSOR(attrOrdinal, entity, entityOrdinal, name)
+#else
+#define RDF_EXPRESS_ATTR_ACCESSOR(attrOrdinal, entity, entityOrdinal, name)                                                                                                     \
+    template <> struct AttrAccessor<attrOrdinal> : AttrAccessorOf<entity, entityOrdinal>                                                                                        \
+    {                                                                                                                                                                           \
+        template <typename TEntity, typename... TArgs> static auto Get(TEntity e, TArgs&&... args) -> decltype(e.get_##name(std::forward<TArgs>(args)...)) { return e.get_##name(std::forward<TArgs>(args)...); } \
+        template <typename TEntity, typename... TArgs> static auto Put(TEntity e, TArgs&&... args) -> decltype(e.put_##name(std::forward<TArgs>(args)...)) { return e.put_##name(std::forward<TArgs>(args)...); } \
+    };
+#endif
+
+    /// <summary>
+    /// Provides utility methods to interact with a generic SDAI instance
+    /// You also can use object of this class instead of SdaiInstance handle in any place where the handle is required
+    /// </summary>
+    class Entity
+    {
+    protected:
+        SdaiInstance m_instance;
+
+        Entity() : m_instance(0) {}
+
+    public:
+        Entity(SdaiInstance instance, TextValue entityName, IntValue entityOrdinal = -1)
+            : m_instance(KindOf(instance, entityName, entityOrdinal))
+        {}
+
+
+        /// <summary>
+        /// Conversion  to instance handle, so the object of the class can be used anywhere where a handle required
+        /// </summary>
+        operator SdaiInstance() const { return m_instance; }
+
+        /// <summary>
+        /// Wraps instance known to be of TEntity or its sub-entity, without kind-of check
+        /// </summary>
+        template <typename TEntity> static TEntity Unchecked(SdaiInstance instance)
+        {
+            TEntity entity;
+            static_cast<Entity&>(entity).m_instance = instance;
+            return entity;
+        }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, entity classes declare attr with their attributes and attributes of supertypes
+        /// </summary>
+        struct attr {};
+
+        /// <summary>
+        /// Access to attribute by constexpr ordinal: door.GetAttr<IfcDoor::attr::OverallHeight>() is door.get_OverallHeight(), PutAttr is put_OverallHeight
+        /// Arguments and result are the ones of the accessors, so schema-generic code can go over attributes at compile time
+        /// </summary>
+        template <IntValue attrOrdinal, typename... TArgs> auto GetAttr(TArgs&&... args) -> decltype(AttrAccessor<attrOrdinal>::Get(std::declval<typename AttrAccessor<attrOrdinal>::EntityType>(), std::forward<TArgs>(args)...))
+        {
+            typedef AttrAccessor<attrOrdinal> Accessor;
+            assert(!m_instance || EntityTypeTable::IsKindOf(m_instance, Accessor::entityOrdinal));
+            return Accessor::Get(Unchecked<typename Accessor::EntityType>(m_instance), std::forward<TArgs>(args)...);
+        }
+
+        template <IntValue attrOrdinal, typename... TArgs> auto PutAttr(TArgs&&... args) -> decltype(AttrAccessor<attrOrdinal>::Put(std::declval<typename AttrAccessor<attrOrdinal>::EntityType>(), std::forward<TArgs>(args)...))
+        {
+            typedef AttrAccessor<attrOrdinal> Accessor;
+            assert(!m_instance || EntityTypeTable::IsKindOf(m_instance, Accessor::entityOrdinal));
+            return Accessor::Put(Unchecked<typename Accessor::EntityType>(m_instance), std::forward<TArgs>(args)...);
+        }
+
+        /// <summary>
+        /// SDAI access to attribute by ordinal known at run time, attribute definition is cached by ordinal, so there is no name lookup
+        /// </summary>
+        void* GetAttr(IntValue attrOrdinal, SdaiPrimitiveType valueType, void* value) { return sdaiGetAttr(m_instance, getAttrDefinition(attrOrdinal), valueType, value); }
+        void PutAttr(IntValue attrOrdinal, SdaiPrimitiveType valueType, const void* value) { sdaiPutAttr(m_instance, getAttrDefinition(attrOrdinal), valueType, value); }
+
+    protected:
+        //
+        // Returns instance if it is of entityName (or entityOrdinal when entityName is NULL) or its sub-entity, 0 otherwise
+        static SdaiInstance KindOf(SdaiInstance instance, TextValue entityName, IntValue entityOrdinal)
+        {
+            if (instance != 0) {
+                if (entityName != NULL) {
+                    if (!sdaiIsKindOfBN(instance, entityName)) {
+                        return 0;
+                    }
+                }
+                else if (entityOrdinal >= 0) {
+                    if (!EntityTypeTable::IsKindOf(instance, entityOrdinal)) {
+                        return 0;
+                    }
+                }
+            }
+            return instance;
+        }
+
+        //
+        //
+        SdaiAttr getAttrDefinition(IntValue attrOrdinal)
+        {
+            return AttributeCache::Get(m_instance, attrOrdinal);
+        }
+
+        //
+        //
+        int getENUM(IntValue attrOrdinal, const EnumerationHash& rEnumHash)
+        {
+            TextValue value = NULL;
+            sdaiGetAttr(m_instance, getAttrDefinition(attrOrdinal), sdaiENUM, (void*) &value);
+            return EnumerationNameToIndex(rEnumHash, value);
+        }
+    };
+
+    /// <summary>
+    /// Input range of TEntity objects over entity extent of a model, iterated by sdaiCreateIterator/sdaiNext
+    /// Members of the extent are known to be of the entity, so objects are created without kind-of check
+    /// </summary>
+    template <typename TEntity> class ExtentRange
+    {
+    public:
+        class iterator
+        {
+        public:
+            typedef std::input_iterator_tag iterator_category;
+            typedef TEntity                 value_type;
+            typedef ptrdiff_t               difference_type;
+            typedef const TEntity*          pointer;
+            typedef TEntity                 reference;
+
+            iterator(SdaiIterator it = NULL) : m_iterator(it), m_current(0) { if (m_iterator) { ++(*this); } }
+
+            TEntity operator*() const { return Entity::Unchecked<TEntity>(m_current); }
+            SdaiInstance instance() const { return m_current; }
+
+            iterator& operator++()
+            {
+                m_current = 0;
+                if (sdaiNext(m_iterator)) {
+                    sdaiGetAggrByIterator(m_iterator, sdaiINSTANCE, &m_current);
+                }
+                if (!m_current) {
+                    m_iterator = NULL;
+                }
+                return *this;
+            }
+            iterator operator++(int) { iterator prev = *this; ++(*this); return prev; }
+
+            bool operator==(const iterator& other) const { return m_iterator == other.m_iterator && m_current == other.m_current; }
+            bool operator!=(const iterator& other) const { return !(*this == other); }
+
+        private:
+            SdaiIterator m_iterator;
+            SdaiInstance m_current;
+        };
+
+    public:
+        ExtentRange(SdaiModel model, IntValue entityOrdinal, bool withSubtypes)
+            : m_extent(NULL), m_iterator(NULL)
+        {
+            IntValue count = 0;
+            SdaiEntity entity = sdaiGetEntity(model, SchemaEntities(count)[entityOrdinal].name);
+            if (entity) {
+                m_extent = withSubtypes ? xxxxGetEntityAndSubTypesExtent(model, entity) : sdaiGetEntityExtent(model, entity);
+            }
+        }
+
+        ExtentRange(ExtentRange&& other) : m_extent(other.m_extent), m_iterator(other.m_iterator) { other.m_iterator = NULL; }
+        ExtentRange(const ExtentRange&) = delete;
+        ExtentRange& operator=(const ExtentRange&) = delete;
+
+        ~ExtentRange() { if (m_iterator) { sdaiDeleteIterator(m_iterator); } }
+
+        //single pass, calling begin() again restarts the iteration
+        iterator begin()
+        {
+            if (!m_extent) {
+                return iterator();
+            }
+            if (m_iterator) {
+                sdaiBeginning(m_iterator);
+            }
+            else {
+                m_iterator = sdaiCreateIterator(m_extent);
+            }
+            return iterator(m_iterator);
+        }
+        iterator end() { return iterator(); }
+
+        //number of instances, to reserve containers before iteration
+        size_t size() const { return m_extent ? (size_t) sdaiGetMemberCount(m_extent) : 0; }
+        bool empty() const { return size() == 0; }
+
+        SdaiAggr extent() const { return m_extent; }
+
+    private:
+        SdaiAggr        m_extent;
+        SdaiIterator    m_iterator;
+    };
+
+    /// <summary>
+    /// IfcGloballyUniqueId decoded from 22 characters of IFC base64 to 128 bits
+    /// </summary>
+    struct GlobalIdKey
+    {
+        uint64_t hi;
+        uint64_t lo;
+
+        bool operator==(const GlobalIdKey& other) const { return hi == other.hi && lo == other.lo; }
+        bool operator!=(const GlobalIdKey& other) const { return !(*this == other); }
+
+        /// <summary>
+        /// Returns false if the text is not 22 characters of 0-9A-Za-z_$ with the first one 0-3
+        /// </summary>
+        static bool Decode(TextValue text, GlobalIdKey& key)
+        {
+            key.hi = key.lo = 0;
+            if (!text) {
+                return false;
+            }
+            for (int i = 0; i < 22; i++) {
+                int digit = Digit(text[i]);
+                if (digit < 0 || (i == 0 && digit > 3)) {
+                    return false;
+                }
+                key.hi = (key.hi << 6) | (key.lo >> 58);
+                key.lo = (key.lo << 6) | (uint64_t) digit;
+            }
+            return text[22] == 0;
+        }
+
+    private:
+        //table lookup, characters of GlobalIds are random so comparisons would mispredict
+        static int Digit(char c)
+        {
+            struct Digits
+            {
+                signed char value[256];
+
+                Digits()
+                {
+                    static const char digits[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz_$";
+                    memset(value, -1, sizeof(value));
+                    for (int i = 0; i < 64; i++) {
+                        value[(unsigned char) digits[i]] = (signed char) i;
+                    }
+                }
+            };
+            static const Digits table;
+            return table.value[(unsigned char) c];
+        }
+    };
+
+    /// <summary>
+    /// Open addressing table of instances of a model by decoded GlobalId, base of generated GlobalIdIndex
+    /// Live tables are updated by put_GlobalId of the wrappers, lookups are not synchronized with puts from other threads
+    /// </summary>
+    class GlobalIdTable
+    {
+    public:
+        GlobalIdTable(const GlobalIdTable&) = delete;
+        GlobalIdTable& operator=(const GlobalIdTable&) = delete;
+
+        SdaiModel Model() const { return m_model; }
+
+        /// <summary>
+        /// Number of indexed instances
+        /// </summary>
+        size_t size() const { return m_count; }
+
+        /// <summary>
+        /// Instances not indexed because GlobalId is not valid or is already indexed for another instance
+        /// </summary>
+        size_t Skipped() const { return m_skipped; }
+
+        SdaiInstance FindInstance(const GlobalIdKey& key) const
+        {
+            size_t mask = m_slots.size() - 1;
+            for (size_t i = Home(key, mask); ; i = (i + 1) & mask) {
+                const Slot& slot = m_slots[i];
+                if (slot.instance == 0) {
+                    return 0;
+                }
+                if (slot.instance != TOMBSTONE && slot.key == key) {
+                    return slot.instance;
+                }
+            }
+        }
+
+        SdaiInstance FindInstance(TextValue globalId) const
+        {
+            GlobalIdKey key;
+            return GlobalIdKey::Decode(globalId, key) ? FindInstance(key) : 0;
+        }
+
+        //
+        // put_GlobalId calls OnPut before the put when any table is alive
+        static bool Active() { return GetRegistry().count.load(std::memory_order_acquire) != 0; }
+
+        static void OnPut(SdaiInstance instance, TextValue oldGlobalId, TextValue newGlobalId)
+        {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            SdaiModel model = sdaiGetInstanceModel(instance);
+            for (auto table : registry.tables) {
+                if (table->m_model == model) {
+                    table->Remove(oldGlobalId, instance);
+                    table->Insert(newGlobalId, instance);
+                }
+            }
+        }
+
+    protected:
+        explicit GlobalIdTable(SdaiModel model) : m_model(model), m_count(0), m_used(0), m_skipped(0), m_slots(16)
+        {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.tables.push_back(this);
+            registry.count++;
+        }
+
+        ~GlobalIdTable()
+        {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (auto it = registry.tables.begin(); it != registry.tables.end(); it++) {
+                if (*it == this) {
+                    registry.tables.erase(it);
+                    registry.count--;
+                    break;
+                }
+            }
+        }
+
+        //
+        // Reads GlobalIds of instances on the calling thread, the engine is not called from other threads,
+        // then threads decode their parts of the copied texts and the keys are inserted
+        template <typename TGetGlobalId> void Build(const std::vector<SdaiInstance>& instances, TGetGlobalId getGlobalId, unsigned threads)
+        {
+            const size_t TEXT = 23; //22 characters and terminating zero, other texts are copied as empty
+
+            size_t count = instances.size();
+            std::vector<char> texts(count * TEXT);
+            std::vector<GlobalIdKey> keys(count);
+            std::vector<char> valid(count);
+
+            for (size_t i = 0; i < count; i++) {
+                TextValue globalId = getGlobalId(instances[i]);
+                if (globalId && strnlen(globalId, TEXT) < TEXT) {
+                    memcpy(&texts[i * TEXT], globalId, strlen(globalId));
+                }
+            }
+
+            auto decode = [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    valid[i] = GlobalIdKey::Decode(&texts[i * TEXT], keys[i]);
+                }
+            };
+
+            if (threads == 0) {
+                threads = std::thread::hardware_concurrency();
+            }
+            if (threads > 1 && count >= 4096) {
+                std::vector<std::thread> workers;
+                size_t part = (count + threads - 1) / threads;
+                for (size_t begin = part; begin < count; begin += part) {
+                    workers.emplace_back(decode, begin, (begin + part < count) ? begin + part : count);
+                }
+                decode(0, part);
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+            }
+            else {
+                decode(0, count);
+            }
+
+            Rehash(count);
+            for (size_t i = 0; i < count; i++) {
+                if (!valid[i] || !Insert(keys[i], instances[i])) {
+                    m_skipped++;
+                }
+            }
+        }
+
+    private:
+        struct Slot
+        {
+            GlobalIdKey     key;
+            SdaiInstance    instance;   //0 for empty slot
+        };
+
+        struct Registry
+        {
+            std::mutex                      mutex;
+            std::vector<GlobalIdTable*>     tables;
+            std::atomic<int>                count;
+
+            Registry() : count(0) {}
+        };
+
+        static Registry& GetRegistry() { static Registry registry; return registry; }
+
+        static const SdaiInstance TOMBSTONE = -1;
+
+        static size_t Home(const GlobalIdKey& key, size_t mask)
+        {
+            uint64_t h = (key.lo ^ key.hi) * 0x9E3779B97F4A7C15ull;
+            return (size_t) (h ^ (h >> 32)) & mask;
+        }
+
+        bool Insert(const GlobalIdKey& key, SdaiInstance instance)
+        {
+            if ((m_used + 1) * 2 > m_slots.size()) {
+                Rehash(m_count + 1);
+            }
+            size_t mask = m_slots.size() - 1;
+            for (size_t i = Home(key, mask); ; i = (i + 1) & mask) {
+                Slot& slot = m_slots[i];
+                if (slot.instance == 0) {
+                    slot.key = key;
+                    slot.instance = instance;
+                    m_count++;
+                    m_used++;
+                    return true;
+                }
+                if (slot.instance != TOMBSTONE && slot.key == key) {
+                    return slot.instance == instance;
+                }
+            }
+        }
+
+        void Insert(TextValue globalId, SdaiInstance instance)
+        {
+            GlobalIdKey key;
+            if (!GlobalIdKey::Decode(globalId, key) || !Insert(key, instance)) {
+                m_skipped++;
+            }
+        }
+
+        void Remove(TextValue globalId, SdaiInstance instance)
+        {
+            GlobalIdKey key;
+            if (!GlobalIdKey::Decode(globalId, key)) {
+                return;
+            }
+            size_t mask = m_slots.size() - 1;
+            for (size_t i = Home(key, mask); m_slots[i].instance != 0; i = (i + 1) & mask) {
+                Slot& slot = m_slots[i];
+                if (slot.instance == instance && slot.key == key) {
+                    slot.instance = TOMBSTONE;
+                    m_count--;
+                    return;
+                }
+            }
+        }
+
+        //
+        // Size for count instances at most half full, drops tombstones
+        void Rehash(size_t count)
+        {
+            size_t size = 16;
+            while (size < count * 2) {
+                size *= 2;
+            }
+            std::vector<Slot> slots(size);
+            slots.swap(m_slots);
+            m_used = 0;
+            m_count = 0;
+            for (auto const& slot : slots) {
+                if (slot.instance != 0 && slot.instance != TOMBSTONE) {
+                    Insert(slot.key, slot.instance);
+                }
+            }
+        }
+
+    private:
+        SdaiModel           m_model;
+        size_t              m_count;
+        size_t              m_used;     //with tombstones
+        size_t              m_skipped;
+        std::vector<Slot>   m_slots;
+    };
+
+    /// <summary>
+    /// Index of TRoot instances of a model by GlobalId with O(1) Find, stays consistent with put_GlobalId of the wrappers
+    /// Construction reads GlobalIds on the calling thread and decodes them in threads (hardware concurrency by default)
+    /// </summary>
+    template <typename TRoot> class GlobalIdIndexOf : public GlobalIdTable
+    {
+    public:
+        explicit GlobalIdIndexOf(SdaiModel model, unsigned threads = 0) : GlobalIdTable(model)
+        {
+            std::vector<SdaiInstance> instances;
+            auto extent = TRoot::ExtentWithSubtypes(model);
+            instances.reserve(extent.size());
+            for (auto it = extent.begin(); it != extent.end(); ++it) {
+                instances.push_back(it.instance());
+            }
+            Build(instances, [](SdaiInstance instance) { return Entity::Unchecked<TRoot>(instance).get_GlobalId(); }, threads);
+        }
+
+        TRoot Find(TextValue globalId) const { return Entity::Unchecked<TRoot>(FindInstance(globalId)); }
+        TRoot Find(const GlobalIdKey& key) const { return Entity::Unchecked<TRoot>(FindInstance(key)); }
+    };
+
+    /// <summary>
+    /// Objectified relationship: entity, attribute of relating instance and attribute of related instance or aggregation of instances
+    /// </summary>
+    struct RelationshipAttributes
+    {
+        const char* entityName;
+        const char* relatingAttrName;
+        const char* relatedAttrName;
+    };
+
+    /// <summary>
+    /// Appends relating-related pairs of relationships in the extent of the relationship entity
+    /// skip(relationship) is called for each relationship of the extent, relationships it returns true for are not read;
+    /// relationshipOf, if not NULL, gets the relationship of each appended pair
+    /// </summary>
+    template <typename TSkip> void ReadRelationshipPairs(SdaiModel model, const RelationshipAttributes& attributes, std::vector<SdaiInstance>& relating, std::vector<SdaiInstance>& related, std::vector<SdaiInstance>* relationshipOf, TSkip&& skip)
+    {
+        SdaiEntity entity = sdaiGetEntity(model, attributes.entityName);
+        SdaiAttr relatingAttr = entity ? sdaiGetAttrDefinition(entity, attributes.relatingAttrName) : NULL;
+        SdaiAttr relatedAttr = entity ? sdaiGetAttrDefinition(entity, attributes.relatedAttrName) : NULL;
+        if (!relatingAttr || !relatedAttr) {
+            return;
+        }
+
+        SdaiAggr extent = xxxxGetEntityAndSubTypesExtent(model, entity);
+        IntValue count = extent ? sdaiGetMemberCount(extent) : 0;
+        for (IntValue i = 0; i < count; i++) {
+            SdaiInstance relationship = 0;
+            sdaiGetAggrByIndex(extent, i, sdaiINSTANCE, &relationship);
+            if (!relationship || skip(relationship)) {
+                continue;
+            }
+
+            SdaiInstance relatingInstance = 0;
+            if (!sdaiGetAttr(relationship, relatingAttr, sdaiINSTANCE, &relatingInstance) || !relatingInstance) {
+                continue;
+            }
+
+            SdaiAggr aggr = NULL;
+            if (sdaiGetAttr(relationship, relatedAttr, sdaiAGGR, &aggr) && aggr) {
+                IntValue members = sdaiGetMemberCount(aggr);
+                for (IntValue j = 0; j < members; j++) {
+                    SdaiInstance relatedInstance = 0;
+                    if (sdaiGetAggrByIndex(aggr, j, sdaiINSTANCE, &relatedInstance) && relatedInstance) {
+                        relating.push_back(relatingInstance);
+                        related.push_back(relatedInstance);
+                    }
+                }
+            }
+            else {
+                SdaiInstance relatedInstance = 0;
+                if (sdaiGetAttr(relationship, relatedAttr, sdaiINSTANCE, &relatedInstance) && relatedInstance) {
+                    relating.push_back(relatingInstance);
+                    related.push_back(relatedInstance);
+                }
+            }
+
+            if (relationshipOf) {
+                relationshipOf->resize(related.size(), relationship);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Appends relating-related pairs of all relationships in the extent of the relationship entity
+    /// </summary>
+    inline void ReadRelationshipPairs(SdaiModel model, const RelationshipAttributes& attributes, std::vector<SdaiInstance>& relating, std::vector<SdaiInstance>& related)
+    {
+        ReadRelationshipPairs(model, attributes, relating, related, NULL, [](SdaiInstance) { return false; });
+    }
+
+    /// <summary>
+    /// Compressed rows of pairs: columns of row of instance are contiguous in order of pairs, the row is found by one hash lookup
+    /// </summary>
+    template <typename TColumn> class InstanceRows
+    {
+    public:
+        typedef ArrayRange<const TColumn> Row;
+
+        //row from[i] gets column to[i]
+        void Build(const std::vector<SdaiInstance>& from, const std::vector<TColumn>& to)
+        {
+            std::vector<uint32_t> rowOf(from.size());
+            m_rows.clear();
+            m_rows.reserve(from.size());
+            m_offsets.assign(1, 0);
+            for (size_t i = 0; i < from.size(); i++) {
+                auto row = m_rows.emplace(from[i], (uint32_t) m_offsets.size() - 1);
+                if (row.second) {
+                    m_offsets.push_back(0);
+                }
+                rowOf[i] = row.first->second;
+                m_offsets[rowOf[i] + 1]++;
+            }
+            for (size_t r = 1; r < m_offsets.size(); r++) {
+                m_offsets[r] += m_offsets[r - 1];
+            }
+
+            std::vector<uint32_t> next(m_offsets.begin(), m_offsets.end() - 1);
+            m_columns.resize(to.size());
+            for (size_t i = 0; i < to.size(); i++) {
+                m_columns[next[rowOf[i]]++] = to[i];
+            }
+        }
+
+        Row Get(SdaiInstance instance) const
+        {
+            auto row = m_rows.find(instance);
+            if (row == m_rows.end()) {
+                return Row{ NULL, 0 };
+            }
+            uint32_t begin = m_offsets[row->second];
+            return Row{ m_columns.data() + begin, m_offsets[row->second + 1] - begin };
+        }
+
+        //number of pairs
+        size_t size() const { return m_columns.size(); }
+
+    private:
+        std::unordered_map<SdaiInstance, uint32_t>  m_rows;
+        std::vector<uint32_t>                       m_offsets;  //columns of row r are m_columns[m_offsets[r]]...m_columns[m_offsets[r + 1] - 1]
+        std::vector<TColumn>                        m_columns;
+    };
+
+    /// <summary>
+    /// Relating and related instances of objectified relationships of a model, read by one pass over extent of each relationship
+    /// Pairs are kept as compressed rows in both directions, instances related to an instance are contiguous range found by one hash lookup
+    /// The table is a snapshot of the model, build it again after relationships are added or changed
+    /// </summary>
+    class RelationshipTable
+    {
+    public:
+        typedef ArrayRange<const SdaiInstance> Instances;
+
+        RelationshipTable(SdaiModel model, const RelationshipAttributes* relationships, int count) : m_model(model), m_relations(count)
+        {
+            for (int i = 0; i < count; i++) {
+                std::vector<SdaiInstance> relating;
+                std::vector<SdaiInstance> related;
+                ReadRelationshipPairs(model, relationships[i], relating, related);
+                m_relations[i].related.Build(relating, related);
+                m_relations[i].relating.Build(related, relating);
+            }
+        }
+
+        SdaiModel Model() const { return m_model; }
+
+        //related instances of relationships where the instance is relating one
+        Instances Related(int relationship, SdaiInstance relating) const { return m_relations[relationship].related.Get(relating); }
+
+        //relating instances of relationships where the instance is related one
+        Instances Relating(int relationship, SdaiInstance related) const { return m_relations[relationship].relating.Get(related); }
+
+        //number of relating-related pairs of the relationship
+        size_t Pairs(int relationship) const { return m_relations[relationship].related.size(); }
+
+    private:
+        struct Relation
+        {
+            InstanceRows<SdaiInstance>  related;    //rows of relating instances
+            InstanceRows<SdaiInstance>  relating;   //rows of related instances
+        };
+
+    private:
+        SdaiModel               m_model;
+        std::vector<Relation>   m_relations;
+    };
+
+    /// <summary>
+    /// Tree of spatial structure in flat array: roots are instances of root entity, children are related by aggregation relationship,
+    /// elements are related to their nodes by containment relationship
+    /// Nodes are in depth-first order, so nodes and elements of a subtree are contiguous; elements of a node are grouped by entity
+    /// Update reads relationships added since construction or previous Update and drops pairs of deleted relationships, it tells
+    /// relationships by instance handle; changes of attributes of relationships read before need new tree
+    /// Update walks the relationship extents and lays the whole tree out again, it only saves reading relationships read before
+    /// </summary>
+    class SpatialTreeTable
+    {
+    public:
+        typedef ArrayRange<const SdaiInstance> Instances;
+
+        struct Node
+        {
+            SdaiInstance    instance;
+            int             parent;             //-1 for root
+            int             firstChild;         //-1 for leaf
+            int             nextSibling;        //-1 for last child
+            int             subtreeEnd;         //nodes of subtree are [this node, subtreeEnd)
+            uint32_t        elementsBegin;      //elements of the node are [elementsBegin, elementsEnd)
+            uint32_t        elementsEnd;
+            uint32_t        subtreeElementsEnd; //elements of subtree are [elementsBegin, subtreeElementsEnd)
+        };
+
+        SdaiModel Model() const { return m_model; }
+
+        size_t size() const { return m_nodes.size(); }
+        const Node& operator[](int node) const { return m_nodes[node]; }
+        const std::vector<Node>& Nodes() const { return m_nodes; }
+
+        //node of the instance, -1 if the instance is not in the tree
+        int Find(SdaiInstance instance) const
+        {
+            auto it = m_nodeOf.find(instance);
+            return (it != m_nodeOf.end()) ? it->second : -1;
+        }
+
+        //node containing the element, -1 if the element is not contained in the tree
+        int Container(SdaiInstance element) const
+        {
+            auto it = m_containerOf.find(element);
+            return (it != m_containerOf.end()) ? it->second : -1;
+        }
+
+        //elements contained in the node
+        Instances Elements(int node) const { return Range(m_nodes[node].elementsBegin, m_nodes[node].elementsEnd); }
+
+        //elements of the node with exact entity, e.g. sdaiGetEntity(model, "IfcWall")
+        Instances Elements(int node, SdaiEntity entity) const
+        {
+            auto begin = m_elementTypes.begin() + m_nodes[node].elementsBegin;
+            auto end = m_elementTypes.begin() + m_nodes[node].elementsEnd;
+            auto range = std::equal_range(begin, end, entity);
+            return Range((uint32_t) (range.first - m_elementTypes.begin()), (uint32_t) (range.second - m_elementTypes.begin()));
+        }
+
+        //elements contained in the node and its descendants
+        Instances SubtreeElements(int node) const { return Range(m_nodes[node].elementsBegin, m_nodes[node].subtreeElementsEnd); }
+
+        void Update()
+        {
+            Read(m_aggregation, m_aggregations, false);
+            Read(m_containment, m_containments, true);
+            Layout();
+        }
+
+    protected:
+        SpatialTreeTable(SdaiModel model, TextValue rootEntityName, const RelationshipAttributes& aggregation, const RelationshipAttributes& containment)
+            : m_model(model), m_rootEntityName(rootEntityName), m_aggregation(aggregation), m_containment(containment)
+        {
+            Update();
+        }
+
+    private:
+        //pairs of relationships read so far, positions of relationships in the extent change when instances are deleted
+        struct Relationships
+        {
+            std::unordered_set<SdaiInstance>    read;
+            std::vector<SdaiInstance>           relationship;   //of each pair
+            std::vector<SdaiInstance>           relating;
+            std::vector<SdaiInstance>           related;
+            std::vector<SdaiEntity>             relatedTypes;   //exact entities of related instances, if read
+        };
+
+    private:
+        Instances Range(uint32_t begin, uint32_t end) const { return Instances{ m_treeElements.data() + begin, end - begin }; }
+
+        //reads relationships not read before and drops pairs of relationships that are no longer in the extent
+        void Read(const RelationshipAttributes& attributes, Relationships& pairs, bool relatedTypes)
+        {
+            std::unordered_set<SdaiInstance> present;
+            size_t kept = 0;
+            size_t first = pairs.related.size();
+            ReadRelationshipPairs(m_model, attributes, pairs.relating, pairs.related, &pairs.relationship, [&](SdaiInstance relationship) {
+                present.insert(relationship);
+                bool read = pairs.read.count(relationship) != 0;
+                kept += read;
+                return read;
+            });
+            if (relatedTypes) {
+                for (size_t i = first; i < pairs.related.size(); i++) {
+                    pairs.relatedTypes.push_back(sdaiGetInstanceType(pairs.related[i]));
+                }
+            }
+
+            if (kept < pairs.read.size()) {
+                size_t count = 0;
+                for (size_t i = 0; i < pairs.related.size(); i++) {
+                    if (present.count(pairs.relationship[i])) {
+                        pairs.relationship[count] = pairs.relationship[i];
+                        pairs.relating[count] = pairs.relating[i];
+                        pairs.related[count] = pairs.related[i];
+                        if (relatedTypes) {
+                            pairs.relatedTypes[count] = pairs.relatedTypes[i];
+                        }
+                        count++;
+                    }
+                }
+                pairs.relationship.resize(count);
+                pairs.relating.resize(count);
+                pairs.related.resize(count);
+                if (relatedTypes) {
+                    pairs.relatedTypes.resize(count);
+                }
+            }
+
+            pairs.read.swap(present);
+        }
+
+        void Layout()
+        {
+            m_nodes.clear();
+            m_nodeOf.clear();
+            m_containerOf.clear();
+            m_treeElements.clear();
+            m_elementTypes.clear();
+
+            InstanceRows<SdaiInstance> children;
+            children.Build(m_aggregations.relating, m_aggregations.related);
+
+            std::vector<uint32_t> pairs(m_containments.related.size());
+            for (size_t i = 0; i < pairs.size(); i++) {
+                pairs[i] = (uint32_t) i;
+            }
+            InstanceRows<uint32_t> contained;
+            contained.Build(m_containments.relating, pairs);
+
+            SdaiEntity rootEntity = sdaiGetEntity(m_model, m_rootEntityName);
+            SdaiAggr roots = rootEntity ? xxxxGetEntityAndSubTypesExtent(m_model, rootEntity) : NULL;
+            IntValue count = roots ? sdaiGetMemberCount(roots) : 0;
+            for (IntValue i = 0; i < count; i++) {
+                SdaiInstance root = 0;
+                sdaiGetAggrByIndex(roots, i, sdaiINSTANCE, &root);
+                AddNode(root, -1, children, contained);
+            }
+        }
+
+        int AddNode(SdaiInstance instance, int parent, const InstanceRows<SdaiInstance>& children, const InstanceRows<uint32_t>& contained)
+        {
+            int index = (int) m_nodes.size();
+            if (!m_nodeOf.emplace(instance, index).second) {
+                return -1; //cycle or second parent
+            }
+
+            Node node = { instance, parent, -1, -1, 0, (uint32_t) m_treeElements.size(), 0, 0 };
+            m_nodes.push_back(node);
+
+            auto own = contained.Get(instance);
+            std::vector<uint32_t> order(own.begin(), own.end());
+            const auto& elements = m_containments.related;
+            const auto& types = m_containments.relatedTypes;
+            std::stable_sort(order.begin(), order.end(), [&types](uint32_t a, uint32_t b) { return types[a] < types[b]; });
+            for (auto i : order) {
+                if (m_containerOf.emplace(elements[i], index).second) {
+                    m_treeElements.push_back(elements[i]);
+                    m_elementTypes.push_back(types[i]);
+                }
+            }
+            m_nodes[index].elementsEnd = (uint32_t) m_treeElements.size();
+
+            int last = -1;
+            for (SdaiInstance child : children.Get(instance)) {
+                int childIndex = AddNode(child, index, children, contained);
+                if (childIndex >= 0) {
+                    if (last < 0) {
+                        m_nodes[index].firstChild = childIndex;
+                    }
+                    else {
+                        m_nodes[last].nextSibling = childIndex;
+                    }
+                    last = childIndex;
+                }
+            }
+
+            m_nodes[index].subtreeEnd = (int) m_nodes.size();
+            m_nodes[index].subtreeElementsEnd = (uint32_t) m_treeElements.size();
+            return index;
+        }
+
+    private:
+        SdaiModel                               m_model;
+        TextValue                               m_rootEntityName;
+        RelationshipAttributes                  m_aggregation;
+        RelationshipAttributes                  m_containment;
+
+        //parents and children, containers and elements
+        Relationships                           m_aggregations;
+        Relationships                           m_containments;
+
+        //layout
+        std::vector<Node>                       m_nodes;
+        std::vector<SdaiInstance>               m_treeElements;
+        std::vector<SdaiEntity>                 m_elementTypes;
+        std::unordered_map<SdaiInstance, int>   m_nodeOf;
+        std::unordered_map<SdaiInstance, int>   m_containerOf;
+    };
+
+#ifdef __cpp_lib_string_view
+    /// <summary>
+    /// Value of single-value property, kind tells the member that is set
+    /// </summary>
+    struct PropertyValue
+    {
+        enum Kind : uint8_t { None, Integer, Real, Boolean, Logical, Text };
+
+        Kind            kind;
+        union
+        {
+            int64_t     integer;    //Integer, Boolean 0 or 1, Logical 0, 1 or 2 for unknown
+            double      real;       //Real
+            TextValue   text;       //Text, NUL terminated and interned in the table
+        };
+
+        std::string_view AsText() const { return (kind == Text) ? std::string_view(text) : std::string_view(); }
+    };
+
+    /// <summary>
+    /// Entities and attributes read by PropertyValueTable: relationship of property sets to objects, property set and single-value property
+    /// </summary>
+    struct PropertyAttributes
+    {
+        RelationshipAttributes  definesByProperties;    //relating property set, related objects
+        const char*             propertySetEntityName;
+        const char*             propertySetNameAttrName;
+        const char*             propertiesAttrName;
+        const char*             singleValueEntityName;
+        const char*             propertyNameAttrName;
+        const char*             valueAttrName;
+        const char*             unitAttrName;
+    };
+
+    /// <summary>
+    /// Single-value properties of all objects of a model in columns: row i is property PropertyNames()[i] of property set PropertySetNames()[i]
+    /// of object Objects()[i], with value Values()[i] of type ValueTypes()[i] and unit Units()[i]
+    /// Names and texts are interned, name columns keep ids of Name(id); (object, property set, property) is found by one hash lookup
+    /// Property sets are read on the calling thread by default; threads > 1 (or 0 for hardware concurrency) read parts of them
+    /// in threads, which calls engine get-functions concurrently and needs an engine whose reads of one model are thread-safe
+    /// The table is a snapshot of the model, build it again after properties change
+    /// </summary>
+    class PropertyValueTable
+    {
+    public:
+        static const uint32_t NO_NAME = (uint32_t) -1;
+
+        PropertyValueTable(const PropertyValueTable&) = delete;
+        PropertyValueTable& operator=(const PropertyValueTable&) = delete;
+
+        SdaiModel Model() const { return m_model; }
+
+        size_t size() const { return m_objects.size(); }
+
+        const std::vector<SdaiInstance>& Objects() const { return m_objects; }
+        const std::vector<uint32_t>& PropertySetNames() const { return m_propertySetNames; }
+        const std::vector<uint32_t>& PropertyNames() const { return m_propertyNames; }
+        const std::vector<PropertyValue>& Values() const { return m_values; }
+        const std::vector<uint32_t>& ValueTypes() const { return m_valueTypes; }
+        const std::vector<SdaiInstance>& Units() const { return m_units; }
+
+        std::string_view Name(uint32_t id) const { return (id < m_names.size()) ? m_names[id] : std::string_view(); }
+
+        //id of the name, NO_NAME if the table has no such name
+        uint32_t NameId(std::string_view name) const
+        {
+            auto it = m_nameIds.find(name);
+            return (it != m_nameIds.end()) ? it->second : NO_NAME;
+        }
+
+        //row of the property, -1 if the object has no such property
+        ptrdiff_t Find(SdaiInstance object, uint32_t propertySetName, uint32_t propertyName) const
+        {
+            auto it = m_rows.find(Key{ object, propertySetName, propertyName });
+            return (it != m_rows.end()) ? (ptrdiff_t) it->second : -1;
+        }
+
+        ptrdiff_t Find(SdaiInstance object, std::string_view propertySetName, std::string_view propertyName) const
+        {
+            return Find(object, NameId(propertySetName), NameId(propertyName));
+        }
+
+        //value of the property, NULL if the object has no such property
+        const PropertyValue* Value(SdaiInstance object, std::string_view propertySetName, std::string_view propertyName) const
+        {
+            ptrdiff_t row = Find(object, propertySetName, propertyName);
+            return (row >= 0) ? &m_values[row] : NULL;
+        }
+
+    protected:
+        PropertyValueTable(SdaiModel model, const PropertyAttributes& attributes, unsigned threads) : m_model(model)
+        {
+            std::vector<SdaiInstance> definitions;
+            std::vector<SdaiInstance> objects;
+            ReadRelationshipPairs(model, attributes.definesByProperties, definitions, objects);
+
+            InstanceRows<SdaiInstance> objectsOf;
+            objectsOf.Build(definitions, objects);
+
+            std::vector<SdaiInstance> propertySets;
+            std::unordered_map<SdaiInstance, bool> seen;
+            for (auto definition : definitions) {
+                if (seen.emplace(definition, true).second) {
+                    propertySets.push_back(definition);
+                }
+            }
+
+            Reader reader(model, attributes);
+            if (!reader.valid) {
+                return;
+            }
+
+            if (threads == 0) {
+                threads = std::thread::hardware_concurrency();
+            }
+            size_t count = propertySets.size();
+            size_t parts = (threads > 1 && count >= 1024) ? threads : 1;
+            size_t part = (count + parts - 1) / parts;
+
+            std::vector<std::vector<Property>> properties(parts);
+            std::vector<TextValue> propertySetNames(count);
+            std::unique_ptr<TextArena[]> texts(new TextArena[parts]); //texts of ADB values copied by each thread until merged to m_texts
+            auto read = [&](size_t index) {
+                size_t end = (index + 1) * part < count ? (index + 1) * part : count;
+                reader.Read(propertySets, index * part, end, propertySetNames, properties[index], texts[index]);
+            };
+
+            std::vector<std::thread> workers;
+            for (size_t i = 1; i < parts; i++) {
+                workers.emplace_back(read, i);
+            }
+            read(0);
+            for (auto& worker : workers) {
+                worker.join();
+            }
+
+            for (auto const& list : properties) {
+                for (auto const& property : list) {
+                    uint32_t propertySetName = Intern(propertySetNames[property.propertySet]);
+                    uint32_t propertyName = Intern(property.name);
+                    uint32_t valueType = Intern(property.valueType);
+                    PropertyValue value = property.value;
+                    if (value.kind == PropertyValue::Text) {
+                        value.text = m_texts.Intern(value.text).data();
+                    }
+                    for (SdaiInstance object : objectsOf.Get(propertySets[property.propertySet])) {
+                        if (m_rows.emplace(Key{ object, propertySetName, propertyName }, m_objects.size()).second) {
+                            m_objects.push_back(object);
+                            m_propertySetNames.push_back(propertySetName);
+                            m_propertyNames.push_back(propertyName);
+                            m_values.push_back(value);
+                            m_valueTypes.push_back(valueType);
+                            m_units.push_back(property.unit);
+                        }
+                    }
+                }
+            }
+        }
+
+    private:
+        struct Key
+        {
+            SdaiInstance    object;
+            uint32_t        propertySet;
+            uint32_t        property;
+
+            bool operator==(const Key& other) const { return object == other.object && propertySet == other.propertySet && property == other.property; }
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key& key) const
+            {
+                uint64_t h = (uint64_t) key.object * 0x9E3779B97F4A7C15ull;
+                h ^= (((uint64_t) key.propertySet << 32) | key.property) * 0xC2B2AE3D27D4EB4Full;
+                return (size_t) (h ^ (h >> 29));
+            }
+        };
+
+        //single-value property read from the engine, names are owned by the engine, value type and text by the arena of the reading thread
+        struct Property
+        {
+            size_t          propertySet;    //index in property sets
+            TextValue       name;
+            PropertyValue   value;
+            TextValue       valueType;
+            SdaiInstance    unit;
+        };
+
+        //
+        // Reads properties of property sets, one ADB per thread
+        // Type path and text of ADB value are valid until the ADB is reused, they are copied to the arena of the thread
+        struct Reader
+        {
+            SdaiEntity  propertySetEntity;
+            SdaiAttr    propertySetNameAttr;
+            SdaiAttr    propertiesAttr;
+            SdaiEntity  singleValueEntity;
+            SdaiAttr    propertyNameAttr;
+            SdaiAttr    valueAttr;
+            SdaiAttr    unitAttr;
+            bool        valid;
+
+            Reader(SdaiModel model, const PropertyAttributes& attributes)
+            {
+                propertySetEntity = sdaiGetEntity(model, attributes.propertySetEntityName);
+                singleValueEntity = sdaiGetEntity(model, attributes.singleValueEntityName);
+                propertySetNameAttr = propertySetEntity ? sdaiGetAttrDefinition(propertySetEntity, attributes.propertySetNameAttrName) : NULL;
+                propertiesAttr = propertySetEntity ? sdaiGetAttrDefinition(propertySetEntity, attributes.propertiesAttrName) : NULL;
+                propertyNameAttr = singleValueEntity ? sdaiGetAttrDefinition(singleValueEntity, attributes.propertyNameAttrName) : NULL;
+                valueAttr = singleValueEntity ? sdaiGetAttrDefinition(singleValueEntity, attributes.valueAttrName) : NULL;
+                unitAttr = singleValueEntity ? sdaiGetAttrDefinition(singleValueEntity, attributes.unitAttrName) : NULL;
+                valid = propertySetNameAttr && propertiesAttr && propertyNameAttr && valueAttr && unitAttr;
+            }
+
+            void Read(const std::vector<SdaiInstance>& propertySets, size_t begin, size_t end, std::vector<TextValue>& propertySetNames, std::vector<Property>& properties, TextArena& texts) const
+            {
+                SdaiADB adb = sdaiCreateEmptyADB();
+
+                for (size_t i = begin; i < end; i++) {
+                    SdaiInstance propertySet = propertySets[i];
+                    if (sdaiGetInstanceType(propertySet) != propertySetEntity) {
+                        continue; //quantities and other property definitions
+                    }
+                    sdaiGetAttr(propertySet, propertySetNameAttr, sdaiSTRING, &propertySetNames[i]);
+
+                    SdaiAggr aggr = NULL;
+                    sdaiGetAttr(propertySet, propertiesAttr, sdaiAGGR, &aggr);
+                    IntValue count = aggr ? sdaiGetMemberCount(aggr) : 0;
+                    for (IntValue j = 0; j < count; j++) {
+                        SdaiInstance instance = 0;
+                        sdaiGetAggrByIndex(aggr, j, sdaiINSTANCE, &instance);
+                        if (!instance || sdaiGetInstanceType(instance) != singleValueEntity) {
+                            continue;
+                        }
+
+                        Property property = {};
+                        property.propertySet = i;
+                        sdaiGetAttr(instance, propertyNameAttr, sdaiSTRING, &property.name);
+                        sdaiGetAttr(instance, unitAttr, sdaiINSTANCE, &property.unit);
+                        if (sdaiGetAttr(instance, valueAttr, sdaiADB, adb)) {
+                            TextValue valueType = sdaiGetADBTypePath(adb, 0);
+                            property.valueType = valueType ? texts.Intern(valueType).data() : NULL;
+                            ReadValue(adb, property.value, texts);
+                        }
+                        properties.push_back(property);
+                    }
+                }
+
+                sdaiDeleteADB(adb);
+            }
+
+            //enumeration values of IfcValue are booleans and logicals
+            static void ReadValue(SdaiADB adb, PropertyValue& value, TextArena& texts)
+            {
+                value.kind = PropertyValue::None;
+                value.integer = 0;
+
+                switch (sdaiGetADBType(adb)) {
+                    case sdaiINTEGER:
+                    {
+                        int_t integer = 0;
+                        if (sdaiGetADBValue(adb, sdaiINTEGER, &integer)) {
+                            value.kind = PropertyValue::Integer;
+                            value.integer = integer;
+                        }
+                        break;
+                    }
+                    case sdaiREAL:
+                    case sdaiNUMBER:
+                        if (sdaiGetADBValue(adb, sdaiREAL, &value.real)) {
+                            value.kind = PropertyValue::Real;
+                        }
+                        break;
+                    case sdaiBOOLEAN:
+                    {
+                        SdaiBoolean boolean = sdaiFALSE;
+                        if (sdaiGetADBValue(adb, sdaiBOOLEAN, &boolean)) {
+                            value.kind = PropertyValue::Boolean;
+                            value.integer = (boolean == sdaiTRUE) ? 1 : 0;
+                        }
+                        break;
+                    }
+                    case sdaiLOGICAL:
+                    case sdaiENUM:
+                    {
+                        TextValue text = NULL;
+                        if (sdaiGetADBValue(adb, sdaiENUM, &text) && text) {
+                            if (!strcmp(text, "T") || !strcmp(text, "F")) {
+                                value.kind = PropertyValue::Boolean;
+                                value.integer = (text[0] == 'T') ? 1 : 0;
+                            }
+                            else if (!strcmp(text, "U")) {
+                                value.kind = PropertyValue::Logical;
+                                value.integer = 2;
+                            }
+                            else {
+                                value.kind = PropertyValue::Text;
+                                value.text = texts.Intern(text).data();
+                            }
+                        }
+                        break;
+                    }
+                    default:
+                    {
+                        TextValue text = NULL;
+                        if (sdaiGetADBValue(adb, sdaiSTRING, &text) && text) {
+                            value.kind = PropertyValue::Text;
+                            value.text = texts.Intern(text).data();
+                        }
+                        break;
+                    }
+                }
+            }
+        };
+
+        uint32_t Intern(TextValue text)
+        {
+            if (!text) {
+                return NO_NAME;
+            }
+            std::string_view name = m_texts.Intern(text);
+            auto it = m_nameIds.emplace(name, (uint32_t) m_names.size());
+            if (it.second) {
+                m_names.push_back(name);
+            }
+            return it.first->second;
+        }
+
+    private:
+        SdaiModel                                           m_model;
+
+        //columns
+        std::vector<SdaiInstance>                           m_objects;
+        std::vector<uint32_t>                               m_propertySetNames;
+        std::vector<uint32_t>                               m_propertyNames;
+        std::vector<PropertyValue>                          m_values;
+        std::vector<uint32_t>                               m_valueTypes;
+        std::vector<SdaiInstance>                           m_units;
+
+        TextArena                                           m_texts;
+        std::vector<std::string_view>                       m_names;
+        std::unordered_map<std::string_view, uint32_t>      m_nameIds;
+        std::unordered_map<Key, uint32_t, KeyHash>          m_rows;
+    };
+#endif
+
+    /// <summary>
+    /// Affine transform as 4x4 matrix in order of getInstanceTransformationMatrix _11, _12 ... _44:
+    /// rows are x axis, y axis, z axis and origin, point is transformed as row vector p * M
+    /// </summary>
+    struct TransformMatrix
+    {
+        double  m[16];
+
+        static TransformMatrix Identity() { return TransformMatrix{ { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 } }; }
+
+        void TransformPoint(const double point[3], double result[3]) const
+        {
+            for (int j = 0; j < 3; j++) {
+                result[j] = point[0] * m[j] + point[1] * m[4 + j] + point[2] * m[8 + j] + m[12 + j];
+            }
+        }
+    };
+
+    /// <summary>
+    /// result = a * b, transform by a then by b: local transform times world transform of parent is world transform
+    /// result may be a or b
+    /// </summary>
+    inline void MultiplyTransforms(const TransformMatrix& a, const TransformMatrix& b, TransformMatrix& result)
+    {
+#if defined(RDF_EXPRESS_SIMD_AVX)
+        __m256d b0 = _mm256_loadu_pd(b.m);
+        __m256d b1 = _mm256_loadu_pd(b.m + 4);
+        __m256d b2 = _mm256_loadu_pd(b.m + 8);
+        __m256d b3 = _mm256_loadu_pd(b.m + 12);
+        for (int i = 0; i < 16; i += 4) {
+            __m256d row = _mm256_mul_pd(_mm256_broadcast_sd(a.m + i), b0);
+            row = _mm256_add_pd(row, _mm256_mul_pd(_mm256_broadcast_sd(a.m + i + 1), b1));
+            row = _mm256_add_pd(row, _mm256_mul_pd(_mm256_broadcast_sd(a.m + i + 2), b2));
+            row = _mm256_add_pd(row, _mm256_mul_pd(_mm256_broadcast_sd(a.m + i + 3), b3));
+            _mm256_storeu_pd(result.m + i, row);
+        }
+#elif defined(RDF_EXPRESS_SIMD_SSE2)
+        __m128d rows[8];
+        for (int k = 0; k < 8; k++) {
+            rows[k] = _mm_loadu_pd(b.m + 2 * k);
+        }
+        for (int i = 0; i < 16; i += 4) {
+            __m128d a0 = _mm_set1_pd(a.m[i]);
+            __m128d a1 = _mm_set1_pd(a.m[i + 1]);
+            __m128d a2 = _mm_set1_pd(a.m[i + 2]);
+            __m128d a3 = _mm_set1_pd(a.m[i + 3]);
+            __m128d low = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(a0, rows[0]), _mm_mul_pd(a1, rows[2])), _mm_mul_pd(a2, rows[4])), _mm_mul_pd(a3, rows[6]));
+            __m128d high = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(a0, rows[1]), _mm_mul_pd(a1, rows[3])), _mm_mul_pd(a2, rows[5])), _mm_mul_pd(a3, rows[7]));
+            _mm_storeu_pd(result.m + i, low);
+            _mm_storeu_pd(result.m + i + 2, high);
+        }
+#else
+        TransformMatrix product;
+        for (int i = 0; i < 16; i += 4) {
+            for (int j = 0; j < 4; j++) {
+                product.m[i + j] = a.m[i] * b.m[j] + a.m[i + 1] * b.m[4 + j] + a.m[i + 2] * b.m[8 + j] + a.m[i + 3] * b.m[12 + j];
+            }
+        }
+        result = product;
+#endif
+    }
+
+    /// <summary>
+    /// Entities and attributes read by PlacementTable: object placements, local placement relative to other placement and axis placements
+    /// </summary>
+    struct PlacementAttributes
+    {
+        const char*     objectPlacementEntityName;  //all placements
+        const char*     localPlacementEntityName;
+        const char*     relativeToAttrName;         //placement the local placement is relative to
+        const char*     relativePlacementAttrName;  //axis placement
+        const char*     axis3DEntityName;
+        const char*     axis3DLocationAttrName;
+        const char*     axis3DAxisAttrName;         //z axis
+        const char*     axis3DRefDirectionAttrName; //x axis
+        const char*     axis2DEntityName;
+        const char*     axis2DLocationAttrName;
+        const char*     axis2DRefDirectionAttrName;
+        const char*     pointEntityName;
+        const char*     coordinatesAttrName;
+        const char*     directionEntityName;
+        const char*     directionRatiosAttrName;
+    };
+
+    /// <summary>
+    /// World transforms of all object placements of a model, read and composed in one pass
+    /// Local placement is relative to the placement it refers to, placements are kept in topological order so the placement
+    /// it refers to comes first; every world transform is computed once from the world transform of its parent, shared parents are not read again
+    /// Transforms()[i] is the transform of Placements()[i], Find gives the index of a placement; placements of other kinds are identity
+    /// The table is a snapshot of the model, build it again after placements change
+    /// </summary>
+    class PlacementTable
+    {
+    public:
+        PlacementTable(const PlacementTable&) = delete;
+        PlacementTable& operator=(const PlacementTable&) = delete;
+
+        SdaiModel Model() const { return m_model; }
+
+        size_t size() const { return m_placements.size(); }
+
+        const std::vector<SdaiInstance>& Placements() const { return m_placements; }
+        const std::vector<TransformMatrix>& Transforms() const { return m_transforms; }
+
+        //index of placement the placement is relative to, -1 for placements in world coordinates
+        const std::vector<int>& Parents() const { return m_parents; }
+
+        //index of the placement, -1 if the instance is not placement of the model
+        int Find(SdaiInstance placement) const
+        {
+            auto it = m_indexOf.find(placement);
+            return (it != m_indexOf.end()) ? it->second : -1;
+        }
+
+        //world transform of the placement, NULL if the instance is not placement of the model
+        const TransformMatrix* Transform(SdaiInstance placement) const
+        {
+            int index = Find(placement);
+            return (index >= 0) ? &m_transforms[index] : NULL;
+        }
+
+    protected:
+        PlacementTable(SdaiModel model, const PlacementAttributes& attributes) : m_model(model)
+        {
+            Reader reader(model, attributes);
+            SdaiEntity entity = sdaiGetEntity(model, attributes.objectPlacementEntityName);
+            SdaiAggr extent = entity ? xxxxGetEntityAndSubTypesExtent(model, entity) : NULL;
+            IntValue count = extent ? sdaiGetMemberCount(extent) : 0;
+
+            //read in order of extent
+            std::vector<SdaiInstance> instances((size_t) count);
+            std::vector<SdaiInstance> relativeTo((size_t) count);
+            std::vector<TransformMatrix> locals((size_t) count);
+            std::unordered_map<SdaiInstance, int> indexOf;
+            indexOf.reserve((size_t) count);
+            for (IntValue i = 0; i < count; i++) {
+                sdaiGetAggrByIndex(extent, i, sdaiINSTANCE, &instances[i]);
+                indexOf.emplace(instances[i], (int) i);
+                reader.Read(instances[i], relativeTo[i], locals[i]);
+            }
+
+            std::vector<int> parents((size_t) count);
+            for (IntValue i = 0; i < count; i++) {
+                auto it = relativeTo[i] ? indexOf.find(relativeTo[i]) : indexOf.end();
+                parents[i] = (it != indexOf.end()) ? it->second : -1;
+            }
+
+            //depth of placement in chain of placements it is relative to, placements of a cycle become roots
+            const int UNKNOWN = -1;
+            const int VISITING = -2;
+            std::vector<int> depths((size_t) count, UNKNOWN);
+            std::vector<int> chain;
+            int maxDepth = 0;
+            for (IntValue i = 0; i < count; i++) {
+                while (depths[i] == UNKNOWN) {
+                    int p = (int) i;
+                    while (p >= 0 && depths[p] == UNKNOWN) {
+                        depths[p] = VISITING;
+                        chain.push_back(p);
+                        p = parents[p];
+                    }
+                    if (p >= 0 && depths[p] == VISITING) {
+                        parents[p] = -1; //break the cycle and walk again
+                        for (int c : chain) {
+                            depths[c] = UNKNOWN;
+                        }
+                        chain.clear();
+                        continue;
+                    }
+                    int depth = (p >= 0) ? depths[p] : -1;
+                    while (chain.size()) {
+                        depths[chain.back()] = ++depth;
+                        chain.pop_back();
+                    }
+                    maxDepth = (depth > maxDepth) ? depth : maxDepth;
+                }
+            }
+
+            //counting sort by depth
+            std::vector<int> offsets((size_t) maxDepth + 2, 0);
+            for (IntValue i = 0; i < count; i++) {
+                offsets[depths[i] + 1]++;
+            }
+            for (size_t d = 1; d < offsets.size(); d++) {
+                offsets[d] += offsets[d - 1];
+            }
+            std::vector<int> positions((size_t) count);
+            for (IntValue i = 0; i < count; i++) {
+                positions[i] = offsets[depths[i]]++;
+            }
+
+            m_placements.resize((size_t) count);
+            m_transforms.resize((size_t) count);
+            m_parents.resize((size_t) count);
+            m_indexOf.reserve((size_t) count);
+            for (IntValue i = 0; i < count; i++) {
+                int position = positions[i];
+                m_placements[position] = instances[i];
+                m_transforms[position] = locals[i];
+                m_parents[position] = (parents[i] >= 0) ? positions[parents[i]] : -1;
+                m_indexOf.emplace(instances[i], position);
+            }
+
+            for (size_t i = 0; i < m_transforms.size(); i++) {
+                if (m_parents[i] >= 0) {
+                    MultiplyTransforms(m_transforms[i], m_transforms[m_parents[i]], m_transforms[i]);
+                }
+            }
+        }
+
+    private:
+        //
+        // Reads local transforms of placements
+        struct Reader
+        {
+            SdaiEntity  localPlacementEntity;
+            SdaiAttr    relativeToAttr;
+            SdaiAttr    relativePlacementAttr;
+            SdaiEntity  axis3DEntity;
+            SdaiAttr    axis3DLocationAttr;
+            SdaiAttr    axis3DAxisAttr;
+            SdaiAttr    axis3DRefDirectionAttr;
+            SdaiEntity  axis2DEntity;
+            SdaiAttr    axis2DLocationAttr;
+            SdaiAttr    axis2DRefDirectionAttr;
+            SdaiEntity  pointEntity;
+            SdaiAttr    coordinatesAttr;
+            SdaiEntity  directionEntity;
+            SdaiAttr    directionRatiosAttr;
+
+            Reader(SdaiModel model, const PlacementAttributes& attributes)
+            {
+                localPlacementEntity = sdaiGetEntity(model, attributes.localPlacementEntityName);
+                relativeToAttr = localPlacementEntity ? sdaiGetAttrDefinition(localPlacementEntity, attributes.relativeToAttrName) : NULL;
+                relativePlacementAttr = localPlacementEntity ? sdaiGetAttrDefinition(localPlacementEntity, attributes.relativePlacementAttrName) : NULL;
+                axis3DEntity = sdaiGetEntity(model, attributes.axis3DEntityName);
+                axis3DLocationAttr = axis3DEntity ? sdaiGetAttrDefinition(axis3DEntity, attributes.axis3DLocationAttrName) : NULL;
+                axis3DAxisAttr = axis3DEntity ? sdaiGetAttrDefinition(axis3DEntity, attributes.axis3DAxisAttrName) : NULL;
+                axis3DRefDirectionAttr = axis3DEntity ? sdaiGetAttrDefinition(axis3DEntity, attributes.axis3DRefDirectionAttrName) : NULL;
+                axis2DEntity = sdaiGetEntity(model, attributes.axis2DEntityName);
+                axis2DLocationAttr = axis2DEntity ? sdaiGetAttrDefinition(axis2DEntity, attributes.axis2DLocationAttrName) : NULL;
+                axis2DRefDirectionAttr = axis2DEntity ? sdaiGetAttrDefinition(axis2DEntity, attributes.axis2DRefDirectionAttrName) : NULL;
+                pointEntity = sdaiGetEntity(model, attributes.pointEntityName);
+                coordinatesAttr = pointEntity ? sdaiGetAttrDefinition(pointEntity, attributes.coordinatesAttrName) : NULL;
+                directionEntity = sdaiGetEntity(model, attributes.directionEntityName);
+                directionRatiosAttr = directionEntity ? sdaiGetAttrDefinition(directionEntity, attributes.directionRatiosAttrName) : NULL;
+            }
+
+            void Read(SdaiInstance placement, SdaiInstance& relativeTo, TransformMatrix& local) const
+            {
+                relativeTo = 0;
+                local = TransformMatrix::Identity();
+                if (!localPlacementEntity || !sdaiIsKindOf(placement, localPlacementEntity)) {
+                    return;
+                }
+                sdaiGetAttr(placement, relativeToAttr, sdaiINSTANCE, &relativeTo);
+
+                SdaiInstance axisPlacement = 0;
+                sdaiGetAttr(placement, relativePlacementAttr, sdaiINSTANCE, &axisPlacement);
+                SdaiEntity entity = axisPlacement ? sdaiGetInstanceType(axisPlacement) : NULL;
+
+                double origin[3] = { 0, 0, 0 };
+                double x[3] = { 1, 0, 0 };
+                double z[3] = { 0, 0, 1 };
+                if (entity && entity == axis3DEntity) {
+                    ReadPoint(axisPlacement, axis3DLocationAttr, origin);
+                    ReadDirection(axisPlacement, axis3DAxisAttr, z);
+                    ReadDirection(axisPlacement, axis3DRefDirectionAttr, x);
+                }
+                else if (entity && entity == axis2DEntity) {
+                    ReadPoint(axisPlacement, axis2DLocationAttr, origin);
+                    ReadDirection(axisPlacement, axis2DRefDirectionAttr, x);
+                }
+                else {
+                    return;
+                }
+
+                //axes as IfcAxis2Placement3D derives them: x is projected to the plane normal to z
+                Normalize(z);
+                double dot = x[0] * z[0] + x[1] * z[1] + x[2] * z[2];
+                for (int j = 0; j < 3; j++) {
+                    x[j] -= dot * z[j];
+                }
+                if (!Normalize(x)) {
+                    x[0] = 1; x[1] = 0; x[2] = 0;
+                }
+                double y[3] = { z[1] * x[2] - z[2] * x[1], z[2] * x[0] - z[0] * x[2], z[0] * x[1] - z[1] * x[0] };
+
+                for (int j = 0; j < 3; j++) {
+                    local.m[j] = x[j];
+                    local.m[4 + j] = y[j];
+                    local.m[8 + j] = z[j];
+                    local.m[12 + j] = origin[j];
+                }
+            }
+
+            void ReadPoint(SdaiInstance axisPlacement, SdaiAttr attr, double point[3]) const
+            {
+                SdaiInstance instance = 0;
+                if (attr && sdaiGetAttr(axisPlacement, attr, sdaiINSTANCE, &instance) && instance && sdaiGetInstanceType(instance) == pointEntity) {
+                    ReadReals(instance, coordinatesAttr, point);
+                }
+            }
+
+            //direction is not changed when it is not set
+            void ReadDirection(SdaiInstance axisPlacement, SdaiAttr attr, double direction[3]) const
+            {
+                SdaiInstance instance = 0;
+                if (attr && sdaiGetAttr(axisPlacement, attr, sdaiINSTANCE, &instance) && instance && sdaiGetInstanceType(instance) == directionEntity) {
+                    double ratios[3] = { 0, 0, 0 };
+                    ReadReals(instance, directionRatiosAttr, ratios);
+                    if (ratios[0] != 0 || ratios[1] != 0 || ratios[2] != 0) {
+                        direction[0] = ratios[0]; direction[1] = ratios[1]; direction[2] = ratios[2];
+                    }
+                }
+            }
+
+            //up to 3 values, 2D points and directions have z = 0
+            static void ReadReals(SdaiInstance instance, SdaiAttr attr, double values[3])
+            {
+                SdaiAggr aggr = NULL;
+                if (attr && sdaiGetAttr(instance, attr, sdaiAGGR, &aggr) && aggr) {
+                    IntValue count = sdaiGetMemberCount(aggr);
+                    for (IntValue j = 0; j < count && j < 3; j++) {
+                        sdaiGetAggrByIndex(aggr, j, sdaiREAL, &values[j]);
+                    }
+                }
+            }
+
+            static bool Normalize(double v[3])
+            {
+                double length = sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+                if (length < 1e-12) {
+                    return false;
+                }
+                v[0] /= length; v[1] /= length; v[2] /= length;
+                return true;
+            }
+        };
+
+    private:
+        SdaiModel                               m_model;
+        std::vector<SdaiInstance>               m_placements;
+        std::vector<TransformMatrix>            m_transforms;
+        std::vector<int>                        m_parents;
+        std::unordered_map<SdaiInstance, int>   m_indexOf;
+    };
+
+
+    //
+    // Entities forward declarations
+    //
+
+    class IfcActionRequest;
+    class IfcActor;
+    class IfcActorRole;
+    class IfcActuator;
+    class IfcActuatorType;
+    class IfcAddress;
+    class IfcAdvancedBrep;
+    class IfcAdvancedBrepWithVoids;
+    class IfcAdvancedFace;
+    class IfcAirTerminal;
+    class IfcAirTerminalBox;
+    class IfcAirTerminalBoxType;
+    class IfcAirTerminalType;
+    class IfcAirToAirHeatRecovery;
+    class IfcAirToAirHeatRecoveryType;
+    class IfcAlarm;
+    class IfcAlarmType;
+    class IfcAnnotation;
+    class IfcAnnotationFillArea;
+    class IfcApplication;
+    class IfcAppliedValue;
+    class IfcApproval;
+    class IfcApprovalRelationship;
+    class IfcArbitraryClosedProfileDef;
+    class IfcArbitraryOpenProfileDef;
+    class IfcArbitraryProfileDefWithVoids;
+    class IfcAsset;
+    class IfcAsymmetricIShapeProfileDef;
+    class IfcAudioVisualAppliance;
+    class IfcAudioVisualApplianceType;
+    class IfcAxis1Placement;
+    class IfcAxis2Placement2D;
+    class IfcAxis2Placement3D;
+    class IfcBeam;
+    class IfcBeamStandardCase;
+    class IfcBeamType;
+    class IfcBlobTexture;
+    class IfcBlock;
+    class IfcBoiler;
+    class IfcBoilerType;
+    class IfcBooleanClippingResult;
+    class IfcBooleanResult;
+    class IfcBoundaryCondition;
+    class IfcBoundaryCurve;
+    class IfcBoundaryEdgeCondition;
+    class IfcBoundaryFaceCondition;
+    class IfcBoundaryNodeCondition;
+    class IfcBoundaryNodeConditionWarping;
+    class IfcBoundedCurve;
+    class IfcBoundedSurface;
+    class IfcBoundingBox;
+    class IfcBoxedHalfSpace;
+    class IfcBSplineCurve;
+    class IfcBSplineCurveWithKnots;
+    class IfcBSplineSurface;
+    class IfcBSplineSurfaceWithKnots;
+    class IfcBuilding;
+    class IfcBuildingElement;
+    class IfcBuildingElementPart;
+    class IfcBuildingElementPartType;
+    class IfcBuildingElementProxy;
+    class IfcBuildingElementProxyType;
+    class IfcBuildingElementType;
+    class IfcBuildingStorey;
+    class IfcBuildingSystem;
+    class IfcBurner;
+    class IfcBurnerType;
+    class IfcCableCarrierFitting;
+    class IfcCableCarrierFittingType;
+    class IfcCableCarrierSegment;
+    class IfcCableCarrierSegmentType;
+    class IfcCableFitting;
+    class IfcCableFittingType;
+    class IfcCableSegment;
+    class IfcCableSegmentType;
+    class IfcCartesianPoint;
+    class IfcCartesianPointList;
+    class IfcCartesianPointList2D;
+    class IfcCartesianPointList3D;
+    class IfcCartesianTransformationOperator;
+    class IfcCartesianTransformationOperator2D;
+    class IfcCartesianTransformationOperator2DnonUniform;
+    class IfcCartesianTransformationOperator3D;
+    class IfcCartesianTransformationOperator3DnonUniform;
+    class IfcCenterLineProfileDef;
+    class IfcChiller;
+    class IfcChillerType;
+    class IfcChimney;
+    class IfcChimneyType;
+    class IfcCircle;
+    class IfcCircleHollowProfileDef;
+    class IfcCircleProfileDef;
+    class IfcCivilElement;
+    class IfcCivilElementType;
+    class IfcClassification;
+    class IfcClassificationReference;
+    class IfcClosedShell;
+    class IfcCoil;
+    class IfcCoilType;
+    class IfcColourRgb;
+    class IfcColourRgbList;
+    class IfcColourSpecification;
+    class IfcColumn;
+    class IfcColumnStandardCase;
+    class IfcColumnType;
+    class IfcCommunicationsAppliance;
+    class IfcCommunicationsApplianceType;
+    class IfcComplexProperty;
+    class IfcComplexPropertyTemplate;
+    class IfcCompositeCurve;
+    class IfcCompositeCurveOnSurface;
+    class IfcCompositeCurveSegment;
+    class IfcCompositeProfileDef;
+    class IfcCompressor;
+    class IfcCompressorType;
+    class IfcCondenser;
+    class IfcCondenserType;
+    class IfcConic;
+    class IfcConnectedFaceSet;
+    class IfcConnectionCurveGeometry;
+    class IfcConnectionGeometry;
+    class IfcConnectionPointEccentricity;
+    class IfcConnectionPointGeometry;
+    class IfcConnectionSurfaceGeometry;
+    class IfcConnectionVolumeGeometry;
+    class IfcConstraint;
+    class IfcConstructionEquipmentResource;
+    class IfcConstructionEquipmentResourceType;
+    class IfcConstructionMaterialResource;
+    class IfcConstructionMaterialResourceType;
+    class IfcConstructionProductResource;
+    class IfcConstructionProductResourceType;
+    class IfcConstructionResource;
+    class IfcConstructionResourceType;
+    class IfcContext;
+    class IfcContextDependentUnit;
+    class IfcControl;
+    class IfcController;
+    class IfcControllerType;
+    class IfcConversionBasedUnit;
+    class IfcConversionBasedUnitWithOffset;
+    class IfcCooledBeam;
+    class IfcCooledBeamType;
+    class IfcCoolingTower;
+    class IfcCoolingTowerType;
+    class IfcCoordinateOperation;
+    class IfcCoordinateReferenceSystem;
+    class IfcCostItem;
+    class IfcCostSchedule;
+    class IfcCostValue;
+    class IfcCovering;
+    class IfcCoveringType;
+    class IfcCrewResource;
+    class IfcCrewResourceType;
+    class IfcCsgPrimitive3D;
+    class IfcCsgSolid;
+    class IfcCShapeProfileDef;
+    class IfcCurrencyRelationship;
+    class IfcCurtainWall;
+    class IfcCurtainWallType;
+    class IfcCurve;
+    class IfcCurveBoundedPlane;
+    class IfcCurveBoundedSurface;
+    class IfcCurveStyle;
+    class IfcCurveStyleFont;
+    class IfcCurveStyleFontAndScaling;
+    class IfcCurveStyleFontPattern;
+    class IfcCylindricalSurface;
+    class IfcDamper;
+    class IfcDamperType;
+    class IfcDerivedProfileDef;
+    class IfcDerivedUnit;
+    class IfcDerivedUnitElement;
+    class IfcDimensionalExponents;
+    class IfcDirection;
+    class IfcDiscreteAccessory;
+    class IfcDiscreteAccessoryType;
+    class IfcDistributionChamberElement;
+    class IfcDistributionChamberElementType;
+    class IfcDistributionCircuit;
+    class IfcDistributionControlElement;
+    class IfcDistributionControlElementType;
+    class IfcDistributionElement;
+    class IfcDistributionElementType;
+    class IfcDistributionFlowElement;
+    class IfcDistributionFlowElementType;
+    class IfcDistributionPort;
+    class IfcDistributionSystem;
+    class IfcDocumentInformation;
+    class IfcDocumentInformationRelationship;
+    class IfcDocumentReference;
+    class IfcDoor;
+    class IfcDoorLiningProperties;
+    class IfcDoorPanelProperties;
+    class IfcDoorStandardCase;
+    class IfcDoorStyle;
+    class IfcDoorType;
+    class IfcDraughtingPreDefinedColour;
+    class IfcDraughtingPreDefinedCurveFont;
+    class IfcDuctFitting;
+    class IfcDuctFittingType;
+    class IfcDuctSegment;
+    class IfcDuctSegmentType;
+    class IfcDuctSilencer;
+    class IfcDuctSilencerType;
+    class IfcEdge;
+    class IfcEdgeCurve;
+    class IfcEdgeLoop;
+    class IfcElectricAppliance;
+    class IfcElectricApplianceType;
+    class IfcElectricDistributionBoard;
+    class IfcElectricDistributionBoardType;
+    class IfcElectricFlowStorageDevice;
+    class IfcElectricFlowStorageDeviceType;
+    class IfcElectricGenerator;
+    class IfcElectricGeneratorType;
+    class IfcElectricMotor;
+    class IfcElectricMotorType;
+    class IfcElectricTimeControl;
+    class IfcElectricTimeControlType;
+    class IfcElement;
+    class IfcElementarySurface;
+    class IfcElementAssembly;
+    class IfcElementAssemblyType;
+    class IfcElementComponent;
+    class IfcElementComponentType;
+    class IfcElementQuantity;
+    class IfcElementType;
+    class IfcEllipse;
+    class IfcEllipseProfileDef;
+    class IfcEnergyConversionDevice;
+    class IfcEnergyConversionDeviceType;
+    class IfcEngine;
+    class IfcEngineType;
+    class IfcEvaporativeCooler;
+    class IfcEvaporativeCoolerType;
+    class IfcEvaporator;
+    class IfcEvaporatorType;
+    class IfcEvent;
+    class IfcEventTime;
+    class IfcEventType;
+    class IfcExtendedProperties;
+    class IfcExternalInformation;
+    class IfcExternallyDefinedHatchStyle;
+    class IfcExternallyDefinedSurfaceStyle;
+    class IfcExternallyDefinedTextFont;
+    class IfcExternalReference;
+    class IfcExternalReferenceRelationship;
+    class IfcExternalSpatialElement;
+    class IfcExternalSpatialStructureElement;
+    class IfcExtrudedAreaSolid;
+    class IfcExtrudedAreaSolidTapered;
+    class IfcFace;
+    class IfcFaceBasedSurfaceModel;
+    class IfcFaceBound;
+    class IfcFaceOuterBound;
+    class IfcFaceSurface;
+    class IfcFacetedBrep;
+    class IfcFacetedBrepWithVoids;
+    class IfcFailureConnectionCondition;
+    class IfcFan;
+    class IfcFanType;
+    class IfcFastener;
+    class IfcFastenerType;
+    class IfcFeatureElement;
+    class IfcFeatureElementAddition;
+    class IfcFeatureElementSubtraction;
+    class IfcFillAreaStyle;
+    class IfcFillAreaStyleHatching;
+    class IfcFillAreaStyleTiles;
+    class IfcFilter;
+    class IfcFilterType;
+    class IfcFireSuppressionTerminal;
+    class IfcFireSuppressionTerminalType;
+    class IfcFixedReferenceSweptAreaSolid;
+    class IfcFlowController;
+    class IfcFlowControllerType;
+    class IfcFlowFitting;
+    class IfcFlowFittingType;
+    class IfcFlowInstrument;
+    class IfcFlowInstrumentType;
+    class IfcFlowMeter;
+    class IfcFlowMeterType;
+    class IfcFlowMovingDevice;
+    class IfcFlowMovingDeviceType;
+    class IfcFlowSegment;
+    class IfcFlowSegmentType;
+    class IfcFlowStorageDevice;
+    class IfcFlowStorageDeviceType;
+    class IfcFlowTerminal;
+    class IfcFlowTerminalType;
+    class IfcFlowTreatmentDevice;
+    class IfcFlowTreatmentDeviceType;
+    class IfcFooting;
+    class IfcFootingType;
+    class IfcFurnishingElement;
+    class IfcFurnishingElementType;
+    class IfcFurniture;
+    class IfcFurnitureType;
+    class IfcGeographicElement;
+    class IfcGeographicElementType;
+    class IfcGeometricCurveSet;
+    class IfcGeometricRepresentationContext;
+    class IfcGeometricRepresentationItem;
+    class IfcGeometricRepresentationSubContext;
+    class IfcGeometricSet;
+    class IfcGrid;
+    class IfcGridAxis;
+    class IfcGridPlacement;
+    class IfcGroup;
+    class IfcHalfSpaceSolid;
+    class IfcHeatExchanger;
+    class IfcHeatExchangerType;
+    class IfcHumidifier;
+    class IfcHumidifierType;
+    class IfcImageTexture;
+    class IfcIndexedColourMap;
+    class IfcIndexedPolyCurve;
+    class IfcIndexedPolygonalFace;
+    class IfcIndexedPolygonalFaceWithVoids;
+    class IfcIndexedTextureMap;
+    class IfcIndexedTriangleTextureMap;
+    class IfcInterceptor;
+    class IfcInterceptorType;
+    class IfcIntersectionCurve;
+    class IfcInventory;
+    class IfcIrregularTimeSeries;
+    class IfcIrregularTimeSeriesValue;
+    class IfcIShapeProfileDef;
+    class IfcJunctionBox;
+    class IfcJunctionBoxType;
+    class IfcLaborResource;
+    class IfcLaborResourceType;
+    class IfcLagTime;
+    class IfcLamp;
+    class IfcLampType;
+    class IfcLibraryInformation;
+    class IfcLibraryReference;
+    class IfcLightDistributionData;
+    class IfcLightFixture;
+    class IfcLightFixtureType;
+    class IfcLightIntensityDistribution;
+    class IfcLightSource;
+    class IfcLightSourceAmbient;
+    class IfcLightSourceDirectional;
+    class IfcLightSourceGoniometric;
+    class IfcLightSourcePositional;
+    class IfcLightSourceSpot;
+    class IfcLine;
+    class IfcLocalPlacement;
+    class IfcLoop;
+    class IfcLShapeProfileDef;
+    class IfcManifoldSolidBrep;
+    class IfcMapConversion;
+    class IfcMappedItem;
+    class IfcMaterial;
+    class IfcMaterialClassificationRelationship;
+    class IfcMaterialConstituent;
+    class IfcMaterialConstituentSet;
+    class IfcMaterialDefinition;
+    class IfcMaterialDefinitionRepresentation;
+    class IfcMaterialLayer;
+    class IfcMaterialLayerSet;
+    class IfcMaterialLayerSetUsage;
+    class IfcMaterialLayerWithOffsets;
+    class IfcMaterialList;
+    class IfcMaterialProfile;
+    class IfcMaterialProfileSet;
+    class IfcMaterialProfileSetUsage;
+    class IfcMaterialProfileSetUsageTapering;
+    class IfcMaterialProfileWithOffsets;
+    class IfcMaterialProperties;
+    class IfcMaterialRelationship;
+    class IfcMaterialUsageDefinition;
+    class IfcMeasureWithUnit;
+    class IfcMechanicalFastener;
+    class IfcMechanicalFastenerType;
+    class IfcMedicalDevice;
+    class IfcMedicalDeviceType;
+    class IfcMember;
+    class IfcMemberStandardCase;
+    class IfcMemberType;
+    class IfcMetric;
+    class IfcMirroredProfileDef;
+    class IfcMonetaryUnit;
+    class IfcMotorConnection;
+    class IfcMotorConnectionType;
+    class IfcNamedUnit;
+    class IfcObject;
+    class IfcObjectDefinition;
+    class IfcObjective;
+    class IfcObjectPlacement;
+    class IfcOccupant;
+    class IfcOffsetCurve2D;
+    class IfcOffsetCurve3D;
+    class IfcOpeningElement;
+    class IfcOpeningStandardCase;
+    class IfcOpenShell;
+    class IfcOrganization;
+    class IfcOrganizationRelationship;
+    class IfcOrientedEdge;
+    class IfcOuterBoundaryCurve;
+    class IfcOutlet;
+    class IfcOutletType;
+    class IfcOwnerHistory;
+    class IfcParameterizedProfileDef;
+    class IfcPath;
+    class IfcPcurve;
+    class IfcPerformanceHistory;
+    class IfcPermeableCoveringProperties;
+    class IfcPermit;
+    class IfcPerson;
+    class IfcPersonAndOrganization;
+    class IfcPhysicalComplexQuantity;
+    class IfcPhysicalQuantity;
+    class IfcPhysicalSimpleQuantity;
+    class IfcPile;
+    class IfcPileType;
+    class IfcPipeFitting;
+    class IfcPipeFittingType;
+    class IfcPipeSegment;
+    class IfcPipeSegmentType;
+    class IfcPixelTexture;
+    class IfcPlacement;
+    class IfcPlanarBox;
+    class IfcPlanarExtent;
+    class IfcPlane;
+    class IfcPlate;
+    class IfcPlateStandardCase;
+    class IfcPlateType;
+    class IfcPoint;
+    class IfcPointOnCurve;
+    class IfcPointOnSurface;
+    class IfcPolygonalBoundedHalfSpace;
+    class IfcPolygonalFaceSet;
+    class IfcPolyline;
+    class IfcPolyLoop;
+    class IfcPort;
+    class IfcPostalAddress;
+    class IfcPreDefinedColour;
+    class IfcPreDefinedCurveFont;
+    class IfcPreDefinedItem;
+    class IfcPreDefinedProperties;
+    class IfcPreDefinedPropertySet;
+    class IfcPreDefinedTextFont;
+    class IfcPresentationItem;
+    class IfcPresentationLayerAssignment;
+    class IfcPresentationLayerWithStyle;
+    class IfcPresentationStyle;
+    class IfcPresentationStyleAssignment;
+    class IfcProcedure;
+    class IfcProcedureType;
+    class IfcProcess;
+    class IfcProduct;
+    class IfcProductDefinitionShape;
+    class IfcProductRepresentation;
+    class IfcProfileDef;
+    class IfcProfileProperties;
+    class IfcProject;
+    class IfcProjectedCRS;
+    class IfcProjectionElement;
+    class IfcProjectLibrary;
+    class IfcProjectOrder;
+    class IfcProperty;
+    class IfcPropertyAbstraction;
+    class IfcPropertyBoundedValue;
+    class IfcPropertyDefinition;
+    class IfcPropertyDependencyRelationship;
+    class IfcPropertyEnumeratedValue;
+    class IfcPropertyEnumeration;
+    class IfcPropertyListValue;
+    class IfcPropertyReferenceValue;
+    class IfcPropertySet;
+    class IfcPropertySetDefinition;
+    class IfcPropertySetTemplate;
+    class IfcPropertySingleValue;
+    class IfcPropertyTableValue;
+    class IfcPropertyTemplate;
+    class IfcPropertyTemplateDefinition;
+    class IfcProtectiveDevice;
+    class IfcProtectiveDeviceTrippingUnit;
+    class IfcProtectiveDeviceTrippingUnitType;
+    class IfcProtectiveDeviceType;
+    class IfcProxy;
+    class IfcPump;
+    class IfcPumpType;
+    class IfcQuantityArea;
+    class IfcQuantityCount;
+    class IfcQuantityLength;
+    class IfcQuantitySet;
+    class IfcQuantityTime;
+    class IfcQuantityVolume;
+    class IfcQuantityWeight;
+    class IfcRailing;
+    class IfcRailingType;
+    class IfcRamp;
+    class IfcRampFlight;
+    class IfcRampFlightType;
+    class IfcRampType;
+    class IfcRationalBSplineCurveWithKnots;
+    class IfcRationalBSplineSurfaceWithKnots;
+    class IfcRectangleHollowProfileDef;
+    class IfcRectangleProfileDef;
+    class IfcRectangularPyramid;
+    class IfcRectangularTrimmedSurface;
+    class IfcRecurrencePattern;
+    class IfcReference;
+    class IfcRegularTimeSeries;
+    class IfcReinforcementBarProperties;
+    class IfcReinforcementDefinitionProperties;
+    class IfcReinforcingBar;
+    class IfcReinforcingBarType;
+    class IfcReinforcingElement;
+    class IfcReinforcingElementType;
+    class IfcReinforcingMesh;
+    class IfcReinforcingMeshType;
+    class IfcRelAggregates;
+    class IfcRelAssigns;
+    class IfcRelAssignsToActor;
+    class IfcRelAssignsToControl;
+    class IfcRelAssignsToGroup;
+    class IfcRelAssignsToGroupByFactor;
+    class IfcRelAssignsToProcess;
+    class IfcRelAssignsToProduct;
+    class IfcRelAssignsToResource;
+    class IfcRelAssociates;
+    class IfcRelAssociatesApproval;
+    class IfcRelAssociatesClassification;
+    class IfcRelAssociatesConstraint;
+    class IfcRelAssociatesDocument;
+    class IfcRelAssociatesLibrary;
+    class IfcRelAssociatesMaterial;
+    class IfcRelationship;
+    class IfcRelConnects;
+    class IfcRelConnectsElements;
+    class IfcRelConnectsPathElements;
+    class IfcRelConnectsPorts;
+    class IfcRelConnectsPortToElement;
+    class IfcRelConnectsStructuralActivity;
+    class IfcRelConnectsStructuralMember;
+    class IfcRelConnectsWithEccentricity;
+    class IfcRelConnectsWithRealizingElements;
+    class IfcRelContainedInSpatialStructure;
+    class IfcRelCoversBldgElements;
+    class IfcRelCoversSpaces;
+    class IfcRelDeclares;
+    class IfcRelDecomposes;
+    class IfcRelDefines;
+    class IfcRelDefinesByObject;
+    class IfcRelDefinesByProperties;
+    class IfcRelDefinesByTemplate;
+    class IfcRelDefinesByType;
+    class IfcRelFillsElement;
+    class IfcRelFlowControlElements;
+    class IfcRelInterferesElements;
+    class IfcRelNests;
+    class IfcRelProjectsElement;
+    class IfcRelReferencedInSpatialStructure;
+    class IfcRelSequence;
+    class IfcRelServicesBuildings;
+    class IfcRelSpaceBoundary;
+    class IfcRelSpaceBoundary1stLevel;
+    class IfcRelSpaceBoundary2ndLevel;
+    class IfcRelVoidsElement;
+    class IfcReparametrisedCompositeCurveSegment;
+    class IfcRepresentation;
+    class IfcRepresentationContext;
+    class IfcRepresentationItem;
+    class IfcRepresentationMap;
+    class IfcResource;
+    class IfcResourceApprovalRelationship;
+    class IfcResourceConstraintRelationship;
+    class IfcResourceLevelRelationship;
+    class IfcResourceTime;
+    class IfcRevolvedAreaSolid;
+    class IfcRevolvedAreaSolidTapered;
+    class IfcRightCircularCone;
+    class IfcRightCircularCylinder;
+    class IfcRoof;
+    class IfcRoofType;
+    class IfcRoot;
+    class IfcRoundedRectangleProfileDef;
+    class IfcSanitaryTerminal;
+    class IfcSanitaryTerminalType;
+    class IfcSchedulingTime;
+    class IfcSeamCurve;
+    class IfcSectionedSpine;
+    class IfcSectionProperties;
+    class IfcSectionReinforcementProperties;
+    class IfcSensor;
+    class IfcSensorType;
+    class IfcShadingDevice;
+    class IfcShadingDeviceType;
+    class IfcShapeAspect;
+    class IfcShapeModel;
+    class IfcShapeRepresentation;
+    class IfcShellBasedSurfaceModel;
+    class IfcSimpleProperty;
+    class IfcSimplePropertyTemplate;
+    class IfcSite;
+    class IfcSIUnit;
+    class IfcSlab;
+    class IfcSlabElementedCase;
+    class IfcSlabStandardCase;
+    class IfcSlabType;
+    class IfcSlippageConnectionCondition;
+    class IfcSolarDevice;
+    class IfcSolarDeviceType;
+    class IfcSolidModel;
+    class IfcSpace;
+    class IfcSpaceHeater;
+    class IfcSpaceHeaterType;
+    class IfcSpaceType;
+    class IfcSpatialElement;
+    class IfcSpatialElementType;
+    class IfcSpatialStructureElement;
+    class IfcSpatialStructureElementType;
+    class IfcSpatialZone;
+    class IfcSpatialZoneType;
+    class IfcSphere;
+    class IfcSphericalSurface;
+    class IfcStackTerminal;
+    class IfcStackTerminalType;
+    class IfcStair;
+    class IfcStairFlight;
+    class IfcStairFlightType;
+    class IfcStairType;
+    class IfcStructuralAction;
+    class IfcStructuralActivity;
+    class IfcStructuralAnalysisModel;
+    class IfcStructuralConnection;
+    class IfcStructuralConnectionCondition;
+    class IfcStructuralCurveAction;
+    class IfcStructuralCurveConnection;
+    class IfcStructuralCurveMember;
+    class IfcStructuralCurveMemberVarying;
+    class IfcStructuralCurveReaction;
+    class IfcStructuralItem;
+    class IfcStructuralLinearAction;
+    class IfcStructuralLoad;
+    class IfcStructuralLoadCase;
+    class IfcStructuralLoadConfiguration;
+    class IfcStructuralLoadGroup;
+    class IfcStructuralLoadLinearForce;
+    class IfcStructuralLoadOrResult;
+    class IfcStructuralLoadPlanarForce;
+    class IfcStructuralLoadSingleDisplacement;
+    class IfcStructuralLoadSingleDisplacementDistortion;
+    class IfcStructuralLoadSingleForce;
+    class IfcStructuralLoadSingleForceWarping;
+    class IfcStructuralLoadStatic;
+    class IfcStructuralLoadTemperature;
+    class IfcStructuralMember;
+    class IfcStructuralPlanarAction;
+    class IfcStructuralPointAction;
+    class IfcStructuralPointConnection;
+    class IfcStructuralPointReaction;
+    class IfcStructuralReaction;
+    class IfcStructuralResultGroup;
+    class IfcStructuralSurfaceAction;
+    class IfcStructuralSurfaceConnection;
+    class IfcStructuralSurfaceMember;
+    class IfcStructuralSurfaceMemberVarying;
+    class IfcStructuralSurfaceReaction;
+    class IfcStyledItem;
+    class IfcStyledRepresentation;
+    class IfcStyleModel;
+    class IfcSubContractResource;
+    class IfcSubContractResourceType;
+    class IfcSubedge;
+    class IfcSurface;
+    class IfcSurfaceCurve;
+    class IfcSurfaceCurveSweptAreaSolid;
+    class IfcSurfaceFeature;
+    class IfcSurfaceOfLinearExtrusion;
+    class IfcSurfaceOfRevolution;
+    class IfcSurfaceReinforcementArea;
+    class IfcSurfaceStyle;
+    class IfcSurfaceStyleLighting;
+    class IfcSurfaceStyleRefraction;
+    class IfcSurfaceStyleRendering;
+    class IfcSurfaceStyleShading;
+    class IfcSurfaceStyleWithTextures;
+    class IfcSurfaceTexture;
+    class IfcSweptAreaSolid;
+    class IfcSweptDiskSolid;
+    class IfcSweptDiskSolidPolygonal;
+    class IfcSweptSurface;
+    class IfcSwitchingDevice;
+    class IfcSwitchingDeviceType;
+    class IfcSystem;
+    class IfcSystemFurnitureElement;
+    class IfcSystemFurnitureElementType;
+    class IfcTable;
+    class IfcTableColumn;
+    class IfcTableRow;
+    class IfcTank;
+    class IfcTankType;
+    class IfcTask;
+    class IfcTaskTime;
+    class IfcTaskTimeRecurring;
+    class IfcTaskType;
+    class IfcTelecomAddress;
+    class IfcTendon;
+    class IfcTendonAnchor;
+    class IfcTendonAnchorType;
+    class IfcTendonType;
+    class IfcTessellatedFaceSet;
+    class IfcTessellatedItem;
+    class IfcTextLiteral;
+    class IfcTextLiteralWithExtent;
+    class IfcTextStyle;
+    class IfcTextStyleFontModel;
+    class IfcTextStyleForDefinedFont;
+    class IfcTextStyleTextModel;
+    class IfcTextureCoordinate;
+    class IfcTextureCoordinateGenerator;
+    class IfcTextureMap;
+    class IfcTextureVertex;
+    class IfcTextureVertexList;
+    class IfcTimePeriod;
+    class IfcTimeSeries;
+    class IfcTimeSeriesValue;
+    class IfcTopologicalRepresentationItem;
+    class IfcTopologyRepresentation;
+    class IfcToroidalSurface;
+    class IfcTransformer;
+    class IfcTransformerType;
+    class IfcTransportElement;
+    class IfcTransportElementType;
+    class IfcTrapeziumProfileDef;
+    class IfcTriangulatedFaceSet;
+    class IfcTrimmedCurve;
+    class IfcTShapeProfileDef;
+    class IfcTubeBundle;
+    class IfcTubeBundleType;
+    class IfcTypeObject;
+    class IfcTypeProcess;
+    class IfcTypeProduct;
+    class IfcTypeResource;
+    class IfcUnitaryControlElement;
+    class IfcUnitaryControlElementType;
+    class IfcUnitaryEquipment;
+    class IfcUnitaryEquipmentType;
+    class IfcUnitAssignment;
+    class IfcUShapeProfileDef;
+    class IfcValve;
+    class IfcValveType;
+    class IfcVector;
+    class IfcVertex;
+    class IfcVertexLoop;
+    class IfcVertexPoint;
+    class IfcVibrationIsolator;
+    class IfcVibrationIsolatorType;
+    class IfcVirtualElement;
+    class IfcVirtualGridIntersection;
+    class IfcVoidingFeature;
+    class IfcWall;
+    class IfcWallElementedCase;
+    class IfcWallStandardCase;
+    class IfcWallType;
+    class IfcWasteTerminal;
+    class IfcWasteTerminalType;
+    class IfcWindow;
+    class IfcWindowLiningProperties;
+    class IfcWindowPanelProperties;
+    class IfcWindowStandardCase;
+    class IfcWindowStyle;
+    class IfcWindowType;
+    class IfcWorkCalendar;
+    class IfcWorkControl;
+    class IfcWorkPlan;
+    class IfcWorkSchedule;
+    class IfcWorkTime;
+    class IfcZone;
+    class IfcZShapeProfileDef;
+
+    class IfcActorSelect;
+    class IfcActorSelect_get;
+    class IfcActorSelect_put;
+    class IfcAppliedValueSelect;
+    class IfcAppliedValueSelect_get;
+    class IfcAppliedValueSelect_put;
+    class IfcAxis2Placement;
+    class IfcAxis2Placement_get;
+    class IfcAxis2Placement_put;
+    class IfcBendingParameterSelect;
+    class IfcBendingParameterSelect_get;
+    class IfcBendingParameterSelect_put;
+    class IfcBooleanOperand;
+    class IfcBooleanOperand_get;
+    class IfcBooleanOperand_put;
+    class IfcClassificationReferenceSelect;
+    class IfcClassificationReferenceSelect_get;
+    class IfcClassificationReferenceSelect_put;
+    class IfcClassificationSelect;
+    class IfcClassificationSelect_get;
+    class IfcClassificationSelect_put;
+    class IfcColour;
+    class IfcColour_get;
+    class IfcColour_put;
+    class IfcColourOrFactor;
+    class IfcColourOrFactor_get;
+    class IfcColourOrFactor_put;
+    class IfcCoordinateReferenceSystemSelect;
+    class IfcCoordinateReferenceSystemSelect_get;
+    class IfcCoordinateReferenceSystemSelect_put;
+    class IfcCsgSelect;
+    class IfcCsgSelect_get;
+    class IfcCsgSelect_put;
+    class IfcCurveFontOrScaledCurveFontSelect;
+    class IfcCurveFontOrScaledCurveFontSelect_get;
+    class IfcCurveFontOrScaledCurveFontSelect_put;
+    class IfcCurveOnSurface;
+    class IfcCurveOnSurface_get;
+    class IfcCurveOnSurface_put;
+    class IfcCurveOrEdgeCurve;
+    class IfcCurveOrEdgeCurve_get;
+    class IfcCurveOrEdgeCurve_put;
+    class IfcCurveStyleFontSelect;
+    class IfcCurveStyleFontSelect_get;
+    class IfcCurveStyleFontSelect_put;
+    class IfcDefinitionSelect;
+    class IfcDefinitionSelect_get;
+    class IfcDefinitionSelect_put;
+    class IfcDerivedMeasureValue;
+    class IfcDerivedMeasureValue_get;
+    class IfcDerivedMeasureValue_put;
+    class IfcDocumentSelect;
+    class IfcDocumentSelect_get;
+    class IfcDocumentSelect_put;
+    class IfcFillStyleSelect;
+    class IfcFillStyleSelect_get;
+    class IfcFillStyleSelect_put;
+    class IfcGeometricSetSelect;
+    class IfcGeometricSetSelect_get;
+    class IfcGeometricSetSelect_put;
+    class IfcGridPlacementDirectionSelect;
+    class IfcGridPlacementDirectionSelect_get;
+    class IfcGridPlacementDirectionSelect_put;
+    class IfcHatchLineDistanceSelect;
+    class IfcHatchLineDistanceSelect_get;
+    class IfcHatchLineDistanceSelect_put;
+    class IfcLayeredItem;
+    class IfcLayeredItem_get;
+    class IfcLayeredItem_put;
+    class IfcLibrarySelect;
+    class IfcLibrarySelect_get;
+    class IfcLibrarySelect_put;
+    class IfcLightDistributionDataSourceSelect;
+    class IfcLightDistributionDataSourceSelect_get;
+    class IfcLightDistributionDataSourceSelect_put;
+    class IfcMaterialSelect;
+    class IfcMaterialSelect_get;
+    class IfcMaterialSelect_put;
+    class IfcMeasureValue;
+    class IfcMeasureValue_get;
+    class IfcMeasureValue_put;
+    class IfcMetricValueSelect;
+    class IfcMetricValueSelect_get;
+    class IfcMetricValueSelect_put;
+    class IfcModulusOfRotationalSubgradeReactionSelect;
+    class IfcModulusOfRotationalSubgradeReactionSelect_get;
+    class IfcModulusOfRotationalSubgradeReactionSelect_put;
+    class IfcModulusOfSubgradeReactionSelect;
+    class IfcModulusOfSubgradeReactionSelect_get;
+    class IfcModulusOfSubgradeReactionSelect_put;
+    class IfcModulusOfTranslationalSubgradeReactionSelect;
+    class IfcModulusOfTranslationalSubgradeReactionSelect_get;
+    class IfcModulusOfTranslationalSubgradeReactionSelect_put;
+    class IfcObjectReferenceSelect;
+    class IfcObjectReferenceSelect_get;
+    class IfcObjectReferenceSelect_put;
+    class IfcPointOrVertexPoint;
+    class IfcPointOrVertexPoint_get;
+    class IfcPointOrVertexPoint_put;
+    class IfcPresentationStyleSelect;
+    class IfcPresentationStyleSelect_get;
+    class IfcPresentationStyleSelect_put;
+    class IfcProcessSelect;
+    class IfcProcessSelect_get;
+    class IfcProcessSelect_put;
+    class IfcProductRepresentationSelect;
+    class IfcProductRepresentationSelect_get;
+    class IfcProductRepresentationSelect_put;
+    class IfcProductSelect;
+    class IfcProductSelect_get;
+    class IfcProductSelect_put;
+    class IfcPropertySetDefinitionSelect;
+    class IfcPropertySetDefinitionSelect_get;
+    class IfcPropertySetDefinitionSelect_put;
+    class IfcResourceObjectSelect;
+    class IfcResourceObjectSelect_get;
+    class IfcResourceObjectSelect_put;
+    class IfcResourceSelect;
+    class IfcResourceSelect_get;
+    class IfcResourceSelect_put;
+    class IfcRotationalStiffnessSelect;
+    class IfcRotationalStiffnessSelect_get;
+    class IfcRotationalStiffnessSelect_put;
+    class IfcSegmentIndexSelect;
+    class IfcSegmentIndexSelect_get;
+    class IfcSegmentIndexSelect_put;
+    class IfcShell;
+    class IfcShell_get;
+    class IfcShell_put;
+    class IfcSimpleValue;
+    class IfcSimpleValue_get;
+    class IfcSimpleValue_put;
+    class IfcSizeSelect;
+    class IfcSizeSelect_get;
+    class IfcSizeSelect_put;
+    class IfcSolidOrShell;
+    class IfcSolidOrShell_get;
+    class IfcSolidOrShell_put;
+    class IfcSpaceBoundarySelect;
+    class IfcSpaceBoundarySelect_get;
+    class IfcSpaceBoundarySelect_put;
+    class IfcSpecularHighlightSelect;
+    class IfcSpecularHighlightSelect_get;
+    class IfcSpecularHighlightSelect_put;
+    class IfcStructuralActivityAssignmentSelect;
+    class IfcStructuralActivityAssignmentSelect_get;
+    class IfcStructuralActivityAssignmentSelect_put;
+    class IfcStyleAssignmentSelect;
+    class IfcStyleAssignmentSelect_get;
+    class IfcStyleAssignmentSelect_put;
+    class IfcSurfaceOrFaceSurface;
+    class IfcSurfaceOrFaceSurface_get;
+    class IfcSurfaceOrFaceSurface_put;
+    class IfcSurfaceStyleElementSelect;
+    class IfcSurfaceStyleElementSelect_get;
+    class IfcSurfaceStyleElementSelect_put;
+    class IfcTextFontSelect;
+    class IfcTextFontSelect_get;
+    class IfcTextFontSelect_put;
+    class IfcTimeOrRatioSelect;
+    class IfcTimeOrRatioSelect_get;
+    class IfcTimeOrRatioSelect_put;
+    class IfcTranslationalStiffnessSelect;
+    class IfcTranslationalStiffnessSelect_get;
+    class IfcTranslationalStiffnessSelect_put;
+    class IfcTrimmingSelect;
+    class IfcTrimmingSelect_get;
+    class IfcTrimmingSelect_put;
+    class IfcUnit;
+    class IfcUnit_get;
+    class IfcUnit_put;
+    class IfcValue;
+    class IfcValue_get;
+    class IfcValue_put;
+    class IfcVectorOrDirection;
+    class IfcVectorOrDirection_get;
+    class IfcVectorOrDirection_put;
+    class IfcWarpingStiffnessSelect;
+    class IfcWarpingStiffnessSelect_get;
+    class IfcWarpingStiffnessSelect_put;
+
+        //
+        // Enumerations
+        //
+
+    enum class IfcActionRequestTypeEnum
+    {
+        EMAIL = 0,
+        FAX = 1,
+        PHONE = 2,
+        POST = 3,
+        VERBAL = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcActionSourceTypeEnum
+    {
+        DEAD_LOAD_G = 0,
+        COMPLETION_G1 = 1,
+        LIVE_LOAD_Q = 2,
+        SNOW_S = 3,
+        WIND_W = 4,
+        PRESTRESSING_P = 5,
+        SETTLEMENT_U = 6,
+        TEMPERATURE_T = 7,
+        EARTHQUAKE_E = 8,
+        FIRE = 9,
+        IMPULSE = 10,
+        IMPACT = 11,
+        TRANSPORT = 12,
+        ERECTION = 13,
+        PROPPING = 14,
+        SYSTEM_IMPERFECTION = 15,
+        SHRINKAGE = 16,
+        CREEP = 17,
+        LACK_OF_FIT = 18,
+        BUOYANCY = 19,
+        ICE = 20,
+        CURRENT = 21,
+        WAVE = 22,
+        RAIN = 23,
+        BRAKES = 24,
+        USERDEFINED = 25,
+        NOTDEFINED = 26,
+        ___unk = -1
+    };
+
+    enum class IfcActionTypeEnum
+    {
+        PERMANENT_G = 0,
+        VARIABLE_Q = 1,
+        EXTRAORDINARY_A = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcActuatorTypeEnum
+    {
+        ELECTRICACTUATOR = 0,
+        HANDOPERATEDACTUATOR = 1,
+        HYDRAULICACTUATOR = 2,
+        PNEUMATICACTUATOR = 3,
+        THERMOSTATICACTUATOR = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcAddressTypeEnum
+    {
+        OFFICE = 0,
+        SITE = 1,
+        HOME = 2,
+        DISTRIBUTIONPOINT = 3,
+        USERDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcAirTerminalBoxTypeEnum
+    {
+        CONSTANTFLOW = 0,
+        VARIABLEFLOWPRESSUREDEPENDANT = 1,
+        VARIABLEFLOWPRESSUREINDEPENDANT = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcAirTerminalTypeEnum
+    {
+        DIFFUSER = 0,
+        GRILLE = 1,
+        LOUVRE = 2,
+        REGISTER = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcAirToAirHeatRecoveryTypeEnum
+    {
+        FIXEDPLATECOUNTERFLOWEXCHANGER = 0,
+        FIXEDPLATECROSSFLOWEXCHANGER = 1,
+        FIXEDPLATEPARALLELFLOWEXCHANGER = 2,
+        ROTARYWHEEL = 3,
+        RUNAROUNDCOILLOOP = 4,
+        HEATPIPE = 5,
+        TWINTOWERENTHALPYRECOVERYLOOPS = 6,
+        THERMOSIPHONSEALEDTUBEHEATEXCHANGERS = 7,
+        THERMOSIPHONCOILTYPEHEATEXCHANGERS = 8,
+        USERDEFINED = 9,
+        NOTDEFINED = 10,
+        ___unk = -1
+    };
+
+    enum class IfcAlarmTypeEnum
+    {
+        BELL = 0,
+        BREAKGLASSBUTTON = 1,
+        LIGHT = 2,
+        MANUALPULLBOX = 3,
+        SIREN = 4,
+        WHISTLE = 5,
+        USERDEFINED = 6,
+        NOTDEFINED = 7,
+        ___unk = -1
+    };
+
+    enum class IfcAnalysisModelTypeEnum
+    {
+        IN_PLANE_LOADING_2D = 0,
+        OUT_PLANE_LOADING_2D = 1,
+        LOADING_3D = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcAnalysisTheoryTypeEnum
+    {
+        FIRST_ORDER_THEORY = 0,
+        SECOND_ORDER_THEORY = 1,
+        THIRD_ORDER_THEORY = 2,
+        FULL_NONLINEAR_THEORY = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcArithmeticOperatorEnum
+    {
+        ADD = 0,
+        DIVIDE = 1,
+        MULTIPLY = 2,
+        SUBTRACT = 3,
+        ___unk = -1
+    };
+
+    enum class IfcAssemblyPlaceEnum
+    {
+        SITE = 0,
+        FACTORY = 1,
+        NOTDEFINED = 2,
+        ___unk = -1
+    };
+
+    enum class IfcAudioVisualApplianceTypeEnum
+    {
+        AMPLIFIER = 0,
+        CAMERA = 1,
+        DISPLAY = 2,
+        MICROPHONE = 3,
+        PLAYER = 4,
+        PROJECTOR = 5,
+        RECEIVER = 6,
+        SPEAKER = 7,
+        SWITCHER = 8,
+        TELEPHONE = 9,
+        TUNER = 10,
+        USERDEFINED = 11,
+        NOTDEFINED = 12,
+        ___unk = -1
+    };
+
+    enum class IfcBeamTypeEnum
+    {
+        BEAM = 0,
+        JOIST = 1,
+        HOLLOWCORE = 2,
+        LINTEL = 3,
+        SPANDREL = 4,
+        T_BEAM = 5,
+        USERDEFINED = 6,
+        NOTDEFINED = 7,
+        ___unk = -1
+    };
+
+    enum class IfcBenchmarkEnum
+    {
+        GREATERTHAN = 0,
+        GREATERTHANOREQUALTO = 1,
+        LESSTHAN = 2,
+        LESSTHANOREQUALTO = 3,
+        EQUALTO = 4,
+        NOTEQUALTO = 5,
+        INCLUDES = 6,
+        NOTINCLUDES = 7,
+        INCLUDEDIN = 8,
+        NOTINCLUDEDIN = 9,
+        ___unk = -1
+    };
+
+    enum class IfcBoilerTypeEnum
+    {
+        WATER = 0,
+        STEAM = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcBooleanOperator
+    {
+        UNION = 0,
+        INTERSECTION = 1,
+        DIFFERENCE = 2,
+        ___unk = -1
+    };
+
+    enum class IfcBSplineCurveForm
+    {
+        POLYLINE_FORM = 0,
+        CIRCULAR_ARC = 1,
+        ELLIPTIC_ARC = 2,
+        PARABOLIC_ARC = 3,
+        HYPERBOLIC_ARC = 4,
+        UNSPECIFIED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcBSplineSurfaceForm
+    {
+        PLANE_SURF = 0,
+        CYLINDRICAL_SURF = 1,
+        CONICAL_SURF = 2,
+        SPHERICAL_SURF = 3,
+        TOROIDAL_SURF = 4,
+        SURF_OF_REVOLUTION = 5,
+        RULED_SURF = 6,
+        GENERALISED_CONE = 7,
+        QUADRIC_SURF = 8,
+        SURF_OF_LINEAR_EXTRUSION = 9,
+        UNSPECIFIED = 10,
+        ___unk = -1
+    };
+
+    enum class IfcBuildingElementPartTypeEnum
+    {
+        INSULATION = 0,
+        PRECASTPANEL = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcBuildingElementProxyTypeEnum
+    {
+        COMPLEX = 0,
+        ELEMENT = 1,
+        PARTIAL = 2,
+        PROVISIONFORVOID = 3,
+        PROVISIONFORSPACE = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcBuildingSystemTypeEnum
+    {
+        FENESTRATION = 0,
+        FOUNDATION = 1,
+        LOADBEARING = 2,
+        OUTERSHELL = 3,
+        SHADING = 4,
+        TRANSPORT = 5,
+        USERDEFINED = 6,
+        NOTDEFINED = 7,
+        ___unk = -1
+    };
+
+    enum class IfcBurnerTypeEnum
+    {
+        USERDEFINED = 0,
+        NOTDEFINED = 1,
+        ___unk = -1
+    };
+
+    enum class IfcCableCarrierFittingTypeEnum
+    {
+        BEND = 0,
+        CROSS = 1,
+        REDUCER = 2,
+        TEE = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcCableCarrierSegmentTypeEnum
+    {
+        CABLELADDERSEGMENT = 0,
+        CABLETRAYSEGMENT = 1,
+        CABLETRUNKINGSEGMENT = 2,
+        CONDUITSEGMENT = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcCableFittingTypeEnum
+    {
+        CONNECTOR = 0,
+        ENTRY = 1,
+        EXIT = 2,
+        JUNCTION = 3,
+        TRANSITION = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcCableSegmentTypeEnum
+    {
+        BUSBARSEGMENT = 0,
+        CABLESEGMENT = 1,
+        CONDUCTORSEGMENT = 2,
+        CORESEGMENT = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcChangeActionEnum
+    {
+        NOCHANGE = 0,
+        MODIFIED = 1,
+        ADDED = 2,
+        DELETED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcChillerTypeEnum
+    {
+        AIRCOOLED = 0,
+        WATERCOOLED = 1,
+        HEATRECOVERY = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcChimneyTypeEnum
+    {
+        USERDEFINED = 0,
+        NOTDEFINED = 1,
+        ___unk = -1
+    };
+
+    enum class IfcCoilTypeEnum
+    {
+        DXCOOLINGCOIL = 0,
+        ELECTRICHEATINGCOIL = 1,
+        GASHEATINGCOIL = 2,
+        HYDRONICCOIL = 3,
+        STEAMHEATINGCOIL = 4,
+        WATERCOOLINGCOIL = 5,
+        WATERHEATINGCOIL = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcColumnTypeEnum
+    {
+        COLUMN = 0,
+        PILASTER = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcCommunicationsApplianceTypeEnum
+    {
+        ANTENNA = 0,
+        COMPUTER = 1,
+        FAX = 2,
+        GATEWAY = 3,
+        MODEM = 4,
+        NETWORKAPPLIANCE = 5,
+        NETWORKBRIDGE = 6,
+        NETWORKHUB = 7,
+        PRINTER = 8,
+        REPEATER = 9,
+        ROUTER = 10,
+        SCANNER = 11,
+        USERDEFINED = 12,
+        NOTDEFINED = 13,
+        ___unk = -1
+    };
+
+    enum class IfcComplexPropertyTemplateTypeEnum
+    {
+        P_COMPLEX = 0,
+        Q_COMPLEX = 1,
+        ___unk = -1
+    };
+
+    enum class IfcCompressorTypeEnum
+    {
+        DYNAMIC = 0,
+        RECIPROCATING = 1,
+        ROTARY = 2,
+        SCROLL = 3,
+        TROCHOIDAL = 4,
+        SINGLESTAGE = 5,
+        BOOSTER = 6,
+        OPENTYPE = 7,
+        HERMETIC = 8,
+        SEMIHERMETIC = 9,
+        WELDEDSHELLHERMETIC = 10,
+        ROLLINGPISTON = 11,
+        ROTARYVANE = 12,
+        SINGLESCREW = 13,
+        TWINSCREW = 14,
+        USERDEFINED = 15,
+        NOTDEFINED = 16,
+        ___unk = -1
+    };
+
+    enum class IfcCondenserTypeEnum
+    {
+        AIRCOOLED = 0,
+        EVAPORATIVECOOLED = 1,
+        WATERCOOLED = 2,
+        WATERCOOLEDBRAZEDPLATE = 3,
+        WATERCOOLEDSHELLCOIL = 4,
+        WATERCOOLEDSHELLTUBE = 5,
+        WATERCOOLEDTUBEINTUBE = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcConnectionTypeEnum
+    {
+        ATPATH = 0,
+        ATSTART = 1,
+        ATEND = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcConstraintEnum
+    {
+        HARD = 0,
+        SOFT = 1,
+        ADVISORY = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcConstructionEquipmentResourceTypeEnum
+    {
+        DEMOLISHING = 0,
+        EARTHMOVING = 1,
+        ERECTING = 2,
+        HEATING = 3,
+        LIGHTING = 4,
+        PAVING = 5,
+        PUMPING = 6,
+        TRANSPORTING = 7,
+        USERDEFINED = 8,
+        NOTDEFINED = 9,
+        ___unk = -1
+    };
+
+    enum class IfcConstructionMaterialResourceTypeEnum
+    {
+        AGGREGATES = 0,
+        CONCRETE = 1,
+        DRYWALL = 2,
+        FUEL = 3,
+        GYPSUM = 4,
+        MASONRY = 5,
+        METAL = 6,
+        PLASTIC = 7,
+        WOOD = 8,
+        NOTDEFINED = 9,
+        USERDEFINED = 10,
+        ___unk = -1
+    };
+
+    enum class IfcConstructionProductResourceTypeEnum
+    {
+        ASSEMBLY = 0,
+        FORMWORK = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcControllerTypeEnum
+    {
+        FLOATING = 0,
+        PROGRAMMABLE = 1,
+        PROPORTIONAL = 2,
+        MULTIPOSITION = 3,
+        TWOPOSITION = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcCooledBeamTypeEnum
+    {
+        ACTIVE = 0,
+        PASSIVE = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcCoolingTowerTypeEnum
+    {
+        NATURALDRAFT = 0,
+        MECHANICALINDUCEDDRAFT = 1,
+        MECHANICALFORCEDDRAFT = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcCostItemTypeEnum
+    {
+        USERDEFINED = 0,
+        NOTDEFINED = 1,
+        ___unk = -1
+    };
+
+    enum class IfcCostScheduleTypeEnum
+    {
+        BUDGET = 0,
+        COSTPLAN = 1,
+        ESTIMATE = 2,
+        TENDER = 3,
+        PRICEDBILLOFQUANTITIES = 4,
+        UNPRICEDBILLOFQUANTITIES = 5,
+        SCHEDULEOFRATES = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcCoveringTypeEnum
+    {
+        CEILING = 0,
+        FLOORING = 1,
+        CLADDING = 2,
+        ROOFING = 3,
+        MOLDING = 4,
+        SKIRTINGBOARD = 5,
+        INSULATION = 6,
+        MEMBRANE = 7,
+        SLEEVING = 8,
+        WRAPPING = 9,
+        USERDEFINED = 10,
+        NOTDEFINED = 11,
+        ___unk = -1
+    };
+
+    enum class IfcCrewResourceTypeEnum
+    {
+        OFFICE = 0,
+        SITE = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcCurtainWallTypeEnum
+    {
+        USERDEFINED = 0,
+        NOTDEFINED = 1,
+        ___unk = -1
+    };
+
+    enum class IfcCurveInterpolationEnum
+    {
+        LINEAR = 0,
+        LOG_LINEAR = 1,
+        LOG_LOG = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcDamperTypeEnum
+    {
+        BACKDRAFTDAMPER = 0,
+        BALANCINGDAMPER = 1,
+        BLASTDAMPER = 2,
+        CONTROLDAMPER = 3,
+        FIREDAMPER = 4,
+        FIRESMOKEDAMPER = 5,
+        FUMEHOODEXHAUST = 6,
+        GRAVITYDAMPER = 7,
+        GRAVITYRELIEFDAMPER = 8,
+        RELIEFDAMPER = 9,
+        SMOKEDAMPER = 10,
+        USERDEFINED = 11,
+        NOTDEFINED = 12,
+        ___unk = -1
+    };
+
+    enum class IfcDataOriginEnum
+    {
+        MEASURED = 0,
+        PREDICTED = 1,
+        SIMULATED = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcDerivedUnitEnum
+    {
+        ANGULARVELOCITYUNIT = 0,
+        AREADENSITYUNIT = 1,
+        COMPOUNDPLANEANGLEUNIT = 2,
+        DYNAMICVISCOSITYUNIT = 3,
+        HEATFLUXDENSITYUNIT = 4,
+        INTEGERCOUNTRATEUNIT = 5,
+        ISOTHERMALMOISTURECAPACITYUNIT = 6,
+        KINEMATICVISCOSITYUNIT = 7,
+        LINEARVELOCITYUNIT = 8,
+        MASSDENSITYUNIT = 9,
+        MASSFLOWRATEUNIT = 10,
+        MOISTUREDIFFUSIVITYUNIT = 11,
+        MOLECULARWEIGHTUNIT = 12,
+        SPECIFICHEATCAPACITYUNIT = 13,
+        THERMALADMITTANCEUNIT = 14,
+        THERMALCONDUCTANCEUNIT = 15,
+        THERMALRESISTANCEUNIT = 16,
+        THERMALTRANSMITTANCEUNIT = 17,
+        VAPORPERMEABILITYUNIT = 18,
+        VOLUMETRICFLOWRATEUNIT = 19,
+        ROTATIONALFREQUENCYUNIT = 20,
+        TORQUEUNIT = 21,
+        MOMENTOFINERTIAUNIT = 22,
+        LINEARMOMENTUNIT = 23,
+        LINEARFORCEUNIT = 24,
+        PLANARFORCEUNIT = 25,
+        MODULUSOFELASTICITYUNIT = 26,
+        SHEARMODULUSUNIT = 27,
+        LINEARSTIFFNESSUNIT = 28,
+        ROTATIONALSTIFFNESSUNIT = 29,
+        MODULUSOFSUBGRADEREACTIONUNIT = 30,
+        ACCELERATIONUNIT = 31,
+        CURVATUREUNIT = 32,
+        HEATINGVALUEUNIT = 33,
+        IONCONCENTRATIONUNIT = 34,
+        LUMINOUSINTENSITYDISTRIBUTIONUNIT = 35,
+        MASSPERLENGTHUNIT = 36,
+        MODULUSOFLINEARSUBGRADEREACTIONUNIT = 37,
+        MODULUSOFROTATIONALSUBGRADEREACTIONUNIT = 38,
+        PHUNIT = 39,
+        ROTATIONALMASSUNIT = 40,
+        SECTIONAREAINTEGRALUNIT = 41,
+        SECTIONMODULUSUNIT = 42,
+        SOUNDPOWERLEVELUNIT = 43,
+        SOUNDPOWERUNIT = 44,
+        SOUNDPRESSURELEVELUNIT = 45,
+        SOUNDPRESSUREUNIT = 46,
+        TEMPERATUREGRADIENTUNIT = 47,
+        TEMPERATURERATEOFCHANGEUNIT = 48,
+        THERMALEXPANSIONCOEFFICIENTUNIT = 49,
+        WARPINGCONSTANTUNIT = 50,
+        WARPINGMOMENTUNIT = 51,
+        USERDEFINED = 52,
+        ___unk = -1
+    };
+
+    enum class IfcDirectionSenseEnum
+    {
+        POSITIVE = 0,
+        NEGATIVE = 1,
+        ___unk = -1
+    };
+
+    enum class IfcDiscreteAccessoryTypeEnum
+    {
+        ANCHORPLATE = 0,
+        BRACKET = 1,
+        SHOE = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcDistributionChamberElementTypeEnum
+    {
+        FORMEDDUCT = 0,
+        INSPECTIONCHAMBER = 1,
+        INSPECTIONPIT = 2,
+        MANHOLE = 3,
+        METERCHAMBER = 4,
+        SUMP = 5,
+        TRENCH = 6,
+        VALVECHAMBER = 7,
+        USERDEFINED = 8,
+        NOTDEFINED = 9,
+        ___unk = -1
+    };
+
+    enum class IfcDistributionPortTypeEnum
+    {
+        CABLE = 0,
+        CABLECARRIER = 1,
+        DUCT = 2,
+        PIPE = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcDistributionSystemEnum
+    {
+        AIRCONDITIONING = 0,
+        AUDIOVISUAL = 1,
+        CHEMICAL = 2,
+        CHILLEDWATER = 3,
+        COMMUNICATION = 4,
+        COMPRESSEDAIR = 5,
+        CONDENSERWATER = 6,
+        CONTROL = 7,
+        CONVEYING = 8,
+        DATA = 9,
+        DISPOSAL = 10,
+        DOMESTICCOLDWATER = 11,
+        DOMESTICHOTWATER = 12,
+        DRAINAGE = 13,
+        EARTHING = 14,
+        ELECTRICAL = 15,
+        ELECTROACOUSTIC = 16,
+        EXHAUST = 17,
+        FIREPROTECTION = 18,
+        FUEL = 19,
+        GAS = 20,
+        HAZARDOUS = 21,
+        HEATING = 22,
+        LIGHTING = 23,
+        LIGHTNINGPROTECTION = 24,
+        MUNICIPALSOLIDWASTE = 25,
+        OIL = 26,
+        OPERATIONAL = 27,
+        POWERGENERATION = 28,
+        RAINWATER = 29,
+        REFRIGERATION = 30,
+        SECURITY = 31,
+        SEWAGE = 32,
+        SIGNAL = 33,
+        STORMWATER = 34,
+        TELEPHONE = 35,
+        TV = 36,
+        VACUUM = 37,
+        VENT = 38,
+        VENTILATION = 39,
+        WASTEWATER = 40,
+        WATERSUPPLY = 41,
+        USERDEFINED = 42,
+        NOTDEFINED = 43,
+        ___unk = -1
+    };
+
+    enum class IfcDocumentConfidentialityEnum
+    {
+        PUBLIC = 0,
+        RESTRICTED = 1,
+        CONFIDENTIAL = 2,
+        PERSONAL = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcDocumentStatusEnum
+    {
+        DRAFT = 0,
+        FINALDRAFT = 1,
+        FINAL = 2,
+        REVISION = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcDoorPanelOperationEnum
+    {
+        SWINGING = 0,
+        DOUBLE_ACTING = 1,
+        SLIDING = 2,
+        FOLDING = 3,
+        REVOLVING = 4,
+        ROLLINGUP = 5,
+        FIXEDPANEL = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcDoorPanelPositionEnum
+    {
+        LEFT = 0,
+        MIDDLE = 1,
+        RIGHT = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcDoorStyleConstructionEnum
+    {
+        ALUMINIUM = 0,
+        HIGH_GRADE_STEEL = 1,
+        STEEL = 2,
+        WOOD = 3,
+        ALUMINIUM_WOOD = 4,
+        ALUMINIUM_PLASTIC = 5,
+        PLASTIC = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcDoorStyleOperationEnum
+    {
+        SINGLE_SWING_LEFT = 0,
+        SINGLE_SWING_RIGHT = 1,
+        DOUBLE_DOOR_SINGLE_SWING = 2,
+        DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_LEFT = 3,
+        DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_RIGHT = 4,
+        DOUBLE_SWING_LEFT = 5,
+        DOUBLE_SWING_RIGHT = 6,
+        DOUBLE_DOOR_DOUBLE_SWING = 7,
+        SLIDING_TO_LEFT = 8,
+        SLIDING_TO_RIGHT = 9,
+        DOUBLE_DOOR_SLIDING = 10,
+        FOLDING_TO_LEFT = 11,
+        FOLDING_TO_RIGHT = 12,
+        DOUBLE_DOOR_FOLDING = 13,
+        REVOLVING = 14,
+        ROLLINGUP = 15,
+        USERDEFINED = 16,
+        NOTDEFINED = 17,
+        ___unk = -1
+    };
+
+    enum class IfcDoorTypeEnum
+    {
+        DOOR = 0,
+        GATE = 1,
+        TRAPDOOR = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcDoorTypeOperationEnum
+    {
+        SINGLE_SWING_LEFT = 0,
+        SINGLE_SWING_RIGHT = 1,
+        DOUBLE_DOOR_SINGLE_SWING = 2,
+        DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_LEFT = 3,
+        DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_RIGHT = 4,
+        DOUBLE_SWING_LEFT = 5,
+        DOUBLE_SWING_RIGHT = 6,
+        DOUBLE_DOOR_DOUBLE_SWING = 7,
+        SLIDING_TO_LEFT = 8,
+        SLIDING_TO_RIGHT = 9,
+        DOUBLE_DOOR_SLIDING = 10,
+        FOLDING_TO_LEFT = 11,
+        FOLDING_TO_RIGHT = 12,
+        DOUBLE_DOOR_FOLDING = 13,
+        REVOLVING = 14,
+        ROLLINGUP = 15,
+        SWING_FIXED_LEFT = 16,
+        SWING_FIXED_RIGHT = 17,
+        USERDEFINED = 18,
+        NOTDEFINED = 19,
+        ___unk = -1
+    };
+
+    enum class IfcDuctFittingTypeEnum
+    {
+        BEND = 0,
+        CONNECTOR = 1,
+        ENTRY = 2,
+        EXIT = 3,
+        JUNCTION = 4,
+        OBSTRUCTION = 5,
+        TRANSITION = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcDuctSegmentTypeEnum
+    {
+        RIGIDSEGMENT = 0,
+        FLEXIBLESEGMENT = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcDuctSilencerTypeEnum
+    {
+        FLATOVAL = 0,
+        RECTANGULAR = 1,
+        ROUND = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcElectricApplianceTypeEnum
+    {
+        DISHWASHER = 0,
+        ELECTRICCOOKER = 1,
+        FREESTANDINGELECTRICHEATER = 2,
+        FREESTANDINGFAN = 3,
+        FREESTANDINGWATERHEATER = 4,
+        FREESTANDINGWATERCOOLER = 5,
+        FREEZER = 6,
+        FRIDGE_FREEZER = 7,
+        HANDDRYER = 8,
+        KITCHENMACHINE = 9,
+        MICROWAVE = 10,
+        PHOTOCOPIER = 11,
+        REFRIGERATOR = 12,
+        TUMBLEDRYER = 13,
+        VENDINGMACHINE = 14,
+        WASHINGMACHINE = 15,
+        USERDEFINED = 16,
+        NOTDEFINED = 17,
+        ___unk = -1
+    };
+
+    enum class IfcElectricDistributionBoardTypeEnum
+    {
+        CONSUMERUNIT = 0,
+        DISTRIBUTIONBOARD = 1,
+        MOTORCONTROLCENTRE = 2,
+        SWITCHBOARD = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcElectricFlowStorageDeviceTypeEnum
+    {
+        BATTERY = 0,
+        CAPACITORBANK = 1,
+        HARMONICFILTER = 2,
+        INDUCTORBANK = 3,
+        UPS = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcElectricGeneratorTypeEnum
+    {
+        CHP = 0,
+        ENGINEGENERATOR = 1,
+        STANDALONE = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcElectricMotorTypeEnum
+    {
+        DC = 0,
+        INDUCTION = 1,
+        POLYPHASE = 2,
+        RELUCTANCESYNCHRONOUS = 3,
+        SYNCHRONOUS = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcElectricTimeControlTypeEnum
+    {
+        TIMECLOCK = 0,
+        TIMEDELAY = 1,
+        RELAY = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcElementAssemblyTypeEnum
+    {
+        ACCESSORY_ASSEMBLY = 0,
+        ARCH = 1,
+        BEAM_GRID = 2,
+        BRACED_FRAME = 3,
+        GIRDER = 4,
+        REINFORCEMENT_UNIT = 5,
+        RIGID_FRAME = 6,
+        SLAB_FIELD = 7,
+        TRUSS = 8,
+        USERDEFINED = 9,
+        NOTDEFINED = 10,
+        ___unk = -1
+    };
+
+    enum class IfcElementCompositionEnum
+    {
+        COMPLEX = 0,
+        ELEMENT = 1,
+        PARTIAL = 2,
+        ___unk = -1
+    };
+
+    enum class IfcEngineTypeEnum
+    {
+        EXTERNALCOMBUSTION = 0,
+        INTERNALCOMBUSTION = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcEvaporativeCoolerTypeEnum
+    {
+        DIRECTEVAPORATIVERANDOMMEDIAAIRCOOLER = 0,
+        DIRECTEVAPORATIVERIGIDMEDIAAIRCOOLER = 1,
+        DIRECTEVAPORATIVESLINGERSPACKAGEDAIRCOOLER = 2,
+        DIRECTEVAPORATIVEPACKAGEDROTARYAIRCOOLER = 3,
+        DIRECTEVAPORATIVEAIRWASHER = 4,
+        INDIRECTEVAPORATIVEPACKAGEAIRCOOLER = 5,
+        INDIRECTEVAPORATIVEWETCOIL = 6,
+        INDIRECTEVAPORATIVECOOLINGTOWERORCOILCOOLER = 7,
+        INDIRECTDIRECTCOMBINATION = 8,
+        USERDEFINED = 9,
+        NOTDEFINED = 10,
+        ___unk = -1
+    };
+
+    enum class IfcEvaporatorTypeEnum
+    {
+        DIRECTEXPANSION = 0,
+        DIRECTEXPANSIONSHELLANDTUBE = 1,
+        DIRECTEXPANSIONTUBEINTUBE = 2,
+        DIRECTEXPANSIONBRAZEDPLATE = 3,
+        FLOODEDSHELLANDTUBE = 4,
+        SHELLANDCOIL = 5,
+        USERDEFINED = 6,
+        NOTDEFINED = 7,
+        ___unk = -1
+    };
+
+    enum class IfcEventTriggerTypeEnum
+    {
+        EVENTRULE = 0,
+        EVENTMESSAGE = 1,
+        EVENTTIME = 2,
+        EVENTCOMPLEX = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcEventTypeEnum
+    {
+        STARTEVENT = 0,
+        ENDEVENT = 1,
+        INTERMEDIATEEVENT = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcExternalSpatialElementTypeEnum
+    {
+        EXTERNAL = 0,
+        EXTERNAL_EARTH = 1,
+        EXTERNAL_WATER = 2,
+        EXTERNAL_FIRE = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcFanTypeEnum
+    {
+        CENTRIFUGALFORWARDCURVED = 0,
+        CENTRIFUGALRADIAL = 1,
+        CENTRIFUGALBACKWARDINCLINEDCURVED = 2,
+        CENTRIFUGALAIRFOIL = 3,
+        TUBEAXIAL = 4,
+        VANEAXIAL = 5,
+        PROPELLORAXIAL = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcFastenerTypeEnum
+    {
+        GLUE = 0,
+        MORTAR = 1,
+        WELD = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcFilterTypeEnum
+    {
+        AIRPARTICLEFILTER = 0,
+        COMPRESSEDAIRFILTER = 1,
+        ODORFILTER = 2,
+        OILFILTER = 3,
+        STRAINER = 4,
+        WATERFILTER = 5,
+        USERDEFINED = 6,
+        NOTDEFINED = 7,
+        ___unk = -1
+    };
+
+    enum class IfcFireSuppressionTerminalTypeEnum
+    {
+        BREECHINGINLET = 0,
+        FIREHYDRANT = 1,
+        HOSEREEL = 2,
+        SPRINKLER = 3,
+        SPRINKLERDEFLECTOR = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcFlowDirectionEnum
+    {
+        SOURCE = 0,
+        SINK = 1,
+        SOURCEANDSINK = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcFlowInstrumentTypeEnum
+    {
+        PRESSUREGAUGE = 0,
+        THERMOMETER = 1,
+        AMMETER = 2,
+        FREQUENCYMETER = 3,
+        POWERFACTORMETER = 4,
+        PHASEANGLEMETER = 5,
+        VOLTMETER_PEAK = 6,
+        VOLTMETER_RMS = 7,
+        USERDEFINED = 8,
+        NOTDEFINED = 9,
+        ___unk = -1
+    };
+
+    enum class IfcFlowMeterTypeEnum
+    {
+        ENERGYMETER = 0,
+        GASMETER = 1,
+        OILMETER = 2,
+        WATERMETER = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcFootingTypeEnum
+    {
+        CAISSON_FOUNDATION = 0,
+        FOOTING_BEAM = 1,
+        PAD_FOOTING = 2,
+        PILE_CAP = 3,
+        STRIP_FOOTING = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcFurnitureTypeEnum
+    {
+        CHAIR = 0,
+        TABLE = 1,
+        DESK = 2,
+        BED = 3,
+        FILECABINET = 4,
+        SHELF = 5,
+        SOFA = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcGeographicElementTypeEnum
+    {
+        TERRAIN = 0,
+        USERDEFINED = 1,
+        NOTDEFINED = 2,
+        ___unk = -1
+    };
+
+    enum class IfcGeometricProjectionEnum
+    {
+        GRAPH_VIEW = 0,
+        SKETCH_VIEW = 1,
+        MODEL_VIEW = 2,
+        PLAN_VIEW = 3,
+        REFLECTED_PLAN_VIEW = 4,
+        SECTION_VIEW = 5,
+        ELEVATION_VIEW = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcGlobalOrLocalEnum
+    {
+        GLOBAL_COORDS = 0,
+        LOCAL_COORDS = 1,
+        ___unk = -1
+    };
+
+    enum class IfcGridTypeEnum
+    {
+        RECTANGULAR = 0,
+        RADIAL = 1,
+        TRIANGULAR = 2,
+        IRREGULAR = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcHeatExchangerTypeEnum
+    {
+        PLATE = 0,
+        SHELLANDTUBE = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcHumidifierTypeEnum
+    {
+        STEAMINJECTION = 0,
+        ADIABATICAIRWASHER = 1,
+        ADIABATICPAN = 2,
+        ADIABATICWETTEDELEMENT = 3,
+        ADIABATICATOMIZING = 4,
+        ADIABATICULTRASONIC = 5,
+        ADIABATICRIGIDMEDIA = 6,
+        ADIABATICCOMPRESSEDAIRNOZZLE = 7,
+        ASSISTEDELECTRIC = 8,
+        ASSISTEDNATURALGAS = 9,
+        ASSISTEDPROPANE = 10,
+        ASSISTEDBUTANE = 11,
+        ASSISTEDSTEAM = 12,
+        USERDEFINED = 13,
+        NOTDEFINED = 14,
+        ___unk = -1
+    };
+
+    enum class IfcInterceptorTypeEnum
+    {
+        CYCLONIC = 0,
+        GREASE = 1,
+        OIL = 2,
+        PETROL = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcInternalOrExternalEnum
+    {
+        INTERNAL = 0,
+        EXTERNAL = 1,
+        EXTERNAL_EARTH = 2,
+        EXTERNAL_WATER = 3,
+        EXTERNAL_FIRE = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcInventoryTypeEnum
+    {
+        ASSETINVENTORY = 0,
+        SPACEINVENTORY = 1,
+        FURNITUREINVENTORY = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcJunctionBoxTypeEnum
+    {
+        DATA = 0,
+        POWER = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcKnotType
+    {
+        UNIFORM_KNOTS = 0,
+        QUASI_UNIFORM_KNOTS = 1,
+        PIECEWISE_BEZIER_KNOTS = 2,
+        UNSPECIFIED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcLaborResourceTypeEnum
+    {
+        ADMINISTRATION = 0,
+        CARPENTRY = 1,
+        CLEANING = 2,
+        CONCRETE = 3,
+        DRYWALL = 4,
+        ELECTRIC = 5,
+        FINISHING = 6,
+        FLOORING = 7,
+        GENERAL = 8,
+        HVAC = 9,
+        LANDSCAPING = 10,
+        MASONRY = 11,
+        PAINTING = 12,
+        PAVING = 13,
+        PLUMBING = 14,
+        ROOFING = 15,
+        SITEGRADING = 16,
+        STEELWORK = 17,
+        SURVEYING = 18,
+        USERDEFINED = 19,
+        NOTDEFINED = 20,
+        ___unk = -1
+    };
+
+    enum class IfcLampTypeEnum
+    {
+        COMPACTFLUORESCENT = 0,
+        FLUORESCENT = 1,
+        HALOGEN = 2,
+        HIGHPRESSUREMERCURY = 3,
+        HIGHPRESSURESODIUM = 4,
+        LED = 5,
+        METALHALIDE = 6,
+        OLED = 7,
+        TUNGSTENFILAMENT = 8,
+        USERDEFINED = 9,
+        NOTDEFINED = 10,
+        ___unk = -1
+    };
+
+    enum class IfcLayerSetDirectionEnum
+    {
+        AXIS1 = 0,
+        AXIS2 = 1,
+        AXIS3 = 2,
+        ___unk = -1
+    };
+
+    enum class IfcLightDistributionCurveEnum
+    {
+        TYPE_A = 0,
+        TYPE_B = 1,
+        TYPE_C = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcLightEmissionSourceEnum
+    {
+        COMPACTFLUORESCENT = 0,
+        FLUORESCENT = 1,
+        HIGHPRESSUREMERCURY = 2,
+        HIGHPRESSURESODIUM = 3,
+        LIGHTEMITTINGDIODE = 4,
+        LOWPRESSURESODIUM = 5,
+        LOWVOLTAGEHALOGEN = 6,
+        MAINVOLTAGEHALOGEN = 7,
+        METALHALIDE = 8,
+        TUNGSTENFILAMENT = 9,
+        NOTDEFINED = 10,
+        ___unk = -1
+    };
+
+    enum class IfcLightFixtureTypeEnum
+    {
+        POINTSOURCE = 0,
+        DIRECTIONSOURCE = 1,
+        SECURITYLIGHTING = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcLoadGroupTypeEnum
+    {
+        LOAD_GROUP = 0,
+        LOAD_CASE = 1,
+        LOAD_COMBINATION = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcLogicalOperatorEnum
+    {
+        LOGICALAND = 0,
+        LOGICALOR = 1,
+        LOGICALXOR = 2,
+        LOGICALNOTAND = 3,
+        LOGICALNOTOR = 4,
+        ___unk = -1
+    };
+
+    enum class IfcMechanicalFastenerTypeEnum
+    {
+        ANCHORBOLT = 0,
+        BOLT = 1,
+        DOWEL = 2,
+        NAIL = 3,
+        NAILPLATE = 4,
+        RIVET = 5,
+        SCREW = 6,
+        SHEARCONNECTOR = 7,
+        STAPLE = 8,
+        STUDSHEARCONNECTOR = 9,
+        USERDEFINED = 10,
+        NOTDEFINED = 11,
+        ___unk = -1
+    };
+
+    enum class IfcMedicalDeviceTypeEnum
+    {
+        AIRSTATION = 0,
+        FEEDAIRUNIT = 1,
+        OXYGENGENERATOR = 2,
+        OXYGENPLANT = 3,
+        VACUUMSTATION = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcMemberTypeEnum
+    {
+        BRACE = 0,
+        CHORD = 1,
+        COLLAR = 2,
+        MEMBER = 3,
+        MULLION = 4,
+        PLATE = 5,
+        POST = 6,
+        PURLIN = 7,
+        RAFTER = 8,
+        STRINGER = 9,
+        STRUT = 10,
+        STUD = 11,
+        USERDEFINED = 12,
+        NOTDEFINED = 13,
+        ___unk = -1
+    };
+
+    enum class IfcMotorConnectionTypeEnum
+    {
+        BELTDRIVE = 0,
+        COUPLING = 1,
+        DIRECTDRIVE = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcNullStyle
+    {
+        NULL_ = 0,
+        ___unk = -1
+    };
+
+    enum class IfcObjectiveEnum
+    {
+        CODECOMPLIANCE = 0,
+        CODEWAIVER = 1,
+        DESIGNINTENT = 2,
+        EXTERNAL = 3,
+        HEALTHANDSAFETY = 4,
+        MERGECONFLICT = 5,
+        MODELVIEW = 6,
+        PARAMETER = 7,
+        REQUIREMENT = 8,
+        SPECIFICATION = 9,
+        TRIGGERCONDITION = 10,
+        USERDEFINED = 11,
+        NOTDEFINED = 12,
+        ___unk = -1
+    };
+
+    enum class IfcObjectTypeEnum
+    {
+        PRODUCT = 0,
+        PROCESS = 1,
+        CONTROL = 2,
+        RESOURCE = 3,
+        ACTOR = 4,
+        GROUP = 5,
+        PROJECT = 6,
+        NOTDEFINED = 7,
+        ___unk = -1
+    };
+
+    enum class IfcOccupantTypeEnum
+    {
+        ASSIGNEE = 0,
+        ASSIGNOR = 1,
+        LESSEE = 2,
+        LESSOR = 3,
+        LETTINGAGENT = 4,
+        OWNER = 5,
+        TENANT = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcOpeningElementTypeEnum
+    {
+        OPENING = 0,
+        RECESS = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcOutletTypeEnum
+    {
+        AUDIOVISUALOUTLET = 0,
+        COMMUNICATIONSOUTLET = 1,
+        POWEROUTLET = 2,
+        DATAOUTLET = 3,
+        TELEPHONEOUTLET = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcPerformanceHistoryTypeEnum
+    {
+        USERDEFINED = 0,
+        NOTDEFINED = 1,
+        ___unk = -1
+    };
+
+    enum class IfcPermeableCoveringOperationEnum
+    {
+        GRILL = 0,
+        LOUVER = 1,
+        SCREEN = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcPermitTypeEnum
+    {
+        ACCESS = 0,
+        BUILDING = 1,
+        WORK = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcPhysicalOrVirtualEnum
+    {
+        PHYSICAL = 0,
+        VIRTUAL = 1,
+        NOTDEFINED = 2,
+        ___unk = -1
+    };
+
+    enum class IfcPileConstructionEnum
+    {
+        CAST_IN_PLACE = 0,
+        COMPOSITE = 1,
+        PRECAST_CONCRETE = 2,
+        PREFAB_STEEL = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcPileTypeEnum
+    {
+        BORED = 0,
+        DRIVEN = 1,
+        JETGROUTING = 2,
+        COHESION = 3,
+        FRICTION = 4,
+        SUPPORT = 5,
+        USERDEFINED = 6,
+        NOTDEFINED = 7,
+        ___unk = -1
+    };
+
+    enum class IfcPipeFittingTypeEnum
+    {
+        BEND = 0,
+        CONNECTOR = 1,
+        ENTRY = 2,
+        EXIT = 3,
+        JUNCTION = 4,
+        OBSTRUCTION = 5,
+        TRANSITION = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcPipeSegmentTypeEnum
+    {
+        CULVERT = 0,
+        FLEXIBLESEGMENT = 1,
+        RIGIDSEGMENT = 2,
+        GUTTER = 3,
+        SPOOL = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcPlateTypeEnum
+    {
+        CURTAIN_PANEL = 0,
+        SHEET = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcPreferredSurfaceCurveRepresentation
+    {
+        CURVE3D = 0,
+        PCURVE_S1 = 1,
+        PCURVE_S2 = 2,
+        ___unk = -1
+    };
+
+    enum class IfcProcedureTypeEnum
+    {
+        ADVICE_CAUTION = 0,
+        ADVICE_NOTE = 1,
+        ADVICE_WARNING = 2,
+        CALIBRATION = 3,
+        DIAGNOSTIC = 4,
+        SHUTDOWN = 5,
+        STARTUP = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcProfileTypeEnum
+    {
+        CURVE = 0,
+        AREA = 1,
+        ___unk = -1
+    };
+
+    enum class IfcProjectedOrTrueLengthEnum
+    {
+        PROJECTED_LENGTH = 0,
+        TRUE_LENGTH = 1,
+        ___unk = -1
+    };
+
+    enum class IfcProjectionElementTypeEnum
+    {
+        USERDEFINED = 0,
+        NOTDEFINED = 1,
+        ___unk = -1
+    };
+
+    enum class IfcProjectOrderTypeEnum
+    {
+        CHANGEORDER = 0,
+        MAINTENANCEWORKORDER = 1,
+        MOVEORDER = 2,
+        PURCHASEORDER = 3,
+        WORKORDER = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcPropertySetTemplateTypeEnum
+    {
+        PSET_TYPEDRIVENONLY = 0,
+        PSET_TYPEDRIVENOVERRIDE = 1,
+        PSET_OCCURRENCEDRIVEN = 2,
+        PSET_PERFORMANCEDRIVEN = 3,
+        QTO_TYPEDRIVENONLY = 4,
+        QTO_TYPEDRIVENOVERRIDE = 5,
+        QTO_OCCURRENCEDRIVEN = 6,
+        NOTDEFINED = 7,
+        ___unk = -1
+    };
+
+    enum class IfcProtectiveDeviceTrippingUnitTypeEnum
+    {
+        ELECTRONIC = 0,
+        ELECTROMAGNETIC = 1,
+        RESIDUALCURRENT = 2,
+        THERMAL = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcProtectiveDeviceTypeEnum
+    {
+        CIRCUITBREAKER = 0,
+        EARTHLEAKAGECIRCUITBREAKER = 1,
+        EARTHINGSWITCH = 2,
+        FUSEDISCONNECTOR = 3,
+        RESIDUALCURRENTCIRCUITBREAKER = 4,
+        RESIDUALCURRENTSWITCH = 5,
+        VARISTOR = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcPumpTypeEnum
+    {
+        CIRCULATOR = 0,
+        ENDSUCTION = 1,
+        SPLITCASE = 2,
+        SUBMERSIBLEPUMP = 3,
+        SUMPPUMP = 4,
+        VERTICALINLINE = 5,
+        VERTICALTURBINE = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcRailingTypeEnum
+    {
+        HANDRAIL = 0,
+        GUARDRAIL = 1,
+        BALUSTRADE = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcRampFlightTypeEnum
+    {
+        STRAIGHT = 0,
+        SPIRAL = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcRampTypeEnum
+    {
+        STRAIGHT_RUN_RAMP = 0,
+        TWO_STRAIGHT_RUN_RAMP = 1,
+        QUARTER_TURN_RAMP = 2,
+        TWO_QUARTER_TURN_RAMP = 3,
+        HALF_TURN_RAMP = 4,
+        SPIRAL_RAMP = 5,
+        USERDEFINED = 6,
+        NOTDEFINED = 7,
+        ___unk = -1
+    };
+
+    enum class IfcRecurrenceTypeEnum
+    {
+        DAILY = 0,
+        WEEKLY = 1,
+        MONTHLY_BY_DAY_OF_MONTH = 2,
+        MONTHLY_BY_POSITION = 3,
+        BY_DAY_COUNT = 4,
+        BY_WEEKDAY_COUNT = 5,
+        YEARLY_BY_DAY_OF_MONTH = 6,
+        YEARLY_BY_POSITION = 7,
+        ___unk = -1
+    };
+
+    enum class IfcReflectanceMethodEnum
+    {
+        BLINN = 0,
+        FLAT = 1,
+        GLASS = 2,
+        MATT = 3,
+        METAL = 4,
+        MIRROR = 5,
+        PHONG = 6,
+        PLASTIC = 7,
+        STRAUSS = 8,
+        NOTDEFINED = 9,
+        ___unk = -1
+    };
+
+    enum class IfcReinforcingBarRoleEnum
+    {
+        MAIN = 0,
+        SHEAR = 1,
+        LIGATURE = 2,
+        STUD = 3,
+        PUNCHING = 4,
+        EDGE = 5,
+        RING = 6,
+        ANCHORING = 7,
+        USERDEFINED = 8,
+        NOTDEFINED = 9,
+        ___unk = -1
+    };
+
+    enum class IfcReinforcingBarSurfaceEnum
+    {
+        PLAIN = 0,
+        TEXTURED = 1,
+        ___unk = -1
+    };
+
+    enum class IfcReinforcingBarTypeEnum
+    {
+        ANCHORING = 0,
+        EDGE = 1,
+        LIGATURE = 2,
+        MAIN = 3,
+        PUNCHING = 4,
+        RING = 5,
+        SHEAR = 6,
+        STUD = 7,
+        USERDEFINED = 8,
+        NOTDEFINED = 9,
+        ___unk = -1
+    };
+
+    enum class IfcReinforcingMeshTypeEnum
+    {
+        USERDEFINED = 0,
+        NOTDEFINED = 1,
+        ___unk = -1
+    };
+
+    enum class IfcRoleEnum
+    {
+        SUPPLIER = 0,
+        MANUFACTURER = 1,
+        CONTRACTOR = 2,
+        SUBCONTRACTOR = 3,
+        ARCHITECT = 4,
+        STRUCTURALENGINEER = 5,
+        COSTENGINEER = 6,
+        CLIENT = 7,
+        BUILDINGOWNER = 8,
+        BUILDINGOPERATOR = 9,
+        MECHANICALENGINEER = 10,
+        ELECTRICALENGINEER = 11,
+        PROJECTMANAGER = 12,
+        FACILITIESMANAGER = 13,
+        CIVILENGINEER = 14,
+        COMMISSIONINGENGINEER = 15,
+        ENGINEER = 16,
+        OWNER = 17,
+        CONSULTANT = 18,
+        CONSTRUCTIONMANAGER = 19,
+        FIELDCONSTRUCTIONMANAGER = 20,
+        RESELLER = 21,
+        USERDEFINED = 22,
+        ___unk = -1
+    };
+
+    enum class IfcRoofTypeEnum
+    {
+        FLAT_ROOF = 0,
+        SHED_ROOF = 1,
+        GABLE_ROOF = 2,
+        HIP_ROOF = 3,
+        HIPPED_GABLE_ROOF = 4,
+        GAMBREL_ROOF = 5,
+        MANSARD_ROOF = 6,
+        BARREL_ROOF = 7,
+        RAINBOW_ROOF = 8,
+        BUTTERFLY_ROOF = 9,
+        PAVILION_ROOF = 10,
+        DOME_ROOF = 11,
+        FREEFORM = 12,
+        USERDEFINED = 13,
+        NOTDEFINED = 14,
+        ___unk = -1
+    };
+
+    enum class IfcSanitaryTerminalTypeEnum
+    {
+        BATH = 0,
+        BIDET = 1,
+        CISTERN = 2,
+        SHOWER = 3,
+        SINK = 4,
+        SANITARYFOUNTAIN = 5,
+        TOILETPAN = 6,
+        URINAL = 7,
+        WASHHANDBASIN = 8,
+        WCSEAT = 9,
+        USERDEFINED = 10,
+        NOTDEFINED = 11,
+        ___unk = -1
+    };
+
+    enum class IfcSectionTypeEnum
+    {
+        UNIFORM = 0,
+        TAPERED = 1,
+        ___unk = -1
+    };
+
+    enum class IfcSensorTypeEnum
+    {
+        COSENSOR = 0,
+        CO2SENSOR = 1,
+        CONDUCTANCESENSOR = 2,
+        CONTACTSENSOR = 3,
+        FIRESENSOR = 4,
+        FLOWSENSOR = 5,
+        FROSTSENSOR = 6,
+        GASSENSOR = 7,
+        HEATSENSOR = 8,
+        HUMIDITYSENSOR = 9,
+        IDENTIFIERSENSOR = 10,
+        IONCONCENTRATIONSENSOR = 11,
+        LEVELSENSOR = 12,
+        LIGHTSENSOR = 13,
+        MOISTURESENSOR = 14,
+        MOVEMENTSENSOR = 15,
+        PHSENSOR = 16,
+        PRESSURESENSOR = 17,
+        RADIATIONSENSOR = 18,
+        RADIOACTIVITYSENSOR = 19,
+        SMOKESENSOR = 20,
+        SOUNDSENSOR = 21,
+        TEMPERATURESENSOR = 22,
+        WINDSENSOR = 23,
+        USERDEFINED = 24,
+        NOTDEFINED = 25,
+        ___unk = -1
+    };
+
+    enum class IfcSequenceEnum
+    {
+        START_START = 0,
+        START_FINISH = 1,
+        FINISH_START = 2,
+        FINISH_FINISH = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcShadingDeviceTypeEnum
+    {
+        JALOUSIE = 0,
+        SHUTTER = 1,
+        AWNING = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcSimplePropertyTemplateTypeEnum
+    {
+        P_SINGLEVALUE = 0,
+        P_ENUMERATEDVALUE = 1,
+        P_BOUNDEDVALUE = 2,
+        P_LISTVALUE = 3,
+        P_TABLEVALUE = 4,
+        P_REFERENCEVALUE = 5,
+        Q_LENGTH = 6,
+        Q_AREA = 7,
+        Q_VOLUME = 8,
+        Q_COUNT = 9,
+        Q_WEIGHT = 10,
+        Q_TIME = 11,
+        ___unk = -1
+    };
+
+    enum class IfcSIPrefix
+    {
+        EXA = 0,
+        PETA = 1,
+        TERA = 2,
+        GIGA = 3,
+        MEGA = 4,
+        KILO = 5,
+        HECTO = 6,
+        DECA = 7,
+        DECI = 8,
+        CENTI = 9,
+        MILLI = 10,
+        MICRO = 11,
+        NANO = 12,
+        PICO = 13,
+        FEMTO = 14,
+        ATTO = 15,
+        ___unk = -1
+    };
+
+    enum class IfcSIUnitName
+    {
+        AMPERE = 0,
+        BECQUEREL = 1,
+        CANDELA = 2,
+        COULOMB = 3,
+        CUBIC_METRE = 4,
+        DEGREE_CELSIUS = 5,
+        FARAD = 6,
+        GRAM = 7,
+        GRAY = 8,
+        HENRY = 9,
+        HERTZ = 10,
+        JOULE = 11,
+        KELVIN = 12,
+        LUMEN = 13,
+        LUX = 14,
+        METRE = 15,
+        MOLE = 16,
+        NEWTON = 17,
+        OHM = 18,
+        PASCAL = 19,
+        RADIAN = 20,
+        SECOND = 21,
+        SIEMENS = 22,
+        SIEVERT = 23,
+        SQUARE_METRE = 24,
+        STERADIAN = 25,
+        TESLA = 26,
+        VOLT = 27,
+        WATT = 28,
+        WEBER = 29,
+        ___unk = -1
+    };
+
+    enum class IfcSlabTypeEnum
+    {
+        FLOOR = 0,
+        ROOF = 1,
+        LANDING = 2,
+        BASESLAB = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcSolarDeviceTypeEnum
+    {
+        SOLARCOLLECTOR = 0,
+        SOLARPANEL = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcSpaceHeaterTypeEnum
+    {
+        CONVECTOR = 0,
+        RADIATOR = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcSpaceTypeEnum
+    {
+        SPACE = 0,
+        PARKING = 1,
+        GFA = 2,
+        INTERNAL = 3,
+        EXTERNAL = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcSpatialZoneTypeEnum
+    {
+        CONSTRUCTION = 0,
+        FIRESAFETY = 1,
+        LIGHTING = 2,
+        OCCUPANCY = 3,
+        SECURITY = 4,
+        THERMAL = 5,
+        TRANSPORT = 6,
+        VENTILATION = 7,
+        USERDEFINED = 8,
+        NOTDEFINED = 9,
+        ___unk = -1
+    };
+
+    enum class IfcStackTerminalTypeEnum
+    {
+        BIRDCAGE = 0,
+        COWL = 1,
+        RAINWATERHOPPER = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcStairFlightTypeEnum
+    {
+        STRAIGHT = 0,
+        WINDER = 1,
+        SPIRAL = 2,
+        CURVED = 3,
+        FREEFORM = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcStairTypeEnum
+    {
+        STRAIGHT_RUN_STAIR = 0,
+        TWO_STRAIGHT_RUN_STAIR = 1,
+        QUARTER_WINDING_STAIR = 2,
+        QUARTER_TURN_STAIR = 3,
+        HALF_WINDING_STAIR = 4,
+        HALF_TURN_STAIR = 5,
+        TWO_QUARTER_WINDING_STAIR = 6,
+        TWO_QUARTER_TURN_STAIR = 7,
+        THREE_QUARTER_WINDING_STAIR = 8,
+        THREE_QUARTER_TURN_STAIR = 9,
+        SPIRAL_STAIR = 10,
+        DOUBLE_RETURN_STAIR = 11,
+        CURVED_RUN_STAIR = 12,
+        TWO_CURVED_RUN_STAIR = 13,
+        USERDEFINED = 14,
+        NOTDEFINED = 15,
+        ___unk = -1
+    };
+
+    enum class IfcStateEnum
+    {
+        READWRITE = 0,
+        READONLY = 1,
+        LOCKED = 2,
+        READWRITELOCKED = 3,
+        READONLYLOCKED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcStructuralCurveActivityTypeEnum
+    {
+        CONST_ = 0,
+        LINEAR = 1,
+        POLYGONAL = 2,
+        EQUIDISTANT = 3,
+        SINUS = 4,
+        PARABOLA = 5,
+        DISCRETE = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcStructuralCurveMemberTypeEnum
+    {
+        RIGID_JOINED_MEMBER = 0,
+        PIN_JOINED_MEMBER = 1,
+        CABLE = 2,
+        TENSION_MEMBER = 3,
+        COMPRESSION_MEMBER = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcStructuralSurfaceActivityTypeEnum
+    {
+        CONST_ = 0,
+        BILINEAR = 1,
+        DISCRETE = 2,
+        ISOCONTOUR = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcStructuralSurfaceMemberTypeEnum
+    {
+        BENDING_ELEMENT = 0,
+        MEMBRANE_ELEMENT = 1,
+        SHELL = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcSubContractResourceTypeEnum
+    {
+        PURCHASE = 0,
+        WORK = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcSurfaceFeatureTypeEnum
+    {
+        MARK = 0,
+        TAG = 1,
+        TREATMENT = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcSurfaceSide
+    {
+        POSITIVE = 0,
+        NEGATIVE = 1,
+        BOTH = 2,
+        ___unk = -1
+    };
+
+    enum class IfcSwitchingDeviceTypeEnum
+    {
+        CONTACTOR = 0,
+        DIMMERSWITCH = 1,
+        EMERGENCYSTOP = 2,
+        KEYPAD = 3,
+        MOMENTARYSWITCH = 4,
+        SELECTORSWITCH = 5,
+        STARTER = 6,
+        SWITCHDISCONNECTOR = 7,
+        TOGGLESWITCH = 8,
+        USERDEFINED = 9,
+        NOTDEFINED = 10,
+        ___unk = -1
+    };
+
+    enum class IfcSystemFurnitureElementTypeEnum
+    {
+        PANEL = 0,
+        WORKSURFACE = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcTankTypeEnum
+    {
+        BASIN = 0,
+        BREAKPRESSURE = 1,
+        EXPANSION = 2,
+        FEEDANDEXPANSION = 3,
+        PRESSUREVESSEL = 4,
+        STORAGE = 5,
+        VESSEL = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcTaskDurationEnum
+    {
+        ELAPSEDTIME = 0,
+        WORKTIME = 1,
+        NOTDEFINED = 2,
+        ___unk = -1
+    };
+
+    enum class IfcTaskTypeEnum
+    {
+        ATTENDANCE = 0,
+        CONSTRUCTION = 1,
+        DEMOLITION = 2,
+        DISMANTLE = 3,
+        DISPOSAL = 4,
+        INSTALLATION = 5,
+        LOGISTIC = 6,
+        MAINTENANCE = 7,
+        MOVE = 8,
+        OPERATION = 9,
+        REMOVAL = 10,
+        RENOVATION = 11,
+        USERDEFINED = 12,
+        NOTDEFINED = 13,
+        ___unk = -1
+    };
+
+    enum class IfcTendonAnchorTypeEnum
+    {
+        COUPLER = 0,
+        FIXED_END = 1,
+        TENSIONING_END = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcTendonTypeEnum
+    {
+        BAR = 0,
+        COATED = 1,
+        STRAND = 2,
+        WIRE = 3,
+        USERDEFINED = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcTextPath
+    {
+        LEFT = 0,
+        RIGHT = 1,
+        UP = 2,
+        DOWN = 3,
+        ___unk = -1
+    };
+
+    enum class IfcTimeSeriesDataTypeEnum
+    {
+        CONTINUOUS = 0,
+        DISCRETE = 1,
+        DISCRETEBINARY = 2,
+        PIECEWISEBINARY = 3,
+        PIECEWISECONSTANT = 4,
+        PIECEWISECONTINUOUS = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcTransformerTypeEnum
+    {
+        CURRENT = 0,
+        FREQUENCY = 1,
+        INVERTER = 2,
+        RECTIFIER = 3,
+        VOLTAGE = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcTransitionCode
+    {
+        DISCONTINUOUS = 0,
+        CONTINUOUS = 1,
+        CONTSAMEGRADIENT = 2,
+        CONTSAMEGRADIENTSAMECURVATURE = 3,
+        ___unk = -1
+    };
+
+    enum class IfcTransportElementTypeEnum
+    {
+        ELEVATOR = 0,
+        ESCALATOR = 1,
+        MOVINGWALKWAY = 2,
+        CRANEWAY = 3,
+        LIFTINGGEAR = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcTrimmingPreference
+    {
+        CARTESIAN = 0,
+        PARAMETER = 1,
+        UNSPECIFIED = 2,
+        ___unk = -1
+    };
+
+    enum class IfcTubeBundleTypeEnum
+    {
+        FINNED = 0,
+        USERDEFINED = 1,
+        NOTDEFINED = 2,
+        ___unk = -1
+    };
+
+    enum class IfcUnitaryControlElementTypeEnum
+    {
+        ALARMPANEL = 0,
+        CONTROLPANEL = 1,
+        GASDETECTIONPANEL = 2,
+        INDICATORPANEL = 3,
+        MIMICPANEL = 4,
+        HUMIDISTAT = 5,
+        THERMOSTAT = 6,
+        WEATHERSTATION = 7,
+        USERDEFINED = 8,
+        NOTDEFINED = 9,
+        ___unk = -1
+    };
+
+    enum class IfcUnitaryEquipmentTypeEnum
+    {
+        AIRHANDLER = 0,
+        AIRCONDITIONINGUNIT = 1,
+        DEHUMIDIFIER = 2,
+        SPLITSYSTEM = 3,
+        ROOFTOPUNIT = 4,
+        USERDEFINED = 5,
+        NOTDEFINED = 6,
+        ___unk = -1
+    };
+
+    enum class IfcUnitEnum
+    {
+        ABSORBEDDOSEUNIT = 0,
+        AMOUNTOFSUBSTANCEUNIT = 1,
+        AREAUNIT = 2,
+        DOSEEQUIVALENTUNIT = 3,
+        ELECTRICCAPACITANCEUNIT = 4,
+        ELECTRICCHARGEUNIT = 5,
+        ELECTRICCONDUCTANCEUNIT = 6,
+        ELECTRICCURRENTUNIT = 7,
+        ELECTRICRESISTANCEUNIT = 8,
+        ELECTRICVOLTAGEUNIT = 9,
+        ENERGYUNIT = 10,
+        FORCEUNIT = 11,
+        FREQUENCYUNIT = 12,
+        ILLUMINANCEUNIT = 13,
+        INDUCTANCEUNIT = 14,
+        LENGTHUNIT = 15,
+        LUMINOUSFLUXUNIT = 16,
+        LUMINOUSINTENSITYUNIT = 17,
+        MAGNETICFLUXDENSITYUNIT = 18,
+        MAGNETICFLUXUNIT = 19,
+        MASSUNIT = 20,
+        PLANEANGLEUNIT = 21,
+        POWERUNIT = 22,
+        PRESSUREUNIT = 23,
+        RADIOACTIVITYUNIT = 24,
+        SOLIDANGLEUNIT = 25,
+        THERMODYNAMICTEMPERATUREUNIT = 26,
+        TIMEUNIT = 27,
+        VOLUMEUNIT = 28,
+        USERDEFINED = 29,
+        ___unk = -1
+    };
+
+    enum class IfcValveTypeEnum
+    {
+        AIRRELEASE = 0,
+        ANTIVACUUM = 1,
+        CHANGEOVER = 2,
+        CHECK = 3,
+        COMMISSIONING = 4,
+        DIVERTING = 5,
+        DRAWOFFCOCK = 6,
+        DOUBLECHECK = 7,
+        DOUBLEREGULATING = 8,
+        FAUCET = 9,
+        FLUSHING = 10,
+        GASCOCK = 11,
+        GASTAP = 12,
+        ISOLATING = 13,
+        MIXING = 14,
+        PRESSUREREDUCING = 15,
+        PRESSURERELIEF = 16,
+        REGULATING = 17,
+        SAFETYCUTOFF = 18,
+        STEAMTRAP = 19,
+        STOPCOCK = 20,
+        USERDEFINED = 21,
+        NOTDEFINED = 22,
+        ___unk = -1
+    };
+
+    enum class IfcVibrationIsolatorTypeEnum
+    {
+        COMPRESSION = 0,
+        SPRING = 1,
+        USERDEFINED = 2,
+        NOTDEFINED = 3,
+        ___unk = -1
+    };
+
+    enum class IfcVoidingFeatureTypeEnum
+    {
+        CUTOUT = 0,
+        NOTCH = 1,
+        HOLE = 2,
+        MITER = 3,
+        CHAMFER = 4,
+        EDGE = 5,
+        USERDEFINED = 6,
+        NOTDEFINED = 7,
+        ___unk = -1
+    };
+
+    enum class IfcWallTypeEnum
+    {
+        MOVABLE = 0,
+        PARAPET = 1,
+        PARTITIONING = 2,
+        PLUMBINGWALL = 3,
+        SHEAR = 4,
+        SOLIDWALL = 5,
+        STANDARD = 6,
+        POLYGONAL = 7,
+        ELEMENTEDWALL = 8,
+        USERDEFINED = 9,
+        NOTDEFINED = 10,
+        ___unk = -1
+    };
+
+    enum class IfcWasteTerminalTypeEnum
+    {
+        FLOORTRAP = 0,
+        FLOORWASTE = 1,
+        GULLYSUMP = 2,
+        GULLYTRAP = 3,
+        ROOFDRAIN = 4,
+        WASTEDISPOSALUNIT = 5,
+        WASTETRAP = 6,
+        USERDEFINED = 7,
+        NOTDEFINED = 8,
+        ___unk = -1
+    };
+
+    enum class IfcWindowPanelOperationEnum
+    {
+        SIDEHUNGRIGHTHAND = 0,
+        SIDEHUNGLEFTHAND = 1,
+        TILTANDTURNRIGHTHAND = 2,
+        TILTANDTURNLEFTHAND = 3,
+        TOPHUNG = 4,
+        BOTTOMHUNG = 5,
+        PIVOTHORIZONTAL = 6,
+        PIVOTVERTICAL = 7,
+        SLIDINGHORIZONTAL = 8,
+        SLIDINGVERTICAL = 9,
+        REMOVABLECASEMENT = 10,
+        FIXEDCASEMENT = 11,
+        OTHEROPERATION = 12,
+        NOTDEFINED = 13,
+        ___unk = -1
+    };
+
+    enum class IfcWindowPanelPositionEnum
+    {
+        LEFT = 0,
+        MIDDLE = 1,
+        RIGHT = 2,
+        BOTTOM = 3,
+        TOP = 4,
+        NOTDEFINED = 5,
+        ___unk = -1
+    };
+
+    enum class IfcWindowStyleConstructionEnum
+    {
+        ALUMINIUM = 0,
+        HIGH_GRADE_STEEL = 1,
+        STEEL = 2,
+        WOOD = 3,
+        ALUMINIUM_WOOD = 4,
+        PLASTIC = 5,
+        OTHER_CONSTRUCTION = 6,
+        NOTDEFINED = 7,
+        ___unk = -1
+    };
+
+    enum class IfcWindowStyleOperationEnum
+    {
+        SINGLE_PANEL = 0,
+        DOUBLE_PANEL_VERTICAL = 1,
+        DOUBLE_PANEL_HORIZONTAL = 2,
+        TRIPLE_PANEL_VERTICAL = 3,
+        TRIPLE_PANEL_BOTTOM = 4,
+        TRIPLE_PANEL_TOP = 5,
+        TRIPLE_PANEL_LEFT = 6,
+        TRIPLE_PANEL_RIGHT = 7,
+        TRIPLE_PANEL_HORIZONTAL = 8,
+        USERDEFINED = 9,
+        NOTDEFINED = 10,
+        ___unk = -1
+    };
+
+    enum class IfcWindowTypeEnum
+    {
+        WINDOW = 0,
+        SKYLIGHT = 1,
+        LIGHTDOME = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcWindowTypePartitioningEnum
+    {
+        SINGLE_PANEL = 0,
+        DOUBLE_PANEL_VERTICAL = 1,
+        DOUBLE_PANEL_HORIZONTAL = 2,
+        TRIPLE_PANEL_VERTICAL = 3,
+        TRIPLE_PANEL_BOTTOM = 4,
+        TRIPLE_PANEL_TOP = 5,
+        TRIPLE_PANEL_LEFT = 6,
+        TRIPLE_PANEL_RIGHT = 7,
+        TRIPLE_PANEL_HORIZONTAL = 8,
+        USERDEFINED = 9,
+        NOTDEFINED = 10,
+        ___unk = -1
+    };
+
+    enum class IfcWorkCalendarTypeEnum
+    {
+        FIRSTSHIFT = 0,
+        SECONDSHIFT = 1,
+        THIRDSHIFT = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcWorkPlanTypeEnum
+    {
+        ACTUAL = 0,
+        BASELINE = 1,
+        PLANNED = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+
+    enum class IfcWorkScheduleTypeEnum
+    {
+        ACTUAL = 0,
+        BASELINE = 1,
+        PLANNED = 2,
+        USERDEFINED = 3,
+        NOTDEFINED = 4,
+        ___unk = -1
+    };
+    //
+    inline TextValue IfcActionRequestTypeEnum_[] = {"EMAIL", "FAX", "PHONE", "POST", "VERBAL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcActionRequestTypeEnum_slots[] = {5, -1, -1, 4, -1, 6, -1, -1, -1, 1, -1, 2, -1, 3, 0, -1};
+    inline constexpr EnumerationHash IfcActionRequestTypeEnum_hash = {IfcActionRequestTypeEnum_, IfcActionRequestTypeEnum_slots, 17u, 15u};
+    inline TextValue IfcActionSourceTypeEnum_[] = {"DEAD_LOAD_G", "COMPLETION_G1", "LIVE_LOAD_Q", "SNOW_S", "WIND_W", "PRESTRESSING_P", "SETTLEMENT_U", "TEMPERATURE_T", "EARTHQUAKE_E", "FIRE", "IMPULSE", "IMPACT", "TRANSPORT", "ERECTION", "PROPPING", "SYSTEM_IMPERFECTION", "SHRINKAGE", "CREEP", "LACK_OF_FIT", "BUOYANCY", "ICE", "CURRENT", "WAVE", "RAIN", "BRAKES", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcActionSourceTypeEnum_slots[] = {17, 13, -1, -1, -1, -1, -1, 3, 18, -1, -1, 26, 21, -1, 16, 14, 7, -1, 22, -1, -1, -1, -1, -1, 25, -1, 1, -1, 19, -1, -1, 0, 5, -1, 12, -1, -1, 10, -1, -1, -1, -1, -1, -1, -1, 15, 24, -1, -1, -1, 9, 6, 8, -1, -1, 11, -1, -1, 20, 2, 4, -1, 23, -1};
+    inline constexpr EnumerationHash IfcActionSourceTypeEnum_hash = {IfcActionSourceTypeEnum_, IfcActionSourceTypeEnum_slots, 262u, 63u};
+    inline TextValue IfcActionTypeEnum_[] = {"PERMANENT_G", "VARIABLE_Q", "EXTRAORDINARY_A", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcActionTypeEnum_slots[] = {4, 3, 2, -1, -1, -1, -1, -1, -1, 0, -1, -1, 1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcActionTypeEnum_hash = {IfcActionTypeEnum_, IfcActionTypeEnum_slots, 3u, 15u};
+    inline TextValue IfcActuatorTypeEnum_[] = {"ELECTRICACTUATOR", "HANDOPERATEDACTUATOR", "HYDRAULICACTUATOR", "PNEUMATICACTUATOR", "THERMOSTATICACTUATOR", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcActuatorTypeEnum_slots[] = {6, 5, -1, 4, -1, 2, 3, -1, -1, -1, -1, -1, -1, 1, 0, -1};
+    inline constexpr EnumerationHash IfcActuatorTypeEnum_hash = {IfcActuatorTypeEnum_, IfcActuatorTypeEnum_slots, 3u, 15u};
+    inline TextValue IfcAddressTypeEnum_[] = {"OFFICE", "SITE", "HOME", "DISTRIBUTIONPOINT", "USERDEFINED", NULL};
+    inline constexpr short IfcAddressTypeEnum_slots[] = {-1, -1, -1, -1, -1, -1, -1, 4, -1, 1, -1, 0, 3, -1, -1, 2};
+    inline constexpr EnumerationHash IfcAddressTypeEnum_hash = {IfcAddressTypeEnum_, IfcAddressTypeEnum_slots, 0u, 15u};
+    inline TextValue IfcAirTerminalBoxTypeEnum_[] = {"CONSTANTFLOW", "VARIABLEFLOWPRESSUREDEPENDANT", "VARIABLEFLOWPRESSUREINDEPENDANT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcAirTerminalBoxTypeEnum_slots[] = {2, -1, 0, -1, -1, -1, -1, -1, 1, 4, -1, 3, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcAirTerminalBoxTypeEnum_hash = {IfcAirTerminalBoxTypeEnum_, IfcAirTerminalBoxTypeEnum_slots, 4u, 15u};
+    inline TextValue IfcAirTerminalTypeEnum_[] = {"DIFFUSER", "GRILLE", "LOUVRE", "REGISTER", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcAirTerminalTypeEnum_slots[] = {5, 4, -1, 1, -1, -1, -1, 2, -1, 0, -1, -1, -1, 3, -1, -1};
+    inline constexpr EnumerationHash IfcAirTerminalTypeEnum_hash = {IfcAirTerminalTypeEnum_, IfcAirTerminalTypeEnum_slots, 3u, 15u};
+    inline TextValue IfcAirToAirHeatRecoveryTypeEnum_[] = {"FIXEDPLATECOUNTERFLOWEXCHANGER", "FIXEDPLATECROSSFLOWEXCHANGER", "FIXEDPLATEPARALLELFLOWEXCHANGER", "ROTARYWHEEL", "RUNAROUNDCOILLOOP", "HEATPIPE", "TWINTOWERENTHALPYRECOVERYLOOPS", "THERMOSIPHONSEALEDTUBEHEATEXCHANGERS", "THERMOSIPHONCOILTYPEHEATEXCHANGERS", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcAirToAirHeatRecoveryTypeEnum_slots[] = {-1, -1, -1, -1, -1, 6, 1, -1, -1, -1, 7, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 9, 3, 8, -1, -1, -1, -1, 0, 2, 10, -1};
+    inline constexpr EnumerationHash IfcAirToAirHeatRecoveryTypeEnum_hash = {IfcAirToAirHeatRecoveryTypeEnum_, IfcAirToAirHeatRecoveryTypeEnum_slots, 5u, 31u};
+    inline TextValue IfcAlarmTypeEnum_[] = {"BELL", "BREAKGLASSBUTTON", "LIGHT", "MANUALPULLBOX", "SIREN", "WHISTLE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcAlarmTypeEnum_slots[] = {7, 6, -1, 3, 4, 1, -1, 0, 5, 2, -1, -1, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcAlarmTypeEnum_hash = {IfcAlarmTypeEnum_, IfcAlarmTypeEnum_slots, 3u, 15u};
+    inline TextValue IfcAnalysisModelTypeEnum_[] = {"IN_PLANE_LOADING_2D", "OUT_PLANE_LOADING_2D", "LOADING_3D", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcAnalysisModelTypeEnum_slots[] = {-1, -1, -1, -1, -1, 3, -1, -1, 2, -1, 1, -1, -1, 4, 0, -1};
+    inline constexpr EnumerationHash IfcAnalysisModelTypeEnum_hash = {IfcAnalysisModelTypeEnum_, IfcAnalysisModelTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcAnalysisTheoryTypeEnum_[] = {"FIRST_ORDER_THEORY", "SECOND_ORDER_THEORY", "THIRD_ORDER_THEORY", "FULL_NONLINEAR_THEORY", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcAnalysisTheoryTypeEnum_slots[] = {-1, -1, -1, -1, -1, 4, -1, 0, -1, -1, 1, 3, 2, -1, 5, -1};
+    inline constexpr EnumerationHash IfcAnalysisTheoryTypeEnum_hash = {IfcAnalysisTheoryTypeEnum_, IfcAnalysisTheoryTypeEnum_slots, 5u, 15u};
+    inline TextValue IfcArithmeticOperatorEnum_[] = {"ADD", "DIVIDE", "MULTIPLY", "SUBTRACT", NULL};
+    inline constexpr short IfcArithmeticOperatorEnum_slots[] = {-1, -1, 3, 1, 2, -1, -1, 0};
+    inline constexpr EnumerationHash IfcArithmeticOperatorEnum_hash = {IfcArithmeticOperatorEnum_, IfcArithmeticOperatorEnum_slots, 2u, 7u};
+    inline TextValue IfcAssemblyPlaceEnum_[] = {"SITE", "FACTORY", "NOTDEFINED", NULL};
+    inline constexpr short IfcAssemblyPlaceEnum_slots[] = {-1, 0, 1, -1, -1, -1, -1, 2};
+    inline constexpr EnumerationHash IfcAssemblyPlaceEnum_hash = {IfcAssemblyPlaceEnum_, IfcAssemblyPlaceEnum_slots, 0u, 7u};
+    inline TextValue IfcAudioVisualApplianceTypeEnum_[] = {"AMPLIFIER", "CAMERA", "DISPLAY", "MICROPHONE", "PLAYER", "PROJECTOR", "RECEIVER", "SPEAKER", "SWITCHER", "TELEPHONE", "TUNER", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcAudioVisualApplianceTypeEnum_slots[] = {-1, 1, -1, -1, 0, -1, -1, 11, -1, 3, -1, 2, 6, 8, -1, -1, -1, 7, 4, -1, -1, -1, -1, 12, 10, -1, 5, -1, -1, -1, 9, -1};
+    inline constexpr EnumerationHash IfcAudioVisualApplianceTypeEnum_hash = {IfcAudioVisualApplianceTypeEnum_, IfcAudioVisualApplianceTypeEnum_slots, 0u, 31u};
+    inline TextValue IfcBeamTypeEnum_[] = {"BEAM", "JOIST", "HOLLOWCORE", "LINTEL", "SPANDREL", "T_BEAM", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcBeamTypeEnum_slots[] = {-1, 5, -1, 4, 2, 3, 0, -1, -1, 7, -1, 6, 1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcBeamTypeEnum_hash = {IfcBeamTypeEnum_, IfcBeamTypeEnum_slots, 4u, 15u};
+    inline TextValue IfcBenchmarkEnum_[] = {"GREATERTHAN", "GREATERTHANOREQUALTO", "LESSTHAN", "LESSTHANOREQUALTO", "EQUALTO", "NOTEQUALTO", "INCLUDES", "NOTINCLUDES", "INCLUDEDIN", "NOTINCLUDEDIN", NULL};
+    inline constexpr short IfcBenchmarkEnum_slots[] = {-1, -1, -1, -1, 1, 9, 4, -1, -1, -1, -1, -1, -1, -1, -1, 7, -1, 6, -1, -1, 2, 8, 3, -1, -1, -1, 5, -1, 0, -1, -1, -1};
+    inline constexpr EnumerationHash IfcBenchmarkEnum_hash = {IfcBenchmarkEnum_, IfcBenchmarkEnum_slots, 0u, 31u};
+    inline TextValue IfcBoilerTypeEnum_[] = {"WATER", "STEAM", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcBoilerTypeEnum_slots[] = {0, -1, 3, -1, -1, 2, -1, 1};
+    inline constexpr EnumerationHash IfcBoilerTypeEnum_hash = {IfcBoilerTypeEnum_, IfcBoilerTypeEnum_slots, 1u, 7u};
+    inline TextValue IfcBooleanOperator_[] = {"UNION", "INTERSECTION", "DIFFERENCE", NULL};
+    inline constexpr short IfcBooleanOperator_slots[] = {-1, -1, 0, -1, -1, 1, 2, -1};
+    inline constexpr EnumerationHash IfcBooleanOperator_hash = {IfcBooleanOperator_, IfcBooleanOperator_slots, 1u, 7u};
+    inline TextValue IfcBSplineCurveForm_[] = {"POLYLINE_FORM", "CIRCULAR_ARC", "ELLIPTIC_ARC", "PARABOLIC_ARC", "HYPERBOLIC_ARC", "UNSPECIFIED", NULL};
+    inline constexpr short IfcBSplineCurveForm_slots[] = {-1, -1, -1, -1, 5, 3, -1, -1, 2, 4, -1, -1, 1, -1, -1, 0};
+    inline constexpr EnumerationHash IfcBSplineCurveForm_hash = {IfcBSplineCurveForm_, IfcBSplineCurveForm_slots, 1u, 15u};
+    inline TextValue IfcBSplineSurfaceForm_[] = {"PLANE_SURF", "CYLINDRICAL_SURF", "CONICAL_SURF", "SPHERICAL_SURF", "TOROIDAL_SURF", "SURF_OF_REVOLUTION", "RULED_SURF", "GENERALISED_CONE", "QUADRIC_SURF", "SURF_OF_LINEAR_EXTRUSION", "UNSPECIFIED", NULL};
+    inline constexpr short IfcBSplineSurfaceForm_slots[] = {-1, -1, -1, -1, -1, -1, 0, 8, 5, 2, -1, -1, 4, -1, -1, 3, -1, -1, 1, 7, -1, 6, 9, -1, -1, -1, -1, 10, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcBSplineSurfaceForm_hash = {IfcBSplineSurfaceForm_, IfcBSplineSurfaceForm_slots, 26u, 31u};
+    inline TextValue IfcBuildingElementPartTypeEnum_[] = {"INSULATION", "PRECASTPANEL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcBuildingElementPartTypeEnum_slots[] = {-1, -1, 3, -1, 1, 2, 0, -1};
+    inline constexpr EnumerationHash IfcBuildingElementPartTypeEnum_hash = {IfcBuildingElementPartTypeEnum_, IfcBuildingElementPartTypeEnum_slots, 1u, 7u};
+    inline TextValue IfcBuildingElementProxyTypeEnum_[] = {"COMPLEX", "ELEMENT", "PARTIAL", "PROVISIONFORVOID", "PROVISIONFORSPACE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcBuildingElementProxyTypeEnum_slots[] = {-1, 2, 3, -1, -1, 5, 0, 1, -1, 4, -1, -1, -1, 6, -1, -1};
+    inline constexpr EnumerationHash IfcBuildingElementProxyTypeEnum_hash = {IfcBuildingElementProxyTypeEnum_, IfcBuildingElementProxyTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcBuildingSystemTypeEnum_[] = {"FENESTRATION", "FOUNDATION", "LOADBEARING", "OUTERSHELL", "SHADING", "TRANSPORT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcBuildingSystemTypeEnum_slots[] = {-1, 2, -1, -1, 7, 4, -1, 0, -1, -1, 3, 1, -1, 6, -1, 5};
+    inline constexpr EnumerationHash IfcBuildingSystemTypeEnum_hash = {IfcBuildingSystemTypeEnum_, IfcBuildingSystemTypeEnum_slots, 14u, 15u};
+    inline TextValue IfcBurnerTypeEnum_[] = {"USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcBurnerTypeEnum_slots[] = {-1, 0, 1, -1};
+    inline constexpr EnumerationHash IfcBurnerTypeEnum_hash = {IfcBurnerTypeEnum_, IfcBurnerTypeEnum_slots, 1u, 3u};
+    inline TextValue IfcCableCarrierFittingTypeEnum_[] = {"BEND", "CROSS", "REDUCER", "TEE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCableCarrierFittingTypeEnum_slots[] = {-1, -1, -1, -1, -1, -1, 1, 0, 2, -1, 5, -1, 3, 4, -1, -1};
+    inline constexpr EnumerationHash IfcCableCarrierFittingTypeEnum_hash = {IfcCableCarrierFittingTypeEnum_, IfcCableCarrierFittingTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcCableCarrierSegmentTypeEnum_[] = {"CABLELADDERSEGMENT", "CABLETRAYSEGMENT", "CABLETRUNKINGSEGMENT", "CONDUITSEGMENT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCableCarrierSegmentTypeEnum_slots[] = {-1, 1, 0, -1, -1, -1, 3, -1, -1, 5, -1, 4, -1, 2, -1, -1};
+    inline constexpr EnumerationHash IfcCableCarrierSegmentTypeEnum_hash = {IfcCableCarrierSegmentTypeEnum_, IfcCableCarrierSegmentTypeEnum_slots, 4u, 15u};
+    inline TextValue IfcCableFittingTypeEnum_[] = {"CONNECTOR", "ENTRY", "EXIT", "JUNCTION", "TRANSITION", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCableFittingTypeEnum_slots[] = {4, -1, 5, -1, -1, 1, -1, -1, -1, 0, 6, -1, 3, -1, -1, 2};
+    inline constexpr EnumerationHash IfcCableFittingTypeEnum_hash = {IfcCableFittingTypeEnum_, IfcCableFittingTypeEnum_slots, 9u, 15u};
+    inline TextValue IfcCableSegmentTypeEnum_[] = {"BUSBARSEGMENT", "CABLESEGMENT", "CONDUCTORSEGMENT", "CORESEGMENT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCableSegmentTypeEnum_slots[] = {0, -1, -1, -1, 1, 4, -1, 2, 3, -1, -1, -1, -1, 5, -1, -1};
+    inline constexpr EnumerationHash IfcCableSegmentTypeEnum_hash = {IfcCableSegmentTypeEnum_, IfcCableSegmentTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcChangeActionEnum_[] = {"NOCHANGE", "MODIFIED", "ADDED", "DELETED", "NOTDEFINED", NULL};
+    inline constexpr short IfcChangeActionEnum_slots[] = {2, 3, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, -1, 4, -1, -1};
+    inline constexpr EnumerationHash IfcChangeActionEnum_hash = {IfcChangeActionEnum_, IfcChangeActionEnum_slots, 2u, 15u};
+    inline TextValue IfcChillerTypeEnum_[] = {"AIRCOOLED", "WATERCOOLED", "HEATRECOVERY", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcChillerTypeEnum_slots[] = {4, 3, -1, -1, -1, -1, -1, 2, -1, -1, 1, -1, -1, -1, 0, -1};
+    inline constexpr EnumerationHash IfcChillerTypeEnum_hash = {IfcChillerTypeEnum_, IfcChillerTypeEnum_slots, 3u, 15u};
+    inline TextValue IfcChimneyTypeEnum_[] = {"USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcChimneyTypeEnum_slots[] = {-1, 0, 1, -1};
+    inline constexpr EnumerationHash IfcChimneyTypeEnum_hash = {IfcChimneyTypeEnum_, IfcChimneyTypeEnum_slots, 1u, 3u};
+    inline TextValue IfcCoilTypeEnum_[] = {"DXCOOLINGCOIL", "ELECTRICHEATINGCOIL", "GASHEATINGCOIL", "HYDRONICCOIL", "STEAMHEATINGCOIL", "WATERCOOLINGCOIL", "WATERHEATINGCOIL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCoilTypeEnum_slots[] = {6, -1, -1, -1, -1, -1, 3, -1, -1, -1, 8, -1, 2, 5, -1, -1, -1, 0, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, 7, 4, -1};
+    inline constexpr EnumerationHash IfcCoilTypeEnum_hash = {IfcCoilTypeEnum_, IfcCoilTypeEnum_slots, 1u, 31u};
+    inline TextValue IfcColumnTypeEnum_[] = {"COLUMN", "PILASTER", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcColumnTypeEnum_slots[] = {0, -1, 3, -1, -1, 2, -1, 1};
+    inline constexpr EnumerationHash IfcColumnTypeEnum_hash = {IfcColumnTypeEnum_, IfcColumnTypeEnum_slots, 1u, 7u};
+    inline TextValue IfcCommunicationsApplianceTypeEnum_[] = {"ANTENNA", "COMPUTER", "FAX", "GATEWAY", "MODEM", "NETWORKAPPLIANCE", "NETWORKBRIDGE", "NETWORKHUB", "PRINTER", "REPEATER", "ROUTER", "SCANNER", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCommunicationsApplianceTypeEnum_slots[] = {-1, -1, 6, 2, -1, -1, -1, 7, -1, 12, -1, -1, 5, -1, 13, 11, 3, -1, 8, -1, -1, -1, 0, 1, -1, 4, -1, -1, -1, 9, -1, 10};
+    inline constexpr EnumerationHash IfcCommunicationsApplianceTypeEnum_hash = {IfcCommunicationsApplianceTypeEnum_, IfcCommunicationsApplianceTypeEnum_slots, 32u, 31u};
+    inline TextValue IfcComplexPropertyTemplateTypeEnum_[] = {"P_COMPLEX", "Q_COMPLEX", NULL};
+    inline constexpr short IfcComplexPropertyTemplateTypeEnum_slots[] = {-1, -1, 1, 0};
+    inline constexpr EnumerationHash IfcComplexPropertyTemplateTypeEnum_hash = {IfcComplexPropertyTemplateTypeEnum_, IfcComplexPropertyTemplateTypeEnum_slots, 2u, 3u};
+    inline TextValue IfcCompressorTypeEnum_[] = {"DYNAMIC", "RECIPROCATING", "ROTARY", "SCROLL", "TROCHOIDAL", "SINGLESTAGE", "BOOSTER", "OPENTYPE", "HERMETIC", "SEMIHERMETIC", "WELDEDSHELLHERMETIC", "ROLLINGPISTON", "ROTARYVANE", "SINGLESCREW", "TWINSCREW", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCompressorTypeEnum_slots[] = {-1, 14, -1, -1, -1, 1, -1, -1, 2, -1, -1, -1, -1, -1, 9, -1, 8, -1, -1, -1, -1, 13, 10, -1, -1, -1, -1, -1, -1, 12, 16, 6, -1, -1, -1, -1, -1, -1, -1, 4, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, -1, 15, -1, -1, -1, -1, -1, -1, 5, 7, -1, -1};
+    inline constexpr EnumerationHash IfcCompressorTypeEnum_hash = {IfcCompressorTypeEnum_, IfcCompressorTypeEnum_slots, 5u, 63u};
+    inline TextValue IfcCondenserTypeEnum_[] = {"AIRCOOLED", "EVAPORATIVECOOLED", "WATERCOOLED", "WATERCOOLEDBRAZEDPLATE", "WATERCOOLEDSHELLCOIL", "WATERCOOLEDSHELLTUBE", "WATERCOOLEDTUBEINTUBE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCondenserTypeEnum_slots[] = {8, 5, -1, -1, -1, -1, 4, -1, 3, -1, 1, 6, -1, -1, -1, -1, -1, 7, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, 0, -1};
+    inline constexpr EnumerationHash IfcCondenserTypeEnum_hash = {IfcCondenserTypeEnum_, IfcCondenserTypeEnum_slots, 3u, 31u};
+    inline TextValue IfcConnectionTypeEnum_[] = {"ATPATH", "ATSTART", "ATEND", "NOTDEFINED", NULL};
+    inline constexpr short IfcConnectionTypeEnum_slots[] = {-1, 3, 2, 0, -1, 1, -1, -1};
+    inline constexpr EnumerationHash IfcConnectionTypeEnum_hash = {IfcConnectionTypeEnum_, IfcConnectionTypeEnum_slots, 4u, 7u};
+    inline TextValue IfcConstraintEnum_[] = {"HARD", "SOFT", "ADVISORY", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcConstraintEnum_slots[] = {-1, -1, -1, -1, 1, -1, -1, -1, 2, 0, 4, -1, -1, 3, -1, -1};
+    inline constexpr EnumerationHash IfcConstraintEnum_hash = {IfcConstraintEnum_, IfcConstraintEnum_slots, 1u, 15u};
+    inline TextValue IfcConstructionEquipmentResourceTypeEnum_[] = {"DEMOLISHING", "EARTHMOVING", "ERECTING", "HEATING", "LIGHTING", "PAVING", "PUMPING", "TRANSPORTING", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcConstructionEquipmentResourceTypeEnum_slots[] = {-1, 2, -1, -1, 5, -1, -1, 8, -1, -1, -1, 1, -1, -1, 4, -1, -1, 6, -1, -1, -1, 0, -1, 9, 3, -1, -1, -1, -1, 7, -1, -1};
+    inline constexpr EnumerationHash IfcConstructionEquipmentResourceTypeEnum_hash = {IfcConstructionEquipmentResourceTypeEnum_, IfcConstructionEquipmentResourceTypeEnum_slots, 0u, 31u};
+    inline TextValue IfcConstructionMaterialResourceTypeEnum_[] = {"AGGREGATES", "CONCRETE", "DRYWALL", "FUEL", "GYPSUM", "MASONRY", "METAL", "PLASTIC", "WOOD", "NOTDEFINED", "USERDEFINED", NULL};
+    inline constexpr short IfcConstructionMaterialResourceTypeEnum_slots[] = {9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, -1, -1, -1, 1, 10, -1, 5, 6, 2, -1, -1, 8, 3, 7, -1, -1, -1, 0, -1};
+    inline constexpr EnumerationHash IfcConstructionMaterialResourceTypeEnum_hash = {IfcConstructionMaterialResourceTypeEnum_, IfcConstructionMaterialResourceTypeEnum_slots, 3u, 31u};
+    inline TextValue IfcConstructionProductResourceTypeEnum_[] = {"ASSEMBLY", "FORMWORK", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcConstructionProductResourceTypeEnum_slots[] = {1, -1, 3, 0, -1, 2, -1, -1};
+    inline constexpr EnumerationHash IfcConstructionProductResourceTypeEnum_hash = {IfcConstructionProductResourceTypeEnum_, IfcConstructionProductResourceTypeEnum_slots, 1u, 7u};
+    inline TextValue IfcControllerTypeEnum_[] = {"FLOATING", "PROGRAMMABLE", "PROPORTIONAL", "MULTIPOSITION", "TWOPOSITION", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcControllerTypeEnum_slots[] = {0, 4, -1, -1, -1, -1, -1, 3, -1, -1, 6, 1, -1, 5, 2, -1};
+    inline constexpr EnumerationHash IfcControllerTypeEnum_hash = {IfcControllerTypeEnum_, IfcControllerTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcCooledBeamTypeEnum_[] = {"ACTIVE", "PASSIVE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCooledBeamTypeEnum_slots[] = {-1, -1, 3, 0, 1, 2, -1, -1};
+    inline constexpr EnumerationHash IfcCooledBeamTypeEnum_hash = {IfcCooledBeamTypeEnum_, IfcCooledBeamTypeEnum_slots, 1u, 7u};
+    inline TextValue IfcCoolingTowerTypeEnum_[] = {"NATURALDRAFT", "MECHANICALINDUCEDDRAFT", "MECHANICALFORCEDDRAFT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCoolingTowerTypeEnum_slots[] = {-1, 2, -1, -1, -1, 1, -1, -1, 0, -1, 4, -1, -1, 3, -1, -1};
+    inline constexpr EnumerationHash IfcCoolingTowerTypeEnum_hash = {IfcCoolingTowerTypeEnum_, IfcCoolingTowerTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcCostItemTypeEnum_[] = {"USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCostItemTypeEnum_slots[] = {-1, 0, 1, -1};
+    inline constexpr EnumerationHash IfcCostItemTypeEnum_hash = {IfcCostItemTypeEnum_, IfcCostItemTypeEnum_slots, 1u, 3u};
+    inline TextValue IfcCostScheduleTypeEnum_[] = {"BUDGET", "COSTPLAN", "ESTIMATE", "TENDER", "PRICEDBILLOFQUANTITIES", "UNPRICEDBILLOFQUANTITIES", "SCHEDULEOFRATES", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCostScheduleTypeEnum_slots[] = {-1, 6, 3, -1, -1, -1, -1, 7, -1, -1, -1, -1, 4, -1, 2, -1, -1, -1, -1, -1, 5, -1, -1, 8, -1, 1, -1, -1, -1, -1, -1, 0};
+    inline constexpr EnumerationHash IfcCostScheduleTypeEnum_hash = {IfcCostScheduleTypeEnum_, IfcCostScheduleTypeEnum_slots, 0u, 31u};
+    inline TextValue IfcCoveringTypeEnum_[] = {"CEILING", "FLOORING", "CLADDING", "ROOFING", "MOLDING", "SKIRTINGBOARD", "INSULATION", "MEMBRANE", "SLEEVING", "WRAPPING", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCoveringTypeEnum_slots[] = {3, 6, -1, 8, -1, -1, -1, -1, -1, -1, 7, -1, 2, 5, 9, 1, -1, -1, -1, -1, -1, 10, 11, -1, 4, -1, -1, -1, 0, -1, -1, -1};
+    inline constexpr EnumerationHash IfcCoveringTypeEnum_hash = {IfcCoveringTypeEnum_, IfcCoveringTypeEnum_slots, 6u, 31u};
+    inline TextValue IfcCrewResourceTypeEnum_[] = {"OFFICE", "SITE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCrewResourceTypeEnum_slots[] = {1, -1, 3, -1, 0, 2, -1, -1};
+    inline constexpr EnumerationHash IfcCrewResourceTypeEnum_hash = {IfcCrewResourceTypeEnum_, IfcCrewResourceTypeEnum_slots, 1u, 7u};
+    inline TextValue IfcCurtainWallTypeEnum_[] = {"USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcCurtainWallTypeEnum_slots[] = {-1, 0, 1, -1};
+    inline constexpr EnumerationHash IfcCurtainWallTypeEnum_hash = {IfcCurtainWallTypeEnum_, IfcCurtainWallTypeEnum_slots, 1u, 3u};
+    inline TextValue IfcCurveInterpolationEnum_[] = {"LINEAR", "LOG_LINEAR", "LOG_LOG", "NOTDEFINED", NULL};
+    inline constexpr short IfcCurveInterpolationEnum_slots[] = {-1, 1, -1, -1, 2, -1, 0, 3};
+    inline constexpr EnumerationHash IfcCurveInterpolationEnum_hash = {IfcCurveInterpolationEnum_, IfcCurveInterpolationEnum_slots, 0u, 7u};
+    inline TextValue IfcDamperTypeEnum_[] = {"BACKDRAFTDAMPER", "BALANCINGDAMPER", "BLASTDAMPER", "CONTROLDAMPER", "FIREDAMPER", "FIRESMOKEDAMPER", "FUMEHOODEXHAUST", "GRAVITYDAMPER", "GRAVITYRELIEFDAMPER", "RELIEFDAMPER", "SMOKEDAMPER", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDamperTypeEnum_slots[] = {-1, -1, 7, -1, -1, 3, -1, -1, -1, -1, -1, -1, 10, 8, 11, 6, -1, -1, -1, 0, -1, 9, 1, 5, -1, 2, -1, -1, -1, 12, -1, 4};
+    inline constexpr EnumerationHash IfcDamperTypeEnum_hash = {IfcDamperTypeEnum_, IfcDamperTypeEnum_slots, 22u, 31u};
+    inline TextValue IfcDataOriginEnum_[] = {"MEASURED", "PREDICTED", "SIMULATED", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDataOriginEnum_slots[] = {-1, -1, -1, 1, -1, 3, -1, -1, -1, 2, -1, -1, 0, 4, -1, -1};
+    inline constexpr EnumerationHash IfcDataOriginEnum_hash = {IfcDataOriginEnum_, IfcDataOriginEnum_slots, 2u, 15u};
+    inline TextValue IfcDerivedUnitEnum_[] = {"ANGULARVELOCITYUNIT", "AREADENSITYUNIT", "COMPOUNDPLANEANGLEUNIT", "DYNAMICVISCOSITYUNIT", "HEATFLUXDENSITYUNIT", "INTEGERCOUNTRATEUNIT", "ISOTHERMALMOISTURECAPACITYUNIT", "KINEMATICVISCOSITYUNIT", "LINEARVELOCITYUNIT", "MASSDENSITYUNIT", "MASSFLOWRATEUNIT", "MOISTUREDIFFUSIVITYUNIT", "MOLECULARWEIGHTUNIT", "SPECIFICHEATCAPACITYUNIT", "THERMALADMITTANCEUNIT", "THERMALCONDUCTANCEUNIT", "THERMALRESISTANCEUNIT", "THERMALTRANSMITTANCEUNIT", "VAPORPERMEABILITYUNIT", "VOLUMETRICFLOWRATEUNIT", "ROTATIONALFREQUENCYUNIT", "TORQUEUNIT", "MOMENTOFINERTIAUNIT", "LINEARMOMENTUNIT", "LINEARFORCEUNIT", "PLANARFORCEUNIT", "MODULUSOFELASTICITYUNIT", "SHEARMODULUSUNIT", "LINEARSTIFFNESSUNIT", "ROTATIONALSTIFFNESSUNIT", "MODULUSOFSUBGRADEREACTIONUNIT", "ACCELERATIONUNIT", "CURVATUREUNIT", "HEATINGVALUEUNIT", "IONCONCENTRATIONUNIT", "LUMINOUSINTENSITYDISTRIBUTIONUNIT", "MASSPERLENGTHUNIT", "MODULUSOFLINEARSUBGRADEREACTIONUNIT", "MODULUSOFROTATIONALSUBGRADEREACTIONUNIT", "PHUNIT", "ROTATIONALMASSUNIT", "SECTIONAREAINTEGRALUNIT", "SECTIONMODULUSUNIT", "SOUNDPOWERLEVELUNIT", "SOUNDPOWERUNIT", "SOUNDPRESSURELEVELUNIT", "SOUNDPRESSUREUNIT", "TEMPERATUREGRADIENTUNIT", "TEMPERATURERATEOFCHANGEUNIT", "THERMALEXPANSIONCOEFFICIENTUNIT", "WARPINGCONSTANTUNIT", "WARPINGMOMENTUNIT", "USERDEFINED", NULL};
+    inline constexpr short IfcDerivedUnitEnum_slots[] = {-1, -1, -1, -1, -1, 48, 34, -1, -1, -1, -1, -1, 50, -1, -1, -1, 7, -1, -1, -1, -1, -1, -1, -1, -1, 22, -1, -1, 46, -1, -1, 2, -1, -1, -1, 14, 0, -1, -1, -1, -1, -1, 16, -1, 28, 41, 11, -1, 23, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 30, -1, -1, -1, -1, 26, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 33, -1, -1, -1, -1, -1, 44, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 19, 39, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 25, -1, -1, -1, -1, -1, 20, -1, -1, -1, -1, -1, -1, -1, -1, 45, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 17, -1, -1, -1, -1, 12, 24, -1, -1, -1, -1, -1, -1, -1, 36, 42, -1, -1, 37, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 35, -1, -1, -1, -1, -1, 47, 5, 3, -1, -1, -1, -1, 27, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 29, 6, 43, 40, -1, -1, 21, -1, -1, -1, -1, 15, -1, -1, -1, -1, 4, -1, -1, 13, -1, 8, -1, -1, 18, -1, -1, 51, -1, -1, -1, -1, 32, -1, 49, -1, -1, 52, -1, 31, 10, -1, -1, 38, -1, 9, -1, -1};
+    inline constexpr EnumerationHash IfcDerivedUnitEnum_hash = {IfcDerivedUnitEnum_, IfcDerivedUnitEnum_slots, 467u, 255u};
+    inline TextValue IfcDirectionSenseEnum_[] = {"POSITIVE", "NEGATIVE", NULL};
+    inline constexpr short IfcDirectionSenseEnum_slots[] = {-1, 0, -1, 1};
+    inline constexpr EnumerationHash IfcDirectionSenseEnum_hash = {IfcDirectionSenseEnum_, IfcDirectionSenseEnum_slots, 0u, 3u};
+    inline TextValue IfcDiscreteAccessoryTypeEnum_[] = {"ANCHORPLATE", "BRACKET", "SHOE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDiscreteAccessoryTypeEnum_slots[] = {4, 3, -1, 0, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, 2, -1};
+    inline constexpr EnumerationHash IfcDiscreteAccessoryTypeEnum_hash = {IfcDiscreteAccessoryTypeEnum_, IfcDiscreteAccessoryTypeEnum_slots, 3u, 15u};
+    inline TextValue IfcDistributionChamberElementTypeEnum_[] = {"FORMEDDUCT", "INSPECTIONCHAMBER", "INSPECTIONPIT", "MANHOLE", "METERCHAMBER", "SUMP", "TRENCH", "VALVECHAMBER", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDistributionChamberElementTypeEnum_slots[] = {-1, 2, 0, 6, -1, 8, -1, -1, -1, 3, -1, -1, -1, 9, 5, 1, -1, -1, -1, -1, -1, 4, -1, -1, 7, -1, -1, -1, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcDistributionChamberElementTypeEnum_hash = {IfcDistributionChamberElementTypeEnum_, IfcDistributionChamberElementTypeEnum_slots, 2u, 31u};
+    inline TextValue IfcDistributionPortTypeEnum_[] = {"CABLE", "CABLECARRIER", "DUCT", "PIPE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDistributionPortTypeEnum_slots[] = {-1, 0, -1, -1, -1, -1, -1, -1, 2, -1, 5, 1, -1, 4, -1, 3};
+    inline constexpr EnumerationHash IfcDistributionPortTypeEnum_hash = {IfcDistributionPortTypeEnum_, IfcDistributionPortTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcDistributionSystemEnum_[] = {"AIRCONDITIONING", "AUDIOVISUAL", "CHEMICAL", "CHILLEDWATER", "COMMUNICATION", "COMPRESSEDAIR", "CONDENSERWATER", "CONTROL", "CONVEYING", "DATA", "DISPOSAL", "DOMESTICCOLDWATER", "DOMESTICHOTWATER", "DRAINAGE", "EARTHING", "ELECTRICAL", "ELECTROACOUSTIC", "EXHAUST", "FIREPROTECTION", "FUEL", "GAS", "HAZARDOUS", "HEATING", "LIGHTING", "LIGHTNINGPROTECTION", "MUNICIPALSOLIDWASTE", "OIL", "OPERATIONAL", "POWERGENERATION", "RAINWATER", "REFRIGERATION", "SECURITY", "SEWAGE", "SIGNAL", "STORMWATER", "TELEPHONE", "TV", "VACUUM", "VENT", "VENTILATION", "WASTEWATER", "WATERSUPPLY", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDistributionSystemEnum_slots[] = {27, 31, -1, -1, -1, 11, -1, 13, 12, -1, -1, -1, -1, 15, -1, -1, 1, -1, -1, 16, 39, -1, -1, -1, 37, -1, -1, -1, -1, -1, -1, -1, 0, -1, 4, -1, -1, 20, -1, 21, -1, 40, 5, 3, -1, 25, 22, -1, 42, -1, -1, -1, -1, -1, 36, 7, -1, -1, 32, -1, -1, -1, -1, -1, -1, -1, 38, -1, -1, -1, -1, -1, -1, -1, 9, -1, 6, -1, -1, -1, 43, -1, -1, -1, -1, 35, -1, 24, -1, -1, 8, -1, -1, -1, 14, -1, -1, -1, 2, 30, -1, 33, 28, 41, 23, -1, -1, 17, -1, 10, -1, -1, -1, -1, 29, -1, -1, -1, 19, 26, 34, -1, -1, 18, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcDistributionSystemEnum_hash = {IfcDistributionSystemEnum_, IfcDistributionSystemEnum_slots, 464u, 127u};
+    inline TextValue IfcDocumentConfidentialityEnum_[] = {"PUBLIC", "RESTRICTED", "CONFIDENTIAL", "PERSONAL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDocumentConfidentialityEnum_slots[] = {0, -1, -1, -1, -1, 4, -1, -1, 3, -1, 2, -1, -1, 5, 1, -1};
+    inline constexpr EnumerationHash IfcDocumentConfidentialityEnum_hash = {IfcDocumentConfidentialityEnum_, IfcDocumentConfidentialityEnum_slots, 2u, 15u};
+    inline TextValue IfcDocumentStatusEnum_[] = {"DRAFT", "FINALDRAFT", "FINAL", "REVISION", "NOTDEFINED", NULL};
+    inline constexpr short IfcDocumentStatusEnum_slots[] = {-1, 3, -1, 1, 0, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, 2};
+    inline constexpr EnumerationHash IfcDocumentStatusEnum_hash = {IfcDocumentStatusEnum_, IfcDocumentStatusEnum_slots, 0u, 15u};
+    inline TextValue IfcDoorPanelOperationEnum_[] = {"SWINGING", "DOUBLE_ACTING", "SLIDING", "FOLDING", "REVOLVING", "ROLLINGUP", "FIXEDPANEL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDoorPanelOperationEnum_slots[] = {-1, 1, -1, 5, -1, -1, 3, 7, 0, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, 6, -1, -1, -1, 8, 4, -1, -1, -1, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcDoorPanelOperationEnum_hash = {IfcDoorPanelOperationEnum_, IfcDoorPanelOperationEnum_slots, 0u, 31u};
+    inline TextValue IfcDoorPanelPositionEnum_[] = {"LEFT", "MIDDLE", "RIGHT", "NOTDEFINED", NULL};
+    inline constexpr short IfcDoorPanelPositionEnum_slots[] = {2, -1, 3, 0, 1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcDoorPanelPositionEnum_hash = {IfcDoorPanelPositionEnum_, IfcDoorPanelPositionEnum_slots, 1u, 7u};
+    inline TextValue IfcDoorStyleConstructionEnum_[] = {"ALUMINIUM", "HIGH_GRADE_STEEL", "STEEL", "WOOD", "ALUMINIUM_WOOD", "ALUMINIUM_PLASTIC", "PLASTIC", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDoorStyleConstructionEnum_slots[] = {1, -1, 3, -1, -1, -1, -1, -1, -1, -1, 8, -1, -1, -1, -1, 0, -1, 5, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, 2, 7, -1, 6};
+    inline constexpr EnumerationHash IfcDoorStyleConstructionEnum_hash = {IfcDoorStyleConstructionEnum_, IfcDoorStyleConstructionEnum_slots, 1u, 31u};
+    inline TextValue IfcDoorStyleOperationEnum_[] = {"SINGLE_SWING_LEFT", "SINGLE_SWING_RIGHT", "DOUBLE_DOOR_SINGLE_SWING", "DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_LEFT", "DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_RIGHT", "DOUBLE_SWING_LEFT", "DOUBLE_SWING_RIGHT", "DOUBLE_DOOR_DOUBLE_SWING", "SLIDING_TO_LEFT", "SLIDING_TO_RIGHT", "DOUBLE_DOOR_SLIDING", "FOLDING_TO_LEFT", "FOLDING_TO_RIGHT", "DOUBLE_DOOR_FOLDING", "REVOLVING", "ROLLINGUP", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDoorStyleOperationEnum_slots[] = {-1, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, -1, 16, -1, 1, -1, -1, -1, -1, -1, -1, -1, 7, -1, -1, -1, -1, 9, 3, -1, -1, -1, -1, -1, -1, -1, 17, 6, 15, 8, -1, 0, 5, 12, -1, -1, -1, -1, 2, 13, 10, 14, -1, -1, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcDoorStyleOperationEnum_hash = {IfcDoorStyleOperationEnum_, IfcDoorStyleOperationEnum_slots, 9u, 63u};
+    inline TextValue IfcDoorTypeEnum_[] = {"DOOR", "GATE", "TRAPDOOR", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDoorTypeEnum_slots[] = {-1, -1, -1, 0, -1, -1, -1, -1, 2, -1, 4, -1, -1, 3, -1, 1};
+    inline constexpr EnumerationHash IfcDoorTypeEnum_hash = {IfcDoorTypeEnum_, IfcDoorTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcDoorTypeOperationEnum_[] = {"SINGLE_SWING_LEFT", "SINGLE_SWING_RIGHT", "DOUBLE_DOOR_SINGLE_SWING", "DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_LEFT", "DOUBLE_DOOR_SINGLE_SWING_OPPOSITE_RIGHT", "DOUBLE_SWING_LEFT", "DOUBLE_SWING_RIGHT", "DOUBLE_DOOR_DOUBLE_SWING", "SLIDING_TO_LEFT", "SLIDING_TO_RIGHT", "DOUBLE_DOOR_SLIDING", "FOLDING_TO_LEFT", "FOLDING_TO_RIGHT", "DOUBLE_DOOR_FOLDING", "REVOLVING", "ROLLINGUP", "SWING_FIXED_LEFT", "SWING_FIXED_RIGHT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDoorTypeOperationEnum_slots[] = {-1, -1, 3, 12, 17, -1, -1, -1, 6, -1, -1, -1, 14, 9, -1, 11, -1, -1, -1, -1, -1, -1, -1, 16, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 13, 19, -1, -1, -1, -1, -1, -1, 10, 18, -1, 15, -1, -1, -1, -1, -1, -1, 0, 5, 8, -1, 1, 7, 2, 4, -1, -1, -1};
+    inline constexpr EnumerationHash IfcDoorTypeOperationEnum_hash = {IfcDoorTypeOperationEnum_, IfcDoorTypeOperationEnum_slots, 21u, 63u};
+    inline TextValue IfcDuctFittingTypeEnum_[] = {"BEND", "CONNECTOR", "ENTRY", "EXIT", "JUNCTION", "OBSTRUCTION", "TRANSITION", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDuctFittingTypeEnum_slots[] = {-1, -1, -1, -1, -1, -1, 4, -1, -1, -1, 8, -1, -1, 3, -1, 5, -1, 1, -1, -1, 2, -1, -1, 0, -1, -1, -1, -1, -1, 7, 6, -1};
+    inline constexpr EnumerationHash IfcDuctFittingTypeEnum_hash = {IfcDuctFittingTypeEnum_, IfcDuctFittingTypeEnum_slots, 1u, 31u};
+    inline TextValue IfcDuctSegmentTypeEnum_[] = {"RIGIDSEGMENT", "FLEXIBLESEGMENT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDuctSegmentTypeEnum_slots[] = {0, -1, 3, -1, -1, 2, 1, -1};
+    inline constexpr EnumerationHash IfcDuctSegmentTypeEnum_hash = {IfcDuctSegmentTypeEnum_, IfcDuctSegmentTypeEnum_slots, 1u, 7u};
+    inline TextValue IfcDuctSilencerTypeEnum_[] = {"FLATOVAL", "RECTANGULAR", "ROUND", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcDuctSilencerTypeEnum_slots[] = {-1, -1, -1, -1, -1, 3, -1, 0, 2, 1, -1, -1, -1, 4, -1, -1};
+    inline constexpr EnumerationHash IfcDuctSilencerTypeEnum_hash = {IfcDuctSilencerTypeEnum_, IfcDuctSilencerTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcElectricApplianceTypeEnum_[] = {"DISHWASHER", "ELECTRICCOOKER", "FREESTANDINGELECTRICHEATER", "FREESTANDINGFAN", "FREESTANDINGWATERHEATER", "FREESTANDINGWATERCOOLER", "FREEZER", "FRIDGE_FREEZER", "HANDDRYER", "KITCHENMACHINE", "MICROWAVE", "PHOTOCOPIER", "REFRIGERATOR", "TUMBLEDRYER", "VENDINGMACHINE", "WASHINGMACHINE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcElectricApplianceTypeEnum_slots[] = {4, 6, -1, -1, -1, -1, -1, 8, -1, -1, -1, -1, -1, 11, 2, -1, 7, -1, 16, -1, -1, -1, -1, 15, -1, -1, -1, -1, -1, 9, -1, 13, -1, -1, -1, -1, 5, -1, -1, -1, 10, -1, 17, -1, -1, 3, -1, 12, -1, -1, -1, -1, -1, 1, -1, 14, 0, -1, -1, -1, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcElectricApplianceTypeEnum_hash = {IfcElectricApplianceTypeEnum_, IfcElectricApplianceTypeEnum_slots, 9u, 63u};
+    inline TextValue IfcElectricDistributionBoardTypeEnum_[] = {"CONSUMERUNIT", "DISTRIBUTIONBOARD", "MOTORCONTROLCENTRE", "SWITCHBOARD", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcElectricDistributionBoardTypeEnum_slots[] = {-1, 0, 2, -1, -1, -1, -1, -1, 1, 5, -1, 4, 3, -1, -1, -1};
+    inline constexpr EnumerationHash IfcElectricDistributionBoardTypeEnum_hash = {IfcElectricDistributionBoardTypeEnum_, IfcElectricDistributionBoardTypeEnum_slots, 4u, 15u};
+    inline TextValue IfcElectricFlowStorageDeviceTypeEnum_[] = {"BATTERY", "CAPACITORBANK", "HARMONICFILTER", "INDUCTORBANK", "UPS", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcElectricFlowStorageDeviceTypeEnum_slots[] = {-1, -1, 4, -1, 6, 3, -1, -1, -1, 0, 5, 2, 1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcElectricFlowStorageDeviceTypeEnum_hash = {IfcElectricFlowStorageDeviceTypeEnum_, IfcElectricFlowStorageDeviceTypeEnum_slots, 7u, 15u};
+    inline TextValue IfcElectricGeneratorTypeEnum_[] = {"CHP", "ENGINEGENERATOR", "STANDALONE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcElectricGeneratorTypeEnum_slots[] = {2, 0, -1, 1, -1, 3, -1, -1, -1, -1, -1, -1, -1, 4, -1, -1};
+    inline constexpr EnumerationHash IfcElectricGeneratorTypeEnum_hash = {IfcElectricGeneratorTypeEnum_, IfcElectricGeneratorTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcElectricMotorTypeEnum_[] = {"DC", "INDUCTION", "POLYPHASE", "RELUCTANCESYNCHRONOUS", "SYNCHRONOUS", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcElectricMotorTypeEnum_slots[] = {-1, 0, -1, -1, -1, 2, -1, -1, -1, 3, 6, 1, -1, 5, 4, -1};
+    inline constexpr EnumerationHash IfcElectricMotorTypeEnum_hash = {IfcElectricMotorTypeEnum_, IfcElectricMotorTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcElectricTimeControlTypeEnum_[] = {"TIMECLOCK", "TIMEDELAY", "RELAY", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcElectricTimeControlTypeEnum_slots[] = {-1, 0, -1, -1, 1, 3, 2, -1, -1, -1, -1, -1, -1, 4, -1, -1};
+    inline constexpr EnumerationHash IfcElectricTimeControlTypeEnum_hash = {IfcElectricTimeControlTypeEnum_, IfcElectricTimeControlTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcElementAssemblyTypeEnum_[] = {"ACCESSORY_ASSEMBLY", "ARCH", "BEAM_GRID", "BRACED_FRAME", "GIRDER", "REINFORCEMENT_UNIT", "RIGID_FRAME", "SLAB_FIELD", "TRUSS", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcElementAssemblyTypeEnum_slots[] = {3, -1, 0, -1, -1, -1, -1, -1, 6, 10, -1, 9, -1, -1, -1, -1, -1, 1, 4, -1, 2, -1, -1, -1, -1, 7, 8, -1, -1, 5, -1, -1};
+    inline constexpr EnumerationHash IfcElementAssemblyTypeEnum_hash = {IfcElementAssemblyTypeEnum_, IfcElementAssemblyTypeEnum_slots, 4u, 31u};
+    inline TextValue IfcElementCompositionEnum_[] = {"COMPLEX", "ELEMENT", "PARTIAL", NULL};
+    inline constexpr short IfcElementCompositionEnum_slots[] = {-1, 2, 0, 1, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcElementCompositionEnum_hash = {IfcElementCompositionEnum_, IfcElementCompositionEnum_slots, 0u, 7u};
+    inline TextValue IfcEngineTypeEnum_[] = {"EXTERNALCOMBUSTION", "INTERNALCOMBUSTION", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcEngineTypeEnum_slots[] = {3, 2, -1, -1, 1, -1, -1, 0};
+    inline constexpr EnumerationHash IfcEngineTypeEnum_hash = {IfcEngineTypeEnum_, IfcEngineTypeEnum_slots, 3u, 7u};
+    inline TextValue IfcEvaporativeCoolerTypeEnum_[] = {"DIRECTEVAPORATIVERANDOMMEDIAAIRCOOLER", "DIRECTEVAPORATIVERIGIDMEDIAAIRCOOLER", "DIRECTEVAPORATIVESLINGERSPACKAGEDAIRCOOLER", "DIRECTEVAPORATIVEPACKAGEDROTARYAIRCOOLER", "DIRECTEVAPORATIVEAIRWASHER", "INDIRECTEVAPORATIVEPACKAGEAIRCOOLER", "INDIRECTEVAPORATIVEWETCOIL", "INDIRECTEVAPORATIVECOOLINGTOWERORCOILCOOLER", "INDIRECTDIRECTCOMBINATION", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcEvaporativeCoolerTypeEnum_slots[] = {-1, 3, 7, 8, -1, -1, -1, 9, -1, -1, -1, -1, 0, 4, 6, 2, -1, -1, 5, -1, -1, -1, -1, 10, -1, -1, -1, -1, 1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcEvaporativeCoolerTypeEnum_hash = {IfcEvaporativeCoolerTypeEnum_, IfcEvaporativeCoolerTypeEnum_slots, 0u, 31u};
+    inline TextValue IfcEvaporatorTypeEnum_[] = {"DIRECTEXPANSION", "DIRECTEXPANSIONSHELLANDTUBE", "DIRECTEXPANSIONTUBEINTUBE", "DIRECTEXPANSIONBRAZEDPLATE", "FLOODEDSHELLANDTUBE", "SHELLANDCOIL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcEvaporatorTypeEnum_slots[] = {-1, -1, -1, -1, 4, 6, 7, -1, 1, 2, -1, -1, 5, 3, -1, 0};
+    inline constexpr EnumerationHash IfcEvaporatorTypeEnum_hash = {IfcEvaporatorTypeEnum_, IfcEvaporatorTypeEnum_slots, 6u, 15u};
+    inline TextValue IfcEventTriggerTypeEnum_[] = {"EVENTRULE", "EVENTMESSAGE", "EVENTTIME", "EVENTCOMPLEX", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcEventTriggerTypeEnum_slots[] = {1, 0, -1, -1, -1, -1, 3, 2, -1, -1, 5, -1, -1, 4, -1, -1};
+    inline constexpr EnumerationHash IfcEventTriggerTypeEnum_hash = {IfcEventTriggerTypeEnum_, IfcEventTriggerTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcEventTypeEnum_[] = {"STARTEVENT", "ENDEVENT", "INTERMEDIATEEVENT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcEventTypeEnum_slots[] = {-1, -1, -1, -1, -1, -1, -1, -1, 2, 0, 4, 1, -1, 3, -1, -1};
+    inline constexpr EnumerationHash IfcEventTypeEnum_hash = {IfcEventTypeEnum_, IfcEventTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcExternalSpatialElementTypeEnum_[] = {"EXTERNAL", "EXTERNAL_EARTH", "EXTERNAL_WATER", "EXTERNAL_FIRE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcExternalSpatialElementTypeEnum_slots[] = {-1, -1, 1, -1, -1, 4, -1, -1, 2, -1, -1, 3, -1, 5, 0, -1};
+    inline constexpr EnumerationHash IfcExternalSpatialElementTypeEnum_hash = {IfcExternalSpatialElementTypeEnum_, IfcExternalSpatialElementTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcFanTypeEnum_[] = {"CENTRIFUGALFORWARDCURVED", "CENTRIFUGALRADIAL", "CENTRIFUGALBACKWARDINCLINEDCURVED", "CENTRIFUGALAIRFOIL", "TUBEAXIAL", "VANEAXIAL", "PROPELLORAXIAL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcFanTypeEnum_slots[] = {-1, -1, -1, -1, 1, -1, -1, 2, -1, 8, 4, 7, -1, -1, -1, -1, -1, 5, 6, 0, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcFanTypeEnum_hash = {IfcFanTypeEnum_, IfcFanTypeEnum_slots, 4u, 31u};
+    inline TextValue IfcFastenerTypeEnum_[] = {"GLUE", "MORTAR", "WELD", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcFastenerTypeEnum_slots[] = {-1, -1, -1, 0, -1, 3, -1, -1, -1, -1, 2, -1, -1, -1, 4, 1};
+    inline constexpr EnumerationHash IfcFastenerTypeEnum_hash = {IfcFastenerTypeEnum_, IfcFastenerTypeEnum_slots, 5u, 15u};
+    inline TextValue IfcFilterTypeEnum_[] = {"AIRPARTICLEFILTER", "COMPRESSEDAIRFILTER", "ODORFILTER", "OILFILTER", "STRAINER", "WATERFILTER", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcFilterTypeEnum_slots[] = {1, 0, 3, -1, 2, -1, -1, -1, -1, 7, 5, 6, 4, -1, -1, -1};
+    inline constexpr EnumerationHash IfcFilterTypeEnum_hash = {IfcFilterTypeEnum_, IfcFilterTypeEnum_slots, 4u, 15u};
+    inline TextValue IfcFireSuppressionTerminalTypeEnum_[] = {"BREECHINGINLET", "FIREHYDRANT", "HOSEREEL", "SPRINKLER", "SPRINKLERDEFLECTOR", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcFireSuppressionTerminalTypeEnum_slots[] = {-1, 3, -1, 2, -1, -1, 1, 0, -1, 4, 6, -1, -1, 5, -1, -1};
+    inline constexpr EnumerationHash IfcFireSuppressionTerminalTypeEnum_hash = {IfcFireSuppressionTerminalTypeEnum_, IfcFireSuppressionTerminalTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcFlowDirectionEnum_[] = {"SOURCE", "SINK", "SOURCEANDSINK", "NOTDEFINED", NULL};
+    inline constexpr short IfcFlowDirectionEnum_slots[] = {-1, 2, 0, -1, -1, 1, -1, 3};
+    inline constexpr EnumerationHash IfcFlowDirectionEnum_hash = {IfcFlowDirectionEnum_, IfcFlowDirectionEnum_slots, 0u, 7u};
+    inline TextValue IfcFlowInstrumentTypeEnum_[] = {"PRESSUREGAUGE", "THERMOMETER", "AMMETER", "FREQUENCYMETER", "POWERFACTORMETER", "PHASEANGLEMETER", "VOLTMETER_PEAK", "VOLTMETER_RMS", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcFlowInstrumentTypeEnum_slots[] = {-1, 1, -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, 7, 0, -1, -1, -1, 8, -1, 5, 2, -1, -1, -1, -1, -1, 9, 6};
+    inline constexpr EnumerationHash IfcFlowInstrumentTypeEnum_hash = {IfcFlowInstrumentTypeEnum_, IfcFlowInstrumentTypeEnum_slots, 5u, 31u};
+    inline TextValue IfcFlowMeterTypeEnum_[] = {"ENERGYMETER", "GASMETER", "OILMETER", "WATERMETER", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcFlowMeterTypeEnum_slots[] = {-1, -1, -1, -1, 2, 3, 0, -1, -1, 1, 5, -1, -1, 4, -1, -1};
+    inline constexpr EnumerationHash IfcFlowMeterTypeEnum_hash = {IfcFlowMeterTypeEnum_, IfcFlowMeterTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcFootingTypeEnum_[] = {"CAISSON_FOUNDATION", "FOOTING_BEAM", "PAD_FOOTING", "PILE_CAP", "STRIP_FOOTING", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcFootingTypeEnum_slots[] = {3, 2, -1, -1, -1, 5, 4, 1, -1, -1, 0, -1, -1, 6, -1, -1};
+    inline constexpr EnumerationHash IfcFootingTypeEnum_hash = {IfcFootingTypeEnum_, IfcFootingTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcFurnitureTypeEnum_[] = {"CHAIR", "TABLE", "DESK", "BED", "FILECABINET", "SHELF", "SOFA", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcFurnitureTypeEnum_slots[] = {0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 8, -1, -1, -1, -1, -1, -1, 3, 5, 2, -1, -1, 4, -1, 1, -1, -1, 6, -1, 7, -1, -1};
+    inline constexpr EnumerationHash IfcFurnitureTypeEnum_hash = {IfcFurnitureTypeEnum_, IfcFurnitureTypeEnum_slots, 1u, 31u};
+    inline TextValue IfcGeographicElementTypeEnum_[] = {"TERRAIN", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcGeographicElementTypeEnum_slots[] = {2, 1, -1, -1, -1, 0, -1, -1};
+    inline constexpr EnumerationHash IfcGeographicElementTypeEnum_hash = {IfcGeographicElementTypeEnum_, IfcGeographicElementTypeEnum_slots, 3u, 7u};
+    inline TextValue IfcGeometricProjectionEnum_[] = {"GRAPH_VIEW", "SKETCH_VIEW", "MODEL_VIEW", "PLAN_VIEW", "REFLECTED_PLAN_VIEW", "SECTION_VIEW", "ELEVATION_VIEW", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcGeometricProjectionEnum_slots[] = {1, 2, -1, -1, -1, -1, -1, -1, -1, -1, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, -1, 3, 6, -1, -1, -1, -1, 5, 7, 0, -1};
+    inline constexpr EnumerationHash IfcGeometricProjectionEnum_hash = {IfcGeometricProjectionEnum_, IfcGeometricProjectionEnum_slots, 1u, 31u};
+    inline TextValue IfcGlobalOrLocalEnum_[] = {"GLOBAL_COORDS", "LOCAL_COORDS", NULL};
+    inline constexpr short IfcGlobalOrLocalEnum_slots[] = {1, 0, -1, -1};
+    inline constexpr EnumerationHash IfcGlobalOrLocalEnum_hash = {IfcGlobalOrLocalEnum_, IfcGlobalOrLocalEnum_slots, 0u, 3u};
+    inline TextValue IfcGridTypeEnum_[] = {"RECTANGULAR", "RADIAL", "TRIANGULAR", "IRREGULAR", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcGridTypeEnum_slots[] = {5, 4, 1, -1, 3, 0, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1};
+    inline constexpr EnumerationHash IfcGridTypeEnum_hash = {IfcGridTypeEnum_, IfcGridTypeEnum_slots, 3u, 15u};
+    inline TextValue IfcHeatExchangerTypeEnum_[] = {"PLATE", "SHELLANDTUBE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcHeatExchangerTypeEnum_slots[] = {1, 0, 3, -1, -1, 2, -1, -1};
+    inline constexpr EnumerationHash IfcHeatExchangerTypeEnum_hash = {IfcHeatExchangerTypeEnum_, IfcHeatExchangerTypeEnum_slots, 1u, 7u};
+    inline TextValue IfcHumidifierTypeEnum_[] = {"STEAMINJECTION", "ADIABATICAIRWASHER", "ADIABATICPAN", "ADIABATICWETTEDELEMENT", "ADIABATICATOMIZING", "ADIABATICULTRASONIC", "ADIABATICRIGIDMEDIA", "ADIABATICCOMPRESSEDAIRNOZZLE", "ASSISTEDELECTRIC", "ASSISTEDNATURALGAS", "ASSISTEDPROPANE", "ASSISTEDBUTANE", "ASSISTEDSTEAM", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcHumidifierTypeEnum_slots[] = {-1, 1, -1, 7, 9, 14, -1, 6, -1, -1, 0, -1, 11, 10, -1, -1, 2, -1, -1, -1, 4, -1, -1, -1, -1, 8, 3, 5, 13, 12, -1, -1};
+    inline constexpr EnumerationHash IfcHumidifierTypeEnum_hash = {IfcHumidifierTypeEnum_, IfcHumidifierTypeEnum_slots, 47u, 31u};
+    inline TextValue IfcInterceptorTypeEnum_[] = {"CYCLONIC", "GREASE", "OIL", "PETROL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcInterceptorTypeEnum_slots[] = {-1, 1, -1, 3, -1, 2, -1, -1, -1, 5, -1, 4, -1, -1, -1, 0};
+    inline constexpr EnumerationHash IfcInterceptorTypeEnum_hash = {IfcInterceptorTypeEnum_, IfcInterceptorTypeEnum_slots, 4u, 15u};
+    inline TextValue IfcInternalOrExternalEnum_[] = {"INTERNAL", "EXTERNAL", "EXTERNAL_EARTH", "EXTERNAL_WATER", "EXTERNAL_FIRE", "NOTDEFINED", NULL};
+    inline constexpr short IfcInternalOrExternalEnum_slots[] = {0, -1, -1, -1, -1, -1, -1, 3, -1, 1, 5, -1, 4, 2, -1, -1};
+    inline constexpr EnumerationHash IfcInternalOrExternalEnum_hash = {IfcInternalOrExternalEnum_, IfcInternalOrExternalEnum_slots, 1u, 15u};
+    inline TextValue IfcInventoryTypeEnum_[] = {"ASSETINVENTORY", "SPACEINVENTORY", "FURNITUREINVENTORY", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcInventoryTypeEnum_slots[] = {-1, 1, -1, 0, -1, 2, -1, -1, -1, -1, 4, -1, -1, 3, -1, -1};
+    inline constexpr EnumerationHash IfcInventoryTypeEnum_hash = {IfcInventoryTypeEnum_, IfcInventoryTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcJunctionBoxTypeEnum_[] = {"DATA", "POWER", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcJunctionBoxTypeEnum_slots[] = {3, 2, -1, -1, -1, 1, -1, 0};
+    inline constexpr EnumerationHash IfcJunctionBoxTypeEnum_hash = {IfcJunctionBoxTypeEnum_, IfcJunctionBoxTypeEnum_slots, 3u, 7u};
+    inline TextValue IfcKnotType_[] = {"UNIFORM_KNOTS", "QUASI_UNIFORM_KNOTS", "PIECEWISE_BEZIER_KNOTS", "UNSPECIFIED", NULL};
+    inline constexpr short IfcKnotType_slots[] = {-1, 3, -1, -1, 2, 1, 0, -1};
+    inline constexpr EnumerationHash IfcKnotType_hash = {IfcKnotType_, IfcKnotType_slots, 0u, 7u};
+    inline TextValue IfcLaborResourceTypeEnum_[] = {"ADMINISTRATION", "CARPENTRY", "CLEANING", "CONCRETE", "DRYWALL", "ELECTRIC", "FINISHING", "FLOORING", "GENERAL", "HVAC", "LANDSCAPING", "MASONRY", "PAINTING", "PAVING", "PLUMBING", "ROOFING", "SITEGRADING", "STEELWORK", "SURVEYING", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcLaborResourceTypeEnum_slots[] = {-1, -1, -1, -1, 3, 19, -1, -1, -1, 1, -1, -1, -1, 20, -1, -1, -1, -1, 5, -1, 11, -1, -1, -1, -1, -1, 13, 12, 6, -1, -1, 4, 17, -1, -1, -1, -1, 10, -1, 2, 9, 15, 7, 0, -1, -1, -1, 16, -1, -1, -1, -1, -1, 14, 18, -1, 8, -1, -1, -1, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcLaborResourceTypeEnum_hash = {IfcLaborResourceTypeEnum_, IfcLaborResourceTypeEnum_slots, 2u, 63u};
+    inline TextValue IfcLampTypeEnum_[] = {"COMPACTFLUORESCENT", "FLUORESCENT", "HALOGEN", "HIGHPRESSUREMERCURY", "HIGHPRESSURESODIUM", "LED", "METALHALIDE", "OLED", "TUNGSTENFILAMENT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcLampTypeEnum_slots[] = {8, 5, -1, -1, -1, 9, 3, -1, -1, -1, 7, -1, -1, 10, -1, -1, -1, -1, -1, 2, -1, -1, 1, -1, -1, -1, -1, 4, 6, -1, -1, 0};
+    inline constexpr EnumerationHash IfcLampTypeEnum_hash = {IfcLampTypeEnum_, IfcLampTypeEnum_slots, 2u, 31u};
+    inline TextValue IfcLayerSetDirectionEnum_[] = {"AXIS1", "AXIS2", "AXIS3", NULL};
+    inline constexpr short IfcLayerSetDirectionEnum_slots[] = {-1, 0, -1, 2, 1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcLayerSetDirectionEnum_hash = {IfcLayerSetDirectionEnum_, IfcLayerSetDirectionEnum_slots, 0u, 7u};
+    inline TextValue IfcLightDistributionCurveEnum_[] = {"TYPE_A", "TYPE_B", "TYPE_C", "NOTDEFINED", NULL};
+    inline constexpr short IfcLightDistributionCurveEnum_slots[] = {-1, -1, -1, -1, 0, 1, 2, 3};
+    inline constexpr EnumerationHash IfcLightDistributionCurveEnum_hash = {IfcLightDistributionCurveEnum_, IfcLightDistributionCurveEnum_slots, 0u, 7u};
+    inline TextValue IfcLightEmissionSourceEnum_[] = {"COMPACTFLUORESCENT", "FLUORESCENT", "HIGHPRESSUREMERCURY", "HIGHPRESSURESODIUM", "LIGHTEMITTINGDIODE", "LOWPRESSURESODIUM", "LOWVOLTAGEHALOGEN", "MAINVOLTAGEHALOGEN", "METALHALIDE", "TUNGSTENFILAMENT", "NOTDEFINED", NULL};
+    inline constexpr short IfcLightEmissionSourceEnum_slots[] = {9, -1, -1, -1, 5, -1, 2, 7, -1, -1, -1, -1, -1, 10, -1, -1, -1, -1, -1, -1, -1, 6, 1, -1, 4, -1, -1, 3, 8, -1, -1, 0};
+    inline constexpr EnumerationHash IfcLightEmissionSourceEnum_hash = {IfcLightEmissionSourceEnum_, IfcLightEmissionSourceEnum_slots, 2u, 31u};
+    inline TextValue IfcLightFixtureTypeEnum_[] = {"POINTSOURCE", "DIRECTIONSOURCE", "SECURITYLIGHTING", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcLightFixtureTypeEnum_slots[] = {4, 3, -1, 2, -1, -1, -1, -1, -1, -1, 1, 0, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcLightFixtureTypeEnum_hash = {IfcLightFixtureTypeEnum_, IfcLightFixtureTypeEnum_slots, 3u, 15u};
+    inline TextValue IfcLoadGroupTypeEnum_[] = {"LOAD_GROUP", "LOAD_CASE", "LOAD_COMBINATION", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcLoadGroupTypeEnum_slots[] = {4, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, 1, 0, -1};
+    inline constexpr EnumerationHash IfcLoadGroupTypeEnum_hash = {IfcLoadGroupTypeEnum_, IfcLoadGroupTypeEnum_slots, 3u, 15u};
+    inline TextValue IfcLogicalOperatorEnum_[] = {"LOGICALAND", "LOGICALOR", "LOGICALXOR", "LOGICALNOTAND", "LOGICALNOTOR", NULL};
+    inline constexpr short IfcLogicalOperatorEnum_slots[] = {-1, -1, -1, -1, -1, 1, -1, 3, -1, 0, -1, -1, -1, 2, -1, 4};
+    inline constexpr EnumerationHash IfcLogicalOperatorEnum_hash = {IfcLogicalOperatorEnum_, IfcLogicalOperatorEnum_slots, 1u, 15u};
+    inline TextValue IfcMechanicalFastenerTypeEnum_[] = {"ANCHORBOLT", "BOLT", "DOWEL", "NAIL", "NAILPLATE", "RIVET", "SCREW", "SHEARCONNECTOR", "STAPLE", "STUDSHEARCONNECTOR", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcMechanicalFastenerTypeEnum_slots[] = {3, -1, 1, -1, -1, 10, 0, -1, -1, 2, -1, 6, -1, 11, -1, -1, 7, 5, 4, -1, -1, -1, -1, -1, -1, -1, -1, 9, 8, -1, -1, -1};
+    inline constexpr EnumerationHash IfcMechanicalFastenerTypeEnum_hash = {IfcMechanicalFastenerTypeEnum_, IfcMechanicalFastenerTypeEnum_slots, 2u, 31u};
+    inline TextValue IfcMedicalDeviceTypeEnum_[] = {"AIRSTATION", "FEEDAIRUNIT", "OXYGENGENERATOR", "OXYGENPLANT", "VACUUMSTATION", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcMedicalDeviceTypeEnum_slots[] = {-1, -1, -1, 3, 2, 1, 4, 5, -1, -1, -1, -1, -1, 6, -1, 0};
+    inline constexpr EnumerationHash IfcMedicalDeviceTypeEnum_hash = {IfcMedicalDeviceTypeEnum_, IfcMedicalDeviceTypeEnum_slots, 10u, 15u};
+    inline TextValue IfcMemberTypeEnum_[] = {"BRACE", "CHORD", "COLLAR", "MEMBER", "MULLION", "PLATE", "POST", "PURLIN", "RAFTER", "STRINGER", "STRUT", "STUD", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcMemberTypeEnum_slots[] = {-1, 4, -1, -1, 11, -1, -1, -1, -1, -1, -1, -1, 7, -1, -1, 1, 10, 13, -1, 12, -1, 0, 6, -1, -1, -1, -1, 9, 5, 8, 2, 3};
+    inline constexpr EnumerationHash IfcMemberTypeEnum_hash = {IfcMemberTypeEnum_, IfcMemberTypeEnum_slots, 15u, 31u};
+    inline TextValue IfcMotorConnectionTypeEnum_[] = {"BELTDRIVE", "COUPLING", "DIRECTDRIVE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcMotorConnectionTypeEnum_slots[] = {-1, -1, -1, -1, 1, -1, -1, -1, -1, -1, 4, 2, -1, 3, -1, 0};
+    inline constexpr EnumerationHash IfcMotorConnectionTypeEnum_hash = {IfcMotorConnectionTypeEnum_, IfcMotorConnectionTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcNullStyle_[] = {"NULL", NULL};
+    inline constexpr short IfcNullStyle_slots[] = {-1, -1, -1, 0};
+    inline constexpr EnumerationHash IfcNullStyle_hash = {IfcNullStyle_, IfcNullStyle_slots, 0u, 3u};
+    inline TextValue IfcObjectiveEnum_[] = {"CODECOMPLIANCE", "CODEWAIVER", "DESIGNINTENT", "EXTERNAL", "HEALTHANDSAFETY", "MERGECONFLICT", "MODELVIEW", "PARAMETER", "REQUIREMENT", "SPECIFICATION", "TRIGGERCONDITION", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcObjectiveEnum_slots[] = {7, 6, 2, -1, 1, 12, 4, -1, -1, -1, -1, -1, -1, -1, 8, -1, -1, -1, -1, 3, 9, 0, -1, -1, 5, -1, -1, -1, 11, -1, -1, 10};
+    inline constexpr EnumerationHash IfcObjectiveEnum_hash = {IfcObjectiveEnum_, IfcObjectiveEnum_slots, 51u, 31u};
+    inline TextValue IfcObjectTypeEnum_[] = {"PRODUCT", "PROCESS", "CONTROL", "RESOURCE", "ACTOR", "GROUP", "PROJECT", "NOTDEFINED", NULL};
+    inline constexpr short IfcObjectTypeEnum_slots[] = {-1, 0, -1, -1, 5, -1, -1, -1, 2, -1, 7, 1, -1, 4, 6, 3};
+    inline constexpr EnumerationHash IfcObjectTypeEnum_hash = {IfcObjectTypeEnum_, IfcObjectTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcOccupantTypeEnum_[] = {"ASSIGNEE", "ASSIGNOR", "LESSEE", "LESSOR", "LETTINGAGENT", "OWNER", "TENANT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcOccupantTypeEnum_slots[] = {-1, -1, -1, -1, 0, 7, -1, -1, -1, 4, -1, -1, -1, 8, -1, -1, -1, -1, -1, -1, 2, -1, 1, -1, -1, 6, -1, 3, -1, -1, -1, 5};
+    inline constexpr EnumerationHash IfcOccupantTypeEnum_hash = {IfcOccupantTypeEnum_, IfcOccupantTypeEnum_slots, 2u, 31u};
+    inline TextValue IfcOpeningElementTypeEnum_[] = {"OPENING", "RECESS", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcOpeningElementTypeEnum_slots[] = {-1, 3, -1, 2, 1, -1, -1, 0};
+    inline constexpr EnumerationHash IfcOpeningElementTypeEnum_hash = {IfcOpeningElementTypeEnum_, IfcOpeningElementTypeEnum_slots, 4u, 7u};
+    inline TextValue IfcOutletTypeEnum_[] = {"AUDIOVISUALOUTLET", "COMMUNICATIONSOUTLET", "POWEROUTLET", "DATAOUTLET", "TELEPHONEOUTLET", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcOutletTypeEnum_slots[] = {6, 5, -1, -1, -1, -1, -1, 1, -1, 2, 3, -1, 4, -1, 0, -1};
+    inline constexpr EnumerationHash IfcOutletTypeEnum_hash = {IfcOutletTypeEnum_, IfcOutletTypeEnum_slots, 3u, 15u};
+    inline TextValue IfcPerformanceHistoryTypeEnum_[] = {"USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcPerformanceHistoryTypeEnum_slots[] = {-1, 0, 1, -1};
+    inline constexpr EnumerationHash IfcPerformanceHistoryTypeEnum_hash = {IfcPerformanceHistoryTypeEnum_, IfcPerformanceHistoryTypeEnum_slots, 1u, 3u};
+    inline TextValue IfcPermeableCoveringOperationEnum_[] = {"GRILL", "LOUVER", "SCREEN", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcPermeableCoveringOperationEnum_slots[] = {-1, -1, -1, 2, -1, 0, -1, -1, -1, 1, 4, -1, -1, 3, -1, -1};
+    inline constexpr EnumerationHash IfcPermeableCoveringOperationEnum_hash = {IfcPermeableCoveringOperationEnum_, IfcPermeableCoveringOperationEnum_slots, 1u, 15u};
+    inline TextValue IfcPermitTypeEnum_[] = {"ACCESS", "BUILDING", "WORK", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcPermitTypeEnum_slots[] = {-1, -1, -1, -1, -1, 3, 0, 1, -1, -1, -1, 2, -1, 4, -1, -1};
+    inline constexpr EnumerationHash IfcPermitTypeEnum_hash = {IfcPermitTypeEnum_, IfcPermitTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcPhysicalOrVirtualEnum_[] = {"PHYSICAL", "VIRTUAL", "NOTDEFINED", NULL};
+    inline constexpr short IfcPhysicalOrVirtualEnum_slots[] = {-1, -1, 1, -1, -1, -1, 0, 2};
+    inline constexpr EnumerationHash IfcPhysicalOrVirtualEnum_hash = {IfcPhysicalOrVirtualEnum_, IfcPhysicalOrVirtualEnum_slots, 0u, 7u};
+    inline TextValue IfcPileConstructionEnum_[] = {"CAST_IN_PLACE", "COMPOSITE", "PRECAST_CONCRETE", "PREFAB_STEEL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcPileConstructionEnum_slots[] = {-1, 3, -1, -1, -1, 0, -1, -1, 1, -1, 5, -1, -1, 4, -1, 2};
+    inline constexpr EnumerationHash IfcPileConstructionEnum_hash = {IfcPileConstructionEnum_, IfcPileConstructionEnum_slots, 1u, 15u};
+    inline TextValue IfcPileTypeEnum_[] = {"BORED", "DRIVEN", "JETGROUTING", "COHESION", "FRICTION", "SUPPORT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcPileTypeEnum_slots[] = {-1, 5, -1, -1, 4, 1, -1, -1, -1, 7, 3, 6, 2, -1, 0, -1};
+    inline constexpr EnumerationHash IfcPileTypeEnum_hash = {IfcPileTypeEnum_, IfcPileTypeEnum_slots, 4u, 15u};
+    inline TextValue IfcPipeFittingTypeEnum_[] = {"BEND", "CONNECTOR", "ENTRY", "EXIT", "JUNCTION", "OBSTRUCTION", "TRANSITION", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcPipeFittingTypeEnum_slots[] = {-1, -1, -1, -1, -1, -1, 4, -1, -1, -1, 8, -1, -1, 3, -1, 5, -1, 1, -1, -1, 2, -1, -1, 0, -1, -1, -1, -1, -1, 7, 6, -1};
+    inline constexpr EnumerationHash IfcPipeFittingTypeEnum_hash = {IfcPipeFittingTypeEnum_, IfcPipeFittingTypeEnum_slots, 1u, 31u};
+    inline TextValue IfcPipeSegmentTypeEnum_[] = {"CULVERT", "FLEXIBLESEGMENT", "RIGIDSEGMENT", "GUTTER", "SPOOL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcPipeSegmentTypeEnum_slots[] = {4, 3, 1, -1, -1, 5, -1, -1, -1, -1, -1, 2, -1, 0, 6, -1};
+    inline constexpr EnumerationHash IfcPipeSegmentTypeEnum_hash = {IfcPipeSegmentTypeEnum_, IfcPipeSegmentTypeEnum_slots, 5u, 15u};
+    inline TextValue IfcPlateTypeEnum_[] = {"CURTAIN_PANEL", "SHEET", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcPlateTypeEnum_slots[] = {-1, -1, 3, -1, 0, 2, -1, 1};
+    inline constexpr EnumerationHash IfcPlateTypeEnum_hash = {IfcPlateTypeEnum_, IfcPlateTypeEnum_slots, 1u, 7u};
+    inline TextValue IfcPreferredSurfaceCurveRepresentation_[] = {"CURVE3D", "PCURVE_S1", "PCURVE_S2", NULL};
+    inline constexpr short IfcPreferredSurfaceCurveRepresentation_slots[] = {-1, 2, 0, -1, 1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcPreferredSurfaceCurveRepresentation_hash = {IfcPreferredSurfaceCurveRepresentation_, IfcPreferredSurfaceCurveRepresentation_slots, 0u, 7u};
+    inline TextValue IfcProcedureTypeEnum_[] = {"ADVICE_CAUTION", "ADVICE_NOTE", "ADVICE_WARNING", "CALIBRATION", "DIAGNOSTIC", "SHUTDOWN", "STARTUP", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcProcedureTypeEnum_slots[] = {-1, -1, 0, 6, -1, -1, 5, 4, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 7, 8, -1, -1, -1, -1, 2, -1, 1, -1, -1};
+    inline constexpr EnumerationHash IfcProcedureTypeEnum_hash = {IfcProcedureTypeEnum_, IfcProcedureTypeEnum_slots, 6u, 31u};
+    inline TextValue IfcProfileTypeEnum_[] = {"CURVE", "AREA", NULL};
+    inline constexpr short IfcProfileTypeEnum_slots[] = {1, -1, 0, -1};
+    inline constexpr EnumerationHash IfcProfileTypeEnum_hash = {IfcProfileTypeEnum_, IfcProfileTypeEnum_slots, 0u, 3u};
+    inline TextValue IfcProjectedOrTrueLengthEnum_[] = {"PROJECTED_LENGTH", "TRUE_LENGTH", NULL};
+    inline constexpr short IfcProjectedOrTrueLengthEnum_slots[] = {0, 1, -1, -1};
+    inline constexpr EnumerationHash IfcProjectedOrTrueLengthEnum_hash = {IfcProjectedOrTrueLengthEnum_, IfcProjectedOrTrueLengthEnum_slots, 0u, 3u};
+    inline TextValue IfcProjectionElementTypeEnum_[] = {"USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcProjectionElementTypeEnum_slots[] = {-1, 0, 1, -1};
+    inline constexpr EnumerationHash IfcProjectionElementTypeEnum_hash = {IfcProjectionElementTypeEnum_, IfcProjectionElementTypeEnum_slots, 1u, 3u};
+    inline TextValue IfcProjectOrderTypeEnum_[] = {"CHANGEORDER", "MAINTENANCEWORKORDER", "MOVEORDER", "PURCHASEORDER", "WORKORDER", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcProjectOrderTypeEnum_slots[] = {0, 2, 4, -1, -1, -1, 1, -1, -1, 6, -1, 5, -1, -1, 3, -1};
+    inline constexpr EnumerationHash IfcProjectOrderTypeEnum_hash = {IfcProjectOrderTypeEnum_, IfcProjectOrderTypeEnum_slots, 4u, 15u};
+    inline TextValue IfcPropertySetTemplateTypeEnum_[] = {"PSET_TYPEDRIVENONLY", "PSET_TYPEDRIVENOVERRIDE", "PSET_OCCURRENCEDRIVEN", "PSET_PERFORMANCEDRIVEN", "QTO_TYPEDRIVENONLY", "QTO_TYPEDRIVENOVERRIDE", "QTO_OCCURRENCEDRIVEN", "NOTDEFINED", NULL};
+    inline constexpr short IfcPropertySetTemplateTypeEnum_slots[] = {-1, -1, 5, -1, 1, -1, 7, 3, 6, 4, 2, -1, -1, -1, -1, 0};
+    inline constexpr EnumerationHash IfcPropertySetTemplateTypeEnum_hash = {IfcPropertySetTemplateTypeEnum_, IfcPropertySetTemplateTypeEnum_slots, 13u, 15u};
+    inline TextValue IfcProtectiveDeviceTrippingUnitTypeEnum_[] = {"ELECTRONIC", "ELECTROMAGNETIC", "RESIDUALCURRENT", "THERMAL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcProtectiveDeviceTrippingUnitTypeEnum_slots[] = {-1, -1, -1, -1, 1, 4, -1, 3, -1, -1, -1, -1, 2, 5, -1, 0};
+    inline constexpr EnumerationHash IfcProtectiveDeviceTrippingUnitTypeEnum_hash = {IfcProtectiveDeviceTrippingUnitTypeEnum_, IfcProtectiveDeviceTrippingUnitTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcProtectiveDeviceTypeEnum_[] = {"CIRCUITBREAKER", "EARTHLEAKAGECIRCUITBREAKER", "EARTHINGSWITCH", "FUSEDISCONNECTOR", "RESIDUALCURRENTCIRCUITBREAKER", "RESIDUALCURRENTSWITCH", "VARISTOR", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcProtectiveDeviceTypeEnum_slots[] = {-1, -1, -1, -1, -1, -1, 4, -1, 3, 8, -1, 7, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, 5, -1, 0, 6, -1, 2, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcProtectiveDeviceTypeEnum_hash = {IfcProtectiveDeviceTypeEnum_, IfcProtectiveDeviceTypeEnum_slots, 4u, 31u};
+    inline TextValue IfcPumpTypeEnum_[] = {"CIRCULATOR", "ENDSUCTION", "SPLITCASE", "SUBMERSIBLEPUMP", "SUMPPUMP", "VERTICALINLINE", "VERTICALTURBINE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcPumpTypeEnum_slots[] = {-1, -1, 5, -1, -1, -1, -1, 7, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6, 1, 0, 8, -1, -1, -1, 4, 3, -1, -1, -1};
+    inline constexpr EnumerationHash IfcPumpTypeEnum_hash = {IfcPumpTypeEnum_, IfcPumpTypeEnum_slots, 0u, 31u};
+    inline TextValue IfcRailingTypeEnum_[] = {"HANDRAIL", "GUARDRAIL", "BALUSTRADE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcRailingTypeEnum_slots[] = {-1, -1, -1, -1, 1, 3, -1, -1, -1, 2, -1, -1, -1, 4, 0, -1};
+    inline constexpr EnumerationHash IfcRailingTypeEnum_hash = {IfcRailingTypeEnum_, IfcRailingTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcRampFlightTypeEnum_[] = {"STRAIGHT", "SPIRAL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcRampFlightTypeEnum_slots[] = {3, 2, -1, -1, 1, -1, -1, 0};
+    inline constexpr EnumerationHash IfcRampFlightTypeEnum_hash = {IfcRampFlightTypeEnum_, IfcRampFlightTypeEnum_slots, 3u, 7u};
+    inline TextValue IfcRampTypeEnum_[] = {"STRAIGHT_RUN_RAMP", "TWO_STRAIGHT_RUN_RAMP", "QUARTER_TURN_RAMP", "TWO_QUARTER_TURN_RAMP", "HALF_TURN_RAMP", "SPIRAL_RAMP", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcRampTypeEnum_slots[] = {7, 6, -1, 5, 1, -1, 2, 4, -1, 3, -1, 0, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcRampTypeEnum_hash = {IfcRampTypeEnum_, IfcRampTypeEnum_slots, 3u, 15u};
+    inline TextValue IfcRecurrenceTypeEnum_[] = {"DAILY", "WEEKLY", "MONTHLY_BY_DAY_OF_MONTH", "MONTHLY_BY_POSITION", "BY_DAY_COUNT", "BY_WEEKDAY_COUNT", "YEARLY_BY_DAY_OF_MONTH", "YEARLY_BY_POSITION", NULL};
+    inline constexpr short IfcRecurrenceTypeEnum_slots[] = {7, 6, 0, -1, 2, -1, 1, -1, 3, -1, -1, 5, -1, -1, 4, -1};
+    inline constexpr EnumerationHash IfcRecurrenceTypeEnum_hash = {IfcRecurrenceTypeEnum_, IfcRecurrenceTypeEnum_slots, 3u, 15u};
+    inline TextValue IfcReflectanceMethodEnum_[] = {"BLINN", "FLAT", "GLASS", "MATT", "METAL", "MIRROR", "PHONG", "PLASTIC", "STRAUSS", "NOTDEFINED", NULL};
+    inline constexpr short IfcReflectanceMethodEnum_slots[] = {-1, 0, 7, -1, -1, -1, -1, -1, 5, 4, -1, -1, -1, 9, 1, -1, 2, 3, 6, -1, -1, -1, -1, -1, -1, -1, 8, -1, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcReflectanceMethodEnum_hash = {IfcReflectanceMethodEnum_, IfcReflectanceMethodEnum_slots, 2u, 31u};
+    inline TextValue IfcReinforcingBarRoleEnum_[] = {"MAIN", "SHEAR", "LIGATURE", "STUD", "PUNCHING", "EDGE", "RING", "ANCHORING", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcReinforcingBarRoleEnum_slots[] = {0, -1, -1, -1, -1, 1, -1, 4, -1, -1, -1, 9, -1, -1, -1, -1, -1, -1, 5, 7, -1, -1, -1, -1, -1, 2, -1, 6, -1, 3, -1, 8};
+    inline constexpr EnumerationHash IfcReinforcingBarRoleEnum_hash = {IfcReinforcingBarRoleEnum_, IfcReinforcingBarRoleEnum_slots, 11u, 31u};
+    inline TextValue IfcReinforcingBarSurfaceEnum_[] = {"PLAIN", "TEXTURED", NULL};
+    inline constexpr short IfcReinforcingBarSurfaceEnum_slots[] = {-1, -1, 1, 0};
+    inline constexpr EnumerationHash IfcReinforcingBarSurfaceEnum_hash = {IfcReinforcingBarSurfaceEnum_, IfcReinforcingBarSurfaceEnum_slots, 0u, 3u};
+    inline TextValue IfcReinforcingBarTypeEnum_[] = {"ANCHORING", "EDGE", "LIGATURE", "MAIN", "PUNCHING", "RING", "SHEAR", "STUD", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcReinforcingBarTypeEnum_slots[] = {3, -1, -1, -1, -1, 6, -1, 4, -1, -1, -1, 9, -1, -1, -1, -1, -1, -1, 1, 0, -1, -1, -1, -1, -1, 2, -1, 5, -1, 7, -1, 8};
+    inline constexpr EnumerationHash IfcReinforcingBarTypeEnum_hash = {IfcReinforcingBarTypeEnum_, IfcReinforcingBarTypeEnum_slots, 11u, 31u};
+    inline TextValue IfcReinforcingMeshTypeEnum_[] = {"USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcReinforcingMeshTypeEnum_slots[] = {-1, 0, 1, -1};
+    inline constexpr EnumerationHash IfcReinforcingMeshTypeEnum_hash = {IfcReinforcingMeshTypeEnum_, IfcReinforcingMeshTypeEnum_slots, 1u, 3u};
+    inline TextValue IfcRoleEnum_[] = {"SUPPLIER", "MANUFACTURER", "CONTRACTOR", "SUBCONTRACTOR", "ARCHITECT", "STRUCTURALENGINEER", "COSTENGINEER", "CLIENT", "BUILDINGOWNER", "BUILDINGOPERATOR", "MECHANICALENGINEER", "ELECTRICALENGINEER", "PROJECTMANAGER", "FACILITIESMANAGER", "CIVILENGINEER", "COMMISSIONINGENGINEER", "ENGINEER", "OWNER", "CONSULTANT", "CONSTRUCTIONMANAGER", "FIELDCONSTRUCTIONMANAGER", "RESELLER", "USERDEFINED", NULL};
+    inline constexpr short IfcRoleEnum_slots[] = {-1, -1, 16, -1, -1, 19, -1, -1, -1, -1, -1, -1, -1, -1, 12, -1, 7, 22, -1, 8, -1, -1, -1, 9, -1, 1, -1, -1, 4, 21, -1, -1, -1, 18, 6, -1, -1, -1, -1, -1, -1, 17, -1, -1, 10, 14, 15, -1, -1, 0, 11, -1, -1, 3, -1, 2, -1, -1, -1, -1, 13, -1, 5, 20};
+    inline constexpr EnumerationHash IfcRoleEnum_hash = {IfcRoleEnum_, IfcRoleEnum_slots, 3u, 63u};
+    inline TextValue IfcRoofTypeEnum_[] = {"FLAT_ROOF", "SHED_ROOF", "GABLE_ROOF", "HIP_ROOF", "HIPPED_GABLE_ROOF", "GAMBREL_ROOF", "MANSARD_ROOF", "BARREL_ROOF", "RAINBOW_ROOF", "BUTTERFLY_ROOF", "PAVILION_ROOF", "DOME_ROOF", "FREEFORM", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcRoofTypeEnum_slots[] = {-1, -1, 1, -1, 5, -1, 7, 8, -1, 4, -1, -1, -1, -1, -1, 0, 2, 3, -1, 10, -1, 6, -1, 14, 13, 9, -1, 12, -1, 11, -1, -1};
+    inline constexpr EnumerationHash IfcRoofTypeEnum_hash = {IfcRoofTypeEnum_, IfcRoofTypeEnum_slots, 81u, 31u};
+    inline TextValue IfcSanitaryTerminalTypeEnum_[] = {"BATH", "BIDET", "CISTERN", "SHOWER", "SINK", "SANITARYFOUNTAIN", "TOILETPAN", "URINAL", "WASHHANDBASIN", "WCSEAT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcSanitaryTerminalTypeEnum_slots[] = {-1, 2, 3, -1, -1, 6, -1, 10, -1, 9, -1, -1, -1, 11, 8, -1, -1, -1, 1, 7, -1, -1, 0, -1, 5, -1, -1, -1, -1, -1, -1, 4};
+    inline constexpr EnumerationHash IfcSanitaryTerminalTypeEnum_hash = {IfcSanitaryTerminalTypeEnum_, IfcSanitaryTerminalTypeEnum_slots, 10u, 31u};
+    inline TextValue IfcSectionTypeEnum_[] = {"UNIFORM", "TAPERED", NULL};
+    inline constexpr short IfcSectionTypeEnum_slots[] = {0, -1, -1, 1};
+    inline constexpr EnumerationHash IfcSectionTypeEnum_hash = {IfcSectionTypeEnum_, IfcSectionTypeEnum_slots, 1u, 3u};
+    inline TextValue IfcSensorTypeEnum_[] = {"COSENSOR", "CO2SENSOR", "CONDUCTANCESENSOR", "CONTACTSENSOR", "FIRESENSOR", "FLOWSENSOR", "FROSTSENSOR", "GASSENSOR", "HEATSENSOR", "HUMIDITYSENSOR", "IDENTIFIERSENSOR", "IONCONCENTRATIONSENSOR", "LEVELSENSOR", "LIGHTSENSOR", "MOISTURESENSOR", "MOVEMENTSENSOR", "PHSENSOR", "PRESSURESENSOR", "RADIATIONSENSOR", "RADIOACTIVITYSENSOR", "SMOKESENSOR", "SOUNDSENSOR", "TEMPERATURESENSOR", "WINDSENSOR", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcSensorTypeEnum_slots[] = {-1, -1, 19, -1, 20, -1, 15, 25, -1, -1, -1, -1, -1, -1, -1, 9, 11, -1, -1, -1, -1, -1, 24, 5, 23, -1, -1, -1, 21, -1, -1, 7, -1, 17, -1, -1, 1, 16, 8, 14, -1, 12, 6, -1, -1, -1, -1, 13, 3, -1, 18, -1, 4, 10, -1, 0, 22, -1, -1, -1, -1, 2, -1, -1};
+    inline constexpr EnumerationHash IfcSensorTypeEnum_hash = {IfcSensorTypeEnum_, IfcSensorTypeEnum_slots, 41u, 63u};
+    inline TextValue IfcSequenceEnum_[] = {"START_START", "START_FINISH", "FINISH_START", "FINISH_FINISH", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcSequenceEnum_slots[] = {2, 0, -1, -1, 1, -1, -1, -1, 3, 5, -1, 4, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcSequenceEnum_hash = {IfcSequenceEnum_, IfcSequenceEnum_slots, 4u, 15u};
+    inline TextValue IfcShadingDeviceTypeEnum_[] = {"JALOUSIE", "SHUTTER", "AWNING", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcShadingDeviceTypeEnum_slots[] = {-1, 2, 1, -1, -1, -1, -1, -1, -1, -1, 4, 0, -1, 3, -1, -1};
+    inline constexpr EnumerationHash IfcShadingDeviceTypeEnum_hash = {IfcShadingDeviceTypeEnum_, IfcShadingDeviceTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcSimplePropertyTemplateTypeEnum_[] = {"P_SINGLEVALUE", "P_ENUMERATEDVALUE", "P_BOUNDEDVALUE", "P_LISTVALUE", "P_TABLEVALUE", "P_REFERENCEVALUE", "Q_LENGTH", "Q_AREA", "Q_VOLUME", "Q_COUNT", "Q_WEIGHT", "Q_TIME", NULL};
+    inline constexpr short IfcSimplePropertyTemplateTypeEnum_slots[] = {-1, 5, 8, -1, -1, 7, -1, -1, 6, 4, 3, 11, -1, 9, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 0, -1, -1, 2, -1, -1, 10, -1};
+    inline constexpr EnumerationHash IfcSimplePropertyTemplateTypeEnum_hash = {IfcSimplePropertyTemplateTypeEnum_, IfcSimplePropertyTemplateTypeEnum_slots, 0u, 31u};
+    inline TextValue IfcSIPrefix_[] = {"EXA", "PETA", "TERA", "GIGA", "MEGA", "KILO", "HECTO", "DECA", "DECI", "CENTI", "MILLI", "MICRO", "NANO", "PICO", "FEMTO", "ATTO", NULL};
+    inline constexpr short IfcSIPrefix_slots[] = {3, 4, 6, -1, 5, 7, -1, -1, -1, 14, -1, -1, -1, 9, 10, -1, 2, 0, -1, 11, -1, 12, -1, -1, -1, 1, 15, -1, 13, 8, -1, -1};
+    inline constexpr EnumerationHash IfcSIPrefix_hash = {IfcSIPrefix_, IfcSIPrefix_slots, 78u, 31u};
+    inline TextValue IfcSIUnitName_[] = {"AMPERE", "BECQUEREL", "CANDELA", "COULOMB", "CUBIC_METRE", "DEGREE_CELSIUS", "FARAD", "GRAM", "GRAY", "HENRY", "HERTZ", "JOULE", "KELVIN", "LUMEN", "LUX", "METRE", "MOLE", "NEWTON", "OHM", "PASCAL", "RADIAN", "SECOND", "SIEMENS", "SIEVERT", "SQUARE_METRE", "STERADIAN", "TESLA", "VOLT", "WATT", "WEBER", NULL};
+    inline constexpr short IfcSIUnitName_slots[] = {-1, -1, 24, 26, -1, 22, -1, -1, -1, 11, -1, 13, -1, 23, 1, -1, -1, -1, 18, -1, -1, -1, 16, 19, 10, 25, -1, -1, 20, 14, 5, -1, -1, 0, 28, -1, -1, 15, 6, -1, -1, 21, 27, -1, -1, -1, 4, -1, -1, 17, 2, 3, -1, 8, -1, -1, -1, 7, -1, 29, 9, -1, -1, 12};
+    inline constexpr EnumerationHash IfcSIUnitName_hash = {IfcSIUnitName_, IfcSIUnitName_slots, 11u, 63u};
+    inline TextValue IfcSlabTypeEnum_[] = {"FLOOR", "ROOF", "LANDING", "BASESLAB", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcSlabTypeEnum_slots[] = {-1, -1, 1, -1, -1, 4, 5, 3, -1, -1, -1, -1, -1, 2, -1, 0};
+    inline constexpr EnumerationHash IfcSlabTypeEnum_hash = {IfcSlabTypeEnum_, IfcSlabTypeEnum_slots, 6u, 15u};
+    inline TextValue IfcSolarDeviceTypeEnum_[] = {"SOLARCOLLECTOR", "SOLARPANEL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcSolarDeviceTypeEnum_slots[] = {0, -1, 1, -1, -1, 2, 3, -1};
+    inline constexpr EnumerationHash IfcSolarDeviceTypeEnum_hash = {IfcSolarDeviceTypeEnum_, IfcSolarDeviceTypeEnum_slots, 6u, 7u};
+    inline TextValue IfcSpaceHeaterTypeEnum_[] = {"CONVECTOR", "RADIATOR", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcSpaceHeaterTypeEnum_slots[] = {-1, 0, 3, -1, -1, 2, 1, -1};
+    inline constexpr EnumerationHash IfcSpaceHeaterTypeEnum_hash = {IfcSpaceHeaterTypeEnum_, IfcSpaceHeaterTypeEnum_slots, 1u, 7u};
+    inline TextValue IfcSpaceTypeEnum_[] = {"SPACE", "PARKING", "GFA", "INTERNAL", "EXTERNAL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcSpaceTypeEnum_slots[] = {-1, -1, -1, -1, 3, 5, 1, -1, 2, -1, 0, -1, -1, 6, 4, -1};
+    inline constexpr EnumerationHash IfcSpaceTypeEnum_hash = {IfcSpaceTypeEnum_, IfcSpaceTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcSpatialZoneTypeEnum_[] = {"CONSTRUCTION", "FIRESAFETY", "LIGHTING", "OCCUPANCY", "SECURITY", "THERMAL", "TRANSPORT", "VENTILATION", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcSpatialZoneTypeEnum_slots[] = {-1, -1, -1, 0, -1, -1, 4, 8, -1, -1, 3, -1, -1, -1, 2, -1, -1, 1, -1, -1, 7, -1, -1, 9, 5, -1, 6, -1, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcSpatialZoneTypeEnum_hash = {IfcSpatialZoneTypeEnum_, IfcSpatialZoneTypeEnum_slots, 0u, 31u};
+    inline TextValue IfcStackTerminalTypeEnum_[] = {"BIRDCAGE", "COWL", "RAINWATERHOPPER", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcStackTerminalTypeEnum_slots[] = {-1, -1, -1, -1, 1, -1, -1, -1, 0, 4, -1, 3, -1, -1, 2, -1};
+    inline constexpr EnumerationHash IfcStackTerminalTypeEnum_hash = {IfcStackTerminalTypeEnum_, IfcStackTerminalTypeEnum_slots, 4u, 15u};
+    inline TextValue IfcStairFlightTypeEnum_[] = {"STRAIGHT", "WINDER", "SPIRAL", "CURVED", "FREEFORM", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcStairFlightTypeEnum_slots[] = {2, -1, 1, -1, -1, 5, 0, -1, -1, -1, -1, 3, -1, 6, -1, 4};
+    inline constexpr EnumerationHash IfcStairFlightTypeEnum_hash = {IfcStairFlightTypeEnum_, IfcStairFlightTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcStairTypeEnum_[] = {"STRAIGHT_RUN_STAIR", "TWO_STRAIGHT_RUN_STAIR", "QUARTER_WINDING_STAIR", "QUARTER_TURN_STAIR", "HALF_WINDING_STAIR", "HALF_TURN_STAIR", "TWO_QUARTER_WINDING_STAIR", "TWO_QUARTER_TURN_STAIR", "THREE_QUARTER_WINDING_STAIR", "THREE_QUARTER_TURN_STAIR", "SPIRAL_STAIR", "DOUBLE_RETURN_STAIR", "CURVED_RUN_STAIR", "TWO_CURVED_RUN_STAIR", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcStairTypeEnum_slots[] = {9, 13, 3, -1, 11, -1, -1, 15, 1, 7, 0, 6, 4, -1, 12, 5, -1, -1, 2, -1, -1, -1, 14, -1, -1, -1, 8, -1, -1, -1, -1, 10};
+    inline constexpr EnumerationHash IfcStairTypeEnum_hash = {IfcStairTypeEnum_, IfcStairTypeEnum_slots, 41u, 31u};
+    inline TextValue IfcStateEnum_[] = {"READWRITE", "READONLY", "LOCKED", "READWRITELOCKED", "READONLYLOCKED", NULL};
+    inline constexpr short IfcStateEnum_slots[] = {0, -1, 1, -1, -1, -1, 3, 2, -1, -1, -1, 4, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcStateEnum_hash = {IfcStateEnum_, IfcStateEnum_slots, 4u, 15u};
+    inline TextValue IfcStructuralCurveActivityTypeEnum_[] = {"CONST", "LINEAR", "POLYGONAL", "EQUIDISTANT", "SINUS", "PARABOLA", "DISCRETE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcStructuralCurveActivityTypeEnum_slots[] = {-1, -1, -1, 4, -1, -1, -1, -1, -1, -1, 8, 2, 0, 1, 3, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 7, -1, -1};
+    inline constexpr EnumerationHash IfcStructuralCurveActivityTypeEnum_hash = {IfcStructuralCurveActivityTypeEnum_, IfcStructuralCurveActivityTypeEnum_slots, 1u, 31u};
+    inline TextValue IfcStructuralCurveMemberTypeEnum_[] = {"RIGID_JOINED_MEMBER", "PIN_JOINED_MEMBER", "CABLE", "TENSION_MEMBER", "COMPRESSION_MEMBER", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcStructuralCurveMemberTypeEnum_slots[] = {-1, 0, -1, 3, 2, -1, 4, -1, 1, 6, -1, 5, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcStructuralCurveMemberTypeEnum_hash = {IfcStructuralCurveMemberTypeEnum_, IfcStructuralCurveMemberTypeEnum_slots, 4u, 15u};
+    inline TextValue IfcStructuralSurfaceActivityTypeEnum_[] = {"CONST", "BILINEAR", "DISCRETE", "ISOCONTOUR", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcStructuralSurfaceActivityTypeEnum_slots[] = {-1, -1, 2, -1, -1, 4, -1, -1, 3, 1, -1, 0, -1, 5, -1, -1};
+    inline constexpr EnumerationHash IfcStructuralSurfaceActivityTypeEnum_hash = {IfcStructuralSurfaceActivityTypeEnum_, IfcStructuralSurfaceActivityTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcStructuralSurfaceMemberTypeEnum_[] = {"BENDING_ELEMENT", "MEMBRANE_ELEMENT", "SHELL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcStructuralSurfaceMemberTypeEnum_slots[] = {-1, 1, -1, -1, -1, -1, -1, -1, -1, -1, 4, -1, 2, 3, -1, 0};
+    inline constexpr EnumerationHash IfcStructuralSurfaceMemberTypeEnum_hash = {IfcStructuralSurfaceMemberTypeEnum_, IfcStructuralSurfaceMemberTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcSubContractResourceTypeEnum_[] = {"PURCHASE", "WORK", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcSubContractResourceTypeEnum_slots[] = {-1, 3, 1, 2, 0, -1, -1, -1};
+    inline constexpr EnumerationHash IfcSubContractResourceTypeEnum_hash = {IfcSubContractResourceTypeEnum_, IfcSubContractResourceTypeEnum_slots, 4u, 7u};
+    inline TextValue IfcSurfaceFeatureTypeEnum_[] = {"MARK", "TAG", "TREATMENT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcSurfaceFeatureTypeEnum_slots[] = {-1, -1, -1, -1, 2, 3, -1, -1, 0, -1, -1, -1, 1, 4, -1, -1};
+    inline constexpr EnumerationHash IfcSurfaceFeatureTypeEnum_hash = {IfcSurfaceFeatureTypeEnum_, IfcSurfaceFeatureTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcSurfaceSide_[] = {"POSITIVE", "NEGATIVE", "BOTH", NULL};
+    inline constexpr short IfcSurfaceSide_slots[] = {2, -1, -1, -1, -1, 0, -1, 1};
+    inline constexpr EnumerationHash IfcSurfaceSide_hash = {IfcSurfaceSide_, IfcSurfaceSide_slots, 0u, 7u};
+    inline TextValue IfcSwitchingDeviceTypeEnum_[] = {"CONTACTOR", "DIMMERSWITCH", "EMERGENCYSTOP", "KEYPAD", "MOMENTARYSWITCH", "SELECTORSWITCH", "STARTER", "SWITCHDISCONNECTOR", "TOGGLESWITCH", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcSwitchingDeviceTypeEnum_slots[] = {-1, 5, -1, -1, -1, 9, -1, -1, 2, -1, 3, -1, 8, 10, -1, -1, -1, -1, 1, -1, 6, -1, -1, 0, 4, -1, -1, 7, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcSwitchingDeviceTypeEnum_hash = {IfcSwitchingDeviceTypeEnum_, IfcSwitchingDeviceTypeEnum_slots, 2u, 31u};
+    inline TextValue IfcSystemFurnitureElementTypeEnum_[] = {"PANEL", "WORKSURFACE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcSystemFurnitureElementTypeEnum_slots[] = {-1, 0, -1, 1, -1, 2, 3, -1};
+    inline constexpr EnumerationHash IfcSystemFurnitureElementTypeEnum_hash = {IfcSystemFurnitureElementTypeEnum_, IfcSystemFurnitureElementTypeEnum_slots, 6u, 7u};
+    inline TextValue IfcTankTypeEnum_[] = {"BASIN", "BREAKPRESSURE", "EXPANSION", "FEEDANDEXPANSION", "PRESSUREVESSEL", "STORAGE", "VESSEL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcTankTypeEnum_slots[] = {-1, -1, -1, -1, -1, 7, -1, 6, -1, -1, 0, -1, -1, 8, -1, 2, -1, -1, -1, -1, 5, -1, -1, -1, 1, -1, -1, -1, -1, 4, -1, 3};
+    inline constexpr EnumerationHash IfcTankTypeEnum_hash = {IfcTankTypeEnum_, IfcTankTypeEnum_slots, 2u, 31u};
+    inline TextValue IfcTaskDurationEnum_[] = {"ELAPSEDTIME", "WORKTIME", "NOTDEFINED", NULL};
+    inline constexpr short IfcTaskDurationEnum_slots[] = {1, -1, -1, 0, -1, -1, -1, 2};
+    inline constexpr EnumerationHash IfcTaskDurationEnum_hash = {IfcTaskDurationEnum_, IfcTaskDurationEnum_slots, 0u, 7u};
+    inline TextValue IfcTaskTypeEnum_[] = {"ATTENDANCE", "CONSTRUCTION", "DEMOLITION", "DISMANTLE", "DISPOSAL", "INSTALLATION", "LOGISTIC", "MAINTENANCE", "MOVE", "OPERATION", "REMOVAL", "RENOVATION", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcTaskTypeEnum_slots[] = {-1, -1, 6, -1, 4, 11, -1, -1, -1, 2, -1, 0, -1, -1, -1, 8, -1, 1, -1, 13, -1, 12, -1, 5, -1, 7, 9, -1, 3, -1, 10, -1};
+    inline constexpr EnumerationHash IfcTaskTypeEnum_hash = {IfcTaskTypeEnum_, IfcTaskTypeEnum_slots, 24u, 31u};
+    inline TextValue IfcTendonAnchorTypeEnum_[] = {"COUPLER", "FIXED_END", "TENSIONING_END", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcTendonAnchorTypeEnum_slots[] = {0, -1, -1, -1, 1, 3, -1, -1, -1, -1, -1, -1, 2, 4, -1, -1};
+    inline constexpr EnumerationHash IfcTendonAnchorTypeEnum_hash = {IfcTendonAnchorTypeEnum_, IfcTendonAnchorTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcTendonTypeEnum_[] = {"BAR", "COATED", "STRAND", "WIRE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcTendonTypeEnum_slots[] = {3, 2, -1, -1, -1, 4, 0, -1, -1, -1, -1, -1, 1, -1, 5, -1};
+    inline constexpr EnumerationHash IfcTendonTypeEnum_hash = {IfcTendonTypeEnum_, IfcTendonTypeEnum_slots, 5u, 15u};
+    inline TextValue IfcTextPath_[] = {"LEFT", "RIGHT", "UP", "DOWN", NULL};
+    inline constexpr short IfcTextPath_slots[] = {0, -1, 1, -1, -1, -1, 3, 2};
+    inline constexpr EnumerationHash IfcTextPath_hash = {IfcTextPath_, IfcTextPath_slots, 0u, 7u};
+    inline TextValue IfcTimeSeriesDataTypeEnum_[] = {"CONTINUOUS", "DISCRETE", "DISCRETEBINARY", "PIECEWISEBINARY", "PIECEWISECONSTANT", "PIECEWISECONTINUOUS", "NOTDEFINED", NULL};
+    inline constexpr short IfcTimeSeriesDataTypeEnum_slots[] = {-1, 5, 1, 3, 2, -1, -1, -1, -1, 4, -1, 0, -1, 6, -1, -1};
+    inline constexpr EnumerationHash IfcTimeSeriesDataTypeEnum_hash = {IfcTimeSeriesDataTypeEnum_, IfcTimeSeriesDataTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcTransformerTypeEnum_[] = {"CURRENT", "FREQUENCY", "INVERTER", "RECTIFIER", "VOLTAGE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcTransformerTypeEnum_slots[] = {-1, -1, 1, 3, -1, -1, -1, -1, 2, 6, -1, 5, -1, 4, 0, -1};
+    inline constexpr EnumerationHash IfcTransformerTypeEnum_hash = {IfcTransformerTypeEnum_, IfcTransformerTypeEnum_slots, 4u, 15u};
+    inline TextValue IfcTransitionCode_[] = {"DISCONTINUOUS", "CONTINUOUS", "CONTSAMEGRADIENT", "CONTSAMEGRADIENTSAMECURVATURE", NULL};
+    inline constexpr short IfcTransitionCode_slots[] = {3, 2, -1, -1, 0, -1, -1, 1};
+    inline constexpr EnumerationHash IfcTransitionCode_hash = {IfcTransitionCode_, IfcTransitionCode_slots, 0u, 7u};
+    inline TextValue IfcTransportElementTypeEnum_[] = {"ELEVATOR", "ESCALATOR", "MOVINGWALKWAY", "CRANEWAY", "LIFTINGGEAR", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcTransportElementTypeEnum_slots[] = {6, 5, -1, -1, 3, 0, -1, -1, -1, -1, -1, 4, 1, 2, -1, -1};
+    inline constexpr EnumerationHash IfcTransportElementTypeEnum_hash = {IfcTransportElementTypeEnum_, IfcTransportElementTypeEnum_slots, 3u, 15u};
+    inline TextValue IfcTrimmingPreference_[] = {"CARTESIAN", "PARAMETER", "UNSPECIFIED", NULL};
+    inline constexpr short IfcTrimmingPreference_slots[] = {2, -1, -1, 1, -1, 0, -1, -1};
+    inline constexpr EnumerationHash IfcTrimmingPreference_hash = {IfcTrimmingPreference_, IfcTrimmingPreference_slots, 2u, 7u};
+    inline TextValue IfcTubeBundleTypeEnum_[] = {"FINNED", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcTubeBundleTypeEnum_slots[] = {-1, -1, 2, -1, -1, 1, 0, -1};
+    inline constexpr EnumerationHash IfcTubeBundleTypeEnum_hash = {IfcTubeBundleTypeEnum_, IfcTubeBundleTypeEnum_slots, 1u, 7u};
+    inline TextValue IfcUnitaryControlElementTypeEnum_[] = {"ALARMPANEL", "CONTROLPANEL", "GASDETECTIONPANEL", "INDICATORPANEL", "MIMICPANEL", "HUMIDISTAT", "THERMOSTAT", "WEATHERSTATION", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcUnitaryControlElementTypeEnum_slots[] = {4, -1, -1, -1, -1, 8, -1, -1, -1, -1, -1, 5, -1, 9, -1, 7, -1, -1, -1, 6, -1, 2, -1, -1, -1, -1, -1, -1, -1, 1, 0, 3};
+    inline constexpr EnumerationHash IfcUnitaryControlElementTypeEnum_hash = {IfcUnitaryControlElementTypeEnum_, IfcUnitaryControlElementTypeEnum_slots, 2u, 31u};
+    inline TextValue IfcUnitaryEquipmentTypeEnum_[] = {"AIRHANDLER", "AIRCONDITIONINGUNIT", "DEHUMIDIFIER", "SPLITSYSTEM", "ROOFTOPUNIT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcUnitaryEquipmentTypeEnum_slots[] = {-1, -1, -1, -1, -1, 5, 0, -1, 2, -1, -1, 4, 3, 6, 1, -1};
+    inline constexpr EnumerationHash IfcUnitaryEquipmentTypeEnum_hash = {IfcUnitaryEquipmentTypeEnum_, IfcUnitaryEquipmentTypeEnum_slots, 2u, 15u};
+    inline TextValue IfcUnitEnum_[] = {"ABSORBEDDOSEUNIT", "AMOUNTOFSUBSTANCEUNIT", "AREAUNIT", "DOSEEQUIVALENTUNIT", "ELECTRICCAPACITANCEUNIT", "ELECTRICCHARGEUNIT", "ELECTRICCONDUCTANCEUNIT", "ELECTRICCURRENTUNIT", "ELECTRICRESISTANCEUNIT", "ELECTRICVOLTAGEUNIT", "ENERGYUNIT", "FORCEUNIT", "FREQUENCYUNIT", "ILLUMINANCEUNIT", "INDUCTANCEUNIT", "LENGTHUNIT", "LUMINOUSFLUXUNIT", "LUMINOUSINTENSITYUNIT", "MAGNETICFLUXDENSITYUNIT", "MAGNETICFLUXUNIT", "MASSUNIT", "PLANEANGLEUNIT", "POWERUNIT", "PRESSUREUNIT", "RADIOACTIVITYUNIT", "SOLIDANGLEUNIT", "THERMODYNAMICTEMPERATUREUNIT", "TIMEUNIT", "VOLUMEUNIT", "USERDEFINED", NULL};
+    inline constexpr short IfcUnitEnum_slots[] = {21, -1, 10, 14, -1, -1, -1, -1, -1, 13, 5, -1, -1, 20, -1, -1, -1, -1, 0, 19, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 27, 7, -1, -1, -1, -1, -1, 24, -1, -1, -1, -1, 16, -1, -1, -1, -1, 12, -1, -1, 11, 29, -1, -1, -1, -1, 4, -1, -1, -1, -1, -1, 2, -1, -1, -1, 25, 17, -1, 1, -1, -1, -1, -1, -1, 8, 28, 26, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 22, -1, -1, -1, 15, -1, -1, -1, -1, -1, 9, -1, 18, -1, -1, -1, 3, -1, -1, -1, -1, -1, 23, -1, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcUnitEnum_hash = {IfcUnitEnum_, IfcUnitEnum_slots, 112u, 127u};
+    inline TextValue IfcValveTypeEnum_[] = {"AIRRELEASE", "ANTIVACUUM", "CHANGEOVER", "CHECK", "COMMISSIONING", "DIVERTING", "DRAWOFFCOCK", "DOUBLECHECK", "DOUBLEREGULATING", "FAUCET", "FLUSHING", "GASCOCK", "GASTAP", "ISOLATING", "MIXING", "PRESSUREREDUCING", "PRESSURERELIEF", "REGULATING", "SAFETYCUTOFF", "STEAMTRAP", "STOPCOCK", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcValveTypeEnum_slots[] = {21, 22, -1, -1, 12, -1, -1, -1, -1, 16, 18, -1, -1, 15, -1, -1, -1, 8, 4, -1, -1, -1, -1, -1, -1, -1, 10, -1, -1, -1, 0, 7, -1, 11, -1, -1, -1, -1, 19, 14, 5, 1, -1, 9, -1, -1, -1, 17, 13, -1, -1, -1, -1, -1, 2, -1, 20, -1, -1, 6, -1, -1, -1, 3};
+    inline constexpr EnumerationHash IfcValveTypeEnum_hash = {IfcValveTypeEnum_, IfcValveTypeEnum_slots, 131u, 63u};
+    inline TextValue IfcVibrationIsolatorTypeEnum_[] = {"COMPRESSION", "SPRING", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcVibrationIsolatorTypeEnum_slots[] = {1, 3, -1, 2, -1, -1, -1, 0};
+    inline constexpr EnumerationHash IfcVibrationIsolatorTypeEnum_hash = {IfcVibrationIsolatorTypeEnum_, IfcVibrationIsolatorTypeEnum_slots, 4u, 7u};
+    inline TextValue IfcVoidingFeatureTypeEnum_[] = {"CUTOUT", "NOTCH", "HOLE", "MITER", "CHAMFER", "EDGE", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcVoidingFeatureTypeEnum_slots[] = {-1, 0, -1, -1, -1, 3, -1, -1, 1, 7, -1, 6, 4, 5, -1, 2};
+    inline constexpr EnumerationHash IfcVoidingFeatureTypeEnum_hash = {IfcVoidingFeatureTypeEnum_, IfcVoidingFeatureTypeEnum_slots, 4u, 15u};
+    inline TextValue IfcWallTypeEnum_[] = {"MOVABLE", "PARAPET", "PARTITIONING", "PLUMBINGWALL", "SHEAR", "SOLIDWALL", "STANDARD", "POLYGONAL", "ELEMENTEDWALL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcWallTypeEnum_slots[] = {-1, -1, -1, -1, 4, 9, 1, 6, -1, 5, -1, -1, -1, 10, 7, -1, -1, -1, -1, -1, -1, -1, 8, -1, 3, -1, -1, 0, -1, -1, 2, -1};
+    inline constexpr EnumerationHash IfcWallTypeEnum_hash = {IfcWallTypeEnum_, IfcWallTypeEnum_slots, 2u, 31u};
+    inline TextValue IfcWasteTerminalTypeEnum_[] = {"FLOORTRAP", "FLOORWASTE", "GULLYSUMP", "GULLYTRAP", "ROOFDRAIN", "WASTEDISPOSALUNIT", "WASTETRAP", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcWasteTerminalTypeEnum_slots[] = {-1, -1, -1, -1, -1, 1, -1, -1, -1, -1, 6, 5, -1, -1, -1, -1, -1, -1, -1, -1, 0, 7, -1, -1, 2, 3, -1, -1, 4, -1, 8, -1};
+    inline constexpr EnumerationHash IfcWasteTerminalTypeEnum_hash = {IfcWasteTerminalTypeEnum_, IfcWasteTerminalTypeEnum_slots, 5u, 31u};
+    inline TextValue IfcWindowPanelOperationEnum_[] = {"SIDEHUNGRIGHTHAND", "SIDEHUNGLEFTHAND", "TILTANDTURNRIGHTHAND", "TILTANDTURNLEFTHAND", "TOPHUNG", "BOTTOMHUNG", "PIVOTHORIZONTAL", "PIVOTVERTICAL", "SLIDINGHORIZONTAL", "SLIDINGVERTICAL", "REMOVABLECASEMENT", "FIXEDCASEMENT", "OTHEROPERATION", "NOTDEFINED", NULL};
+    inline constexpr short IfcWindowPanelOperationEnum_slots[] = {-1, 5, -1, -1, 0, -1, 11, -1, 8, -1, -1, 4, -1, 2, -1, 9, -1, -1, 12, 13, 10, -1, 1, -1, 6, -1, -1, 7, 3, -1, -1, -1};
+    inline constexpr EnumerationHash IfcWindowPanelOperationEnum_hash = {IfcWindowPanelOperationEnum_, IfcWindowPanelOperationEnum_slots, 83u, 31u};
+    inline TextValue IfcWindowPanelPositionEnum_[] = {"LEFT", "MIDDLE", "RIGHT", "BOTTOM", "TOP", "NOTDEFINED", NULL};
+    inline constexpr short IfcWindowPanelPositionEnum_slots[] = {2, 3, -1, 0, -1, 4, -1, -1, -1, -1, 5, -1, 1, -1, -1, -1};
+    inline constexpr EnumerationHash IfcWindowPanelPositionEnum_hash = {IfcWindowPanelPositionEnum_, IfcWindowPanelPositionEnum_slots, 1u, 15u};
+    inline TextValue IfcWindowStyleConstructionEnum_[] = {"ALUMINIUM", "HIGH_GRADE_STEEL", "STEEL", "WOOD", "ALUMINIUM_WOOD", "PLASTIC", "OTHER_CONSTRUCTION", "NOTDEFINED", NULL};
+    inline constexpr short IfcWindowStyleConstructionEnum_slots[] = {2, 5, -1, -1, 7, -1, 4, -1, 0, 3, -1, -1, -1, 1, 6, -1};
+    inline constexpr EnumerationHash IfcWindowStyleConstructionEnum_hash = {IfcWindowStyleConstructionEnum_, IfcWindowStyleConstructionEnum_slots, 7u, 15u};
+    inline TextValue IfcWindowStyleOperationEnum_[] = {"SINGLE_PANEL", "DOUBLE_PANEL_VERTICAL", "DOUBLE_PANEL_HORIZONTAL", "TRIPLE_PANEL_VERTICAL", "TRIPLE_PANEL_BOTTOM", "TRIPLE_PANEL_TOP", "TRIPLE_PANEL_LEFT", "TRIPLE_PANEL_RIGHT", "TRIPLE_PANEL_HORIZONTAL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcWindowStyleOperationEnum_slots[] = {-1, -1, 6, 2, -1, 3, -1, 0, -1, -1, 10, -1, -1, -1, -1, 4, -1, -1, 9, -1, -1, 8, -1, -1, 1, 5, -1, -1, -1, 7, -1, -1};
+    inline constexpr EnumerationHash IfcWindowStyleOperationEnum_hash = {IfcWindowStyleOperationEnum_, IfcWindowStyleOperationEnum_slots, 9u, 31u};
+    inline TextValue IfcWindowTypeEnum_[] = {"WINDOW", "SKYLIGHT", "LIGHTDOME", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcWindowTypeEnum_slots[] = {-1, -1, -1, -1, -1, -1, 2, -1, -1, 0, 4, -1, 1, 3, -1, -1};
+    inline constexpr EnumerationHash IfcWindowTypeEnum_hash = {IfcWindowTypeEnum_, IfcWindowTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcWindowTypePartitioningEnum_[] = {"SINGLE_PANEL", "DOUBLE_PANEL_VERTICAL", "DOUBLE_PANEL_HORIZONTAL", "TRIPLE_PANEL_VERTICAL", "TRIPLE_PANEL_BOTTOM", "TRIPLE_PANEL_TOP", "TRIPLE_PANEL_LEFT", "TRIPLE_PANEL_RIGHT", "TRIPLE_PANEL_HORIZONTAL", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcWindowTypePartitioningEnum_slots[] = {-1, -1, 6, 2, -1, 3, -1, 0, -1, -1, 10, -1, -1, -1, -1, 4, -1, -1, 9, -1, -1, 8, -1, -1, 1, 5, -1, -1, -1, 7, -1, -1};
+    inline constexpr EnumerationHash IfcWindowTypePartitioningEnum_hash = {IfcWindowTypePartitioningEnum_, IfcWindowTypePartitioningEnum_slots, 9u, 31u};
+    inline TextValue IfcWorkCalendarTypeEnum_[] = {"FIRSTSHIFT", "SECONDSHIFT", "THIRDSHIFT", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcWorkCalendarTypeEnum_slots[] = {-1, -1, -1, 0, -1, 2, -1, -1, -1, -1, 4, 1, -1, 3, -1, -1};
+    inline constexpr EnumerationHash IfcWorkCalendarTypeEnum_hash = {IfcWorkCalendarTypeEnum_, IfcWorkCalendarTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcWorkPlanTypeEnum_[] = {"ACTUAL", "BASELINE", "PLANNED", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcWorkPlanTypeEnum_slots[] = {1, -1, 0, 2, -1, -1, -1, -1, -1, -1, 4, -1, -1, 3, -1, -1};
+    inline constexpr EnumerationHash IfcWorkPlanTypeEnum_hash = {IfcWorkPlanTypeEnum_, IfcWorkPlanTypeEnum_slots, 1u, 15u};
+    inline TextValue IfcWorkScheduleTypeEnum_[] = {"ACTUAL", "BASELINE", "PLANNED", "USERDEFINED", "NOTDEFINED", NULL};
+    inline constexpr short IfcWorkScheduleTypeEnum_slots[] = {1, -1, 0, 2, -1, -1, -1, -1, -1, -1, 4, -1, -1, 3, -1, -1};
+    inline constexpr EnumerationHash IfcWorkScheduleTypeEnum_hash = {IfcWorkScheduleTypeEnum_, IfcWorkScheduleTypeEnum_slots, 1u, 15u};
+
+    //
+    // Defined types
+    // 
+    typedef double IfcAbsorbedDoseMeasure;
+    typedef double IfcAccelerationMeasure;
+    typedef double IfcAmountOfSubstanceMeasure;
+    typedef double IfcAngularVelocityMeasure;
+    typedef IntValue IfcInteger;
+    typedef IntValue IfcPositiveInteger;
+    typedef AggrContainer<IfcPositiveInteger> IfcArcIndex;
+    template <typename TList> class IfcArcIndexSerializer : public AggrSerializerSimple<TList, IfcPositiveInteger, sdaiINTEGER> {};
+    typedef double IfcAreaDensityMeasure;
+    typedef double IfcAreaMeasure;
+    typedef TextValue IfcBinary;
+    typedef bool IfcBoolean;
+    typedef TextValue IfcLabel;
+    typedef TextValue IfcBoxAlignment;
+    typedef IntValue IfcCardinalPointReference;
+    typedef AggrContainer<double> IfcComplexNumber;
+    template <typename TList> class IfcComplexNumberSerializer : public AggrSerializerSimple<TList, double, sdaiREAL> {};
+    typedef AggrContainer<IntValue> IfcCompoundPlaneAngleMeasure;
+    template <typename TList> class IfcCompoundPlaneAngleMeasureSerializer : public AggrSerializerSimple<TList, IntValue, sdaiINTEGER> {};
+    typedef double IfcContextDependentMeasure;
+    typedef double IfcCountMeasure;
+    typedef double IfcCurvatureMeasure;
+    typedef TextValue IfcDate;
+    typedef TextValue IfcDateTime;
+    typedef IntValue IfcDayInMonthNumber;
+    typedef IntValue IfcDayInWeekNumber;
+    typedef TextValue IfcDescriptiveMeasure;
+    typedef IntValue IfcDimensionCount;
+    typedef double IfcDoseEquivalentMeasure;
+    typedef TextValue IfcDuration;
+    typedef double IfcDynamicViscosityMeasure;
+    typedef double IfcElectricCapacitanceMeasure;
+    typedef double IfcElectricChargeMeasure;
+    typedef double IfcElectricConductanceMeasure;
+    typedef double IfcElectricCurrentMeasure;
+    typedef double IfcElectricResistanceMeasure;
+    typedef double IfcElectricVoltageMeasure;
+    typedef double IfcEnergyMeasure;
+    typedef TextValue IfcFontStyle;
+    typedef TextValue IfcFontVariant;
+    typedef TextValue IfcFontWeight;
+    typedef double IfcForceMeasure;
+    typedef double IfcFrequencyMeasure;
+    typedef TextValue IfcGloballyUniqueId;
+    typedef double IfcHeatFluxDensityMeasure;
+    typedef double IfcHeatingValueMeasure;
+    typedef TextValue IfcIdentifier;
+    typedef double IfcIlluminanceMeasure;
+    typedef double IfcInductanceMeasure;
+    typedef IntValue IfcIntegerCountRateMeasure;
+    typedef double IfcIonConcentrationMeasure;
+    typedef double IfcIsothermalMoistureCapacityMeasure;
+    typedef double IfcKinematicViscosityMeasure;
+    typedef IfcIdentifier IfcLanguageId;
+    typedef double IfcLengthMeasure;
+    typedef double IfcLinearForceMeasure;
+    typedef double IfcLinearMomentMeasure;
+    typedef double IfcLinearStiffnessMeasure;
+    typedef double IfcLinearVelocityMeasure;
+    typedef AggrContainer<IfcPositiveInteger> IfcLineIndex;
+    template <typename TList> class IfcLineIndexSerializer : public AggrSerializerSimple<TList, IfcPositiveInteger, sdaiINTEGER> {};
+    typedef LOGICAL_VALUE IfcLogical;
+    typedef double IfcLuminousFluxMeasure;
+    typedef double IfcLuminousIntensityDistributionMeasure;
+    typedef double IfcLuminousIntensityMeasure;
+    typedef double IfcMagneticFluxDensityMeasure;
+    typedef double IfcMagneticFluxMeasure;
+    typedef double IfcMassDensityMeasure;
+    typedef double IfcMassFlowRateMeasure;
+    typedef double IfcMassMeasure;
+    typedef double IfcMassPerLengthMeasure;
+    typedef double IfcModulusOfElasticityMeasure;
+    typedef double IfcModulusOfLinearSubgradeReactionMeasure;
+    typedef double IfcModulusOfRotationalSubgradeReactionMeasure;
+    typedef double IfcModulusOfSubgradeReactionMeasure;
+    typedef double IfcMoistureDiffusivityMeasure;
+    typedef double IfcMolecularWeightMeasure;
+    typedef double IfcMomentOfInertiaMeasure;
+    typedef double IfcMonetaryMeasure;
+    typedef IntValue IfcMonthInYearNumber;
+    typedef IfcLengthMeasure IfcNonNegativeLengthMeasure;
+    typedef double IfcRatioMeasure;
+    typedef double IfcNormalisedRatioMeasure;
+    typedef double IfcNumericMeasure;
+    typedef double IfcParameterValue;
+    typedef double IfcPHMeasure;
+    typedef double IfcPlanarForceMeasure;
+    typedef double IfcPlaneAngleMeasure;
+    typedef IfcLengthMeasure IfcPositiveLengthMeasure;
+    typedef IfcPlaneAngleMeasure IfcPositivePlaneAngleMeasure;
+    typedef IfcRatioMeasure IfcPositiveRatioMeasure;
+    typedef double IfcPowerMeasure;
+    typedef TextValue IfcPresentableText;
+    typedef double IfcPressureMeasure;
+    typedef AggrContainer<IfcPropertySetDefinition> IfcPropertySetDefinitionSet;
+    template <typename TList> class IfcPropertySetDefinitionSetSerializer : public AggrSerializerInstance<TList, IfcPropertySetDefinition> {};
+    typedef double IfcRadioActivityMeasure;
+    typedef double IfcReal;
+    typedef double IfcRotationalFrequencyMeasure;
+    typedef double IfcRotationalMassMeasure;
+    typedef double IfcRotationalStiffnessMeasure;
+    typedef double IfcSectionalAreaIntegralMeasure;
+    typedef double IfcSectionModulusMeasure;
+    typedef double IfcShearModulusMeasure;
+    typedef double IfcSolidAngleMeasure;
+    typedef double IfcSoundPowerLevelMeasure;
+    typedef double IfcSoundPowerMeasure;
+    typedef double IfcSoundPressureLevelMeasure;
+    typedef double IfcSoundPressureMeasure;
+    typedef double IfcSpecificHeatCapacityMeasure;
+    typedef double IfcSpecularExponent;
+    typedef double IfcSpecularRoughness;
+    typedef double IfcTemperatureGradientMeasure;
+    typedef double IfcTemperatureRateOfChangeMeasure;
+    typedef TextValue IfcText;
+    typedef TextValue IfcTextAlignment;
+    typedef TextValue IfcTextDecoration;
+    typedef TextValue IfcTextFontName;
+    typedef TextValue IfcTextTransformation;
+    typedef double IfcThermalAdmittanceMeasure;
+    typedef double IfcThermalConductivityMeasure;
+    typedef double IfcThermalExpansionCoefficientMeasure;
+    typedef double IfcThermalResistanceMeasure;
+    typedef double IfcThermalTransmittanceMeasure;
+    typedef double IfcThermodynamicTemperatureMeasure;
+    typedef TextValue IfcTime;
+    typedef double IfcTimeMeasure;
+    typedef IntValue IfcTimeStamp;
+    typedef double IfcTorqueMeasure;
+    typedef TextValue IfcURIReference;
+    typedef double IfcVaporPermeabilityMeasure;
+    typedef double IfcVolumeMeasure;
+    typedef double IfcVolumetricFlowRateMeasure;
+    typedef double IfcWarpingConstantMeasure;
+    typedef double IfcWarpingMomentMeasure;
+
+    class IfcActorSelect : public Select
+    {
+    public:
+        IfcActorSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcActorSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(398); }
+        IfcOrganization get_IfcOrganization();
+        void put_IfcOrganization(IfcOrganization inst);
+
+        bool is_IfcPerson() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(411); }
+        IfcPerson get_IfcPerson();
+        void put_IfcPerson(IfcPerson inst);
+
+        bool is_IfcPersonAndOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(412); }
+        IfcPersonAndOrganization get_IfcPersonAndOrganization();
+        void put_IfcPersonAndOrganization(IfcPersonAndOrganization inst);
+    };
+
+
+    class IfcActorSelect_get : public Select
+    {
+    public:
+        IfcActorSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcActorSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(398); }
+        IfcOrganization get_IfcOrganization();
+        bool is_IfcPerson() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(411); }
+        IfcPerson get_IfcPerson();
+        bool is_IfcPersonAndOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(412); }
+        IfcPersonAndOrganization get_IfcPersonAndOrganization();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcActorSelect_put : public Select
+    {
+    public:
+        IfcActorSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcActorSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcOrganization(IfcOrganization inst);
+        void put_IfcPerson(IfcPerson inst);
+        void put_IfcPersonAndOrganization(IfcPersonAndOrganization inst);
+    };
+
+
+    class IfcDerivedMeasureValue : public Select
+    {
+    public:
+        IfcDerivedMeasureValue(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcDerivedMeasureValue(Select* outer) : Select(outer) {}
+
+        bool is_IfcAbsorbedDoseMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(0); }
+        Nullable<IfcAbsorbedDoseMeasure> get_IfcAbsorbedDoseMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcAbsorbedDoseMeasure>(0, sdaiREAL); }
+        void put_IfcAbsorbedDoseMeasure(IfcAbsorbedDoseMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(0, sdaiREAL, value); }
+
+        bool is_IfcAccelerationMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(1); }
+        Nullable<IfcAccelerationMeasure> get_IfcAccelerationMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcAccelerationMeasure>(1, sdaiREAL); }
+        void put_IfcAccelerationMeasure(IfcAccelerationMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(1, sdaiREAL, value); }
+
+        bool is_IfcAngularVelocityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(2); }
+        Nullable<IfcAngularVelocityMeasure> get_IfcAngularVelocityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcAngularVelocityMeasure>(2, sdaiREAL); }
+        void put_IfcAngularVelocityMeasure(IfcAngularVelocityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(2, sdaiREAL, value); }
+
+        bool is_IfcAreaDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(3); }
+        Nullable<IfcAreaDensityMeasure> get_IfcAreaDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcAreaDensityMeasure>(3, sdaiREAL); }
+        void put_IfcAreaDensityMeasure(IfcAreaDensityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(3, sdaiREAL, value); }
+
+        bool is_IfcCompoundPlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(4); }
+
+        //TList may be IfcCompoundPlaneAngleMeasure or list of convertible elements
+        template <typename TList> void get_IfcCompoundPlaneAngleMeasure(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); SdaiAggr aggr = getAggrValue(4); IfcCompoundPlaneAngleMeasureSerializer<TList> sr; sr.FromSdaiAggr(lst, m_instance, aggr); }
+
+                //TList may be IfcCompoundPlaneAngleMeasure or list of convertible elements
+        template <typename TList> void put_IfcCompoundPlaneAngleMeasure(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); IfcCompoundPlaneAngleMeasureSerializer<TList> sr; SdaiAggr aggr = sr.ToSdaiAggr(lst, m_instance, NULL); putAggrValue(4, aggr); }
+
+                //TArrayElem[] may be IntValue[] or array of convertible elements
+        template <typename TArrayElem> void put_IfcCompoundPlaneAngleMeasure(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(ProbeAttr()); ArrayRange<TArrayElem> range = {arr, n}; IfcCompoundPlaneAngleMeasureSerializer<IfcCompoundPlaneAngleMeasure> sr; SdaiAggr aggr = sr.RangeToSdaiAggr(range, m_instance, NULL); putAggrValue(4, aggr); }
+
+        bool is_IfcCurvatureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(5); }
+        Nullable<IfcCurvatureMeasure> get_IfcCurvatureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcCurvatureMeasure>(5, sdaiREAL); }
+        void put_IfcCurvatureMeasure(IfcCurvatureMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(5, sdaiREAL, value); }
+
+        bool is_IfcDoseEquivalentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(6); }
+        Nullable<IfcDoseEquivalentMeasure> get_IfcDoseEquivalentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcDoseEquivalentMeasure>(6, sdaiREAL); }
+        void put_IfcDoseEquivalentMeasure(IfcDoseEquivalentMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(6, sdaiREAL, value); }
+
+        bool is_IfcDynamicViscosityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(7); }
+        Nullable<IfcDynamicViscosityMeasure> get_IfcDynamicViscosityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcDynamicViscosityMeasure>(7, sdaiREAL); }
+        void put_IfcDynamicViscosityMeasure(IfcDynamicViscosityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(7, sdaiREAL, value); }
+
+        bool is_IfcElectricCapacitanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(8); }
+        Nullable<IfcElectricCapacitanceMeasure> get_IfcElectricCapacitanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcElectricCapacitanceMeasure>(8, sdaiREAL); }
+        void put_IfcElectricCapacitanceMeasure(IfcElectricCapacitanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(8, sdaiREAL, value); }
+
+        bool is_IfcElectricChargeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(9); }
+        Nullable<IfcElectricChargeMeasure> get_IfcElectricChargeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcElectricChargeMeasure>(9, sdaiREAL); }
+        void put_IfcElectricChargeMeasure(IfcElectricChargeMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(9, sdaiREAL, value); }
+
+        bool is_IfcElectricConductanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(10); }
+        Nullable<IfcElectricConductanceMeasure> get_IfcElectricConductanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcElectricConductanceMeasure>(10, sdaiREAL); }
+        void put_IfcElectricConductanceMeasure(IfcElectricConductanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(10, sdaiREAL, value); }
+
+        bool is_IfcElectricResistanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(11); }
+        Nullable<IfcElectricResistanceMeasure> get_IfcElectricResistanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcElectricResistanceMeasure>(11, sdaiREAL); }
+        void put_IfcElectricResistanceMeasure(IfcElectricResistanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(11, sdaiREAL, value); }
+
+        bool is_IfcElectricVoltageMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(12); }
+        Nullable<IfcElectricVoltageMeasure> get_IfcElectricVoltageMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcElectricVoltageMeasure>(12, sdaiREAL); }
+        void put_IfcElectricVoltageMeasure(IfcElectricVoltageMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(12, sdaiREAL, value); }
+
+        bool is_IfcEnergyMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(13); }
+        Nullable<IfcEnergyMeasure> get_IfcEnergyMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcEnergyMeasure>(13, sdaiREAL); }
+        void put_IfcEnergyMeasure(IfcEnergyMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(13, sdaiREAL, value); }
+
+        bool is_IfcForceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(14); }
+        Nullable<IfcForceMeasure> get_IfcForceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcForceMeasure>(14, sdaiREAL); }
+        void put_IfcForceMeasure(IfcForceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(14, sdaiREAL, value); }
+
+        bool is_IfcFrequencyMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(15); }
+        Nullable<IfcFrequencyMeasure> get_IfcFrequencyMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcFrequencyMeasure>(15, sdaiREAL); }
+        void put_IfcFrequencyMeasure(IfcFrequencyMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(15, sdaiREAL, value); }
+
+        bool is_IfcHeatFluxDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(16); }
+        Nullable<IfcHeatFluxDensityMeasure> get_IfcHeatFluxDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcHeatFluxDensityMeasure>(16, sdaiREAL); }
+        void put_IfcHeatFluxDensityMeasure(IfcHeatFluxDensityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(16, sdaiREAL, value); }
+
+        bool is_IfcHeatingValueMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(17); }
+        Nullable<IfcHeatingValueMeasure> get_IfcHeatingValueMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcHeatingValueMeasure>(17, sdaiREAL); }
+        void put_IfcHeatingValueMeasure(IfcHeatingValueMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(17, sdaiREAL, value); }
+
+        bool is_IfcIlluminanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(18); }
+        Nullable<IfcIlluminanceMeasure> get_IfcIlluminanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcIlluminanceMeasure>(18, sdaiREAL); }
+        void put_IfcIlluminanceMeasure(IfcIlluminanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(18, sdaiREAL, value); }
+
+        bool is_IfcInductanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(19); }
+        Nullable<IfcInductanceMeasure> get_IfcInductanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcInductanceMeasure>(19, sdaiREAL); }
+        void put_IfcInductanceMeasure(IfcInductanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(19, sdaiREAL, value); }
+
+        bool is_IfcIntegerCountRateMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(20); }
+        Nullable<IfcIntegerCountRateMeasure> get_IfcIntegerCountRateMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcIntegerCountRateMeasure>(20, sdaiINTEGER); }
+        void put_IfcIntegerCountRateMeasure(IfcIntegerCountRateMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(20, sdaiINTEGER, value); }
+
+        bool is_IfcIonConcentrationMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(21); }
+        Nullable<IfcIonConcentrationMeasure> get_IfcIonConcentrationMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcIonConcentrationMeasure>(21, sdaiREAL); }
+        void put_IfcIonConcentrationMeasure(IfcIonConcentrationMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(21, sdaiREAL, value); }
+
+        bool is_IfcIsothermalMoistureCapacityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(22); }
+        Nullable<IfcIsothermalMoistureCapacityMeasure> get_IfcIsothermalMoistureCapacityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcIsothermalMoistureCapacityMeasure>(22, sdaiREAL); }
+        void put_IfcIsothermalMoistureCapacityMeasure(IfcIsothermalMoistureCapacityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(22, sdaiREAL, value); }
+
+        bool is_IfcKinematicViscosityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(23); }
+        Nullable<IfcKinematicViscosityMeasure> get_IfcKinematicViscosityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcKinematicViscosityMeasure>(23, sdaiREAL); }
+        void put_IfcKinematicViscosityMeasure(IfcKinematicViscosityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(23, sdaiREAL, value); }
+
+        bool is_IfcLinearForceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(24); }
+        Nullable<IfcLinearForceMeasure> get_IfcLinearForceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLinearForceMeasure>(24, sdaiREAL); }
+        void put_IfcLinearForceMeasure(IfcLinearForceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(24, sdaiREAL, value); }
+
+        bool is_IfcLinearMomentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(25); }
+        Nullable<IfcLinearMomentMeasure> get_IfcLinearMomentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLinearMomentMeasure>(25, sdaiREAL); }
+        void put_IfcLinearMomentMeasure(IfcLinearMomentMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(25, sdaiREAL, value); }
+
+        bool is_IfcLinearStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(26); }
+        Nullable<IfcLinearStiffnessMeasure> get_IfcLinearStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLinearStiffnessMeasure>(26, sdaiREAL); }
+        void put_IfcLinearStiffnessMeasure(IfcLinearStiffnessMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(26, sdaiREAL, value); }
+
+        bool is_IfcLinearVelocityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(27); }
+        Nullable<IfcLinearVelocityMeasure> get_IfcLinearVelocityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLinearVelocityMeasure>(27, sdaiREAL); }
+        void put_IfcLinearVelocityMeasure(IfcLinearVelocityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(27, sdaiREAL, value); }
+
+        bool is_IfcLuminousFluxMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(28); }
+        Nullable<IfcLuminousFluxMeasure> get_IfcLuminousFluxMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLuminousFluxMeasure>(28, sdaiREAL); }
+        void put_IfcLuminousFluxMeasure(IfcLuminousFluxMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(28, sdaiREAL, value); }
+
+        bool is_IfcLuminousIntensityDistributionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(29); }
+        Nullable<IfcLuminousIntensityDistributionMeasure> get_IfcLuminousIntensityDistributionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLuminousIntensityDistributionMeasure>(29, sdaiREAL); }
+        void put_IfcLuminousIntensityDistributionMeasure(IfcLuminousIntensityDistributionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(29, sdaiREAL, value); }
+
+        bool is_IfcMagneticFluxDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(30); }
+        Nullable<IfcMagneticFluxDensityMeasure> get_IfcMagneticFluxDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMagneticFluxDensityMeasure>(30, sdaiREAL); }
+        void put_IfcMagneticFluxDensityMeasure(IfcMagneticFluxDensityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(30, sdaiREAL, value); }
+
+        bool is_IfcMagneticFluxMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(31); }
+        Nullable<IfcMagneticFluxMeasure> get_IfcMagneticFluxMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMagneticFluxMeasure>(31, sdaiREAL); }
+        void put_IfcMagneticFluxMeasure(IfcMagneticFluxMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(31, sdaiREAL, value); }
+
+        bool is_IfcMassDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(32); }
+        Nullable<IfcMassDensityMeasure> get_IfcMassDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMassDensityMeasure>(32, sdaiREAL); }
+        void put_IfcMassDensityMeasure(IfcMassDensityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(32, sdaiREAL, value); }
+
+        bool is_IfcMassFlowRateMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(33); }
+        Nullable<IfcMassFlowRateMeasure> get_IfcMassFlowRateMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMassFlowRateMeasure>(33, sdaiREAL); }
+        void put_IfcMassFlowRateMeasure(IfcMassFlowRateMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(33, sdaiREAL, value); }
+
+        bool is_IfcMassPerLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(34); }
+        Nullable<IfcMassPerLengthMeasure> get_IfcMassPerLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMassPerLengthMeasure>(34, sdaiREAL); }
+        void put_IfcMassPerLengthMeasure(IfcMassPerLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(34, sdaiREAL, value); }
+
+        bool is_IfcModulusOfElasticityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(35); }
+        Nullable<IfcModulusOfElasticityMeasure> get_IfcModulusOfElasticityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfElasticityMeasure>(35, sdaiREAL); }
+        void put_IfcModulusOfElasticityMeasure(IfcModulusOfElasticityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(35, sdaiREAL, value); }
+
+        bool is_IfcModulusOfLinearSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(36); }
+        Nullable<IfcModulusOfLinearSubgradeReactionMeasure> get_IfcModulusOfLinearSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfLinearSubgradeReactionMeasure>(36, sdaiREAL); }
+        void put_IfcModulusOfLinearSubgradeReactionMeasure(IfcModulusOfLinearSubgradeReactionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(36, sdaiREAL, value); }
+
+        bool is_IfcModulusOfRotationalSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(37); }
+        Nullable<IfcModulusOfRotationalSubgradeReactionMeasure> get_IfcModulusOfRotationalSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfRotationalSubgradeReactionMeasure>(37, sdaiREAL); }
+        void put_IfcModulusOfRotationalSubgradeReactionMeasure(IfcModulusOfRotationalSubgradeReactionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(37, sdaiREAL, value); }
+
+        bool is_IfcModulusOfSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(38); }
+        Nullable<IfcModulusOfSubgradeReactionMeasure> get_IfcModulusOfSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfSubgradeReactionMeasure>(38, sdaiREAL); }
+        void put_IfcModulusOfSubgradeReactionMeasure(IfcModulusOfSubgradeReactionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(38, sdaiREAL, value); }
+
+        bool is_IfcMoistureDiffusivityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(39); }
+        Nullable<IfcMoistureDiffusivityMeasure> get_IfcMoistureDiffusivityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMoistureDiffusivityMeasure>(39, sdaiREAL); }
+        void put_IfcMoistureDiffusivityMeasure(IfcMoistureDiffusivityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(39, sdaiREAL, value); }
+
+        bool is_IfcMolecularWeightMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(40); }
+        Nullable<IfcMolecularWeightMeasure> get_IfcMolecularWeightMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMolecularWeightMeasure>(40, sdaiREAL); }
+        void put_IfcMolecularWeightMeasure(IfcMolecularWeightMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(40, sdaiREAL, value); }
+
+        bool is_IfcMomentOfInertiaMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(41); }
+        Nullable<IfcMomentOfInertiaMeasure> get_IfcMomentOfInertiaMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMomentOfInertiaMeasure>(41, sdaiREAL); }
+        void put_IfcMomentOfInertiaMeasure(IfcMomentOfInertiaMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(41, sdaiREAL, value); }
+
+        bool is_IfcMonetaryMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(42); }
+        Nullable<IfcMonetaryMeasure> get_IfcMonetaryMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMonetaryMeasure>(42, sdaiREAL); }
+        void put_IfcMonetaryMeasure(IfcMonetaryMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(42, sdaiREAL, value); }
+
+        bool is_IfcPHMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(43); }
+        Nullable<IfcPHMeasure> get_IfcPHMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPHMeasure>(43, sdaiREAL); }
+        void put_IfcPHMeasure(IfcPHMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(43, sdaiREAL, value); }
+
+        bool is_IfcPlanarForceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(44); }
+        Nullable<IfcPlanarForceMeasure> get_IfcPlanarForceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPlanarForceMeasure>(44, sdaiREAL); }
+        void put_IfcPlanarForceMeasure(IfcPlanarForceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(44, sdaiREAL, value); }
+
+        bool is_IfcPowerMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(45); }
+        Nullable<IfcPowerMeasure> get_IfcPowerMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPowerMeasure>(45, sdaiREAL); }
+        void put_IfcPowerMeasure(IfcPowerMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(45, sdaiREAL, value); }
+
+        bool is_IfcPressureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(46); }
+        Nullable<IfcPressureMeasure> get_IfcPressureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPressureMeasure>(46, sdaiREAL); }
+        void put_IfcPressureMeasure(IfcPressureMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(46, sdaiREAL, value); }
+
+        bool is_IfcRadioActivityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(47); }
+        Nullable<IfcRadioActivityMeasure> get_IfcRadioActivityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRadioActivityMeasure>(47, sdaiREAL); }
+        void put_IfcRadioActivityMeasure(IfcRadioActivityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(47, sdaiREAL, value); }
+
+        bool is_IfcRotationalFrequencyMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(48); }
+        Nullable<IfcRotationalFrequencyMeasure> get_IfcRotationalFrequencyMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRotationalFrequencyMeasure>(48, sdaiREAL); }
+        void put_IfcRotationalFrequencyMeasure(IfcRotationalFrequencyMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(48, sdaiREAL, value); }
+
+        bool is_IfcRotationalMassMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(49); }
+        Nullable<IfcRotationalMassMeasure> get_IfcRotationalMassMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRotationalMassMeasure>(49, sdaiREAL); }
+        void put_IfcRotationalMassMeasure(IfcRotationalMassMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(49, sdaiREAL, value); }
+
+        bool is_IfcRotationalStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(50); }
+        Nullable<IfcRotationalStiffnessMeasure> get_IfcRotationalStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRotationalStiffnessMeasure>(50, sdaiREAL); }
+        void put_IfcRotationalStiffnessMeasure(IfcRotationalStiffnessMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(50, sdaiREAL, value); }
+
+        bool is_IfcSectionModulusMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(51); }
+        Nullable<IfcSectionModulusMeasure> get_IfcSectionModulusMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSectionModulusMeasure>(51, sdaiREAL); }
+        void put_IfcSectionModulusMeasure(IfcSectionModulusMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(51, sdaiREAL, value); }
+
+        bool is_IfcSectionalAreaIntegralMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(52); }
+        Nullable<IfcSectionalAreaIntegralMeasure> get_IfcSectionalAreaIntegralMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSectionalAreaIntegralMeasure>(52, sdaiREAL); }
+        void put_IfcSectionalAreaIntegralMeasure(IfcSectionalAreaIntegralMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(52, sdaiREAL, value); }
+
+        bool is_IfcShearModulusMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(53); }
+        Nullable<IfcShearModulusMeasure> get_IfcShearModulusMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcShearModulusMeasure>(53, sdaiREAL); }
+        void put_IfcShearModulusMeasure(IfcShearModulusMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(53, sdaiREAL, value); }
+
+        bool is_IfcSoundPowerLevelMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(54); }
+        Nullable<IfcSoundPowerLevelMeasure> get_IfcSoundPowerLevelMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSoundPowerLevelMeasure>(54, sdaiREAL); }
+        void put_IfcSoundPowerLevelMeasure(IfcSoundPowerLevelMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(54, sdaiREAL, value); }
+
+        bool is_IfcSoundPowerMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(55); }
+        Nullable<IfcSoundPowerMeasure> get_IfcSoundPowerMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSoundPowerMeasure>(55, sdaiREAL); }
+        void put_IfcSoundPowerMeasure(IfcSoundPowerMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(55, sdaiREAL, value); }
+
+        bool is_IfcSoundPressureLevelMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(56); }
+        Nullable<IfcSoundPressureLevelMeasure> get_IfcSoundPressureLevelMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSoundPressureLevelMeasure>(56, sdaiREAL); }
+        void put_IfcSoundPressureLevelMeasure(IfcSoundPressureLevelMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(56, sdaiREAL, value); }
+
+        bool is_IfcSoundPressureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(57); }
+        Nullable<IfcSoundPressureMeasure> get_IfcSoundPressureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSoundPressureMeasure>(57, sdaiREAL); }
+        void put_IfcSoundPressureMeasure(IfcSoundPressureMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(57, sdaiREAL, value); }
+
+        bool is_IfcSpecificHeatCapacityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(58); }
+        Nullable<IfcSpecificHeatCapacityMeasure> get_IfcSpecificHeatCapacityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSpecificHeatCapacityMeasure>(58, sdaiREAL); }
+        void put_IfcSpecificHeatCapacityMeasure(IfcSpecificHeatCapacityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(58, sdaiREAL, value); }
+
+        bool is_IfcTemperatureGradientMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(59); }
+        Nullable<IfcTemperatureGradientMeasure> get_IfcTemperatureGradientMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcTemperatureGradientMeasure>(59, sdaiREAL); }
+        void put_IfcTemperatureGradientMeasure(IfcTemperatureGradientMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(59, sdaiREAL, value); }
+
+        bool is_IfcTemperatureRateOfChangeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(60); }
+        Nullable<IfcTemperatureRateOfChangeMeasure> get_IfcTemperatureRateOfChangeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcTemperatureRateOfChangeMeasure>(60, sdaiREAL); }
+        void put_IfcTemperatureRateOfChangeMeasure(IfcTemperatureRateOfChangeMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(60, sdaiREAL, value); }
+
+        bool is_IfcThermalAdmittanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(61); }
+        Nullable<IfcThermalAdmittanceMeasure> get_IfcThermalAdmittanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcThermalAdmittanceMeasure>(61, sdaiREAL); }
+        void put_IfcThermalAdmittanceMeasure(IfcThermalAdmittanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(61, sdaiREAL, value); }
+
+        bool is_IfcThermalConductivityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(62); }
+        Nullable<IfcThermalConductivityMeasure> get_IfcThermalConductivityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcThermalConductivityMeasure>(62, sdaiREAL); }
+        void put_IfcThermalConductivityMeasure(IfcThermalConductivityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(62, sdaiREAL, value); }
+
+        bool is_IfcThermalExpansionCoefficientMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(63); }
+        Nullable<IfcThermalExpansionCoefficientMeasure> get_IfcThermalExpansionCoefficientMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcThermalExpansionCoefficientMeasure>(63, sdaiREAL); }
+        void put_IfcThermalExpansionCoefficientMeasure(IfcThermalExpansionCoefficientMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(63, sdaiREAL, value); }
+
+        bool is_IfcThermalResistanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(64); }
+        Nullable<IfcThermalResistanceMeasure> get_IfcThermalResistanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcThermalResistanceMeasure>(64, sdaiREAL); }
+        void put_IfcThermalResistanceMeasure(IfcThermalResistanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(64, sdaiREAL, value); }
+
+        bool is_IfcThermalTransmittanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(65); }
+        Nullable<IfcThermalTransmittanceMeasure> get_IfcThermalTransmittanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcThermalTransmittanceMeasure>(65, sdaiREAL); }
+        void put_IfcThermalTransmittanceMeasure(IfcThermalTransmittanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(65, sdaiREAL, value); }
+
+        bool is_IfcTorqueMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(66); }
+        Nullable<IfcTorqueMeasure> get_IfcTorqueMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcTorqueMeasure>(66, sdaiREAL); }
+        void put_IfcTorqueMeasure(IfcTorqueMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(66, sdaiREAL, value); }
+
+        bool is_IfcVaporPermeabilityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(67); }
+        Nullable<IfcVaporPermeabilityMeasure> get_IfcVaporPermeabilityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcVaporPermeabilityMeasure>(67, sdaiREAL); }
+        void put_IfcVaporPermeabilityMeasure(IfcVaporPermeabilityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(67, sdaiREAL, value); }
+
+        bool is_IfcVolumetricFlowRateMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(68); }
+        Nullable<IfcVolumetricFlowRateMeasure> get_IfcVolumetricFlowRateMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcVolumetricFlowRateMeasure>(68, sdaiREAL); }
+        void put_IfcVolumetricFlowRateMeasure(IfcVolumetricFlowRateMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(68, sdaiREAL, value); }
+
+        bool is_IfcWarpingConstantMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(69); }
+        Nullable<IfcWarpingConstantMeasure> get_IfcWarpingConstantMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcWarpingConstantMeasure>(69, sdaiREAL); }
+        void put_IfcWarpingConstantMeasure(IfcWarpingConstantMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(69, sdaiREAL, value); }
+
+        bool is_IfcWarpingMomentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(70); }
+        Nullable<IfcWarpingMomentMeasure> get_IfcWarpingMomentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcWarpingMomentMeasure>(70, sdaiREAL); }
+        void put_IfcWarpingMomentMeasure(IfcWarpingMomentMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(70, sdaiREAL, value); }
+    };
+
+
+    class IfcDerivedMeasureValue_get : public Select
+    {
+    public:
+        IfcDerivedMeasureValue_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcDerivedMeasureValue_get(Select* outer) : Select(outer) {}
+        bool is_IfcAbsorbedDoseMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(0); }
+        Nullable<IfcAbsorbedDoseMeasure> get_IfcAbsorbedDoseMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcAbsorbedDoseMeasure>(0, sdaiREAL); }
+        bool is_IfcAccelerationMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(1); }
+        Nullable<IfcAccelerationMeasure> get_IfcAccelerationMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcAccelerationMeasure>(1, sdaiREAL); }
+        bool is_IfcAngularVelocityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(2); }
+        Nullable<IfcAngularVelocityMeasure> get_IfcAngularVelocityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcAngularVelocityMeasure>(2, sdaiREAL); }
+        bool is_IfcAreaDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(3); }
+        Nullable<IfcAreaDensityMeasure> get_IfcAreaDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcAreaDensityMeasure>(3, sdaiREAL); }
+        bool is_IfcCompoundPlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(4); }
+
+        //TList may be IfcCompoundPlaneAngleMeasure or list of convertible elements
+        template <typename TList> void get_IfcCompoundPlaneAngleMeasure(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); SdaiAggr aggr = getAggrValue(4); IfcCompoundPlaneAngleMeasureSerializer<TList> sr; sr.FromSdaiAggr(lst, m_instance, aggr); }
+        bool is_IfcCurvatureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(5); }
+        Nullable<IfcCurvatureMeasure> get_IfcCurvatureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcCurvatureMeasure>(5, sdaiREAL); }
+        bool is_IfcDoseEquivalentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(6); }
+        Nullable<IfcDoseEquivalentMeasure> get_IfcDoseEquivalentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcDoseEquivalentMeasure>(6, sdaiREAL); }
+        bool is_IfcDynamicViscosityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(7); }
+        Nullable<IfcDynamicViscosityMeasure> get_IfcDynamicViscosityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcDynamicViscosityMeasure>(7, sdaiREAL); }
+        bool is_IfcElectricCapacitanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(8); }
+        Nullable<IfcElectricCapacitanceMeasure> get_IfcElectricCapacitanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcElectricCapacitanceMeasure>(8, sdaiREAL); }
+        bool is_IfcElectricChargeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(9); }
+        Nullable<IfcElectricChargeMeasure> get_IfcElectricChargeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcElectricChargeMeasure>(9, sdaiREAL); }
+        bool is_IfcElectricConductanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(10); }
+        Nullable<IfcElectricConductanceMeasure> get_IfcElectricConductanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcElectricConductanceMeasure>(10, sdaiREAL); }
+        bool is_IfcElectricResistanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(11); }
+        Nullable<IfcElectricResistanceMeasure> get_IfcElectricResistanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcElectricResistanceMeasure>(11, sdaiREAL); }
+        bool is_IfcElectricVoltageMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(12); }
+        Nullable<IfcElectricVoltageMeasure> get_IfcElectricVoltageMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcElectricVoltageMeasure>(12, sdaiREAL); }
+        bool is_IfcEnergyMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(13); }
+        Nullable<IfcEnergyMeasure> get_IfcEnergyMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcEnergyMeasure>(13, sdaiREAL); }
+        bool is_IfcForceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(14); }
+        Nullable<IfcForceMeasure> get_IfcForceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcForceMeasure>(14, sdaiREAL); }
+        bool is_IfcFrequencyMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(15); }
+        Nullable<IfcFrequencyMeasure> get_IfcFrequencyMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcFrequencyMeasure>(15, sdaiREAL); }
+        bool is_IfcHeatFluxDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(16); }
+        Nullable<IfcHeatFluxDensityMeasure> get_IfcHeatFluxDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcHeatFluxDensityMeasure>(16, sdaiREAL); }
+        bool is_IfcHeatingValueMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(17); }
+        Nullable<IfcHeatingValueMeasure> get_IfcHeatingValueMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcHeatingValueMeasure>(17, sdaiREAL); }
+        bool is_IfcIlluminanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(18); }
+        Nullable<IfcIlluminanceMeasure> get_IfcIlluminanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcIlluminanceMeasure>(18, sdaiREAL); }
+        bool is_IfcInductanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(19); }
+        Nullable<IfcInductanceMeasure> get_IfcInductanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcInductanceMeasure>(19, sdaiREAL); }
+        bool is_IfcIntegerCountRateMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(20); }
+        Nullable<IfcIntegerCountRateMeasure> get_IfcIntegerCountRateMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcIntegerCountRateMeasure>(20, sdaiINTEGER); }
+        bool is_IfcIonConcentrationMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(21); }
+        Nullable<IfcIonConcentrationMeasure> get_IfcIonConcentrationMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcIonConcentrationMeasure>(21, sdaiREAL); }
+        bool is_IfcIsothermalMoistureCapacityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(22); }
+        Nullable<IfcIsothermalMoistureCapacityMeasure> get_IfcIsothermalMoistureCapacityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcIsothermalMoistureCapacityMeasure>(22, sdaiREAL); }
+        bool is_IfcKinematicViscosityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(23); }
+        Nullable<IfcKinematicViscosityMeasure> get_IfcKinematicViscosityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcKinematicViscosityMeasure>(23, sdaiREAL); }
+        bool is_IfcLinearForceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(24); }
+        Nullable<IfcLinearForceMeasure> get_IfcLinearForceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLinearForceMeasure>(24, sdaiREAL); }
+        bool is_IfcLinearMomentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(25); }
+        Nullable<IfcLinearMomentMeasure> get_IfcLinearMomentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLinearMomentMeasure>(25, sdaiREAL); }
+        bool is_IfcLinearStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(26); }
+        Nullable<IfcLinearStiffnessMeasure> get_IfcLinearStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLinearStiffnessMeasure>(26, sdaiREAL); }
+        bool is_IfcLinearVelocityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(27); }
+        Nullable<IfcLinearVelocityMeasure> get_IfcLinearVelocityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLinearVelocityMeasure>(27, sdaiREAL); }
+        bool is_IfcLuminousFluxMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(28); }
+        Nullable<IfcLuminousFluxMeasure> get_IfcLuminousFluxMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLuminousFluxMeasure>(28, sdaiREAL); }
+        bool is_IfcLuminousIntensityDistributionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(29); }
+        Nullable<IfcLuminousIntensityDistributionMeasure> get_IfcLuminousIntensityDistributionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLuminousIntensityDistributionMeasure>(29, sdaiREAL); }
+        bool is_IfcMagneticFluxDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(30); }
+        Nullable<IfcMagneticFluxDensityMeasure> get_IfcMagneticFluxDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMagneticFluxDensityMeasure>(30, sdaiREAL); }
+        bool is_IfcMagneticFluxMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(31); }
+        Nullable<IfcMagneticFluxMeasure> get_IfcMagneticFluxMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMagneticFluxMeasure>(31, sdaiREAL); }
+        bool is_IfcMassDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(32); }
+        Nullable<IfcMassDensityMeasure> get_IfcMassDensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMassDensityMeasure>(32, sdaiREAL); }
+        bool is_IfcMassFlowRateMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(33); }
+        Nullable<IfcMassFlowRateMeasure> get_IfcMassFlowRateMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMassFlowRateMeasure>(33, sdaiREAL); }
+        bool is_IfcMassPerLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(34); }
+        Nullable<IfcMassPerLengthMeasure> get_IfcMassPerLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMassPerLengthMeasure>(34, sdaiREAL); }
+        bool is_IfcModulusOfElasticityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(35); }
+        Nullable<IfcModulusOfElasticityMeasure> get_IfcModulusOfElasticityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfElasticityMeasure>(35, sdaiREAL); }
+        bool is_IfcModulusOfLinearSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(36); }
+        Nullable<IfcModulusOfLinearSubgradeReactionMeasure> get_IfcModulusOfLinearSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfLinearSubgradeReactionMeasure>(36, sdaiREAL); }
+        bool is_IfcModulusOfRotationalSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(37); }
+        Nullable<IfcModulusOfRotationalSubgradeReactionMeasure> get_IfcModulusOfRotationalSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfRotationalSubgradeReactionMeasure>(37, sdaiREAL); }
+        bool is_IfcModulusOfSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(38); }
+        Nullable<IfcModulusOfSubgradeReactionMeasure> get_IfcModulusOfSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfSubgradeReactionMeasure>(38, sdaiREAL); }
+        bool is_IfcMoistureDiffusivityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(39); }
+        Nullable<IfcMoistureDiffusivityMeasure> get_IfcMoistureDiffusivityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMoistureDiffusivityMeasure>(39, sdaiREAL); }
+        bool is_IfcMolecularWeightMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(40); }
+        Nullable<IfcMolecularWeightMeasure> get_IfcMolecularWeightMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMolecularWeightMeasure>(40, sdaiREAL); }
+        bool is_IfcMomentOfInertiaMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(41); }
+        Nullable<IfcMomentOfInertiaMeasure> get_IfcMomentOfInertiaMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMomentOfInertiaMeasure>(41, sdaiREAL); }
+        bool is_IfcMonetaryMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(42); }
+        Nullable<IfcMonetaryMeasure> get_IfcMonetaryMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMonetaryMeasure>(42, sdaiREAL); }
+        bool is_IfcPHMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(43); }
+        Nullable<IfcPHMeasure> get_IfcPHMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPHMeasure>(43, sdaiREAL); }
+        bool is_IfcPlanarForceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(44); }
+        Nullable<IfcPlanarForceMeasure> get_IfcPlanarForceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPlanarForceMeasure>(44, sdaiREAL); }
+        bool is_IfcPowerMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(45); }
+        Nullable<IfcPowerMeasure> get_IfcPowerMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPowerMeasure>(45, sdaiREAL); }
+        bool is_IfcPressureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(46); }
+        Nullable<IfcPressureMeasure> get_IfcPressureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPressureMeasure>(46, sdaiREAL); }
+        bool is_IfcRadioActivityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(47); }
+        Nullable<IfcRadioActivityMeasure> get_IfcRadioActivityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRadioActivityMeasure>(47, sdaiREAL); }
+        bool is_IfcRotationalFrequencyMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(48); }
+        Nullable<IfcRotationalFrequencyMeasure> get_IfcRotationalFrequencyMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRotationalFrequencyMeasure>(48, sdaiREAL); }
+        bool is_IfcRotationalMassMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(49); }
+        Nullable<IfcRotationalMassMeasure> get_IfcRotationalMassMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRotationalMassMeasure>(49, sdaiREAL); }
+        bool is_IfcRotationalStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(50); }
+        Nullable<IfcRotationalStiffnessMeasure> get_IfcRotationalStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRotationalStiffnessMeasure>(50, sdaiREAL); }
+        bool is_IfcSectionModulusMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(51); }
+        Nullable<IfcSectionModulusMeasure> get_IfcSectionModulusMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSectionModulusMeasure>(51, sdaiREAL); }
+        bool is_IfcSectionalAreaIntegralMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(52); }
+        Nullable<IfcSectionalAreaIntegralMeasure> get_IfcSectionalAreaIntegralMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSectionalAreaIntegralMeasure>(52, sdaiREAL); }
+        bool is_IfcShearModulusMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(53); }
+        Nullable<IfcShearModulusMeasure> get_IfcShearModulusMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcShearModulusMeasure>(53, sdaiREAL); }
+        bool is_IfcSoundPowerLevelMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(54); }
+        Nullable<IfcSoundPowerLevelMeasure> get_IfcSoundPowerLevelMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSoundPowerLevelMeasure>(54, sdaiREAL); }
+        bool is_IfcSoundPowerMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(55); }
+        Nullable<IfcSoundPowerMeasure> get_IfcSoundPowerMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSoundPowerMeasure>(55, sdaiREAL); }
+        bool is_IfcSoundPressureLevelMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(56); }
+        Nullable<IfcSoundPressureLevelMeasure> get_IfcSoundPressureLevelMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSoundPressureLevelMeasure>(56, sdaiREAL); }
+        bool is_IfcSoundPressureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(57); }
+        Nullable<IfcSoundPressureMeasure> get_IfcSoundPressureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSoundPressureMeasure>(57, sdaiREAL); }
+        bool is_IfcSpecificHeatCapacityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(58); }
+        Nullable<IfcSpecificHeatCapacityMeasure> get_IfcSpecificHeatCapacityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSpecificHeatCapacityMeasure>(58, sdaiREAL); }
+        bool is_IfcTemperatureGradientMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(59); }
+        Nullable<IfcTemperatureGradientMeasure> get_IfcTemperatureGradientMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcTemperatureGradientMeasure>(59, sdaiREAL); }
+        bool is_IfcTemperatureRateOfChangeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(60); }
+        Nullable<IfcTemperatureRateOfChangeMeasure> get_IfcTemperatureRateOfChangeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcTemperatureRateOfChangeMeasure>(60, sdaiREAL); }
+        bool is_IfcThermalAdmittanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(61); }
+        Nullable<IfcThermalAdmittanceMeasure> get_IfcThermalAdmittanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcThermalAdmittanceMeasure>(61, sdaiREAL); }
+        bool is_IfcThermalConductivityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(62); }
+        Nullable<IfcThermalConductivityMeasure> get_IfcThermalConductivityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcThermalConductivityMeasure>(62, sdaiREAL); }
+        bool is_IfcThermalExpansionCoefficientMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(63); }
+        Nullable<IfcThermalExpansionCoefficientMeasure> get_IfcThermalExpansionCoefficientMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcThermalExpansionCoefficientMeasure>(63, sdaiREAL); }
+        bool is_IfcThermalResistanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(64); }
+        Nullable<IfcThermalResistanceMeasure> get_IfcThermalResistanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcThermalResistanceMeasure>(64, sdaiREAL); }
+        bool is_IfcThermalTransmittanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(65); }
+        Nullable<IfcThermalTransmittanceMeasure> get_IfcThermalTransmittanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcThermalTransmittanceMeasure>(65, sdaiREAL); }
+        bool is_IfcTorqueMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(66); }
+        Nullable<IfcTorqueMeasure> get_IfcTorqueMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcTorqueMeasure>(66, sdaiREAL); }
+        bool is_IfcVaporPermeabilityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(67); }
+        Nullable<IfcVaporPermeabilityMeasure> get_IfcVaporPermeabilityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcVaporPermeabilityMeasure>(67, sdaiREAL); }
+        bool is_IfcVolumetricFlowRateMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(68); }
+        Nullable<IfcVolumetricFlowRateMeasure> get_IfcVolumetricFlowRateMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcVolumetricFlowRateMeasure>(68, sdaiREAL); }
+        bool is_IfcWarpingConstantMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(69); }
+        Nullable<IfcWarpingConstantMeasure> get_IfcWarpingConstantMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcWarpingConstantMeasure>(69, sdaiREAL); }
+        bool is_IfcWarpingMomentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(70); }
+        Nullable<IfcWarpingMomentMeasure> get_IfcWarpingMomentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcWarpingMomentMeasure>(70, sdaiREAL); }
+
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+        Nullable<IntValue> as_int() { RDF_EXPRESS_PROBE(ProbeAttr()); IntValue val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+    };
+
+
+    class IfcDerivedMeasureValue_put : public Select
+    {
+    public:
+        IfcDerivedMeasureValue_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcDerivedMeasureValue_put(Select* outer) : Select(outer) {}
+        void put_IfcAbsorbedDoseMeasure(IfcAbsorbedDoseMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(0, sdaiREAL, value); }
+        void put_IfcAccelerationMeasure(IfcAccelerationMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(1, sdaiREAL, value); }
+        void put_IfcAngularVelocityMeasure(IfcAngularVelocityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(2, sdaiREAL, value); }
+        void put_IfcAreaDensityMeasure(IfcAreaDensityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(3, sdaiREAL, value); }
+
+                //TList may be IfcCompoundPlaneAngleMeasure or list of convertible elements
+        template <typename TList> void put_IfcCompoundPlaneAngleMeasure(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); IfcCompoundPlaneAngleMeasureSerializer<TList> sr; SdaiAggr aggr = sr.ToSdaiAggr(lst, m_instance, NULL); putAggrValue(4, aggr); }
+
+                //TArrayElem[] may be IntValue[] or array of convertible elements
+        template <typename TArrayElem> void put_IfcCompoundPlaneAngleMeasure(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(ProbeAttr()); ArrayRange<TArrayElem> range = {arr, n}; IfcCompoundPlaneAngleMeasureSerializer<IfcCompoundPlaneAngleMeasure> sr; SdaiAggr aggr = sr.RangeToSdaiAggr(range, m_instance, NULL); putAggrValue(4, aggr); }
+        void put_IfcCurvatureMeasure(IfcCurvatureMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(5, sdaiREAL, value); }
+        void put_IfcDoseEquivalentMeasure(IfcDoseEquivalentMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(6, sdaiREAL, value); }
+        void put_IfcDynamicViscosityMeasure(IfcDynamicViscosityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(7, sdaiREAL, value); }
+        void put_IfcElectricCapacitanceMeasure(IfcElectricCapacitanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(8, sdaiREAL, value); }
+        void put_IfcElectricChargeMeasure(IfcElectricChargeMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(9, sdaiREAL, value); }
+        void put_IfcElectricConductanceMeasure(IfcElectricConductanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(10, sdaiREAL, value); }
+        void put_IfcElectricResistanceMeasure(IfcElectricResistanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(11, sdaiREAL, value); }
+        void put_IfcElectricVoltageMeasure(IfcElectricVoltageMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(12, sdaiREAL, value); }
+        void put_IfcEnergyMeasure(IfcEnergyMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(13, sdaiREAL, value); }
+        void put_IfcForceMeasure(IfcForceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(14, sdaiREAL, value); }
+        void put_IfcFrequencyMeasure(IfcFrequencyMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(15, sdaiREAL, value); }
+        void put_IfcHeatFluxDensityMeasure(IfcHeatFluxDensityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(16, sdaiREAL, value); }
+        void put_IfcHeatingValueMeasure(IfcHeatingValueMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(17, sdaiREAL, value); }
+        void put_IfcIlluminanceMeasure(IfcIlluminanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(18, sdaiREAL, value); }
+        void put_IfcInductanceMeasure(IfcInductanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(19, sdaiREAL, value); }
+        void put_IfcIntegerCountRateMeasure(IfcIntegerCountRateMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(20, sdaiINTEGER, value); }
+        void put_IfcIonConcentrationMeasure(IfcIonConcentrationMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(21, sdaiREAL, value); }
+        void put_IfcIsothermalMoistureCapacityMeasure(IfcIsothermalMoistureCapacityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(22, sdaiREAL, value); }
+        void put_IfcKinematicViscosityMeasure(IfcKinematicViscosityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(23, sdaiREAL, value); }
+        void put_IfcLinearForceMeasure(IfcLinearForceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(24, sdaiREAL, value); }
+        void put_IfcLinearMomentMeasure(IfcLinearMomentMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(25, sdaiREAL, value); }
+        void put_IfcLinearStiffnessMeasure(IfcLinearStiffnessMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(26, sdaiREAL, value); }
+        void put_IfcLinearVelocityMeasure(IfcLinearVelocityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(27, sdaiREAL, value); }
+        void put_IfcLuminousFluxMeasure(IfcLuminousFluxMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(28, sdaiREAL, value); }
+        void put_IfcLuminousIntensityDistributionMeasure(IfcLuminousIntensityDistributionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(29, sdaiREAL, value); }
+        void put_IfcMagneticFluxDensityMeasure(IfcMagneticFluxDensityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(30, sdaiREAL, value); }
+        void put_IfcMagneticFluxMeasure(IfcMagneticFluxMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(31, sdaiREAL, value); }
+        void put_IfcMassDensityMeasure(IfcMassDensityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(32, sdaiREAL, value); }
+        void put_IfcMassFlowRateMeasure(IfcMassFlowRateMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(33, sdaiREAL, value); }
+        void put_IfcMassPerLengthMeasure(IfcMassPerLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(34, sdaiREAL, value); }
+        void put_IfcModulusOfElasticityMeasure(IfcModulusOfElasticityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(35, sdaiREAL, value); }
+        void put_IfcModulusOfLinearSubgradeReactionMeasure(IfcModulusOfLinearSubgradeReactionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(36, sdaiREAL, value); }
+        void put_IfcModulusOfRotationalSubgradeReactionMeasure(IfcModulusOfRotationalSubgradeReactionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(37, sdaiREAL, value); }
+        void put_IfcModulusOfSubgradeReactionMeasure(IfcModulusOfSubgradeReactionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(38, sdaiREAL, value); }
+        void put_IfcMoistureDiffusivityMeasure(IfcMoistureDiffusivityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(39, sdaiREAL, value); }
+        void put_IfcMolecularWeightMeasure(IfcMolecularWeightMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(40, sdaiREAL, value); }
+        void put_IfcMomentOfInertiaMeasure(IfcMomentOfInertiaMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(41, sdaiREAL, value); }
+        void put_IfcMonetaryMeasure(IfcMonetaryMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(42, sdaiREAL, value); }
+        void put_IfcPHMeasure(IfcPHMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(43, sdaiREAL, value); }
+        void put_IfcPlanarForceMeasure(IfcPlanarForceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(44, sdaiREAL, value); }
+        void put_IfcPowerMeasure(IfcPowerMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(45, sdaiREAL, value); }
+        void put_IfcPressureMeasure(IfcPressureMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(46, sdaiREAL, value); }
+        void put_IfcRadioActivityMeasure(IfcRadioActivityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(47, sdaiREAL, value); }
+        void put_IfcRotationalFrequencyMeasure(IfcRotationalFrequencyMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(48, sdaiREAL, value); }
+        void put_IfcRotationalMassMeasure(IfcRotationalMassMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(49, sdaiREAL, value); }
+        void put_IfcRotationalStiffnessMeasure(IfcRotationalStiffnessMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(50, sdaiREAL, value); }
+        void put_IfcSectionModulusMeasure(IfcSectionModulusMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(51, sdaiREAL, value); }
+        void put_IfcSectionalAreaIntegralMeasure(IfcSectionalAreaIntegralMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(52, sdaiREAL, value); }
+        void put_IfcShearModulusMeasure(IfcShearModulusMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(53, sdaiREAL, value); }
+        void put_IfcSoundPowerLevelMeasure(IfcSoundPowerLevelMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(54, sdaiREAL, value); }
+        void put_IfcSoundPowerMeasure(IfcSoundPowerMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(55, sdaiREAL, value); }
+        void put_IfcSoundPressureLevelMeasure(IfcSoundPressureLevelMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(56, sdaiREAL, value); }
+        void put_IfcSoundPressureMeasure(IfcSoundPressureMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(57, sdaiREAL, value); }
+        void put_IfcSpecificHeatCapacityMeasure(IfcSpecificHeatCapacityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(58, sdaiREAL, value); }
+        void put_IfcTemperatureGradientMeasure(IfcTemperatureGradientMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(59, sdaiREAL, value); }
+        void put_IfcTemperatureRateOfChangeMeasure(IfcTemperatureRateOfChangeMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(60, sdaiREAL, value); }
+        void put_IfcThermalAdmittanceMeasure(IfcThermalAdmittanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(61, sdaiREAL, value); }
+        void put_IfcThermalConductivityMeasure(IfcThermalConductivityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(62, sdaiREAL, value); }
+        void put_IfcThermalExpansionCoefficientMeasure(IfcThermalExpansionCoefficientMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(63, sdaiREAL, value); }
+        void put_IfcThermalResistanceMeasure(IfcThermalResistanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(64, sdaiREAL, value); }
+        void put_IfcThermalTransmittanceMeasure(IfcThermalTransmittanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(65, sdaiREAL, value); }
+        void put_IfcTorqueMeasure(IfcTorqueMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(66, sdaiREAL, value); }
+        void put_IfcVaporPermeabilityMeasure(IfcVaporPermeabilityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(67, sdaiREAL, value); }
+        void put_IfcVolumetricFlowRateMeasure(IfcVolumetricFlowRateMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(68, sdaiREAL, value); }
+        void put_IfcWarpingConstantMeasure(IfcWarpingConstantMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(69, sdaiREAL, value); }
+        void put_IfcWarpingMomentMeasure(IfcWarpingMomentMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(70, sdaiREAL, value); }
+    };
+
+
+    class IfcMeasureValue : public Select
+    {
+    public:
+        IfcMeasureValue(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcMeasureValue(Select* outer) : Select(outer) {}
+
+        bool is_IfcAmountOfSubstanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(71); }
+        Nullable<IfcAmountOfSubstanceMeasure> get_IfcAmountOfSubstanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcAmountOfSubstanceMeasure>(71, sdaiREAL); }
+        void put_IfcAmountOfSubstanceMeasure(IfcAmountOfSubstanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(71, sdaiREAL, value); }
+
+        bool is_IfcAreaMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(72); }
+        Nullable<IfcAreaMeasure> get_IfcAreaMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcAreaMeasure>(72, sdaiREAL); }
+        void put_IfcAreaMeasure(IfcAreaMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(72, sdaiREAL, value); }
+
+        bool is_IfcComplexNumber() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(73); }
+
+        //TList may be IfcComplexNumber or list of convertible elements
+        template <typename TList> void get_IfcComplexNumber(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); SdaiAggr aggr = getAggrValue(73); IfcComplexNumberSerializer<TList> sr; sr.FromSdaiAggr(lst, m_instance, aggr); }
+
+                //TList may be IfcComplexNumber or list of convertible elements
+        template <typename TList> void put_IfcComplexNumber(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); IfcComplexNumberSerializer<TList> sr; SdaiAggr aggr = sr.ToSdaiAggr(lst, m_instance, NULL); putAggrValue(73, aggr); }
+
+                //TArrayElem[] may be double[] or array of convertible elements
+        template <typename TArrayElem> void put_IfcComplexNumber(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(ProbeAttr()); ArrayRange<TArrayElem> range = {arr, n}; IfcComplexNumberSerializer<IfcComplexNumber> sr; SdaiAggr aggr = sr.RangeToSdaiAggr(range, m_instance, NULL); putAggrValue(73, aggr); }
+
+        bool is_IfcContextDependentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(74); }
+        Nullable<IfcContextDependentMeasure> get_IfcContextDependentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcContextDependentMeasure>(74, sdaiREAL); }
+        void put_IfcContextDependentMeasure(IfcContextDependentMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(74, sdaiREAL, value); }
+
+        bool is_IfcCountMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(75); }
+        Nullable<IfcCountMeasure> get_IfcCountMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcCountMeasure>(75, sdaiREAL); }
+        void put_IfcCountMeasure(IfcCountMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(75, sdaiREAL, value); }
+
+        bool is_IfcDescriptiveMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(76); }
+        IfcDescriptiveMeasure get_IfcDescriptiveMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(76, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcDescriptiveMeasure_view() { return TextView(get_IfcDescriptiveMeasure()); }
+#endif
+        void put_IfcDescriptiveMeasure(IfcDescriptiveMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(76, sdaiSTRING, value); }
+
+        bool is_IfcElectricCurrentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(77); }
+        Nullable<IfcElectricCurrentMeasure> get_IfcElectricCurrentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcElectricCurrentMeasure>(77, sdaiREAL); }
+        void put_IfcElectricCurrentMeasure(IfcElectricCurrentMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(77, sdaiREAL, value); }
+
+        bool is_IfcLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(78); }
+        Nullable<IfcLengthMeasure> get_IfcLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLengthMeasure>(78, sdaiREAL); }
+        void put_IfcLengthMeasure(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(78, sdaiREAL, value); }
+
+        bool is_IfcLuminousIntensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(79); }
+        Nullable<IfcLuminousIntensityMeasure> get_IfcLuminousIntensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLuminousIntensityMeasure>(79, sdaiREAL); }
+        void put_IfcLuminousIntensityMeasure(IfcLuminousIntensityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(79, sdaiREAL, value); }
+
+        bool is_IfcMassMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(80); }
+        Nullable<IfcMassMeasure> get_IfcMassMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMassMeasure>(80, sdaiREAL); }
+        void put_IfcMassMeasure(IfcMassMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(80, sdaiREAL, value); }
+
+        bool is_IfcNonNegativeLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(81); }
+        Nullable<IfcNonNegativeLengthMeasure> get_IfcNonNegativeLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcNonNegativeLengthMeasure>(81, sdaiREAL); }
+        void put_IfcNonNegativeLengthMeasure(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(81, sdaiREAL, value); }
+
+        bool is_IfcNormalisedRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(82); }
+        Nullable<IfcNormalisedRatioMeasure> get_IfcNormalisedRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcNormalisedRatioMeasure>(82, sdaiREAL); }
+        void put_IfcNormalisedRatioMeasure(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(82, sdaiREAL, value); }
+
+        bool is_IfcNumericMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(83); }
+        Nullable<IfcNumericMeasure> get_IfcNumericMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcNumericMeasure>(83, sdaiREAL); }
+        void put_IfcNumericMeasure(IfcNumericMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(83, sdaiREAL, value); }
+
+        bool is_IfcParameterValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(84); }
+        Nullable<IfcParameterValue> get_IfcParameterValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcParameterValue>(84, sdaiREAL); }
+        void put_IfcParameterValue(IfcParameterValue value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(84, sdaiREAL, value); }
+
+        bool is_IfcPlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(85); }
+        Nullable<IfcPlaneAngleMeasure> get_IfcPlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPlaneAngleMeasure>(85, sdaiREAL); }
+        void put_IfcPlaneAngleMeasure(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(85, sdaiREAL, value); }
+
+        bool is_IfcPositiveLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(86); }
+        Nullable<IfcPositiveLengthMeasure> get_IfcPositiveLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositiveLengthMeasure>(86, sdaiREAL); }
+        void put_IfcPositiveLengthMeasure(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(86, sdaiREAL, value); }
+
+        bool is_IfcPositivePlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(87); }
+        Nullable<IfcPositivePlaneAngleMeasure> get_IfcPositivePlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositivePlaneAngleMeasure>(87, sdaiREAL); }
+        void put_IfcPositivePlaneAngleMeasure(IfcPositivePlaneAngleMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(87, sdaiREAL, value); }
+
+        bool is_IfcPositiveRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(88); }
+        Nullable<IfcPositiveRatioMeasure> get_IfcPositiveRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositiveRatioMeasure>(88, sdaiREAL); }
+        void put_IfcPositiveRatioMeasure(IfcPositiveRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(88, sdaiREAL, value); }
+
+        bool is_IfcRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(89); }
+        Nullable<IfcRatioMeasure> get_IfcRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRatioMeasure>(89, sdaiREAL); }
+        void put_IfcRatioMeasure(IfcRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(89, sdaiREAL, value); }
+
+        bool is_IfcSolidAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(90); }
+        Nullable<IfcSolidAngleMeasure> get_IfcSolidAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSolidAngleMeasure>(90, sdaiREAL); }
+        void put_IfcSolidAngleMeasure(IfcSolidAngleMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(90, sdaiREAL, value); }
+
+        bool is_IfcThermodynamicTemperatureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(91); }
+        Nullable<IfcThermodynamicTemperatureMeasure> get_IfcThermodynamicTemperatureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcThermodynamicTemperatureMeasure>(91, sdaiREAL); }
+        void put_IfcThermodynamicTemperatureMeasure(IfcThermodynamicTemperatureMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(91, sdaiREAL, value); }
+
+        bool is_IfcTimeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(92); }
+        Nullable<IfcTimeMeasure> get_IfcTimeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcTimeMeasure>(92, sdaiREAL); }
+        void put_IfcTimeMeasure(IfcTimeMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(92, sdaiREAL, value); }
+
+        bool is_IfcVolumeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(93); }
+        Nullable<IfcVolumeMeasure> get_IfcVolumeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcVolumeMeasure>(93, sdaiREAL); }
+        void put_IfcVolumeMeasure(IfcVolumeMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(93, sdaiREAL, value); }
+    };
+
+
+    class IfcMeasureValue_get : public Select
+    {
+    public:
+        IfcMeasureValue_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcMeasureValue_get(Select* outer) : Select(outer) {}
+        bool is_IfcAmountOfSubstanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(71); }
+        Nullable<IfcAmountOfSubstanceMeasure> get_IfcAmountOfSubstanceMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcAmountOfSubstanceMeasure>(71, sdaiREAL); }
+        bool is_IfcAreaMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(72); }
+        Nullable<IfcAreaMeasure> get_IfcAreaMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcAreaMeasure>(72, sdaiREAL); }
+        bool is_IfcComplexNumber() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(73); }
+
+        //TList may be IfcComplexNumber or list of convertible elements
+        template <typename TList> void get_IfcComplexNumber(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); SdaiAggr aggr = getAggrValue(73); IfcComplexNumberSerializer<TList> sr; sr.FromSdaiAggr(lst, m_instance, aggr); }
+        bool is_IfcContextDependentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(74); }
+        Nullable<IfcContextDependentMeasure> get_IfcContextDependentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcContextDependentMeasure>(74, sdaiREAL); }
+        bool is_IfcCountMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(75); }
+        Nullable<IfcCountMeasure> get_IfcCountMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcCountMeasure>(75, sdaiREAL); }
+        bool is_IfcDescriptiveMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(76); }
+        IfcDescriptiveMeasure get_IfcDescriptiveMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(76, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcDescriptiveMeasure_view() { return TextView(get_IfcDescriptiveMeasure()); }
+#endif
+        bool is_IfcElectricCurrentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(77); }
+        Nullable<IfcElectricCurrentMeasure> get_IfcElectricCurrentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcElectricCurrentMeasure>(77, sdaiREAL); }
+        bool is_IfcLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(78); }
+        Nullable<IfcLengthMeasure> get_IfcLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLengthMeasure>(78, sdaiREAL); }
+        bool is_IfcLuminousIntensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(79); }
+        Nullable<IfcLuminousIntensityMeasure> get_IfcLuminousIntensityMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLuminousIntensityMeasure>(79, sdaiREAL); }
+        bool is_IfcMassMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(80); }
+        Nullable<IfcMassMeasure> get_IfcMassMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcMassMeasure>(80, sdaiREAL); }
+        bool is_IfcNonNegativeLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(81); }
+        Nullable<IfcNonNegativeLengthMeasure> get_IfcNonNegativeLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcNonNegativeLengthMeasure>(81, sdaiREAL); }
+        bool is_IfcNormalisedRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(82); }
+        Nullable<IfcNormalisedRatioMeasure> get_IfcNormalisedRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcNormalisedRatioMeasure>(82, sdaiREAL); }
+        bool is_IfcNumericMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(83); }
+        Nullable<IfcNumericMeasure> get_IfcNumericMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcNumericMeasure>(83, sdaiREAL); }
+        bool is_IfcParameterValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(84); }
+        Nullable<IfcParameterValue> get_IfcParameterValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcParameterValue>(84, sdaiREAL); }
+        bool is_IfcPlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(85); }
+        Nullable<IfcPlaneAngleMeasure> get_IfcPlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPlaneAngleMeasure>(85, sdaiREAL); }
+        bool is_IfcPositiveLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(86); }
+        Nullable<IfcPositiveLengthMeasure> get_IfcPositiveLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositiveLengthMeasure>(86, sdaiREAL); }
+        bool is_IfcPositivePlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(87); }
+        Nullable<IfcPositivePlaneAngleMeasure> get_IfcPositivePlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositivePlaneAngleMeasure>(87, sdaiREAL); }
+        bool is_IfcPositiveRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(88); }
+        Nullable<IfcPositiveRatioMeasure> get_IfcPositiveRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositiveRatioMeasure>(88, sdaiREAL); }
+        bool is_IfcRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(89); }
+        Nullable<IfcRatioMeasure> get_IfcRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRatioMeasure>(89, sdaiREAL); }
+        bool is_IfcSolidAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(90); }
+        Nullable<IfcSolidAngleMeasure> get_IfcSolidAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSolidAngleMeasure>(90, sdaiREAL); }
+        bool is_IfcThermodynamicTemperatureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(91); }
+        Nullable<IfcThermodynamicTemperatureMeasure> get_IfcThermodynamicTemperatureMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcThermodynamicTemperatureMeasure>(91, sdaiREAL); }
+        bool is_IfcTimeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(92); }
+        Nullable<IfcTimeMeasure> get_IfcTimeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcTimeMeasure>(92, sdaiREAL); }
+        bool is_IfcVolumeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(93); }
+        Nullable<IfcVolumeMeasure> get_IfcVolumeMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcVolumeMeasure>(93, sdaiREAL); }
+
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+        TextValue as_text() { RDF_EXPRESS_PROBE(ProbeAttr()); TextValue val = NULL; sdaiGetAttr(m_instance, getAttrDefinition(), sdaiSTRING, &val); return val; }
+#ifdef __cpp_lib_string_view
+        std::string_view as_text_view() { return TextView(as_text()); }
+#endif
+        const char* as_text_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(ProbeAttr()); return buffer.GetAttr(m_instance, getAttrName()); }
+        const char* as_text_utf8() { return as_text_utf8(ThreadUtf8Buffer()); }
+    };
+
+
+    class IfcMeasureValue_put : public Select
+    {
+    public:
+        IfcMeasureValue_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcMeasureValue_put(Select* outer) : Select(outer) {}
+        void put_IfcAmountOfSubstanceMeasure(IfcAmountOfSubstanceMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(71, sdaiREAL, value); }
+        void put_IfcAreaMeasure(IfcAreaMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(72, sdaiREAL, value); }
+
+                //TList may be IfcComplexNumber or list of convertible elements
+        template <typename TList> void put_IfcComplexNumber(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); IfcComplexNumberSerializer<TList> sr; SdaiAggr aggr = sr.ToSdaiAggr(lst, m_instance, NULL); putAggrValue(73, aggr); }
+
+                //TArrayElem[] may be double[] or array of convertible elements
+        template <typename TArrayElem> void put_IfcComplexNumber(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(ProbeAttr()); ArrayRange<TArrayElem> range = {arr, n}; IfcComplexNumberSerializer<IfcComplexNumber> sr; SdaiAggr aggr = sr.RangeToSdaiAggr(range, m_instance, NULL); putAggrValue(73, aggr); }
+        void put_IfcContextDependentMeasure(IfcContextDependentMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(74, sdaiREAL, value); }
+        void put_IfcCountMeasure(IfcCountMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(75, sdaiREAL, value); }
+        void put_IfcDescriptiveMeasure(IfcDescriptiveMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(76, sdaiSTRING, value); }
+        void put_IfcElectricCurrentMeasure(IfcElectricCurrentMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(77, sdaiREAL, value); }
+        void put_IfcLengthMeasure(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(78, sdaiREAL, value); }
+        void put_IfcLuminousIntensityMeasure(IfcLuminousIntensityMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(79, sdaiREAL, value); }
+        void put_IfcMassMeasure(IfcMassMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(80, sdaiREAL, value); }
+        void put_IfcNonNegativeLengthMeasure(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(81, sdaiREAL, value); }
+        void put_IfcNormalisedRatioMeasure(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(82, sdaiREAL, value); }
+        void put_IfcNumericMeasure(IfcNumericMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(83, sdaiREAL, value); }
+        void put_IfcParameterValue(IfcParameterValue value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(84, sdaiREAL, value); }
+        void put_IfcPlaneAngleMeasure(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(85, sdaiREAL, value); }
+        void put_IfcPositiveLengthMeasure(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(86, sdaiREAL, value); }
+        void put_IfcPositivePlaneAngleMeasure(IfcPositivePlaneAngleMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(87, sdaiREAL, value); }
+        void put_IfcPositiveRatioMeasure(IfcPositiveRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(88, sdaiREAL, value); }
+        void put_IfcRatioMeasure(IfcRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(89, sdaiREAL, value); }
+        void put_IfcSolidAngleMeasure(IfcSolidAngleMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(90, sdaiREAL, value); }
+        void put_IfcThermodynamicTemperatureMeasure(IfcThermodynamicTemperatureMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(91, sdaiREAL, value); }
+        void put_IfcTimeMeasure(IfcTimeMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(92, sdaiREAL, value); }
+        void put_IfcVolumeMeasure(IfcVolumeMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(93, sdaiREAL, value); }
+    };
+
+
+    class IfcSimpleValue : public Select
+    {
+    public:
+        IfcSimpleValue(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSimpleValue(Select* outer) : Select(outer) {}
+
+        bool is_IfcBinary() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(94); }
+        IfcBinary get_IfcBinary() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(94, sdaiBINARY); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcBinary_view() { return TextView(get_IfcBinary()); }
+#endif
+        void put_IfcBinary(IfcBinary value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(94, sdaiBINARY, value); }
+
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+
+        bool is_IfcDate() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(96); }
+        IfcDate get_IfcDate() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(96, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcDate_view() { return TextView(get_IfcDate()); }
+#endif
+        void put_IfcDate(IfcDate value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(96, sdaiSTRING, value); }
+
+        bool is_IfcDateTime() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(97); }
+        IfcDateTime get_IfcDateTime() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(97, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcDateTime_view() { return TextView(get_IfcDateTime()); }
+#endif
+        void put_IfcDateTime(IfcDateTime value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(97, sdaiSTRING, value); }
+
+        bool is_IfcDuration() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(98); }
+        IfcDuration get_IfcDuration() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(98, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcDuration_view() { return TextView(get_IfcDuration()); }
+#endif
+        void put_IfcDuration(IfcDuration value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(98, sdaiSTRING, value); }
+
+        bool is_IfcIdentifier() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(99); }
+        IfcIdentifier get_IfcIdentifier() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(99, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcIdentifier_view() { return TextView(get_IfcIdentifier()); }
+#endif
+        void put_IfcIdentifier(IfcIdentifier value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(99, sdaiSTRING, value); }
+
+        bool is_IfcInteger() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(100); }
+        Nullable<IfcInteger> get_IfcInteger() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcInteger>(100, sdaiINTEGER); }
+        void put_IfcInteger(IfcInteger value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(100, sdaiINTEGER, value); }
+
+        bool is_IfcLabel() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(101); }
+        IfcLabel get_IfcLabel() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(101, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcLabel_view() { return TextView(get_IfcLabel()); }
+#endif
+        void put_IfcLabel(IfcLabel value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(101, sdaiSTRING, value); }
+
+        bool is_IfcLogical() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(102); }
+        Nullable<IfcLogical> get_IfcLogical() { RDF_EXPRESS_PROBE(ProbeAttr()); int v = getEnumerationValue(102, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_IfcLogical(IfcLogical value) { RDF_EXPRESS_PROBE(ProbeAttr()); TextValue val = LOGICAL_VALUE_[(int) value]; putEnumerationValue(102, val); }
+
+        bool is_IfcPositiveInteger() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(103); }
+        Nullable<IfcPositiveInteger> get_IfcPositiveInteger() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositiveInteger>(103, sdaiINTEGER); }
+        void put_IfcPositiveInteger(IfcPositiveInteger value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(103, sdaiINTEGER, value); }
+
+        bool is_IfcReal() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(104); }
+        Nullable<IfcReal> get_IfcReal() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcReal>(104, sdaiREAL); }
+        void put_IfcReal(IfcReal value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(104, sdaiREAL, value); }
+
+        bool is_IfcText() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(105); }
+        IfcText get_IfcText() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(105, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcText_view() { return TextView(get_IfcText()); }
+#endif
+        void put_IfcText(IfcText value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(105, sdaiSTRING, value); }
+
+        bool is_IfcTime() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(106); }
+        IfcTime get_IfcTime() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(106, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcTime_view() { return TextView(get_IfcTime()); }
+#endif
+        void put_IfcTime(IfcTime value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(106, sdaiSTRING, value); }
+
+        bool is_IfcTimeStamp() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(107); }
+        Nullable<IfcTimeStamp> get_IfcTimeStamp() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcTimeStamp>(107, sdaiINTEGER); }
+        void put_IfcTimeStamp(IfcTimeStamp value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(107, sdaiINTEGER, value); }
+    };
+
+
+    class IfcSimpleValue_get : public Select
+    {
+    public:
+        IfcSimpleValue_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSimpleValue_get(Select* outer) : Select(outer) {}
+        bool is_IfcBinary() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(94); }
+        IfcBinary get_IfcBinary() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(94, sdaiBINARY); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcBinary_view() { return TextView(get_IfcBinary()); }
+#endif
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        bool is_IfcDate() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(96); }
+        IfcDate get_IfcDate() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(96, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcDate_view() { return TextView(get_IfcDate()); }
+#endif
+        bool is_IfcDateTime() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(97); }
+        IfcDateTime get_IfcDateTime() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(97, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcDateTime_view() { return TextView(get_IfcDateTime()); }
+#endif
+        bool is_IfcDuration() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(98); }
+        IfcDuration get_IfcDuration() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(98, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcDuration_view() { return TextView(get_IfcDuration()); }
+#endif
+        bool is_IfcIdentifier() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(99); }
+        IfcIdentifier get_IfcIdentifier() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(99, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcIdentifier_view() { return TextView(get_IfcIdentifier()); }
+#endif
+        bool is_IfcInteger() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(100); }
+        Nullable<IfcInteger> get_IfcInteger() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcInteger>(100, sdaiINTEGER); }
+        bool is_IfcLabel() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(101); }
+        IfcLabel get_IfcLabel() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(101, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcLabel_view() { return TextView(get_IfcLabel()); }
+#endif
+        bool is_IfcLogical() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(102); }
+        Nullable<IfcLogical> get_IfcLogical() { RDF_EXPRESS_PROBE(ProbeAttr()); int v = getEnumerationValue(102, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        bool is_IfcPositiveInteger() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(103); }
+        Nullable<IfcPositiveInteger> get_IfcPositiveInteger() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositiveInteger>(103, sdaiINTEGER); }
+        bool is_IfcReal() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(104); }
+        Nullable<IfcReal> get_IfcReal() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcReal>(104, sdaiREAL); }
+        bool is_IfcText() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(105); }
+        IfcText get_IfcText() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(105, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcText_view() { return TextView(get_IfcText()); }
+#endif
+        bool is_IfcTime() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(106); }
+        IfcTime get_IfcTime() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(106, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcTime_view() { return TextView(get_IfcTime()); }
+#endif
+        bool is_IfcTimeStamp() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(107); }
+        Nullable<IfcTimeStamp> get_IfcTimeStamp() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcTimeStamp>(107, sdaiINTEGER); }
+
+        TextValue as_text() { RDF_EXPRESS_PROBE(ProbeAttr()); TextValue val = NULL; sdaiGetAttr(m_instance, getAttrDefinition(), sdaiSTRING, &val); return val; }
+#ifdef __cpp_lib_string_view
+        std::string_view as_text_view() { return TextView(as_text()); }
+#endif
+        const char* as_text_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(ProbeAttr()); return buffer.GetAttr(m_instance, getAttrName()); }
+        const char* as_text_utf8() { return as_text_utf8(ThreadUtf8Buffer()); }
+        Nullable<bool> as_bool() { RDF_EXPRESS_PROBE(ProbeAttr()); bool val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiBOOLEAN, &val)) return val; else return Nullable<bool>(); }
+        Nullable<IntValue> as_int() { RDF_EXPRESS_PROBE(ProbeAttr()); IntValue val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+    };
+
+
+    class IfcSimpleValue_put : public Select
+    {
+    public:
+        IfcSimpleValue_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSimpleValue_put(Select* outer) : Select(outer) {}
+        void put_IfcBinary(IfcBinary value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(94, sdaiBINARY, value); }
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+        void put_IfcDate(IfcDate value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(96, sdaiSTRING, value); }
+        void put_IfcDateTime(IfcDateTime value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(97, sdaiSTRING, value); }
+        void put_IfcDuration(IfcDuration value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(98, sdaiSTRING, value); }
+        void put_IfcIdentifier(IfcIdentifier value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(99, sdaiSTRING, value); }
+        void put_IfcInteger(IfcInteger value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(100, sdaiINTEGER, value); }
+        void put_IfcLabel(IfcLabel value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(101, sdaiSTRING, value); }
+        void put_IfcLogical(IfcLogical value) { RDF_EXPRESS_PROBE(ProbeAttr()); TextValue val = LOGICAL_VALUE_[(int) value]; putEnumerationValue(102, val); }
+        void put_IfcPositiveInteger(IfcPositiveInteger value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(103, sdaiINTEGER, value); }
+        void put_IfcReal(IfcReal value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(104, sdaiREAL, value); }
+        void put_IfcText(IfcText value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(105, sdaiSTRING, value); }
+        void put_IfcTime(IfcTime value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(106, sdaiSTRING, value); }
+        void put_IfcTimeStamp(IfcTimeStamp value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(107, sdaiINTEGER, value); }
+    };
+
+
+    class IfcValue : public Select
+    {
+    public:
+        IfcValue(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcValue(Select* outer) : Select(outer) {}
+
+        IfcDerivedMeasureValue _IfcDerivedMeasureValue() { return IfcDerivedMeasureValue(this); }
+
+        IfcMeasureValue _IfcMeasureValue() { return IfcMeasureValue(this); }
+
+        IfcSimpleValue _IfcSimpleValue() { return IfcSimpleValue(this); }
+    };
+
+
+    class IfcValue_get : public Select
+    {
+    public:
+        IfcValue_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcValue_get(Select* outer) : Select(outer) {}
+        IfcDerivedMeasureValue_get get_IfcDerivedMeasureValue() { return IfcDerivedMeasureValue_get(this); }
+        IfcMeasureValue_get get_IfcMeasureValue() { return IfcMeasureValue_get(this); }
+        IfcSimpleValue_get get_IfcSimpleValue() { return IfcSimpleValue_get(this); }
+
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+        Nullable<IntValue> as_int() { RDF_EXPRESS_PROBE(ProbeAttr()); IntValue val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+        TextValue as_text() { RDF_EXPRESS_PROBE(ProbeAttr()); TextValue val = NULL; sdaiGetAttr(m_instance, getAttrDefinition(), sdaiSTRING, &val); return val; }
+#ifdef __cpp_lib_string_view
+        std::string_view as_text_view() { return TextView(as_text()); }
+#endif
+        const char* as_text_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(ProbeAttr()); return buffer.GetAttr(m_instance, getAttrName()); }
+        const char* as_text_utf8() { return as_text_utf8(ThreadUtf8Buffer()); }
+        Nullable<bool> as_bool() { RDF_EXPRESS_PROBE(ProbeAttr()); bool val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiBOOLEAN, &val)) return val; else return Nullable<bool>(); }
+    };
+
+
+    class IfcValue_put : public Select
+    {
+    public:
+        IfcValue_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcValue_put(Select* outer) : Select(outer) {}
+        IfcDerivedMeasureValue_put put_IfcDerivedMeasureValue() { return IfcDerivedMeasureValue_put(this); }
+        IfcMeasureValue_put put_IfcMeasureValue() { return IfcMeasureValue_put(this); }
+        IfcSimpleValue_put put_IfcSimpleValue() { return IfcSimpleValue_put(this); }
+    };
+
+
+    class IfcAppliedValueSelect : public Select
+    {
+    public:
+        IfcAppliedValueSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcAppliedValueSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcMeasureWithUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(374); }
+        IfcMeasureWithUnit get_IfcMeasureWithUnit();
+        void put_IfcMeasureWithUnit(IfcMeasureWithUnit inst);
+
+        bool is_IfcReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(506); }
+        IfcReference get_IfcReference();
+        void put_IfcReference(IfcReference inst);
+
+        IfcValue _IfcValue() { return IfcValue(this); }
+    };
+
+
+    class IfcAppliedValueSelect_get : public Select
+    {
+    public:
+        IfcAppliedValueSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcAppliedValueSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcMeasureWithUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(374); }
+        IfcMeasureWithUnit get_IfcMeasureWithUnit();
+        bool is_IfcReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(506); }
+        IfcReference get_IfcReference();
+        IfcValue_get get_IfcValue() { return IfcValue_get(this); }
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+        Nullable<IntValue> as_int() { RDF_EXPRESS_PROBE(ProbeAttr()); IntValue val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+        TextValue as_text() { RDF_EXPRESS_PROBE(ProbeAttr()); TextValue val = NULL; sdaiGetAttr(m_instance, getAttrDefinition(), sdaiSTRING, &val); return val; }
+#ifdef __cpp_lib_string_view
+        std::string_view as_text_view() { return TextView(as_text()); }
+#endif
+        const char* as_text_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(ProbeAttr()); return buffer.GetAttr(m_instance, getAttrName()); }
+        const char* as_text_utf8() { return as_text_utf8(ThreadUtf8Buffer()); }
+        Nullable<bool> as_bool() { RDF_EXPRESS_PROBE(ProbeAttr()); bool val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiBOOLEAN, &val)) return val; else return Nullable<bool>(); }
+    };
+
+
+    class IfcAppliedValueSelect_put : public Select
+    {
+    public:
+        IfcAppliedValueSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcAppliedValueSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcMeasureWithUnit(IfcMeasureWithUnit inst);
+        void put_IfcReference(IfcReference inst);
+        IfcValue_put put_IfcValue() { return IfcValue_put(this); }
+    };
+
+
+    class IfcAxis2Placement : public Select
+    {
+    public:
+        IfcAxis2Placement(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcAxis2Placement(Select* outer) : Select(outer) {}
+
+        bool is_IfcAxis2Placement2D() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(31); }
+        IfcAxis2Placement2D get_IfcAxis2Placement2D();
+        void put_IfcAxis2Placement2D(IfcAxis2Placement2D inst);
+
+        bool is_IfcAxis2Placement3D() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(32); }
+        IfcAxis2Placement3D get_IfcAxis2Placement3D();
+        void put_IfcAxis2Placement3D(IfcAxis2Placement3D inst);
+    };
+
+
+    class IfcAxis2Placement_get : public Select
+    {
+    public:
+        IfcAxis2Placement_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcAxis2Placement_get(Select* outer) : Select(outer) {}
+        bool is_IfcAxis2Placement2D() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(31); }
+        IfcAxis2Placement2D get_IfcAxis2Placement2D();
+        bool is_IfcAxis2Placement3D() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(32); }
+        IfcAxis2Placement3D get_IfcAxis2Placement3D();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcAxis2Placement_put : public Select
+    {
+    public:
+        IfcAxis2Placement_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcAxis2Placement_put(Select* outer) : Select(outer) {}
+        void put_IfcAxis2Placement2D(IfcAxis2Placement2D inst);
+        void put_IfcAxis2Placement3D(IfcAxis2Placement3D inst);
+    };
+
+
+    class IfcBendingParameterSelect : public Select
+    {
+    public:
+        IfcBendingParameterSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcBendingParameterSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(78); }
+        Nullable<IfcLengthMeasure> get_IfcLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLengthMeasure>(78, sdaiREAL); }
+        void put_IfcLengthMeasure(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(78, sdaiREAL, value); }
+
+        bool is_IfcPlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(85); }
+        Nullable<IfcPlaneAngleMeasure> get_IfcPlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPlaneAngleMeasure>(85, sdaiREAL); }
+        void put_IfcPlaneAngleMeasure(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(85, sdaiREAL, value); }
+    };
+
+
+    class IfcBendingParameterSelect_get : public Select
+    {
+    public:
+        IfcBendingParameterSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcBendingParameterSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(78); }
+        Nullable<IfcLengthMeasure> get_IfcLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLengthMeasure>(78, sdaiREAL); }
+        bool is_IfcPlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(85); }
+        Nullable<IfcPlaneAngleMeasure> get_IfcPlaneAngleMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPlaneAngleMeasure>(85, sdaiREAL); }
+
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+    };
+
+
+    class IfcBendingParameterSelect_put : public Select
+    {
+    public:
+        IfcBendingParameterSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcBendingParameterSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcLengthMeasure(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(78, sdaiREAL, value); }
+        void put_IfcPlaneAngleMeasure(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(85, sdaiREAL, value); }
+    };
+
+
+    class IfcBooleanOperand : public Select
+    {
+    public:
+        IfcBooleanOperand(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcBooleanOperand(Select* outer) : Select(outer) {}
+
+        bool is_IfcBooleanResult() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(41); }
+        IfcBooleanResult get_IfcBooleanResult();
+        void put_IfcBooleanResult(IfcBooleanResult inst);
+
+        bool is_IfcCsgPrimitive3D() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(154); }
+        IfcCsgPrimitive3D get_IfcCsgPrimitive3D();
+        void put_IfcCsgPrimitive3D(IfcCsgPrimitive3D inst);
+
+        bool is_IfcHalfSpaceSolid() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(310); }
+        IfcHalfSpaceSolid get_IfcHalfSpaceSolid();
+        void put_IfcHalfSpaceSolid(IfcHalfSpaceSolid inst);
+
+        bool is_IfcSolidModel() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(608); }
+        IfcSolidModel get_IfcSolidModel();
+        void put_IfcSolidModel(IfcSolidModel inst);
+
+        bool is_IfcTessellatedFaceSet() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(707); }
+        IfcTessellatedFaceSet get_IfcTessellatedFaceSet();
+        void put_IfcTessellatedFaceSet(IfcTessellatedFaceSet inst);
+    };
+
+
+    class IfcBooleanOperand_get : public Select
+    {
+    public:
+        IfcBooleanOperand_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcBooleanOperand_get(Select* outer) : Select(outer) {}
+        bool is_IfcBooleanResult() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(41); }
+        IfcBooleanResult get_IfcBooleanResult();
+        bool is_IfcCsgPrimitive3D() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(154); }
+        IfcCsgPrimitive3D get_IfcCsgPrimitive3D();
+        bool is_IfcHalfSpaceSolid() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(310); }
+        IfcHalfSpaceSolid get_IfcHalfSpaceSolid();
+        bool is_IfcSolidModel() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(608); }
+        IfcSolidModel get_IfcSolidModel();
+        bool is_IfcTessellatedFaceSet() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(707); }
+        IfcTessellatedFaceSet get_IfcTessellatedFaceSet();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcBooleanOperand_put : public Select
+    {
+    public:
+        IfcBooleanOperand_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcBooleanOperand_put(Select* outer) : Select(outer) {}
+        void put_IfcBooleanResult(IfcBooleanResult inst);
+        void put_IfcCsgPrimitive3D(IfcCsgPrimitive3D inst);
+        void put_IfcHalfSpaceSolid(IfcHalfSpaceSolid inst);
+        void put_IfcSolidModel(IfcSolidModel inst);
+        void put_IfcTessellatedFaceSet(IfcTessellatedFaceSet inst);
+    };
+
+
+    class IfcClassificationReferenceSelect : public Select
+    {
+    public:
+        IfcClassificationReferenceSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcClassificationReferenceSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcClassification() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(94); }
+        IfcClassification get_IfcClassification();
+        void put_IfcClassification(IfcClassification inst);
+
+        bool is_IfcClassificationReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(95); }
+        IfcClassificationReference get_IfcClassificationReference();
+        void put_IfcClassificationReference(IfcClassificationReference inst);
+    };
+
+
+    class IfcClassificationReferenceSelect_get : public Select
+    {
+    public:
+        IfcClassificationReferenceSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcClassificationReferenceSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcClassification() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(94); }
+        IfcClassification get_IfcClassification();
+        bool is_IfcClassificationReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(95); }
+        IfcClassificationReference get_IfcClassificationReference();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcClassificationReferenceSelect_put : public Select
+    {
+    public:
+        IfcClassificationReferenceSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcClassificationReferenceSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcClassification(IfcClassification inst);
+        void put_IfcClassificationReference(IfcClassificationReference inst);
+    };
+
+
+    class IfcClassificationSelect : public Select
+    {
+    public:
+        IfcClassificationSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcClassificationSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcClassification() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(94); }
+        IfcClassification get_IfcClassification();
+        void put_IfcClassification(IfcClassification inst);
+
+        bool is_IfcClassificationReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(95); }
+        IfcClassificationReference get_IfcClassificationReference();
+        void put_IfcClassificationReference(IfcClassificationReference inst);
+    };
+
+
+    class IfcClassificationSelect_get : public Select
+    {
+    public:
+        IfcClassificationSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcClassificationSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcClassification() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(94); }
+        IfcClassification get_IfcClassification();
+        bool is_IfcClassificationReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(95); }
+        IfcClassificationReference get_IfcClassificationReference();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcClassificationSelect_put : public Select
+    {
+    public:
+        IfcClassificationSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcClassificationSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcClassification(IfcClassification inst);
+        void put_IfcClassificationReference(IfcClassificationReference inst);
+    };
+
+
+    class IfcColour : public Select
+    {
+    public:
+        IfcColour(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcColour(Select* outer) : Select(outer) {}
+
+        bool is_IfcColourSpecification() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(101); }
+        IfcColourSpecification get_IfcColourSpecification();
+        void put_IfcColourSpecification(IfcColourSpecification inst);
+
+        bool is_IfcPreDefinedColour() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(439); }
+        IfcPreDefinedColour get_IfcPreDefinedColour();
+        void put_IfcPreDefinedColour(IfcPreDefinedColour inst);
+    };
+
+
+    class IfcColour_get : public Select
+    {
+    public:
+        IfcColour_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcColour_get(Select* outer) : Select(outer) {}
+        bool is_IfcColourSpecification() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(101); }
+        IfcColourSpecification get_IfcColourSpecification();
+        bool is_IfcPreDefinedColour() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(439); }
+        IfcPreDefinedColour get_IfcPreDefinedColour();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcColour_put : public Select
+    {
+    public:
+        IfcColour_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcColour_put(Select* outer) : Select(outer) {}
+        void put_IfcColourSpecification(IfcColourSpecification inst);
+        void put_IfcPreDefinedColour(IfcPreDefinedColour inst);
+    };
+
+
+    class IfcColourOrFactor : public Select
+    {
+    public:
+        IfcColourOrFactor(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcColourOrFactor(Select* outer) : Select(outer) {}
+
+        bool is_IfcColourRgb() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(99); }
+        IfcColourRgb get_IfcColourRgb();
+        void put_IfcColourRgb(IfcColourRgb inst);
+
+        bool is_IfcNormalisedRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(82); }
+        Nullable<IfcNormalisedRatioMeasure> get_IfcNormalisedRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcNormalisedRatioMeasure>(82, sdaiREAL); }
+        void put_IfcNormalisedRatioMeasure(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(82, sdaiREAL, value); }
+    };
+
+
+    class IfcColourOrFactor_get : public Select
+    {
+    public:
+        IfcColourOrFactor_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcColourOrFactor_get(Select* outer) : Select(outer) {}
+        bool is_IfcColourRgb() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(99); }
+        IfcColourRgb get_IfcColourRgb();
+        bool is_IfcNormalisedRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(82); }
+        Nullable<IfcNormalisedRatioMeasure> get_IfcNormalisedRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcNormalisedRatioMeasure>(82, sdaiREAL); }
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+    };
+
+
+    class IfcColourOrFactor_put : public Select
+    {
+    public:
+        IfcColourOrFactor_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcColourOrFactor_put(Select* outer) : Select(outer) {}
+        void put_IfcColourRgb(IfcColourRgb inst);
+        void put_IfcNormalisedRatioMeasure(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(82, sdaiREAL, value); }
+    };
+
+
+    class IfcCoordinateReferenceSystemSelect : public Select
+    {
+    public:
+        IfcCoordinateReferenceSystemSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCoordinateReferenceSystemSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcCoordinateReferenceSystem() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(146); }
+        IfcCoordinateReferenceSystem get_IfcCoordinateReferenceSystem();
+        void put_IfcCoordinateReferenceSystem(IfcCoordinateReferenceSystem inst);
+
+        bool is_IfcGeometricRepresentationContext() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(302); }
+        IfcGeometricRepresentationContext get_IfcGeometricRepresentationContext();
+        void put_IfcGeometricRepresentationContext(IfcGeometricRepresentationContext inst);
+    };
+
+
+    class IfcCoordinateReferenceSystemSelect_get : public Select
+    {
+    public:
+        IfcCoordinateReferenceSystemSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCoordinateReferenceSystemSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcCoordinateReferenceSystem() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(146); }
+        IfcCoordinateReferenceSystem get_IfcCoordinateReferenceSystem();
+        bool is_IfcGeometricRepresentationContext() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(302); }
+        IfcGeometricRepresentationContext get_IfcGeometricRepresentationContext();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcCoordinateReferenceSystemSelect_put : public Select
+    {
+    public:
+        IfcCoordinateReferenceSystemSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCoordinateReferenceSystemSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcCoordinateReferenceSystem(IfcCoordinateReferenceSystem inst);
+        void put_IfcGeometricRepresentationContext(IfcGeometricRepresentationContext inst);
+    };
+
+
+    class IfcCsgSelect : public Select
+    {
+    public:
+        IfcCsgSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCsgSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcBooleanResult() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(41); }
+        IfcBooleanResult get_IfcBooleanResult();
+        void put_IfcBooleanResult(IfcBooleanResult inst);
+
+        bool is_IfcCsgPrimitive3D() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(154); }
+        IfcCsgPrimitive3D get_IfcCsgPrimitive3D();
+        void put_IfcCsgPrimitive3D(IfcCsgPrimitive3D inst);
+    };
+
+
+    class IfcCsgSelect_get : public Select
+    {
+    public:
+        IfcCsgSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCsgSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcBooleanResult() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(41); }
+        IfcBooleanResult get_IfcBooleanResult();
+        bool is_IfcCsgPrimitive3D() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(154); }
+        IfcCsgPrimitive3D get_IfcCsgPrimitive3D();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcCsgSelect_put : public Select
+    {
+    public:
+        IfcCsgSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCsgSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcBooleanResult(IfcBooleanResult inst);
+        void put_IfcCsgPrimitive3D(IfcCsgPrimitive3D inst);
+    };
+
+
+    class IfcCurveStyleFontSelect : public Select
+    {
+    public:
+        IfcCurveStyleFontSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCurveStyleFontSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcCurveStyleFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(164); }
+        IfcCurveStyleFont get_IfcCurveStyleFont();
+        void put_IfcCurveStyleFont(IfcCurveStyleFont inst);
+
+        bool is_IfcPreDefinedCurveFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(440); }
+        IfcPreDefinedCurveFont get_IfcPreDefinedCurveFont();
+        void put_IfcPreDefinedCurveFont(IfcPreDefinedCurveFont inst);
+    };
+
+
+    class IfcCurveStyleFontSelect_get : public Select
+    {
+    public:
+        IfcCurveStyleFontSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCurveStyleFontSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcCurveStyleFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(164); }
+        IfcCurveStyleFont get_IfcCurveStyleFont();
+        bool is_IfcPreDefinedCurveFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(440); }
+        IfcPreDefinedCurveFont get_IfcPreDefinedCurveFont();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcCurveStyleFontSelect_put : public Select
+    {
+    public:
+        IfcCurveStyleFontSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCurveStyleFontSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcCurveStyleFont(IfcCurveStyleFont inst);
+        void put_IfcPreDefinedCurveFont(IfcPreDefinedCurveFont inst);
+    };
+
+
+    class IfcCurveFontOrScaledCurveFontSelect : public Select
+    {
+    public:
+        IfcCurveFontOrScaledCurveFontSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCurveFontOrScaledCurveFontSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcCurveStyleFontAndScaling() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(165); }
+        IfcCurveStyleFontAndScaling get_IfcCurveStyleFontAndScaling();
+        void put_IfcCurveStyleFontAndScaling(IfcCurveStyleFontAndScaling inst);
+
+        IfcCurveStyleFontSelect _IfcCurveStyleFontSelect() { return IfcCurveStyleFontSelect(this); }
+    };
+
+
+    class IfcCurveFontOrScaledCurveFontSelect_get : public Select
+    {
+    public:
+        IfcCurveFontOrScaledCurveFontSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCurveFontOrScaledCurveFontSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcCurveStyleFontAndScaling() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(165); }
+        IfcCurveStyleFontAndScaling get_IfcCurveStyleFontAndScaling();
+        IfcCurveStyleFontSelect_get get_IfcCurveStyleFontSelect() { return IfcCurveStyleFontSelect_get(this); }
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcCurveFontOrScaledCurveFontSelect_put : public Select
+    {
+    public:
+        IfcCurveFontOrScaledCurveFontSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCurveFontOrScaledCurveFontSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcCurveStyleFontAndScaling(IfcCurveStyleFontAndScaling inst);
+        IfcCurveStyleFontSelect_put put_IfcCurveStyleFontSelect() { return IfcCurveStyleFontSelect_put(this); }
+    };
+
+
+    class IfcCurveOnSurface : public Select
+    {
+    public:
+        IfcCurveOnSurface(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCurveOnSurface(Select* outer) : Select(outer) {}
+
+        bool is_IfcCompositeCurveOnSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(110); }
+        IfcCompositeCurveOnSurface get_IfcCompositeCurveOnSurface();
+        void put_IfcCompositeCurveOnSurface(IfcCompositeCurveOnSurface inst);
+
+        bool is_IfcPcurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(407); }
+        IfcPcurve get_IfcPcurve();
+        void put_IfcPcurve(IfcPcurve inst);
+
+        bool is_IfcSurfaceCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(671); }
+        IfcSurfaceCurve get_IfcSurfaceCurve();
+        void put_IfcSurfaceCurve(IfcSurfaceCurve inst);
+    };
+
+
+    class IfcCurveOnSurface_get : public Select
+    {
+    public:
+        IfcCurveOnSurface_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCurveOnSurface_get(Select* outer) : Select(outer) {}
+        bool is_IfcCompositeCurveOnSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(110); }
+        IfcCompositeCurveOnSurface get_IfcCompositeCurveOnSurface();
+        bool is_IfcPcurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(407); }
+        IfcPcurve get_IfcPcurve();
+        bool is_IfcSurfaceCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(671); }
+        IfcSurfaceCurve get_IfcSurfaceCurve();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcCurveOnSurface_put : public Select
+    {
+    public:
+        IfcCurveOnSurface_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCurveOnSurface_put(Select* outer) : Select(outer) {}
+        void put_IfcCompositeCurveOnSurface(IfcCompositeCurveOnSurface inst);
+        void put_IfcPcurve(IfcPcurve inst);
+        void put_IfcSurfaceCurve(IfcSurfaceCurve inst);
+    };
+
+
+    class IfcCurveOrEdgeCurve : public Select
+    {
+    public:
+        IfcCurveOrEdgeCurve(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCurveOrEdgeCurve(Select* outer) : Select(outer) {}
+
+        bool is_IfcBoundedCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(48); }
+        IfcBoundedCurve get_IfcBoundedCurve();
+        void put_IfcBoundedCurve(IfcBoundedCurve inst);
+
+        bool is_IfcEdgeCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(206); }
+        IfcEdgeCurve get_IfcEdgeCurve();
+        void put_IfcEdgeCurve(IfcEdgeCurve inst);
+    };
+
+
+    class IfcCurveOrEdgeCurve_get : public Select
+    {
+    public:
+        IfcCurveOrEdgeCurve_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCurveOrEdgeCurve_get(Select* outer) : Select(outer) {}
+        bool is_IfcBoundedCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(48); }
+        IfcBoundedCurve get_IfcBoundedCurve();
+        bool is_IfcEdgeCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(206); }
+        IfcEdgeCurve get_IfcEdgeCurve();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcCurveOrEdgeCurve_put : public Select
+    {
+    public:
+        IfcCurveOrEdgeCurve_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcCurveOrEdgeCurve_put(Select* outer) : Select(outer) {}
+        void put_IfcBoundedCurve(IfcBoundedCurve inst);
+        void put_IfcEdgeCurve(IfcEdgeCurve inst);
+    };
+
+
+    class IfcDefinitionSelect : public Select
+    {
+    public:
+        IfcDefinitionSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcDefinitionSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcObjectDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(389); }
+        IfcObjectDefinition get_IfcObjectDefinition();
+        void put_IfcObjectDefinition(IfcObjectDefinition inst);
+
+        bool is_IfcPropertyDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(466); }
+        IfcPropertyDefinition get_IfcPropertyDefinition();
+        void put_IfcPropertyDefinition(IfcPropertyDefinition inst);
+    };
+
+
+    class IfcDefinitionSelect_get : public Select
+    {
+    public:
+        IfcDefinitionSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcDefinitionSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcObjectDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(389); }
+        IfcObjectDefinition get_IfcObjectDefinition();
+        bool is_IfcPropertyDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(466); }
+        IfcPropertyDefinition get_IfcPropertyDefinition();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcDefinitionSelect_put : public Select
+    {
+    public:
+        IfcDefinitionSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcDefinitionSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcObjectDefinition(IfcObjectDefinition inst);
+        void put_IfcPropertyDefinition(IfcPropertyDefinition inst);
+    };
+
+
+    class IfcDocumentSelect : public Select
+    {
+    public:
+        IfcDocumentSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcDocumentSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcDocumentInformation() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(188); }
+        IfcDocumentInformation get_IfcDocumentInformation();
+        void put_IfcDocumentInformation(IfcDocumentInformation inst);
+
+        bool is_IfcDocumentReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(190); }
+        IfcDocumentReference get_IfcDocumentReference();
+        void put_IfcDocumentReference(IfcDocumentReference inst);
+    };
+
+
+    class IfcDocumentSelect_get : public Select
+    {
+    public:
+        IfcDocumentSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcDocumentSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcDocumentInformation() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(188); }
+        IfcDocumentInformation get_IfcDocumentInformation();
+        bool is_IfcDocumentReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(190); }
+        IfcDocumentReference get_IfcDocumentReference();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcDocumentSelect_put : public Select
+    {
+    public:
+        IfcDocumentSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcDocumentSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcDocumentInformation(IfcDocumentInformation inst);
+        void put_IfcDocumentReference(IfcDocumentReference inst);
+    };
+
+
+    class IfcFillStyleSelect : public Select
+    {
+    public:
+        IfcFillStyleSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcFillStyleSelect(Select* outer) : Select(outer) {}
+
+        IfcColour _IfcColour() { return IfcColour(this); }
+
+        bool is_IfcExternallyDefinedHatchStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(243); }
+        IfcExternallyDefinedHatchStyle get_IfcExternallyDefinedHatchStyle();
+        void put_IfcExternallyDefinedHatchStyle(IfcExternallyDefinedHatchStyle inst);
+
+        bool is_IfcFillAreaStyleHatching() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(268); }
+        IfcFillAreaStyleHatching get_IfcFillAreaStyleHatching();
+        void put_IfcFillAreaStyleHatching(IfcFillAreaStyleHatching inst);
+
+        bool is_IfcFillAreaStyleTiles() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(269); }
+        IfcFillAreaStyleTiles get_IfcFillAreaStyleTiles();
+        void put_IfcFillAreaStyleTiles(IfcFillAreaStyleTiles inst);
+    };
+
+
+    class IfcFillStyleSelect_get : public Select
+    {
+    public:
+        IfcFillStyleSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcFillStyleSelect_get(Select* outer) : Select(outer) {}
+        IfcColour_get get_IfcColour() { return IfcColour_get(this); }
+        bool is_IfcExternallyDefinedHatchStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(243); }
+        IfcExternallyDefinedHatchStyle get_IfcExternallyDefinedHatchStyle();
+        bool is_IfcFillAreaStyleHatching() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(268); }
+        IfcFillAreaStyleHatching get_IfcFillAreaStyleHatching();
+        bool is_IfcFillAreaStyleTiles() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(269); }
+        IfcFillAreaStyleTiles get_IfcFillAreaStyleTiles();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcFillStyleSelect_put : public Select
+    {
+    public:
+        IfcFillStyleSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcFillStyleSelect_put(Select* outer) : Select(outer) {}
+        IfcColour_put put_IfcColour() { return IfcColour_put(this); }
+        void put_IfcExternallyDefinedHatchStyle(IfcExternallyDefinedHatchStyle inst);
+        void put_IfcFillAreaStyleHatching(IfcFillAreaStyleHatching inst);
+        void put_IfcFillAreaStyleTiles(IfcFillAreaStyleTiles inst);
+    };
+
+
+    class IfcGeometricSetSelect : public Select
+    {
+    public:
+        IfcGeometricSetSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcGeometricSetSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(160); }
+        IfcCurve get_IfcCurve();
+        void put_IfcCurve(IfcCurve inst);
+
+        bool is_IfcPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(430); }
+        IfcPoint get_IfcPoint();
+        void put_IfcPoint(IfcPoint inst);
+
+        bool is_IfcSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(670); }
+        IfcSurface get_IfcSurface();
+        void put_IfcSurface(IfcSurface inst);
+    };
+
+
+    class IfcGeometricSetSelect_get : public Select
+    {
+    public:
+        IfcGeometricSetSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcGeometricSetSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(160); }
+        IfcCurve get_IfcCurve();
+        bool is_IfcPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(430); }
+        IfcPoint get_IfcPoint();
+        bool is_IfcSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(670); }
+        IfcSurface get_IfcSurface();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcGeometricSetSelect_put : public Select
+    {
+    public:
+        IfcGeometricSetSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcGeometricSetSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcCurve(IfcCurve inst);
+        void put_IfcPoint(IfcPoint inst);
+        void put_IfcSurface(IfcSurface inst);
+    };
+
+
+    class IfcGridPlacementDirectionSelect : public Select
+    {
+    public:
+        IfcGridPlacementDirectionSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcGridPlacementDirectionSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcDirection() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(174); }
+        IfcDirection get_IfcDirection();
+        void put_IfcDirection(IfcDirection inst);
+
+        bool is_IfcVirtualGridIntersection() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(755); }
+        IfcVirtualGridIntersection get_IfcVirtualGridIntersection();
+        void put_IfcVirtualGridIntersection(IfcVirtualGridIntersection inst);
+    };
+
+
+    class IfcGridPlacementDirectionSelect_get : public Select
+    {
+    public:
+        IfcGridPlacementDirectionSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcGridPlacementDirectionSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcDirection() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(174); }
+        IfcDirection get_IfcDirection();
+        bool is_IfcVirtualGridIntersection() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(755); }
+        IfcVirtualGridIntersection get_IfcVirtualGridIntersection();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcGridPlacementDirectionSelect_put : public Select
+    {
+    public:
+        IfcGridPlacementDirectionSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcGridPlacementDirectionSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcDirection(IfcDirection inst);
+        void put_IfcVirtualGridIntersection(IfcVirtualGridIntersection inst);
+    };
+
+
+    class IfcHatchLineDistanceSelect : public Select
+    {
+    public:
+        IfcHatchLineDistanceSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcHatchLineDistanceSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcPositiveLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(86); }
+        Nullable<IfcPositiveLengthMeasure> get_IfcPositiveLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositiveLengthMeasure>(86, sdaiREAL); }
+        void put_IfcPositiveLengthMeasure(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(86, sdaiREAL, value); }
+
+        bool is_IfcVector() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(748); }
+        IfcVector get_IfcVector();
+        void put_IfcVector(IfcVector inst);
+    };
+
+
+    class IfcHatchLineDistanceSelect_get : public Select
+    {
+    public:
+        IfcHatchLineDistanceSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcHatchLineDistanceSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcPositiveLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(86); }
+        Nullable<IfcPositiveLengthMeasure> get_IfcPositiveLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositiveLengthMeasure>(86, sdaiREAL); }
+        bool is_IfcVector() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(748); }
+        IfcVector get_IfcVector();
+
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcHatchLineDistanceSelect_put : public Select
+    {
+    public:
+        IfcHatchLineDistanceSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcHatchLineDistanceSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcPositiveLengthMeasure(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(86, sdaiREAL, value); }
+        void put_IfcVector(IfcVector inst);
+    };
+
+
+    class IfcLayeredItem : public Select
+    {
+    public:
+        IfcLayeredItem(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcLayeredItem(Select* outer) : Select(outer) {}
+
+        bool is_IfcRepresentation() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(565); }
+        IfcRepresentation get_IfcRepresentation();
+        void put_IfcRepresentation(IfcRepresentation inst);
+
+        bool is_IfcRepresentationItem() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(567); }
+        IfcRepresentationItem get_IfcRepresentationItem();
+        void put_IfcRepresentationItem(IfcRepresentationItem inst);
+    };
+
+
+    class IfcLayeredItem_get : public Select
+    {
+    public:
+        IfcLayeredItem_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcLayeredItem_get(Select* outer) : Select(outer) {}
+        bool is_IfcRepresentation() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(565); }
+        IfcRepresentation get_IfcRepresentation();
+        bool is_IfcRepresentationItem() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(567); }
+        IfcRepresentationItem get_IfcRepresentationItem();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcLayeredItem_put : public Select
+    {
+    public:
+        IfcLayeredItem_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcLayeredItem_put(Select* outer) : Select(outer) {}
+        void put_IfcRepresentation(IfcRepresentation inst);
+        void put_IfcRepresentationItem(IfcRepresentationItem inst);
+    };
+
+
+    class IfcLibrarySelect : public Select
+    {
+    public:
+        IfcLibrarySelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcLibrarySelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcLibraryInformation() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(336); }
+        IfcLibraryInformation get_IfcLibraryInformation();
+        void put_IfcLibraryInformation(IfcLibraryInformation inst);
+
+        bool is_IfcLibraryReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(337); }
+        IfcLibraryReference get_IfcLibraryReference();
+        void put_IfcLibraryReference(IfcLibraryReference inst);
+    };
+
+
+    class IfcLibrarySelect_get : public Select
+    {
+    public:
+        IfcLibrarySelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcLibrarySelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcLibraryInformation() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(336); }
+        IfcLibraryInformation get_IfcLibraryInformation();
+        bool is_IfcLibraryReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(337); }
+        IfcLibraryReference get_IfcLibraryReference();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcLibrarySelect_put : public Select
+    {
+    public:
+        IfcLibrarySelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcLibrarySelect_put(Select* outer) : Select(outer) {}
+        void put_IfcLibraryInformation(IfcLibraryInformation inst);
+        void put_IfcLibraryReference(IfcLibraryReference inst);
+    };
+
+
+    class IfcLightDistributionDataSourceSelect : public Select
+    {
+    public:
+        IfcLightDistributionDataSourceSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcLightDistributionDataSourceSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcExternalReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(246); }
+        IfcExternalReference get_IfcExternalReference();
+        void put_IfcExternalReference(IfcExternalReference inst);
+
+        bool is_IfcLightIntensityDistribution() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(341); }
+        IfcLightIntensityDistribution get_IfcLightIntensityDistribution();
+        void put_IfcLightIntensityDistribution(IfcLightIntensityDistribution inst);
+    };
+
+
+    class IfcLightDistributionDataSourceSelect_get : public Select
+    {
+    public:
+        IfcLightDistributionDataSourceSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcLightDistributionDataSourceSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcExternalReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(246); }
+        IfcExternalReference get_IfcExternalReference();
+        bool is_IfcLightIntensityDistribution() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(341); }
+        IfcLightIntensityDistribution get_IfcLightIntensityDistribution();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcLightDistributionDataSourceSelect_put : public Select
+    {
+    public:
+        IfcLightDistributionDataSourceSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcLightDistributionDataSourceSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcExternalReference(IfcExternalReference inst);
+        void put_IfcLightIntensityDistribution(IfcLightIntensityDistribution inst);
+    };
+
+
+    class IfcMaterialSelect : public Select
+    {
+    public:
+        IfcMaterialSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcMaterialSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcMaterialDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(359); }
+        IfcMaterialDefinition get_IfcMaterialDefinition();
+        void put_IfcMaterialDefinition(IfcMaterialDefinition inst);
+
+        bool is_IfcMaterialList() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(365); }
+        IfcMaterialList get_IfcMaterialList();
+        void put_IfcMaterialList(IfcMaterialList inst);
+
+        bool is_IfcMaterialUsageDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(373); }
+        IfcMaterialUsageDefinition get_IfcMaterialUsageDefinition();
+        void put_IfcMaterialUsageDefinition(IfcMaterialUsageDefinition inst);
+    };
+
+
+    class IfcMaterialSelect_get : public Select
+    {
+    public:
+        IfcMaterialSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcMaterialSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcMaterialDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(359); }
+        IfcMaterialDefinition get_IfcMaterialDefinition();
+        bool is_IfcMaterialList() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(365); }
+        IfcMaterialList get_IfcMaterialList();
+        bool is_IfcMaterialUsageDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(373); }
+        IfcMaterialUsageDefinition get_IfcMaterialUsageDefinition();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcMaterialSelect_put : public Select
+    {
+    public:
+        IfcMaterialSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcMaterialSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcMaterialDefinition(IfcMaterialDefinition inst);
+        void put_IfcMaterialList(IfcMaterialList inst);
+        void put_IfcMaterialUsageDefinition(IfcMaterialUsageDefinition inst);
+    };
+
+
+    class IfcMetricValueSelect : public Select
+    {
+    public:
+        IfcMetricValueSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcMetricValueSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcAppliedValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(20); }
+        IfcAppliedValue get_IfcAppliedValue();
+        void put_IfcAppliedValue(IfcAppliedValue inst);
+
+        bool is_IfcMeasureWithUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(374); }
+        IfcMeasureWithUnit get_IfcMeasureWithUnit();
+        void put_IfcMeasureWithUnit(IfcMeasureWithUnit inst);
+
+        bool is_IfcReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(506); }
+        IfcReference get_IfcReference();
+        void put_IfcReference(IfcReference inst);
+
+        bool is_IfcTable() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(693); }
+        IfcTable get_IfcTable();
+        void put_IfcTable(IfcTable inst);
+
+        bool is_IfcTimeSeries() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(721); }
+        IfcTimeSeries get_IfcTimeSeries();
+        void put_IfcTimeSeries(IfcTimeSeries inst);
+
+        IfcValue _IfcValue() { return IfcValue(this); }
+    };
+
+
+    class IfcMetricValueSelect_get : public Select
+    {
+    public:
+        IfcMetricValueSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcMetricValueSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcAppliedValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(20); }
+        IfcAppliedValue get_IfcAppliedValue();
+        bool is_IfcMeasureWithUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(374); }
+        IfcMeasureWithUnit get_IfcMeasureWithUnit();
+        bool is_IfcReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(506); }
+        IfcReference get_IfcReference();
+        bool is_IfcTable() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(693); }
+        IfcTable get_IfcTable();
+        bool is_IfcTimeSeries() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(721); }
+        IfcTimeSeries get_IfcTimeSeries();
+        IfcValue_get get_IfcValue() { return IfcValue_get(this); }
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+        Nullable<IntValue> as_int() { RDF_EXPRESS_PROBE(ProbeAttr()); IntValue val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+        TextValue as_text() { RDF_EXPRESS_PROBE(ProbeAttr()); TextValue val = NULL; sdaiGetAttr(m_instance, getAttrDefinition(), sdaiSTRING, &val); return val; }
+#ifdef __cpp_lib_string_view
+        std::string_view as_text_view() { return TextView(as_text()); }
+#endif
+        const char* as_text_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(ProbeAttr()); return buffer.GetAttr(m_instance, getAttrName()); }
+        const char* as_text_utf8() { return as_text_utf8(ThreadUtf8Buffer()); }
+        Nullable<bool> as_bool() { RDF_EXPRESS_PROBE(ProbeAttr()); bool val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiBOOLEAN, &val)) return val; else return Nullable<bool>(); }
+    };
+
+
+    class IfcMetricValueSelect_put : public Select
+    {
+    public:
+        IfcMetricValueSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcMetricValueSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcAppliedValue(IfcAppliedValue inst);
+        void put_IfcMeasureWithUnit(IfcMeasureWithUnit inst);
+        void put_IfcReference(IfcReference inst);
+        void put_IfcTable(IfcTable inst);
+        void put_IfcTimeSeries(IfcTimeSeries inst);
+        IfcValue_put put_IfcValue() { return IfcValue_put(this); }
+    };
+
+
+    class IfcModulusOfRotationalSubgradeReactionSelect : public Select
+    {
+    public:
+        IfcModulusOfRotationalSubgradeReactionSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcModulusOfRotationalSubgradeReactionSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+
+        bool is_IfcModulusOfRotationalSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(37); }
+        Nullable<IfcModulusOfRotationalSubgradeReactionMeasure> get_IfcModulusOfRotationalSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfRotationalSubgradeReactionMeasure>(37, sdaiREAL); }
+        void put_IfcModulusOfRotationalSubgradeReactionMeasure(IfcModulusOfRotationalSubgradeReactionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(37, sdaiREAL, value); }
+    };
+
+
+    class IfcModulusOfRotationalSubgradeReactionSelect_get : public Select
+    {
+    public:
+        IfcModulusOfRotationalSubgradeReactionSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcModulusOfRotationalSubgradeReactionSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        bool is_IfcModulusOfRotationalSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(37); }
+        Nullable<IfcModulusOfRotationalSubgradeReactionMeasure> get_IfcModulusOfRotationalSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfRotationalSubgradeReactionMeasure>(37, sdaiREAL); }
+
+        Nullable<bool> as_bool() { RDF_EXPRESS_PROBE(ProbeAttr()); bool val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiBOOLEAN, &val)) return val; else return Nullable<bool>(); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+    };
+
+
+    class IfcModulusOfRotationalSubgradeReactionSelect_put : public Select
+    {
+    public:
+        IfcModulusOfRotationalSubgradeReactionSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcModulusOfRotationalSubgradeReactionSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+        void put_IfcModulusOfRotationalSubgradeReactionMeasure(IfcModulusOfRotationalSubgradeReactionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(37, sdaiREAL, value); }
+    };
+
+
+    class IfcModulusOfSubgradeReactionSelect : public Select
+    {
+    public:
+        IfcModulusOfSubgradeReactionSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcModulusOfSubgradeReactionSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+
+        bool is_IfcModulusOfSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(38); }
+        Nullable<IfcModulusOfSubgradeReactionMeasure> get_IfcModulusOfSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfSubgradeReactionMeasure>(38, sdaiREAL); }
+        void put_IfcModulusOfSubgradeReactionMeasure(IfcModulusOfSubgradeReactionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(38, sdaiREAL, value); }
+    };
+
+
+    class IfcModulusOfSubgradeReactionSelect_get : public Select
+    {
+    public:
+        IfcModulusOfSubgradeReactionSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcModulusOfSubgradeReactionSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        bool is_IfcModulusOfSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(38); }
+        Nullable<IfcModulusOfSubgradeReactionMeasure> get_IfcModulusOfSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfSubgradeReactionMeasure>(38, sdaiREAL); }
+
+        Nullable<bool> as_bool() { RDF_EXPRESS_PROBE(ProbeAttr()); bool val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiBOOLEAN, &val)) return val; else return Nullable<bool>(); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+    };
+
+
+    class IfcModulusOfSubgradeReactionSelect_put : public Select
+    {
+    public:
+        IfcModulusOfSubgradeReactionSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcModulusOfSubgradeReactionSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+        void put_IfcModulusOfSubgradeReactionMeasure(IfcModulusOfSubgradeReactionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(38, sdaiREAL, value); }
+    };
+
+
+    class IfcModulusOfTranslationalSubgradeReactionSelect : public Select
+    {
+    public:
+        IfcModulusOfTranslationalSubgradeReactionSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcModulusOfTranslationalSubgradeReactionSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+
+        bool is_IfcModulusOfLinearSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(36); }
+        Nullable<IfcModulusOfLinearSubgradeReactionMeasure> get_IfcModulusOfLinearSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfLinearSubgradeReactionMeasure>(36, sdaiREAL); }
+        void put_IfcModulusOfLinearSubgradeReactionMeasure(IfcModulusOfLinearSubgradeReactionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(36, sdaiREAL, value); }
+    };
+
+
+    class IfcModulusOfTranslationalSubgradeReactionSelect_get : public Select
+    {
+    public:
+        IfcModulusOfTranslationalSubgradeReactionSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcModulusOfTranslationalSubgradeReactionSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        bool is_IfcModulusOfLinearSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(36); }
+        Nullable<IfcModulusOfLinearSubgradeReactionMeasure> get_IfcModulusOfLinearSubgradeReactionMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcModulusOfLinearSubgradeReactionMeasure>(36, sdaiREAL); }
+
+        Nullable<bool> as_bool() { RDF_EXPRESS_PROBE(ProbeAttr()); bool val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiBOOLEAN, &val)) return val; else return Nullable<bool>(); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+    };
+
+
+    class IfcModulusOfTranslationalSubgradeReactionSelect_put : public Select
+    {
+    public:
+        IfcModulusOfTranslationalSubgradeReactionSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcModulusOfTranslationalSubgradeReactionSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+        void put_IfcModulusOfLinearSubgradeReactionMeasure(IfcModulusOfLinearSubgradeReactionMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(36, sdaiREAL, value); }
+    };
+
+
+    class IfcObjectReferenceSelect : public Select
+    {
+    public:
+        IfcObjectReferenceSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcObjectReferenceSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcAddress() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(5); }
+        IfcAddress get_IfcAddress();
+        void put_IfcAddress(IfcAddress inst);
+
+        bool is_IfcAppliedValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(20); }
+        IfcAppliedValue get_IfcAppliedValue();
+        void put_IfcAppliedValue(IfcAppliedValue inst);
+
+        bool is_IfcExternalReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(246); }
+        IfcExternalReference get_IfcExternalReference();
+        void put_IfcExternalReference(IfcExternalReference inst);
+
+        bool is_IfcMaterialDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(359); }
+        IfcMaterialDefinition get_IfcMaterialDefinition();
+        void put_IfcMaterialDefinition(IfcMaterialDefinition inst);
+
+        bool is_IfcOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(398); }
+        IfcOrganization get_IfcOrganization();
+        void put_IfcOrganization(IfcOrganization inst);
+
+        bool is_IfcPerson() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(411); }
+        IfcPerson get_IfcPerson();
+        void put_IfcPerson(IfcPerson inst);
+
+        bool is_IfcPersonAndOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(412); }
+        IfcPersonAndOrganization get_IfcPersonAndOrganization();
+        void put_IfcPersonAndOrganization(IfcPersonAndOrganization inst);
+
+        bool is_IfcTable() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(693); }
+        IfcTable get_IfcTable();
+        void put_IfcTable(IfcTable inst);
+
+        bool is_IfcTimeSeries() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(721); }
+        IfcTimeSeries get_IfcTimeSeries();
+        void put_IfcTimeSeries(IfcTimeSeries inst);
+    };
+
+
+    class IfcObjectReferenceSelect_get : public Select
+    {
+    public:
+        IfcObjectReferenceSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcObjectReferenceSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcAddress() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(5); }
+        IfcAddress get_IfcAddress();
+        bool is_IfcAppliedValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(20); }
+        IfcAppliedValue get_IfcAppliedValue();
+        bool is_IfcExternalReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(246); }
+        IfcExternalReference get_IfcExternalReference();
+        bool is_IfcMaterialDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(359); }
+        IfcMaterialDefinition get_IfcMaterialDefinition();
+        bool is_IfcOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(398); }
+        IfcOrganization get_IfcOrganization();
+        bool is_IfcPerson() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(411); }
+        IfcPerson get_IfcPerson();
+        bool is_IfcPersonAndOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(412); }
+        IfcPersonAndOrganization get_IfcPersonAndOrganization();
+        bool is_IfcTable() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(693); }
+        IfcTable get_IfcTable();
+        bool is_IfcTimeSeries() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(721); }
+        IfcTimeSeries get_IfcTimeSeries();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcObjectReferenceSelect_put : public Select
+    {
+    public:
+        IfcObjectReferenceSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcObjectReferenceSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcAddress(IfcAddress inst);
+        void put_IfcAppliedValue(IfcAppliedValue inst);
+        void put_IfcExternalReference(IfcExternalReference inst);
+        void put_IfcMaterialDefinition(IfcMaterialDefinition inst);
+        void put_IfcOrganization(IfcOrganization inst);
+        void put_IfcPerson(IfcPerson inst);
+        void put_IfcPersonAndOrganization(IfcPersonAndOrganization inst);
+        void put_IfcTable(IfcTable inst);
+        void put_IfcTimeSeries(IfcTimeSeries inst);
+    };
+
+
+    class IfcPointOrVertexPoint : public Select
+    {
+    public:
+        IfcPointOrVertexPoint(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcPointOrVertexPoint(Select* outer) : Select(outer) {}
+
+        bool is_IfcPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(430); }
+        IfcPoint get_IfcPoint();
+        void put_IfcPoint(IfcPoint inst);
+
+        bool is_IfcVertexPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(751); }
+        IfcVertexPoint get_IfcVertexPoint();
+        void put_IfcVertexPoint(IfcVertexPoint inst);
+    };
+
+
+    class IfcPointOrVertexPoint_get : public Select
+    {
+    public:
+        IfcPointOrVertexPoint_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcPointOrVertexPoint_get(Select* outer) : Select(outer) {}
+        bool is_IfcPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(430); }
+        IfcPoint get_IfcPoint();
+        bool is_IfcVertexPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(751); }
+        IfcVertexPoint get_IfcVertexPoint();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcPointOrVertexPoint_put : public Select
+    {
+    public:
+        IfcPointOrVertexPoint_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcPointOrVertexPoint_put(Select* outer) : Select(outer) {}
+        void put_IfcPoint(IfcPoint inst);
+        void put_IfcVertexPoint(IfcVertexPoint inst);
+    };
+
+
+    class IfcPresentationStyleSelect : public Select
+    {
+    public:
+        IfcPresentationStyleSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcPresentationStyleSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcCurveStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(163); }
+        IfcCurveStyle get_IfcCurveStyle();
+        void put_IfcCurveStyle(IfcCurveStyle inst);
+
+        bool is_IfcFillAreaStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(267); }
+        IfcFillAreaStyle get_IfcFillAreaStyle();
+        void put_IfcFillAreaStyle(IfcFillAreaStyle inst);
+
+        bool is_IfcNullStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(108); }
+        Nullable<IfcNullStyle> get_IfcNullStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); int v = getEnumerationValue(108, IfcNullStyle_hash); if (v >= 0) return (IfcNullStyle) v; else return Nullable<IfcNullStyle>(); }
+        void put_IfcNullStyle(IfcNullStyle value) { RDF_EXPRESS_PROBE(ProbeAttr()); TextValue val = IfcNullStyle_[(int) value]; putEnumerationValue(108, val); }
+
+        bool is_IfcSurfaceStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(677); }
+        IfcSurfaceStyle get_IfcSurfaceStyle();
+        void put_IfcSurfaceStyle(IfcSurfaceStyle inst);
+
+        bool is_IfcTextStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(711); }
+        IfcTextStyle get_IfcTextStyle();
+        void put_IfcTextStyle(IfcTextStyle inst);
+    };
+
+
+    class IfcPresentationStyleSelect_get : public Select
+    {
+    public:
+        IfcPresentationStyleSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcPresentationStyleSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcCurveStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(163); }
+        IfcCurveStyle get_IfcCurveStyle();
+        bool is_IfcFillAreaStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(267); }
+        IfcFillAreaStyle get_IfcFillAreaStyle();
+        bool is_IfcNullStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(108); }
+        Nullable<IfcNullStyle> get_IfcNullStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); int v = getEnumerationValue(108, IfcNullStyle_hash); if (v >= 0) return (IfcNullStyle) v; else return Nullable<IfcNullStyle>(); }
+        bool is_IfcSurfaceStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(677); }
+        IfcSurfaceStyle get_IfcSurfaceStyle();
+        bool is_IfcTextStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(711); }
+        IfcTextStyle get_IfcTextStyle();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcPresentationStyleSelect_put : public Select
+    {
+    public:
+        IfcPresentationStyleSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcPresentationStyleSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcCurveStyle(IfcCurveStyle inst);
+        void put_IfcFillAreaStyle(IfcFillAreaStyle inst);
+        void put_IfcNullStyle(IfcNullStyle value) { RDF_EXPRESS_PROBE(ProbeAttr()); TextValue val = IfcNullStyle_[(int) value]; putEnumerationValue(108, val); }
+        void put_IfcSurfaceStyle(IfcSurfaceStyle inst);
+        void put_IfcTextStyle(IfcTextStyle inst);
+    };
+
+
+    class IfcProcessSelect : public Select
+    {
+    public:
+        IfcProcessSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcProcessSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcProcess() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(452); }
+        IfcProcess get_IfcProcess();
+        void put_IfcProcess(IfcProcess inst);
+
+        bool is_IfcTypeProcess() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(737); }
+        IfcTypeProcess get_IfcTypeProcess();
+        void put_IfcTypeProcess(IfcTypeProcess inst);
+    };
+
+
+    class IfcProcessSelect_get : public Select
+    {
+    public:
+        IfcProcessSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcProcessSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcProcess() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(452); }
+        IfcProcess get_IfcProcess();
+        bool is_IfcTypeProcess() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(737); }
+        IfcTypeProcess get_IfcTypeProcess();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcProcessSelect_put : public Select
+    {
+    public:
+        IfcProcessSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcProcessSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcProcess(IfcProcess inst);
+        void put_IfcTypeProcess(IfcTypeProcess inst);
+    };
+
+
+    class IfcProductRepresentationSelect : public Select
+    {
+    public:
+        IfcProductRepresentationSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcProductRepresentationSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcProductDefinitionShape() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(454); }
+        IfcProductDefinitionShape get_IfcProductDefinitionShape();
+        void put_IfcProductDefinitionShape(IfcProductDefinitionShape inst);
+
+        bool is_IfcRepresentationMap() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(568); }
+        IfcRepresentationMap get_IfcRepresentationMap();
+        void put_IfcRepresentationMap(IfcRepresentationMap inst);
+    };
+
+
+    class IfcProductRepresentationSelect_get : public Select
+    {
+    public:
+        IfcProductRepresentationSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcProductRepresentationSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcProductDefinitionShape() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(454); }
+        IfcProductDefinitionShape get_IfcProductDefinitionShape();
+        bool is_IfcRepresentationMap() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(568); }
+        IfcRepresentationMap get_IfcRepresentationMap();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcProductRepresentationSelect_put : public Select
+    {
+    public:
+        IfcProductRepresentationSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcProductRepresentationSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcProductDefinitionShape(IfcProductDefinitionShape inst);
+        void put_IfcRepresentationMap(IfcRepresentationMap inst);
+    };
+
+
+    class IfcProductSelect : public Select
+    {
+    public:
+        IfcProductSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcProductSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcProduct() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(453); }
+        IfcProduct get_IfcProduct();
+        void put_IfcProduct(IfcProduct inst);
+
+        bool is_IfcTypeProduct() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(738); }
+        IfcTypeProduct get_IfcTypeProduct();
+        void put_IfcTypeProduct(IfcTypeProduct inst);
+    };
+
+
+    class IfcProductSelect_get : public Select
+    {
+    public:
+        IfcProductSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcProductSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcProduct() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(453); }
+        IfcProduct get_IfcProduct();
+        bool is_IfcTypeProduct() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(738); }
+        IfcTypeProduct get_IfcTypeProduct();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcProductSelect_put : public Select
+    {
+    public:
+        IfcProductSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcProductSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcProduct(IfcProduct inst);
+        void put_IfcTypeProduct(IfcTypeProduct inst);
+    };
+
+
+    class IfcPropertySetDefinitionSelect : public Select
+    {
+    public:
+        IfcPropertySetDefinitionSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcPropertySetDefinitionSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcPropertySetDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(473); }
+        IfcPropertySetDefinition get_IfcPropertySetDefinition();
+        void put_IfcPropertySetDefinition(IfcPropertySetDefinition inst);
+
+        bool is_IfcPropertySetDefinitionSet() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(109); }
+
+        //TList may be IfcPropertySetDefinitionSet or list of convertible elements
+        template <typename TList> void get_IfcPropertySetDefinitionSet(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); SdaiAggr aggr = getAggrValue(109); IfcPropertySetDefinitionSetSerializer<TList> sr; sr.FromSdaiAggr(lst, m_instance, aggr); }
+
+                //TList may be IfcPropertySetDefinitionSet or list of convertible elements
+        template <typename TList> void put_IfcPropertySetDefinitionSet(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); IfcPropertySetDefinitionSetSerializer<TList> sr; SdaiAggr aggr = sr.ToSdaiAggr(lst, m_instance, NULL); putAggrValue(109, aggr); }
+
+                //TArrayElem[] may be IfcPropertySetDefinition[] or array of convertible elements
+        template <typename TArrayElem> void put_IfcPropertySetDefinitionSet(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(ProbeAttr()); ArrayRange<TArrayElem> range = {arr, n}; IfcPropertySetDefinitionSetSerializer<IfcPropertySetDefinitionSet> sr; SdaiAggr aggr = sr.RangeToSdaiAggr(range, m_instance, NULL); putAggrValue(109, aggr); }
+    };
+
+
+    class IfcPropertySetDefinitionSelect_get : public Select
+    {
+    public:
+        IfcPropertySetDefinitionSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcPropertySetDefinitionSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcPropertySetDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(473); }
+        IfcPropertySetDefinition get_IfcPropertySetDefinition();
+        bool is_IfcPropertySetDefinitionSet() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(109); }
+
+        //TList may be IfcPropertySetDefinitionSet or list of convertible elements
+        template <typename TList> void get_IfcPropertySetDefinitionSet(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); SdaiAggr aggr = getAggrValue(109); IfcPropertySetDefinitionSetSerializer<TList> sr; sr.FromSdaiAggr(lst, m_instance, aggr); }
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcPropertySetDefinitionSelect_put : public Select
+    {
+    public:
+        IfcPropertySetDefinitionSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcPropertySetDefinitionSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcPropertySetDefinition(IfcPropertySetDefinition inst);
+
+                //TList may be IfcPropertySetDefinitionSet or list of convertible elements
+        template <typename TList> void put_IfcPropertySetDefinitionSet(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); IfcPropertySetDefinitionSetSerializer<TList> sr; SdaiAggr aggr = sr.ToSdaiAggr(lst, m_instance, NULL); putAggrValue(109, aggr); }
+
+                //TArrayElem[] may be IfcPropertySetDefinition[] or array of convertible elements
+        template <typename TArrayElem> void put_IfcPropertySetDefinitionSet(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(ProbeAttr()); ArrayRange<TArrayElem> range = {arr, n}; IfcPropertySetDefinitionSetSerializer<IfcPropertySetDefinitionSet> sr; SdaiAggr aggr = sr.RangeToSdaiAggr(range, m_instance, NULL); putAggrValue(109, aggr); }
+    };
+
+
+    class IfcResourceObjectSelect : public Select
+    {
+    public:
+        IfcResourceObjectSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcResourceObjectSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcActorRole() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(2); }
+        IfcActorRole get_IfcActorRole();
+        void put_IfcActorRole(IfcActorRole inst);
+
+        bool is_IfcAppliedValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(20); }
+        IfcAppliedValue get_IfcAppliedValue();
+        void put_IfcAppliedValue(IfcAppliedValue inst);
+
+        bool is_IfcApproval() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(21); }
+        IfcApproval get_IfcApproval();
+        void put_IfcApproval(IfcApproval inst);
+
+        bool is_IfcConstraint() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(125); }
+        IfcConstraint get_IfcConstraint();
+        void put_IfcConstraint(IfcConstraint inst);
+
+        bool is_IfcContextDependentUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(135); }
+        IfcContextDependentUnit get_IfcContextDependentUnit();
+        void put_IfcContextDependentUnit(IfcContextDependentUnit inst);
+
+        bool is_IfcConversionBasedUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(139); }
+        IfcConversionBasedUnit get_IfcConversionBasedUnit();
+        void put_IfcConversionBasedUnit(IfcConversionBasedUnit inst);
+
+        bool is_IfcExternalInformation() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(242); }
+        IfcExternalInformation get_IfcExternalInformation();
+        void put_IfcExternalInformation(IfcExternalInformation inst);
+
+        bool is_IfcExternalReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(246); }
+        IfcExternalReference get_IfcExternalReference();
+        void put_IfcExternalReference(IfcExternalReference inst);
+
+        bool is_IfcMaterialDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(359); }
+        IfcMaterialDefinition get_IfcMaterialDefinition();
+        void put_IfcMaterialDefinition(IfcMaterialDefinition inst);
+
+        bool is_IfcOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(398); }
+        IfcOrganization get_IfcOrganization();
+        void put_IfcOrganization(IfcOrganization inst);
+
+        bool is_IfcPerson() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(411); }
+        IfcPerson get_IfcPerson();
+        void put_IfcPerson(IfcPerson inst);
+
+        bool is_IfcPersonAndOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(412); }
+        IfcPersonAndOrganization get_IfcPersonAndOrganization();
+        void put_IfcPersonAndOrganization(IfcPersonAndOrganization inst);
+
+        bool is_IfcPhysicalQuantity() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(414); }
+        IfcPhysicalQuantity get_IfcPhysicalQuantity();
+        void put_IfcPhysicalQuantity(IfcPhysicalQuantity inst);
+
+        bool is_IfcProfileDef() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(456); }
+        IfcProfileDef get_IfcProfileDef();
+        void put_IfcProfileDef(IfcProfileDef inst);
+
+        bool is_IfcPropertyAbstraction() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(464); }
+        IfcPropertyAbstraction get_IfcPropertyAbstraction();
+        void put_IfcPropertyAbstraction(IfcPropertyAbstraction inst);
+
+        bool is_IfcTimeSeries() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(721); }
+        IfcTimeSeries get_IfcTimeSeries();
+        void put_IfcTimeSeries(IfcTimeSeries inst);
+    };
+
+
+    class IfcResourceObjectSelect_get : public Select
+    {
+    public:
+        IfcResourceObjectSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcResourceObjectSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcActorRole() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(2); }
+        IfcActorRole get_IfcActorRole();
+        bool is_IfcAppliedValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(20); }
+        IfcAppliedValue get_IfcAppliedValue();
+        bool is_IfcApproval() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(21); }
+        IfcApproval get_IfcApproval();
+        bool is_IfcConstraint() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(125); }
+        IfcConstraint get_IfcConstraint();
+        bool is_IfcContextDependentUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(135); }
+        IfcContextDependentUnit get_IfcContextDependentUnit();
+        bool is_IfcConversionBasedUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(139); }
+        IfcConversionBasedUnit get_IfcConversionBasedUnit();
+        bool is_IfcExternalInformation() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(242); }
+        IfcExternalInformation get_IfcExternalInformation();
+        bool is_IfcExternalReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(246); }
+        IfcExternalReference get_IfcExternalReference();
+        bool is_IfcMaterialDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(359); }
+        IfcMaterialDefinition get_IfcMaterialDefinition();
+        bool is_IfcOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(398); }
+        IfcOrganization get_IfcOrganization();
+        bool is_IfcPerson() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(411); }
+        IfcPerson get_IfcPerson();
+        bool is_IfcPersonAndOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(412); }
+        IfcPersonAndOrganization get_IfcPersonAndOrganization();
+        bool is_IfcPhysicalQuantity() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(414); }
+        IfcPhysicalQuantity get_IfcPhysicalQuantity();
+        bool is_IfcProfileDef() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(456); }
+        IfcProfileDef get_IfcProfileDef();
+        bool is_IfcPropertyAbstraction() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(464); }
+        IfcPropertyAbstraction get_IfcPropertyAbstraction();
+        bool is_IfcTimeSeries() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(721); }
+        IfcTimeSeries get_IfcTimeSeries();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcResourceObjectSelect_put : public Select
+    {
+    public:
+        IfcResourceObjectSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcResourceObjectSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcActorRole(IfcActorRole inst);
+        void put_IfcAppliedValue(IfcAppliedValue inst);
+        void put_IfcApproval(IfcApproval inst);
+        void put_IfcConstraint(IfcConstraint inst);
+        void put_IfcContextDependentUnit(IfcContextDependentUnit inst);
+        void put_IfcConversionBasedUnit(IfcConversionBasedUnit inst);
+        void put_IfcExternalInformation(IfcExternalInformation inst);
+        void put_IfcExternalReference(IfcExternalReference inst);
+        void put_IfcMaterialDefinition(IfcMaterialDefinition inst);
+        void put_IfcOrganization(IfcOrganization inst);
+        void put_IfcPerson(IfcPerson inst);
+        void put_IfcPersonAndOrganization(IfcPersonAndOrganization inst);
+        void put_IfcPhysicalQuantity(IfcPhysicalQuantity inst);
+        void put_IfcProfileDef(IfcProfileDef inst);
+        void put_IfcPropertyAbstraction(IfcPropertyAbstraction inst);
+        void put_IfcTimeSeries(IfcTimeSeries inst);
+    };
+
+
+    class IfcResourceSelect : public Select
+    {
+    public:
+        IfcResourceSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcResourceSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcResource() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(569); }
+        IfcResource get_IfcResource();
+        void put_IfcResource(IfcResource inst);
+
+        bool is_IfcTypeResource() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(739); }
+        IfcTypeResource get_IfcTypeResource();
+        void put_IfcTypeResource(IfcTypeResource inst);
+    };
+
+
+    class IfcResourceSelect_get : public Select
+    {
+    public:
+        IfcResourceSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcResourceSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcResource() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(569); }
+        IfcResource get_IfcResource();
+        bool is_IfcTypeResource() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(739); }
+        IfcTypeResource get_IfcTypeResource();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcResourceSelect_put : public Select
+    {
+    public:
+        IfcResourceSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcResourceSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcResource(IfcResource inst);
+        void put_IfcTypeResource(IfcTypeResource inst);
+    };
+
+
+    class IfcRotationalStiffnessSelect : public Select
+    {
+    public:
+        IfcRotationalStiffnessSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcRotationalStiffnessSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+
+        bool is_IfcRotationalStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(50); }
+        Nullable<IfcRotationalStiffnessMeasure> get_IfcRotationalStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRotationalStiffnessMeasure>(50, sdaiREAL); }
+        void put_IfcRotationalStiffnessMeasure(IfcRotationalStiffnessMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(50, sdaiREAL, value); }
+    };
+
+
+    class IfcRotationalStiffnessSelect_get : public Select
+    {
+    public:
+        IfcRotationalStiffnessSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcRotationalStiffnessSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        bool is_IfcRotationalStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(50); }
+        Nullable<IfcRotationalStiffnessMeasure> get_IfcRotationalStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRotationalStiffnessMeasure>(50, sdaiREAL); }
+
+        Nullable<bool> as_bool() { RDF_EXPRESS_PROBE(ProbeAttr()); bool val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiBOOLEAN, &val)) return val; else return Nullable<bool>(); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+    };
+
+
+    class IfcRotationalStiffnessSelect_put : public Select
+    {
+    public:
+        IfcRotationalStiffnessSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcRotationalStiffnessSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+        void put_IfcRotationalStiffnessMeasure(IfcRotationalStiffnessMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(50, sdaiREAL, value); }
+    };
+
+
+    class IfcSegmentIndexSelect : public Select
+    {
+    public:
+        IfcSegmentIndexSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSegmentIndexSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcArcIndex() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(110); }
+
+        //TList may be IfcArcIndex or list of convertible elements
+        template <typename TList> void get_IfcArcIndex(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); SdaiAggr aggr = getAggrValue(110); IfcArcIndexSerializer<TList> sr; sr.FromSdaiAggr(lst, m_instance, aggr); }
+
+                //TList may be IfcArcIndex or list of convertible elements
+        template <typename TList> void put_IfcArcIndex(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); IfcArcIndexSerializer<TList> sr; SdaiAggr aggr = sr.ToSdaiAggr(lst, m_instance, NULL); putAggrValue(110, aggr); }
+
+                //TArrayElem[] may be IfcPositiveInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_IfcArcIndex(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(ProbeAttr()); ArrayRange<TArrayElem> range = {arr, n}; IfcArcIndexSerializer<IfcArcIndex> sr; SdaiAggr aggr = sr.RangeToSdaiAggr(range, m_instance, NULL); putAggrValue(110, aggr); }
+
+        bool is_IfcLineIndex() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(111); }
+
+        //TList may be IfcLineIndex or list of convertible elements
+        template <typename TList> void get_IfcLineIndex(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); SdaiAggr aggr = getAggrValue(111); IfcLineIndexSerializer<TList> sr; sr.FromSdaiAggr(lst, m_instance, aggr); }
+
+                //TList may be IfcLineIndex or list of convertible elements
+        template <typename TList> void put_IfcLineIndex(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); IfcLineIndexSerializer<TList> sr; SdaiAggr aggr = sr.ToSdaiAggr(lst, m_instance, NULL); putAggrValue(111, aggr); }
+
+                //TArrayElem[] may be IfcPositiveInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_IfcLineIndex(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(ProbeAttr()); ArrayRange<TArrayElem> range = {arr, n}; IfcLineIndexSerializer<IfcLineIndex> sr; SdaiAggr aggr = sr.RangeToSdaiAggr(range, m_instance, NULL); putAggrValue(111, aggr); }
+    };
+
+
+    class IfcSegmentIndexSelect_get : public Select
+    {
+    public:
+        IfcSegmentIndexSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSegmentIndexSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcArcIndex() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(110); }
+
+        //TList may be IfcArcIndex or list of convertible elements
+        template <typename TList> void get_IfcArcIndex(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); SdaiAggr aggr = getAggrValue(110); IfcArcIndexSerializer<TList> sr; sr.FromSdaiAggr(lst, m_instance, aggr); }
+        bool is_IfcLineIndex() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(111); }
+
+        //TList may be IfcLineIndex or list of convertible elements
+        template <typename TList> void get_IfcLineIndex(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); SdaiAggr aggr = getAggrValue(111); IfcLineIndexSerializer<TList> sr; sr.FromSdaiAggr(lst, m_instance, aggr); }
+    };
+
+
+    class IfcSegmentIndexSelect_put : public Select
+    {
+    public:
+        IfcSegmentIndexSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSegmentIndexSelect_put(Select* outer) : Select(outer) {}
+
+                //TList may be IfcArcIndex or list of convertible elements
+        template <typename TList> void put_IfcArcIndex(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); IfcArcIndexSerializer<TList> sr; SdaiAggr aggr = sr.ToSdaiAggr(lst, m_instance, NULL); putAggrValue(110, aggr); }
+
+                //TArrayElem[] may be IfcPositiveInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_IfcArcIndex(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(ProbeAttr()); ArrayRange<TArrayElem> range = {arr, n}; IfcArcIndexSerializer<IfcArcIndex> sr; SdaiAggr aggr = sr.RangeToSdaiAggr(range, m_instance, NULL); putAggrValue(110, aggr); }
+
+                //TList may be IfcLineIndex or list of convertible elements
+        template <typename TList> void put_IfcLineIndex(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); IfcLineIndexSerializer<TList> sr; SdaiAggr aggr = sr.ToSdaiAggr(lst, m_instance, NULL); putAggrValue(111, aggr); }
+
+                //TArrayElem[] may be IfcPositiveInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_IfcLineIndex(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(ProbeAttr()); ArrayRange<TArrayElem> range = {arr, n}; IfcLineIndexSerializer<IfcLineIndex> sr; SdaiAggr aggr = sr.RangeToSdaiAggr(range, m_instance, NULL); putAggrValue(111, aggr); }
+    };
+
+
+    class IfcShell : public Select
+    {
+    public:
+        IfcShell(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcShell(Select* outer) : Select(outer) {}
+
+        bool is_IfcClosedShell() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(96); }
+        IfcClosedShell get_IfcClosedShell();
+        void put_IfcClosedShell(IfcClosedShell inst);
+
+        bool is_IfcOpenShell() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(397); }
+        IfcOpenShell get_IfcOpenShell();
+        void put_IfcOpenShell(IfcOpenShell inst);
+    };
+
+
+    class IfcShell_get : public Select
+    {
+    public:
+        IfcShell_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcShell_get(Select* outer) : Select(outer) {}
+        bool is_IfcClosedShell() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(96); }
+        IfcClosedShell get_IfcClosedShell();
+        bool is_IfcOpenShell() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(397); }
+        IfcOpenShell get_IfcOpenShell();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcShell_put : public Select
+    {
+    public:
+        IfcShell_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcShell_put(Select* outer) : Select(outer) {}
+        void put_IfcClosedShell(IfcClosedShell inst);
+        void put_IfcOpenShell(IfcOpenShell inst);
+    };
+
+
+    class IfcSizeSelect : public Select
+    {
+    public:
+        IfcSizeSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSizeSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcDescriptiveMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(76); }
+        IfcDescriptiveMeasure get_IfcDescriptiveMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(76, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcDescriptiveMeasure_view() { return TextView(get_IfcDescriptiveMeasure()); }
+#endif
+        void put_IfcDescriptiveMeasure(IfcDescriptiveMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(76, sdaiSTRING, value); }
+
+        bool is_IfcLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(78); }
+        Nullable<IfcLengthMeasure> get_IfcLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLengthMeasure>(78, sdaiREAL); }
+        void put_IfcLengthMeasure(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(78, sdaiREAL, value); }
+
+        bool is_IfcNormalisedRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(82); }
+        Nullable<IfcNormalisedRatioMeasure> get_IfcNormalisedRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcNormalisedRatioMeasure>(82, sdaiREAL); }
+        void put_IfcNormalisedRatioMeasure(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(82, sdaiREAL, value); }
+
+        bool is_IfcPositiveLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(86); }
+        Nullable<IfcPositiveLengthMeasure> get_IfcPositiveLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositiveLengthMeasure>(86, sdaiREAL); }
+        void put_IfcPositiveLengthMeasure(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(86, sdaiREAL, value); }
+
+        bool is_IfcPositiveRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(88); }
+        Nullable<IfcPositiveRatioMeasure> get_IfcPositiveRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositiveRatioMeasure>(88, sdaiREAL); }
+        void put_IfcPositiveRatioMeasure(IfcPositiveRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(88, sdaiREAL, value); }
+
+        bool is_IfcRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(89); }
+        Nullable<IfcRatioMeasure> get_IfcRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRatioMeasure>(89, sdaiREAL); }
+        void put_IfcRatioMeasure(IfcRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(89, sdaiREAL, value); }
+    };
+
+
+    class IfcSizeSelect_get : public Select
+    {
+    public:
+        IfcSizeSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSizeSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcDescriptiveMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(76); }
+        IfcDescriptiveMeasure get_IfcDescriptiveMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(76, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcDescriptiveMeasure_view() { return TextView(get_IfcDescriptiveMeasure()); }
+#endif
+        bool is_IfcLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(78); }
+        Nullable<IfcLengthMeasure> get_IfcLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLengthMeasure>(78, sdaiREAL); }
+        bool is_IfcNormalisedRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(82); }
+        Nullable<IfcNormalisedRatioMeasure> get_IfcNormalisedRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcNormalisedRatioMeasure>(82, sdaiREAL); }
+        bool is_IfcPositiveLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(86); }
+        Nullable<IfcPositiveLengthMeasure> get_IfcPositiveLengthMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositiveLengthMeasure>(86, sdaiREAL); }
+        bool is_IfcPositiveRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(88); }
+        Nullable<IfcPositiveRatioMeasure> get_IfcPositiveRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcPositiveRatioMeasure>(88, sdaiREAL); }
+        bool is_IfcRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(89); }
+        Nullable<IfcRatioMeasure> get_IfcRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRatioMeasure>(89, sdaiREAL); }
+
+        TextValue as_text() { RDF_EXPRESS_PROBE(ProbeAttr()); TextValue val = NULL; sdaiGetAttr(m_instance, getAttrDefinition(), sdaiSTRING, &val); return val; }
+#ifdef __cpp_lib_string_view
+        std::string_view as_text_view() { return TextView(as_text()); }
+#endif
+        const char* as_text_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(ProbeAttr()); return buffer.GetAttr(m_instance, getAttrName()); }
+        const char* as_text_utf8() { return as_text_utf8(ThreadUtf8Buffer()); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+    };
+
+
+    class IfcSizeSelect_put : public Select
+    {
+    public:
+        IfcSizeSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSizeSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcDescriptiveMeasure(IfcDescriptiveMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(76, sdaiSTRING, value); }
+        void put_IfcLengthMeasure(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(78, sdaiREAL, value); }
+        void put_IfcNormalisedRatioMeasure(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(82, sdaiREAL, value); }
+        void put_IfcPositiveLengthMeasure(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(86, sdaiREAL, value); }
+        void put_IfcPositiveRatioMeasure(IfcPositiveRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(88, sdaiREAL, value); }
+        void put_IfcRatioMeasure(IfcRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(89, sdaiREAL, value); }
+    };
+
+
+    class IfcSolidOrShell : public Select
+    {
+    public:
+        IfcSolidOrShell(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSolidOrShell(Select* outer) : Select(outer) {}
+
+        bool is_IfcClosedShell() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(96); }
+        IfcClosedShell get_IfcClosedShell();
+        void put_IfcClosedShell(IfcClosedShell inst);
+
+        bool is_IfcSolidModel() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(608); }
+        IfcSolidModel get_IfcSolidModel();
+        void put_IfcSolidModel(IfcSolidModel inst);
+    };
+
+
+    class IfcSolidOrShell_get : public Select
+    {
+    public:
+        IfcSolidOrShell_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSolidOrShell_get(Select* outer) : Select(outer) {}
+        bool is_IfcClosedShell() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(96); }
+        IfcClosedShell get_IfcClosedShell();
+        bool is_IfcSolidModel() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(608); }
+        IfcSolidModel get_IfcSolidModel();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcSolidOrShell_put : public Select
+    {
+    public:
+        IfcSolidOrShell_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSolidOrShell_put(Select* outer) : Select(outer) {}
+        void put_IfcClosedShell(IfcClosedShell inst);
+        void put_IfcSolidModel(IfcSolidModel inst);
+    };
+
+
+    class IfcSpaceBoundarySelect : public Select
+    {
+    public:
+        IfcSpaceBoundarySelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSpaceBoundarySelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcExternalSpatialElement() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(248); }
+        IfcExternalSpatialElement get_IfcExternalSpatialElement();
+        void put_IfcExternalSpatialElement(IfcExternalSpatialElement inst);
+
+        bool is_IfcSpace() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(609); }
+        IfcSpace get_IfcSpace();
+        void put_IfcSpace(IfcSpace inst);
+    };
+
+
+    class IfcSpaceBoundarySelect_get : public Select
+    {
+    public:
+        IfcSpaceBoundarySelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSpaceBoundarySelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcExternalSpatialElement() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(248); }
+        IfcExternalSpatialElement get_IfcExternalSpatialElement();
+        bool is_IfcSpace() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(609); }
+        IfcSpace get_IfcSpace();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcSpaceBoundarySelect_put : public Select
+    {
+    public:
+        IfcSpaceBoundarySelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSpaceBoundarySelect_put(Select* outer) : Select(outer) {}
+        void put_IfcExternalSpatialElement(IfcExternalSpatialElement inst);
+        void put_IfcSpace(IfcSpace inst);
+    };
+
+
+    class IfcSpecularHighlightSelect : public Select
+    {
+    public:
+        IfcSpecularHighlightSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSpecularHighlightSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcSpecularExponent() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(112); }
+        Nullable<IfcSpecularExponent> get_IfcSpecularExponent() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSpecularExponent>(112, sdaiREAL); }
+        void put_IfcSpecularExponent(IfcSpecularExponent value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(112, sdaiREAL, value); }
+
+        bool is_IfcSpecularRoughness() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(113); }
+        Nullable<IfcSpecularRoughness> get_IfcSpecularRoughness() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSpecularRoughness>(113, sdaiREAL); }
+        void put_IfcSpecularRoughness(IfcSpecularRoughness value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(113, sdaiREAL, value); }
+    };
+
+
+    class IfcSpecularHighlightSelect_get : public Select
+    {
+    public:
+        IfcSpecularHighlightSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSpecularHighlightSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcSpecularExponent() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(112); }
+        Nullable<IfcSpecularExponent> get_IfcSpecularExponent() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSpecularExponent>(112, sdaiREAL); }
+        bool is_IfcSpecularRoughness() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(113); }
+        Nullable<IfcSpecularRoughness> get_IfcSpecularRoughness() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcSpecularRoughness>(113, sdaiREAL); }
+
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+    };
+
+
+    class IfcSpecularHighlightSelect_put : public Select
+    {
+    public:
+        IfcSpecularHighlightSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSpecularHighlightSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcSpecularExponent(IfcSpecularExponent value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(112, sdaiREAL, value); }
+        void put_IfcSpecularRoughness(IfcSpecularRoughness value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(113, sdaiREAL, value); }
+    };
+
+
+    class IfcStructuralActivityAssignmentSelect : public Select
+    {
+    public:
+        IfcStructuralActivityAssignmentSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcStructuralActivityAssignmentSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcElement() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(220); }
+        IfcElement get_IfcElement();
+        void put_IfcElement(IfcElement inst);
+
+        bool is_IfcStructuralItem() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(637); }
+        IfcStructuralItem get_IfcStructuralItem();
+        void put_IfcStructuralItem(IfcStructuralItem inst);
+    };
+
+
+    class IfcStructuralActivityAssignmentSelect_get : public Select
+    {
+    public:
+        IfcStructuralActivityAssignmentSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcStructuralActivityAssignmentSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcElement() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(220); }
+        IfcElement get_IfcElement();
+        bool is_IfcStructuralItem() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(637); }
+        IfcStructuralItem get_IfcStructuralItem();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcStructuralActivityAssignmentSelect_put : public Select
+    {
+    public:
+        IfcStructuralActivityAssignmentSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcStructuralActivityAssignmentSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcElement(IfcElement inst);
+        void put_IfcStructuralItem(IfcStructuralItem inst);
+    };
+
+
+    class IfcStyleAssignmentSelect : public Select
+    {
+    public:
+        IfcStyleAssignmentSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcStyleAssignmentSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcPresentationStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(448); }
+        IfcPresentationStyle get_IfcPresentationStyle();
+        void put_IfcPresentationStyle(IfcPresentationStyle inst);
+
+        bool is_IfcPresentationStyleAssignment() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(449); }
+        IfcPresentationStyleAssignment get_IfcPresentationStyleAssignment();
+        void put_IfcPresentationStyleAssignment(IfcPresentationStyleAssignment inst);
+    };
+
+
+    class IfcStyleAssignmentSelect_get : public Select
+    {
+    public:
+        IfcStyleAssignmentSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcStyleAssignmentSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcPresentationStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(448); }
+        IfcPresentationStyle get_IfcPresentationStyle();
+        bool is_IfcPresentationStyleAssignment() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(449); }
+        IfcPresentationStyleAssignment get_IfcPresentationStyleAssignment();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcStyleAssignmentSelect_put : public Select
+    {
+    public:
+        IfcStyleAssignmentSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcStyleAssignmentSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcPresentationStyle(IfcPresentationStyle inst);
+        void put_IfcPresentationStyleAssignment(IfcPresentationStyleAssignment inst);
+    };
+
+
+    class IfcSurfaceOrFaceSurface : public Select
+    {
+    public:
+        IfcSurfaceOrFaceSurface(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSurfaceOrFaceSurface(Select* outer) : Select(outer) {}
+
+        bool is_IfcFaceBasedSurfaceModel() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(253); }
+        IfcFaceBasedSurfaceModel get_IfcFaceBasedSurfaceModel();
+        void put_IfcFaceBasedSurfaceModel(IfcFaceBasedSurfaceModel inst);
+
+        bool is_IfcFaceSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(256); }
+        IfcFaceSurface get_IfcFaceSurface();
+        void put_IfcFaceSurface(IfcFaceSurface inst);
+
+        bool is_IfcSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(670); }
+        IfcSurface get_IfcSurface();
+        void put_IfcSurface(IfcSurface inst);
+    };
+
+
+    class IfcSurfaceOrFaceSurface_get : public Select
+    {
+    public:
+        IfcSurfaceOrFaceSurface_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSurfaceOrFaceSurface_get(Select* outer) : Select(outer) {}
+        bool is_IfcFaceBasedSurfaceModel() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(253); }
+        IfcFaceBasedSurfaceModel get_IfcFaceBasedSurfaceModel();
+        bool is_IfcFaceSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(256); }
+        IfcFaceSurface get_IfcFaceSurface();
+        bool is_IfcSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(670); }
+        IfcSurface get_IfcSurface();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcSurfaceOrFaceSurface_put : public Select
+    {
+    public:
+        IfcSurfaceOrFaceSurface_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSurfaceOrFaceSurface_put(Select* outer) : Select(outer) {}
+        void put_IfcFaceBasedSurfaceModel(IfcFaceBasedSurfaceModel inst);
+        void put_IfcFaceSurface(IfcFaceSurface inst);
+        void put_IfcSurface(IfcSurface inst);
+    };
+
+
+    class IfcSurfaceStyleElementSelect : public Select
+    {
+    public:
+        IfcSurfaceStyleElementSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSurfaceStyleElementSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcExternallyDefinedSurfaceStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(244); }
+        IfcExternallyDefinedSurfaceStyle get_IfcExternallyDefinedSurfaceStyle();
+        void put_IfcExternallyDefinedSurfaceStyle(IfcExternallyDefinedSurfaceStyle inst);
+
+        bool is_IfcSurfaceStyleLighting() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(678); }
+        IfcSurfaceStyleLighting get_IfcSurfaceStyleLighting();
+        void put_IfcSurfaceStyleLighting(IfcSurfaceStyleLighting inst);
+
+        bool is_IfcSurfaceStyleRefraction() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(679); }
+        IfcSurfaceStyleRefraction get_IfcSurfaceStyleRefraction();
+        void put_IfcSurfaceStyleRefraction(IfcSurfaceStyleRefraction inst);
+
+        bool is_IfcSurfaceStyleShading() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(681); }
+        IfcSurfaceStyleShading get_IfcSurfaceStyleShading();
+        void put_IfcSurfaceStyleShading(IfcSurfaceStyleShading inst);
+
+        bool is_IfcSurfaceStyleWithTextures() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(682); }
+        IfcSurfaceStyleWithTextures get_IfcSurfaceStyleWithTextures();
+        void put_IfcSurfaceStyleWithTextures(IfcSurfaceStyleWithTextures inst);
+    };
+
+
+    class IfcSurfaceStyleElementSelect_get : public Select
+    {
+    public:
+        IfcSurfaceStyleElementSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSurfaceStyleElementSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcExternallyDefinedSurfaceStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(244); }
+        IfcExternallyDefinedSurfaceStyle get_IfcExternallyDefinedSurfaceStyle();
+        bool is_IfcSurfaceStyleLighting() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(678); }
+        IfcSurfaceStyleLighting get_IfcSurfaceStyleLighting();
+        bool is_IfcSurfaceStyleRefraction() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(679); }
+        IfcSurfaceStyleRefraction get_IfcSurfaceStyleRefraction();
+        bool is_IfcSurfaceStyleShading() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(681); }
+        IfcSurfaceStyleShading get_IfcSurfaceStyleShading();
+        bool is_IfcSurfaceStyleWithTextures() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(682); }
+        IfcSurfaceStyleWithTextures get_IfcSurfaceStyleWithTextures();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcSurfaceStyleElementSelect_put : public Select
+    {
+    public:
+        IfcSurfaceStyleElementSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcSurfaceStyleElementSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcExternallyDefinedSurfaceStyle(IfcExternallyDefinedSurfaceStyle inst);
+        void put_IfcSurfaceStyleLighting(IfcSurfaceStyleLighting inst);
+        void put_IfcSurfaceStyleRefraction(IfcSurfaceStyleRefraction inst);
+        void put_IfcSurfaceStyleShading(IfcSurfaceStyleShading inst);
+        void put_IfcSurfaceStyleWithTextures(IfcSurfaceStyleWithTextures inst);
+    };
+
+
+    class IfcTextFontSelect : public Select
+    {
+    public:
+        IfcTextFontSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcTextFontSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcExternallyDefinedTextFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(245); }
+        IfcExternallyDefinedTextFont get_IfcExternallyDefinedTextFont();
+        void put_IfcExternallyDefinedTextFont(IfcExternallyDefinedTextFont inst);
+
+        bool is_IfcPreDefinedTextFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(444); }
+        IfcPreDefinedTextFont get_IfcPreDefinedTextFont();
+        void put_IfcPreDefinedTextFont(IfcPreDefinedTextFont inst);
+    };
+
+
+    class IfcTextFontSelect_get : public Select
+    {
+    public:
+        IfcTextFontSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcTextFontSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcExternallyDefinedTextFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(245); }
+        IfcExternallyDefinedTextFont get_IfcExternallyDefinedTextFont();
+        bool is_IfcPreDefinedTextFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(444); }
+        IfcPreDefinedTextFont get_IfcPreDefinedTextFont();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcTextFontSelect_put : public Select
+    {
+    public:
+        IfcTextFontSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcTextFontSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcExternallyDefinedTextFont(IfcExternallyDefinedTextFont inst);
+        void put_IfcPreDefinedTextFont(IfcPreDefinedTextFont inst);
+    };
+
+
+    class IfcTimeOrRatioSelect : public Select
+    {
+    public:
+        IfcTimeOrRatioSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcTimeOrRatioSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcDuration() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(98); }
+        IfcDuration get_IfcDuration() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(98, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcDuration_view() { return TextView(get_IfcDuration()); }
+#endif
+        void put_IfcDuration(IfcDuration value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(98, sdaiSTRING, value); }
+
+        bool is_IfcRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(89); }
+        Nullable<IfcRatioMeasure> get_IfcRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRatioMeasure>(89, sdaiREAL); }
+        void put_IfcRatioMeasure(IfcRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(89, sdaiREAL, value); }
+    };
+
+
+    class IfcTimeOrRatioSelect_get : public Select
+    {
+    public:
+        IfcTimeOrRatioSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcTimeOrRatioSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcDuration() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(98); }
+        IfcDuration get_IfcDuration() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(98, sdaiSTRING); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IfcDuration_view() { return TextView(get_IfcDuration()); }
+#endif
+        bool is_IfcRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(89); }
+        Nullable<IfcRatioMeasure> get_IfcRatioMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcRatioMeasure>(89, sdaiREAL); }
+
+        TextValue as_text() { RDF_EXPRESS_PROBE(ProbeAttr()); TextValue val = NULL; sdaiGetAttr(m_instance, getAttrDefinition(), sdaiSTRING, &val); return val; }
+#ifdef __cpp_lib_string_view
+        std::string_view as_text_view() { return TextView(as_text()); }
+#endif
+        const char* as_text_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(ProbeAttr()); return buffer.GetAttr(m_instance, getAttrName()); }
+        const char* as_text_utf8() { return as_text_utf8(ThreadUtf8Buffer()); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+    };
+
+
+    class IfcTimeOrRatioSelect_put : public Select
+    {
+    public:
+        IfcTimeOrRatioSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcTimeOrRatioSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcDuration(IfcDuration value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(98, sdaiSTRING, value); }
+        void put_IfcRatioMeasure(IfcRatioMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(89, sdaiREAL, value); }
+    };
+
+
+    class IfcTranslationalStiffnessSelect : public Select
+    {
+    public:
+        IfcTranslationalStiffnessSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcTranslationalStiffnessSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+
+        bool is_IfcLinearStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(26); }
+        Nullable<IfcLinearStiffnessMeasure> get_IfcLinearStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLinearStiffnessMeasure>(26, sdaiREAL); }
+        void put_IfcLinearStiffnessMeasure(IfcLinearStiffnessMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(26, sdaiREAL, value); }
+    };
+
+
+    class IfcTranslationalStiffnessSelect_get : public Select
+    {
+    public:
+        IfcTranslationalStiffnessSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcTranslationalStiffnessSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        bool is_IfcLinearStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(26); }
+        Nullable<IfcLinearStiffnessMeasure> get_IfcLinearStiffnessMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcLinearStiffnessMeasure>(26, sdaiREAL); }
+
+        Nullable<bool> as_bool() { RDF_EXPRESS_PROBE(ProbeAttr()); bool val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiBOOLEAN, &val)) return val; else return Nullable<bool>(); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+    };
+
+
+    class IfcTranslationalStiffnessSelect_put : public Select
+    {
+    public:
+        IfcTranslationalStiffnessSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcTranslationalStiffnessSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+        void put_IfcLinearStiffnessMeasure(IfcLinearStiffnessMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(26, sdaiREAL, value); }
+    };
+
+
+    class IfcTrimmingSelect : public Select
+    {
+    public:
+        IfcTrimmingSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcTrimmingSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcCartesianPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(75); }
+        IfcCartesianPoint get_IfcCartesianPoint();
+        void put_IfcCartesianPoint(IfcCartesianPoint inst);
+
+        bool is_IfcParameterValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(84); }
+        Nullable<IfcParameterValue> get_IfcParameterValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcParameterValue>(84, sdaiREAL); }
+        void put_IfcParameterValue(IfcParameterValue value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(84, sdaiREAL, value); }
+    };
+
+
+    class IfcTrimmingSelect_get : public Select
+    {
+    public:
+        IfcTrimmingSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcTrimmingSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcCartesianPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(75); }
+        IfcCartesianPoint get_IfcCartesianPoint();
+        bool is_IfcParameterValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(84); }
+        Nullable<IfcParameterValue> get_IfcParameterValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcParameterValue>(84, sdaiREAL); }
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+    };
+
+
+    class IfcTrimmingSelect_put : public Select
+    {
+    public:
+        IfcTrimmingSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcTrimmingSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcCartesianPoint(IfcCartesianPoint inst);
+        void put_IfcParameterValue(IfcParameterValue value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(84, sdaiREAL, value); }
+    };
+
+
+    class IfcUnit : public Select
+    {
+    public:
+        IfcUnit(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcUnit(Select* outer) : Select(outer) {}
+
+        bool is_IfcDerivedUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(171); }
+        IfcDerivedUnit get_IfcDerivedUnit();
+        void put_IfcDerivedUnit(IfcDerivedUnit inst);
+
+        bool is_IfcMonetaryUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(384); }
+        IfcMonetaryUnit get_IfcMonetaryUnit();
+        void put_IfcMonetaryUnit(IfcMonetaryUnit inst);
+
+        bool is_IfcNamedUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(387); }
+        IfcNamedUnit get_IfcNamedUnit();
+        void put_IfcNamedUnit(IfcNamedUnit inst);
+    };
+
+
+    class IfcUnit_get : public Select
+    {
+    public:
+        IfcUnit_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcUnit_get(Select* outer) : Select(outer) {}
+        bool is_IfcDerivedUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(171); }
+        IfcDerivedUnit get_IfcDerivedUnit();
+        bool is_IfcMonetaryUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(384); }
+        IfcMonetaryUnit get_IfcMonetaryUnit();
+        bool is_IfcNamedUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(387); }
+        IfcNamedUnit get_IfcNamedUnit();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcUnit_put : public Select
+    {
+    public:
+        IfcUnit_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcUnit_put(Select* outer) : Select(outer) {}
+        void put_IfcDerivedUnit(IfcDerivedUnit inst);
+        void put_IfcMonetaryUnit(IfcMonetaryUnit inst);
+        void put_IfcNamedUnit(IfcNamedUnit inst);
+    };
+
+
+    class IfcVectorOrDirection : public Select
+    {
+    public:
+        IfcVectorOrDirection(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcVectorOrDirection(Select* outer) : Select(outer) {}
+
+        bool is_IfcDirection() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(174); }
+        IfcDirection get_IfcDirection();
+        void put_IfcDirection(IfcDirection inst);
+
+        bool is_IfcVector() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(748); }
+        IfcVector get_IfcVector();
+        void put_IfcVector(IfcVector inst);
+    };
+
+
+    class IfcVectorOrDirection_get : public Select
+    {
+    public:
+        IfcVectorOrDirection_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcVectorOrDirection_get(Select* outer) : Select(outer) {}
+        bool is_IfcDirection() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(174); }
+        IfcDirection get_IfcDirection();
+        bool is_IfcVector() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(748); }
+        IfcVector get_IfcVector();
+
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
+    };
+
+
+    class IfcVectorOrDirection_put : public Select
+    {
+    public:
+        IfcVectorOrDirection_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcVectorOrDirection_put(Select* outer) : Select(outer) {}
+        void put_IfcDirection(IfcDirection inst);
+        void put_IfcVector(IfcVector inst);
+    };
+
+
+    class IfcWarpingStiffnessSelect : public Select
+    {
+    public:
+        IfcWarpingStiffnessSelect(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcWarpingStiffnessSelect(Select* outer) : Select(outer) {}
+
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+
+        bool is_IfcWarpingMomentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(70); }
+        Nullable<IfcWarpingMomentMeasure> get_IfcWarpingMomentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcWarpingMomentMeasure>(70, sdaiREAL); }
+        void put_IfcWarpingMomentMeasure(IfcWarpingMomentMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(70, sdaiREAL, value); }
+    };
+
+
+    class IfcWarpingStiffnessSelect_get : public Select
+    {
+    public:
+        IfcWarpingStiffnessSelect_get(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcWarpingStiffnessSelect_get(Select* outer) : Select(outer) {}
+        bool is_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(95); }
+        Nullable<IfcBoolean> get_IfcBoolean() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcBoolean>(95, sdaiBOOLEAN); }
+        bool is_IfcWarpingMomentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(70); }
+        Nullable<IfcWarpingMomentMeasure> get_IfcWarpingMomentMeasure() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<IfcWarpingMomentMeasure>(70, sdaiREAL); }
+
+        Nullable<bool> as_bool() { RDF_EXPRESS_PROBE(ProbeAttr()); bool val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiBOOLEAN, &val)) return val; else return Nullable<bool>(); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
+    };
+
+
+    class IfcWarpingStiffnessSelect_put : public Select
+    {
+    public:
+        IfcWarpingStiffnessSelect_put(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
+        IfcWarpingStiffnessSelect_put(Select* outer) : Select(outer) {}
+        void put_IfcBoolean(IfcBoolean value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(95, sdaiBOOLEAN, value); }
+        void put_IfcWarpingMomentMeasure(IfcWarpingMomentMeasure value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(70, sdaiREAL, value); }
+    };
+
+
+        //
+        // Unnamed aggregations
+        //
+    typedef AggrContainer<IfcRelAssigns> SetOfIfcRelAssigns;
+    template <typename TList> class SetOfIfcRelAssignsSerializer : public AggrSerializerInstance<TList, IfcRelAssigns> {};
+    typedef AggrContainer<IfcRelNests> SetOfIfcRelNests;
+    template <typename TList> class SetOfIfcRelNestsSerializer : public AggrSerializerInstance<TList, IfcRelNests> {};
+    typedef AggrContainer<IfcRelDeclares> SetOfIfcRelDeclares;
+    template <typename TList> class SetOfIfcRelDeclaresSerializer : public AggrSerializerInstance<TList, IfcRelDeclares> {};
+    typedef AggrContainer<IfcRelAggregates> SetOfIfcRelAggregates;
+    template <typename TList> class SetOfIfcRelAggregatesSerializer : public AggrSerializerInstance<TList, IfcRelAggregates> {};
+    typedef AggrContainer<IfcRelAssociates> SetOfIfcRelAssociates;
+    template <typename TList> class SetOfIfcRelAssociatesSerializer : public AggrSerializerInstance<TList, IfcRelAssociates> {};
+    typedef AggrContainer<IfcRelDefinesByObject> SetOfIfcRelDefinesByObject;
+    template <typename TList> class SetOfIfcRelDefinesByObjectSerializer : public AggrSerializerInstance<TList, IfcRelDefinesByObject> {};
+    typedef AggrContainer<IfcRelDefinesByType> SetOfIfcRelDefinesByType;
+    template <typename TList> class SetOfIfcRelDefinesByTypeSerializer : public AggrSerializerInstance<TList, IfcRelDefinesByType> {};
+    typedef AggrContainer<IfcRelDefinesByProperties> SetOfIfcRelDefinesByProperties;
+    template <typename TList> class SetOfIfcRelDefinesByPropertiesSerializer : public AggrSerializerInstance<TList, IfcRelDefinesByProperties> {};
+    typedef AggrContainer<IfcRelAssignsToControl> SetOfIfcRelAssignsToControl;
+    template <typename TList> class SetOfIfcRelAssignsToControlSerializer : public AggrSerializerInstance<TList, IfcRelAssignsToControl> {};
+    typedef AggrContainer<IfcRelAssignsToActor> SetOfIfcRelAssignsToActor;
+    template <typename TList> class SetOfIfcRelAssignsToActorSerializer : public AggrSerializerInstance<TList, IfcRelAssignsToActor> {};
+    typedef AggrContainer<IfcExternalReferenceRelationship> SetOfIfcExternalReferenceRelationship;
+    template <typename TList> class SetOfIfcExternalReferenceRelationshipSerializer : public AggrSerializerInstance<TList, IfcExternalReferenceRelationship> {};
+    typedef AggrContainer<IfcRelAssignsToProduct> SetOfIfcRelAssignsToProduct;
+    template <typename TList> class SetOfIfcRelAssignsToProductSerializer : public AggrSerializerInstance<TList, IfcRelAssignsToProduct> {};
+    typedef AggrContainer<IfcRelFillsElement> SetOfIfcRelFillsElement;
+    template <typename TList> class SetOfIfcRelFillsElementSerializer : public AggrSerializerInstance<TList, IfcRelFillsElement> {};
+    typedef AggrContainer<IfcRelConnectsElements> SetOfIfcRelConnectsElements;
+    template <typename TList> class SetOfIfcRelConnectsElementsSerializer : public AggrSerializerInstance<TList, IfcRelConnectsElements> {};
+    typedef AggrContainer<IfcRelInterferesElements> SetOfIfcRelInterferesElements;
+    template <typename TList> class SetOfIfcRelInterferesElementsSerializer : public AggrSerializerInstance<TList, IfcRelInterferesElements> {};
+    typedef AggrContainer<IfcRelProjectsElement> SetOfIfcRelProjectsElement;
+    template <typename TList> class SetOfIfcRelProjectsElementSerializer : public AggrSerializerInstance<TList, IfcRelProjectsElement> {};
+    typedef AggrContainer<IfcRelReferencedInSpatialStructure> SetOfIfcRelReferencedInSpatialStructure;
+    template <typename TList> class SetOfIfcRelReferencedInSpatialStructureSerializer : public AggrSerializerInstance<TList, IfcRelReferencedInSpatialStructure> {};
+    typedef AggrContainer<IfcRelVoidsElement> SetOfIfcRelVoidsElement;
+    template <typename TList> class SetOfIfcRelVoidsElementSerializer : public AggrSerializerInstance<TList, IfcRelVoidsElement> {};
+    typedef AggrContainer<IfcRelConnectsWithRealizingElements> SetOfIfcRelConnectsWithRealizingElements;
+    template <typename TList> class SetOfIfcRelConnectsWithRealizingElementsSerializer : public AggrSerializerInstance<TList, IfcRelConnectsWithRealizingElements> {};
+    typedef AggrContainer<IfcRelSpaceBoundary> SetOfIfcRelSpaceBoundary;
+    template <typename TList> class SetOfIfcRelSpaceBoundarySerializer : public AggrSerializerInstance<TList, IfcRelSpaceBoundary> {};
+    typedef AggrContainer<IfcRelContainedInSpatialStructure> SetOfIfcRelContainedInSpatialStructure;
+    template <typename TList> class SetOfIfcRelContainedInSpatialStructureSerializer : public AggrSerializerInstance<TList, IfcRelContainedInSpatialStructure> {};
+    typedef AggrContainer<IfcRelCoversBldgElements> SetOfIfcRelCoversBldgElements;
+    template <typename TList> class SetOfIfcRelCoversBldgElementsSerializer : public AggrSerializerInstance<TList, IfcRelCoversBldgElements> {};
+    typedef AggrContainer<IfcRelConnectsPortToElement> SetOfIfcRelConnectsPortToElement;
+    template <typename TList> class SetOfIfcRelConnectsPortToElementSerializer : public AggrSerializerInstance<TList, IfcRelConnectsPortToElement> {};
+    typedef AggrContainer<IfcRelFlowControlElements> SetOfIfcRelFlowControlElements;
+    template <typename TList> class SetOfIfcRelFlowControlElementsSerializer : public AggrSerializerInstance<TList, IfcRelFlowControlElements> {};
+    typedef AggrContainer<IfcPropertySetDefinition> SetOfIfcPropertySetDefinition;
+    template <typename TList> class SetOfIfcPropertySetDefinitionSerializer : public AggrSerializerInstance<TList, IfcPropertySetDefinition> {};
+    typedef AggrContainer<IfcRepresentationMap> ListOfIfcRepresentationMap;
+    template <typename TList> class ListOfIfcRepresentationMapSerializer : public AggrSerializerInstance<TList, IfcRepresentationMap> {};
+    typedef AggrContainer<IfcPerson> SetOfIfcPerson;
+    template <typename TList> class SetOfIfcPersonSerializer : public AggrSerializerInstance<TList, IfcPerson> {};
+    typedef AggrContainer<IfcOrganization> SetOfIfcOrganization;
+    template <typename TList> class SetOfIfcOrganizationSerializer : public AggrSerializerInstance<TList, IfcOrganization> {};
+    typedef AggrContainer<IfcPresentationLayerAssignment> SetOfIfcPresentationLayerAssignment;
+    template <typename TList> class SetOfIfcPresentationLayerAssignmentSerializer : public AggrSerializerInstance<TList, IfcPresentationLayerAssignment> {};
+    typedef AggrContainer<IfcStyledItem> SetOfIfcStyledItem;
+    template <typename TList> class SetOfIfcStyledItemSerializer : public AggrSerializerInstance<TList, IfcStyledItem> {};
+    typedef AggrContainer<IfcClosedShell> SetOfIfcClosedShell;
+    template <typename TList> class SetOfIfcClosedShellSerializer : public AggrSerializerInstance<TList, IfcClosedShell> {};
+    typedef AggrContainer<IfcFaceBound> SetOfIfcFaceBound;
+    template <typename TList> class SetOfIfcFaceBoundSerializer : public AggrSerializerInstance<TList, IfcFaceBound> {};
+    typedef AggrContainer<IfcTextureMap> SetOfIfcTextureMap;
+    template <typename TList> class SetOfIfcTextureMapSerializer : public AggrSerializerInstance<TList, IfcTextureMap> {};
+    typedef AggrContainer<IfcCurve> SetOfIfcCurve;
+    template <typename TList> class SetOfIfcCurveSerializer : public AggrSerializerInstance<TList, IfcCurve> {};
+    typedef AggrContainer<IfcAppliedValue> ListOfIfcAppliedValue;
+    template <typename TList> class ListOfIfcAppliedValueSerializer : public AggrSerializerInstance<TList, IfcAppliedValue> {};
+    typedef AggrContainer<IfcRelAssociatesApproval> SetOfIfcRelAssociatesApproval;
+    template <typename TList> class SetOfIfcRelAssociatesApprovalSerializer : public AggrSerializerInstance<TList, IfcRelAssociatesApproval> {};
+    typedef AggrContainer<IfcResourceApprovalRelationship> SetOfIfcResourceApprovalRelationship;
+    template <typename TList> class SetOfIfcResourceApprovalRelationshipSerializer : public AggrSerializerInstance<TList, IfcResourceApprovalRelationship> {};
+    typedef AggrContainer<IfcApprovalRelationship> SetOfIfcApprovalRelationship;
+    template <typename TList> class SetOfIfcApprovalRelationshipSerializer : public AggrSerializerInstance<TList, IfcApprovalRelationship> {};
+    typedef AggrContainer<IfcApproval> SetOfIfcApproval;
+    template <typename TList> class SetOfIfcApprovalSerializer : public AggrSerializerInstance<TList, IfcApproval> {};
+    typedef AggrContainer<IfcProfileProperties> SetOfIfcProfileProperties;
+    template <typename TList> class SetOfIfcProfilePropertiesSerializer : public AggrSerializerInstance<TList, IfcProfileProperties> {};
+    typedef AggrContainer<IfcRelAssignsToGroup> SetOfIfcRelAssignsToGroup;
+    template <typename TList> class SetOfIfcRelAssignsToGroupSerializer : public AggrSerializerInstance<TList, IfcRelAssignsToGroup> {};
+    typedef AggrContainer<IfcDirection> ListOfIfcDirection;
+    template <typename TList> class ListOfIfcDirectionSerializer : public AggrSerializerInstance<TList, IfcDirection> {};
+    typedef AggrContainer<StringValue> ListOfIfcIdentifier;
+    template <typename TList> class ListOfIfcIdentifierSerializer : public AggrSerializerText<TList, IfcIdentifier, sdaiSTRING> {};
+    typedef AggrContainer<IfcTextureCoordinate> SetOfIfcTextureCoordinate;
+    template <typename TList> class SetOfIfcTextureCoordinateSerializer : public AggrSerializerInstance<TList, IfcTextureCoordinate> {};
+    typedef AggrContainer<IfcSurfaceStyleWithTextures> SetOfIfcSurfaceStyleWithTextures;
+    template <typename TList> class SetOfIfcSurfaceStyleWithTexturesSerializer : public AggrSerializerInstance<TList, IfcSurfaceStyleWithTextures> {};
+    typedef AggrContainer<IfcCompositeCurveSegment> ListOfIfcCompositeCurveSegment;
+    template <typename TList> class ListOfIfcCompositeCurveSegmentSerializer : public AggrSerializerInstance<TList, IfcCompositeCurveSegment> {};
+    typedef AggrContainer<IfcSurface> SetOfIfcSurface;
+    template <typename TList> class SetOfIfcSurfaceSerializer : public AggrSerializerInstance<TList, IfcSurface> {};
+    typedef AggrContainer<IfcCartesianPoint> ListOfIfcCartesianPoint;
+    template <typename TList> class ListOfIfcCartesianPointSerializer : public AggrSerializerInstance<TList, IfcCartesianPoint> {};
+    typedef AggrContainer<IfcCartesianPoint> ArrayOfIfcCartesianPoint;
+    template <typename TList> class ArrayOfIfcCartesianPointSerializer : public AggrSerializerInstance<TList, IfcCartesianPoint> {};
+    typedef AggrContainer<IfcInteger> ListOfIfcInteger;
+    template <typename TList> class ListOfIfcIntegerSerializer : public AggrSerializerSimple<TList, IfcInteger, sdaiINTEGER> {};
+    typedef AggrContainer<IfcParameterValue> ListOfIfcParameterValue;
+    template <typename TList> class ListOfIfcParameterValueSerializer : public AggrSerializerSimple<TList, IfcParameterValue, sdaiREAL> {};
+    typedef AggrContainer<ListOfIfcCartesianPoint> ListOfListOfIfcCartesianPoint;
+    template <typename TList> class ListOfListOfIfcCartesianPointSerializer : public AggrSerializerAggr<TList, ListOfIfcCartesianPoint, ListOfIfcCartesianPointSerializer<ListOfIfcCartesianPoint>> {};
+    typedef AggrContainer<ArrayOfIfcCartesianPoint> ArrayOfArrayOfIfcCartesianPoint;
+    template <typename TList> class ArrayOfArrayOfIfcCartesianPointSerializer : public AggrSerializerAggr<TList, ArrayOfIfcCartesianPoint, ArrayOfIfcCartesianPointSerializer<ArrayOfIfcCartesianPoint>> {};
+    typedef AggrContainer<IfcRelServicesBuildings> SetOfIfcRelServicesBuildings;
+    template <typename TList> class SetOfIfcRelServicesBuildingsSerializer : public AggrSerializerInstance<TList, IfcRelServicesBuildings> {};
+    typedef AggrContainer<IfcLengthMeasure> ListOfIfcLengthMeasure;
+    template <typename TList> class ListOfIfcLengthMeasureSerializer : public AggrSerializerSimple<TList, IfcLengthMeasure, sdaiREAL> {};
+    typedef AggrContainer<ListOfIfcLengthMeasure> ListOfListOfIfcLengthMeasure;
+    template <typename TList> class ListOfListOfIfcLengthMeasureSerializer : public AggrSerializerAggr<TList, ListOfIfcLengthMeasure, ListOfIfcLengthMeasureSerializer<ListOfIfcLengthMeasure>> {};
+    typedef AggrContainer<IfcRelAssociatesClassification> SetOfIfcRelAssociatesClassification;
+    template <typename TList> class SetOfIfcRelAssociatesClassificationSerializer : public AggrSerializerInstance<TList, IfcRelAssociatesClassification> {};
+    typedef AggrContainer<IfcClassificationReference> SetOfIfcClassificationReference;
+    template <typename TList> class SetOfIfcClassificationReferenceSerializer : public AggrSerializerInstance<TList, IfcClassificationReference> {};
+    typedef AggrContainer<IfcFace> SetOfIfcFace;
+    template <typename TList> class SetOfIfcFaceSerializer : public AggrSerializerInstance<TList, IfcFace> {};
+    typedef AggrContainer<IfcNormalisedRatioMeasure> ListOfIfcNormalisedRatioMeasure;
+    template <typename TList> class ListOfIfcNormalisedRatioMeasureSerializer : public AggrSerializerSimple<TList, IfcNormalisedRatioMeasure, sdaiREAL> {};
+    typedef AggrContainer<ListOfIfcNormalisedRatioMeasure> ListOfListOfIfcNormalisedRatioMeasure;
+    template <typename TList> class ListOfListOfIfcNormalisedRatioMeasureSerializer : public AggrSerializerAggr<TList, ListOfIfcNormalisedRatioMeasure, ListOfIfcNormalisedRatioMeasureSerializer<ListOfIfcNormalisedRatioMeasure>> {};
+    typedef AggrContainer<IfcPropertySet> SetOfIfcPropertySet;
+    template <typename TList> class SetOfIfcPropertySetSerializer : public AggrSerializerInstance<TList, IfcPropertySet> {};
+    typedef AggrContainer<IfcPropertyDependencyRelationship> SetOfIfcPropertyDependencyRelationship;
+    template <typename TList> class SetOfIfcPropertyDependencyRelationshipSerializer : public AggrSerializerInstance<TList, IfcPropertyDependencyRelationship> {};
+    typedef AggrContainer<IfcComplexProperty> SetOfIfcComplexProperty;
+    template <typename TList> class SetOfIfcComplexPropertySerializer : public AggrSerializerInstance<TList, IfcComplexProperty> {};
+    typedef AggrContainer<IfcResourceConstraintRelationship> SetOfIfcResourceConstraintRelationship;
+    template <typename TList> class SetOfIfcResourceConstraintRelationshipSerializer : public AggrSerializerInstance<TList, IfcResourceConstraintRelationship> {};
+    typedef AggrContainer<IfcProperty> SetOfIfcProperty;
+    template <typename TList> class SetOfIfcPropertySerializer : public AggrSerializerInstance<TList, IfcProperty> {};
+    typedef AggrContainer<IfcComplexPropertyTemplate> SetOfIfcComplexPropertyTemplate;
+    template <typename TList> class SetOfIfcComplexPropertyTemplateSerializer : public AggrSerializerInstance<TList, IfcComplexPropertyTemplate> {};
+    typedef AggrContainer<IfcPropertySetTemplate> SetOfIfcPropertySetTemplate;
+    template <typename TList> class SetOfIfcPropertySetTemplateSerializer : public AggrSerializerInstance<TList, IfcPropertySetTemplate> {};
+    typedef AggrContainer<IfcPropertyTemplate> SetOfIfcPropertyTemplate;
+    template <typename TList> class SetOfIfcPropertyTemplateSerializer : public AggrSerializerInstance<TList, IfcPropertyTemplate> {};
+    typedef AggrContainer<IfcCompositeCurve> SetOfIfcCompositeCurve;
+    template <typename TList> class SetOfIfcCompositeCurveSerializer : public AggrSerializerInstance<TList, IfcCompositeCurve> {};
+    typedef AggrContainer<IfcProfileDef> SetOfIfcProfileDef;
+    template <typename TList> class SetOfIfcProfileDefSerializer : public AggrSerializerInstance<TList, IfcProfileDef> {};
+    typedef AggrContainer<IfcRelAssignsToResource> SetOfIfcRelAssignsToResource;
+    template <typename TList> class SetOfIfcRelAssignsToResourceSerializer : public AggrSerializerInstance<TList, IfcRelAssignsToResource> {};
+    typedef AggrContainer<IfcRepresentationContext> SetOfIfcRepresentationContext;
+    template <typename TList> class SetOfIfcRepresentationContextSerializer : public AggrSerializerInstance<TList, IfcRepresentationContext> {};
+    typedef AggrContainer<IfcCoordinateOperation> SetOfIfcCoordinateOperation;
+    template <typename TList> class SetOfIfcCoordinateOperationSerializer : public AggrSerializerInstance<TList, IfcCoordinateOperation> {};
+    typedef AggrContainer<IfcCostValue> ListOfIfcCostValue;
+    template <typename TList> class ListOfIfcCostValueSerializer : public AggrSerializerInstance<TList, IfcCostValue> {};
+    typedef AggrContainer<IfcPhysicalQuantity> ListOfIfcPhysicalQuantity;
+    template <typename TList> class ListOfIfcPhysicalQuantitySerializer : public AggrSerializerInstance<TList, IfcPhysicalQuantity> {};
+    typedef AggrContainer<IfcRelCoversSpaces> SetOfIfcRelCoversSpaces;
+    template <typename TList> class SetOfIfcRelCoversSpacesSerializer : public AggrSerializerInstance<TList, IfcRelCoversSpaces> {};
+    typedef AggrContainer<IfcBoundaryCurve> SetOfIfcBoundaryCurve;
+    template <typename TList> class SetOfIfcBoundaryCurveSerializer : public AggrSerializerInstance<TList, IfcBoundaryCurve> {};
+    typedef AggrContainer<IfcCurveStyleFontPattern> ListOfIfcCurveStyleFontPattern;
+    template <typename TList> class ListOfIfcCurveStyleFontPatternSerializer : public AggrSerializerInstance<TList, IfcCurveStyleFontPattern> {};
+    typedef AggrContainer<IfcDerivedUnitElement> SetOfIfcDerivedUnitElement;
+    template <typename TList> class SetOfIfcDerivedUnitElementSerializer : public AggrSerializerInstance<TList, IfcDerivedUnitElement> {};
+    typedef AggrContainer<IfcReal> ListOfIfcReal;
+    template <typename TList> class ListOfIfcRealSerializer : public AggrSerializerSimple<TList, IfcReal, sdaiREAL> {};
+    typedef AggrContainer<IfcRelConnectsPorts> SetOfIfcRelConnectsPorts;
+    template <typename TList> class SetOfIfcRelConnectsPortsSerializer : public AggrSerializerInstance<TList, IfcRelConnectsPorts> {};
+    typedef AggrContainer<IfcActorSelect> SetOfIfcActorSelect;
+    template <typename TList> class SetOfIfcActorSelectSerializer : public AggrSerializerSelect<TList, IfcActorSelect> {};
+    typedef AggrContainer<IfcRelAssociatesDocument> SetOfIfcRelAssociatesDocument;
+    template <typename TList> class SetOfIfcRelAssociatesDocumentSerializer : public AggrSerializerInstance<TList, IfcRelAssociatesDocument> {};
+    typedef AggrContainer<IfcDocumentReference> SetOfIfcDocumentReference;
+    template <typename TList> class SetOfIfcDocumentReferenceSerializer : public AggrSerializerInstance<TList, IfcDocumentReference> {};
+    typedef AggrContainer<IfcDocumentInformationRelationship> SetOfIfcDocumentInformationRelationship;
+    template <typename TList> class SetOfIfcDocumentInformationRelationshipSerializer : public AggrSerializerInstance<TList, IfcDocumentInformationRelationship> {};
+    typedef AggrContainer<IfcDocumentInformation> SetOfIfcDocumentInformation;
+    template <typename TList> class SetOfIfcDocumentInformationSerializer : public AggrSerializerInstance<TList, IfcDocumentInformation> {};
+    typedef AggrContainer<IfcTypeObject> SetOfIfcTypeObject;
+    template <typename TList> class SetOfIfcTypeObjectSerializer : public AggrSerializerInstance<TList, IfcTypeObject> {};
+    typedef AggrContainer<IfcRelDefinesByTemplate> SetOfIfcRelDefinesByTemplate;
+    template <typename TList> class SetOfIfcRelDefinesByTemplateSerializer : public AggrSerializerInstance<TList, IfcRelDefinesByTemplate> {};
+    typedef AggrContainer<IfcOrientedEdge> ListOfIfcOrientedEdge;
+    template <typename TList> class ListOfIfcOrientedEdgeSerializer : public AggrSerializerInstance<TList, IfcOrientedEdge> {};
+    typedef AggrContainer<IfcPhysicalQuantity> SetOfIfcPhysicalQuantity;
+    template <typename TList> class SetOfIfcPhysicalQuantitySerializer : public AggrSerializerInstance<TList, IfcPhysicalQuantity> {};
+    typedef AggrContainer<IfcRelSequence> SetOfIfcRelSequence;
+    template <typename TList> class SetOfIfcRelSequenceSerializer : public AggrSerializerInstance<TList, IfcRelSequence> {};
+    typedef AggrContainer<IfcRelAssignsToProcess> SetOfIfcRelAssignsToProcess;
+    template <typename TList> class SetOfIfcRelAssignsToProcessSerializer : public AggrSerializerInstance<TList, IfcRelAssignsToProcess> {};
+    typedef AggrContainer<IfcResourceObjectSelect> SetOfIfcResourceObjectSelect;
+    template <typename TList> class SetOfIfcResourceObjectSelectSerializer : public AggrSerializerSelect<TList, IfcResourceObjectSelect> {};
+    typedef AggrContainer<IfcConnectedFaceSet> SetOfIfcConnectedFaceSet;
+    template <typename TList> class SetOfIfcConnectedFaceSetSerializer : public AggrSerializerInstance<TList, IfcConnectedFaceSet> {};
+    typedef AggrContainer<IfcFillStyleSelect> SetOfIfcFillStyleSelect;
+    template <typename TList> class SetOfIfcFillStyleSelectSerializer : public AggrSerializerSelect<TList, IfcFillStyleSelect> {};
+    typedef AggrContainer<IfcVector> ListOfIfcVector;
+    template <typename TList> class ListOfIfcVectorSerializer : public AggrSerializerInstance<TList, IfcVector> {};
+    typedef AggrContainer<IfcGeometricSetSelect> SetOfIfcGeometricSetSelect;
+    template <typename TList> class SetOfIfcGeometricSetSelectSerializer : public AggrSerializerSelect<TList, IfcGeometricSetSelect> {};
+    typedef AggrContainer<IfcRepresentation> SetOfIfcRepresentation;
+    template <typename TList> class SetOfIfcRepresentationSerializer : public AggrSerializerInstance<TList, IfcRepresentation> {};
+    typedef AggrContainer<IfcGeometricRepresentationSubContext> SetOfIfcGeometricRepresentationSubContext;
+    template <typename TList> class SetOfIfcGeometricRepresentationSubContextSerializer : public AggrSerializerInstance<TList, IfcGeometricRepresentationSubContext> {};
+    typedef AggrContainer<IfcGridAxis> ListOfIfcGridAxis;
+    template <typename TList> class ListOfIfcGridAxisSerializer : public AggrSerializerInstance<TList, IfcGridAxis> {};
+    typedef AggrContainer<IfcGrid> SetOfIfcGrid;
+    template <typename TList> class SetOfIfcGridSerializer : public AggrSerializerInstance<TList, IfcGrid> {};
+    typedef AggrContainer<IfcVirtualGridIntersection> SetOfIfcVirtualGridIntersection;
+    template <typename TList> class SetOfIfcVirtualGridIntersectionSerializer : public AggrSerializerInstance<TList, IfcVirtualGridIntersection> {};
+    typedef AggrContainer<IfcProduct> SetOfIfcProduct;
+    template <typename TList> class SetOfIfcProductSerializer : public AggrSerializerInstance<TList, IfcProduct> {};
+    typedef AggrContainer<IfcLocalPlacement> SetOfIfcLocalPlacement;
+    template <typename TList> class SetOfIfcLocalPlacementSerializer : public AggrSerializerInstance<TList, IfcLocalPlacement> {};
+    typedef AggrContainer<IfcPositiveInteger> ListOfIfcPositiveInteger;
+    template <typename TList> class ListOfIfcPositiveIntegerSerializer : public AggrSerializerSimple<TList, IfcPositiveInteger, sdaiINTEGER> {};
+    typedef AggrContainer<IfcSegmentIndexSelect> ListOfIfcSegmentIndexSelect;
+    template <typename TList> class ListOfIfcSegmentIndexSelectSerializer : public AggrSerializerSelect<TList, IfcSegmentIndexSelect> {};
+    typedef AggrContainer<IfcPolygonalFaceSet> SetOfIfcPolygonalFaceSet;
+    template <typename TList> class SetOfIfcPolygonalFaceSetSerializer : public AggrSerializerInstance<TList, IfcPolygonalFaceSet> {};
+    typedef AggrContainer<ListOfIfcPositiveInteger> ListOfListOfIfcPositiveInteger;
+    template <typename TList> class ListOfListOfIfcPositiveIntegerSerializer : public AggrSerializerAggr<TList, ListOfIfcPositiveInteger, ListOfIfcPositiveIntegerSerializer<ListOfIfcPositiveInteger>> {};
+    typedef AggrContainer<IfcSurfaceTexture> ListOfIfcSurfaceTexture;
+    template <typename TList> class ListOfIfcSurfaceTextureSerializer : public AggrSerializerInstance<TList, IfcSurfaceTexture> {};
+    typedef AggrContainer<IfcPcurve> ListOfIfcPcurve;
+    template <typename TList> class ListOfIfcPcurveSerializer : public AggrSerializerInstance<TList, IfcPcurve> {};
+    typedef AggrContainer<IfcIrregularTimeSeriesValue> ListOfIfcIrregularTimeSeriesValue;
+    template <typename TList> class ListOfIfcIrregularTimeSeriesValueSerializer : public AggrSerializerInstance<TList, IfcIrregularTimeSeriesValue> {};
+    typedef AggrContainer<IfcValue> ListOfIfcValue;
+    template <typename TList> class ListOfIfcValueSerializer : public AggrSerializerSelect<TList, IfcValue> {};
+    typedef AggrContainer<IfcRelAssociatesLibrary> SetOfIfcRelAssociatesLibrary;
+    template <typename TList> class SetOfIfcRelAssociatesLibrarySerializer : public AggrSerializerInstance<TList, IfcRelAssociatesLibrary> {};
+    typedef AggrContainer<IfcLibraryReference> SetOfIfcLibraryReference;
+    template <typename TList> class SetOfIfcLibraryReferenceSerializer : public AggrSerializerInstance<TList, IfcLibraryReference> {};
+    typedef AggrContainer<IfcPlaneAngleMeasure> ListOfIfcPlaneAngleMeasure;
+    template <typename TList> class ListOfIfcPlaneAngleMeasureSerializer : public AggrSerializerSimple<TList, IfcPlaneAngleMeasure, sdaiREAL> {};
+    typedef AggrContainer<IfcLuminousIntensityDistributionMeasure> ListOfIfcLuminousIntensityDistributionMeasure;
+    template <typename TList> class ListOfIfcLuminousIntensityDistributionMeasureSerializer : public AggrSerializerSimple<TList, IfcLuminousIntensityDistributionMeasure, sdaiREAL> {};
+    typedef AggrContainer<IfcLightDistributionData> ListOfIfcLightDistributionData;
+    template <typename TList> class ListOfIfcLightDistributionDataSerializer : public AggrSerializerInstance<TList, IfcLightDistributionData> {};
+    typedef AggrContainer<IfcRelAssociatesMaterial> SetOfIfcRelAssociatesMaterial;
+    template <typename TList> class SetOfIfcRelAssociatesMaterialSerializer : public AggrSerializerInstance<TList, IfcRelAssociatesMaterial> {};
+    typedef AggrContainer<IfcMaterialProperties> SetOfIfcMaterialProperties;
+    template <typename TList> class SetOfIfcMaterialPropertiesSerializer : public AggrSerializerInstance<TList, IfcMaterialProperties> {};
+    typedef AggrContainer<IfcMaterialDefinitionRepresentation> SetOfIfcMaterialDefinitionRepresentation;
+    template <typename TList> class SetOfIfcMaterialDefinitionRepresentationSerializer : public AggrSerializerInstance<TList, IfcMaterialDefinitionRepresentation> {};
+    typedef AggrContainer<IfcMaterialRelationship> SetOfIfcMaterialRelationship;
+    template <typename TList> class SetOfIfcMaterialRelationshipSerializer : public AggrSerializerInstance<TList, IfcMaterialRelationship> {};
+    typedef AggrContainer<IfcClassificationSelect> SetOfIfcClassificationSelect;
+    template <typename TList> class SetOfIfcClassificationSelectSerializer : public AggrSerializerSelect<TList, IfcClassificationSelect> {};
+    typedef AggrContainer<IfcMaterialConstituent> SetOfIfcMaterialConstituent;
+    template <typename TList> class SetOfIfcMaterialConstituentSerializer : public AggrSerializerInstance<TList, IfcMaterialConstituent> {};
+    typedef AggrContainer<IfcRepresentation> ListOfIfcRepresentation;
+    template <typename TList> class ListOfIfcRepresentationSerializer : public AggrSerializerInstance<TList, IfcRepresentation> {};
+    typedef AggrContainer<IfcMaterialLayer> ListOfIfcMaterialLayer;
+    template <typename TList> class ListOfIfcMaterialLayerSerializer : public AggrSerializerInstance<TList, IfcMaterialLayer> {};
+    typedef AggrContainer<IfcLengthMeasure> ArrayOfIfcLengthMeasure;
+    template <typename TList> class ArrayOfIfcLengthMeasureSerializer : public AggrSerializerSimple<TList, IfcLengthMeasure, sdaiREAL> {};
+    typedef AggrContainer<IfcMaterial> ListOfIfcMaterial;
+    template <typename TList> class ListOfIfcMaterialSerializer : public AggrSerializerInstance<TList, IfcMaterial> {};
+    typedef AggrContainer<IfcMaterialProfile> ListOfIfcMaterialProfile;
+    template <typename TList> class ListOfIfcMaterialProfileSerializer : public AggrSerializerInstance<TList, IfcMaterialProfile> {};
+    typedef AggrContainer<IfcMaterial> SetOfIfcMaterial;
+    template <typename TList> class SetOfIfcMaterialSerializer : public AggrSerializerInstance<TList, IfcMaterial> {};
+    typedef AggrContainer<IfcConstraint> ListOfIfcConstraint;
+    template <typename TList> class ListOfIfcConstraintSerializer : public AggrSerializerInstance<TList, IfcConstraint> {};
+    typedef AggrContainer<IfcActorRole> ListOfIfcActorRole;
+    template <typename TList> class ListOfIfcActorRoleSerializer : public AggrSerializerInstance<TList, IfcActorRole> {};
+    typedef AggrContainer<IfcAddress> ListOfIfcAddress;
+    template <typename TList> class ListOfIfcAddressSerializer : public AggrSerializerInstance<TList, IfcAddress> {};
+    typedef AggrContainer<IfcOrganizationRelationship> SetOfIfcOrganizationRelationship;
+    template <typename TList> class SetOfIfcOrganizationRelationshipSerializer : public AggrSerializerInstance<TList, IfcOrganizationRelationship> {};
+    typedef AggrContainer<IfcPersonAndOrganization> SetOfIfcPersonAndOrganization;
+    template <typename TList> class SetOfIfcPersonAndOrganizationSerializer : public AggrSerializerInstance<TList, IfcPersonAndOrganization> {};
+    typedef AggrContainer<StringValue> ListOfIfcLabel;
+    template <typename TList> class ListOfIfcLabelSerializer : public AggrSerializerText<TList, IfcLabel, sdaiSTRING> {};
+    typedef AggrContainer<IfcPhysicalComplexQuantity> SetOfIfcPhysicalComplexQuantity;
+    template <typename TList> class SetOfIfcPhysicalComplexQuantitySerializer : public AggrSerializerInstance<TList, IfcPhysicalComplexQuantity> {};
+    typedef AggrContainer<StringValue> ListOfIfcBinary;
+    template <typename TList> class ListOfIfcBinarySerializer : public AggrSerializerText<TList, IfcBinary, sdaiBINARY> {};
+    typedef AggrContainer<IfcIndexedColourMap> SetOfIfcIndexedColourMap;
+    template <typename TList> class SetOfIfcIndexedColourMapSerializer : public AggrSerializerInstance<TList, IfcIndexedColourMap> {};
+    typedef AggrContainer<IfcIndexedTextureMap> SetOfIfcIndexedTextureMap;
+    template <typename TList> class SetOfIfcIndexedTextureMapSerializer : public AggrSerializerInstance<TList, IfcIndexedTextureMap> {};
+    typedef AggrContainer<IfcIndexedPolygonalFace> ListOfIfcIndexedPolygonalFace;
+    template <typename TList> class ListOfIfcIndexedPolygonalFaceSerializer : public AggrSerializerInstance<TList, IfcIndexedPolygonalFace> {};
+    typedef AggrContainer<IfcLayeredItem> SetOfIfcLayeredItem;
+    template <typename TList> class SetOfIfcLayeredItemSerializer : public AggrSerializerSelect<TList, IfcLayeredItem> {};
+    typedef AggrContainer<IfcPresentationStyle> SetOfIfcPresentationStyle;
+    template <typename TList> class SetOfIfcPresentationStyleSerializer : public AggrSerializerInstance<TList, IfcPresentationStyle> {};
+    typedef AggrContainer<IfcPresentationStyleSelect> SetOfIfcPresentationStyleSelect;
+    template <typename TList> class SetOfIfcPresentationStyleSelectSerializer : public AggrSerializerSelect<TList, IfcPresentationStyleSelect> {};
+    typedef AggrContainer<IfcShapeAspect> SetOfIfcShapeAspect;
+    template <typename TList> class SetOfIfcShapeAspectSerializer : public AggrSerializerInstance<TList, IfcShapeAspect> {};
+    typedef AggrContainer<IfcReal> ArrayOfIfcReal;
+    template <typename TList> class ArrayOfIfcRealSerializer : public AggrSerializerSimple<TList, IfcReal, sdaiREAL> {};
+    typedef AggrContainer<ListOfIfcReal> ListOfListOfIfcReal;
+    template <typename TList> class ListOfListOfIfcRealSerializer : public AggrSerializerAggr<TList, ListOfIfcReal, ListOfIfcRealSerializer<ListOfIfcReal>> {};
+    typedef AggrContainer<ArrayOfIfcReal> ArrayOfArrayOfIfcReal;
+    template <typename TList> class ArrayOfArrayOfIfcRealSerializer : public AggrSerializerAggr<TList, ArrayOfIfcReal, ArrayOfIfcRealSerializer<ArrayOfIfcReal>> {};
+    typedef AggrContainer<IfcDayInMonthNumber> SetOfIfcDayInMonthNumber;
+    template <typename TList> class SetOfIfcDayInMonthNumberSerializer : public AggrSerializerSimple<TList, IfcDayInMonthNumber, sdaiINTEGER> {};
+    typedef AggrContainer<IfcDayInWeekNumber> SetOfIfcDayInWeekNumber;
+    template <typename TList> class SetOfIfcDayInWeekNumberSerializer : public AggrSerializerSimple<TList, IfcDayInWeekNumber, sdaiINTEGER> {};
+    typedef AggrContainer<IfcMonthInYearNumber> SetOfIfcMonthInYearNumber;
+    template <typename TList> class SetOfIfcMonthInYearNumberSerializer : public AggrSerializerSimple<TList, IfcMonthInYearNumber, sdaiINTEGER> {};
+    typedef AggrContainer<IfcTimePeriod> ListOfIfcTimePeriod;
+    template <typename TList> class ListOfIfcTimePeriodSerializer : public AggrSerializerInstance<TList, IfcTimePeriod> {};
+    typedef AggrContainer<IfcTimeSeriesValue> ListOfIfcTimeSeriesValue;
+    template <typename TList> class ListOfIfcTimeSeriesValueSerializer : public AggrSerializerInstance<TList, IfcTimeSeriesValue> {};
+    typedef AggrContainer<IfcSectionReinforcementProperties> ListOfIfcSectionReinforcementProperties;
+    template <typename TList> class ListOfIfcSectionReinforcementPropertiesSerializer : public AggrSerializerInstance<TList, IfcSectionReinforcementProperties> {};
+    typedef AggrContainer<IfcBendingParameterSelect> ListOfIfcBendingParameterSelect;
+    template <typename TList> class ListOfIfcBendingParameterSelectSerializer : public AggrSerializerSelect<TList, IfcBendingParameterSelect> {};
+    typedef AggrContainer<IfcObjectDefinition> SetOfIfcObjectDefinition;
+    template <typename TList> class SetOfIfcObjectDefinitionSerializer : public AggrSerializerInstance<TList, IfcObjectDefinition> {};
+    typedef AggrContainer<IfcDefinitionSelect> SetOfIfcDefinitionSelect;
+    template <typename TList> class SetOfIfcDefinitionSelectSerializer : public AggrSerializerSelect<TList, IfcDefinitionSelect> {};
+    typedef AggrContainer<IfcElement> SetOfIfcElement;
+    template <typename TList> class SetOfIfcElementSerializer : public AggrSerializerInstance<TList, IfcElement> {};
+    typedef AggrContainer<IfcCovering> SetOfIfcCovering;
+    template <typename TList> class SetOfIfcCoveringSerializer : public AggrSerializerInstance<TList, IfcCovering> {};
+    typedef AggrContainer<IfcObject> SetOfIfcObject;
+    template <typename TList> class SetOfIfcObjectSerializer : public AggrSerializerInstance<TList, IfcObject> {};
+    typedef AggrContainer<IfcDistributionControlElement> SetOfIfcDistributionControlElement;
+    template <typename TList> class SetOfIfcDistributionControlElementSerializer : public AggrSerializerInstance<TList, IfcDistributionControlElement> {};
+    typedef AggrContainer<IfcObjectDefinition> ListOfIfcObjectDefinition;
+    template <typename TList> class ListOfIfcObjectDefinitionSerializer : public AggrSerializerInstance<TList, IfcObjectDefinition> {};
+    typedef AggrContainer<IfcSpatialElement> SetOfIfcSpatialElement;
+    template <typename TList> class SetOfIfcSpatialElementSerializer : public AggrSerializerInstance<TList, IfcSpatialElement> {};
+    typedef AggrContainer<IfcRelSpaceBoundary1stLevel> SetOfIfcRelSpaceBoundary1stLevel;
+    template <typename TList> class SetOfIfcRelSpaceBoundary1stLevelSerializer : public AggrSerializerInstance<TList, IfcRelSpaceBoundary1stLevel> {};
+    typedef AggrContainer<IfcRelSpaceBoundary2ndLevel> SetOfIfcRelSpaceBoundary2ndLevel;
+    template <typename TList> class SetOfIfcRelSpaceBoundary2ndLevelSerializer : public AggrSerializerInstance<TList, IfcRelSpaceBoundary2ndLevel> {};
+    typedef AggrContainer<IfcRepresentationItem> SetOfIfcRepresentationItem;
+    template <typename TList> class SetOfIfcRepresentationItemSerializer : public AggrSerializerInstance<TList, IfcRepresentationItem> {};
+    typedef AggrContainer<IfcRepresentationMap> SetOfIfcRepresentationMap;
+    template <typename TList> class SetOfIfcRepresentationMapSerializer : public AggrSerializerInstance<TList, IfcRepresentationMap> {};
+    typedef AggrContainer<IfcProductRepresentation> SetOfIfcProductRepresentation;
+    template <typename TList> class SetOfIfcProductRepresentationSerializer : public AggrSerializerInstance<TList, IfcProductRepresentation> {};
+    typedef AggrContainer<IfcMappedItem> SetOfIfcMappedItem;
+    template <typename TList> class SetOfIfcMappedItemSerializer : public AggrSerializerInstance<TList, IfcMappedItem> {};
+    typedef AggrContainer<IfcProfileDef> ListOfIfcProfileDef;
+    template <typename TList> class ListOfIfcProfileDefSerializer : public AggrSerializerInstance<TList, IfcProfileDef> {};
+    typedef AggrContainer<IfcAxis2Placement3D> ListOfIfcAxis2Placement3D;
+    template <typename TList> class ListOfIfcAxis2Placement3DSerializer : public AggrSerializerInstance<TList, IfcAxis2Placement3D> {};
+    typedef AggrContainer<IfcReinforcementBarProperties> SetOfIfcReinforcementBarProperties;
+    template <typename TList> class SetOfIfcReinforcementBarPropertiesSerializer : public AggrSerializerInstance<TList, IfcReinforcementBarProperties> {};
+    typedef AggrContainer<IfcShapeModel> ListOfIfcShapeModel;
+    template <typename TList> class ListOfIfcShapeModelSerializer : public AggrSerializerInstance<TList, IfcShapeModel> {};
+    typedef AggrContainer<IfcShell> SetOfIfcShell;
+    template <typename TList> class SetOfIfcShellSerializer : public AggrSerializerSelect<TList, IfcShell> {};
+    typedef AggrContainer<IfcRelConnectsStructuralActivity> SetOfIfcRelConnectsStructuralActivity;
+    template <typename TList> class SetOfIfcRelConnectsStructuralActivitySerializer : public AggrSerializerInstance<TList, IfcRelConnectsStructuralActivity> {};
+    typedef AggrContainer<IfcStructuralLoadGroup> SetOfIfcStructuralLoadGroup;
+    template <typename TList> class SetOfIfcStructuralLoadGroupSerializer : public AggrSerializerInstance<TList, IfcStructuralLoadGroup> {};
+    typedef AggrContainer<IfcStructuralResultGroup> SetOfIfcStructuralResultGroup;
+    template <typename TList> class SetOfIfcStructuralResultGroupSerializer : public AggrSerializerInstance<TList, IfcStructuralResultGroup> {};
+    typedef AggrContainer<IfcRelConnectsStructuralMember> SetOfIfcRelConnectsStructuralMember;
+    template <typename TList> class SetOfIfcRelConnectsStructuralMemberSerializer : public AggrSerializerInstance<TList, IfcRelConnectsStructuralMember> {};
+    typedef AggrContainer<IfcStructuralAnalysisModel> SetOfIfcStructuralAnalysisModel;
+    template <typename TList> class SetOfIfcStructuralAnalysisModelSerializer : public AggrSerializerInstance<TList, IfcStructuralAnalysisModel> {};
+    typedef AggrContainer<IfcRatioMeasure> ListOfIfcRatioMeasure;
+    template <typename TList> class ListOfIfcRatioMeasureSerializer : public AggrSerializerSimple<TList, IfcRatioMeasure, sdaiREAL> {};
+    typedef AggrContainer<IfcStructuralLoadOrResult> ListOfIfcStructuralLoadOrResult;
+    template <typename TList> class ListOfIfcStructuralLoadOrResultSerializer : public AggrSerializerInstance<TList, IfcStructuralLoadOrResult> {};
+    typedef AggrContainer<IfcStyleAssignmentSelect> SetOfIfcStyleAssignmentSelect;
+    template <typename TList> class SetOfIfcStyleAssignmentSelectSerializer : public AggrSerializerSelect<TList, IfcStyleAssignmentSelect> {};
+    typedef AggrContainer<IfcSurfaceStyleElementSelect> SetOfIfcSurfaceStyleElementSelect;
+    template <typename TList> class SetOfIfcSurfaceStyleElementSelectSerializer : public AggrSerializerSelect<TList, IfcSurfaceStyleElementSelect> {};
+    typedef AggrContainer<IfcTableRow> ListOfIfcTableRow;
+    template <typename TList> class ListOfIfcTableRowSerializer : public AggrSerializerInstance<TList, IfcTableRow> {};
+    typedef AggrContainer<IfcTableColumn> ListOfIfcTableColumn;
+    template <typename TList> class ListOfIfcTableColumnSerializer : public AggrSerializerInstance<TList, IfcTableColumn> {};
+    typedef AggrContainer<StringValue> ListOfIfcURIReference;
+    template <typename TList> class ListOfIfcURIReferenceSerializer : public AggrSerializerText<TList, IfcURIReference, sdaiSTRING> {};
+    typedef AggrContainer<StringValue> ListOfIfcTextFontName;
+    template <typename TList> class ListOfIfcTextFontNameSerializer : public AggrSerializerText<TList, IfcTextFontName, sdaiSTRING> {};
+    typedef AggrContainer<IfcTextureVertex> ListOfIfcTextureVertex;
+    template <typename TList> class ListOfIfcTextureVertexSerializer : public AggrSerializerInstance<TList, IfcTextureVertex> {};
+    typedef AggrContainer<ListOfIfcParameterValue> ListOfListOfIfcParameterValue;
+    template <typename TList> class ListOfListOfIfcParameterValueSerializer : public AggrSerializerAggr<TList, ListOfIfcParameterValue, ListOfIfcParameterValueSerializer<ListOfIfcParameterValue>> {};
+    typedef AggrContainer<IfcTrimmingSelect> SetOfIfcTrimmingSelect;
+    template <typename TList> class SetOfIfcTrimmingSelectSerializer : public AggrSerializerSelect<TList, IfcTrimmingSelect> {};
+    typedef AggrContainer<IfcUnit> SetOfIfcUnit;
+    template <typename TList> class SetOfIfcUnitSerializer : public AggrSerializerSelect<TList, IfcUnit> {};
+    typedef AggrContainer<IfcWorkTime> SetOfIfcWorkTime;
+    template <typename TList> class SetOfIfcWorkTimeSerializer : public AggrSerializerInstance<TList, IfcWorkTime> {};
+
+        //
+        // Entities
+        // 
+
+
+    //
+    // Entities of the schema, indexed by entity ordinal
+    //
+    static constexpr EntityDefinition SchemaEntities_[] = {
+        {"IfcActionRequest", 0},
+        {"IfcActor", 2},
+        {"IfcActorRole", 4},
+        {"IfcActuator", 5},
+        {"IfcActuatorType", 7},
+        {"IfcAddress", 9},
+        {"IfcAdvancedBrep", 10},
+        {"IfcAdvancedBrepWithVoids", 12},
+        {"IfcAdvancedFace", 14},
+        {"IfcAirTerminal", 16},
+        {"IfcAirTerminalBox", 18},
+        {"IfcAirTerminalBoxType", 20},
+        {"IfcAirTerminalType", 22},
+        {"IfcAirToAirHeatRecovery", 24},
+        {"IfcAirToAirHeatRecoveryType", 26},
+        {"IfcAlarm", 28},
+        {"IfcAlarmType", 30},
+        {"IfcAnnotation", 32},
+        {"IfcAnnotationFillArea", 34},
+        {"IfcApplication", 36},
+        {"IfcAppliedValue", 37},
+        {"IfcApproval", 38},
+        {"IfcApprovalRelationship", 39},
+        {"IfcArbitraryClosedProfileDef", 41},
+        {"IfcArbitraryOpenProfileDef", 43},
+        {"IfcArbitraryProfileDefWithVoids", 45},
+        {"IfcAsset", 47},
+        {"IfcAsymmetricIShapeProfileDef", 49},
+        {"IfcAudioVisualAppliance", 51},
+        {"IfcAudioVisualApplianceType", 53},
+        {"IfcAxis1Placement", 55},
+        {"IfcAxis2Placement2D", 57},
+        {"IfcAxis2Placement3D", 59},
+        {"IfcBeam", 61},
+        {"IfcBeamStandardCase", 63},
+        {"IfcBeamType", 65},
+        {"IfcBlobTexture", 67},
+        {"IfcBlock", 69},
+        {"IfcBoiler", 71},
+        {"IfcBoilerType", 73},
+        {"IfcBooleanClippingResult", 75},
+        {"IfcBooleanResult", 77},
+        {"IfcBoundaryCondition", 79},
+        {"IfcBoundaryCurve", 80},
+        {"IfcBoundaryEdgeCondition", 82},
+        {"IfcBoundaryFaceCondition", 84},
+        {"IfcBoundaryNodeCondition", 86},
+        {"IfcBoundaryNodeConditionWarping", 88},
+        {"IfcBoundedCurve", 90},
+        {"IfcBoundedSurface", 92},
+        {"IfcBoundingBox", 94},
+        {"IfcBoxedHalfSpace", 96},
+        {"IfcBSplineCurve", 98},
+        {"IfcBSplineCurveWithKnots", 100},
+        {"IfcBSplineSurface", 102},
+        {"IfcBSplineSurfaceWithKnots", 104},
+        {"IfcBuilding", 106},
+        {"IfcBuildingElement", 108},
+        {"IfcBuildingElementPart", 110},
+        {"IfcBuildingElementPartType", 112},
+        {"IfcBuildingElementProxy", 114},
+        {"IfcBuildingElementProxyType", 116},
+        {"IfcBuildingElementType", 118},
+        {"IfcBuildingStorey", 120},
+        {"IfcBuildingSystem", 122},
+        {"IfcBurner", 124},
+        {"IfcBurnerType", 126},
+        {"IfcCableCarrierFitting", 128},
+        {"IfcCableCarrierFittingType", 130},
+        {"IfcCableCarrierSegment", 132},
+        {"IfcCableCarrierSegmentType", 134},
+        {"IfcCableFitting", 136},
+        {"IfcCableFittingType", 138},
+        {"IfcCableSegment", 140},
+        {"IfcCableSegmentType", 142},
+        {"IfcCartesianPoint", 144},
+        {"IfcCartesianPointList", 146},
+        {"IfcCartesianPointList2D", 148},
+        {"IfcCartesianPointList3D", 150},
+        {"IfcCartesianTransformationOperator", 152},
+        {"IfcCartesianTransformationOperator2D", 154},
+        {"IfcCartesianTransformationOperator2DnonUniform", 156},
+        {"IfcCartesianTransformationOperator3D", 158},
+        {"IfcCartesianTransformationOperator3DnonUniform", 160},
+        {"IfcCenterLineProfileDef", 162},
+        {"IfcChiller", 164},
+        {"IfcChillerType", 166},
+        {"IfcChimney", 168},
+        {"IfcChimneyType", 170},
+        {"IfcCircle", 172},
+        {"IfcCircleHollowProfileDef", 174},
+        {"IfcCircleProfileDef", 176},
+        {"IfcCivilElement", 178},
+        {"IfcCivilElementType", 180},
+        {"IfcClassification", 182},
+        {"IfcClassificationReference", 184},
+        {"IfcClosedShell", 186},
+        {"IfcCoil", 188},
+        {"IfcCoilType", 190},
+        {"IfcColourRgb", 192},
+        {"IfcColourRgbList", 194},
+        {"IfcColourSpecification", 196},
+        {"IfcColumn", 198},
+        {"IfcColumnStandardCase", 200},
+        {"IfcColumnType", 202},
+        {"IfcCommunicationsAppliance", 204},
+        {"IfcCommunicationsApplianceType", 206},
+        {"IfcComplexProperty", 208},
+        {"IfcComplexPropertyTemplate", 210},
+        {"IfcCompositeCurve", 212},
+        {"IfcCompositeCurveOnSurface", 214},
+        {"IfcCompositeCurveSegment", 216},
+        {"IfcCompositeProfileDef", 218},
+        {"IfcCompressor", 220},
+        {"IfcCompressorType", 222},
+        {"IfcCondenser", 224},
+        {"IfcCondenserType", 226},
+        {"IfcConic", 228},
+        {"IfcConnectedFaceSet", 230},
+        {"IfcConnectionCurveGeometry", 232},
+        {"IfcConnectionGeometry", 234},
+        {"IfcConnectionPointEccentricity", 235},
+        {"IfcConnectionPointGeometry", 237},
+        {"IfcConnectionSurfaceGeometry", 239},
+        {"IfcConnectionVolumeGeometry", 241},
+        {"IfcConstraint", 243},
+        {"IfcConstructionEquipmentResource", 244},
+        {"IfcConstructionEquipmentResourceType", 246},
+        {"IfcConstructionMaterialResource", 248},
+        {"IfcConstructionMaterialResourceType", 250},
+        {"IfcConstructionProductResource", 252},
+        {"IfcConstructionProductResourceType", 254},
+        {"IfcConstructionResource", 256},
+        {"IfcConstructionResourceType", 258},
+        {"IfcContext", 260},
+        {"IfcContextDependentUnit", 262},
+        {"IfcControl", 264},
+        {"IfcController", 266},
+        {"IfcControllerType", 268},
+        {"IfcConversionBasedUnit", 270},
+        {"IfcConversionBasedUnitWithOffset", 272},
+        {"IfcCooledBeam", 274},
+        {"IfcCooledBeamType", 276},
+        {"IfcCoolingTower", 278},
+        {"IfcCoolingTowerType", 280},
+        {"IfcCoordinateOperation", 282},
+        {"IfcCoordinateReferenceSystem", 283},
+        {"IfcCostItem", 284},
+        {"IfcCostSchedule", 286},
+        {"IfcCostValue", 288},
+        {"IfcCovering", 290},
+        {"IfcCoveringType", 292},
+        {"IfcCrewResource", 294},
+        {"IfcCrewResourceType", 296},
+        {"IfcCsgPrimitive3D", 298},
+        {"IfcCsgSolid", 300},
+        {"IfcCShapeProfileDef", 302},
+        {"IfcCurrencyRelationship", 304},
+        {"IfcCurtainWall", 306},
+        {"IfcCurtainWallType", 308},
+        {"IfcCurve", 310},
+        {"IfcCurveBoundedPlane", 312},
+        {"IfcCurveBoundedSurface", 314},
+        {"IfcCurveStyle", 316},
+        {"IfcCurveStyleFont", 318},
+        {"IfcCurveStyleFontAndScaling", 320},
+        {"IfcCurveStyleFontPattern", 322},
+        {"IfcCylindricalSurface", 324},
+        {"IfcDamper", 326},
+        {"IfcDamperType", 328},
+        {"IfcDerivedProfileDef", 330},
+        {"IfcDerivedUnit", 332},
+        {"IfcDerivedUnitElement", 333},
+        {"IfcDimensionalExponents", 334},
+        {"IfcDirection", 335},
+        {"IfcDiscreteAccessory", 337},
+        {"IfcDiscreteAccessoryType", 339},
+        {"IfcDistributionChamberElement", 341},
+        {"IfcDistributionChamberElementType", 343},
+        {"IfcDistributionCircuit", 345},
+        {"IfcDistributionControlElement", 347},
+        {"IfcDistributionControlElementType", 349},
+        {"IfcDistributionElement", 351},
+        {"IfcDistributionElementType", 353},
+        {"IfcDistributionFlowElement", 355},
+        {"IfcDistributionFlowElementType", 357},
+        {"IfcDistributionPort", 359},
+        {"IfcDistributionSystem", 361},
+        {"IfcDocumentInformation", 363},
+        {"IfcDocumentInformationRelationship", 365},
+        {"IfcDocumentReference", 367},
+        {"IfcDoor", 369},
+        {"IfcDoorLiningProperties", 371},
+        {"IfcDoorPanelProperties", 373},
+        {"IfcDoorStandardCase", 375},
+        {"IfcDoorStyle", 377},
+        {"IfcDoorType", 379},
+        {"IfcDraughtingPreDefinedColour", 381},
+        {"IfcDraughtingPreDefinedCurveFont", 383},
+        {"IfcDuctFitting", 385},
+        {"IfcDuctFittingType", 387},
+        {"IfcDuctSegment", 389},
+        {"IfcDuctSegmentType", 391},
+        {"IfcDuctSilencer", 393},
+        {"IfcDuctSilencerType", 395},
+        {"IfcEdge", 397},
+        {"IfcEdgeCurve", 399},
+        {"IfcEdgeLoop", 401},
+        {"IfcElectricAppliance", 403},
+        {"IfcElectricApplianceType", 405},
+        {"IfcElectricDistributionBoard", 407},
+        {"IfcElectricDistributionBoardType", 409},
+        {"IfcElectricFlowStorageDevice", 411},
+        {"IfcElectricFlowStorageDeviceType", 413},
+        {"IfcElectricGenerator", 415},
+        {"IfcElectricGeneratorType", 417},
+        {"IfcElectricMotor", 419},
+        {"IfcElectricMotorType", 421},
+        {"IfcElectricTimeControl", 423},
+        {"IfcElectricTimeControlType", 425},
+        {"IfcElement", 427},
+        {"IfcElementarySurface", 429},
+        {"IfcElementAssembly", 431},
+        {"IfcElementAssemblyType", 433},
+        {"IfcElementComponent", 435},
+        {"IfcElementComponentType", 437},
+        {"IfcElementQuantity", 439},
+        {"IfcElementType", 441},
+        {"IfcEllipse", 443},
+        {"IfcEllipseProfileDef", 445},
+        {"IfcEnergyConversionDevice", 447},
+        {"IfcEnergyConversionDeviceType", 449},
+        {"IfcEngine", 451},
+        {"IfcEngineType", 453},
+        {"IfcEvaporativeCooler", 455},
+        {"IfcEvaporativeCoolerType", 457},
+        {"IfcEvaporator", 459},
+        {"IfcEvaporatorType", 461},
+        {"IfcEvent", 463},
+        {"IfcEventTime", 465},
+        {"IfcEventType", 467},
+        {"IfcExtendedProperties", 469},
+        {"IfcExternalInformation", 471},
+        {"IfcExternallyDefinedHatchStyle", 472},
+        {"IfcExternallyDefinedSurfaceStyle", 474},
+        {"IfcExternallyDefinedTextFont", 476},
+        {"IfcExternalReference", 478},
+        {"IfcExternalReferenceRelationship", 479},
+        {"IfcExternalSpatialElement", 481},
+        {"IfcExternalSpatialStructureElement", 483},
+        {"IfcExtrudedAreaSolid", 485},
+        {"IfcExtrudedAreaSolidTapered", 487},
+        {"IfcFace", 489},
+        {"IfcFaceBasedSurfaceModel", 491},
+        {"IfcFaceBound", 493},
+        {"IfcFaceOuterBound", 495},
+        {"IfcFaceSurface", 497},
+        {"IfcFacetedBrep", 499},
+        {"IfcFacetedBrepWithVoids", 501},
+        {"IfcFailureConnectionCondition", 503},
+        {"IfcFan", 505},
+        {"IfcFanType", 507},
+        {"IfcFastener", 509},
+        {"IfcFastenerType", 511},
+        {"IfcFeatureElement", 513},
+        {"IfcFeatureElementAddition", 515},
+        {"IfcFeatureElementSubtraction", 517},
+        {"IfcFillAreaStyle", 519},
+        {"IfcFillAreaStyleHatching", 521},
+        {"IfcFillAreaStyleTiles", 523},
+        {"IfcFilter", 525},
+        {"IfcFilterType", 527},
+        {"IfcFireSuppressionTerminal", 529},
+        {"IfcFireSuppressionTerminalType", 531},
+        {"IfcFixedReferenceSweptAreaSolid", 533},
+        {"IfcFlowController", 535},
+        {"IfcFlowControllerType", 537},
+        {"IfcFlowFitting", 539},
+        {"IfcFlowFittingType", 541},
+        {"IfcFlowInstrument", 543},
+        {"IfcFlowInstrumentType", 545},
+        {"IfcFlowMeter", 547},
+        {"IfcFlowMeterType", 549},
+        {"IfcFlowMovingDevice", 551},
+        {"IfcFlowMovingDeviceType", 553},
+        {"IfcFlowSegment", 555},
+        {"IfcFlowSegmentType", 557},
+        {"IfcFlowStorageDevice", 559},
+        {"IfcFlowStorageDeviceType", 561},
+        {"IfcFlowTerminal", 563},
+        {"IfcFlowTerminalType", 565},
+        {"IfcFlowTreatmentDevice", 567},
+        {"IfcFlowTreatmentDeviceType", 569},
+        {"IfcFooting", 571},
+        {"IfcFootingType", 573},
+        {"IfcFurnishingElement", 575},
+        {"IfcFurnishingElementType", 577},
+        {"IfcFurniture", 579},
+        {"IfcFurnitureType", 581},
+        {"IfcGeographicElement", 583},
+        {"IfcGeographicElementType", 585},
+        {"IfcGeometricCurveSet", 587},
+        {"IfcGeometricRepresentationContext", 589},
+        {"IfcGeometricRepresentationItem", 591},
+        {"IfcGeometricRepresentationSubContext", 593},
+        {"IfcGeometricSet", 595},
+        {"IfcGrid", 597},
+        {"IfcGridAxis", 599},
+        {"IfcGridPlacement", 600},
+        {"IfcGroup", 602},
+        {"IfcHalfSpaceSolid", 604},
+        {"IfcHeatExchanger", 606},
+        {"IfcHeatExchangerType", 608},
+        {"IfcHumidifier", 610},
+        {"IfcHumidifierType", 612},
+        {"IfcImageTexture", 614},
+        {"IfcIndexedColourMap", 616},
+        {"IfcIndexedPolyCurve", 618},
+        {"IfcIndexedPolygonalFace", 620},
+        {"IfcIndexedPolygonalFaceWithVoids", 622},
+        {"IfcIndexedTextureMap", 624},
+        {"IfcIndexedTriangleTextureMap", 626},
+        {"IfcInterceptor", 628},
+        {"IfcInterceptorType", 630},
+        {"IfcIntersectionCurve", 632},
+        {"IfcInventory", 634},
+        {"IfcIrregularTimeSeries", 636},
+        {"IfcIrregularTimeSeriesValue", 638},
+        {"IfcIShapeProfileDef", 639},
+        {"IfcJunctionBox", 641},
+        {"IfcJunctionBoxType", 643},
+        {"IfcLaborResource", 645},
+        {"IfcLaborResourceType", 647},
+        {"IfcLagTime", 649},
+        {"IfcLamp", 651},
+        {"IfcLampType", 653},
+        {"IfcLibraryInformation", 655},
+        {"IfcLibraryReference", 657},
+        {"IfcLightDistributionData", 659},
+        {"IfcLightFixture", 660},
+        {"IfcLightFixtureType", 662},
+        {"IfcLightIntensityDistribution", 664},
+        {"IfcLightSource", 665},
+        {"IfcLightSourceAmbient", 667},
+        {"IfcLightSourceDirectional", 669},
+        {"IfcLightSourceGoniometric", 671},
+        {"IfcLightSourcePositional", 673},
+        {"IfcLightSourceSpot", 675},
+        {"IfcLine", 677},
+        {"IfcLocalPlacement", 679},
+        {"IfcLoop", 681},
+        {"IfcLShapeProfileDef", 683},
+        {"IfcManifoldSolidBrep", 685},
+        {"IfcMapConversion", 687},
+        {"IfcMappedItem", 689},
+        {"IfcMaterial", 691},
+        {"IfcMaterialClassificationRelationship", 693},
+        {"IfcMaterialConstituent", 694},
+        {"IfcMaterialConstituentSet", 696},
+        {"IfcMaterialDefinition", 698},
+        {"IfcMaterialDefinitionRepresentation", 699},
+        {"IfcMaterialLayer", 701},
+        {"IfcMaterialLayerSet", 703},
+        {"IfcMaterialLayerSetUsage", 705},
+        {"IfcMaterialLayerWithOffsets", 707},
+        {"IfcMaterialList", 709},
+        {"IfcMaterialProfile", 710},
+        {"IfcMaterialProfileSet", 712},
+        {"IfcMaterialProfileSetUsage", 714},
+        {"IfcMaterialProfileSetUsageTapering", 716},
+        {"IfcMaterialProfileWithOffsets", 718},
+        {"IfcMaterialProperties", 720},
+        {"IfcMaterialRelationship", 722},
+        {"IfcMaterialUsageDefinition", 724},
+        {"IfcMeasureWithUnit", 725},
+        {"IfcMechanicalFastener", 726},
+        {"IfcMechanicalFastenerType", 728},
+        {"IfcMedicalDevice", 730},
+        {"IfcMedicalDeviceType", 732},
+        {"IfcMember", 734},
+        {"IfcMemberStandardCase", 736},
+        {"IfcMemberType", 738},
+        {"IfcMetric", 740},
+        {"IfcMirroredProfileDef", 742},
+        {"IfcMonetaryUnit", 744},
+        {"IfcMotorConnection", 745},
+        {"IfcMotorConnectionType", 747},
+        {"IfcNamedUnit", 749},
+        {"IfcObject", 750},
+        {"IfcObjectDefinition", 752},
+        {"IfcObjective", 754},
+        {"IfcObjectPlacement", 756},
+        {"IfcOccupant", 757},
+        {"IfcOffsetCurve2D", 759},
+        {"IfcOffsetCurve3D", 761},
+        {"IfcOpeningElement", 763},
+        {"IfcOpeningStandardCase", 765},
+        {"IfcOpenShell", 767},
+        {"IfcOrganization", 769},
+        {"IfcOrganizationRelationship", 770},
+        {"IfcOrientedEdge", 772},
+        {"IfcOuterBoundaryCurve", 774},
+        {"IfcOutlet", 776},
+        {"IfcOutletType", 778},
+        {"IfcOwnerHistory", 780},
+        {"IfcParameterizedProfileDef", 781},
+        {"IfcPath", 783},
+        {"IfcPcurve", 785},
+        {"IfcPerformanceHistory", 787},
+        {"IfcPermeableCoveringProperties", 789},
+        {"IfcPermit", 791},
+        {"IfcPerson", 793},
+        {"IfcPersonAndOrganization", 794},
+        {"IfcPhysicalComplexQuantity", 795},
+        {"IfcPhysicalQuantity", 797},
+        {"IfcPhysicalSimpleQuantity", 798},
+        {"IfcPile", 800},
+        {"IfcPileType", 802},
+        {"IfcPipeFitting", 804},
+        {"IfcPipeFittingType", 806},
+        {"IfcPipeSegment", 808},
+        {"IfcPipeSegmentType", 810},
+        {"IfcPixelTexture", 812},
+        {"IfcPlacement", 814},
+        {"IfcPlanarBox", 816},
+        {"IfcPlanarExtent", 818},
+        {"IfcPlane", 820},
+        {"IfcPlate", 822},
+        {"IfcPlateStandardCase", 824},
+        {"IfcPlateType", 826},
+        {"IfcPoint", 828},
+        {"IfcPointOnCurve", 830},
+        {"IfcPointOnSurface", 832},
+        {"IfcPolygonalBoundedHalfSpace", 834},
+        {"IfcPolygonalFaceSet", 836},
+        {"IfcPolyline", 838},
+        {"IfcPolyLoop", 840},
+        {"IfcPort", 842},
+        {"IfcPostalAddress", 844},
+        {"IfcPreDefinedColour", 846},
+        {"IfcPreDefinedCurveFont", 848},
+        {"IfcPreDefinedItem", 850},
+        {"IfcPreDefinedProperties", 852},
+        {"IfcPreDefinedPropertySet", 854},
+        {"IfcPreDefinedTextFont", 856},
+        {"IfcPresentationItem", 858},
+        {"IfcPresentationLayerAssignment", 859},
+        {"IfcPresentationLayerWithStyle", 860},
+        {"IfcPresentationStyle", 862},
+        {"IfcPresentationStyleAssignment", 863},
+        {"IfcProcedure", 864},
+        {"IfcProcedureType", 866},
+        {"IfcProcess", 868},
+        {"IfcProduct", 870},
+        {"IfcProductDefinitionShape", 872},
+        {"IfcProductRepresentation", 874},
+        {"IfcProfileDef", 875},
+        {"IfcProfileProperties", 876},
+        {"IfcProject", 878},
+        {"IfcProjectedCRS", 880},
+        {"IfcProjectionElement", 882},
+        {"IfcProjectLibrary", 884},
+        {"IfcProjectOrder", 886},
+        {"IfcProperty", 888},
+        {"IfcPropertyAbstraction", 890},
+        {"IfcPropertyBoundedValue", 891},
+        {"IfcPropertyDefinition", 893},
+        {"IfcPropertyDependencyRelationship", 895},
+        {"IfcPropertyEnumeratedValue", 897},
+        {"IfcPropertyEnumeration", 899},
+        {"IfcPropertyListValue", 901},
+        {"IfcPropertyReferenceValue", 903},
+        {"IfcPropertySet", 905},
+        {"IfcPropertySetDefinition", 907},
+        {"IfcPropertySetTemplate", 909},
+        {"IfcPropertySingleValue", 911},
+        {"IfcPropertyTableValue", 913},
+        {"IfcPropertyTemplate", 915},
+        {"IfcPropertyTemplateDefinition", 917},
+        {"IfcProtectiveDevice", 919},
+        {"IfcProtectiveDeviceTrippingUnit", 921},
+        {"IfcProtectiveDeviceTrippingUnitType", 923},
+        {"IfcProtectiveDeviceType", 925},
+        {"IfcProxy", 927},
+        {"IfcPump", 929},
+        {"IfcPumpType", 931},
+        {"IfcQuantityArea", 933},
+        {"IfcQuantityCount", 935},
+        {"IfcQuantityLength", 937},
+        {"IfcQuantitySet", 939},
+        {"IfcQuantityTime", 941},
+        {"IfcQuantityVolume", 943},
+        {"IfcQuantityWeight", 945},
+        {"IfcRailing", 947},
+        {"IfcRailingType", 949},
+        {"IfcRamp", 951},
+        {"IfcRampFlight", 953},
+        {"IfcRampFlightType", 955},
+        {"IfcRampType", 957},
+        {"IfcRationalBSplineCurveWithKnots", 959},
+        {"IfcRationalBSplineSurfaceWithKnots", 961},
+        {"IfcRectangleHollowProfileDef", 963},
+        {"IfcRectangleProfileDef", 965},
+        {"IfcRectangularPyramid", 967},
+        {"IfcRectangularTrimmedSurface", 969},
+        {"IfcRecurrencePattern", 971},
+        {"IfcReference", 972},
+        {"IfcRegularTimeSeries", 973},
+        {"IfcReinforcementBarProperties", 975},
+        {"IfcReinforcementDefinitionProperties", 977},
+        {"IfcReinforcingBar", 979},
+        {"IfcReinforcingBarType", 981},
+        {"IfcReinforcingElement", 983},
+        {"IfcReinforcingElementType", 985},
+        {"IfcReinforcingMesh", 987},
+        {"IfcReinforcingMeshType", 989},
+        {"IfcRelAggregates", 991},
+        {"IfcRelAssigns", 993},
+        {"IfcRelAssignsToActor", 995},
+        {"IfcRelAssignsToControl", 997},
+        {"IfcRelAssignsToGroup", 999},
+        {"IfcRelAssignsToGroupByFactor", 1001},
+        {"IfcRelAssignsToProcess", 1003},
+        {"IfcRelAssignsToProduct", 1005},
+        {"IfcRelAssignsToResource", 1007},
+        {"IfcRelAssociates", 1009},
+        {"IfcRelAssociatesApproval", 1011},
+        {"IfcRelAssociatesClassification", 1013},
+        {"IfcRelAssociatesConstraint", 1015},
+        {"IfcRelAssociatesDocument", 1017},
+        {"IfcRelAssociatesLibrary", 1019},
+        {"IfcRelAssociatesMaterial", 1021},
+        {"IfcRelationship", 1023},
+        {"IfcRelConnects", 1025},
+        {"IfcRelConnectsElements", 1027},
+        {"IfcRelConnectsPathElements", 1029},
+        {"IfcRelConnectsPorts", 1031},
+        {"IfcRelConnectsPortToElement", 1033},
+        {"IfcRelConnectsStructuralActivity", 1035},
+        {"IfcRelConnectsStructuralMember", 1037},
+        {"IfcRelConnectsWithEccentricity", 1039},
+        {"IfcRelConnectsWithRealizingElements", 1041},
+        {"IfcRelContainedInSpatialStructure", 1043},
+        {"IfcRelCoversBldgElements", 1045},
+        {"IfcRelCoversSpaces", 1047},
+        {"IfcRelDeclares", 1049},
+        {"IfcRelDecomposes", 1051},
+        {"IfcRelDefines", 1053},
+        {"IfcRelDefinesByObject", 1055},
+        {"IfcRelDefinesByProperties", 1057},
+        {"IfcRelDefinesByTemplate", 1059},
+        {"IfcRelDefinesByType", 1061},
+        {"IfcRelFillsElement", 1063},
+        {"IfcRelFlowControlElements", 1065},
+        {"IfcRelInterferesElements", 1067},
+        {"IfcRelNests", 1069},
+        {"IfcRelProjectsElement", 1071},
+        {"IfcRelReferencedInSpatialStructure", 1073},
+        {"IfcRelSequence", 1075},
+        {"IfcRelServicesBuildings", 1077},
+        {"IfcRelSpaceBoundary", 1079},
+        {"IfcRelSpaceBoundary1stLevel", 1081},
+        {"IfcRelSpaceBoundary2ndLevel", 1083},
+        {"IfcRelVoidsElement", 1085},
+        {"IfcReparametrisedCompositeCurveSegment", 1087},
+        {"IfcRepresentation", 1089},
+        {"IfcRepresentationContext", 1090},
+        {"IfcRepresentationItem", 1091},
+        {"IfcRepresentationMap", 1092},
+        {"IfcResource", 1093},
+        {"IfcResourceApprovalRelationship", 1095},
+        {"IfcResourceConstraintRelationship", 1097},
+        {"IfcResourceLevelRelationship", 1099},
+        {"IfcResourceTime", 1100},
+        {"IfcRevolvedAreaSolid", 1102},
+        {"IfcRevolvedAreaSolidTapered", 1104},
+        {"IfcRightCircularCone", 1106},
+        {"IfcRightCircularCylinder", 1108},
+        {"IfcRoof", 1110},
+        {"IfcRoofType", 1112},
+        {"IfcRoot", 1114},
+        {"IfcRoundedRectangleProfileDef", 1115},
+        {"IfcSanitaryTerminal", 1117},
+        {"IfcSanitaryTerminalType", 1119},
+        {"IfcSchedulingTime", 1121},
+        {"IfcSeamCurve", 1122},
+        {"IfcSectionedSpine", 1124},
+        {"IfcSectionProperties", 1126},
+        {"IfcSectionReinforcementProperties", 1128},
+        {"IfcSensor", 1130},
+        {"IfcSensorType", 1132},
+        {"IfcShadingDevice", 1134},
+        {"IfcShadingDeviceType", 1136},
+        {"IfcShapeAspect", 1138},
+        {"IfcShapeModel", 1139},
+        {"IfcShapeRepresentation", 1141},
+        {"IfcShellBasedSurfaceModel", 1143},
+        {"IfcSimpleProperty", 1145},
+        {"IfcSimplePropertyTemplate", 1147},
+        {"IfcSite", 1149},
+        {"IfcSIUnit", 1151},
+        {"IfcSlab", 1153},
+        {"IfcSlabElementedCase", 1155},
+        {"IfcSlabStandardCase", 1157},
+        {"IfcSlabType", 1159},
+        {"IfcSlippageConnectionCondition", 1161},
+        {"IfcSolarDevice", 1163},
+        {"IfcSolarDeviceType", 1165},
+        {"IfcSolidModel", 1167},
+        {"IfcSpace", 1169},
+        {"IfcSpaceHeater", 1171},
+        {"IfcSpaceHeaterType", 1173},
+        {"IfcSpaceType", 1175},
+        {"IfcSpatialElement", 1177},
+        {"IfcSpatialElementType", 1179},
+        {"IfcSpatialStructureElement", 1181},
+        {"IfcSpatialStructureElementType", 1183},
+        {"IfcSpatialZone", 1185},
+        {"IfcSpatialZoneType", 1187},
+        {"IfcSphere", 1189},
+        {"IfcSphericalSurface", 1191},
+        {"IfcStackTerminal", 1193},
+        {"IfcStackTerminalType", 1195},
+        {"IfcStair", 1197},
+        {"IfcStairFlight", 1199},
+        {"IfcStairFlightType", 1201},
+        {"IfcStairType", 1203},
+        {"IfcStructuralAction", 1205},
+        {"IfcStructuralActivity", 1207},
+        {"IfcStructuralAnalysisModel", 1209},
+        {"IfcStructuralConnection", 1211},
+        {"IfcStructuralConnectionCondition", 1213},
+        {"IfcStructuralCurveAction", 1214},
+        {"IfcStructuralCurveConnection", 1216},
+        {"IfcStructuralCurveMember", 1218},
+        {"IfcStructuralCurveMemberVarying", 1220},
+        {"IfcStructuralCurveReaction", 1222},
+        {"IfcStructuralItem", 1224},
+        {"IfcStructuralLinearAction", 1226},
+        {"IfcStructuralLoad", 1228},
+        {"IfcStructuralLoadCase", 1229},
+        {"IfcStructuralLoadConfiguration", 1231},
+        {"IfcStructuralLoadGroup", 1233},
+        {"IfcStructuralLoadLinearForce", 1235},
+        {"IfcStructuralLoadOrResult", 1237},
+        {"IfcStructuralLoadPlanarForce", 1239},
+        {"IfcStructuralLoadSingleDisplacement", 1241},
+        {"IfcStructuralLoadSingleDisplacementDistortion", 1243},
+        {"IfcStructuralLoadSingleForce", 1245},
+        {"IfcStructuralLoadSingleForceWarping", 1247},
+        {"IfcStructuralLoadStatic", 1249},
+        {"IfcStructuralLoadTemperature", 1251},
+        {"IfcStructuralMember", 1253},
+        {"IfcStructuralPlanarAction", 1255},
+        {"IfcStructuralPointAction", 1257},
+        {"IfcStructuralPointConnection", 1259},
+        {"IfcStructuralPointReaction", 1261},
+        {"IfcStructuralReaction", 1263},
+        {"IfcStructuralResultGroup", 1265},
+        {"IfcStructuralSurfaceAction", 1267},
+        {"IfcStructuralSurfaceConnection", 1269},
+        {"IfcStructuralSurfaceMember", 1271},
+        {"IfcStructuralSurfaceMemberVarying", 1273},
+        {"IfcStructuralSurfaceReaction", 1275},
+        {"IfcStyledItem", 1277},
+        {"IfcStyledRepresentation", 1279},
+        {"IfcStyleModel", 1281},
+        {"IfcSubContractResource", 1283},
+        {"IfcSubContractResourceType", 1285},
+        {"IfcSubedge", 1287},
+        {"IfcSurface", 1289},
+        {"IfcSurfaceCurve", 1291},
+        {"IfcSurfaceCurveSweptAreaSolid", 1293},
+        {"IfcSurfaceFeature", 1295},
+        {"IfcSurfaceOfLinearExtrusion", 1297},
+        {"IfcSurfaceOfRevolution", 1299},
+        {"IfcSurfaceReinforcementArea", 1301},
+        {"IfcSurfaceStyle", 1303},
+        {"IfcSurfaceStyleLighting", 1305},
+        {"IfcSurfaceStyleRefraction", 1307},
+        {"IfcSurfaceStyleRendering", 1309},
+        {"IfcSurfaceStyleShading", 1311},
+        {"IfcSurfaceStyleWithTextures", 1313},
+        {"IfcSurfaceTexture", 1315},
+        {"IfcSweptAreaSolid", 1317},
+        {"IfcSweptDiskSolid", 1319},
+        {"IfcSweptDiskSolidPolygonal", 1321},
+        {"IfcSweptSurface", 1323},
+        {"IfcSwitchingDevice", 1325},
+        {"IfcSwitchingDeviceType", 1327},
+        {"IfcSystem", 1329},
+        {"IfcSystemFurnitureElement", 1331},
+        {"IfcSystemFurnitureElementType", 1333},
+        {"IfcTable", 1335},
+        {"IfcTableColumn", 1336},
+        {"IfcTableRow", 1337},
+        {"IfcTank", 1338},
+        {"IfcTankType", 1340},
+        {"IfcTask", 1342},
+        {"IfcTaskTime", 1344},
+        {"IfcTaskTimeRecurring", 1346},
+        {"IfcTaskType", 1348},
+        {"IfcTelecomAddress", 1350},
+        {"IfcTendon", 1352},
+        {"IfcTendonAnchor", 1354},
+        {"IfcTendonAnchorType", 1356},
+        {"IfcTendonType", 1358},
+        {"IfcTessellatedFaceSet", 1360},
+        {"IfcTessellatedItem", 1362},
+        {"IfcTextLiteral", 1364},
+        {"IfcTextLiteralWithExtent", 1366},
+        {"IfcTextStyle", 1368},
+        {"IfcTextStyleFontModel", 1370},
+        {"IfcTextStyleForDefinedFont", 1372},
+        {"IfcTextStyleTextModel", 1374},
+        {"IfcTextureCoordinate", 1376},
+        {"IfcTextureCoordinateGenerator", 1378},
+        {"IfcTextureMap", 1380},
+        {"IfcTextureVertex", 1382},
+        {"IfcTextureVertexList", 1384},
+        {"IfcTimePeriod", 1386},
+        {"IfcTimeSeries", 1387},
+        {"IfcTimeSeriesValue", 1388},
+        {"IfcTopologicalRepresentationItem", 1389},
+        {"IfcTopologyRepresentation", 1391},
+        {"IfcToroidalSurface", 1393},
+        {"IfcTransformer", 1395},
+        {"IfcTransformerType", 1397},
+        {"IfcTransportElement", 1399},
+        {"IfcTransportElementType", 1401},
+        {"IfcTrapeziumProfileDef", 1403},
+        {"IfcTriangulatedFaceSet", 1405},
+        {"IfcTrimmedCurve", 1407},
+        {"IfcTShapeProfileDef", 1409},
+        {"IfcTubeBundle", 1411},
+        {"IfcTubeBundleType", 1413},
+        {"IfcTypeObject", 1415},
+        {"IfcTypeProcess", 1417},
+        {"IfcTypeProduct", 1419},
+        {"IfcTypeResource", 1421},
+        {"IfcUnitaryControlElement", 1423},
+        {"IfcUnitaryControlElementType", 1425},
+        {"IfcUnitaryEquipment", 1427},
+        {"IfcUnitaryEquipmentType", 1429},
+        {"IfcUnitAssignment", 1431},
+        {"IfcUShapeProfileDef", 1432},
+        {"IfcValve", 1434},
+        {"IfcValveType", 1436},
+        {"IfcVector", 1438},
+        {"IfcVertex", 1440},
+        {"IfcVertexLoop", 1442},
+        {"IfcVertexPoint", 1444},
+        {"IfcVibrationIsolator", 1446},
+        {"IfcVibrationIsolatorType", 1448},
+        {"IfcVirtualElement", 1450},
+        {"IfcVirtualGridIntersection", 1452},
+        {"IfcVoidingFeature", 1453},
+        {"IfcWall", 1455},
+        {"IfcWallElementedCase", 1457},
+        {"IfcWallStandardCase", 1459},
+        {"IfcWallType", 1461},
+        {"IfcWasteTerminal", 1463},
+        {"IfcWasteTerminalType", 1465},
+        {"IfcWindow", 1467},
+        {"IfcWindowLiningProperties", 1469},
+        {"IfcWindowPanelProperties", 1471},
+        {"IfcWindowStandardCase", 1473},
+        {"IfcWindowStyle", 1475},
+        {"IfcWindowType", 1477},
+        {"IfcWorkCalendar", 1479},
+        {"IfcWorkControl", 1481},
+        {"IfcWorkPlan", 1483},
+        {"IfcWorkSchedule", 1485},
+        {"IfcWorkTime", 1487},
+        {"IfcZone", 1489},
+        {"IfcZShapeProfileDef", 1491},
+        {NULL, -1}
+    };
+
+    //
+    // Direct supertypes of entities, -1 terminated list for each entity
+    //
+    static constexpr IntValue SchemaSupertypes_[] = {
+        136, -1, //IfcActionRequest
+        388, -1, //IfcActor
+        -1, //IfcActorRole
+        180, -1, //IfcActuator
+        181, -1, //IfcActuatorType
+        -1, //IfcAddress
+        352, -1, //IfcAdvancedBrep
+        6, -1, //IfcAdvancedBrepWithVoids
+        256, -1, //IfcAdvancedFace
+        289, -1, //IfcAirTerminal
+        275, -1, //IfcAirTerminalBox
+        276, -1, //IfcAirTerminalBoxType
+        290, -1, //IfcAirTerminalType
+        230, -1, //IfcAirToAirHeatRecovery
+        231, -1, //IfcAirToAirHeatRecoveryType
+        180, -1, //IfcAlarm
+        181, -1, //IfcAlarmType
+        453, -1, //IfcAnnotation
+        303, -1, //IfcAnnotationFillArea
+        -1, //IfcApplication
+        -1, //IfcAppliedValue
+        -1, //IfcApproval
+        572, -1, //IfcApprovalRelationship
+        456, -1, //IfcArbitraryClosedProfileDef
+        456, -1, //IfcArbitraryOpenProfileDef
+        23, -1, //IfcArbitraryProfileDefWithVoids
+        309, -1, //IfcAsset
+        405, -1, //IfcAsymmetricIShapeProfileDef
+        289, -1, //IfcAudioVisualAppliance
+        290, -1, //IfcAudioVisualApplianceType
+        423, -1, //IfcAxis1Placement
+        423, -1, //IfcAxis2Placement2D
+        423, -1, //IfcAxis2Placement3D
+        57, -1, //IfcBeam
+        33, -1, //IfcBeamStandardCase
+        62, -1, //IfcBeamType
+        683, -1, //IfcBlobTexture
+        154, -1, //IfcBlock
+        230, -1, //IfcBoiler
+        231, -1, //IfcBoilerType
+        41, -1, //IfcBooleanClippingResult
+        303, -1, //IfcBooleanResult
+        -1, //IfcBoundaryCondition
+        110, -1, //IfcBoundaryCurve
+        42, -1, //IfcBoundaryEdgeCondition
+        42, -1, //IfcBoundaryFaceCondition
+        42, -1, //IfcBoundaryNodeCondition
+        46, -1, //IfcBoundaryNodeConditionWarping
+        160, -1, //IfcBoundedCurve
+        670, -1, //IfcBoundedSurface
+        303, -1, //IfcBoundingBox
+        310, -1, //IfcBoxedHalfSpace
+        48, -1, //IfcBSplineCurve
+        52, -1, //IfcBSplineCurveWithKnots
+        49, -1, //IfcBSplineSurface
+        54, -1, //IfcBSplineSurfaceWithKnots
+        615, -1, //IfcBuilding
+        220, -1, //IfcBuildingElement
+        224, -1, //IfcBuildingElementPart
+        225, -1, //IfcBuildingElementPartType
+        57, -1, //IfcBuildingElementProxy
+        62, -1, //IfcBuildingElementProxyType
+        227, -1, //IfcBuildingElementType
+        615, -1, //IfcBuildingStorey
+        690, -1, //IfcBuildingSystem
+        230, -1, //IfcBurner
+        231, -1, //IfcBurnerType
+        277, -1, //IfcCableCarrierFitting
+        278, -1, //IfcCableCarrierFittingType
+        285, -1, //IfcCableCarrierSegment
+        286, -1, //IfcCableCarrierSegmentType
+        277, -1, //IfcCableFitting
+        278, -1, //IfcCableFittingType
+        285, -1, //IfcCableSegment
+        286, -1, //IfcCableSegmentType
+        430, -1, //IfcCartesianPoint
+        303, -1, //IfcCartesianPointList
+        76, -1, //IfcCartesianPointList2D
+        76, -1, //IfcCartesianPointList3D
+        303, -1, //IfcCartesianTransformationOperator
+        79, -1, //IfcCartesianTransformationOperator2D
+        80, -1, //IfcCartesianTransformationOperator2DnonUniform
+        79, -1, //IfcCartesianTransformationOperator3D
+        82, -1, //IfcCartesianTransformationOperator3DnonUniform
+        24, -1, //IfcCenterLineProfileDef
+        230, -1, //IfcChiller
+        231, -1, //IfcChillerType
+        57, -1, //IfcChimney
+        62, -1, //IfcChimneyType
+        117, -1, //IfcCircle
+        91, -1, //IfcCircleHollowProfileDef
+        405, -1, //IfcCircleProfileDef
+        220, -1, //IfcCivilElement
+        227, -1, //IfcCivilElementType
+        242, -1, //IfcClassification
+        246, -1, //IfcClassificationReference
+        118, -1, //IfcClosedShell
+        230, -1, //IfcCoil
+        231, -1, //IfcCoilType
+        101, -1, //IfcColourRgb
+        445, -1, //IfcColourRgbList
+        445, -1, //IfcColourSpecification
+        57, -1, //IfcColumn
+        102, -1, //IfcColumnStandardCase
+        62, -1, //IfcColumnType
+        289, -1, //IfcCommunicationsAppliance
+        290, -1, //IfcCommunicationsApplianceType
+        463, -1, //IfcComplexProperty
+        477, -1, //IfcComplexPropertyTemplate
+        48, -1, //IfcCompositeCurve
+        109, -1, //IfcCompositeCurveOnSurface
+        303, -1, //IfcCompositeCurveSegment
+        456, -1, //IfcCompositeProfileDef
+        283, -1, //IfcCompressor
+        284, -1, //IfcCompressorType
+        230, -1, //IfcCondenser
+        231, -1, //IfcCondenserType
+        160, -1, //IfcConic
+        723, -1, //IfcConnectedFaceSet
+        120, -1, //IfcConnectionCurveGeometry
+        -1, //IfcConnectionGeometry
+        122, -1, //IfcConnectionPointEccentricity
+        120, -1, //IfcConnectionPointGeometry
+        120, -1, //IfcConnectionSurfaceGeometry
+        120, -1, //IfcConnectionVolumeGeometry
+        -1, //IfcConstraint
+        132, -1, //IfcConstructionEquipmentResource
+        133, -1, //IfcConstructionEquipmentResourceType
+        132, -1, //IfcConstructionMaterialResource
+        133, -1, //IfcConstructionMaterialResourceType
+        132, -1, //IfcConstructionProductResource
+        133, -1, //IfcConstructionProductResourceType
+        569, -1, //IfcConstructionResource
+        739, -1, //IfcConstructionResourceType
+        389, -1, //IfcContext
+        387, -1, //IfcContextDependentUnit
+        388, -1, //IfcControl
+        180, -1, //IfcController
+        181, -1, //IfcControllerType
+        387, -1, //IfcConversionBasedUnit
+        139, -1, //IfcConversionBasedUnitWithOffset
+        230, -1, //IfcCooledBeam
+        231, -1, //IfcCooledBeamType
+        230, -1, //IfcCoolingTower
+        231, -1, //IfcCoolingTowerType
+        -1, //IfcCoordinateOperation
+        -1, //IfcCoordinateReferenceSystem
+        136, -1, //IfcCostItem
+        136, -1, //IfcCostSchedule
+        20, -1, //IfcCostValue
+        57, -1, //IfcCovering
+        62, -1, //IfcCoveringType
+        132, -1, //IfcCrewResource
+        133, -1, //IfcCrewResourceType
+        303, -1, //IfcCsgPrimitive3D
+        608, -1, //IfcCsgSolid
+        405, -1, //IfcCShapeProfileDef
+        572, -1, //IfcCurrencyRelationship
+        57, -1, //IfcCurtainWall
+        62, -1, //IfcCurtainWallType
+        303, -1, //IfcCurve
+        49, -1, //IfcCurveBoundedPlane
+        49, -1, //IfcCurveBoundedSurface
+        448, -1, //IfcCurveStyle
+        445, -1, //IfcCurveStyleFont
+        445, -1, //IfcCurveStyleFontAndScaling
+        445, -1, //IfcCurveStyleFontPattern
+        221, -1, //IfcCylindricalSurface
+        275, -1, //IfcDamper
+        276, -1, //IfcDamperType
+        456, -1, //IfcDerivedProfileDef
+        -1, //IfcDerivedUnit
+        -1, //IfcDerivedUnitElement
+        -1, //IfcDimensionalExponents
+        303, -1, //IfcDirection
+        224, -1, //IfcDiscreteAccessory
+        225, -1, //IfcDiscreteAccessoryType
+        184, -1, //IfcDistributionChamberElement
+        185, -1, //IfcDistributionChamberElementType
+        187, -1, //IfcDistributionCircuit
+        182, -1, //IfcDistributionControlElement
+        183, -1, //IfcDistributionControlElementType
+        220, -1, //IfcDistributionElement
+        227, -1, //IfcDistributionElementType
+        182, -1, //IfcDistributionFlowElement
+        183, -1, //IfcDistributionFlowElementType
+        437, -1, //IfcDistributionPort
+        690, -1, //IfcDistributionSystem
+        242, -1, //IfcDocumentInformation
+        572, -1, //IfcDocumentInformationRelationship
+        246, -1, //IfcDocumentReference
+        57, -1, //IfcDoor
+        443, -1, //IfcDoorLiningProperties
+        443, -1, //IfcDoorPanelProperties
+        191, -1, //IfcDoorStandardCase
+        738, -1, //IfcDoorStyle
+        62, -1, //IfcDoorType
+        439, -1, //IfcDraughtingPreDefinedColour
+        440, -1, //IfcDraughtingPreDefinedCurveFont
+        277, -1, //IfcDuctFitting
+        278, -1, //IfcDuctFittingType
+        285, -1, //IfcDuctSegment
+        286, -1, //IfcDuctSegmentType
+        291, -1, //IfcDuctSilencer
+        292, -1, //IfcDuctSilencerType
+        723, -1, //IfcEdge
+        205, -1, //IfcEdgeCurve
+        350, -1, //IfcEdgeLoop
+        289, -1, //IfcElectricAppliance
+        290, -1, //IfcElectricApplianceType
+        275, -1, //IfcElectricDistributionBoard
+        276, -1, //IfcElectricDistributionBoardType
+        287, -1, //IfcElectricFlowStorageDevice
+        288, -1, //IfcElectricFlowStorageDeviceType
+        230, -1, //IfcElectricGenerator
+        231, -1, //IfcElectricGeneratorType
+        230, -1, //IfcElectricMotor
+        231, -1, //IfcElectricMotorType
+        275, -1, //IfcElectricTimeControl
+        276, -1, //IfcElectricTimeControlType
+        453, -1, //IfcElement
+        670, -1, //IfcElementarySurface
+        220, -1, //IfcElementAssembly
+        227, -1, //IfcElementAssemblyType
+        220, -1, //IfcElementComponent
+        227, -1, //IfcElementComponentType
+        489, -1, //IfcElementQuantity
+        738, -1, //IfcElementType
+        117, -1, //IfcEllipse
+        405, -1, //IfcEllipseProfileDef
+        184, -1, //IfcEnergyConversionDevice
+        185, -1, //IfcEnergyConversionDeviceType
+        230, -1, //IfcEngine
+        231, -1, //IfcEngineType
+        230, -1, //IfcEvaporativeCooler
+        231, -1, //IfcEvaporativeCoolerType
+        230, -1, //IfcEvaporator
+        231, -1, //IfcEvaporatorType
+        452, -1, //IfcEvent
+        584, -1, //IfcEventTime
+        737, -1, //IfcEventType
+        464, -1, //IfcExtendedProperties
+        -1, //IfcExternalInformation
+        246, -1, //IfcExternallyDefinedHatchStyle
+        246, -1, //IfcExternallyDefinedSurfaceStyle
+        246, -1, //IfcExternallyDefinedTextFont
+        -1, //IfcExternalReference
+        572, -1, //IfcExternalReferenceRelationship
+        249, -1, //IfcExternalSpatialElement
+        613, -1, //IfcExternalSpatialStructureElement
+        684, -1, //IfcExtrudedAreaSolid
+        250, -1, //IfcExtrudedAreaSolidTapered
+        723, -1, //IfcFace
+        303, -1, //IfcFaceBasedSurfaceModel
+        723, -1, //IfcFaceBound
+        254, -1, //IfcFaceOuterBound
+        252, -1, //IfcFaceSurface
+        352, -1, //IfcFacetedBrep
+        257, -1, //IfcFacetedBrepWithVoids
+        631, -1, //IfcFailureConnectionCondition
+        283, -1, //IfcFan
+        284, -1, //IfcFanType
+        224, -1, //IfcFastener
+        225, -1, //IfcFastenerType
+        220, -1, //IfcFeatureElement
+        264, -1, //IfcFeatureElementAddition
+        264, -1, //IfcFeatureElementSubtraction
+        448, -1, //IfcFillAreaStyle
+        303, -1, //IfcFillAreaStyleHatching
+        303, -1, //IfcFillAreaStyleTiles
+        291, -1, //IfcFilter
+        292, -1, //IfcFilterType
+        289, -1, //IfcFireSuppressionTerminal
+        290, -1, //IfcFireSuppressionTerminalType
+        684, -1, //IfcFixedReferenceSweptAreaSolid
+        184, -1, //IfcFlowController
+        185, -1, //IfcFlowControllerType
+        184, -1, //IfcFlowFitting
+        185, -1, //IfcFlowFittingType
+        180, -1, //IfcFlowInstrument
+        181, -1, //IfcFlowInstrumentType
+        275, -1, //IfcFlowMeter
+        276, -1, //IfcFlowMeterType
+        184, -1, //IfcFlowMovingDevice
+        185, -1, //IfcFlowMovingDeviceType
+        184, -1, //IfcFlowSegment
+        185, -1, //IfcFlowSegmentType
+        184, -1, //IfcFlowStorageDevice
+        185, -1, //IfcFlowStorageDeviceType
+        184, -1, //IfcFlowTerminal
+        185, -1, //IfcFlowTerminalType
+        184, -1, //IfcFlowTreatmentDevice
+        185, -1, //IfcFlowTreatmentDeviceType
+        57, -1, //IfcFooting
+        62, -1, //IfcFootingType
+        220, -1, //IfcFurnishingElement
+        227, -1, //IfcFurnishingElementType
+        295, -1, //IfcFurniture
+        296, -1, //IfcFurnitureType
+        220, -1, //IfcGeographicElement
+        227, -1, //IfcGeographicElementType
+        305, -1, //IfcGeometricCurveSet
+        566, -1, //IfcGeometricRepresentationContext
+        567, -1, //IfcGeometricRepresentationItem
+        302, -1, //IfcGeometricRepresentationSubContext
+        303, -1, //IfcGeometricSet
+        453, -1, //IfcGrid
+        -1, //IfcGridAxis
+        391, -1, //IfcGridPlacement
+        388, -1, //IfcGroup
+        303, -1, //IfcHalfSpaceSolid
+        230, -1, //IfcHeatExchanger
+        231, -1, //IfcHeatExchangerType
+        230, -1, //IfcHumidifier
+        231, -1, //IfcHumidifierType
+        683, -1, //IfcImageTexture
+        445, -1, //IfcIndexedColourMap
+        48, -1, //IfcIndexedPolyCurve
+        708, -1, //IfcIndexedPolygonalFace
+        318, -1, //IfcIndexedPolygonalFaceWithVoids
+        715, -1, //IfcIndexedTextureMap
+        320, -1, //IfcIndexedTriangleTextureMap
+        291, -1, //IfcInterceptor
+        292, -1, //IfcInterceptorType
+        671, -1, //IfcIntersectionCurve
+        309, -1, //IfcInventory
+        721, -1, //IfcIrregularTimeSeries
+        -1, //IfcIrregularTimeSeriesValue
+        405, -1, //IfcIShapeProfileDef
+        277, -1, //IfcJunctionBox
+        278, -1, //IfcJunctionBoxType
+        132, -1, //IfcLaborResource
+        133, -1, //IfcLaborResourceType
+        584, -1, //IfcLagTime
+        289, -1, //IfcLamp
+        290, -1, //IfcLampType
+        242, -1, //IfcLibraryInformation
+        246, -1, //IfcLibraryReference
+        -1, //IfcLightDistributionData
+        289, -1, //IfcLightFixture
+        290, -1, //IfcLightFixtureType
+        -1, //IfcLightIntensityDistribution
+        303, -1, //IfcLightSource
+        342, -1, //IfcLightSourceAmbient
+        342, -1, //IfcLightSourceDirectional
+        342, -1, //IfcLightSourceGoniometric
+        342, -1, //IfcLightSourcePositional
+        346, -1, //IfcLightSourceSpot
+        160, -1, //IfcLine
+        391, -1, //IfcLocalPlacement
+        723, -1, //IfcLoop
+        405, -1, //IfcLShapeProfileDef
+        608, -1, //IfcManifoldSolidBrep
+        145, -1, //IfcMapConversion
+        567, -1, //IfcMappedItem
+        359, -1, //IfcMaterial
+        -1, //IfcMaterialClassificationRelationship
+        359, -1, //IfcMaterialConstituent
+        359, -1, //IfcMaterialConstituentSet
+        -1, //IfcMaterialDefinition
+        455, -1, //IfcMaterialDefinitionRepresentation
+        359, -1, //IfcMaterialLayer
+        359, -1, //IfcMaterialLayerSet
+        373, -1, //IfcMaterialLayerSetUsage
+        361, -1, //IfcMaterialLayerWithOffsets
+        -1, //IfcMaterialList
+        359, -1, //IfcMaterialProfile
+        359, -1, //IfcMaterialProfileSet
+        373, -1, //IfcMaterialProfileSetUsage
+        368, -1, //IfcMaterialProfileSetUsageTapering
+        366, -1, //IfcMaterialProfileWithOffsets
+        241, -1, //IfcMaterialProperties
+        572, -1, //IfcMaterialRelationship
+        -1, //IfcMaterialUsageDefinition
+        -1, //IfcMeasureWithUnit
+        224, -1, //IfcMechanicalFastener
+        225, -1, //IfcMechanicalFastenerType
+        289, -1, //IfcMedicalDevice
+        290, -1, //IfcMedicalDeviceType
+        57, -1, //IfcMember
+        379, -1, //IfcMemberStandardCase
+        62, -1, //IfcMemberType
+        125, -1, //IfcMetric
+        170, -1, //IfcMirroredProfileDef
+        -1, //IfcMonetaryUnit
+        230, -1, //IfcMotorConnection
+        231, -1, //IfcMotorConnectionType
+        -1, //IfcNamedUnit
+        389, -1, //IfcObject
+        580, -1, //IfcObjectDefinition
+        125, -1, //IfcObjective
+        -1, //IfcObjectPlacement
+        1, -1, //IfcOccupant
+        160, -1, //IfcOffsetCurve2D
+        160, -1, //IfcOffsetCurve3D
+        266, -1, //IfcOpeningElement
+        395, -1, //IfcOpeningStandardCase
+        118, -1, //IfcOpenShell
+        -1, //IfcOrganization
+        572, -1, //IfcOrganizationRelationship
+        205, -1, //IfcOrientedEdge
+        43, -1, //IfcOuterBoundaryCurve
+        289, -1, //IfcOutlet
+        290, -1, //IfcOutletType
+        -1, //IfcOwnerHistory
+        456, -1, //IfcParameterizedProfileDef
+        723, -1, //IfcPath
+        160, -1, //IfcPcurve
+        136, -1, //IfcPerformanceHistory
+        443, -1, //IfcPermeableCoveringProperties
+        136, -1, //IfcPermit
+        -1, //IfcPerson
+        -1, //IfcPersonAndOrganization
+        414, -1, //IfcPhysicalComplexQuantity
+        -1, //IfcPhysicalQuantity
+        414, -1, //IfcPhysicalSimpleQuantity
+        57, -1, //IfcPile
+        62, -1, //IfcPileType
+        277, -1, //IfcPipeFitting
+        278, -1, //IfcPipeFittingType
+        285, -1, //IfcPipeSegment
+        286, -1, //IfcPipeSegmentType
+        683, -1, //IfcPixelTexture
+        303, -1, //IfcPlacement
+        425, -1, //IfcPlanarBox
+        303, -1, //IfcPlanarExtent
+        221, -1, //IfcPlane
+        57, -1, //IfcPlate
+        427, -1, //IfcPlateStandardCase
+        62, -1, //IfcPlateType
+        303, -1, //IfcPoint
+        430, -1, //IfcPointOnCurve
+        430, -1, //IfcPointOnSurface
+        310, -1, //IfcPolygonalBoundedHalfSpace
+        707, -1, //IfcPolygonalFaceSet
+        48, -1, //IfcPolyline
+        350, -1, //IfcPolyLoop
+        453, -1, //IfcPort
+        5, -1, //IfcPostalAddress
+        441, -1, //IfcPreDefinedColour
+        441, -1, //IfcPreDefinedCurveFont
+        445, -1, //IfcPreDefinedItem
+        464, -1, //IfcPreDefinedProperties
+        473, -1, //IfcPreDefinedPropertySet
+        441, -1, //IfcPreDefinedTextFont
+        -1, //IfcPresentationItem
+        -1, //IfcPresentationLayerAssignment
+        446, -1, //IfcPresentationLayerWithStyle
+        -1, //IfcPresentationStyle
+        -1, //IfcPresentationStyleAssignment
+        452, -1, //IfcProcedure
+        737, -1, //IfcProcedureType
+        388, -1, //IfcProcess
+        388, -1, //IfcProduct
+        455, -1, //IfcProductDefinitionShape
+        -1, //IfcProductRepresentation
+        -1, //IfcProfileDef
+        241, -1, //IfcProfileProperties
+        134, -1, //IfcProject
+        146, -1, //IfcProjectedCRS
+        265, -1, //IfcProjectionElement
+        134, -1, //IfcProjectLibrary
+        136, -1, //IfcProjectOrder
+        464, -1, //IfcProperty
+        -1, //IfcPropertyAbstraction
+        597, -1, //IfcPropertyBoundedValue
+        580, -1, //IfcPropertyDefinition
+        572, -1, //IfcPropertyDependencyRelationship
+        597, -1, //IfcPropertyEnumeratedValue
+        464, -1, //IfcPropertyEnumeration
+        597, -1, //IfcPropertyListValue
+        597, -1, //IfcPropertyReferenceValue
+        473, -1, //IfcPropertySet
+        466, -1, //IfcPropertySetDefinition
+        478, -1, //IfcPropertySetTemplate
+        597, -1, //IfcPropertySingleValue
+        597, -1, //IfcPropertyTableValue
+        478, -1, //IfcPropertyTemplate
+        466, -1, //IfcPropertyTemplateDefinition
+        275, -1, //IfcProtectiveDevice
+        180, -1, //IfcProtectiveDeviceTrippingUnit
+        181, -1, //IfcProtectiveDeviceTrippingUnitType
+        276, -1, //IfcProtectiveDeviceType
+        453, -1, //IfcProxy
+        283, -1, //IfcPump
+        284, -1, //IfcPumpType
+        415, -1, //IfcQuantityArea
+        415, -1, //IfcQuantityCount
+        415, -1, //IfcQuantityLength
+        473, -1, //IfcQuantitySet
+        415, -1, //IfcQuantityTime
+        415, -1, //IfcQuantityVolume
+        415, -1, //IfcQuantityWeight
+        57, -1, //IfcRailing
+        62, -1, //IfcRailingType
+        57, -1, //IfcRamp
+        57, -1, //IfcRampFlight
+        62, -1, //IfcRampFlightType
+        62, -1, //IfcRampType
+        53, -1, //IfcRationalBSplineCurveWithKnots
+        55, -1, //IfcRationalBSplineSurfaceWithKnots
+        502, -1, //IfcRectangleHollowProfileDef
+        405, -1, //IfcRectangleProfileDef
+        154, -1, //IfcRectangularPyramid
+        49, -1, //IfcRectangularTrimmedSurface
+        -1, //IfcRecurrencePattern
+        -1, //IfcReference
+        721, -1, //IfcRegularTimeSeries
+        442, -1, //IfcReinforcementBarProperties
+        443, -1, //IfcReinforcementDefinitionProperties
+        512, -1, //IfcReinforcingBar
+        513, -1, //IfcReinforcingBarType
+        224, -1, //IfcReinforcingElement
+        225, -1, //IfcReinforcingElementType
+        512, -1, //IfcReinforcingMesh
+        513, -1, //IfcReinforcingMeshType
+        546, -1, //IfcRelAggregates
+        532, -1, //IfcRelAssigns
+        517, -1, //IfcRelAssignsToActor
+        517, -1, //IfcRelAssignsToControl
+        517, -1, //IfcRelAssignsToGroup
+        520, -1, //IfcRelAssignsToGroupByFactor
+        517, -1, //IfcRelAssignsToProcess
+        517, -1, //IfcRelAssignsToProduct
+        517, -1, //IfcRelAssignsToResource
+        532, -1, //IfcRelAssociates
+        525, -1, //IfcRelAssociatesApproval
+        525, -1, //IfcRelAssociatesClassification
+        525, -1, //IfcRelAssociatesConstraint
+        525, -1, //IfcRelAssociatesDocument
+        525, -1, //IfcRelAssociatesLibrary
+        525, -1, //IfcRelAssociatesMaterial
+        580, -1, //IfcRelationship
+        532, -1, //IfcRelConnects
+        533, -1, //IfcRelConnectsElements
+        534, -1, //IfcRelConnectsPathElements
+        533, -1, //IfcRelConnectsPorts
+        533, -1, //IfcRelConnectsPortToElement
+        533, -1, //IfcRelConnectsStructuralActivity
+        533, -1, //IfcRelConnectsStructuralMember
+        539, -1, //IfcRelConnectsWithEccentricity
+        534, -1, //IfcRelConnectsWithRealizingElements
+        533, -1, //IfcRelContainedInSpatialStructure
+        533, -1, //IfcRelCoversBldgElements
+        533, -1, //IfcRelCoversSpaces
+        532, -1, //IfcRelDeclares
+        532, -1, //IfcRelDecomposes
+        532, -1, //IfcRelDefines
+        547, -1, //IfcRelDefinesByObject
+        547, -1, //IfcRelDefinesByProperties
+        547, -1, //IfcRelDefinesByTemplate
+        547, -1, //IfcRelDefinesByType
+        533, -1, //IfcRelFillsElement
+        533, -1, //IfcRelFlowControlElements
+        533, -1, //IfcRelInterferesElements
+        546, -1, //IfcRelNests
+        546, -1, //IfcRelProjectsElement
+        533, -1, //IfcRelReferencedInSpatialStructure
+        533, -1, //IfcRelSequence
+        533, -1, //IfcRelServicesBuildings
+        533, -1, //IfcRelSpaceBoundary
+        560, -1, //IfcRelSpaceBoundary1stLevel
+        561, -1, //IfcRelSpaceBoundary2ndLevel
+        546, -1, //IfcRelVoidsElement
+        111, -1, //IfcReparametrisedCompositeCurveSegment
+        -1, //IfcRepresentation
+        -1, //IfcRepresentationContext
+        -1, //IfcRepresentationItem
+        -1, //IfcRepresentationMap
+        388, -1, //IfcResource
+        572, -1, //IfcResourceApprovalRelationship
+        572, -1, //IfcResourceConstraintRelationship
+        -1, //IfcResourceLevelRelationship
+        584, -1, //IfcResourceTime
+        684, -1, //IfcRevolvedAreaSolid
+        574, -1, //IfcRevolvedAreaSolidTapered
+        154, -1, //IfcRightCircularCone
+        154, -1, //IfcRightCircularCylinder
+        57, -1, //IfcRoof
+        62, -1, //IfcRoofType
+        -1, //IfcRoot
+        502, -1, //IfcRoundedRectangleProfileDef
+        289, -1, //IfcSanitaryTerminal
+        290, -1, //IfcSanitaryTerminalType
+        -1, //IfcSchedulingTime
+        671, -1, //IfcSeamCurve
+        303, -1, //IfcSectionedSpine
+        442, -1, //IfcSectionProperties
+        442, -1, //IfcSectionReinforcementProperties
+        180, -1, //IfcSensor
+        181, -1, //IfcSensorType
+        57, -1, //IfcShadingDevice
+        62, -1, //IfcShadingDeviceType
+        -1, //IfcShapeAspect
+        565, -1, //IfcShapeModel
+        594, -1, //IfcShapeRepresentation
+        303, -1, //IfcShellBasedSurfaceModel
+        463, -1, //IfcSimpleProperty
+        477, -1, //IfcSimplePropertyTemplate
+        615, -1, //IfcSite
+        387, -1, //IfcSIUnit
+        57, -1, //IfcSlab
+        601, -1, //IfcSlabElementedCase
+        601, -1, //IfcSlabStandardCase
+        62, -1, //IfcSlabType
+        631, -1, //IfcSlippageConnectionCondition
+        230, -1, //IfcSolarDevice
+        231, -1, //IfcSolarDeviceType
+        303, -1, //IfcSolidModel
+        615, -1, //IfcSpace
+        289, -1, //IfcSpaceHeater
+        290, -1, //IfcSpaceHeaterType
+        616, -1, //IfcSpaceType
+        453, -1, //IfcSpatialElement
+        738, -1, //IfcSpatialElementType
+        613, -1, //IfcSpatialStructureElement
+        614, -1, //IfcSpatialStructureElementType
+        613, -1, //IfcSpatialZone
+        614, -1, //IfcSpatialZoneType
+        154, -1, //IfcSphere
+        221, -1, //IfcSphericalSurface
+        289, -1, //IfcStackTerminal
+        290, -1, //IfcStackTerminalType
+        57, -1, //IfcStair
+        57, -1, //IfcStairFlight
+        62, -1, //IfcStairFlightType
+        62, -1, //IfcStairType
+        628, -1, //IfcStructuralAction
+        453, -1, //IfcStructuralActivity
+        690, -1, //IfcStructuralAnalysisModel
+        637, -1, //IfcStructuralConnection
+        -1, //IfcStructuralConnectionCondition
+        627, -1, //IfcStructuralCurveAction
+        630, -1, //IfcStructuralCurveConnection
+        652, -1, //IfcStructuralCurveMember
+        634, -1, //IfcStructuralCurveMemberVarying
+        657, -1, //IfcStructuralCurveReaction
+        453, -1, //IfcStructuralItem
+        632, -1, //IfcStructuralLinearAction
+        -1, //IfcStructuralLoad
+        642, -1, //IfcStructuralLoadCase
+        639, -1, //IfcStructuralLoadConfiguration
+        309, -1, //IfcStructuralLoadGroup
+        650, -1, //IfcStructuralLoadLinearForce
+        639, -1, //IfcStructuralLoadOrResult
+        650, -1, //IfcStructuralLoadPlanarForce
+        650, -1, //IfcStructuralLoadSingleDisplacement
+        646, -1, //IfcStructuralLoadSingleDisplacementDistortion
+        650, -1, //IfcStructuralLoadSingleForce
+        648, -1, //IfcStructuralLoadSingleForceWarping
+        644, -1, //IfcStructuralLoadStatic
+        650, -1, //IfcStructuralLoadTemperature
+        637, -1, //IfcStructuralMember
+        659, -1, //IfcStructuralPlanarAction
+        627, -1, //IfcStructuralPointAction
+        630, -1, //IfcStructuralPointConnection
+        657, -1, //IfcStructuralPointReaction
+        628, -1, //IfcStructuralReaction
+        309, -1, //IfcStructuralResultGroup
+        627, -1, //IfcStructuralSurfaceAction
+        630, -1, //IfcStructuralSurfaceConnection
+        652, -1, //IfcStructuralSurfaceMember
+        661, -1, //IfcStructuralSurfaceMemberVarying
+        657, -1, //IfcStructuralSurfaceReaction
+        567, -1, //IfcStyledItem
+        666, -1, //IfcStyledRepresentation
+        565, -1, //IfcStyleModel
+        132, -1, //IfcSubContractResource
+        133, -1, //IfcSubContractResourceType
+        205, -1, //IfcSubedge
+        303, -1, //IfcSurface
+        160, -1, //IfcSurfaceCurve
+        684, -1, //IfcSurfaceCurveSweptAreaSolid
+        264, -1, //IfcSurfaceFeature
+        687, -1, //IfcSurfaceOfLinearExtrusion
+        687, -1, //IfcSurfaceOfRevolution
+        644, -1, //IfcSurfaceReinforcementArea
+        448, -1, //IfcSurfaceStyle
+        445, -1, //IfcSurfaceStyleLighting
+        445, -1, //IfcSurfaceStyleRefraction
+        681, -1, //IfcSurfaceStyleRendering
+        445, -1, //IfcSurfaceStyleShading
+        445, -1, //IfcSurfaceStyleWithTextures
+        445, -1, //IfcSurfaceTexture
+        608, -1, //IfcSweptAreaSolid
+        608, -1, //IfcSweptDiskSolid
+        685, -1, //IfcSweptDiskSolidPolygonal
+        670, -1, //IfcSweptSurface
+        275, -1, //IfcSwitchingDevice
+        276, -1, //IfcSwitchingDeviceType
+        309, -1, //IfcSystem
+        295, -1, //IfcSystemFurnitureElement
+        296, -1, //IfcSystemFurnitureElementType
+        -1, //IfcTable
+        -1, //IfcTableColumn
+        -1, //IfcTableRow
+        287, -1, //IfcTank
+        288, -1, //IfcTankType
+        452, -1, //IfcTask
+        584, -1, //IfcTaskTime
+        699, -1, //IfcTaskTimeRecurring
+        737, -1, //IfcTaskType
+        5, -1, //IfcTelecomAddress
+        512, -1, //IfcTendon
+        512, -1, //IfcTendonAnchor
+        513, -1, //IfcTendonAnchorType
+        513, -1, //IfcTendonType
+        708, -1, //IfcTessellatedFaceSet
+        303, -1, //IfcTessellatedItem
+        303, -1, //IfcTextLiteral
+        709, -1, //IfcTextLiteralWithExtent
+        448, -1, //IfcTextStyle
+        444, -1, //IfcTextStyleFontModel
+        445, -1, //IfcTextStyleForDefinedFont
+        445, -1, //IfcTextStyleTextModel
+        445, -1, //IfcTextureCoordinate
+        715, -1, //IfcTextureCoordinateGenerator
+        715, -1, //IfcTextureMap
+        445, -1, //IfcTextureVertex
+        445, -1, //IfcTextureVertexList
+        -1, //IfcTimePeriod
+        -1, //IfcTimeSeries
+        -1, //IfcTimeSeriesValue
+        567, -1, //IfcTopologicalRepresentationItem
+        594, -1, //IfcTopologyRepresentation
+        221, -1, //IfcToroidalSurface
+        230, -1, //IfcTransformer
+        231, -1, //IfcTransformerType
+        220, -1, //IfcTransportElement
+        227, -1, //IfcTransportElementType
+        405, -1, //IfcTrapeziumProfileDef
+        707, -1, //IfcTriangulatedFaceSet
+        48, -1, //IfcTrimmedCurve
+        405, -1, //IfcTShapeProfileDef
+        230, -1, //IfcTubeBundle
+        231, -1, //IfcTubeBundleType
+        389, -1, //IfcTypeObject
+        736, -1, //IfcTypeProcess
+        736, -1, //IfcTypeProduct
+        736, -1, //IfcTypeResource
+        180, -1, //IfcUnitaryControlElement
+        181, -1, //IfcUnitaryControlElementType
+        230, -1, //IfcUnitaryEquipment
+        231, -1, //IfcUnitaryEquipmentType
+        -1, //IfcUnitAssignment
+        405, -1, //IfcUShapeProfileDef
+        275, -1, //IfcValve
+        276, -1, //IfcValveType
+        303, -1, //IfcVector
+        723, -1, //IfcVertex
+        350, -1, //IfcVertexLoop
+        749, -1, //IfcVertexPoint
+        224, -1, //IfcVibrationIsolator
+        225, -1, //IfcVibrationIsolatorType
+        220, -1, //IfcVirtualElement
+        -1, //IfcVirtualGridIntersection
+        266, -1, //IfcVoidingFeature
+        57, -1, //IfcWall
+        757, -1, //IfcWallElementedCase
+        757, -1, //IfcWallStandardCase
+        62, -1, //IfcWallType
+        289, -1, //IfcWasteTerminal
+        290, -1, //IfcWasteTerminalType
+        57, -1, //IfcWindow
+        443, -1, //IfcWindowLiningProperties
+        443, -1, //IfcWindowPanelProperties
+        763, -1, //IfcWindowStandardCase
+        738, -1, //IfcWindowStyle
+        62, -1, //IfcWindowType
+        136, -1, //IfcWorkCalendar
+        136, -1, //IfcWorkControl
+        770, -1, //IfcWorkPlan
+        770, -1, //IfcWorkSchedule
+        584, -1, //IfcWorkTime
+        690, -1, //IfcZone
+        405, -1, //IfcZShapeProfileDef
+        -1
+    };
+
+    inline const EntityDefinition* SchemaEntities(IntValue& count)
+    {
+        count = sizeof(SchemaEntities_) / sizeof(SchemaEntities_[0]) - 1;
+        return SchemaEntities_;
+    }
+
+    inline const IntValue* SchemaSupertypes()
+    {
+        return SchemaSupertypes_;
+    }
+
+    //
+    // Attributes of generated accessors, indexed by attribute ordinal
+    //
+    static const AttributeName SchemaAttributes_[] = {
+        {"IfcRoot", "GlobalId"},
+        {"IfcRoot", "OwnerHistory"},
+        {"IfcRoot", "Name"},
+        {"IfcRoot", "Description"},
+        {"IfcObjectDefinition", "HasAssignments"},
+        {"IfcObjectDefinition", "Nests"},
+        {"IfcObjectDefinition", "IsNestedBy"},
+        {"IfcObjectDefinition", "HasContext"},
+        {"IfcObjectDefinition", "IsDecomposedBy"},
+        {"IfcObjectDefinition", "Decomposes"},
+        {"IfcObjectDefinition", "HasAssociations"},
+        {"IfcObject", "ObjectType"},
+        {"IfcObject", "IsDeclaredBy"},
+        {"IfcObject", "Declares"},
+        {"IfcObject", "IsTypedBy"},
+        {"IfcObject", "IsDefinedBy"},
+        {"IfcControl", "Identification"},
+        {"IfcControl", "Controls"},
+        {"IfcActionRequest", "PredefinedType"},
+        {"IfcActionRequest", "Status"},
+        {"IfcActionRequest", "LongDescription"},
+        {"IfcActor", "TheActor"},
+        {"IfcActor", "IsActingUpon"},
+        {"IfcActorRole", "Role"},
+        {"IfcActorRole", "UserDefinedRole"},
+        {"IfcActorRole", "Description"},
+        {"IfcActorRole", "HasExternalReference"},
+        {"IfcProduct", "ObjectPlacement"},
+        {"IfcProduct", "Representation"},
+        {"IfcProduct", "ReferencedBy"},
+        {"IfcElement", "Tag"},
+        {"IfcElement", "FillsVoids"},
+        {"IfcElement", "ConnectedTo"},
+        {"IfcElement", "IsInterferedByElements"},
+        {"IfcElement", "InterferesElements"},
+        {"IfcElement", "HasProjections"},
+        {"IfcElement", "ReferencedInStructures"},
+        {"IfcElement", "HasOpenings"},
+        {"IfcElement", "IsConnectionRealization"},
+        {"IfcElement", "ProvidesBoundaries"},
+        {"IfcElement", "ConnectedFrom"},
+        {"IfcElement", "ContainedInStructure"},
+        {"IfcElement", "HasCoverings"},
+        {"IfcDistributionElement", "HasPorts"},
+        {"IfcDistributionControlElement", "AssignedToFlowElement"},
+        {"IfcActuator", "PredefinedType"},
+        {"IfcTypeObject", "ApplicableOccurrence"},
+        {"IfcTypeObject", "HasPropertySets"},
+        {"IfcTypeObject", "Types"},
+        {"IfcTypeProduct", "RepresentationMaps"},
+        {"IfcTypeProduct", "Tag"},
+        {"IfcTypeProduct", "ReferencedBy"},
+        {"IfcElementType", "ElementType"},
+        {"IfcActuatorType", "PredefinedType"},
+        {"IfcAddress", "Purpose"},
+        {"IfcAddress", "Description"},
+        {"IfcAddress", "UserDefinedPurpose"},
+        {"IfcAddress", "OfPerson"},
+        {"IfcAddress", "OfOrganization"},
+        {"IfcRepresentationItem", "LayerAssignment"},
+        {"IfcRepresentationItem", "StyledByItem"},
+        {"IfcSolidModel", "Dim"},
+        {"IfcManifoldSolidBrep", "Outer"},
+        {"IfcAdvancedBrepWithVoids", "Voids"},
+        {"IfcFace", "Bounds"},
+        {"IfcFace", "HasTextureMaps"},
+        {"IfcFaceSurface", "FaceSurface"},
+        {"IfcFaceSurface", "SameSense"},
+        {"IfcDistributionFlowElement", "HasControlElements"},
+        {"IfcAirTerminal", "PredefinedType"},
+        {"IfcAirTerminalBox", "PredefinedType"},
+        {"IfcAirTerminalBoxType", "PredefinedType"},
+        {"IfcAirTerminalType", "PredefinedType"},
+        {"IfcAirToAirHeatRecovery", "PredefinedType"},
+        {"IfcAirToAirHeatRecoveryType", "PredefinedType"},
+        {"IfcAlarm", "PredefinedType"},
+        {"IfcAlarmType", "PredefinedType"},
+        {"IfcAnnotation", "ContainedInStructure"},
+        {"IfcAnnotationFillArea", "OuterBoundary"},
+        {"IfcAnnotationFillArea", "InnerBoundaries"},
+        {"IfcApplication", "ApplicationDeveloper"},
+        {"IfcApplication", "Version"},
+        {"IfcApplication", "ApplicationFullName"},
+        {"IfcApplication", "ApplicationIdentifier"},
+        {"IfcAppliedValue", "Name"},
+        {"IfcAppliedValue", "Description"},
+        {"IfcAppliedValue", "AppliedValue"},
+        {"IfcAppliedValue", "UnitBasis"},
+        {"IfcAppliedValue", "ApplicableDate"},
+        {"IfcAppliedValue", "FixedUntilDate"},
+        {"IfcAppliedValue", "Category"},
+        {"IfcAppliedValue", "Condition"},
+        {"IfcAppliedValue", "ArithmeticOperator"},
+        {"IfcAppliedValue", "Components"},
+        {"IfcAppliedValue", "HasExternalReference"},
+        {"IfcApproval", "Identifier"},
+        {"IfcApproval", "Name"},
+        {"IfcApproval", "Description"},
+        {"IfcApproval", "TimeOfApproval"},
+        {"IfcApproval", "Status"},
+        {"IfcApproval", "Level"},
+        {"IfcApproval", "Qualifier"},
+        {"IfcApproval", "RequestingApproval"},
+        {"IfcApproval", "GivingApproval"},
+        {"IfcApproval", "HasExternalReferences"},
+        {"IfcApproval", "ApprovedObjects"},
+        {"IfcApproval", "ApprovedResources"},
+        {"IfcApproval", "IsRelatedWith"},
+        {"IfcApproval", "Relates"},
+        {"IfcResourceLevelRelationship", "Name"},
+        {"IfcResourceLevelRelationship", "Description"},
+        {"IfcApprovalRelationship", "RelatingApproval"},
+        {"IfcApprovalRelationship", "RelatedApprovals"},
+        {"IfcProfileDef", "ProfileType"},
+        {"IfcProfileDef", "ProfileName"},
+        {"IfcProfileDef", "HasExternalReference"},
+        {"IfcProfileDef", "HasProperties"},
+        {"IfcArbitraryClosedProfileDef", "OuterCurve"},
+        {"IfcArbitraryOpenProfileDef", "Curve"},
+        {"IfcArbitraryProfileDefWithVoids", "InnerCurves"},
+        {"IfcGroup", "IsGroupedBy"},
+        {"IfcAsset", "Identification"},
+        {"IfcAsset", "OriginalValue"},
+        {"IfcAsset", "CurrentValue"},
+        {"IfcAsset", "TotalReplacementCost"},
+        {"IfcAsset", "Owner"},
+        {"IfcAsset", "User"},
+        {"IfcAsset", "ResponsiblePerson"},
+        {"IfcAsset", "IncorporationDate"},
+        {"IfcAsset", "DepreciatedValue"},
+        {"IfcParameterizedProfileDef", "Position"},
+        {"IfcAsymmetricIShapeProfileDef", "BottomFlangeWidth"},
+        {"IfcAsymmetricIShapeProfileDef", "OverallDepth"},
+        {"IfcAsymmetricIShapeProfileDef", "WebThickness"},
+        {"IfcAsymmetricIShapeProfileDef", "BottomFlangeThickness"},
+        {"IfcAsymmetricIShapeProfileDef", "BottomFlangeFilletRadius"},
+        {"IfcAsymmetricIShapeProfileDef", "TopFlangeWidth"},
+        {"IfcAsymmetricIShapeProfileDef", "TopFlangeThickness"},
+        {"IfcAsymmetricIShapeProfileDef", "TopFlangeFilletRadius"},
+        {"IfcAsymmetricIShapeProfileDef", "BottomFlangeEdgeRadius"},
+        {"IfcAsymmetricIShapeProfileDef", "BottomFlangeSlope"},
+        {"IfcAsymmetricIShapeProfileDef", "TopFlangeEdgeRadius"},
+        {"IfcAsymmetricIShapeProfileDef", "TopFlangeSlope"},
+        {"IfcAudioVisualAppliance", "PredefinedType"},
+        {"IfcAudioVisualApplianceType", "PredefinedType"},
+        {"IfcPlacement", "Location"},
+        {"IfcPlacement", "Dim"},
+        {"IfcAxis1Placement", "Axis"},
+        {"IfcAxis1Placement", "Z"},
+        {"IfcAxis2Placement2D", "RefDirection"},
+        {"IfcAxis2Placement2D", "P"},
+        {"IfcAxis2Placement3D", "Axis"},
+        {"IfcAxis2Placement3D", "RefDirection"},
+        {"IfcAxis2Placement3D", "P"},
+        {"IfcBeam", "PredefinedType"},
+        {"IfcBeamType", "PredefinedType"},
+        {"IfcSurfaceTexture", "RepeatS"},
+        {"IfcSurfaceTexture", "RepeatT"},
+        {"IfcSurfaceTexture", "Mode"},
+        {"IfcSurfaceTexture", "TextureTransform"},
+        {"IfcSurfaceTexture", "Parameter"},
+        {"IfcSurfaceTexture", "IsMappedBy"},
+        {"IfcSurfaceTexture", "UsedInStyles"},
+        {"IfcBlobTexture", "RasterFormat"},
+        {"IfcBlobTexture", "RasterCode"},
+        {"IfcCsgPrimitive3D", "Position"},
+        {"IfcCsgPrimitive3D", "Dim"},
+        {"IfcBlock", "XLength"},
+        {"IfcBlock", "YLength"},
+        {"IfcBlock", "ZLength"},
+        {"IfcBoiler", "PredefinedType"},
+        {"IfcBoilerType", "PredefinedType"},
+        {"IfcBooleanResult", "Operator"},
+        {"IfcBooleanResult", "FirstOperand"},
+        {"IfcBooleanResult", "SecondOperand"},
+        {"IfcBooleanResult", "Dim"},
+        {"IfcBoundaryCondition", "Name"},
+        {"IfcCurve", "Dim"},
+        {"IfcCompositeCurve", "Segments"},
+        {"IfcCompositeCurve", "SelfIntersect"},
+        {"IfcCompositeCurve", "NSegments"},
+        {"IfcCompositeCurve", "ClosedCurve"},
+        {"IfcCompositeCurveOnSurface", "BasisSurface"},
+        {"IfcBoundaryEdgeCondition", "TranslationalStiffnessByLengthX"},
+        {"IfcBoundaryEdgeCondition", "TranslationalStiffnessByLengthY"},
+        {"IfcBoundaryEdgeCondition", "TranslationalStiffnessByLengthZ"},
+        {"IfcBoundaryEdgeCondition", "RotationalStiffnessByLengthX"},
+        {"IfcBoundaryEdgeCondition", "RotationalStiffnessByLengthY"},
+        {"IfcBoundaryEdgeCondition", "RotationalStiffnessByLengthZ"},
+        {"IfcBoundaryFaceCondition", "TranslationalStiffnessByAreaX"},
+        {"IfcBoundaryFaceCondition", "TranslationalStiffnessByAreaY"},
+        {"IfcBoundaryFaceCondition", "TranslationalStiffnessByAreaZ"},
+        {"IfcBoundaryNodeCondition", "TranslationalStiffnessX"},
+        {"IfcBoundaryNodeCondition", "TranslationalStiffnessY"},
+        {"IfcBoundaryNodeCondition", "TranslationalStiffnessZ"},
+        {"IfcBoundaryNodeCondition", "RotationalStiffnessX"},
+        {"IfcBoundaryNodeCondition", "RotationalStiffnessY"},
+        {"IfcBoundaryNodeCondition", "RotationalStiffnessZ"},
+        {"IfcBoundaryNodeConditionWarping", "WarpingStiffness"},
+        {"IfcSurface", "Dim"},
+        {"IfcBoundingBox", "Corner"},
+        {"IfcBoundingBox", "XDim"},
+        {"IfcBoundingBox", "YDim"},
+        {"IfcBoundingBox", "ZDim"},
+        {"IfcBoundingBox", "Dim"},
+        {"IfcHalfSpaceSolid", "BaseSurface"},
+        {"IfcHalfSpaceSolid", "AgreementFlag"},
+        {"IfcHalfSpaceSolid", "Dim"},
+        {"IfcBoxedHalfSpace", "Enclosure"},
+        {"IfcBSplineCurve", "Degree"},
+        {"IfcBSplineCurve", "ControlPointsList"},
+        {"IfcBSplineCurve", "CurveForm"},
+        {"IfcBSplineCurve", "ClosedCurve"},
+        {"IfcBSplineCurve", "SelfIntersect"},
+        {"IfcBSplineCurve", "UpperIndexOnControlPoints"},
+        {"IfcBSplineCurve", "ControlPoints"},
+        {"IfcBSplineCurveWithKnots", "KnotMultiplicities"},
+        {"IfcBSplineCurveWithKnots", "Knots"},
+        {"IfcBSplineCurveWithKnots", "KnotSpec"},
+        {"IfcBSplineCurveWithKnots", "UpperIndexOnKnots"},
+        {"IfcBSplineSurface", "UDegree"},
+        {"IfcBSplineSurface", "VDegree"},
+        {"IfcBSplineSurface", "ControlPointsList"},
+        {"IfcBSplineSurface", "SurfaceForm"},
+        {"IfcBSplineSurface", "UClosed"},
+        {"IfcBSplineSurface", "VClosed"},
+        {"IfcBSplineSurface", "SelfIntersect"},
+        {"IfcBSplineSurface", "UUpper"},
+        {"IfcBSplineSurface", "VUpper"},
+        {"IfcBSplineSurface", "ControlPoints"},
+        {"IfcBSplineSurfaceWithKnots", "UMultiplicities"},
+        {"IfcBSplineSurfaceWithKnots", "VMultiplicities"},
+        {"IfcBSplineSurfaceWithKnots", "UKnots"},
+        {"IfcBSplineSurfaceWithKnots", "VKnots"},
+        {"IfcBSplineSurfaceWithKnots", "KnotSpec"},
+        {"IfcBSplineSurfaceWithKnots", "KnotVUpper"},
+        {"IfcBSplineSurfaceWithKnots", "KnotUUpper"},
+        {"IfcSpatialElement", "LongName"},
+        {"IfcSpatialElement", "ContainsElements"},
+        {"IfcSpatialElement", "ServicedBySystems"},
+        {"IfcSpatialElement", "ReferencesElements"},
+        {"IfcSpatialStructureElement", "CompositionType"},
+        {"IfcBuilding", "ElevationOfRefHeight"},
+        {"IfcBuilding", "ElevationOfTerrain"},
+        {"IfcBuilding", "BuildingAddress"},
+        {"IfcBuildingElementPart", "PredefinedType"},
+        {"IfcBuildingElementPartType", "PredefinedType"},
+        {"IfcBuildingElementProxy", "PredefinedType"},
+        {"IfcBuildingElementProxyType", "PredefinedType"},
+        {"IfcBuildingStorey", "Elevation"},
+        {"IfcSystem", "ServicesBuildings"},
+        {"IfcBuildingSystem", "PredefinedType"},
+        {"IfcBuildingSystem", "LongName"},
+        {"IfcBurner", "PredefinedType"},
+        {"IfcBurnerType", "PredefinedType"},
+        {"IfcCableCarrierFitting", "PredefinedType"},
+        {"IfcCableCarrierFittingType", "PredefinedType"},
+        {"IfcCableCarrierSegment", "PredefinedType"},
+        {"IfcCableCarrierSegmentType", "PredefinedType"},
+        {"IfcCableFitting", "PredefinedType"},
+        {"IfcCableFittingType", "PredefinedType"},
+        {"IfcCableSegment", "PredefinedType"},
+        {"IfcCableSegmentType", "PredefinedType"},
+        {"IfcCartesianPoint", "Coordinates"},
+        {"IfcCartesianPoint", "Dim"},
+        {"IfcCartesianPointList", "Dim"},
+        {"IfcCartesianPointList2D", "CoordList"},
+        {"IfcCartesianPointList3D", "CoordList"},
+        {"IfcCartesianTransformationOperator", "Axis1"},
+        {"IfcCartesianTransformationOperator", "Axis2"},
+        {"IfcCartesianTransformationOperator", "LocalOrigin"},
+        {"IfcCartesianTransformationOperator", "Scale"},
+        {"IfcCartesianTransformationOperator", "Scl"},
+        {"IfcCartesianTransformationOperator", "Dim"},
+        {"IfcCartesianTransformationOperator2D", "U"},
+        {"IfcCartesianTransformationOperator2DnonUniform", "Scale2"},
+        {"IfcCartesianTransformationOperator2DnonUniform", "Scl2"},
+        {"IfcCartesianTransformationOperator3D", "Axis3"},
+        {"IfcCartesianTransformationOperator3D", "U"},
+        {"IfcCartesianTransformationOperator3DnonUniform", "Scale2"},
+        {"IfcCartesianTransformationOperator3DnonUniform", "Scale3"},
+        {"IfcCartesianTransformationOperator3DnonUniform", "Scl2"},
+        {"IfcCartesianTransformationOperator3DnonUniform", "Scl3"},
+        {"IfcCenterLineProfileDef", "Thickness"},
+        {"IfcChiller", "PredefinedType"},
+        {"IfcChillerType", "PredefinedType"},
+        {"IfcChimney", "PredefinedType"},
+        {"IfcChimneyType", "PredefinedType"},
+        {"IfcConic", "Position"},
+        {"IfcCircle", "Radius"},
+        {"IfcCircleProfileDef", "Radius"},
+        {"IfcCircleHollowProfileDef", "WallThickness"},
+        {"IfcClassification", "Source"},
+        {"IfcClassification", "Edition"},
+        {"IfcClassification", "EditionDate"},
+        {"IfcClassification", "Name"},
+        {"IfcClassification", "Description"},
+        {"IfcClassification", "Location"},
+        {"IfcClassification", "ReferenceTokens"},
+        {"IfcClassification", "ClassificationForObjects"},
+        {"IfcClassification", "HasReferences"},
+        {"IfcExternalReference", "Location"},
+        {"IfcExternalReference", "Identification"},
+        {"IfcExternalReference", "Name"},
+        {"IfcExternalReference", "ExternalReferenceForResources"},
+        {"IfcClassificationReference", "ReferencedSource"},
+        {"IfcClassificationReference", "Description"},
+        {"IfcClassificationReference", "Sort"},
+        {"IfcClassificationReference", "ClassificationRefForObjects"},
+        {"IfcClassificationReference", "HasReferences"},
+        {"IfcConnectedFaceSet", "CfsFaces"},
+        {"IfcCoil", "PredefinedType"},
+        {"IfcCoilType", "PredefinedType"},
+        {"IfcColourSpecification", "Name"},
+        {"IfcColourRgb", "Red"},
+        {"IfcColourRgb", "Green"},
+        {"IfcColourRgb", "Blue"},
+        {"IfcColourRgbList", "ColourList"},
+        {"IfcColumn", "PredefinedType"},
+        {"IfcColumnType", "PredefinedType"},
+        {"IfcCommunicationsAppliance", "PredefinedType"},
+        {"IfcCommunicationsApplianceType", "PredefinedType"},
+        {"IfcPropertyAbstraction", "HasExternalReferences"},
+        {"IfcProperty", "Name"},
+        {"IfcProperty", "Description"},
+        {"IfcProperty", "PartOfPset"},
+        {"IfcProperty", "PropertyForDependance"},
+        {"IfcProperty", "PropertyDependsOn"},
+        {"IfcProperty", "PartOfComplex"},
+        {"IfcProperty", "HasConstraints"},
+        {"IfcProperty", "HasApprovals"},
+        {"IfcComplexProperty", "UsageName"},
+        {"IfcComplexProperty", "HasProperties"},
+        {"IfcPropertyDefinition", "HasContext"},
+        {"IfcPropertyDefinition", "HasAssociations"},
+        {"IfcPropertyTemplate", "PartOfComplexTemplate"},
+        {"IfcPropertyTemplate", "PartOfPsetTemplate"},
+        {"IfcComplexPropertyTemplate", "UsageName"},
+        {"IfcComplexPropertyTemplate", "TemplateType"},
+        {"IfcComplexPropertyTemplate", "HasPropertyTemplates"},
+        {"IfcCompositeCurveSegment", "Transition"},
+        {"IfcCompositeCurveSegment", "SameSense"},
+        {"IfcCompositeCurveSegment", "ParentCurve"},
+        {"IfcCompositeCurveSegment", "UsingCurves"},
+        {"IfcCompositeCurveSegment", "Dim"},
+        {"IfcCompositeProfileDef", "Profiles"},
+        {"IfcCompositeProfileDef", "Label"},
+        {"IfcCompressor", "PredefinedType"},
+        {"IfcCompressorType", "PredefinedType"},
+        {"IfcCondenser", "PredefinedType"},
+        {"IfcCondenserType", "PredefinedType"},
+        {"IfcConnectionCurveGeometry", "CurveOnRelatingElement"},
+        {"IfcConnectionCurveGeometry", "CurveOnRelatedElement"},
+        {"IfcConnectionPointGeometry", "PointOnRelatingElement"},
+        {"IfcConnectionPointGeometry", "PointOnRelatedElement"},
+        {"IfcConnectionPointEccentricity", "EccentricityInX"},
+        {"IfcConnectionPointEccentricity", "EccentricityInY"},
+        {"IfcConnectionPointEccentricity", "EccentricityInZ"},
+        {"IfcConnectionSurfaceGeometry", "SurfaceOnRelatingElement"},
+        {"IfcConnectionSurfaceGeometry", "SurfaceOnRelatedElement"},
+        {"IfcConnectionVolumeGeometry", "VolumeOnRelatingElement"},
+        {"IfcConnectionVolumeGeometry", "VolumeOnRelatedElement"},
+        {"IfcConstraint", "Name"},
+        {"IfcConstraint", "Description"},
+        {"IfcConstraint", "ConstraintGrade"},
+        {"IfcConstraint", "ConstraintSource"},
+        {"IfcConstraint", "CreatingActor"},
+        {"IfcConstraint", "CreationTime"},
+        {"IfcConstraint", "UserDefinedGrade"},
+        {"IfcConstraint", "HasExternalReferences"},
+        {"IfcConstraint", "PropertiesForConstraint"},
+        {"IfcResource", "Identification"},
+        {"IfcResource", "LongDescription"},
+        {"IfcResource", "ResourceOf"},
+        {"IfcConstructionResource", "Usage"},
+        {"IfcConstructionResource", "BaseCosts"},
+        {"IfcConstructionResource", "BaseQuantity"},
+        {"IfcConstructionEquipmentResource", "PredefinedType"},
+        {"IfcTypeResource", "Identification"},
+        {"IfcTypeResource", "LongDescription"},
+        {"IfcTypeResource", "ResourceType"},
+        {"IfcTypeResource", "ResourceOf"},
+        {"IfcConstructionResourceType", "BaseCosts"},
+        {"IfcConstructionResourceType", "BaseQuantity"},
+        {"IfcConstructionEquipmentResourceType", "PredefinedType"},
+        {"IfcConstructionMaterialResource", "PredefinedType"},
+        {"IfcConstructionMaterialResourceType", "PredefinedType"},
+        {"IfcConstructionProductResource", "PredefinedType"},
+        {"IfcConstructionProductResourceType", "PredefinedType"},
+        {"IfcContext", "ObjectType"},
+        {"IfcContext", "LongName"},
+        {"IfcContext", "Phase"},
+        {"IfcContext", "RepresentationContexts"},
+        {"IfcContext", "UnitsInContext"},
+        {"IfcContext", "IsDefinedBy"},
+        {"IfcContext", "Declares"},
+        {"IfcNamedUnit", "Dimensions"},
+        {"IfcNamedUnit", "UnitType"},
+        {"IfcContextDependentUnit", "Name"},
+        {"IfcContextDependentUnit", "HasExternalReference"},
+        {"IfcController", "PredefinedType"},
+        {"IfcControllerType", "PredefinedType"},
+        {"IfcConversionBasedUnit", "Name"},
+        {"IfcConversionBasedUnit", "ConversionFactor"},
+        {"IfcConversionBasedUnit", "HasExternalReference"},
+        {"IfcConversionBasedUnitWithOffset", "ConversionOffset"},
+        {"IfcCooledBeam", "PredefinedType"},
+        {"IfcCooledBeamType", "PredefinedType"},
+        {"IfcCoolingTower", "PredefinedType"},
+        {"IfcCoolingTowerType", "PredefinedType"},
+        {"IfcCoordinateOperation", "SourceCRS"},
+        {"IfcCoordinateOperation", "TargetCRS"},
+        {"IfcCoordinateReferenceSystem", "Name"},
+        {"IfcCoordinateReferenceSystem", "Description"},
+        {"IfcCoordinateReferenceSystem", "GeodeticDatum"},
+        {"IfcCoordinateReferenceSystem", "VerticalDatum"},
+        {"IfcCoordinateReferenceSystem", "HasCoordinateOperation"},
+        {"IfcCostItem", "PredefinedType"},
+        {"IfcCostItem", "CostValues"},
+        {"IfcCostItem", "CostQuantities"},
+        {"IfcCostSchedule", "PredefinedType"},
+        {"IfcCostSchedule", "Status"},
+        {"IfcCostSchedule", "SubmittedOn"},
+        {"IfcCostSchedule", "UpdateDate"},
+        {"IfcCovering", "PredefinedType"},
+        {"IfcCovering", "CoversSpaces"},
+        {"IfcCovering", "CoversElements"},
+        {"IfcCoveringType", "PredefinedType"},
+        {"IfcCrewResource", "PredefinedType"},
+        {"IfcCrewResourceType", "PredefinedType"},
+        {"IfcCsgSolid", "TreeRootExpression"},
+        {"IfcCShapeProfileDef", "Depth"},
+        {"IfcCShapeProfileDef", "Width"},
+        {"IfcCShapeProfileDef", "WallThickness"},
+        {"IfcCShapeProfileDef", "Girth"},
+        {"IfcCShapeProfileDef", "InternalFilletRadius"},
+        {"IfcCurrencyRelationship", "RelatingMonetaryUnit"},
+        {"IfcCurrencyRelationship", "RelatedMonetaryUnit"},
+        {"IfcCurrencyRelationship", "ExchangeRate"},
+        {"IfcCurrencyRelationship", "RateDateTime"},
+        {"IfcCurrencyRelationship", "RateSource"},
+        {"IfcCurtainWall", "PredefinedType"},
+        {"IfcCurtainWallType", "PredefinedType"},
+        {"IfcCurveBoundedPlane", "BasisSurface"},
+        {"IfcCurveBoundedPlane", "OuterBoundary"},
+        {"IfcCurveBoundedPlane", "InnerBoundaries"},
+        {"IfcCurveBoundedSurface", "BasisSurface"},
+        {"IfcCurveBoundedSurface", "Boundaries"},
+        {"IfcCurveBoundedSurface", "ImplicitOuter"},
+        {"IfcPresentationStyle", "Name"},
+        {"IfcCurveStyle", "CurveFont"},
+        {"IfcCurveStyle", "CurveWidth"},
+        {"IfcCurveStyle", "CurveColour"},
+        {"IfcCurveStyle", "ModelOrDraughting"},
+        {"IfcCurveStyleFont", "Name"},
+        {"IfcCurveStyleFont", "PatternList"},
+        {"IfcCurveStyleFontAndScaling", "Name"},
+        {"IfcCurveStyleFontAndScaling", "CurveFont"},
+        {"IfcCurveStyleFontAndScaling", "CurveFontScaling"},
+        {"IfcCurveStyleFontPattern", "VisibleSegmentLength"},
+        {"IfcCurveStyleFontPattern", "InvisibleSegmentLength"},
+        {"IfcElementarySurface", "Position"},
+        {"IfcCylindricalSurface", "Radius"},
+        {"IfcDamper", "PredefinedType"},
+        {"IfcDamperType", "PredefinedType"},
+        {"IfcDerivedProfileDef", "ParentProfile"},
+        {"IfcDerivedProfileDef", "Operator"},
+        {"IfcDerivedProfileDef", "Label"},
+        {"IfcDerivedUnit", "Elements"},
+        {"IfcDerivedUnit", "UnitType"},
+        {"IfcDerivedUnit", "UserDefinedType"},
+        {"IfcDerivedUnit", "Dimensions"},
+        {"IfcDerivedUnitElement", "Unit"},
+        {"IfcDerivedUnitElement", "Exponent"},
+        {"IfcDimensionalExponents", "LengthExponent"},
+        {"IfcDimensionalExponents", "MassExponent"},
+        {"IfcDimensionalExponents", "TimeExponent"},
+        {"IfcDimensionalExponents", "ElectricCurrentExponent"},
+        {"IfcDimensionalExponents", "ThermodynamicTemperatureExponent"},
+        {"IfcDimensionalExponents", "AmountOfSubstanceExponent"},
+        {"IfcDimensionalExponents", "LuminousIntensityExponent"},
+        {"IfcDirection", "DirectionRatios"},
+        {"IfcDirection", "Dim"},
+        {"IfcDiscreteAccessory", "PredefinedType"},
+        {"IfcDiscreteAccessoryType", "PredefinedType"},
+        {"IfcDistributionChamberElement", "PredefinedType"},
+        {"IfcDistributionChamberElementType", "PredefinedType"},
+        {"IfcDistributionSystem", "LongName"},
+        {"IfcDistributionSystem", "PredefinedType"},
+        {"IfcPort", "ContainedIn"},
+        {"IfcPort", "ConnectedFrom"},
+        {"IfcPort", "ConnectedTo"},
+        {"IfcDistributionPort", "FlowDirection"},
+        {"IfcDistributionPort", "PredefinedType"},
+        {"IfcDistributionPort", "SystemType"},
+        {"IfcDocumentInformation", "Identification"},
+        {"IfcDocumentInformation", "Name"},
+        {"IfcDocumentInformation", "Description"},
+        {"IfcDocumentInformation", "Location"},
+        {"IfcDocumentInformation", "Purpose"},
+        {"IfcDocumentInformation", "IntendedUse"},
+        {"IfcDocumentInformation", "Scope"},
+        {"IfcDocumentInformation", "Revision"},
+        {"IfcDocumentInformation", "DocumentOwner"},
+        {"IfcDocumentInformation", "Editors"},
+        {"IfcDocumentInformation", "CreationTime"},
+        {"IfcDocumentInformation", "LastRevisionTime"},
+        {"IfcDocumentInformation", "ElectronicFormat"},
+        {"IfcDocumentInformation", "ValidFrom"},
+        {"IfcDocumentInformation", "ValidUntil"},
+        {"IfcDocumentInformation", "Confidentiality"},
+        {"IfcDocumentInformation", "Status"},
+        {"IfcDocumentInformation", "DocumentInfoForObjects"},
+        {"IfcDocumentInformation", "HasDocumentReferences"},
+        {"IfcDocumentInformation", "IsPointedTo"},
+        {"IfcDocumentInformation", "IsPointer"},
+        {"IfcDocumentInformationRelationship", "RelatingDocument"},
+        {"IfcDocumentInformationRelationship", "RelatedDocuments"},
+        {"IfcDocumentInformationRelationship", "RelationshipType"},
+        {"IfcDocumentReference", "Description"},
+        {"IfcDocumentReference", "ReferencedDocument"},
+        {"IfcDocumentReference", "DocumentRefForObjects"},
+        {"IfcDoor", "OverallHeight"},
+        {"IfcDoor", "OverallWidth"},
+        {"IfcDoor", "PredefinedType"},
+        {"IfcDoor", "OperationType"},
+        {"IfcDoor", "UserDefinedOperationType"},
+        {"IfcPropertySetDefinition", "DefinesType"},
+        {"IfcPropertySetDefinition", "IsDefinedBy"},
+        {"IfcPropertySetDefinition", "DefinesOccurrence"},
+        {"IfcDoorLiningProperties", "LiningDepth"},
+        {"IfcDoorLiningProperties", "LiningThickness"},
+        {"IfcDoorLiningProperties", "ThresholdDepth"},
+        {"IfcDoorLiningProperties", "ThresholdThickness"},
+        {"IfcDoorLiningProperties", "TransomThickness"},
+        {"IfcDoorLiningProperties", "TransomOffset"},
+        {"IfcDoorLiningProperties", "LiningOffset"},
+        {"IfcDoorLiningProperties", "ThresholdOffset"},
+        {"IfcDoorLiningProperties", "CasingThickness"},
+        {"IfcDoorLiningProperties", "CasingDepth"},
+        {"IfcDoorLiningProperties", "ShapeAspectStyle"},
+        {"IfcDoorLiningProperties", "LiningToPanelOffsetX"},
+        {"IfcDoorLiningProperties", "LiningToPanelOffsetY"},
+        {"IfcDoorPanelProperties", "PanelDepth"},
+        {"IfcDoorPanelProperties", "PanelOperation"},
+        {"IfcDoorPanelProperties", "PanelWidth"},
+        {"IfcDoorPanelProperties", "PanelPosition"},
+        {"IfcDoorPanelProperties", "ShapeAspectStyle"},
+        {"IfcDoorStyle", "OperationType"},
+        {"IfcDoorStyle", "ConstructionType"},
+        {"IfcDoorStyle", "ParameterTakesPrecedence"},
+        {"IfcDoorStyle", "Sizeable"},
+        {"IfcDoorType", "PredefinedType"},
+        {"IfcDoorType", "OperationType"},
+        {"IfcDoorType", "ParameterTakesPrecedence"},
+        {"IfcDoorType", "UserDefinedOperationType"},
+        {"IfcPreDefinedItem", "Name"},
+        {"IfcDuctFitting", "PredefinedType"},
+        {"IfcDuctFittingType", "PredefinedType"},
+        {"IfcDuctSegment", "PredefinedType"},
+        {"IfcDuctSegmentType", "PredefinedType"},
+        {"IfcDuctSilencer", "PredefinedType"},
+        {"IfcDuctSilencerType", "PredefinedType"},
+        {"IfcEdge", "EdgeStart"},
+        {"IfcEdge", "EdgeEnd"},
+        {"IfcEdgeCurve", "EdgeGeometry"},
+        {"IfcEdgeCurve", "SameSense"},
+        {"IfcEdgeLoop", "EdgeList"},
+        {"IfcEdgeLoop", "Ne"},
+        {"IfcElectricAppliance", "PredefinedType"},
+        {"IfcElectricApplianceType", "PredefinedType"},
+        {"IfcElectricDistributionBoard", "PredefinedType"},
+        {"IfcElectricDistributionBoardType", "PredefinedType"},
+        {"IfcElectricFlowStorageDevice", "PredefinedType"},
+        {"IfcElectricFlowStorageDeviceType", "PredefinedType"},
+        {"IfcElectricGenerator", "PredefinedType"},
+        {"IfcElectricGeneratorType", "PredefinedType"},
+        {"IfcElectricMotor", "PredefinedType"},
+        {"IfcElectricMotorType", "PredefinedType"},
+        {"IfcElectricTimeControl", "PredefinedType"},
+        {"IfcElectricTimeControlType", "PredefinedType"},
+        {"IfcElementAssembly", "AssemblyPlace"},
+        {"IfcElementAssembly", "PredefinedType"},
+        {"IfcElementAssemblyType", "PredefinedType"},
+        {"IfcElementQuantity", "MethodOfMeasurement"},
+        {"IfcElementQuantity", "Quantities"},
+        {"IfcEllipse", "SemiAxis1"},
+        {"IfcEllipse", "SemiAxis2"},
+        {"IfcEllipseProfileDef", "SemiAxis1"},
+        {"IfcEllipseProfileDef", "SemiAxis2"},
+        {"IfcEngine", "PredefinedType"},
+        {"IfcEngineType", "PredefinedType"},
+        {"IfcEvaporativeCooler", "PredefinedType"},
+        {"IfcEvaporativeCoolerType", "PredefinedType"},
+        {"IfcEvaporator", "PredefinedType"},
+        {"IfcEvaporatorType", "PredefinedType"},
+        {"IfcProcess", "Identification"},
+        {"IfcProcess", "LongDescription"},
+        {"IfcProcess", "IsPredecessorTo"},
+        {"IfcProcess", "IsSuccessorFrom"},
+        {"IfcProcess", "OperatesOn"},
+        {"IfcEvent", "PredefinedType"},
+        {"IfcEvent", "EventTriggerType"},
+        {"IfcEvent", "UserDefinedEventTriggerType"},
+        {"IfcEvent", "EventOccurenceTime"},
+        {"IfcSchedulingTime", "Name"},
+        {"IfcSchedulingTime", "DataOrigin"},
+        {"IfcSchedulingTime", "UserDefinedDataOrigin"},
+        {"IfcEventTime", "ActualDate"},
+        {"IfcEventTime", "EarlyDate"},
+        {"IfcEventTime", "LateDate"},
+        {"IfcEventTime", "ScheduleDate"},
+        {"IfcTypeProcess", "Identification"},
+        {"IfcTypeProcess", "LongDescription"},
+        {"IfcTypeProcess", "ProcessType"},
+        {"IfcTypeProcess", "OperatesOn"},
+        {"IfcEventType", "PredefinedType"},
+        {"IfcEventType", "EventTriggerType"},
+        {"IfcEventType", "UserDefinedEventTriggerType"},
+        {"IfcExtendedProperties", "Name"},
+        {"IfcExtendedProperties", "Description"},
+        {"IfcExtendedProperties", "Properties"},
+        {"IfcExternalReferenceRelationship", "RelatingReference"},
+        {"IfcExternalReferenceRelationship", "RelatedResourceObjects"},
+        {"IfcExternalSpatialElement", "PredefinedType"},
+        {"IfcExternalSpatialElement", "BoundedBy"},
+        {"IfcSweptAreaSolid", "SweptArea"},
+        {"IfcSweptAreaSolid", "Position"},
+        {"IfcExtrudedAreaSolid", "ExtrudedDirection"},
+        {"IfcExtrudedAreaSolid", "Depth"},
+        {"IfcExtrudedAreaSolidTapered", "EndSweptArea"},
+        {"IfcFaceBasedSurfaceModel", "FbsmFaces"},
+        {"IfcFaceBasedSurfaceModel", "Dim"},
+        {"IfcFaceBound", "Bound"},
+        {"IfcFaceBound", "Orientation"},
+        {"IfcFacetedBrepWithVoids", "Voids"},
+        {"IfcStructuralConnectionCondition", "Name"},
+        {"IfcFailureConnectionCondition", "TensionFailureX"},
+        {"IfcFailureConnectionCondition", "TensionFailureY"},
+        {"IfcFailureConnectionCondition", "TensionFailureZ"},
+        {"IfcFailureConnectionCondition", "CompressionFailureX"},
+        {"IfcFailureConnectionCondition", "CompressionFailureY"},
+        {"IfcFailureConnectionCondition", "CompressionFailureZ"},
+        {"IfcFan", "PredefinedType"},
+        {"IfcFanType", "PredefinedType"},
+        {"IfcFastener", "PredefinedType"},
+        {"IfcFastenerType", "PredefinedType"},
+        {"IfcFeatureElementAddition", "ProjectsElements"},
+        {"IfcFeatureElementSubtraction", "VoidsElements"},
+        {"IfcFillAreaStyle", "FillStyles"},
+        {"IfcFillAreaStyle", "ModelorDraughting"},
+        {"IfcFillAreaStyleHatching", "HatchLineAppearance"},
+        {"IfcFillAreaStyleHatching", "StartOfNextHatchLine"},
+        {"IfcFillAreaStyleHatching", "PointOfReferenceHatchLine"},
+        {"IfcFillAreaStyleHatching", "PatternStart"},
+        {"IfcFillAreaStyleHatching", "HatchLineAngle"},
+        {"IfcFillAreaStyleTiles", "TilingPattern"},
+        {"IfcFillAreaStyleTiles", "Tiles"},
+        {"IfcFillAreaStyleTiles", "TilingScale"},
+        {"IfcFilter", "PredefinedType"},
+        {"IfcFilterType", "PredefinedType"},
+        {"IfcFireSuppressionTerminal", "PredefinedType"},
+        {"IfcFireSuppressionTerminalType", "PredefinedType"},
+        {"IfcFixedReferenceSweptAreaSolid", "Directrix"},
+        {"IfcFixedReferenceSweptAreaSolid", "StartParam"},
+        {"IfcFixedReferenceSweptAreaSolid", "EndParam"},
+        {"IfcFixedReferenceSweptAreaSolid", "FixedReference"},
+        {"IfcFlowInstrument", "PredefinedType"},
+        {"IfcFlowInstrumentType", "PredefinedType"},
+        {"IfcFlowMeter", "PredefinedType"},
+        {"IfcFlowMeterType", "PredefinedType"},
+        {"IfcFooting", "PredefinedType"},
+        {"IfcFootingType", "PredefinedType"},
+        {"IfcFurniture", "PredefinedType"},
+        {"IfcFurnitureType", "AssemblyPlace"},
+        {"IfcFurnitureType", "PredefinedType"},
+        {"IfcGeographicElement", "PredefinedType"},
+        {"IfcGeographicElementType", "PredefinedType"},
+        {"IfcGeometricSet", "Elements"},
+        {"IfcGeometricSet", "Dim"},
+        {"IfcRepresentationContext", "ContextIdentifier"},
+        {"IfcRepresentationContext", "ContextType"},
+        {"IfcRepresentationContext", "RepresentationsInContext"},
+        {"IfcGeometricRepresentationContext", "CoordinateSpaceDimension"},
+        {"IfcGeometricRepresentationContext", "Precision"},
+        {"IfcGeometricRepresentationContext", "WorldCoordinateSystem"},
+        {"IfcGeometricRepresentationContext", "TrueNorth"},
+        {"IfcGeometricRepresentationContext", "HasSubContexts"},
+        {"IfcGeometricRepresentationContext", "HasCoordinateOperation"},
+        {"IfcGeometricRepresentationSubContext", "ParentContext"},
+        {"IfcGeometricRepresentationSubContext", "TargetScale"},
+        {"IfcGeometricRepresentationSubContext", "TargetView"},
+        {"IfcGeometricRepresentationSubContext", "UserDefinedTargetView"},
+        {"IfcGrid", "UAxes"},
+        {"IfcGrid", "VAxes"},
+        {"IfcGrid", "WAxes"},
+        {"IfcGrid", "PredefinedType"},
+        {"IfcGrid", "ContainedInStructure"},
+        {"IfcGridAxis", "AxisTag"},
+        {"IfcGridAxis", "AxisCurve"},
+        {"IfcGridAxis", "SameSense"},
+        {"IfcGridAxis", "PartOfW"},
+        {"IfcGridAxis", "PartOfV"},
+        {"IfcGridAxis", "PartOfU"},
+        {"IfcGridAxis", "HasIntersections"},
+        {"IfcObjectPlacement", "PlacesObject"},
+        {"IfcObjectPlacement", "ReferencedByPlacements"},
+        {"IfcGridPlacement", "PlacementLocation"},
+        {"IfcGridPlacement", "PlacementRefDirection"},
+        {"IfcHeatExchanger", "PredefinedType"},
+        {"IfcHeatExchangerType", "PredefinedType"},
+        {"IfcHumidifier", "PredefinedType"},
+        {"IfcHumidifierType", "PredefinedType"},
+        {"IfcImageTexture", "URLReference"},
+        {"IfcIndexedColourMap", "MappedTo"},
+        {"IfcIndexedColourMap", "Opacity"},
+        {"IfcIndexedColourMap", "Colours"},
+        {"IfcIndexedColourMap", "ColourIndex"},
+        {"IfcIndexedPolyCurve", "Points"},
+        {"IfcIndexedPolyCurve", "Segments"},
+        {"IfcIndexedPolyCurve", "SelfIntersect"},
+        {"IfcIndexedPolygonalFace", "CoordIndex"},
+        {"IfcIndexedPolygonalFace", "ToFaceSet"},
+        {"IfcIndexedPolygonalFaceWithVoids", "InnerCoordIndices"},
+        {"IfcTextureCoordinate", "Maps"},
+        {"IfcIndexedTextureMap", "MappedTo"},
+        {"IfcIndexedTextureMap", "TexCoords"},
+        {"IfcIndexedTriangleTextureMap", "TexCoordIndex"},
+        {"IfcInterceptor", "PredefinedType"},
+        {"IfcInterceptorType", "PredefinedType"},
+        {"IfcSurfaceCurve", "Curve3D"},
+        {"IfcSurfaceCurve", "AssociatedGeometry"},
+        {"IfcSurfaceCurve", "MasterRepresentation"},
+        {"IfcSurfaceCurve", "BasisSurface"},
+        {"IfcInventory", "PredefinedType"},
+        {"IfcInventory", "Jurisdiction"},
+        {"IfcInventory", "ResponsiblePersons"},
+        {"IfcInventory", "LastUpdateDate"},
+        {"IfcInventory", "CurrentValue"},
+        {"IfcInventory", "OriginalValue"},
+        {"IfcTimeSeries", "Name"},
+        {"IfcTimeSeries", "Description"},
+        {"IfcTimeSeries", "StartTime"},
+        {"IfcTimeSeries", "EndTime"},
+        {"IfcTimeSeries", "TimeSeriesDataType"},
+        {"IfcTimeSeries", "DataOrigin"},
+        {"IfcTimeSeries", "UserDefinedDataOrigin"},
+        {"IfcTimeSeries", "Unit"},
+        {"IfcTimeSeries", "HasExternalReference"},
+        {"IfcIrregularTimeSeries", "Values"},
+        {"IfcIrregularTimeSeriesValue", "TimeStamp"},
+        {"IfcIrregularTimeSeriesValue", "ListValues"},
+        {"IfcIShapeProfileDef", "OverallWidth"},
+        {"IfcIShapeProfileDef", "OverallDepth"},
+        {"IfcIShapeProfileDef", "WebThickness"},
+        {"IfcIShapeProfileDef", "FlangeThickness"},
+        {"IfcIShapeProfileDef", "FilletRadius"},
+        {"IfcIShapeProfileDef", "FlangeEdgeRadius"},
+        {"IfcIShapeProfileDef", "FlangeSlope"},
+        {"IfcJunctionBox", "PredefinedType"},
+        {"IfcJunctionBoxType", "PredefinedType"},
+        {"IfcLaborResource", "PredefinedType"},
+        {"IfcLaborResourceType", "PredefinedType"},
+        {"IfcLagTime", "LagValue"},
+        {"IfcLagTime", "DurationType"},
+        {"IfcLamp", "PredefinedType"},
+        {"IfcLampType", "PredefinedType"},
+        {"IfcLibraryInformation", "Name"},
+        {"IfcLibraryInformation", "Version"},
+        {"IfcLibraryInformation", "Publisher"},
+        {"IfcLibraryInformation", "VersionDate"},
+        {"IfcLibraryInformation", "Location"},
+        {"IfcLibraryInformation", "Description"},
+        {"IfcLibraryInformation", "LibraryInfoForObjects"},
+        {"IfcLibraryInformation", "HasLibraryReferences"},
+        {"IfcLibraryReference", "Description"},
+        {"IfcLibraryReference", "Language"},
+        {"IfcLibraryReference", "ReferencedLibrary"},
+        {"IfcLibraryReference", "LibraryRefForObjects"},
+        {"IfcLightDistributionData", "MainPlaneAngle"},
+        {"IfcLightDistributionData", "SecondaryPlaneAngle"},
+        {"IfcLightDistributionData", "LuminousIntensity"},
+        {"IfcLightFixture", "PredefinedType"},
+        {"IfcLightFixtureType", "PredefinedType"},
+        {"IfcLightIntensityDistribution", "LightDistributionCurve"},
+        {"IfcLightIntensityDistribution", "DistributionData"},
+        {"IfcLightSource", "Name"},
+        {"IfcLightSource", "LightColour"},
+        {"IfcLightSource", "AmbientIntensity"},
+        {"IfcLightSource", "Intensity"},
+        {"IfcLightSourceDirectional", "Orientation"},
+        {"IfcLightSourceGoniometric", "Position"},
+        {"IfcLightSourceGoniometric", "ColourAppearance"},
+        {"IfcLightSourceGoniometric", "ColourTemperature"},
+        {"IfcLightSourceGoniometric", "LuminousFlux"},
+        {"IfcLightSourceGoniometric", "LightEmissionSource"},
+        {"IfcLightSourceGoniometric", "LightDistributionDataSource"},
+        {"IfcLightSourcePositional", "Position"},
+        {"IfcLightSourcePositional", "Radius"},
+        {"IfcLightSourcePositional", "ConstantAttenuation"},
+        {"IfcLightSourcePositional", "DistanceAttenuation"},
+        {"IfcLightSourcePositional", "QuadricAttenuation"},
+        {"IfcLightSourceSpot", "Orientation"},
+        {"IfcLightSourceSpot", "ConcentrationExponent"},
+        {"IfcLightSourceSpot", "SpreadAngle"},
+        {"IfcLightSourceSpot", "BeamWidthAngle"},
+        {"IfcLine", "Pnt"},
+        {"IfcLine", "Dir"},
+        {"IfcLocalPlacement", "PlacementRelTo"},
+        {"IfcLocalPlacement", "RelativePlacement"},
+        {"IfcLShapeProfileDef", "Depth"},
+        {"IfcLShapeProfileDef", "Width"},
+        {"IfcLShapeProfileDef", "Thickness"},
+        {"IfcLShapeProfileDef", "FilletRadius"},
+        {"IfcLShapeProfileDef", "EdgeRadius"},
+        {"IfcLShapeProfileDef", "LegSlope"},
+        {"IfcMapConversion", "Eastings"},
+        {"IfcMapConversion", "Northings"},
+        {"IfcMapConversion", "OrthogonalHeight"},
+        {"IfcMapConversion", "XAxisAbscissa"},
+        {"IfcMapConversion", "XAxisOrdinate"},
+        {"IfcMapConversion", "Scale"},
+        {"IfcMappedItem", "MappingSource"},
+        {"IfcMappedItem", "MappingTarget"},
+        {"IfcMaterialDefinition", "AssociatedTo"},
+        {"IfcMaterialDefinition", "HasExternalReferences"},
+        {"IfcMaterialDefinition", "HasProperties"},
+        {"IfcMaterial", "Name"},
+        {"IfcMaterial", "Description"},
+        {"IfcMaterial", "Category"},
+        {"IfcMaterial", "HasRepresentation"},
+        {"IfcMaterial", "IsRelatedWith"},
+        {"IfcMaterial", "RelatesTo"},
+        {"IfcMaterialClassificationRelationship", "MaterialClassifications"},
+        {"IfcMaterialClassificationRelationship", "ClassifiedMaterial"},
+        {"IfcMaterialConstituent", "Name"},
+        {"IfcMaterialConstituent", "Description"},
+        {"IfcMaterialConstituent", "Material"},
+        {"IfcMaterialConstituent", "Fraction"},
+        {"IfcMaterialConstituent", "Category"},
+        {"IfcMaterialConstituent", "ToMaterialConstituentSet"},
+        {"IfcMaterialConstituentSet", "Name"},
+        {"IfcMaterialConstituentSet", "Description"},
+        {"IfcMaterialConstituentSet", "MaterialConstituents"},
+        {"IfcProductRepresentation", "Name"},
+        {"IfcProductRepresentation", "Description"},
+        {"IfcProductRepresentation", "Representations"},
+        {"IfcMaterialDefinitionRepresentation", "RepresentedMaterial"},
+        {"IfcMaterialLayer", "Material"},
+        {"IfcMaterialLayer", "LayerThickness"},
+        {"IfcMaterialLayer", "IsVentilated"},
+        {"IfcMaterialLayer", "Name"},
+        {"IfcMaterialLayer", "Description"},
+        {"IfcMaterialLayer", "Category"},
+        {"IfcMaterialLayer", "Priority"},
+        {"IfcMaterialLayer", "ToMaterialLayerSet"},
+        {"IfcMaterialLayerSet", "MaterialLayers"},
+        {"IfcMaterialLayerSet", "LayerSetName"},
+        {"IfcMaterialLayerSet", "Description"},
+        {"IfcMaterialLayerSet", "TotalThickness"},
+        {"IfcMaterialUsageDefinition", "AssociatedTo"},
+        {"IfcMaterialLayerSetUsage", "ForLayerSet"},
+        {"IfcMaterialLayerSetUsage", "LayerSetDirection"},
+        {"IfcMaterialLayerSetUsage", "DirectionSense"},
+        {"IfcMaterialLayerSetUsage", "OffsetFromReferenceLine"},
+        {"IfcMaterialLayerSetUsage", "ReferenceExtent"},
+        {"IfcMaterialLayerWithOffsets", "OffsetDirection"},
+        {"IfcMaterialLayerWithOffsets", "OffsetValues"},
+        {"IfcMaterialList", "Materials"},
+        {"IfcMaterialProfile", "Name"},
+        {"IfcMaterialProfile", "Description"},
+        {"IfcMaterialProfile", "Material"},
+        {"IfcMaterialProfile", "Profile"},
+        {"IfcMaterialProfile", "Priority"},
+        {"IfcMaterialProfile", "Category"},
+        {"IfcMaterialProfile", "ToMaterialProfileSet"},
+        {"IfcMaterialProfileSet", "Name"},
+        {"IfcMaterialProfileSet", "Description"},
+        {"IfcMaterialProfileSet", "MaterialProfiles"},
+        {"IfcMaterialProfileSet", "CompositeProfile"},
+        {"IfcMaterialProfileSetUsage", "ForProfileSet"},
+        {"IfcMaterialProfileSetUsage", "CardinalPoint"},
+        {"IfcMaterialProfileSetUsage", "ReferenceExtent"},
+        {"IfcMaterialProfileSetUsageTapering", "ForProfileEndSet"},
+        {"IfcMaterialProfileSetUsageTapering", "CardinalEndPoint"},
+        {"IfcMaterialProfileWithOffsets", "OffsetValues"},
+        {"IfcMaterialProperties", "Material"},
+        {"IfcMaterialRelationship", "RelatingMaterial"},
+        {"IfcMaterialRelationship", "RelatedMaterials"},
+        {"IfcMaterialRelationship", "Expression"},
+        {"IfcMeasureWithUnit", "ValueComponent"},
+        {"IfcMeasureWithUnit", "UnitComponent"},
+        {"IfcMechanicalFastener", "NominalDiameter"},
+        {"IfcMechanicalFastener", "NominalLength"},
+        {"IfcMechanicalFastener", "PredefinedType"},
+        {"IfcMechanicalFastenerType", "PredefinedType"},
+        {"IfcMechanicalFastenerType", "NominalDiameter"},
+        {"IfcMechanicalFastenerType", "NominalLength"},
+        {"IfcMedicalDevice", "PredefinedType"},
+        {"IfcMedicalDeviceType", "PredefinedType"},
+        {"IfcMember", "PredefinedType"},
+        {"IfcMemberType", "PredefinedType"},
+        {"IfcMetric", "Benchmark"},
+        {"IfcMetric", "ValueSource"},
+        {"IfcMetric", "DataValue"},
+        {"IfcMetric", "ReferencePath"},
+        {"IfcMonetaryUnit", "Currency"},
+        {"IfcMotorConnection", "PredefinedType"},
+        {"IfcMotorConnectionType", "PredefinedType"},
+        {"IfcObjective", "BenchmarkValues"},
+        {"IfcObjective", "LogicalAggregator"},
+        {"IfcObjective", "ObjectiveQualifier"},
+        {"IfcObjective", "UserDefinedQualifier"},
+        {"IfcOccupant", "PredefinedType"},
+        {"IfcOffsetCurve2D", "BasisCurve"},
+        {"IfcOffsetCurve2D", "Distance"},
+        {"IfcOffsetCurve2D", "SelfIntersect"},
+        {"IfcOffsetCurve3D", "BasisCurve"},
+        {"IfcOffsetCurve3D", "Distance"},
+        {"IfcOffsetCurve3D", "SelfIntersect"},
+        {"IfcOffsetCurve3D", "RefDirection"},
+        {"IfcOpeningElement", "PredefinedType"},
+        {"IfcOpeningElement", "HasFillings"},
+        {"IfcOrganization", "Identification"},
+        {"IfcOrganization", "Name"},
+        {"IfcOrganization", "Description"},
+        {"IfcOrganization", "Roles"},
+        {"IfcOrganization", "Addresses"},
+        {"IfcOrganization", "IsRelatedBy"},
+        {"IfcOrganization", "Relates"},
+        {"IfcOrganization", "Engages"},
+        {"IfcOrganizationRelationship", "RelatingOrganization"},
+        {"IfcOrganizationRelationship", "RelatedOrganizations"},
+        {"IfcOrientedEdge", "EdgeElement"},
+        {"IfcOrientedEdge", "Orientation"},
+        {"IfcOutlet", "PredefinedType"},
+        {"IfcOutletType", "PredefinedType"},
+        {"IfcOwnerHistory", "OwningUser"},
+        {"IfcOwnerHistory", "OwningApplication"},
+        {"IfcOwnerHistory", "State"},
+        {"IfcOwnerHistory", "ChangeAction"},
+        {"IfcOwnerHistory", "LastModifiedDate"},
+        {"IfcOwnerHistory", "LastModifyingUser"},
+        {"IfcOwnerHistory", "LastModifyingApplication"},
+        {"IfcOwnerHistory", "CreationDate"},
+        {"IfcPath", "EdgeList"},
+        {"IfcPcurve", "BasisSurface"},
+        {"IfcPcurve", "ReferenceCurve"},
+        {"IfcPerformanceHistory", "LifeCyclePhase"},
+        {"IfcPerformanceHistory", "PredefinedType"},
+        {"IfcPermeableCoveringProperties", "OperationType"},
+        {"IfcPermeableCoveringProperties", "PanelPosition"},
+        {"IfcPermeableCoveringProperties", "FrameDepth"},
+        {"IfcPermeableCoveringProperties", "FrameThickness"},
+        {"IfcPermeableCoveringProperties", "ShapeAspectStyle"},
+        {"IfcPermit", "PredefinedType"},
+        {"IfcPermit", "Status"},
+        {"IfcPermit", "LongDescription"},
+        {"IfcPerson", "Identification"},
+        {"IfcPerson", "FamilyName"},
+        {"IfcPerson", "GivenName"},
+        {"IfcPerson", "MiddleNames"},
+        {"IfcPerson", "PrefixTitles"},
+        {"IfcPerson", "SuffixTitles"},
+        {"IfcPerson", "Roles"},
+        {"IfcPerson", "Addresses"},
+        {"IfcPerson", "EngagedIn"},
+        {"IfcPersonAndOrganization", "ThePerson"},
+        {"IfcPersonAndOrganization", "TheOrganization"},
+        {"IfcPersonAndOrganization", "Roles"},
+        {"IfcPhysicalQuantity", "Name"},
+        {"IfcPhysicalQuantity", "Description"},
+        {"IfcPhysicalQuantity", "HasExternalReferences"},
+        {"IfcPhysicalQuantity", "PartOfComplex"},
+        {"IfcPhysicalComplexQuantity", "HasQuantities"},
+        {"IfcPhysicalComplexQuantity", "Discrimination"},
+        {"IfcPhysicalComplexQuantity", "Quality"},
+        {"IfcPhysicalComplexQuantity", "Usage"},
+        {"IfcPhysicalSimpleQuantity", "Unit"},
+        {"IfcPile", "PredefinedType"},
+        {"IfcPile", "ConstructionType"},
+        {"IfcPileType", "PredefinedType"},
+        {"IfcPipeFitting", "PredefinedType"},
+        {"IfcPipeFittingType", "PredefinedType"},
+        {"IfcPipeSegment", "PredefinedType"},
+        {"IfcPipeSegmentType", "PredefinedType"},
+        {"IfcPixelTexture", "Width"},
+        {"IfcPixelTexture", "Height"},
+        {"IfcPixelTexture", "ColourComponents"},
+        {"IfcPixelTexture", "Pixel"},
+        {"IfcPlanarExtent", "SizeInX"},
+        {"IfcPlanarExtent", "SizeInY"},
+        {"IfcPlanarBox", "Placement"},
+        {"IfcPlate", "PredefinedType"},
+        {"IfcPlateType", "PredefinedType"},
+        {"IfcPointOnCurve", "BasisCurve"},
+        {"IfcPointOnCurve", "PointParameter"},
+        {"IfcPointOnCurve", "Dim"},
+        {"IfcPointOnSurface", "BasisSurface"},
+        {"IfcPointOnSurface", "PointParameterU"},
+        {"IfcPointOnSurface", "PointParameterV"},
+        {"IfcPointOnSurface", "Dim"},
+        {"IfcPolygonalBoundedHalfSpace", "Position"},
+        {"IfcPolygonalBoundedHalfSpace", "PolygonalBoundary"},
+        {"IfcTessellatedFaceSet", "Coordinates"},
+        {"IfcTessellatedFaceSet", "HasColours"},
+        {"IfcTessellatedFaceSet", "HasTextures"},
+        {"IfcTessellatedFaceSet", "Dim"},
+        {"IfcPolygonalFaceSet", "Closed"},
+        {"IfcPolygonalFaceSet", "Faces"},
+        {"IfcPolygonalFaceSet", "PnIndex"},
+        {"IfcPolyline", "Points"},
+        {"IfcPolyLoop", "Polygon"},
+        {"IfcPostalAddress", "InternalLocation"},
+        {"IfcPostalAddress", "AddressLines"},
+        {"IfcPostalAddress", "PostalBox"},
+        {"IfcPostalAddress", "Town"},
+        {"IfcPostalAddress", "Region"},
+        {"IfcPostalAddress", "PostalCode"},
+        {"IfcPostalAddress", "Country"},
+        {"IfcPresentationLayerAssignment", "Name"},
+        {"IfcPresentationLayerAssignment", "Description"},
+        {"IfcPresentationLayerAssignment", "AssignedItems"},
+        {"IfcPresentationLayerAssignment", "Identifier"},
+        {"IfcPresentationLayerWithStyle", "LayerOn"},
+        {"IfcPresentationLayerWithStyle", "LayerFrozen"},
+        {"IfcPresentationLayerWithStyle", "LayerBlocked"},
+        {"IfcPresentationLayerWithStyle", "LayerStyles"},
+        {"IfcPresentationStyleAssignment", "Styles"},
+        {"IfcProcedure", "PredefinedType"},
+        {"IfcProcedureType", "PredefinedType"},
+        {"IfcProductDefinitionShape", "ShapeOfProduct"},
+        {"IfcProductDefinitionShape", "HasShapeAspects"},
+        {"IfcProfileProperties", "ProfileDefinition"},
+        {"IfcProjectedCRS", "MapProjection"},
+        {"IfcProjectedCRS", "MapZone"},
+        {"IfcProjectedCRS", "MapUnit"},
+        {"IfcProjectionElement", "PredefinedType"},
+        {"IfcProjectOrder", "PredefinedType"},
+        {"IfcProjectOrder", "Status"},
+        {"IfcProjectOrder", "LongDescription"},
+        {"IfcPropertyBoundedValue", "UpperBoundValue"},
+        {"IfcPropertyBoundedValue", "LowerBoundValue"},
+        {"IfcPropertyBoundedValue", "Unit"},
+        {"IfcPropertyBoundedValue", "SetPointValue"},
+        {"IfcPropertyDependencyRelationship", "DependingProperty"},
+        {"IfcPropertyDependencyRelationship", "DependantProperty"},
+        {"IfcPropertyDependencyRelationship", "Expression"},
+        {"IfcPropertyEnumeratedValue", "EnumerationValues"},
+        {"IfcPropertyEnumeratedValue", "EnumerationReference"},
+        {"IfcPropertyEnumeration", "Name"},
+        {"IfcPropertyEnumeration", "EnumerationValues"},
+        {"IfcPropertyEnumeration", "Unit"},
+        {"IfcPropertyListValue", "ListValues"},
+        {"IfcPropertyListValue", "Unit"},
+        {"IfcPropertyReferenceValue", "UsageName"},
+        {"IfcPropertyReferenceValue", "PropertyReference"},
+        {"IfcPropertySet", "HasProperties"},
+        {"IfcPropertySetTemplate", "TemplateType"},
+        {"IfcPropertySetTemplate", "ApplicableEntity"},
+        {"IfcPropertySetTemplate", "HasPropertyTemplates"},
+        {"IfcPropertySetTemplate", "Defines"},
+        {"IfcPropertySingleValue", "NominalValue"},
+        {"IfcPropertySingleValue", "Unit"},
+        {"IfcPropertyTableValue", "DefiningValues"},
+        {"IfcPropertyTableValue", "DefinedValues"},
+        {"IfcPropertyTableValue", "Expression"},
+        {"IfcPropertyTableValue", "DefiningUnit"},
+        {"IfcPropertyTableValue", "DefinedUnit"},
+        {"IfcPropertyTableValue", "CurveInterpolation"},
+        {"IfcProtectiveDevice", "PredefinedType"},
+        {"IfcProtectiveDeviceTrippingUnit", "PredefinedType"},
+        {"IfcProtectiveDeviceTrippingUnitType", "PredefinedType"},
+        {"IfcProtectiveDeviceType", "PredefinedType"},
+        {"IfcProxy", "ProxyType"},
+        {"IfcProxy", "Tag"},
+        {"IfcPump", "PredefinedType"},
+        {"IfcPumpType", "PredefinedType"},
+        {"IfcQuantityArea", "AreaValue"},
+        {"IfcQuantityArea", "Formula"},
+        {"IfcQuantityCount", "CountValue"},
+        {"IfcQuantityCount", "Formula"},
+        {"IfcQuantityLength", "LengthValue"},
+        {"IfcQuantityLength", "Formula"},
+        {"IfcQuantityTime", "TimeValue"},
+        {"IfcQuantityTime", "Formula"},
+        {"IfcQuantityVolume", "VolumeValue"},
+        {"IfcQuantityVolume", "Formula"},
+        {"IfcQuantityWeight", "WeightValue"},
+        {"IfcQuantityWeight", "Formula"},
+        {"IfcRailing", "PredefinedType"},
+        {"IfcRailingType", "PredefinedType"},
+        {"IfcRamp", "PredefinedType"},
+        {"IfcRampFlight", "PredefinedType"},
+        {"IfcRampFlightType", "PredefinedType"},
+        {"IfcRampType", "PredefinedType"},
+        {"IfcRationalBSplineCurveWithKnots", "WeightsData"},
+        {"IfcRationalBSplineCurveWithKnots", "Weights"},
+        {"IfcRationalBSplineSurfaceWithKnots", "WeightsData"},
+        {"IfcRationalBSplineSurfaceWithKnots", "Weights"},
+        {"IfcRectangleProfileDef", "XDim"},
+        {"IfcRectangleProfileDef", "YDim"},
+        {"IfcRectangleHollowProfileDef", "WallThickness"},
+        {"IfcRectangleHollowProfileDef", "InnerFilletRadius"},
+        {"IfcRectangleHollowProfileDef", "OuterFilletRadius"},
+        {"IfcRectangularPyramid", "XLength"},
+        {"IfcRectangularPyramid", "YLength"},
+        {"IfcRectangularPyramid", "Height"},
+        {"IfcRectangularTrimmedSurface", "BasisSurface"},
+        {"IfcRectangularTrimmedSurface", "U1"},
+        {"IfcRectangularTrimmedSurface", "V1"},
+        {"IfcRectangularTrimmedSurface", "U2"},
+        {"IfcRectangularTrimmedSurface", "V2"},
+        {"IfcRectangularTrimmedSurface", "Usense"},
+        {"IfcRectangularTrimmedSurface", "Vsense"},
+        {"IfcRecurrencePattern", "RecurrenceType"},
+        {"IfcRecurrencePattern", "DayComponent"},
+        {"IfcRecurrencePattern", "WeekdayComponent"},
+        {"IfcRecurrencePattern", "MonthComponent"},
+        {"IfcRecurrencePattern", "Position"},
+        {"IfcRecurrencePattern", "Interval"},
+        {"IfcRecurrencePattern", "Occurrences"},
+        {"IfcRecurrencePattern", "TimePeriods"},
+        {"IfcReference", "TypeIdentifier"},
+        {"IfcReference", "AttributeIdentifier"},
+        {"IfcReference", "InstanceName"},
+        {"IfcReference", "ListPositions"},
+        {"IfcReference", "InnerReference"},
+        {"IfcRegularTimeSeries", "TimeStep"},
+        {"IfcRegularTimeSeries", "Values"},
+        {"IfcReinforcementBarProperties", "TotalCrossSectionArea"},
+        {"IfcReinforcementBarProperties", "SteelGrade"},
+        {"IfcReinforcementBarProperties", "BarSurface"},
+        {"IfcReinforcementBarProperties", "EffectiveDepth"},
+        {"IfcReinforcementBarProperties", "NominalBarDiameter"},
+        {"IfcReinforcementBarProperties", "BarCount"},
+        {"IfcReinforcementDefinitionProperties", "DefinitionType"},
+        {"IfcReinforcementDefinitionProperties", "ReinforcementSectionDefinitions"},
+        {"IfcReinforcingElement", "SteelGrade"},
+        {"IfcReinforcingBar", "NominalDiameter"},
+        {"IfcReinforcingBar", "CrossSectionArea"},
+        {"IfcReinforcingBar", "BarLength"},
+        {"IfcReinforcingBar", "PredefinedType"},
+        {"IfcReinforcingBar", "BarSurface"},
+        {"IfcReinforcingBarType", "PredefinedType"},
+        {"IfcReinforcingBarType", "NominalDiameter"},
+        {"IfcReinforcingBarType", "CrossSectionArea"},
+        {"IfcReinforcingBarType", "BarLength"},
+        {"IfcReinforcingBarType", "BarSurface"},
+        {"IfcReinforcingBarType", "BendingShapeCode"},
+        {"IfcReinforcingBarType", "BendingParameters"},
+        {"IfcReinforcingMesh", "MeshLength"},
+        {"IfcReinforcingMesh", "MeshWidth"},
+        {"IfcReinforcingMesh", "LongitudinalBarNominalDiameter"},
+        {"IfcReinforcingMesh", "TransverseBarNominalDiameter"},
+        {"IfcReinforcingMesh", "LongitudinalBarCrossSectionArea"},
+        {"IfcReinforcingMesh", "TransverseBarCrossSectionArea"},
+        {"IfcReinforcingMesh", "LongitudinalBarSpacing"},
+        {"IfcReinforcingMesh", "TransverseBarSpacing"},
+        {"IfcReinforcingMesh", "PredefinedType"},
+        {"IfcReinforcingMeshType", "PredefinedType"},
+        {"IfcReinforcingMeshType", "MeshLength"},
+        {"IfcReinforcingMeshType", "MeshWidth"},
+        {"IfcReinforcingMeshType", "LongitudinalBarNominalDiameter"},
+        {"IfcReinforcingMeshType", "TransverseBarNominalDiameter"},
+        {"IfcReinforcingMeshType", "LongitudinalBarCrossSectionArea"},
+        {"IfcReinforcingMeshType", "TransverseBarCrossSectionArea"},
+        {"IfcReinforcingMeshType", "LongitudinalBarSpacing"},
+        {"IfcReinforcingMeshType", "TransverseBarSpacing"},
+        {"IfcReinforcingMeshType", "BendingShapeCode"},
+        {"IfcReinforcingMeshType", "BendingParameters"},
+        {"IfcRelAggregates", "RelatingObject"},
+        {"IfcRelAggregates", "RelatedObjects"},
+        {"IfcRelAssigns", "RelatedObjects"},
+        {"IfcRelAssigns", "RelatedObjectsType"},
+        {"IfcRelAssignsToActor", "RelatingActor"},
+        {"IfcRelAssignsToActor", "ActingRole"},
+        {"IfcRelAssignsToControl", "RelatingControl"},
+        {"IfcRelAssignsToGroup", "RelatingGroup"},
+        {"IfcRelAssignsToGroupByFactor", "Factor"},
+        {"IfcRelAssignsToProcess", "RelatingProcess"},
+        {"IfcRelAssignsToProcess", "QuantityInProcess"},
+        {"IfcRelAssignsToProduct", "RelatingProduct"},
+        {"IfcRelAssignsToResource", "RelatingResource"},
+        {"IfcRelAssociates", "RelatedObjects"},
+        {"IfcRelAssociatesApproval", "RelatingApproval"},
+        {"IfcRelAssociatesClassification", "RelatingClassification"},
+        {"IfcRelAssociatesConstraint", "Intent"},
+        {"IfcRelAssociatesConstraint", "RelatingConstraint"},
+        {"IfcRelAssociatesDocument", "RelatingDocument"},
+        {"IfcRelAssociatesLibrary", "RelatingLibrary"},
+        {"IfcRelAssociatesMaterial", "RelatingMaterial"},
+        {"IfcRelConnectsElements", "ConnectionGeometry"},
+        {"IfcRelConnectsElements", "RelatingElement"},
+        {"IfcRelConnectsElements", "RelatedElement"},
+        {"IfcRelConnectsPathElements", "RelatingPriorities"},
+        {"IfcRelConnectsPathElements", "RelatedPriorities"},
+        {"IfcRelConnectsPathElements", "RelatedConnectionType"},
+        {"IfcRelConnectsPathElements", "RelatingConnectionType"},
+        {"IfcRelConnectsPorts", "RelatingPort"},
+        {"IfcRelConnectsPorts", "RelatedPort"},
+        {"IfcRelConnectsPorts", "RealizingElement"},
+        {"IfcRelConnectsPortToElement", "RelatingPort"},
+        {"IfcRelConnectsPortToElement", "RelatedElement"},
+        {"IfcRelConnectsStructuralActivity", "RelatingElement"},
+        {"IfcRelConnectsStructuralActivity", "RelatedStructuralActivity"},
+        {"IfcRelConnectsStructuralMember", "RelatingStructuralMember"},
+        {"IfcRelConnectsStructuralMember", "RelatedStructuralConnection"},
+        {"IfcRelConnectsStructuralMember", "AppliedCondition"},
+        {"IfcRelConnectsStructuralMember", "AdditionalConditions"},
+        {"IfcRelConnectsStructuralMember", "SupportedLength"},
+        {"IfcRelConnectsStructuralMember", "ConditionCoordinateSystem"},
+        {"IfcRelConnectsWithEccentricity", "ConnectionConstraint"},
+        {"IfcRelConnectsWithRealizingElements", "RealizingElements"},
+        {"IfcRelConnectsWithRealizingElements", "ConnectionType"},
+        {"IfcRelContainedInSpatialStructure", "RelatedElements"},
+        {"IfcRelContainedInSpatialStructure", "RelatingStructure"},
+        {"IfcRelCoversBldgElements", "RelatingBuildingElement"},
+        {"IfcRelCoversBldgElements", "RelatedCoverings"},
+        {"IfcRelCoversSpaces", "RelatingSpace"},
+        {"IfcRelCoversSpaces", "RelatedCoverings"},
+        {"IfcRelDeclares", "RelatingContext"},
+        {"IfcRelDeclares", "RelatedDefinitions"},
+        {"IfcRelDefinesByObject", "RelatedObjects"},
+        {"IfcRelDefinesByObject", "RelatingObject"},
+        {"IfcRelDefinesByProperties", "RelatedObjects"},
+        {"IfcRelDefinesByProperties", "RelatingPropertyDefinition"},
+        {"IfcRelDefinesByTemplate", "RelatedPropertySets"},
+        {"IfcRelDefinesByTemplate", "RelatingTemplate"},
+        {"IfcRelDefinesByType", "RelatedObjects"},
+        {"IfcRelDefinesByType", "RelatingType"},
+        {"IfcRelFillsElement", "RelatingOpeningElement"},
+        {"IfcRelFillsElement", "RelatedBuildingElement"},
+        {"IfcRelFlowControlElements", "RelatedControlElements"},
+        {"IfcRelFlowControlElements", "RelatingFlowElement"},
+        {"IfcRelInterferesElements", "RelatingElement"},
+        {"IfcRelInterferesElements", "RelatedElement"},
+        {"IfcRelInterferesElements", "InterferenceGeometry"},
+        {"IfcRelInterferesElements", "InterferenceType"},
+        {"IfcRelInterferesElements", "ImpliedOrder"},
+        {"IfcRelNests", "RelatingObject"},
+        {"IfcRelNests", "RelatedObjects"},
+        {"IfcRelProjectsElement", "RelatingElement"},
+        {"IfcRelProjectsElement", "RelatedFeatureElement"},
+        {"IfcRelReferencedInSpatialStructure", "RelatedElements"},
+        {"IfcRelReferencedInSpatialStructure", "RelatingStructure"},
+        {"IfcRelSequence", "RelatingProcess"},
+        {"IfcRelSequence", "RelatedProcess"},
+        {"IfcRelSequence", "TimeLag"},
+        {"IfcRelSequence", "SequenceType"},
+        {"IfcRelSequence", "UserDefinedSequenceType"},
+        {"IfcRelServicesBuildings", "RelatingSystem"},
+        {"IfcRelServicesBuildings", "RelatedBuildings"},
+        {"IfcRelSpaceBoundary", "RelatingSpace"},
+        {"IfcRelSpaceBoundary", "RelatedBuildingElement"},
+        {"IfcRelSpaceBoundary", "ConnectionGeometry"},
+        {"IfcRelSpaceBoundary", "PhysicalOrVirtualBoundary"},
+        {"IfcRelSpaceBoundary", "InternalOrExternalBoundary"},
+        {"IfcRelSpaceBoundary1stLevel", "ParentBoundary"},
+        {"IfcRelSpaceBoundary1stLevel", "InnerBoundaries"},
+        {"IfcRelSpaceBoundary2ndLevel", "CorrespondingBoundary"},
+        {"IfcRelSpaceBoundary2ndLevel", "Corresponds"},
+        {"IfcRelVoidsElement", "RelatingBuildingElement"},
+        {"IfcRelVoidsElement", "RelatedOpeningElement"},
+        {"IfcReparametrisedCompositeCurveSegment", "ParamLength"},
+        {"IfcRepresentation", "ContextOfItems"},
+        {"IfcRepresentation", "RepresentationIdentifier"},
+        {"IfcRepresentation", "RepresentationType"},
+        {"IfcRepresentation", "Items"},
+        {"IfcRepresentation", "RepresentationMap"},
+        {"IfcRepresentation", "LayerAssignments"},
+        {"IfcRepresentation", "OfProductRepresentation"},
+        {"IfcRepresentationMap", "MappingOrigin"},
+        {"IfcRepresentationMap", "MappedRepresentation"},
+        {"IfcRepresentationMap", "HasShapeAspects"},
+        {"IfcRepresentationMap", "MapUsage"},
+        {"IfcResourceApprovalRelationship", "RelatedResourceObjects"},
+        {"IfcResourceApprovalRelationship", "RelatingApproval"},
+        {"IfcResourceConstraintRelationship", "RelatingConstraint"},
+        {"IfcResourceConstraintRelationship", "RelatedResourceObjects"},
+        {"IfcResourceTime", "ScheduleWork"},
+        {"IfcResourceTime", "ScheduleUsage"},
+        {"IfcResourceTime", "ScheduleStart"},
+        {"IfcResourceTime", "ScheduleFinish"},
+        {"IfcResourceTime", "ScheduleContour"},
+        {"IfcResourceTime", "LevelingDelay"},
+        {"IfcResourceTime", "IsOverAllocated"},
+        {"IfcResourceTime", "StatusTime"},
+        {"IfcResourceTime", "ActualWork"},
+        {"IfcResourceTime", "ActualUsage"},
+        {"IfcResourceTime", "ActualStart"},
+        {"IfcResourceTime", "ActualFinish"},
+        {"IfcResourceTime", "RemainingWork"},
+        {"IfcResourceTime", "RemainingUsage"},
+        {"IfcResourceTime", "Completion"},
+        {"IfcRevolvedAreaSolid", "Axis"},
+        {"IfcRevolvedAreaSolid", "Angle"},
+        {"IfcRevolvedAreaSolid", "AxisLine"},
+        {"IfcRevolvedAreaSolidTapered", "EndSweptArea"},
+        {"IfcRightCircularCone", "Height"},
+        {"IfcRightCircularCone", "BottomRadius"},
+        {"IfcRightCircularCylinder", "Height"},
+        {"IfcRightCircularCylinder", "Radius"},
+        {"IfcRoof", "PredefinedType"},
+        {"IfcRoofType", "PredefinedType"},
+        {"IfcRoundedRectangleProfileDef", "RoundingRadius"},
+        {"IfcSanitaryTerminal", "PredefinedType"},
+        {"IfcSanitaryTerminalType", "PredefinedType"},
+        {"IfcSectionedSpine", "SpineCurve"},
+        {"IfcSectionedSpine", "CrossSections"},
+        {"IfcSectionedSpine", "CrossSectionPositions"},
+        {"IfcSectionedSpine", "Dim"},
+        {"IfcSectionProperties", "SectionType"},
+        {"IfcSectionProperties", "StartProfile"},
+        {"IfcSectionProperties", "EndProfile"},
+        {"IfcSectionReinforcementProperties", "LongitudinalStartPosition"},
+        {"IfcSectionReinforcementProperties", "LongitudinalEndPosition"},
+        {"IfcSectionReinforcementProperties", "TransversePosition"},
+        {"IfcSectionReinforcementProperties", "ReinforcementRole"},
+        {"IfcSectionReinforcementProperties", "SectionDefinition"},
+        {"IfcSectionReinforcementProperties", "CrossSectionReinforcementDefinitions"},
+        {"IfcSensor", "PredefinedType"},
+        {"IfcSensorType", "PredefinedType"},
+        {"IfcShadingDevice", "PredefinedType"},
+        {"IfcShadingDeviceType", "PredefinedType"},
+        {"IfcShapeAspect", "ShapeRepresentations"},
+        {"IfcShapeAspect", "Name"},
+        {"IfcShapeAspect", "Description"},
+        {"IfcShapeAspect", "ProductDefinitional"},
+        {"IfcShapeAspect", "PartOfProductDefinitionShape"},
+        {"IfcShapeModel", "OfShapeAspect"},
+        {"IfcShellBasedSurfaceModel", "SbsmBoundary"},
+        {"IfcShellBasedSurfaceModel", "Dim"},
+        {"IfcSimplePropertyTemplate", "TemplateType"},
+        {"IfcSimplePropertyTemplate", "PrimaryMeasureType"},
+        {"IfcSimplePropertyTemplate", "SecondaryMeasureType"},
+        {"IfcSimplePropertyTemplate", "Enumerators"},
+        {"IfcSimplePropertyTemplate", "PrimaryUnit"},
+        {"IfcSimplePropertyTemplate", "SecondaryUnit"},
+        {"IfcSimplePropertyTemplate", "Expression"},
+        {"IfcSimplePropertyTemplate", "AccessState"},
+        {"IfcSite", "RefLatitude"},
+        {"IfcSite", "RefLongitude"},
+        {"IfcSite", "RefElevation"},
+        {"IfcSite", "LandTitleNumber"},
+        {"IfcSite", "SiteAddress"},
+        {"IfcSIUnit", "Prefix"},
+        {"IfcSIUnit", "Name"},
+        {"IfcSlab", "PredefinedType"},
+        {"IfcSlabType", "PredefinedType"},
+        {"IfcSlippageConnectionCondition", "SlippageX"},
+        {"IfcSlippageConnectionCondition", "SlippageY"},
+        {"IfcSlippageConnectionCondition", "SlippageZ"},
+        {"IfcSolarDevice", "PredefinedType"},
+        {"IfcSolarDeviceType", "PredefinedType"},
+        {"IfcSpace", "PredefinedType"},
+        {"IfcSpace", "ElevationWithFlooring"},
+        {"IfcSpace", "HasCoverings"},
+        {"IfcSpace", "BoundedBy"},
+        {"IfcSpaceHeater", "PredefinedType"},
+        {"IfcSpaceHeaterType", "PredefinedType"},
+        {"IfcSpatialElementType", "ElementType"},
+        {"IfcSpaceType", "PredefinedType"},
+        {"IfcSpaceType", "LongName"},
+        {"IfcSpatialZone", "PredefinedType"},
+        {"IfcSpatialZoneType", "PredefinedType"},
+        {"IfcSpatialZoneType", "LongName"},
+        {"IfcSphere", "Radius"},
+        {"IfcSphericalSurface", "Radius"},
+        {"IfcStackTerminal", "PredefinedType"},
+        {"IfcStackTerminalType", "PredefinedType"},
+        {"IfcStair", "PredefinedType"},
+        {"IfcStairFlight", "NumberOfRisers"},
+        {"IfcStairFlight", "NumberOfTreads"},
+        {"IfcStairFlight", "RiserHeight"},
+        {"IfcStairFlight", "TreadLength"},
+        {"IfcStairFlight", "PredefinedType"},
+        {"IfcStairFlightType", "PredefinedType"},
+        {"IfcStairType", "PredefinedType"},
+        {"IfcStructuralActivity", "AppliedLoad"},
+        {"IfcStructuralActivity", "GlobalOrLocal"},
+        {"IfcStructuralActivity", "AssignedToStructuralItem"},
+        {"IfcStructuralAction", "DestabilizingLoad"},
+        {"IfcStructuralAnalysisModel", "PredefinedType"},
+        {"IfcStructuralAnalysisModel", "OrientationOf2DPlane"},
+        {"IfcStructuralAnalysisModel", "LoadedBy"},
+        {"IfcStructuralAnalysisModel", "HasResults"},
+        {"IfcStructuralAnalysisModel", "SharedPlacement"},
+        {"IfcStructuralItem", "AssignedStructuralActivity"},
+        {"IfcStructuralConnection", "AppliedCondition"},
+        {"IfcStructuralConnection", "ConnectsStructuralMembers"},
+        {"IfcStructuralCurveAction", "ProjectedOrTrue"},
+        {"IfcStructuralCurveAction", "PredefinedType"},
+        {"IfcStructuralCurveConnection", "Axis"},
+        {"IfcStructuralMember", "ConnectedBy"},
+        {"IfcStructuralCurveMember", "PredefinedType"},
+        {"IfcStructuralCurveMember", "Axis"},
+        {"IfcStructuralCurveReaction", "PredefinedType"},
+        {"IfcStructuralLoad", "Name"},
+        {"IfcStructuralLoadGroup", "PredefinedType"},
+        {"IfcStructuralLoadGroup", "ActionType"},
+        {"IfcStructuralLoadGroup", "ActionSource"},
+        {"IfcStructuralLoadGroup", "Coefficient"},
+        {"IfcStructuralLoadGroup", "Purpose"},
+        {"IfcStructuralLoadGroup", "SourceOfResultGroup"},
+        {"IfcStructuralLoadGroup", "LoadGroupFor"},
+        {"IfcStructuralLoadCase", "SelfWeightCoefficients"},
+        {"IfcStructuralLoadConfiguration", "Values"},
+        {"IfcStructuralLoadConfiguration", "Locations"},
+        {"IfcStructuralLoadLinearForce", "LinearForceX"},
+        {"IfcStructuralLoadLinearForce", "LinearForceY"},
+        {"IfcStructuralLoadLinearForce", "LinearForceZ"},
+        {"IfcStructuralLoadLinearForce", "LinearMomentX"},
+        {"IfcStructuralLoadLinearForce", "LinearMomentY"},
+        {"IfcStructuralLoadLinearForce", "LinearMomentZ"},
+        {"IfcStructuralLoadPlanarForce", "PlanarForceX"},
+        {"IfcStructuralLoadPlanarForce", "PlanarForceY"},
+        {"IfcStructuralLoadPlanarForce", "PlanarForceZ"},
+        {"IfcStructuralLoadSingleDisplacement", "DisplacementX"},
+        {"IfcStructuralLoadSingleDisplacement", "DisplacementY"},
+        {"IfcStructuralLoadSingleDisplacement", "DisplacementZ"},
+        {"IfcStructuralLoadSingleDisplacement", "RotationalDisplacementRX"},
+        {"IfcStructuralLoadSingleDisplacement", "RotationalDisplacementRY"},
+        {"IfcStructuralLoadSingleDisplacement", "RotationalDisplacementRZ"},
+        {"IfcStructuralLoadSingleDisplacementDistortion", "Distortion"},
+        {"IfcStructuralLoadSingleForce", "ForceX"},
+        {"IfcStructuralLoadSingleForce", "ForceY"},
+        {"IfcStructuralLoadSingleForce", "ForceZ"},
+        {"IfcStructuralLoadSingleForce", "MomentX"},
+        {"IfcStructuralLoadSingleForce", "MomentY"},
+        {"IfcStructuralLoadSingleForce", "MomentZ"},
+        {"IfcStructuralLoadSingleForceWarping", "WarpingMoment"},
+        {"IfcStructuralLoadTemperature", "DeltaTConstant"},
+        {"IfcStructuralLoadTemperature", "DeltaTY"},
+        {"IfcStructuralLoadTemperature", "DeltaTZ"},
+        {"IfcStructuralSurfaceAction", "ProjectedOrTrue"},
+        {"IfcStructuralSurfaceAction", "PredefinedType"},
+        {"IfcStructuralPointConnection", "ConditionCoordinateSystem"},
+        {"IfcStructuralResultGroup", "TheoryType"},
+        {"IfcStructuralResultGroup", "ResultForLoadGroup"},
+        {"IfcStructuralResultGroup", "IsLinear"},
+        {"IfcStructuralResultGroup", "ResultGroupFor"},
+        {"IfcStructuralSurfaceMember", "PredefinedType"},
+        {"IfcStructuralSurfaceMember", "Thickness"},
+        {"IfcStructuralSurfaceReaction", "PredefinedType"},
+        {"IfcStyledItem", "Item"},
+        {"IfcStyledItem", "Styles"},
+        {"IfcStyledItem", "Name"},
+        {"IfcSubContractResource", "PredefinedType"},
+        {"IfcSubContractResourceType", "PredefinedType"},
+        {"IfcSubedge", "ParentEdge"},
+        {"IfcSurfaceCurveSweptAreaSolid", "Directrix"},
+        {"IfcSurfaceCurveSweptAreaSolid", "StartParam"},
+        {"IfcSurfaceCurveSweptAreaSolid", "EndParam"},
+        {"IfcSurfaceCurveSweptAreaSolid", "ReferenceSurface"},
+        {"IfcSurfaceFeature", "PredefinedType"},
+        {"IfcSweptSurface", "SweptCurve"},
+        {"IfcSweptSurface", "Position"},
+        {"IfcSurfaceOfLinearExtrusion", "ExtrudedDirection"},
+        {"IfcSurfaceOfLinearExtrusion", "Depth"},
+        {"IfcSurfaceOfLinearExtrusion", "ExtrusionAxis"},
+        {"IfcSurfaceOfRevolution", "AxisPosition"},
+        {"IfcSurfaceOfRevolution", "AxisLine"},
+        {"IfcSurfaceReinforcementArea", "SurfaceReinforcement1"},
+        {"IfcSurfaceReinforcementArea", "SurfaceReinforcement2"},
+        {"IfcSurfaceReinforcementArea", "ShearReinforcement"},
+        {"IfcSurfaceStyle", "Side"},
+        {"IfcSurfaceStyle", "Styles"},
+        {"IfcSurfaceStyleLighting", "DiffuseTransmissionColour"},
+        {"IfcSurfaceStyleLighting", "DiffuseReflectionColour"},
+        {"IfcSurfaceStyleLighting", "TransmissionColour"},
+        {"IfcSurfaceStyleLighting", "ReflectanceColour"},
+        {"IfcSurfaceStyleRefraction", "RefractionIndex"},
+        {"IfcSurfaceStyleRefraction", "DispersionFactor"},
+        {"IfcSurfaceStyleShading", "SurfaceColour"},
+        {"IfcSurfaceStyleShading", "Transparency"},
+        {"IfcSurfaceStyleRendering", "DiffuseColour"},
+        {"IfcSurfaceStyleRendering", "TransmissionColour"},
+        {"IfcSurfaceStyleRendering", "DiffuseTransmissionColour"},
+        {"IfcSurfaceStyleRendering", "ReflectionColour"},
+        {"IfcSurfaceStyleRendering", "SpecularColour"},
+        {"IfcSurfaceStyleRendering", "SpecularHighlight"},
+        {"IfcSurfaceStyleRendering", "ReflectanceMethod"},
+        {"IfcSurfaceStyleWithTextures", "Textures"},
+        {"IfcSweptDiskSolid", "Directrix"},
+        {"IfcSweptDiskSolid", "Radius"},
+        {"IfcSweptDiskSolid", "InnerRadius"},
+        {"IfcSweptDiskSolid", "StartParam"},
+        {"IfcSweptDiskSolid", "EndParam"},
+        {"IfcSweptDiskSolidPolygonal", "FilletRadius"},
+        {"IfcSwitchingDevice", "PredefinedType"},
+        {"IfcSwitchingDeviceType", "PredefinedType"},
+        {"IfcSystemFurnitureElement", "PredefinedType"},
+        {"IfcSystemFurnitureElementType", "PredefinedType"},
+        {"IfcTable", "Name"},
+        {"IfcTable", "Rows"},
+        {"IfcTable", "Columns"},
+        {"IfcTable", "NumberOfCellsInRow"},
+        {"IfcTable", "NumberOfHeadings"},
+        {"IfcTable", "NumberOfDataRows"},
+        {"IfcTableColumn", "Identifier"},
+        {"IfcTableColumn", "Name"},
+        {"IfcTableColumn", "Description"},
+        {"IfcTableColumn", "Unit"},
+        {"IfcTableColumn", "ReferencePath"},
+        {"IfcTableRow", "RowCells"},
+        {"IfcTableRow", "IsHeading"},
+        {"IfcTank", "PredefinedType"},
+        {"IfcTankType", "PredefinedType"},
+        {"IfcTask", "Status"},
+        {"IfcTask", "WorkMethod"},
+        {"IfcTask", "IsMilestone"},
+        {"IfcTask", "Priority"},
+        {"IfcTask", "TaskTime"},
+        {"IfcTask", "PredefinedType"},
+        {"IfcTaskTime", "DurationType"},
+        {"IfcTaskTime", "ScheduleDuration"},
+        {"IfcTaskTime", "ScheduleStart"},
+        {"IfcTaskTime", "ScheduleFinish"},
+        {"IfcTaskTime", "EarlyStart"},
+        {"IfcTaskTime", "EarlyFinish"},
+        {"IfcTaskTime", "LateStart"},
+        {"IfcTaskTime", "LateFinish"},
+        {"IfcTaskTime", "FreeFloat"},
+        {"IfcTaskTime", "TotalFloat"},
+        {"IfcTaskTime", "IsCritical"},
+        {"IfcTaskTime", "StatusTime"},
+        {"IfcTaskTime", "ActualDuration"},
+        {"IfcTaskTime", "ActualStart"},
+        {"IfcTaskTime", "ActualFinish"},
+        {"IfcTaskTime", "RemainingTime"},
+        {"IfcTaskTime", "Completion"},
+        {"IfcTaskTimeRecurring", "Recurrence"},
+        {"IfcTaskType", "PredefinedType"},
+        {"IfcTaskType", "WorkMethod"},
+        {"IfcTelecomAddress", "TelephoneNumbers"},
+        {"IfcTelecomAddress", "FacsimileNumbers"},
+        {"IfcTelecomAddress", "PagerNumber"},
+        {"IfcTelecomAddress", "ElectronicMailAddresses"},
+        {"IfcTelecomAddress", "WWWHomePageURL"},
+        {"IfcTelecomAddress", "MessagingIDs"},
+        {"IfcTendon", "PredefinedType"},
+        {"IfcTendon", "NominalDiameter"},
+        {"IfcTendon", "CrossSectionArea"},
+        {"IfcTendon", "TensionForce"},
+        {"IfcTendon", "PreStress"},
+        {"IfcTendon", "FrictionCoefficient"},
+        {"IfcTendon", "AnchorageSlip"},
+        {"IfcTendon", "MinCurvatureRadius"},
+        {"IfcTendonAnchor", "PredefinedType"},
+        {"IfcTendonAnchorType", "PredefinedType"},
+        {"IfcTendonType", "PredefinedType"},
+        {"IfcTendonType", "NominalDiameter"},
+        {"IfcTendonType", "CrossSectionArea"},
+        {"IfcTendonType", "SheathDiameter"},
+        {"IfcTextLiteral", "Literal"},
+        {"IfcTextLiteral", "Placement"},
+        {"IfcTextLiteral", "Path"},
+        {"IfcTextLiteralWithExtent", "Extent"},
+        {"IfcTextLiteralWithExtent", "BoxAlignment"},
+        {"IfcTextStyle", "TextCharacterAppearance"},
+        {"IfcTextStyle", "TextStyle"},
+        {"IfcTextStyle", "TextFontStyle"},
+        {"IfcTextStyle", "ModelOrDraughting"},
+        {"IfcTextStyleFontModel", "FontFamily"},
+        {"IfcTextStyleFontModel", "FontStyle"},
+        {"IfcTextStyleFontModel", "FontVariant"},
+        {"IfcTextStyleFontModel", "FontWeight"},
+        {"IfcTextStyleFontModel", "FontSize"},
+        {"IfcTextStyleForDefinedFont", "Colour"},
+        {"IfcTextStyleForDefinedFont", "BackgroundColour"},
+        {"IfcTextStyleTextModel", "TextIndent"},
+        {"IfcTextStyleTextModel", "TextAlign"},
+        {"IfcTextStyleTextModel", "TextDecoration"},
+        {"IfcTextStyleTextModel", "LetterSpacing"},
+        {"IfcTextStyleTextModel", "WordSpacing"},
+        {"IfcTextStyleTextModel", "TextTransform"},
+        {"IfcTextStyleTextModel", "LineHeight"},
+        {"IfcTextureCoordinateGenerator", "Mode"},
+        {"IfcTextureCoordinateGenerator", "Parameter"},
+        {"IfcTextureMap", "Vertices"},
+        {"IfcTextureMap", "MappedTo"},
+        {"IfcTextureVertex", "Coordinates"},
+        {"IfcTextureVertexList", "TexCoordsList"},
+        {"IfcTimePeriod", "StartTime"},
+        {"IfcTimePeriod", "EndTime"},
+        {"IfcTimeSeriesValue", "ListValues"},
+        {"IfcToroidalSurface", "MajorRadius"},
+        {"IfcToroidalSurface", "MinorRadius"},
+        {"IfcTransformer", "PredefinedType"},
+        {"IfcTransformerType", "PredefinedType"},
+        {"IfcTransportElement", "PredefinedType"},
+        {"IfcTransportElementType", "PredefinedType"},
+        {"IfcTrapeziumProfileDef", "BottomXDim"},
+        {"IfcTrapeziumProfileDef", "TopXDim"},
+        {"IfcTrapeziumProfileDef", "YDim"},
+        {"IfcTrapeziumProfileDef", "TopXOffset"},
+        {"IfcTriangulatedFaceSet", "Normals"},
+        {"IfcTriangulatedFaceSet", "Closed"},
+        {"IfcTriangulatedFaceSet", "CoordIndex"},
+        {"IfcTriangulatedFaceSet", "PnIndex"},
+        {"IfcTriangulatedFaceSet", "NumberOfTriangles"},
+        {"IfcTrimmedCurve", "BasisCurve"},
+        {"IfcTrimmedCurve", "Trim1"},
+        {"IfcTrimmedCurve", "Trim2"},
+        {"IfcTrimmedCurve", "SenseAgreement"},
+        {"IfcTrimmedCurve", "MasterRepresentation"},
+        {"IfcTShapeProfileDef", "Depth"},
+        {"IfcTShapeProfileDef", "FlangeWidth"},
+        {"IfcTShapeProfileDef", "WebThickness"},
+        {"IfcTShapeProfileDef", "FlangeThickness"},
+        {"IfcTShapeProfileDef", "FilletRadius"},
+        {"IfcTShapeProfileDef", "FlangeEdgeRadius"},
+        {"IfcTShapeProfileDef", "WebEdgeRadius"},
+        {"IfcTShapeProfileDef", "WebSlope"},
+        {"IfcTShapeProfileDef", "FlangeSlope"},
+        {"IfcTubeBundle", "PredefinedType"},
+        {"IfcTubeBundleType", "PredefinedType"},
+        {"IfcUnitaryControlElement", "PredefinedType"},
+        {"IfcUnitaryControlElementType", "PredefinedType"},
+        {"IfcUnitaryEquipment", "PredefinedType"},
+        {"IfcUnitaryEquipmentType", "PredefinedType"},
+        {"IfcUnitAssignment", "Units"},
+        {"IfcUShapeProfileDef", "Depth"},
+        {"IfcUShapeProfileDef", "FlangeWidth"},
+        {"IfcUShapeProfileDef", "WebThickness"},
+        {"IfcUShapeProfileDef", "FlangeThickness"},
+        {"IfcUShapeProfileDef", "FilletRadius"},
+        {"IfcUShapeProfileDef", "EdgeRadius"},
+        {"IfcUShapeProfileDef", "FlangeSlope"},
+        {"IfcValve", "PredefinedType"},
+        {"IfcValveType", "PredefinedType"},
+        {"IfcVector", "Orientation"},
+        {"IfcVector", "Magnitude"},
+        {"IfcVector", "Dim"},
+        {"IfcVertexLoop", "LoopVertex"},
+        {"IfcVertexPoint", "VertexGeometry"},
+        {"IfcVibrationIsolator", "PredefinedType"},
+        {"IfcVibrationIsolatorType", "PredefinedType"},
+        {"IfcVirtualGridIntersection", "IntersectingAxes"},
+        {"IfcVirtualGridIntersection", "OffsetDistances"},
+        {"IfcVoidingFeature", "PredefinedType"},
+        {"IfcWall", "PredefinedType"},
+        {"IfcWallType", "PredefinedType"},
+        {"IfcWasteTerminal", "PredefinedType"},
+        {"IfcWasteTerminalType", "PredefinedType"},
+        {"IfcWindow", "OverallHeight"},
+        {"IfcWindow", "OverallWidth"},
+        {"IfcWindow", "PredefinedType"},
+        {"IfcWindow", "PartitioningType"},
+        {"IfcWindow", "UserDefinedPartitioningType"},
+        {"IfcWindowLiningProperties", "LiningDepth"},
+        {"IfcWindowLiningProperties", "LiningThickness"},
+        {"IfcWindowLiningProperties", "TransomThickness"},
+        {"IfcWindowLiningProperties", "MullionThickness"},
+        {"IfcWindowLiningProperties", "FirstTransomOffset"},
+        {"IfcWindowLiningProperties", "SecondTransomOffset"},
+        {"IfcWindowLiningProperties", "FirstMullionOffset"},
+        {"IfcWindowLiningProperties", "SecondMullionOffset"},
+        {"IfcWindowLiningProperties", "ShapeAspectStyle"},
+        {"IfcWindowLiningProperties", "LiningOffset"},
+        {"IfcWindowLiningProperties", "LiningToPanelOffsetX"},
+        {"IfcWindowLiningProperties", "LiningToPanelOffsetY"},
+        {"IfcWindowPanelProperties", "OperationType"},
+        {"IfcWindowPanelProperties", "PanelPosition"},
+        {"IfcWindowPanelProperties", "FrameDepth"},
+        {"IfcWindowPanelProperties", "FrameThickness"},
+        {"IfcWindowPanelProperties", "ShapeAspectStyle"},
+        {"IfcWindowStyle", "ConstructionType"},
+        {"IfcWindowStyle", "OperationType"},
+        {"IfcWindowStyle", "ParameterTakesPrecedence"},
+        {"IfcWindowStyle", "Sizeable"},
+        {"IfcWindowType", "PredefinedType"},
+        {"IfcWindowType", "PartitioningType"},
+        {"IfcWindowType", "ParameterTakesPrecedence"},
+        {"IfcWindowType", "UserDefinedPartitioningType"},
+        {"IfcWorkCalendar", "WorkingTimes"},
+        {"IfcWorkCalendar", "ExceptionTimes"},
+        {"IfcWorkCalendar", "PredefinedType"},
+        {"IfcWorkControl", "CreationDate"},
+        {"IfcWorkControl", "Creators"},
+        {"IfcWorkControl", "Purpose"},
+        {"IfcWorkControl", "Duration"},
+        {"IfcWorkControl", "TotalFloat"},
+        {"IfcWorkControl", "StartTime"},
+        {"IfcWorkControl", "FinishTime"},
+        {"IfcWorkPlan", "PredefinedType"},
+        {"IfcWorkSchedule", "PredefinedType"},
+        {"IfcWorkTime", "RecurrencePattern"},
+        {"IfcWorkTime", "Start"},
+        {"IfcWorkTime", "Finish"},
+        {"IfcZone", "LongName"},
+        {"IfcZShapeProfileDef", "Depth"},
+        {"IfcZShapeProfileDef", "FlangeWidth"},
+        {"IfcZShapeProfileDef", "WebThickness"},
+        {"IfcZShapeProfileDef", "FlangeThickness"},
+        {"IfcZShapeProfileDef", "FilletRadius"},
+        {"IfcZShapeProfileDef", "EdgeRadius"},
+        {NULL, NULL}
+    };
+
+    inline const AttributeName* SchemaAttributes(IntValue& count)
+    {
+        count = sizeof(SchemaAttributes_) / sizeof(SchemaAttributes_[0]) - 1;
+        return SchemaAttributes_;
+    }
+
+    //
+    // Type paths of SELECT values, indexed by type path id
+    //
+    static const TextValue SchemaTypePaths_[] = {
+        "IFCABSORBEDDOSEMEASURE",
+        "IFCACCELERATIONMEASURE",
+        "IFCANGULARVELOCITYMEASURE",
+        "IFCAREADENSITYMEASURE",
+        "IFCCOMPOUNDPLANEANGLEMEASURE",
+        "IFCCURVATUREMEASURE",
+        "IFCDOSEEQUIVALENTMEASURE",
+        "IFCDYNAMICVISCOSITYMEASURE",
+        "IFCELECTRICCAPACITANCEMEASURE",
+        "IFCELECTRICCHARGEMEASURE",
+        "IFCELECTRICCONDUCTANCEMEASURE",
+        "IFCELECTRICRESISTANCEMEASURE",
+        "IFCELECTRICVOLTAGEMEASURE",
+        "IFCENERGYMEASURE",
+        "IFCFORCEMEASURE",
+        "IFCFREQUENCYMEASURE",
+        "IFCHEATFLUXDENSITYMEASURE",
+        "IFCHEATINGVALUEMEASURE",
+        "IFCILLUMINANCEMEASURE",
+        "IFCINDUCTANCEMEASURE",
+        "IFCINTEGERCOUNTRATEMEASURE",
+        "IFCIONCONCENTRATIONMEASURE",
+        "IFCISOTHERMALMOISTURECAPACITYMEASURE",
+        "IFCKINEMATICVISCOSITYMEASURE",
+        "IFCLINEARFORCEMEASURE",
+        "IFCLINEARMOMENTMEASURE",
+        "IFCLINEARSTIFFNESSMEASURE",
+        "IFCLINEARVELOCITYMEASURE",
+        "IFCLUMINOUSFLUXMEASURE",
+        "IFCLUMINOUSINTENSITYDISTRIBUTIONMEASURE",
+        "IFCMAGNETICFLUXDENSITYMEASURE",
+        "IFCMAGNETICFLUXMEASURE",
+        "IFCMASSDENSITYMEASURE",
+        "IFCMASSFLOWRATEMEASURE",
+        "IFCMASSPERLENGTHMEASURE",
+        "IFCMODULUSOFELASTICITYMEASURE",
+        "IFCMODULUSOFLINEARSUBGRADEREACTIONMEASURE",
+        "IFCMODULUSOFROTATIONALSUBGRADEREACTIONMEASURE",
+        "IFCMODULUSOFSUBGRADEREACTIONMEASURE",
+        "IFCMOISTUREDIFFUSIVITYMEASURE",
+        "IFCMOLECULARWEIGHTMEASURE",
+        "IFCMOMENTOFINERTIAMEASURE",
+        "IFCMONETARYMEASURE",
+        "IFCPHMEASURE",
+        "IFCPLANARFORCEMEASURE",
+        "IFCPOWERMEASURE",
+        "IFCPRESSUREMEASURE",
+        "IFCRADIOACTIVITYMEASURE",
+        "IFCROTATIONALFREQUENCYMEASURE",
+        "IFCROTATIONALMASSMEASURE",
+        "IFCROTATIONALSTIFFNESSMEASURE",
+        "IFCSECTIONMODULUSMEASURE",
+        "IFCSECTIONALAREAINTEGRALMEASURE",
+        "IFCSHEARMODULUSMEASURE",
+        "IFCSOUNDPOWERLEVELMEASURE",
+        "IFCSOUNDPOWERMEASURE",
+        "IFCSOUNDPRESSURELEVELMEASURE",
+        "IFCSOUNDPRESSUREMEASURE",
+        "IFCSPECIFICHEATCAPACITYMEASURE",
+        "IFCTEMPERATUREGRADIENTMEASURE",
+        "IFCTEMPERATURERATEOFCHANGEMEASURE",
+        "IFCTHERMALADMITTANCEMEASURE",
+        "IFCTHERMALCONDUCTIVITYMEASURE",
+        "IFCTHERMALEXPANSIONCOEFFICIENTMEASURE",
+        "IFCTHERMALRESISTANCEMEASURE",
+        "IFCTHERMALTRANSMITTANCEMEASURE",
+        "IFCTORQUEMEASURE",
+        "IFCVAPORPERMEABILITYMEASURE",
+        "IFCVOLUMETRICFLOWRATEMEASURE",
+        "IFCWARPINGCONSTANTMEASURE",
+        "IFCWARPINGMOMENTMEASURE",
+        "IFCAMOUNTOFSUBSTANCEMEASURE",
+        "IFCAREAMEASURE",
+        "IFCCOMPLEXNUMBER",
+        "IFCCONTEXTDEPENDENTMEASURE",
+        "IFCCOUNTMEASURE",
+        "IFCDESCRIPTIVEMEASURE",
+        "IFCELECTRICCURRENTMEASURE",
+        "IFCLENGTHMEASURE",
+        "IFCLUMINOUSINTENSITYMEASURE",
+        "IFCMASSMEASURE",
+        "IFCNONNEGATIVELENGTHMEASURE",
+        "IFCNORMALISEDRATIOMEASURE",
+        "IFCNUMERICMEASURE",
+        "IFCPARAMETERVALUE",
+        "IFCPLANEANGLEMEASURE",
+        "IFCPOSITIVELENGTHMEASURE",
+        "IFCPOSITIVEPLANEANGLEMEASURE",
+        "IFCPOSITIVERATIOMEASURE",
+        "IFCRATIOMEASURE",
+        "IFCSOLIDANGLEMEASURE",
+        "IFCTHERMODYNAMICTEMPERATUREMEASURE",
+        "IFCTIMEMEASURE",
+        "IFCVOLUMEMEASURE",
+        "IFCBINARY",
+        "IFCBOOLEAN",
+        "IFCDATE",
+        "IFCDATETIME",
+        "IFCDURATION",
+        "IFCIDENTIFIER",
+        "IFCINTEGER",
+        "IFCLABEL",
+        "IFCLOGICAL",
+        "IFCPOSITIVEINTEGER",
+        "IFCREAL",
+        "IFCTEXT",
+        "IFCTIME",
+        "IFCTIMESTAMP",
+        "IFCNULLSTYLE",
+        "IFCPROPERTYSETDEFINITIONSET",
+        "IFCARCINDEX",
+        "IFCLINEINDEX",
+        "IFCSPECULAREXPONENT",
+        "IFCSPECULARROUGHNESS",
+        NULL
+    };
+
+    inline const TextValue* SchemaTypePaths(IntValue& count)
+    {
+        count = sizeof(SchemaTypePaths_) / sizeof(SchemaTypePaths_[0]) - 1;
+        return SchemaTypePaths_;
+    }
+
+    /// <summary>
+    /// Relationships of a model read in one pass, for example
+    ///     index.Related(RelationshipIndex::ContainedInSpatialStructure, storey) - elements contained in the storey
+    ///     index.Relating(RelationshipIndex::DefinesByProperties, wall) - property definitions of the wall
+    /// </summary>
+    class RelationshipIndex : public RelationshipTable
+    {
+    public:
+        enum Relationship
+        {
+            Aggregates,                     //RelatingObject - RelatedObjects
+            ContainedInSpatialStructure,    //RelatingStructure - RelatedElements
+            DefinesByProperties,            //RelatingPropertyDefinition - RelatedObjects
+            DefinesByType,                  //RelatingType - RelatedObjects
+            VoidsElement,                   //RelatingBuildingElement - RelatedOpeningElement
+            AssociatesMaterial              //RelatingMaterial - RelatedObjects
+        };
+
+        explicit RelationshipIndex(SdaiModel model) : RelationshipTable(model, Relationships(), AssociatesMaterial + 1) {}
+
+    private:
+        static const RelationshipAttributes* Relationships()
+        {
+            static const RelationshipAttributes relationships[] = {
+                {"IfcRelAggregates", "RelatingObject", "RelatedObjects"},
+                {"IfcRelContainedInSpatialStructure", "RelatingStructure", "RelatedElements"},
+                {"IfcRelDefinesByProperties", "RelatingPropertyDefinition", "RelatedObjects"},
+                {"IfcRelDefinesByType", "RelatingType", "RelatedObjects"},
+                {"IfcRelVoidsElement", "RelatingBuildingElement", "RelatedOpeningElement"},
+                {"IfcRelAssociatesMaterial", "RelatingMaterial", "RelatedObjects"}
+            };
+            return relationships;
+        }
+    };
+
+    /// <summary>
+    /// Spatial structure of a model: IfcProject and objects decomposed by IfcRelAggregates, with elements contained by IfcRelContainedInSpatialStructure
+    ///     tree.SubtreeElements(tree.Find(building)) - elements of all storeys of the building
+    ///     tree.Elements(tree.Find(storey), sdaiGetEntity(model, "IfcWall")) - walls contained in the storey
+    /// Call Update after relationships are added or deleted, it lays the whole tree out again
+    /// </summary>
+    class SpatialTree : public SpatialTreeTable
+    {
+    public:
+        explicit SpatialTree(SdaiModel model)
+            : SpatialTreeTable(model, "IfcProject", { "IfcRelAggregates", "RelatingObject", "RelatedObjects" }, { "IfcRelContainedInSpatialStructure", "RelatingStructure", "RelatedElements" })
+        {}
+    };
+#ifdef __cpp_lib_string_view
+
+    /// <summary>
+    /// Single-value properties of objects of a model from IfcPropertySet related by IfcRelDefinesByProperties, for example
+    ///     table.Value(wall, "Pset_WallCommon", "FireRating") - the value, NULL if the wall has no such property
+    ///     table.Values() - values of all properties for whole-column scans
+    /// </summary>
+    class PropertyTable : public PropertyValueTable
+    {
+    public:
+        explicit PropertyTable(SdaiModel model, unsigned threads = 1) : PropertyValueTable(model, Attributes(), threads) {}
+
+    private:
+        static const PropertyAttributes& Attributes()
+        {
+            static const PropertyAttributes attributes = {
+                {"IfcRelDefinesByProperties", "RelatingPropertyDefinition", "RelatedObjects"},
+                "IfcPropertySet", "Name", "HasProperties",
+                "IfcPropertySingleValue", "Name", "NominalValue", "Unit"
+            };
+            return attributes;
+        }
+    };
+#endif
+
+    /// <summary>
+    /// World transforms of IfcObjectPlacement of a model: IfcLocalPlacement composed with its PlacementRelTo chain, for example
+    ///     resolver.Transform(product.get_ObjectPlacement()) - transform of the product to world coordinates
+    ///     resolver.Transforms() - transforms of all placements, contiguous
+    /// </summary>
+    class PlacementResolver : public PlacementTable
+    {
+    public:
+        explicit PlacementResolver(SdaiModel model) : PlacementTable(model, Attributes()) {}
+
+    private:
+        static const PlacementAttributes& Attributes()
+        {
+            static const PlacementAttributes attributes = {
+                "IfcObjectPlacement",
+                "IfcLocalPlacement", "PlacementRelTo", "RelativePlacement",
+                "IfcAxis2Placement3D", "Location", "Axis", "RefDirection",
+                "IfcAxis2Placement2D", "Location", "RefDirection",
+                "IfcCartesianPoint", "Coordinates",
+                "IfcDirection", "DirectionRatios"
+            };
+            return attributes;
+        }
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_H
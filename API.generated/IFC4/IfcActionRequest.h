@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcActionRequest_H
+#define __RDF_LTD__IFC4_IfcActionRequest_H
+
+#include    "classes/IfcActionRequest.h"
+#include    "IfcControl.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(18, IfcActionRequest, 0, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(19, IfcActionRequest, 0, Status)
+    RDF_EXPRESS_ATTR_ACCESSOR(20, IfcActionRequest, 0, LongDescription)
+}
+
+#endif //__RDF_LTD__IFC4_IfcActionRequest_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcActor_H
+#define __RDF_LTD__IFC4_IfcActor_H
+
+#include    "classes/IfcActor.h"
+#include    "IfcObject.h"
+#include    "classes/IfcRelAssignsToActor.h"
+#include    "selects/IfcActorSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(21, IfcActor, 1, TheActor)
+    RDF_EXPRESS_ATTR_ACCESSOR(22, IfcActor, 1, IsActingUpon)
+}
+
+#endif //__RDF_LTD__IFC4_IfcActor_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcActorRole_H
+#define __RDF_LTD__IFC4_IfcActorRole_H
+
+#include    "classes/IfcActorRole.h"
+#include    "classes/IfcExternalReferenceRelationship.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(23, IfcActorRole, 2, Role)
+    RDF_EXPRESS_ATTR_ACCESSOR(24, IfcActorRole, 2, UserDefinedRole)
+    RDF_EXPRESS_ATTR_ACCESSOR(25, IfcActorRole, 2, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(26, IfcActorRole, 2, HasExternalReference)
+}
+
+#endif //__RDF_LTD__IFC4_IfcActorRole_H
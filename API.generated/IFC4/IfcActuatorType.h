@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcActuatorType_H
+#define __RDF_LTD__IFC4_IfcActuatorType_H
+
+#include    "classes/IfcActuatorType.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(53, IfcActuatorType, 4, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcActuatorType_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAddress_H
+#define __RDF_LTD__IFC4_IfcAddress_H
+
+#include    "classes/IfcAddress.h"
+#include    "classes/IfcOrganization.h"
+#include    "classes/IfcPerson.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(54, IfcAddress, 5, Purpose)
+    RDF_EXPRESS_ATTR_ACCESSOR(55, IfcAddress, 5, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(56, IfcAddress, 5, UserDefinedPurpose)
+    RDF_EXPRESS_ATTR_ACCESSOR(57, IfcAddress, 5, OfPerson)
+    RDF_EXPRESS_ATTR_ACCESSOR(58, IfcAddress, 5, OfOrganization)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAddress_H
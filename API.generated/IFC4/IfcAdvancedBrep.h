@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAdvancedBrep_H
+#define __RDF_LTD__IFC4_IfcAdvancedBrep_H
+
+#include    "classes/IfcAdvancedBrep.h"
+#include    "IfcManifoldSolidBrep.h"
+
+#endif //__RDF_LTD__IFC4_IfcAdvancedBrep_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAdvancedBrepWithVoids_H
+#define __RDF_LTD__IFC4_IfcAdvancedBrepWithVoids_H
+
+#include    "classes/IfcAdvancedBrepWithVoids.h"
+#include    "IfcAdvancedBrep.h"
+#include    "classes/IfcClosedShell.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(63, IfcAdvancedBrepWithVoids, 7, Voids)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAdvancedBrepWithVoids_H
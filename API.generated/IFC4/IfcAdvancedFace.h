@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAdvancedFace_H
+#define __RDF_LTD__IFC4_IfcAdvancedFace_H
+
+#include    "classes/IfcAdvancedFace.h"
+#include    "IfcFaceSurface.h"
+
+#endif //__RDF_LTD__IFC4_IfcAdvancedFace_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAirTerminal_H
+#define __RDF_LTD__IFC4_IfcAirTerminal_H
+
+#include    "classes/IfcAirTerminal.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(69, IfcAirTerminal, 9, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAirTerminal_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAirTerminalBoxType_H
+#define __RDF_LTD__IFC4_IfcAirTerminalBoxType_H
+
+#include    "classes/IfcAirTerminalBoxType.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(71, IfcAirTerminalBoxType, 11, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAirTerminalBoxType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAirTerminalType_H
+#define __RDF_LTD__IFC4_IfcAirTerminalType_H
+
+#include    "classes/IfcAirTerminalType.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(72, IfcAirTerminalType, 12, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAirTerminalType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAirToAirHeatRecovery_H
+#define __RDF_LTD__IFC4_IfcAirToAirHeatRecovery_H
+
+#include    "classes/IfcAirToAirHeatRecovery.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(73, IfcAirToAirHeatRecovery, 13, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAirToAirHeatRecovery_H
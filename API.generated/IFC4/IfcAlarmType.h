@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAlarmType_H
+#define __RDF_LTD__IFC4_IfcAlarmType_H
+
+#include    "classes/IfcAlarmType.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(76, IfcAlarmType, 16, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAlarmType_H
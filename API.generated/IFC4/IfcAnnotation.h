@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAnnotation_H
+#define __RDF_LTD__IFC4_IfcAnnotation_H
+
+#include    "classes/IfcAnnotation.h"
+#include    "IfcProduct.h"
+#include    "classes/IfcRelContainedInSpatialStructure.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(77, IfcAnnotation, 17, ContainedInStructure)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAnnotation_H
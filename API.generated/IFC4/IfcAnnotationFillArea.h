@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAnnotationFillArea_H
+#define __RDF_LTD__IFC4_IfcAnnotationFillArea_H
+
+#include    "classes/IfcAnnotationFillArea.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "classes/IfcCurve.h"
+
+namespace IFC4
+{
+    inline IfcCurve IfcAnnotationFillArea::get_OuterBoundary() { RDF_EXPRESS_PROBE(78); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(78), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcAnnotationFillArea::put_OuterBoundary(IfcCurve inst) { RDF_EXPRESS_PROBE(78); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(78), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(78, IfcAnnotationFillArea, 18, OuterBoundary)
+    RDF_EXPRESS_ATTR_ACCESSOR(79, IfcAnnotationFillArea, 18, InnerBoundaries)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAnnotationFillArea_H
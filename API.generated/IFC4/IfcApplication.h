@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcApplication_H
+#define __RDF_LTD__IFC4_IfcApplication_H
+
+#include    "classes/IfcApplication.h"
+#include    "classes/IfcOrganization.h"
+
+namespace IFC4
+{
+    inline IfcOrganization IfcApplication::get_ApplicationDeveloper() { RDF_EXPRESS_PROBE(80); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(80), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcApplication::put_ApplicationDeveloper(IfcOrganization inst) { RDF_EXPRESS_PROBE(80); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(80), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(80, IfcApplication, 19, ApplicationDeveloper)
+    RDF_EXPRESS_ATTR_ACCESSOR(81, IfcApplication, 19, Version)
+    RDF_EXPRESS_ATTR_ACCESSOR(82, IfcApplication, 19, ApplicationFullName)
+    RDF_EXPRESS_ATTR_ACCESSOR(83, IfcApplication, 19, ApplicationIdentifier)
+}
+
+#endif //__RDF_LTD__IFC4_IfcApplication_H
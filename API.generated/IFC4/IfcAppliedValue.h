@@ -0,0 +1,29 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAppliedValue_H
+#define __RDF_LTD__IFC4_IfcAppliedValue_H
+
+#include    "classes/IfcAppliedValue.h"
+#include    "classes/IfcExternalReferenceRelationship.h"
+#include    "classes/IfcMeasureWithUnit.h"
+#include    "selects/IfcAppliedValueSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(84, IfcAppliedValue, 20, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(85, IfcAppliedValue, 20, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(86, IfcAppliedValue, 20, AppliedValue)
+    inline IfcMeasureWithUnit IfcAppliedValue::get_UnitBasis() { RDF_EXPRESS_PROBE(87); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(87), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcAppliedValue::put_UnitBasis(IfcMeasureWithUnit inst) { RDF_EXPRESS_PROBE(87); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(87), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(87, IfcAppliedValue, 20, UnitBasis)
+    RDF_EXPRESS_ATTR_ACCESSOR(88, IfcAppliedValue, 20, ApplicableDate)
+    RDF_EXPRESS_ATTR_ACCESSOR(89, IfcAppliedValue, 20, FixedUntilDate)
+    RDF_EXPRESS_ATTR_ACCESSOR(90, IfcAppliedValue, 20, Category)
+    RDF_EXPRESS_ATTR_ACCESSOR(91, IfcAppliedValue, 20, Condition)
+    RDF_EXPRESS_ATTR_ACCESSOR(92, IfcAppliedValue, 20, ArithmeticOperator)
+    RDF_EXPRESS_ATTR_ACCESSOR(93, IfcAppliedValue, 20, Components)
+    RDF_EXPRESS_ATTR_ACCESSOR(94, IfcAppliedValue, 20, HasExternalReference)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAppliedValue_H
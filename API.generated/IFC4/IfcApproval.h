@@ -0,0 +1,32 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcApproval_H
+#define __RDF_LTD__IFC4_IfcApproval_H
+
+#include    "classes/IfcApproval.h"
+#include    "classes/IfcApprovalRelationship.h"
+#include    "classes/IfcExternalReferenceRelationship.h"
+#include    "classes/IfcRelAssociatesApproval.h"
+#include    "classes/IfcResourceApprovalRelationship.h"
+#include    "selects/IfcActorSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(95, IfcApproval, 21, Identifier)
+    RDF_EXPRESS_ATTR_ACCESSOR(96, IfcApproval, 21, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(97, IfcApproval, 21, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(98, IfcApproval, 21, TimeOfApproval)
+    RDF_EXPRESS_ATTR_ACCESSOR(99, IfcApproval, 21, Status)
+    RDF_EXPRESS_ATTR_ACCESSOR(100, IfcApproval, 21, Level)
+    RDF_EXPRESS_ATTR_ACCESSOR(101, IfcApproval, 21, Qualifier)
+    RDF_EXPRESS_ATTR_ACCESSOR(102, IfcApproval, 21, RequestingApproval)
+    RDF_EXPRESS_ATTR_ACCESSOR(103, IfcApproval, 21, GivingApproval)
+    RDF_EXPRESS_ATTR_ACCESSOR(104, IfcApproval, 21, HasExternalReferences)
+    RDF_EXPRESS_ATTR_ACCESSOR(105, IfcApproval, 21, ApprovedObjects)
+    RDF_EXPRESS_ATTR_ACCESSOR(106, IfcApproval, 21, ApprovedResources)
+    RDF_EXPRESS_ATTR_ACCESSOR(107, IfcApproval, 21, IsRelatedWith)
+    RDF_EXPRESS_ATTR_ACCESSOR(108, IfcApproval, 21, Relates)
+}
+
+#endif //__RDF_LTD__IFC4_IfcApproval_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcApprovalRelationship_H
+#define __RDF_LTD__IFC4_IfcApprovalRelationship_H
+
+#include    "classes/IfcApprovalRelationship.h"
+#include    "IfcResourceLevelRelationship.h"
+#include    "classes/IfcApproval.h"
+
+namespace IFC4
+{
+    inline IfcApproval IfcApprovalRelationship::get_RelatingApproval() { RDF_EXPRESS_PROBE(111); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(111), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcApprovalRelationship::put_RelatingApproval(IfcApproval inst) { RDF_EXPRESS_PROBE(111); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(111), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(111, IfcApprovalRelationship, 22, RelatingApproval)
+    RDF_EXPRESS_ATTR_ACCESSOR(112, IfcApprovalRelationship, 22, RelatedApprovals)
+}
+
+#endif //__RDF_LTD__IFC4_IfcApprovalRelationship_H
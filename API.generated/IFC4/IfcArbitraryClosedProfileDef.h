@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcArbitraryClosedProfileDef_H
+#define __RDF_LTD__IFC4_IfcArbitraryClosedProfileDef_H
+
+#include    "classes/IfcArbitraryClosedProfileDef.h"
+#include    "IfcProfileDef.h"
+#include    "classes/IfcCurve.h"
+
+namespace IFC4
+{
+    inline IfcCurve IfcArbitraryClosedProfileDef::get_OuterCurve() { RDF_EXPRESS_PROBE(117); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(117), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcArbitraryClosedProfileDef::put_OuterCurve(IfcCurve inst) { RDF_EXPRESS_PROBE(117); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(117), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(117, IfcArbitraryClosedProfileDef, 23, OuterCurve)
+}
+
+#endif //__RDF_LTD__IFC4_IfcArbitraryClosedProfileDef_H
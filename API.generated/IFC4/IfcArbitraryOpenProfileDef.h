@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcArbitraryOpenProfileDef_H
+#define __RDF_LTD__IFC4_IfcArbitraryOpenProfileDef_H
+
+#include    "classes/IfcArbitraryOpenProfileDef.h"
+#include    "IfcProfileDef.h"
+#include    "classes/IfcBoundedCurve.h"
+
+namespace IFC4
+{
+    inline IfcBoundedCurve IfcArbitraryOpenProfileDef::get_Curve() { RDF_EXPRESS_PROBE(118); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(118), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcArbitraryOpenProfileDef::put_Curve(IfcBoundedCurve inst) { RDF_EXPRESS_PROBE(118); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(118), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(118, IfcArbitraryOpenProfileDef, 24, Curve)
+}
+
+#endif //__RDF_LTD__IFC4_IfcArbitraryOpenProfileDef_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcArbitraryProfileDefWithVoids_H
+#define __RDF_LTD__IFC4_IfcArbitraryProfileDefWithVoids_H
+
+#include    "classes/IfcArbitraryProfileDefWithVoids.h"
+#include    "IfcArbitraryClosedProfileDef.h"
+#include    "classes/IfcCurve.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(119, IfcArbitraryProfileDefWithVoids, 25, InnerCurves)
+}
+
+#endif //__RDF_LTD__IFC4_IfcArbitraryProfileDefWithVoids_H
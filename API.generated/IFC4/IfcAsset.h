@@ -0,0 +1,36 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAsset_H
+#define __RDF_LTD__IFC4_IfcAsset_H
+
+#include    "classes/IfcAsset.h"
+#include    "IfcGroup.h"
+#include    "classes/IfcCostValue.h"
+#include    "classes/IfcPerson.h"
+#include    "selects/IfcActorSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(121, IfcAsset, 26, Identification)
+    inline IfcCostValue IfcAsset::get_OriginalValue() { RDF_EXPRESS_PROBE(122); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(122), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcAsset::put_OriginalValue(IfcCostValue inst) { RDF_EXPRESS_PROBE(122); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(122), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(122, IfcAsset, 26, OriginalValue)
+    inline IfcCostValue IfcAsset::get_CurrentValue() { RDF_EXPRESS_PROBE(123); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(123), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcAsset::put_CurrentValue(IfcCostValue inst) { RDF_EXPRESS_PROBE(123); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(123), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(123, IfcAsset, 26, CurrentValue)
+    inline IfcCostValue IfcAsset::get_TotalReplacementCost() { RDF_EXPRESS_PROBE(124); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(124), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcAsset::put_TotalReplacementCost(IfcCostValue inst) { RDF_EXPRESS_PROBE(124); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(124), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(124, IfcAsset, 26, TotalReplacementCost)
+    RDF_EXPRESS_ATTR_ACCESSOR(125, IfcAsset, 26, Owner)
+    RDF_EXPRESS_ATTR_ACCESSOR(126, IfcAsset, 26, User)
+    inline IfcPerson IfcAsset::get_ResponsiblePerson() { RDF_EXPRESS_PROBE(127); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(127), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcAsset::put_ResponsiblePerson(IfcPerson inst) { RDF_EXPRESS_PROBE(127); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(127), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(127, IfcAsset, 26, ResponsiblePerson)
+    RDF_EXPRESS_ATTR_ACCESSOR(128, IfcAsset, 26, IncorporationDate)
+    inline IfcCostValue IfcAsset::get_DepreciatedValue() { RDF_EXPRESS_PROBE(129); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(129), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcAsset::put_DepreciatedValue(IfcCostValue inst) { RDF_EXPRESS_PROBE(129); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(129), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(129, IfcAsset, 26, DepreciatedValue)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAsset_H
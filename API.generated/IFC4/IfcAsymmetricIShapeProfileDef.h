@@ -0,0 +1,26 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAsymmetricIShapeProfileDef_H
+#define __RDF_LTD__IFC4_IfcAsymmetricIShapeProfileDef_H
+
+#include    "classes/IfcAsymmetricIShapeProfileDef.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(131, IfcAsymmetricIShapeProfileDef, 27, BottomFlangeWidth)
+    RDF_EXPRESS_ATTR_ACCESSOR(132, IfcAsymmetricIShapeProfileDef, 27, OverallDepth)
+    RDF_EXPRESS_ATTR_ACCESSOR(133, IfcAsymmetricIShapeProfileDef, 27, WebThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(134, IfcAsymmetricIShapeProfileDef, 27, BottomFlangeThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(135, IfcAsymmetricIShapeProfileDef, 27, BottomFlangeFilletRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(136, IfcAsymmetricIShapeProfileDef, 27, TopFlangeWidth)
+    RDF_EXPRESS_ATTR_ACCESSOR(137, IfcAsymmetricIShapeProfileDef, 27, TopFlangeThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(138, IfcAsymmetricIShapeProfileDef, 27, TopFlangeFilletRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(139, IfcAsymmetricIShapeProfileDef, 27, BottomFlangeEdgeRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(140, IfcAsymmetricIShapeProfileDef, 27, BottomFlangeSlope)
+    RDF_EXPRESS_ATTR_ACCESSOR(141, IfcAsymmetricIShapeProfileDef, 27, TopFlangeEdgeRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(142, IfcAsymmetricIShapeProfileDef, 27, TopFlangeSlope)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAsymmetricIShapeProfileDef_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAudioVisualApplianceType_H
+#define __RDF_LTD__IFC4_IfcAudioVisualApplianceType_H
+
+#include    "classes/IfcAudioVisualApplianceType.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(144, IfcAudioVisualApplianceType, 29, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAudioVisualApplianceType_H
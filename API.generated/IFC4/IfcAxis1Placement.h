@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAxis1Placement_H
+#define __RDF_LTD__IFC4_IfcAxis1Placement_H
+
+#include    "classes/IfcAxis1Placement.h"
+#include    "IfcPlacement.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    inline IfcDirection IfcAxis1Placement::get_Axis() { RDF_EXPRESS_PROBE(147); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(147), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcAxis1Placement::put_Axis(IfcDirection inst) { RDF_EXPRESS_PROBE(147); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(147), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(147, IfcAxis1Placement, 30, Axis)
+    inline IfcDirection IfcAxis1Placement::get_Z() { RDF_EXPRESS_PROBE(148); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(148), sdaiINSTANCE, &inst); return inst; }
+    RDF_EXPRESS_ATTR_ACCESSOR(148, IfcAxis1Placement, 30, Z)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAxis1Placement_H
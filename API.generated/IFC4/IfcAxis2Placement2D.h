@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAxis2Placement2D_H
+#define __RDF_LTD__IFC4_IfcAxis2Placement2D_H
+
+#include    "classes/IfcAxis2Placement2D.h"
+#include    "IfcPlacement.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    inline IfcDirection IfcAxis2Placement2D::get_RefDirection() { RDF_EXPRESS_PROBE(149); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(149), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcAxis2Placement2D::put_RefDirection(IfcDirection inst) { RDF_EXPRESS_PROBE(149); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(149), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(149, IfcAxis2Placement2D, 31, RefDirection)
+    RDF_EXPRESS_ATTR_ACCESSOR(150, IfcAxis2Placement2D, 31, P)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAxis2Placement2D_H
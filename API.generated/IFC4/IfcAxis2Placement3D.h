@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAxis2Placement3D_H
+#define __RDF_LTD__IFC4_IfcAxis2Placement3D_H
+
+#include    "classes/IfcAxis2Placement3D.h"
+#include    "IfcPlacement.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    inline IfcDirection IfcAxis2Placement3D::get_Axis() { RDF_EXPRESS_PROBE(151); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(151), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcAxis2Placement3D::put_Axis(IfcDirection inst) { RDF_EXPRESS_PROBE(151); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(151), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(151, IfcAxis2Placement3D, 32, Axis)
+    inline IfcDirection IfcAxis2Placement3D::get_RefDirection() { RDF_EXPRESS_PROBE(152); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(152), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcAxis2Placement3D::put_RefDirection(IfcDirection inst) { RDF_EXPRESS_PROBE(152); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(152), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(152, IfcAxis2Placement3D, 32, RefDirection)
+    RDF_EXPRESS_ATTR_ACCESSOR(153, IfcAxis2Placement3D, 32, P)
+}
+
+#endif //__RDF_LTD__IFC4_IfcAxis2Placement3D_H
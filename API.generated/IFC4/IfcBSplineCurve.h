@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBSplineCurve_H
+#define __RDF_LTD__IFC4_IfcBSplineCurve_H
+
+#include    "classes/IfcBSplineCurve.h"
+#include    "IfcBoundedCurve.h"
+#include    "classes/IfcCartesianPoint.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(209, IfcBSplineCurve, 52, Degree)
+    RDF_EXPRESS_ATTR_ACCESSOR(210, IfcBSplineCurve, 52, ControlPointsList)
+    RDF_EXPRESS_ATTR_ACCESSOR(211, IfcBSplineCurve, 52, CurveForm)
+    RDF_EXPRESS_ATTR_ACCESSOR(212, IfcBSplineCurve, 52, ClosedCurve)
+    RDF_EXPRESS_ATTR_ACCESSOR(213, IfcBSplineCurve, 52, SelfIntersect)
+    RDF_EXPRESS_ATTR_ACCESSOR(214, IfcBSplineCurve, 52, UpperIndexOnControlPoints)
+    RDF_EXPRESS_ATTR_ACCESSOR(215, IfcBSplineCurve, 52, ControlPoints)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBSplineCurve_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBSplineCurveWithKnots_H
+#define __RDF_LTD__IFC4_IfcBSplineCurveWithKnots_H
+
+#include    "classes/IfcBSplineCurveWithKnots.h"
+#include    "IfcBSplineCurve.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(216, IfcBSplineCurveWithKnots, 53, KnotMultiplicities)
+    RDF_EXPRESS_ATTR_ACCESSOR(217, IfcBSplineCurveWithKnots, 53, Knots)
+    RDF_EXPRESS_ATTR_ACCESSOR(218, IfcBSplineCurveWithKnots, 53, KnotSpec)
+    RDF_EXPRESS_ATTR_ACCESSOR(219, IfcBSplineCurveWithKnots, 53, UpperIndexOnKnots)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBSplineCurveWithKnots_H
@@ -0,0 +1,24 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBSplineSurface_H
+#define __RDF_LTD__IFC4_IfcBSplineSurface_H
+
+#include    "classes/IfcBSplineSurface.h"
+#include    "IfcBoundedSurface.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(220, IfcBSplineSurface, 54, UDegree)
+    RDF_EXPRESS_ATTR_ACCESSOR(221, IfcBSplineSurface, 54, VDegree)
+    RDF_EXPRESS_ATTR_ACCESSOR(222, IfcBSplineSurface, 54, ControlPointsList)
+    RDF_EXPRESS_ATTR_ACCESSOR(223, IfcBSplineSurface, 54, SurfaceForm)
+    RDF_EXPRESS_ATTR_ACCESSOR(224, IfcBSplineSurface, 54, UClosed)
+    RDF_EXPRESS_ATTR_ACCESSOR(225, IfcBSplineSurface, 54, VClosed)
+    RDF_EXPRESS_ATTR_ACCESSOR(226, IfcBSplineSurface, 54, SelfIntersect)
+    RDF_EXPRESS_ATTR_ACCESSOR(227, IfcBSplineSurface, 54, UUpper)
+    RDF_EXPRESS_ATTR_ACCESSOR(228, IfcBSplineSurface, 54, VUpper)
+    RDF_EXPRESS_ATTR_ACCESSOR(229, IfcBSplineSurface, 54, ControlPoints)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBSplineSurface_H
@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBSplineSurfaceWithKnots_H
+#define __RDF_LTD__IFC4_IfcBSplineSurfaceWithKnots_H
+
+#include    "classes/IfcBSplineSurfaceWithKnots.h"
+#include    "IfcBSplineSurface.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(230, IfcBSplineSurfaceWithKnots, 55, UMultiplicities)
+    RDF_EXPRESS_ATTR_ACCESSOR(231, IfcBSplineSurfaceWithKnots, 55, VMultiplicities)
+    RDF_EXPRESS_ATTR_ACCESSOR(232, IfcBSplineSurfaceWithKnots, 55, UKnots)
+    RDF_EXPRESS_ATTR_ACCESSOR(233, IfcBSplineSurfaceWithKnots, 55, VKnots)
+    RDF_EXPRESS_ATTR_ACCESSOR(234, IfcBSplineSurfaceWithKnots, 55, KnotSpec)
+    RDF_EXPRESS_ATTR_ACCESSOR(235, IfcBSplineSurfaceWithKnots, 55, KnotVUpper)
+    RDF_EXPRESS_ATTR_ACCESSOR(236, IfcBSplineSurfaceWithKnots, 55, KnotUUpper)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBSplineSurfaceWithKnots_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBeam_H
+#define __RDF_LTD__IFC4_IfcBeam_H
+
+#include    "classes/IfcBeam.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(154, IfcBeam, 33, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBeam_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBeamStandardCase_H
+#define __RDF_LTD__IFC4_IfcBeamStandardCase_H
+
+#include    "classes/IfcBeamStandardCase.h"
+#include    "IfcBeam.h"
+
+#endif //__RDF_LTD__IFC4_IfcBeamStandardCase_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBeamType_H
+#define __RDF_LTD__IFC4_IfcBeamType_H
+
+#include    "classes/IfcBeamType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(155, IfcBeamType, 35, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBeamType_H
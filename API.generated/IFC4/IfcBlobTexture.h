@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBlobTexture_H
+#define __RDF_LTD__IFC4_IfcBlobTexture_H
+
+#include    "classes/IfcBlobTexture.h"
+#include    "IfcSurfaceTexture.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(163, IfcBlobTexture, 36, RasterFormat)
+    RDF_EXPRESS_ATTR_ACCESSOR(164, IfcBlobTexture, 36, RasterCode)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBlobTexture_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBlock_H
+#define __RDF_LTD__IFC4_IfcBlock_H
+
+#include    "classes/IfcBlock.h"
+#include    "IfcCsgPrimitive3D.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(167, IfcBlock, 37, XLength)
+    RDF_EXPRESS_ATTR_ACCESSOR(168, IfcBlock, 37, YLength)
+    RDF_EXPRESS_ATTR_ACCESSOR(169, IfcBlock, 37, ZLength)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBlock_H
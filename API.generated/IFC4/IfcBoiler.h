@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoiler_H
+#define __RDF_LTD__IFC4_IfcBoiler_H
+
+#include    "classes/IfcBoiler.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(170, IfcBoiler, 38, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoiler_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoilerType_H
+#define __RDF_LTD__IFC4_IfcBoilerType_H
+
+#include    "classes/IfcBoilerType.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(171, IfcBoilerType, 39, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoilerType_H
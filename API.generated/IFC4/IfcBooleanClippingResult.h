@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBooleanClippingResult_H
+#define __RDF_LTD__IFC4_IfcBooleanClippingResult_H
+
+#include    "classes/IfcBooleanClippingResult.h"
+#include    "IfcBooleanResult.h"
+
+#endif //__RDF_LTD__IFC4_IfcBooleanClippingResult_H
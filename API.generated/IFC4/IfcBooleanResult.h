@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBooleanResult_H
+#define __RDF_LTD__IFC4_IfcBooleanResult_H
+
+#include    "classes/IfcBooleanResult.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "selects/IfcBooleanOperand.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(172, IfcBooleanResult, 41, Operator)
+    RDF_EXPRESS_ATTR_ACCESSOR(173, IfcBooleanResult, 41, FirstOperand)
+    RDF_EXPRESS_ATTR_ACCESSOR(174, IfcBooleanResult, 41, SecondOperand)
+    RDF_EXPRESS_ATTR_ACCESSOR(175, IfcBooleanResult, 41, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBooleanResult_H
@@ -0,0 +1,14 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundaryCondition_H
+#define __RDF_LTD__IFC4_IfcBoundaryCondition_H
+
+#include    "classes/IfcBoundaryCondition.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(176, IfcBoundaryCondition, 42, Name)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundaryCondition_H
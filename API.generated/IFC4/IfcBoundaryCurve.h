@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundaryCurve_H
+#define __RDF_LTD__IFC4_IfcBoundaryCurve_H
+
+#include    "classes/IfcBoundaryCurve.h"
+#include    "IfcCompositeCurveOnSurface.h"
+
+#endif //__RDF_LTD__IFC4_IfcBoundaryCurve_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundaryEdgeCondition_H
+#define __RDF_LTD__IFC4_IfcBoundaryEdgeCondition_H
+
+#include    "classes/IfcBoundaryEdgeCondition.h"
+#include    "IfcBoundaryCondition.h"
+#include    "selects/IfcModulusOfRotationalSubgradeReactionSelect.h"
+#include    "selects/IfcModulusOfTranslationalSubgradeReactionSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(183, IfcBoundaryEdgeCondition, 44, TranslationalStiffnessByLengthX)
+    RDF_EXPRESS_ATTR_ACCESSOR(184, IfcBoundaryEdgeCondition, 44, TranslationalStiffnessByLengthY)
+    RDF_EXPRESS_ATTR_ACCESSOR(185, IfcBoundaryEdgeCondition, 44, TranslationalStiffnessByLengthZ)
+    RDF_EXPRESS_ATTR_ACCESSOR(186, IfcBoundaryEdgeCondition, 44, RotationalStiffnessByLengthX)
+    RDF_EXPRESS_ATTR_ACCESSOR(187, IfcBoundaryEdgeCondition, 44, RotationalStiffnessByLengthY)
+    RDF_EXPRESS_ATTR_ACCESSOR(188, IfcBoundaryEdgeCondition, 44, RotationalStiffnessByLengthZ)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundaryEdgeCondition_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundaryFaceCondition_H
+#define __RDF_LTD__IFC4_IfcBoundaryFaceCondition_H
+
+#include    "classes/IfcBoundaryFaceCondition.h"
+#include    "IfcBoundaryCondition.h"
+#include    "selects/IfcModulusOfSubgradeReactionSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(189, IfcBoundaryFaceCondition, 45, TranslationalStiffnessByAreaX)
+    RDF_EXPRESS_ATTR_ACCESSOR(190, IfcBoundaryFaceCondition, 45, TranslationalStiffnessByAreaY)
+    RDF_EXPRESS_ATTR_ACCESSOR(191, IfcBoundaryFaceCondition, 45, TranslationalStiffnessByAreaZ)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundaryFaceCondition_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundaryNodeCondition_H
+#define __RDF_LTD__IFC4_IfcBoundaryNodeCondition_H
+
+#include    "classes/IfcBoundaryNodeCondition.h"
+#include    "IfcBoundaryCondition.h"
+#include    "selects/IfcRotationalStiffnessSelect.h"
+#include    "selects/IfcTranslationalStiffnessSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(192, IfcBoundaryNodeCondition, 46, TranslationalStiffnessX)
+    RDF_EXPRESS_ATTR_ACCESSOR(193, IfcBoundaryNodeCondition, 46, TranslationalStiffnessY)
+    RDF_EXPRESS_ATTR_ACCESSOR(194, IfcBoundaryNodeCondition, 46, TranslationalStiffnessZ)
+    RDF_EXPRESS_ATTR_ACCESSOR(195, IfcBoundaryNodeCondition, 46, RotationalStiffnessX)
+    RDF_EXPRESS_ATTR_ACCESSOR(196, IfcBoundaryNodeCondition, 46, RotationalStiffnessY)
+    RDF_EXPRESS_ATTR_ACCESSOR(197, IfcBoundaryNodeCondition, 46, RotationalStiffnessZ)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundaryNodeCondition_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundaryNodeConditionWarping_H
+#define __RDF_LTD__IFC4_IfcBoundaryNodeConditionWarping_H
+
+#include    "classes/IfcBoundaryNodeConditionWarping.h"
+#include    "IfcBoundaryNodeCondition.h"
+#include    "selects/IfcWarpingStiffnessSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(198, IfcBoundaryNodeConditionWarping, 47, WarpingStiffness)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundaryNodeConditionWarping_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundedCurve_H
+#define __RDF_LTD__IFC4_IfcBoundedCurve_H
+
+#include    "classes/IfcBoundedCurve.h"
+#include    "IfcCurve.h"
+
+#endif //__RDF_LTD__IFC4_IfcBoundedCurve_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundedSurface_H
+#define __RDF_LTD__IFC4_IfcBoundedSurface_H
+
+#include    "classes/IfcBoundedSurface.h"
+#include    "IfcSurface.h"
+
+#endif //__RDF_LTD__IFC4_IfcBoundedSurface_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundingBox_H
+#define __RDF_LTD__IFC4_IfcBoundingBox_H
+
+#include    "classes/IfcBoundingBox.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "classes/IfcCartesianPoint.h"
+
+namespace IFC4
+{
+    inline IfcCartesianPoint IfcBoundingBox::get_Corner() { RDF_EXPRESS_PROBE(200); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(200), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcBoundingBox::put_Corner(IfcCartesianPoint inst) { RDF_EXPRESS_PROBE(200); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(200), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(200, IfcBoundingBox, 50, Corner)
+    RDF_EXPRESS_ATTR_ACCESSOR(201, IfcBoundingBox, 50, XDim)
+    RDF_EXPRESS_ATTR_ACCESSOR(202, IfcBoundingBox, 50, YDim)
+    RDF_EXPRESS_ATTR_ACCESSOR(203, IfcBoundingBox, 50, ZDim)
+    RDF_EXPRESS_ATTR_ACCESSOR(204, IfcBoundingBox, 50, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundingBox_H
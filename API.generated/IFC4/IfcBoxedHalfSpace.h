@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoxedHalfSpace_H
+#define __RDF_LTD__IFC4_IfcBoxedHalfSpace_H
+
+#include    "classes/IfcBoxedHalfSpace.h"
+#include    "IfcHalfSpaceSolid.h"
+#include    "classes/IfcBoundingBox.h"
+
+namespace IFC4
+{
+    inline IfcBoundingBox IfcBoxedHalfSpace::get_Enclosure() { RDF_EXPRESS_PROBE(208); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(208), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcBoxedHalfSpace::put_Enclosure(IfcBoundingBox inst) { RDF_EXPRESS_PROBE(208); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(208), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(208, IfcBoxedHalfSpace, 51, Enclosure)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoxedHalfSpace_H
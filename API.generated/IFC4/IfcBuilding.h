@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuilding_H
+#define __RDF_LTD__IFC4_IfcBuilding_H
+
+#include    "classes/IfcBuilding.h"
+#include    "IfcSpatialStructureElement.h"
+#include    "classes/IfcPostalAddress.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(242, IfcBuilding, 56, ElevationOfRefHeight)
+    RDF_EXPRESS_ATTR_ACCESSOR(243, IfcBuilding, 56, ElevationOfTerrain)
+    inline IfcPostalAddress IfcBuilding::get_BuildingAddress() { RDF_EXPRESS_PROBE(244); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(244), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcBuilding::put_BuildingAddress(IfcPostalAddress inst) { RDF_EXPRESS_PROBE(244); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(244), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(244, IfcBuilding, 56, BuildingAddress)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuilding_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingElement_H
+#define __RDF_LTD__IFC4_IfcBuildingElement_H
+
+#include    "classes/IfcBuildingElement.h"
+#include    "IfcElement.h"
+
+#endif //__RDF_LTD__IFC4_IfcBuildingElement_H
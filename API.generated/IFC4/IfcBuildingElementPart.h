@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingElementPart_H
+#define __RDF_LTD__IFC4_IfcBuildingElementPart_H
+
+#include    "classes/IfcBuildingElementPart.h"
+#include    "IfcElementComponent.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(245, IfcBuildingElementPart, 58, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuildingElementPart_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingElementPartType_H
+#define __RDF_LTD__IFC4_IfcBuildingElementPartType_H
+
+#include    "classes/IfcBuildingElementPartType.h"
+#include    "IfcElementComponentType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(246, IfcBuildingElementPartType, 59, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuildingElementPartType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingElementProxy_H
+#define __RDF_LTD__IFC4_IfcBuildingElementProxy_H
+
+#include    "classes/IfcBuildingElementProxy.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(247, IfcBuildingElementProxy, 60, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuildingElementProxy_H
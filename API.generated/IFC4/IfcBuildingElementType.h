@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingElementType_H
+#define __RDF_LTD__IFC4_IfcBuildingElementType_H
+
+#include    "classes/IfcBuildingElementType.h"
+#include    "IfcElementType.h"
+
+#endif //__RDF_LTD__IFC4_IfcBuildingElementType_H
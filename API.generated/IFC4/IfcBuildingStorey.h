@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingStorey_H
+#define __RDF_LTD__IFC4_IfcBuildingStorey_H
+
+#include    "classes/IfcBuildingStorey.h"
+#include    "IfcSpatialStructureElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(249, IfcBuildingStorey, 63, Elevation)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuildingStorey_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingSystem_H
+#define __RDF_LTD__IFC4_IfcBuildingSystem_H
+
+#include    "classes/IfcBuildingSystem.h"
+#include    "IfcSystem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(251, IfcBuildingSystem, 64, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(252, IfcBuildingSystem, 64, LongName)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuildingSystem_H
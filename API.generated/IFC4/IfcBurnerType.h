@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBurnerType_H
+#define __RDF_LTD__IFC4_IfcBurnerType_H
+
+#include    "classes/IfcBurnerType.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(254, IfcBurnerType, 66, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcBurnerType_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCShapeProfileDef_H
+#define __RDF_LTD__IFC4_IfcCShapeProfileDef_H
+
+#include    "classes/IfcCShapeProfileDef.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(431, IfcCShapeProfileDef, 156, Depth)
+    RDF_EXPRESS_ATTR_ACCESSOR(432, IfcCShapeProfileDef, 156, Width)
+    RDF_EXPRESS_ATTR_ACCESSOR(433, IfcCShapeProfileDef, 156, WallThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(434, IfcCShapeProfileDef, 156, Girth)
+    RDF_EXPRESS_ATTR_ACCESSOR(435, IfcCShapeProfileDef, 156, InternalFilletRadius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCShapeProfileDef_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableCarrierFitting_H
+#define __RDF_LTD__IFC4_IfcCableCarrierFitting_H
+
+#include    "classes/IfcCableCarrierFitting.h"
+#include    "IfcFlowFitting.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(255, IfcCableCarrierFitting, 67, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableCarrierFitting_H
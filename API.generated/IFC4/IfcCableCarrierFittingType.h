@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableCarrierFittingType_H
+#define __RDF_LTD__IFC4_IfcCableCarrierFittingType_H
+
+#include    "classes/IfcCableCarrierFittingType.h"
+#include    "IfcFlowFittingType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(256, IfcCableCarrierFittingType, 68, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableCarrierFittingType_H
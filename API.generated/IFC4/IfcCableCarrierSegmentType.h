@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableCarrierSegmentType_H
+#define __RDF_LTD__IFC4_IfcCableCarrierSegmentType_H
+
+#include    "classes/IfcCableCarrierSegmentType.h"
+#include    "IfcFlowSegmentType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(258, IfcCableCarrierSegmentType, 70, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableCarrierSegmentType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableFitting_H
+#define __RDF_LTD__IFC4_IfcCableFitting_H
+
+#include    "classes/IfcCableFitting.h"
+#include    "IfcFlowFitting.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(259, IfcCableFitting, 71, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableFitting_H
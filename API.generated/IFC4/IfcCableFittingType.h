@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableFittingType_H
+#define __RDF_LTD__IFC4_IfcCableFittingType_H
+
+#include    "classes/IfcCableFittingType.h"
+#include    "IfcFlowFittingType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(260, IfcCableFittingType, 72, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableFittingType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableSegment_H
+#define __RDF_LTD__IFC4_IfcCableSegment_H
+
+#include    "classes/IfcCableSegment.h"
+#include    "IfcFlowSegment.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(261, IfcCableSegment, 73, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableSegment_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableSegmentType_H
+#define __RDF_LTD__IFC4_IfcCableSegmentType_H
+
+#include    "classes/IfcCableSegmentType.h"
+#include    "IfcFlowSegmentType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(262, IfcCableSegmentType, 74, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableSegmentType_H
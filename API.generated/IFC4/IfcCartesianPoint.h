@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianPoint_H
+#define __RDF_LTD__IFC4_IfcCartesianPoint_H
+
+#include    "classes/IfcCartesianPoint.h"
+#include    "IfcPoint.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(263, IfcCartesianPoint, 75, Coordinates)
+    RDF_EXPRESS_ATTR_ACCESSOR(264, IfcCartesianPoint, 75, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianPoint_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianPointList_H
+#define __RDF_LTD__IFC4_IfcCartesianPointList_H
+
+#include    "classes/IfcCartesianPointList.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(265, IfcCartesianPointList, 76, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianPointList_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianPointList2D_H
+#define __RDF_LTD__IFC4_IfcCartesianPointList2D_H
+
+#include    "classes/IfcCartesianPointList2D.h"
+#include    "IfcCartesianPointList.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(266, IfcCartesianPointList2D, 77, CoordList)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianPointList2D_H
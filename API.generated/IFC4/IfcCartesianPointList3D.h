@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianPointList3D_H
+#define __RDF_LTD__IFC4_IfcCartesianPointList3D_H
+
+#include    "classes/IfcCartesianPointList3D.h"
+#include    "IfcCartesianPointList.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(267, IfcCartesianPointList3D, 78, CoordList)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianPointList3D_H
@@ -0,0 +1,28 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianTransformationOperator_H
+#define __RDF_LTD__IFC4_IfcCartesianTransformationOperator_H
+
+#include    "classes/IfcCartesianTransformationOperator.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "classes/IfcCartesianPoint.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    inline IfcDirection IfcCartesianTransformationOperator::get_Axis1() { RDF_EXPRESS_PROBE(268); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(268), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcCartesianTransformationOperator::put_Axis1(IfcDirection inst) { RDF_EXPRESS_PROBE(268); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(268), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(268, IfcCartesianTransformationOperator, 79, Axis1)
+    inline IfcDirection IfcCartesianTransformationOperator::get_Axis2() { RDF_EXPRESS_PROBE(269); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(269), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcCartesianTransformationOperator::put_Axis2(IfcDirection inst) { RDF_EXPRESS_PROBE(269); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(269), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(269, IfcCartesianTransformationOperator, 79, Axis2)
+    inline IfcCartesianPoint IfcCartesianTransformationOperator::get_LocalOrigin() { RDF_EXPRESS_PROBE(270); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(270), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcCartesianTransformationOperator::put_LocalOrigin(IfcCartesianPoint inst) { RDF_EXPRESS_PROBE(270); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(270), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(270, IfcCartesianTransformationOperator, 79, LocalOrigin)
+    RDF_EXPRESS_ATTR_ACCESSOR(271, IfcCartesianTransformationOperator, 79, Scale)
+    RDF_EXPRESS_ATTR_ACCESSOR(272, IfcCartesianTransformationOperator, 79, Scl)
+    RDF_EXPRESS_ATTR_ACCESSOR(273, IfcCartesianTransformationOperator, 79, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianTransformationOperator_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianTransformationOperator2D_H
+#define __RDF_LTD__IFC4_IfcCartesianTransformationOperator2D_H
+
+#include    "classes/IfcCartesianTransformationOperator2D.h"
+#include    "IfcCartesianTransformationOperator.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(274, IfcCartesianTransformationOperator2D, 80, U)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianTransformationOperator2D_H
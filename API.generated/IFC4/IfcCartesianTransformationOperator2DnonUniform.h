@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianTransformationOperator2DnonUniform_H
+#define __RDF_LTD__IFC4_IfcCartesianTransformationOperator2DnonUniform_H
+
+#include    "classes/IfcCartesianTransformationOperator2DnonUniform.h"
+#include    "IfcCartesianTransformationOperator2D.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(275, IfcCartesianTransformationOperator2DnonUniform, 81, Scale2)
+    RDF_EXPRESS_ATTR_ACCESSOR(276, IfcCartesianTransformationOperator2DnonUniform, 81, Scl2)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianTransformationOperator2DnonUniform_H
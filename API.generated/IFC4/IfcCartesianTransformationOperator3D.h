@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianTransformationOperator3D_H
+#define __RDF_LTD__IFC4_IfcCartesianTransformationOperator3D_H
+
+#include    "classes/IfcCartesianTransformationOperator3D.h"
+#include    "IfcCartesianTransformationOperator.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    inline IfcDirection IfcCartesianTransformationOperator3D::get_Axis3() { RDF_EXPRESS_PROBE(277); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(277), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcCartesianTransformationOperator3D::put_Axis3(IfcDirection inst) { RDF_EXPRESS_PROBE(277); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(277), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(277, IfcCartesianTransformationOperator3D, 82, Axis3)
+    RDF_EXPRESS_ATTR_ACCESSOR(278, IfcCartesianTransformationOperator3D, 82, U)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianTransformationOperator3D_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianTransformationOperator3DnonUniform_H
+#define __RDF_LTD__IFC4_IfcCartesianTransformationOperator3DnonUniform_H
+
+#include    "classes/IfcCartesianTransformationOperator3DnonUniform.h"
+#include    "IfcCartesianTransformationOperator3D.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(279, IfcCartesianTransformationOperator3DnonUniform, 83, Scale2)
+    RDF_EXPRESS_ATTR_ACCESSOR(280, IfcCartesianTransformationOperator3DnonUniform, 83, Scale3)
+    RDF_EXPRESS_ATTR_ACCESSOR(281, IfcCartesianTransformationOperator3DnonUniform, 83, Scl2)
+    RDF_EXPRESS_ATTR_ACCESSOR(282, IfcCartesianTransformationOperator3DnonUniform, 83, Scl3)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianTransformationOperator3DnonUniform_H
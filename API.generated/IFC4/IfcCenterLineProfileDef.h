@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCenterLineProfileDef_H
+#define __RDF_LTD__IFC4_IfcCenterLineProfileDef_H
+
+#include    "classes/IfcCenterLineProfileDef.h"
+#include    "IfcArbitraryOpenProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(283, IfcCenterLineProfileDef, 84, Thickness)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCenterLineProfileDef_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcChiller_H
+#define __RDF_LTD__IFC4_IfcChiller_H
+
+#include    "classes/IfcChiller.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(284, IfcChiller, 85, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcChiller_H
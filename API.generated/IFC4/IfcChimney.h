@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcChimney_H
+#define __RDF_LTD__IFC4_IfcChimney_H
+
+#include    "classes/IfcChimney.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(286, IfcChimney, 87, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcChimney_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcChimneyType_H
+#define __RDF_LTD__IFC4_IfcChimneyType_H
+
+#include    "classes/IfcChimneyType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(287, IfcChimneyType, 88, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcChimneyType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCircle_H
+#define __RDF_LTD__IFC4_IfcCircle_H
+
+#include    "classes/IfcCircle.h"
+#include    "IfcConic.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(289, IfcCircle, 89, Radius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCircle_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCircleHollowProfileDef_H
+#define __RDF_LTD__IFC4_IfcCircleHollowProfileDef_H
+
+#include    "classes/IfcCircleHollowProfileDef.h"
+#include    "IfcCircleProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(291, IfcCircleHollowProfileDef, 90, WallThickness)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCircleHollowProfileDef_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCircleProfileDef_H
+#define __RDF_LTD__IFC4_IfcCircleProfileDef_H
+
+#include    "classes/IfcCircleProfileDef.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(290, IfcCircleProfileDef, 91, Radius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCircleProfileDef_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCivilElement_H
+#define __RDF_LTD__IFC4_IfcCivilElement_H
+
+#include    "classes/IfcCivilElement.h"
+#include    "IfcElement.h"
+
+#endif //__RDF_LTD__IFC4_IfcCivilElement_H
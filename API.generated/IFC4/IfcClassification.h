@@ -0,0 +1,25 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcClassification_H
+#define __RDF_LTD__IFC4_IfcClassification_H
+
+#include    "classes/IfcClassification.h"
+#include    "IfcExternalInformation.h"
+#include    "classes/IfcClassificationReference.h"
+#include    "classes/IfcRelAssociatesClassification.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(292, IfcClassification, 94, Source)
+    RDF_EXPRESS_ATTR_ACCESSOR(293, IfcClassification, 94, Edition)
+    RDF_EXPRESS_ATTR_ACCESSOR(294, IfcClassification, 94, EditionDate)
+    RDF_EXPRESS_ATTR_ACCESSOR(295, IfcClassification, 94, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(296, IfcClassification, 94, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(297, IfcClassification, 94, Location)
+    RDF_EXPRESS_ATTR_ACCESSOR(298, IfcClassification, 94, ReferenceTokens)
+    RDF_EXPRESS_ATTR_ACCESSOR(299, IfcClassification, 94, ClassificationForObjects)
+    RDF_EXPRESS_ATTR_ACCESSOR(300, IfcClassification, 94, HasReferences)
+}
+
+#endif //__RDF_LTD__IFC4_IfcClassification_H
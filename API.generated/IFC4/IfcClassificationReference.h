@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcClassificationReference_H
+#define __RDF_LTD__IFC4_IfcClassificationReference_H
+
+#include    "classes/IfcClassificationReference.h"
+#include    "IfcExternalReference.h"
+#include    "classes/IfcRelAssociatesClassification.h"
+#include    "selects/IfcClassificationReferenceSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(305, IfcClassificationReference, 95, ReferencedSource)
+    RDF_EXPRESS_ATTR_ACCESSOR(306, IfcClassificationReference, 95, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(307, IfcClassificationReference, 95, Sort)
+    RDF_EXPRESS_ATTR_ACCESSOR(308, IfcClassificationReference, 95, ClassificationRefForObjects)
+    RDF_EXPRESS_ATTR_ACCESSOR(309, IfcClassificationReference, 95, HasReferences)
+}
+
+#endif //__RDF_LTD__IFC4_IfcClassificationReference_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcClosedShell_H
+#define __RDF_LTD__IFC4_IfcClosedShell_H
+
+#include    "classes/IfcClosedShell.h"
+#include    "IfcConnectedFaceSet.h"
+
+#endif //__RDF_LTD__IFC4_IfcClosedShell_H
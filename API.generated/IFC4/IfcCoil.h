@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCoil_H
+#define __RDF_LTD__IFC4_IfcCoil_H
+
+#include    "classes/IfcCoil.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(311, IfcCoil, 97, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCoil_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCoilType_H
+#define __RDF_LTD__IFC4_IfcCoilType_H
+
+#include    "classes/IfcCoilType.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(312, IfcCoilType, 98, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCoilType_H
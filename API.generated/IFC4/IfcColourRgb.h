@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcColourRgb_H
+#define __RDF_LTD__IFC4_IfcColourRgb_H
+
+#include    "classes/IfcColourRgb.h"
+#include    "IfcColourSpecification.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(314, IfcColourRgb, 99, Red)
+    RDF_EXPRESS_ATTR_ACCESSOR(315, IfcColourRgb, 99, Green)
+    RDF_EXPRESS_ATTR_ACCESSOR(316, IfcColourRgb, 99, Blue)
+}
+
+#endif //__RDF_LTD__IFC4_IfcColourRgb_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcColourRgbList_H
+#define __RDF_LTD__IFC4_IfcColourRgbList_H
+
+#include    "classes/IfcColourRgbList.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(317, IfcColourRgbList, 100, ColourList)
+}
+
+#endif //__RDF_LTD__IFC4_IfcColourRgbList_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcColourSpecification_H
+#define __RDF_LTD__IFC4_IfcColourSpecification_H
+
+#include    "classes/IfcColourSpecification.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(313, IfcColourSpecification, 101, Name)
+}
+
+#endif //__RDF_LTD__IFC4_IfcColourSpecification_H
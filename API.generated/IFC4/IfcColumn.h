@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcColumn_H
+#define __RDF_LTD__IFC4_IfcColumn_H
+
+#include    "classes/IfcColumn.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(318, IfcColumn, 102, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcColumn_H
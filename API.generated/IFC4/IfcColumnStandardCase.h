@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcColumnStandardCase_H
+#define __RDF_LTD__IFC4_IfcColumnStandardCase_H
+
+#include    "classes/IfcColumnStandardCase.h"
+#include    "IfcColumn.h"
+
+#endif //__RDF_LTD__IFC4_IfcColumnStandardCase_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcColumnType_H
+#define __RDF_LTD__IFC4_IfcColumnType_H
+
+#include    "classes/IfcColumnType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(319, IfcColumnType, 104, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcColumnType_H
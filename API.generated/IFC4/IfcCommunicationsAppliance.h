@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCommunicationsAppliance_H
+#define __RDF_LTD__IFC4_IfcCommunicationsAppliance_H
+
+#include    "classes/IfcCommunicationsAppliance.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(320, IfcCommunicationsAppliance, 105, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCommunicationsAppliance_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCommunicationsApplianceType_H
+#define __RDF_LTD__IFC4_IfcCommunicationsApplianceType_H
+
+#include    "classes/IfcCommunicationsApplianceType.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(321, IfcCommunicationsApplianceType, 106, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCommunicationsApplianceType_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcComplexProperty_H
+#define __RDF_LTD__IFC4_IfcComplexProperty_H
+
+#include    "classes/IfcComplexProperty.h"
+#include    "IfcProperty.h"
+#include    "classes/IfcProperty.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(331, IfcComplexProperty, 107, UsageName)
+    RDF_EXPRESS_ATTR_ACCESSOR(332, IfcComplexProperty, 107, HasProperties)
+}
+
+#endif //__RDF_LTD__IFC4_IfcComplexProperty_H
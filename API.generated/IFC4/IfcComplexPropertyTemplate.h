@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcComplexPropertyTemplate_H
+#define __RDF_LTD__IFC4_IfcComplexPropertyTemplate_H
+
+#include    "classes/IfcComplexPropertyTemplate.h"
+#include    "IfcPropertyTemplate.h"
+#include    "classes/IfcPropertyTemplate.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(337, IfcComplexPropertyTemplate, 108, UsageName)
+    RDF_EXPRESS_ATTR_ACCESSOR(338, IfcComplexPropertyTemplate, 108, TemplateType)
+    RDF_EXPRESS_ATTR_ACCESSOR(339, IfcComplexPropertyTemplate, 108, HasPropertyTemplates)
+}
+
+#endif //__RDF_LTD__IFC4_IfcComplexPropertyTemplate_H
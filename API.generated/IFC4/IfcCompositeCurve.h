@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCompositeCurve_H
+#define __RDF_LTD__IFC4_IfcCompositeCurve_H
+
+#include    "classes/IfcCompositeCurve.h"
+#include    "IfcBoundedCurve.h"
+#include    "classes/IfcCompositeCurveSegment.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(178, IfcCompositeCurve, 109, Segments)
+    RDF_EXPRESS_ATTR_ACCESSOR(179, IfcCompositeCurve, 109, SelfIntersect)
+    RDF_EXPRESS_ATTR_ACCESSOR(180, IfcCompositeCurve, 109, NSegments)
+    RDF_EXPRESS_ATTR_ACCESSOR(181, IfcCompositeCurve, 109, ClosedCurve)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCompositeCurve_H
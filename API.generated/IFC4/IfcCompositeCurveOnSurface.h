@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCompositeCurveOnSurface_H
+#define __RDF_LTD__IFC4_IfcCompositeCurveOnSurface_H
+
+#include    "classes/IfcCompositeCurveOnSurface.h"
+#include    "IfcCompositeCurve.h"
+#include    "classes/IfcSurface.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(182, IfcCompositeCurveOnSurface, 110, BasisSurface)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCompositeCurveOnSurface_H
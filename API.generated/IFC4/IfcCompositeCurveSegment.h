@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCompositeCurveSegment_H
+#define __RDF_LTD__IFC4_IfcCompositeCurveSegment_H
+
+#include    "classes/IfcCompositeCurveSegment.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "classes/IfcCompositeCurve.h"
+#include    "classes/IfcCurve.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(340, IfcCompositeCurveSegment, 111, Transition)
+    RDF_EXPRESS_ATTR_ACCESSOR(341, IfcCompositeCurveSegment, 111, SameSense)
+    inline IfcCurve IfcCompositeCurveSegment::get_ParentCurve() { RDF_EXPRESS_PROBE(342); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(342), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcCompositeCurveSegment::put_ParentCurve(IfcCurve inst) { RDF_EXPRESS_PROBE(342); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(342), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(342, IfcCompositeCurveSegment, 111, ParentCurve)
+    RDF_EXPRESS_ATTR_ACCESSOR(343, IfcCompositeCurveSegment, 111, UsingCurves)
+    RDF_EXPRESS_ATTR_ACCESSOR(344, IfcCompositeCurveSegment, 111, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCompositeCurveSegment_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCompositeProfileDef_H
+#define __RDF_LTD__IFC4_IfcCompositeProfileDef_H
+
+#include    "classes/IfcCompositeProfileDef.h"
+#include    "IfcProfileDef.h"
+#include    "classes/IfcProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(345, IfcCompositeProfileDef, 112, Profiles)
+    RDF_EXPRESS_ATTR_ACCESSOR(346, IfcCompositeProfileDef, 112, Label)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCompositeProfileDef_H
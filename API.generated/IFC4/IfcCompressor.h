@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCompressor_H
+#define __RDF_LTD__IFC4_IfcCompressor_H
+
+#include    "classes/IfcCompressor.h"
+#include    "IfcFlowMovingDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(347, IfcCompressor, 113, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCompressor_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCompressorType_H
+#define __RDF_LTD__IFC4_IfcCompressorType_H
+
+#include    "classes/IfcCompressorType.h"
+#include    "IfcFlowMovingDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(348, IfcCompressorType, 114, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCompressorType_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConic_H
+#define __RDF_LTD__IFC4_IfcConic_H
+
+#include    "classes/IfcConic.h"
+#include    "IfcCurve.h"
+#include    "selects/IfcAxis2Placement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(288, IfcConic, 117, Position)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConic_H
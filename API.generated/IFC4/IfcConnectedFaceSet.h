@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConnectedFaceSet_H
+#define __RDF_LTD__IFC4_IfcConnectedFaceSet_H
+
+#include    "classes/IfcConnectedFaceSet.h"
+#include    "IfcTopologicalRepresentationItem.h"
+#include    "classes/IfcFace.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(310, IfcConnectedFaceSet, 118, CfsFaces)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConnectedFaceSet_H
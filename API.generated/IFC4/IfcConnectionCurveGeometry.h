@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConnectionCurveGeometry_H
+#define __RDF_LTD__IFC4_IfcConnectionCurveGeometry_H
+
+#include    "classes/IfcConnectionCurveGeometry.h"
+#include    "IfcConnectionGeometry.h"
+#include    "selects/IfcCurveOrEdgeCurve.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(351, IfcConnectionCurveGeometry, 119, CurveOnRelatingElement)
+    RDF_EXPRESS_ATTR_ACCESSOR(352, IfcConnectionCurveGeometry, 119, CurveOnRelatedElement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConnectionCurveGeometry_H
@@ -0,0 +1,9 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConnectionGeometry_H
+#define __RDF_LTD__IFC4_IfcConnectionGeometry_H
+
+#include    "classes/IfcConnectionGeometry.h"
+
+#endif //__RDF_LTD__IFC4_IfcConnectionGeometry_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConnectionPointEccentricity_H
+#define __RDF_LTD__IFC4_IfcConnectionPointEccentricity_H
+
+#include    "classes/IfcConnectionPointEccentricity.h"
+#include    "IfcConnectionPointGeometry.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(355, IfcConnectionPointEccentricity, 121, EccentricityInX)
+    RDF_EXPRESS_ATTR_ACCESSOR(356, IfcConnectionPointEccentricity, 121, EccentricityInY)
+    RDF_EXPRESS_ATTR_ACCESSOR(357, IfcConnectionPointEccentricity, 121, EccentricityInZ)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConnectionPointEccentricity_H
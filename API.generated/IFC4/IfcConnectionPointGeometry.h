@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConnectionPointGeometry_H
+#define __RDF_LTD__IFC4_IfcConnectionPointGeometry_H
+
+#include    "classes/IfcConnectionPointGeometry.h"
+#include    "IfcConnectionGeometry.h"
+#include    "selects/IfcPointOrVertexPoint.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(353, IfcConnectionPointGeometry, 122, PointOnRelatingElement)
+    RDF_EXPRESS_ATTR_ACCESSOR(354, IfcConnectionPointGeometry, 122, PointOnRelatedElement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConnectionPointGeometry_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConnectionSurfaceGeometry_H
+#define __RDF_LTD__IFC4_IfcConnectionSurfaceGeometry_H
+
+#include    "classes/IfcConnectionSurfaceGeometry.h"
+#include    "IfcConnectionGeometry.h"
+#include    "selects/IfcSurfaceOrFaceSurface.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(358, IfcConnectionSurfaceGeometry, 123, SurfaceOnRelatingElement)
+    RDF_EXPRESS_ATTR_ACCESSOR(359, IfcConnectionSurfaceGeometry, 123, SurfaceOnRelatedElement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConnectionSurfaceGeometry_H
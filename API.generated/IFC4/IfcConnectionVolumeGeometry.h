@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConnectionVolumeGeometry_H
+#define __RDF_LTD__IFC4_IfcConnectionVolumeGeometry_H
+
+#include    "classes/IfcConnectionVolumeGeometry.h"
+#include    "IfcConnectionGeometry.h"
+#include    "selects/IfcSolidOrShell.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(360, IfcConnectionVolumeGeometry, 124, VolumeOnRelatingElement)
+    RDF_EXPRESS_ATTR_ACCESSOR(361, IfcConnectionVolumeGeometry, 124, VolumeOnRelatedElement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConnectionVolumeGeometry_H
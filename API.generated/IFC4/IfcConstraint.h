@@ -0,0 +1,25 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstraint_H
+#define __RDF_LTD__IFC4_IfcConstraint_H
+
+#include    "classes/IfcConstraint.h"
+#include    "classes/IfcExternalReferenceRelationship.h"
+#include    "classes/IfcResourceConstraintRelationship.h"
+#include    "selects/IfcActorSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(362, IfcConstraint, 125, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(363, IfcConstraint, 125, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(364, IfcConstraint, 125, ConstraintGrade)
+    RDF_EXPRESS_ATTR_ACCESSOR(365, IfcConstraint, 125, ConstraintSource)
+    RDF_EXPRESS_ATTR_ACCESSOR(366, IfcConstraint, 125, CreatingActor)
+    RDF_EXPRESS_ATTR_ACCESSOR(367, IfcConstraint, 125, CreationTime)
+    RDF_EXPRESS_ATTR_ACCESSOR(368, IfcConstraint, 125, UserDefinedGrade)
+    RDF_EXPRESS_ATTR_ACCESSOR(369, IfcConstraint, 125, HasExternalReferences)
+    RDF_EXPRESS_ATTR_ACCESSOR(370, IfcConstraint, 125, PropertiesForConstraint)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstraint_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionEquipmentResource_H
+#define __RDF_LTD__IFC4_IfcConstructionEquipmentResource_H
+
+#include    "classes/IfcConstructionEquipmentResource.h"
+#include    "IfcConstructionResource.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(377, IfcConstructionEquipmentResource, 126, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionEquipmentResource_H
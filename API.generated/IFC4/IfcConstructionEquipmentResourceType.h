@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionEquipmentResourceType_H
+#define __RDF_LTD__IFC4_IfcConstructionEquipmentResourceType_H
+
+#include    "classes/IfcConstructionEquipmentResourceType.h"
+#include    "IfcConstructionResourceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(384, IfcConstructionEquipmentResourceType, 127, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionEquipmentResourceType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionMaterialResource_H
+#define __RDF_LTD__IFC4_IfcConstructionMaterialResource_H
+
+#include    "classes/IfcConstructionMaterialResource.h"
+#include    "IfcConstructionResource.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(385, IfcConstructionMaterialResource, 128, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionMaterialResource_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionMaterialResourceType_H
+#define __RDF_LTD__IFC4_IfcConstructionMaterialResourceType_H
+
+#include    "classes/IfcConstructionMaterialResourceType.h"
+#include    "IfcConstructionResourceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(386, IfcConstructionMaterialResourceType, 129, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionMaterialResourceType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionProductResource_H
+#define __RDF_LTD__IFC4_IfcConstructionProductResource_H
+
+#include    "classes/IfcConstructionProductResource.h"
+#include    "IfcConstructionResource.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(387, IfcConstructionProductResource, 130, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionProductResource_H
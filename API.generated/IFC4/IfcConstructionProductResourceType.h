@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionProductResourceType_H
+#define __RDF_LTD__IFC4_IfcConstructionProductResourceType_H
+
+#include    "classes/IfcConstructionProductResourceType.h"
+#include    "IfcConstructionResourceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(388, IfcConstructionProductResourceType, 131, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionProductResourceType_H
@@ -0,0 +1,24 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionResource_H
+#define __RDF_LTD__IFC4_IfcConstructionResource_H
+
+#include    "classes/IfcConstructionResource.h"
+#include    "IfcResource.h"
+#include    "classes/IfcAppliedValue.h"
+#include    "classes/IfcPhysicalQuantity.h"
+#include    "classes/IfcResourceTime.h"
+
+namespace IFC4
+{
+    inline IfcResourceTime IfcConstructionResource::get_Usage() { RDF_EXPRESS_PROBE(374); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(374), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcConstructionResource::put_Usage(IfcResourceTime inst) { RDF_EXPRESS_PROBE(374); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(374), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(374, IfcConstructionResource, 132, Usage)
+    RDF_EXPRESS_ATTR_ACCESSOR(375, IfcConstructionResource, 132, BaseCosts)
+    inline IfcPhysicalQuantity IfcConstructionResource::get_BaseQuantity() { RDF_EXPRESS_PROBE(376); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(376), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcConstructionResource::put_BaseQuantity(IfcPhysicalQuantity inst) { RDF_EXPRESS_PROBE(376); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(376), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(376, IfcConstructionResource, 132, BaseQuantity)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionResource_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionResourceType_H
+#define __RDF_LTD__IFC4_IfcConstructionResourceType_H
+
+#include    "classes/IfcConstructionResourceType.h"
+#include    "IfcTypeResource.h"
+#include    "classes/IfcAppliedValue.h"
+#include    "classes/IfcPhysicalQuantity.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(382, IfcConstructionResourceType, 133, BaseCosts)
+    inline IfcPhysicalQuantity IfcConstructionResourceType::get_BaseQuantity() { RDF_EXPRESS_PROBE(383); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(383), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcConstructionResourceType::put_BaseQuantity(IfcPhysicalQuantity inst) { RDF_EXPRESS_PROBE(383); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(383), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(383, IfcConstructionResourceType, 133, BaseQuantity)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionResourceType_H
@@ -0,0 +1,27 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcContext_H
+#define __RDF_LTD__IFC4_IfcContext_H
+
+#include    "classes/IfcContext.h"
+#include    "IfcObjectDefinition.h"
+#include    "classes/IfcRelDeclares.h"
+#include    "classes/IfcRelDefinesByProperties.h"
+#include    "classes/IfcRepresentationContext.h"
+#include    "classes/IfcUnitAssignment.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(389, IfcContext, 134, ObjectType)
+    RDF_EXPRESS_ATTR_ACCESSOR(390, IfcContext, 134, LongName)
+    RDF_EXPRESS_ATTR_ACCESSOR(391, IfcContext, 134, Phase)
+    RDF_EXPRESS_ATTR_ACCESSOR(392, IfcContext, 134, RepresentationContexts)
+    inline IfcUnitAssignment IfcContext::get_UnitsInContext() { RDF_EXPRESS_PROBE(393); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(393), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcContext::put_UnitsInContext(IfcUnitAssignment inst) { RDF_EXPRESS_PROBE(393); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(393), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(393, IfcContext, 134, UnitsInContext)
+    RDF_EXPRESS_ATTR_ACCESSOR(394, IfcContext, 134, IsDefinedBy)
+    RDF_EXPRESS_ATTR_ACCESSOR(395, IfcContext, 134, Declares)
+}
+
+#endif //__RDF_LTD__IFC4_IfcContext_H
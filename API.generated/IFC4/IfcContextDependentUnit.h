@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcContextDependentUnit_H
+#define __RDF_LTD__IFC4_IfcContextDependentUnit_H
+
+#include    "classes/IfcContextDependentUnit.h"
+#include    "IfcNamedUnit.h"
+#include    "classes/IfcExternalReferenceRelationship.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(398, IfcContextDependentUnit, 135, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(399, IfcContextDependentUnit, 135, HasExternalReference)
+}
+
+#endif //__RDF_LTD__IFC4_IfcContextDependentUnit_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcControl_H
+#define __RDF_LTD__IFC4_IfcControl_H
+
+#include    "classes/IfcControl.h"
+#include    "IfcObject.h"
+#include    "classes/IfcRelAssignsToControl.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(16, IfcControl, 136, Identification)
+    RDF_EXPRESS_ATTR_ACCESSOR(17, IfcControl, 136, Controls)
+}
+
+#endif //__RDF_LTD__IFC4_IfcControl_H
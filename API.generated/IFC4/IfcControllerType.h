@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcControllerType_H
+#define __RDF_LTD__IFC4_IfcControllerType_H
+
+#include    "classes/IfcControllerType.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(401, IfcControllerType, 138, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcControllerType_H
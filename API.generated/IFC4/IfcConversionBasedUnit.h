@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConversionBasedUnit_H
+#define __RDF_LTD__IFC4_IfcConversionBasedUnit_H
+
+#include    "classes/IfcConversionBasedUnit.h"
+#include    "IfcNamedUnit.h"
+#include    "classes/IfcExternalReferenceRelationship.h"
+#include    "classes/IfcMeasureWithUnit.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(402, IfcConversionBasedUnit, 139, Name)
+    inline IfcMeasureWithUnit IfcConversionBasedUnit::get_ConversionFactor() { RDF_EXPRESS_PROBE(403); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(403), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcConversionBasedUnit::put_ConversionFactor(IfcMeasureWithUnit inst) { RDF_EXPRESS_PROBE(403); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(403), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(403, IfcConversionBasedUnit, 139, ConversionFactor)
+    RDF_EXPRESS_ATTR_ACCESSOR(404, IfcConversionBasedUnit, 139, HasExternalReference)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConversionBasedUnit_H
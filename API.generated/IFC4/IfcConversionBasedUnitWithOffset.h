@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConversionBasedUnitWithOffset_H
+#define __RDF_LTD__IFC4_IfcConversionBasedUnitWithOffset_H
+
+#include    "classes/IfcConversionBasedUnitWithOffset.h"
+#include    "IfcConversionBasedUnit.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(405, IfcConversionBasedUnitWithOffset, 140, ConversionOffset)
+}
+
+#endif //__RDF_LTD__IFC4_IfcConversionBasedUnitWithOffset_H
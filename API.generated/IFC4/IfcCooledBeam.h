@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCooledBeam_H
+#define __RDF_LTD__IFC4_IfcCooledBeam_H
+
+#include    "classes/IfcCooledBeam.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(406, IfcCooledBeam, 141, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCooledBeam_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCoolingTower_H
+#define __RDF_LTD__IFC4_IfcCoolingTower_H
+
+#include    "classes/IfcCoolingTower.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(408, IfcCoolingTower, 143, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCoolingTower_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCoordinateOperation_H
+#define __RDF_LTD__IFC4_IfcCoordinateOperation_H
+
+#include    "classes/IfcCoordinateOperation.h"
+#include    "classes/IfcCoordinateReferenceSystem.h"
+#include    "selects/IfcCoordinateReferenceSystemSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(410, IfcCoordinateOperation, 145, SourceCRS)
+    inline IfcCoordinateReferenceSystem IfcCoordinateOperation::get_TargetCRS() { RDF_EXPRESS_PROBE(411); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(411), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcCoordinateOperation::put_TargetCRS(IfcCoordinateReferenceSystem inst) { RDF_EXPRESS_PROBE(411); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(411), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(411, IfcCoordinateOperation, 145, TargetCRS)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCoordinateOperation_H
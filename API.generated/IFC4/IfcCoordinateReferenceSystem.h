@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCoordinateReferenceSystem_H
+#define __RDF_LTD__IFC4_IfcCoordinateReferenceSystem_H
+
+#include    "classes/IfcCoordinateReferenceSystem.h"
+#include    "classes/IfcCoordinateOperation.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(412, IfcCoordinateReferenceSystem, 146, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(413, IfcCoordinateReferenceSystem, 146, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(414, IfcCoordinateReferenceSystem, 146, GeodeticDatum)
+    RDF_EXPRESS_ATTR_ACCESSOR(415, IfcCoordinateReferenceSystem, 146, VerticalDatum)
+    RDF_EXPRESS_ATTR_ACCESSOR(416, IfcCoordinateReferenceSystem, 146, HasCoordinateOperation)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCoordinateReferenceSystem_H
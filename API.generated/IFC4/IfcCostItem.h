@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCostItem_H
+#define __RDF_LTD__IFC4_IfcCostItem_H
+
+#include    "classes/IfcCostItem.h"
+#include    "IfcControl.h"
+#include    "classes/IfcCostValue.h"
+#include    "classes/IfcPhysicalQuantity.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(417, IfcCostItem, 147, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(418, IfcCostItem, 147, CostValues)
+    RDF_EXPRESS_ATTR_ACCESSOR(419, IfcCostItem, 147, CostQuantities)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCostItem_H
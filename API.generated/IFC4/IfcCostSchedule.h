@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCostSchedule_H
+#define __RDF_LTD__IFC4_IfcCostSchedule_H
+
+#include    "classes/IfcCostSchedule.h"
+#include    "IfcControl.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(420, IfcCostSchedule, 148, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(421, IfcCostSchedule, 148, Status)
+    RDF_EXPRESS_ATTR_ACCESSOR(422, IfcCostSchedule, 148, SubmittedOn)
+    RDF_EXPRESS_ATTR_ACCESSOR(423, IfcCostSchedule, 148, UpdateDate)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCostSchedule_H
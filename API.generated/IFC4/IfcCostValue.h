@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCostValue_H
+#define __RDF_LTD__IFC4_IfcCostValue_H
+
+#include    "classes/IfcCostValue.h"
+#include    "IfcAppliedValue.h"
+
+#endif //__RDF_LTD__IFC4_IfcCostValue_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCovering_H
+#define __RDF_LTD__IFC4_IfcCovering_H
+
+#include    "classes/IfcCovering.h"
+#include    "IfcBuildingElement.h"
+#include    "classes/IfcRelCoversBldgElements.h"
+#include    "classes/IfcRelCoversSpaces.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(424, IfcCovering, 150, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(425, IfcCovering, 150, CoversSpaces)
+    RDF_EXPRESS_ATTR_ACCESSOR(426, IfcCovering, 150, CoversElements)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCovering_H
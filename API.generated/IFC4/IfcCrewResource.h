@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCrewResource_H
+#define __RDF_LTD__IFC4_IfcCrewResource_H
+
+#include    "classes/IfcCrewResource.h"
+#include    "IfcConstructionResource.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(428, IfcCrewResource, 152, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCrewResource_H
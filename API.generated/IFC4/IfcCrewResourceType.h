@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCrewResourceType_H
+#define __RDF_LTD__IFC4_IfcCrewResourceType_H
+
+#include    "classes/IfcCrewResourceType.h"
+#include    "IfcConstructionResourceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(429, IfcCrewResourceType, 153, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCrewResourceType_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCsgPrimitive3D_H
+#define __RDF_LTD__IFC4_IfcCsgPrimitive3D_H
+
+#include    "classes/IfcCsgPrimitive3D.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "classes/IfcAxis2Placement3D.h"
+
+namespace IFC4
+{
+    inline IfcAxis2Placement3D IfcCsgPrimitive3D::get_Position() { RDF_EXPRESS_PROBE(165); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(165), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcCsgPrimitive3D::put_Position(IfcAxis2Placement3D inst) { RDF_EXPRESS_PROBE(165); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(165), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(165, IfcCsgPrimitive3D, 154, Position)
+    RDF_EXPRESS_ATTR_ACCESSOR(166, IfcCsgPrimitive3D, 154, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCsgPrimitive3D_H
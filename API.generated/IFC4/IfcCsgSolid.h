@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCsgSolid_H
+#define __RDF_LTD__IFC4_IfcCsgSolid_H
+
+#include    "classes/IfcCsgSolid.h"
+#include    "IfcSolidModel.h"
+#include    "selects/IfcCsgSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(430, IfcCsgSolid, 155, TreeRootExpression)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCsgSolid_H
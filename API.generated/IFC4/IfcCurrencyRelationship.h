@@ -0,0 +1,27 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurrencyRelationship_H
+#define __RDF_LTD__IFC4_IfcCurrencyRelationship_H
+
+#include    "classes/IfcCurrencyRelationship.h"
+#include    "IfcResourceLevelRelationship.h"
+#include    "classes/IfcLibraryInformation.h"
+#include    "classes/IfcMonetaryUnit.h"
+
+namespace IFC4
+{
+    inline IfcMonetaryUnit IfcCurrencyRelationship::get_RelatingMonetaryUnit() { RDF_EXPRESS_PROBE(436); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(436), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcCurrencyRelationship::put_RelatingMonetaryUnit(IfcMonetaryUnit inst) { RDF_EXPRESS_PROBE(436); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(436), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(436, IfcCurrencyRelationship, 157, RelatingMonetaryUnit)
+    inline IfcMonetaryUnit IfcCurrencyRelationship::get_RelatedMonetaryUnit() { RDF_EXPRESS_PROBE(437); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(437), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcCurrencyRelationship::put_RelatedMonetaryUnit(IfcMonetaryUnit inst) { RDF_EXPRESS_PROBE(437); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(437), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(437, IfcCurrencyRelationship, 157, RelatedMonetaryUnit)
+    RDF_EXPRESS_ATTR_ACCESSOR(438, IfcCurrencyRelationship, 157, ExchangeRate)
+    RDF_EXPRESS_ATTR_ACCESSOR(439, IfcCurrencyRelationship, 157, RateDateTime)
+    inline IfcLibraryInformation IfcCurrencyRelationship::get_RateSource() { RDF_EXPRESS_PROBE(440); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(440), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcCurrencyRelationship::put_RateSource(IfcLibraryInformation inst) { RDF_EXPRESS_PROBE(440); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(440), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(440, IfcCurrencyRelationship, 157, RateSource)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurrencyRelationship_H
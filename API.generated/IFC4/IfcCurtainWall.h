@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurtainWall_H
+#define __RDF_LTD__IFC4_IfcCurtainWall_H
+
+#include    "classes/IfcCurtainWall.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(441, IfcCurtainWall, 158, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurtainWall_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveBoundedPlane_H
+#define __RDF_LTD__IFC4_IfcCurveBoundedPlane_H
+
+#include    "classes/IfcCurveBoundedPlane.h"
+#include    "IfcBoundedSurface.h"
+#include    "classes/IfcCurve.h"
+#include    "classes/IfcPlane.h"
+
+namespace IFC4
+{
+    inline IfcPlane IfcCurveBoundedPlane::get_BasisSurface() { RDF_EXPRESS_PROBE(443); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(443), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcCurveBoundedPlane::put_BasisSurface(IfcPlane inst) { RDF_EXPRESS_PROBE(443); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(443), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(443, IfcCurveBoundedPlane, 161, BasisSurface)
+    inline IfcCurve IfcCurveBoundedPlane::get_OuterBoundary() { RDF_EXPRESS_PROBE(444); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(444), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcCurveBoundedPlane::put_OuterBoundary(IfcCurve inst) { RDF_EXPRESS_PROBE(444); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(444), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(444, IfcCurveBoundedPlane, 161, OuterBoundary)
+    RDF_EXPRESS_ATTR_ACCESSOR(445, IfcCurveBoundedPlane, 161, InnerBoundaries)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveBoundedPlane_H
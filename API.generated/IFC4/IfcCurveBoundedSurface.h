@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveBoundedSurface_H
+#define __RDF_LTD__IFC4_IfcCurveBoundedSurface_H
+
+#include    "classes/IfcCurveBoundedSurface.h"
+#include    "IfcBoundedSurface.h"
+#include    "classes/IfcBoundaryCurve.h"
+#include    "classes/IfcSurface.h"
+
+namespace IFC4
+{
+    inline IfcSurface IfcCurveBoundedSurface::get_BasisSurface() { RDF_EXPRESS_PROBE(446); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(446), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcCurveBoundedSurface::put_BasisSurface(IfcSurface inst) { RDF_EXPRESS_PROBE(446); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(446), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(446, IfcCurveBoundedSurface, 162, BasisSurface)
+    RDF_EXPRESS_ATTR_ACCESSOR(447, IfcCurveBoundedSurface, 162, Boundaries)
+    RDF_EXPRESS_ATTR_ACCESSOR(448, IfcCurveBoundedSurface, 162, ImplicitOuter)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveBoundedSurface_H
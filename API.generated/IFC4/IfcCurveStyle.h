@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveStyle_H
+#define __RDF_LTD__IFC4_IfcCurveStyle_H
+
+#include    "classes/IfcCurveStyle.h"
+#include    "IfcPresentationStyle.h"
+#include    "selects/IfcColour.h"
+#include    "selects/IfcCurveFontOrScaledCurveFontSelect.h"
+#include    "selects/IfcSizeSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(450, IfcCurveStyle, 163, CurveFont)
+    RDF_EXPRESS_ATTR_ACCESSOR(451, IfcCurveStyle, 163, CurveWidth)
+    RDF_EXPRESS_ATTR_ACCESSOR(452, IfcCurveStyle, 163, CurveColour)
+    RDF_EXPRESS_ATTR_ACCESSOR(453, IfcCurveStyle, 163, ModelOrDraughting)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveStyle_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveStyleFont_H
+#define __RDF_LTD__IFC4_IfcCurveStyleFont_H
+
+#include    "classes/IfcCurveStyleFont.h"
+#include    "IfcPresentationItem.h"
+#include    "classes/IfcCurveStyleFontPattern.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(454, IfcCurveStyleFont, 164, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(455, IfcCurveStyleFont, 164, PatternList)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveStyleFont_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveStyleFontAndScaling_H
+#define __RDF_LTD__IFC4_IfcCurveStyleFontAndScaling_H
+
+#include    "classes/IfcCurveStyleFontAndScaling.h"
+#include    "IfcPresentationItem.h"
+#include    "selects/IfcCurveStyleFontSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(456, IfcCurveStyleFontAndScaling, 165, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(457, IfcCurveStyleFontAndScaling, 165, CurveFont)
+    RDF_EXPRESS_ATTR_ACCESSOR(458, IfcCurveStyleFontAndScaling, 165, CurveFontScaling)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveStyleFontAndScaling_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveStyleFontPattern_H
+#define __RDF_LTD__IFC4_IfcCurveStyleFontPattern_H
+
+#include    "classes/IfcCurveStyleFontPattern.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(459, IfcCurveStyleFontPattern, 166, VisibleSegmentLength)
+    RDF_EXPRESS_ATTR_ACCESSOR(460, IfcCurveStyleFontPattern, 166, InvisibleSegmentLength)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveStyleFontPattern_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCylindricalSurface_H
+#define __RDF_LTD__IFC4_IfcCylindricalSurface_H
+
+#include    "classes/IfcCylindricalSurface.h"
+#include    "IfcElementarySurface.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(462, IfcCylindricalSurface, 167, Radius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcCylindricalSurface_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDamper_H
+#define __RDF_LTD__IFC4_IfcDamper_H
+
+#include    "classes/IfcDamper.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(463, IfcDamper, 168, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDamper_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDamperType_H
+#define __RDF_LTD__IFC4_IfcDamperType_H
+
+#include    "classes/IfcDamperType.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(464, IfcDamperType, 169, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDamperType_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDerivedProfileDef_H
+#define __RDF_LTD__IFC4_IfcDerivedProfileDef_H
+
+#include    "classes/IfcDerivedProfileDef.h"
+#include    "IfcProfileDef.h"
+#include    "classes/IfcCartesianTransformationOperator2D.h"
+#include    "classes/IfcProfileDef.h"
+
+namespace IFC4
+{
+    inline IfcProfileDef IfcDerivedProfileDef::get_ParentProfile() { RDF_EXPRESS_PROBE(465); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(465), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcDerivedProfileDef::put_ParentProfile(IfcProfileDef inst) { RDF_EXPRESS_PROBE(465); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(465), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(465, IfcDerivedProfileDef, 170, ParentProfile)
+    inline IfcCartesianTransformationOperator2D IfcDerivedProfileDef::get_Operator() { RDF_EXPRESS_PROBE(466); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(466), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcDerivedProfileDef::put_Operator(IfcCartesianTransformationOperator2D inst) { RDF_EXPRESS_PROBE(466); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(466), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(466, IfcDerivedProfileDef, 170, Operator)
+    RDF_EXPRESS_ATTR_ACCESSOR(467, IfcDerivedProfileDef, 170, Label)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDerivedProfileDef_H
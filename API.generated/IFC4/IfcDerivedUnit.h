@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDerivedUnit_H
+#define __RDF_LTD__IFC4_IfcDerivedUnit_H
+
+#include    "classes/IfcDerivedUnit.h"
+#include    "classes/IfcDerivedUnitElement.h"
+#include    "classes/IfcDimensionalExponents.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(468, IfcDerivedUnit, 171, Elements)
+    RDF_EXPRESS_ATTR_ACCESSOR(469, IfcDerivedUnit, 171, UnitType)
+    RDF_EXPRESS_ATTR_ACCESSOR(470, IfcDerivedUnit, 171, UserDefinedType)
+    inline IfcDimensionalExponents IfcDerivedUnit::get_Dimensions() { RDF_EXPRESS_PROBE(471); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(471), sdaiINSTANCE, &inst); return inst; }
+    RDF_EXPRESS_ATTR_ACCESSOR(471, IfcDerivedUnit, 171, Dimensions)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDerivedUnit_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDerivedUnitElement_H
+#define __RDF_LTD__IFC4_IfcDerivedUnitElement_H
+
+#include    "classes/IfcDerivedUnitElement.h"
+#include    "classes/IfcNamedUnit.h"
+
+namespace IFC4
+{
+    inline IfcNamedUnit IfcDerivedUnitElement::get_Unit() { RDF_EXPRESS_PROBE(472); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(472), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcDerivedUnitElement::put_Unit(IfcNamedUnit inst) { RDF_EXPRESS_PROBE(472); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(472), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(472, IfcDerivedUnitElement, 172, Unit)
+    RDF_EXPRESS_ATTR_ACCESSOR(473, IfcDerivedUnitElement, 172, Exponent)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDerivedUnitElement_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDimensionalExponents_H
+#define __RDF_LTD__IFC4_IfcDimensionalExponents_H
+
+#include    "classes/IfcDimensionalExponents.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(474, IfcDimensionalExponents, 173, LengthExponent)
+    RDF_EXPRESS_ATTR_ACCESSOR(475, IfcDimensionalExponents, 173, MassExponent)
+    RDF_EXPRESS_ATTR_ACCESSOR(476, IfcDimensionalExponents, 173, TimeExponent)
+    RDF_EXPRESS_ATTR_ACCESSOR(477, IfcDimensionalExponents, 173, ElectricCurrentExponent)
+    RDF_EXPRESS_ATTR_ACCESSOR(478, IfcDimensionalExponents, 173, ThermodynamicTemperatureExponent)
+    RDF_EXPRESS_ATTR_ACCESSOR(479, IfcDimensionalExponents, 173, AmountOfSubstanceExponent)
+    RDF_EXPRESS_ATTR_ACCESSOR(480, IfcDimensionalExponents, 173, LuminousIntensityExponent)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDimensionalExponents_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDirection_H
+#define __RDF_LTD__IFC4_IfcDirection_H
+
+#include    "classes/IfcDirection.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(481, IfcDirection, 174, DirectionRatios)
+    RDF_EXPRESS_ATTR_ACCESSOR(482, IfcDirection, 174, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDirection_H
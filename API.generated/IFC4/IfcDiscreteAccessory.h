@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDiscreteAccessory_H
+#define __RDF_LTD__IFC4_IfcDiscreteAccessory_H
+
+#include    "classes/IfcDiscreteAccessory.h"
+#include    "IfcElementComponent.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(483, IfcDiscreteAccessory, 175, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDiscreteAccessory_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDiscreteAccessoryType_H
+#define __RDF_LTD__IFC4_IfcDiscreteAccessoryType_H
+
+#include    "classes/IfcDiscreteAccessoryType.h"
+#include    "IfcElementComponentType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(484, IfcDiscreteAccessoryType, 176, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDiscreteAccessoryType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionChamberElement_H
+#define __RDF_LTD__IFC4_IfcDistributionChamberElement_H
+
+#include    "classes/IfcDistributionChamberElement.h"
+#include    "IfcDistributionFlowElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(485, IfcDistributionChamberElement, 177, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionChamberElement_H
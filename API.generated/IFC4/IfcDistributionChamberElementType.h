@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionChamberElementType_H
+#define __RDF_LTD__IFC4_IfcDistributionChamberElementType_H
+
+#include    "classes/IfcDistributionChamberElementType.h"
+#include    "IfcDistributionFlowElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(486, IfcDistributionChamberElementType, 178, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionChamberElementType_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionCircuit_H
+#define __RDF_LTD__IFC4_IfcDistributionCircuit_H
+
+#include    "classes/IfcDistributionCircuit.h"
+#include    "IfcDistributionSystem.h"
+
+#endif //__RDF_LTD__IFC4_IfcDistributionCircuit_H
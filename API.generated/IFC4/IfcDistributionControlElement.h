@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionControlElement_H
+#define __RDF_LTD__IFC4_IfcDistributionControlElement_H
+
+#include    "classes/IfcDistributionControlElement.h"
+#include    "IfcDistributionElement.h"
+#include    "classes/IfcRelFlowControlElements.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(44, IfcDistributionControlElement, 180, AssignedToFlowElement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionControlElement_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionControlElementType_H
+#define __RDF_LTD__IFC4_IfcDistributionControlElementType_H
+
+#include    "classes/IfcDistributionControlElementType.h"
+#include    "IfcDistributionElementType.h"
+
+#endif //__RDF_LTD__IFC4_IfcDistributionControlElementType_H
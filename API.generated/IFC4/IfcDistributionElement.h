@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionElement_H
+#define __RDF_LTD__IFC4_IfcDistributionElement_H
+
+#include    "classes/IfcDistributionElement.h"
+#include    "IfcElement.h"
+#include    "classes/IfcRelConnectsPortToElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(43, IfcDistributionElement, 182, HasPorts)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionElement_H
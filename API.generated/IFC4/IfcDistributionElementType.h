@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionElementType_H
+#define __RDF_LTD__IFC4_IfcDistributionElementType_H
+
+#include    "classes/IfcDistributionElementType.h"
+#include    "IfcElementType.h"
+
+#endif //__RDF_LTD__IFC4_IfcDistributionElementType_H
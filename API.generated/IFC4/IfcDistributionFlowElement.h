@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionFlowElement_H
+#define __RDF_LTD__IFC4_IfcDistributionFlowElement_H
+
+#include    "classes/IfcDistributionFlowElement.h"
+#include    "IfcDistributionElement.h"
+#include    "classes/IfcRelFlowControlElements.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(68, IfcDistributionFlowElement, 184, HasControlElements)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionFlowElement_H
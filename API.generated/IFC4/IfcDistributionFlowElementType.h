@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionFlowElementType_H
+#define __RDF_LTD__IFC4_IfcDistributionFlowElementType_H
+
+#include    "classes/IfcDistributionFlowElementType.h"
+#include    "IfcDistributionElementType.h"
+
+#endif //__RDF_LTD__IFC4_IfcDistributionFlowElementType_H
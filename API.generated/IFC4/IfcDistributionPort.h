@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionPort_H
+#define __RDF_LTD__IFC4_IfcDistributionPort_H
+
+#include    "classes/IfcDistributionPort.h"
+#include    "IfcPort.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(492, IfcDistributionPort, 186, FlowDirection)
+    RDF_EXPRESS_ATTR_ACCESSOR(493, IfcDistributionPort, 186, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(494, IfcDistributionPort, 186, SystemType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionPort_H
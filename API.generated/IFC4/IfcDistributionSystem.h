@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionSystem_H
+#define __RDF_LTD__IFC4_IfcDistributionSystem_H
+
+#include    "classes/IfcDistributionSystem.h"
+#include    "IfcSystem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(487, IfcDistributionSystem, 187, LongName)
+    RDF_EXPRESS_ATTR_ACCESSOR(488, IfcDistributionSystem, 187, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionSystem_H
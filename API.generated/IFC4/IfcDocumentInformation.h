@@ -0,0 +1,39 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDocumentInformation_H
+#define __RDF_LTD__IFC4_IfcDocumentInformation_H
+
+#include    "classes/IfcDocumentInformation.h"
+#include    "IfcExternalInformation.h"
+#include    "classes/IfcDocumentInformationRelationship.h"
+#include    "classes/IfcDocumentReference.h"
+#include    "classes/IfcRelAssociatesDocument.h"
+#include    "selects/IfcActorSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(495, IfcDocumentInformation, 188, Identification)
+    RDF_EXPRESS_ATTR_ACCESSOR(496, IfcDocumentInformation, 188, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(497, IfcDocumentInformation, 188, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(498, IfcDocumentInformation, 188, Location)
+    RDF_EXPRESS_ATTR_ACCESSOR(499, IfcDocumentInformation, 188, Purpose)
+    RDF_EXPRESS_ATTR_ACCESSOR(500, IfcDocumentInformation, 188, IntendedUse)
+    RDF_EXPRESS_ATTR_ACCESSOR(501, IfcDocumentInformation, 188, Scope)
+    RDF_EXPRESS_ATTR_ACCESSOR(502, IfcDocumentInformation, 188, Revision)
+    RDF_EXPRESS_ATTR_ACCESSOR(503, IfcDocumentInformation, 188, DocumentOwner)
+    RDF_EXPRESS_ATTR_ACCESSOR(504, IfcDocumentInformation, 188, Editors)
+    RDF_EXPRESS_ATTR_ACCESSOR(505, IfcDocumentInformation, 188, CreationTime)
+    RDF_EXPRESS_ATTR_ACCESSOR(506, IfcDocumentInformation, 188, LastRevisionTime)
+    RDF_EXPRESS_ATTR_ACCESSOR(507, IfcDocumentInformation, 188, ElectronicFormat)
+    RDF_EXPRESS_ATTR_ACCESSOR(508, IfcDocumentInformation, 188, ValidFrom)
+    RDF_EXPRESS_ATTR_ACCESSOR(509, IfcDocumentInformation, 188, ValidUntil)
+    RDF_EXPRESS_ATTR_ACCESSOR(510, IfcDocumentInformation, 188, Confidentiality)
+    RDF_EXPRESS_ATTR_ACCESSOR(511, IfcDocumentInformation, 188, Status)
+    RDF_EXPRESS_ATTR_ACCESSOR(512, IfcDocumentInformation, 188, DocumentInfoForObjects)
+    RDF_EXPRESS_ATTR_ACCESSOR(513, IfcDocumentInformation, 188, HasDocumentReferences)
+    RDF_EXPRESS_ATTR_ACCESSOR(514, IfcDocumentInformation, 188, IsPointedTo)
+    RDF_EXPRESS_ATTR_ACCESSOR(515, IfcDocumentInformation, 188, IsPointer)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDocumentInformation_H
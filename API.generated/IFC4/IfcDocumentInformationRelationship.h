@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDocumentInformationRelationship_H
+#define __RDF_LTD__IFC4_IfcDocumentInformationRelationship_H
+
+#include    "classes/IfcDocumentInformationRelationship.h"
+#include    "IfcResourceLevelRelationship.h"
+#include    "classes/IfcDocumentInformation.h"
+
+namespace IFC4
+{
+    inline IfcDocumentInformation IfcDocumentInformationRelationship::get_RelatingDocument() { RDF_EXPRESS_PROBE(516); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(516), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcDocumentInformationRelationship::put_RelatingDocument(IfcDocumentInformation inst) { RDF_EXPRESS_PROBE(516); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(516), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(516, IfcDocumentInformationRelationship, 189, RelatingDocument)
+    RDF_EXPRESS_ATTR_ACCESSOR(517, IfcDocumentInformationRelationship, 189, RelatedDocuments)
+    RDF_EXPRESS_ATTR_ACCESSOR(518, IfcDocumentInformationRelationship, 189, RelationshipType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDocumentInformationRelationship_H
@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDocumentReference_H
+#define __RDF_LTD__IFC4_IfcDocumentReference_H
+
+#include    "classes/IfcDocumentReference.h"
+#include    "IfcExternalReference.h"
+#include    "classes/IfcDocumentInformation.h"
+#include    "classes/IfcRelAssociatesDocument.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(519, IfcDocumentReference, 190, Description)
+    inline IfcDocumentInformation IfcDocumentReference::get_ReferencedDocument() { RDF_EXPRESS_PROBE(520); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(520), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcDocumentReference::put_ReferencedDocument(IfcDocumentInformation inst) { RDF_EXPRESS_PROBE(520); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(520), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(520, IfcDocumentReference, 190, ReferencedDocument)
+    RDF_EXPRESS_ATTR_ACCESSOR(521, IfcDocumentReference, 190, DocumentRefForObjects)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDocumentReference_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDoor_H
+#define __RDF_LTD__IFC4_IfcDoor_H
+
+#include    "classes/IfcDoor.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(522, IfcDoor, 191, OverallHeight)
+    RDF_EXPRESS_ATTR_ACCESSOR(523, IfcDoor, 191, OverallWidth)
+    RDF_EXPRESS_ATTR_ACCESSOR(524, IfcDoor, 191, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(525, IfcDoor, 191, OperationType)
+    RDF_EXPRESS_ATTR_ACCESSOR(526, IfcDoor, 191, UserDefinedOperationType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDoor_H
@@ -0,0 +1,30 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDoorLiningProperties_H
+#define __RDF_LTD__IFC4_IfcDoorLiningProperties_H
+
+#include    "classes/IfcDoorLiningProperties.h"
+#include    "IfcPreDefinedPropertySet.h"
+#include    "classes/IfcShapeAspect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(530, IfcDoorLiningProperties, 192, LiningDepth)
+    RDF_EXPRESS_ATTR_ACCESSOR(531, IfcDoorLiningProperties, 192, LiningThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(532, IfcDoorLiningProperties, 192, ThresholdDepth)
+    RDF_EXPRESS_ATTR_ACCESSOR(533, IfcDoorLiningProperties, 192, ThresholdThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(534, IfcDoorLiningProperties, 192, TransomThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(535, IfcDoorLiningProperties, 192, TransomOffset)
+    RDF_EXPRESS_ATTR_ACCESSOR(536, IfcDoorLiningProperties, 192, LiningOffset)
+    RDF_EXPRESS_ATTR_ACCESSOR(537, IfcDoorLiningProperties, 192, ThresholdOffset)
+    RDF_EXPRESS_ATTR_ACCESSOR(538, IfcDoorLiningProperties, 192, CasingThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(539, IfcDoorLiningProperties, 192, CasingDepth)
+    inline IfcShapeAspect IfcDoorLiningProperties::get_ShapeAspectStyle() { RDF_EXPRESS_PROBE(540); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(540), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcDoorLiningProperties::put_ShapeAspectStyle(IfcShapeAspect inst) { RDF_EXPRESS_PROBE(540); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(540), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(540, IfcDoorLiningProperties, 192, ShapeAspectStyle)
+    RDF_EXPRESS_ATTR_ACCESSOR(541, IfcDoorLiningProperties, 192, LiningToPanelOffsetX)
+    RDF_EXPRESS_ATTR_ACCESSOR(542, IfcDoorLiningProperties, 192, LiningToPanelOffsetY)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDoorLiningProperties_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDoorPanelProperties_H
+#define __RDF_LTD__IFC4_IfcDoorPanelProperties_H
+
+#include    "classes/IfcDoorPanelProperties.h"
+#include    "IfcPreDefinedPropertySet.h"
+#include    "classes/IfcShapeAspect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(543, IfcDoorPanelProperties, 193, PanelDepth)
+    RDF_EXPRESS_ATTR_ACCESSOR(544, IfcDoorPanelProperties, 193, PanelOperation)
+    RDF_EXPRESS_ATTR_ACCESSOR(545, IfcDoorPanelProperties, 193, PanelWidth)
+    RDF_EXPRESS_ATTR_ACCESSOR(546, IfcDoorPanelProperties, 193, PanelPosition)
+    inline IfcShapeAspect IfcDoorPanelProperties::get_ShapeAspectStyle() { RDF_EXPRESS_PROBE(547); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(547), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcDoorPanelProperties::put_ShapeAspectStyle(IfcShapeAspect inst) { RDF_EXPRESS_PROBE(547); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(547), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(547, IfcDoorPanelProperties, 193, ShapeAspectStyle)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDoorPanelProperties_H
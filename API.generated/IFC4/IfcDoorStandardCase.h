@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDoorStandardCase_H
+#define __RDF_LTD__IFC4_IfcDoorStandardCase_H
+
+#include    "classes/IfcDoorStandardCase.h"
+#include    "IfcDoor.h"
+
+#endif //__RDF_LTD__IFC4_IfcDoorStandardCase_H
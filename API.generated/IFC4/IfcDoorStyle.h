@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDoorStyle_H
+#define __RDF_LTD__IFC4_IfcDoorStyle_H
+
+#include    "classes/IfcDoorStyle.h"
+#include    "IfcTypeProduct.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(548, IfcDoorStyle, 195, OperationType)
+    RDF_EXPRESS_ATTR_ACCESSOR(549, IfcDoorStyle, 195, ConstructionType)
+    RDF_EXPRESS_ATTR_ACCESSOR(550, IfcDoorStyle, 195, ParameterTakesPrecedence)
+    RDF_EXPRESS_ATTR_ACCESSOR(551, IfcDoorStyle, 195, Sizeable)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDoorStyle_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDoorType_H
+#define __RDF_LTD__IFC4_IfcDoorType_H
+
+#include    "classes/IfcDoorType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(552, IfcDoorType, 196, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(553, IfcDoorType, 196, OperationType)
+    RDF_EXPRESS_ATTR_ACCESSOR(554, IfcDoorType, 196, ParameterTakesPrecedence)
+    RDF_EXPRESS_ATTR_ACCESSOR(555, IfcDoorType, 196, UserDefinedOperationType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDoorType_H
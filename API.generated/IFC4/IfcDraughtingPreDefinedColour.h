@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDraughtingPreDefinedColour_H
+#define __RDF_LTD__IFC4_IfcDraughtingPreDefinedColour_H
+
+#include    "classes/IfcDraughtingPreDefinedColour.h"
+#include    "IfcPreDefinedColour.h"
+
+#endif //__RDF_LTD__IFC4_IfcDraughtingPreDefinedColour_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDraughtingPreDefinedCurveFont_H
+#define __RDF_LTD__IFC4_IfcDraughtingPreDefinedCurveFont_H
+
+#include    "classes/IfcDraughtingPreDefinedCurveFont.h"
+#include    "IfcPreDefinedCurveFont.h"
+
+#endif //__RDF_LTD__IFC4_IfcDraughtingPreDefinedCurveFont_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDuctFitting_H
+#define __RDF_LTD__IFC4_IfcDuctFitting_H
+
+#include    "classes/IfcDuctFitting.h"
+#include    "IfcFlowFitting.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(557, IfcDuctFitting, 199, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDuctFitting_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDuctSegment_H
+#define __RDF_LTD__IFC4_IfcDuctSegment_H
+
+#include    "classes/IfcDuctSegment.h"
+#include    "IfcFlowSegment.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(559, IfcDuctSegment, 201, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDuctSegment_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDuctSegmentType_H
+#define __RDF_LTD__IFC4_IfcDuctSegmentType_H
+
+#include    "classes/IfcDuctSegmentType.h"
+#include    "IfcFlowSegmentType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(560, IfcDuctSegmentType, 202, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDuctSegmentType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDuctSilencer_H
+#define __RDF_LTD__IFC4_IfcDuctSilencer_H
+
+#include    "classes/IfcDuctSilencer.h"
+#include    "IfcFlowTreatmentDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(561, IfcDuctSilencer, 203, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDuctSilencer_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDuctSilencerType_H
+#define __RDF_LTD__IFC4_IfcDuctSilencerType_H
+
+#include    "classes/IfcDuctSilencerType.h"
+#include    "IfcFlowTreatmentDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(562, IfcDuctSilencerType, 204, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcDuctSilencerType_H
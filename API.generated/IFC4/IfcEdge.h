@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEdge_H
+#define __RDF_LTD__IFC4_IfcEdge_H
+
+#include    "classes/IfcEdge.h"
+#include    "IfcTopologicalRepresentationItem.h"
+#include    "classes/IfcVertex.h"
+
+namespace IFC4
+{
+    inline IfcVertex IfcEdge::get_EdgeStart() { RDF_EXPRESS_PROBE(563); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(563), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcEdge::put_EdgeStart(IfcVertex inst) { RDF_EXPRESS_PROBE(563); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(563), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(563, IfcEdge, 205, EdgeStart)
+    inline IfcVertex IfcEdge::get_EdgeEnd() { RDF_EXPRESS_PROBE(564); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(564), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcEdge::put_EdgeEnd(IfcVertex inst) { RDF_EXPRESS_PROBE(564); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(564), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(564, IfcEdge, 205, EdgeEnd)
+}
+
+#endif //__RDF_LTD__IFC4_IfcEdge_H
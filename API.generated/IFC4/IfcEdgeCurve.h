@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEdgeCurve_H
+#define __RDF_LTD__IFC4_IfcEdgeCurve_H
+
+#include    "classes/IfcEdgeCurve.h"
+#include    "IfcEdge.h"
+#include    "classes/IfcCurve.h"
+
+namespace IFC4
+{
+    inline IfcCurve IfcEdgeCurve::get_EdgeGeometry() { RDF_EXPRESS_PROBE(565); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(565), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcEdgeCurve::put_EdgeGeometry(IfcCurve inst) { RDF_EXPRESS_PROBE(565); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(565), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(565, IfcEdgeCurve, 206, EdgeGeometry)
+    RDF_EXPRESS_ATTR_ACCESSOR(566, IfcEdgeCurve, 206, SameSense)
+}
+
+#endif //__RDF_LTD__IFC4_IfcEdgeCurve_H
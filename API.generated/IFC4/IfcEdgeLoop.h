@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEdgeLoop_H
+#define __RDF_LTD__IFC4_IfcEdgeLoop_H
+
+#include    "classes/IfcEdgeLoop.h"
+#include    "IfcLoop.h"
+#include    "classes/IfcOrientedEdge.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(567, IfcEdgeLoop, 207, EdgeList)
+    RDF_EXPRESS_ATTR_ACCESSOR(568, IfcEdgeLoop, 207, Ne)
+}
+
+#endif //__RDF_LTD__IFC4_IfcEdgeLoop_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricApplianceType_H
+#define __RDF_LTD__IFC4_IfcElectricApplianceType_H
+
+#include    "classes/IfcElectricApplianceType.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(570, IfcElectricApplianceType, 209, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricApplianceType_H
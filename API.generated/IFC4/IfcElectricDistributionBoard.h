@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricDistributionBoard_H
+#define __RDF_LTD__IFC4_IfcElectricDistributionBoard_H
+
+#include    "classes/IfcElectricDistributionBoard.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(571, IfcElectricDistributionBoard, 210, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricDistributionBoard_H
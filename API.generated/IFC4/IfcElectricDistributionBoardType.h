@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricDistributionBoardType_H
+#define __RDF_LTD__IFC4_IfcElectricDistributionBoardType_H
+
+#include    "classes/IfcElectricDistributionBoardType.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(572, IfcElectricDistributionBoardType, 211, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricDistributionBoardType_H
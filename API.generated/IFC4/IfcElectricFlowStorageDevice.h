@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricFlowStorageDevice_H
+#define __RDF_LTD__IFC4_IfcElectricFlowStorageDevice_H
+
+#include    "classes/IfcElectricFlowStorageDevice.h"
+#include    "IfcFlowStorageDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(573, IfcElectricFlowStorageDevice, 212, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricFlowStorageDevice_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricFlowStorageDeviceType_H
+#define __RDF_LTD__IFC4_IfcElectricFlowStorageDeviceType_H
+
+#include    "classes/IfcElectricFlowStorageDeviceType.h"
+#include    "IfcFlowStorageDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(574, IfcElectricFlowStorageDeviceType, 213, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricFlowStorageDeviceType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricGenerator_H
+#define __RDF_LTD__IFC4_IfcElectricGenerator_H
+
+#include    "classes/IfcElectricGenerator.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(575, IfcElectricGenerator, 214, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricGenerator_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricGeneratorType_H
+#define __RDF_LTD__IFC4_IfcElectricGeneratorType_H
+
+#include    "classes/IfcElectricGeneratorType.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(576, IfcElectricGeneratorType, 215, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricGeneratorType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricMotor_H
+#define __RDF_LTD__IFC4_IfcElectricMotor_H
+
+#include    "classes/IfcElectricMotor.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(577, IfcElectricMotor, 216, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricMotor_H
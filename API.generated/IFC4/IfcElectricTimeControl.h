@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricTimeControl_H
+#define __RDF_LTD__IFC4_IfcElectricTimeControl_H
+
+#include    "classes/IfcElectricTimeControl.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(579, IfcElectricTimeControl, 218, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricTimeControl_H
@@ -0,0 +1,37 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElement_H
+#define __RDF_LTD__IFC4_IfcElement_H
+
+#include    "classes/IfcElement.h"
+#include    "IfcProduct.h"
+#include    "classes/IfcRelConnectsElements.h"
+#include    "classes/IfcRelConnectsWithRealizingElements.h"
+#include    "classes/IfcRelContainedInSpatialStructure.h"
+#include    "classes/IfcRelCoversBldgElements.h"
+#include    "classes/IfcRelFillsElement.h"
+#include    "classes/IfcRelInterferesElements.h"
+#include    "classes/IfcRelProjectsElement.h"
+#include    "classes/IfcRelReferencedInSpatialStructure.h"
+#include    "classes/IfcRelSpaceBoundary.h"
+#include    "classes/IfcRelVoidsElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(30, IfcElement, 220, Tag)
+    RDF_EXPRESS_ATTR_ACCESSOR(31, IfcElement, 220, FillsVoids)
+    RDF_EXPRESS_ATTR_ACCESSOR(32, IfcElement, 220, ConnectedTo)
+    RDF_EXPRESS_ATTR_ACCESSOR(33, IfcElement, 220, IsInterferedByElements)
+    RDF_EXPRESS_ATTR_ACCESSOR(34, IfcElement, 220, InterferesElements)
+    RDF_EXPRESS_ATTR_ACCESSOR(35, IfcElement, 220, HasProjections)
+    RDF_EXPRESS_ATTR_ACCESSOR(36, IfcElement, 220, ReferencedInStructures)
+    RDF_EXPRESS_ATTR_ACCESSOR(37, IfcElement, 220, HasOpenings)
+    RDF_EXPRESS_ATTR_ACCESSOR(38, IfcElement, 220, IsConnectionRealization)
+    RDF_EXPRESS_ATTR_ACCESSOR(39, IfcElement, 220, ProvidesBoundaries)
+    RDF_EXPRESS_ATTR_ACCESSOR(40, IfcElement, 220, ConnectedFrom)
+    RDF_EXPRESS_ATTR_ACCESSOR(41, IfcElement, 220, ContainedInStructure)
+    RDF_EXPRESS_ATTR_ACCESSOR(42, IfcElement, 220, HasCoverings)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElement_H
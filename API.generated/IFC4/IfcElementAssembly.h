@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElementAssembly_H
+#define __RDF_LTD__IFC4_IfcElementAssembly_H
+
+#include    "classes/IfcElementAssembly.h"
+#include    "IfcElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(581, IfcElementAssembly, 222, AssemblyPlace)
+    RDF_EXPRESS_ATTR_ACCESSOR(582, IfcElementAssembly, 222, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElementAssembly_H
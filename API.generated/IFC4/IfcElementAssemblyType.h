@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElementAssemblyType_H
+#define __RDF_LTD__IFC4_IfcElementAssemblyType_H
+
+#include    "classes/IfcElementAssemblyType.h"
+#include    "IfcElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(583, IfcElementAssemblyType, 223, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElementAssemblyType_H
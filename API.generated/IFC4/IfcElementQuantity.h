@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElementQuantity_H
+#define __RDF_LTD__IFC4_IfcElementQuantity_H
+
+#include    "classes/IfcElementQuantity.h"
+#include    "IfcQuantitySet.h"
+#include    "classes/IfcPhysicalQuantity.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(584, IfcElementQuantity, 226, MethodOfMeasurement)
+    RDF_EXPRESS_ATTR_ACCESSOR(585, IfcElementQuantity, 226, Quantities)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElementQuantity_H
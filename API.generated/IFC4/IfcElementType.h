@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElementType_H
+#define __RDF_LTD__IFC4_IfcElementType_H
+
+#include    "classes/IfcElementType.h"
+#include    "IfcTypeProduct.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(52, IfcElementType, 227, ElementType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElementType_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElementarySurface_H
+#define __RDF_LTD__IFC4_IfcElementarySurface_H
+
+#include    "classes/IfcElementarySurface.h"
+#include    "IfcSurface.h"
+#include    "classes/IfcAxis2Placement3D.h"
+
+namespace IFC4
+{
+    inline IfcAxis2Placement3D IfcElementarySurface::get_Position() { RDF_EXPRESS_PROBE(461); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(461), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcElementarySurface::put_Position(IfcAxis2Placement3D inst) { RDF_EXPRESS_PROBE(461); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(461), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(461, IfcElementarySurface, 221, Position)
+}
+
+#endif //__RDF_LTD__IFC4_IfcElementarySurface_H
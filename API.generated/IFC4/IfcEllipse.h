@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEllipse_H
+#define __RDF_LTD__IFC4_IfcEllipse_H
+
+#include    "classes/IfcEllipse.h"
+#include    "IfcConic.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(586, IfcEllipse, 228, SemiAxis1)
+    RDF_EXPRESS_ATTR_ACCESSOR(587, IfcEllipse, 228, SemiAxis2)
+}
+
+#endif //__RDF_LTD__IFC4_IfcEllipse_H
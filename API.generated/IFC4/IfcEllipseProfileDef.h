@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEllipseProfileDef_H
+#define __RDF_LTD__IFC4_IfcEllipseProfileDef_H
+
+#include    "classes/IfcEllipseProfileDef.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(588, IfcEllipseProfileDef, 229, SemiAxis1)
+    RDF_EXPRESS_ATTR_ACCESSOR(589, IfcEllipseProfileDef, 229, SemiAxis2)
+}
+
+#endif //__RDF_LTD__IFC4_IfcEllipseProfileDef_H
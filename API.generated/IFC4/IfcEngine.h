@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEngine_H
+#define __RDF_LTD__IFC4_IfcEngine_H
+
+#include    "classes/IfcEngine.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(590, IfcEngine, 232, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcEngine_H
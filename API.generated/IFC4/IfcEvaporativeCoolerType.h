@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEvaporativeCoolerType_H
+#define __RDF_LTD__IFC4_IfcEvaporativeCoolerType_H
+
+#include    "classes/IfcEvaporativeCoolerType.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(593, IfcEvaporativeCoolerType, 235, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcEvaporativeCoolerType_H
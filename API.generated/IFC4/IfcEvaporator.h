@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEvaporator_H
+#define __RDF_LTD__IFC4_IfcEvaporator_H
+
+#include    "classes/IfcEvaporator.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(594, IfcEvaporator, 236, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcEvaporator_H
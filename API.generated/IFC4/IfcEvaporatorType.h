@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEvaporatorType_H
+#define __RDF_LTD__IFC4_IfcEvaporatorType_H
+
+#include    "classes/IfcEvaporatorType.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(595, IfcEvaporatorType, 237, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcEvaporatorType_H
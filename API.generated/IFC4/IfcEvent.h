@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEvent_H
+#define __RDF_LTD__IFC4_IfcEvent_H
+
+#include    "classes/IfcEvent.h"
+#include    "IfcProcess.h"
+#include    "classes/IfcEventTime.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(601, IfcEvent, 238, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(602, IfcEvent, 238, EventTriggerType)
+    RDF_EXPRESS_ATTR_ACCESSOR(603, IfcEvent, 238, UserDefinedEventTriggerType)
+    inline IfcEventTime IfcEvent::get_EventOccurenceTime() { RDF_EXPRESS_PROBE(604); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(604), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcEvent::put_EventOccurenceTime(IfcEventTime inst) { RDF_EXPRESS_PROBE(604); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(604), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(604, IfcEvent, 238, EventOccurenceTime)
+}
+
+#endif //__RDF_LTD__IFC4_IfcEvent_H
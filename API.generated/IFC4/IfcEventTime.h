@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEventTime_H
+#define __RDF_LTD__IFC4_IfcEventTime_H
+
+#include    "classes/IfcEventTime.h"
+#include    "IfcSchedulingTime.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(608, IfcEventTime, 239, ActualDate)
+    RDF_EXPRESS_ATTR_ACCESSOR(609, IfcEventTime, 239, EarlyDate)
+    RDF_EXPRESS_ATTR_ACCESSOR(610, IfcEventTime, 239, LateDate)
+    RDF_EXPRESS_ATTR_ACCESSOR(611, IfcEventTime, 239, ScheduleDate)
+}
+
+#endif //__RDF_LTD__IFC4_IfcEventTime_H
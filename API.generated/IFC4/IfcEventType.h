@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEventType_H
+#define __RDF_LTD__IFC4_IfcEventType_H
+
+#include    "classes/IfcEventType.h"
+#include    "IfcTypeProcess.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(616, IfcEventType, 240, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(617, IfcEventType, 240, EventTriggerType)
+    RDF_EXPRESS_ATTR_ACCESSOR(618, IfcEventType, 240, UserDefinedEventTriggerType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcEventType_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExtendedProperties_H
+#define __RDF_LTD__IFC4_IfcExtendedProperties_H
+
+#include    "classes/IfcExtendedProperties.h"
+#include    "IfcPropertyAbstraction.h"
+#include    "classes/IfcProperty.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(619, IfcExtendedProperties, 241, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(620, IfcExtendedProperties, 241, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(621, IfcExtendedProperties, 241, Properties)
+}
+
+#endif //__RDF_LTD__IFC4_IfcExtendedProperties_H
@@ -0,0 +1,9 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternalInformation_H
+#define __RDF_LTD__IFC4_IfcExternalInformation_H
+
+#include    "classes/IfcExternalInformation.h"
+
+#endif //__RDF_LTD__IFC4_IfcExternalInformation_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternalReference_H
+#define __RDF_LTD__IFC4_IfcExternalReference_H
+
+#include    "classes/IfcExternalReference.h"
+#include    "classes/IfcExternalReferenceRelationship.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(301, IfcExternalReference, 246, Location)
+    RDF_EXPRESS_ATTR_ACCESSOR(302, IfcExternalReference, 246, Identification)
+    RDF_EXPRESS_ATTR_ACCESSOR(303, IfcExternalReference, 246, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(304, IfcExternalReference, 246, ExternalReferenceForResources)
+}
+
+#endif //__RDF_LTD__IFC4_IfcExternalReference_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternalReferenceRelationship_H
+#define __RDF_LTD__IFC4_IfcExternalReferenceRelationship_H
+
+#include    "classes/IfcExternalReferenceRelationship.h"
+#include    "IfcResourceLevelRelationship.h"
+#include    "classes/IfcExternalReference.h"
+#include    "selects/IfcResourceObjectSelect.h"
+
+namespace IFC4
+{
+    inline IfcExternalReference IfcExternalReferenceRelationship::get_RelatingReference() { RDF_EXPRESS_PROBE(622); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(622), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcExternalReferenceRelationship::put_RelatingReference(IfcExternalReference inst) { RDF_EXPRESS_PROBE(622); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(622), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(622, IfcExternalReferenceRelationship, 247, RelatingReference)
+    RDF_EXPRESS_ATTR_ACCESSOR(623, IfcExternalReferenceRelationship, 247, RelatedResourceObjects)
+}
+
+#endif //__RDF_LTD__IFC4_IfcExternalReferenceRelationship_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternalSpatialElement_H
+#define __RDF_LTD__IFC4_IfcExternalSpatialElement_H
+
+#include    "classes/IfcExternalSpatialElement.h"
+#include    "IfcExternalSpatialStructureElement.h"
+#include    "classes/IfcRelSpaceBoundary.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(624, IfcExternalSpatialElement, 248, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(625, IfcExternalSpatialElement, 248, BoundedBy)
+}
+
+#endif //__RDF_LTD__IFC4_IfcExternalSpatialElement_H
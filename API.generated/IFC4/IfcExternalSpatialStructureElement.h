@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternalSpatialStructureElement_H
+#define __RDF_LTD__IFC4_IfcExternalSpatialStructureElement_H
+
+#include    "classes/IfcExternalSpatialStructureElement.h"
+#include    "IfcSpatialElement.h"
+
+#endif //__RDF_LTD__IFC4_IfcExternalSpatialStructureElement_H
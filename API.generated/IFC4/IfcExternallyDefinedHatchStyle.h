@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternallyDefinedHatchStyle_H
+#define __RDF_LTD__IFC4_IfcExternallyDefinedHatchStyle_H
+
+#include    "classes/IfcExternallyDefinedHatchStyle.h"
+#include    "IfcExternalReference.h"
+
+#endif //__RDF_LTD__IFC4_IfcExternallyDefinedHatchStyle_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternallyDefinedSurfaceStyle_H
+#define __RDF_LTD__IFC4_IfcExternallyDefinedSurfaceStyle_H
+
+#include    "classes/IfcExternallyDefinedSurfaceStyle.h"
+#include    "IfcExternalReference.h"
+
+#endif //__RDF_LTD__IFC4_IfcExternallyDefinedSurfaceStyle_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternallyDefinedTextFont_H
+#define __RDF_LTD__IFC4_IfcExternallyDefinedTextFont_H
+
+#include    "classes/IfcExternallyDefinedTextFont.h"
+#include    "IfcExternalReference.h"
+
+#endif //__RDF_LTD__IFC4_IfcExternallyDefinedTextFont_H
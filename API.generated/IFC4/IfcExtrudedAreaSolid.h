@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExtrudedAreaSolid_H
+#define __RDF_LTD__IFC4_IfcExtrudedAreaSolid_H
+
+#include    "classes/IfcExtrudedAreaSolid.h"
+#include    "IfcSweptAreaSolid.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    inline IfcDirection IfcExtrudedAreaSolid::get_ExtrudedDirection() { RDF_EXPRESS_PROBE(628); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(628), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcExtrudedAreaSolid::put_ExtrudedDirection(IfcDirection inst) { RDF_EXPRESS_PROBE(628); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(628), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(628, IfcExtrudedAreaSolid, 250, ExtrudedDirection)
+    RDF_EXPRESS_ATTR_ACCESSOR(629, IfcExtrudedAreaSolid, 250, Depth)
+}
+
+#endif //__RDF_LTD__IFC4_IfcExtrudedAreaSolid_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExtrudedAreaSolidTapered_H
+#define __RDF_LTD__IFC4_IfcExtrudedAreaSolidTapered_H
+
+#include    "classes/IfcExtrudedAreaSolidTapered.h"
+#include    "IfcExtrudedAreaSolid.h"
+#include    "classes/IfcProfileDef.h"
+
+namespace IFC4
+{
+    inline IfcProfileDef IfcExtrudedAreaSolidTapered::get_EndSweptArea() { RDF_EXPRESS_PROBE(630); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(630), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcExtrudedAreaSolidTapered::put_EndSweptArea(IfcProfileDef inst) { RDF_EXPRESS_PROBE(630); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(630), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(630, IfcExtrudedAreaSolidTapered, 251, EndSweptArea)
+}
+
+#endif //__RDF_LTD__IFC4_IfcExtrudedAreaSolidTapered_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFace_H
+#define __RDF_LTD__IFC4_IfcFace_H
+
+#include    "classes/IfcFace.h"
+#include    "IfcTopologicalRepresentationItem.h"
+#include    "classes/IfcFaceBound.h"
+#include    "classes/IfcTextureMap.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(64, IfcFace, 252, Bounds)
+    RDF_EXPRESS_ATTR_ACCESSOR(65, IfcFace, 252, HasTextureMaps)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFace_H
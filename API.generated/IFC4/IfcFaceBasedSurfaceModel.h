@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFaceBasedSurfaceModel_H
+#define __RDF_LTD__IFC4_IfcFaceBasedSurfaceModel_H
+
+#include    "classes/IfcFaceBasedSurfaceModel.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "classes/IfcConnectedFaceSet.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(631, IfcFaceBasedSurfaceModel, 253, FbsmFaces)
+    RDF_EXPRESS_ATTR_ACCESSOR(632, IfcFaceBasedSurfaceModel, 253, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFaceBasedSurfaceModel_H
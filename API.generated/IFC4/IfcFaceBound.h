@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFaceBound_H
+#define __RDF_LTD__IFC4_IfcFaceBound_H
+
+#include    "classes/IfcFaceBound.h"
+#include    "IfcTopologicalRepresentationItem.h"
+#include    "classes/IfcLoop.h"
+
+namespace IFC4
+{
+    inline IfcLoop IfcFaceBound::get_Bound() { RDF_EXPRESS_PROBE(633); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(633), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcFaceBound::put_Bound(IfcLoop inst) { RDF_EXPRESS_PROBE(633); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(633), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(633, IfcFaceBound, 254, Bound)
+    RDF_EXPRESS_ATTR_ACCESSOR(634, IfcFaceBound, 254, Orientation)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFaceBound_H
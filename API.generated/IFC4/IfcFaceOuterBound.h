@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFaceOuterBound_H
+#define __RDF_LTD__IFC4_IfcFaceOuterBound_H
+
+#include    "classes/IfcFaceOuterBound.h"
+#include    "IfcFaceBound.h"
+
+#endif //__RDF_LTD__IFC4_IfcFaceOuterBound_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFaceSurface_H
+#define __RDF_LTD__IFC4_IfcFaceSurface_H
+
+#include    "classes/IfcFaceSurface.h"
+#include    "IfcFace.h"
+#include    "classes/IfcSurface.h"
+
+namespace IFC4
+{
+    inline IfcSurface IfcFaceSurface::get_FaceSurface() { RDF_EXPRESS_PROBE(66); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(66), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcFaceSurface::put_FaceSurface(IfcSurface inst) { RDF_EXPRESS_PROBE(66); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(66), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(66, IfcFaceSurface, 256, FaceSurface)
+    RDF_EXPRESS_ATTR_ACCESSOR(67, IfcFaceSurface, 256, SameSense)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFaceSurface_H
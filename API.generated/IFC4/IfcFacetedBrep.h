@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFacetedBrep_H
+#define __RDF_LTD__IFC4_IfcFacetedBrep_H
+
+#include    "classes/IfcFacetedBrep.h"
+#include    "IfcManifoldSolidBrep.h"
+
+#endif //__RDF_LTD__IFC4_IfcFacetedBrep_H
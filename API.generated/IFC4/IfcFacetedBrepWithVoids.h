@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFacetedBrepWithVoids_H
+#define __RDF_LTD__IFC4_IfcFacetedBrepWithVoids_H
+
+#include    "classes/IfcFacetedBrepWithVoids.h"
+#include    "IfcFacetedBrep.h"
+#include    "classes/IfcClosedShell.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(635, IfcFacetedBrepWithVoids, 258, Voids)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFacetedBrepWithVoids_H
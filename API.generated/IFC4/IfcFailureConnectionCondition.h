@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFailureConnectionCondition_H
+#define __RDF_LTD__IFC4_IfcFailureConnectionCondition_H
+
+#include    "classes/IfcFailureConnectionCondition.h"
+#include    "IfcStructuralConnectionCondition.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(637, IfcFailureConnectionCondition, 259, TensionFailureX)
+    RDF_EXPRESS_ATTR_ACCESSOR(638, IfcFailureConnectionCondition, 259, TensionFailureY)
+    RDF_EXPRESS_ATTR_ACCESSOR(639, IfcFailureConnectionCondition, 259, TensionFailureZ)
+    RDF_EXPRESS_ATTR_ACCESSOR(640, IfcFailureConnectionCondition, 259, CompressionFailureX)
+    RDF_EXPRESS_ATTR_ACCESSOR(641, IfcFailureConnectionCondition, 259, CompressionFailureY)
+    RDF_EXPRESS_ATTR_ACCESSOR(642, IfcFailureConnectionCondition, 259, CompressionFailureZ)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFailureConnectionCondition_H
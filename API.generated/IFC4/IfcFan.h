@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFan_H
+#define __RDF_LTD__IFC4_IfcFan_H
+
+#include    "classes/IfcFan.h"
+#include    "IfcFlowMovingDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(643, IfcFan, 260, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFan_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFanType_H
+#define __RDF_LTD__IFC4_IfcFanType_H
+
+#include    "classes/IfcFanType.h"
+#include    "IfcFlowMovingDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(644, IfcFanType, 261, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFanType_H
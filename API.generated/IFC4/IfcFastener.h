@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFastener_H
+#define __RDF_LTD__IFC4_IfcFastener_H
+
+#include    "classes/IfcFastener.h"
+#include    "IfcElementComponent.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(645, IfcFastener, 262, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFastener_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFastenerType_H
+#define __RDF_LTD__IFC4_IfcFastenerType_H
+
+#include    "classes/IfcFastenerType.h"
+#include    "IfcElementComponentType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(646, IfcFastenerType, 263, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFastenerType_H
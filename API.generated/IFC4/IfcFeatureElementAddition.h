@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFeatureElementAddition_H
+#define __RDF_LTD__IFC4_IfcFeatureElementAddition_H
+
+#include    "classes/IfcFeatureElementAddition.h"
+#include    "IfcFeatureElement.h"
+#include    "classes/IfcRelProjectsElement.h"
+
+namespace IFC4
+{
+    inline IfcRelProjectsElement IfcFeatureElementAddition::get_ProjectsElements() { RDF_EXPRESS_PROBE(647); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(647), sdaiINSTANCE, &inst); return inst; }
+    RDF_EXPRESS_ATTR_ACCESSOR(647, IfcFeatureElementAddition, 265, ProjectsElements)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFeatureElementAddition_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFeatureElementSubtraction_H
+#define __RDF_LTD__IFC4_IfcFeatureElementSubtraction_H
+
+#include    "classes/IfcFeatureElementSubtraction.h"
+#include    "IfcFeatureElement.h"
+#include    "classes/IfcRelVoidsElement.h"
+
+namespace IFC4
+{
+    inline IfcRelVoidsElement IfcFeatureElementSubtraction::get_VoidsElements() { RDF_EXPRESS_PROBE(648); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(648), sdaiINSTANCE, &inst); return inst; }
+    RDF_EXPRESS_ATTR_ACCESSOR(648, IfcFeatureElementSubtraction, 266, VoidsElements)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFeatureElementSubtraction_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFillAreaStyle_H
+#define __RDF_LTD__IFC4_IfcFillAreaStyle_H
+
+#include    "classes/IfcFillAreaStyle.h"
+#include    "IfcPresentationStyle.h"
+#include    "selects/IfcFillStyleSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(649, IfcFillAreaStyle, 267, FillStyles)
+    RDF_EXPRESS_ATTR_ACCESSOR(650, IfcFillAreaStyle, 267, ModelorDraughting)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFillAreaStyle_H
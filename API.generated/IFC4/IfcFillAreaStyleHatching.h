@@ -0,0 +1,28 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFillAreaStyleHatching_H
+#define __RDF_LTD__IFC4_IfcFillAreaStyleHatching_H
+
+#include    "classes/IfcFillAreaStyleHatching.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "classes/IfcCartesianPoint.h"
+#include    "classes/IfcCurveStyle.h"
+#include    "selects/IfcHatchLineDistanceSelect.h"
+
+namespace IFC4
+{
+    inline IfcCurveStyle IfcFillAreaStyleHatching::get_HatchLineAppearance() { RDF_EXPRESS_PROBE(651); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(651), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcFillAreaStyleHatching::put_HatchLineAppearance(IfcCurveStyle inst) { RDF_EXPRESS_PROBE(651); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(651), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(651, IfcFillAreaStyleHatching, 268, HatchLineAppearance)
+    RDF_EXPRESS_ATTR_ACCESSOR(652, IfcFillAreaStyleHatching, 268, StartOfNextHatchLine)
+    inline IfcCartesianPoint IfcFillAreaStyleHatching::get_PointOfReferenceHatchLine() { RDF_EXPRESS_PROBE(653); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(653), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcFillAreaStyleHatching::put_PointOfReferenceHatchLine(IfcCartesianPoint inst) { RDF_EXPRESS_PROBE(653); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(653), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(653, IfcFillAreaStyleHatching, 268, PointOfReferenceHatchLine)
+    inline IfcCartesianPoint IfcFillAreaStyleHatching::get_PatternStart() { RDF_EXPRESS_PROBE(654); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(654), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcFillAreaStyleHatching::put_PatternStart(IfcCartesianPoint inst) { RDF_EXPRESS_PROBE(654); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(654), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(654, IfcFillAreaStyleHatching, 268, PatternStart)
+    RDF_EXPRESS_ATTR_ACCESSOR(655, IfcFillAreaStyleHatching, 268, HatchLineAngle)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFillAreaStyleHatching_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFillAreaStyleTiles_H
+#define __RDF_LTD__IFC4_IfcFillAreaStyleTiles_H
+
+#include    "classes/IfcFillAreaStyleTiles.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "classes/IfcStyledItem.h"
+#include    "classes/IfcVector.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(656, IfcFillAreaStyleTiles, 269, TilingPattern)
+    RDF_EXPRESS_ATTR_ACCESSOR(657, IfcFillAreaStyleTiles, 269, Tiles)
+    RDF_EXPRESS_ATTR_ACCESSOR(658, IfcFillAreaStyleTiles, 269, TilingScale)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFillAreaStyleTiles_H
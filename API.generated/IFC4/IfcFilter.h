@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFilter_H
+#define __RDF_LTD__IFC4_IfcFilter_H
+
+#include    "classes/IfcFilter.h"
+#include    "IfcFlowTreatmentDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(659, IfcFilter, 270, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFilter_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFilterType_H
+#define __RDF_LTD__IFC4_IfcFilterType_H
+
+#include    "classes/IfcFilterType.h"
+#include    "IfcFlowTreatmentDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(660, IfcFilterType, 271, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFilterType_H
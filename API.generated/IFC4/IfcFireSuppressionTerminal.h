@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFireSuppressionTerminal_H
+#define __RDF_LTD__IFC4_IfcFireSuppressionTerminal_H
+
+#include    "classes/IfcFireSuppressionTerminal.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(661, IfcFireSuppressionTerminal, 272, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFireSuppressionTerminal_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFireSuppressionTerminalType_H
+#define __RDF_LTD__IFC4_IfcFireSuppressionTerminalType_H
+
+#include    "classes/IfcFireSuppressionTerminalType.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(662, IfcFireSuppressionTerminalType, 273, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFireSuppressionTerminalType_H
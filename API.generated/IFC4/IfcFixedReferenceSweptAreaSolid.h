@@ -0,0 +1,24 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFixedReferenceSweptAreaSolid_H
+#define __RDF_LTD__IFC4_IfcFixedReferenceSweptAreaSolid_H
+
+#include    "classes/IfcFixedReferenceSweptAreaSolid.h"
+#include    "IfcSweptAreaSolid.h"
+#include    "classes/IfcCurve.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    inline IfcCurve IfcFixedReferenceSweptAreaSolid::get_Directrix() { RDF_EXPRESS_PROBE(663); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(663), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcFixedReferenceSweptAreaSolid::put_Directrix(IfcCurve inst) { RDF_EXPRESS_PROBE(663); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(663), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(663, IfcFixedReferenceSweptAreaSolid, 274, Directrix)
+    RDF_EXPRESS_ATTR_ACCESSOR(664, IfcFixedReferenceSweptAreaSolid, 274, StartParam)
+    RDF_EXPRESS_ATTR_ACCESSOR(665, IfcFixedReferenceSweptAreaSolid, 274, EndParam)
+    inline IfcDirection IfcFixedReferenceSweptAreaSolid::get_FixedReference() { RDF_EXPRESS_PROBE(666); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(666), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcFixedReferenceSweptAreaSolid::put_FixedReference(IfcDirection inst) { RDF_EXPRESS_PROBE(666); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(666), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(666, IfcFixedReferenceSweptAreaSolid, 274, FixedReference)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFixedReferenceSweptAreaSolid_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowControllerType_H
+#define __RDF_LTD__IFC4_IfcFlowControllerType_H
+
+#include    "classes/IfcFlowControllerType.h"
+#include    "IfcDistributionFlowElementType.h"
+
+#endif //__RDF_LTD__IFC4_IfcFlowControllerType_H
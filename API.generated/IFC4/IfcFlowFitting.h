@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowFitting_H
+#define __RDF_LTD__IFC4_IfcFlowFitting_H
+
+#include    "classes/IfcFlowFitting.h"
+#include    "IfcDistributionFlowElement.h"
+
+#endif //__RDF_LTD__IFC4_IfcFlowFitting_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowFittingType_H
+#define __RDF_LTD__IFC4_IfcFlowFittingType_H
+
+#include    "classes/IfcFlowFittingType.h"
+#include    "IfcDistributionFlowElementType.h"
+
+#endif //__RDF_LTD__IFC4_IfcFlowFittingType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowInstrument_H
+#define __RDF_LTD__IFC4_IfcFlowInstrument_H
+
+#include    "classes/IfcFlowInstrument.h"
+#include    "IfcDistributionControlElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(667, IfcFlowInstrument, 279, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowInstrument_H
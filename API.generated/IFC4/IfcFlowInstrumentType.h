@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowInstrumentType_H
+#define __RDF_LTD__IFC4_IfcFlowInstrumentType_H
+
+#include    "classes/IfcFlowInstrumentType.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(668, IfcFlowInstrumentType, 280, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowInstrumentType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowMeter_H
+#define __RDF_LTD__IFC4_IfcFlowMeter_H
+
+#include    "classes/IfcFlowMeter.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(669, IfcFlowMeter, 281, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowMeter_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowMeterType_H
+#define __RDF_LTD__IFC4_IfcFlowMeterType_H
+
+#include    "classes/IfcFlowMeterType.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(670, IfcFlowMeterType, 282, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowMeterType_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowMovingDevice_H
+#define __RDF_LTD__IFC4_IfcFlowMovingDevice_H
+
+#include    "classes/IfcFlowMovingDevice.h"
+#include    "IfcDistributionFlowElement.h"
+
+#endif //__RDF_LTD__IFC4_IfcFlowMovingDevice_H
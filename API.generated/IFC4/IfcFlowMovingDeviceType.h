@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowMovingDeviceType_H
+#define __RDF_LTD__IFC4_IfcFlowMovingDeviceType_H
+
+#include    "classes/IfcFlowMovingDeviceType.h"
+#include    "IfcDistributionFlowElementType.h"
+
+#endif //__RDF_LTD__IFC4_IfcFlowMovingDeviceType_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowSegmentType_H
+#define __RDF_LTD__IFC4_IfcFlowSegmentType_H
+
+#include    "classes/IfcFlowSegmentType.h"
+#include    "IfcDistributionFlowElementType.h"
+
+#endif //__RDF_LTD__IFC4_IfcFlowSegmentType_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowTerminal_H
+#define __RDF_LTD__IFC4_IfcFlowTerminal_H
+
+#include    "classes/IfcFlowTerminal.h"
+#include    "IfcDistributionFlowElement.h"
+
+#endif //__RDF_LTD__IFC4_IfcFlowTerminal_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFooting_H
+#define __RDF_LTD__IFC4_IfcFooting_H
+
+#include    "classes/IfcFooting.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(671, IfcFooting, 293, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFooting_H
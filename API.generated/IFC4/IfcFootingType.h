@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFootingType_H
+#define __RDF_LTD__IFC4_IfcFootingType_H
+
+#include    "classes/IfcFootingType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(672, IfcFootingType, 294, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFootingType_H
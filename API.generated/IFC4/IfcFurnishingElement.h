@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFurnishingElement_H
+#define __RDF_LTD__IFC4_IfcFurnishingElement_H
+
+#include    "classes/IfcFurnishingElement.h"
+#include    "IfcElement.h"
+
+#endif //__RDF_LTD__IFC4_IfcFurnishingElement_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFurniture_H
+#define __RDF_LTD__IFC4_IfcFurniture_H
+
+#include    "classes/IfcFurniture.h"
+#include    "IfcFurnishingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(673, IfcFurniture, 297, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFurniture_H
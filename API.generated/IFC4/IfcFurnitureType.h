@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFurnitureType_H
+#define __RDF_LTD__IFC4_IfcFurnitureType_H
+
+#include    "classes/IfcFurnitureType.h"
+#include    "IfcFurnishingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(674, IfcFurnitureType, 298, AssemblyPlace)
+    RDF_EXPRESS_ATTR_ACCESSOR(675, IfcFurnitureType, 298, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcFurnitureType_H
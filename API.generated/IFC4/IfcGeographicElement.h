@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeographicElement_H
+#define __RDF_LTD__IFC4_IfcGeographicElement_H
+
+#include    "classes/IfcGeographicElement.h"
+#include    "IfcElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(676, IfcGeographicElement, 299, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcGeographicElement_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeographicElementType_H
+#define __RDF_LTD__IFC4_IfcGeographicElementType_H
+
+#include    "classes/IfcGeographicElementType.h"
+#include    "IfcElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(677, IfcGeographicElementType, 300, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcGeographicElementType_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeometricCurveSet_H
+#define __RDF_LTD__IFC4_IfcGeometricCurveSet_H
+
+#include    "classes/IfcGeometricCurveSet.h"
+#include    "IfcGeometricSet.h"
+
+#endif //__RDF_LTD__IFC4_IfcGeometricCurveSet_H
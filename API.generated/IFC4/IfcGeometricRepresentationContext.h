@@ -0,0 +1,26 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeometricRepresentationContext_H
+#define __RDF_LTD__IFC4_IfcGeometricRepresentationContext_H
+
+#include    "classes/IfcGeometricRepresentationContext.h"
+#include    "IfcRepresentationContext.h"
+#include    "classes/IfcCoordinateOperation.h"
+#include    "classes/IfcDirection.h"
+#include    "classes/IfcGeometricRepresentationSubContext.h"
+#include    "selects/IfcAxis2Placement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(683, IfcGeometricRepresentationContext, 302, CoordinateSpaceDimension)
+    RDF_EXPRESS_ATTR_ACCESSOR(684, IfcGeometricRepresentationContext, 302, Precision)
+    RDF_EXPRESS_ATTR_ACCESSOR(685, IfcGeometricRepresentationContext, 302, WorldCoordinateSystem)
+    inline IfcDirection IfcGeometricRepresentationContext::get_TrueNorth() { RDF_EXPRESS_PROBE(686); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(686), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcGeometricRepresentationContext::put_TrueNorth(IfcDirection inst) { RDF_EXPRESS_PROBE(686); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(686), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(686, IfcGeometricRepresentationContext, 302, TrueNorth)
+    RDF_EXPRESS_ATTR_ACCESSOR(687, IfcGeometricRepresentationContext, 302, HasSubContexts)
+    RDF_EXPRESS_ATTR_ACCESSOR(688, IfcGeometricRepresentationContext, 302, HasCoordinateOperation)
+}
+
+#endif //__RDF_LTD__IFC4_IfcGeometricRepresentationContext_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeometricRepresentationItem_H
+#define __RDF_LTD__IFC4_IfcGeometricRepresentationItem_H
+
+#include    "classes/IfcGeometricRepresentationItem.h"
+#include    "IfcRepresentationItem.h"
+
+#endif //__RDF_LTD__IFC4_IfcGeometricRepresentationItem_H
@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeometricRepresentationSubContext_H
+#define __RDF_LTD__IFC4_IfcGeometricRepresentationSubContext_H
+
+#include    "classes/IfcGeometricRepresentationSubContext.h"
+#include    "IfcGeometricRepresentationContext.h"
+#include    "classes/IfcGeometricRepresentationContext.h"
+
+namespace IFC4
+{
+    inline IfcGeometricRepresentationContext IfcGeometricRepresentationSubContext::get_ParentContext() { RDF_EXPRESS_PROBE(689); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(689), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcGeometricRepresentationSubContext::put_ParentContext(IfcGeometricRepresentationContext inst) { RDF_EXPRESS_PROBE(689); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(689), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(689, IfcGeometricRepresentationSubContext, 304, ParentContext)
+    RDF_EXPRESS_ATTR_ACCESSOR(690, IfcGeometricRepresentationSubContext, 304, TargetScale)
+    RDF_EXPRESS_ATTR_ACCESSOR(691, IfcGeometricRepresentationSubContext, 304, TargetView)
+    RDF_EXPRESS_ATTR_ACCESSOR(692, IfcGeometricRepresentationSubContext, 304, UserDefinedTargetView)
+}
+
+#endif //__RDF_LTD__IFC4_IfcGeometricRepresentationSubContext_H
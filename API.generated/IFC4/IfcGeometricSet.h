@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeometricSet_H
+#define __RDF_LTD__IFC4_IfcGeometricSet_H
+
+#include    "classes/IfcGeometricSet.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "selects/IfcGeometricSetSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(678, IfcGeometricSet, 305, Elements)
+    RDF_EXPRESS_ATTR_ACCESSOR(679, IfcGeometricSet, 305, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcGeometricSet_H
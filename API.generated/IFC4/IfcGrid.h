@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGrid_H
+#define __RDF_LTD__IFC4_IfcGrid_H
+
+#include    "classes/IfcGrid.h"
+#include    "IfcProduct.h"
+#include    "classes/IfcGridAxis.h"
+#include    "classes/IfcRelContainedInSpatialStructure.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(693, IfcGrid, 306, UAxes)
+    RDF_EXPRESS_ATTR_ACCESSOR(694, IfcGrid, 306, VAxes)
+    RDF_EXPRESS_ATTR_ACCESSOR(695, IfcGrid, 306, WAxes)
+    RDF_EXPRESS_ATTR_ACCESSOR(696, IfcGrid, 306, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(697, IfcGrid, 306, ContainedInStructure)
+}
+
+#endif //__RDF_LTD__IFC4_IfcGrid_H
@@ -0,0 +1,25 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGridAxis_H
+#define __RDF_LTD__IFC4_IfcGridAxis_H
+
+#include    "classes/IfcGridAxis.h"
+#include    "classes/IfcCurve.h"
+#include    "classes/IfcGrid.h"
+#include    "classes/IfcVirtualGridIntersection.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(698, IfcGridAxis, 307, AxisTag)
+    inline IfcCurve IfcGridAxis::get_AxisCurve() { RDF_EXPRESS_PROBE(699); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(699), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcGridAxis::put_AxisCurve(IfcCurve inst) { RDF_EXPRESS_PROBE(699); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(699), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(699, IfcGridAxis, 307, AxisCurve)
+    RDF_EXPRESS_ATTR_ACCESSOR(700, IfcGridAxis, 307, SameSense)
+    RDF_EXPRESS_ATTR_ACCESSOR(701, IfcGridAxis, 307, PartOfW)
+    RDF_EXPRESS_ATTR_ACCESSOR(702, IfcGridAxis, 307, PartOfV)
+    RDF_EXPRESS_ATTR_ACCESSOR(703, IfcGridAxis, 307, PartOfU)
+    RDF_EXPRESS_ATTR_ACCESSOR(704, IfcGridAxis, 307, HasIntersections)
+}
+
+#endif //__RDF_LTD__IFC4_IfcGridAxis_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGridPlacement_H
+#define __RDF_LTD__IFC4_IfcGridPlacement_H
+
+#include    "classes/IfcGridPlacement.h"
+#include    "IfcObjectPlacement.h"
+#include    "classes/IfcVirtualGridIntersection.h"
+#include    "selects/IfcGridPlacementDirectionSelect.h"
+
+namespace IFC4
+{
+    inline IfcVirtualGridIntersection IfcGridPlacement::get_PlacementLocation() { RDF_EXPRESS_PROBE(707); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(707), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcGridPlacement::put_PlacementLocation(IfcVirtualGridIntersection inst) { RDF_EXPRESS_PROBE(707); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(707), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(707, IfcGridPlacement, 308, PlacementLocation)
+    RDF_EXPRESS_ATTR_ACCESSOR(708, IfcGridPlacement, 308, PlacementRefDirection)
+}
+
+#endif //__RDF_LTD__IFC4_IfcGridPlacement_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGroup_H
+#define __RDF_LTD__IFC4_IfcGroup_H
+
+#include    "classes/IfcGroup.h"
+#include    "IfcObject.h"
+#include    "classes/IfcRelAssignsToGroup.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(120, IfcGroup, 309, IsGroupedBy)
+}
+
+#endif //__RDF_LTD__IFC4_IfcGroup_H
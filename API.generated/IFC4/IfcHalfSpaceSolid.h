@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcHalfSpaceSolid_H
+#define __RDF_LTD__IFC4_IfcHalfSpaceSolid_H
+
+#include    "classes/IfcHalfSpaceSolid.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "classes/IfcSurface.h"
+
+namespace IFC4
+{
+    inline IfcSurface IfcHalfSpaceSolid::get_BaseSurface() { RDF_EXPRESS_PROBE(205); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(205), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcHalfSpaceSolid::put_BaseSurface(IfcSurface inst) { RDF_EXPRESS_PROBE(205); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(205), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(205, IfcHalfSpaceSolid, 310, BaseSurface)
+    RDF_EXPRESS_ATTR_ACCESSOR(206, IfcHalfSpaceSolid, 310, AgreementFlag)
+    RDF_EXPRESS_ATTR_ACCESSOR(207, IfcHalfSpaceSolid, 310, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcHalfSpaceSolid_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcHeatExchanger_H
+#define __RDF_LTD__IFC4_IfcHeatExchanger_H
+
+#include    "classes/IfcHeatExchanger.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(709, IfcHeatExchanger, 311, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcHeatExchanger_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcHeatExchangerType_H
+#define __RDF_LTD__IFC4_IfcHeatExchangerType_H
+
+#include    "classes/IfcHeatExchangerType.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(710, IfcHeatExchangerType, 312, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcHeatExchangerType_H
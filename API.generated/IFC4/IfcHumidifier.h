@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcHumidifier_H
+#define __RDF_LTD__IFC4_IfcHumidifier_H
+
+#include    "classes/IfcHumidifier.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(711, IfcHumidifier, 313, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcHumidifier_H
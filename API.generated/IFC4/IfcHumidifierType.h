@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcHumidifierType_H
+#define __RDF_LTD__IFC4_IfcHumidifierType_H
+
+#include    "classes/IfcHumidifierType.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(712, IfcHumidifierType, 314, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcHumidifierType_H
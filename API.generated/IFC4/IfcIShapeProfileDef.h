@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIShapeProfileDef_H
+#define __RDF_LTD__IFC4_IfcIShapeProfileDef_H
+
+#include    "classes/IfcIShapeProfileDef.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(752, IfcIShapeProfileDef, 328, OverallWidth)
+    RDF_EXPRESS_ATTR_ACCESSOR(753, IfcIShapeProfileDef, 328, OverallDepth)
+    RDF_EXPRESS_ATTR_ACCESSOR(754, IfcIShapeProfileDef, 328, WebThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(755, IfcIShapeProfileDef, 328, FlangeThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(756, IfcIShapeProfileDef, 328, FilletRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(757, IfcIShapeProfileDef, 328, FlangeEdgeRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(758, IfcIShapeProfileDef, 328, FlangeSlope)
+}
+
+#endif //__RDF_LTD__IFC4_IfcIShapeProfileDef_H
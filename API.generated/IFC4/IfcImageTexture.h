@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcImageTexture_H
+#define __RDF_LTD__IFC4_IfcImageTexture_H
+
+#include    "classes/IfcImageTexture.h"
+#include    "IfcSurfaceTexture.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(713, IfcImageTexture, 315, URLReference)
+}
+
+#endif //__RDF_LTD__IFC4_IfcImageTexture_H
@@ -0,0 +1,24 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIndexedColourMap_H
+#define __RDF_LTD__IFC4_IfcIndexedColourMap_H
+
+#include    "classes/IfcIndexedColourMap.h"
+#include    "IfcPresentationItem.h"
+#include    "classes/IfcColourRgbList.h"
+#include    "classes/IfcTessellatedFaceSet.h"
+
+namespace IFC4
+{
+    inline IfcTessellatedFaceSet IfcIndexedColourMap::get_MappedTo() { RDF_EXPRESS_PROBE(714); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(714), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcIndexedColourMap::put_MappedTo(IfcTessellatedFaceSet inst) { RDF_EXPRESS_PROBE(714); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(714), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(714, IfcIndexedColourMap, 316, MappedTo)
+    RDF_EXPRESS_ATTR_ACCESSOR(715, IfcIndexedColourMap, 316, Opacity)
+    inline IfcColourRgbList IfcIndexedColourMap::get_Colours() { RDF_EXPRESS_PROBE(716); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(716), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcIndexedColourMap::put_Colours(IfcColourRgbList inst) { RDF_EXPRESS_PROBE(716); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(716), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(716, IfcIndexedColourMap, 316, Colours)
+    RDF_EXPRESS_ATTR_ACCESSOR(717, IfcIndexedColourMap, 316, ColourIndex)
+}
+
+#endif //__RDF_LTD__IFC4_IfcIndexedColourMap_H
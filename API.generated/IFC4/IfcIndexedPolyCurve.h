@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIndexedPolyCurve_H
+#define __RDF_LTD__IFC4_IfcIndexedPolyCurve_H
+
+#include    "classes/IfcIndexedPolyCurve.h"
+#include    "IfcBoundedCurve.h"
+#include    "classes/IfcCartesianPointList.h"
+#include    "selects/IfcSegmentIndexSelect.h"
+
+namespace IFC4
+{
+    inline IfcCartesianPointList IfcIndexedPolyCurve::get_Points() { RDF_EXPRESS_PROBE(718); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(718), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcIndexedPolyCurve::put_Points(IfcCartesianPointList inst) { RDF_EXPRESS_PROBE(718); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(718), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(718, IfcIndexedPolyCurve, 317, Points)
+    RDF_EXPRESS_ATTR_ACCESSOR(719, IfcIndexedPolyCurve, 317, Segments)
+    RDF_EXPRESS_ATTR_ACCESSOR(720, IfcIndexedPolyCurve, 317, SelfIntersect)
+}
+
+#endif //__RDF_LTD__IFC4_IfcIndexedPolyCurve_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIndexedPolygonalFace_H
+#define __RDF_LTD__IFC4_IfcIndexedPolygonalFace_H
+
+#include    "classes/IfcIndexedPolygonalFace.h"
+#include    "IfcTessellatedItem.h"
+#include    "classes/IfcPolygonalFaceSet.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(721, IfcIndexedPolygonalFace, 318, CoordIndex)
+    RDF_EXPRESS_ATTR_ACCESSOR(722, IfcIndexedPolygonalFace, 318, ToFaceSet)
+}
+
+#endif //__RDF_LTD__IFC4_IfcIndexedPolygonalFace_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIndexedPolygonalFaceWithVoids_H
+#define __RDF_LTD__IFC4_IfcIndexedPolygonalFaceWithVoids_H
+
+#include    "classes/IfcIndexedPolygonalFaceWithVoids.h"
+#include    "IfcIndexedPolygonalFace.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(723, IfcIndexedPolygonalFaceWithVoids, 319, InnerCoordIndices)
+}
+
+#endif //__RDF_LTD__IFC4_IfcIndexedPolygonalFaceWithVoids_H
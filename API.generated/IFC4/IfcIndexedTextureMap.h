@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIndexedTextureMap_H
+#define __RDF_LTD__IFC4_IfcIndexedTextureMap_H
+
+#include    "classes/IfcIndexedTextureMap.h"
+#include    "IfcTextureCoordinate.h"
+#include    "classes/IfcTessellatedFaceSet.h"
+#include    "classes/IfcTextureVertexList.h"
+
+namespace IFC4
+{
+    inline IfcTessellatedFaceSet IfcIndexedTextureMap::get_MappedTo() { RDF_EXPRESS_PROBE(725); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(725), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcIndexedTextureMap::put_MappedTo(IfcTessellatedFaceSet inst) { RDF_EXPRESS_PROBE(725); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(725), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(725, IfcIndexedTextureMap, 320, MappedTo)
+    inline IfcTextureVertexList IfcIndexedTextureMap::get_TexCoords() { RDF_EXPRESS_PROBE(726); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(726), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcIndexedTextureMap::put_TexCoords(IfcTextureVertexList inst) { RDF_EXPRESS_PROBE(726); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(726), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(726, IfcIndexedTextureMap, 320, TexCoords)
+}
+
+#endif //__RDF_LTD__IFC4_IfcIndexedTextureMap_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIndexedTriangleTextureMap_H
+#define __RDF_LTD__IFC4_IfcIndexedTriangleTextureMap_H
+
+#include    "classes/IfcIndexedTriangleTextureMap.h"
+#include    "IfcIndexedTextureMap.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(727, IfcIndexedTriangleTextureMap, 321, TexCoordIndex)
+}
+
+#endif //__RDF_LTD__IFC4_IfcIndexedTriangleTextureMap_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcInterceptor_H
+#define __RDF_LTD__IFC4_IfcInterceptor_H
+
+#include    "classes/IfcInterceptor.h"
+#include    "IfcFlowTreatmentDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(728, IfcInterceptor, 322, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcInterceptor_H
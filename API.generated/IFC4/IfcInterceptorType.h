@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcInterceptorType_H
+#define __RDF_LTD__IFC4_IfcInterceptorType_H
+
+#include    "classes/IfcInterceptorType.h"
+#include    "IfcFlowTreatmentDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(729, IfcInterceptorType, 323, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcInterceptorType_H
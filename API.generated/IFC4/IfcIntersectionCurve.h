@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIntersectionCurve_H
+#define __RDF_LTD__IFC4_IfcIntersectionCurve_H
+
+#include    "classes/IfcIntersectionCurve.h"
+#include    "IfcSurfaceCurve.h"
+
+#endif //__RDF_LTD__IFC4_IfcIntersectionCurve_H
@@ -0,0 +1,27 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcInventory_H
+#define __RDF_LTD__IFC4_IfcInventory_H
+
+#include    "classes/IfcInventory.h"
+#include    "IfcGroup.h"
+#include    "classes/IfcCostValue.h"
+#include    "classes/IfcPerson.h"
+#include    "selects/IfcActorSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(734, IfcInventory, 325, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(735, IfcInventory, 325, Jurisdiction)
+    RDF_EXPRESS_ATTR_ACCESSOR(736, IfcInventory, 325, ResponsiblePersons)
+    RDF_EXPRESS_ATTR_ACCESSOR(737, IfcInventory, 325, LastUpdateDate)
+    inline IfcCostValue IfcInventory::get_CurrentValue() { RDF_EXPRESS_PROBE(738); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(738), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcInventory::put_CurrentValue(IfcCostValue inst) { RDF_EXPRESS_PROBE(738); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(738), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(738, IfcInventory, 325, CurrentValue)
+    inline IfcCostValue IfcInventory::get_OriginalValue() { RDF_EXPRESS_PROBE(739); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(739), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcInventory::put_OriginalValue(IfcCostValue inst) { RDF_EXPRESS_PROBE(739); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(739), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(739, IfcInventory, 325, OriginalValue)
+}
+
+#endif //__RDF_LTD__IFC4_IfcInventory_H
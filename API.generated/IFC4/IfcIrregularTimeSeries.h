@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIrregularTimeSeries_H
+#define __RDF_LTD__IFC4_IfcIrregularTimeSeries_H
+
+#include    "classes/IfcIrregularTimeSeries.h"
+#include    "IfcTimeSeries.h"
+#include    "classes/IfcIrregularTimeSeriesValue.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(749, IfcIrregularTimeSeries, 326, Values)
+}
+
+#endif //__RDF_LTD__IFC4_IfcIrregularTimeSeries_H
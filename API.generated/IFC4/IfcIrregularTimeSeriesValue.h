@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIrregularTimeSeriesValue_H
+#define __RDF_LTD__IFC4_IfcIrregularTimeSeriesValue_H
+
+#include    "classes/IfcIrregularTimeSeriesValue.h"
+#include    "selects/IfcValue.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(750, IfcIrregularTimeSeriesValue, 327, TimeStamp)
+    RDF_EXPRESS_ATTR_ACCESSOR(751, IfcIrregularTimeSeriesValue, 327, ListValues)
+}
+
+#endif //__RDF_LTD__IFC4_IfcIrregularTimeSeriesValue_H
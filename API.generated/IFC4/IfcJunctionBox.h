@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcJunctionBox_H
+#define __RDF_LTD__IFC4_IfcJunctionBox_H
+
+#include    "classes/IfcJunctionBox.h"
+#include    "IfcFlowFitting.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(759, IfcJunctionBox, 329, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcJunctionBox_H
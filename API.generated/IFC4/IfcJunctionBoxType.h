@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcJunctionBoxType_H
+#define __RDF_LTD__IFC4_IfcJunctionBoxType_H
+
+#include    "classes/IfcJunctionBoxType.h"
+#include    "IfcFlowFittingType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(760, IfcJunctionBoxType, 330, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcJunctionBoxType_H
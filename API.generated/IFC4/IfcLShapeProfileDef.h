@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLShapeProfileDef_H
+#define __RDF_LTD__IFC4_IfcLShapeProfileDef_H
+
+#include    "classes/IfcLShapeProfileDef.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(810, IfcLShapeProfileDef, 351, Depth)
+    RDF_EXPRESS_ATTR_ACCESSOR(811, IfcLShapeProfileDef, 351, Width)
+    RDF_EXPRESS_ATTR_ACCESSOR(812, IfcLShapeProfileDef, 351, Thickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(813, IfcLShapeProfileDef, 351, FilletRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(814, IfcLShapeProfileDef, 351, EdgeRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(815, IfcLShapeProfileDef, 351, LegSlope)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLShapeProfileDef_H
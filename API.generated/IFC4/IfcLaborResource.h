@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLaborResource_H
+#define __RDF_LTD__IFC4_IfcLaborResource_H
+
+#include    "classes/IfcLaborResource.h"
+#include    "IfcConstructionResource.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(761, IfcLaborResource, 331, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLaborResource_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLaborResourceType_H
+#define __RDF_LTD__IFC4_IfcLaborResourceType_H
+
+#include    "classes/IfcLaborResourceType.h"
+#include    "IfcConstructionResourceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(762, IfcLaborResourceType, 332, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLaborResourceType_H
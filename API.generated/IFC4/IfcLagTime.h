@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLagTime_H
+#define __RDF_LTD__IFC4_IfcLagTime_H
+
+#include    "classes/IfcLagTime.h"
+#include    "IfcSchedulingTime.h"
+#include    "selects/IfcTimeOrRatioSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(763, IfcLagTime, 333, LagValue)
+    RDF_EXPRESS_ATTR_ACCESSOR(764, IfcLagTime, 333, DurationType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLagTime_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLamp_H
+#define __RDF_LTD__IFC4_IfcLamp_H
+
+#include    "classes/IfcLamp.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(765, IfcLamp, 334, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLamp_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLampType_H
+#define __RDF_LTD__IFC4_IfcLampType_H
+
+#include    "classes/IfcLampType.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(766, IfcLampType, 335, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLampType_H
@@ -0,0 +1,25 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLibraryInformation_H
+#define __RDF_LTD__IFC4_IfcLibraryInformation_H
+
+#include    "classes/IfcLibraryInformation.h"
+#include    "IfcExternalInformation.h"
+#include    "classes/IfcLibraryReference.h"
+#include    "classes/IfcRelAssociatesLibrary.h"
+#include    "selects/IfcActorSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(767, IfcLibraryInformation, 336, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(768, IfcLibraryInformation, 336, Version)
+    RDF_EXPRESS_ATTR_ACCESSOR(769, IfcLibraryInformation, 336, Publisher)
+    RDF_EXPRESS_ATTR_ACCESSOR(770, IfcLibraryInformation, 336, VersionDate)
+    RDF_EXPRESS_ATTR_ACCESSOR(771, IfcLibraryInformation, 336, Location)
+    RDF_EXPRESS_ATTR_ACCESSOR(772, IfcLibraryInformation, 336, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(773, IfcLibraryInformation, 336, LibraryInfoForObjects)
+    RDF_EXPRESS_ATTR_ACCESSOR(774, IfcLibraryInformation, 336, HasLibraryReferences)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLibraryInformation_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLibraryReference_H
+#define __RDF_LTD__IFC4_IfcLibraryReference_H
+
+#include    "classes/IfcLibraryReference.h"
+#include    "IfcExternalReference.h"
+#include    "classes/IfcLibraryInformation.h"
+#include    "classes/IfcRelAssociatesLibrary.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(775, IfcLibraryReference, 337, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(776, IfcLibraryReference, 337, Language)
+    inline IfcLibraryInformation IfcLibraryReference::get_ReferencedLibrary() { RDF_EXPRESS_PROBE(777); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(777), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcLibraryReference::put_ReferencedLibrary(IfcLibraryInformation inst) { RDF_EXPRESS_PROBE(777); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(777), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(777, IfcLibraryReference, 337, ReferencedLibrary)
+    RDF_EXPRESS_ATTR_ACCESSOR(778, IfcLibraryReference, 337, LibraryRefForObjects)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLibraryReference_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightDistributionData_H
+#define __RDF_LTD__IFC4_IfcLightDistributionData_H
+
+#include    "classes/IfcLightDistributionData.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(779, IfcLightDistributionData, 338, MainPlaneAngle)
+    RDF_EXPRESS_ATTR_ACCESSOR(780, IfcLightDistributionData, 338, SecondaryPlaneAngle)
+    RDF_EXPRESS_ATTR_ACCESSOR(781, IfcLightDistributionData, 338, LuminousIntensity)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightDistributionData_H
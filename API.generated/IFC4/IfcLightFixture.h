@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightFixture_H
+#define __RDF_LTD__IFC4_IfcLightFixture_H
+
+#include    "classes/IfcLightFixture.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(782, IfcLightFixture, 339, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightFixture_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightFixtureType_H
+#define __RDF_LTD__IFC4_IfcLightFixtureType_H
+
+#include    "classes/IfcLightFixtureType.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(783, IfcLightFixtureType, 340, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightFixtureType_H
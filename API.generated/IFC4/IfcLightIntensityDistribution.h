@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightIntensityDistribution_H
+#define __RDF_LTD__IFC4_IfcLightIntensityDistribution_H
+
+#include    "classes/IfcLightIntensityDistribution.h"
+#include    "classes/IfcLightDistributionData.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(784, IfcLightIntensityDistribution, 341, LightDistributionCurve)
+    RDF_EXPRESS_ATTR_ACCESSOR(785, IfcLightIntensityDistribution, 341, DistributionData)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightIntensityDistribution_H
@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightSource_H
+#define __RDF_LTD__IFC4_IfcLightSource_H
+
+#include    "classes/IfcLightSource.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "classes/IfcColourRgb.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(786, IfcLightSource, 342, Name)
+    inline IfcColourRgb IfcLightSource::get_LightColour() { RDF_EXPRESS_PROBE(787); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(787), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcLightSource::put_LightColour(IfcColourRgb inst) { RDF_EXPRESS_PROBE(787); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(787), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(787, IfcLightSource, 342, LightColour)
+    RDF_EXPRESS_ATTR_ACCESSOR(788, IfcLightSource, 342, AmbientIntensity)
+    RDF_EXPRESS_ATTR_ACCESSOR(789, IfcLightSource, 342, Intensity)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightSource_H
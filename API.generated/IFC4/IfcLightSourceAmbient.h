@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightSourceAmbient_H
+#define __RDF_LTD__IFC4_IfcLightSourceAmbient_H
+
+#include    "classes/IfcLightSourceAmbient.h"
+#include    "IfcLightSource.h"
+
+#endif //__RDF_LTD__IFC4_IfcLightSourceAmbient_H
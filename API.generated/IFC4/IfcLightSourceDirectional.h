@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightSourceDirectional_H
+#define __RDF_LTD__IFC4_IfcLightSourceDirectional_H
+
+#include    "classes/IfcLightSourceDirectional.h"
+#include    "IfcLightSource.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    inline IfcDirection IfcLightSourceDirectional::get_Orientation() { RDF_EXPRESS_PROBE(790); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(790), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcLightSourceDirectional::put_Orientation(IfcDirection inst) { RDF_EXPRESS_PROBE(790); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(790), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(790, IfcLightSourceDirectional, 344, Orientation)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightSourceDirectional_H
@@ -0,0 +1,27 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightSourceGoniometric_H
+#define __RDF_LTD__IFC4_IfcLightSourceGoniometric_H
+
+#include    "classes/IfcLightSourceGoniometric.h"
+#include    "IfcLightSource.h"
+#include    "classes/IfcAxis2Placement3D.h"
+#include    "classes/IfcColourRgb.h"
+#include    "selects/IfcLightDistributionDataSourceSelect.h"
+
+namespace IFC4
+{
+    inline IfcAxis2Placement3D IfcLightSourceGoniometric::get_Position() { RDF_EXPRESS_PROBE(791); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(791), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcLightSourceGoniometric::put_Position(IfcAxis2Placement3D inst) { RDF_EXPRESS_PROBE(791); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(791), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(791, IfcLightSourceGoniometric, 345, Position)
+    inline IfcColourRgb IfcLightSourceGoniometric::get_ColourAppearance() { RDF_EXPRESS_PROBE(792); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(792), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcLightSourceGoniometric::put_ColourAppearance(IfcColourRgb inst) { RDF_EXPRESS_PROBE(792); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(792), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(792, IfcLightSourceGoniometric, 345, ColourAppearance)
+    RDF_EXPRESS_ATTR_ACCESSOR(793, IfcLightSourceGoniometric, 345, ColourTemperature)
+    RDF_EXPRESS_ATTR_ACCESSOR(794, IfcLightSourceGoniometric, 345, LuminousFlux)
+    RDF_EXPRESS_ATTR_ACCESSOR(795, IfcLightSourceGoniometric, 345, LightEmissionSource)
+    RDF_EXPRESS_ATTR_ACCESSOR(796, IfcLightSourceGoniometric, 345, LightDistributionDataSource)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightSourceGoniometric_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightSourcePositional_H
+#define __RDF_LTD__IFC4_IfcLightSourcePositional_H
+
+#include    "classes/IfcLightSourcePositional.h"
+#include    "IfcLightSource.h"
+#include    "classes/IfcCartesianPoint.h"
+
+namespace IFC4
+{
+    inline IfcCartesianPoint IfcLightSourcePositional::get_Position() { RDF_EXPRESS_PROBE(797); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(797), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcLightSourcePositional::put_Position(IfcCartesianPoint inst) { RDF_EXPRESS_PROBE(797); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(797), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(797, IfcLightSourcePositional, 346, Position)
+    RDF_EXPRESS_ATTR_ACCESSOR(798, IfcLightSourcePositional, 346, Radius)
+    RDF_EXPRESS_ATTR_ACCESSOR(799, IfcLightSourcePositional, 346, ConstantAttenuation)
+    RDF_EXPRESS_ATTR_ACCESSOR(800, IfcLightSourcePositional, 346, DistanceAttenuation)
+    RDF_EXPRESS_ATTR_ACCESSOR(801, IfcLightSourcePositional, 346, QuadricAttenuation)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightSourcePositional_H
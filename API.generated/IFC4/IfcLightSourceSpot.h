@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightSourceSpot_H
+#define __RDF_LTD__IFC4_IfcLightSourceSpot_H
+
+#include    "classes/IfcLightSourceSpot.h"
+#include    "IfcLightSourcePositional.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    inline IfcDirection IfcLightSourceSpot::get_Orientation() { RDF_EXPRESS_PROBE(802); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(802), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcLightSourceSpot::put_Orientation(IfcDirection inst) { RDF_EXPRESS_PROBE(802); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(802), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(802, IfcLightSourceSpot, 347, Orientation)
+    RDF_EXPRESS_ATTR_ACCESSOR(803, IfcLightSourceSpot, 347, ConcentrationExponent)
+    RDF_EXPRESS_ATTR_ACCESSOR(804, IfcLightSourceSpot, 347, SpreadAngle)
+    RDF_EXPRESS_ATTR_ACCESSOR(805, IfcLightSourceSpot, 347, BeamWidthAngle)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightSourceSpot_H
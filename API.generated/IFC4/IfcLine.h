@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLine_H
+#define __RDF_LTD__IFC4_IfcLine_H
+
+#include    "classes/IfcLine.h"
+#include    "IfcCurve.h"
+#include    "classes/IfcCartesianPoint.h"
+#include    "classes/IfcVector.h"
+
+namespace IFC4
+{
+    inline IfcCartesianPoint IfcLine::get_Pnt() { RDF_EXPRESS_PROBE(806); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(806), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcLine::put_Pnt(IfcCartesianPoint inst) { RDF_EXPRESS_PROBE(806); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(806), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(806, IfcLine, 348, Pnt)
+    inline IfcVector IfcLine::get_Dir() { RDF_EXPRESS_PROBE(807); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(807), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcLine::put_Dir(IfcVector inst) { RDF_EXPRESS_PROBE(807); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(807), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(807, IfcLine, 348, Dir)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLine_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLocalPlacement_H
+#define __RDF_LTD__IFC4_IfcLocalPlacement_H
+
+#include    "classes/IfcLocalPlacement.h"
+#include    "IfcObjectPlacement.h"
+#include    "classes/IfcObjectPlacement.h"
+#include    "selects/IfcAxis2Placement.h"
+
+namespace IFC4
+{
+    inline IfcObjectPlacement IfcLocalPlacement::get_PlacementRelTo() { RDF_EXPRESS_PROBE(808); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(808), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcLocalPlacement::put_PlacementRelTo(IfcObjectPlacement inst) { RDF_EXPRESS_PROBE(808); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(808), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(808, IfcLocalPlacement, 349, PlacementRelTo)
+    RDF_EXPRESS_ATTR_ACCESSOR(809, IfcLocalPlacement, 349, RelativePlacement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcLocalPlacement_H
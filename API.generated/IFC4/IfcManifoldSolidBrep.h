@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcManifoldSolidBrep_H
+#define __RDF_LTD__IFC4_IfcManifoldSolidBrep_H
+
+#include    "classes/IfcManifoldSolidBrep.h"
+#include    "IfcSolidModel.h"
+#include    "classes/IfcClosedShell.h"
+
+namespace IFC4
+{
+    inline IfcClosedShell IfcManifoldSolidBrep::get_Outer() { RDF_EXPRESS_PROBE(62); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(62), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcManifoldSolidBrep::put_Outer(IfcClosedShell inst) { RDF_EXPRESS_PROBE(62); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(62), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(62, IfcManifoldSolidBrep, 352, Outer)
+}
+
+#endif //__RDF_LTD__IFC4_IfcManifoldSolidBrep_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMapConversion_H
+#define __RDF_LTD__IFC4_IfcMapConversion_H
+
+#include    "classes/IfcMapConversion.h"
+#include    "IfcCoordinateOperation.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(816, IfcMapConversion, 353, Eastings)
+    RDF_EXPRESS_ATTR_ACCESSOR(817, IfcMapConversion, 353, Northings)
+    RDF_EXPRESS_ATTR_ACCESSOR(818, IfcMapConversion, 353, OrthogonalHeight)
+    RDF_EXPRESS_ATTR_ACCESSOR(819, IfcMapConversion, 353, XAxisAbscissa)
+    RDF_EXPRESS_ATTR_ACCESSOR(820, IfcMapConversion, 353, XAxisOrdinate)
+    RDF_EXPRESS_ATTR_ACCESSOR(821, IfcMapConversion, 353, Scale)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMapConversion_H
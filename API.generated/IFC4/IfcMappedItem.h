@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMappedItem_H
+#define __RDF_LTD__IFC4_IfcMappedItem_H
+
+#include    "classes/IfcMappedItem.h"
+#include    "IfcRepresentationItem.h"
+#include    "classes/IfcCartesianTransformationOperator.h"
+#include    "classes/IfcRepresentationMap.h"
+
+namespace IFC4
+{
+    inline IfcRepresentationMap IfcMappedItem::get_MappingSource() { RDF_EXPRESS_PROBE(822); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(822), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMappedItem::put_MappingSource(IfcRepresentationMap inst) { RDF_EXPRESS_PROBE(822); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(822), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(822, IfcMappedItem, 354, MappingSource)
+    inline IfcCartesianTransformationOperator IfcMappedItem::get_MappingTarget() { RDF_EXPRESS_PROBE(823); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(823), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMappedItem::put_MappingTarget(IfcCartesianTransformationOperator inst) { RDF_EXPRESS_PROBE(823); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(823), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(823, IfcMappedItem, 354, MappingTarget)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMappedItem_H
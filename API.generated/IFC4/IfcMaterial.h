@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterial_H
+#define __RDF_LTD__IFC4_IfcMaterial_H
+
+#include    "classes/IfcMaterial.h"
+#include    "IfcMaterialDefinition.h"
+#include    "classes/IfcMaterialDefinitionRepresentation.h"
+#include    "classes/IfcMaterialRelationship.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(827, IfcMaterial, 355, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(828, IfcMaterial, 355, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(829, IfcMaterial, 355, Category)
+    RDF_EXPRESS_ATTR_ACCESSOR(830, IfcMaterial, 355, HasRepresentation)
+    RDF_EXPRESS_ATTR_ACCESSOR(831, IfcMaterial, 355, IsRelatedWith)
+    RDF_EXPRESS_ATTR_ACCESSOR(832, IfcMaterial, 355, RelatesTo)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterial_H
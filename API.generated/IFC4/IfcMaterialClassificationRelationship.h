@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialClassificationRelationship_H
+#define __RDF_LTD__IFC4_IfcMaterialClassificationRelationship_H
+
+#include    "classes/IfcMaterialClassificationRelationship.h"
+#include    "classes/IfcMaterial.h"
+#include    "selects/IfcClassificationSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(833, IfcMaterialClassificationRelationship, 356, MaterialClassifications)
+    inline IfcMaterial IfcMaterialClassificationRelationship::get_ClassifiedMaterial() { RDF_EXPRESS_PROBE(834); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(834), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMaterialClassificationRelationship::put_ClassifiedMaterial(IfcMaterial inst) { RDF_EXPRESS_PROBE(834); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(834), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(834, IfcMaterialClassificationRelationship, 356, ClassifiedMaterial)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialClassificationRelationship_H
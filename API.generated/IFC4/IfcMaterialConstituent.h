@@ -0,0 +1,25 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialConstituent_H
+#define __RDF_LTD__IFC4_IfcMaterialConstituent_H
+
+#include    "classes/IfcMaterialConstituent.h"
+#include    "IfcMaterialDefinition.h"
+#include    "classes/IfcMaterial.h"
+#include    "classes/IfcMaterialConstituentSet.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(835, IfcMaterialConstituent, 357, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(836, IfcMaterialConstituent, 357, Description)
+    inline IfcMaterial IfcMaterialConstituent::get_Material() { RDF_EXPRESS_PROBE(837); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(837), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMaterialConstituent::put_Material(IfcMaterial inst) { RDF_EXPRESS_PROBE(837); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(837), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(837, IfcMaterialConstituent, 357, Material)
+    RDF_EXPRESS_ATTR_ACCESSOR(838, IfcMaterialConstituent, 357, Fraction)
+    RDF_EXPRESS_ATTR_ACCESSOR(839, IfcMaterialConstituent, 357, Category)
+    inline IfcMaterialConstituentSet IfcMaterialConstituent::get_ToMaterialConstituentSet() { RDF_EXPRESS_PROBE(840); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(840), sdaiINSTANCE, &inst); return inst; }
+    RDF_EXPRESS_ATTR_ACCESSOR(840, IfcMaterialConstituent, 357, ToMaterialConstituentSet)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialConstituent_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialConstituentSet_H
+#define __RDF_LTD__IFC4_IfcMaterialConstituentSet_H
+
+#include    "classes/IfcMaterialConstituentSet.h"
+#include    "IfcMaterialDefinition.h"
+#include    "classes/IfcMaterialConstituent.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(841, IfcMaterialConstituentSet, 358, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(842, IfcMaterialConstituentSet, 358, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(843, IfcMaterialConstituentSet, 358, MaterialConstituents)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialConstituentSet_H
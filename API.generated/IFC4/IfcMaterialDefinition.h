@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialDefinition_H
+#define __RDF_LTD__IFC4_IfcMaterialDefinition_H
+
+#include    "classes/IfcMaterialDefinition.h"
+#include    "classes/IfcExternalReferenceRelationship.h"
+#include    "classes/IfcMaterialProperties.h"
+#include    "classes/IfcRelAssociatesMaterial.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(824, IfcMaterialDefinition, 359, AssociatedTo)
+    RDF_EXPRESS_ATTR_ACCESSOR(825, IfcMaterialDefinition, 359, HasExternalReferences)
+    RDF_EXPRESS_ATTR_ACCESSOR(826, IfcMaterialDefinition, 359, HasProperties)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialDefinition_H
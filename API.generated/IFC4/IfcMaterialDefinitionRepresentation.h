@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialDefinitionRepresentation_H
+#define __RDF_LTD__IFC4_IfcMaterialDefinitionRepresentation_H
+
+#include    "classes/IfcMaterialDefinitionRepresentation.h"
+#include    "IfcProductRepresentation.h"
+#include    "classes/IfcMaterial.h"
+
+namespace IFC4
+{
+    inline IfcMaterial IfcMaterialDefinitionRepresentation::get_RepresentedMaterial() { RDF_EXPRESS_PROBE(847); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(847), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMaterialDefinitionRepresentation::put_RepresentedMaterial(IfcMaterial inst) { RDF_EXPRESS_PROBE(847); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(847), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(847, IfcMaterialDefinitionRepresentation, 360, RepresentedMaterial)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialDefinitionRepresentation_H
@@ -0,0 +1,27 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialLayer_H
+#define __RDF_LTD__IFC4_IfcMaterialLayer_H
+
+#include    "classes/IfcMaterialLayer.h"
+#include    "IfcMaterialDefinition.h"
+#include    "classes/IfcMaterial.h"
+#include    "classes/IfcMaterialLayerSet.h"
+
+namespace IFC4
+{
+    inline IfcMaterial IfcMaterialLayer::get_Material() { RDF_EXPRESS_PROBE(848); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(848), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMaterialLayer::put_Material(IfcMaterial inst) { RDF_EXPRESS_PROBE(848); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(848), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(848, IfcMaterialLayer, 361, Material)
+    RDF_EXPRESS_ATTR_ACCESSOR(849, IfcMaterialLayer, 361, LayerThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(850, IfcMaterialLayer, 361, IsVentilated)
+    RDF_EXPRESS_ATTR_ACCESSOR(851, IfcMaterialLayer, 361, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(852, IfcMaterialLayer, 361, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(853, IfcMaterialLayer, 361, Category)
+    RDF_EXPRESS_ATTR_ACCESSOR(854, IfcMaterialLayer, 361, Priority)
+    inline IfcMaterialLayerSet IfcMaterialLayer::get_ToMaterialLayerSet() { RDF_EXPRESS_PROBE(855); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(855), sdaiINSTANCE, &inst); return inst; }
+    RDF_EXPRESS_ATTR_ACCESSOR(855, IfcMaterialLayer, 361, ToMaterialLayerSet)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialLayer_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialLayerSet_H
+#define __RDF_LTD__IFC4_IfcMaterialLayerSet_H
+
+#include    "classes/IfcMaterialLayerSet.h"
+#include    "IfcMaterialDefinition.h"
+#include    "classes/IfcMaterialLayer.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(856, IfcMaterialLayerSet, 362, MaterialLayers)
+    RDF_EXPRESS_ATTR_ACCESSOR(857, IfcMaterialLayerSet, 362, LayerSetName)
+    RDF_EXPRESS_ATTR_ACCESSOR(858, IfcMaterialLayerSet, 362, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(859, IfcMaterialLayerSet, 362, TotalThickness)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialLayerSet_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialLayerSetUsage_H
+#define __RDF_LTD__IFC4_IfcMaterialLayerSetUsage_H
+
+#include    "classes/IfcMaterialLayerSetUsage.h"
+#include    "IfcMaterialUsageDefinition.h"
+#include    "classes/IfcMaterialLayerSet.h"
+
+namespace IFC4
+{
+    inline IfcMaterialLayerSet IfcMaterialLayerSetUsage::get_ForLayerSet() { RDF_EXPRESS_PROBE(861); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(861), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMaterialLayerSetUsage::put_ForLayerSet(IfcMaterialLayerSet inst) { RDF_EXPRESS_PROBE(861); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(861), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(861, IfcMaterialLayerSetUsage, 363, ForLayerSet)
+    RDF_EXPRESS_ATTR_ACCESSOR(862, IfcMaterialLayerSetUsage, 363, LayerSetDirection)
+    RDF_EXPRESS_ATTR_ACCESSOR(863, IfcMaterialLayerSetUsage, 363, DirectionSense)
+    RDF_EXPRESS_ATTR_ACCESSOR(864, IfcMaterialLayerSetUsage, 363, OffsetFromReferenceLine)
+    RDF_EXPRESS_ATTR_ACCESSOR(865, IfcMaterialLayerSetUsage, 363, ReferenceExtent)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialLayerSetUsage_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialLayerWithOffsets_H
+#define __RDF_LTD__IFC4_IfcMaterialLayerWithOffsets_H
+
+#include    "classes/IfcMaterialLayerWithOffsets.h"
+#include    "IfcMaterialLayer.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(866, IfcMaterialLayerWithOffsets, 364, OffsetDirection)
+    RDF_EXPRESS_ATTR_ACCESSOR(867, IfcMaterialLayerWithOffsets, 364, OffsetValues)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialLayerWithOffsets_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialList_H
+#define __RDF_LTD__IFC4_IfcMaterialList_H
+
+#include    "classes/IfcMaterialList.h"
+#include    "classes/IfcMaterial.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(868, IfcMaterialList, 365, Materials)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialList_H
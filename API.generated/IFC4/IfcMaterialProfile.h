@@ -0,0 +1,29 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialProfile_H
+#define __RDF_LTD__IFC4_IfcMaterialProfile_H
+
+#include    "classes/IfcMaterialProfile.h"
+#include    "IfcMaterialDefinition.h"
+#include    "classes/IfcMaterial.h"
+#include    "classes/IfcMaterialProfileSet.h"
+#include    "classes/IfcProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(869, IfcMaterialProfile, 366, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(870, IfcMaterialProfile, 366, Description)
+    inline IfcMaterial IfcMaterialProfile::get_Material() { RDF_EXPRESS_PROBE(871); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(871), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMaterialProfile::put_Material(IfcMaterial inst) { RDF_EXPRESS_PROBE(871); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(871), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(871, IfcMaterialProfile, 366, Material)
+    inline IfcProfileDef IfcMaterialProfile::get_Profile() { RDF_EXPRESS_PROBE(872); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(872), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMaterialProfile::put_Profile(IfcProfileDef inst) { RDF_EXPRESS_PROBE(872); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(872), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(872, IfcMaterialProfile, 366, Profile)
+    RDF_EXPRESS_ATTR_ACCESSOR(873, IfcMaterialProfile, 366, Priority)
+    RDF_EXPRESS_ATTR_ACCESSOR(874, IfcMaterialProfile, 366, Category)
+    inline IfcMaterialProfileSet IfcMaterialProfile::get_ToMaterialProfileSet() { RDF_EXPRESS_PROBE(875); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(875), sdaiINSTANCE, &inst); return inst; }
+    RDF_EXPRESS_ATTR_ACCESSOR(875, IfcMaterialProfile, 366, ToMaterialProfileSet)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialProfile_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialProfileSet_H
+#define __RDF_LTD__IFC4_IfcMaterialProfileSet_H
+
+#include    "classes/IfcMaterialProfileSet.h"
+#include    "IfcMaterialDefinition.h"
+#include    "classes/IfcCompositeProfileDef.h"
+#include    "classes/IfcMaterialProfile.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(876, IfcMaterialProfileSet, 367, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(877, IfcMaterialProfileSet, 367, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(878, IfcMaterialProfileSet, 367, MaterialProfiles)
+    inline IfcCompositeProfileDef IfcMaterialProfileSet::get_CompositeProfile() { RDF_EXPRESS_PROBE(879); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(879), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMaterialProfileSet::put_CompositeProfile(IfcCompositeProfileDef inst) { RDF_EXPRESS_PROBE(879); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(879), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(879, IfcMaterialProfileSet, 367, CompositeProfile)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialProfileSet_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialProfileSetUsage_H
+#define __RDF_LTD__IFC4_IfcMaterialProfileSetUsage_H
+
+#include    "classes/IfcMaterialProfileSetUsage.h"
+#include    "IfcMaterialUsageDefinition.h"
+#include    "classes/IfcMaterialProfileSet.h"
+
+namespace IFC4
+{
+    inline IfcMaterialProfileSet IfcMaterialProfileSetUsage::get_ForProfileSet() { RDF_EXPRESS_PROBE(880); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(880), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMaterialProfileSetUsage::put_ForProfileSet(IfcMaterialProfileSet inst) { RDF_EXPRESS_PROBE(880); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(880), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(880, IfcMaterialProfileSetUsage, 368, ForProfileSet)
+    RDF_EXPRESS_ATTR_ACCESSOR(881, IfcMaterialProfileSetUsage, 368, CardinalPoint)
+    RDF_EXPRESS_ATTR_ACCESSOR(882, IfcMaterialProfileSetUsage, 368, ReferenceExtent)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialProfileSetUsage_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialProfileSetUsageTapering_H
+#define __RDF_LTD__IFC4_IfcMaterialProfileSetUsageTapering_H
+
+#include    "classes/IfcMaterialProfileSetUsageTapering.h"
+#include    "IfcMaterialProfileSetUsage.h"
+#include    "classes/IfcMaterialProfileSet.h"
+
+namespace IFC4
+{
+    inline IfcMaterialProfileSet IfcMaterialProfileSetUsageTapering::get_ForProfileEndSet() { RDF_EXPRESS_PROBE(883); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(883), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMaterialProfileSetUsageTapering::put_ForProfileEndSet(IfcMaterialProfileSet inst) { RDF_EXPRESS_PROBE(883); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(883), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(883, IfcMaterialProfileSetUsageTapering, 369, ForProfileEndSet)
+    RDF_EXPRESS_ATTR_ACCESSOR(884, IfcMaterialProfileSetUsageTapering, 369, CardinalEndPoint)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialProfileSetUsageTapering_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialProfileWithOffsets_H
+#define __RDF_LTD__IFC4_IfcMaterialProfileWithOffsets_H
+
+#include    "classes/IfcMaterialProfileWithOffsets.h"
+#include    "IfcMaterialProfile.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(885, IfcMaterialProfileWithOffsets, 370, OffsetValues)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialProfileWithOffsets_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialProperties_H
+#define __RDF_LTD__IFC4_IfcMaterialProperties_H
+
+#include    "classes/IfcMaterialProperties.h"
+#include    "IfcExtendedProperties.h"
+#include    "classes/IfcMaterialDefinition.h"
+
+namespace IFC4
+{
+    inline IfcMaterialDefinition IfcMaterialProperties::get_Material() { RDF_EXPRESS_PROBE(886); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(886), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMaterialProperties::put_Material(IfcMaterialDefinition inst) { RDF_EXPRESS_PROBE(886); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(886), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(886, IfcMaterialProperties, 371, Material)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialProperties_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialRelationship_H
+#define __RDF_LTD__IFC4_IfcMaterialRelationship_H
+
+#include    "classes/IfcMaterialRelationship.h"
+#include    "IfcResourceLevelRelationship.h"
+#include    "classes/IfcMaterial.h"
+
+namespace IFC4
+{
+    inline IfcMaterial IfcMaterialRelationship::get_RelatingMaterial() { RDF_EXPRESS_PROBE(887); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(887), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMaterialRelationship::put_RelatingMaterial(IfcMaterial inst) { RDF_EXPRESS_PROBE(887); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(887), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(887, IfcMaterialRelationship, 372, RelatingMaterial)
+    RDF_EXPRESS_ATTR_ACCESSOR(888, IfcMaterialRelationship, 372, RelatedMaterials)
+    RDF_EXPRESS_ATTR_ACCESSOR(889, IfcMaterialRelationship, 372, Expression)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialRelationship_H
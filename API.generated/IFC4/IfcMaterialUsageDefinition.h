@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialUsageDefinition_H
+#define __RDF_LTD__IFC4_IfcMaterialUsageDefinition_H
+
+#include    "classes/IfcMaterialUsageDefinition.h"
+#include    "classes/IfcRelAssociatesMaterial.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(860, IfcMaterialUsageDefinition, 373, AssociatedTo)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialUsageDefinition_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMeasureWithUnit_H
+#define __RDF_LTD__IFC4_IfcMeasureWithUnit_H
+
+#include    "classes/IfcMeasureWithUnit.h"
+#include    "selects/IfcUnit.h"
+#include    "selects/IfcValue.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(890, IfcMeasureWithUnit, 374, ValueComponent)
+    RDF_EXPRESS_ATTR_ACCESSOR(891, IfcMeasureWithUnit, 374, UnitComponent)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMeasureWithUnit_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMechanicalFastener_H
+#define __RDF_LTD__IFC4_IfcMechanicalFastener_H
+
+#include    "classes/IfcMechanicalFastener.h"
+#include    "IfcElementComponent.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(892, IfcMechanicalFastener, 375, NominalDiameter)
+    RDF_EXPRESS_ATTR_ACCESSOR(893, IfcMechanicalFastener, 375, NominalLength)
+    RDF_EXPRESS_ATTR_ACCESSOR(894, IfcMechanicalFastener, 375, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMechanicalFastener_H
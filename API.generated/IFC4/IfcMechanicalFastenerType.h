@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMechanicalFastenerType_H
+#define __RDF_LTD__IFC4_IfcMechanicalFastenerType_H
+
+#include    "classes/IfcMechanicalFastenerType.h"
+#include    "IfcElementComponentType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(895, IfcMechanicalFastenerType, 376, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(896, IfcMechanicalFastenerType, 376, NominalDiameter)
+    RDF_EXPRESS_ATTR_ACCESSOR(897, IfcMechanicalFastenerType, 376, NominalLength)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMechanicalFastenerType_H
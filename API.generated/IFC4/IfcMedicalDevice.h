@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMedicalDevice_H
+#define __RDF_LTD__IFC4_IfcMedicalDevice_H
+
+#include    "classes/IfcMedicalDevice.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(898, IfcMedicalDevice, 377, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMedicalDevice_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMember_H
+#define __RDF_LTD__IFC4_IfcMember_H
+
+#include    "classes/IfcMember.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(900, IfcMember, 379, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMember_H
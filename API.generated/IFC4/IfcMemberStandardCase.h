@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMemberStandardCase_H
+#define __RDF_LTD__IFC4_IfcMemberStandardCase_H
+
+#include    "classes/IfcMemberStandardCase.h"
+#include    "IfcMember.h"
+
+#endif //__RDF_LTD__IFC4_IfcMemberStandardCase_H
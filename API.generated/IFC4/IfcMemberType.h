@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMemberType_H
+#define __RDF_LTD__IFC4_IfcMemberType_H
+
+#include    "classes/IfcMemberType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(901, IfcMemberType, 381, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMemberType_H
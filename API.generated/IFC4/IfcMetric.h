@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMetric_H
+#define __RDF_LTD__IFC4_IfcMetric_H
+
+#include    "classes/IfcMetric.h"
+#include    "IfcConstraint.h"
+#include    "classes/IfcReference.h"
+#include    "selects/IfcMetricValueSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(902, IfcMetric, 382, Benchmark)
+    RDF_EXPRESS_ATTR_ACCESSOR(903, IfcMetric, 382, ValueSource)
+    RDF_EXPRESS_ATTR_ACCESSOR(904, IfcMetric, 382, DataValue)
+    inline IfcReference IfcMetric::get_ReferencePath() { RDF_EXPRESS_PROBE(905); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(905), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcMetric::put_ReferencePath(IfcReference inst) { RDF_EXPRESS_PROBE(905); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(905), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(905, IfcMetric, 382, ReferencePath)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMetric_H
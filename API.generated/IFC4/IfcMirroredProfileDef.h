@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMirroredProfileDef_H
+#define __RDF_LTD__IFC4_IfcMirroredProfileDef_H
+
+#include    "classes/IfcMirroredProfileDef.h"
+#include    "IfcDerivedProfileDef.h"
+
+#endif //__RDF_LTD__IFC4_IfcMirroredProfileDef_H
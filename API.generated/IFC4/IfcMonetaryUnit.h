@@ -0,0 +1,14 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMonetaryUnit_H
+#define __RDF_LTD__IFC4_IfcMonetaryUnit_H
+
+#include    "classes/IfcMonetaryUnit.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(906, IfcMonetaryUnit, 384, Currency)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMonetaryUnit_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMotorConnection_H
+#define __RDF_LTD__IFC4_IfcMotorConnection_H
+
+#include    "classes/IfcMotorConnection.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(907, IfcMotorConnection, 385, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMotorConnection_H
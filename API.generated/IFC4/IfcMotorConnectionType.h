@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMotorConnectionType_H
+#define __RDF_LTD__IFC4_IfcMotorConnectionType_H
+
+#include    "classes/IfcMotorConnectionType.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(908, IfcMotorConnectionType, 386, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcMotorConnectionType_H
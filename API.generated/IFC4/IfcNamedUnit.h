@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcNamedUnit_H
+#define __RDF_LTD__IFC4_IfcNamedUnit_H
+
+#include    "classes/IfcNamedUnit.h"
+#include    "classes/IfcDimensionalExponents.h"
+
+namespace IFC4
+{
+    inline IfcDimensionalExponents IfcNamedUnit::get_Dimensions() { RDF_EXPRESS_PROBE(396); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(396), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcNamedUnit::put_Dimensions(IfcDimensionalExponents inst) { RDF_EXPRESS_PROBE(396); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(396), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(396, IfcNamedUnit, 387, Dimensions)
+    RDF_EXPRESS_ATTR_ACCESSOR(397, IfcNamedUnit, 387, UnitType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcNamedUnit_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcObject_H
+#define __RDF_LTD__IFC4_IfcObject_H
+
+#include    "classes/IfcObject.h"
+#include    "IfcObjectDefinition.h"
+#include    "classes/IfcRelDefinesByObject.h"
+#include    "classes/IfcRelDefinesByProperties.h"
+#include    "classes/IfcRelDefinesByType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(11, IfcObject, 388, ObjectType)
+    RDF_EXPRESS_ATTR_ACCESSOR(12, IfcObject, 388, IsDeclaredBy)
+    RDF_EXPRESS_ATTR_ACCESSOR(13, IfcObject, 388, Declares)
+    RDF_EXPRESS_ATTR_ACCESSOR(14, IfcObject, 388, IsTypedBy)
+    RDF_EXPRESS_ATTR_ACCESSOR(15, IfcObject, 388, IsDefinedBy)
+}
+
+#endif //__RDF_LTD__IFC4_IfcObject_H
@@ -0,0 +1,26 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcObjectDefinition_H
+#define __RDF_LTD__IFC4_IfcObjectDefinition_H
+
+#include    "classes/IfcObjectDefinition.h"
+#include    "IfcRoot.h"
+#include    "classes/IfcRelAggregates.h"
+#include    "classes/IfcRelAssigns.h"
+#include    "classes/IfcRelAssociates.h"
+#include    "classes/IfcRelDeclares.h"
+#include    "classes/IfcRelNests.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(4, IfcObjectDefinition, 389, HasAssignments)
+    RDF_EXPRESS_ATTR_ACCESSOR(5, IfcObjectDefinition, 389, Nests)
+    RDF_EXPRESS_ATTR_ACCESSOR(6, IfcObjectDefinition, 389, IsNestedBy)
+    RDF_EXPRESS_ATTR_ACCESSOR(7, IfcObjectDefinition, 389, HasContext)
+    RDF_EXPRESS_ATTR_ACCESSOR(8, IfcObjectDefinition, 389, IsDecomposedBy)
+    RDF_EXPRESS_ATTR_ACCESSOR(9, IfcObjectDefinition, 389, Decomposes)
+    RDF_EXPRESS_ATTR_ACCESSOR(10, IfcObjectDefinition, 389, HasAssociations)
+}
+
+#endif //__RDF_LTD__IFC4_IfcObjectDefinition_H
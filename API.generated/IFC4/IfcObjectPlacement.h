@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcObjectPlacement_H
+#define __RDF_LTD__IFC4_IfcObjectPlacement_H
+
+#include    "classes/IfcObjectPlacement.h"
+#include    "classes/IfcLocalPlacement.h"
+#include    "classes/IfcProduct.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(705, IfcObjectPlacement, 391, PlacesObject)
+    RDF_EXPRESS_ATTR_ACCESSOR(706, IfcObjectPlacement, 391, ReferencedByPlacements)
+}
+
+#endif //__RDF_LTD__IFC4_IfcObjectPlacement_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcObjective_H
+#define __RDF_LTD__IFC4_IfcObjective_H
+
+#include    "classes/IfcObjective.h"
+#include    "IfcConstraint.h"
+#include    "classes/IfcConstraint.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(909, IfcObjective, 390, BenchmarkValues)
+    RDF_EXPRESS_ATTR_ACCESSOR(910, IfcObjective, 390, LogicalAggregator)
+    RDF_EXPRESS_ATTR_ACCESSOR(911, IfcObjective, 390, ObjectiveQualifier)
+    RDF_EXPRESS_ATTR_ACCESSOR(912, IfcObjective, 390, UserDefinedQualifier)
+}
+
+#endif //__RDF_LTD__IFC4_IfcObjective_H
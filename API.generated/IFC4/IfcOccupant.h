@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOccupant_H
+#define __RDF_LTD__IFC4_IfcOccupant_H
+
+#include    "classes/IfcOccupant.h"
+#include    "IfcActor.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(913, IfcOccupant, 392, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcOccupant_H
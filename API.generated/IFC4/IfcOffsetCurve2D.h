@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOffsetCurve2D_H
+#define __RDF_LTD__IFC4_IfcOffsetCurve2D_H
+
+#include    "classes/IfcOffsetCurve2D.h"
+#include    "IfcCurve.h"
+#include    "classes/IfcCurve.h"
+
+namespace IFC4
+{
+    inline IfcCurve IfcOffsetCurve2D::get_BasisCurve() { RDF_EXPRESS_PROBE(914); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(914), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcOffsetCurve2D::put_BasisCurve(IfcCurve inst) { RDF_EXPRESS_PROBE(914); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(914), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(914, IfcOffsetCurve2D, 393, BasisCurve)
+    RDF_EXPRESS_ATTR_ACCESSOR(915, IfcOffsetCurve2D, 393, Distance)
+    RDF_EXPRESS_ATTR_ACCESSOR(916, IfcOffsetCurve2D, 393, SelfIntersect)
+}
+
+#endif //__RDF_LTD__IFC4_IfcOffsetCurve2D_H
@@ -0,0 +1,24 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOffsetCurve3D_H
+#define __RDF_LTD__IFC4_IfcOffsetCurve3D_H
+
+#include    "classes/IfcOffsetCurve3D.h"
+#include    "IfcCurve.h"
+#include    "classes/IfcCurve.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    inline IfcCurve IfcOffsetCurve3D::get_BasisCurve() { RDF_EXPRESS_PROBE(917); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(917), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcOffsetCurve3D::put_BasisCurve(IfcCurve inst) { RDF_EXPRESS_PROBE(917); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(917), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(917, IfcOffsetCurve3D, 394, BasisCurve)
+    RDF_EXPRESS_ATTR_ACCESSOR(918, IfcOffsetCurve3D, 394, Distance)
+    RDF_EXPRESS_ATTR_ACCESSOR(919, IfcOffsetCurve3D, 394, SelfIntersect)
+    inline IfcDirection IfcOffsetCurve3D::get_RefDirection() { RDF_EXPRESS_PROBE(920); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(920), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcOffsetCurve3D::put_RefDirection(IfcDirection inst) { RDF_EXPRESS_PROBE(920); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(920), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(920, IfcOffsetCurve3D, 394, RefDirection)
+}
+
+#endif //__RDF_LTD__IFC4_IfcOffsetCurve3D_H
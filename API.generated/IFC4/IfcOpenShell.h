@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOpenShell_H
+#define __RDF_LTD__IFC4_IfcOpenShell_H
+
+#include    "classes/IfcOpenShell.h"
+#include    "IfcConnectedFaceSet.h"
+
+#endif //__RDF_LTD__IFC4_IfcOpenShell_H
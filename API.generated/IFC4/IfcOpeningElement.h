@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOpeningElement_H
+#define __RDF_LTD__IFC4_IfcOpeningElement_H
+
+#include    "classes/IfcOpeningElement.h"
+#include    "IfcFeatureElementSubtraction.h"
+#include    "classes/IfcRelFillsElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(921, IfcOpeningElement, 395, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(922, IfcOpeningElement, 395, HasFillings)
+}
+
+#endif //__RDF_LTD__IFC4_IfcOpeningElement_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOpeningStandardCase_H
+#define __RDF_LTD__IFC4_IfcOpeningStandardCase_H
+
+#include    "classes/IfcOpeningStandardCase.h"
+#include    "IfcOpeningElement.h"
+
+#endif //__RDF_LTD__IFC4_IfcOpeningStandardCase_H
@@ -0,0 +1,25 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOrganization_H
+#define __RDF_LTD__IFC4_IfcOrganization_H
+
+#include    "classes/IfcOrganization.h"
+#include    "classes/IfcActorRole.h"
+#include    "classes/IfcAddress.h"
+#include    "classes/IfcOrganizationRelationship.h"
+#include    "classes/IfcPersonAndOrganization.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(923, IfcOrganization, 398, Identification)
+    RDF_EXPRESS_ATTR_ACCESSOR(924, IfcOrganization, 398, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(925, IfcOrganization, 398, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(926, IfcOrganization, 398, Roles)
+    RDF_EXPRESS_ATTR_ACCESSOR(927, IfcOrganization, 398, Addresses)
+    RDF_EXPRESS_ATTR_ACCESSOR(928, IfcOrganization, 398, IsRelatedBy)
+    RDF_EXPRESS_ATTR_ACCESSOR(929, IfcOrganization, 398, Relates)
+    RDF_EXPRESS_ATTR_ACCESSOR(930, IfcOrganization, 398, Engages)
+}
+
+#endif //__RDF_LTD__IFC4_IfcOrganization_H
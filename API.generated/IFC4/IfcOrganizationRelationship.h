@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOrganizationRelationship_H
+#define __RDF_LTD__IFC4_IfcOrganizationRelationship_H
+
+#include    "classes/IfcOrganizationRelationship.h"
+#include    "IfcResourceLevelRelationship.h"
+#include    "classes/IfcOrganization.h"
+
+namespace IFC4
+{
+    inline IfcOrganization IfcOrganizationRelationship::get_RelatingOrganization() { RDF_EXPRESS_PROBE(931); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(931), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcOrganizationRelationship::put_RelatingOrganization(IfcOrganization inst) { RDF_EXPRESS_PROBE(931); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(931), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(931, IfcOrganizationRelationship, 399, RelatingOrganization)
+    RDF_EXPRESS_ATTR_ACCESSOR(932, IfcOrganizationRelationship, 399, RelatedOrganizations)
+}
+
+#endif //__RDF_LTD__IFC4_IfcOrganizationRelationship_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOrientedEdge_H
+#define __RDF_LTD__IFC4_IfcOrientedEdge_H
+
+#include    "classes/IfcOrientedEdge.h"
+#include    "IfcEdge.h"
+#include    "classes/IfcEdge.h"
+
+namespace IFC4
+{
+    inline IfcEdge IfcOrientedEdge::get_EdgeElement() { RDF_EXPRESS_PROBE(933); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(933), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcOrientedEdge::put_EdgeElement(IfcEdge inst) { RDF_EXPRESS_PROBE(933); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(933), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(933, IfcOrientedEdge, 400, EdgeElement)
+    RDF_EXPRESS_ATTR_ACCESSOR(934, IfcOrientedEdge, 400, Orientation)
+}
+
+#endif //__RDF_LTD__IFC4_IfcOrientedEdge_H
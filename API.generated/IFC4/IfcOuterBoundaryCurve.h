@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOuterBoundaryCurve_H
+#define __RDF_LTD__IFC4_IfcOuterBoundaryCurve_H
+
+#include    "classes/IfcOuterBoundaryCurve.h"
+#include    "IfcBoundaryCurve.h"
+
+#endif //__RDF_LTD__IFC4_IfcOuterBoundaryCurve_H
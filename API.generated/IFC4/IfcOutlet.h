@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOutlet_H
+#define __RDF_LTD__IFC4_IfcOutlet_H
+
+#include    "classes/IfcOutlet.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(935, IfcOutlet, 402, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcOutlet_H
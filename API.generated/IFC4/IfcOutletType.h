@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOutletType_H
+#define __RDF_LTD__IFC4_IfcOutletType_H
+
+#include    "classes/IfcOutletType.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(936, IfcOutletType, 403, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcOutletType_H
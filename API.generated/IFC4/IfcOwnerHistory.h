@@ -0,0 +1,31 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOwnerHistory_H
+#define __RDF_LTD__IFC4_IfcOwnerHistory_H
+
+#include    "classes/IfcOwnerHistory.h"
+#include    "classes/IfcApplication.h"
+#include    "classes/IfcPersonAndOrganization.h"
+
+namespace IFC4
+{
+    inline IfcPersonAndOrganization IfcOwnerHistory::get_OwningUser() { RDF_EXPRESS_PROBE(937); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(937), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcOwnerHistory::put_OwningUser(IfcPersonAndOrganization inst) { RDF_EXPRESS_PROBE(937); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(937), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(937, IfcOwnerHistory, 404, OwningUser)
+    inline IfcApplication IfcOwnerHistory::get_OwningApplication() { RDF_EXPRESS_PROBE(938); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(938), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcOwnerHistory::put_OwningApplication(IfcApplication inst) { RDF_EXPRESS_PROBE(938); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(938), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(938, IfcOwnerHistory, 404, OwningApplication)
+    RDF_EXPRESS_ATTR_ACCESSOR(939, IfcOwnerHistory, 404, State)
+    RDF_EXPRESS_ATTR_ACCESSOR(940, IfcOwnerHistory, 404, ChangeAction)
+    RDF_EXPRESS_ATTR_ACCESSOR(941, IfcOwnerHistory, 404, LastModifiedDate)
+    inline IfcPersonAndOrganization IfcOwnerHistory::get_LastModifyingUser() { RDF_EXPRESS_PROBE(942); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(942), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcOwnerHistory::put_LastModifyingUser(IfcPersonAndOrganization inst) { RDF_EXPRESS_PROBE(942); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(942), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(942, IfcOwnerHistory, 404, LastModifyingUser)
+    inline IfcApplication IfcOwnerHistory::get_LastModifyingApplication() { RDF_EXPRESS_PROBE(943); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(943), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcOwnerHistory::put_LastModifyingApplication(IfcApplication inst) { RDF_EXPRESS_PROBE(943); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(943), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(943, IfcOwnerHistory, 404, LastModifyingApplication)
+    RDF_EXPRESS_ATTR_ACCESSOR(944, IfcOwnerHistory, 404, CreationDate)
+}
+
+#endif //__RDF_LTD__IFC4_IfcOwnerHistory_H
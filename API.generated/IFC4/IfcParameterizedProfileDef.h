@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcParameterizedProfileDef_H
+#define __RDF_LTD__IFC4_IfcParameterizedProfileDef_H
+
+#include    "classes/IfcParameterizedProfileDef.h"
+#include    "IfcProfileDef.h"
+#include    "classes/IfcAxis2Placement2D.h"
+
+namespace IFC4
+{
+    inline IfcAxis2Placement2D IfcParameterizedProfileDef::get_Position() { RDF_EXPRESS_PROBE(130); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(130), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcParameterizedProfileDef::put_Position(IfcAxis2Placement2D inst) { RDF_EXPRESS_PROBE(130); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(130), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(130, IfcParameterizedProfileDef, 405, Position)
+}
+
+#endif //__RDF_LTD__IFC4_IfcParameterizedProfileDef_H
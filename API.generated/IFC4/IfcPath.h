@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPath_H
+#define __RDF_LTD__IFC4_IfcPath_H
+
+#include    "classes/IfcPath.h"
+#include    "IfcTopologicalRepresentationItem.h"
+#include    "classes/IfcOrientedEdge.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(945, IfcPath, 406, EdgeList)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPath_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPcurve_H
+#define __RDF_LTD__IFC4_IfcPcurve_H
+
+#include    "classes/IfcPcurve.h"
+#include    "IfcCurve.h"
+#include    "classes/IfcCurve.h"
+#include    "classes/IfcSurface.h"
+
+namespace IFC4
+{
+    inline IfcSurface IfcPcurve::get_BasisSurface() { RDF_EXPRESS_PROBE(946); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(946), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPcurve::put_BasisSurface(IfcSurface inst) { RDF_EXPRESS_PROBE(946); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(946), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(946, IfcPcurve, 407, BasisSurface)
+    inline IfcCurve IfcPcurve::get_ReferenceCurve() { RDF_EXPRESS_PROBE(947); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(947), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPcurve::put_ReferenceCurve(IfcCurve inst) { RDF_EXPRESS_PROBE(947); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(947), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(947, IfcPcurve, 407, ReferenceCurve)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPcurve_H
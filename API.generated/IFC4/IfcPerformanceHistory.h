@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPerformanceHistory_H
+#define __RDF_LTD__IFC4_IfcPerformanceHistory_H
+
+#include    "classes/IfcPerformanceHistory.h"
+#include    "IfcControl.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(948, IfcPerformanceHistory, 408, LifeCyclePhase)
+    RDF_EXPRESS_ATTR_ACCESSOR(949, IfcPerformanceHistory, 408, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPerformanceHistory_H
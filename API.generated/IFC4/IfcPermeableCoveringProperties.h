@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPermeableCoveringProperties_H
+#define __RDF_LTD__IFC4_IfcPermeableCoveringProperties_H
+
+#include    "classes/IfcPermeableCoveringProperties.h"
+#include    "IfcPreDefinedPropertySet.h"
+#include    "classes/IfcShapeAspect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(950, IfcPermeableCoveringProperties, 409, OperationType)
+    RDF_EXPRESS_ATTR_ACCESSOR(951, IfcPermeableCoveringProperties, 409, PanelPosition)
+    RDF_EXPRESS_ATTR_ACCESSOR(952, IfcPermeableCoveringProperties, 409, FrameDepth)
+    RDF_EXPRESS_ATTR_ACCESSOR(953, IfcPermeableCoveringProperties, 409, FrameThickness)
+    inline IfcShapeAspect IfcPermeableCoveringProperties::get_ShapeAspectStyle() { RDF_EXPRESS_PROBE(954); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(954), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPermeableCoveringProperties::put_ShapeAspectStyle(IfcShapeAspect inst) { RDF_EXPRESS_PROBE(954); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(954), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(954, IfcPermeableCoveringProperties, 409, ShapeAspectStyle)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPermeableCoveringProperties_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPermit_H
+#define __RDF_LTD__IFC4_IfcPermit_H
+
+#include    "classes/IfcPermit.h"
+#include    "IfcControl.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(955, IfcPermit, 410, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(956, IfcPermit, 410, Status)
+    RDF_EXPRESS_ATTR_ACCESSOR(957, IfcPermit, 410, LongDescription)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPermit_H
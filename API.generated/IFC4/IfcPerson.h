@@ -0,0 +1,25 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPerson_H
+#define __RDF_LTD__IFC4_IfcPerson_H
+
+#include    "classes/IfcPerson.h"
+#include    "classes/IfcActorRole.h"
+#include    "classes/IfcAddress.h"
+#include    "classes/IfcPersonAndOrganization.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(958, IfcPerson, 411, Identification)
+    RDF_EXPRESS_ATTR_ACCESSOR(959, IfcPerson, 411, FamilyName)
+    RDF_EXPRESS_ATTR_ACCESSOR(960, IfcPerson, 411, GivenName)
+    RDF_EXPRESS_ATTR_ACCESSOR(961, IfcPerson, 411, MiddleNames)
+    RDF_EXPRESS_ATTR_ACCESSOR(962, IfcPerson, 411, PrefixTitles)
+    RDF_EXPRESS_ATTR_ACCESSOR(963, IfcPerson, 411, SuffixTitles)
+    RDF_EXPRESS_ATTR_ACCESSOR(964, IfcPerson, 411, Roles)
+    RDF_EXPRESS_ATTR_ACCESSOR(965, IfcPerson, 411, Addresses)
+    RDF_EXPRESS_ATTR_ACCESSOR(966, IfcPerson, 411, EngagedIn)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPerson_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPersonAndOrganization_H
+#define __RDF_LTD__IFC4_IfcPersonAndOrganization_H
+
+#include    "classes/IfcPersonAndOrganization.h"
+#include    "classes/IfcActorRole.h"
+#include    "classes/IfcOrganization.h"
+#include    "classes/IfcPerson.h"
+
+namespace IFC4
+{
+    inline IfcPerson IfcPersonAndOrganization::get_ThePerson() { RDF_EXPRESS_PROBE(967); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(967), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPersonAndOrganization::put_ThePerson(IfcPerson inst) { RDF_EXPRESS_PROBE(967); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(967), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(967, IfcPersonAndOrganization, 412, ThePerson)
+    inline IfcOrganization IfcPersonAndOrganization::get_TheOrganization() { RDF_EXPRESS_PROBE(968); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(968), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPersonAndOrganization::put_TheOrganization(IfcOrganization inst) { RDF_EXPRESS_PROBE(968); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(968), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(968, IfcPersonAndOrganization, 412, TheOrganization)
+    RDF_EXPRESS_ATTR_ACCESSOR(969, IfcPersonAndOrganization, 412, Roles)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPersonAndOrganization_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPhysicalComplexQuantity_H
+#define __RDF_LTD__IFC4_IfcPhysicalComplexQuantity_H
+
+#include    "classes/IfcPhysicalComplexQuantity.h"
+#include    "IfcPhysicalQuantity.h"
+#include    "classes/IfcPhysicalQuantity.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(974, IfcPhysicalComplexQuantity, 413, HasQuantities)
+    RDF_EXPRESS_ATTR_ACCESSOR(975, IfcPhysicalComplexQuantity, 413, Discrimination)
+    RDF_EXPRESS_ATTR_ACCESSOR(976, IfcPhysicalComplexQuantity, 413, Quality)
+    RDF_EXPRESS_ATTR_ACCESSOR(977, IfcPhysicalComplexQuantity, 413, Usage)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPhysicalComplexQuantity_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPhysicalQuantity_H
+#define __RDF_LTD__IFC4_IfcPhysicalQuantity_H
+
+#include    "classes/IfcPhysicalQuantity.h"
+#include    "classes/IfcExternalReferenceRelationship.h"
+#include    "classes/IfcPhysicalComplexQuantity.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(970, IfcPhysicalQuantity, 414, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(971, IfcPhysicalQuantity, 414, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(972, IfcPhysicalQuantity, 414, HasExternalReferences)
+    RDF_EXPRESS_ATTR_ACCESSOR(973, IfcPhysicalQuantity, 414, PartOfComplex)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPhysicalQuantity_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPhysicalSimpleQuantity_H
+#define __RDF_LTD__IFC4_IfcPhysicalSimpleQuantity_H
+
+#include    "classes/IfcPhysicalSimpleQuantity.h"
+#include    "IfcPhysicalQuantity.h"
+#include    "classes/IfcNamedUnit.h"
+
+namespace IFC4
+{
+    inline IfcNamedUnit IfcPhysicalSimpleQuantity::get_Unit() { RDF_EXPRESS_PROBE(978); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(978), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPhysicalSimpleQuantity::put_Unit(IfcNamedUnit inst) { RDF_EXPRESS_PROBE(978); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(978), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(978, IfcPhysicalSimpleQuantity, 415, Unit)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPhysicalSimpleQuantity_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPile_H
+#define __RDF_LTD__IFC4_IfcPile_H
+
+#include    "classes/IfcPile.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(979, IfcPile, 416, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(980, IfcPile, 416, ConstructionType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPile_H
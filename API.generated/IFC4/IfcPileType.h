@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPileType_H
+#define __RDF_LTD__IFC4_IfcPileType_H
+
+#include    "classes/IfcPileType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(981, IfcPileType, 417, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPileType_H
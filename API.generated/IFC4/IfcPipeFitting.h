@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPipeFitting_H
+#define __RDF_LTD__IFC4_IfcPipeFitting_H
+
+#include    "classes/IfcPipeFitting.h"
+#include    "IfcFlowFitting.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(982, IfcPipeFitting, 418, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPipeFitting_H
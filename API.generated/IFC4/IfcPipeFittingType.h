@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPipeFittingType_H
+#define __RDF_LTD__IFC4_IfcPipeFittingType_H
+
+#include    "classes/IfcPipeFittingType.h"
+#include    "IfcFlowFittingType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(983, IfcPipeFittingType, 419, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPipeFittingType_H
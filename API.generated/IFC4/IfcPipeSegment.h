@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPipeSegment_H
+#define __RDF_LTD__IFC4_IfcPipeSegment_H
+
+#include    "classes/IfcPipeSegment.h"
+#include    "IfcFlowSegment.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(984, IfcPipeSegment, 420, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPipeSegment_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPipeSegmentType_H
+#define __RDF_LTD__IFC4_IfcPipeSegmentType_H
+
+#include    "classes/IfcPipeSegmentType.h"
+#include    "IfcFlowSegmentType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(985, IfcPipeSegmentType, 421, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPipeSegmentType_H
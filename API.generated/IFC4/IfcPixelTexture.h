@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPixelTexture_H
+#define __RDF_LTD__IFC4_IfcPixelTexture_H
+
+#include    "classes/IfcPixelTexture.h"
+#include    "IfcSurfaceTexture.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(986, IfcPixelTexture, 422, Width)
+    RDF_EXPRESS_ATTR_ACCESSOR(987, IfcPixelTexture, 422, Height)
+    RDF_EXPRESS_ATTR_ACCESSOR(988, IfcPixelTexture, 422, ColourComponents)
+    RDF_EXPRESS_ATTR_ACCESSOR(989, IfcPixelTexture, 422, Pixel)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPixelTexture_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPlacement_H
+#define __RDF_LTD__IFC4_IfcPlacement_H
+
+#include    "classes/IfcPlacement.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "classes/IfcCartesianPoint.h"
+
+namespace IFC4
+{
+    inline IfcCartesianPoint IfcPlacement::get_Location() { RDF_EXPRESS_PROBE(145); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(145), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPlacement::put_Location(IfcCartesianPoint inst) { RDF_EXPRESS_PROBE(145); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(145), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(145, IfcPlacement, 423, Location)
+    RDF_EXPRESS_ATTR_ACCESSOR(146, IfcPlacement, 423, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPlacement_H
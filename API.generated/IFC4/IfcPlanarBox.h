@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPlanarBox_H
+#define __RDF_LTD__IFC4_IfcPlanarBox_H
+
+#include    "classes/IfcPlanarBox.h"
+#include    "IfcPlanarExtent.h"
+#include    "selects/IfcAxis2Placement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(992, IfcPlanarBox, 424, Placement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPlanarBox_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPlanarExtent_H
+#define __RDF_LTD__IFC4_IfcPlanarExtent_H
+
+#include    "classes/IfcPlanarExtent.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(990, IfcPlanarExtent, 425, SizeInX)
+    RDF_EXPRESS_ATTR_ACCESSOR(991, IfcPlanarExtent, 425, SizeInY)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPlanarExtent_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPlane_H
+#define __RDF_LTD__IFC4_IfcPlane_H
+
+#include    "classes/IfcPlane.h"
+#include    "IfcElementarySurface.h"
+
+#endif //__RDF_LTD__IFC4_IfcPlane_H
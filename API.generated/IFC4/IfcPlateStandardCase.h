@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPlateStandardCase_H
+#define __RDF_LTD__IFC4_IfcPlateStandardCase_H
+
+#include    "classes/IfcPlateStandardCase.h"
+#include    "IfcPlate.h"
+
+#endif //__RDF_LTD__IFC4_IfcPlateStandardCase_H
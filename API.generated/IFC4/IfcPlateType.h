@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPlateType_H
+#define __RDF_LTD__IFC4_IfcPlateType_H
+
+#include    "classes/IfcPlateType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(994, IfcPlateType, 429, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPlateType_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPointOnCurve_H
+#define __RDF_LTD__IFC4_IfcPointOnCurve_H
+
+#include    "classes/IfcPointOnCurve.h"
+#include    "IfcPoint.h"
+#include    "classes/IfcCurve.h"
+
+namespace IFC4
+{
+    inline IfcCurve IfcPointOnCurve::get_BasisCurve() { RDF_EXPRESS_PROBE(995); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(995), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPointOnCurve::put_BasisCurve(IfcCurve inst) { RDF_EXPRESS_PROBE(995); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(995), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(995, IfcPointOnCurve, 431, BasisCurve)
+    RDF_EXPRESS_ATTR_ACCESSOR(996, IfcPointOnCurve, 431, PointParameter)
+    RDF_EXPRESS_ATTR_ACCESSOR(997, IfcPointOnCurve, 431, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPointOnCurve_H
@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPointOnSurface_H
+#define __RDF_LTD__IFC4_IfcPointOnSurface_H
+
+#include    "classes/IfcPointOnSurface.h"
+#include    "IfcPoint.h"
+#include    "classes/IfcSurface.h"
+
+namespace IFC4
+{
+    inline IfcSurface IfcPointOnSurface::get_BasisSurface() { RDF_EXPRESS_PROBE(998); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(998), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPointOnSurface::put_BasisSurface(IfcSurface inst) { RDF_EXPRESS_PROBE(998); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(998), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(998, IfcPointOnSurface, 432, BasisSurface)
+    RDF_EXPRESS_ATTR_ACCESSOR(999, IfcPointOnSurface, 432, PointParameterU)
+    RDF_EXPRESS_ATTR_ACCESSOR(1000, IfcPointOnSurface, 432, PointParameterV)
+    RDF_EXPRESS_ATTR_ACCESSOR(1001, IfcPointOnSurface, 432, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPointOnSurface_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPolyLoop_H
+#define __RDF_LTD__IFC4_IfcPolyLoop_H
+
+#include    "classes/IfcPolyLoop.h"
+#include    "IfcLoop.h"
+#include    "classes/IfcCartesianPoint.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1012, IfcPolyLoop, 436, Polygon)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPolyLoop_H
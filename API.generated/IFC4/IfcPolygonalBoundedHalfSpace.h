@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPolygonalBoundedHalfSpace_H
+#define __RDF_LTD__IFC4_IfcPolygonalBoundedHalfSpace_H
+
+#include    "classes/IfcPolygonalBoundedHalfSpace.h"
+#include    "IfcHalfSpaceSolid.h"
+#include    "classes/IfcAxis2Placement3D.h"
+#include    "classes/IfcBoundedCurve.h"
+
+namespace IFC4
+{
+    inline IfcAxis2Placement3D IfcPolygonalBoundedHalfSpace::get_Position() { RDF_EXPRESS_PROBE(1002); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1002), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPolygonalBoundedHalfSpace::put_Position(IfcAxis2Placement3D inst) { RDF_EXPRESS_PROBE(1002); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1002), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1002, IfcPolygonalBoundedHalfSpace, 433, Position)
+    inline IfcBoundedCurve IfcPolygonalBoundedHalfSpace::get_PolygonalBoundary() { RDF_EXPRESS_PROBE(1003); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1003), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPolygonalBoundedHalfSpace::put_PolygonalBoundary(IfcBoundedCurve inst) { RDF_EXPRESS_PROBE(1003); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1003), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1003, IfcPolygonalBoundedHalfSpace, 433, PolygonalBoundary)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPolygonalBoundedHalfSpace_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPolygonalFaceSet_H
+#define __RDF_LTD__IFC4_IfcPolygonalFaceSet_H
+
+#include    "classes/IfcPolygonalFaceSet.h"
+#include    "IfcTessellatedFaceSet.h"
+#include    "classes/IfcIndexedPolygonalFace.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1008, IfcPolygonalFaceSet, 434, Closed)
+    RDF_EXPRESS_ATTR_ACCESSOR(1009, IfcPolygonalFaceSet, 434, Faces)
+    RDF_EXPRESS_ATTR_ACCESSOR(1010, IfcPolygonalFaceSet, 434, PnIndex)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPolygonalFaceSet_H
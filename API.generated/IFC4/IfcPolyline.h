@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPolyline_H
+#define __RDF_LTD__IFC4_IfcPolyline_H
+
+#include    "classes/IfcPolyline.h"
+#include    "IfcBoundedCurve.h"
+#include    "classes/IfcCartesianPoint.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1011, IfcPolyline, 435, Points)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPolyline_H
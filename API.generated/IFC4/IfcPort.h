@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPort_H
+#define __RDF_LTD__IFC4_IfcPort_H
+
+#include    "classes/IfcPort.h"
+#include    "IfcProduct.h"
+#include    "classes/IfcRelConnectsPorts.h"
+#include    "classes/IfcRelConnectsPortToElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(489, IfcPort, 437, ContainedIn)
+    RDF_EXPRESS_ATTR_ACCESSOR(490, IfcPort, 437, ConnectedFrom)
+    RDF_EXPRESS_ATTR_ACCESSOR(491, IfcPort, 437, ConnectedTo)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPort_H
@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPostalAddress_H
+#define __RDF_LTD__IFC4_IfcPostalAddress_H
+
+#include    "classes/IfcPostalAddress.h"
+#include    "IfcAddress.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1013, IfcPostalAddress, 438, InternalLocation)
+    RDF_EXPRESS_ATTR_ACCESSOR(1014, IfcPostalAddress, 438, AddressLines)
+    RDF_EXPRESS_ATTR_ACCESSOR(1015, IfcPostalAddress, 438, PostalBox)
+    RDF_EXPRESS_ATTR_ACCESSOR(1016, IfcPostalAddress, 438, Town)
+    RDF_EXPRESS_ATTR_ACCESSOR(1017, IfcPostalAddress, 438, Region)
+    RDF_EXPRESS_ATTR_ACCESSOR(1018, IfcPostalAddress, 438, PostalCode)
+    RDF_EXPRESS_ATTR_ACCESSOR(1019, IfcPostalAddress, 438, Country)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPostalAddress_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPreDefinedColour_H
+#define __RDF_LTD__IFC4_IfcPreDefinedColour_H
+
+#include    "classes/IfcPreDefinedColour.h"
+#include    "IfcPreDefinedItem.h"
+
+#endif //__RDF_LTD__IFC4_IfcPreDefinedColour_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPreDefinedItem_H
+#define __RDF_LTD__IFC4_IfcPreDefinedItem_H
+
+#include    "classes/IfcPreDefinedItem.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(556, IfcPreDefinedItem, 441, Name)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPreDefinedItem_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPreDefinedProperties_H
+#define __RDF_LTD__IFC4_IfcPreDefinedProperties_H
+
+#include    "classes/IfcPreDefinedProperties.h"
+#include    "IfcPropertyAbstraction.h"
+
+#endif //__RDF_LTD__IFC4_IfcPreDefinedProperties_H
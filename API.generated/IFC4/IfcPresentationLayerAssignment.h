@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPresentationLayerAssignment_H
+#define __RDF_LTD__IFC4_IfcPresentationLayerAssignment_H
+
+#include    "classes/IfcPresentationLayerAssignment.h"
+#include    "selects/IfcLayeredItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1020, IfcPresentationLayerAssignment, 446, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(1021, IfcPresentationLayerAssignment, 446, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(1022, IfcPresentationLayerAssignment, 446, AssignedItems)
+    RDF_EXPRESS_ATTR_ACCESSOR(1023, IfcPresentationLayerAssignment, 446, Identifier)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPresentationLayerAssignment_H
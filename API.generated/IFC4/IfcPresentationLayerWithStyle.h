@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPresentationLayerWithStyle_H
+#define __RDF_LTD__IFC4_IfcPresentationLayerWithStyle_H
+
+#include    "classes/IfcPresentationLayerWithStyle.h"
+#include    "IfcPresentationLayerAssignment.h"
+#include    "classes/IfcPresentationStyle.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1024, IfcPresentationLayerWithStyle, 447, LayerOn)
+    RDF_EXPRESS_ATTR_ACCESSOR(1025, IfcPresentationLayerWithStyle, 447, LayerFrozen)
+    RDF_EXPRESS_ATTR_ACCESSOR(1026, IfcPresentationLayerWithStyle, 447, LayerBlocked)
+    RDF_EXPRESS_ATTR_ACCESSOR(1027, IfcPresentationLayerWithStyle, 447, LayerStyles)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPresentationLayerWithStyle_H
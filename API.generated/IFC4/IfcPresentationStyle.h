@@ -0,0 +1,14 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPresentationStyle_H
+#define __RDF_LTD__IFC4_IfcPresentationStyle_H
+
+#include    "classes/IfcPresentationStyle.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(449, IfcPresentationStyle, 448, Name)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPresentationStyle_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPresentationStyleAssignment_H
+#define __RDF_LTD__IFC4_IfcPresentationStyleAssignment_H
+
+#include    "classes/IfcPresentationStyleAssignment.h"
+#include    "selects/IfcPresentationStyleSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1028, IfcPresentationStyleAssignment, 449, Styles)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPresentationStyleAssignment_H
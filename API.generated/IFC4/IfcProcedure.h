@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProcedure_H
+#define __RDF_LTD__IFC4_IfcProcedure_H
+
+#include    "classes/IfcProcedure.h"
+#include    "IfcProcess.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1029, IfcProcedure, 450, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProcedure_H
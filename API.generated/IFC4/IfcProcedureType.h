@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProcedureType_H
+#define __RDF_LTD__IFC4_IfcProcedureType_H
+
+#include    "classes/IfcProcedureType.h"
+#include    "IfcTypeProcess.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1030, IfcProcedureType, 451, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProcedureType_H
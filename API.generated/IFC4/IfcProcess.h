@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProcess_H
+#define __RDF_LTD__IFC4_IfcProcess_H
+
+#include    "classes/IfcProcess.h"
+#include    "IfcObject.h"
+#include    "classes/IfcRelAssignsToProcess.h"
+#include    "classes/IfcRelSequence.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(596, IfcProcess, 452, Identification)
+    RDF_EXPRESS_ATTR_ACCESSOR(597, IfcProcess, 452, LongDescription)
+    RDF_EXPRESS_ATTR_ACCESSOR(598, IfcProcess, 452, IsPredecessorTo)
+    RDF_EXPRESS_ATTR_ACCESSOR(599, IfcProcess, 452, IsSuccessorFrom)
+    RDF_EXPRESS_ATTR_ACCESSOR(600, IfcProcess, 452, OperatesOn)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProcess_H
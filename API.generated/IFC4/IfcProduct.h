@@ -0,0 +1,24 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProduct_H
+#define __RDF_LTD__IFC4_IfcProduct_H
+
+#include    "classes/IfcProduct.h"
+#include    "IfcObject.h"
+#include    "classes/IfcObjectPlacement.h"
+#include    "classes/IfcProductRepresentation.h"
+#include    "classes/IfcRelAssignsToProduct.h"
+
+namespace IFC4
+{
+    inline IfcObjectPlacement IfcProduct::get_ObjectPlacement() { RDF_EXPRESS_PROBE(27); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(27), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcProduct::put_ObjectPlacement(IfcObjectPlacement inst) { RDF_EXPRESS_PROBE(27); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(27), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(27, IfcProduct, 453, ObjectPlacement)
+    inline IfcProductRepresentation IfcProduct::get_Representation() { RDF_EXPRESS_PROBE(28); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(28), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcProduct::put_Representation(IfcProductRepresentation inst) { RDF_EXPRESS_PROBE(28); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(28), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(28, IfcProduct, 453, Representation)
+    RDF_EXPRESS_ATTR_ACCESSOR(29, IfcProduct, 453, ReferencedBy)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProduct_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProductDefinitionShape_H
+#define __RDF_LTD__IFC4_IfcProductDefinitionShape_H
+
+#include    "classes/IfcProductDefinitionShape.h"
+#include    "IfcProductRepresentation.h"
+#include    "classes/IfcProduct.h"
+#include    "classes/IfcShapeAspect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1031, IfcProductDefinitionShape, 454, ShapeOfProduct)
+    RDF_EXPRESS_ATTR_ACCESSOR(1032, IfcProductDefinitionShape, 454, HasShapeAspects)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProductDefinitionShape_H
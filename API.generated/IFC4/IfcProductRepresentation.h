@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProductRepresentation_H
+#define __RDF_LTD__IFC4_IfcProductRepresentation_H
+
+#include    "classes/IfcProductRepresentation.h"
+#include    "classes/IfcRepresentation.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(844, IfcProductRepresentation, 455, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(845, IfcProductRepresentation, 455, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(846, IfcProductRepresentation, 455, Representations)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProductRepresentation_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProfileDef_H
+#define __RDF_LTD__IFC4_IfcProfileDef_H
+
+#include    "classes/IfcProfileDef.h"
+#include    "classes/IfcExternalReferenceRelationship.h"
+#include    "classes/IfcProfileProperties.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(113, IfcProfileDef, 456, ProfileType)
+    RDF_EXPRESS_ATTR_ACCESSOR(114, IfcProfileDef, 456, ProfileName)
+    RDF_EXPRESS_ATTR_ACCESSOR(115, IfcProfileDef, 456, HasExternalReference)
+    RDF_EXPRESS_ATTR_ACCESSOR(116, IfcProfileDef, 456, HasProperties)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProfileDef_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProfileProperties_H
+#define __RDF_LTD__IFC4_IfcProfileProperties_H
+
+#include    "classes/IfcProfileProperties.h"
+#include    "IfcExtendedProperties.h"
+#include    "classes/IfcProfileDef.h"
+
+namespace IFC4
+{
+    inline IfcProfileDef IfcProfileProperties::get_ProfileDefinition() { RDF_EXPRESS_PROBE(1033); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1033), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcProfileProperties::put_ProfileDefinition(IfcProfileDef inst) { RDF_EXPRESS_PROBE(1033); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1033), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1033, IfcProfileProperties, 457, ProfileDefinition)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProfileProperties_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProject_H
+#define __RDF_LTD__IFC4_IfcProject_H
+
+#include    "classes/IfcProject.h"
+#include    "IfcContext.h"
+
+#endif //__RDF_LTD__IFC4_IfcProject_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProjectLibrary_H
+#define __RDF_LTD__IFC4_IfcProjectLibrary_H
+
+#include    "classes/IfcProjectLibrary.h"
+#include    "IfcContext.h"
+
+#endif //__RDF_LTD__IFC4_IfcProjectLibrary_H
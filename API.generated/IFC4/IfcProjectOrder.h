@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProjectOrder_H
+#define __RDF_LTD__IFC4_IfcProjectOrder_H
+
+#include    "classes/IfcProjectOrder.h"
+#include    "IfcControl.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1038, IfcProjectOrder, 462, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1039, IfcProjectOrder, 462, Status)
+    RDF_EXPRESS_ATTR_ACCESSOR(1040, IfcProjectOrder, 462, LongDescription)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProjectOrder_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProjectedCRS_H
+#define __RDF_LTD__IFC4_IfcProjectedCRS_H
+
+#include    "classes/IfcProjectedCRS.h"
+#include    "IfcCoordinateReferenceSystem.h"
+#include    "classes/IfcNamedUnit.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1034, IfcProjectedCRS, 459, MapProjection)
+    RDF_EXPRESS_ATTR_ACCESSOR(1035, IfcProjectedCRS, 459, MapZone)
+    inline IfcNamedUnit IfcProjectedCRS::get_MapUnit() { RDF_EXPRESS_PROBE(1036); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1036), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcProjectedCRS::put_MapUnit(IfcNamedUnit inst) { RDF_EXPRESS_PROBE(1036); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1036), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1036, IfcProjectedCRS, 459, MapUnit)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProjectedCRS_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProjectionElement_H
+#define __RDF_LTD__IFC4_IfcProjectionElement_H
+
+#include    "classes/IfcProjectionElement.h"
+#include    "IfcFeatureElementAddition.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1037, IfcProjectionElement, 460, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProjectionElement_H
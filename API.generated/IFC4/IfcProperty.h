@@ -0,0 +1,27 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProperty_H
+#define __RDF_LTD__IFC4_IfcProperty_H
+
+#include    "classes/IfcProperty.h"
+#include    "IfcPropertyAbstraction.h"
+#include    "classes/IfcComplexProperty.h"
+#include    "classes/IfcPropertyDependencyRelationship.h"
+#include    "classes/IfcPropertySet.h"
+#include    "classes/IfcResourceApprovalRelationship.h"
+#include    "classes/IfcResourceConstraintRelationship.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(323, IfcProperty, 463, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(324, IfcProperty, 463, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(325, IfcProperty, 463, PartOfPset)
+    RDF_EXPRESS_ATTR_ACCESSOR(326, IfcProperty, 463, PropertyForDependance)
+    RDF_EXPRESS_ATTR_ACCESSOR(327, IfcProperty, 463, PropertyDependsOn)
+    RDF_EXPRESS_ATTR_ACCESSOR(328, IfcProperty, 463, PartOfComplex)
+    RDF_EXPRESS_ATTR_ACCESSOR(329, IfcProperty, 463, HasConstraints)
+    RDF_EXPRESS_ATTR_ACCESSOR(330, IfcProperty, 463, HasApprovals)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProperty_H
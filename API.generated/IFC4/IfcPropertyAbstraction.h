@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyAbstraction_H
+#define __RDF_LTD__IFC4_IfcPropertyAbstraction_H
+
+#include    "classes/IfcPropertyAbstraction.h"
+#include    "classes/IfcExternalReferenceRelationship.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(322, IfcPropertyAbstraction, 464, HasExternalReferences)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyAbstraction_H
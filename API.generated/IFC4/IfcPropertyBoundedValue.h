@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyBoundedValue_H
+#define __RDF_LTD__IFC4_IfcPropertyBoundedValue_H
+
+#include    "classes/IfcPropertyBoundedValue.h"
+#include    "IfcSimpleProperty.h"
+#include    "selects/IfcUnit.h"
+#include    "selects/IfcValue.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1041, IfcPropertyBoundedValue, 465, UpperBoundValue)
+    RDF_EXPRESS_ATTR_ACCESSOR(1042, IfcPropertyBoundedValue, 465, LowerBoundValue)
+    RDF_EXPRESS_ATTR_ACCESSOR(1043, IfcPropertyBoundedValue, 465, Unit)
+    RDF_EXPRESS_ATTR_ACCESSOR(1044, IfcPropertyBoundedValue, 465, SetPointValue)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyBoundedValue_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyDefinition_H
+#define __RDF_LTD__IFC4_IfcPropertyDefinition_H
+
+#include    "classes/IfcPropertyDefinition.h"
+#include    "IfcRoot.h"
+#include    "classes/IfcRelAssociates.h"
+#include    "classes/IfcRelDeclares.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(333, IfcPropertyDefinition, 466, HasContext)
+    RDF_EXPRESS_ATTR_ACCESSOR(334, IfcPropertyDefinition, 466, HasAssociations)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyDefinition_H
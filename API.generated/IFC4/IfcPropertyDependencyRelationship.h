@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyDependencyRelationship_H
+#define __RDF_LTD__IFC4_IfcPropertyDependencyRelationship_H
+
+#include    "classes/IfcPropertyDependencyRelationship.h"
+#include    "IfcResourceLevelRelationship.h"
+#include    "classes/IfcProperty.h"
+
+namespace IFC4
+{
+    inline IfcProperty IfcPropertyDependencyRelationship::get_DependingProperty() { RDF_EXPRESS_PROBE(1045); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1045), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPropertyDependencyRelationship::put_DependingProperty(IfcProperty inst) { RDF_EXPRESS_PROBE(1045); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1045), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1045, IfcPropertyDependencyRelationship, 467, DependingProperty)
+    inline IfcProperty IfcPropertyDependencyRelationship::get_DependantProperty() { RDF_EXPRESS_PROBE(1046); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1046), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPropertyDependencyRelationship::put_DependantProperty(IfcProperty inst) { RDF_EXPRESS_PROBE(1046); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1046), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1046, IfcPropertyDependencyRelationship, 467, DependantProperty)
+    RDF_EXPRESS_ATTR_ACCESSOR(1047, IfcPropertyDependencyRelationship, 467, Expression)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyDependencyRelationship_H
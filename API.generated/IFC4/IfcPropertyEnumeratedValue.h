@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyEnumeratedValue_H
+#define __RDF_LTD__IFC4_IfcPropertyEnumeratedValue_H
+
+#include    "classes/IfcPropertyEnumeratedValue.h"
+#include    "IfcSimpleProperty.h"
+#include    "classes/IfcPropertyEnumeration.h"
+#include    "selects/IfcValue.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1048, IfcPropertyEnumeratedValue, 468, EnumerationValues)
+    inline IfcPropertyEnumeration IfcPropertyEnumeratedValue::get_EnumerationReference() { RDF_EXPRESS_PROBE(1049); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1049), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcPropertyEnumeratedValue::put_EnumerationReference(IfcPropertyEnumeration inst) { RDF_EXPRESS_PROBE(1049); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1049), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1049, IfcPropertyEnumeratedValue, 468, EnumerationReference)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyEnumeratedValue_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyEnumeration_H
+#define __RDF_LTD__IFC4_IfcPropertyEnumeration_H
+
+#include    "classes/IfcPropertyEnumeration.h"
+#include    "IfcPropertyAbstraction.h"
+#include    "selects/IfcUnit.h"
+#include    "selects/IfcValue.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1050, IfcPropertyEnumeration, 469, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(1051, IfcPropertyEnumeration, 469, EnumerationValues)
+    RDF_EXPRESS_ATTR_ACCESSOR(1052, IfcPropertyEnumeration, 469, Unit)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyEnumeration_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyListValue_H
+#define __RDF_LTD__IFC4_IfcPropertyListValue_H
+
+#include    "classes/IfcPropertyListValue.h"
+#include    "IfcSimpleProperty.h"
+#include    "selects/IfcUnit.h"
+#include    "selects/IfcValue.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1053, IfcPropertyListValue, 470, ListValues)
+    RDF_EXPRESS_ATTR_ACCESSOR(1054, IfcPropertyListValue, 470, Unit)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyListValue_H
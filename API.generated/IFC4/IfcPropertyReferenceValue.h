@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyReferenceValue_H
+#define __RDF_LTD__IFC4_IfcPropertyReferenceValue_H
+
+#include    "classes/IfcPropertyReferenceValue.h"
+#include    "IfcSimpleProperty.h"
+#include    "selects/IfcObjectReferenceSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1055, IfcPropertyReferenceValue, 471, UsageName)
+    RDF_EXPRESS_ATTR_ACCESSOR(1056, IfcPropertyReferenceValue, 471, PropertyReference)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyReferenceValue_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertySet_H
+#define __RDF_LTD__IFC4_IfcPropertySet_H
+
+#include    "classes/IfcPropertySet.h"
+#include    "IfcPropertySetDefinition.h"
+#include    "classes/IfcProperty.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1057, IfcPropertySet, 472, HasProperties)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertySet_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertySetDefinition_H
+#define __RDF_LTD__IFC4_IfcPropertySetDefinition_H
+
+#include    "classes/IfcPropertySetDefinition.h"
+#include    "IfcPropertyDefinition.h"
+#include    "classes/IfcRelDefinesByProperties.h"
+#include    "classes/IfcRelDefinesByTemplate.h"
+#include    "classes/IfcTypeObject.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(527, IfcPropertySetDefinition, 473, DefinesType)
+    RDF_EXPRESS_ATTR_ACCESSOR(528, IfcPropertySetDefinition, 473, IsDefinedBy)
+    RDF_EXPRESS_ATTR_ACCESSOR(529, IfcPropertySetDefinition, 473, DefinesOccurrence)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertySetDefinition_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertySetTemplate_H
+#define __RDF_LTD__IFC4_IfcPropertySetTemplate_H
+
+#include    "classes/IfcPropertySetTemplate.h"
+#include    "IfcPropertyTemplateDefinition.h"
+#include    "classes/IfcPropertyTemplate.h"
+#include    "classes/IfcRelDefinesByTemplate.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1058, IfcPropertySetTemplate, 474, TemplateType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1059, IfcPropertySetTemplate, 474, ApplicableEntity)
+    RDF_EXPRESS_ATTR_ACCESSOR(1060, IfcPropertySetTemplate, 474, HasPropertyTemplates)
+    RDF_EXPRESS_ATTR_ACCESSOR(1061, IfcPropertySetTemplate, 474, Defines)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertySetTemplate_H
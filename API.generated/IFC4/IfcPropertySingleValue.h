@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertySingleValue_H
+#define __RDF_LTD__IFC4_IfcPropertySingleValue_H
+
+#include    "classes/IfcPropertySingleValue.h"
+#include    "IfcSimpleProperty.h"
+#include    "selects/IfcUnit.h"
+#include    "selects/IfcValue.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1062, IfcPropertySingleValue, 475, NominalValue)
+    RDF_EXPRESS_ATTR_ACCESSOR(1063, IfcPropertySingleValue, 475, Unit)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertySingleValue_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyTableValue_H
+#define __RDF_LTD__IFC4_IfcPropertyTableValue_H
+
+#include    "classes/IfcPropertyTableValue.h"
+#include    "IfcSimpleProperty.h"
+#include    "selects/IfcUnit.h"
+#include    "selects/IfcValue.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1064, IfcPropertyTableValue, 476, DefiningValues)
+    RDF_EXPRESS_ATTR_ACCESSOR(1065, IfcPropertyTableValue, 476, DefinedValues)
+    RDF_EXPRESS_ATTR_ACCESSOR(1066, IfcPropertyTableValue, 476, Expression)
+    RDF_EXPRESS_ATTR_ACCESSOR(1067, IfcPropertyTableValue, 476, DefiningUnit)
+    RDF_EXPRESS_ATTR_ACCESSOR(1068, IfcPropertyTableValue, 476, DefinedUnit)
+    RDF_EXPRESS_ATTR_ACCESSOR(1069, IfcPropertyTableValue, 476, CurveInterpolation)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyTableValue_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyTemplate_H
+#define __RDF_LTD__IFC4_IfcPropertyTemplate_H
+
+#include    "classes/IfcPropertyTemplate.h"
+#include    "IfcPropertyTemplateDefinition.h"
+#include    "classes/IfcComplexPropertyTemplate.h"
+#include    "classes/IfcPropertySetTemplate.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(335, IfcPropertyTemplate, 477, PartOfComplexTemplate)
+    RDF_EXPRESS_ATTR_ACCESSOR(336, IfcPropertyTemplate, 477, PartOfPsetTemplate)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyTemplate_H
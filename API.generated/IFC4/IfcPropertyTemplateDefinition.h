@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyTemplateDefinition_H
+#define __RDF_LTD__IFC4_IfcPropertyTemplateDefinition_H
+
+#include    "classes/IfcPropertyTemplateDefinition.h"
+#include    "IfcPropertyDefinition.h"
+
+#endif //__RDF_LTD__IFC4_IfcPropertyTemplateDefinition_H
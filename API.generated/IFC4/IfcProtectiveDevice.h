@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProtectiveDevice_H
+#define __RDF_LTD__IFC4_IfcProtectiveDevice_H
+
+#include    "classes/IfcProtectiveDevice.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1070, IfcProtectiveDevice, 479, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProtectiveDevice_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProtectiveDeviceTrippingUnit_H
+#define __RDF_LTD__IFC4_IfcProtectiveDeviceTrippingUnit_H
+
+#include    "classes/IfcProtectiveDeviceTrippingUnit.h"
+#include    "IfcDistributionControlElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1071, IfcProtectiveDeviceTrippingUnit, 480, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProtectiveDeviceTrippingUnit_H
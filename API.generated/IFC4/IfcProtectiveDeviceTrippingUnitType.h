@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProtectiveDeviceTrippingUnitType_H
+#define __RDF_LTD__IFC4_IfcProtectiveDeviceTrippingUnitType_H
+
+#include    "classes/IfcProtectiveDeviceTrippingUnitType.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1072, IfcProtectiveDeviceTrippingUnitType, 481, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProtectiveDeviceTrippingUnitType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProtectiveDeviceType_H
+#define __RDF_LTD__IFC4_IfcProtectiveDeviceType_H
+
+#include    "classes/IfcProtectiveDeviceType.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1073, IfcProtectiveDeviceType, 482, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProtectiveDeviceType_H
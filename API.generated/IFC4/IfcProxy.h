@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProxy_H
+#define __RDF_LTD__IFC4_IfcProxy_H
+
+#include    "classes/IfcProxy.h"
+#include    "IfcProduct.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1074, IfcProxy, 483, ProxyType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1075, IfcProxy, 483, Tag)
+}
+
+#endif //__RDF_LTD__IFC4_IfcProxy_H
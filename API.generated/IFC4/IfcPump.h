@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPump_H
+#define __RDF_LTD__IFC4_IfcPump_H
+
+#include    "classes/IfcPump.h"
+#include    "IfcFlowMovingDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1076, IfcPump, 484, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPump_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPumpType_H
+#define __RDF_LTD__IFC4_IfcPumpType_H
+
+#include    "classes/IfcPumpType.h"
+#include    "IfcFlowMovingDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1077, IfcPumpType, 485, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcPumpType_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcQuantityArea_H
+#define __RDF_LTD__IFC4_IfcQuantityArea_H
+
+#include    "classes/IfcQuantityArea.h"
+#include    "IfcPhysicalSimpleQuantity.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1078, IfcQuantityArea, 486, AreaValue)
+    RDF_EXPRESS_ATTR_ACCESSOR(1079, IfcQuantityArea, 486, Formula)
+}
+
+#endif //__RDF_LTD__IFC4_IfcQuantityArea_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcQuantityCount_H
+#define __RDF_LTD__IFC4_IfcQuantityCount_H
+
+#include    "classes/IfcQuantityCount.h"
+#include    "IfcPhysicalSimpleQuantity.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1080, IfcQuantityCount, 487, CountValue)
+    RDF_EXPRESS_ATTR_ACCESSOR(1081, IfcQuantityCount, 487, Formula)
+}
+
+#endif //__RDF_LTD__IFC4_IfcQuantityCount_H
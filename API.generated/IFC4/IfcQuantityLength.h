@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcQuantityLength_H
+#define __RDF_LTD__IFC4_IfcQuantityLength_H
+
+#include    "classes/IfcQuantityLength.h"
+#include    "IfcPhysicalSimpleQuantity.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1082, IfcQuantityLength, 488, LengthValue)
+    RDF_EXPRESS_ATTR_ACCESSOR(1083, IfcQuantityLength, 488, Formula)
+}
+
+#endif //__RDF_LTD__IFC4_IfcQuantityLength_H
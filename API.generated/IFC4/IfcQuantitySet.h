@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcQuantitySet_H
+#define __RDF_LTD__IFC4_IfcQuantitySet_H
+
+#include    "classes/IfcQuantitySet.h"
+#include    "IfcPropertySetDefinition.h"
+
+#endif //__RDF_LTD__IFC4_IfcQuantitySet_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcQuantityTime_H
+#define __RDF_LTD__IFC4_IfcQuantityTime_H
+
+#include    "classes/IfcQuantityTime.h"
+#include    "IfcPhysicalSimpleQuantity.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1084, IfcQuantityTime, 490, TimeValue)
+    RDF_EXPRESS_ATTR_ACCESSOR(1085, IfcQuantityTime, 490, Formula)
+}
+
+#endif //__RDF_LTD__IFC4_IfcQuantityTime_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcQuantityVolume_H
+#define __RDF_LTD__IFC4_IfcQuantityVolume_H
+
+#include    "classes/IfcQuantityVolume.h"
+#include    "IfcPhysicalSimpleQuantity.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1086, IfcQuantityVolume, 491, VolumeValue)
+    RDF_EXPRESS_ATTR_ACCESSOR(1087, IfcQuantityVolume, 491, Formula)
+}
+
+#endif //__RDF_LTD__IFC4_IfcQuantityVolume_H
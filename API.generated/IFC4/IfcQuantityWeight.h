@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcQuantityWeight_H
+#define __RDF_LTD__IFC4_IfcQuantityWeight_H
+
+#include    "classes/IfcQuantityWeight.h"
+#include    "IfcPhysicalSimpleQuantity.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1088, IfcQuantityWeight, 492, WeightValue)
+    RDF_EXPRESS_ATTR_ACCESSOR(1089, IfcQuantityWeight, 492, Formula)
+}
+
+#endif //__RDF_LTD__IFC4_IfcQuantityWeight_H
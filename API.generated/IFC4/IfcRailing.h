@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRailing_H
+#define __RDF_LTD__IFC4_IfcRailing_H
+
+#include    "classes/IfcRailing.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1090, IfcRailing, 493, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRailing_H
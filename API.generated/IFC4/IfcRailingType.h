@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRailingType_H
+#define __RDF_LTD__IFC4_IfcRailingType_H
+
+#include    "classes/IfcRailingType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1091, IfcRailingType, 494, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRailingType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRamp_H
+#define __RDF_LTD__IFC4_IfcRamp_H
+
+#include    "classes/IfcRamp.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1092, IfcRamp, 495, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRamp_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRampFlight_H
+#define __RDF_LTD__IFC4_IfcRampFlight_H
+
+#include    "classes/IfcRampFlight.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1093, IfcRampFlight, 496, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRampFlight_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRampFlightType_H
+#define __RDF_LTD__IFC4_IfcRampFlightType_H
+
+#include    "classes/IfcRampFlightType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1094, IfcRampFlightType, 497, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRampFlightType_H
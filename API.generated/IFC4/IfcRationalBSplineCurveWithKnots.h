@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRationalBSplineCurveWithKnots_H
+#define __RDF_LTD__IFC4_IfcRationalBSplineCurveWithKnots_H
+
+#include    "classes/IfcRationalBSplineCurveWithKnots.h"
+#include    "IfcBSplineCurveWithKnots.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1096, IfcRationalBSplineCurveWithKnots, 499, WeightsData)
+    RDF_EXPRESS_ATTR_ACCESSOR(1097, IfcRationalBSplineCurveWithKnots, 499, Weights)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRationalBSplineCurveWithKnots_H
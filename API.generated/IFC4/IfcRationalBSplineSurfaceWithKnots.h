@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRationalBSplineSurfaceWithKnots_H
+#define __RDF_LTD__IFC4_IfcRationalBSplineSurfaceWithKnots_H
+
+#include    "classes/IfcRationalBSplineSurfaceWithKnots.h"
+#include    "IfcBSplineSurfaceWithKnots.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1098, IfcRationalBSplineSurfaceWithKnots, 500, WeightsData)
+    RDF_EXPRESS_ATTR_ACCESSOR(1099, IfcRationalBSplineSurfaceWithKnots, 500, Weights)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRationalBSplineSurfaceWithKnots_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRectangleHollowProfileDef_H
+#define __RDF_LTD__IFC4_IfcRectangleHollowProfileDef_H
+
+#include    "classes/IfcRectangleHollowProfileDef.h"
+#include    "IfcRectangleProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1102, IfcRectangleHollowProfileDef, 501, WallThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(1103, IfcRectangleHollowProfileDef, 501, InnerFilletRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(1104, IfcRectangleHollowProfileDef, 501, OuterFilletRadius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRectangleHollowProfileDef_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRectangleProfileDef_H
+#define __RDF_LTD__IFC4_IfcRectangleProfileDef_H
+
+#include    "classes/IfcRectangleProfileDef.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1100, IfcRectangleProfileDef, 502, XDim)
+    RDF_EXPRESS_ATTR_ACCESSOR(1101, IfcRectangleProfileDef, 502, YDim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRectangleProfileDef_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRectangularPyramid_H
+#define __RDF_LTD__IFC4_IfcRectangularPyramid_H
+
+#include    "classes/IfcRectangularPyramid.h"
+#include    "IfcCsgPrimitive3D.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1105, IfcRectangularPyramid, 503, XLength)
+    RDF_EXPRESS_ATTR_ACCESSOR(1106, IfcRectangularPyramid, 503, YLength)
+    RDF_EXPRESS_ATTR_ACCESSOR(1107, IfcRectangularPyramid, 503, Height)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRectangularPyramid_H
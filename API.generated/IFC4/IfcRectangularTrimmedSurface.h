@@ -0,0 +1,24 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRectangularTrimmedSurface_H
+#define __RDF_LTD__IFC4_IfcRectangularTrimmedSurface_H
+
+#include    "classes/IfcRectangularTrimmedSurface.h"
+#include    "IfcBoundedSurface.h"
+#include    "classes/IfcSurface.h"
+
+namespace IFC4
+{
+    inline IfcSurface IfcRectangularTrimmedSurface::get_BasisSurface() { RDF_EXPRESS_PROBE(1108); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1108), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRectangularTrimmedSurface::put_BasisSurface(IfcSurface inst) { RDF_EXPRESS_PROBE(1108); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1108), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1108, IfcRectangularTrimmedSurface, 504, BasisSurface)
+    RDF_EXPRESS_ATTR_ACCESSOR(1109, IfcRectangularTrimmedSurface, 504, U1)
+    RDF_EXPRESS_ATTR_ACCESSOR(1110, IfcRectangularTrimmedSurface, 504, V1)
+    RDF_EXPRESS_ATTR_ACCESSOR(1111, IfcRectangularTrimmedSurface, 504, U2)
+    RDF_EXPRESS_ATTR_ACCESSOR(1112, IfcRectangularTrimmedSurface, 504, V2)
+    RDF_EXPRESS_ATTR_ACCESSOR(1113, IfcRectangularTrimmedSurface, 504, Usense)
+    RDF_EXPRESS_ATTR_ACCESSOR(1114, IfcRectangularTrimmedSurface, 504, Vsense)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRectangularTrimmedSurface_H
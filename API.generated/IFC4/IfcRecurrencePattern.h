@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRecurrencePattern_H
+#define __RDF_LTD__IFC4_IfcRecurrencePattern_H
+
+#include    "classes/IfcRecurrencePattern.h"
+#include    "classes/IfcTimePeriod.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1115, IfcRecurrencePattern, 505, RecurrenceType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1116, IfcRecurrencePattern, 505, DayComponent)
+    RDF_EXPRESS_ATTR_ACCESSOR(1117, IfcRecurrencePattern, 505, WeekdayComponent)
+    RDF_EXPRESS_ATTR_ACCESSOR(1118, IfcRecurrencePattern, 505, MonthComponent)
+    RDF_EXPRESS_ATTR_ACCESSOR(1119, IfcRecurrencePattern, 505, Position)
+    RDF_EXPRESS_ATTR_ACCESSOR(1120, IfcRecurrencePattern, 505, Interval)
+    RDF_EXPRESS_ATTR_ACCESSOR(1121, IfcRecurrencePattern, 505, Occurrences)
+    RDF_EXPRESS_ATTR_ACCESSOR(1122, IfcRecurrencePattern, 505, TimePeriods)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRecurrencePattern_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReference_H
+#define __RDF_LTD__IFC4_IfcReference_H
+
+#include    "classes/IfcReference.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1123, IfcReference, 506, TypeIdentifier)
+    RDF_EXPRESS_ATTR_ACCESSOR(1124, IfcReference, 506, AttributeIdentifier)
+    RDF_EXPRESS_ATTR_ACCESSOR(1125, IfcReference, 506, InstanceName)
+    RDF_EXPRESS_ATTR_ACCESSOR(1126, IfcReference, 506, ListPositions)
+    inline IfcReference IfcReference::get_InnerReference() { RDF_EXPRESS_PROBE(1127); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1127), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcReference::put_InnerReference(IfcReference inst) { RDF_EXPRESS_PROBE(1127); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1127), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1127, IfcReference, 506, InnerReference)
+}
+
+#endif //__RDF_LTD__IFC4_IfcReference_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRegularTimeSeries_H
+#define __RDF_LTD__IFC4_IfcRegularTimeSeries_H
+
+#include    "classes/IfcRegularTimeSeries.h"
+#include    "IfcTimeSeries.h"
+#include    "classes/IfcTimeSeriesValue.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1128, IfcRegularTimeSeries, 507, TimeStep)
+    RDF_EXPRESS_ATTR_ACCESSOR(1129, IfcRegularTimeSeries, 507, Values)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRegularTimeSeries_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcementBarProperties_H
+#define __RDF_LTD__IFC4_IfcReinforcementBarProperties_H
+
+#include    "classes/IfcReinforcementBarProperties.h"
+#include    "IfcPreDefinedProperties.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1130, IfcReinforcementBarProperties, 508, TotalCrossSectionArea)
+    RDF_EXPRESS_ATTR_ACCESSOR(1131, IfcReinforcementBarProperties, 508, SteelGrade)
+    RDF_EXPRESS_ATTR_ACCESSOR(1132, IfcReinforcementBarProperties, 508, BarSurface)
+    RDF_EXPRESS_ATTR_ACCESSOR(1133, IfcReinforcementBarProperties, 508, EffectiveDepth)
+    RDF_EXPRESS_ATTR_ACCESSOR(1134, IfcReinforcementBarProperties, 508, NominalBarDiameter)
+    RDF_EXPRESS_ATTR_ACCESSOR(1135, IfcReinforcementBarProperties, 508, BarCount)
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcementBarProperties_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcementDefinitionProperties_H
+#define __RDF_LTD__IFC4_IfcReinforcementDefinitionProperties_H
+
+#include    "classes/IfcReinforcementDefinitionProperties.h"
+#include    "IfcPreDefinedPropertySet.h"
+#include    "classes/IfcSectionReinforcementProperties.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1136, IfcReinforcementDefinitionProperties, 509, DefinitionType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1137, IfcReinforcementDefinitionProperties, 509, ReinforcementSectionDefinitions)
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcementDefinitionProperties_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcingBar_H
+#define __RDF_LTD__IFC4_IfcReinforcingBar_H
+
+#include    "classes/IfcReinforcingBar.h"
+#include    "IfcReinforcingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1139, IfcReinforcingBar, 510, NominalDiameter)
+    RDF_EXPRESS_ATTR_ACCESSOR(1140, IfcReinforcingBar, 510, CrossSectionArea)
+    RDF_EXPRESS_ATTR_ACCESSOR(1141, IfcReinforcingBar, 510, BarLength)
+    RDF_EXPRESS_ATTR_ACCESSOR(1142, IfcReinforcingBar, 510, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1143, IfcReinforcingBar, 510, BarSurface)
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcingBar_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcingBarType_H
+#define __RDF_LTD__IFC4_IfcReinforcingBarType_H
+
+#include    "classes/IfcReinforcingBarType.h"
+#include    "IfcReinforcingElementType.h"
+#include    "selects/IfcBendingParameterSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1144, IfcReinforcingBarType, 511, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1145, IfcReinforcingBarType, 511, NominalDiameter)
+    RDF_EXPRESS_ATTR_ACCESSOR(1146, IfcReinforcingBarType, 511, CrossSectionArea)
+    RDF_EXPRESS_ATTR_ACCESSOR(1147, IfcReinforcingBarType, 511, BarLength)
+    RDF_EXPRESS_ATTR_ACCESSOR(1148, IfcReinforcingBarType, 511, BarSurface)
+    RDF_EXPRESS_ATTR_ACCESSOR(1149, IfcReinforcingBarType, 511, BendingShapeCode)
+    RDF_EXPRESS_ATTR_ACCESSOR(1150, IfcReinforcingBarType, 511, BendingParameters)
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcingBarType_H
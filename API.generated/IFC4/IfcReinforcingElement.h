@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcingElement_H
+#define __RDF_LTD__IFC4_IfcReinforcingElement_H
+
+#include    "classes/IfcReinforcingElement.h"
+#include    "IfcElementComponent.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1138, IfcReinforcingElement, 512, SteelGrade)
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcingElement_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcingElementType_H
+#define __RDF_LTD__IFC4_IfcReinforcingElementType_H
+
+#include    "classes/IfcReinforcingElementType.h"
+#include    "IfcElementComponentType.h"
+
+#endif //__RDF_LTD__IFC4_IfcReinforcingElementType_H
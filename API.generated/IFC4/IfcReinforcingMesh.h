@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcingMesh_H
+#define __RDF_LTD__IFC4_IfcReinforcingMesh_H
+
+#include    "classes/IfcReinforcingMesh.h"
+#include    "IfcReinforcingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1151, IfcReinforcingMesh, 514, MeshLength)
+    RDF_EXPRESS_ATTR_ACCESSOR(1152, IfcReinforcingMesh, 514, MeshWidth)
+    RDF_EXPRESS_ATTR_ACCESSOR(1153, IfcReinforcingMesh, 514, LongitudinalBarNominalDiameter)
+    RDF_EXPRESS_ATTR_ACCESSOR(1154, IfcReinforcingMesh, 514, TransverseBarNominalDiameter)
+    RDF_EXPRESS_ATTR_ACCESSOR(1155, IfcReinforcingMesh, 514, LongitudinalBarCrossSectionArea)
+    RDF_EXPRESS_ATTR_ACCESSOR(1156, IfcReinforcingMesh, 514, TransverseBarCrossSectionArea)
+    RDF_EXPRESS_ATTR_ACCESSOR(1157, IfcReinforcingMesh, 514, LongitudinalBarSpacing)
+    RDF_EXPRESS_ATTR_ACCESSOR(1158, IfcReinforcingMesh, 514, TransverseBarSpacing)
+    RDF_EXPRESS_ATTR_ACCESSOR(1159, IfcReinforcingMesh, 514, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcingMesh_H
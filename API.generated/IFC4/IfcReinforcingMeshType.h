@@ -0,0 +1,26 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcingMeshType_H
+#define __RDF_LTD__IFC4_IfcReinforcingMeshType_H
+
+#include    "classes/IfcReinforcingMeshType.h"
+#include    "IfcReinforcingElementType.h"
+#include    "selects/IfcBendingParameterSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1160, IfcReinforcingMeshType, 515, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1161, IfcReinforcingMeshType, 515, MeshLength)
+    RDF_EXPRESS_ATTR_ACCESSOR(1162, IfcReinforcingMeshType, 515, MeshWidth)
+    RDF_EXPRESS_ATTR_ACCESSOR(1163, IfcReinforcingMeshType, 515, LongitudinalBarNominalDiameter)
+    RDF_EXPRESS_ATTR_ACCESSOR(1164, IfcReinforcingMeshType, 515, TransverseBarNominalDiameter)
+    RDF_EXPRESS_ATTR_ACCESSOR(1165, IfcReinforcingMeshType, 515, LongitudinalBarCrossSectionArea)
+    RDF_EXPRESS_ATTR_ACCESSOR(1166, IfcReinforcingMeshType, 515, TransverseBarCrossSectionArea)
+    RDF_EXPRESS_ATTR_ACCESSOR(1167, IfcReinforcingMeshType, 515, LongitudinalBarSpacing)
+    RDF_EXPRESS_ATTR_ACCESSOR(1168, IfcReinforcingMeshType, 515, TransverseBarSpacing)
+    RDF_EXPRESS_ATTR_ACCESSOR(1169, IfcReinforcingMeshType, 515, BendingShapeCode)
+    RDF_EXPRESS_ATTR_ACCESSOR(1170, IfcReinforcingMeshType, 515, BendingParameters)
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcingMeshType_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAggregates_H
+#define __RDF_LTD__IFC4_IfcRelAggregates_H
+
+#include    "classes/IfcRelAggregates.h"
+#include    "IfcRelDecomposes.h"
+#include    "classes/IfcObjectDefinition.h"
+
+namespace IFC4
+{
+    inline IfcObjectDefinition IfcRelAggregates::get_RelatingObject() { RDF_EXPRESS_PROBE(1171); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1171), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelAggregates::put_RelatingObject(IfcObjectDefinition inst) { RDF_EXPRESS_PROBE(1171); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1171), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1171, IfcRelAggregates, 516, RelatingObject)
+    RDF_EXPRESS_ATTR_ACCESSOR(1172, IfcRelAggregates, 516, RelatedObjects)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAggregates_H
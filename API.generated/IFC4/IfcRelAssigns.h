@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssigns_H
+#define __RDF_LTD__IFC4_IfcRelAssigns_H
+
+#include    "classes/IfcRelAssigns.h"
+#include    "IfcRelationship.h"
+#include    "classes/IfcObjectDefinition.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1173, IfcRelAssigns, 517, RelatedObjects)
+    RDF_EXPRESS_ATTR_ACCESSOR(1174, IfcRelAssigns, 517, RelatedObjectsType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssigns_H
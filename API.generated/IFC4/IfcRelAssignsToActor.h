@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToActor_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToActor_H
+
+#include    "classes/IfcRelAssignsToActor.h"
+#include    "IfcRelAssigns.h"
+#include    "classes/IfcActor.h"
+#include    "classes/IfcActorRole.h"
+
+namespace IFC4
+{
+    inline IfcActor IfcRelAssignsToActor::get_RelatingActor() { RDF_EXPRESS_PROBE(1175); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1175), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelAssignsToActor::put_RelatingActor(IfcActor inst) { RDF_EXPRESS_PROBE(1175); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1175), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1175, IfcRelAssignsToActor, 518, RelatingActor)
+    inline IfcActorRole IfcRelAssignsToActor::get_ActingRole() { RDF_EXPRESS_PROBE(1176); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1176), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelAssignsToActor::put_ActingRole(IfcActorRole inst) { RDF_EXPRESS_PROBE(1176); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1176), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1176, IfcRelAssignsToActor, 518, ActingRole)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToActor_H
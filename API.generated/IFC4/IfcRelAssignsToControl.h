@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToControl_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToControl_H
+
+#include    "classes/IfcRelAssignsToControl.h"
+#include    "IfcRelAssigns.h"
+#include    "classes/IfcControl.h"
+
+namespace IFC4
+{
+    inline IfcControl IfcRelAssignsToControl::get_RelatingControl() { RDF_EXPRESS_PROBE(1177); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1177), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelAssignsToControl::put_RelatingControl(IfcControl inst) { RDF_EXPRESS_PROBE(1177); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1177), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1177, IfcRelAssignsToControl, 519, RelatingControl)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToControl_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToGroup_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToGroup_H
+
+#include    "classes/IfcRelAssignsToGroup.h"
+#include    "IfcRelAssigns.h"
+#include    "classes/IfcGroup.h"
+
+namespace IFC4
+{
+    inline IfcGroup IfcRelAssignsToGroup::get_RelatingGroup() { RDF_EXPRESS_PROBE(1178); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1178), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelAssignsToGroup::put_RelatingGroup(IfcGroup inst) { RDF_EXPRESS_PROBE(1178); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1178), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1178, IfcRelAssignsToGroup, 520, RelatingGroup)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToGroup_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToGroupByFactor_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToGroupByFactor_H
+
+#include    "classes/IfcRelAssignsToGroupByFactor.h"
+#include    "IfcRelAssignsToGroup.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1179, IfcRelAssignsToGroupByFactor, 521, Factor)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToGroupByFactor_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToProcess_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToProcess_H
+
+#include    "classes/IfcRelAssignsToProcess.h"
+#include    "IfcRelAssigns.h"
+#include    "classes/IfcMeasureWithUnit.h"
+#include    "selects/IfcProcessSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1180, IfcRelAssignsToProcess, 522, RelatingProcess)
+    inline IfcMeasureWithUnit IfcRelAssignsToProcess::get_QuantityInProcess() { RDF_EXPRESS_PROBE(1181); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1181), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelAssignsToProcess::put_QuantityInProcess(IfcMeasureWithUnit inst) { RDF_EXPRESS_PROBE(1181); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1181), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1181, IfcRelAssignsToProcess, 522, QuantityInProcess)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToProcess_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToProduct_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToProduct_H
+
+#include    "classes/IfcRelAssignsToProduct.h"
+#include    "IfcRelAssigns.h"
+#include    "selects/IfcProductSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1182, IfcRelAssignsToProduct, 523, RelatingProduct)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToProduct_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToResource_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToResource_H
+
+#include    "classes/IfcRelAssignsToResource.h"
+#include    "IfcRelAssigns.h"
+#include    "selects/IfcResourceSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1183, IfcRelAssignsToResource, 524, RelatingResource)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToResource_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociates_H
+#define __RDF_LTD__IFC4_IfcRelAssociates_H
+
+#include    "classes/IfcRelAssociates.h"
+#include    "IfcRelationship.h"
+#include    "selects/IfcDefinitionSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1184, IfcRelAssociates, 525, RelatedObjects)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociates_H
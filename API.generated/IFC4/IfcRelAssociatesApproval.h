@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociatesApproval_H
+#define __RDF_LTD__IFC4_IfcRelAssociatesApproval_H
+
+#include    "classes/IfcRelAssociatesApproval.h"
+#include    "IfcRelAssociates.h"
+#include    "classes/IfcApproval.h"
+
+namespace IFC4
+{
+    inline IfcApproval IfcRelAssociatesApproval::get_RelatingApproval() { RDF_EXPRESS_PROBE(1185); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1185), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelAssociatesApproval::put_RelatingApproval(IfcApproval inst) { RDF_EXPRESS_PROBE(1185); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1185), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1185, IfcRelAssociatesApproval, 526, RelatingApproval)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociatesApproval_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociatesClassification_H
+#define __RDF_LTD__IFC4_IfcRelAssociatesClassification_H
+
+#include    "classes/IfcRelAssociatesClassification.h"
+#include    "IfcRelAssociates.h"
+#include    "selects/IfcClassificationSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1186, IfcRelAssociatesClassification, 527, RelatingClassification)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociatesClassification_H
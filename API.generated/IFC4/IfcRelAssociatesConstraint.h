@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociatesConstraint_H
+#define __RDF_LTD__IFC4_IfcRelAssociatesConstraint_H
+
+#include    "classes/IfcRelAssociatesConstraint.h"
+#include    "IfcRelAssociates.h"
+#include    "classes/IfcConstraint.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1187, IfcRelAssociatesConstraint, 528, Intent)
+    inline IfcConstraint IfcRelAssociatesConstraint::get_RelatingConstraint() { RDF_EXPRESS_PROBE(1188); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1188), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelAssociatesConstraint::put_RelatingConstraint(IfcConstraint inst) { RDF_EXPRESS_PROBE(1188); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1188), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1188, IfcRelAssociatesConstraint, 528, RelatingConstraint)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociatesConstraint_H
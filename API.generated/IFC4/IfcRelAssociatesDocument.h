@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociatesDocument_H
+#define __RDF_LTD__IFC4_IfcRelAssociatesDocument_H
+
+#include    "classes/IfcRelAssociatesDocument.h"
+#include    "IfcRelAssociates.h"
+#include    "selects/IfcDocumentSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1189, IfcRelAssociatesDocument, 529, RelatingDocument)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociatesDocument_H
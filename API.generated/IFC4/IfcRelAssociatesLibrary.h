@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociatesLibrary_H
+#define __RDF_LTD__IFC4_IfcRelAssociatesLibrary_H
+
+#include    "classes/IfcRelAssociatesLibrary.h"
+#include    "IfcRelAssociates.h"
+#include    "selects/IfcLibrarySelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1190, IfcRelAssociatesLibrary, 530, RelatingLibrary)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociatesLibrary_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociatesMaterial_H
+#define __RDF_LTD__IFC4_IfcRelAssociatesMaterial_H
+
+#include    "classes/IfcRelAssociatesMaterial.h"
+#include    "IfcRelAssociates.h"
+#include    "selects/IfcMaterialSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1191, IfcRelAssociatesMaterial, 531, RelatingMaterial)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociatesMaterial_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnects_H
+#define __RDF_LTD__IFC4_IfcRelConnects_H
+
+#include    "classes/IfcRelConnects.h"
+#include    "IfcRelationship.h"
+
+#endif //__RDF_LTD__IFC4_IfcRelConnects_H
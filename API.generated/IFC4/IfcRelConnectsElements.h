@@ -0,0 +1,25 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsElements_H
+#define __RDF_LTD__IFC4_IfcRelConnectsElements_H
+
+#include    "classes/IfcRelConnectsElements.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcConnectionGeometry.h"
+#include    "classes/IfcElement.h"
+
+namespace IFC4
+{
+    inline IfcConnectionGeometry IfcRelConnectsElements::get_ConnectionGeometry() { RDF_EXPRESS_PROBE(1192); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1192), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsElements::put_ConnectionGeometry(IfcConnectionGeometry inst) { RDF_EXPRESS_PROBE(1192); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1192), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1192, IfcRelConnectsElements, 534, ConnectionGeometry)
+    inline IfcElement IfcRelConnectsElements::get_RelatingElement() { RDF_EXPRESS_PROBE(1193); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1193), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsElements::put_RelatingElement(IfcElement inst) { RDF_EXPRESS_PROBE(1193); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1193), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1193, IfcRelConnectsElements, 534, RelatingElement)
+    inline IfcElement IfcRelConnectsElements::get_RelatedElement() { RDF_EXPRESS_PROBE(1194); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1194), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsElements::put_RelatedElement(IfcElement inst) { RDF_EXPRESS_PROBE(1194); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1194), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1194, IfcRelConnectsElements, 534, RelatedElement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsElements_H
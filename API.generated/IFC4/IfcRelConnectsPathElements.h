@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsPathElements_H
+#define __RDF_LTD__IFC4_IfcRelConnectsPathElements_H
+
+#include    "classes/IfcRelConnectsPathElements.h"
+#include    "IfcRelConnectsElements.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1195, IfcRelConnectsPathElements, 535, RelatingPriorities)
+    RDF_EXPRESS_ATTR_ACCESSOR(1196, IfcRelConnectsPathElements, 535, RelatedPriorities)
+    RDF_EXPRESS_ATTR_ACCESSOR(1197, IfcRelConnectsPathElements, 535, RelatedConnectionType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1198, IfcRelConnectsPathElements, 535, RelatingConnectionType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsPathElements_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsPortToElement_H
+#define __RDF_LTD__IFC4_IfcRelConnectsPortToElement_H
+
+#include    "classes/IfcRelConnectsPortToElement.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcDistributionElement.h"
+#include    "classes/IfcPort.h"
+
+namespace IFC4
+{
+    inline IfcPort IfcRelConnectsPortToElement::get_RelatingPort() { RDF_EXPRESS_PROBE(1202); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1202), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsPortToElement::put_RelatingPort(IfcPort inst) { RDF_EXPRESS_PROBE(1202); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1202), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1202, IfcRelConnectsPortToElement, 537, RelatingPort)
+    inline IfcDistributionElement IfcRelConnectsPortToElement::get_RelatedElement() { RDF_EXPRESS_PROBE(1203); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1203), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsPortToElement::put_RelatedElement(IfcDistributionElement inst) { RDF_EXPRESS_PROBE(1203); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1203), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1203, IfcRelConnectsPortToElement, 537, RelatedElement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsPortToElement_H
@@ -0,0 +1,25 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsPorts_H
+#define __RDF_LTD__IFC4_IfcRelConnectsPorts_H
+
+#include    "classes/IfcRelConnectsPorts.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcElement.h"
+#include    "classes/IfcPort.h"
+
+namespace IFC4
+{
+    inline IfcPort IfcRelConnectsPorts::get_RelatingPort() { RDF_EXPRESS_PROBE(1199); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1199), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsPorts::put_RelatingPort(IfcPort inst) { RDF_EXPRESS_PROBE(1199); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1199), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1199, IfcRelConnectsPorts, 536, RelatingPort)
+    inline IfcPort IfcRelConnectsPorts::get_RelatedPort() { RDF_EXPRESS_PROBE(1200); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1200), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsPorts::put_RelatedPort(IfcPort inst) { RDF_EXPRESS_PROBE(1200); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1200), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1200, IfcRelConnectsPorts, 536, RelatedPort)
+    inline IfcElement IfcRelConnectsPorts::get_RealizingElement() { RDF_EXPRESS_PROBE(1201); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1201), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsPorts::put_RealizingElement(IfcElement inst) { RDF_EXPRESS_PROBE(1201); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1201), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1201, IfcRelConnectsPorts, 536, RealizingElement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsPorts_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsStructuralActivity_H
+#define __RDF_LTD__IFC4_IfcRelConnectsStructuralActivity_H
+
+#include    "classes/IfcRelConnectsStructuralActivity.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcStructuralActivity.h"
+#include    "selects/IfcStructuralActivityAssignmentSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1204, IfcRelConnectsStructuralActivity, 538, RelatingElement)
+    inline IfcStructuralActivity IfcRelConnectsStructuralActivity::get_RelatedStructuralActivity() { RDF_EXPRESS_PROBE(1205); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1205), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsStructuralActivity::put_RelatedStructuralActivity(IfcStructuralActivity inst) { RDF_EXPRESS_PROBE(1205); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1205), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1205, IfcRelConnectsStructuralActivity, 538, RelatedStructuralActivity)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsStructuralActivity_H
@@ -0,0 +1,35 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsStructuralMember_H
+#define __RDF_LTD__IFC4_IfcRelConnectsStructuralMember_H
+
+#include    "classes/IfcRelConnectsStructuralMember.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcAxis2Placement3D.h"
+#include    "classes/IfcBoundaryCondition.h"
+#include    "classes/IfcStructuralConnection.h"
+#include    "classes/IfcStructuralConnectionCondition.h"
+#include    "classes/IfcStructuralMember.h"
+
+namespace IFC4
+{
+    inline IfcStructuralMember IfcRelConnectsStructuralMember::get_RelatingStructuralMember() { RDF_EXPRESS_PROBE(1206); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1206), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsStructuralMember::put_RelatingStructuralMember(IfcStructuralMember inst) { RDF_EXPRESS_PROBE(1206); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1206), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1206, IfcRelConnectsStructuralMember, 539, RelatingStructuralMember)
+    inline IfcStructuralConnection IfcRelConnectsStructuralMember::get_RelatedStructuralConnection() { RDF_EXPRESS_PROBE(1207); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1207), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsStructuralMember::put_RelatedStructuralConnection(IfcStructuralConnection inst) { RDF_EXPRESS_PROBE(1207); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1207), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1207, IfcRelConnectsStructuralMember, 539, RelatedStructuralConnection)
+    inline IfcBoundaryCondition IfcRelConnectsStructuralMember::get_AppliedCondition() { RDF_EXPRESS_PROBE(1208); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1208), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsStructuralMember::put_AppliedCondition(IfcBoundaryCondition inst) { RDF_EXPRESS_PROBE(1208); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1208), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1208, IfcRelConnectsStructuralMember, 539, AppliedCondition)
+    inline IfcStructuralConnectionCondition IfcRelConnectsStructuralMember::get_AdditionalConditions() { RDF_EXPRESS_PROBE(1209); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1209), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsStructuralMember::put_AdditionalConditions(IfcStructuralConnectionCondition inst) { RDF_EXPRESS_PROBE(1209); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1209), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1209, IfcRelConnectsStructuralMember, 539, AdditionalConditions)
+    RDF_EXPRESS_ATTR_ACCESSOR(1210, IfcRelConnectsStructuralMember, 539, SupportedLength)
+    inline IfcAxis2Placement3D IfcRelConnectsStructuralMember::get_ConditionCoordinateSystem() { RDF_EXPRESS_PROBE(1211); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1211), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsStructuralMember::put_ConditionCoordinateSystem(IfcAxis2Placement3D inst) { RDF_EXPRESS_PROBE(1211); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1211), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1211, IfcRelConnectsStructuralMember, 539, ConditionCoordinateSystem)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsStructuralMember_H
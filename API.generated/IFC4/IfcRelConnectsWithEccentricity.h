@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsWithEccentricity_H
+#define __RDF_LTD__IFC4_IfcRelConnectsWithEccentricity_H
+
+#include    "classes/IfcRelConnectsWithEccentricity.h"
+#include    "IfcRelConnectsStructuralMember.h"
+#include    "classes/IfcConnectionGeometry.h"
+
+namespace IFC4
+{
+    inline IfcConnectionGeometry IfcRelConnectsWithEccentricity::get_ConnectionConstraint() { RDF_EXPRESS_PROBE(1212); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1212), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelConnectsWithEccentricity::put_ConnectionConstraint(IfcConnectionGeometry inst) { RDF_EXPRESS_PROBE(1212); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1212), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1212, IfcRelConnectsWithEccentricity, 540, ConnectionConstraint)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsWithEccentricity_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsWithRealizingElements_H
+#define __RDF_LTD__IFC4_IfcRelConnectsWithRealizingElements_H
+
+#include    "classes/IfcRelConnectsWithRealizingElements.h"
+#include    "IfcRelConnectsElements.h"
+#include    "classes/IfcElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1213, IfcRelConnectsWithRealizingElements, 541, RealizingElements)
+    RDF_EXPRESS_ATTR_ACCESSOR(1214, IfcRelConnectsWithRealizingElements, 541, ConnectionType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsWithRealizingElements_H
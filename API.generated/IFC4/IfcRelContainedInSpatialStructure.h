@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelContainedInSpatialStructure_H
+#define __RDF_LTD__IFC4_IfcRelContainedInSpatialStructure_H
+
+#include    "classes/IfcRelContainedInSpatialStructure.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcProduct.h"
+#include    "classes/IfcSpatialElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1215, IfcRelContainedInSpatialStructure, 542, RelatedElements)
+    inline IfcSpatialElement IfcRelContainedInSpatialStructure::get_RelatingStructure() { RDF_EXPRESS_PROBE(1216); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1216), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelContainedInSpatialStructure::put_RelatingStructure(IfcSpatialElement inst) { RDF_EXPRESS_PROBE(1216); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1216), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1216, IfcRelContainedInSpatialStructure, 542, RelatingStructure)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelContainedInSpatialStructure_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelCoversBldgElements_H
+#define __RDF_LTD__IFC4_IfcRelCoversBldgElements_H
+
+#include    "classes/IfcRelCoversBldgElements.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcCovering.h"
+#include    "classes/IfcElement.h"
+
+namespace IFC4
+{
+    inline IfcElement IfcRelCoversBldgElements::get_RelatingBuildingElement() { RDF_EXPRESS_PROBE(1217); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1217), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelCoversBldgElements::put_RelatingBuildingElement(IfcElement inst) { RDF_EXPRESS_PROBE(1217); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1217), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1217, IfcRelCoversBldgElements, 543, RelatingBuildingElement)
+    RDF_EXPRESS_ATTR_ACCESSOR(1218, IfcRelCoversBldgElements, 543, RelatedCoverings)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelCoversBldgElements_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelCoversSpaces_H
+#define __RDF_LTD__IFC4_IfcRelCoversSpaces_H
+
+#include    "classes/IfcRelCoversSpaces.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcCovering.h"
+#include    "classes/IfcSpace.h"
+
+namespace IFC4
+{
+    inline IfcSpace IfcRelCoversSpaces::get_RelatingSpace() { RDF_EXPRESS_PROBE(1219); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1219), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelCoversSpaces::put_RelatingSpace(IfcSpace inst) { RDF_EXPRESS_PROBE(1219); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1219), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1219, IfcRelCoversSpaces, 544, RelatingSpace)
+    RDF_EXPRESS_ATTR_ACCESSOR(1220, IfcRelCoversSpaces, 544, RelatedCoverings)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelCoversSpaces_H
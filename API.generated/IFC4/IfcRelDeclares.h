@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelDeclares_H
+#define __RDF_LTD__IFC4_IfcRelDeclares_H
+
+#include    "classes/IfcRelDeclares.h"
+#include    "IfcRelationship.h"
+#include    "classes/IfcContext.h"
+#include    "selects/IfcDefinitionSelect.h"
+
+namespace IFC4
+{
+    inline IfcContext IfcRelDeclares::get_RelatingContext() { RDF_EXPRESS_PROBE(1221); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1221), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelDeclares::put_RelatingContext(IfcContext inst) { RDF_EXPRESS_PROBE(1221); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1221), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1221, IfcRelDeclares, 545, RelatingContext)
+    RDF_EXPRESS_ATTR_ACCESSOR(1222, IfcRelDeclares, 545, RelatedDefinitions)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelDeclares_H
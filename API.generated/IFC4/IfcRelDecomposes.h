@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelDecomposes_H
+#define __RDF_LTD__IFC4_IfcRelDecomposes_H
+
+#include    "classes/IfcRelDecomposes.h"
+#include    "IfcRelationship.h"
+
+#endif //__RDF_LTD__IFC4_IfcRelDecomposes_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelDefines_H
+#define __RDF_LTD__IFC4_IfcRelDefines_H
+
+#include    "classes/IfcRelDefines.h"
+#include    "IfcRelationship.h"
+
+#endif //__RDF_LTD__IFC4_IfcRelDefines_H
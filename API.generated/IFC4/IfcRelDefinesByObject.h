@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelDefinesByObject_H
+#define __RDF_LTD__IFC4_IfcRelDefinesByObject_H
+
+#include    "classes/IfcRelDefinesByObject.h"
+#include    "IfcRelDefines.h"
+#include    "classes/IfcObject.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1223, IfcRelDefinesByObject, 548, RelatedObjects)
+    inline IfcObject IfcRelDefinesByObject::get_RelatingObject() { RDF_EXPRESS_PROBE(1224); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1224), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelDefinesByObject::put_RelatingObject(IfcObject inst) { RDF_EXPRESS_PROBE(1224); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1224), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1224, IfcRelDefinesByObject, 548, RelatingObject)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelDefinesByObject_H
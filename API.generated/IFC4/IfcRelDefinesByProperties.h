@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelDefinesByProperties_H
+#define __RDF_LTD__IFC4_IfcRelDefinesByProperties_H
+
+#include    "classes/IfcRelDefinesByProperties.h"
+#include    "IfcRelDefines.h"
+#include    "classes/IfcObjectDefinition.h"
+#include    "selects/IfcPropertySetDefinitionSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1225, IfcRelDefinesByProperties, 549, RelatedObjects)
+    RDF_EXPRESS_ATTR_ACCESSOR(1226, IfcRelDefinesByProperties, 549, RelatingPropertyDefinition)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelDefinesByProperties_H
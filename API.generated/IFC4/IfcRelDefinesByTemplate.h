@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelDefinesByTemplate_H
+#define __RDF_LTD__IFC4_IfcRelDefinesByTemplate_H
+
+#include    "classes/IfcRelDefinesByTemplate.h"
+#include    "IfcRelDefines.h"
+#include    "classes/IfcPropertySetDefinition.h"
+#include    "classes/IfcPropertySetTemplate.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1227, IfcRelDefinesByTemplate, 550, RelatedPropertySets)
+    inline IfcPropertySetTemplate IfcRelDefinesByTemplate::get_RelatingTemplate() { RDF_EXPRESS_PROBE(1228); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1228), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelDefinesByTemplate::put_RelatingTemplate(IfcPropertySetTemplate inst) { RDF_EXPRESS_PROBE(1228); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1228), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1228, IfcRelDefinesByTemplate, 550, RelatingTemplate)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelDefinesByTemplate_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelDefinesByType_H
+#define __RDF_LTD__IFC4_IfcRelDefinesByType_H
+
+#include    "classes/IfcRelDefinesByType.h"
+#include    "IfcRelDefines.h"
+#include    "classes/IfcObject.h"
+#include    "classes/IfcTypeObject.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1229, IfcRelDefinesByType, 551, RelatedObjects)
+    inline IfcTypeObject IfcRelDefinesByType::get_RelatingType() { RDF_EXPRESS_PROBE(1230); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1230), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelDefinesByType::put_RelatingType(IfcTypeObject inst) { RDF_EXPRESS_PROBE(1230); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1230), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1230, IfcRelDefinesByType, 551, RelatingType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelDefinesByType_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelFillsElement_H
+#define __RDF_LTD__IFC4_IfcRelFillsElement_H
+
+#include    "classes/IfcRelFillsElement.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcElement.h"
+#include    "classes/IfcOpeningElement.h"
+
+namespace IFC4
+{
+    inline IfcOpeningElement IfcRelFillsElement::get_RelatingOpeningElement() { RDF_EXPRESS_PROBE(1231); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1231), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelFillsElement::put_RelatingOpeningElement(IfcOpeningElement inst) { RDF_EXPRESS_PROBE(1231); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1231), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1231, IfcRelFillsElement, 552, RelatingOpeningElement)
+    inline IfcElement IfcRelFillsElement::get_RelatedBuildingElement() { RDF_EXPRESS_PROBE(1232); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1232), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelFillsElement::put_RelatedBuildingElement(IfcElement inst) { RDF_EXPRESS_PROBE(1232); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1232), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1232, IfcRelFillsElement, 552, RelatedBuildingElement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelFillsElement_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelFlowControlElements_H
+#define __RDF_LTD__IFC4_IfcRelFlowControlElements_H
+
+#include    "classes/IfcRelFlowControlElements.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcDistributionControlElement.h"
+#include    "classes/IfcDistributionFlowElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1233, IfcRelFlowControlElements, 553, RelatedControlElements)
+    inline IfcDistributionFlowElement IfcRelFlowControlElements::get_RelatingFlowElement() { RDF_EXPRESS_PROBE(1234); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1234), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelFlowControlElements::put_RelatingFlowElement(IfcDistributionFlowElement inst) { RDF_EXPRESS_PROBE(1234); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1234), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1234, IfcRelFlowControlElements, 553, RelatingFlowElement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelFlowControlElements_H
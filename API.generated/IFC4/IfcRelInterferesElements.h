@@ -0,0 +1,27 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelInterferesElements_H
+#define __RDF_LTD__IFC4_IfcRelInterferesElements_H
+
+#include    "classes/IfcRelInterferesElements.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcConnectionGeometry.h"
+#include    "classes/IfcElement.h"
+
+namespace IFC4
+{
+    inline IfcElement IfcRelInterferesElements::get_RelatingElement() { RDF_EXPRESS_PROBE(1235); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1235), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelInterferesElements::put_RelatingElement(IfcElement inst) { RDF_EXPRESS_PROBE(1235); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1235), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1235, IfcRelInterferesElements, 554, RelatingElement)
+    inline IfcElement IfcRelInterferesElements::get_RelatedElement() { RDF_EXPRESS_PROBE(1236); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1236), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelInterferesElements::put_RelatedElement(IfcElement inst) { RDF_EXPRESS_PROBE(1236); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1236), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1236, IfcRelInterferesElements, 554, RelatedElement)
+    inline IfcConnectionGeometry IfcRelInterferesElements::get_InterferenceGeometry() { RDF_EXPRESS_PROBE(1237); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1237), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelInterferesElements::put_InterferenceGeometry(IfcConnectionGeometry inst) { RDF_EXPRESS_PROBE(1237); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1237), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1237, IfcRelInterferesElements, 554, InterferenceGeometry)
+    RDF_EXPRESS_ATTR_ACCESSOR(1238, IfcRelInterferesElements, 554, InterferenceType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1239, IfcRelInterferesElements, 554, ImpliedOrder)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelInterferesElements_H
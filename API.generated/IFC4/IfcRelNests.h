@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelNests_H
+#define __RDF_LTD__IFC4_IfcRelNests_H
+
+#include    "classes/IfcRelNests.h"
+#include    "IfcRelDecomposes.h"
+#include    "classes/IfcObjectDefinition.h"
+
+namespace IFC4
+{
+    inline IfcObjectDefinition IfcRelNests::get_RelatingObject() { RDF_EXPRESS_PROBE(1240); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1240), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelNests::put_RelatingObject(IfcObjectDefinition inst) { RDF_EXPRESS_PROBE(1240); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1240), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1240, IfcRelNests, 555, RelatingObject)
+    RDF_EXPRESS_ATTR_ACCESSOR(1241, IfcRelNests, 555, RelatedObjects)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelNests_H
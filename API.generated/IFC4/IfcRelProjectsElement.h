@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelProjectsElement_H
+#define __RDF_LTD__IFC4_IfcRelProjectsElement_H
+
+#include    "classes/IfcRelProjectsElement.h"
+#include    "IfcRelDecomposes.h"
+#include    "classes/IfcElement.h"
+#include    "classes/IfcFeatureElementAddition.h"
+
+namespace IFC4
+{
+    inline IfcElement IfcRelProjectsElement::get_RelatingElement() { RDF_EXPRESS_PROBE(1242); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1242), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelProjectsElement::put_RelatingElement(IfcElement inst) { RDF_EXPRESS_PROBE(1242); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1242), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1242, IfcRelProjectsElement, 556, RelatingElement)
+    inline IfcFeatureElementAddition IfcRelProjectsElement::get_RelatedFeatureElement() { RDF_EXPRESS_PROBE(1243); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1243), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelProjectsElement::put_RelatedFeatureElement(IfcFeatureElementAddition inst) { RDF_EXPRESS_PROBE(1243); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1243), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1243, IfcRelProjectsElement, 556, RelatedFeatureElement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelProjectsElement_H
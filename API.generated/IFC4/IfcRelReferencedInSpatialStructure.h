@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelReferencedInSpatialStructure_H
+#define __RDF_LTD__IFC4_IfcRelReferencedInSpatialStructure_H
+
+#include    "classes/IfcRelReferencedInSpatialStructure.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcProduct.h"
+#include    "classes/IfcSpatialElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1244, IfcRelReferencedInSpatialStructure, 557, RelatedElements)
+    inline IfcSpatialElement IfcRelReferencedInSpatialStructure::get_RelatingStructure() { RDF_EXPRESS_PROBE(1245); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1245), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelReferencedInSpatialStructure::put_RelatingStructure(IfcSpatialElement inst) { RDF_EXPRESS_PROBE(1245); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1245), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1245, IfcRelReferencedInSpatialStructure, 557, RelatingStructure)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelReferencedInSpatialStructure_H
@@ -0,0 +1,27 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelSequence_H
+#define __RDF_LTD__IFC4_IfcRelSequence_H
+
+#include    "classes/IfcRelSequence.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcLagTime.h"
+#include    "classes/IfcProcess.h"
+
+namespace IFC4
+{
+    inline IfcProcess IfcRelSequence::get_RelatingProcess() { RDF_EXPRESS_PROBE(1246); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1246), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelSequence::put_RelatingProcess(IfcProcess inst) { RDF_EXPRESS_PROBE(1246); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1246), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1246, IfcRelSequence, 558, RelatingProcess)
+    inline IfcProcess IfcRelSequence::get_RelatedProcess() { RDF_EXPRESS_PROBE(1247); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1247), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelSequence::put_RelatedProcess(IfcProcess inst) { RDF_EXPRESS_PROBE(1247); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1247), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1247, IfcRelSequence, 558, RelatedProcess)
+    inline IfcLagTime IfcRelSequence::get_TimeLag() { RDF_EXPRESS_PROBE(1248); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1248), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelSequence::put_TimeLag(IfcLagTime inst) { RDF_EXPRESS_PROBE(1248); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1248), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1248, IfcRelSequence, 558, TimeLag)
+    RDF_EXPRESS_ATTR_ACCESSOR(1249, IfcRelSequence, 558, SequenceType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1250, IfcRelSequence, 558, UserDefinedSequenceType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelSequence_H
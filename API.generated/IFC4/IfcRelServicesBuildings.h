@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelServicesBuildings_H
+#define __RDF_LTD__IFC4_IfcRelServicesBuildings_H
+
+#include    "classes/IfcRelServicesBuildings.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcSpatialElement.h"
+#include    "classes/IfcSystem.h"
+
+namespace IFC4
+{
+    inline IfcSystem IfcRelServicesBuildings::get_RelatingSystem() { RDF_EXPRESS_PROBE(1251); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1251), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelServicesBuildings::put_RelatingSystem(IfcSystem inst) { RDF_EXPRESS_PROBE(1251); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1251), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1251, IfcRelServicesBuildings, 559, RelatingSystem)
+    RDF_EXPRESS_ATTR_ACCESSOR(1252, IfcRelServicesBuildings, 559, RelatedBuildings)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelServicesBuildings_H
@@ -0,0 +1,26 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelSpaceBoundary_H
+#define __RDF_LTD__IFC4_IfcRelSpaceBoundary_H
+
+#include    "classes/IfcRelSpaceBoundary.h"
+#include    "IfcRelConnects.h"
+#include    "classes/IfcConnectionGeometry.h"
+#include    "classes/IfcElement.h"
+#include    "selects/IfcSpaceBoundarySelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1253, IfcRelSpaceBoundary, 560, RelatingSpace)
+    inline IfcElement IfcRelSpaceBoundary::get_RelatedBuildingElement() { RDF_EXPRESS_PROBE(1254); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1254), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelSpaceBoundary::put_RelatedBuildingElement(IfcElement inst) { RDF_EXPRESS_PROBE(1254); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1254), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1254, IfcRelSpaceBoundary, 560, RelatedBuildingElement)
+    inline IfcConnectionGeometry IfcRelSpaceBoundary::get_ConnectionGeometry() { RDF_EXPRESS_PROBE(1255); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1255), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelSpaceBoundary::put_ConnectionGeometry(IfcConnectionGeometry inst) { RDF_EXPRESS_PROBE(1255); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1255), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1255, IfcRelSpaceBoundary, 560, ConnectionGeometry)
+    RDF_EXPRESS_ATTR_ACCESSOR(1256, IfcRelSpaceBoundary, 560, PhysicalOrVirtualBoundary)
+    RDF_EXPRESS_ATTR_ACCESSOR(1257, IfcRelSpaceBoundary, 560, InternalOrExternalBoundary)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelSpaceBoundary_H
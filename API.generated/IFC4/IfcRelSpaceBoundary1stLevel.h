@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelSpaceBoundary1stLevel_H
+#define __RDF_LTD__IFC4_IfcRelSpaceBoundary1stLevel_H
+
+#include    "classes/IfcRelSpaceBoundary1stLevel.h"
+#include    "IfcRelSpaceBoundary.h"
+
+namespace IFC4
+{
+    inline IfcRelSpaceBoundary1stLevel IfcRelSpaceBoundary1stLevel::get_ParentBoundary() { RDF_EXPRESS_PROBE(1258); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1258), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelSpaceBoundary1stLevel::put_ParentBoundary(IfcRelSpaceBoundary1stLevel inst) { RDF_EXPRESS_PROBE(1258); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1258), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1258, IfcRelSpaceBoundary1stLevel, 561, ParentBoundary)
+    RDF_EXPRESS_ATTR_ACCESSOR(1259, IfcRelSpaceBoundary1stLevel, 561, InnerBoundaries)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelSpaceBoundary1stLevel_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelSpaceBoundary2ndLevel_H
+#define __RDF_LTD__IFC4_IfcRelSpaceBoundary2ndLevel_H
+
+#include    "classes/IfcRelSpaceBoundary2ndLevel.h"
+#include    "IfcRelSpaceBoundary1stLevel.h"
+
+namespace IFC4
+{
+    inline IfcRelSpaceBoundary2ndLevel IfcRelSpaceBoundary2ndLevel::get_CorrespondingBoundary() { RDF_EXPRESS_PROBE(1260); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1260), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelSpaceBoundary2ndLevel::put_CorrespondingBoundary(IfcRelSpaceBoundary2ndLevel inst) { RDF_EXPRESS_PROBE(1260); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1260), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1260, IfcRelSpaceBoundary2ndLevel, 562, CorrespondingBoundary)
+    RDF_EXPRESS_ATTR_ACCESSOR(1261, IfcRelSpaceBoundary2ndLevel, 562, Corresponds)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelSpaceBoundary2ndLevel_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelVoidsElement_H
+#define __RDF_LTD__IFC4_IfcRelVoidsElement_H
+
+#include    "classes/IfcRelVoidsElement.h"
+#include    "IfcRelDecomposes.h"
+#include    "classes/IfcElement.h"
+#include    "classes/IfcFeatureElementSubtraction.h"
+
+namespace IFC4
+{
+    inline IfcElement IfcRelVoidsElement::get_RelatingBuildingElement() { RDF_EXPRESS_PROBE(1262); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1262), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelVoidsElement::put_RelatingBuildingElement(IfcElement inst) { RDF_EXPRESS_PROBE(1262); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1262), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1262, IfcRelVoidsElement, 563, RelatingBuildingElement)
+    inline IfcFeatureElementSubtraction IfcRelVoidsElement::get_RelatedOpeningElement() { RDF_EXPRESS_PROBE(1263); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1263), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRelVoidsElement::put_RelatedOpeningElement(IfcFeatureElementSubtraction inst) { RDF_EXPRESS_PROBE(1263); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1263), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1263, IfcRelVoidsElement, 563, RelatedOpeningElement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelVoidsElement_H
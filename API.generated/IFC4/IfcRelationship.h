@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelationship_H
+#define __RDF_LTD__IFC4_IfcRelationship_H
+
+#include    "classes/IfcRelationship.h"
+#include    "IfcRoot.h"
+
+#endif //__RDF_LTD__IFC4_IfcRelationship_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReparametrisedCompositeCurveSegment_H
+#define __RDF_LTD__IFC4_IfcReparametrisedCompositeCurveSegment_H
+
+#include    "classes/IfcReparametrisedCompositeCurveSegment.h"
+#include    "IfcCompositeCurveSegment.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1264, IfcReparametrisedCompositeCurveSegment, 564, ParamLength)
+}
+
+#endif //__RDF_LTD__IFC4_IfcReparametrisedCompositeCurveSegment_H
@@ -0,0 +1,27 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRepresentation_H
+#define __RDF_LTD__IFC4_IfcRepresentation_H
+
+#include    "classes/IfcRepresentation.h"
+#include    "classes/IfcPresentationLayerAssignment.h"
+#include    "classes/IfcProductRepresentation.h"
+#include    "classes/IfcRepresentationContext.h"
+#include    "classes/IfcRepresentationItem.h"
+#include    "classes/IfcRepresentationMap.h"
+
+namespace IFC4
+{
+    inline IfcRepresentationContext IfcRepresentation::get_ContextOfItems() { RDF_EXPRESS_PROBE(1265); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1265), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRepresentation::put_ContextOfItems(IfcRepresentationContext inst) { RDF_EXPRESS_PROBE(1265); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1265), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1265, IfcRepresentation, 565, ContextOfItems)
+    RDF_EXPRESS_ATTR_ACCESSOR(1266, IfcRepresentation, 565, RepresentationIdentifier)
+    RDF_EXPRESS_ATTR_ACCESSOR(1267, IfcRepresentation, 565, RepresentationType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1268, IfcRepresentation, 565, Items)
+    RDF_EXPRESS_ATTR_ACCESSOR(1269, IfcRepresentation, 565, RepresentationMap)
+    RDF_EXPRESS_ATTR_ACCESSOR(1270, IfcRepresentation, 565, LayerAssignments)
+    RDF_EXPRESS_ATTR_ACCESSOR(1271, IfcRepresentation, 565, OfProductRepresentation)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRepresentation_H
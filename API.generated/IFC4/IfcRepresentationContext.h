@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRepresentationContext_H
+#define __RDF_LTD__IFC4_IfcRepresentationContext_H
+
+#include    "classes/IfcRepresentationContext.h"
+#include    "classes/IfcRepresentation.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(680, IfcRepresentationContext, 566, ContextIdentifier)
+    RDF_EXPRESS_ATTR_ACCESSOR(681, IfcRepresentationContext, 566, ContextType)
+    RDF_EXPRESS_ATTR_ACCESSOR(682, IfcRepresentationContext, 566, RepresentationsInContext)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRepresentationContext_H
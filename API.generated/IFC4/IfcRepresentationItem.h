@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRepresentationItem_H
+#define __RDF_LTD__IFC4_IfcRepresentationItem_H
+
+#include    "classes/IfcRepresentationItem.h"
+#include    "classes/IfcPresentationLayerAssignment.h"
+#include    "classes/IfcStyledItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(59, IfcRepresentationItem, 567, LayerAssignment)
+    RDF_EXPRESS_ATTR_ACCESSOR(60, IfcRepresentationItem, 567, StyledByItem)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRepresentationItem_H
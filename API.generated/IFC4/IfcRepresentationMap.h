@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRepresentationMap_H
+#define __RDF_LTD__IFC4_IfcRepresentationMap_H
+
+#include    "classes/IfcRepresentationMap.h"
+#include    "classes/IfcMappedItem.h"
+#include    "classes/IfcRepresentation.h"
+#include    "classes/IfcShapeAspect.h"
+#include    "selects/IfcAxis2Placement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1272, IfcRepresentationMap, 568, MappingOrigin)
+    inline IfcRepresentation IfcRepresentationMap::get_MappedRepresentation() { RDF_EXPRESS_PROBE(1273); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1273), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRepresentationMap::put_MappedRepresentation(IfcRepresentation inst) { RDF_EXPRESS_PROBE(1273); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1273), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1273, IfcRepresentationMap, 568, MappedRepresentation)
+    RDF_EXPRESS_ATTR_ACCESSOR(1274, IfcRepresentationMap, 568, HasShapeAspects)
+    RDF_EXPRESS_ATTR_ACCESSOR(1275, IfcRepresentationMap, 568, MapUsage)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRepresentationMap_H
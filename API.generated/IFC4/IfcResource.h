@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcResource_H
+#define __RDF_LTD__IFC4_IfcResource_H
+
+#include    "classes/IfcResource.h"
+#include    "IfcObject.h"
+#include    "classes/IfcRelAssignsToResource.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(371, IfcResource, 569, Identification)
+    RDF_EXPRESS_ATTR_ACCESSOR(372, IfcResource, 569, LongDescription)
+    RDF_EXPRESS_ATTR_ACCESSOR(373, IfcResource, 569, ResourceOf)
+}
+
+#endif //__RDF_LTD__IFC4_IfcResource_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcResourceApprovalRelationship_H
+#define __RDF_LTD__IFC4_IfcResourceApprovalRelationship_H
+
+#include    "classes/IfcResourceApprovalRelationship.h"
+#include    "IfcResourceLevelRelationship.h"
+#include    "classes/IfcApproval.h"
+#include    "selects/IfcResourceObjectSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1276, IfcResourceApprovalRelationship, 570, RelatedResourceObjects)
+    inline IfcApproval IfcResourceApprovalRelationship::get_RelatingApproval() { RDF_EXPRESS_PROBE(1277); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1277), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcResourceApprovalRelationship::put_RelatingApproval(IfcApproval inst) { RDF_EXPRESS_PROBE(1277); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1277), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1277, IfcResourceApprovalRelationship, 570, RelatingApproval)
+}
+
+#endif //__RDF_LTD__IFC4_IfcResourceApprovalRelationship_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcResourceConstraintRelationship_H
+#define __RDF_LTD__IFC4_IfcResourceConstraintRelationship_H
+
+#include    "classes/IfcResourceConstraintRelationship.h"
+#include    "IfcResourceLevelRelationship.h"
+#include    "classes/IfcConstraint.h"
+#include    "selects/IfcResourceObjectSelect.h"
+
+namespace IFC4
+{
+    inline IfcConstraint IfcResourceConstraintRelationship::get_RelatingConstraint() { RDF_EXPRESS_PROBE(1278); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1278), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcResourceConstraintRelationship::put_RelatingConstraint(IfcConstraint inst) { RDF_EXPRESS_PROBE(1278); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1278), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1278, IfcResourceConstraintRelationship, 571, RelatingConstraint)
+    RDF_EXPRESS_ATTR_ACCESSOR(1279, IfcResourceConstraintRelationship, 571, RelatedResourceObjects)
+}
+
+#endif //__RDF_LTD__IFC4_IfcResourceConstraintRelationship_H
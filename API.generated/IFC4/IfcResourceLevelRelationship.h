@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcResourceLevelRelationship_H
+#define __RDF_LTD__IFC4_IfcResourceLevelRelationship_H
+
+#include    "classes/IfcResourceLevelRelationship.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(109, IfcResourceLevelRelationship, 572, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(110, IfcResourceLevelRelationship, 572, Description)
+}
+
+#endif //__RDF_LTD__IFC4_IfcResourceLevelRelationship_H
@@ -0,0 +1,29 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcResourceTime_H
+#define __RDF_LTD__IFC4_IfcResourceTime_H
+
+#include    "classes/IfcResourceTime.h"
+#include    "IfcSchedulingTime.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1280, IfcResourceTime, 573, ScheduleWork)
+    RDF_EXPRESS_ATTR_ACCESSOR(1281, IfcResourceTime, 573, ScheduleUsage)
+    RDF_EXPRESS_ATTR_ACCESSOR(1282, IfcResourceTime, 573, ScheduleStart)
+    RDF_EXPRESS_ATTR_ACCESSOR(1283, IfcResourceTime, 573, ScheduleFinish)
+    RDF_EXPRESS_ATTR_ACCESSOR(1284, IfcResourceTime, 573, ScheduleContour)
+    RDF_EXPRESS_ATTR_ACCESSOR(1285, IfcResourceTime, 573, LevelingDelay)
+    RDF_EXPRESS_ATTR_ACCESSOR(1286, IfcResourceTime, 573, IsOverAllocated)
+    RDF_EXPRESS_ATTR_ACCESSOR(1287, IfcResourceTime, 573, StatusTime)
+    RDF_EXPRESS_ATTR_ACCESSOR(1288, IfcResourceTime, 573, ActualWork)
+    RDF_EXPRESS_ATTR_ACCESSOR(1289, IfcResourceTime, 573, ActualUsage)
+    RDF_EXPRESS_ATTR_ACCESSOR(1290, IfcResourceTime, 573, ActualStart)
+    RDF_EXPRESS_ATTR_ACCESSOR(1291, IfcResourceTime, 573, ActualFinish)
+    RDF_EXPRESS_ATTR_ACCESSOR(1292, IfcResourceTime, 573, RemainingWork)
+    RDF_EXPRESS_ATTR_ACCESSOR(1293, IfcResourceTime, 573, RemainingUsage)
+    RDF_EXPRESS_ATTR_ACCESSOR(1294, IfcResourceTime, 573, Completion)
+}
+
+#endif //__RDF_LTD__IFC4_IfcResourceTime_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRevolvedAreaSolid_H
+#define __RDF_LTD__IFC4_IfcRevolvedAreaSolid_H
+
+#include    "classes/IfcRevolvedAreaSolid.h"
+#include    "IfcSweptAreaSolid.h"
+#include    "classes/IfcAxis1Placement.h"
+#include    "classes/IfcLine.h"
+
+namespace IFC4
+{
+    inline IfcAxis1Placement IfcRevolvedAreaSolid::get_Axis() { RDF_EXPRESS_PROBE(1295); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1295), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRevolvedAreaSolid::put_Axis(IfcAxis1Placement inst) { RDF_EXPRESS_PROBE(1295); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1295), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1295, IfcRevolvedAreaSolid, 574, Axis)
+    RDF_EXPRESS_ATTR_ACCESSOR(1296, IfcRevolvedAreaSolid, 574, Angle)
+    inline IfcLine IfcRevolvedAreaSolid::get_AxisLine() { RDF_EXPRESS_PROBE(1297); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1297), sdaiINSTANCE, &inst); return inst; }
+    RDF_EXPRESS_ATTR_ACCESSOR(1297, IfcRevolvedAreaSolid, 574, AxisLine)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRevolvedAreaSolid_H
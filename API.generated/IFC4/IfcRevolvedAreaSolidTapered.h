@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRevolvedAreaSolidTapered_H
+#define __RDF_LTD__IFC4_IfcRevolvedAreaSolidTapered_H
+
+#include    "classes/IfcRevolvedAreaSolidTapered.h"
+#include    "IfcRevolvedAreaSolid.h"
+#include    "classes/IfcProfileDef.h"
+
+namespace IFC4
+{
+    inline IfcProfileDef IfcRevolvedAreaSolidTapered::get_EndSweptArea() { RDF_EXPRESS_PROBE(1298); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1298), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRevolvedAreaSolidTapered::put_EndSweptArea(IfcProfileDef inst) { RDF_EXPRESS_PROBE(1298); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1298), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1298, IfcRevolvedAreaSolidTapered, 575, EndSweptArea)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRevolvedAreaSolidTapered_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRightCircularCone_H
+#define __RDF_LTD__IFC4_IfcRightCircularCone_H
+
+#include    "classes/IfcRightCircularCone.h"
+#include    "IfcCsgPrimitive3D.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1299, IfcRightCircularCone, 576, Height)
+    RDF_EXPRESS_ATTR_ACCESSOR(1300, IfcRightCircularCone, 576, BottomRadius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRightCircularCone_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRightCircularCylinder_H
+#define __RDF_LTD__IFC4_IfcRightCircularCylinder_H
+
+#include    "classes/IfcRightCircularCylinder.h"
+#include    "IfcCsgPrimitive3D.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1301, IfcRightCircularCylinder, 577, Height)
+    RDF_EXPRESS_ATTR_ACCESSOR(1302, IfcRightCircularCylinder, 577, Radius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRightCircularCylinder_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRoof_H
+#define __RDF_LTD__IFC4_IfcRoof_H
+
+#include    "classes/IfcRoof.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1303, IfcRoof, 578, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRoof_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRoofType_H
+#define __RDF_LTD__IFC4_IfcRoofType_H
+
+#include    "classes/IfcRoofType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1304, IfcRoofType, 579, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRoofType_H
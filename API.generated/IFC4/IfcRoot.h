@@ -0,0 +1,26 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRoot_H
+#define __RDF_LTD__IFC4_IfcRoot_H
+
+#include    "classes/IfcRoot.h"
+#include    "classes/IfcOwnerHistory.h"
+
+namespace IFC4
+{
+
+    /// <summary>
+    /// Index of IfcRoot instances of a model by GlobalId, see GlobalIdIndexOf
+    /// </summary>
+    typedef GlobalIdIndexOf<IfcRoot> GlobalIdIndex;
+
+    RDF_EXPRESS_ATTR_ACCESSOR(0, IfcRoot, 580, GlobalId)
+    inline IfcOwnerHistory IfcRoot::get_OwnerHistory() { RDF_EXPRESS_PROBE(1); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcRoot::put_OwnerHistory(IfcOwnerHistory inst) { RDF_EXPRESS_PROBE(1); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1, IfcRoot, 580, OwnerHistory)
+    RDF_EXPRESS_ATTR_ACCESSOR(2, IfcRoot, 580, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(3, IfcRoot, 580, Description)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRoot_H
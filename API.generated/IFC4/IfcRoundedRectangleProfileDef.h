@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRoundedRectangleProfileDef_H
+#define __RDF_LTD__IFC4_IfcRoundedRectangleProfileDef_H
+
+#include    "classes/IfcRoundedRectangleProfileDef.h"
+#include    "IfcRectangleProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1305, IfcRoundedRectangleProfileDef, 581, RoundingRadius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcRoundedRectangleProfileDef_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSIUnit_H
+#define __RDF_LTD__IFC4_IfcSIUnit_H
+
+#include    "classes/IfcSIUnit.h"
+#include    "IfcNamedUnit.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1346, IfcSIUnit, 600, Prefix)
+    RDF_EXPRESS_ATTR_ACCESSOR(1347, IfcSIUnit, 600, Name)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSIUnit_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSanitaryTerminal_H
+#define __RDF_LTD__IFC4_IfcSanitaryTerminal_H
+
+#include    "classes/IfcSanitaryTerminal.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1306, IfcSanitaryTerminal, 582, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSanitaryTerminal_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSanitaryTerminalType_H
+#define __RDF_LTD__IFC4_IfcSanitaryTerminalType_H
+
+#include    "classes/IfcSanitaryTerminalType.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1307, IfcSanitaryTerminalType, 583, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSanitaryTerminalType_H
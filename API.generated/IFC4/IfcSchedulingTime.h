@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSchedulingTime_H
+#define __RDF_LTD__IFC4_IfcSchedulingTime_H
+
+#include    "classes/IfcSchedulingTime.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(605, IfcSchedulingTime, 584, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(606, IfcSchedulingTime, 584, DataOrigin)
+    RDF_EXPRESS_ATTR_ACCESSOR(607, IfcSchedulingTime, 584, UserDefinedDataOrigin)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSchedulingTime_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSeamCurve_H
+#define __RDF_LTD__IFC4_IfcSeamCurve_H
+
+#include    "classes/IfcSeamCurve.h"
+#include    "IfcSurfaceCurve.h"
+
+#endif //__RDF_LTD__IFC4_IfcSeamCurve_H
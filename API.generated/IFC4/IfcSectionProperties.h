@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSectionProperties_H
+#define __RDF_LTD__IFC4_IfcSectionProperties_H
+
+#include    "classes/IfcSectionProperties.h"
+#include    "IfcPreDefinedProperties.h"
+#include    "classes/IfcProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1312, IfcSectionProperties, 587, SectionType)
+    inline IfcProfileDef IfcSectionProperties::get_StartProfile() { RDF_EXPRESS_PROBE(1313); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1313), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSectionProperties::put_StartProfile(IfcProfileDef inst) { RDF_EXPRESS_PROBE(1313); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1313), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1313, IfcSectionProperties, 587, StartProfile)
+    inline IfcProfileDef IfcSectionProperties::get_EndProfile() { RDF_EXPRESS_PROBE(1314); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1314), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSectionProperties::put_EndProfile(IfcProfileDef inst) { RDF_EXPRESS_PROBE(1314); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1314), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1314, IfcSectionProperties, 587, EndProfile)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSectionProperties_H
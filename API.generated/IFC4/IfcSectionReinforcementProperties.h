@@ -0,0 +1,24 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSectionReinforcementProperties_H
+#define __RDF_LTD__IFC4_IfcSectionReinforcementProperties_H
+
+#include    "classes/IfcSectionReinforcementProperties.h"
+#include    "IfcPreDefinedProperties.h"
+#include    "classes/IfcReinforcementBarProperties.h"
+#include    "classes/IfcSectionProperties.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1315, IfcSectionReinforcementProperties, 588, LongitudinalStartPosition)
+    RDF_EXPRESS_ATTR_ACCESSOR(1316, IfcSectionReinforcementProperties, 588, LongitudinalEndPosition)
+    RDF_EXPRESS_ATTR_ACCESSOR(1317, IfcSectionReinforcementProperties, 588, TransversePosition)
+    RDF_EXPRESS_ATTR_ACCESSOR(1318, IfcSectionReinforcementProperties, 588, ReinforcementRole)
+    inline IfcSectionProperties IfcSectionReinforcementProperties::get_SectionDefinition() { RDF_EXPRESS_PROBE(1319); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1319), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSectionReinforcementProperties::put_SectionDefinition(IfcSectionProperties inst) { RDF_EXPRESS_PROBE(1319); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1319), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1319, IfcSectionReinforcementProperties, 588, SectionDefinition)
+    RDF_EXPRESS_ATTR_ACCESSOR(1320, IfcSectionReinforcementProperties, 588, CrossSectionReinforcementDefinitions)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSectionReinforcementProperties_H
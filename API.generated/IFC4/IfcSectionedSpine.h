@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSectionedSpine_H
+#define __RDF_LTD__IFC4_IfcSectionedSpine_H
+
+#include    "classes/IfcSectionedSpine.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "classes/IfcAxis2Placement3D.h"
+#include    "classes/IfcCompositeCurve.h"
+#include    "classes/IfcProfileDef.h"
+
+namespace IFC4
+{
+    inline IfcCompositeCurve IfcSectionedSpine::get_SpineCurve() { RDF_EXPRESS_PROBE(1308); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1308), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSectionedSpine::put_SpineCurve(IfcCompositeCurve inst) { RDF_EXPRESS_PROBE(1308); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1308), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1308, IfcSectionedSpine, 586, SpineCurve)
+    RDF_EXPRESS_ATTR_ACCESSOR(1309, IfcSectionedSpine, 586, CrossSections)
+    RDF_EXPRESS_ATTR_ACCESSOR(1310, IfcSectionedSpine, 586, CrossSectionPositions)
+    RDF_EXPRESS_ATTR_ACCESSOR(1311, IfcSectionedSpine, 586, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSectionedSpine_H
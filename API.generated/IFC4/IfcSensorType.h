@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSensorType_H
+#define __RDF_LTD__IFC4_IfcSensorType_H
+
+#include    "classes/IfcSensorType.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1322, IfcSensorType, 590, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSensorType_H
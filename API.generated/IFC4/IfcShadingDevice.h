@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcShadingDevice_H
+#define __RDF_LTD__IFC4_IfcShadingDevice_H
+
+#include    "classes/IfcShadingDevice.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1323, IfcShadingDevice, 591, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcShadingDevice_H
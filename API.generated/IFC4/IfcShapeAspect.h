@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcShapeAspect_H
+#define __RDF_LTD__IFC4_IfcShapeAspect_H
+
+#include    "classes/IfcShapeAspect.h"
+#include    "classes/IfcShapeModel.h"
+#include    "selects/IfcProductRepresentationSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1325, IfcShapeAspect, 593, ShapeRepresentations)
+    RDF_EXPRESS_ATTR_ACCESSOR(1326, IfcShapeAspect, 593, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(1327, IfcShapeAspect, 593, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(1328, IfcShapeAspect, 593, ProductDefinitional)
+    RDF_EXPRESS_ATTR_ACCESSOR(1329, IfcShapeAspect, 593, PartOfProductDefinitionShape)
+}
+
+#endif //__RDF_LTD__IFC4_IfcShapeAspect_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcShapeModel_H
+#define __RDF_LTD__IFC4_IfcShapeModel_H
+
+#include    "classes/IfcShapeModel.h"
+#include    "IfcRepresentation.h"
+#include    "classes/IfcShapeAspect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1330, IfcShapeModel, 594, OfShapeAspect)
+}
+
+#endif //__RDF_LTD__IFC4_IfcShapeModel_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcShapeRepresentation_H
+#define __RDF_LTD__IFC4_IfcShapeRepresentation_H
+
+#include    "classes/IfcShapeRepresentation.h"
+#include    "IfcShapeModel.h"
+
+#endif //__RDF_LTD__IFC4_IfcShapeRepresentation_H
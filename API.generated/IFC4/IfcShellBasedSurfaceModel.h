@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcShellBasedSurfaceModel_H
+#define __RDF_LTD__IFC4_IfcShellBasedSurfaceModel_H
+
+#include    "classes/IfcShellBasedSurfaceModel.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "selects/IfcShell.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1331, IfcShellBasedSurfaceModel, 596, SbsmBoundary)
+    RDF_EXPRESS_ATTR_ACCESSOR(1332, IfcShellBasedSurfaceModel, 596, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcShellBasedSurfaceModel_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSimpleProperty_H
+#define __RDF_LTD__IFC4_IfcSimpleProperty_H
+
+#include    "classes/IfcSimpleProperty.h"
+#include    "IfcProperty.h"
+
+#endif //__RDF_LTD__IFC4_IfcSimpleProperty_H
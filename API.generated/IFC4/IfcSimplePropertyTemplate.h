@@ -0,0 +1,26 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSimplePropertyTemplate_H
+#define __RDF_LTD__IFC4_IfcSimplePropertyTemplate_H
+
+#include    "classes/IfcSimplePropertyTemplate.h"
+#include    "IfcPropertyTemplate.h"
+#include    "classes/IfcPropertyEnumeration.h"
+#include    "selects/IfcUnit.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1333, IfcSimplePropertyTemplate, 598, TemplateType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1334, IfcSimplePropertyTemplate, 598, PrimaryMeasureType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1335, IfcSimplePropertyTemplate, 598, SecondaryMeasureType)
+    inline IfcPropertyEnumeration IfcSimplePropertyTemplate::get_Enumerators() { RDF_EXPRESS_PROBE(1336); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1336), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSimplePropertyTemplate::put_Enumerators(IfcPropertyEnumeration inst) { RDF_EXPRESS_PROBE(1336); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1336), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1336, IfcSimplePropertyTemplate, 598, Enumerators)
+    RDF_EXPRESS_ATTR_ACCESSOR(1337, IfcSimplePropertyTemplate, 598, PrimaryUnit)
+    RDF_EXPRESS_ATTR_ACCESSOR(1338, IfcSimplePropertyTemplate, 598, SecondaryUnit)
+    RDF_EXPRESS_ATTR_ACCESSOR(1339, IfcSimplePropertyTemplate, 598, Expression)
+    RDF_EXPRESS_ATTR_ACCESSOR(1340, IfcSimplePropertyTemplate, 598, AccessState)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSimplePropertyTemplate_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSite_H
+#define __RDF_LTD__IFC4_IfcSite_H
+
+#include    "classes/IfcSite.h"
+#include    "IfcSpatialStructureElement.h"
+#include    "classes/IfcPostalAddress.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1341, IfcSite, 599, RefLatitude)
+    RDF_EXPRESS_ATTR_ACCESSOR(1342, IfcSite, 599, RefLongitude)
+    RDF_EXPRESS_ATTR_ACCESSOR(1343, IfcSite, 599, RefElevation)
+    RDF_EXPRESS_ATTR_ACCESSOR(1344, IfcSite, 599, LandTitleNumber)
+    inline IfcPostalAddress IfcSite::get_SiteAddress() { RDF_EXPRESS_PROBE(1345); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1345), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSite::put_SiteAddress(IfcPostalAddress inst) { RDF_EXPRESS_PROBE(1345); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1345), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1345, IfcSite, 599, SiteAddress)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSite_H
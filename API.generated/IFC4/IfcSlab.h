@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSlab_H
+#define __RDF_LTD__IFC4_IfcSlab_H
+
+#include    "classes/IfcSlab.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1348, IfcSlab, 601, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSlab_H
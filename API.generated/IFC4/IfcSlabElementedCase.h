@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSlabElementedCase_H
+#define __RDF_LTD__IFC4_IfcSlabElementedCase_H
+
+#include    "classes/IfcSlabElementedCase.h"
+#include    "IfcSlab.h"
+
+#endif //__RDF_LTD__IFC4_IfcSlabElementedCase_H
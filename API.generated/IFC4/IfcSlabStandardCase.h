@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSlabStandardCase_H
+#define __RDF_LTD__IFC4_IfcSlabStandardCase_H
+
+#include    "classes/IfcSlabStandardCase.h"
+#include    "IfcSlab.h"
+
+#endif //__RDF_LTD__IFC4_IfcSlabStandardCase_H
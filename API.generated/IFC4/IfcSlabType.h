@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSlabType_H
+#define __RDF_LTD__IFC4_IfcSlabType_H
+
+#include    "classes/IfcSlabType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1349, IfcSlabType, 604, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSlabType_H
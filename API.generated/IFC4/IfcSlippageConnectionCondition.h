@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSlippageConnectionCondition_H
+#define __RDF_LTD__IFC4_IfcSlippageConnectionCondition_H
+
+#include    "classes/IfcSlippageConnectionCondition.h"
+#include    "IfcStructuralConnectionCondition.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1350, IfcSlippageConnectionCondition, 605, SlippageX)
+    RDF_EXPRESS_ATTR_ACCESSOR(1351, IfcSlippageConnectionCondition, 605, SlippageY)
+    RDF_EXPRESS_ATTR_ACCESSOR(1352, IfcSlippageConnectionCondition, 605, SlippageZ)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSlippageConnectionCondition_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSolarDevice_H
+#define __RDF_LTD__IFC4_IfcSolarDevice_H
+
+#include    "classes/IfcSolarDevice.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1353, IfcSolarDevice, 606, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSolarDevice_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSolarDeviceType_H
+#define __RDF_LTD__IFC4_IfcSolarDeviceType_H
+
+#include    "classes/IfcSolarDeviceType.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1354, IfcSolarDeviceType, 607, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSolarDeviceType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSolidModel_H
+#define __RDF_LTD__IFC4_IfcSolidModel_H
+
+#include    "classes/IfcSolidModel.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(61, IfcSolidModel, 608, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSolidModel_H
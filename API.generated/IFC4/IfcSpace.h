@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpace_H
+#define __RDF_LTD__IFC4_IfcSpace_H
+
+#include    "classes/IfcSpace.h"
+#include    "IfcSpatialStructureElement.h"
+#include    "classes/IfcRelCoversSpaces.h"
+#include    "classes/IfcRelSpaceBoundary.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1355, IfcSpace, 609, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1356, IfcSpace, 609, ElevationWithFlooring)
+    RDF_EXPRESS_ATTR_ACCESSOR(1357, IfcSpace, 609, HasCoverings)
+    RDF_EXPRESS_ATTR_ACCESSOR(1358, IfcSpace, 609, BoundedBy)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpace_H
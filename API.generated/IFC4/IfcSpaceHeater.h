@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpaceHeater_H
+#define __RDF_LTD__IFC4_IfcSpaceHeater_H
+
+#include    "classes/IfcSpaceHeater.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1359, IfcSpaceHeater, 610, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpaceHeater_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpaceHeaterType_H
+#define __RDF_LTD__IFC4_IfcSpaceHeaterType_H
+
+#include    "classes/IfcSpaceHeaterType.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1360, IfcSpaceHeaterType, 611, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpaceHeaterType_H
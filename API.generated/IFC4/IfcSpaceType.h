@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpaceType_H
+#define __RDF_LTD__IFC4_IfcSpaceType_H
+
+#include    "classes/IfcSpaceType.h"
+#include    "IfcSpatialStructureElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1362, IfcSpaceType, 612, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1363, IfcSpaceType, 612, LongName)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpaceType_H
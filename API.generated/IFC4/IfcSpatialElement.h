@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpatialElement_H
+#define __RDF_LTD__IFC4_IfcSpatialElement_H
+
+#include    "classes/IfcSpatialElement.h"
+#include    "IfcProduct.h"
+#include    "classes/IfcRelContainedInSpatialStructure.h"
+#include    "classes/IfcRelReferencedInSpatialStructure.h"
+#include    "classes/IfcRelServicesBuildings.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(237, IfcSpatialElement, 613, LongName)
+    RDF_EXPRESS_ATTR_ACCESSOR(238, IfcSpatialElement, 613, ContainsElements)
+    RDF_EXPRESS_ATTR_ACCESSOR(239, IfcSpatialElement, 613, ServicedBySystems)
+    RDF_EXPRESS_ATTR_ACCESSOR(240, IfcSpatialElement, 613, ReferencesElements)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpatialElement_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpatialElementType_H
+#define __RDF_LTD__IFC4_IfcSpatialElementType_H
+
+#include    "classes/IfcSpatialElementType.h"
+#include    "IfcTypeProduct.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1361, IfcSpatialElementType, 614, ElementType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpatialElementType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpatialStructureElement_H
+#define __RDF_LTD__IFC4_IfcSpatialStructureElement_H
+
+#include    "classes/IfcSpatialStructureElement.h"
+#include    "IfcSpatialElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(241, IfcSpatialStructureElement, 615, CompositionType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpatialStructureElement_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpatialStructureElementType_H
+#define __RDF_LTD__IFC4_IfcSpatialStructureElementType_H
+
+#include    "classes/IfcSpatialStructureElementType.h"
+#include    "IfcSpatialElementType.h"
+
+#endif //__RDF_LTD__IFC4_IfcSpatialStructureElementType_H
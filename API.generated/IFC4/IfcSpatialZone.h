@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpatialZone_H
+#define __RDF_LTD__IFC4_IfcSpatialZone_H
+
+#include    "classes/IfcSpatialZone.h"
+#include    "IfcSpatialElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1364, IfcSpatialZone, 617, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpatialZone_H
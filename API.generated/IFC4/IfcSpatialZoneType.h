@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpatialZoneType_H
+#define __RDF_LTD__IFC4_IfcSpatialZoneType_H
+
+#include    "classes/IfcSpatialZoneType.h"
+#include    "IfcSpatialElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1365, IfcSpatialZoneType, 618, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1366, IfcSpatialZoneType, 618, LongName)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpatialZoneType_H
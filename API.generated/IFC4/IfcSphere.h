@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSphere_H
+#define __RDF_LTD__IFC4_IfcSphere_H
+
+#include    "classes/IfcSphere.h"
+#include    "IfcCsgPrimitive3D.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1367, IfcSphere, 619, Radius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSphere_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSphericalSurface_H
+#define __RDF_LTD__IFC4_IfcSphericalSurface_H
+
+#include    "classes/IfcSphericalSurface.h"
+#include    "IfcElementarySurface.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1368, IfcSphericalSurface, 620, Radius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSphericalSurface_H
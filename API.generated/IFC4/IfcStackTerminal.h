@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStackTerminal_H
+#define __RDF_LTD__IFC4_IfcStackTerminal_H
+
+#include    "classes/IfcStackTerminal.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1369, IfcStackTerminal, 621, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStackTerminal_H
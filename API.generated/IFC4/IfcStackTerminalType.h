@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStackTerminalType_H
+#define __RDF_LTD__IFC4_IfcStackTerminalType_H
+
+#include    "classes/IfcStackTerminalType.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1370, IfcStackTerminalType, 622, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStackTerminalType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStair_H
+#define __RDF_LTD__IFC4_IfcStair_H
+
+#include    "classes/IfcStair.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1371, IfcStair, 623, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStair_H
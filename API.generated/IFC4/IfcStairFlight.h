@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStairFlight_H
+#define __RDF_LTD__IFC4_IfcStairFlight_H
+
+#include    "classes/IfcStairFlight.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1372, IfcStairFlight, 624, NumberOfRisers)
+    RDF_EXPRESS_ATTR_ACCESSOR(1373, IfcStairFlight, 624, NumberOfTreads)
+    RDF_EXPRESS_ATTR_ACCESSOR(1374, IfcStairFlight, 624, RiserHeight)
+    RDF_EXPRESS_ATTR_ACCESSOR(1375, IfcStairFlight, 624, TreadLength)
+    RDF_EXPRESS_ATTR_ACCESSOR(1376, IfcStairFlight, 624, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStairFlight_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStairFlightType_H
+#define __RDF_LTD__IFC4_IfcStairFlightType_H
+
+#include    "classes/IfcStairFlightType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1377, IfcStairFlightType, 625, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStairFlightType_H
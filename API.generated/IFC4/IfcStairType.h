@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStairType_H
+#define __RDF_LTD__IFC4_IfcStairType_H
+
+#include    "classes/IfcStairType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1378, IfcStairType, 626, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStairType_H
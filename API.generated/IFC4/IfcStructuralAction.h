@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralAction_H
+#define __RDF_LTD__IFC4_IfcStructuralAction_H
+
+#include    "classes/IfcStructuralAction.h"
+#include    "IfcStructuralActivity.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1382, IfcStructuralAction, 627, DestabilizingLoad)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralAction_H
@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralActivity_H
+#define __RDF_LTD__IFC4_IfcStructuralActivity_H
+
+#include    "classes/IfcStructuralActivity.h"
+#include    "IfcProduct.h"
+#include    "classes/IfcRelConnectsStructuralActivity.h"
+#include    "classes/IfcStructuralLoad.h"
+
+namespace IFC4
+{
+    inline IfcStructuralLoad IfcStructuralActivity::get_AppliedLoad() { RDF_EXPRESS_PROBE(1379); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1379), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcStructuralActivity::put_AppliedLoad(IfcStructuralLoad inst) { RDF_EXPRESS_PROBE(1379); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1379), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1379, IfcStructuralActivity, 628, AppliedLoad)
+    RDF_EXPRESS_ATTR_ACCESSOR(1380, IfcStructuralActivity, 628, GlobalOrLocal)
+    RDF_EXPRESS_ATTR_ACCESSOR(1381, IfcStructuralActivity, 628, AssignedToStructuralItem)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralActivity_H
@@ -0,0 +1,27 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralAnalysisModel_H
+#define __RDF_LTD__IFC4_IfcStructuralAnalysisModel_H
+
+#include    "classes/IfcStructuralAnalysisModel.h"
+#include    "IfcSystem.h"
+#include    "classes/IfcAxis2Placement3D.h"
+#include    "classes/IfcObjectPlacement.h"
+#include    "classes/IfcStructuralLoadGroup.h"
+#include    "classes/IfcStructuralResultGroup.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1383, IfcStructuralAnalysisModel, 629, PredefinedType)
+    inline IfcAxis2Placement3D IfcStructuralAnalysisModel::get_OrientationOf2DPlane() { RDF_EXPRESS_PROBE(1384); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1384), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcStructuralAnalysisModel::put_OrientationOf2DPlane(IfcAxis2Placement3D inst) { RDF_EXPRESS_PROBE(1384); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1384), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1384, IfcStructuralAnalysisModel, 629, OrientationOf2DPlane)
+    RDF_EXPRESS_ATTR_ACCESSOR(1385, IfcStructuralAnalysisModel, 629, LoadedBy)
+    RDF_EXPRESS_ATTR_ACCESSOR(1386, IfcStructuralAnalysisModel, 629, HasResults)
+    inline IfcObjectPlacement IfcStructuralAnalysisModel::get_SharedPlacement() { RDF_EXPRESS_PROBE(1387); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1387), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcStructuralAnalysisModel::put_SharedPlacement(IfcObjectPlacement inst) { RDF_EXPRESS_PROBE(1387); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1387), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1387, IfcStructuralAnalysisModel, 629, SharedPlacement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralAnalysisModel_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralConnection_H
+#define __RDF_LTD__IFC4_IfcStructuralConnection_H
+
+#include    "classes/IfcStructuralConnection.h"
+#include    "IfcStructuralItem.h"
+#include    "classes/IfcBoundaryCondition.h"
+#include    "classes/IfcRelConnectsStructuralMember.h"
+
+namespace IFC4
+{
+    inline IfcBoundaryCondition IfcStructuralConnection::get_AppliedCondition() { RDF_EXPRESS_PROBE(1389); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1389), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcStructuralConnection::put_AppliedCondition(IfcBoundaryCondition inst) { RDF_EXPRESS_PROBE(1389); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1389), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1389, IfcStructuralConnection, 630, AppliedCondition)
+    RDF_EXPRESS_ATTR_ACCESSOR(1390, IfcStructuralConnection, 630, ConnectsStructuralMembers)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralConnection_H
@@ -0,0 +1,14 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralConnectionCondition_H
+#define __RDF_LTD__IFC4_IfcStructuralConnectionCondition_H
+
+#include    "classes/IfcStructuralConnectionCondition.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(636, IfcStructuralConnectionCondition, 631, Name)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralConnectionCondition_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralCurveAction_H
+#define __RDF_LTD__IFC4_IfcStructuralCurveAction_H
+
+#include    "classes/IfcStructuralCurveAction.h"
+#include    "IfcStructuralAction.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1391, IfcStructuralCurveAction, 632, ProjectedOrTrue)
+    RDF_EXPRESS_ATTR_ACCESSOR(1392, IfcStructuralCurveAction, 632, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralCurveAction_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralCurveConnection_H
+#define __RDF_LTD__IFC4_IfcStructuralCurveConnection_H
+
+#include    "classes/IfcStructuralCurveConnection.h"
+#include    "IfcStructuralConnection.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    inline IfcDirection IfcStructuralCurveConnection::get_Axis() { RDF_EXPRESS_PROBE(1393); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1393), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcStructuralCurveConnection::put_Axis(IfcDirection inst) { RDF_EXPRESS_PROBE(1393); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1393), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1393, IfcStructuralCurveConnection, 633, Axis)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralCurveConnection_H
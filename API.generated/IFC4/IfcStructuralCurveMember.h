@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralCurveMember_H
+#define __RDF_LTD__IFC4_IfcStructuralCurveMember_H
+
+#include    "classes/IfcStructuralCurveMember.h"
+#include    "IfcStructuralMember.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1395, IfcStructuralCurveMember, 634, PredefinedType)
+    inline IfcDirection IfcStructuralCurveMember::get_Axis() { RDF_EXPRESS_PROBE(1396); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1396), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcStructuralCurveMember::put_Axis(IfcDirection inst) { RDF_EXPRESS_PROBE(1396); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1396), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1396, IfcStructuralCurveMember, 634, Axis)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralCurveMember_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralCurveMemberVarying_H
+#define __RDF_LTD__IFC4_IfcStructuralCurveMemberVarying_H
+
+#include    "classes/IfcStructuralCurveMemberVarying.h"
+#include    "IfcStructuralCurveMember.h"
+
+#endif //__RDF_LTD__IFC4_IfcStructuralCurveMemberVarying_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralCurveReaction_H
+#define __RDF_LTD__IFC4_IfcStructuralCurveReaction_H
+
+#include    "classes/IfcStructuralCurveReaction.h"
+#include    "IfcStructuralReaction.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1397, IfcStructuralCurveReaction, 636, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralCurveReaction_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralItem_H
+#define __RDF_LTD__IFC4_IfcStructuralItem_H
+
+#include    "classes/IfcStructuralItem.h"
+#include    "IfcProduct.h"
+#include    "classes/IfcRelConnectsStructuralActivity.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1388, IfcStructuralItem, 637, AssignedStructuralActivity)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralItem_H
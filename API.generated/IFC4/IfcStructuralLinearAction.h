@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLinearAction_H
+#define __RDF_LTD__IFC4_IfcStructuralLinearAction_H
+
+#include    "classes/IfcStructuralLinearAction.h"
+#include    "IfcStructuralCurveAction.h"
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLinearAction_H
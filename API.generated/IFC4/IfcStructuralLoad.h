@@ -0,0 +1,14 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoad_H
+#define __RDF_LTD__IFC4_IfcStructuralLoad_H
+
+#include    "classes/IfcStructuralLoad.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1398, IfcStructuralLoad, 639, Name)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoad_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadCase_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadCase_H
+
+#include    "classes/IfcStructuralLoadCase.h"
+#include    "IfcStructuralLoadGroup.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1406, IfcStructuralLoadCase, 640, SelfWeightCoefficients)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadCase_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadConfiguration_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadConfiguration_H
+
+#include    "classes/IfcStructuralLoadConfiguration.h"
+#include    "IfcStructuralLoad.h"
+#include    "classes/IfcStructuralLoadOrResult.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1407, IfcStructuralLoadConfiguration, 641, Values)
+    RDF_EXPRESS_ATTR_ACCESSOR(1408, IfcStructuralLoadConfiguration, 641, Locations)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadConfiguration_H
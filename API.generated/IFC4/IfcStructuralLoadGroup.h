@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadGroup_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadGroup_H
+
+#include    "classes/IfcStructuralLoadGroup.h"
+#include    "IfcGroup.h"
+#include    "classes/IfcStructuralAnalysisModel.h"
+#include    "classes/IfcStructuralResultGroup.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1399, IfcStructuralLoadGroup, 642, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1400, IfcStructuralLoadGroup, 642, ActionType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1401, IfcStructuralLoadGroup, 642, ActionSource)
+    RDF_EXPRESS_ATTR_ACCESSOR(1402, IfcStructuralLoadGroup, 642, Coefficient)
+    RDF_EXPRESS_ATTR_ACCESSOR(1403, IfcStructuralLoadGroup, 642, Purpose)
+    RDF_EXPRESS_ATTR_ACCESSOR(1404, IfcStructuralLoadGroup, 642, SourceOfResultGroup)
+    RDF_EXPRESS_ATTR_ACCESSOR(1405, IfcStructuralLoadGroup, 642, LoadGroupFor)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadGroup_H
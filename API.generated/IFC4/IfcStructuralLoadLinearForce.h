@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadLinearForce_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadLinearForce_H
+
+#include    "classes/IfcStructuralLoadLinearForce.h"
+#include    "IfcStructuralLoadStatic.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1409, IfcStructuralLoadLinearForce, 643, LinearForceX)
+    RDF_EXPRESS_ATTR_ACCESSOR(1410, IfcStructuralLoadLinearForce, 643, LinearForceY)
+    RDF_EXPRESS_ATTR_ACCESSOR(1411, IfcStructuralLoadLinearForce, 643, LinearForceZ)
+    RDF_EXPRESS_ATTR_ACCESSOR(1412, IfcStructuralLoadLinearForce, 643, LinearMomentX)
+    RDF_EXPRESS_ATTR_ACCESSOR(1413, IfcStructuralLoadLinearForce, 643, LinearMomentY)
+    RDF_EXPRESS_ATTR_ACCESSOR(1414, IfcStructuralLoadLinearForce, 643, LinearMomentZ)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadLinearForce_H
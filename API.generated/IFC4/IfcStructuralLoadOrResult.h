@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadOrResult_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadOrResult_H
+
+#include    "classes/IfcStructuralLoadOrResult.h"
+#include    "IfcStructuralLoad.h"
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadOrResult_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadPlanarForce_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadPlanarForce_H
+
+#include    "classes/IfcStructuralLoadPlanarForce.h"
+#include    "IfcStructuralLoadStatic.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1415, IfcStructuralLoadPlanarForce, 645, PlanarForceX)
+    RDF_EXPRESS_ATTR_ACCESSOR(1416, IfcStructuralLoadPlanarForce, 645, PlanarForceY)
+    RDF_EXPRESS_ATTR_ACCESSOR(1417, IfcStructuralLoadPlanarForce, 645, PlanarForceZ)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadPlanarForce_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadSingleDisplacement_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadSingleDisplacement_H
+
+#include    "classes/IfcStructuralLoadSingleDisplacement.h"
+#include    "IfcStructuralLoadStatic.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1418, IfcStructuralLoadSingleDisplacement, 646, DisplacementX)
+    RDF_EXPRESS_ATTR_ACCESSOR(1419, IfcStructuralLoadSingleDisplacement, 646, DisplacementY)
+    RDF_EXPRESS_ATTR_ACCESSOR(1420, IfcStructuralLoadSingleDisplacement, 646, DisplacementZ)
+    RDF_EXPRESS_ATTR_ACCESSOR(1421, IfcStructuralLoadSingleDisplacement, 646, RotationalDisplacementRX)
+    RDF_EXPRESS_ATTR_ACCESSOR(1422, IfcStructuralLoadSingleDisplacement, 646, RotationalDisplacementRY)
+    RDF_EXPRESS_ATTR_ACCESSOR(1423, IfcStructuralLoadSingleDisplacement, 646, RotationalDisplacementRZ)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadSingleDisplacement_H
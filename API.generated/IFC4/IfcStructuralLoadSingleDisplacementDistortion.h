@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadSingleDisplacementDistortion_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadSingleDisplacementDistortion_H
+
+#include    "classes/IfcStructuralLoadSingleDisplacementDistortion.h"
+#include    "IfcStructuralLoadSingleDisplacement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1424, IfcStructuralLoadSingleDisplacementDistortion, 647, Distortion)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadSingleDisplacementDistortion_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadSingleForce_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadSingleForce_H
+
+#include    "classes/IfcStructuralLoadSingleForce.h"
+#include    "IfcStructuralLoadStatic.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1425, IfcStructuralLoadSingleForce, 648, ForceX)
+    RDF_EXPRESS_ATTR_ACCESSOR(1426, IfcStructuralLoadSingleForce, 648, ForceY)
+    RDF_EXPRESS_ATTR_ACCESSOR(1427, IfcStructuralLoadSingleForce, 648, ForceZ)
+    RDF_EXPRESS_ATTR_ACCESSOR(1428, IfcStructuralLoadSingleForce, 648, MomentX)
+    RDF_EXPRESS_ATTR_ACCESSOR(1429, IfcStructuralLoadSingleForce, 648, MomentY)
+    RDF_EXPRESS_ATTR_ACCESSOR(1430, IfcStructuralLoadSingleForce, 648, MomentZ)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadSingleForce_H
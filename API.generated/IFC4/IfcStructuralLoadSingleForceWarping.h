@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadSingleForceWarping_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadSingleForceWarping_H
+
+#include    "classes/IfcStructuralLoadSingleForceWarping.h"
+#include    "IfcStructuralLoadSingleForce.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1431, IfcStructuralLoadSingleForceWarping, 649, WarpingMoment)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadSingleForceWarping_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadStatic_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadStatic_H
+
+#include    "classes/IfcStructuralLoadStatic.h"
+#include    "IfcStructuralLoadOrResult.h"
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadStatic_H
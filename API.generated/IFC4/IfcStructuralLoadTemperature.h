@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadTemperature_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadTemperature_H
+
+#include    "classes/IfcStructuralLoadTemperature.h"
+#include    "IfcStructuralLoadStatic.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1432, IfcStructuralLoadTemperature, 651, DeltaTConstant)
+    RDF_EXPRESS_ATTR_ACCESSOR(1433, IfcStructuralLoadTemperature, 651, DeltaTY)
+    RDF_EXPRESS_ATTR_ACCESSOR(1434, IfcStructuralLoadTemperature, 651, DeltaTZ)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadTemperature_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralMember_H
+#define __RDF_LTD__IFC4_IfcStructuralMember_H
+
+#include    "classes/IfcStructuralMember.h"
+#include    "IfcStructuralItem.h"
+#include    "classes/IfcRelConnectsStructuralMember.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1394, IfcStructuralMember, 652, ConnectedBy)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralMember_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralPlanarAction_H
+#define __RDF_LTD__IFC4_IfcStructuralPlanarAction_H
+
+#include    "classes/IfcStructuralPlanarAction.h"
+#include    "IfcStructuralSurfaceAction.h"
+
+#endif //__RDF_LTD__IFC4_IfcStructuralPlanarAction_H
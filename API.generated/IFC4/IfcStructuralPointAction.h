@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralPointAction_H
+#define __RDF_LTD__IFC4_IfcStructuralPointAction_H
+
+#include    "classes/IfcStructuralPointAction.h"
+#include    "IfcStructuralAction.h"
+
+#endif //__RDF_LTD__IFC4_IfcStructuralPointAction_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralPointConnection_H
+#define __RDF_LTD__IFC4_IfcStructuralPointConnection_H
+
+#include    "classes/IfcStructuralPointConnection.h"
+#include    "IfcStructuralConnection.h"
+#include    "classes/IfcAxis2Placement3D.h"
+
+namespace IFC4
+{
+    inline IfcAxis2Placement3D IfcStructuralPointConnection::get_ConditionCoordinateSystem() { RDF_EXPRESS_PROBE(1437); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1437), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcStructuralPointConnection::put_ConditionCoordinateSystem(IfcAxis2Placement3D inst) { RDF_EXPRESS_PROBE(1437); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1437), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1437, IfcStructuralPointConnection, 655, ConditionCoordinateSystem)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralPointConnection_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralPointReaction_H
+#define __RDF_LTD__IFC4_IfcStructuralPointReaction_H
+
+#include    "classes/IfcStructuralPointReaction.h"
+#include    "IfcStructuralReaction.h"
+
+#endif //__RDF_LTD__IFC4_IfcStructuralPointReaction_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralReaction_H
+#define __RDF_LTD__IFC4_IfcStructuralReaction_H
+
+#include    "classes/IfcStructuralReaction.h"
+#include    "IfcStructuralActivity.h"
+
+#endif //__RDF_LTD__IFC4_IfcStructuralReaction_H
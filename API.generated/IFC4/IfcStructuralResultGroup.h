@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralResultGroup_H
+#define __RDF_LTD__IFC4_IfcStructuralResultGroup_H
+
+#include    "classes/IfcStructuralResultGroup.h"
+#include    "IfcGroup.h"
+#include    "classes/IfcStructuralAnalysisModel.h"
+#include    "classes/IfcStructuralLoadGroup.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1438, IfcStructuralResultGroup, 658, TheoryType)
+    inline IfcStructuralLoadGroup IfcStructuralResultGroup::get_ResultForLoadGroup() { RDF_EXPRESS_PROBE(1439); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1439), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcStructuralResultGroup::put_ResultForLoadGroup(IfcStructuralLoadGroup inst) { RDF_EXPRESS_PROBE(1439); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1439), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1439, IfcStructuralResultGroup, 658, ResultForLoadGroup)
+    RDF_EXPRESS_ATTR_ACCESSOR(1440, IfcStructuralResultGroup, 658, IsLinear)
+    RDF_EXPRESS_ATTR_ACCESSOR(1441, IfcStructuralResultGroup, 658, ResultGroupFor)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralResultGroup_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralSurfaceAction_H
+#define __RDF_LTD__IFC4_IfcStructuralSurfaceAction_H
+
+#include    "classes/IfcStructuralSurfaceAction.h"
+#include    "IfcStructuralAction.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1435, IfcStructuralSurfaceAction, 659, ProjectedOrTrue)
+    RDF_EXPRESS_ATTR_ACCESSOR(1436, IfcStructuralSurfaceAction, 659, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralSurfaceAction_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralSurfaceConnection_H
+#define __RDF_LTD__IFC4_IfcStructuralSurfaceConnection_H
+
+#include    "classes/IfcStructuralSurfaceConnection.h"
+#include    "IfcStructuralConnection.h"
+
+#endif //__RDF_LTD__IFC4_IfcStructuralSurfaceConnection_H
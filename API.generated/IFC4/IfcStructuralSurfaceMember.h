@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralSurfaceMember_H
+#define __RDF_LTD__IFC4_IfcStructuralSurfaceMember_H
+
+#include    "classes/IfcStructuralSurfaceMember.h"
+#include    "IfcStructuralMember.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1442, IfcStructuralSurfaceMember, 661, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1443, IfcStructuralSurfaceMember, 661, Thickness)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralSurfaceMember_H
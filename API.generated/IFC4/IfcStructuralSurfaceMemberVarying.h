@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralSurfaceMemberVarying_H
+#define __RDF_LTD__IFC4_IfcStructuralSurfaceMemberVarying_H
+
+#include    "classes/IfcStructuralSurfaceMemberVarying.h"
+#include    "IfcStructuralSurfaceMember.h"
+
+#endif //__RDF_LTD__IFC4_IfcStructuralSurfaceMemberVarying_H
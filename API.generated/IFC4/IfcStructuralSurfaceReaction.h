@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralSurfaceReaction_H
+#define __RDF_LTD__IFC4_IfcStructuralSurfaceReaction_H
+
+#include    "classes/IfcStructuralSurfaceReaction.h"
+#include    "IfcStructuralReaction.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1444, IfcStructuralSurfaceReaction, 663, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralSurfaceReaction_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStyleModel_H
+#define __RDF_LTD__IFC4_IfcStyleModel_H
+
+#include    "classes/IfcStyleModel.h"
+#include    "IfcRepresentation.h"
+
+#endif //__RDF_LTD__IFC4_IfcStyleModel_H
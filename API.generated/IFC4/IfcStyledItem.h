@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStyledItem_H
+#define __RDF_LTD__IFC4_IfcStyledItem_H
+
+#include    "classes/IfcStyledItem.h"
+#include    "IfcRepresentationItem.h"
+#include    "classes/IfcRepresentationItem.h"
+#include    "selects/IfcStyleAssignmentSelect.h"
+
+namespace IFC4
+{
+    inline IfcRepresentationItem IfcStyledItem::get_Item() { RDF_EXPRESS_PROBE(1445); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1445), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcStyledItem::put_Item(IfcRepresentationItem inst) { RDF_EXPRESS_PROBE(1445); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1445), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1445, IfcStyledItem, 664, Item)
+    RDF_EXPRESS_ATTR_ACCESSOR(1446, IfcStyledItem, 664, Styles)
+    RDF_EXPRESS_ATTR_ACCESSOR(1447, IfcStyledItem, 664, Name)
+}
+
+#endif //__RDF_LTD__IFC4_IfcStyledItem_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStyledRepresentation_H
+#define __RDF_LTD__IFC4_IfcStyledRepresentation_H
+
+#include    "classes/IfcStyledRepresentation.h"
+#include    "IfcStyleModel.h"
+
+#endif //__RDF_LTD__IFC4_IfcStyledRepresentation_H
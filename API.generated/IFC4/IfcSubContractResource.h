@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSubContractResource_H
+#define __RDF_LTD__IFC4_IfcSubContractResource_H
+
+#include    "classes/IfcSubContractResource.h"
+#include    "IfcConstructionResource.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1448, IfcSubContractResource, 667, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSubContractResource_H
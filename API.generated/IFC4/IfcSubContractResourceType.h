@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSubContractResourceType_H
+#define __RDF_LTD__IFC4_IfcSubContractResourceType_H
+
+#include    "classes/IfcSubContractResourceType.h"
+#include    "IfcConstructionResourceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1449, IfcSubContractResourceType, 668, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSubContractResourceType_H
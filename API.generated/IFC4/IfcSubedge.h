@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSubedge_H
+#define __RDF_LTD__IFC4_IfcSubedge_H
+
+#include    "classes/IfcSubedge.h"
+#include    "IfcEdge.h"
+#include    "classes/IfcEdge.h"
+
+namespace IFC4
+{
+    inline IfcEdge IfcSubedge::get_ParentEdge() { RDF_EXPRESS_PROBE(1450); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1450), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSubedge::put_ParentEdge(IfcEdge inst) { RDF_EXPRESS_PROBE(1450); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1450), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1450, IfcSubedge, 669, ParentEdge)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSubedge_H
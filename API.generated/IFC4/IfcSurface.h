@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurface_H
+#define __RDF_LTD__IFC4_IfcSurface_H
+
+#include    "classes/IfcSurface.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(199, IfcSurface, 670, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurface_H
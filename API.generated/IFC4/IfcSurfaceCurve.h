@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceCurve_H
+#define __RDF_LTD__IFC4_IfcSurfaceCurve_H
+
+#include    "classes/IfcSurfaceCurve.h"
+#include    "IfcCurve.h"
+#include    "classes/IfcCurve.h"
+#include    "classes/IfcPcurve.h"
+#include    "classes/IfcSurface.h"
+
+namespace IFC4
+{
+    inline IfcCurve IfcSurfaceCurve::get_Curve3D() { RDF_EXPRESS_PROBE(730); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(730), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSurfaceCurve::put_Curve3D(IfcCurve inst) { RDF_EXPRESS_PROBE(730); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(730), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(730, IfcSurfaceCurve, 671, Curve3D)
+    RDF_EXPRESS_ATTR_ACCESSOR(731, IfcSurfaceCurve, 671, AssociatedGeometry)
+    RDF_EXPRESS_ATTR_ACCESSOR(732, IfcSurfaceCurve, 671, MasterRepresentation)
+    RDF_EXPRESS_ATTR_ACCESSOR(733, IfcSurfaceCurve, 671, BasisSurface)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceCurve_H
@@ -0,0 +1,24 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceCurveSweptAreaSolid_H
+#define __RDF_LTD__IFC4_IfcSurfaceCurveSweptAreaSolid_H
+
+#include    "classes/IfcSurfaceCurveSweptAreaSolid.h"
+#include    "IfcSweptAreaSolid.h"
+#include    "classes/IfcCurve.h"
+#include    "classes/IfcSurface.h"
+
+namespace IFC4
+{
+    inline IfcCurve IfcSurfaceCurveSweptAreaSolid::get_Directrix() { RDF_EXPRESS_PROBE(1451); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1451), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSurfaceCurveSweptAreaSolid::put_Directrix(IfcCurve inst) { RDF_EXPRESS_PROBE(1451); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1451), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1451, IfcSurfaceCurveSweptAreaSolid, 672, Directrix)
+    RDF_EXPRESS_ATTR_ACCESSOR(1452, IfcSurfaceCurveSweptAreaSolid, 672, StartParam)
+    RDF_EXPRESS_ATTR_ACCESSOR(1453, IfcSurfaceCurveSweptAreaSolid, 672, EndParam)
+    inline IfcSurface IfcSurfaceCurveSweptAreaSolid::get_ReferenceSurface() { RDF_EXPRESS_PROBE(1454); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1454), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSurfaceCurveSweptAreaSolid::put_ReferenceSurface(IfcSurface inst) { RDF_EXPRESS_PROBE(1454); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1454), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1454, IfcSurfaceCurveSweptAreaSolid, 672, ReferenceSurface)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceCurveSweptAreaSolid_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceFeature_H
+#define __RDF_LTD__IFC4_IfcSurfaceFeature_H
+
+#include    "classes/IfcSurfaceFeature.h"
+#include    "IfcFeatureElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1455, IfcSurfaceFeature, 673, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceFeature_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceOfLinearExtrusion_H
+#define __RDF_LTD__IFC4_IfcSurfaceOfLinearExtrusion_H
+
+#include    "classes/IfcSurfaceOfLinearExtrusion.h"
+#include    "IfcSweptSurface.h"
+#include    "classes/IfcDirection.h"
+#include    "classes/IfcVector.h"
+
+namespace IFC4
+{
+    inline IfcDirection IfcSurfaceOfLinearExtrusion::get_ExtrudedDirection() { RDF_EXPRESS_PROBE(1458); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1458), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSurfaceOfLinearExtrusion::put_ExtrudedDirection(IfcDirection inst) { RDF_EXPRESS_PROBE(1458); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1458), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1458, IfcSurfaceOfLinearExtrusion, 674, ExtrudedDirection)
+    RDF_EXPRESS_ATTR_ACCESSOR(1459, IfcSurfaceOfLinearExtrusion, 674, Depth)
+    inline IfcVector IfcSurfaceOfLinearExtrusion::get_ExtrusionAxis() { RDF_EXPRESS_PROBE(1460); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1460), sdaiINSTANCE, &inst); return inst; }
+    RDF_EXPRESS_ATTR_ACCESSOR(1460, IfcSurfaceOfLinearExtrusion, 674, ExtrusionAxis)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceOfLinearExtrusion_H
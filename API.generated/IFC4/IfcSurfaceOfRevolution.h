@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceOfRevolution_H
+#define __RDF_LTD__IFC4_IfcSurfaceOfRevolution_H
+
+#include    "classes/IfcSurfaceOfRevolution.h"
+#include    "IfcSweptSurface.h"
+#include    "classes/IfcAxis1Placement.h"
+#include    "classes/IfcLine.h"
+
+namespace IFC4
+{
+    inline IfcAxis1Placement IfcSurfaceOfRevolution::get_AxisPosition() { RDF_EXPRESS_PROBE(1461); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1461), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSurfaceOfRevolution::put_AxisPosition(IfcAxis1Placement inst) { RDF_EXPRESS_PROBE(1461); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1461), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1461, IfcSurfaceOfRevolution, 675, AxisPosition)
+    inline IfcLine IfcSurfaceOfRevolution::get_AxisLine() { RDF_EXPRESS_PROBE(1462); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1462), sdaiINSTANCE, &inst); return inst; }
+    RDF_EXPRESS_ATTR_ACCESSOR(1462, IfcSurfaceOfRevolution, 675, AxisLine)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceOfRevolution_H
@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceReinforcementArea_H
+#define __RDF_LTD__IFC4_IfcSurfaceReinforcementArea_H
+
+#include    "classes/IfcSurfaceReinforcementArea.h"
+#include    "IfcStructuralLoadOrResult.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1463, IfcSurfaceReinforcementArea, 676, SurfaceReinforcement1)
+    RDF_EXPRESS_ATTR_ACCESSOR(1464, IfcSurfaceReinforcementArea, 676, SurfaceReinforcement2)
+    RDF_EXPRESS_ATTR_ACCESSOR(1465, IfcSurfaceReinforcementArea, 676, ShearReinforcement)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceReinforcementArea_H
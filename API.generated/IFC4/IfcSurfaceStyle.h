@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceStyle_H
+#define __RDF_LTD__IFC4_IfcSurfaceStyle_H
+
+#include    "classes/IfcSurfaceStyle.h"
+#include    "IfcPresentationStyle.h"
+#include    "selects/IfcSurfaceStyleElementSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1466, IfcSurfaceStyle, 677, Side)
+    RDF_EXPRESS_ATTR_ACCESSOR(1467, IfcSurfaceStyle, 677, Styles)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceStyle_H
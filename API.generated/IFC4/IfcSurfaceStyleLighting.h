@@ -0,0 +1,27 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceStyleLighting_H
+#define __RDF_LTD__IFC4_IfcSurfaceStyleLighting_H
+
+#include    "classes/IfcSurfaceStyleLighting.h"
+#include    "IfcPresentationItem.h"
+#include    "classes/IfcColourRgb.h"
+
+namespace IFC4
+{
+    inline IfcColourRgb IfcSurfaceStyleLighting::get_DiffuseTransmissionColour() { RDF_EXPRESS_PROBE(1468); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1468), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSurfaceStyleLighting::put_DiffuseTransmissionColour(IfcColourRgb inst) { RDF_EXPRESS_PROBE(1468); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1468), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1468, IfcSurfaceStyleLighting, 678, DiffuseTransmissionColour)
+    inline IfcColourRgb IfcSurfaceStyleLighting::get_DiffuseReflectionColour() { RDF_EXPRESS_PROBE(1469); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1469), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSurfaceStyleLighting::put_DiffuseReflectionColour(IfcColourRgb inst) { RDF_EXPRESS_PROBE(1469); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1469), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1469, IfcSurfaceStyleLighting, 678, DiffuseReflectionColour)
+    inline IfcColourRgb IfcSurfaceStyleLighting::get_TransmissionColour() { RDF_EXPRESS_PROBE(1470); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1470), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSurfaceStyleLighting::put_TransmissionColour(IfcColourRgb inst) { RDF_EXPRESS_PROBE(1470); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1470), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1470, IfcSurfaceStyleLighting, 678, TransmissionColour)
+    inline IfcColourRgb IfcSurfaceStyleLighting::get_ReflectanceColour() { RDF_EXPRESS_PROBE(1471); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1471), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSurfaceStyleLighting::put_ReflectanceColour(IfcColourRgb inst) { RDF_EXPRESS_PROBE(1471); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1471), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1471, IfcSurfaceStyleLighting, 678, ReflectanceColour)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceStyleLighting_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceStyleRefraction_H
+#define __RDF_LTD__IFC4_IfcSurfaceStyleRefraction_H
+
+#include    "classes/IfcSurfaceStyleRefraction.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1472, IfcSurfaceStyleRefraction, 679, RefractionIndex)
+    RDF_EXPRESS_ATTR_ACCESSOR(1473, IfcSurfaceStyleRefraction, 679, DispersionFactor)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceStyleRefraction_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceStyleRendering_H
+#define __RDF_LTD__IFC4_IfcSurfaceStyleRendering_H
+
+#include    "classes/IfcSurfaceStyleRendering.h"
+#include    "IfcSurfaceStyleShading.h"
+#include    "selects/IfcColourOrFactor.h"
+#include    "selects/IfcSpecularHighlightSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1476, IfcSurfaceStyleRendering, 680, DiffuseColour)
+    RDF_EXPRESS_ATTR_ACCESSOR(1477, IfcSurfaceStyleRendering, 680, TransmissionColour)
+    RDF_EXPRESS_ATTR_ACCESSOR(1478, IfcSurfaceStyleRendering, 680, DiffuseTransmissionColour)
+    RDF_EXPRESS_ATTR_ACCESSOR(1479, IfcSurfaceStyleRendering, 680, ReflectionColour)
+    RDF_EXPRESS_ATTR_ACCESSOR(1480, IfcSurfaceStyleRendering, 680, SpecularColour)
+    RDF_EXPRESS_ATTR_ACCESSOR(1481, IfcSurfaceStyleRendering, 680, SpecularHighlight)
+    RDF_EXPRESS_ATTR_ACCESSOR(1482, IfcSurfaceStyleRendering, 680, ReflectanceMethod)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceStyleRendering_H
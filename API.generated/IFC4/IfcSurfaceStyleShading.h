@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceStyleShading_H
+#define __RDF_LTD__IFC4_IfcSurfaceStyleShading_H
+
+#include    "classes/IfcSurfaceStyleShading.h"
+#include    "IfcPresentationItem.h"
+#include    "classes/IfcColourRgb.h"
+
+namespace IFC4
+{
+    inline IfcColourRgb IfcSurfaceStyleShading::get_SurfaceColour() { RDF_EXPRESS_PROBE(1474); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1474), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSurfaceStyleShading::put_SurfaceColour(IfcColourRgb inst) { RDF_EXPRESS_PROBE(1474); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1474), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1474, IfcSurfaceStyleShading, 681, SurfaceColour)
+    RDF_EXPRESS_ATTR_ACCESSOR(1475, IfcSurfaceStyleShading, 681, Transparency)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceStyleShading_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceStyleWithTextures_H
+#define __RDF_LTD__IFC4_IfcSurfaceStyleWithTextures_H
+
+#include    "classes/IfcSurfaceStyleWithTextures.h"
+#include    "IfcPresentationItem.h"
+#include    "classes/IfcSurfaceTexture.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1483, IfcSurfaceStyleWithTextures, 682, Textures)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceStyleWithTextures_H
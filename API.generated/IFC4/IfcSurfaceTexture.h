@@ -0,0 +1,26 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceTexture_H
+#define __RDF_LTD__IFC4_IfcSurfaceTexture_H
+
+#include    "classes/IfcSurfaceTexture.h"
+#include    "IfcPresentationItem.h"
+#include    "classes/IfcCartesianTransformationOperator2D.h"
+#include    "classes/IfcSurfaceStyleWithTextures.h"
+#include    "classes/IfcTextureCoordinate.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(156, IfcSurfaceTexture, 683, RepeatS)
+    RDF_EXPRESS_ATTR_ACCESSOR(157, IfcSurfaceTexture, 683, RepeatT)
+    RDF_EXPRESS_ATTR_ACCESSOR(158, IfcSurfaceTexture, 683, Mode)
+    inline IfcCartesianTransformationOperator2D IfcSurfaceTexture::get_TextureTransform() { RDF_EXPRESS_PROBE(159); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(159), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSurfaceTexture::put_TextureTransform(IfcCartesianTransformationOperator2D inst) { RDF_EXPRESS_PROBE(159); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(159), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(159, IfcSurfaceTexture, 683, TextureTransform)
+    RDF_EXPRESS_ATTR_ACCESSOR(160, IfcSurfaceTexture, 683, Parameter)
+    RDF_EXPRESS_ATTR_ACCESSOR(161, IfcSurfaceTexture, 683, IsMappedBy)
+    RDF_EXPRESS_ATTR_ACCESSOR(162, IfcSurfaceTexture, 683, UsedInStyles)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceTexture_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSweptAreaSolid_H
+#define __RDF_LTD__IFC4_IfcSweptAreaSolid_H
+
+#include    "classes/IfcSweptAreaSolid.h"
+#include    "IfcSolidModel.h"
+#include    "classes/IfcAxis2Placement3D.h"
+#include    "classes/IfcProfileDef.h"
+
+namespace IFC4
+{
+    inline IfcProfileDef IfcSweptAreaSolid::get_SweptArea() { RDF_EXPRESS_PROBE(626); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(626), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSweptAreaSolid::put_SweptArea(IfcProfileDef inst) { RDF_EXPRESS_PROBE(626); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(626), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(626, IfcSweptAreaSolid, 684, SweptArea)
+    inline IfcAxis2Placement3D IfcSweptAreaSolid::get_Position() { RDF_EXPRESS_PROBE(627); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(627), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSweptAreaSolid::put_Position(IfcAxis2Placement3D inst) { RDF_EXPRESS_PROBE(627); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(627), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(627, IfcSweptAreaSolid, 684, Position)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSweptAreaSolid_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSweptDiskSolid_H
+#define __RDF_LTD__IFC4_IfcSweptDiskSolid_H
+
+#include    "classes/IfcSweptDiskSolid.h"
+#include    "IfcSolidModel.h"
+#include    "classes/IfcCurve.h"
+
+namespace IFC4
+{
+    inline IfcCurve IfcSweptDiskSolid::get_Directrix() { RDF_EXPRESS_PROBE(1484); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1484), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSweptDiskSolid::put_Directrix(IfcCurve inst) { RDF_EXPRESS_PROBE(1484); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1484), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1484, IfcSweptDiskSolid, 685, Directrix)
+    RDF_EXPRESS_ATTR_ACCESSOR(1485, IfcSweptDiskSolid, 685, Radius)
+    RDF_EXPRESS_ATTR_ACCESSOR(1486, IfcSweptDiskSolid, 685, InnerRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(1487, IfcSweptDiskSolid, 685, StartParam)
+    RDF_EXPRESS_ATTR_ACCESSOR(1488, IfcSweptDiskSolid, 685, EndParam)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSweptDiskSolid_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSweptDiskSolidPolygonal_H
+#define __RDF_LTD__IFC4_IfcSweptDiskSolidPolygonal_H
+
+#include    "classes/IfcSweptDiskSolidPolygonal.h"
+#include    "IfcSweptDiskSolid.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1489, IfcSweptDiskSolidPolygonal, 686, FilletRadius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSweptDiskSolidPolygonal_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSweptSurface_H
+#define __RDF_LTD__IFC4_IfcSweptSurface_H
+
+#include    "classes/IfcSweptSurface.h"
+#include    "IfcSurface.h"
+#include    "classes/IfcAxis2Placement3D.h"
+#include    "classes/IfcProfileDef.h"
+
+namespace IFC4
+{
+    inline IfcProfileDef IfcSweptSurface::get_SweptCurve() { RDF_EXPRESS_PROBE(1456); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1456), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSweptSurface::put_SweptCurve(IfcProfileDef inst) { RDF_EXPRESS_PROBE(1456); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1456), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1456, IfcSweptSurface, 687, SweptCurve)
+    inline IfcAxis2Placement3D IfcSweptSurface::get_Position() { RDF_EXPRESS_PROBE(1457); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1457), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcSweptSurface::put_Position(IfcAxis2Placement3D inst) { RDF_EXPRESS_PROBE(1457); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1457), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1457, IfcSweptSurface, 687, Position)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSweptSurface_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSwitchingDevice_H
+#define __RDF_LTD__IFC4_IfcSwitchingDevice_H
+
+#include    "classes/IfcSwitchingDevice.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1490, IfcSwitchingDevice, 688, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSwitchingDevice_H
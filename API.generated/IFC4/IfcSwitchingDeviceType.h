@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSwitchingDeviceType_H
+#define __RDF_LTD__IFC4_IfcSwitchingDeviceType_H
+
+#include    "classes/IfcSwitchingDeviceType.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1491, IfcSwitchingDeviceType, 689, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSwitchingDeviceType_H
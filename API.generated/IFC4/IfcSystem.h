@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSystem_H
+#define __RDF_LTD__IFC4_IfcSystem_H
+
+#include    "classes/IfcSystem.h"
+#include    "IfcGroup.h"
+#include    "classes/IfcRelServicesBuildings.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(250, IfcSystem, 690, ServicesBuildings)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSystem_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSystemFurnitureElement_H
+#define __RDF_LTD__IFC4_IfcSystemFurnitureElement_H
+
+#include    "classes/IfcSystemFurnitureElement.h"
+#include    "IfcFurnishingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1492, IfcSystemFurnitureElement, 691, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSystemFurnitureElement_H
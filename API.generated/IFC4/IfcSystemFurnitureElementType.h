@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSystemFurnitureElementType_H
+#define __RDF_LTD__IFC4_IfcSystemFurnitureElementType_H
+
+#include    "classes/IfcSystemFurnitureElementType.h"
+#include    "IfcFurnishingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1493, IfcSystemFurnitureElementType, 692, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcSystemFurnitureElementType_H
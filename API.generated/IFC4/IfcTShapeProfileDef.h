@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTShapeProfileDef_H
+#define __RDF_LTD__IFC4_IfcTShapeProfileDef_H
+
+#include    "classes/IfcTShapeProfileDef.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1607, IfcTShapeProfileDef, 733, Depth)
+    RDF_EXPRESS_ATTR_ACCESSOR(1608, IfcTShapeProfileDef, 733, FlangeWidth)
+    RDF_EXPRESS_ATTR_ACCESSOR(1609, IfcTShapeProfileDef, 733, WebThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(1610, IfcTShapeProfileDef, 733, FlangeThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(1611, IfcTShapeProfileDef, 733, FilletRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(1612, IfcTShapeProfileDef, 733, FlangeEdgeRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(1613, IfcTShapeProfileDef, 733, WebEdgeRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(1614, IfcTShapeProfileDef, 733, WebSlope)
+    RDF_EXPRESS_ATTR_ACCESSOR(1615, IfcTShapeProfileDef, 733, FlangeSlope)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTShapeProfileDef_H
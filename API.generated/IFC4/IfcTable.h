@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTable_H
+#define __RDF_LTD__IFC4_IfcTable_H
+
+#include    "classes/IfcTable.h"
+#include    "classes/IfcTableColumn.h"
+#include    "classes/IfcTableRow.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1494, IfcTable, 693, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(1495, IfcTable, 693, Rows)
+    RDF_EXPRESS_ATTR_ACCESSOR(1496, IfcTable, 693, Columns)
+    RDF_EXPRESS_ATTR_ACCESSOR(1497, IfcTable, 693, NumberOfCellsInRow)
+    RDF_EXPRESS_ATTR_ACCESSOR(1498, IfcTable, 693, NumberOfHeadings)
+    RDF_EXPRESS_ATTR_ACCESSOR(1499, IfcTable, 693, NumberOfDataRows)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTable_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTableColumn_H
+#define __RDF_LTD__IFC4_IfcTableColumn_H
+
+#include    "classes/IfcTableColumn.h"
+#include    "classes/IfcReference.h"
+#include    "selects/IfcUnit.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1500, IfcTableColumn, 694, Identifier)
+    RDF_EXPRESS_ATTR_ACCESSOR(1501, IfcTableColumn, 694, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(1502, IfcTableColumn, 694, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(1503, IfcTableColumn, 694, Unit)
+    inline IfcReference IfcTableColumn::get_ReferencePath() { RDF_EXPRESS_PROBE(1504); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1504), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcTableColumn::put_ReferencePath(IfcReference inst) { RDF_EXPRESS_PROBE(1504); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1504), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1504, IfcTableColumn, 694, ReferencePath)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTableColumn_H
@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTableRow_H
+#define __RDF_LTD__IFC4_IfcTableRow_H
+
+#include    "classes/IfcTableRow.h"
+#include    "selects/IfcValue.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1505, IfcTableRow, 695, RowCells)
+    RDF_EXPRESS_ATTR_ACCESSOR(1506, IfcTableRow, 695, IsHeading)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTableRow_H
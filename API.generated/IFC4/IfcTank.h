@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTank_H
+#define __RDF_LTD__IFC4_IfcTank_H
+
+#include    "classes/IfcTank.h"
+#include    "IfcFlowStorageDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1507, IfcTank, 696, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTank_H
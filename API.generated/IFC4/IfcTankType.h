@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTankType_H
+#define __RDF_LTD__IFC4_IfcTankType_H
+
+#include    "classes/IfcTankType.h"
+#include    "IfcFlowStorageDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1508, IfcTankType, 697, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTankType_H
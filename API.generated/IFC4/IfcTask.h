@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTask_H
+#define __RDF_LTD__IFC4_IfcTask_H
+
+#include    "classes/IfcTask.h"
+#include    "IfcProcess.h"
+#include    "classes/IfcTaskTime.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1509, IfcTask, 698, Status)
+    RDF_EXPRESS_ATTR_ACCESSOR(1510, IfcTask, 698, WorkMethod)
+    RDF_EXPRESS_ATTR_ACCESSOR(1511, IfcTask, 698, IsMilestone)
+    RDF_EXPRESS_ATTR_ACCESSOR(1512, IfcTask, 698, Priority)
+    inline IfcTaskTime IfcTask::get_TaskTime() { RDF_EXPRESS_PROBE(1513); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1513), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcTask::put_TaskTime(IfcTaskTime inst) { RDF_EXPRESS_PROBE(1513); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1513), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1513, IfcTask, 698, TaskTime)
+    RDF_EXPRESS_ATTR_ACCESSOR(1514, IfcTask, 698, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTask_H
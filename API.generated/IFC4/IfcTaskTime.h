@@ -0,0 +1,31 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTaskTime_H
+#define __RDF_LTD__IFC4_IfcTaskTime_H
+
+#include    "classes/IfcTaskTime.h"
+#include    "IfcSchedulingTime.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1515, IfcTaskTime, 699, DurationType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1516, IfcTaskTime, 699, ScheduleDuration)
+    RDF_EXPRESS_ATTR_ACCESSOR(1517, IfcTaskTime, 699, ScheduleStart)
+    RDF_EXPRESS_ATTR_ACCESSOR(1518, IfcTaskTime, 699, ScheduleFinish)
+    RDF_EXPRESS_ATTR_ACCESSOR(1519, IfcTaskTime, 699, EarlyStart)
+    RDF_EXPRESS_ATTR_ACCESSOR(1520, IfcTaskTime, 699, EarlyFinish)
+    RDF_EXPRESS_ATTR_ACCESSOR(1521, IfcTaskTime, 699, LateStart)
+    RDF_EXPRESS_ATTR_ACCESSOR(1522, IfcTaskTime, 699, LateFinish)
+    RDF_EXPRESS_ATTR_ACCESSOR(1523, IfcTaskTime, 699, FreeFloat)
+    RDF_EXPRESS_ATTR_ACCESSOR(1524, IfcTaskTime, 699, TotalFloat)
+    RDF_EXPRESS_ATTR_ACCESSOR(1525, IfcTaskTime, 699, IsCritical)
+    RDF_EXPRESS_ATTR_ACCESSOR(1526, IfcTaskTime, 699, StatusTime)
+    RDF_EXPRESS_ATTR_ACCESSOR(1527, IfcTaskTime, 699, ActualDuration)
+    RDF_EXPRESS_ATTR_ACCESSOR(1528, IfcTaskTime, 699, ActualStart)
+    RDF_EXPRESS_ATTR_ACCESSOR(1529, IfcTaskTime, 699, ActualFinish)
+    RDF_EXPRESS_ATTR_ACCESSOR(1530, IfcTaskTime, 699, RemainingTime)
+    RDF_EXPRESS_ATTR_ACCESSOR(1531, IfcTaskTime, 699, Completion)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTaskTime_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTaskTimeRecurring_H
+#define __RDF_LTD__IFC4_IfcTaskTimeRecurring_H
+
+#include    "classes/IfcTaskTimeRecurring.h"
+#include    "IfcTaskTime.h"
+#include    "classes/IfcRecurrencePattern.h"
+
+namespace IFC4
+{
+    inline IfcRecurrencePattern IfcTaskTimeRecurring::get_Recurrence() { RDF_EXPRESS_PROBE(1532); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1532), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcTaskTimeRecurring::put_Recurrence(IfcRecurrencePattern inst) { RDF_EXPRESS_PROBE(1532); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1532), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1532, IfcTaskTimeRecurring, 700, Recurrence)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTaskTimeRecurring_H
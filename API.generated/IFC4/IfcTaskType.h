@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTaskType_H
+#define __RDF_LTD__IFC4_IfcTaskType_H
+
+#include    "classes/IfcTaskType.h"
+#include    "IfcTypeProcess.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1533, IfcTaskType, 701, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1534, IfcTaskType, 701, WorkMethod)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTaskType_H
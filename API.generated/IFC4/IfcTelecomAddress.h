@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTelecomAddress_H
+#define __RDF_LTD__IFC4_IfcTelecomAddress_H
+
+#include    "classes/IfcTelecomAddress.h"
+#include    "IfcAddress.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1535, IfcTelecomAddress, 702, TelephoneNumbers)
+    RDF_EXPRESS_ATTR_ACCESSOR(1536, IfcTelecomAddress, 702, FacsimileNumbers)
+    RDF_EXPRESS_ATTR_ACCESSOR(1537, IfcTelecomAddress, 702, PagerNumber)
+    RDF_EXPRESS_ATTR_ACCESSOR(1538, IfcTelecomAddress, 702, ElectronicMailAddresses)
+    RDF_EXPRESS_ATTR_ACCESSOR(1539, IfcTelecomAddress, 702, WWWHomePageURL)
+    RDF_EXPRESS_ATTR_ACCESSOR(1540, IfcTelecomAddress, 702, MessagingIDs)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTelecomAddress_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTendon_H
+#define __RDF_LTD__IFC4_IfcTendon_H
+
+#include    "classes/IfcTendon.h"
+#include    "IfcReinforcingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1541, IfcTendon, 703, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1542, IfcTendon, 703, NominalDiameter)
+    RDF_EXPRESS_ATTR_ACCESSOR(1543, IfcTendon, 703, CrossSectionArea)
+    RDF_EXPRESS_ATTR_ACCESSOR(1544, IfcTendon, 703, TensionForce)
+    RDF_EXPRESS_ATTR_ACCESSOR(1545, IfcTendon, 703, PreStress)
+    RDF_EXPRESS_ATTR_ACCESSOR(1546, IfcTendon, 703, FrictionCoefficient)
+    RDF_EXPRESS_ATTR_ACCESSOR(1547, IfcTendon, 703, AnchorageSlip)
+    RDF_EXPRESS_ATTR_ACCESSOR(1548, IfcTendon, 703, MinCurvatureRadius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTendon_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTendonAnchor_H
+#define __RDF_LTD__IFC4_IfcTendonAnchor_H
+
+#include    "classes/IfcTendonAnchor.h"
+#include    "IfcReinforcingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1549, IfcTendonAnchor, 704, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTendonAnchor_H
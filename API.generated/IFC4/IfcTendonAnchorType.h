@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTendonAnchorType_H
+#define __RDF_LTD__IFC4_IfcTendonAnchorType_H
+
+#include    "classes/IfcTendonAnchorType.h"
+#include    "IfcReinforcingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1550, IfcTendonAnchorType, 705, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTendonAnchorType_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTendonType_H
+#define __RDF_LTD__IFC4_IfcTendonType_H
+
+#include    "classes/IfcTendonType.h"
+#include    "IfcReinforcingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1551, IfcTendonType, 706, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1552, IfcTendonType, 706, NominalDiameter)
+    RDF_EXPRESS_ATTR_ACCESSOR(1553, IfcTendonType, 706, CrossSectionArea)
+    RDF_EXPRESS_ATTR_ACCESSOR(1554, IfcTendonType, 706, SheathDiameter)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTendonType_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTessellatedFaceSet_H
+#define __RDF_LTD__IFC4_IfcTessellatedFaceSet_H
+
+#include    "classes/IfcTessellatedFaceSet.h"
+#include    "IfcTessellatedItem.h"
+#include    "classes/IfcCartesianPointList3D.h"
+#include    "classes/IfcIndexedColourMap.h"
+#include    "classes/IfcIndexedTextureMap.h"
+
+namespace IFC4
+{
+    inline IfcCartesianPointList3D IfcTessellatedFaceSet::get_Coordinates() { RDF_EXPRESS_PROBE(1004); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1004), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcTessellatedFaceSet::put_Coordinates(IfcCartesianPointList3D inst) { RDF_EXPRESS_PROBE(1004); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1004), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1004, IfcTessellatedFaceSet, 707, Coordinates)
+    RDF_EXPRESS_ATTR_ACCESSOR(1005, IfcTessellatedFaceSet, 707, HasColours)
+    RDF_EXPRESS_ATTR_ACCESSOR(1006, IfcTessellatedFaceSet, 707, HasTextures)
+    RDF_EXPRESS_ATTR_ACCESSOR(1007, IfcTessellatedFaceSet, 707, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTessellatedFaceSet_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTessellatedItem_H
+#define __RDF_LTD__IFC4_IfcTessellatedItem_H
+
+#include    "classes/IfcTessellatedItem.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+#endif //__RDF_LTD__IFC4_IfcTessellatedItem_H
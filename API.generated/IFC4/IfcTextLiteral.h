@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextLiteral_H
+#define __RDF_LTD__IFC4_IfcTextLiteral_H
+
+#include    "classes/IfcTextLiteral.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "selects/IfcAxis2Placement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1555, IfcTextLiteral, 709, Literal)
+    RDF_EXPRESS_ATTR_ACCESSOR(1556, IfcTextLiteral, 709, Placement)
+    RDF_EXPRESS_ATTR_ACCESSOR(1557, IfcTextLiteral, 709, Path)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextLiteral_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextLiteralWithExtent_H
+#define __RDF_LTD__IFC4_IfcTextLiteralWithExtent_H
+
+#include    "classes/IfcTextLiteralWithExtent.h"
+#include    "IfcTextLiteral.h"
+#include    "classes/IfcPlanarExtent.h"
+
+namespace IFC4
+{
+    inline IfcPlanarExtent IfcTextLiteralWithExtent::get_Extent() { RDF_EXPRESS_PROBE(1558); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1558), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcTextLiteralWithExtent::put_Extent(IfcPlanarExtent inst) { RDF_EXPRESS_PROBE(1558); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1558), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1558, IfcTextLiteralWithExtent, 710, Extent)
+    RDF_EXPRESS_ATTR_ACCESSOR(1559, IfcTextLiteralWithExtent, 710, BoxAlignment)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextLiteralWithExtent_H
@@ -0,0 +1,25 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextStyle_H
+#define __RDF_LTD__IFC4_IfcTextStyle_H
+
+#include    "classes/IfcTextStyle.h"
+#include    "IfcPresentationStyle.h"
+#include    "classes/IfcTextStyleForDefinedFont.h"
+#include    "classes/IfcTextStyleTextModel.h"
+#include    "selects/IfcTextFontSelect.h"
+
+namespace IFC4
+{
+    inline IfcTextStyleForDefinedFont IfcTextStyle::get_TextCharacterAppearance() { RDF_EXPRESS_PROBE(1560); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1560), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcTextStyle::put_TextCharacterAppearance(IfcTextStyleForDefinedFont inst) { RDF_EXPRESS_PROBE(1560); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1560), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1560, IfcTextStyle, 711, TextCharacterAppearance)
+    inline IfcTextStyleTextModel IfcTextStyle::get_TextStyle() { RDF_EXPRESS_PROBE(1561); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1561), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcTextStyle::put_TextStyle(IfcTextStyleTextModel inst) { RDF_EXPRESS_PROBE(1561); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1561), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1561, IfcTextStyle, 711, TextStyle)
+    RDF_EXPRESS_ATTR_ACCESSOR(1562, IfcTextStyle, 711, TextFontStyle)
+    RDF_EXPRESS_ATTR_ACCESSOR(1563, IfcTextStyle, 711, ModelOrDraughting)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextStyle_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextStyleFontModel_H
+#define __RDF_LTD__IFC4_IfcTextStyleFontModel_H
+
+#include    "classes/IfcTextStyleFontModel.h"
+#include    "IfcPreDefinedTextFont.h"
+#include    "selects/IfcSizeSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1564, IfcTextStyleFontModel, 712, FontFamily)
+    RDF_EXPRESS_ATTR_ACCESSOR(1565, IfcTextStyleFontModel, 712, FontStyle)
+    RDF_EXPRESS_ATTR_ACCESSOR(1566, IfcTextStyleFontModel, 712, FontVariant)
+    RDF_EXPRESS_ATTR_ACCESSOR(1567, IfcTextStyleFontModel, 712, FontWeight)
+    RDF_EXPRESS_ATTR_ACCESSOR(1568, IfcTextStyleFontModel, 712, FontSize)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextStyleFontModel_H
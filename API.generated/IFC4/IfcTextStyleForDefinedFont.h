@@ -0,0 +1,17 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextStyleForDefinedFont_H
+#define __RDF_LTD__IFC4_IfcTextStyleForDefinedFont_H
+
+#include    "classes/IfcTextStyleForDefinedFont.h"
+#include    "IfcPresentationItem.h"
+#include    "selects/IfcColour.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1569, IfcTextStyleForDefinedFont, 713, Colour)
+    RDF_EXPRESS_ATTR_ACCESSOR(1570, IfcTextStyleForDefinedFont, 713, BackgroundColour)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextStyleForDefinedFont_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextStyleTextModel_H
+#define __RDF_LTD__IFC4_IfcTextStyleTextModel_H
+
+#include    "classes/IfcTextStyleTextModel.h"
+#include    "IfcPresentationItem.h"
+#include    "selects/IfcSizeSelect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1571, IfcTextStyleTextModel, 714, TextIndent)
+    RDF_EXPRESS_ATTR_ACCESSOR(1572, IfcTextStyleTextModel, 714, TextAlign)
+    RDF_EXPRESS_ATTR_ACCESSOR(1573, IfcTextStyleTextModel, 714, TextDecoration)
+    RDF_EXPRESS_ATTR_ACCESSOR(1574, IfcTextStyleTextModel, 714, LetterSpacing)
+    RDF_EXPRESS_ATTR_ACCESSOR(1575, IfcTextStyleTextModel, 714, WordSpacing)
+    RDF_EXPRESS_ATTR_ACCESSOR(1576, IfcTextStyleTextModel, 714, TextTransform)
+    RDF_EXPRESS_ATTR_ACCESSOR(1577, IfcTextStyleTextModel, 714, LineHeight)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextStyleTextModel_H
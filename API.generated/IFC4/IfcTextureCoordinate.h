@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextureCoordinate_H
+#define __RDF_LTD__IFC4_IfcTextureCoordinate_H
+
+#include    "classes/IfcTextureCoordinate.h"
+#include    "IfcPresentationItem.h"
+#include    "classes/IfcSurfaceTexture.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(724, IfcTextureCoordinate, 715, Maps)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextureCoordinate_H
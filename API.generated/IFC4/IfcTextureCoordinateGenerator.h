@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextureCoordinateGenerator_H
+#define __RDF_LTD__IFC4_IfcTextureCoordinateGenerator_H
+
+#include    "classes/IfcTextureCoordinateGenerator.h"
+#include    "IfcTextureCoordinate.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1578, IfcTextureCoordinateGenerator, 716, Mode)
+    RDF_EXPRESS_ATTR_ACCESSOR(1579, IfcTextureCoordinateGenerator, 716, Parameter)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextureCoordinateGenerator_H
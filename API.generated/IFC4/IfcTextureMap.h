@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextureMap_H
+#define __RDF_LTD__IFC4_IfcTextureMap_H
+
+#include    "classes/IfcTextureMap.h"
+#include    "IfcTextureCoordinate.h"
+#include    "classes/IfcFace.h"
+#include    "classes/IfcTextureVertex.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1580, IfcTextureMap, 717, Vertices)
+    inline IfcFace IfcTextureMap::get_MappedTo() { RDF_EXPRESS_PROBE(1581); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1581), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcTextureMap::put_MappedTo(IfcFace inst) { RDF_EXPRESS_PROBE(1581); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1581), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1581, IfcTextureMap, 717, MappedTo)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextureMap_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextureVertex_H
+#define __RDF_LTD__IFC4_IfcTextureVertex_H
+
+#include    "classes/IfcTextureVertex.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1582, IfcTextureVertex, 718, Coordinates)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextureVertex_H
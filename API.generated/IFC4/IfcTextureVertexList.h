@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextureVertexList_H
+#define __RDF_LTD__IFC4_IfcTextureVertexList_H
+
+#include    "classes/IfcTextureVertexList.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1583, IfcTextureVertexList, 719, TexCoordsList)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextureVertexList_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTimePeriod_H
+#define __RDF_LTD__IFC4_IfcTimePeriod_H
+
+#include    "classes/IfcTimePeriod.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1584, IfcTimePeriod, 720, StartTime)
+    RDF_EXPRESS_ATTR_ACCESSOR(1585, IfcTimePeriod, 720, EndTime)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTimePeriod_H
@@ -0,0 +1,24 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTimeSeries_H
+#define __RDF_LTD__IFC4_IfcTimeSeries_H
+
+#include    "classes/IfcTimeSeries.h"
+#include    "classes/IfcExternalReferenceRelationship.h"
+#include    "selects/IfcUnit.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(740, IfcTimeSeries, 721, Name)
+    RDF_EXPRESS_ATTR_ACCESSOR(741, IfcTimeSeries, 721, Description)
+    RDF_EXPRESS_ATTR_ACCESSOR(742, IfcTimeSeries, 721, StartTime)
+    RDF_EXPRESS_ATTR_ACCESSOR(743, IfcTimeSeries, 721, EndTime)
+    RDF_EXPRESS_ATTR_ACCESSOR(744, IfcTimeSeries, 721, TimeSeriesDataType)
+    RDF_EXPRESS_ATTR_ACCESSOR(745, IfcTimeSeries, 721, DataOrigin)
+    RDF_EXPRESS_ATTR_ACCESSOR(746, IfcTimeSeries, 721, UserDefinedDataOrigin)
+    RDF_EXPRESS_ATTR_ACCESSOR(747, IfcTimeSeries, 721, Unit)
+    RDF_EXPRESS_ATTR_ACCESSOR(748, IfcTimeSeries, 721, HasExternalReference)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTimeSeries_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTimeSeriesValue_H
+#define __RDF_LTD__IFC4_IfcTimeSeriesValue_H
+
+#include    "classes/IfcTimeSeriesValue.h"
+#include    "selects/IfcValue.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1586, IfcTimeSeriesValue, 722, ListValues)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTimeSeriesValue_H
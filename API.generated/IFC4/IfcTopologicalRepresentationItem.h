@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTopologicalRepresentationItem_H
+#define __RDF_LTD__IFC4_IfcTopologicalRepresentationItem_H
+
+#include    "classes/IfcTopologicalRepresentationItem.h"
+#include    "IfcRepresentationItem.h"
+
+#endif //__RDF_LTD__IFC4_IfcTopologicalRepresentationItem_H
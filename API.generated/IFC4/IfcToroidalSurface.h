@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcToroidalSurface_H
+#define __RDF_LTD__IFC4_IfcToroidalSurface_H
+
+#include    "classes/IfcToroidalSurface.h"
+#include    "IfcElementarySurface.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1587, IfcToroidalSurface, 725, MajorRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(1588, IfcToroidalSurface, 725, MinorRadius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcToroidalSurface_H
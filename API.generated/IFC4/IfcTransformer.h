@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTransformer_H
+#define __RDF_LTD__IFC4_IfcTransformer_H
+
+#include    "classes/IfcTransformer.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1589, IfcTransformer, 726, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTransformer_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTransformerType_H
+#define __RDF_LTD__IFC4_IfcTransformerType_H
+
+#include    "classes/IfcTransformerType.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1590, IfcTransformerType, 727, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTransformerType_H
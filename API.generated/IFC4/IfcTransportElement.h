@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTransportElement_H
+#define __RDF_LTD__IFC4_IfcTransportElement_H
+
+#include    "classes/IfcTransportElement.h"
+#include    "IfcElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1591, IfcTransportElement, 728, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTransportElement_H
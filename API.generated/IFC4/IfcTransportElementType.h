@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTransportElementType_H
+#define __RDF_LTD__IFC4_IfcTransportElementType_H
+
+#include    "classes/IfcTransportElementType.h"
+#include    "IfcElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1592, IfcTransportElementType, 729, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTransportElementType_H
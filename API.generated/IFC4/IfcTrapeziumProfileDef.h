@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTrapeziumProfileDef_H
+#define __RDF_LTD__IFC4_IfcTrapeziumProfileDef_H
+
+#include    "classes/IfcTrapeziumProfileDef.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1593, IfcTrapeziumProfileDef, 730, BottomXDim)
+    RDF_EXPRESS_ATTR_ACCESSOR(1594, IfcTrapeziumProfileDef, 730, TopXDim)
+    RDF_EXPRESS_ATTR_ACCESSOR(1595, IfcTrapeziumProfileDef, 730, YDim)
+    RDF_EXPRESS_ATTR_ACCESSOR(1596, IfcTrapeziumProfileDef, 730, TopXOffset)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTrapeziumProfileDef_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTriangulatedFaceSet_H
+#define __RDF_LTD__IFC4_IfcTriangulatedFaceSet_H
+
+#include    "classes/IfcTriangulatedFaceSet.h"
+#include    "IfcTessellatedFaceSet.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1597, IfcTriangulatedFaceSet, 731, Normals)
+    RDF_EXPRESS_ATTR_ACCESSOR(1598, IfcTriangulatedFaceSet, 731, Closed)
+    RDF_EXPRESS_ATTR_ACCESSOR(1599, IfcTriangulatedFaceSet, 731, CoordIndex)
+    RDF_EXPRESS_ATTR_ACCESSOR(1600, IfcTriangulatedFaceSet, 731, PnIndex)
+    RDF_EXPRESS_ATTR_ACCESSOR(1601, IfcTriangulatedFaceSet, 731, NumberOfTriangles)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTriangulatedFaceSet_H
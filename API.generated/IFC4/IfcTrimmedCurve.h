@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTrimmedCurve_H
+#define __RDF_LTD__IFC4_IfcTrimmedCurve_H
+
+#include    "classes/IfcTrimmedCurve.h"
+#include    "IfcBoundedCurve.h"
+#include    "classes/IfcCurve.h"
+#include    "selects/IfcTrimmingSelect.h"
+
+namespace IFC4
+{
+    inline IfcCurve IfcTrimmedCurve::get_BasisCurve() { RDF_EXPRESS_PROBE(1602); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1602), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcTrimmedCurve::put_BasisCurve(IfcCurve inst) { RDF_EXPRESS_PROBE(1602); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1602), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1602, IfcTrimmedCurve, 732, BasisCurve)
+    RDF_EXPRESS_ATTR_ACCESSOR(1603, IfcTrimmedCurve, 732, Trim1)
+    RDF_EXPRESS_ATTR_ACCESSOR(1604, IfcTrimmedCurve, 732, Trim2)
+    RDF_EXPRESS_ATTR_ACCESSOR(1605, IfcTrimmedCurve, 732, SenseAgreement)
+    RDF_EXPRESS_ATTR_ACCESSOR(1606, IfcTrimmedCurve, 732, MasterRepresentation)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTrimmedCurve_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTubeBundle_H
+#define __RDF_LTD__IFC4_IfcTubeBundle_H
+
+#include    "classes/IfcTubeBundle.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1616, IfcTubeBundle, 734, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTubeBundle_H
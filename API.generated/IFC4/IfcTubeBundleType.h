@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTubeBundleType_H
+#define __RDF_LTD__IFC4_IfcTubeBundleType_H
+
+#include    "classes/IfcTubeBundleType.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1617, IfcTubeBundleType, 735, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTubeBundleType_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTypeObject_H
+#define __RDF_LTD__IFC4_IfcTypeObject_H
+
+#include    "classes/IfcTypeObject.h"
+#include    "IfcObjectDefinition.h"
+#include    "classes/IfcPropertySetDefinition.h"
+#include    "classes/IfcRelDefinesByType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(46, IfcTypeObject, 736, ApplicableOccurrence)
+    RDF_EXPRESS_ATTR_ACCESSOR(47, IfcTypeObject, 736, HasPropertySets)
+    RDF_EXPRESS_ATTR_ACCESSOR(48, IfcTypeObject, 736, Types)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTypeObject_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTypeProcess_H
+#define __RDF_LTD__IFC4_IfcTypeProcess_H
+
+#include    "classes/IfcTypeProcess.h"
+#include    "IfcTypeObject.h"
+#include    "classes/IfcRelAssignsToProcess.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(612, IfcTypeProcess, 737, Identification)
+    RDF_EXPRESS_ATTR_ACCESSOR(613, IfcTypeProcess, 737, LongDescription)
+    RDF_EXPRESS_ATTR_ACCESSOR(614, IfcTypeProcess, 737, ProcessType)
+    RDF_EXPRESS_ATTR_ACCESSOR(615, IfcTypeProcess, 737, OperatesOn)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTypeProcess_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTypeProduct_H
+#define __RDF_LTD__IFC4_IfcTypeProduct_H
+
+#include    "classes/IfcTypeProduct.h"
+#include    "IfcTypeObject.h"
+#include    "classes/IfcRelAssignsToProduct.h"
+#include    "classes/IfcRepresentationMap.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(49, IfcTypeProduct, 738, RepresentationMaps)
+    RDF_EXPRESS_ATTR_ACCESSOR(50, IfcTypeProduct, 738, Tag)
+    RDF_EXPRESS_ATTR_ACCESSOR(51, IfcTypeProduct, 738, ReferencedBy)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTypeProduct_H
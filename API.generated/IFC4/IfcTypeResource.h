@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTypeResource_H
+#define __RDF_LTD__IFC4_IfcTypeResource_H
+
+#include    "classes/IfcTypeResource.h"
+#include    "IfcTypeObject.h"
+#include    "classes/IfcRelAssignsToResource.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(378, IfcTypeResource, 739, Identification)
+    RDF_EXPRESS_ATTR_ACCESSOR(379, IfcTypeResource, 739, LongDescription)
+    RDF_EXPRESS_ATTR_ACCESSOR(380, IfcTypeResource, 739, ResourceType)
+    RDF_EXPRESS_ATTR_ACCESSOR(381, IfcTypeResource, 739, ResourceOf)
+}
+
+#endif //__RDF_LTD__IFC4_IfcTypeResource_H
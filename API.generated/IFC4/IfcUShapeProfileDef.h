@@ -0,0 +1,21 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcUShapeProfileDef_H
+#define __RDF_LTD__IFC4_IfcUShapeProfileDef_H
+
+#include    "classes/IfcUShapeProfileDef.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1623, IfcUShapeProfileDef, 745, Depth)
+    RDF_EXPRESS_ATTR_ACCESSOR(1624, IfcUShapeProfileDef, 745, FlangeWidth)
+    RDF_EXPRESS_ATTR_ACCESSOR(1625, IfcUShapeProfileDef, 745, WebThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(1626, IfcUShapeProfileDef, 745, FlangeThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(1627, IfcUShapeProfileDef, 745, FilletRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(1628, IfcUShapeProfileDef, 745, EdgeRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(1629, IfcUShapeProfileDef, 745, FlangeSlope)
+}
+
+#endif //__RDF_LTD__IFC4_IfcUShapeProfileDef_H
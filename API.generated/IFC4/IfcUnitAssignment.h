@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcUnitAssignment_H
+#define __RDF_LTD__IFC4_IfcUnitAssignment_H
+
+#include    "classes/IfcUnitAssignment.h"
+#include    "selects/IfcUnit.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1622, IfcUnitAssignment, 744, Units)
+}
+
+#endif //__RDF_LTD__IFC4_IfcUnitAssignment_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcUnitaryControlElement_H
+#define __RDF_LTD__IFC4_IfcUnitaryControlElement_H
+
+#include    "classes/IfcUnitaryControlElement.h"
+#include    "IfcDistributionControlElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1618, IfcUnitaryControlElement, 740, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcUnitaryControlElement_H
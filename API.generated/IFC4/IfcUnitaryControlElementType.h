@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcUnitaryControlElementType_H
+#define __RDF_LTD__IFC4_IfcUnitaryControlElementType_H
+
+#include    "classes/IfcUnitaryControlElementType.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1619, IfcUnitaryControlElementType, 741, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcUnitaryControlElementType_H
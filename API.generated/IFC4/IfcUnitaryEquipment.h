@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcUnitaryEquipment_H
+#define __RDF_LTD__IFC4_IfcUnitaryEquipment_H
+
+#include    "classes/IfcUnitaryEquipment.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1620, IfcUnitaryEquipment, 742, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcUnitaryEquipment_H
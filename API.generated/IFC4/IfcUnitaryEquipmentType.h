@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcUnitaryEquipmentType_H
+#define __RDF_LTD__IFC4_IfcUnitaryEquipmentType_H
+
+#include    "classes/IfcUnitaryEquipmentType.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1621, IfcUnitaryEquipmentType, 743, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcUnitaryEquipmentType_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcValve_H
+#define __RDF_LTD__IFC4_IfcValve_H
+
+#include    "classes/IfcValve.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1630, IfcValve, 746, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcValve_H
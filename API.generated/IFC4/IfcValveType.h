@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcValveType_H
+#define __RDF_LTD__IFC4_IfcValveType_H
+
+#include    "classes/IfcValveType.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1631, IfcValveType, 747, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcValveType_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVector_H
+#define __RDF_LTD__IFC4_IfcVector_H
+
+#include    "classes/IfcVector.h"
+#include    "IfcGeometricRepresentationItem.h"
+#include    "classes/IfcDirection.h"
+
+namespace IFC4
+{
+    inline IfcDirection IfcVector::get_Orientation() { RDF_EXPRESS_PROBE(1632); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1632), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcVector::put_Orientation(IfcDirection inst) { RDF_EXPRESS_PROBE(1632); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1632), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1632, IfcVector, 748, Orientation)
+    RDF_EXPRESS_ATTR_ACCESSOR(1633, IfcVector, 748, Magnitude)
+    RDF_EXPRESS_ATTR_ACCESSOR(1634, IfcVector, 748, Dim)
+}
+
+#endif //__RDF_LTD__IFC4_IfcVector_H
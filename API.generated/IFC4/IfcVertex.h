@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVertex_H
+#define __RDF_LTD__IFC4_IfcVertex_H
+
+#include    "classes/IfcVertex.h"
+#include    "IfcTopologicalRepresentationItem.h"
+
+#endif //__RDF_LTD__IFC4_IfcVertex_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVertexLoop_H
+#define __RDF_LTD__IFC4_IfcVertexLoop_H
+
+#include    "classes/IfcVertexLoop.h"
+#include    "IfcLoop.h"
+#include    "classes/IfcVertex.h"
+
+namespace IFC4
+{
+    inline IfcVertex IfcVertexLoop::get_LoopVertex() { RDF_EXPRESS_PROBE(1635); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1635), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcVertexLoop::put_LoopVertex(IfcVertex inst) { RDF_EXPRESS_PROBE(1635); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1635), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1635, IfcVertexLoop, 750, LoopVertex)
+}
+
+#endif //__RDF_LTD__IFC4_IfcVertexLoop_H
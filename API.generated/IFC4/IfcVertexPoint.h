@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVertexPoint_H
+#define __RDF_LTD__IFC4_IfcVertexPoint_H
+
+#include    "classes/IfcVertexPoint.h"
+#include    "IfcVertex.h"
+#include    "classes/IfcPoint.h"
+
+namespace IFC4
+{
+    inline IfcPoint IfcVertexPoint::get_VertexGeometry() { RDF_EXPRESS_PROBE(1636); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1636), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcVertexPoint::put_VertexGeometry(IfcPoint inst) { RDF_EXPRESS_PROBE(1636); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1636), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1636, IfcVertexPoint, 751, VertexGeometry)
+}
+
+#endif //__RDF_LTD__IFC4_IfcVertexPoint_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVibrationIsolator_H
+#define __RDF_LTD__IFC4_IfcVibrationIsolator_H
+
+#include    "classes/IfcVibrationIsolator.h"
+#include    "IfcElementComponent.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1637, IfcVibrationIsolator, 752, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcVibrationIsolator_H
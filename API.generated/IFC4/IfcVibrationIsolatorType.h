@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVibrationIsolatorType_H
+#define __RDF_LTD__IFC4_IfcVibrationIsolatorType_H
+
+#include    "classes/IfcVibrationIsolatorType.h"
+#include    "IfcElementComponentType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1638, IfcVibrationIsolatorType, 753, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcVibrationIsolatorType_H
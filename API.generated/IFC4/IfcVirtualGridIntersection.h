@@ -0,0 +1,16 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVirtualGridIntersection_H
+#define __RDF_LTD__IFC4_IfcVirtualGridIntersection_H
+
+#include    "classes/IfcVirtualGridIntersection.h"
+#include    "classes/IfcGridAxis.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1639, IfcVirtualGridIntersection, 755, IntersectingAxes)
+    RDF_EXPRESS_ATTR_ACCESSOR(1640, IfcVirtualGridIntersection, 755, OffsetDistances)
+}
+
+#endif //__RDF_LTD__IFC4_IfcVirtualGridIntersection_H
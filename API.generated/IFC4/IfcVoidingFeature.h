@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVoidingFeature_H
+#define __RDF_LTD__IFC4_IfcVoidingFeature_H
+
+#include    "classes/IfcVoidingFeature.h"
+#include    "IfcFeatureElementSubtraction.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1641, IfcVoidingFeature, 756, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcVoidingFeature_H
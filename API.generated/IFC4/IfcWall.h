@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWall_H
+#define __RDF_LTD__IFC4_IfcWall_H
+
+#include    "classes/IfcWall.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1642, IfcWall, 757, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcWall_H
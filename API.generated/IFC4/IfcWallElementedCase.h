@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWallElementedCase_H
+#define __RDF_LTD__IFC4_IfcWallElementedCase_H
+
+#include    "classes/IfcWallElementedCase.h"
+#include    "IfcWall.h"
+
+#endif //__RDF_LTD__IFC4_IfcWallElementedCase_H
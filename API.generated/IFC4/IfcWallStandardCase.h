@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWallStandardCase_H
+#define __RDF_LTD__IFC4_IfcWallStandardCase_H
+
+#include    "classes/IfcWallStandardCase.h"
+#include    "IfcWall.h"
+
+#endif //__RDF_LTD__IFC4_IfcWallStandardCase_H
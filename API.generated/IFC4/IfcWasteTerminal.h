@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWasteTerminal_H
+#define __RDF_LTD__IFC4_IfcWasteTerminal_H
+
+#include    "classes/IfcWasteTerminal.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1644, IfcWasteTerminal, 761, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcWasteTerminal_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWasteTerminalType_H
+#define __RDF_LTD__IFC4_IfcWasteTerminalType_H
+
+#include    "classes/IfcWasteTerminalType.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1645, IfcWasteTerminalType, 762, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcWasteTerminalType_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWindow_H
+#define __RDF_LTD__IFC4_IfcWindow_H
+
+#include    "classes/IfcWindow.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1646, IfcWindow, 763, OverallHeight)
+    RDF_EXPRESS_ATTR_ACCESSOR(1647, IfcWindow, 763, OverallWidth)
+    RDF_EXPRESS_ATTR_ACCESSOR(1648, IfcWindow, 763, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1649, IfcWindow, 763, PartitioningType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1650, IfcWindow, 763, UserDefinedPartitioningType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcWindow_H
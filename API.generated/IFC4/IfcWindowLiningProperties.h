@@ -0,0 +1,29 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWindowLiningProperties_H
+#define __RDF_LTD__IFC4_IfcWindowLiningProperties_H
+
+#include    "classes/IfcWindowLiningProperties.h"
+#include    "IfcPreDefinedPropertySet.h"
+#include    "classes/IfcShapeAspect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1651, IfcWindowLiningProperties, 764, LiningDepth)
+    RDF_EXPRESS_ATTR_ACCESSOR(1652, IfcWindowLiningProperties, 764, LiningThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(1653, IfcWindowLiningProperties, 764, TransomThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(1654, IfcWindowLiningProperties, 764, MullionThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(1655, IfcWindowLiningProperties, 764, FirstTransomOffset)
+    RDF_EXPRESS_ATTR_ACCESSOR(1656, IfcWindowLiningProperties, 764, SecondTransomOffset)
+    RDF_EXPRESS_ATTR_ACCESSOR(1657, IfcWindowLiningProperties, 764, FirstMullionOffset)
+    RDF_EXPRESS_ATTR_ACCESSOR(1658, IfcWindowLiningProperties, 764, SecondMullionOffset)
+    inline IfcShapeAspect IfcWindowLiningProperties::get_ShapeAspectStyle() { RDF_EXPRESS_PROBE(1659); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1659), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcWindowLiningProperties::put_ShapeAspectStyle(IfcShapeAspect inst) { RDF_EXPRESS_PROBE(1659); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1659), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1659, IfcWindowLiningProperties, 764, ShapeAspectStyle)
+    RDF_EXPRESS_ATTR_ACCESSOR(1660, IfcWindowLiningProperties, 764, LiningOffset)
+    RDF_EXPRESS_ATTR_ACCESSOR(1661, IfcWindowLiningProperties, 764, LiningToPanelOffsetX)
+    RDF_EXPRESS_ATTR_ACCESSOR(1662, IfcWindowLiningProperties, 764, LiningToPanelOffsetY)
+}
+
+#endif //__RDF_LTD__IFC4_IfcWindowLiningProperties_H
@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWindowPanelProperties_H
+#define __RDF_LTD__IFC4_IfcWindowPanelProperties_H
+
+#include    "classes/IfcWindowPanelProperties.h"
+#include    "IfcPreDefinedPropertySet.h"
+#include    "classes/IfcShapeAspect.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1663, IfcWindowPanelProperties, 765, OperationType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1664, IfcWindowPanelProperties, 765, PanelPosition)
+    RDF_EXPRESS_ATTR_ACCESSOR(1665, IfcWindowPanelProperties, 765, FrameDepth)
+    RDF_EXPRESS_ATTR_ACCESSOR(1666, IfcWindowPanelProperties, 765, FrameThickness)
+    inline IfcShapeAspect IfcWindowPanelProperties::get_ShapeAspectStyle() { RDF_EXPRESS_PROBE(1667); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1667), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcWindowPanelProperties::put_ShapeAspectStyle(IfcShapeAspect inst) { RDF_EXPRESS_PROBE(1667); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1667), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1667, IfcWindowPanelProperties, 765, ShapeAspectStyle)
+}
+
+#endif //__RDF_LTD__IFC4_IfcWindowPanelProperties_H
@@ -0,0 +1,10 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWindowStandardCase_H
+#define __RDF_LTD__IFC4_IfcWindowStandardCase_H
+
+#include    "classes/IfcWindowStandardCase.h"
+#include    "IfcWindow.h"
+
+#endif //__RDF_LTD__IFC4_IfcWindowStandardCase_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWindowStyle_H
+#define __RDF_LTD__IFC4_IfcWindowStyle_H
+
+#include    "classes/IfcWindowStyle.h"
+#include    "IfcTypeProduct.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1668, IfcWindowStyle, 767, ConstructionType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1669, IfcWindowStyle, 767, OperationType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1670, IfcWindowStyle, 767, ParameterTakesPrecedence)
+    RDF_EXPRESS_ATTR_ACCESSOR(1671, IfcWindowStyle, 767, Sizeable)
+}
+
+#endif //__RDF_LTD__IFC4_IfcWindowStyle_H
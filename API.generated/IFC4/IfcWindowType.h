@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWindowType_H
+#define __RDF_LTD__IFC4_IfcWindowType_H
+
+#include    "classes/IfcWindowType.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1672, IfcWindowType, 768, PredefinedType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1673, IfcWindowType, 768, PartitioningType)
+    RDF_EXPRESS_ATTR_ACCESSOR(1674, IfcWindowType, 768, ParameterTakesPrecedence)
+    RDF_EXPRESS_ATTR_ACCESSOR(1675, IfcWindowType, 768, UserDefinedPartitioningType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcWindowType_H
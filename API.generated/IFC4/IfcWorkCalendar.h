@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWorkCalendar_H
+#define __RDF_LTD__IFC4_IfcWorkCalendar_H
+
+#include    "classes/IfcWorkCalendar.h"
+#include    "IfcControl.h"
+#include    "classes/IfcWorkTime.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1676, IfcWorkCalendar, 769, WorkingTimes)
+    RDF_EXPRESS_ATTR_ACCESSOR(1677, IfcWorkCalendar, 769, ExceptionTimes)
+    RDF_EXPRESS_ATTR_ACCESSOR(1678, IfcWorkCalendar, 769, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcWorkCalendar_H
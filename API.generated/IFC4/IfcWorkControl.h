@@ -0,0 +1,22 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWorkControl_H
+#define __RDF_LTD__IFC4_IfcWorkControl_H
+
+#include    "classes/IfcWorkControl.h"
+#include    "IfcControl.h"
+#include    "classes/IfcPerson.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1679, IfcWorkControl, 770, CreationDate)
+    RDF_EXPRESS_ATTR_ACCESSOR(1680, IfcWorkControl, 770, Creators)
+    RDF_EXPRESS_ATTR_ACCESSOR(1681, IfcWorkControl, 770, Purpose)
+    RDF_EXPRESS_ATTR_ACCESSOR(1682, IfcWorkControl, 770, Duration)
+    RDF_EXPRESS_ATTR_ACCESSOR(1683, IfcWorkControl, 770, TotalFloat)
+    RDF_EXPRESS_ATTR_ACCESSOR(1684, IfcWorkControl, 770, StartTime)
+    RDF_EXPRESS_ATTR_ACCESSOR(1685, IfcWorkControl, 770, FinishTime)
+}
+
+#endif //__RDF_LTD__IFC4_IfcWorkControl_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWorkPlan_H
+#define __RDF_LTD__IFC4_IfcWorkPlan_H
+
+#include    "classes/IfcWorkPlan.h"
+#include    "IfcWorkControl.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1686, IfcWorkPlan, 771, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcWorkPlan_H
@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWorkSchedule_H
+#define __RDF_LTD__IFC4_IfcWorkSchedule_H
+
+#include    "classes/IfcWorkSchedule.h"
+#include    "IfcWorkControl.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1687, IfcWorkSchedule, 772, PredefinedType)
+}
+
+#endif //__RDF_LTD__IFC4_IfcWorkSchedule_H
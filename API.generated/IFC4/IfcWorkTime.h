@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWorkTime_H
+#define __RDF_LTD__IFC4_IfcWorkTime_H
+
+#include    "classes/IfcWorkTime.h"
+#include    "IfcSchedulingTime.h"
+#include    "classes/IfcRecurrencePattern.h"
+
+namespace IFC4
+{
+    inline IfcRecurrencePattern IfcWorkTime::get_RecurrencePattern() { RDF_EXPRESS_PROBE(1688); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(1688), sdaiINSTANCE, &inst); return inst; }
+    inline void IfcWorkTime::put_RecurrencePattern(IfcRecurrencePattern inst) { RDF_EXPRESS_PROBE(1688); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(1688), sdaiINSTANCE, (void*) i); }
+    RDF_EXPRESS_ATTR_ACCESSOR(1688, IfcWorkTime, 773, RecurrencePattern)
+    RDF_EXPRESS_ATTR_ACCESSOR(1689, IfcWorkTime, 773, Start)
+    RDF_EXPRESS_ATTR_ACCESSOR(1690, IfcWorkTime, 773, Finish)
+}
+
+#endif //__RDF_LTD__IFC4_IfcWorkTime_H
@@ -0,0 +1,20 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcZShapeProfileDef_H
+#define __RDF_LTD__IFC4_IfcZShapeProfileDef_H
+
+#include    "classes/IfcZShapeProfileDef.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1692, IfcZShapeProfileDef, 775, Depth)
+    RDF_EXPRESS_ATTR_ACCESSOR(1693, IfcZShapeProfileDef, 775, FlangeWidth)
+    RDF_EXPRESS_ATTR_ACCESSOR(1694, IfcZShapeProfileDef, 775, WebThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(1695, IfcZShapeProfileDef, 775, FlangeThickness)
+    RDF_EXPRESS_ATTR_ACCESSOR(1696, IfcZShapeProfileDef, 775, FilletRadius)
+    RDF_EXPRESS_ATTR_ACCESSOR(1697, IfcZShapeProfileDef, 775, EdgeRadius)
+}
+
+#endif //__RDF_LTD__IFC4_IfcZShapeProfileDef_H
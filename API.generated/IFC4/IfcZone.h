@@ -0,0 +1,15 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcZone_H
+#define __RDF_LTD__IFC4_IfcZone_H
+
+#include    "classes/IfcZone.h"
+#include    "IfcSystem.h"
+
+namespace IFC4
+{
+    RDF_EXPRESS_ATTR_ACCESSOR(1691, IfcZone, 774, LongName)
+}
+
+#endif //__RDF_LTD__IFC4_IfcZone_H
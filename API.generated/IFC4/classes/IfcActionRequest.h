@@ -0,0 +1,86 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcActionRequest_CLASS_H
+#define __RDF_LTD__IFC4_IfcActionRequest_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcControl.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcActionRequest
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcActionRequest : public RDF_EXPRESS_VIRTUAL IfcControl
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcActionRequest
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcActionRequest(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 0);
+        }
+
+        /// <summary>
+        /// Instances of IfcActionRequest in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcActionRequest> Extent(SdaiModel model) { return ExtentRange<IfcActionRequest>(model, 0, false); }
+        static ExtentRange<IfcActionRequest> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcActionRequest>(model, 0, true); }
+
+        /// <summary>
+        /// Create new instance of IfcActionRequest and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcActionRequest Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcActionRequest"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcActionRequest if the actual type of SdaiInstance is IfcActionRequest or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcActionRequest CreateExactEntity(SdaiInstance instance) { return IfcActionRequest(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcActionRequest or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcActionRequest(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcActionRequestTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(18); int v = getENUM(18, IfcActionRequestTypeEnum_hash); if (v >= 0) return (IfcActionRequestTypeEnum) v; else return Nullable<IfcActionRequestTypeEnum>(); }
+        void put_PredefinedType(IfcActionRequestTypeEnum value) { RDF_EXPRESS_PROBE(18); TextValue val = IfcActionRequestTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(18), sdaiENUM, val); }
+
+        IfcLabel get_Status() { RDF_EXPRESS_PROBE(19); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(19), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Status_view() { return TextView(get_Status()); }
+#endif
+        void put_Status(IfcLabel value) { RDF_EXPRESS_PROBE(19); sdaiPutAttr(m_instance, getAttrDefinition(19), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Status_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(19); return buffer.GetAttr(m_instance, "Status"); }
+        const char* get_Status_utf8() { return get_Status_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_LongDescription() { RDF_EXPRESS_PROBE(20); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(20), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LongDescription_view() { return TextView(get_LongDescription()); }
+#endif
+        void put_LongDescription(IfcText value) { RDF_EXPRESS_PROBE(20); sdaiPutAttr(m_instance, getAttrDefinition(20), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LongDescription_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(20); return buffer.GetAttr(m_instance, "LongDescription"); }
+        const char* get_LongDescription_utf8() { return get_LongDescription_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcControl::attr
+        {
+            static constexpr IntValue PredefinedType = 18;
+            static constexpr IntValue Status = 19;
+            static constexpr IntValue LongDescription = 20;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcActionRequest_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcActor_CLASS_H
+#define __RDF_LTD__IFC4_IfcActor_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcObject.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcActor
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcActor : public RDF_EXPRESS_VIRTUAL IfcObject
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcActor
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcActor(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 1);
+        }
+
+        /// <summary>
+        /// Instances of IfcActor in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcActor> Extent(SdaiModel model) { return ExtentRange<IfcActor>(model, 1, false); }
+        static ExtentRange<IfcActor> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcActor>(model, 1, true); }
+
+        /// <summary>
+        /// Create new instance of IfcActor and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcActor Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcActor"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcActor if the actual type of SdaiInstance is IfcActor or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcActor CreateExactEntity(SdaiInstance instance) { return IfcActor(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcActor or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcActor(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcActorSelect_get get_TheActor() { return IfcActorSelect_get(m_instance, 21); }
+        IfcActorSelect_put put_TheActor() { return IfcActorSelect_put(m_instance, 21); }
+
+        //TList may be SetOfIfcRelAssignsToActor or list of convertible elements
+        template <typename TList> void get_IsActingUpon(TList& lst) { RDF_EXPRESS_PROBE(22); SetOfIfcRelAssignsToActorSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(22)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcObject::attr
+        {
+            static constexpr IntValue TheActor = 21;
+            static constexpr IntValue IsActingUpon = 22;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcActor_CLASS_H
@@ -0,0 +1,89 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcActorRole_CLASS_H
+#define __RDF_LTD__IFC4_IfcActorRole_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcActorRole
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcActorRole : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcActorRole
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcActorRole(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 2);
+        }
+
+        /// <summary>
+        /// Instances of IfcActorRole in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcActorRole> Extent(SdaiModel model) { return ExtentRange<IfcActorRole>(model, 2, false); }
+        static ExtentRange<IfcActorRole> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcActorRole>(model, 2, true); }
+
+        /// <summary>
+        /// Create new instance of IfcActorRole and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcActorRole Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcActorRole"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcActorRole if the actual type of SdaiInstance is IfcActorRole or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcActorRole CreateExactEntity(SdaiInstance instance) { return IfcActorRole(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcActorRole or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcActorRole(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcRoleEnum> get_Role() { RDF_EXPRESS_PROBE(23); int v = getENUM(23, IfcRoleEnum_hash); if (v >= 0) return (IfcRoleEnum) v; else return Nullable<IfcRoleEnum>(); }
+        void put_Role(IfcRoleEnum value) { RDF_EXPRESS_PROBE(23); TextValue val = IfcRoleEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(23), sdaiENUM, val); }
+
+        IfcLabel get_UserDefinedRole() { RDF_EXPRESS_PROBE(24); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(24), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedRole_view() { return TextView(get_UserDefinedRole()); }
+#endif
+        void put_UserDefinedRole(IfcLabel value) { RDF_EXPRESS_PROBE(24); sdaiPutAttr(m_instance, getAttrDefinition(24), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedRole_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(24); return buffer.GetAttr(m_instance, "UserDefinedRole"); }
+        const char* get_UserDefinedRole_utf8() { return get_UserDefinedRole_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(25); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(25), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(25); sdaiPutAttr(m_instance, getAttrDefinition(25), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(25); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcExternalReferenceRelationship or list of convertible elements
+        template <typename TList> void get_HasExternalReference(TList& lst) { RDF_EXPRESS_PROBE(26); SetOfIfcExternalReferenceRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(26)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Role = 23;
+            static constexpr IntValue UserDefinedRole = 24;
+            static constexpr IntValue Description = 25;
+            static constexpr IntValue HasExternalReference = 26;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcActorRole_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcActuator_CLASS_H
+#define __RDF_LTD__IFC4_IfcActuator_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcActuator
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcActuator : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcActuator
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcActuator(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 3);
+        }
+
+        /// <summary>
+        /// Instances of IfcActuator in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcActuator> Extent(SdaiModel model) { return ExtentRange<IfcActuator>(model, 3, false); }
+        static ExtentRange<IfcActuator> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcActuator>(model, 3, true); }
+
+        /// <summary>
+        /// Create new instance of IfcActuator and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcActuator Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcActuator"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcActuator if the actual type of SdaiInstance is IfcActuator or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcActuator CreateExactEntity(SdaiInstance instance) { return IfcActuator(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcActuator or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcActuator(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcActuatorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(45); int v = getENUM(45, IfcActuatorTypeEnum_hash); if (v >= 0) return (IfcActuatorTypeEnum) v; else return Nullable<IfcActuatorTypeEnum>(); }
+        void put_PredefinedType(IfcActuatorTypeEnum value) { RDF_EXPRESS_PROBE(45); TextValue val = IfcActuatorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(45), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElement::attr
+        {
+            static constexpr IntValue PredefinedType = 45;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcActuator_CLASS_H
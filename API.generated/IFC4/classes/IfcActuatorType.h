@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcActuatorType_CLASS_H
+#define __RDF_LTD__IFC4_IfcActuatorType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcActuatorType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcActuatorType : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcActuatorType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcActuatorType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 4);
+        }
+
+        /// <summary>
+        /// Instances of IfcActuatorType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcActuatorType> Extent(SdaiModel model) { return ExtentRange<IfcActuatorType>(model, 4, false); }
+        static ExtentRange<IfcActuatorType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcActuatorType>(model, 4, true); }
+
+        /// <summary>
+        /// Create new instance of IfcActuatorType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcActuatorType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcActuatorType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcActuatorType if the actual type of SdaiInstance is IfcActuatorType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcActuatorType CreateExactEntity(SdaiInstance instance) { return IfcActuatorType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcActuatorType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcActuatorType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcActuatorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(53); int v = getENUM(53, IfcActuatorTypeEnum_hash); if (v >= 0) return (IfcActuatorTypeEnum) v; else return Nullable<IfcActuatorTypeEnum>(); }
+        void put_PredefinedType(IfcActuatorTypeEnum value) { RDF_EXPRESS_PROBE(53); TextValue val = IfcActuatorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(53), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 53;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcActuatorType_CLASS_H
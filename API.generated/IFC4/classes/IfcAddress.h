@@ -0,0 +1,89 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAddress_CLASS_H
+#define __RDF_LTD__IFC4_IfcAddress_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAddress
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAddress : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAddress
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAddress(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 5);
+        }
+
+        /// <summary>
+        /// Instances of IfcAddress in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAddress> Extent(SdaiModel model) { return ExtentRange<IfcAddress>(model, 5, false); }
+        static ExtentRange<IfcAddress> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAddress>(model, 5, true); }
+
+        /// <summary>
+        /// Returns object of IfcAddress if the actual type of SdaiInstance is IfcAddress or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAddress CreateExactEntity(SdaiInstance instance) { return IfcAddress(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAddress or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAddress(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAddressTypeEnum> get_Purpose() { RDF_EXPRESS_PROBE(54); int v = getENUM(54, IfcAddressTypeEnum_hash); if (v >= 0) return (IfcAddressTypeEnum) v; else return Nullable<IfcAddressTypeEnum>(); }
+        void put_Purpose(IfcAddressTypeEnum value) { RDF_EXPRESS_PROBE(54); TextValue val = IfcAddressTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(54), sdaiENUM, val); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(55); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(55), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(55); sdaiPutAttr(m_instance, getAttrDefinition(55), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(55); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_UserDefinedPurpose() { RDF_EXPRESS_PROBE(56); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(56), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedPurpose_view() { return TextView(get_UserDefinedPurpose()); }
+#endif
+        void put_UserDefinedPurpose(IfcLabel value) { RDF_EXPRESS_PROBE(56); sdaiPutAttr(m_instance, getAttrDefinition(56), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedPurpose_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(56); return buffer.GetAttr(m_instance, "UserDefinedPurpose"); }
+        const char* get_UserDefinedPurpose_utf8() { return get_UserDefinedPurpose_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcPerson or list of convertible elements
+        template <typename TList> void get_OfPerson(TList& lst) { RDF_EXPRESS_PROBE(57); SetOfIfcPersonSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(57)); }
+
+        //TList may be SetOfIfcOrganization or list of convertible elements
+        template <typename TList> void get_OfOrganization(TList& lst) { RDF_EXPRESS_PROBE(58); SetOfIfcOrganizationSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(58)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Purpose = 54;
+            static constexpr IntValue Description = 55;
+            static constexpr IntValue UserDefinedPurpose = 56;
+            static constexpr IntValue OfPerson = 57;
+            static constexpr IntValue OfOrganization = 58;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAddress_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAdvancedBrep_CLASS_H
+#define __RDF_LTD__IFC4_IfcAdvancedBrep_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcManifoldSolidBrep.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAdvancedBrep
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAdvancedBrep : public RDF_EXPRESS_VIRTUAL IfcManifoldSolidBrep
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAdvancedBrep
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAdvancedBrep(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 6);
+        }
+
+        /// <summary>
+        /// Instances of IfcAdvancedBrep in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAdvancedBrep> Extent(SdaiModel model) { return ExtentRange<IfcAdvancedBrep>(model, 6, false); }
+        static ExtentRange<IfcAdvancedBrep> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAdvancedBrep>(model, 6, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAdvancedBrep and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAdvancedBrep Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAdvancedBrep"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAdvancedBrep if the actual type of SdaiInstance is IfcAdvancedBrep or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAdvancedBrep CreateExactEntity(SdaiInstance instance) { return IfcAdvancedBrep(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAdvancedBrep or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAdvancedBrep(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcManifoldSolidBrep::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAdvancedBrep_CLASS_H
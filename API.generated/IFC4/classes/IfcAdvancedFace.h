@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAdvancedFace_CLASS_H
+#define __RDF_LTD__IFC4_IfcAdvancedFace_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFaceSurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAdvancedFace
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAdvancedFace : public RDF_EXPRESS_VIRTUAL IfcFaceSurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAdvancedFace
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAdvancedFace(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 8);
+        }
+
+        /// <summary>
+        /// Instances of IfcAdvancedFace in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAdvancedFace> Extent(SdaiModel model) { return ExtentRange<IfcAdvancedFace>(model, 8, false); }
+        static ExtentRange<IfcAdvancedFace> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAdvancedFace>(model, 8, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAdvancedFace and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAdvancedFace Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAdvancedFace"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAdvancedFace if the actual type of SdaiInstance is IfcAdvancedFace or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAdvancedFace CreateExactEntity(SdaiInstance instance) { return IfcAdvancedFace(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAdvancedFace or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAdvancedFace(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFaceSurface::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAdvancedFace_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAirTerminal_CLASS_H
+#define __RDF_LTD__IFC4_IfcAirTerminal_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAirTerminal
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAirTerminal : public RDF_EXPRESS_VIRTUAL IfcFlowTerminal
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAirTerminal
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAirTerminal(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 9);
+        }
+
+        /// <summary>
+        /// Instances of IfcAirTerminal in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAirTerminal> Extent(SdaiModel model) { return ExtentRange<IfcAirTerminal>(model, 9, false); }
+        static ExtentRange<IfcAirTerminal> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAirTerminal>(model, 9, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAirTerminal and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAirTerminal Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAirTerminal"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAirTerminal if the actual type of SdaiInstance is IfcAirTerminal or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAirTerminal CreateExactEntity(SdaiInstance instance) { return IfcAirTerminal(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAirTerminal or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAirTerminal(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAirTerminalTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(69); int v = getENUM(69, IfcAirTerminalTypeEnum_hash); if (v >= 0) return (IfcAirTerminalTypeEnum) v; else return Nullable<IfcAirTerminalTypeEnum>(); }
+        void put_PredefinedType(IfcAirTerminalTypeEnum value) { RDF_EXPRESS_PROBE(69); TextValue val = IfcAirTerminalTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(69), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminal::attr
+        {
+            static constexpr IntValue PredefinedType = 69;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAirTerminal_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAirTerminalBox_CLASS_H
+#define __RDF_LTD__IFC4_IfcAirTerminalBox_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAirTerminalBox
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAirTerminalBox : public RDF_EXPRESS_VIRTUAL IfcFlowController
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAirTerminalBox
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAirTerminalBox(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 10);
+        }
+
+        /// <summary>
+        /// Instances of IfcAirTerminalBox in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAirTerminalBox> Extent(SdaiModel model) { return ExtentRange<IfcAirTerminalBox>(model, 10, false); }
+        static ExtentRange<IfcAirTerminalBox> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAirTerminalBox>(model, 10, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAirTerminalBox and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAirTerminalBox Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAirTerminalBox"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAirTerminalBox if the actual type of SdaiInstance is IfcAirTerminalBox or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAirTerminalBox CreateExactEntity(SdaiInstance instance) { return IfcAirTerminalBox(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAirTerminalBox or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAirTerminalBox(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAirTerminalBoxTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(70); int v = getENUM(70, IfcAirTerminalBoxTypeEnum_hash); if (v >= 0) return (IfcAirTerminalBoxTypeEnum) v; else return Nullable<IfcAirTerminalBoxTypeEnum>(); }
+        void put_PredefinedType(IfcAirTerminalBoxTypeEnum value) { RDF_EXPRESS_PROBE(70); TextValue val = IfcAirTerminalBoxTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(70), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowController::attr
+        {
+            static constexpr IntValue PredefinedType = 70;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAirTerminalBox_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAirTerminalBoxType_CLASS_H
+#define __RDF_LTD__IFC4_IfcAirTerminalBoxType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAirTerminalBoxType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAirTerminalBoxType : public RDF_EXPRESS_VIRTUAL IfcFlowControllerType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAirTerminalBoxType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAirTerminalBoxType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 11);
+        }
+
+        /// <summary>
+        /// Instances of IfcAirTerminalBoxType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAirTerminalBoxType> Extent(SdaiModel model) { return ExtentRange<IfcAirTerminalBoxType>(model, 11, false); }
+        static ExtentRange<IfcAirTerminalBoxType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAirTerminalBoxType>(model, 11, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAirTerminalBoxType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAirTerminalBoxType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAirTerminalBoxType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAirTerminalBoxType if the actual type of SdaiInstance is IfcAirTerminalBoxType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAirTerminalBoxType CreateExactEntity(SdaiInstance instance) { return IfcAirTerminalBoxType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAirTerminalBoxType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAirTerminalBoxType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAirTerminalBoxTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(71); int v = getENUM(71, IfcAirTerminalBoxTypeEnum_hash); if (v >= 0) return (IfcAirTerminalBoxTypeEnum) v; else return Nullable<IfcAirTerminalBoxTypeEnum>(); }
+        void put_PredefinedType(IfcAirTerminalBoxTypeEnum value) { RDF_EXPRESS_PROBE(71); TextValue val = IfcAirTerminalBoxTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(71), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowControllerType::attr
+        {
+            static constexpr IntValue PredefinedType = 71;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAirTerminalBoxType_CLASS_H
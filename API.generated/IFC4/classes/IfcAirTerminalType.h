@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAirTerminalType_CLASS_H
+#define __RDF_LTD__IFC4_IfcAirTerminalType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAirTerminalType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAirTerminalType : public RDF_EXPRESS_VIRTUAL IfcFlowTerminalType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAirTerminalType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAirTerminalType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 12);
+        }
+
+        /// <summary>
+        /// Instances of IfcAirTerminalType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAirTerminalType> Extent(SdaiModel model) { return ExtentRange<IfcAirTerminalType>(model, 12, false); }
+        static ExtentRange<IfcAirTerminalType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAirTerminalType>(model, 12, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAirTerminalType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAirTerminalType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAirTerminalType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAirTerminalType if the actual type of SdaiInstance is IfcAirTerminalType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAirTerminalType CreateExactEntity(SdaiInstance instance) { return IfcAirTerminalType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAirTerminalType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAirTerminalType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAirTerminalTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(72); int v = getENUM(72, IfcAirTerminalTypeEnum_hash); if (v >= 0) return (IfcAirTerminalTypeEnum) v; else return Nullable<IfcAirTerminalTypeEnum>(); }
+        void put_PredefinedType(IfcAirTerminalTypeEnum value) { RDF_EXPRESS_PROBE(72); TextValue val = IfcAirTerminalTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(72), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminalType::attr
+        {
+            static constexpr IntValue PredefinedType = 72;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAirTerminalType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAirToAirHeatRecovery_CLASS_H
+#define __RDF_LTD__IFC4_IfcAirToAirHeatRecovery_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAirToAirHeatRecovery
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAirToAirHeatRecovery : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAirToAirHeatRecovery
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAirToAirHeatRecovery(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 13);
+        }
+
+        /// <summary>
+        /// Instances of IfcAirToAirHeatRecovery in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAirToAirHeatRecovery> Extent(SdaiModel model) { return ExtentRange<IfcAirToAirHeatRecovery>(model, 13, false); }
+        static ExtentRange<IfcAirToAirHeatRecovery> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAirToAirHeatRecovery>(model, 13, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAirToAirHeatRecovery and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAirToAirHeatRecovery Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAirToAirHeatRecovery"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAirToAirHeatRecovery if the actual type of SdaiInstance is IfcAirToAirHeatRecovery or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAirToAirHeatRecovery CreateExactEntity(SdaiInstance instance) { return IfcAirToAirHeatRecovery(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAirToAirHeatRecovery or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAirToAirHeatRecovery(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAirToAirHeatRecoveryTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(73); int v = getENUM(73, IfcAirToAirHeatRecoveryTypeEnum_hash); if (v >= 0) return (IfcAirToAirHeatRecoveryTypeEnum) v; else return Nullable<IfcAirToAirHeatRecoveryTypeEnum>(); }
+        void put_PredefinedType(IfcAirToAirHeatRecoveryTypeEnum value) { RDF_EXPRESS_PROBE(73); TextValue val = IfcAirToAirHeatRecoveryTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(73), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 73;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAirToAirHeatRecovery_CLASS_H
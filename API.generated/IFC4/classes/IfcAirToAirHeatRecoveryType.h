@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAirToAirHeatRecoveryType_CLASS_H
+#define __RDF_LTD__IFC4_IfcAirToAirHeatRecoveryType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAirToAirHeatRecoveryType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAirToAirHeatRecoveryType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAirToAirHeatRecoveryType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAirToAirHeatRecoveryType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 14);
+        }
+
+        /// <summary>
+        /// Instances of IfcAirToAirHeatRecoveryType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAirToAirHeatRecoveryType> Extent(SdaiModel model) { return ExtentRange<IfcAirToAirHeatRecoveryType>(model, 14, false); }
+        static ExtentRange<IfcAirToAirHeatRecoveryType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAirToAirHeatRecoveryType>(model, 14, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAirToAirHeatRecoveryType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAirToAirHeatRecoveryType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAirToAirHeatRecoveryType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAirToAirHeatRecoveryType if the actual type of SdaiInstance is IfcAirToAirHeatRecoveryType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAirToAirHeatRecoveryType CreateExactEntity(SdaiInstance instance) { return IfcAirToAirHeatRecoveryType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAirToAirHeatRecoveryType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAirToAirHeatRecoveryType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAirToAirHeatRecoveryTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(74); int v = getENUM(74, IfcAirToAirHeatRecoveryTypeEnum_hash); if (v >= 0) return (IfcAirToAirHeatRecoveryTypeEnum) v; else return Nullable<IfcAirToAirHeatRecoveryTypeEnum>(); }
+        void put_PredefinedType(IfcAirToAirHeatRecoveryTypeEnum value) { RDF_EXPRESS_PROBE(74); TextValue val = IfcAirToAirHeatRecoveryTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(74), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 74;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAirToAirHeatRecoveryType_CLASS_H
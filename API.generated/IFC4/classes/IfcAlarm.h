@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAlarm_CLASS_H
+#define __RDF_LTD__IFC4_IfcAlarm_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAlarm
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAlarm : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAlarm
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAlarm(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 15);
+        }
+
+        /// <summary>
+        /// Instances of IfcAlarm in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAlarm> Extent(SdaiModel model) { return ExtentRange<IfcAlarm>(model, 15, false); }
+        static ExtentRange<IfcAlarm> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAlarm>(model, 15, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAlarm and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAlarm Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAlarm"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAlarm if the actual type of SdaiInstance is IfcAlarm or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAlarm CreateExactEntity(SdaiInstance instance) { return IfcAlarm(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAlarm or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAlarm(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAlarmTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(75); int v = getENUM(75, IfcAlarmTypeEnum_hash); if (v >= 0) return (IfcAlarmTypeEnum) v; else return Nullable<IfcAlarmTypeEnum>(); }
+        void put_PredefinedType(IfcAlarmTypeEnum value) { RDF_EXPRESS_PROBE(75); TextValue val = IfcAlarmTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(75), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElement::attr
+        {
+            static constexpr IntValue PredefinedType = 75;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAlarm_CLASS_H
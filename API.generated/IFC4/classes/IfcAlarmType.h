@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAlarmType_CLASS_H
+#define __RDF_LTD__IFC4_IfcAlarmType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAlarmType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAlarmType : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAlarmType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAlarmType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 16);
+        }
+
+        /// <summary>
+        /// Instances of IfcAlarmType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAlarmType> Extent(SdaiModel model) { return ExtentRange<IfcAlarmType>(model, 16, false); }
+        static ExtentRange<IfcAlarmType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAlarmType>(model, 16, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAlarmType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAlarmType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAlarmType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAlarmType if the actual type of SdaiInstance is IfcAlarmType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAlarmType CreateExactEntity(SdaiInstance instance) { return IfcAlarmType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAlarmType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAlarmType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAlarmTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(76); int v = getENUM(76, IfcAlarmTypeEnum_hash); if (v >= 0) return (IfcAlarmTypeEnum) v; else return Nullable<IfcAlarmTypeEnum>(); }
+        void put_PredefinedType(IfcAlarmTypeEnum value) { RDF_EXPRESS_PROBE(76); TextValue val = IfcAlarmTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(76), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 76;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAlarmType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAnnotation_CLASS_H
+#define __RDF_LTD__IFC4_IfcAnnotation_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProduct.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAnnotation
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAnnotation : public RDF_EXPRESS_VIRTUAL IfcProduct
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAnnotation
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAnnotation(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 17);
+        }
+
+        /// <summary>
+        /// Instances of IfcAnnotation in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAnnotation> Extent(SdaiModel model) { return ExtentRange<IfcAnnotation>(model, 17, false); }
+        static ExtentRange<IfcAnnotation> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAnnotation>(model, 17, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAnnotation and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAnnotation Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAnnotation"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAnnotation if the actual type of SdaiInstance is IfcAnnotation or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAnnotation CreateExactEntity(SdaiInstance instance) { return IfcAnnotation(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAnnotation or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAnnotation(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcRelContainedInSpatialStructure or list of convertible elements
+        template <typename TList> void get_ContainedInStructure(TList& lst) { RDF_EXPRESS_PROBE(77); SetOfIfcRelContainedInSpatialStructureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(77)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProduct::attr
+        {
+            static constexpr IntValue ContainedInStructure = 77;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAnnotation_CLASS_H
@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAnnotationFillArea_CLASS_H
+#define __RDF_LTD__IFC4_IfcAnnotationFillArea_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAnnotationFillArea
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAnnotationFillArea : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAnnotationFillArea
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAnnotationFillArea(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 18);
+        }
+
+        /// <summary>
+        /// Instances of IfcAnnotationFillArea in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAnnotationFillArea> Extent(SdaiModel model) { return ExtentRange<IfcAnnotationFillArea>(model, 18, false); }
+        static ExtentRange<IfcAnnotationFillArea> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAnnotationFillArea>(model, 18, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAnnotationFillArea and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAnnotationFillArea Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAnnotationFillArea"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAnnotationFillArea if the actual type of SdaiInstance is IfcAnnotationFillArea or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAnnotationFillArea CreateExactEntity(SdaiInstance instance) { return IfcAnnotationFillArea(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAnnotationFillArea or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAnnotationFillArea(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurve get_OuterBoundary();
+        void put_OuterBoundary(IfcCurve inst);
+
+        //TList may be SetOfIfcCurve or list of convertible elements
+        template <typename TList> void get_InnerBoundaries(TList& lst) { RDF_EXPRESS_PROBE(79); SetOfIfcCurveSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(79)); }
+
+        //TList may be SetOfIfcCurve or list of convertible elements
+        template <typename TList> void put_InnerBoundaries(TList& lst) { RDF_EXPRESS_PROBE(79); SetOfIfcCurveSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(79)); }
+
+        //TArrayElem[] may be IfcCurve[] or array of convertible elements
+        template <typename TArrayElem> void put_InnerBoundaries(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(79); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcCurveSerializer<SetOfIfcCurve> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(79)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue OuterBoundary = 78;
+            static constexpr IntValue InnerBoundaries = 79;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAnnotationFillArea_CLASS_H
@@ -0,0 +1,96 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcApplication_CLASS_H
+#define __RDF_LTD__IFC4_IfcApplication_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcApplication
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcApplication : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcApplication
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcApplication(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 19);
+        }
+
+        /// <summary>
+        /// Instances of IfcApplication in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcApplication> Extent(SdaiModel model) { return ExtentRange<IfcApplication>(model, 19, false); }
+        static ExtentRange<IfcApplication> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcApplication>(model, 19, true); }
+
+        /// <summary>
+        /// Create new instance of IfcApplication and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcApplication Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcApplication"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcApplication if the actual type of SdaiInstance is IfcApplication or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcApplication CreateExactEntity(SdaiInstance instance) { return IfcApplication(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcApplication or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcApplication(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcOrganization get_ApplicationDeveloper();
+        void put_ApplicationDeveloper(IfcOrganization inst);
+
+        IfcLabel get_Version() { RDF_EXPRESS_PROBE(81); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(81), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Version_view() { return TextView(get_Version()); }
+#endif
+        void put_Version(IfcLabel value) { RDF_EXPRESS_PROBE(81); sdaiPutAttr(m_instance, getAttrDefinition(81), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Version_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(81); return buffer.GetAttr(m_instance, "Version"); }
+        const char* get_Version_utf8() { return get_Version_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_ApplicationFullName() { RDF_EXPRESS_PROBE(82); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(82), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ApplicationFullName_view() { return TextView(get_ApplicationFullName()); }
+#endif
+        void put_ApplicationFullName(IfcLabel value) { RDF_EXPRESS_PROBE(82); sdaiPutAttr(m_instance, getAttrDefinition(82), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ApplicationFullName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(82); return buffer.GetAttr(m_instance, "ApplicationFullName"); }
+        const char* get_ApplicationFullName_utf8() { return get_ApplicationFullName_utf8(ThreadUtf8Buffer()); }
+
+        IfcIdentifier get_ApplicationIdentifier() { RDF_EXPRESS_PROBE(83); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(83), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ApplicationIdentifier_view() { return TextView(get_ApplicationIdentifier()); }
+#endif
+        void put_ApplicationIdentifier(IfcIdentifier value) { RDF_EXPRESS_PROBE(83); sdaiPutAttr(m_instance, getAttrDefinition(83), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ApplicationIdentifier_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(83); return buffer.GetAttr(m_instance, "ApplicationIdentifier"); }
+        const char* get_ApplicationIdentifier_utf8() { return get_ApplicationIdentifier_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue ApplicationDeveloper = 80;
+            static constexpr IntValue Version = 81;
+            static constexpr IntValue ApplicationFullName = 82;
+            static constexpr IntValue ApplicationIdentifier = 83;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcApplication_CLASS_H
@@ -0,0 +1,151 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAppliedValue_CLASS_H
+#define __RDF_LTD__IFC4_IfcAppliedValue_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAppliedValue
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAppliedValue : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAppliedValue
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAppliedValue(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 20);
+        }
+
+        /// <summary>
+        /// Instances of IfcAppliedValue in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAppliedValue> Extent(SdaiModel model) { return ExtentRange<IfcAppliedValue>(model, 20, false); }
+        static ExtentRange<IfcAppliedValue> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAppliedValue>(model, 20, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAppliedValue and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAppliedValue Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAppliedValue"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAppliedValue if the actual type of SdaiInstance is IfcAppliedValue or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAppliedValue CreateExactEntity(SdaiInstance instance) { return IfcAppliedValue(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAppliedValue or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAppliedValue(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(84); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(84), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(84); sdaiPutAttr(m_instance, getAttrDefinition(84), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(84); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(85); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(85), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(85); sdaiPutAttr(m_instance, getAttrDefinition(85), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(85); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcAppliedValueSelect_get get_AppliedValue() { return IfcAppliedValueSelect_get(m_instance, 86); }
+        IfcAppliedValueSelect_put put_AppliedValue() { return IfcAppliedValueSelect_put(m_instance, 86); }
+
+        IfcMeasureWithUnit get_UnitBasis();
+        void put_UnitBasis(IfcMeasureWithUnit inst);
+
+        IfcDate get_ApplicableDate() { RDF_EXPRESS_PROBE(88); IfcDate val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(88), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ApplicableDate_view() { return TextView(get_ApplicableDate()); }
+#endif
+        void put_ApplicableDate(IfcDate value) { RDF_EXPRESS_PROBE(88); sdaiPutAttr(m_instance, getAttrDefinition(88), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ApplicableDate_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(88); return buffer.GetAttr(m_instance, "ApplicableDate"); }
+        const char* get_ApplicableDate_utf8() { return get_ApplicableDate_utf8(ThreadUtf8Buffer()); }
+
+        IfcDate get_FixedUntilDate() { RDF_EXPRESS_PROBE(89); IfcDate val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(89), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_FixedUntilDate_view() { return TextView(get_FixedUntilDate()); }
+#endif
+        void put_FixedUntilDate(IfcDate value) { RDF_EXPRESS_PROBE(89); sdaiPutAttr(m_instance, getAttrDefinition(89), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_FixedUntilDate_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(89); return buffer.GetAttr(m_instance, "FixedUntilDate"); }
+        const char* get_FixedUntilDate_utf8() { return get_FixedUntilDate_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Category() { RDF_EXPRESS_PROBE(90); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(90), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Category_view() { return TextView(get_Category()); }
+#endif
+        void put_Category(IfcLabel value) { RDF_EXPRESS_PROBE(90); sdaiPutAttr(m_instance, getAttrDefinition(90), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Category_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(90); return buffer.GetAttr(m_instance, "Category"); }
+        const char* get_Category_utf8() { return get_Category_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Condition() { RDF_EXPRESS_PROBE(91); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(91), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Condition_view() { return TextView(get_Condition()); }
+#endif
+        void put_Condition(IfcLabel value) { RDF_EXPRESS_PROBE(91); sdaiPutAttr(m_instance, getAttrDefinition(91), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Condition_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(91); return buffer.GetAttr(m_instance, "Condition"); }
+        const char* get_Condition_utf8() { return get_Condition_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcArithmeticOperatorEnum> get_ArithmeticOperator() { RDF_EXPRESS_PROBE(92); int v = getENUM(92, IfcArithmeticOperatorEnum_hash); if (v >= 0) return (IfcArithmeticOperatorEnum) v; else return Nullable<IfcArithmeticOperatorEnum>(); }
+        void put_ArithmeticOperator(IfcArithmeticOperatorEnum value) { RDF_EXPRESS_PROBE(92); TextValue val = IfcArithmeticOperatorEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(92), sdaiENUM, val); }
+
+        //TList may be ListOfIfcAppliedValue or list of convertible elements
+        template <typename TList> void get_Components(TList& lst) { RDF_EXPRESS_PROBE(93); ListOfIfcAppliedValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(93)); }
+
+        //TList may be ListOfIfcAppliedValue or list of convertible elements
+        template <typename TList> void put_Components(TList& lst) { RDF_EXPRESS_PROBE(93); ListOfIfcAppliedValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(93)); }
+
+        //TArrayElem[] may be IfcAppliedValue[] or array of convertible elements
+        template <typename TArrayElem> void put_Components(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(93); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcAppliedValueSerializer<ListOfIfcAppliedValue> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(93)); }
+
+        //TList may be SetOfIfcExternalReferenceRelationship or list of convertible elements
+        template <typename TList> void get_HasExternalReference(TList& lst) { RDF_EXPRESS_PROBE(94); SetOfIfcExternalReferenceRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(94)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Name = 84;
+            static constexpr IntValue Description = 85;
+            static constexpr IntValue AppliedValue = 86;
+            static constexpr IntValue UnitBasis = 87;
+            static constexpr IntValue ApplicableDate = 88;
+            static constexpr IntValue FixedUntilDate = 89;
+            static constexpr IntValue Category = 90;
+            static constexpr IntValue Condition = 91;
+            static constexpr IntValue ArithmeticOperator = 92;
+            static constexpr IntValue Components = 93;
+            static constexpr IntValue HasExternalReference = 94;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAppliedValue_CLASS_H
@@ -0,0 +1,164 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcApproval_CLASS_H
+#define __RDF_LTD__IFC4_IfcApproval_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcApproval
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcApproval : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcApproval
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcApproval(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 21);
+        }
+
+        /// <summary>
+        /// Instances of IfcApproval in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcApproval> Extent(SdaiModel model) { return ExtentRange<IfcApproval>(model, 21, false); }
+        static ExtentRange<IfcApproval> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcApproval>(model, 21, true); }
+
+        /// <summary>
+        /// Create new instance of IfcApproval and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcApproval Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcApproval"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcApproval if the actual type of SdaiInstance is IfcApproval or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcApproval CreateExactEntity(SdaiInstance instance) { return IfcApproval(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcApproval or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcApproval(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Identifier() { RDF_EXPRESS_PROBE(95); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(95), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Identifier_view() { return TextView(get_Identifier()); }
+#endif
+        void put_Identifier(IfcIdentifier value) { RDF_EXPRESS_PROBE(95); sdaiPutAttr(m_instance, getAttrDefinition(95), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Identifier_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(95); return buffer.GetAttr(m_instance, "Identifier"); }
+        const char* get_Identifier_utf8() { return get_Identifier_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(96); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(96), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(96); sdaiPutAttr(m_instance, getAttrDefinition(96), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(96); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(97); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(97), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(97); sdaiPutAttr(m_instance, getAttrDefinition(97), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(97); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_TimeOfApproval() { RDF_EXPRESS_PROBE(98); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(98), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_TimeOfApproval_view() { return TextView(get_TimeOfApproval()); }
+#endif
+        void put_TimeOfApproval(IfcDateTime value) { RDF_EXPRESS_PROBE(98); sdaiPutAttr(m_instance, getAttrDefinition(98), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_TimeOfApproval_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(98); return buffer.GetAttr(m_instance, "TimeOfApproval"); }
+        const char* get_TimeOfApproval_utf8() { return get_TimeOfApproval_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Status() { RDF_EXPRESS_PROBE(99); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(99), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Status_view() { return TextView(get_Status()); }
+#endif
+        void put_Status(IfcLabel value) { RDF_EXPRESS_PROBE(99); sdaiPutAttr(m_instance, getAttrDefinition(99), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Status_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(99); return buffer.GetAttr(m_instance, "Status"); }
+        const char* get_Status_utf8() { return get_Status_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Level() { RDF_EXPRESS_PROBE(100); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(100), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Level_view() { return TextView(get_Level()); }
+#endif
+        void put_Level(IfcLabel value) { RDF_EXPRESS_PROBE(100); sdaiPutAttr(m_instance, getAttrDefinition(100), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Level_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(100); return buffer.GetAttr(m_instance, "Level"); }
+        const char* get_Level_utf8() { return get_Level_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Qualifier() { RDF_EXPRESS_PROBE(101); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(101), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Qualifier_view() { return TextView(get_Qualifier()); }
+#endif
+        void put_Qualifier(IfcText value) { RDF_EXPRESS_PROBE(101); sdaiPutAttr(m_instance, getAttrDefinition(101), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Qualifier_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(101); return buffer.GetAttr(m_instance, "Qualifier"); }
+        const char* get_Qualifier_utf8() { return get_Qualifier_utf8(ThreadUtf8Buffer()); }
+
+        IfcActorSelect_get get_RequestingApproval() { return IfcActorSelect_get(m_instance, 102); }
+        IfcActorSelect_put put_RequestingApproval() { return IfcActorSelect_put(m_instance, 102); }
+
+        IfcActorSelect_get get_GivingApproval() { return IfcActorSelect_get(m_instance, 103); }
+        IfcActorSelect_put put_GivingApproval() { return IfcActorSelect_put(m_instance, 103); }
+
+        //TList may be SetOfIfcExternalReferenceRelationship or list of convertible elements
+        template <typename TList> void get_HasExternalReferences(TList& lst) { RDF_EXPRESS_PROBE(104); SetOfIfcExternalReferenceRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(104)); }
+
+        //TList may be SetOfIfcRelAssociatesApproval or list of convertible elements
+        template <typename TList> void get_ApprovedObjects(TList& lst) { RDF_EXPRESS_PROBE(105); SetOfIfcRelAssociatesApprovalSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(105)); }
+
+        //TList may be SetOfIfcResourceApprovalRelationship or list of convertible elements
+        template <typename TList> void get_ApprovedResources(TList& lst) { RDF_EXPRESS_PROBE(106); SetOfIfcResourceApprovalRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(106)); }
+
+        //TList may be SetOfIfcApprovalRelationship or list of convertible elements
+        template <typename TList> void get_IsRelatedWith(TList& lst) { RDF_EXPRESS_PROBE(107); SetOfIfcApprovalRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(107)); }
+
+        //TList may be SetOfIfcApprovalRelationship or list of convertible elements
+        template <typename TList> void get_Relates(TList& lst) { RDF_EXPRESS_PROBE(108); SetOfIfcApprovalRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(108)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Identifier = 95;
+            static constexpr IntValue Name = 96;
+            static constexpr IntValue Description = 97;
+            static constexpr IntValue TimeOfApproval = 98;
+            static constexpr IntValue Status = 99;
+            static constexpr IntValue Level = 100;
+            static constexpr IntValue Qualifier = 101;
+            static constexpr IntValue RequestingApproval = 102;
+            static constexpr IntValue GivingApproval = 103;
+            static constexpr IntValue HasExternalReferences = 104;
+            static constexpr IntValue ApprovedObjects = 105;
+            static constexpr IntValue ApprovedResources = 106;
+            static constexpr IntValue IsRelatedWith = 107;
+            static constexpr IntValue Relates = 108;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcApproval_CLASS_H
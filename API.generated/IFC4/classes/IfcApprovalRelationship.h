@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcApprovalRelationship_CLASS_H
+#define __RDF_LTD__IFC4_IfcApprovalRelationship_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcResourceLevelRelationship.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcApprovalRelationship
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcApprovalRelationship : public RDF_EXPRESS_VIRTUAL IfcResourceLevelRelationship
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcApprovalRelationship
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcApprovalRelationship(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 22);
+        }
+
+        /// <summary>
+        /// Instances of IfcApprovalRelationship in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcApprovalRelationship> Extent(SdaiModel model) { return ExtentRange<IfcApprovalRelationship>(model, 22, false); }
+        static ExtentRange<IfcApprovalRelationship> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcApprovalRelationship>(model, 22, true); }
+
+        /// <summary>
+        /// Create new instance of IfcApprovalRelationship and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcApprovalRelationship Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcApprovalRelationship"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcApprovalRelationship if the actual type of SdaiInstance is IfcApprovalRelationship or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcApprovalRelationship CreateExactEntity(SdaiInstance instance) { return IfcApprovalRelationship(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcApprovalRelationship or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcApprovalRelationship(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcApproval get_RelatingApproval();
+        void put_RelatingApproval(IfcApproval inst);
+
+        //TList may be SetOfIfcApproval or list of convertible elements
+        template <typename TList> void get_RelatedApprovals(TList& lst) { RDF_EXPRESS_PROBE(112); SetOfIfcApprovalSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(112)); }
+
+        //TList may be SetOfIfcApproval or list of convertible elements
+        template <typename TList> void put_RelatedApprovals(TList& lst) { RDF_EXPRESS_PROBE(112); SetOfIfcApprovalSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(112)); }
+
+        //TArrayElem[] may be IfcApproval[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedApprovals(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(112); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcApprovalSerializer<SetOfIfcApproval> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(112)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcResourceLevelRelationship::attr
+        {
+            static constexpr IntValue RelatingApproval = 111;
+            static constexpr IntValue RelatedApprovals = 112;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcApprovalRelationship_CLASS_H
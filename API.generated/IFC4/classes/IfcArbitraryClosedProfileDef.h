@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcArbitraryClosedProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcArbitraryClosedProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcArbitraryClosedProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcArbitraryClosedProfileDef : public RDF_EXPRESS_VIRTUAL IfcProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcArbitraryClosedProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcArbitraryClosedProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 23);
+        }
+
+        /// <summary>
+        /// Instances of IfcArbitraryClosedProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcArbitraryClosedProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcArbitraryClosedProfileDef>(model, 23, false); }
+        static ExtentRange<IfcArbitraryClosedProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcArbitraryClosedProfileDef>(model, 23, true); }
+
+        /// <summary>
+        /// Create new instance of IfcArbitraryClosedProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcArbitraryClosedProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcArbitraryClosedProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcArbitraryClosedProfileDef if the actual type of SdaiInstance is IfcArbitraryClosedProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcArbitraryClosedProfileDef CreateExactEntity(SdaiInstance instance) { return IfcArbitraryClosedProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcArbitraryClosedProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcArbitraryClosedProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurve get_OuterCurve();
+        void put_OuterCurve(IfcCurve inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProfileDef::attr
+        {
+            static constexpr IntValue OuterCurve = 117;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcArbitraryClosedProfileDef_CLASS_H
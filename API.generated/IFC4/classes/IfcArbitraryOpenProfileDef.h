@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcArbitraryOpenProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcArbitraryOpenProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcArbitraryOpenProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcArbitraryOpenProfileDef : public RDF_EXPRESS_VIRTUAL IfcProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcArbitraryOpenProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcArbitraryOpenProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 24);
+        }
+
+        /// <summary>
+        /// Instances of IfcArbitraryOpenProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcArbitraryOpenProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcArbitraryOpenProfileDef>(model, 24, false); }
+        static ExtentRange<IfcArbitraryOpenProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcArbitraryOpenProfileDef>(model, 24, true); }
+
+        /// <summary>
+        /// Create new instance of IfcArbitraryOpenProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcArbitraryOpenProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcArbitraryOpenProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcArbitraryOpenProfileDef if the actual type of SdaiInstance is IfcArbitraryOpenProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcArbitraryOpenProfileDef CreateExactEntity(SdaiInstance instance) { return IfcArbitraryOpenProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcArbitraryOpenProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcArbitraryOpenProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcBoundedCurve get_Curve();
+        void put_Curve(IfcBoundedCurve inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProfileDef::attr
+        {
+            static constexpr IntValue Curve = 118;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcArbitraryOpenProfileDef_CLASS_H
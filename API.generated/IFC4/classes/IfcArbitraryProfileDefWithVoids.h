@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcArbitraryProfileDefWithVoids_CLASS_H
+#define __RDF_LTD__IFC4_IfcArbitraryProfileDefWithVoids_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcArbitraryClosedProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcArbitraryProfileDefWithVoids
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcArbitraryProfileDefWithVoids : public RDF_EXPRESS_VIRTUAL IfcArbitraryClosedProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcArbitraryProfileDefWithVoids
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcArbitraryProfileDefWithVoids(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 25);
+        }
+
+        /// <summary>
+        /// Instances of IfcArbitraryProfileDefWithVoids in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcArbitraryProfileDefWithVoids> Extent(SdaiModel model) { return ExtentRange<IfcArbitraryProfileDefWithVoids>(model, 25, false); }
+        static ExtentRange<IfcArbitraryProfileDefWithVoids> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcArbitraryProfileDefWithVoids>(model, 25, true); }
+
+        /// <summary>
+        /// Create new instance of IfcArbitraryProfileDefWithVoids and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcArbitraryProfileDefWithVoids Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcArbitraryProfileDefWithVoids"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcArbitraryProfileDefWithVoids if the actual type of SdaiInstance is IfcArbitraryProfileDefWithVoids or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcArbitraryProfileDefWithVoids CreateExactEntity(SdaiInstance instance) { return IfcArbitraryProfileDefWithVoids(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcArbitraryProfileDefWithVoids or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcArbitraryProfileDefWithVoids(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcCurve or list of convertible elements
+        template <typename TList> void get_InnerCurves(TList& lst) { RDF_EXPRESS_PROBE(119); SetOfIfcCurveSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(119)); }
+
+        //TList may be SetOfIfcCurve or list of convertible elements
+        template <typename TList> void put_InnerCurves(TList& lst) { RDF_EXPRESS_PROBE(119); SetOfIfcCurveSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(119)); }
+
+        //TArrayElem[] may be IfcCurve[] or array of convertible elements
+        template <typename TArrayElem> void put_InnerCurves(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(119); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcCurveSerializer<SetOfIfcCurve> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(119)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcArbitraryClosedProfileDef::attr
+        {
+            static constexpr IntValue InnerCurves = 119;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcArbitraryProfileDefWithVoids_CLASS_H
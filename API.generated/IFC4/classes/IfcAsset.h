@@ -0,0 +1,110 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAsset_CLASS_H
+#define __RDF_LTD__IFC4_IfcAsset_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGroup.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAsset
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAsset : public RDF_EXPRESS_VIRTUAL IfcGroup
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAsset
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAsset(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 26);
+        }
+
+        /// <summary>
+        /// Instances of IfcAsset in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAsset> Extent(SdaiModel model) { return ExtentRange<IfcAsset>(model, 26, false); }
+        static ExtentRange<IfcAsset> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAsset>(model, 26, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAsset and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAsset Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAsset"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAsset if the actual type of SdaiInstance is IfcAsset or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAsset CreateExactEntity(SdaiInstance instance) { return IfcAsset(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAsset or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAsset(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Identification() { RDF_EXPRESS_PROBE(121); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(121), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Identification_view() { return TextView(get_Identification()); }
+#endif
+        void put_Identification(IfcIdentifier value) { RDF_EXPRESS_PROBE(121); sdaiPutAttr(m_instance, getAttrDefinition(121), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Identification_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(121); return buffer.GetAttr(m_instance, "Identification"); }
+        const char* get_Identification_utf8() { return get_Identification_utf8(ThreadUtf8Buffer()); }
+
+        IfcCostValue get_OriginalValue();
+        void put_OriginalValue(IfcCostValue inst);
+
+        IfcCostValue get_CurrentValue();
+        void put_CurrentValue(IfcCostValue inst);
+
+        IfcCostValue get_TotalReplacementCost();
+        void put_TotalReplacementCost(IfcCostValue inst);
+
+        IfcActorSelect_get get_Owner() { return IfcActorSelect_get(m_instance, 125); }
+        IfcActorSelect_put put_Owner() { return IfcActorSelect_put(m_instance, 125); }
+
+        IfcActorSelect_get get_User() { return IfcActorSelect_get(m_instance, 126); }
+        IfcActorSelect_put put_User() { return IfcActorSelect_put(m_instance, 126); }
+
+        IfcPerson get_ResponsiblePerson();
+        void put_ResponsiblePerson(IfcPerson inst);
+
+        IfcDate get_IncorporationDate() { RDF_EXPRESS_PROBE(128); IfcDate val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(128), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IncorporationDate_view() { return TextView(get_IncorporationDate()); }
+#endif
+        void put_IncorporationDate(IfcDate value) { RDF_EXPRESS_PROBE(128); sdaiPutAttr(m_instance, getAttrDefinition(128), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_IncorporationDate_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(128); return buffer.GetAttr(m_instance, "IncorporationDate"); }
+        const char* get_IncorporationDate_utf8() { return get_IncorporationDate_utf8(ThreadUtf8Buffer()); }
+
+        IfcCostValue get_DepreciatedValue();
+        void put_DepreciatedValue(IfcCostValue inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGroup::attr
+        {
+            static constexpr IntValue Identification = 121;
+            static constexpr IntValue OriginalValue = 122;
+            static constexpr IntValue CurrentValue = 123;
+            static constexpr IntValue TotalReplacementCost = 124;
+            static constexpr IntValue Owner = 125;
+            static constexpr IntValue User = 126;
+            static constexpr IntValue ResponsiblePerson = 127;
+            static constexpr IntValue IncorporationDate = 128;
+            static constexpr IntValue DepreciatedValue = 129;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAsset_CLASS_H
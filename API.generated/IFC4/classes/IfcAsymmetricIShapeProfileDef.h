@@ -0,0 +1,108 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAsymmetricIShapeProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcAsymmetricIShapeProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAsymmetricIShapeProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAsymmetricIShapeProfileDef : public RDF_EXPRESS_VIRTUAL IfcParameterizedProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAsymmetricIShapeProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAsymmetricIShapeProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 27);
+        }
+
+        /// <summary>
+        /// Instances of IfcAsymmetricIShapeProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAsymmetricIShapeProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcAsymmetricIShapeProfileDef>(model, 27, false); }
+        static ExtentRange<IfcAsymmetricIShapeProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAsymmetricIShapeProfileDef>(model, 27, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAsymmetricIShapeProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAsymmetricIShapeProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAsymmetricIShapeProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAsymmetricIShapeProfileDef if the actual type of SdaiInstance is IfcAsymmetricIShapeProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAsymmetricIShapeProfileDef CreateExactEntity(SdaiInstance instance) { return IfcAsymmetricIShapeProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAsymmetricIShapeProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAsymmetricIShapeProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_BottomFlangeWidth() { RDF_EXPRESS_PROBE(131); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(131), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_BottomFlangeWidth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(131); sdaiPutAttr(m_instance, getAttrDefinition(131), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_OverallDepth() { RDF_EXPRESS_PROBE(132); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(132), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_OverallDepth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(132); sdaiPutAttr(m_instance, getAttrDefinition(132), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_WebThickness() { RDF_EXPRESS_PROBE(133); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(133), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_WebThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(133); sdaiPutAttr(m_instance, getAttrDefinition(133), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_BottomFlangeThickness() { RDF_EXPRESS_PROBE(134); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(134), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_BottomFlangeThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(134); sdaiPutAttr(m_instance, getAttrDefinition(134), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_BottomFlangeFilletRadius() { RDF_EXPRESS_PROBE(135); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(135), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_BottomFlangeFilletRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(135); sdaiPutAttr(m_instance, getAttrDefinition(135), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_TopFlangeWidth() { RDF_EXPRESS_PROBE(136); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(136), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_TopFlangeWidth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(136); sdaiPutAttr(m_instance, getAttrDefinition(136), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_TopFlangeThickness() { RDF_EXPRESS_PROBE(137); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(137), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_TopFlangeThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(137); sdaiPutAttr(m_instance, getAttrDefinition(137), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_TopFlangeFilletRadius() { RDF_EXPRESS_PROBE(138); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(138), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_TopFlangeFilletRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(138); sdaiPutAttr(m_instance, getAttrDefinition(138), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_BottomFlangeEdgeRadius() { RDF_EXPRESS_PROBE(139); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(139), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_BottomFlangeEdgeRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(139); sdaiPutAttr(m_instance, getAttrDefinition(139), sdaiREAL, &value); }
+
+        Nullable<IfcPlaneAngleMeasure> get_BottomFlangeSlope() { RDF_EXPRESS_PROBE(140); IfcPlaneAngleMeasure val = (IfcPlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(140), sdaiREAL, &val)) return val; else return Nullable<IfcPlaneAngleMeasure>(); }
+        void put_BottomFlangeSlope(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(140); sdaiPutAttr(m_instance, getAttrDefinition(140), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_TopFlangeEdgeRadius() { RDF_EXPRESS_PROBE(141); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(141), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_TopFlangeEdgeRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(141); sdaiPutAttr(m_instance, getAttrDefinition(141), sdaiREAL, &value); }
+
+        Nullable<IfcPlaneAngleMeasure> get_TopFlangeSlope() { RDF_EXPRESS_PROBE(142); IfcPlaneAngleMeasure val = (IfcPlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(142), sdaiREAL, &val)) return val; else return Nullable<IfcPlaneAngleMeasure>(); }
+        void put_TopFlangeSlope(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(142); sdaiPutAttr(m_instance, getAttrDefinition(142), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcParameterizedProfileDef::attr
+        {
+            static constexpr IntValue BottomFlangeWidth = 131;
+            static constexpr IntValue OverallDepth = 132;
+            static constexpr IntValue WebThickness = 133;
+            static constexpr IntValue BottomFlangeThickness = 134;
+            static constexpr IntValue BottomFlangeFilletRadius = 135;
+            static constexpr IntValue TopFlangeWidth = 136;
+            static constexpr IntValue TopFlangeThickness = 137;
+            static constexpr IntValue TopFlangeFilletRadius = 138;
+            static constexpr IntValue BottomFlangeEdgeRadius = 139;
+            static constexpr IntValue BottomFlangeSlope = 140;
+            static constexpr IntValue TopFlangeEdgeRadius = 141;
+            static constexpr IntValue TopFlangeSlope = 142;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAsymmetricIShapeProfileDef_CLASS_H
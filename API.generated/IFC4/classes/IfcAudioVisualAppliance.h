@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAudioVisualAppliance_CLASS_H
+#define __RDF_LTD__IFC4_IfcAudioVisualAppliance_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAudioVisualAppliance
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAudioVisualAppliance : public RDF_EXPRESS_VIRTUAL IfcFlowTerminal
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAudioVisualAppliance
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAudioVisualAppliance(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 28);
+        }
+
+        /// <summary>
+        /// Instances of IfcAudioVisualAppliance in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAudioVisualAppliance> Extent(SdaiModel model) { return ExtentRange<IfcAudioVisualAppliance>(model, 28, false); }
+        static ExtentRange<IfcAudioVisualAppliance> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAudioVisualAppliance>(model, 28, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAudioVisualAppliance and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAudioVisualAppliance Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAudioVisualAppliance"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAudioVisualAppliance if the actual type of SdaiInstance is IfcAudioVisualAppliance or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAudioVisualAppliance CreateExactEntity(SdaiInstance instance) { return IfcAudioVisualAppliance(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAudioVisualAppliance or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAudioVisualAppliance(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAudioVisualApplianceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(143); int v = getENUM(143, IfcAudioVisualApplianceTypeEnum_hash); if (v >= 0) return (IfcAudioVisualApplianceTypeEnum) v; else return Nullable<IfcAudioVisualApplianceTypeEnum>(); }
+        void put_PredefinedType(IfcAudioVisualApplianceTypeEnum value) { RDF_EXPRESS_PROBE(143); TextValue val = IfcAudioVisualApplianceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(143), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminal::attr
+        {
+            static constexpr IntValue PredefinedType = 143;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAudioVisualAppliance_CLASS_H
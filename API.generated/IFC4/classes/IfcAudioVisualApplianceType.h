@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAudioVisualApplianceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcAudioVisualApplianceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAudioVisualApplianceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAudioVisualApplianceType : public RDF_EXPRESS_VIRTUAL IfcFlowTerminalType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAudioVisualApplianceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAudioVisualApplianceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 29);
+        }
+
+        /// <summary>
+        /// Instances of IfcAudioVisualApplianceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAudioVisualApplianceType> Extent(SdaiModel model) { return ExtentRange<IfcAudioVisualApplianceType>(model, 29, false); }
+        static ExtentRange<IfcAudioVisualApplianceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAudioVisualApplianceType>(model, 29, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAudioVisualApplianceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAudioVisualApplianceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAudioVisualApplianceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAudioVisualApplianceType if the actual type of SdaiInstance is IfcAudioVisualApplianceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAudioVisualApplianceType CreateExactEntity(SdaiInstance instance) { return IfcAudioVisualApplianceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAudioVisualApplianceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAudioVisualApplianceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAudioVisualApplianceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(144); int v = getENUM(144, IfcAudioVisualApplianceTypeEnum_hash); if (v >= 0) return (IfcAudioVisualApplianceTypeEnum) v; else return Nullable<IfcAudioVisualApplianceTypeEnum>(); }
+        void put_PredefinedType(IfcAudioVisualApplianceTypeEnum value) { RDF_EXPRESS_PROBE(144); TextValue val = IfcAudioVisualApplianceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(144), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminalType::attr
+        {
+            static constexpr IntValue PredefinedType = 144;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAudioVisualApplianceType_CLASS_H
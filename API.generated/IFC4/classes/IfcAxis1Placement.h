@@ -0,0 +1,67 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAxis1Placement_CLASS_H
+#define __RDF_LTD__IFC4_IfcAxis1Placement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPlacement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAxis1Placement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAxis1Placement : public RDF_EXPRESS_VIRTUAL IfcPlacement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAxis1Placement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAxis1Placement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 30);
+        }
+
+        /// <summary>
+        /// Instances of IfcAxis1Placement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAxis1Placement> Extent(SdaiModel model) { return ExtentRange<IfcAxis1Placement>(model, 30, false); }
+        static ExtentRange<IfcAxis1Placement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAxis1Placement>(model, 30, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAxis1Placement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAxis1Placement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAxis1Placement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAxis1Placement if the actual type of SdaiInstance is IfcAxis1Placement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAxis1Placement CreateExactEntity(SdaiInstance instance) { return IfcAxis1Placement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAxis1Placement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAxis1Placement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDirection get_Axis();
+        void put_Axis(IfcDirection inst);
+
+        IfcDirection get_Z();
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPlacement::attr
+        {
+            static constexpr IntValue Axis = 147;
+            static constexpr IntValue Z = 148;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAxis1Placement_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAxis2Placement2D_CLASS_H
+#define __RDF_LTD__IFC4_IfcAxis2Placement2D_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPlacement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcAxis2Placement2D
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcAxis2Placement2D : public RDF_EXPRESS_VIRTUAL IfcPlacement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcAxis2Placement2D
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcAxis2Placement2D(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 31);
+        }
+
+        /// <summary>
+        /// Instances of IfcAxis2Placement2D in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcAxis2Placement2D> Extent(SdaiModel model) { return ExtentRange<IfcAxis2Placement2D>(model, 31, false); }
+        static ExtentRange<IfcAxis2Placement2D> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcAxis2Placement2D>(model, 31, true); }
+
+        /// <summary>
+        /// Create new instance of IfcAxis2Placement2D and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcAxis2Placement2D Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcAxis2Placement2D"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcAxis2Placement2D if the actual type of SdaiInstance is IfcAxis2Placement2D or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcAxis2Placement2D CreateExactEntity(SdaiInstance instance) { return IfcAxis2Placement2D(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcAxis2Placement2D or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcAxis2Placement2D(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDirection get_RefDirection();
+        void put_RefDirection(IfcDirection inst);
+
+        //TList may be ListOfIfcDirection or list of convertible elements
+        template <typename TList> void get_P(TList& lst) { RDF_EXPRESS_PROBE(150); ListOfIfcDirectionSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(150)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPlacement::attr
+        {
+            static constexpr IntValue RefDirection = 149;
+            static constexpr IntValue P = 150;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcAxis2Placement2D_CLASS_H
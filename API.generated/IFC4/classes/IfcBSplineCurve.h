@@ -0,0 +1,89 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBSplineCurve_CLASS_H
+#define __RDF_LTD__IFC4_IfcBSplineCurve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundedCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBSplineCurve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBSplineCurve : public RDF_EXPRESS_VIRTUAL IfcBoundedCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBSplineCurve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBSplineCurve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 52);
+        }
+
+        /// <summary>
+        /// Instances of IfcBSplineCurve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBSplineCurve> Extent(SdaiModel model) { return ExtentRange<IfcBSplineCurve>(model, 52, false); }
+        static ExtentRange<IfcBSplineCurve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBSplineCurve>(model, 52, true); }
+
+        /// <summary>
+        /// Returns object of IfcBSplineCurve if the actual type of SdaiInstance is IfcBSplineCurve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBSplineCurve CreateExactEntity(SdaiInstance instance) { return IfcBSplineCurve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBSplineCurve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBSplineCurve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcInteger> get_Degree() { RDF_EXPRESS_PROBE(209); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(209), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_Degree(IfcInteger value) { RDF_EXPRESS_PROBE(209); sdaiPutAttr(m_instance, getAttrDefinition(209), sdaiINTEGER, &value); }
+
+        //TList may be ListOfIfcCartesianPoint or list of convertible elements
+        template <typename TList> void get_ControlPointsList(TList& lst) { RDF_EXPRESS_PROBE(210); ListOfIfcCartesianPointSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(210)); }
+
+        //TList may be ListOfIfcCartesianPoint or list of convertible elements
+        template <typename TList> void put_ControlPointsList(TList& lst) { RDF_EXPRESS_PROBE(210); ListOfIfcCartesianPointSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(210)); }
+
+        //TArrayElem[] may be IfcCartesianPoint[] or array of convertible elements
+        template <typename TArrayElem> void put_ControlPointsList(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(210); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcCartesianPointSerializer<ListOfIfcCartesianPoint> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(210)); }
+
+        Nullable<IfcBSplineCurveForm> get_CurveForm() { RDF_EXPRESS_PROBE(211); int v = getENUM(211, IfcBSplineCurveForm_hash); if (v >= 0) return (IfcBSplineCurveForm) v; else return Nullable<IfcBSplineCurveForm>(); }
+        void put_CurveForm(IfcBSplineCurveForm value) { RDF_EXPRESS_PROBE(211); TextValue val = IfcBSplineCurveForm_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(211), sdaiENUM, val); }
+
+        Nullable<IfcLogical> get_ClosedCurve() { RDF_EXPRESS_PROBE(212); int v = getENUM(212, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_ClosedCurve(IfcLogical value) { RDF_EXPRESS_PROBE(212); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(212), sdaiENUM, val); }
+
+        Nullable<IfcLogical> get_SelfIntersect() { RDF_EXPRESS_PROBE(213); int v = getENUM(213, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_SelfIntersect(IfcLogical value) { RDF_EXPRESS_PROBE(213); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(213), sdaiENUM, val); }
+
+        Nullable<IfcInteger> get_UpperIndexOnControlPoints() { RDF_EXPRESS_PROBE(214); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(214), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+
+        //TList may be ArrayOfIfcCartesianPoint or list of convertible elements
+        template <typename TList> void get_ControlPoints(TList& lst) { RDF_EXPRESS_PROBE(215); ArrayOfIfcCartesianPointSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(215)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundedCurve::attr
+        {
+            static constexpr IntValue Degree = 209;
+            static constexpr IntValue ControlPointsList = 210;
+            static constexpr IntValue CurveForm = 211;
+            static constexpr IntValue ClosedCurve = 212;
+            static constexpr IntValue SelfIntersect = 213;
+            static constexpr IntValue UpperIndexOnControlPoints = 214;
+            static constexpr IntValue ControlPoints = 215;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBSplineCurve_CLASS_H
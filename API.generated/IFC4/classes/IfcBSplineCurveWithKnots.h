@@ -0,0 +1,87 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBSplineCurveWithKnots_CLASS_H
+#define __RDF_LTD__IFC4_IfcBSplineCurveWithKnots_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBSplineCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBSplineCurveWithKnots
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBSplineCurveWithKnots : public RDF_EXPRESS_VIRTUAL IfcBSplineCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBSplineCurveWithKnots
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBSplineCurveWithKnots(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 53);
+        }
+
+        /// <summary>
+        /// Instances of IfcBSplineCurveWithKnots in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBSplineCurveWithKnots> Extent(SdaiModel model) { return ExtentRange<IfcBSplineCurveWithKnots>(model, 53, false); }
+        static ExtentRange<IfcBSplineCurveWithKnots> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBSplineCurveWithKnots>(model, 53, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBSplineCurveWithKnots and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBSplineCurveWithKnots Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBSplineCurveWithKnots"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBSplineCurveWithKnots if the actual type of SdaiInstance is IfcBSplineCurveWithKnots or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBSplineCurveWithKnots CreateExactEntity(SdaiInstance instance) { return IfcBSplineCurveWithKnots(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBSplineCurveWithKnots or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBSplineCurveWithKnots(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcInteger or list of convertible elements
+        template <typename TList> void get_KnotMultiplicities(TList& lst) { RDF_EXPRESS_PROBE(216); ListOfIfcIntegerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(216)); }
+
+        //TList may be ListOfIfcInteger or list of convertible elements
+        template <typename TList> void put_KnotMultiplicities(TList& lst) { RDF_EXPRESS_PROBE(216); ListOfIfcIntegerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(216)); }
+
+        //TArrayElem[] may be IfcInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_KnotMultiplicities(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(216); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcIntegerSerializer<ListOfIfcInteger> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(216)); }
+
+        //TList may be ListOfIfcParameterValue or list of convertible elements
+        template <typename TList> void get_Knots(TList& lst) { RDF_EXPRESS_PROBE(217); ListOfIfcParameterValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(217)); }
+
+        //TList may be ListOfIfcParameterValue or list of convertible elements
+        template <typename TList> void put_Knots(TList& lst) { RDF_EXPRESS_PROBE(217); ListOfIfcParameterValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(217)); }
+
+        //TArrayElem[] may be IfcParameterValue[] or array of convertible elements
+        template <typename TArrayElem> void put_Knots(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(217); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcParameterValueSerializer<ListOfIfcParameterValue> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(217)); }
+
+        Nullable<IfcKnotType> get_KnotSpec() { RDF_EXPRESS_PROBE(218); int v = getENUM(218, IfcKnotType_hash); if (v >= 0) return (IfcKnotType) v; else return Nullable<IfcKnotType>(); }
+        void put_KnotSpec(IfcKnotType value) { RDF_EXPRESS_PROBE(218); TextValue val = IfcKnotType_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(218), sdaiENUM, val); }
+
+        Nullable<IfcInteger> get_UpperIndexOnKnots() { RDF_EXPRESS_PROBE(219); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(219), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBSplineCurve::attr
+        {
+            static constexpr IntValue KnotMultiplicities = 216;
+            static constexpr IntValue Knots = 217;
+            static constexpr IntValue KnotSpec = 218;
+            static constexpr IntValue UpperIndexOnKnots = 219;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBSplineCurveWithKnots_CLASS_H
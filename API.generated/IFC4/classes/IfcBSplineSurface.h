@@ -0,0 +1,97 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBSplineSurface_CLASS_H
+#define __RDF_LTD__IFC4_IfcBSplineSurface_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundedSurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBSplineSurface
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBSplineSurface : public RDF_EXPRESS_VIRTUAL IfcBoundedSurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBSplineSurface
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBSplineSurface(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 54);
+        }
+
+        /// <summary>
+        /// Instances of IfcBSplineSurface in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBSplineSurface> Extent(SdaiModel model) { return ExtentRange<IfcBSplineSurface>(model, 54, false); }
+        static ExtentRange<IfcBSplineSurface> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBSplineSurface>(model, 54, true); }
+
+        /// <summary>
+        /// Returns object of IfcBSplineSurface if the actual type of SdaiInstance is IfcBSplineSurface or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBSplineSurface CreateExactEntity(SdaiInstance instance) { return IfcBSplineSurface(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBSplineSurface or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBSplineSurface(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcInteger> get_UDegree() { RDF_EXPRESS_PROBE(220); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(220), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_UDegree(IfcInteger value) { RDF_EXPRESS_PROBE(220); sdaiPutAttr(m_instance, getAttrDefinition(220), sdaiINTEGER, &value); }
+
+        Nullable<IfcInteger> get_VDegree() { RDF_EXPRESS_PROBE(221); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(221), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_VDegree(IfcInteger value) { RDF_EXPRESS_PROBE(221); sdaiPutAttr(m_instance, getAttrDefinition(221), sdaiINTEGER, &value); }
+
+        //TList may be ListOfListOfIfcCartesianPoint or list of convertible elements
+        template <typename TList> void get_ControlPointsList(TList& lst) { RDF_EXPRESS_PROBE(222); ListOfListOfIfcCartesianPointSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(222)); }
+
+        //TList may be ListOfListOfIfcCartesianPoint or list of convertible elements
+        template <typename TList> void put_ControlPointsList(TList& lst) { RDF_EXPRESS_PROBE(222); ListOfListOfIfcCartesianPointSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(222)); }
+
+        Nullable<IfcBSplineSurfaceForm> get_SurfaceForm() { RDF_EXPRESS_PROBE(223); int v = getENUM(223, IfcBSplineSurfaceForm_hash); if (v >= 0) return (IfcBSplineSurfaceForm) v; else return Nullable<IfcBSplineSurfaceForm>(); }
+        void put_SurfaceForm(IfcBSplineSurfaceForm value) { RDF_EXPRESS_PROBE(223); TextValue val = IfcBSplineSurfaceForm_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(223), sdaiENUM, val); }
+
+        Nullable<IfcLogical> get_UClosed() { RDF_EXPRESS_PROBE(224); int v = getENUM(224, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_UClosed(IfcLogical value) { RDF_EXPRESS_PROBE(224); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(224), sdaiENUM, val); }
+
+        Nullable<IfcLogical> get_VClosed() { RDF_EXPRESS_PROBE(225); int v = getENUM(225, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_VClosed(IfcLogical value) { RDF_EXPRESS_PROBE(225); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(225), sdaiENUM, val); }
+
+        Nullable<IfcLogical> get_SelfIntersect() { RDF_EXPRESS_PROBE(226); int v = getENUM(226, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_SelfIntersect(IfcLogical value) { RDF_EXPRESS_PROBE(226); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(226), sdaiENUM, val); }
+
+        Nullable<IfcInteger> get_UUpper() { RDF_EXPRESS_PROBE(227); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(227), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+
+        Nullable<IfcInteger> get_VUpper() { RDF_EXPRESS_PROBE(228); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(228), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+
+        //TList may be ArrayOfArrayOfIfcCartesianPoint or list of convertible elements
+        template <typename TList> void get_ControlPoints(TList& lst) { RDF_EXPRESS_PROBE(229); ArrayOfArrayOfIfcCartesianPointSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(229)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundedSurface::attr
+        {
+            static constexpr IntValue UDegree = 220;
+            static constexpr IntValue VDegree = 221;
+            static constexpr IntValue ControlPointsList = 222;
+            static constexpr IntValue SurfaceForm = 223;
+            static constexpr IntValue UClosed = 224;
+            static constexpr IntValue VClosed = 225;
+            static constexpr IntValue SelfIntersect = 226;
+            static constexpr IntValue UUpper = 227;
+            static constexpr IntValue VUpper = 228;
+            static constexpr IntValue ControlPoints = 229;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBSplineSurface_CLASS_H
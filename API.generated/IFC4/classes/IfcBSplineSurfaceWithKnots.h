@@ -0,0 +1,110 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBSplineSurfaceWithKnots_CLASS_H
+#define __RDF_LTD__IFC4_IfcBSplineSurfaceWithKnots_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBSplineSurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBSplineSurfaceWithKnots
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBSplineSurfaceWithKnots : public RDF_EXPRESS_VIRTUAL IfcBSplineSurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBSplineSurfaceWithKnots
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBSplineSurfaceWithKnots(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 55);
+        }
+
+        /// <summary>
+        /// Instances of IfcBSplineSurfaceWithKnots in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBSplineSurfaceWithKnots> Extent(SdaiModel model) { return ExtentRange<IfcBSplineSurfaceWithKnots>(model, 55, false); }
+        static ExtentRange<IfcBSplineSurfaceWithKnots> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBSplineSurfaceWithKnots>(model, 55, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBSplineSurfaceWithKnots and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBSplineSurfaceWithKnots Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBSplineSurfaceWithKnots"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBSplineSurfaceWithKnots if the actual type of SdaiInstance is IfcBSplineSurfaceWithKnots or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBSplineSurfaceWithKnots CreateExactEntity(SdaiInstance instance) { return IfcBSplineSurfaceWithKnots(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBSplineSurfaceWithKnots or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBSplineSurfaceWithKnots(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcInteger or list of convertible elements
+        template <typename TList> void get_UMultiplicities(TList& lst) { RDF_EXPRESS_PROBE(230); ListOfIfcIntegerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(230)); }
+
+        //TList may be ListOfIfcInteger or list of convertible elements
+        template <typename TList> void put_UMultiplicities(TList& lst) { RDF_EXPRESS_PROBE(230); ListOfIfcIntegerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(230)); }
+
+        //TArrayElem[] may be IfcInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_UMultiplicities(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(230); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcIntegerSerializer<ListOfIfcInteger> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(230)); }
+
+        //TList may be ListOfIfcInteger or list of convertible elements
+        template <typename TList> void get_VMultiplicities(TList& lst) { RDF_EXPRESS_PROBE(231); ListOfIfcIntegerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(231)); }
+
+        //TList may be ListOfIfcInteger or list of convertible elements
+        template <typename TList> void put_VMultiplicities(TList& lst) { RDF_EXPRESS_PROBE(231); ListOfIfcIntegerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(231)); }
+
+        //TArrayElem[] may be IfcInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_VMultiplicities(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(231); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcIntegerSerializer<ListOfIfcInteger> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(231)); }
+
+        //TList may be ListOfIfcParameterValue or list of convertible elements
+        template <typename TList> void get_UKnots(TList& lst) { RDF_EXPRESS_PROBE(232); ListOfIfcParameterValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(232)); }
+
+        //TList may be ListOfIfcParameterValue or list of convertible elements
+        template <typename TList> void put_UKnots(TList& lst) { RDF_EXPRESS_PROBE(232); ListOfIfcParameterValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(232)); }
+
+        //TArrayElem[] may be IfcParameterValue[] or array of convertible elements
+        template <typename TArrayElem> void put_UKnots(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(232); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcParameterValueSerializer<ListOfIfcParameterValue> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(232)); }
+
+        //TList may be ListOfIfcParameterValue or list of convertible elements
+        template <typename TList> void get_VKnots(TList& lst) { RDF_EXPRESS_PROBE(233); ListOfIfcParameterValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(233)); }
+
+        //TList may be ListOfIfcParameterValue or list of convertible elements
+        template <typename TList> void put_VKnots(TList& lst) { RDF_EXPRESS_PROBE(233); ListOfIfcParameterValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(233)); }
+
+        //TArrayElem[] may be IfcParameterValue[] or array of convertible elements
+        template <typename TArrayElem> void put_VKnots(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(233); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcParameterValueSerializer<ListOfIfcParameterValue> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(233)); }
+
+        Nullable<IfcKnotType> get_KnotSpec() { RDF_EXPRESS_PROBE(234); int v = getENUM(234, IfcKnotType_hash); if (v >= 0) return (IfcKnotType) v; else return Nullable<IfcKnotType>(); }
+        void put_KnotSpec(IfcKnotType value) { RDF_EXPRESS_PROBE(234); TextValue val = IfcKnotType_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(234), sdaiENUM, val); }
+
+        Nullable<IfcInteger> get_KnotVUpper() { RDF_EXPRESS_PROBE(235); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(235), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+
+        Nullable<IfcInteger> get_KnotUUpper() { RDF_EXPRESS_PROBE(236); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(236), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBSplineSurface::attr
+        {
+            static constexpr IntValue UMultiplicities = 230;
+            static constexpr IntValue VMultiplicities = 231;
+            static constexpr IntValue UKnots = 232;
+            static constexpr IntValue VKnots = 233;
+            static constexpr IntValue KnotSpec = 234;
+            static constexpr IntValue KnotVUpper = 235;
+            static constexpr IntValue KnotUUpper = 236;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBSplineSurfaceWithKnots_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBeam_CLASS_H
+#define __RDF_LTD__IFC4_IfcBeam_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBeam
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBeam : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBeam
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBeam(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 33);
+        }
+
+        /// <summary>
+        /// Instances of IfcBeam in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBeam> Extent(SdaiModel model) { return ExtentRange<IfcBeam>(model, 33, false); }
+        static ExtentRange<IfcBeam> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBeam>(model, 33, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBeam and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBeam Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBeam"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBeam if the actual type of SdaiInstance is IfcBeam or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBeam CreateExactEntity(SdaiInstance instance) { return IfcBeam(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBeam or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBeam(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBeamTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(154); int v = getENUM(154, IfcBeamTypeEnum_hash); if (v >= 0) return (IfcBeamTypeEnum) v; else return Nullable<IfcBeamTypeEnum>(); }
+        void put_PredefinedType(IfcBeamTypeEnum value) { RDF_EXPRESS_PROBE(154); TextValue val = IfcBeamTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(154), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 154;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBeam_CLASS_H
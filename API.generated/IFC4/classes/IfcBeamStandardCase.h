@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBeamStandardCase_CLASS_H
+#define __RDF_LTD__IFC4_IfcBeamStandardCase_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBeam.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBeamStandardCase
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBeamStandardCase : public RDF_EXPRESS_VIRTUAL IfcBeam
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBeamStandardCase
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBeamStandardCase(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 34);
+        }
+
+        /// <summary>
+        /// Instances of IfcBeamStandardCase in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBeamStandardCase> Extent(SdaiModel model) { return ExtentRange<IfcBeamStandardCase>(model, 34, false); }
+        static ExtentRange<IfcBeamStandardCase> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBeamStandardCase>(model, 34, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBeamStandardCase and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBeamStandardCase Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBeamStandardCase"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBeamStandardCase if the actual type of SdaiInstance is IfcBeamStandardCase or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBeamStandardCase CreateExactEntity(SdaiInstance instance) { return IfcBeamStandardCase(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBeamStandardCase or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBeamStandardCase(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBeam::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBeamStandardCase_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBeamType_CLASS_H
+#define __RDF_LTD__IFC4_IfcBeamType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBeamType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBeamType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBeamType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBeamType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 35);
+        }
+
+        /// <summary>
+        /// Instances of IfcBeamType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBeamType> Extent(SdaiModel model) { return ExtentRange<IfcBeamType>(model, 35, false); }
+        static ExtentRange<IfcBeamType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBeamType>(model, 35, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBeamType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBeamType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBeamType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBeamType if the actual type of SdaiInstance is IfcBeamType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBeamType CreateExactEntity(SdaiInstance instance) { return IfcBeamType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBeamType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBeamType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBeamTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(155); int v = getENUM(155, IfcBeamTypeEnum_hash); if (v >= 0) return (IfcBeamTypeEnum) v; else return Nullable<IfcBeamTypeEnum>(); }
+        void put_PredefinedType(IfcBeamTypeEnum value) { RDF_EXPRESS_PROBE(155); TextValue val = IfcBeamTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(155), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 155;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBeamType_CLASS_H
@@ -0,0 +1,78 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBlobTexture_CLASS_H
+#define __RDF_LTD__IFC4_IfcBlobTexture_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSurfaceTexture.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBlobTexture
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBlobTexture : public RDF_EXPRESS_VIRTUAL IfcSurfaceTexture
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBlobTexture
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBlobTexture(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 36);
+        }
+
+        /// <summary>
+        /// Instances of IfcBlobTexture in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBlobTexture> Extent(SdaiModel model) { return ExtentRange<IfcBlobTexture>(model, 36, false); }
+        static ExtentRange<IfcBlobTexture> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBlobTexture>(model, 36, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBlobTexture and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBlobTexture Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBlobTexture"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBlobTexture if the actual type of SdaiInstance is IfcBlobTexture or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBlobTexture CreateExactEntity(SdaiInstance instance) { return IfcBlobTexture(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBlobTexture or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBlobTexture(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_RasterFormat() { RDF_EXPRESS_PROBE(163); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(163), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_RasterFormat_view() { return TextView(get_RasterFormat()); }
+#endif
+        void put_RasterFormat(IfcIdentifier value) { RDF_EXPRESS_PROBE(163); sdaiPutAttr(m_instance, getAttrDefinition(163), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_RasterFormat_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(163); return buffer.GetAttr(m_instance, "RasterFormat"); }
+        const char* get_RasterFormat_utf8() { return get_RasterFormat_utf8(ThreadUtf8Buffer()); }
+
+        IfcBinary get_RasterCode() { RDF_EXPRESS_PROBE(164); IfcBinary val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(164), sdaiBINARY, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_RasterCode_view() { return TextView(get_RasterCode()); }
+#endif
+        void put_RasterCode(IfcBinary value) { RDF_EXPRESS_PROBE(164); sdaiPutAttr(m_instance, getAttrDefinition(164), sdaiBINARY, value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSurfaceTexture::attr
+        {
+            static constexpr IntValue RasterFormat = 163;
+            static constexpr IntValue RasterCode = 164;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBlobTexture_CLASS_H
@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBlock_CLASS_H
+#define __RDF_LTD__IFC4_IfcBlock_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCsgPrimitive3D.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBlock
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBlock : public RDF_EXPRESS_VIRTUAL IfcCsgPrimitive3D
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBlock
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBlock(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 37);
+        }
+
+        /// <summary>
+        /// Instances of IfcBlock in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBlock> Extent(SdaiModel model) { return ExtentRange<IfcBlock>(model, 37, false); }
+        static ExtentRange<IfcBlock> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBlock>(model, 37, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBlock and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBlock Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBlock"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBlock if the actual type of SdaiInstance is IfcBlock or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBlock CreateExactEntity(SdaiInstance instance) { return IfcBlock(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBlock or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBlock(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_XLength() { RDF_EXPRESS_PROBE(167); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(167), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_XLength(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(167); sdaiPutAttr(m_instance, getAttrDefinition(167), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_YLength() { RDF_EXPRESS_PROBE(168); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(168), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_YLength(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(168); sdaiPutAttr(m_instance, getAttrDefinition(168), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_ZLength() { RDF_EXPRESS_PROBE(169); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(169), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_ZLength(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(169); sdaiPutAttr(m_instance, getAttrDefinition(169), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCsgPrimitive3D::attr
+        {
+            static constexpr IntValue XLength = 167;
+            static constexpr IntValue YLength = 168;
+            static constexpr IntValue ZLength = 169;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBlock_CLASS_H
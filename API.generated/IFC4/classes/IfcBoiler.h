@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoiler_CLASS_H
+#define __RDF_LTD__IFC4_IfcBoiler_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBoiler
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBoiler : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBoiler
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBoiler(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 38);
+        }
+
+        /// <summary>
+        /// Instances of IfcBoiler in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBoiler> Extent(SdaiModel model) { return ExtentRange<IfcBoiler>(model, 38, false); }
+        static ExtentRange<IfcBoiler> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBoiler>(model, 38, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBoiler and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBoiler Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBoiler"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBoiler if the actual type of SdaiInstance is IfcBoiler or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBoiler CreateExactEntity(SdaiInstance instance) { return IfcBoiler(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBoiler or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBoiler(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBoilerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(170); int v = getENUM(170, IfcBoilerTypeEnum_hash); if (v >= 0) return (IfcBoilerTypeEnum) v; else return Nullable<IfcBoilerTypeEnum>(); }
+        void put_PredefinedType(IfcBoilerTypeEnum value) { RDF_EXPRESS_PROBE(170); TextValue val = IfcBoilerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(170), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 170;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoiler_CLASS_H
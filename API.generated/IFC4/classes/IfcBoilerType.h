@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoilerType_CLASS_H
+#define __RDF_LTD__IFC4_IfcBoilerType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBoilerType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBoilerType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBoilerType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBoilerType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 39);
+        }
+
+        /// <summary>
+        /// Instances of IfcBoilerType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBoilerType> Extent(SdaiModel model) { return ExtentRange<IfcBoilerType>(model, 39, false); }
+        static ExtentRange<IfcBoilerType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBoilerType>(model, 39, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBoilerType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBoilerType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBoilerType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBoilerType if the actual type of SdaiInstance is IfcBoilerType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBoilerType CreateExactEntity(SdaiInstance instance) { return IfcBoilerType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBoilerType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBoilerType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBoilerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(171); int v = getENUM(171, IfcBoilerTypeEnum_hash); if (v >= 0) return (IfcBoilerTypeEnum) v; else return Nullable<IfcBoilerTypeEnum>(); }
+        void put_PredefinedType(IfcBoilerTypeEnum value) { RDF_EXPRESS_PROBE(171); TextValue val = IfcBoilerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(171), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 171;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoilerType_CLASS_H
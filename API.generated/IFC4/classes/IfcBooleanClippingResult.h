@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBooleanClippingResult_CLASS_H
+#define __RDF_LTD__IFC4_IfcBooleanClippingResult_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBooleanResult.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBooleanClippingResult
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBooleanClippingResult : public RDF_EXPRESS_VIRTUAL IfcBooleanResult
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBooleanClippingResult
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBooleanClippingResult(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 40);
+        }
+
+        /// <summary>
+        /// Instances of IfcBooleanClippingResult in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBooleanClippingResult> Extent(SdaiModel model) { return ExtentRange<IfcBooleanClippingResult>(model, 40, false); }
+        static ExtentRange<IfcBooleanClippingResult> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBooleanClippingResult>(model, 40, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBooleanClippingResult and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBooleanClippingResult Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBooleanClippingResult"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBooleanClippingResult if the actual type of SdaiInstance is IfcBooleanClippingResult or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBooleanClippingResult CreateExactEntity(SdaiInstance instance) { return IfcBooleanClippingResult(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBooleanClippingResult or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBooleanClippingResult(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBooleanResult::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBooleanClippingResult_CLASS_H
@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBooleanResult_CLASS_H
+#define __RDF_LTD__IFC4_IfcBooleanResult_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBooleanResult
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBooleanResult : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBooleanResult
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBooleanResult(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 41);
+        }
+
+        /// <summary>
+        /// Instances of IfcBooleanResult in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBooleanResult> Extent(SdaiModel model) { return ExtentRange<IfcBooleanResult>(model, 41, false); }
+        static ExtentRange<IfcBooleanResult> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBooleanResult>(model, 41, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBooleanResult and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBooleanResult Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBooleanResult"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBooleanResult if the actual type of SdaiInstance is IfcBooleanResult or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBooleanResult CreateExactEntity(SdaiInstance instance) { return IfcBooleanResult(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBooleanResult or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBooleanResult(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBooleanOperator> get_Operator() { RDF_EXPRESS_PROBE(172); int v = getENUM(172, IfcBooleanOperator_hash); if (v >= 0) return (IfcBooleanOperator) v; else return Nullable<IfcBooleanOperator>(); }
+        void put_Operator(IfcBooleanOperator value) { RDF_EXPRESS_PROBE(172); TextValue val = IfcBooleanOperator_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(172), sdaiENUM, val); }
+
+        IfcBooleanOperand_get get_FirstOperand() { return IfcBooleanOperand_get(m_instance, 173); }
+        IfcBooleanOperand_put put_FirstOperand() { return IfcBooleanOperand_put(m_instance, 173); }
+
+        IfcBooleanOperand_get get_SecondOperand() { return IfcBooleanOperand_get(m_instance, 174); }
+        IfcBooleanOperand_put put_SecondOperand() { return IfcBooleanOperand_put(m_instance, 174); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(175); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(175), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue Operator = 172;
+            static constexpr IntValue FirstOperand = 173;
+            static constexpr IntValue SecondOperand = 174;
+            static constexpr IntValue Dim = 175;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBooleanResult_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundaryCurve_CLASS_H
+#define __RDF_LTD__IFC4_IfcBoundaryCurve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCompositeCurveOnSurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBoundaryCurve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBoundaryCurve : public RDF_EXPRESS_VIRTUAL IfcCompositeCurveOnSurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBoundaryCurve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBoundaryCurve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 43);
+        }
+
+        /// <summary>
+        /// Instances of IfcBoundaryCurve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBoundaryCurve> Extent(SdaiModel model) { return ExtentRange<IfcBoundaryCurve>(model, 43, false); }
+        static ExtentRange<IfcBoundaryCurve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBoundaryCurve>(model, 43, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBoundaryCurve and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBoundaryCurve Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBoundaryCurve"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBoundaryCurve if the actual type of SdaiInstance is IfcBoundaryCurve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBoundaryCurve CreateExactEntity(SdaiInstance instance) { return IfcBoundaryCurve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBoundaryCurve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBoundaryCurve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCompositeCurveOnSurface::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundaryCurve_CLASS_H
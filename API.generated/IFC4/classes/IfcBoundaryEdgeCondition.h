@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundaryEdgeCondition_CLASS_H
+#define __RDF_LTD__IFC4_IfcBoundaryEdgeCondition_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundaryCondition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBoundaryEdgeCondition
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBoundaryEdgeCondition : public RDF_EXPRESS_VIRTUAL IfcBoundaryCondition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBoundaryEdgeCondition
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBoundaryEdgeCondition(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 44);
+        }
+
+        /// <summary>
+        /// Instances of IfcBoundaryEdgeCondition in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBoundaryEdgeCondition> Extent(SdaiModel model) { return ExtentRange<IfcBoundaryEdgeCondition>(model, 44, false); }
+        static ExtentRange<IfcBoundaryEdgeCondition> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBoundaryEdgeCondition>(model, 44, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBoundaryEdgeCondition and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBoundaryEdgeCondition Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBoundaryEdgeCondition"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBoundaryEdgeCondition if the actual type of SdaiInstance is IfcBoundaryEdgeCondition or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBoundaryEdgeCondition CreateExactEntity(SdaiInstance instance) { return IfcBoundaryEdgeCondition(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBoundaryEdgeCondition or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBoundaryEdgeCondition(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcModulusOfTranslationalSubgradeReactionSelect_get get_TranslationalStiffnessByLengthX() { return IfcModulusOfTranslationalSubgradeReactionSelect_get(m_instance, 183); }
+        IfcModulusOfTranslationalSubgradeReactionSelect_put put_TranslationalStiffnessByLengthX() { return IfcModulusOfTranslationalSubgradeReactionSelect_put(m_instance, 183); }
+
+        IfcModulusOfTranslationalSubgradeReactionSelect_get get_TranslationalStiffnessByLengthY() { return IfcModulusOfTranslationalSubgradeReactionSelect_get(m_instance, 184); }
+        IfcModulusOfTranslationalSubgradeReactionSelect_put put_TranslationalStiffnessByLengthY() { return IfcModulusOfTranslationalSubgradeReactionSelect_put(m_instance, 184); }
+
+        IfcModulusOfTranslationalSubgradeReactionSelect_get get_TranslationalStiffnessByLengthZ() { return IfcModulusOfTranslationalSubgradeReactionSelect_get(m_instance, 185); }
+        IfcModulusOfTranslationalSubgradeReactionSelect_put put_TranslationalStiffnessByLengthZ() { return IfcModulusOfTranslationalSubgradeReactionSelect_put(m_instance, 185); }
+
+        IfcModulusOfRotationalSubgradeReactionSelect_get get_RotationalStiffnessByLengthX() { return IfcModulusOfRotationalSubgradeReactionSelect_get(m_instance, 186); }
+        IfcModulusOfRotationalSubgradeReactionSelect_put put_RotationalStiffnessByLengthX() { return IfcModulusOfRotationalSubgradeReactionSelect_put(m_instance, 186); }
+
+        IfcModulusOfRotationalSubgradeReactionSelect_get get_RotationalStiffnessByLengthY() { return IfcModulusOfRotationalSubgradeReactionSelect_get(m_instance, 187); }
+        IfcModulusOfRotationalSubgradeReactionSelect_put put_RotationalStiffnessByLengthY() { return IfcModulusOfRotationalSubgradeReactionSelect_put(m_instance, 187); }
+
+        IfcModulusOfRotationalSubgradeReactionSelect_get get_RotationalStiffnessByLengthZ() { return IfcModulusOfRotationalSubgradeReactionSelect_get(m_instance, 188); }
+        IfcModulusOfRotationalSubgradeReactionSelect_put put_RotationalStiffnessByLengthZ() { return IfcModulusOfRotationalSubgradeReactionSelect_put(m_instance, 188); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundaryCondition::attr
+        {
+            static constexpr IntValue TranslationalStiffnessByLengthX = 183;
+            static constexpr IntValue TranslationalStiffnessByLengthY = 184;
+            static constexpr IntValue TranslationalStiffnessByLengthZ = 185;
+            static constexpr IntValue RotationalStiffnessByLengthX = 186;
+            static constexpr IntValue RotationalStiffnessByLengthY = 187;
+            static constexpr IntValue RotationalStiffnessByLengthZ = 188;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundaryEdgeCondition_CLASS_H
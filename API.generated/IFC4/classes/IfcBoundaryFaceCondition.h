@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundaryFaceCondition_CLASS_H
+#define __RDF_LTD__IFC4_IfcBoundaryFaceCondition_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundaryCondition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBoundaryFaceCondition
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBoundaryFaceCondition : public RDF_EXPRESS_VIRTUAL IfcBoundaryCondition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBoundaryFaceCondition
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBoundaryFaceCondition(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 45);
+        }
+
+        /// <summary>
+        /// Instances of IfcBoundaryFaceCondition in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBoundaryFaceCondition> Extent(SdaiModel model) { return ExtentRange<IfcBoundaryFaceCondition>(model, 45, false); }
+        static ExtentRange<IfcBoundaryFaceCondition> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBoundaryFaceCondition>(model, 45, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBoundaryFaceCondition and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBoundaryFaceCondition Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBoundaryFaceCondition"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBoundaryFaceCondition if the actual type of SdaiInstance is IfcBoundaryFaceCondition or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBoundaryFaceCondition CreateExactEntity(SdaiInstance instance) { return IfcBoundaryFaceCondition(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBoundaryFaceCondition or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBoundaryFaceCondition(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcModulusOfSubgradeReactionSelect_get get_TranslationalStiffnessByAreaX() { return IfcModulusOfSubgradeReactionSelect_get(m_instance, 189); }
+        IfcModulusOfSubgradeReactionSelect_put put_TranslationalStiffnessByAreaX() { return IfcModulusOfSubgradeReactionSelect_put(m_instance, 189); }
+
+        IfcModulusOfSubgradeReactionSelect_get get_TranslationalStiffnessByAreaY() { return IfcModulusOfSubgradeReactionSelect_get(m_instance, 190); }
+        IfcModulusOfSubgradeReactionSelect_put put_TranslationalStiffnessByAreaY() { return IfcModulusOfSubgradeReactionSelect_put(m_instance, 190); }
+
+        IfcModulusOfSubgradeReactionSelect_get get_TranslationalStiffnessByAreaZ() { return IfcModulusOfSubgradeReactionSelect_get(m_instance, 191); }
+        IfcModulusOfSubgradeReactionSelect_put put_TranslationalStiffnessByAreaZ() { return IfcModulusOfSubgradeReactionSelect_put(m_instance, 191); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundaryCondition::attr
+        {
+            static constexpr IntValue TranslationalStiffnessByAreaX = 189;
+            static constexpr IntValue TranslationalStiffnessByAreaY = 190;
+            static constexpr IntValue TranslationalStiffnessByAreaZ = 191;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundaryFaceCondition_CLASS_H
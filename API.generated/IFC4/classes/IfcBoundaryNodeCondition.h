@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundaryNodeCondition_CLASS_H
+#define __RDF_LTD__IFC4_IfcBoundaryNodeCondition_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundaryCondition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBoundaryNodeCondition
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBoundaryNodeCondition : public RDF_EXPRESS_VIRTUAL IfcBoundaryCondition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBoundaryNodeCondition
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBoundaryNodeCondition(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 46);
+        }
+
+        /// <summary>
+        /// Instances of IfcBoundaryNodeCondition in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBoundaryNodeCondition> Extent(SdaiModel model) { return ExtentRange<IfcBoundaryNodeCondition>(model, 46, false); }
+        static ExtentRange<IfcBoundaryNodeCondition> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBoundaryNodeCondition>(model, 46, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBoundaryNodeCondition and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBoundaryNodeCondition Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBoundaryNodeCondition"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBoundaryNodeCondition if the actual type of SdaiInstance is IfcBoundaryNodeCondition or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBoundaryNodeCondition CreateExactEntity(SdaiInstance instance) { return IfcBoundaryNodeCondition(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBoundaryNodeCondition or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBoundaryNodeCondition(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcTranslationalStiffnessSelect_get get_TranslationalStiffnessX() { return IfcTranslationalStiffnessSelect_get(m_instance, 192); }
+        IfcTranslationalStiffnessSelect_put put_TranslationalStiffnessX() { return IfcTranslationalStiffnessSelect_put(m_instance, 192); }
+
+        IfcTranslationalStiffnessSelect_get get_TranslationalStiffnessY() { return IfcTranslationalStiffnessSelect_get(m_instance, 193); }
+        IfcTranslationalStiffnessSelect_put put_TranslationalStiffnessY() { return IfcTranslationalStiffnessSelect_put(m_instance, 193); }
+
+        IfcTranslationalStiffnessSelect_get get_TranslationalStiffnessZ() { return IfcTranslationalStiffnessSelect_get(m_instance, 194); }
+        IfcTranslationalStiffnessSelect_put put_TranslationalStiffnessZ() { return IfcTranslationalStiffnessSelect_put(m_instance, 194); }
+
+        IfcRotationalStiffnessSelect_get get_RotationalStiffnessX() { return IfcRotationalStiffnessSelect_get(m_instance, 195); }
+        IfcRotationalStiffnessSelect_put put_RotationalStiffnessX() { return IfcRotationalStiffnessSelect_put(m_instance, 195); }
+
+        IfcRotationalStiffnessSelect_get get_RotationalStiffnessY() { return IfcRotationalStiffnessSelect_get(m_instance, 196); }
+        IfcRotationalStiffnessSelect_put put_RotationalStiffnessY() { return IfcRotationalStiffnessSelect_put(m_instance, 196); }
+
+        IfcRotationalStiffnessSelect_get get_RotationalStiffnessZ() { return IfcRotationalStiffnessSelect_get(m_instance, 197); }
+        IfcRotationalStiffnessSelect_put put_RotationalStiffnessZ() { return IfcRotationalStiffnessSelect_put(m_instance, 197); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundaryCondition::attr
+        {
+            static constexpr IntValue TranslationalStiffnessX = 192;
+            static constexpr IntValue TranslationalStiffnessY = 193;
+            static constexpr IntValue TranslationalStiffnessZ = 194;
+            static constexpr IntValue RotationalStiffnessX = 195;
+            static constexpr IntValue RotationalStiffnessY = 196;
+            static constexpr IntValue RotationalStiffnessZ = 197;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundaryNodeCondition_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundaryNodeConditionWarping_CLASS_H
+#define __RDF_LTD__IFC4_IfcBoundaryNodeConditionWarping_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundaryNodeCondition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBoundaryNodeConditionWarping
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBoundaryNodeConditionWarping : public RDF_EXPRESS_VIRTUAL IfcBoundaryNodeCondition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBoundaryNodeConditionWarping
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBoundaryNodeConditionWarping(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 47);
+        }
+
+        /// <summary>
+        /// Instances of IfcBoundaryNodeConditionWarping in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBoundaryNodeConditionWarping> Extent(SdaiModel model) { return ExtentRange<IfcBoundaryNodeConditionWarping>(model, 47, false); }
+        static ExtentRange<IfcBoundaryNodeConditionWarping> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBoundaryNodeConditionWarping>(model, 47, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBoundaryNodeConditionWarping and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBoundaryNodeConditionWarping Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBoundaryNodeConditionWarping"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBoundaryNodeConditionWarping if the actual type of SdaiInstance is IfcBoundaryNodeConditionWarping or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBoundaryNodeConditionWarping CreateExactEntity(SdaiInstance instance) { return IfcBoundaryNodeConditionWarping(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBoundaryNodeConditionWarping or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBoundaryNodeConditionWarping(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcWarpingStiffnessSelect_get get_WarpingStiffness() { return IfcWarpingStiffnessSelect_get(m_instance, 198); }
+        IfcWarpingStiffnessSelect_put put_WarpingStiffness() { return IfcWarpingStiffnessSelect_put(m_instance, 198); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundaryNodeCondition::attr
+        {
+            static constexpr IntValue WarpingStiffness = 198;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundaryNodeConditionWarping_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundedCurve_CLASS_H
+#define __RDF_LTD__IFC4_IfcBoundedCurve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBoundedCurve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBoundedCurve : public RDF_EXPRESS_VIRTUAL IfcCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBoundedCurve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBoundedCurve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 48);
+        }
+
+        /// <summary>
+        /// Instances of IfcBoundedCurve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBoundedCurve> Extent(SdaiModel model) { return ExtentRange<IfcBoundedCurve>(model, 48, false); }
+        static ExtentRange<IfcBoundedCurve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBoundedCurve>(model, 48, true); }
+
+        /// <summary>
+        /// Returns object of IfcBoundedCurve if the actual type of SdaiInstance is IfcBoundedCurve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBoundedCurve CreateExactEntity(SdaiInstance instance) { return IfcBoundedCurve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBoundedCurve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBoundedCurve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCurve::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundedCurve_CLASS_H
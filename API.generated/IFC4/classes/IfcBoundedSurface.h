@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundedSurface_CLASS_H
+#define __RDF_LTD__IFC4_IfcBoundedSurface_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBoundedSurface
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBoundedSurface : public RDF_EXPRESS_VIRTUAL IfcSurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBoundedSurface
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBoundedSurface(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 49);
+        }
+
+        /// <summary>
+        /// Instances of IfcBoundedSurface in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBoundedSurface> Extent(SdaiModel model) { return ExtentRange<IfcBoundedSurface>(model, 49, false); }
+        static ExtentRange<IfcBoundedSurface> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBoundedSurface>(model, 49, true); }
+
+        /// <summary>
+        /// Returns object of IfcBoundedSurface if the actual type of SdaiInstance is IfcBoundedSurface or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBoundedSurface CreateExactEntity(SdaiInstance instance) { return IfcBoundedSurface(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBoundedSurface or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBoundedSurface(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSurface::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundedSurface_CLASS_H
@@ -0,0 +1,79 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoundingBox_CLASS_H
+#define __RDF_LTD__IFC4_IfcBoundingBox_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBoundingBox
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBoundingBox : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBoundingBox
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBoundingBox(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 50);
+        }
+
+        /// <summary>
+        /// Instances of IfcBoundingBox in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBoundingBox> Extent(SdaiModel model) { return ExtentRange<IfcBoundingBox>(model, 50, false); }
+        static ExtentRange<IfcBoundingBox> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBoundingBox>(model, 50, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBoundingBox and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBoundingBox Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBoundingBox"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBoundingBox if the actual type of SdaiInstance is IfcBoundingBox or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBoundingBox CreateExactEntity(SdaiInstance instance) { return IfcBoundingBox(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBoundingBox or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBoundingBox(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCartesianPoint get_Corner();
+        void put_Corner(IfcCartesianPoint inst);
+
+        Nullable<IfcPositiveLengthMeasure> get_XDim() { RDF_EXPRESS_PROBE(201); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(201), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_XDim(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(201); sdaiPutAttr(m_instance, getAttrDefinition(201), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_YDim() { RDF_EXPRESS_PROBE(202); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(202), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_YDim(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(202); sdaiPutAttr(m_instance, getAttrDefinition(202), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_ZDim() { RDF_EXPRESS_PROBE(203); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(203), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_ZDim(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(203); sdaiPutAttr(m_instance, getAttrDefinition(203), sdaiREAL, &value); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(204); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(204), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue Corner = 200;
+            static constexpr IntValue XDim = 201;
+            static constexpr IntValue YDim = 202;
+            static constexpr IntValue ZDim = 203;
+            static constexpr IntValue Dim = 204;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoundingBox_CLASS_H
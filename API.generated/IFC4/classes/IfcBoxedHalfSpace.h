@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBoxedHalfSpace_CLASS_H
+#define __RDF_LTD__IFC4_IfcBoxedHalfSpace_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcHalfSpaceSolid.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBoxedHalfSpace
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBoxedHalfSpace : public RDF_EXPRESS_VIRTUAL IfcHalfSpaceSolid
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBoxedHalfSpace
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBoxedHalfSpace(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 51);
+        }
+
+        /// <summary>
+        /// Instances of IfcBoxedHalfSpace in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBoxedHalfSpace> Extent(SdaiModel model) { return ExtentRange<IfcBoxedHalfSpace>(model, 51, false); }
+        static ExtentRange<IfcBoxedHalfSpace> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBoxedHalfSpace>(model, 51, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBoxedHalfSpace and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBoxedHalfSpace Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBoxedHalfSpace"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBoxedHalfSpace if the actual type of SdaiInstance is IfcBoxedHalfSpace or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBoxedHalfSpace CreateExactEntity(SdaiInstance instance) { return IfcBoxedHalfSpace(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBoxedHalfSpace or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBoxedHalfSpace(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcBoundingBox get_Enclosure();
+        void put_Enclosure(IfcBoundingBox inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcHalfSpaceSolid::attr
+        {
+            static constexpr IntValue Enclosure = 208;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBoxedHalfSpace_CLASS_H
@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuilding_CLASS_H
+#define __RDF_LTD__IFC4_IfcBuilding_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSpatialStructureElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBuilding
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBuilding : public RDF_EXPRESS_VIRTUAL IfcSpatialStructureElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBuilding
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBuilding(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 56);
+        }
+
+        /// <summary>
+        /// Instances of IfcBuilding in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBuilding> Extent(SdaiModel model) { return ExtentRange<IfcBuilding>(model, 56, false); }
+        static ExtentRange<IfcBuilding> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBuilding>(model, 56, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBuilding and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBuilding Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBuilding"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBuilding if the actual type of SdaiInstance is IfcBuilding or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBuilding CreateExactEntity(SdaiInstance instance) { return IfcBuilding(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBuilding or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBuilding(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLengthMeasure> get_ElevationOfRefHeight() { RDF_EXPRESS_PROBE(242); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(242), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_ElevationOfRefHeight(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(242); sdaiPutAttr(m_instance, getAttrDefinition(242), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_ElevationOfTerrain() { RDF_EXPRESS_PROBE(243); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(243), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_ElevationOfTerrain(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(243); sdaiPutAttr(m_instance, getAttrDefinition(243), sdaiREAL, &value); }
+
+        IfcPostalAddress get_BuildingAddress();
+        void put_BuildingAddress(IfcPostalAddress inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSpatialStructureElement::attr
+        {
+            static constexpr IntValue ElevationOfRefHeight = 242;
+            static constexpr IntValue ElevationOfTerrain = 243;
+            static constexpr IntValue BuildingAddress = 244;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuilding_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcBuildingElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBuildingElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBuildingElement : public RDF_EXPRESS_VIRTUAL IfcElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBuildingElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBuildingElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 57);
+        }
+
+        /// <summary>
+        /// Instances of IfcBuildingElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBuildingElement> Extent(SdaiModel model) { return ExtentRange<IfcBuildingElement>(model, 57, false); }
+        static ExtentRange<IfcBuildingElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBuildingElement>(model, 57, true); }
+
+        /// <summary>
+        /// Returns object of IfcBuildingElement if the actual type of SdaiInstance is IfcBuildingElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBuildingElement CreateExactEntity(SdaiInstance instance) { return IfcBuildingElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBuildingElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBuildingElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElement::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuildingElement_CLASS_H
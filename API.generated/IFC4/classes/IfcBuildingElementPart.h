@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingElementPart_CLASS_H
+#define __RDF_LTD__IFC4_IfcBuildingElementPart_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementComponent.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBuildingElementPart
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBuildingElementPart : public RDF_EXPRESS_VIRTUAL IfcElementComponent
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBuildingElementPart
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBuildingElementPart(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 58);
+        }
+
+        /// <summary>
+        /// Instances of IfcBuildingElementPart in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBuildingElementPart> Extent(SdaiModel model) { return ExtentRange<IfcBuildingElementPart>(model, 58, false); }
+        static ExtentRange<IfcBuildingElementPart> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBuildingElementPart>(model, 58, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBuildingElementPart and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBuildingElementPart Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBuildingElementPart"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBuildingElementPart if the actual type of SdaiInstance is IfcBuildingElementPart or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBuildingElementPart CreateExactEntity(SdaiInstance instance) { return IfcBuildingElementPart(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBuildingElementPart or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBuildingElementPart(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBuildingElementPartTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(245); int v = getENUM(245, IfcBuildingElementPartTypeEnum_hash); if (v >= 0) return (IfcBuildingElementPartTypeEnum) v; else return Nullable<IfcBuildingElementPartTypeEnum>(); }
+        void put_PredefinedType(IfcBuildingElementPartTypeEnum value) { RDF_EXPRESS_PROBE(245); TextValue val = IfcBuildingElementPartTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(245), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementComponent::attr
+        {
+            static constexpr IntValue PredefinedType = 245;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuildingElementPart_CLASS_H
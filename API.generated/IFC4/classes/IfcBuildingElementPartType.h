@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingElementPartType_CLASS_H
+#define __RDF_LTD__IFC4_IfcBuildingElementPartType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementComponentType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBuildingElementPartType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBuildingElementPartType : public RDF_EXPRESS_VIRTUAL IfcElementComponentType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBuildingElementPartType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBuildingElementPartType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 59);
+        }
+
+        /// <summary>
+        /// Instances of IfcBuildingElementPartType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBuildingElementPartType> Extent(SdaiModel model) { return ExtentRange<IfcBuildingElementPartType>(model, 59, false); }
+        static ExtentRange<IfcBuildingElementPartType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBuildingElementPartType>(model, 59, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBuildingElementPartType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBuildingElementPartType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBuildingElementPartType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBuildingElementPartType if the actual type of SdaiInstance is IfcBuildingElementPartType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBuildingElementPartType CreateExactEntity(SdaiInstance instance) { return IfcBuildingElementPartType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBuildingElementPartType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBuildingElementPartType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBuildingElementPartTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(246); int v = getENUM(246, IfcBuildingElementPartTypeEnum_hash); if (v >= 0) return (IfcBuildingElementPartTypeEnum) v; else return Nullable<IfcBuildingElementPartTypeEnum>(); }
+        void put_PredefinedType(IfcBuildingElementPartTypeEnum value) { RDF_EXPRESS_PROBE(246); TextValue val = IfcBuildingElementPartTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(246), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementComponentType::attr
+        {
+            static constexpr IntValue PredefinedType = 246;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuildingElementPartType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingElementProxy_CLASS_H
+#define __RDF_LTD__IFC4_IfcBuildingElementProxy_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBuildingElementProxy
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBuildingElementProxy : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBuildingElementProxy
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBuildingElementProxy(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 60);
+        }
+
+        /// <summary>
+        /// Instances of IfcBuildingElementProxy in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBuildingElementProxy> Extent(SdaiModel model) { return ExtentRange<IfcBuildingElementProxy>(model, 60, false); }
+        static ExtentRange<IfcBuildingElementProxy> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBuildingElementProxy>(model, 60, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBuildingElementProxy and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBuildingElementProxy Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBuildingElementProxy"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBuildingElementProxy if the actual type of SdaiInstance is IfcBuildingElementProxy or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBuildingElementProxy CreateExactEntity(SdaiInstance instance) { return IfcBuildingElementProxy(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBuildingElementProxy or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBuildingElementProxy(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBuildingElementProxyTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(247); int v = getENUM(247, IfcBuildingElementProxyTypeEnum_hash); if (v >= 0) return (IfcBuildingElementProxyTypeEnum) v; else return Nullable<IfcBuildingElementProxyTypeEnum>(); }
+        void put_PredefinedType(IfcBuildingElementProxyTypeEnum value) { RDF_EXPRESS_PROBE(247); TextValue val = IfcBuildingElementProxyTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(247), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 247;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuildingElementProxy_CLASS_H
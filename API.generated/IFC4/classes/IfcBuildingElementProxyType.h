@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingElementProxyType_CLASS_H
+#define __RDF_LTD__IFC4_IfcBuildingElementProxyType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBuildingElementProxyType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBuildingElementProxyType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBuildingElementProxyType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBuildingElementProxyType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 61);
+        }
+
+        /// <summary>
+        /// Instances of IfcBuildingElementProxyType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBuildingElementProxyType> Extent(SdaiModel model) { return ExtentRange<IfcBuildingElementProxyType>(model, 61, false); }
+        static ExtentRange<IfcBuildingElementProxyType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBuildingElementProxyType>(model, 61, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBuildingElementProxyType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBuildingElementProxyType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBuildingElementProxyType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBuildingElementProxyType if the actual type of SdaiInstance is IfcBuildingElementProxyType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBuildingElementProxyType CreateExactEntity(SdaiInstance instance) { return IfcBuildingElementProxyType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBuildingElementProxyType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBuildingElementProxyType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBuildingElementProxyTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(248); int v = getENUM(248, IfcBuildingElementProxyTypeEnum_hash); if (v >= 0) return (IfcBuildingElementProxyTypeEnum) v; else return Nullable<IfcBuildingElementProxyTypeEnum>(); }
+        void put_PredefinedType(IfcBuildingElementProxyTypeEnum value) { RDF_EXPRESS_PROBE(248); TextValue val = IfcBuildingElementProxyTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(248), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 248;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuildingElementProxyType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingStorey_CLASS_H
+#define __RDF_LTD__IFC4_IfcBuildingStorey_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSpatialStructureElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBuildingStorey
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBuildingStorey : public RDF_EXPRESS_VIRTUAL IfcSpatialStructureElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBuildingStorey
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBuildingStorey(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 63);
+        }
+
+        /// <summary>
+        /// Instances of IfcBuildingStorey in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBuildingStorey> Extent(SdaiModel model) { return ExtentRange<IfcBuildingStorey>(model, 63, false); }
+        static ExtentRange<IfcBuildingStorey> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBuildingStorey>(model, 63, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBuildingStorey and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBuildingStorey Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBuildingStorey"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBuildingStorey if the actual type of SdaiInstance is IfcBuildingStorey or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBuildingStorey CreateExactEntity(SdaiInstance instance) { return IfcBuildingStorey(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBuildingStorey or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBuildingStorey(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLengthMeasure> get_Elevation() { RDF_EXPRESS_PROBE(249); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(249), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_Elevation(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(249); sdaiPutAttr(m_instance, getAttrDefinition(249), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSpatialStructureElement::attr
+        {
+            static constexpr IntValue Elevation = 249;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuildingStorey_CLASS_H
@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBuildingSystem_CLASS_H
+#define __RDF_LTD__IFC4_IfcBuildingSystem_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSystem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBuildingSystem
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBuildingSystem : public RDF_EXPRESS_VIRTUAL IfcSystem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBuildingSystem
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBuildingSystem(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 64);
+        }
+
+        /// <summary>
+        /// Instances of IfcBuildingSystem in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBuildingSystem> Extent(SdaiModel model) { return ExtentRange<IfcBuildingSystem>(model, 64, false); }
+        static ExtentRange<IfcBuildingSystem> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBuildingSystem>(model, 64, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBuildingSystem and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBuildingSystem Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBuildingSystem"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBuildingSystem if the actual type of SdaiInstance is IfcBuildingSystem or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBuildingSystem CreateExactEntity(SdaiInstance instance) { return IfcBuildingSystem(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBuildingSystem or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBuildingSystem(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBuildingSystemTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(251); int v = getENUM(251, IfcBuildingSystemTypeEnum_hash); if (v >= 0) return (IfcBuildingSystemTypeEnum) v; else return Nullable<IfcBuildingSystemTypeEnum>(); }
+        void put_PredefinedType(IfcBuildingSystemTypeEnum value) { RDF_EXPRESS_PROBE(251); TextValue val = IfcBuildingSystemTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(251), sdaiENUM, val); }
+
+        IfcLabel get_LongName() { RDF_EXPRESS_PROBE(252); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(252), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LongName_view() { return TextView(get_LongName()); }
+#endif
+        void put_LongName(IfcLabel value) { RDF_EXPRESS_PROBE(252); sdaiPutAttr(m_instance, getAttrDefinition(252), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LongName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(252); return buffer.GetAttr(m_instance, "LongName"); }
+        const char* get_LongName_utf8() { return get_LongName_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSystem::attr
+        {
+            static constexpr IntValue PredefinedType = 251;
+            static constexpr IntValue LongName = 252;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBuildingSystem_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBurner_CLASS_H
+#define __RDF_LTD__IFC4_IfcBurner_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBurner
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBurner : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBurner
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBurner(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 65);
+        }
+
+        /// <summary>
+        /// Instances of IfcBurner in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBurner> Extent(SdaiModel model) { return ExtentRange<IfcBurner>(model, 65, false); }
+        static ExtentRange<IfcBurner> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBurner>(model, 65, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBurner and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBurner Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBurner"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBurner if the actual type of SdaiInstance is IfcBurner or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBurner CreateExactEntity(SdaiInstance instance) { return IfcBurner(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBurner or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBurner(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBurnerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(253); int v = getENUM(253, IfcBurnerTypeEnum_hash); if (v >= 0) return (IfcBurnerTypeEnum) v; else return Nullable<IfcBurnerTypeEnum>(); }
+        void put_PredefinedType(IfcBurnerTypeEnum value) { RDF_EXPRESS_PROBE(253); TextValue val = IfcBurnerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(253), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 253;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBurner_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBurnerType_CLASS_H
+#define __RDF_LTD__IFC4_IfcBurnerType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcBurnerType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcBurnerType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcBurnerType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcBurnerType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 66);
+        }
+
+        /// <summary>
+        /// Instances of IfcBurnerType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcBurnerType> Extent(SdaiModel model) { return ExtentRange<IfcBurnerType>(model, 66, false); }
+        static ExtentRange<IfcBurnerType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcBurnerType>(model, 66, true); }
+
+        /// <summary>
+        /// Create new instance of IfcBurnerType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcBurnerType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcBurnerType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcBurnerType if the actual type of SdaiInstance is IfcBurnerType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcBurnerType CreateExactEntity(SdaiInstance instance) { return IfcBurnerType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcBurnerType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcBurnerType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBurnerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(254); int v = getENUM(254, IfcBurnerTypeEnum_hash); if (v >= 0) return (IfcBurnerTypeEnum) v; else return Nullable<IfcBurnerTypeEnum>(); }
+        void put_PredefinedType(IfcBurnerTypeEnum value) { RDF_EXPRESS_PROBE(254); TextValue val = IfcBurnerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(254), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 254;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcBurnerType_CLASS_H
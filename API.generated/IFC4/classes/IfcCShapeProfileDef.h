@@ -0,0 +1,80 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCShapeProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcCShapeProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCShapeProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCShapeProfileDef : public RDF_EXPRESS_VIRTUAL IfcParameterizedProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCShapeProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCShapeProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 156);
+        }
+
+        /// <summary>
+        /// Instances of IfcCShapeProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCShapeProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcCShapeProfileDef>(model, 156, false); }
+        static ExtentRange<IfcCShapeProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCShapeProfileDef>(model, 156, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCShapeProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCShapeProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCShapeProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCShapeProfileDef if the actual type of SdaiInstance is IfcCShapeProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCShapeProfileDef CreateExactEntity(SdaiInstance instance) { return IfcCShapeProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCShapeProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCShapeProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Depth() { RDF_EXPRESS_PROBE(431); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(431), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Depth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(431); sdaiPutAttr(m_instance, getAttrDefinition(431), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Width() { RDF_EXPRESS_PROBE(432); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(432), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Width(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(432); sdaiPutAttr(m_instance, getAttrDefinition(432), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_WallThickness() { RDF_EXPRESS_PROBE(433); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(433), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_WallThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(433); sdaiPutAttr(m_instance, getAttrDefinition(433), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Girth() { RDF_EXPRESS_PROBE(434); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(434), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Girth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(434); sdaiPutAttr(m_instance, getAttrDefinition(434), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_InternalFilletRadius() { RDF_EXPRESS_PROBE(435); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(435), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_InternalFilletRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(435); sdaiPutAttr(m_instance, getAttrDefinition(435), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcParameterizedProfileDef::attr
+        {
+            static constexpr IntValue Depth = 431;
+            static constexpr IntValue Width = 432;
+            static constexpr IntValue WallThickness = 433;
+            static constexpr IntValue Girth = 434;
+            static constexpr IntValue InternalFilletRadius = 435;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCShapeProfileDef_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableCarrierFitting_CLASS_H
+#define __RDF_LTD__IFC4_IfcCableCarrierFitting_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowFitting.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCableCarrierFitting
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCableCarrierFitting : public RDF_EXPRESS_VIRTUAL IfcFlowFitting
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCableCarrierFitting
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCableCarrierFitting(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 67);
+        }
+
+        /// <summary>
+        /// Instances of IfcCableCarrierFitting in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCableCarrierFitting> Extent(SdaiModel model) { return ExtentRange<IfcCableCarrierFitting>(model, 67, false); }
+        static ExtentRange<IfcCableCarrierFitting> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCableCarrierFitting>(model, 67, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCableCarrierFitting and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCableCarrierFitting Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCableCarrierFitting"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCableCarrierFitting if the actual type of SdaiInstance is IfcCableCarrierFitting or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCableCarrierFitting CreateExactEntity(SdaiInstance instance) { return IfcCableCarrierFitting(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCableCarrierFitting or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCableCarrierFitting(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCableCarrierFittingTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(255); int v = getENUM(255, IfcCableCarrierFittingTypeEnum_hash); if (v >= 0) return (IfcCableCarrierFittingTypeEnum) v; else return Nullable<IfcCableCarrierFittingTypeEnum>(); }
+        void put_PredefinedType(IfcCableCarrierFittingTypeEnum value) { RDF_EXPRESS_PROBE(255); TextValue val = IfcCableCarrierFittingTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(255), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowFitting::attr
+        {
+            static constexpr IntValue PredefinedType = 255;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableCarrierFitting_CLASS_H
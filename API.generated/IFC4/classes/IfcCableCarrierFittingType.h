@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableCarrierFittingType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCableCarrierFittingType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowFittingType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCableCarrierFittingType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCableCarrierFittingType : public RDF_EXPRESS_VIRTUAL IfcFlowFittingType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCableCarrierFittingType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCableCarrierFittingType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 68);
+        }
+
+        /// <summary>
+        /// Instances of IfcCableCarrierFittingType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCableCarrierFittingType> Extent(SdaiModel model) { return ExtentRange<IfcCableCarrierFittingType>(model, 68, false); }
+        static ExtentRange<IfcCableCarrierFittingType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCableCarrierFittingType>(model, 68, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCableCarrierFittingType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCableCarrierFittingType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCableCarrierFittingType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCableCarrierFittingType if the actual type of SdaiInstance is IfcCableCarrierFittingType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCableCarrierFittingType CreateExactEntity(SdaiInstance instance) { return IfcCableCarrierFittingType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCableCarrierFittingType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCableCarrierFittingType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCableCarrierFittingTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(256); int v = getENUM(256, IfcCableCarrierFittingTypeEnum_hash); if (v >= 0) return (IfcCableCarrierFittingTypeEnum) v; else return Nullable<IfcCableCarrierFittingTypeEnum>(); }
+        void put_PredefinedType(IfcCableCarrierFittingTypeEnum value) { RDF_EXPRESS_PROBE(256); TextValue val = IfcCableCarrierFittingTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(256), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowFittingType::attr
+        {
+            static constexpr IntValue PredefinedType = 256;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableCarrierFittingType_CLASS_H
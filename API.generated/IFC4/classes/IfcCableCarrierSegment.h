@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableCarrierSegment_CLASS_H
+#define __RDF_LTD__IFC4_IfcCableCarrierSegment_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowSegment.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCableCarrierSegment
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCableCarrierSegment : public RDF_EXPRESS_VIRTUAL IfcFlowSegment
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCableCarrierSegment
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCableCarrierSegment(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 69);
+        }
+
+        /// <summary>
+        /// Instances of IfcCableCarrierSegment in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCableCarrierSegment> Extent(SdaiModel model) { return ExtentRange<IfcCableCarrierSegment>(model, 69, false); }
+        static ExtentRange<IfcCableCarrierSegment> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCableCarrierSegment>(model, 69, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCableCarrierSegment and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCableCarrierSegment Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCableCarrierSegment"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCableCarrierSegment if the actual type of SdaiInstance is IfcCableCarrierSegment or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCableCarrierSegment CreateExactEntity(SdaiInstance instance) { return IfcCableCarrierSegment(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCableCarrierSegment or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCableCarrierSegment(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCableCarrierSegmentTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(257); int v = getENUM(257, IfcCableCarrierSegmentTypeEnum_hash); if (v >= 0) return (IfcCableCarrierSegmentTypeEnum) v; else return Nullable<IfcCableCarrierSegmentTypeEnum>(); }
+        void put_PredefinedType(IfcCableCarrierSegmentTypeEnum value) { RDF_EXPRESS_PROBE(257); TextValue val = IfcCableCarrierSegmentTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(257), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowSegment::attr
+        {
+            static constexpr IntValue PredefinedType = 257;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableCarrierSegment_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableCarrierSegmentType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCableCarrierSegmentType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowSegmentType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCableCarrierSegmentType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCableCarrierSegmentType : public RDF_EXPRESS_VIRTUAL IfcFlowSegmentType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCableCarrierSegmentType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCableCarrierSegmentType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 70);
+        }
+
+        /// <summary>
+        /// Instances of IfcCableCarrierSegmentType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCableCarrierSegmentType> Extent(SdaiModel model) { return ExtentRange<IfcCableCarrierSegmentType>(model, 70, false); }
+        static ExtentRange<IfcCableCarrierSegmentType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCableCarrierSegmentType>(model, 70, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCableCarrierSegmentType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCableCarrierSegmentType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCableCarrierSegmentType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCableCarrierSegmentType if the actual type of SdaiInstance is IfcCableCarrierSegmentType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCableCarrierSegmentType CreateExactEntity(SdaiInstance instance) { return IfcCableCarrierSegmentType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCableCarrierSegmentType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCableCarrierSegmentType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCableCarrierSegmentTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(258); int v = getENUM(258, IfcCableCarrierSegmentTypeEnum_hash); if (v >= 0) return (IfcCableCarrierSegmentTypeEnum) v; else return Nullable<IfcCableCarrierSegmentTypeEnum>(); }
+        void put_PredefinedType(IfcCableCarrierSegmentTypeEnum value) { RDF_EXPRESS_PROBE(258); TextValue val = IfcCableCarrierSegmentTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(258), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowSegmentType::attr
+        {
+            static constexpr IntValue PredefinedType = 258;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableCarrierSegmentType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableFitting_CLASS_H
+#define __RDF_LTD__IFC4_IfcCableFitting_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowFitting.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCableFitting
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCableFitting : public RDF_EXPRESS_VIRTUAL IfcFlowFitting
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCableFitting
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCableFitting(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 71);
+        }
+
+        /// <summary>
+        /// Instances of IfcCableFitting in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCableFitting> Extent(SdaiModel model) { return ExtentRange<IfcCableFitting>(model, 71, false); }
+        static ExtentRange<IfcCableFitting> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCableFitting>(model, 71, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCableFitting and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCableFitting Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCableFitting"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCableFitting if the actual type of SdaiInstance is IfcCableFitting or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCableFitting CreateExactEntity(SdaiInstance instance) { return IfcCableFitting(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCableFitting or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCableFitting(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCableFittingTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(259); int v = getENUM(259, IfcCableFittingTypeEnum_hash); if (v >= 0) return (IfcCableFittingTypeEnum) v; else return Nullable<IfcCableFittingTypeEnum>(); }
+        void put_PredefinedType(IfcCableFittingTypeEnum value) { RDF_EXPRESS_PROBE(259); TextValue val = IfcCableFittingTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(259), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowFitting::attr
+        {
+            static constexpr IntValue PredefinedType = 259;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableFitting_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableFittingType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCableFittingType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowFittingType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCableFittingType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCableFittingType : public RDF_EXPRESS_VIRTUAL IfcFlowFittingType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCableFittingType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCableFittingType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 72);
+        }
+
+        /// <summary>
+        /// Instances of IfcCableFittingType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCableFittingType> Extent(SdaiModel model) { return ExtentRange<IfcCableFittingType>(model, 72, false); }
+        static ExtentRange<IfcCableFittingType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCableFittingType>(model, 72, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCableFittingType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCableFittingType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCableFittingType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCableFittingType if the actual type of SdaiInstance is IfcCableFittingType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCableFittingType CreateExactEntity(SdaiInstance instance) { return IfcCableFittingType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCableFittingType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCableFittingType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCableFittingTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(260); int v = getENUM(260, IfcCableFittingTypeEnum_hash); if (v >= 0) return (IfcCableFittingTypeEnum) v; else return Nullable<IfcCableFittingTypeEnum>(); }
+        void put_PredefinedType(IfcCableFittingTypeEnum value) { RDF_EXPRESS_PROBE(260); TextValue val = IfcCableFittingTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(260), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowFittingType::attr
+        {
+            static constexpr IntValue PredefinedType = 260;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableFittingType_CLASS_H
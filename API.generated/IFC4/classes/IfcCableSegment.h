@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableSegment_CLASS_H
+#define __RDF_LTD__IFC4_IfcCableSegment_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowSegment.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCableSegment
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCableSegment : public RDF_EXPRESS_VIRTUAL IfcFlowSegment
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCableSegment
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCableSegment(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 73);
+        }
+
+        /// <summary>
+        /// Instances of IfcCableSegment in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCableSegment> Extent(SdaiModel model) { return ExtentRange<IfcCableSegment>(model, 73, false); }
+        static ExtentRange<IfcCableSegment> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCableSegment>(model, 73, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCableSegment and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCableSegment Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCableSegment"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCableSegment if the actual type of SdaiInstance is IfcCableSegment or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCableSegment CreateExactEntity(SdaiInstance instance) { return IfcCableSegment(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCableSegment or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCableSegment(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCableSegmentTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(261); int v = getENUM(261, IfcCableSegmentTypeEnum_hash); if (v >= 0) return (IfcCableSegmentTypeEnum) v; else return Nullable<IfcCableSegmentTypeEnum>(); }
+        void put_PredefinedType(IfcCableSegmentTypeEnum value) { RDF_EXPRESS_PROBE(261); TextValue val = IfcCableSegmentTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(261), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowSegment::attr
+        {
+            static constexpr IntValue PredefinedType = 261;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableSegment_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCableSegmentType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCableSegmentType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowSegmentType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCableSegmentType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCableSegmentType : public RDF_EXPRESS_VIRTUAL IfcFlowSegmentType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCableSegmentType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCableSegmentType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 74);
+        }
+
+        /// <summary>
+        /// Instances of IfcCableSegmentType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCableSegmentType> Extent(SdaiModel model) { return ExtentRange<IfcCableSegmentType>(model, 74, false); }
+        static ExtentRange<IfcCableSegmentType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCableSegmentType>(model, 74, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCableSegmentType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCableSegmentType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCableSegmentType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCableSegmentType if the actual type of SdaiInstance is IfcCableSegmentType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCableSegmentType CreateExactEntity(SdaiInstance instance) { return IfcCableSegmentType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCableSegmentType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCableSegmentType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCableSegmentTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(262); int v = getENUM(262, IfcCableSegmentTypeEnum_hash); if (v >= 0) return (IfcCableSegmentTypeEnum) v; else return Nullable<IfcCableSegmentTypeEnum>(); }
+        void put_PredefinedType(IfcCableSegmentTypeEnum value) { RDF_EXPRESS_PROBE(262); TextValue val = IfcCableSegmentTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(262), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowSegmentType::attr
+        {
+            static constexpr IntValue PredefinedType = 262;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCableSegmentType_CLASS_H
@@ -0,0 +1,73 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianPoint_CLASS_H
+#define __RDF_LTD__IFC4_IfcCartesianPoint_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPoint.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCartesianPoint
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCartesianPoint : public RDF_EXPRESS_VIRTUAL IfcPoint
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCartesianPoint
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCartesianPoint(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 75);
+        }
+
+        /// <summary>
+        /// Instances of IfcCartesianPoint in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCartesianPoint> Extent(SdaiModel model) { return ExtentRange<IfcCartesianPoint>(model, 75, false); }
+        static ExtentRange<IfcCartesianPoint> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCartesianPoint>(model, 75, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCartesianPoint and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCartesianPoint Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCartesianPoint"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCartesianPoint if the actual type of SdaiInstance is IfcCartesianPoint or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCartesianPoint CreateExactEntity(SdaiInstance instance) { return IfcCartesianPoint(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCartesianPoint or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCartesianPoint(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void get_Coordinates(TList& lst) { RDF_EXPRESS_PROBE(263); ListOfIfcLengthMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(263)); }
+
+        //TList may be ListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void put_Coordinates(TList& lst) { RDF_EXPRESS_PROBE(263); ListOfIfcLengthMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(263)); }
+
+        //TArrayElem[] may be IfcLengthMeasure[] or array of convertible elements
+        template <typename TArrayElem> void put_Coordinates(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(263); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcLengthMeasureSerializer<ListOfIfcLengthMeasure> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(263)); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(264); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(264), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPoint::attr
+        {
+            static constexpr IntValue Coordinates = 263;
+            static constexpr IntValue Dim = 264;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianPoint_CLASS_H
@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianPointList2D_CLASS_H
+#define __RDF_LTD__IFC4_IfcCartesianPointList2D_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCartesianPointList.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCartesianPointList2D
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCartesianPointList2D : public RDF_EXPRESS_VIRTUAL IfcCartesianPointList
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCartesianPointList2D
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCartesianPointList2D(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 77);
+        }
+
+        /// <summary>
+        /// Instances of IfcCartesianPointList2D in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCartesianPointList2D> Extent(SdaiModel model) { return ExtentRange<IfcCartesianPointList2D>(model, 77, false); }
+        static ExtentRange<IfcCartesianPointList2D> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCartesianPointList2D>(model, 77, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCartesianPointList2D and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCartesianPointList2D Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCartesianPointList2D"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCartesianPointList2D if the actual type of SdaiInstance is IfcCartesianPointList2D or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCartesianPointList2D CreateExactEntity(SdaiInstance instance) { return IfcCartesianPointList2D(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCartesianPointList2D or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCartesianPointList2D(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void get_CoordList(TList& lst) { RDF_EXPRESS_PROBE(266); ListOfListOfIfcLengthMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(266)); }
+
+        //TList may be ListOfListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void put_CoordList(TList& lst) { RDF_EXPRESS_PROBE(266); ListOfListOfIfcLengthMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(266)); }
+
+        //reads inner aggregations into flat buffer, stride elements each (e.g. xyz of points), returns number of inner aggregations
+        template <typename TElem> IntValue get_CoordList(TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(266); return FlatAggrFromAttr<TElem, IfcLengthMeasure, sdaiREAL>(m_instance, getAttrDefinition(266), buffer, size, stride); }
+        template <typename TElem> IntValue get_CoordList(std::vector<TElem>& flat, size_t stride) { RDF_EXPRESS_PROBE(266); return FlatAggrFromAttr<TElem, IfcLengthMeasure, sdaiREAL>(m_instance, getAttrDefinition(266), flat, stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> IntValue get_CoordList(std::span<TElem> buffer, size_t stride) { return get_CoordList(buffer.data(), buffer.size(), stride); }
+#endif
+
+        //writes flat buffer as inner aggregations of stride elements each (e.g. xyz of points), no intermediate lists
+        template <typename TElem> void put_CoordList(const TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(266); FlatAggrToAttr<TElem, IfcLengthMeasure, sdaiREAL>(m_instance, getAttrDefinition(266), buffer, size, stride); }
+        template <typename TElem> void put_CoordList(const std::vector<TElem>& flat, size_t stride) { put_CoordList(flat.data(), flat.size(), stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> void put_CoordList(std::span<const TElem> buffer, size_t stride) { put_CoordList(buffer.data(), buffer.size(), stride); }
+#endif
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCartesianPointList::attr
+        {
+            static constexpr IntValue CoordList = 266;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianPointList2D_CLASS_H
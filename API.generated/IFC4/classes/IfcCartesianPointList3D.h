@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianPointList3D_CLASS_H
+#define __RDF_LTD__IFC4_IfcCartesianPointList3D_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCartesianPointList.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCartesianPointList3D
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCartesianPointList3D : public RDF_EXPRESS_VIRTUAL IfcCartesianPointList
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCartesianPointList3D
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCartesianPointList3D(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 78);
+        }
+
+        /// <summary>
+        /// Instances of IfcCartesianPointList3D in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCartesianPointList3D> Extent(SdaiModel model) { return ExtentRange<IfcCartesianPointList3D>(model, 78, false); }
+        static ExtentRange<IfcCartesianPointList3D> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCartesianPointList3D>(model, 78, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCartesianPointList3D and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCartesianPointList3D Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCartesianPointList3D"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCartesianPointList3D if the actual type of SdaiInstance is IfcCartesianPointList3D or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCartesianPointList3D CreateExactEntity(SdaiInstance instance) { return IfcCartesianPointList3D(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCartesianPointList3D or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCartesianPointList3D(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void get_CoordList(TList& lst) { RDF_EXPRESS_PROBE(267); ListOfListOfIfcLengthMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(267)); }
+
+        //TList may be ListOfListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void put_CoordList(TList& lst) { RDF_EXPRESS_PROBE(267); ListOfListOfIfcLengthMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(267)); }
+
+        //reads inner aggregations into flat buffer, stride elements each (e.g. xyz of points), returns number of inner aggregations
+        template <typename TElem> IntValue get_CoordList(TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(267); return FlatAggrFromAttr<TElem, IfcLengthMeasure, sdaiREAL>(m_instance, getAttrDefinition(267), buffer, size, stride); }
+        template <typename TElem> IntValue get_CoordList(std::vector<TElem>& flat, size_t stride) { RDF_EXPRESS_PROBE(267); return FlatAggrFromAttr<TElem, IfcLengthMeasure, sdaiREAL>(m_instance, getAttrDefinition(267), flat, stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> IntValue get_CoordList(std::span<TElem> buffer, size_t stride) { return get_CoordList(buffer.data(), buffer.size(), stride); }
+#endif
+
+        //writes flat buffer as inner aggregations of stride elements each (e.g. xyz of points), no intermediate lists
+        template <typename TElem> void put_CoordList(const TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(267); FlatAggrToAttr<TElem, IfcLengthMeasure, sdaiREAL>(m_instance, getAttrDefinition(267), buffer, size, stride); }
+        template <typename TElem> void put_CoordList(const std::vector<TElem>& flat, size_t stride) { put_CoordList(flat.data(), flat.size(), stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> void put_CoordList(std::span<const TElem> buffer, size_t stride) { put_CoordList(buffer.data(), buffer.size(), stride); }
+#endif
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCartesianPointList::attr
+        {
+            static constexpr IntValue CoordList = 267;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianPointList3D_CLASS_H
@@ -0,0 +1,78 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianTransformationOperator_CLASS_H
+#define __RDF_LTD__IFC4_IfcCartesianTransformationOperator_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCartesianTransformationOperator
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCartesianTransformationOperator : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCartesianTransformationOperator
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCartesianTransformationOperator(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 79);
+        }
+
+        /// <summary>
+        /// Instances of IfcCartesianTransformationOperator in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCartesianTransformationOperator> Extent(SdaiModel model) { return ExtentRange<IfcCartesianTransformationOperator>(model, 79, false); }
+        static ExtentRange<IfcCartesianTransformationOperator> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCartesianTransformationOperator>(model, 79, true); }
+
+        /// <summary>
+        /// Returns object of IfcCartesianTransformationOperator if the actual type of SdaiInstance is IfcCartesianTransformationOperator or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCartesianTransformationOperator CreateExactEntity(SdaiInstance instance) { return IfcCartesianTransformationOperator(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCartesianTransformationOperator or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCartesianTransformationOperator(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDirection get_Axis1();
+        void put_Axis1(IfcDirection inst);
+
+        IfcDirection get_Axis2();
+        void put_Axis2(IfcDirection inst);
+
+        IfcCartesianPoint get_LocalOrigin();
+        void put_LocalOrigin(IfcCartesianPoint inst);
+
+        Nullable<IfcReal> get_Scale() { RDF_EXPRESS_PROBE(271); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(271), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_Scale(IfcReal value) { RDF_EXPRESS_PROBE(271); sdaiPutAttr(m_instance, getAttrDefinition(271), sdaiREAL, &value); }
+
+        Nullable<IfcReal> get_Scl() { RDF_EXPRESS_PROBE(272); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(272), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(273); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(273), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue Axis1 = 268;
+            static constexpr IntValue Axis2 = 269;
+            static constexpr IntValue LocalOrigin = 270;
+            static constexpr IntValue Scale = 271;
+            static constexpr IntValue Scl = 272;
+            static constexpr IntValue Dim = 273;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianTransformationOperator_CLASS_H
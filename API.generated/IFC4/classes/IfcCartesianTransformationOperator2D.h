@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianTransformationOperator2D_CLASS_H
+#define __RDF_LTD__IFC4_IfcCartesianTransformationOperator2D_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCartesianTransformationOperator.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCartesianTransformationOperator2D
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCartesianTransformationOperator2D : public RDF_EXPRESS_VIRTUAL IfcCartesianTransformationOperator
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCartesianTransformationOperator2D
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCartesianTransformationOperator2D(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 80);
+        }
+
+        /// <summary>
+        /// Instances of IfcCartesianTransformationOperator2D in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCartesianTransformationOperator2D> Extent(SdaiModel model) { return ExtentRange<IfcCartesianTransformationOperator2D>(model, 80, false); }
+        static ExtentRange<IfcCartesianTransformationOperator2D> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCartesianTransformationOperator2D>(model, 80, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCartesianTransformationOperator2D and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCartesianTransformationOperator2D Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCartesianTransformationOperator2D"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCartesianTransformationOperator2D if the actual type of SdaiInstance is IfcCartesianTransformationOperator2D or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCartesianTransformationOperator2D CreateExactEntity(SdaiInstance instance) { return IfcCartesianTransformationOperator2D(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCartesianTransformationOperator2D or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCartesianTransformationOperator2D(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcDirection or list of convertible elements
+        template <typename TList> void get_U(TList& lst) { RDF_EXPRESS_PROBE(274); ListOfIfcDirectionSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(274)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCartesianTransformationOperator::attr
+        {
+            static constexpr IntValue U = 274;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianTransformationOperator2D_CLASS_H
@@ -0,0 +1,67 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianTransformationOperator2DnonUniform_CLASS_H
+#define __RDF_LTD__IFC4_IfcCartesianTransformationOperator2DnonUniform_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCartesianTransformationOperator2D.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCartesianTransformationOperator2DnonUniform
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCartesianTransformationOperator2DnonUniform : public RDF_EXPRESS_VIRTUAL IfcCartesianTransformationOperator2D
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCartesianTransformationOperator2DnonUniform
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCartesianTransformationOperator2DnonUniform(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 81);
+        }
+
+        /// <summary>
+        /// Instances of IfcCartesianTransformationOperator2DnonUniform in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCartesianTransformationOperator2DnonUniform> Extent(SdaiModel model) { return ExtentRange<IfcCartesianTransformationOperator2DnonUniform>(model, 81, false); }
+        static ExtentRange<IfcCartesianTransformationOperator2DnonUniform> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCartesianTransformationOperator2DnonUniform>(model, 81, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCartesianTransformationOperator2DnonUniform and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCartesianTransformationOperator2DnonUniform Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCartesianTransformationOperator2DnonUniform"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCartesianTransformationOperator2DnonUniform if the actual type of SdaiInstance is IfcCartesianTransformationOperator2DnonUniform or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCartesianTransformationOperator2DnonUniform CreateExactEntity(SdaiInstance instance) { return IfcCartesianTransformationOperator2DnonUniform(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCartesianTransformationOperator2DnonUniform or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCartesianTransformationOperator2DnonUniform(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcReal> get_Scale2() { RDF_EXPRESS_PROBE(275); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(275), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_Scale2(IfcReal value) { RDF_EXPRESS_PROBE(275); sdaiPutAttr(m_instance, getAttrDefinition(275), sdaiREAL, &value); }
+
+        Nullable<IfcReal> get_Scl2() { RDF_EXPRESS_PROBE(276); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(276), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCartesianTransformationOperator2D::attr
+        {
+            static constexpr IntValue Scale2 = 275;
+            static constexpr IntValue Scl2 = 276;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianTransformationOperator2DnonUniform_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianTransformationOperator3D_CLASS_H
+#define __RDF_LTD__IFC4_IfcCartesianTransformationOperator3D_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCartesianTransformationOperator.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCartesianTransformationOperator3D
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCartesianTransformationOperator3D : public RDF_EXPRESS_VIRTUAL IfcCartesianTransformationOperator
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCartesianTransformationOperator3D
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCartesianTransformationOperator3D(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 82);
+        }
+
+        /// <summary>
+        /// Instances of IfcCartesianTransformationOperator3D in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCartesianTransformationOperator3D> Extent(SdaiModel model) { return ExtentRange<IfcCartesianTransformationOperator3D>(model, 82, false); }
+        static ExtentRange<IfcCartesianTransformationOperator3D> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCartesianTransformationOperator3D>(model, 82, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCartesianTransformationOperator3D and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCartesianTransformationOperator3D Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCartesianTransformationOperator3D"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCartesianTransformationOperator3D if the actual type of SdaiInstance is IfcCartesianTransformationOperator3D or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCartesianTransformationOperator3D CreateExactEntity(SdaiInstance instance) { return IfcCartesianTransformationOperator3D(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCartesianTransformationOperator3D or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCartesianTransformationOperator3D(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDirection get_Axis3();
+        void put_Axis3(IfcDirection inst);
+
+        //TList may be ListOfIfcDirection or list of convertible elements
+        template <typename TList> void get_U(TList& lst) { RDF_EXPRESS_PROBE(278); ListOfIfcDirectionSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(278)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCartesianTransformationOperator::attr
+        {
+            static constexpr IntValue Axis3 = 277;
+            static constexpr IntValue U = 278;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianTransformationOperator3D_CLASS_H
@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCartesianTransformationOperator3DnonUniform_CLASS_H
+#define __RDF_LTD__IFC4_IfcCartesianTransformationOperator3DnonUniform_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCartesianTransformationOperator3D.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCartesianTransformationOperator3DnonUniform
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCartesianTransformationOperator3DnonUniform : public RDF_EXPRESS_VIRTUAL IfcCartesianTransformationOperator3D
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCartesianTransformationOperator3DnonUniform
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCartesianTransformationOperator3DnonUniform(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 83);
+        }
+
+        /// <summary>
+        /// Instances of IfcCartesianTransformationOperator3DnonUniform in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCartesianTransformationOperator3DnonUniform> Extent(SdaiModel model) { return ExtentRange<IfcCartesianTransformationOperator3DnonUniform>(model, 83, false); }
+        static ExtentRange<IfcCartesianTransformationOperator3DnonUniform> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCartesianTransformationOperator3DnonUniform>(model, 83, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCartesianTransformationOperator3DnonUniform and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCartesianTransformationOperator3DnonUniform Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCartesianTransformationOperator3DnonUniform"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCartesianTransformationOperator3DnonUniform if the actual type of SdaiInstance is IfcCartesianTransformationOperator3DnonUniform or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCartesianTransformationOperator3DnonUniform CreateExactEntity(SdaiInstance instance) { return IfcCartesianTransformationOperator3DnonUniform(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCartesianTransformationOperator3DnonUniform or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCartesianTransformationOperator3DnonUniform(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcReal> get_Scale2() { RDF_EXPRESS_PROBE(279); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(279), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_Scale2(IfcReal value) { RDF_EXPRESS_PROBE(279); sdaiPutAttr(m_instance, getAttrDefinition(279), sdaiREAL, &value); }
+
+        Nullable<IfcReal> get_Scale3() { RDF_EXPRESS_PROBE(280); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(280), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_Scale3(IfcReal value) { RDF_EXPRESS_PROBE(280); sdaiPutAttr(m_instance, getAttrDefinition(280), sdaiREAL, &value); }
+
+        Nullable<IfcReal> get_Scl2() { RDF_EXPRESS_PROBE(281); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(281), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+
+        Nullable<IfcReal> get_Scl3() { RDF_EXPRESS_PROBE(282); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(282), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCartesianTransformationOperator3D::attr
+        {
+            static constexpr IntValue Scale2 = 279;
+            static constexpr IntValue Scale3 = 280;
+            static constexpr IntValue Scl2 = 281;
+            static constexpr IntValue Scl3 = 282;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCartesianTransformationOperator3DnonUniform_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCenterLineProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcCenterLineProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcArbitraryOpenProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCenterLineProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCenterLineProfileDef : public RDF_EXPRESS_VIRTUAL IfcArbitraryOpenProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCenterLineProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCenterLineProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 84);
+        }
+
+        /// <summary>
+        /// Instances of IfcCenterLineProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCenterLineProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcCenterLineProfileDef>(model, 84, false); }
+        static ExtentRange<IfcCenterLineProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCenterLineProfileDef>(model, 84, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCenterLineProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCenterLineProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCenterLineProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCenterLineProfileDef if the actual type of SdaiInstance is IfcCenterLineProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCenterLineProfileDef CreateExactEntity(SdaiInstance instance) { return IfcCenterLineProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCenterLineProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCenterLineProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Thickness() { RDF_EXPRESS_PROBE(283); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(283), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Thickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(283); sdaiPutAttr(m_instance, getAttrDefinition(283), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcArbitraryOpenProfileDef::attr
+        {
+            static constexpr IntValue Thickness = 283;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCenterLineProfileDef_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcChiller_CLASS_H
+#define __RDF_LTD__IFC4_IfcChiller_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcChiller
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcChiller : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcChiller
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcChiller(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 85);
+        }
+
+        /// <summary>
+        /// Instances of IfcChiller in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcChiller> Extent(SdaiModel model) { return ExtentRange<IfcChiller>(model, 85, false); }
+        static ExtentRange<IfcChiller> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcChiller>(model, 85, true); }
+
+        /// <summary>
+        /// Create new instance of IfcChiller and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcChiller Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcChiller"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcChiller if the actual type of SdaiInstance is IfcChiller or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcChiller CreateExactEntity(SdaiInstance instance) { return IfcChiller(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcChiller or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcChiller(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcChillerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(284); int v = getENUM(284, IfcChillerTypeEnum_hash); if (v >= 0) return (IfcChillerTypeEnum) v; else return Nullable<IfcChillerTypeEnum>(); }
+        void put_PredefinedType(IfcChillerTypeEnum value) { RDF_EXPRESS_PROBE(284); TextValue val = IfcChillerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(284), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 284;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcChiller_CLASS_H
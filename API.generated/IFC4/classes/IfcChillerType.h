@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcChillerType_CLASS_H
+#define __RDF_LTD__IFC4_IfcChillerType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcChillerType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcChillerType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcChillerType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcChillerType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 86);
+        }
+
+        /// <summary>
+        /// Instances of IfcChillerType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcChillerType> Extent(SdaiModel model) { return ExtentRange<IfcChillerType>(model, 86, false); }
+        static ExtentRange<IfcChillerType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcChillerType>(model, 86, true); }
+
+        /// <summary>
+        /// Create new instance of IfcChillerType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcChillerType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcChillerType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcChillerType if the actual type of SdaiInstance is IfcChillerType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcChillerType CreateExactEntity(SdaiInstance instance) { return IfcChillerType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcChillerType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcChillerType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcChillerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(285); int v = getENUM(285, IfcChillerTypeEnum_hash); if (v >= 0) return (IfcChillerTypeEnum) v; else return Nullable<IfcChillerTypeEnum>(); }
+        void put_PredefinedType(IfcChillerTypeEnum value) { RDF_EXPRESS_PROBE(285); TextValue val = IfcChillerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(285), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 285;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcChillerType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcChimney_CLASS_H
+#define __RDF_LTD__IFC4_IfcChimney_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcChimney
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcChimney : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcChimney
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcChimney(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 87);
+        }
+
+        /// <summary>
+        /// Instances of IfcChimney in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcChimney> Extent(SdaiModel model) { return ExtentRange<IfcChimney>(model, 87, false); }
+        static ExtentRange<IfcChimney> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcChimney>(model, 87, true); }
+
+        /// <summary>
+        /// Create new instance of IfcChimney and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcChimney Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcChimney"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcChimney if the actual type of SdaiInstance is IfcChimney or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcChimney CreateExactEntity(SdaiInstance instance) { return IfcChimney(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcChimney or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcChimney(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcChimneyTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(286); int v = getENUM(286, IfcChimneyTypeEnum_hash); if (v >= 0) return (IfcChimneyTypeEnum) v; else return Nullable<IfcChimneyTypeEnum>(); }
+        void put_PredefinedType(IfcChimneyTypeEnum value) { RDF_EXPRESS_PROBE(286); TextValue val = IfcChimneyTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(286), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 286;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcChimney_CLASS_H
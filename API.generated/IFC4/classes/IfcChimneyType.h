@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcChimneyType_CLASS_H
+#define __RDF_LTD__IFC4_IfcChimneyType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcChimneyType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcChimneyType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcChimneyType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcChimneyType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 88);
+        }
+
+        /// <summary>
+        /// Instances of IfcChimneyType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcChimneyType> Extent(SdaiModel model) { return ExtentRange<IfcChimneyType>(model, 88, false); }
+        static ExtentRange<IfcChimneyType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcChimneyType>(model, 88, true); }
+
+        /// <summary>
+        /// Create new instance of IfcChimneyType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcChimneyType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcChimneyType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcChimneyType if the actual type of SdaiInstance is IfcChimneyType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcChimneyType CreateExactEntity(SdaiInstance instance) { return IfcChimneyType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcChimneyType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcChimneyType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcChimneyTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(287); int v = getENUM(287, IfcChimneyTypeEnum_hash); if (v >= 0) return (IfcChimneyTypeEnum) v; else return Nullable<IfcChimneyTypeEnum>(); }
+        void put_PredefinedType(IfcChimneyTypeEnum value) { RDF_EXPRESS_PROBE(287); TextValue val = IfcChimneyTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(287), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 287;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcChimneyType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCircle_CLASS_H
+#define __RDF_LTD__IFC4_IfcCircle_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConic.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCircle
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCircle : public RDF_EXPRESS_VIRTUAL IfcConic
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCircle
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCircle(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 89);
+        }
+
+        /// <summary>
+        /// Instances of IfcCircle in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCircle> Extent(SdaiModel model) { return ExtentRange<IfcCircle>(model, 89, false); }
+        static ExtentRange<IfcCircle> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCircle>(model, 89, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCircle and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCircle Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCircle"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCircle if the actual type of SdaiInstance is IfcCircle or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCircle CreateExactEntity(SdaiInstance instance) { return IfcCircle(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCircle or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCircle(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Radius() { RDF_EXPRESS_PROBE(289); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(289), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Radius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(289); sdaiPutAttr(m_instance, getAttrDefinition(289), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConic::attr
+        {
+            static constexpr IntValue Radius = 289;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCircle_CLASS_H
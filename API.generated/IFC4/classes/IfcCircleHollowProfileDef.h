@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCircleHollowProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcCircleHollowProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCircleProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCircleHollowProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCircleHollowProfileDef : public RDF_EXPRESS_VIRTUAL IfcCircleProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCircleHollowProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCircleHollowProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 90);
+        }
+
+        /// <summary>
+        /// Instances of IfcCircleHollowProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCircleHollowProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcCircleHollowProfileDef>(model, 90, false); }
+        static ExtentRange<IfcCircleHollowProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCircleHollowProfileDef>(model, 90, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCircleHollowProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCircleHollowProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCircleHollowProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCircleHollowProfileDef if the actual type of SdaiInstance is IfcCircleHollowProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCircleHollowProfileDef CreateExactEntity(SdaiInstance instance) { return IfcCircleHollowProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCircleHollowProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCircleHollowProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_WallThickness() { RDF_EXPRESS_PROBE(291); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(291), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_WallThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(291); sdaiPutAttr(m_instance, getAttrDefinition(291), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCircleProfileDef::attr
+        {
+            static constexpr IntValue WallThickness = 291;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCircleHollowProfileDef_CLASS_H
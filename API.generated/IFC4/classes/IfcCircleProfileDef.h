@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCircleProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcCircleProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCircleProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCircleProfileDef : public RDF_EXPRESS_VIRTUAL IfcParameterizedProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCircleProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCircleProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 91);
+        }
+
+        /// <summary>
+        /// Instances of IfcCircleProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCircleProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcCircleProfileDef>(model, 91, false); }
+        static ExtentRange<IfcCircleProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCircleProfileDef>(model, 91, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCircleProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCircleProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCircleProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCircleProfileDef if the actual type of SdaiInstance is IfcCircleProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCircleProfileDef CreateExactEntity(SdaiInstance instance) { return IfcCircleProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCircleProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCircleProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Radius() { RDF_EXPRESS_PROBE(290); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(290), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Radius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(290); sdaiPutAttr(m_instance, getAttrDefinition(290), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcParameterizedProfileDef::attr
+        {
+            static constexpr IntValue Radius = 290;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCircleProfileDef_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCivilElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcCivilElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCivilElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCivilElement : public RDF_EXPRESS_VIRTUAL IfcElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCivilElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCivilElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 92);
+        }
+
+        /// <summary>
+        /// Instances of IfcCivilElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCivilElement> Extent(SdaiModel model) { return ExtentRange<IfcCivilElement>(model, 92, false); }
+        static ExtentRange<IfcCivilElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCivilElement>(model, 92, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCivilElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCivilElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCivilElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCivilElement if the actual type of SdaiInstance is IfcCivilElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCivilElement CreateExactEntity(SdaiInstance instance) { return IfcCivilElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCivilElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCivilElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElement::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCivilElement_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCivilElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCivilElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCivilElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCivilElementType : public RDF_EXPRESS_VIRTUAL IfcElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCivilElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCivilElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 93);
+        }
+
+        /// <summary>
+        /// Instances of IfcCivilElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCivilElementType> Extent(SdaiModel model) { return ExtentRange<IfcCivilElementType>(model, 93, false); }
+        static ExtentRange<IfcCivilElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCivilElementType>(model, 93, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCivilElementType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCivilElementType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCivilElementType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCivilElementType if the actual type of SdaiInstance is IfcCivilElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCivilElementType CreateExactEntity(SdaiInstance instance) { return IfcCivilElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCivilElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCivilElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementType::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCivilElementType_CLASS_H
@@ -0,0 +1,144 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcClassification_CLASS_H
+#define __RDF_LTD__IFC4_IfcClassification_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcExternalInformation.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcClassification
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcClassification : public RDF_EXPRESS_VIRTUAL IfcExternalInformation
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcClassification
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcClassification(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 94);
+        }
+
+        /// <summary>
+        /// Instances of IfcClassification in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcClassification> Extent(SdaiModel model) { return ExtentRange<IfcClassification>(model, 94, false); }
+        static ExtentRange<IfcClassification> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcClassification>(model, 94, true); }
+
+        /// <summary>
+        /// Create new instance of IfcClassification and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcClassification Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcClassification"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcClassification if the actual type of SdaiInstance is IfcClassification or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcClassification CreateExactEntity(SdaiInstance instance) { return IfcClassification(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcClassification or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcClassification(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Source() { RDF_EXPRESS_PROBE(292); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(292), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Source_view() { return TextView(get_Source()); }
+#endif
+        void put_Source(IfcLabel value) { RDF_EXPRESS_PROBE(292); sdaiPutAttr(m_instance, getAttrDefinition(292), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Source_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(292); return buffer.GetAttr(m_instance, "Source"); }
+        const char* get_Source_utf8() { return get_Source_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Edition() { RDF_EXPRESS_PROBE(293); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(293), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Edition_view() { return TextView(get_Edition()); }
+#endif
+        void put_Edition(IfcLabel value) { RDF_EXPRESS_PROBE(293); sdaiPutAttr(m_instance, getAttrDefinition(293), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Edition_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(293); return buffer.GetAttr(m_instance, "Edition"); }
+        const char* get_Edition_utf8() { return get_Edition_utf8(ThreadUtf8Buffer()); }
+
+        IfcDate get_EditionDate() { RDF_EXPRESS_PROBE(294); IfcDate val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(294), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_EditionDate_view() { return TextView(get_EditionDate()); }
+#endif
+        void put_EditionDate(IfcDate value) { RDF_EXPRESS_PROBE(294); sdaiPutAttr(m_instance, getAttrDefinition(294), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_EditionDate_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(294); return buffer.GetAttr(m_instance, "EditionDate"); }
+        const char* get_EditionDate_utf8() { return get_EditionDate_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(295); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(295), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(295); sdaiPutAttr(m_instance, getAttrDefinition(295), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(295); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(296); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(296), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(296); sdaiPutAttr(m_instance, getAttrDefinition(296), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(296); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcURIReference get_Location() { RDF_EXPRESS_PROBE(297); IfcURIReference val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(297), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Location_view() { return TextView(get_Location()); }
+#endif
+        void put_Location(IfcURIReference value) { RDF_EXPRESS_PROBE(297); sdaiPutAttr(m_instance, getAttrDefinition(297), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Location_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(297); return buffer.GetAttr(m_instance, "Location"); }
+        const char* get_Location_utf8() { return get_Location_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcIdentifier or list of convertible elements
+        template <typename TList> void get_ReferenceTokens(TList& lst) { RDF_EXPRESS_PROBE(298); ListOfIfcIdentifierSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(298)); }
+
+        //TList may be ListOfIfcIdentifier or list of convertible elements
+        template <typename TList> void put_ReferenceTokens(TList& lst) { RDF_EXPRESS_PROBE(298); ListOfIfcIdentifierSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(298)); }
+
+        //TArrayElem[] may be IfcIdentifier[] or array of convertible elements
+        template <typename TArrayElem> void put_ReferenceTokens(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(298); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcIdentifierSerializer<ListOfIfcIdentifier> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(298)); }
+
+        //TList may be SetOfIfcRelAssociatesClassification or list of convertible elements
+        template <typename TList> void get_ClassificationForObjects(TList& lst) { RDF_EXPRESS_PROBE(299); SetOfIfcRelAssociatesClassificationSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(299)); }
+
+        //TList may be SetOfIfcClassificationReference or list of convertible elements
+        template <typename TList> void get_HasReferences(TList& lst) { RDF_EXPRESS_PROBE(300); SetOfIfcClassificationReferenceSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(300)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcExternalInformation::attr
+        {
+            static constexpr IntValue Source = 292;
+            static constexpr IntValue Edition = 293;
+            static constexpr IntValue EditionDate = 294;
+            static constexpr IntValue Name = 295;
+            static constexpr IntValue Description = 296;
+            static constexpr IntValue Location = 297;
+            static constexpr IntValue ReferenceTokens = 298;
+            static constexpr IntValue ClassificationForObjects = 299;
+            static constexpr IntValue HasReferences = 300;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcClassification_CLASS_H
@@ -0,0 +1,94 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcClassificationReference_CLASS_H
+#define __RDF_LTD__IFC4_IfcClassificationReference_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcExternalReference.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcClassificationReference
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcClassificationReference : public RDF_EXPRESS_VIRTUAL IfcExternalReference
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcClassificationReference
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcClassificationReference(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 95);
+        }
+
+        /// <summary>
+        /// Instances of IfcClassificationReference in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcClassificationReference> Extent(SdaiModel model) { return ExtentRange<IfcClassificationReference>(model, 95, false); }
+        static ExtentRange<IfcClassificationReference> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcClassificationReference>(model, 95, true); }
+
+        /// <summary>
+        /// Create new instance of IfcClassificationReference and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcClassificationReference Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcClassificationReference"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcClassificationReference if the actual type of SdaiInstance is IfcClassificationReference or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcClassificationReference CreateExactEntity(SdaiInstance instance) { return IfcClassificationReference(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcClassificationReference or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcClassificationReference(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcClassificationReferenceSelect_get get_ReferencedSource() { return IfcClassificationReferenceSelect_get(m_instance, 305); }
+        IfcClassificationReferenceSelect_put put_ReferencedSource() { return IfcClassificationReferenceSelect_put(m_instance, 305); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(306); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(306), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(306); sdaiPutAttr(m_instance, getAttrDefinition(306), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(306); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcIdentifier get_Sort() { RDF_EXPRESS_PROBE(307); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(307), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Sort_view() { return TextView(get_Sort()); }
+#endif
+        void put_Sort(IfcIdentifier value) { RDF_EXPRESS_PROBE(307); sdaiPutAttr(m_instance, getAttrDefinition(307), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Sort_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(307); return buffer.GetAttr(m_instance, "Sort"); }
+        const char* get_Sort_utf8() { return get_Sort_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRelAssociatesClassification or list of convertible elements
+        template <typename TList> void get_ClassificationRefForObjects(TList& lst) { RDF_EXPRESS_PROBE(308); SetOfIfcRelAssociatesClassificationSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(308)); }
+
+        //TList may be SetOfIfcClassificationReference or list of convertible elements
+        template <typename TList> void get_HasReferences(TList& lst) { RDF_EXPRESS_PROBE(309); SetOfIfcClassificationReferenceSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(309)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcExternalReference::attr
+        {
+            static constexpr IntValue ReferencedSource = 305;
+            static constexpr IntValue Description = 306;
+            static constexpr IntValue Sort = 307;
+            static constexpr IntValue ClassificationRefForObjects = 308;
+            static constexpr IntValue HasReferences = 309;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcClassificationReference_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcClosedShell_CLASS_H
+#define __RDF_LTD__IFC4_IfcClosedShell_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConnectedFaceSet.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcClosedShell
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcClosedShell : public RDF_EXPRESS_VIRTUAL IfcConnectedFaceSet
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcClosedShell
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcClosedShell(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 96);
+        }
+
+        /// <summary>
+        /// Instances of IfcClosedShell in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcClosedShell> Extent(SdaiModel model) { return ExtentRange<IfcClosedShell>(model, 96, false); }
+        static ExtentRange<IfcClosedShell> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcClosedShell>(model, 96, true); }
+
+        /// <summary>
+        /// Create new instance of IfcClosedShell and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcClosedShell Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcClosedShell"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcClosedShell if the actual type of SdaiInstance is IfcClosedShell or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcClosedShell CreateExactEntity(SdaiInstance instance) { return IfcClosedShell(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcClosedShell or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcClosedShell(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConnectedFaceSet::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcClosedShell_CLASS_H
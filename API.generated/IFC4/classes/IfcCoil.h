@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCoil_CLASS_H
+#define __RDF_LTD__IFC4_IfcCoil_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCoil
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCoil : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCoil
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCoil(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 97);
+        }
+
+        /// <summary>
+        /// Instances of IfcCoil in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCoil> Extent(SdaiModel model) { return ExtentRange<IfcCoil>(model, 97, false); }
+        static ExtentRange<IfcCoil> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCoil>(model, 97, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCoil and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCoil Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCoil"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCoil if the actual type of SdaiInstance is IfcCoil or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCoil CreateExactEntity(SdaiInstance instance) { return IfcCoil(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCoil or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCoil(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCoilTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(311); int v = getENUM(311, IfcCoilTypeEnum_hash); if (v >= 0) return (IfcCoilTypeEnum) v; else return Nullable<IfcCoilTypeEnum>(); }
+        void put_PredefinedType(IfcCoilTypeEnum value) { RDF_EXPRESS_PROBE(311); TextValue val = IfcCoilTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(311), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 311;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCoil_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCoilType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCoilType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCoilType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCoilType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCoilType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCoilType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 98);
+        }
+
+        /// <summary>
+        /// Instances of IfcCoilType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCoilType> Extent(SdaiModel model) { return ExtentRange<IfcCoilType>(model, 98, false); }
+        static ExtentRange<IfcCoilType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCoilType>(model, 98, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCoilType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCoilType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCoilType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCoilType if the actual type of SdaiInstance is IfcCoilType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCoilType CreateExactEntity(SdaiInstance instance) { return IfcCoilType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCoilType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCoilType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCoilTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(312); int v = getENUM(312, IfcCoilTypeEnum_hash); if (v >= 0) return (IfcCoilTypeEnum) v; else return Nullable<IfcCoilTypeEnum>(); }
+        void put_PredefinedType(IfcCoilTypeEnum value) { RDF_EXPRESS_PROBE(312); TextValue val = IfcCoilTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(312), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 312;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCoilType_CLASS_H
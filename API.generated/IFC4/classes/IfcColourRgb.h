@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcColourRgb_CLASS_H
+#define __RDF_LTD__IFC4_IfcColourRgb_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcColourSpecification.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcColourRgb
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcColourRgb : public RDF_EXPRESS_VIRTUAL IfcColourSpecification
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcColourRgb
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcColourRgb(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 99);
+        }
+
+        /// <summary>
+        /// Instances of IfcColourRgb in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcColourRgb> Extent(SdaiModel model) { return ExtentRange<IfcColourRgb>(model, 99, false); }
+        static ExtentRange<IfcColourRgb> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcColourRgb>(model, 99, true); }
+
+        /// <summary>
+        /// Create new instance of IfcColourRgb and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcColourRgb Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcColourRgb"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcColourRgb if the actual type of SdaiInstance is IfcColourRgb or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcColourRgb CreateExactEntity(SdaiInstance instance) { return IfcColourRgb(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcColourRgb or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcColourRgb(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcNormalisedRatioMeasure> get_Red() { RDF_EXPRESS_PROBE(314); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(314), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_Red(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(314); sdaiPutAttr(m_instance, getAttrDefinition(314), sdaiREAL, &value); }
+
+        Nullable<IfcNormalisedRatioMeasure> get_Green() { RDF_EXPRESS_PROBE(315); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(315), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_Green(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(315); sdaiPutAttr(m_instance, getAttrDefinition(315), sdaiREAL, &value); }
+
+        Nullable<IfcNormalisedRatioMeasure> get_Blue() { RDF_EXPRESS_PROBE(316); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(316), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_Blue(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(316); sdaiPutAttr(m_instance, getAttrDefinition(316), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcColourSpecification::attr
+        {
+            static constexpr IntValue Red = 314;
+            static constexpr IntValue Green = 315;
+            static constexpr IntValue Blue = 316;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcColourRgb_CLASS_H
@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcColourRgbList_CLASS_H
+#define __RDF_LTD__IFC4_IfcColourRgbList_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcColourRgbList
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcColourRgbList : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcColourRgbList
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcColourRgbList(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 100);
+        }
+
+        /// <summary>
+        /// Instances of IfcColourRgbList in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcColourRgbList> Extent(SdaiModel model) { return ExtentRange<IfcColourRgbList>(model, 100, false); }
+        static ExtentRange<IfcColourRgbList> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcColourRgbList>(model, 100, true); }
+
+        /// <summary>
+        /// Create new instance of IfcColourRgbList and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcColourRgbList Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcColourRgbList"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcColourRgbList if the actual type of SdaiInstance is IfcColourRgbList or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcColourRgbList CreateExactEntity(SdaiInstance instance) { return IfcColourRgbList(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcColourRgbList or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcColourRgbList(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfListOfIfcNormalisedRatioMeasure or list of convertible elements
+        template <typename TList> void get_ColourList(TList& lst) { RDF_EXPRESS_PROBE(317); ListOfListOfIfcNormalisedRatioMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(317)); }
+
+        //TList may be ListOfListOfIfcNormalisedRatioMeasure or list of convertible elements
+        template <typename TList> void put_ColourList(TList& lst) { RDF_EXPRESS_PROBE(317); ListOfListOfIfcNormalisedRatioMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(317)); }
+
+        //reads inner aggregations into flat buffer, stride elements each (e.g. xyz of points), returns number of inner aggregations
+        template <typename TElem> IntValue get_ColourList(TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(317); return FlatAggrFromAttr<TElem, IfcNormalisedRatioMeasure, sdaiREAL>(m_instance, getAttrDefinition(317), buffer, size, stride); }
+        template <typename TElem> IntValue get_ColourList(std::vector<TElem>& flat, size_t stride) { RDF_EXPRESS_PROBE(317); return FlatAggrFromAttr<TElem, IfcNormalisedRatioMeasure, sdaiREAL>(m_instance, getAttrDefinition(317), flat, stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> IntValue get_ColourList(std::span<TElem> buffer, size_t stride) { return get_ColourList(buffer.data(), buffer.size(), stride); }
+#endif
+
+        //writes flat buffer as inner aggregations of stride elements each (e.g. xyz of points), no intermediate lists
+        template <typename TElem> void put_ColourList(const TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(317); FlatAggrToAttr<TElem, IfcNormalisedRatioMeasure, sdaiREAL>(m_instance, getAttrDefinition(317), buffer, size, stride); }
+        template <typename TElem> void put_ColourList(const std::vector<TElem>& flat, size_t stride) { put_ColourList(flat.data(), flat.size(), stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> void put_ColourList(std::span<const TElem> buffer, size_t stride) { put_ColourList(buffer.data(), buffer.size(), stride); }
+#endif
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue ColourList = 317;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcColourRgbList_CLASS_H
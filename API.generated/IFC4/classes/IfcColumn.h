@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcColumn_CLASS_H
+#define __RDF_LTD__IFC4_IfcColumn_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcColumn
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcColumn : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcColumn
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcColumn(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 102);
+        }
+
+        /// <summary>
+        /// Instances of IfcColumn in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcColumn> Extent(SdaiModel model) { return ExtentRange<IfcColumn>(model, 102, false); }
+        static ExtentRange<IfcColumn> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcColumn>(model, 102, true); }
+
+        /// <summary>
+        /// Create new instance of IfcColumn and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcColumn Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcColumn"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcColumn if the actual type of SdaiInstance is IfcColumn or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcColumn CreateExactEntity(SdaiInstance instance) { return IfcColumn(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcColumn or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcColumn(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcColumnTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(318); int v = getENUM(318, IfcColumnTypeEnum_hash); if (v >= 0) return (IfcColumnTypeEnum) v; else return Nullable<IfcColumnTypeEnum>(); }
+        void put_PredefinedType(IfcColumnTypeEnum value) { RDF_EXPRESS_PROBE(318); TextValue val = IfcColumnTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(318), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 318;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcColumn_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcColumnStandardCase_CLASS_H
+#define __RDF_LTD__IFC4_IfcColumnStandardCase_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcColumn.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcColumnStandardCase
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcColumnStandardCase : public RDF_EXPRESS_VIRTUAL IfcColumn
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcColumnStandardCase
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcColumnStandardCase(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 103);
+        }
+
+        /// <summary>
+        /// Instances of IfcColumnStandardCase in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcColumnStandardCase> Extent(SdaiModel model) { return ExtentRange<IfcColumnStandardCase>(model, 103, false); }
+        static ExtentRange<IfcColumnStandardCase> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcColumnStandardCase>(model, 103, true); }
+
+        /// <summary>
+        /// Create new instance of IfcColumnStandardCase and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcColumnStandardCase Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcColumnStandardCase"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcColumnStandardCase if the actual type of SdaiInstance is IfcColumnStandardCase or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcColumnStandardCase CreateExactEntity(SdaiInstance instance) { return IfcColumnStandardCase(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcColumnStandardCase or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcColumnStandardCase(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcColumn::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcColumnStandardCase_CLASS_H
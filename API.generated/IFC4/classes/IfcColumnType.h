@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcColumnType_CLASS_H
+#define __RDF_LTD__IFC4_IfcColumnType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcColumnType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcColumnType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcColumnType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcColumnType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 104);
+        }
+
+        /// <summary>
+        /// Instances of IfcColumnType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcColumnType> Extent(SdaiModel model) { return ExtentRange<IfcColumnType>(model, 104, false); }
+        static ExtentRange<IfcColumnType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcColumnType>(model, 104, true); }
+
+        /// <summary>
+        /// Create new instance of IfcColumnType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcColumnType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcColumnType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcColumnType if the actual type of SdaiInstance is IfcColumnType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcColumnType CreateExactEntity(SdaiInstance instance) { return IfcColumnType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcColumnType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcColumnType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcColumnTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(319); int v = getENUM(319, IfcColumnTypeEnum_hash); if (v >= 0) return (IfcColumnTypeEnum) v; else return Nullable<IfcColumnTypeEnum>(); }
+        void put_PredefinedType(IfcColumnTypeEnum value) { RDF_EXPRESS_PROBE(319); TextValue val = IfcColumnTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(319), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 319;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcColumnType_CLASS_H
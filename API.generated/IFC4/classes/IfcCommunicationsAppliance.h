@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCommunicationsAppliance_CLASS_H
+#define __RDF_LTD__IFC4_IfcCommunicationsAppliance_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCommunicationsAppliance
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCommunicationsAppliance : public RDF_EXPRESS_VIRTUAL IfcFlowTerminal
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCommunicationsAppliance
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCommunicationsAppliance(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 105);
+        }
+
+        /// <summary>
+        /// Instances of IfcCommunicationsAppliance in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCommunicationsAppliance> Extent(SdaiModel model) { return ExtentRange<IfcCommunicationsAppliance>(model, 105, false); }
+        static ExtentRange<IfcCommunicationsAppliance> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCommunicationsAppliance>(model, 105, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCommunicationsAppliance and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCommunicationsAppliance Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCommunicationsAppliance"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCommunicationsAppliance if the actual type of SdaiInstance is IfcCommunicationsAppliance or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCommunicationsAppliance CreateExactEntity(SdaiInstance instance) { return IfcCommunicationsAppliance(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCommunicationsAppliance or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCommunicationsAppliance(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCommunicationsApplianceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(320); int v = getENUM(320, IfcCommunicationsApplianceTypeEnum_hash); if (v >= 0) return (IfcCommunicationsApplianceTypeEnum) v; else return Nullable<IfcCommunicationsApplianceTypeEnum>(); }
+        void put_PredefinedType(IfcCommunicationsApplianceTypeEnum value) { RDF_EXPRESS_PROBE(320); TextValue val = IfcCommunicationsApplianceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(320), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminal::attr
+        {
+            static constexpr IntValue PredefinedType = 320;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCommunicationsAppliance_CLASS_H
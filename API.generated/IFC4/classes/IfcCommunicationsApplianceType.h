@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCommunicationsApplianceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCommunicationsApplianceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCommunicationsApplianceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCommunicationsApplianceType : public RDF_EXPRESS_VIRTUAL IfcFlowTerminalType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCommunicationsApplianceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCommunicationsApplianceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 106);
+        }
+
+        /// <summary>
+        /// Instances of IfcCommunicationsApplianceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCommunicationsApplianceType> Extent(SdaiModel model) { return ExtentRange<IfcCommunicationsApplianceType>(model, 106, false); }
+        static ExtentRange<IfcCommunicationsApplianceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCommunicationsApplianceType>(model, 106, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCommunicationsApplianceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCommunicationsApplianceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCommunicationsApplianceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCommunicationsApplianceType if the actual type of SdaiInstance is IfcCommunicationsApplianceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCommunicationsApplianceType CreateExactEntity(SdaiInstance instance) { return IfcCommunicationsApplianceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCommunicationsApplianceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCommunicationsApplianceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCommunicationsApplianceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(321); int v = getENUM(321, IfcCommunicationsApplianceTypeEnum_hash); if (v >= 0) return (IfcCommunicationsApplianceTypeEnum) v; else return Nullable<IfcCommunicationsApplianceTypeEnum>(); }
+        void put_PredefinedType(IfcCommunicationsApplianceTypeEnum value) { RDF_EXPRESS_PROBE(321); TextValue val = IfcCommunicationsApplianceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(321), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminalType::attr
+        {
+            static constexpr IntValue PredefinedType = 321;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCommunicationsApplianceType_CLASS_H
@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcComplexProperty_CLASS_H
+#define __RDF_LTD__IFC4_IfcComplexProperty_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProperty.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcComplexProperty
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcComplexProperty : public RDF_EXPRESS_VIRTUAL IfcProperty
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcComplexProperty
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcComplexProperty(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 107);
+        }
+
+        /// <summary>
+        /// Instances of IfcComplexProperty in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcComplexProperty> Extent(SdaiModel model) { return ExtentRange<IfcComplexProperty>(model, 107, false); }
+        static ExtentRange<IfcComplexProperty> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcComplexProperty>(model, 107, true); }
+
+        /// <summary>
+        /// Create new instance of IfcComplexProperty and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcComplexProperty Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcComplexProperty"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcComplexProperty if the actual type of SdaiInstance is IfcComplexProperty or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcComplexProperty CreateExactEntity(SdaiInstance instance) { return IfcComplexProperty(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcComplexProperty or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcComplexProperty(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_UsageName() { RDF_EXPRESS_PROBE(331); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(331), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UsageName_view() { return TextView(get_UsageName()); }
+#endif
+        void put_UsageName(IfcIdentifier value) { RDF_EXPRESS_PROBE(331); sdaiPutAttr(m_instance, getAttrDefinition(331), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UsageName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(331); return buffer.GetAttr(m_instance, "UsageName"); }
+        const char* get_UsageName_utf8() { return get_UsageName_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcProperty or list of convertible elements
+        template <typename TList> void get_HasProperties(TList& lst) { RDF_EXPRESS_PROBE(332); SetOfIfcPropertySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(332)); }
+
+        //TList may be SetOfIfcProperty or list of convertible elements
+        template <typename TList> void put_HasProperties(TList& lst) { RDF_EXPRESS_PROBE(332); SetOfIfcPropertySerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(332)); }
+
+        //TArrayElem[] may be IfcProperty[] or array of convertible elements
+        template <typename TArrayElem> void put_HasProperties(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(332); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcPropertySerializer<SetOfIfcProperty> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(332)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProperty::attr
+        {
+            static constexpr IntValue UsageName = 331;
+            static constexpr IntValue HasProperties = 332;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcComplexProperty_CLASS_H
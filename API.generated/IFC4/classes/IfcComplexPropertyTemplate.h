@@ -0,0 +1,85 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcComplexPropertyTemplate_CLASS_H
+#define __RDF_LTD__IFC4_IfcComplexPropertyTemplate_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPropertyTemplate.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcComplexPropertyTemplate
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcComplexPropertyTemplate : public RDF_EXPRESS_VIRTUAL IfcPropertyTemplate
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcComplexPropertyTemplate
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcComplexPropertyTemplate(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 108);
+        }
+
+        /// <summary>
+        /// Instances of IfcComplexPropertyTemplate in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcComplexPropertyTemplate> Extent(SdaiModel model) { return ExtentRange<IfcComplexPropertyTemplate>(model, 108, false); }
+        static ExtentRange<IfcComplexPropertyTemplate> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcComplexPropertyTemplate>(model, 108, true); }
+
+        /// <summary>
+        /// Create new instance of IfcComplexPropertyTemplate and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcComplexPropertyTemplate Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcComplexPropertyTemplate"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcComplexPropertyTemplate if the actual type of SdaiInstance is IfcComplexPropertyTemplate or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcComplexPropertyTemplate CreateExactEntity(SdaiInstance instance) { return IfcComplexPropertyTemplate(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcComplexPropertyTemplate or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcComplexPropertyTemplate(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_UsageName() { RDF_EXPRESS_PROBE(337); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(337), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UsageName_view() { return TextView(get_UsageName()); }
+#endif
+        void put_UsageName(IfcLabel value) { RDF_EXPRESS_PROBE(337); sdaiPutAttr(m_instance, getAttrDefinition(337), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UsageName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(337); return buffer.GetAttr(m_instance, "UsageName"); }
+        const char* get_UsageName_utf8() { return get_UsageName_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcComplexPropertyTemplateTypeEnum> get_TemplateType() { RDF_EXPRESS_PROBE(338); int v = getENUM(338, IfcComplexPropertyTemplateTypeEnum_hash); if (v >= 0) return (IfcComplexPropertyTemplateTypeEnum) v; else return Nullable<IfcComplexPropertyTemplateTypeEnum>(); }
+        void put_TemplateType(IfcComplexPropertyTemplateTypeEnum value) { RDF_EXPRESS_PROBE(338); TextValue val = IfcComplexPropertyTemplateTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(338), sdaiENUM, val); }
+
+        //TList may be SetOfIfcPropertyTemplate or list of convertible elements
+        template <typename TList> void get_HasPropertyTemplates(TList& lst) { RDF_EXPRESS_PROBE(339); SetOfIfcPropertyTemplateSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(339)); }
+
+        //TList may be SetOfIfcPropertyTemplate or list of convertible elements
+        template <typename TList> void put_HasPropertyTemplates(TList& lst) { RDF_EXPRESS_PROBE(339); SetOfIfcPropertyTemplateSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(339)); }
+
+        //TArrayElem[] may be IfcPropertyTemplate[] or array of convertible elements
+        template <typename TArrayElem> void put_HasPropertyTemplates(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(339); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcPropertyTemplateSerializer<SetOfIfcPropertyTemplate> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(339)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPropertyTemplate::attr
+        {
+            static constexpr IntValue UsageName = 337;
+            static constexpr IntValue TemplateType = 338;
+            static constexpr IntValue HasPropertyTemplates = 339;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcComplexPropertyTemplate_CLASS_H
@@ -0,0 +1,80 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCompositeCurve_CLASS_H
+#define __RDF_LTD__IFC4_IfcCompositeCurve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundedCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCompositeCurve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCompositeCurve : public RDF_EXPRESS_VIRTUAL IfcBoundedCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCompositeCurve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCompositeCurve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 109);
+        }
+
+        /// <summary>
+        /// Instances of IfcCompositeCurve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCompositeCurve> Extent(SdaiModel model) { return ExtentRange<IfcCompositeCurve>(model, 109, false); }
+        static ExtentRange<IfcCompositeCurve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCompositeCurve>(model, 109, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCompositeCurve and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCompositeCurve Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCompositeCurve"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCompositeCurve if the actual type of SdaiInstance is IfcCompositeCurve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCompositeCurve CreateExactEntity(SdaiInstance instance) { return IfcCompositeCurve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCompositeCurve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCompositeCurve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcCompositeCurveSegment or list of convertible elements
+        template <typename TList> void get_Segments(TList& lst) { RDF_EXPRESS_PROBE(178); ListOfIfcCompositeCurveSegmentSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(178)); }
+
+        //TList may be ListOfIfcCompositeCurveSegment or list of convertible elements
+        template <typename TList> void put_Segments(TList& lst) { RDF_EXPRESS_PROBE(178); ListOfIfcCompositeCurveSegmentSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(178)); }
+
+        //TArrayElem[] may be IfcCompositeCurveSegment[] or array of convertible elements
+        template <typename TArrayElem> void put_Segments(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(178); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcCompositeCurveSegmentSerializer<ListOfIfcCompositeCurveSegment> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(178)); }
+
+        Nullable<IfcLogical> get_SelfIntersect() { RDF_EXPRESS_PROBE(179); int v = getENUM(179, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_SelfIntersect(IfcLogical value) { RDF_EXPRESS_PROBE(179); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(179), sdaiENUM, val); }
+
+        Nullable<IfcInteger> get_NSegments() { RDF_EXPRESS_PROBE(180); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(180), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+
+        Nullable<IfcLogical> get_ClosedCurve() { RDF_EXPRESS_PROBE(181); int v = getENUM(181, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundedCurve::attr
+        {
+            static constexpr IntValue Segments = 178;
+            static constexpr IntValue SelfIntersect = 179;
+            static constexpr IntValue NSegments = 180;
+            static constexpr IntValue ClosedCurve = 181;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCompositeCurve_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCompositeCurveOnSurface_CLASS_H
+#define __RDF_LTD__IFC4_IfcCompositeCurveOnSurface_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCompositeCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCompositeCurveOnSurface
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCompositeCurveOnSurface : public RDF_EXPRESS_VIRTUAL IfcCompositeCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCompositeCurveOnSurface
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCompositeCurveOnSurface(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 110);
+        }
+
+        /// <summary>
+        /// Instances of IfcCompositeCurveOnSurface in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCompositeCurveOnSurface> Extent(SdaiModel model) { return ExtentRange<IfcCompositeCurveOnSurface>(model, 110, false); }
+        static ExtentRange<IfcCompositeCurveOnSurface> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCompositeCurveOnSurface>(model, 110, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCompositeCurveOnSurface and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCompositeCurveOnSurface Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCompositeCurveOnSurface"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCompositeCurveOnSurface if the actual type of SdaiInstance is IfcCompositeCurveOnSurface or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCompositeCurveOnSurface CreateExactEntity(SdaiInstance instance) { return IfcCompositeCurveOnSurface(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCompositeCurveOnSurface or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCompositeCurveOnSurface(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcSurface or list of convertible elements
+        template <typename TList> void get_BasisSurface(TList& lst) { RDF_EXPRESS_PROBE(182); SetOfIfcSurfaceSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(182)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCompositeCurve::attr
+        {
+            static constexpr IntValue BasisSurface = 182;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCompositeCurveOnSurface_CLASS_H
@@ -0,0 +1,79 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCompositeCurveSegment_CLASS_H
+#define __RDF_LTD__IFC4_IfcCompositeCurveSegment_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCompositeCurveSegment
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCompositeCurveSegment : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCompositeCurveSegment
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCompositeCurveSegment(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 111);
+        }
+
+        /// <summary>
+        /// Instances of IfcCompositeCurveSegment in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCompositeCurveSegment> Extent(SdaiModel model) { return ExtentRange<IfcCompositeCurveSegment>(model, 111, false); }
+        static ExtentRange<IfcCompositeCurveSegment> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCompositeCurveSegment>(model, 111, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCompositeCurveSegment and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCompositeCurveSegment Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCompositeCurveSegment"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCompositeCurveSegment if the actual type of SdaiInstance is IfcCompositeCurveSegment or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCompositeCurveSegment CreateExactEntity(SdaiInstance instance) { return IfcCompositeCurveSegment(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCompositeCurveSegment or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCompositeCurveSegment(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTransitionCode> get_Transition() { RDF_EXPRESS_PROBE(340); int v = getENUM(340, IfcTransitionCode_hash); if (v >= 0) return (IfcTransitionCode) v; else return Nullable<IfcTransitionCode>(); }
+        void put_Transition(IfcTransitionCode value) { RDF_EXPRESS_PROBE(340); TextValue val = IfcTransitionCode_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(340), sdaiENUM, val); }
+
+        Nullable<IfcBoolean> get_SameSense() { RDF_EXPRESS_PROBE(341); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(341), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_SameSense(IfcBoolean value) { RDF_EXPRESS_PROBE(341); sdaiPutAttr(m_instance, getAttrDefinition(341), sdaiBOOLEAN, &value); }
+
+        IfcCurve get_ParentCurve();
+        void put_ParentCurve(IfcCurve inst);
+
+        //TList may be SetOfIfcCompositeCurve or list of convertible elements
+        template <typename TList> void get_UsingCurves(TList& lst) { RDF_EXPRESS_PROBE(343); SetOfIfcCompositeCurveSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(343)); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(344); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(344), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue Transition = 340;
+            static constexpr IntValue SameSense = 341;
+            static constexpr IntValue ParentCurve = 342;
+            static constexpr IntValue UsingCurves = 343;
+            static constexpr IntValue Dim = 344;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCompositeCurveSegment_CLASS_H
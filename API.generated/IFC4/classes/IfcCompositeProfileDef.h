@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCompositeProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcCompositeProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCompositeProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCompositeProfileDef : public RDF_EXPRESS_VIRTUAL IfcProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCompositeProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCompositeProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 112);
+        }
+
+        /// <summary>
+        /// Instances of IfcCompositeProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCompositeProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcCompositeProfileDef>(model, 112, false); }
+        static ExtentRange<IfcCompositeProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCompositeProfileDef>(model, 112, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCompositeProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCompositeProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCompositeProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCompositeProfileDef if the actual type of SdaiInstance is IfcCompositeProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCompositeProfileDef CreateExactEntity(SdaiInstance instance) { return IfcCompositeProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCompositeProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCompositeProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcProfileDef or list of convertible elements
+        template <typename TList> void get_Profiles(TList& lst) { RDF_EXPRESS_PROBE(345); SetOfIfcProfileDefSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(345)); }
+
+        //TList may be SetOfIfcProfileDef or list of convertible elements
+        template <typename TList> void put_Profiles(TList& lst) { RDF_EXPRESS_PROBE(345); SetOfIfcProfileDefSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(345)); }
+
+        //TArrayElem[] may be IfcProfileDef[] or array of convertible elements
+        template <typename TArrayElem> void put_Profiles(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(345); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcProfileDefSerializer<SetOfIfcProfileDef> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(345)); }
+
+        IfcLabel get_Label() { RDF_EXPRESS_PROBE(346); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(346), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Label_view() { return TextView(get_Label()); }
+#endif
+        void put_Label(IfcLabel value) { RDF_EXPRESS_PROBE(346); sdaiPutAttr(m_instance, getAttrDefinition(346), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Label_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(346); return buffer.GetAttr(m_instance, "Label"); }
+        const char* get_Label_utf8() { return get_Label_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProfileDef::attr
+        {
+            static constexpr IntValue Profiles = 345;
+            static constexpr IntValue Label = 346;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCompositeProfileDef_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCompressor_CLASS_H
+#define __RDF_LTD__IFC4_IfcCompressor_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowMovingDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCompressor
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCompressor : public RDF_EXPRESS_VIRTUAL IfcFlowMovingDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCompressor
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCompressor(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 113);
+        }
+
+        /// <summary>
+        /// Instances of IfcCompressor in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCompressor> Extent(SdaiModel model) { return ExtentRange<IfcCompressor>(model, 113, false); }
+        static ExtentRange<IfcCompressor> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCompressor>(model, 113, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCompressor and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCompressor Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCompressor"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCompressor if the actual type of SdaiInstance is IfcCompressor or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCompressor CreateExactEntity(SdaiInstance instance) { return IfcCompressor(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCompressor or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCompressor(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCompressorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(347); int v = getENUM(347, IfcCompressorTypeEnum_hash); if (v >= 0) return (IfcCompressorTypeEnum) v; else return Nullable<IfcCompressorTypeEnum>(); }
+        void put_PredefinedType(IfcCompressorTypeEnum value) { RDF_EXPRESS_PROBE(347); TextValue val = IfcCompressorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(347), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowMovingDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 347;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCompressor_CLASS_H
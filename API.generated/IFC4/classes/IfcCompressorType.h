@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCompressorType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCompressorType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowMovingDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCompressorType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCompressorType : public RDF_EXPRESS_VIRTUAL IfcFlowMovingDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCompressorType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCompressorType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 114);
+        }
+
+        /// <summary>
+        /// Instances of IfcCompressorType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCompressorType> Extent(SdaiModel model) { return ExtentRange<IfcCompressorType>(model, 114, false); }
+        static ExtentRange<IfcCompressorType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCompressorType>(model, 114, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCompressorType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCompressorType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCompressorType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCompressorType if the actual type of SdaiInstance is IfcCompressorType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCompressorType CreateExactEntity(SdaiInstance instance) { return IfcCompressorType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCompressorType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCompressorType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCompressorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(348); int v = getENUM(348, IfcCompressorTypeEnum_hash); if (v >= 0) return (IfcCompressorTypeEnum) v; else return Nullable<IfcCompressorTypeEnum>(); }
+        void put_PredefinedType(IfcCompressorTypeEnum value) { RDF_EXPRESS_PROBE(348); TextValue val = IfcCompressorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(348), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowMovingDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 348;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCompressorType_CLASS_H
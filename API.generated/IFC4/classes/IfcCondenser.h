@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCondenser_CLASS_H
+#define __RDF_LTD__IFC4_IfcCondenser_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCondenser
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCondenser : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCondenser
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCondenser(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 115);
+        }
+
+        /// <summary>
+        /// Instances of IfcCondenser in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCondenser> Extent(SdaiModel model) { return ExtentRange<IfcCondenser>(model, 115, false); }
+        static ExtentRange<IfcCondenser> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCondenser>(model, 115, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCondenser and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCondenser Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCondenser"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCondenser if the actual type of SdaiInstance is IfcCondenser or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCondenser CreateExactEntity(SdaiInstance instance) { return IfcCondenser(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCondenser or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCondenser(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCondenserTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(349); int v = getENUM(349, IfcCondenserTypeEnum_hash); if (v >= 0) return (IfcCondenserTypeEnum) v; else return Nullable<IfcCondenserTypeEnum>(); }
+        void put_PredefinedType(IfcCondenserTypeEnum value) { RDF_EXPRESS_PROBE(349); TextValue val = IfcCondenserTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(349), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 349;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCondenser_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCondenserType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCondenserType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCondenserType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCondenserType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCondenserType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCondenserType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 116);
+        }
+
+        /// <summary>
+        /// Instances of IfcCondenserType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCondenserType> Extent(SdaiModel model) { return ExtentRange<IfcCondenserType>(model, 116, false); }
+        static ExtentRange<IfcCondenserType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCondenserType>(model, 116, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCondenserType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCondenserType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCondenserType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCondenserType if the actual type of SdaiInstance is IfcCondenserType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCondenserType CreateExactEntity(SdaiInstance instance) { return IfcCondenserType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCondenserType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCondenserType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCondenserTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(350); int v = getENUM(350, IfcCondenserTypeEnum_hash); if (v >= 0) return (IfcCondenserTypeEnum) v; else return Nullable<IfcCondenserTypeEnum>(); }
+        void put_PredefinedType(IfcCondenserTypeEnum value) { RDF_EXPRESS_PROBE(350); TextValue val = IfcCondenserTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(350), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 350;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCondenserType_CLASS_H
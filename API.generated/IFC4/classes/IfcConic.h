@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConic_CLASS_H
+#define __RDF_LTD__IFC4_IfcConic_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConic
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConic : public RDF_EXPRESS_VIRTUAL IfcCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConic
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConic(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 117);
+        }
+
+        /// <summary>
+        /// Instances of IfcConic in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConic> Extent(SdaiModel model) { return ExtentRange<IfcConic>(model, 117, false); }
+        static ExtentRange<IfcConic> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConic>(model, 117, true); }
+
+        /// <summary>
+        /// Returns object of IfcConic if the actual type of SdaiInstance is IfcConic or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConic CreateExactEntity(SdaiInstance instance) { return IfcConic(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConic or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConic(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcAxis2Placement_get get_Position() { return IfcAxis2Placement_get(m_instance, 288); }
+        IfcAxis2Placement_put put_Position() { return IfcAxis2Placement_put(m_instance, 288); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCurve::attr
+        {
+            static constexpr IntValue Position = 288;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConic_CLASS_H
@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConnectedFaceSet_CLASS_H
+#define __RDF_LTD__IFC4_IfcConnectedFaceSet_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTopologicalRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConnectedFaceSet
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConnectedFaceSet : public RDF_EXPRESS_VIRTUAL IfcTopologicalRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConnectedFaceSet
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConnectedFaceSet(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 118);
+        }
+
+        /// <summary>
+        /// Instances of IfcConnectedFaceSet in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConnectedFaceSet> Extent(SdaiModel model) { return ExtentRange<IfcConnectedFaceSet>(model, 118, false); }
+        static ExtentRange<IfcConnectedFaceSet> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConnectedFaceSet>(model, 118, true); }
+
+        /// <summary>
+        /// Create new instance of IfcConnectedFaceSet and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcConnectedFaceSet Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcConnectedFaceSet"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcConnectedFaceSet if the actual type of SdaiInstance is IfcConnectedFaceSet or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConnectedFaceSet CreateExactEntity(SdaiInstance instance) { return IfcConnectedFaceSet(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConnectedFaceSet or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConnectedFaceSet(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcFace or list of convertible elements
+        template <typename TList> void get_CfsFaces(TList& lst) { RDF_EXPRESS_PROBE(310); SetOfIfcFaceSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(310)); }
+
+        //TList may be SetOfIfcFace or list of convertible elements
+        template <typename TList> void put_CfsFaces(TList& lst) { RDF_EXPRESS_PROBE(310); SetOfIfcFaceSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(310)); }
+
+        //TArrayElem[] may be IfcFace[] or array of convertible elements
+        template <typename TArrayElem> void put_CfsFaces(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(310); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcFaceSerializer<SetOfIfcFace> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(310)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTopologicalRepresentationItem::attr
+        {
+            static constexpr IntValue CfsFaces = 310;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConnectedFaceSet_CLASS_H
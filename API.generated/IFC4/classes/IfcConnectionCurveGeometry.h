@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConnectionCurveGeometry_CLASS_H
+#define __RDF_LTD__IFC4_IfcConnectionCurveGeometry_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConnectionGeometry.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConnectionCurveGeometry
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConnectionCurveGeometry : public RDF_EXPRESS_VIRTUAL IfcConnectionGeometry
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConnectionCurveGeometry
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConnectionCurveGeometry(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 119);
+        }
+
+        /// <summary>
+        /// Instances of IfcConnectionCurveGeometry in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConnectionCurveGeometry> Extent(SdaiModel model) { return ExtentRange<IfcConnectionCurveGeometry>(model, 119, false); }
+        static ExtentRange<IfcConnectionCurveGeometry> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConnectionCurveGeometry>(model, 119, true); }
+
+        /// <summary>
+        /// Create new instance of IfcConnectionCurveGeometry and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcConnectionCurveGeometry Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcConnectionCurveGeometry"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcConnectionCurveGeometry if the actual type of SdaiInstance is IfcConnectionCurveGeometry or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConnectionCurveGeometry CreateExactEntity(SdaiInstance instance) { return IfcConnectionCurveGeometry(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConnectionCurveGeometry or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConnectionCurveGeometry(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurveOrEdgeCurve_get get_CurveOnRelatingElement() { return IfcCurveOrEdgeCurve_get(m_instance, 351); }
+        IfcCurveOrEdgeCurve_put put_CurveOnRelatingElement() { return IfcCurveOrEdgeCurve_put(m_instance, 351); }
+
+        IfcCurveOrEdgeCurve_get get_CurveOnRelatedElement() { return IfcCurveOrEdgeCurve_get(m_instance, 352); }
+        IfcCurveOrEdgeCurve_put put_CurveOnRelatedElement() { return IfcCurveOrEdgeCurve_put(m_instance, 352); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConnectionGeometry::attr
+        {
+            static constexpr IntValue CurveOnRelatingElement = 351;
+            static constexpr IntValue CurveOnRelatedElement = 352;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConnectionCurveGeometry_CLASS_H
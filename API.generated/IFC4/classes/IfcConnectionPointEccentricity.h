@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConnectionPointEccentricity_CLASS_H
+#define __RDF_LTD__IFC4_IfcConnectionPointEccentricity_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConnectionPointGeometry.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConnectionPointEccentricity
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConnectionPointEccentricity : public RDF_EXPRESS_VIRTUAL IfcConnectionPointGeometry
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConnectionPointEccentricity
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConnectionPointEccentricity(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 121);
+        }
+
+        /// <summary>
+        /// Instances of IfcConnectionPointEccentricity in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConnectionPointEccentricity> Extent(SdaiModel model) { return ExtentRange<IfcConnectionPointEccentricity>(model, 121, false); }
+        static ExtentRange<IfcConnectionPointEccentricity> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConnectionPointEccentricity>(model, 121, true); }
+
+        /// <summary>
+        /// Create new instance of IfcConnectionPointEccentricity and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcConnectionPointEccentricity Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcConnectionPointEccentricity"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcConnectionPointEccentricity if the actual type of SdaiInstance is IfcConnectionPointEccentricity or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConnectionPointEccentricity CreateExactEntity(SdaiInstance instance) { return IfcConnectionPointEccentricity(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConnectionPointEccentricity or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConnectionPointEccentricity(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLengthMeasure> get_EccentricityInX() { RDF_EXPRESS_PROBE(355); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(355), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_EccentricityInX(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(355); sdaiPutAttr(m_instance, getAttrDefinition(355), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_EccentricityInY() { RDF_EXPRESS_PROBE(356); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(356), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_EccentricityInY(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(356); sdaiPutAttr(m_instance, getAttrDefinition(356), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_EccentricityInZ() { RDF_EXPRESS_PROBE(357); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(357), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_EccentricityInZ(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(357); sdaiPutAttr(m_instance, getAttrDefinition(357), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConnectionPointGeometry::attr
+        {
+            static constexpr IntValue EccentricityInX = 355;
+            static constexpr IntValue EccentricityInY = 356;
+            static constexpr IntValue EccentricityInZ = 357;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConnectionPointEccentricity_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConnectionPointGeometry_CLASS_H
+#define __RDF_LTD__IFC4_IfcConnectionPointGeometry_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConnectionGeometry.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConnectionPointGeometry
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConnectionPointGeometry : public RDF_EXPRESS_VIRTUAL IfcConnectionGeometry
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConnectionPointGeometry
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConnectionPointGeometry(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 122);
+        }
+
+        /// <summary>
+        /// Instances of IfcConnectionPointGeometry in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConnectionPointGeometry> Extent(SdaiModel model) { return ExtentRange<IfcConnectionPointGeometry>(model, 122, false); }
+        static ExtentRange<IfcConnectionPointGeometry> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConnectionPointGeometry>(model, 122, true); }
+
+        /// <summary>
+        /// Create new instance of IfcConnectionPointGeometry and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcConnectionPointGeometry Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcConnectionPointGeometry"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcConnectionPointGeometry if the actual type of SdaiInstance is IfcConnectionPointGeometry or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConnectionPointGeometry CreateExactEntity(SdaiInstance instance) { return IfcConnectionPointGeometry(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConnectionPointGeometry or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConnectionPointGeometry(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcPointOrVertexPoint_get get_PointOnRelatingElement() { return IfcPointOrVertexPoint_get(m_instance, 353); }
+        IfcPointOrVertexPoint_put put_PointOnRelatingElement() { return IfcPointOrVertexPoint_put(m_instance, 353); }
+
+        IfcPointOrVertexPoint_get get_PointOnRelatedElement() { return IfcPointOrVertexPoint_get(m_instance, 354); }
+        IfcPointOrVertexPoint_put put_PointOnRelatedElement() { return IfcPointOrVertexPoint_put(m_instance, 354); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConnectionGeometry::attr
+        {
+            static constexpr IntValue PointOnRelatingElement = 353;
+            static constexpr IntValue PointOnRelatedElement = 354;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConnectionPointGeometry_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConnectionSurfaceGeometry_CLASS_H
+#define __RDF_LTD__IFC4_IfcConnectionSurfaceGeometry_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConnectionGeometry.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConnectionSurfaceGeometry
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConnectionSurfaceGeometry : public RDF_EXPRESS_VIRTUAL IfcConnectionGeometry
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConnectionSurfaceGeometry
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConnectionSurfaceGeometry(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 123);
+        }
+
+        /// <summary>
+        /// Instances of IfcConnectionSurfaceGeometry in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConnectionSurfaceGeometry> Extent(SdaiModel model) { return ExtentRange<IfcConnectionSurfaceGeometry>(model, 123, false); }
+        static ExtentRange<IfcConnectionSurfaceGeometry> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConnectionSurfaceGeometry>(model, 123, true); }
+
+        /// <summary>
+        /// Create new instance of IfcConnectionSurfaceGeometry and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcConnectionSurfaceGeometry Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcConnectionSurfaceGeometry"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcConnectionSurfaceGeometry if the actual type of SdaiInstance is IfcConnectionSurfaceGeometry or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConnectionSurfaceGeometry CreateExactEntity(SdaiInstance instance) { return IfcConnectionSurfaceGeometry(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConnectionSurfaceGeometry or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConnectionSurfaceGeometry(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcSurfaceOrFaceSurface_get get_SurfaceOnRelatingElement() { return IfcSurfaceOrFaceSurface_get(m_instance, 358); }
+        IfcSurfaceOrFaceSurface_put put_SurfaceOnRelatingElement() { return IfcSurfaceOrFaceSurface_put(m_instance, 358); }
+
+        IfcSurfaceOrFaceSurface_get get_SurfaceOnRelatedElement() { return IfcSurfaceOrFaceSurface_get(m_instance, 359); }
+        IfcSurfaceOrFaceSurface_put put_SurfaceOnRelatedElement() { return IfcSurfaceOrFaceSurface_put(m_instance, 359); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConnectionGeometry::attr
+        {
+            static constexpr IntValue SurfaceOnRelatingElement = 358;
+            static constexpr IntValue SurfaceOnRelatedElement = 359;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConnectionSurfaceGeometry_CLASS_H
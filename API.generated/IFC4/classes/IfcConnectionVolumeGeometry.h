@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConnectionVolumeGeometry_CLASS_H
+#define __RDF_LTD__IFC4_IfcConnectionVolumeGeometry_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConnectionGeometry.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConnectionVolumeGeometry
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConnectionVolumeGeometry : public RDF_EXPRESS_VIRTUAL IfcConnectionGeometry
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConnectionVolumeGeometry
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConnectionVolumeGeometry(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 124);
+        }
+
+        /// <summary>
+        /// Instances of IfcConnectionVolumeGeometry in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConnectionVolumeGeometry> Extent(SdaiModel model) { return ExtentRange<IfcConnectionVolumeGeometry>(model, 124, false); }
+        static ExtentRange<IfcConnectionVolumeGeometry> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConnectionVolumeGeometry>(model, 124, true); }
+
+        /// <summary>
+        /// Create new instance of IfcConnectionVolumeGeometry and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcConnectionVolumeGeometry Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcConnectionVolumeGeometry"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcConnectionVolumeGeometry if the actual type of SdaiInstance is IfcConnectionVolumeGeometry or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConnectionVolumeGeometry CreateExactEntity(SdaiInstance instance) { return IfcConnectionVolumeGeometry(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConnectionVolumeGeometry or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConnectionVolumeGeometry(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcSolidOrShell_get get_VolumeOnRelatingElement() { return IfcSolidOrShell_get(m_instance, 360); }
+        IfcSolidOrShell_put put_VolumeOnRelatingElement() { return IfcSolidOrShell_put(m_instance, 360); }
+
+        IfcSolidOrShell_get get_VolumeOnRelatedElement() { return IfcSolidOrShell_get(m_instance, 361); }
+        IfcSolidOrShell_put put_VolumeOnRelatedElement() { return IfcSolidOrShell_put(m_instance, 361); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConnectionGeometry::attr
+        {
+            static constexpr IntValue VolumeOnRelatingElement = 360;
+            static constexpr IntValue VolumeOnRelatedElement = 361;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConnectionVolumeGeometry_CLASS_H
@@ -0,0 +1,126 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstraint_CLASS_H
+#define __RDF_LTD__IFC4_IfcConstraint_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConstraint
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConstraint : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConstraint
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConstraint(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 125);
+        }
+
+        /// <summary>
+        /// Instances of IfcConstraint in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConstraint> Extent(SdaiModel model) { return ExtentRange<IfcConstraint>(model, 125, false); }
+        static ExtentRange<IfcConstraint> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConstraint>(model, 125, true); }
+
+        /// <summary>
+        /// Returns object of IfcConstraint if the actual type of SdaiInstance is IfcConstraint or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConstraint CreateExactEntity(SdaiInstance instance) { return IfcConstraint(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConstraint or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConstraint(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(362); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(362), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(362); sdaiPutAttr(m_instance, getAttrDefinition(362), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(362); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(363); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(363), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(363); sdaiPutAttr(m_instance, getAttrDefinition(363), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(363); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcConstraintEnum> get_ConstraintGrade() { RDF_EXPRESS_PROBE(364); int v = getENUM(364, IfcConstraintEnum_hash); if (v >= 0) return (IfcConstraintEnum) v; else return Nullable<IfcConstraintEnum>(); }
+        void put_ConstraintGrade(IfcConstraintEnum value) { RDF_EXPRESS_PROBE(364); TextValue val = IfcConstraintEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(364), sdaiENUM, val); }
+
+        IfcLabel get_ConstraintSource() { RDF_EXPRESS_PROBE(365); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(365), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ConstraintSource_view() { return TextView(get_ConstraintSource()); }
+#endif
+        void put_ConstraintSource(IfcLabel value) { RDF_EXPRESS_PROBE(365); sdaiPutAttr(m_instance, getAttrDefinition(365), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ConstraintSource_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(365); return buffer.GetAttr(m_instance, "ConstraintSource"); }
+        const char* get_ConstraintSource_utf8() { return get_ConstraintSource_utf8(ThreadUtf8Buffer()); }
+
+        IfcActorSelect_get get_CreatingActor() { return IfcActorSelect_get(m_instance, 366); }
+        IfcActorSelect_put put_CreatingActor() { return IfcActorSelect_put(m_instance, 366); }
+
+        IfcDateTime get_CreationTime() { RDF_EXPRESS_PROBE(367); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(367), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_CreationTime_view() { return TextView(get_CreationTime()); }
+#endif
+        void put_CreationTime(IfcDateTime value) { RDF_EXPRESS_PROBE(367); sdaiPutAttr(m_instance, getAttrDefinition(367), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_CreationTime_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(367); return buffer.GetAttr(m_instance, "CreationTime"); }
+        const char* get_CreationTime_utf8() { return get_CreationTime_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_UserDefinedGrade() { RDF_EXPRESS_PROBE(368); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(368), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedGrade_view() { return TextView(get_UserDefinedGrade()); }
+#endif
+        void put_UserDefinedGrade(IfcLabel value) { RDF_EXPRESS_PROBE(368); sdaiPutAttr(m_instance, getAttrDefinition(368), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedGrade_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(368); return buffer.GetAttr(m_instance, "UserDefinedGrade"); }
+        const char* get_UserDefinedGrade_utf8() { return get_UserDefinedGrade_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcExternalReferenceRelationship or list of convertible elements
+        template <typename TList> void get_HasExternalReferences(TList& lst) { RDF_EXPRESS_PROBE(369); SetOfIfcExternalReferenceRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(369)); }
+
+        //TList may be SetOfIfcResourceConstraintRelationship or list of convertible elements
+        template <typename TList> void get_PropertiesForConstraint(TList& lst) { RDF_EXPRESS_PROBE(370); SetOfIfcResourceConstraintRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(370)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Name = 362;
+            static constexpr IntValue Description = 363;
+            static constexpr IntValue ConstraintGrade = 364;
+            static constexpr IntValue ConstraintSource = 365;
+            static constexpr IntValue CreatingActor = 366;
+            static constexpr IntValue CreationTime = 367;
+            static constexpr IntValue UserDefinedGrade = 368;
+            static constexpr IntValue HasExternalReferences = 369;
+            static constexpr IntValue PropertiesForConstraint = 370;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstraint_CLASS_H
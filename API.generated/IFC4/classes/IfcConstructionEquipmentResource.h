@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionEquipmentResource_CLASS_H
+#define __RDF_LTD__IFC4_IfcConstructionEquipmentResource_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstructionResource.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConstructionEquipmentResource
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConstructionEquipmentResource : public RDF_EXPRESS_VIRTUAL IfcConstructionResource
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConstructionEquipmentResource
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConstructionEquipmentResource(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 126);
+        }
+
+        /// <summary>
+        /// Instances of IfcConstructionEquipmentResource in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConstructionEquipmentResource> Extent(SdaiModel model) { return ExtentRange<IfcConstructionEquipmentResource>(model, 126, false); }
+        static ExtentRange<IfcConstructionEquipmentResource> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConstructionEquipmentResource>(model, 126, true); }
+
+        /// <summary>
+        /// Create new instance of IfcConstructionEquipmentResource and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcConstructionEquipmentResource Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcConstructionEquipmentResource"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcConstructionEquipmentResource if the actual type of SdaiInstance is IfcConstructionEquipmentResource or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConstructionEquipmentResource CreateExactEntity(SdaiInstance instance) { return IfcConstructionEquipmentResource(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConstructionEquipmentResource or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConstructionEquipmentResource(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcConstructionEquipmentResourceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(377); int v = getENUM(377, IfcConstructionEquipmentResourceTypeEnum_hash); if (v >= 0) return (IfcConstructionEquipmentResourceTypeEnum) v; else return Nullable<IfcConstructionEquipmentResourceTypeEnum>(); }
+        void put_PredefinedType(IfcConstructionEquipmentResourceTypeEnum value) { RDF_EXPRESS_PROBE(377); TextValue val = IfcConstructionEquipmentResourceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(377), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstructionResource::attr
+        {
+            static constexpr IntValue PredefinedType = 377;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionEquipmentResource_CLASS_H
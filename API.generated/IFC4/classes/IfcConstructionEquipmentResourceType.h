@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionEquipmentResourceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcConstructionEquipmentResourceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstructionResourceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConstructionEquipmentResourceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConstructionEquipmentResourceType : public RDF_EXPRESS_VIRTUAL IfcConstructionResourceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConstructionEquipmentResourceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConstructionEquipmentResourceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 127);
+        }
+
+        /// <summary>
+        /// Instances of IfcConstructionEquipmentResourceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConstructionEquipmentResourceType> Extent(SdaiModel model) { return ExtentRange<IfcConstructionEquipmentResourceType>(model, 127, false); }
+        static ExtentRange<IfcConstructionEquipmentResourceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConstructionEquipmentResourceType>(model, 127, true); }
+
+        /// <summary>
+        /// Create new instance of IfcConstructionEquipmentResourceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcConstructionEquipmentResourceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcConstructionEquipmentResourceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcConstructionEquipmentResourceType if the actual type of SdaiInstance is IfcConstructionEquipmentResourceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConstructionEquipmentResourceType CreateExactEntity(SdaiInstance instance) { return IfcConstructionEquipmentResourceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConstructionEquipmentResourceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConstructionEquipmentResourceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcConstructionEquipmentResourceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(384); int v = getENUM(384, IfcConstructionEquipmentResourceTypeEnum_hash); if (v >= 0) return (IfcConstructionEquipmentResourceTypeEnum) v; else return Nullable<IfcConstructionEquipmentResourceTypeEnum>(); }
+        void put_PredefinedType(IfcConstructionEquipmentResourceTypeEnum value) { RDF_EXPRESS_PROBE(384); TextValue val = IfcConstructionEquipmentResourceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(384), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstructionResourceType::attr
+        {
+            static constexpr IntValue PredefinedType = 384;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionEquipmentResourceType_CLASS_H
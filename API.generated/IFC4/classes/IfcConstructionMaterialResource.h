@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionMaterialResource_CLASS_H
+#define __RDF_LTD__IFC4_IfcConstructionMaterialResource_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstructionResource.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConstructionMaterialResource
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConstructionMaterialResource : public RDF_EXPRESS_VIRTUAL IfcConstructionResource
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConstructionMaterialResource
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConstructionMaterialResource(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 128);
+        }
+
+        /// <summary>
+        /// Instances of IfcConstructionMaterialResource in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConstructionMaterialResource> Extent(SdaiModel model) { return ExtentRange<IfcConstructionMaterialResource>(model, 128, false); }
+        static ExtentRange<IfcConstructionMaterialResource> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConstructionMaterialResource>(model, 128, true); }
+
+        /// <summary>
+        /// Create new instance of IfcConstructionMaterialResource and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcConstructionMaterialResource Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcConstructionMaterialResource"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcConstructionMaterialResource if the actual type of SdaiInstance is IfcConstructionMaterialResource or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConstructionMaterialResource CreateExactEntity(SdaiInstance instance) { return IfcConstructionMaterialResource(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConstructionMaterialResource or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConstructionMaterialResource(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcConstructionMaterialResourceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(385); int v = getENUM(385, IfcConstructionMaterialResourceTypeEnum_hash); if (v >= 0) return (IfcConstructionMaterialResourceTypeEnum) v; else return Nullable<IfcConstructionMaterialResourceTypeEnum>(); }
+        void put_PredefinedType(IfcConstructionMaterialResourceTypeEnum value) { RDF_EXPRESS_PROBE(385); TextValue val = IfcConstructionMaterialResourceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(385), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstructionResource::attr
+        {
+            static constexpr IntValue PredefinedType = 385;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionMaterialResource_CLASS_H
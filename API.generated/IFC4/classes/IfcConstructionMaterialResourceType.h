@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionMaterialResourceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcConstructionMaterialResourceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstructionResourceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConstructionMaterialResourceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConstructionMaterialResourceType : public RDF_EXPRESS_VIRTUAL IfcConstructionResourceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConstructionMaterialResourceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConstructionMaterialResourceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 129);
+        }
+
+        /// <summary>
+        /// Instances of IfcConstructionMaterialResourceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConstructionMaterialResourceType> Extent(SdaiModel model) { return ExtentRange<IfcConstructionMaterialResourceType>(model, 129, false); }
+        static ExtentRange<IfcConstructionMaterialResourceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConstructionMaterialResourceType>(model, 129, true); }
+
+        /// <summary>
+        /// Create new instance of IfcConstructionMaterialResourceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcConstructionMaterialResourceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcConstructionMaterialResourceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcConstructionMaterialResourceType if the actual type of SdaiInstance is IfcConstructionMaterialResourceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConstructionMaterialResourceType CreateExactEntity(SdaiInstance instance) { return IfcConstructionMaterialResourceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConstructionMaterialResourceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConstructionMaterialResourceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcConstructionMaterialResourceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(386); int v = getENUM(386, IfcConstructionMaterialResourceTypeEnum_hash); if (v >= 0) return (IfcConstructionMaterialResourceTypeEnum) v; else return Nullable<IfcConstructionMaterialResourceTypeEnum>(); }
+        void put_PredefinedType(IfcConstructionMaterialResourceTypeEnum value) { RDF_EXPRESS_PROBE(386); TextValue val = IfcConstructionMaterialResourceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(386), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstructionResourceType::attr
+        {
+            static constexpr IntValue PredefinedType = 386;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionMaterialResourceType_CLASS_H
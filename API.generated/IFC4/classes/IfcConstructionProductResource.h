@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionProductResource_CLASS_H
+#define __RDF_LTD__IFC4_IfcConstructionProductResource_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstructionResource.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConstructionProductResource
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConstructionProductResource : public RDF_EXPRESS_VIRTUAL IfcConstructionResource
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConstructionProductResource
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConstructionProductResource(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 130);
+        }
+
+        /// <summary>
+        /// Instances of IfcConstructionProductResource in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConstructionProductResource> Extent(SdaiModel model) { return ExtentRange<IfcConstructionProductResource>(model, 130, false); }
+        static ExtentRange<IfcConstructionProductResource> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConstructionProductResource>(model, 130, true); }
+
+        /// <summary>
+        /// Create new instance of IfcConstructionProductResource and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcConstructionProductResource Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcConstructionProductResource"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcConstructionProductResource if the actual type of SdaiInstance is IfcConstructionProductResource or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConstructionProductResource CreateExactEntity(SdaiInstance instance) { return IfcConstructionProductResource(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConstructionProductResource or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConstructionProductResource(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcConstructionProductResourceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(387); int v = getENUM(387, IfcConstructionProductResourceTypeEnum_hash); if (v >= 0) return (IfcConstructionProductResourceTypeEnum) v; else return Nullable<IfcConstructionProductResourceTypeEnum>(); }
+        void put_PredefinedType(IfcConstructionProductResourceTypeEnum value) { RDF_EXPRESS_PROBE(387); TextValue val = IfcConstructionProductResourceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(387), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstructionResource::attr
+        {
+            static constexpr IntValue PredefinedType = 387;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionProductResource_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionProductResourceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcConstructionProductResourceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstructionResourceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConstructionProductResourceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConstructionProductResourceType : public RDF_EXPRESS_VIRTUAL IfcConstructionResourceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConstructionProductResourceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConstructionProductResourceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 131);
+        }
+
+        /// <summary>
+        /// Instances of IfcConstructionProductResourceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConstructionProductResourceType> Extent(SdaiModel model) { return ExtentRange<IfcConstructionProductResourceType>(model, 131, false); }
+        static ExtentRange<IfcConstructionProductResourceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConstructionProductResourceType>(model, 131, true); }
+
+        /// <summary>
+        /// Create new instance of IfcConstructionProductResourceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcConstructionProductResourceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcConstructionProductResourceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcConstructionProductResourceType if the actual type of SdaiInstance is IfcConstructionProductResourceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConstructionProductResourceType CreateExactEntity(SdaiInstance instance) { return IfcConstructionProductResourceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConstructionProductResourceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConstructionProductResourceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcConstructionProductResourceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(388); int v = getENUM(388, IfcConstructionProductResourceTypeEnum_hash); if (v >= 0) return (IfcConstructionProductResourceTypeEnum) v; else return Nullable<IfcConstructionProductResourceTypeEnum>(); }
+        void put_PredefinedType(IfcConstructionProductResourceTypeEnum value) { RDF_EXPRESS_PROBE(388); TextValue val = IfcConstructionProductResourceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(388), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstructionResourceType::attr
+        {
+            static constexpr IntValue PredefinedType = 388;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionProductResourceType_CLASS_H
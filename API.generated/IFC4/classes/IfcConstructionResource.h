@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionResource_CLASS_H
+#define __RDF_LTD__IFC4_IfcConstructionResource_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcResource.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConstructionResource
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConstructionResource : public RDF_EXPRESS_VIRTUAL IfcResource
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConstructionResource
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConstructionResource(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 132);
+        }
+
+        /// <summary>
+        /// Instances of IfcConstructionResource in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConstructionResource> Extent(SdaiModel model) { return ExtentRange<IfcConstructionResource>(model, 132, false); }
+        static ExtentRange<IfcConstructionResource> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConstructionResource>(model, 132, true); }
+
+        /// <summary>
+        /// Returns object of IfcConstructionResource if the actual type of SdaiInstance is IfcConstructionResource or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConstructionResource CreateExactEntity(SdaiInstance instance) { return IfcConstructionResource(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConstructionResource or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConstructionResource(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcResourceTime get_Usage();
+        void put_Usage(IfcResourceTime inst);
+
+        //TList may be ListOfIfcAppliedValue or list of convertible elements
+        template <typename TList> void get_BaseCosts(TList& lst) { RDF_EXPRESS_PROBE(375); ListOfIfcAppliedValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(375)); }
+
+        //TList may be ListOfIfcAppliedValue or list of convertible elements
+        template <typename TList> void put_BaseCosts(TList& lst) { RDF_EXPRESS_PROBE(375); ListOfIfcAppliedValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(375)); }
+
+        //TArrayElem[] may be IfcAppliedValue[] or array of convertible elements
+        template <typename TArrayElem> void put_BaseCosts(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(375); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcAppliedValueSerializer<ListOfIfcAppliedValue> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(375)); }
+
+        IfcPhysicalQuantity get_BaseQuantity();
+        void put_BaseQuantity(IfcPhysicalQuantity inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcResource::attr
+        {
+            static constexpr IntValue Usage = 374;
+            static constexpr IntValue BaseCosts = 375;
+            static constexpr IntValue BaseQuantity = 376;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionResource_CLASS_H
@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConstructionResourceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcConstructionResourceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTypeResource.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConstructionResourceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConstructionResourceType : public RDF_EXPRESS_VIRTUAL IfcTypeResource
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConstructionResourceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConstructionResourceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 133);
+        }
+
+        /// <summary>
+        /// Instances of IfcConstructionResourceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConstructionResourceType> Extent(SdaiModel model) { return ExtentRange<IfcConstructionResourceType>(model, 133, false); }
+        static ExtentRange<IfcConstructionResourceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConstructionResourceType>(model, 133, true); }
+
+        /// <summary>
+        /// Returns object of IfcConstructionResourceType if the actual type of SdaiInstance is IfcConstructionResourceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConstructionResourceType CreateExactEntity(SdaiInstance instance) { return IfcConstructionResourceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConstructionResourceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConstructionResourceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcAppliedValue or list of convertible elements
+        template <typename TList> void get_BaseCosts(TList& lst) { RDF_EXPRESS_PROBE(382); ListOfIfcAppliedValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(382)); }
+
+        //TList may be ListOfIfcAppliedValue or list of convertible elements
+        template <typename TList> void put_BaseCosts(TList& lst) { RDF_EXPRESS_PROBE(382); ListOfIfcAppliedValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(382)); }
+
+        //TArrayElem[] may be IfcAppliedValue[] or array of convertible elements
+        template <typename TArrayElem> void put_BaseCosts(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(382); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcAppliedValueSerializer<ListOfIfcAppliedValue> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(382)); }
+
+        IfcPhysicalQuantity get_BaseQuantity();
+        void put_BaseQuantity(IfcPhysicalQuantity inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTypeResource::attr
+        {
+            static constexpr IntValue BaseCosts = 382;
+            static constexpr IntValue BaseQuantity = 383;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConstructionResourceType_CLASS_H
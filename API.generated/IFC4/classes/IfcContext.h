@@ -0,0 +1,111 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcContext_CLASS_H
+#define __RDF_LTD__IFC4_IfcContext_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcObjectDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcContext
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcContext : public RDF_EXPRESS_VIRTUAL IfcObjectDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcContext
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcContext(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 134);
+        }
+
+        /// <summary>
+        /// Instances of IfcContext in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcContext> Extent(SdaiModel model) { return ExtentRange<IfcContext>(model, 134, false); }
+        static ExtentRange<IfcContext> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcContext>(model, 134, true); }
+
+        /// <summary>
+        /// Returns object of IfcContext if the actual type of SdaiInstance is IfcContext or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcContext CreateExactEntity(SdaiInstance instance) { return IfcContext(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcContext or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcContext(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_ObjectType() { RDF_EXPRESS_PROBE(389); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(389), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ObjectType_view() { return TextView(get_ObjectType()); }
+#endif
+        void put_ObjectType(IfcLabel value) { RDF_EXPRESS_PROBE(389); sdaiPutAttr(m_instance, getAttrDefinition(389), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ObjectType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(389); return buffer.GetAttr(m_instance, "ObjectType"); }
+        const char* get_ObjectType_utf8() { return get_ObjectType_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_LongName() { RDF_EXPRESS_PROBE(390); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(390), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LongName_view() { return TextView(get_LongName()); }
+#endif
+        void put_LongName(IfcLabel value) { RDF_EXPRESS_PROBE(390); sdaiPutAttr(m_instance, getAttrDefinition(390), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LongName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(390); return buffer.GetAttr(m_instance, "LongName"); }
+        const char* get_LongName_utf8() { return get_LongName_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Phase() { RDF_EXPRESS_PROBE(391); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(391), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Phase_view() { return TextView(get_Phase()); }
+#endif
+        void put_Phase(IfcLabel value) { RDF_EXPRESS_PROBE(391); sdaiPutAttr(m_instance, getAttrDefinition(391), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Phase_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(391); return buffer.GetAttr(m_instance, "Phase"); }
+        const char* get_Phase_utf8() { return get_Phase_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRepresentationContext or list of convertible elements
+        template <typename TList> void get_RepresentationContexts(TList& lst) { RDF_EXPRESS_PROBE(392); SetOfIfcRepresentationContextSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(392)); }
+
+        //TList may be SetOfIfcRepresentationContext or list of convertible elements
+        template <typename TList> void put_RepresentationContexts(TList& lst) { RDF_EXPRESS_PROBE(392); SetOfIfcRepresentationContextSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(392)); }
+
+        //TArrayElem[] may be IfcRepresentationContext[] or array of convertible elements
+        template <typename TArrayElem> void put_RepresentationContexts(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(392); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcRepresentationContextSerializer<SetOfIfcRepresentationContext> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(392)); }
+
+        IfcUnitAssignment get_UnitsInContext();
+        void put_UnitsInContext(IfcUnitAssignment inst);
+
+        //TList may be SetOfIfcRelDefinesByProperties or list of convertible elements
+        template <typename TList> void get_IsDefinedBy(TList& lst) { RDF_EXPRESS_PROBE(394); SetOfIfcRelDefinesByPropertiesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(394)); }
+
+        //TList may be SetOfIfcRelDeclares or list of convertible elements
+        template <typename TList> void get_Declares(TList& lst) { RDF_EXPRESS_PROBE(395); SetOfIfcRelDeclaresSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(395)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcObjectDefinition::attr
+        {
+            static constexpr IntValue ObjectType = 389;
+            static constexpr IntValue LongName = 390;
+            static constexpr IntValue Phase = 391;
+            static constexpr IntValue RepresentationContexts = 392;
+            static constexpr IntValue UnitsInContext = 393;
+            static constexpr IntValue IsDefinedBy = 394;
+            static constexpr IntValue Declares = 395;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcContext_CLASS_H
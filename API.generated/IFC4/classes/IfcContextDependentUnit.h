@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcContextDependentUnit_CLASS_H
+#define __RDF_LTD__IFC4_IfcContextDependentUnit_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcNamedUnit.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcContextDependentUnit
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcContextDependentUnit : public RDF_EXPRESS_VIRTUAL IfcNamedUnit
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcContextDependentUnit
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcContextDependentUnit(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 135);
+        }
+
+        /// <summary>
+        /// Instances of IfcContextDependentUnit in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcContextDependentUnit> Extent(SdaiModel model) { return ExtentRange<IfcContextDependentUnit>(model, 135, false); }
+        static ExtentRange<IfcContextDependentUnit> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcContextDependentUnit>(model, 135, true); }
+
+        /// <summary>
+        /// Create new instance of IfcContextDependentUnit and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcContextDependentUnit Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcContextDependentUnit"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcContextDependentUnit if the actual type of SdaiInstance is IfcContextDependentUnit or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcContextDependentUnit CreateExactEntity(SdaiInstance instance) { return IfcContextDependentUnit(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcContextDependentUnit or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcContextDependentUnit(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(398); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(398), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(398); sdaiPutAttr(m_instance, getAttrDefinition(398), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(398); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcExternalReferenceRelationship or list of convertible elements
+        template <typename TList> void get_HasExternalReference(TList& lst) { RDF_EXPRESS_PROBE(399); SetOfIfcExternalReferenceRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(399)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcNamedUnit::attr
+        {
+            static constexpr IntValue Name = 398;
+            static constexpr IntValue HasExternalReference = 399;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcContextDependentUnit_CLASS_H
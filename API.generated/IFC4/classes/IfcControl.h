@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcControl_CLASS_H
+#define __RDF_LTD__IFC4_IfcControl_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcObject.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcControl
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcControl : public RDF_EXPRESS_VIRTUAL IfcObject
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcControl
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcControl(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 136);
+        }
+
+        /// <summary>
+        /// Instances of IfcControl in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcControl> Extent(SdaiModel model) { return ExtentRange<IfcControl>(model, 136, false); }
+        static ExtentRange<IfcControl> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcControl>(model, 136, true); }
+
+        /// <summary>
+        /// Returns object of IfcControl if the actual type of SdaiInstance is IfcControl or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcControl CreateExactEntity(SdaiInstance instance) { return IfcControl(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcControl or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcControl(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Identification() { RDF_EXPRESS_PROBE(16); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(16), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Identification_view() { return TextView(get_Identification()); }
+#endif
+        void put_Identification(IfcIdentifier value) { RDF_EXPRESS_PROBE(16); sdaiPutAttr(m_instance, getAttrDefinition(16), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Identification_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(16); return buffer.GetAttr(m_instance, "Identification"); }
+        const char* get_Identification_utf8() { return get_Identification_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRelAssignsToControl or list of convertible elements
+        template <typename TList> void get_Controls(TList& lst) { RDF_EXPRESS_PROBE(17); SetOfIfcRelAssignsToControlSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(17)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcObject::attr
+        {
+            static constexpr IntValue Identification = 16;
+            static constexpr IntValue Controls = 17;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcControl_CLASS_H
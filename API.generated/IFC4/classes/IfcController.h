@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcController_CLASS_H
+#define __RDF_LTD__IFC4_IfcController_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcController
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcController : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcController
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcController(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 137);
+        }
+
+        /// <summary>
+        /// Instances of IfcController in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcController> Extent(SdaiModel model) { return ExtentRange<IfcController>(model, 137, false); }
+        static ExtentRange<IfcController> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcController>(model, 137, true); }
+
+        /// <summary>
+        /// Create new instance of IfcController and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcController Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcController"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcController if the actual type of SdaiInstance is IfcController or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcController CreateExactEntity(SdaiInstance instance) { return IfcController(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcController or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcController(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcControllerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(400); int v = getENUM(400, IfcControllerTypeEnum_hash); if (v >= 0) return (IfcControllerTypeEnum) v; else return Nullable<IfcControllerTypeEnum>(); }
+        void put_PredefinedType(IfcControllerTypeEnum value) { RDF_EXPRESS_PROBE(400); TextValue val = IfcControllerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(400), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElement::attr
+        {
+            static constexpr IntValue PredefinedType = 400;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcController_CLASS_H
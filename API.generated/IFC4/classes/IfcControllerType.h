@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcControllerType_CLASS_H
+#define __RDF_LTD__IFC4_IfcControllerType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcControllerType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcControllerType : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcControllerType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcControllerType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 138);
+        }
+
+        /// <summary>
+        /// Instances of IfcControllerType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcControllerType> Extent(SdaiModel model) { return ExtentRange<IfcControllerType>(model, 138, false); }
+        static ExtentRange<IfcControllerType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcControllerType>(model, 138, true); }
+
+        /// <summary>
+        /// Create new instance of IfcControllerType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcControllerType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcControllerType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcControllerType if the actual type of SdaiInstance is IfcControllerType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcControllerType CreateExactEntity(SdaiInstance instance) { return IfcControllerType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcControllerType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcControllerType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcControllerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(401); int v = getENUM(401, IfcControllerTypeEnum_hash); if (v >= 0) return (IfcControllerTypeEnum) v; else return Nullable<IfcControllerTypeEnum>(); }
+        void put_PredefinedType(IfcControllerTypeEnum value) { RDF_EXPRESS_PROBE(401); TextValue val = IfcControllerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(401), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 401;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcControllerType_CLASS_H
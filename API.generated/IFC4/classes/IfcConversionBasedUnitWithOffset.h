@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcConversionBasedUnitWithOffset_CLASS_H
+#define __RDF_LTD__IFC4_IfcConversionBasedUnitWithOffset_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConversionBasedUnit.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcConversionBasedUnitWithOffset
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcConversionBasedUnitWithOffset : public RDF_EXPRESS_VIRTUAL IfcConversionBasedUnit
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcConversionBasedUnitWithOffset
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcConversionBasedUnitWithOffset(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 140);
+        }
+
+        /// <summary>
+        /// Instances of IfcConversionBasedUnitWithOffset in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcConversionBasedUnitWithOffset> Extent(SdaiModel model) { return ExtentRange<IfcConversionBasedUnitWithOffset>(model, 140, false); }
+        static ExtentRange<IfcConversionBasedUnitWithOffset> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcConversionBasedUnitWithOffset>(model, 140, true); }
+
+        /// <summary>
+        /// Create new instance of IfcConversionBasedUnitWithOffset and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcConversionBasedUnitWithOffset Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcConversionBasedUnitWithOffset"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcConversionBasedUnitWithOffset if the actual type of SdaiInstance is IfcConversionBasedUnitWithOffset or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcConversionBasedUnitWithOffset CreateExactEntity(SdaiInstance instance) { return IfcConversionBasedUnitWithOffset(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcConversionBasedUnitWithOffset or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcConversionBasedUnitWithOffset(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcReal> get_ConversionOffset() { RDF_EXPRESS_PROBE(405); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(405), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_ConversionOffset(IfcReal value) { RDF_EXPRESS_PROBE(405); sdaiPutAttr(m_instance, getAttrDefinition(405), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConversionBasedUnit::attr
+        {
+            static constexpr IntValue ConversionOffset = 405;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcConversionBasedUnitWithOffset_CLASS_H
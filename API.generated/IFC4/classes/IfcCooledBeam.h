@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCooledBeam_CLASS_H
+#define __RDF_LTD__IFC4_IfcCooledBeam_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCooledBeam
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCooledBeam : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCooledBeam
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCooledBeam(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 141);
+        }
+
+        /// <summary>
+        /// Instances of IfcCooledBeam in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCooledBeam> Extent(SdaiModel model) { return ExtentRange<IfcCooledBeam>(model, 141, false); }
+        static ExtentRange<IfcCooledBeam> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCooledBeam>(model, 141, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCooledBeam and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCooledBeam Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCooledBeam"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCooledBeam if the actual type of SdaiInstance is IfcCooledBeam or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCooledBeam CreateExactEntity(SdaiInstance instance) { return IfcCooledBeam(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCooledBeam or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCooledBeam(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCooledBeamTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(406); int v = getENUM(406, IfcCooledBeamTypeEnum_hash); if (v >= 0) return (IfcCooledBeamTypeEnum) v; else return Nullable<IfcCooledBeamTypeEnum>(); }
+        void put_PredefinedType(IfcCooledBeamTypeEnum value) { RDF_EXPRESS_PROBE(406); TextValue val = IfcCooledBeamTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(406), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 406;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCooledBeam_CLASS_H
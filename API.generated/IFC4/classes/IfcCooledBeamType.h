@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCooledBeamType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCooledBeamType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCooledBeamType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCooledBeamType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCooledBeamType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCooledBeamType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 142);
+        }
+
+        /// <summary>
+        /// Instances of IfcCooledBeamType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCooledBeamType> Extent(SdaiModel model) { return ExtentRange<IfcCooledBeamType>(model, 142, false); }
+        static ExtentRange<IfcCooledBeamType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCooledBeamType>(model, 142, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCooledBeamType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCooledBeamType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCooledBeamType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCooledBeamType if the actual type of SdaiInstance is IfcCooledBeamType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCooledBeamType CreateExactEntity(SdaiInstance instance) { return IfcCooledBeamType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCooledBeamType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCooledBeamType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCooledBeamTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(407); int v = getENUM(407, IfcCooledBeamTypeEnum_hash); if (v >= 0) return (IfcCooledBeamTypeEnum) v; else return Nullable<IfcCooledBeamTypeEnum>(); }
+        void put_PredefinedType(IfcCooledBeamTypeEnum value) { RDF_EXPRESS_PROBE(407); TextValue val = IfcCooledBeamTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(407), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 407;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCooledBeamType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCoolingTower_CLASS_H
+#define __RDF_LTD__IFC4_IfcCoolingTower_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCoolingTower
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCoolingTower : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCoolingTower
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCoolingTower(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 143);
+        }
+
+        /// <summary>
+        /// Instances of IfcCoolingTower in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCoolingTower> Extent(SdaiModel model) { return ExtentRange<IfcCoolingTower>(model, 143, false); }
+        static ExtentRange<IfcCoolingTower> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCoolingTower>(model, 143, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCoolingTower and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCoolingTower Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCoolingTower"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCoolingTower if the actual type of SdaiInstance is IfcCoolingTower or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCoolingTower CreateExactEntity(SdaiInstance instance) { return IfcCoolingTower(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCoolingTower or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCoolingTower(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCoolingTowerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(408); int v = getENUM(408, IfcCoolingTowerTypeEnum_hash); if (v >= 0) return (IfcCoolingTowerTypeEnum) v; else return Nullable<IfcCoolingTowerTypeEnum>(); }
+        void put_PredefinedType(IfcCoolingTowerTypeEnum value) { RDF_EXPRESS_PROBE(408); TextValue val = IfcCoolingTowerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(408), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 408;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCoolingTower_CLASS_H
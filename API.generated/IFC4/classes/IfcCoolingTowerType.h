@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCoolingTowerType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCoolingTowerType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCoolingTowerType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCoolingTowerType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCoolingTowerType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCoolingTowerType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 144);
+        }
+
+        /// <summary>
+        /// Instances of IfcCoolingTowerType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCoolingTowerType> Extent(SdaiModel model) { return ExtentRange<IfcCoolingTowerType>(model, 144, false); }
+        static ExtentRange<IfcCoolingTowerType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCoolingTowerType>(model, 144, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCoolingTowerType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCoolingTowerType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCoolingTowerType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCoolingTowerType if the actual type of SdaiInstance is IfcCoolingTowerType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCoolingTowerType CreateExactEntity(SdaiInstance instance) { return IfcCoolingTowerType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCoolingTowerType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCoolingTowerType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCoolingTowerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(409); int v = getENUM(409, IfcCoolingTowerTypeEnum_hash); if (v >= 0) return (IfcCoolingTowerTypeEnum) v; else return Nullable<IfcCoolingTowerTypeEnum>(); }
+        void put_PredefinedType(IfcCoolingTowerTypeEnum value) { RDF_EXPRESS_PROBE(409); TextValue val = IfcCoolingTowerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(409), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 409;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCoolingTowerType_CLASS_H
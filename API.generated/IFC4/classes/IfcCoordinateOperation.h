@@ -0,0 +1,63 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCoordinateOperation_CLASS_H
+#define __RDF_LTD__IFC4_IfcCoordinateOperation_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCoordinateOperation
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCoordinateOperation : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCoordinateOperation
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCoordinateOperation(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 145);
+        }
+
+        /// <summary>
+        /// Instances of IfcCoordinateOperation in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCoordinateOperation> Extent(SdaiModel model) { return ExtentRange<IfcCoordinateOperation>(model, 145, false); }
+        static ExtentRange<IfcCoordinateOperation> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCoordinateOperation>(model, 145, true); }
+
+        /// <summary>
+        /// Returns object of IfcCoordinateOperation if the actual type of SdaiInstance is IfcCoordinateOperation or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCoordinateOperation CreateExactEntity(SdaiInstance instance) { return IfcCoordinateOperation(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCoordinateOperation or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCoordinateOperation(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCoordinateReferenceSystemSelect_get get_SourceCRS() { return IfcCoordinateReferenceSystemSelect_get(m_instance, 410); }
+        IfcCoordinateReferenceSystemSelect_put put_SourceCRS() { return IfcCoordinateReferenceSystemSelect_put(m_instance, 410); }
+
+        IfcCoordinateReferenceSystem get_TargetCRS();
+        void put_TargetCRS(IfcCoordinateReferenceSystem inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue SourceCRS = 410;
+            static constexpr IntValue TargetCRS = 411;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCoordinateOperation_CLASS_H
@@ -0,0 +1,103 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCoordinateReferenceSystem_CLASS_H
+#define __RDF_LTD__IFC4_IfcCoordinateReferenceSystem_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCoordinateReferenceSystem
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCoordinateReferenceSystem : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCoordinateReferenceSystem
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCoordinateReferenceSystem(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 146);
+        }
+
+        /// <summary>
+        /// Instances of IfcCoordinateReferenceSystem in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCoordinateReferenceSystem> Extent(SdaiModel model) { return ExtentRange<IfcCoordinateReferenceSystem>(model, 146, false); }
+        static ExtentRange<IfcCoordinateReferenceSystem> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCoordinateReferenceSystem>(model, 146, true); }
+
+        /// <summary>
+        /// Returns object of IfcCoordinateReferenceSystem if the actual type of SdaiInstance is IfcCoordinateReferenceSystem or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCoordinateReferenceSystem CreateExactEntity(SdaiInstance instance) { return IfcCoordinateReferenceSystem(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCoordinateReferenceSystem or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCoordinateReferenceSystem(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(412); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(412), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(412); sdaiPutAttr(m_instance, getAttrDefinition(412), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(412); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(413); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(413), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(413); sdaiPutAttr(m_instance, getAttrDefinition(413), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(413); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcIdentifier get_GeodeticDatum() { RDF_EXPRESS_PROBE(414); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(414), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_GeodeticDatum_view() { return TextView(get_GeodeticDatum()); }
+#endif
+        void put_GeodeticDatum(IfcIdentifier value) { RDF_EXPRESS_PROBE(414); sdaiPutAttr(m_instance, getAttrDefinition(414), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_GeodeticDatum_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(414); return buffer.GetAttr(m_instance, "GeodeticDatum"); }
+        const char* get_GeodeticDatum_utf8() { return get_GeodeticDatum_utf8(ThreadUtf8Buffer()); }
+
+        IfcIdentifier get_VerticalDatum() { RDF_EXPRESS_PROBE(415); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(415), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_VerticalDatum_view() { return TextView(get_VerticalDatum()); }
+#endif
+        void put_VerticalDatum(IfcIdentifier value) { RDF_EXPRESS_PROBE(415); sdaiPutAttr(m_instance, getAttrDefinition(415), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_VerticalDatum_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(415); return buffer.GetAttr(m_instance, "VerticalDatum"); }
+        const char* get_VerticalDatum_utf8() { return get_VerticalDatum_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcCoordinateOperation or list of convertible elements
+        template <typename TList> void get_HasCoordinateOperation(TList& lst) { RDF_EXPRESS_PROBE(416); SetOfIfcCoordinateOperationSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(416)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Name = 412;
+            static constexpr IntValue Description = 413;
+            static constexpr IntValue GeodeticDatum = 414;
+            static constexpr IntValue VerticalDatum = 415;
+            static constexpr IntValue HasCoordinateOperation = 416;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCoordinateReferenceSystem_CLASS_H
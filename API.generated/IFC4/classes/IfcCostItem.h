@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCostItem_CLASS_H
+#define __RDF_LTD__IFC4_IfcCostItem_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcControl.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCostItem
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCostItem : public RDF_EXPRESS_VIRTUAL IfcControl
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCostItem
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCostItem(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 147);
+        }
+
+        /// <summary>
+        /// Instances of IfcCostItem in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCostItem> Extent(SdaiModel model) { return ExtentRange<IfcCostItem>(model, 147, false); }
+        static ExtentRange<IfcCostItem> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCostItem>(model, 147, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCostItem and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCostItem Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCostItem"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCostItem if the actual type of SdaiInstance is IfcCostItem or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCostItem CreateExactEntity(SdaiInstance instance) { return IfcCostItem(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCostItem or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCostItem(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCostItemTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(417); int v = getENUM(417, IfcCostItemTypeEnum_hash); if (v >= 0) return (IfcCostItemTypeEnum) v; else return Nullable<IfcCostItemTypeEnum>(); }
+        void put_PredefinedType(IfcCostItemTypeEnum value) { RDF_EXPRESS_PROBE(417); TextValue val = IfcCostItemTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(417), sdaiENUM, val); }
+
+        //TList may be ListOfIfcCostValue or list of convertible elements
+        template <typename TList> void get_CostValues(TList& lst) { RDF_EXPRESS_PROBE(418); ListOfIfcCostValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(418)); }
+
+        //TList may be ListOfIfcCostValue or list of convertible elements
+        template <typename TList> void put_CostValues(TList& lst) { RDF_EXPRESS_PROBE(418); ListOfIfcCostValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(418)); }
+
+        //TArrayElem[] may be IfcCostValue[] or array of convertible elements
+        template <typename TArrayElem> void put_CostValues(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(418); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcCostValueSerializer<ListOfIfcCostValue> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(418)); }
+
+        //TList may be ListOfIfcPhysicalQuantity or list of convertible elements
+        template <typename TList> void get_CostQuantities(TList& lst) { RDF_EXPRESS_PROBE(419); ListOfIfcPhysicalQuantitySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(419)); }
+
+        //TList may be ListOfIfcPhysicalQuantity or list of convertible elements
+        template <typename TList> void put_CostQuantities(TList& lst) { RDF_EXPRESS_PROBE(419); ListOfIfcPhysicalQuantitySerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(419)); }
+
+        //TArrayElem[] may be IfcPhysicalQuantity[] or array of convertible elements
+        template <typename TArrayElem> void put_CostQuantities(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(419); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcPhysicalQuantitySerializer<ListOfIfcPhysicalQuantity> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(419)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcControl::attr
+        {
+            static constexpr IntValue PredefinedType = 417;
+            static constexpr IntValue CostValues = 418;
+            static constexpr IntValue CostQuantities = 419;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCostItem_CLASS_H
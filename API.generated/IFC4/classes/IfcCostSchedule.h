@@ -0,0 +1,97 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCostSchedule_CLASS_H
+#define __RDF_LTD__IFC4_IfcCostSchedule_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcControl.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCostSchedule
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCostSchedule : public RDF_EXPRESS_VIRTUAL IfcControl
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCostSchedule
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCostSchedule(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 148);
+        }
+
+        /// <summary>
+        /// Instances of IfcCostSchedule in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCostSchedule> Extent(SdaiModel model) { return ExtentRange<IfcCostSchedule>(model, 148, false); }
+        static ExtentRange<IfcCostSchedule> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCostSchedule>(model, 148, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCostSchedule and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCostSchedule Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCostSchedule"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCostSchedule if the actual type of SdaiInstance is IfcCostSchedule or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCostSchedule CreateExactEntity(SdaiInstance instance) { return IfcCostSchedule(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCostSchedule or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCostSchedule(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCostScheduleTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(420); int v = getENUM(420, IfcCostScheduleTypeEnum_hash); if (v >= 0) return (IfcCostScheduleTypeEnum) v; else return Nullable<IfcCostScheduleTypeEnum>(); }
+        void put_PredefinedType(IfcCostScheduleTypeEnum value) { RDF_EXPRESS_PROBE(420); TextValue val = IfcCostScheduleTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(420), sdaiENUM, val); }
+
+        IfcLabel get_Status() { RDF_EXPRESS_PROBE(421); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(421), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Status_view() { return TextView(get_Status()); }
+#endif
+        void put_Status(IfcLabel value) { RDF_EXPRESS_PROBE(421); sdaiPutAttr(m_instance, getAttrDefinition(421), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Status_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(421); return buffer.GetAttr(m_instance, "Status"); }
+        const char* get_Status_utf8() { return get_Status_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_SubmittedOn() { RDF_EXPRESS_PROBE(422); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(422), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_SubmittedOn_view() { return TextView(get_SubmittedOn()); }
+#endif
+        void put_SubmittedOn(IfcDateTime value) { RDF_EXPRESS_PROBE(422); sdaiPutAttr(m_instance, getAttrDefinition(422), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_SubmittedOn_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(422); return buffer.GetAttr(m_instance, "SubmittedOn"); }
+        const char* get_SubmittedOn_utf8() { return get_SubmittedOn_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_UpdateDate() { RDF_EXPRESS_PROBE(423); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(423), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UpdateDate_view() { return TextView(get_UpdateDate()); }
+#endif
+        void put_UpdateDate(IfcDateTime value) { RDF_EXPRESS_PROBE(423); sdaiPutAttr(m_instance, getAttrDefinition(423), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UpdateDate_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(423); return buffer.GetAttr(m_instance, "UpdateDate"); }
+        const char* get_UpdateDate_utf8() { return get_UpdateDate_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcControl::attr
+        {
+            static constexpr IntValue PredefinedType = 420;
+            static constexpr IntValue Status = 421;
+            static constexpr IntValue SubmittedOn = 422;
+            static constexpr IntValue UpdateDate = 423;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCostSchedule_CLASS_H
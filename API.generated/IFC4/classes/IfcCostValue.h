@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCostValue_CLASS_H
+#define __RDF_LTD__IFC4_IfcCostValue_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcAppliedValue.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCostValue
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCostValue : public RDF_EXPRESS_VIRTUAL IfcAppliedValue
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCostValue
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCostValue(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 149);
+        }
+
+        /// <summary>
+        /// Instances of IfcCostValue in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCostValue> Extent(SdaiModel model) { return ExtentRange<IfcCostValue>(model, 149, false); }
+        static ExtentRange<IfcCostValue> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCostValue>(model, 149, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCostValue and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCostValue Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCostValue"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCostValue if the actual type of SdaiInstance is IfcCostValue or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCostValue CreateExactEntity(SdaiInstance instance) { return IfcCostValue(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCostValue or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCostValue(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcAppliedValue::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCostValue_CLASS_H
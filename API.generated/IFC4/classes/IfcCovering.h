@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCovering_CLASS_H
+#define __RDF_LTD__IFC4_IfcCovering_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCovering
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCovering : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCovering
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCovering(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 150);
+        }
+
+        /// <summary>
+        /// Instances of IfcCovering in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCovering> Extent(SdaiModel model) { return ExtentRange<IfcCovering>(model, 150, false); }
+        static ExtentRange<IfcCovering> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCovering>(model, 150, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCovering and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCovering Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCovering"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCovering if the actual type of SdaiInstance is IfcCovering or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCovering CreateExactEntity(SdaiInstance instance) { return IfcCovering(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCovering or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCovering(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCoveringTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(424); int v = getENUM(424, IfcCoveringTypeEnum_hash); if (v >= 0) return (IfcCoveringTypeEnum) v; else return Nullable<IfcCoveringTypeEnum>(); }
+        void put_PredefinedType(IfcCoveringTypeEnum value) { RDF_EXPRESS_PROBE(424); TextValue val = IfcCoveringTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(424), sdaiENUM, val); }
+
+        //TList may be SetOfIfcRelCoversSpaces or list of convertible elements
+        template <typename TList> void get_CoversSpaces(TList& lst) { RDF_EXPRESS_PROBE(425); SetOfIfcRelCoversSpacesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(425)); }
+
+        //TList may be SetOfIfcRelCoversBldgElements or list of convertible elements
+        template <typename TList> void get_CoversElements(TList& lst) { RDF_EXPRESS_PROBE(426); SetOfIfcRelCoversBldgElementsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(426)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 424;
+            static constexpr IntValue CoversSpaces = 425;
+            static constexpr IntValue CoversElements = 426;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCovering_CLASS_H
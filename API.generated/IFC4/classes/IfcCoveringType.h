@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCoveringType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCoveringType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCoveringType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCoveringType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCoveringType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCoveringType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 151);
+        }
+
+        /// <summary>
+        /// Instances of IfcCoveringType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCoveringType> Extent(SdaiModel model) { return ExtentRange<IfcCoveringType>(model, 151, false); }
+        static ExtentRange<IfcCoveringType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCoveringType>(model, 151, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCoveringType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCoveringType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCoveringType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCoveringType if the actual type of SdaiInstance is IfcCoveringType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCoveringType CreateExactEntity(SdaiInstance instance) { return IfcCoveringType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCoveringType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCoveringType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCoveringTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(427); int v = getENUM(427, IfcCoveringTypeEnum_hash); if (v >= 0) return (IfcCoveringTypeEnum) v; else return Nullable<IfcCoveringTypeEnum>(); }
+        void put_PredefinedType(IfcCoveringTypeEnum value) { RDF_EXPRESS_PROBE(427); TextValue val = IfcCoveringTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(427), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 427;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCoveringType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCrewResource_CLASS_H
+#define __RDF_LTD__IFC4_IfcCrewResource_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstructionResource.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCrewResource
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCrewResource : public RDF_EXPRESS_VIRTUAL IfcConstructionResource
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCrewResource
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCrewResource(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 152);
+        }
+
+        /// <summary>
+        /// Instances of IfcCrewResource in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCrewResource> Extent(SdaiModel model) { return ExtentRange<IfcCrewResource>(model, 152, false); }
+        static ExtentRange<IfcCrewResource> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCrewResource>(model, 152, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCrewResource and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCrewResource Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCrewResource"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCrewResource if the actual type of SdaiInstance is IfcCrewResource or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCrewResource CreateExactEntity(SdaiInstance instance) { return IfcCrewResource(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCrewResource or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCrewResource(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCrewResourceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(428); int v = getENUM(428, IfcCrewResourceTypeEnum_hash); if (v >= 0) return (IfcCrewResourceTypeEnum) v; else return Nullable<IfcCrewResourceTypeEnum>(); }
+        void put_PredefinedType(IfcCrewResourceTypeEnum value) { RDF_EXPRESS_PROBE(428); TextValue val = IfcCrewResourceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(428), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstructionResource::attr
+        {
+            static constexpr IntValue PredefinedType = 428;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCrewResource_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCrewResourceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCrewResourceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstructionResourceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCrewResourceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCrewResourceType : public RDF_EXPRESS_VIRTUAL IfcConstructionResourceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCrewResourceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCrewResourceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 153);
+        }
+
+        /// <summary>
+        /// Instances of IfcCrewResourceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCrewResourceType> Extent(SdaiModel model) { return ExtentRange<IfcCrewResourceType>(model, 153, false); }
+        static ExtentRange<IfcCrewResourceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCrewResourceType>(model, 153, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCrewResourceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCrewResourceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCrewResourceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCrewResourceType if the actual type of SdaiInstance is IfcCrewResourceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCrewResourceType CreateExactEntity(SdaiInstance instance) { return IfcCrewResourceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCrewResourceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCrewResourceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCrewResourceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(429); int v = getENUM(429, IfcCrewResourceTypeEnum_hash); if (v >= 0) return (IfcCrewResourceTypeEnum) v; else return Nullable<IfcCrewResourceTypeEnum>(); }
+        void put_PredefinedType(IfcCrewResourceTypeEnum value) { RDF_EXPRESS_PROBE(429); TextValue val = IfcCrewResourceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(429), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstructionResourceType::attr
+        {
+            static constexpr IntValue PredefinedType = 429;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCrewResourceType_CLASS_H
@@ -0,0 +1,63 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCsgPrimitive3D_CLASS_H
+#define __RDF_LTD__IFC4_IfcCsgPrimitive3D_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCsgPrimitive3D
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCsgPrimitive3D : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCsgPrimitive3D
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCsgPrimitive3D(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 154);
+        }
+
+        /// <summary>
+        /// Instances of IfcCsgPrimitive3D in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCsgPrimitive3D> Extent(SdaiModel model) { return ExtentRange<IfcCsgPrimitive3D>(model, 154, false); }
+        static ExtentRange<IfcCsgPrimitive3D> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCsgPrimitive3D>(model, 154, true); }
+
+        /// <summary>
+        /// Returns object of IfcCsgPrimitive3D if the actual type of SdaiInstance is IfcCsgPrimitive3D or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCsgPrimitive3D CreateExactEntity(SdaiInstance instance) { return IfcCsgPrimitive3D(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCsgPrimitive3D or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCsgPrimitive3D(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcAxis2Placement3D get_Position();
+        void put_Position(IfcAxis2Placement3D inst);
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(166); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(166), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue Position = 165;
+            static constexpr IntValue Dim = 166;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCsgPrimitive3D_CLASS_H
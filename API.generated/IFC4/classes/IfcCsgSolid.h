@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCsgSolid_CLASS_H
+#define __RDF_LTD__IFC4_IfcCsgSolid_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSolidModel.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCsgSolid
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCsgSolid : public RDF_EXPRESS_VIRTUAL IfcSolidModel
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCsgSolid
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCsgSolid(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 155);
+        }
+
+        /// <summary>
+        /// Instances of IfcCsgSolid in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCsgSolid> Extent(SdaiModel model) { return ExtentRange<IfcCsgSolid>(model, 155, false); }
+        static ExtentRange<IfcCsgSolid> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCsgSolid>(model, 155, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCsgSolid and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCsgSolid Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCsgSolid"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCsgSolid if the actual type of SdaiInstance is IfcCsgSolid or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCsgSolid CreateExactEntity(SdaiInstance instance) { return IfcCsgSolid(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCsgSolid or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCsgSolid(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCsgSelect_get get_TreeRootExpression() { return IfcCsgSelect_get(m_instance, 430); }
+        IfcCsgSelect_put put_TreeRootExpression() { return IfcCsgSelect_put(m_instance, 430); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSolidModel::attr
+        {
+            static constexpr IntValue TreeRootExpression = 430;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCsgSolid_CLASS_H
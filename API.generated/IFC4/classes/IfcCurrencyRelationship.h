@@ -0,0 +1,87 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurrencyRelationship_CLASS_H
+#define __RDF_LTD__IFC4_IfcCurrencyRelationship_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcResourceLevelRelationship.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCurrencyRelationship
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCurrencyRelationship : public RDF_EXPRESS_VIRTUAL IfcResourceLevelRelationship
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCurrencyRelationship
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCurrencyRelationship(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 157);
+        }
+
+        /// <summary>
+        /// Instances of IfcCurrencyRelationship in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCurrencyRelationship> Extent(SdaiModel model) { return ExtentRange<IfcCurrencyRelationship>(model, 157, false); }
+        static ExtentRange<IfcCurrencyRelationship> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCurrencyRelationship>(model, 157, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCurrencyRelationship and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCurrencyRelationship Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCurrencyRelationship"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCurrencyRelationship if the actual type of SdaiInstance is IfcCurrencyRelationship or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCurrencyRelationship CreateExactEntity(SdaiInstance instance) { return IfcCurrencyRelationship(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCurrencyRelationship or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCurrencyRelationship(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcMonetaryUnit get_RelatingMonetaryUnit();
+        void put_RelatingMonetaryUnit(IfcMonetaryUnit inst);
+
+        IfcMonetaryUnit get_RelatedMonetaryUnit();
+        void put_RelatedMonetaryUnit(IfcMonetaryUnit inst);
+
+        Nullable<IfcPositiveRatioMeasure> get_ExchangeRate() { RDF_EXPRESS_PROBE(438); IfcPositiveRatioMeasure val = (IfcPositiveRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(438), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveRatioMeasure>(); }
+        void put_ExchangeRate(IfcPositiveRatioMeasure value) { RDF_EXPRESS_PROBE(438); sdaiPutAttr(m_instance, getAttrDefinition(438), sdaiREAL, &value); }
+
+        IfcDateTime get_RateDateTime() { RDF_EXPRESS_PROBE(439); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(439), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_RateDateTime_view() { return TextView(get_RateDateTime()); }
+#endif
+        void put_RateDateTime(IfcDateTime value) { RDF_EXPRESS_PROBE(439); sdaiPutAttr(m_instance, getAttrDefinition(439), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_RateDateTime_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(439); return buffer.GetAttr(m_instance, "RateDateTime"); }
+        const char* get_RateDateTime_utf8() { return get_RateDateTime_utf8(ThreadUtf8Buffer()); }
+
+        IfcLibraryInformation get_RateSource();
+        void put_RateSource(IfcLibraryInformation inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcResourceLevelRelationship::attr
+        {
+            static constexpr IntValue RelatingMonetaryUnit = 436;
+            static constexpr IntValue RelatedMonetaryUnit = 437;
+            static constexpr IntValue ExchangeRate = 438;
+            static constexpr IntValue RateDateTime = 439;
+            static constexpr IntValue RateSource = 440;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurrencyRelationship_CLASS_H
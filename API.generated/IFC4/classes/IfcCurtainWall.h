@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurtainWall_CLASS_H
+#define __RDF_LTD__IFC4_IfcCurtainWall_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCurtainWall
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCurtainWall : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCurtainWall
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCurtainWall(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 158);
+        }
+
+        /// <summary>
+        /// Instances of IfcCurtainWall in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCurtainWall> Extent(SdaiModel model) { return ExtentRange<IfcCurtainWall>(model, 158, false); }
+        static ExtentRange<IfcCurtainWall> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCurtainWall>(model, 158, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCurtainWall and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCurtainWall Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCurtainWall"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCurtainWall if the actual type of SdaiInstance is IfcCurtainWall or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCurtainWall CreateExactEntity(SdaiInstance instance) { return IfcCurtainWall(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCurtainWall or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCurtainWall(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCurtainWallTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(441); int v = getENUM(441, IfcCurtainWallTypeEnum_hash); if (v >= 0) return (IfcCurtainWallTypeEnum) v; else return Nullable<IfcCurtainWallTypeEnum>(); }
+        void put_PredefinedType(IfcCurtainWallTypeEnum value) { RDF_EXPRESS_PROBE(441); TextValue val = IfcCurtainWallTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(441), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 441;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurtainWall_CLASS_H
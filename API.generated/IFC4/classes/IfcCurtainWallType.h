@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurtainWallType_CLASS_H
+#define __RDF_LTD__IFC4_IfcCurtainWallType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCurtainWallType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCurtainWallType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCurtainWallType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCurtainWallType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 159);
+        }
+
+        /// <summary>
+        /// Instances of IfcCurtainWallType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCurtainWallType> Extent(SdaiModel model) { return ExtentRange<IfcCurtainWallType>(model, 159, false); }
+        static ExtentRange<IfcCurtainWallType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCurtainWallType>(model, 159, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCurtainWallType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCurtainWallType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCurtainWallType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCurtainWallType if the actual type of SdaiInstance is IfcCurtainWallType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCurtainWallType CreateExactEntity(SdaiInstance instance) { return IfcCurtainWallType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCurtainWallType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCurtainWallType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCurtainWallTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(442); int v = getENUM(442, IfcCurtainWallTypeEnum_hash); if (v >= 0) return (IfcCurtainWallTypeEnum) v; else return Nullable<IfcCurtainWallTypeEnum>(); }
+        void put_PredefinedType(IfcCurtainWallTypeEnum value) { RDF_EXPRESS_PROBE(442); TextValue val = IfcCurtainWallTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(442), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 442;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurtainWallType_CLASS_H
@@ -0,0 +1,59 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurve_CLASS_H
+#define __RDF_LTD__IFC4_IfcCurve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCurve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCurve : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCurve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCurve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 160);
+        }
+
+        /// <summary>
+        /// Instances of IfcCurve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCurve> Extent(SdaiModel model) { return ExtentRange<IfcCurve>(model, 160, false); }
+        static ExtentRange<IfcCurve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCurve>(model, 160, true); }
+
+        /// <summary>
+        /// Returns object of IfcCurve if the actual type of SdaiInstance is IfcCurve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCurve CreateExactEntity(SdaiInstance instance) { return IfcCurve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCurve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCurve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(177); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(177), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue Dim = 177;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurve_CLASS_H
@@ -0,0 +1,78 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveBoundedPlane_CLASS_H
+#define __RDF_LTD__IFC4_IfcCurveBoundedPlane_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundedSurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCurveBoundedPlane
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCurveBoundedPlane : public RDF_EXPRESS_VIRTUAL IfcBoundedSurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCurveBoundedPlane
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCurveBoundedPlane(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 161);
+        }
+
+        /// <summary>
+        /// Instances of IfcCurveBoundedPlane in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCurveBoundedPlane> Extent(SdaiModel model) { return ExtentRange<IfcCurveBoundedPlane>(model, 161, false); }
+        static ExtentRange<IfcCurveBoundedPlane> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCurveBoundedPlane>(model, 161, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCurveBoundedPlane and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCurveBoundedPlane Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCurveBoundedPlane"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCurveBoundedPlane if the actual type of SdaiInstance is IfcCurveBoundedPlane or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCurveBoundedPlane CreateExactEntity(SdaiInstance instance) { return IfcCurveBoundedPlane(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCurveBoundedPlane or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCurveBoundedPlane(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcPlane get_BasisSurface();
+        void put_BasisSurface(IfcPlane inst);
+
+        IfcCurve get_OuterBoundary();
+        void put_OuterBoundary(IfcCurve inst);
+
+        //TList may be SetOfIfcCurve or list of convertible elements
+        template <typename TList> void get_InnerBoundaries(TList& lst) { RDF_EXPRESS_PROBE(445); SetOfIfcCurveSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(445)); }
+
+        //TList may be SetOfIfcCurve or list of convertible elements
+        template <typename TList> void put_InnerBoundaries(TList& lst) { RDF_EXPRESS_PROBE(445); SetOfIfcCurveSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(445)); }
+
+        //TArrayElem[] may be IfcCurve[] or array of convertible elements
+        template <typename TArrayElem> void put_InnerBoundaries(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(445); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcCurveSerializer<SetOfIfcCurve> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(445)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundedSurface::attr
+        {
+            static constexpr IntValue BasisSurface = 443;
+            static constexpr IntValue OuterBoundary = 444;
+            static constexpr IntValue InnerBoundaries = 445;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveBoundedPlane_CLASS_H
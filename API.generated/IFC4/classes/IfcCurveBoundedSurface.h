@@ -0,0 +1,78 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveBoundedSurface_CLASS_H
+#define __RDF_LTD__IFC4_IfcCurveBoundedSurface_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundedSurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCurveBoundedSurface
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCurveBoundedSurface : public RDF_EXPRESS_VIRTUAL IfcBoundedSurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCurveBoundedSurface
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCurveBoundedSurface(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 162);
+        }
+
+        /// <summary>
+        /// Instances of IfcCurveBoundedSurface in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCurveBoundedSurface> Extent(SdaiModel model) { return ExtentRange<IfcCurveBoundedSurface>(model, 162, false); }
+        static ExtentRange<IfcCurveBoundedSurface> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCurveBoundedSurface>(model, 162, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCurveBoundedSurface and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCurveBoundedSurface Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCurveBoundedSurface"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCurveBoundedSurface if the actual type of SdaiInstance is IfcCurveBoundedSurface or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCurveBoundedSurface CreateExactEntity(SdaiInstance instance) { return IfcCurveBoundedSurface(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCurveBoundedSurface or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCurveBoundedSurface(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcSurface get_BasisSurface();
+        void put_BasisSurface(IfcSurface inst);
+
+        //TList may be SetOfIfcBoundaryCurve or list of convertible elements
+        template <typename TList> void get_Boundaries(TList& lst) { RDF_EXPRESS_PROBE(447); SetOfIfcBoundaryCurveSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(447)); }
+
+        //TList may be SetOfIfcBoundaryCurve or list of convertible elements
+        template <typename TList> void put_Boundaries(TList& lst) { RDF_EXPRESS_PROBE(447); SetOfIfcBoundaryCurveSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(447)); }
+
+        //TArrayElem[] may be IfcBoundaryCurve[] or array of convertible elements
+        template <typename TArrayElem> void put_Boundaries(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(447); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcBoundaryCurveSerializer<SetOfIfcBoundaryCurve> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(447)); }
+
+        Nullable<IfcBoolean> get_ImplicitOuter() { RDF_EXPRESS_PROBE(448); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(448), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_ImplicitOuter(IfcBoolean value) { RDF_EXPRESS_PROBE(448); sdaiPutAttr(m_instance, getAttrDefinition(448), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundedSurface::attr
+        {
+            static constexpr IntValue BasisSurface = 446;
+            static constexpr IntValue Boundaries = 447;
+            static constexpr IntValue ImplicitOuter = 448;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveBoundedSurface_CLASS_H
@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveStyle_CLASS_H
+#define __RDF_LTD__IFC4_IfcCurveStyle_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationStyle.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCurveStyle
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCurveStyle : public RDF_EXPRESS_VIRTUAL IfcPresentationStyle
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCurveStyle
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCurveStyle(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 163);
+        }
+
+        /// <summary>
+        /// Instances of IfcCurveStyle in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCurveStyle> Extent(SdaiModel model) { return ExtentRange<IfcCurveStyle>(model, 163, false); }
+        static ExtentRange<IfcCurveStyle> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCurveStyle>(model, 163, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCurveStyle and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCurveStyle Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCurveStyle"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCurveStyle if the actual type of SdaiInstance is IfcCurveStyle or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCurveStyle CreateExactEntity(SdaiInstance instance) { return IfcCurveStyle(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCurveStyle or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCurveStyle(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurveFontOrScaledCurveFontSelect_get get_CurveFont() { return IfcCurveFontOrScaledCurveFontSelect_get(m_instance, 450); }
+        IfcCurveFontOrScaledCurveFontSelect_put put_CurveFont() { return IfcCurveFontOrScaledCurveFontSelect_put(m_instance, 450); }
+
+        IfcSizeSelect_get get_CurveWidth() { return IfcSizeSelect_get(m_instance, 451); }
+        IfcSizeSelect_put put_CurveWidth() { return IfcSizeSelect_put(m_instance, 451); }
+
+        IfcColour_get get_CurveColour() { return IfcColour_get(m_instance, 452); }
+        IfcColour_put put_CurveColour() { return IfcColour_put(m_instance, 452); }
+
+        Nullable<IfcBoolean> get_ModelOrDraughting() { RDF_EXPRESS_PROBE(453); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(453), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_ModelOrDraughting(IfcBoolean value) { RDF_EXPRESS_PROBE(453); sdaiPutAttr(m_instance, getAttrDefinition(453), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationStyle::attr
+        {
+            static constexpr IntValue CurveFont = 450;
+            static constexpr IntValue CurveWidth = 451;
+            static constexpr IntValue CurveColour = 452;
+            static constexpr IntValue ModelOrDraughting = 453;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveStyle_CLASS_H
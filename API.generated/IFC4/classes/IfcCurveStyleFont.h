@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveStyleFont_CLASS_H
+#define __RDF_LTD__IFC4_IfcCurveStyleFont_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCurveStyleFont
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCurveStyleFont : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCurveStyleFont
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCurveStyleFont(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 164);
+        }
+
+        /// <summary>
+        /// Instances of IfcCurveStyleFont in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCurveStyleFont> Extent(SdaiModel model) { return ExtentRange<IfcCurveStyleFont>(model, 164, false); }
+        static ExtentRange<IfcCurveStyleFont> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCurveStyleFont>(model, 164, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCurveStyleFont and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCurveStyleFont Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCurveStyleFont"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCurveStyleFont if the actual type of SdaiInstance is IfcCurveStyleFont or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCurveStyleFont CreateExactEntity(SdaiInstance instance) { return IfcCurveStyleFont(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCurveStyleFont or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCurveStyleFont(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(454); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(454), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(454); sdaiPutAttr(m_instance, getAttrDefinition(454), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(454); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcCurveStyleFontPattern or list of convertible elements
+        template <typename TList> void get_PatternList(TList& lst) { RDF_EXPRESS_PROBE(455); ListOfIfcCurveStyleFontPatternSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(455)); }
+
+        //TList may be ListOfIfcCurveStyleFontPattern or list of convertible elements
+        template <typename TList> void put_PatternList(TList& lst) { RDF_EXPRESS_PROBE(455); ListOfIfcCurveStyleFontPatternSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(455)); }
+
+        //TArrayElem[] may be IfcCurveStyleFontPattern[] or array of convertible elements
+        template <typename TArrayElem> void put_PatternList(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(455); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcCurveStyleFontPatternSerializer<ListOfIfcCurveStyleFontPattern> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(455)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue Name = 454;
+            static constexpr IntValue PatternList = 455;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveStyleFont_CLASS_H
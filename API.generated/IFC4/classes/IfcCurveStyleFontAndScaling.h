@@ -0,0 +1,79 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveStyleFontAndScaling_CLASS_H
+#define __RDF_LTD__IFC4_IfcCurveStyleFontAndScaling_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCurveStyleFontAndScaling
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCurveStyleFontAndScaling : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCurveStyleFontAndScaling
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCurveStyleFontAndScaling(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 165);
+        }
+
+        /// <summary>
+        /// Instances of IfcCurveStyleFontAndScaling in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCurveStyleFontAndScaling> Extent(SdaiModel model) { return ExtentRange<IfcCurveStyleFontAndScaling>(model, 165, false); }
+        static ExtentRange<IfcCurveStyleFontAndScaling> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCurveStyleFontAndScaling>(model, 165, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCurveStyleFontAndScaling and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCurveStyleFontAndScaling Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCurveStyleFontAndScaling"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCurveStyleFontAndScaling if the actual type of SdaiInstance is IfcCurveStyleFontAndScaling or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCurveStyleFontAndScaling CreateExactEntity(SdaiInstance instance) { return IfcCurveStyleFontAndScaling(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCurveStyleFontAndScaling or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCurveStyleFontAndScaling(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(456); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(456), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(456); sdaiPutAttr(m_instance, getAttrDefinition(456), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(456); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcCurveStyleFontSelect_get get_CurveFont() { return IfcCurveStyleFontSelect_get(m_instance, 457); }
+        IfcCurveStyleFontSelect_put put_CurveFont() { return IfcCurveStyleFontSelect_put(m_instance, 457); }
+
+        Nullable<IfcPositiveRatioMeasure> get_CurveFontScaling() { RDF_EXPRESS_PROBE(458); IfcPositiveRatioMeasure val = (IfcPositiveRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(458), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveRatioMeasure>(); }
+        void put_CurveFontScaling(IfcPositiveRatioMeasure value) { RDF_EXPRESS_PROBE(458); sdaiPutAttr(m_instance, getAttrDefinition(458), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue Name = 456;
+            static constexpr IntValue CurveFont = 457;
+            static constexpr IntValue CurveFontScaling = 458;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveStyleFontAndScaling_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveStyleFontPattern_CLASS_H
+#define __RDF_LTD__IFC4_IfcCurveStyleFontPattern_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCurveStyleFontPattern
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCurveStyleFontPattern : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCurveStyleFontPattern
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCurveStyleFontPattern(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 166);
+        }
+
+        /// <summary>
+        /// Instances of IfcCurveStyleFontPattern in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCurveStyleFontPattern> Extent(SdaiModel model) { return ExtentRange<IfcCurveStyleFontPattern>(model, 166, false); }
+        static ExtentRange<IfcCurveStyleFontPattern> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCurveStyleFontPattern>(model, 166, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCurveStyleFontPattern and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCurveStyleFontPattern Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCurveStyleFontPattern"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCurveStyleFontPattern if the actual type of SdaiInstance is IfcCurveStyleFontPattern or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCurveStyleFontPattern CreateExactEntity(SdaiInstance instance) { return IfcCurveStyleFontPattern(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCurveStyleFontPattern or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCurveStyleFontPattern(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLengthMeasure> get_VisibleSegmentLength() { RDF_EXPRESS_PROBE(459); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(459), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_VisibleSegmentLength(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(459); sdaiPutAttr(m_instance, getAttrDefinition(459), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_InvisibleSegmentLength() { RDF_EXPRESS_PROBE(460); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(460), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_InvisibleSegmentLength(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(460); sdaiPutAttr(m_instance, getAttrDefinition(460), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue VisibleSegmentLength = 459;
+            static constexpr IntValue InvisibleSegmentLength = 460;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveStyleFontPattern_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCylindricalSurface_CLASS_H
+#define __RDF_LTD__IFC4_IfcCylindricalSurface_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementarySurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcCylindricalSurface
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcCylindricalSurface : public RDF_EXPRESS_VIRTUAL IfcElementarySurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcCylindricalSurface
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcCylindricalSurface(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 167);
+        }
+
+        /// <summary>
+        /// Instances of IfcCylindricalSurface in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcCylindricalSurface> Extent(SdaiModel model) { return ExtentRange<IfcCylindricalSurface>(model, 167, false); }
+        static ExtentRange<IfcCylindricalSurface> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcCylindricalSurface>(model, 167, true); }
+
+        /// <summary>
+        /// Create new instance of IfcCylindricalSurface and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcCylindricalSurface Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcCylindricalSurface"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcCylindricalSurface if the actual type of SdaiInstance is IfcCylindricalSurface or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcCylindricalSurface CreateExactEntity(SdaiInstance instance) { return IfcCylindricalSurface(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcCylindricalSurface or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcCylindricalSurface(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Radius() { RDF_EXPRESS_PROBE(462); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(462), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Radius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(462); sdaiPutAttr(m_instance, getAttrDefinition(462), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementarySurface::attr
+        {
+            static constexpr IntValue Radius = 462;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcCylindricalSurface_CLASS_H
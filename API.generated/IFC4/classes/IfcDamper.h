@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDamper_CLASS_H
+#define __RDF_LTD__IFC4_IfcDamper_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDamper
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDamper : public RDF_EXPRESS_VIRTUAL IfcFlowController
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDamper
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDamper(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 168);
+        }
+
+        /// <summary>
+        /// Instances of IfcDamper in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDamper> Extent(SdaiModel model) { return ExtentRange<IfcDamper>(model, 168, false); }
+        static ExtentRange<IfcDamper> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDamper>(model, 168, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDamper and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDamper Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDamper"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDamper if the actual type of SdaiInstance is IfcDamper or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDamper CreateExactEntity(SdaiInstance instance) { return IfcDamper(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDamper or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDamper(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDamperTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(463); int v = getENUM(463, IfcDamperTypeEnum_hash); if (v >= 0) return (IfcDamperTypeEnum) v; else return Nullable<IfcDamperTypeEnum>(); }
+        void put_PredefinedType(IfcDamperTypeEnum value) { RDF_EXPRESS_PROBE(463); TextValue val = IfcDamperTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(463), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowController::attr
+        {
+            static constexpr IntValue PredefinedType = 463;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDamper_CLASS_H
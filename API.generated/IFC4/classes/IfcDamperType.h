@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDamperType_CLASS_H
+#define __RDF_LTD__IFC4_IfcDamperType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDamperType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDamperType : public RDF_EXPRESS_VIRTUAL IfcFlowControllerType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDamperType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDamperType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 169);
+        }
+
+        /// <summary>
+        /// Instances of IfcDamperType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDamperType> Extent(SdaiModel model) { return ExtentRange<IfcDamperType>(model, 169, false); }
+        static ExtentRange<IfcDamperType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDamperType>(model, 169, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDamperType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDamperType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDamperType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDamperType if the actual type of SdaiInstance is IfcDamperType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDamperType CreateExactEntity(SdaiInstance instance) { return IfcDamperType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDamperType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDamperType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDamperTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(464); int v = getENUM(464, IfcDamperTypeEnum_hash); if (v >= 0) return (IfcDamperTypeEnum) v; else return Nullable<IfcDamperTypeEnum>(); }
+        void put_PredefinedType(IfcDamperTypeEnum value) { RDF_EXPRESS_PROBE(464); TextValue val = IfcDamperTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(464), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowControllerType::attr
+        {
+            static constexpr IntValue PredefinedType = 464;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDamperType_CLASS_H
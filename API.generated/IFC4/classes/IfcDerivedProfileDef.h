@@ -0,0 +1,79 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDerivedProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcDerivedProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDerivedProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDerivedProfileDef : public RDF_EXPRESS_VIRTUAL IfcProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDerivedProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDerivedProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 170);
+        }
+
+        /// <summary>
+        /// Instances of IfcDerivedProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDerivedProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcDerivedProfileDef>(model, 170, false); }
+        static ExtentRange<IfcDerivedProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDerivedProfileDef>(model, 170, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDerivedProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDerivedProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDerivedProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDerivedProfileDef if the actual type of SdaiInstance is IfcDerivedProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDerivedProfileDef CreateExactEntity(SdaiInstance instance) { return IfcDerivedProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDerivedProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDerivedProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcProfileDef get_ParentProfile();
+        void put_ParentProfile(IfcProfileDef inst);
+
+        IfcCartesianTransformationOperator2D get_Operator();
+        void put_Operator(IfcCartesianTransformationOperator2D inst);
+
+        IfcLabel get_Label() { RDF_EXPRESS_PROBE(467); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(467), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Label_view() { return TextView(get_Label()); }
+#endif
+        void put_Label(IfcLabel value) { RDF_EXPRESS_PROBE(467); sdaiPutAttr(m_instance, getAttrDefinition(467), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Label_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(467); return buffer.GetAttr(m_instance, "Label"); }
+        const char* get_Label_utf8() { return get_Label_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProfileDef::attr
+        {
+            static constexpr IntValue ParentProfile = 465;
+            static constexpr IntValue Operator = 466;
+            static constexpr IntValue Label = 467;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDerivedProfileDef_CLASS_H
@@ -0,0 +1,87 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDerivedUnit_CLASS_H
+#define __RDF_LTD__IFC4_IfcDerivedUnit_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDerivedUnit
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDerivedUnit : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDerivedUnit
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDerivedUnit(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 171);
+        }
+
+        /// <summary>
+        /// Instances of IfcDerivedUnit in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDerivedUnit> Extent(SdaiModel model) { return ExtentRange<IfcDerivedUnit>(model, 171, false); }
+        static ExtentRange<IfcDerivedUnit> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDerivedUnit>(model, 171, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDerivedUnit and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDerivedUnit Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDerivedUnit"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDerivedUnit if the actual type of SdaiInstance is IfcDerivedUnit or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDerivedUnit CreateExactEntity(SdaiInstance instance) { return IfcDerivedUnit(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDerivedUnit or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDerivedUnit(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcDerivedUnitElement or list of convertible elements
+        template <typename TList> void get_Elements(TList& lst) { RDF_EXPRESS_PROBE(468); SetOfIfcDerivedUnitElementSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(468)); }
+
+        //TList may be SetOfIfcDerivedUnitElement or list of convertible elements
+        template <typename TList> void put_Elements(TList& lst) { RDF_EXPRESS_PROBE(468); SetOfIfcDerivedUnitElementSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(468)); }
+
+        //TArrayElem[] may be IfcDerivedUnitElement[] or array of convertible elements
+        template <typename TArrayElem> void put_Elements(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(468); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcDerivedUnitElementSerializer<SetOfIfcDerivedUnitElement> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(468)); }
+
+        Nullable<IfcDerivedUnitEnum> get_UnitType() { RDF_EXPRESS_PROBE(469); int v = getENUM(469, IfcDerivedUnitEnum_hash); if (v >= 0) return (IfcDerivedUnitEnum) v; else return Nullable<IfcDerivedUnitEnum>(); }
+        void put_UnitType(IfcDerivedUnitEnum value) { RDF_EXPRESS_PROBE(469); TextValue val = IfcDerivedUnitEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(469), sdaiENUM, val); }
+
+        IfcLabel get_UserDefinedType() { RDF_EXPRESS_PROBE(470); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(470), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedType_view() { return TextView(get_UserDefinedType()); }
+#endif
+        void put_UserDefinedType(IfcLabel value) { RDF_EXPRESS_PROBE(470); sdaiPutAttr(m_instance, getAttrDefinition(470), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(470); return buffer.GetAttr(m_instance, "UserDefinedType"); }
+        const char* get_UserDefinedType_utf8() { return get_UserDefinedType_utf8(ThreadUtf8Buffer()); }
+
+        IfcDimensionalExponents get_Dimensions();
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Elements = 468;
+            static constexpr IntValue UnitType = 469;
+            static constexpr IntValue UserDefinedType = 470;
+            static constexpr IntValue Dimensions = 471;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDerivedUnit_CLASS_H
@@ -0,0 +1,67 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDerivedUnitElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcDerivedUnitElement_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDerivedUnitElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDerivedUnitElement : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDerivedUnitElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDerivedUnitElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 172);
+        }
+
+        /// <summary>
+        /// Instances of IfcDerivedUnitElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDerivedUnitElement> Extent(SdaiModel model) { return ExtentRange<IfcDerivedUnitElement>(model, 172, false); }
+        static ExtentRange<IfcDerivedUnitElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDerivedUnitElement>(model, 172, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDerivedUnitElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDerivedUnitElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDerivedUnitElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDerivedUnitElement if the actual type of SdaiInstance is IfcDerivedUnitElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDerivedUnitElement CreateExactEntity(SdaiInstance instance) { return IfcDerivedUnitElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDerivedUnitElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDerivedUnitElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcNamedUnit get_Unit();
+        void put_Unit(IfcNamedUnit inst);
+
+        Nullable<IntValue> get_Exponent() { RDF_EXPRESS_PROBE(473); IntValue val = (IntValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(473), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+        void put_Exponent(IntValue value) { RDF_EXPRESS_PROBE(473); sdaiPutAttr(m_instance, getAttrDefinition(473), sdaiINTEGER, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Unit = 472;
+            static constexpr IntValue Exponent = 473;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDerivedUnitElement_CLASS_H
@@ -0,0 +1,87 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDimensionalExponents_CLASS_H
+#define __RDF_LTD__IFC4_IfcDimensionalExponents_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDimensionalExponents
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDimensionalExponents : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDimensionalExponents
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDimensionalExponents(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 173);
+        }
+
+        /// <summary>
+        /// Instances of IfcDimensionalExponents in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDimensionalExponents> Extent(SdaiModel model) { return ExtentRange<IfcDimensionalExponents>(model, 173, false); }
+        static ExtentRange<IfcDimensionalExponents> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDimensionalExponents>(model, 173, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDimensionalExponents and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDimensionalExponents Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDimensionalExponents"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDimensionalExponents if the actual type of SdaiInstance is IfcDimensionalExponents or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDimensionalExponents CreateExactEntity(SdaiInstance instance) { return IfcDimensionalExponents(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDimensionalExponents or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDimensionalExponents(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IntValue> get_LengthExponent() { RDF_EXPRESS_PROBE(474); IntValue val = (IntValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(474), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+        void put_LengthExponent(IntValue value) { RDF_EXPRESS_PROBE(474); sdaiPutAttr(m_instance, getAttrDefinition(474), sdaiINTEGER, &value); }
+
+        Nullable<IntValue> get_MassExponent() { RDF_EXPRESS_PROBE(475); IntValue val = (IntValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(475), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+        void put_MassExponent(IntValue value) { RDF_EXPRESS_PROBE(475); sdaiPutAttr(m_instance, getAttrDefinition(475), sdaiINTEGER, &value); }
+
+        Nullable<IntValue> get_TimeExponent() { RDF_EXPRESS_PROBE(476); IntValue val = (IntValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(476), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+        void put_TimeExponent(IntValue value) { RDF_EXPRESS_PROBE(476); sdaiPutAttr(m_instance, getAttrDefinition(476), sdaiINTEGER, &value); }
+
+        Nullable<IntValue> get_ElectricCurrentExponent() { RDF_EXPRESS_PROBE(477); IntValue val = (IntValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(477), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+        void put_ElectricCurrentExponent(IntValue value) { RDF_EXPRESS_PROBE(477); sdaiPutAttr(m_instance, getAttrDefinition(477), sdaiINTEGER, &value); }
+
+        Nullable<IntValue> get_ThermodynamicTemperatureExponent() { RDF_EXPRESS_PROBE(478); IntValue val = (IntValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(478), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+        void put_ThermodynamicTemperatureExponent(IntValue value) { RDF_EXPRESS_PROBE(478); sdaiPutAttr(m_instance, getAttrDefinition(478), sdaiINTEGER, &value); }
+
+        Nullable<IntValue> get_AmountOfSubstanceExponent() { RDF_EXPRESS_PROBE(479); IntValue val = (IntValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(479), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+        void put_AmountOfSubstanceExponent(IntValue value) { RDF_EXPRESS_PROBE(479); sdaiPutAttr(m_instance, getAttrDefinition(479), sdaiINTEGER, &value); }
+
+        Nullable<IntValue> get_LuminousIntensityExponent() { RDF_EXPRESS_PROBE(480); IntValue val = (IntValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(480), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+        void put_LuminousIntensityExponent(IntValue value) { RDF_EXPRESS_PROBE(480); sdaiPutAttr(m_instance, getAttrDefinition(480), sdaiINTEGER, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue LengthExponent = 474;
+            static constexpr IntValue MassExponent = 475;
+            static constexpr IntValue TimeExponent = 476;
+            static constexpr IntValue ElectricCurrentExponent = 477;
+            static constexpr IntValue ThermodynamicTemperatureExponent = 478;
+            static constexpr IntValue AmountOfSubstanceExponent = 479;
+            static constexpr IntValue LuminousIntensityExponent = 480;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDimensionalExponents_CLASS_H
@@ -0,0 +1,73 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDirection_CLASS_H
+#define __RDF_LTD__IFC4_IfcDirection_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDirection
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDirection : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDirection
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDirection(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 174);
+        }
+
+        /// <summary>
+        /// Instances of IfcDirection in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDirection> Extent(SdaiModel model) { return ExtentRange<IfcDirection>(model, 174, false); }
+        static ExtentRange<IfcDirection> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDirection>(model, 174, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDirection and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDirection Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDirection"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDirection if the actual type of SdaiInstance is IfcDirection or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDirection CreateExactEntity(SdaiInstance instance) { return IfcDirection(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDirection or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDirection(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcReal or list of convertible elements
+        template <typename TList> void get_DirectionRatios(TList& lst) { RDF_EXPRESS_PROBE(481); ListOfIfcRealSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(481)); }
+
+        //TList may be ListOfIfcReal or list of convertible elements
+        template <typename TList> void put_DirectionRatios(TList& lst) { RDF_EXPRESS_PROBE(481); ListOfIfcRealSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(481)); }
+
+        //TArrayElem[] may be IfcReal[] or array of convertible elements
+        template <typename TArrayElem> void put_DirectionRatios(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(481); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcRealSerializer<ListOfIfcReal> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(481)); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(482); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(482), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue DirectionRatios = 481;
+            static constexpr IntValue Dim = 482;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDirection_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDiscreteAccessory_CLASS_H
+#define __RDF_LTD__IFC4_IfcDiscreteAccessory_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementComponent.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDiscreteAccessory
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDiscreteAccessory : public RDF_EXPRESS_VIRTUAL IfcElementComponent
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDiscreteAccessory
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDiscreteAccessory(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 175);
+        }
+
+        /// <summary>
+        /// Instances of IfcDiscreteAccessory in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDiscreteAccessory> Extent(SdaiModel model) { return ExtentRange<IfcDiscreteAccessory>(model, 175, false); }
+        static ExtentRange<IfcDiscreteAccessory> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDiscreteAccessory>(model, 175, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDiscreteAccessory and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDiscreteAccessory Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDiscreteAccessory"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDiscreteAccessory if the actual type of SdaiInstance is IfcDiscreteAccessory or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDiscreteAccessory CreateExactEntity(SdaiInstance instance) { return IfcDiscreteAccessory(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDiscreteAccessory or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDiscreteAccessory(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDiscreteAccessoryTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(483); int v = getENUM(483, IfcDiscreteAccessoryTypeEnum_hash); if (v >= 0) return (IfcDiscreteAccessoryTypeEnum) v; else return Nullable<IfcDiscreteAccessoryTypeEnum>(); }
+        void put_PredefinedType(IfcDiscreteAccessoryTypeEnum value) { RDF_EXPRESS_PROBE(483); TextValue val = IfcDiscreteAccessoryTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(483), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementComponent::attr
+        {
+            static constexpr IntValue PredefinedType = 483;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDiscreteAccessory_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDiscreteAccessoryType_CLASS_H
+#define __RDF_LTD__IFC4_IfcDiscreteAccessoryType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementComponentType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDiscreteAccessoryType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDiscreteAccessoryType : public RDF_EXPRESS_VIRTUAL IfcElementComponentType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDiscreteAccessoryType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDiscreteAccessoryType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 176);
+        }
+
+        /// <summary>
+        /// Instances of IfcDiscreteAccessoryType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDiscreteAccessoryType> Extent(SdaiModel model) { return ExtentRange<IfcDiscreteAccessoryType>(model, 176, false); }
+        static ExtentRange<IfcDiscreteAccessoryType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDiscreteAccessoryType>(model, 176, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDiscreteAccessoryType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDiscreteAccessoryType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDiscreteAccessoryType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDiscreteAccessoryType if the actual type of SdaiInstance is IfcDiscreteAccessoryType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDiscreteAccessoryType CreateExactEntity(SdaiInstance instance) { return IfcDiscreteAccessoryType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDiscreteAccessoryType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDiscreteAccessoryType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDiscreteAccessoryTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(484); int v = getENUM(484, IfcDiscreteAccessoryTypeEnum_hash); if (v >= 0) return (IfcDiscreteAccessoryTypeEnum) v; else return Nullable<IfcDiscreteAccessoryTypeEnum>(); }
+        void put_PredefinedType(IfcDiscreteAccessoryTypeEnum value) { RDF_EXPRESS_PROBE(484); TextValue val = IfcDiscreteAccessoryTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(484), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementComponentType::attr
+        {
+            static constexpr IntValue PredefinedType = 484;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDiscreteAccessoryType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionChamberElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcDistributionChamberElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionFlowElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDistributionChamberElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDistributionChamberElement : public RDF_EXPRESS_VIRTUAL IfcDistributionFlowElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDistributionChamberElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDistributionChamberElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 177);
+        }
+
+        /// <summary>
+        /// Instances of IfcDistributionChamberElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDistributionChamberElement> Extent(SdaiModel model) { return ExtentRange<IfcDistributionChamberElement>(model, 177, false); }
+        static ExtentRange<IfcDistributionChamberElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDistributionChamberElement>(model, 177, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDistributionChamberElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDistributionChamberElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDistributionChamberElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDistributionChamberElement if the actual type of SdaiInstance is IfcDistributionChamberElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDistributionChamberElement CreateExactEntity(SdaiInstance instance) { return IfcDistributionChamberElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDistributionChamberElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDistributionChamberElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDistributionChamberElementTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(485); int v = getENUM(485, IfcDistributionChamberElementTypeEnum_hash); if (v >= 0) return (IfcDistributionChamberElementTypeEnum) v; else return Nullable<IfcDistributionChamberElementTypeEnum>(); }
+        void put_PredefinedType(IfcDistributionChamberElementTypeEnum value) { RDF_EXPRESS_PROBE(485); TextValue val = IfcDistributionChamberElementTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(485), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionFlowElement::attr
+        {
+            static constexpr IntValue PredefinedType = 485;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionChamberElement_CLASS_H
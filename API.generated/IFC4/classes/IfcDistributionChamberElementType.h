@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionChamberElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcDistributionChamberElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionFlowElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDistributionChamberElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDistributionChamberElementType : public RDF_EXPRESS_VIRTUAL IfcDistributionFlowElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDistributionChamberElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDistributionChamberElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 178);
+        }
+
+        /// <summary>
+        /// Instances of IfcDistributionChamberElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDistributionChamberElementType> Extent(SdaiModel model) { return ExtentRange<IfcDistributionChamberElementType>(model, 178, false); }
+        static ExtentRange<IfcDistributionChamberElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDistributionChamberElementType>(model, 178, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDistributionChamberElementType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDistributionChamberElementType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDistributionChamberElementType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDistributionChamberElementType if the actual type of SdaiInstance is IfcDistributionChamberElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDistributionChamberElementType CreateExactEntity(SdaiInstance instance) { return IfcDistributionChamberElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDistributionChamberElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDistributionChamberElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDistributionChamberElementTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(486); int v = getENUM(486, IfcDistributionChamberElementTypeEnum_hash); if (v >= 0) return (IfcDistributionChamberElementTypeEnum) v; else return Nullable<IfcDistributionChamberElementTypeEnum>(); }
+        void put_PredefinedType(IfcDistributionChamberElementTypeEnum value) { RDF_EXPRESS_PROBE(486); TextValue val = IfcDistributionChamberElementTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(486), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionFlowElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 486;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionChamberElementType_CLASS_H
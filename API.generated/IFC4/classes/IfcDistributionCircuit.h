@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionCircuit_CLASS_H
+#define __RDF_LTD__IFC4_IfcDistributionCircuit_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionSystem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDistributionCircuit
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDistributionCircuit : public RDF_EXPRESS_VIRTUAL IfcDistributionSystem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDistributionCircuit
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDistributionCircuit(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 179);
+        }
+
+        /// <summary>
+        /// Instances of IfcDistributionCircuit in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDistributionCircuit> Extent(SdaiModel model) { return ExtentRange<IfcDistributionCircuit>(model, 179, false); }
+        static ExtentRange<IfcDistributionCircuit> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDistributionCircuit>(model, 179, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDistributionCircuit and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDistributionCircuit Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDistributionCircuit"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDistributionCircuit if the actual type of SdaiInstance is IfcDistributionCircuit or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDistributionCircuit CreateExactEntity(SdaiInstance instance) { return IfcDistributionCircuit(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDistributionCircuit or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDistributionCircuit(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionSystem::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionCircuit_CLASS_H
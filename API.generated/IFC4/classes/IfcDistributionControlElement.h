@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionControlElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcDistributionControlElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDistributionControlElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDistributionControlElement : public RDF_EXPRESS_VIRTUAL IfcDistributionElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDistributionControlElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDistributionControlElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 180);
+        }
+
+        /// <summary>
+        /// Instances of IfcDistributionControlElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDistributionControlElement> Extent(SdaiModel model) { return ExtentRange<IfcDistributionControlElement>(model, 180, false); }
+        static ExtentRange<IfcDistributionControlElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDistributionControlElement>(model, 180, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDistributionControlElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDistributionControlElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDistributionControlElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDistributionControlElement if the actual type of SdaiInstance is IfcDistributionControlElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDistributionControlElement CreateExactEntity(SdaiInstance instance) { return IfcDistributionControlElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDistributionControlElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDistributionControlElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcRelFlowControlElements or list of convertible elements
+        template <typename TList> void get_AssignedToFlowElement(TList& lst) { RDF_EXPRESS_PROBE(44); SetOfIfcRelFlowControlElementsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(44)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionElement::attr
+        {
+            static constexpr IntValue AssignedToFlowElement = 44;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionControlElement_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionControlElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcDistributionControlElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDistributionControlElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDistributionControlElementType : public RDF_EXPRESS_VIRTUAL IfcDistributionElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDistributionControlElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDistributionControlElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 181);
+        }
+
+        /// <summary>
+        /// Instances of IfcDistributionControlElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDistributionControlElementType> Extent(SdaiModel model) { return ExtentRange<IfcDistributionControlElementType>(model, 181, false); }
+        static ExtentRange<IfcDistributionControlElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDistributionControlElementType>(model, 181, true); }
+
+        /// <summary>
+        /// Returns object of IfcDistributionControlElementType if the actual type of SdaiInstance is IfcDistributionControlElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDistributionControlElementType CreateExactEntity(SdaiInstance instance) { return IfcDistributionControlElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDistributionControlElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDistributionControlElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionElementType::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionControlElementType_CLASS_H
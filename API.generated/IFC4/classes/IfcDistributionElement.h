@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcDistributionElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDistributionElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDistributionElement : public RDF_EXPRESS_VIRTUAL IfcElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDistributionElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDistributionElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 182);
+        }
+
+        /// <summary>
+        /// Instances of IfcDistributionElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDistributionElement> Extent(SdaiModel model) { return ExtentRange<IfcDistributionElement>(model, 182, false); }
+        static ExtentRange<IfcDistributionElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDistributionElement>(model, 182, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDistributionElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDistributionElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDistributionElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDistributionElement if the actual type of SdaiInstance is IfcDistributionElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDistributionElement CreateExactEntity(SdaiInstance instance) { return IfcDistributionElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDistributionElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDistributionElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcRelConnectsPortToElement or list of convertible elements
+        template <typename TList> void get_HasPorts(TList& lst) { RDF_EXPRESS_PROBE(43); SetOfIfcRelConnectsPortToElementSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(43)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElement::attr
+        {
+            static constexpr IntValue HasPorts = 43;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionElement_CLASS_H
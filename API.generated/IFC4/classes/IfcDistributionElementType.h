@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcDistributionElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDistributionElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDistributionElementType : public RDF_EXPRESS_VIRTUAL IfcElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDistributionElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDistributionElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 183);
+        }
+
+        /// <summary>
+        /// Instances of IfcDistributionElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDistributionElementType> Extent(SdaiModel model) { return ExtentRange<IfcDistributionElementType>(model, 183, false); }
+        static ExtentRange<IfcDistributionElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDistributionElementType>(model, 183, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDistributionElementType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDistributionElementType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDistributionElementType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDistributionElementType if the actual type of SdaiInstance is IfcDistributionElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDistributionElementType CreateExactEntity(SdaiInstance instance) { return IfcDistributionElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDistributionElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDistributionElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementType::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionElementType_CLASS_H
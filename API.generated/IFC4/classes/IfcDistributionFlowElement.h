@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionFlowElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcDistributionFlowElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDistributionFlowElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDistributionFlowElement : public RDF_EXPRESS_VIRTUAL IfcDistributionElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDistributionFlowElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDistributionFlowElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 184);
+        }
+
+        /// <summary>
+        /// Instances of IfcDistributionFlowElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDistributionFlowElement> Extent(SdaiModel model) { return ExtentRange<IfcDistributionFlowElement>(model, 184, false); }
+        static ExtentRange<IfcDistributionFlowElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDistributionFlowElement>(model, 184, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDistributionFlowElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDistributionFlowElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDistributionFlowElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDistributionFlowElement if the actual type of SdaiInstance is IfcDistributionFlowElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDistributionFlowElement CreateExactEntity(SdaiInstance instance) { return IfcDistributionFlowElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDistributionFlowElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDistributionFlowElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcRelFlowControlElements or list of convertible elements
+        template <typename TList> void get_HasControlElements(TList& lst) { RDF_EXPRESS_PROBE(68); SetOfIfcRelFlowControlElementsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(68)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionElement::attr
+        {
+            static constexpr IntValue HasControlElements = 68;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionFlowElement_CLASS_H
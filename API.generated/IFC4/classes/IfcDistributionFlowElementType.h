@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionFlowElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcDistributionFlowElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDistributionFlowElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDistributionFlowElementType : public RDF_EXPRESS_VIRTUAL IfcDistributionElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDistributionFlowElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDistributionFlowElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 185);
+        }
+
+        /// <summary>
+        /// Instances of IfcDistributionFlowElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDistributionFlowElementType> Extent(SdaiModel model) { return ExtentRange<IfcDistributionFlowElementType>(model, 185, false); }
+        static ExtentRange<IfcDistributionFlowElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDistributionFlowElementType>(model, 185, true); }
+
+        /// <summary>
+        /// Returns object of IfcDistributionFlowElementType if the actual type of SdaiInstance is IfcDistributionFlowElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDistributionFlowElementType CreateExactEntity(SdaiInstance instance) { return IfcDistributionFlowElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDistributionFlowElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDistributionFlowElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionElementType::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionFlowElementType_CLASS_H
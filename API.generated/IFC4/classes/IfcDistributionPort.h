@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionPort_CLASS_H
+#define __RDF_LTD__IFC4_IfcDistributionPort_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPort.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDistributionPort
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDistributionPort : public RDF_EXPRESS_VIRTUAL IfcPort
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDistributionPort
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDistributionPort(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 186);
+        }
+
+        /// <summary>
+        /// Instances of IfcDistributionPort in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDistributionPort> Extent(SdaiModel model) { return ExtentRange<IfcDistributionPort>(model, 186, false); }
+        static ExtentRange<IfcDistributionPort> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDistributionPort>(model, 186, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDistributionPort and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDistributionPort Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDistributionPort"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDistributionPort if the actual type of SdaiInstance is IfcDistributionPort or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDistributionPort CreateExactEntity(SdaiInstance instance) { return IfcDistributionPort(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDistributionPort or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDistributionPort(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFlowDirectionEnum> get_FlowDirection() { RDF_EXPRESS_PROBE(492); int v = getENUM(492, IfcFlowDirectionEnum_hash); if (v >= 0) return (IfcFlowDirectionEnum) v; else return Nullable<IfcFlowDirectionEnum>(); }
+        void put_FlowDirection(IfcFlowDirectionEnum value) { RDF_EXPRESS_PROBE(492); TextValue val = IfcFlowDirectionEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(492), sdaiENUM, val); }
+
+        Nullable<IfcDistributionPortTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(493); int v = getENUM(493, IfcDistributionPortTypeEnum_hash); if (v >= 0) return (IfcDistributionPortTypeEnum) v; else return Nullable<IfcDistributionPortTypeEnum>(); }
+        void put_PredefinedType(IfcDistributionPortTypeEnum value) { RDF_EXPRESS_PROBE(493); TextValue val = IfcDistributionPortTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(493), sdaiENUM, val); }
+
+        Nullable<IfcDistributionSystemEnum> get_SystemType() { RDF_EXPRESS_PROBE(494); int v = getENUM(494, IfcDistributionSystemEnum_hash); if (v >= 0) return (IfcDistributionSystemEnum) v; else return Nullable<IfcDistributionSystemEnum>(); }
+        void put_SystemType(IfcDistributionSystemEnum value) { RDF_EXPRESS_PROBE(494); TextValue val = IfcDistributionSystemEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(494), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPort::attr
+        {
+            static constexpr IntValue FlowDirection = 492;
+            static constexpr IntValue PredefinedType = 493;
+            static constexpr IntValue SystemType = 494;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionPort_CLASS_H
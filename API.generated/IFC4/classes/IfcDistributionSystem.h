@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDistributionSystem_CLASS_H
+#define __RDF_LTD__IFC4_IfcDistributionSystem_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSystem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDistributionSystem
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDistributionSystem : public RDF_EXPRESS_VIRTUAL IfcSystem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDistributionSystem
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDistributionSystem(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 187);
+        }
+
+        /// <summary>
+        /// Instances of IfcDistributionSystem in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDistributionSystem> Extent(SdaiModel model) { return ExtentRange<IfcDistributionSystem>(model, 187, false); }
+        static ExtentRange<IfcDistributionSystem> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDistributionSystem>(model, 187, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDistributionSystem and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDistributionSystem Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDistributionSystem"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDistributionSystem if the actual type of SdaiInstance is IfcDistributionSystem or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDistributionSystem CreateExactEntity(SdaiInstance instance) { return IfcDistributionSystem(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDistributionSystem or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDistributionSystem(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_LongName() { RDF_EXPRESS_PROBE(487); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(487), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LongName_view() { return TextView(get_LongName()); }
+#endif
+        void put_LongName(IfcLabel value) { RDF_EXPRESS_PROBE(487); sdaiPutAttr(m_instance, getAttrDefinition(487), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LongName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(487); return buffer.GetAttr(m_instance, "LongName"); }
+        const char* get_LongName_utf8() { return get_LongName_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcDistributionSystemEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(488); int v = getENUM(488, IfcDistributionSystemEnum_hash); if (v >= 0) return (IfcDistributionSystemEnum) v; else return Nullable<IfcDistributionSystemEnum>(); }
+        void put_PredefinedType(IfcDistributionSystemEnum value) { RDF_EXPRESS_PROBE(488); TextValue val = IfcDistributionSystemEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(488), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSystem::attr
+        {
+            static constexpr IntValue LongName = 487;
+            static constexpr IntValue PredefinedType = 488;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDistributionSystem_CLASS_H
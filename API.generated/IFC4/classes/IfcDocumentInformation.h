@@ -0,0 +1,238 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDocumentInformation_CLASS_H
+#define __RDF_LTD__IFC4_IfcDocumentInformation_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcExternalInformation.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDocumentInformation
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDocumentInformation : public RDF_EXPRESS_VIRTUAL IfcExternalInformation
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDocumentInformation
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDocumentInformation(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 188);
+        }
+
+        /// <summary>
+        /// Instances of IfcDocumentInformation in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDocumentInformation> Extent(SdaiModel model) { return ExtentRange<IfcDocumentInformation>(model, 188, false); }
+        static ExtentRange<IfcDocumentInformation> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDocumentInformation>(model, 188, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDocumentInformation and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDocumentInformation Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDocumentInformation"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDocumentInformation if the actual type of SdaiInstance is IfcDocumentInformation or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDocumentInformation CreateExactEntity(SdaiInstance instance) { return IfcDocumentInformation(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDocumentInformation or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDocumentInformation(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Identification() { RDF_EXPRESS_PROBE(495); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(495), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Identification_view() { return TextView(get_Identification()); }
+#endif
+        void put_Identification(IfcIdentifier value) { RDF_EXPRESS_PROBE(495); sdaiPutAttr(m_instance, getAttrDefinition(495), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Identification_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(495); return buffer.GetAttr(m_instance, "Identification"); }
+        const char* get_Identification_utf8() { return get_Identification_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(496); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(496), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(496); sdaiPutAttr(m_instance, getAttrDefinition(496), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(496); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(497); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(497), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(497); sdaiPutAttr(m_instance, getAttrDefinition(497), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(497); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcURIReference get_Location() { RDF_EXPRESS_PROBE(498); IfcURIReference val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(498), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Location_view() { return TextView(get_Location()); }
+#endif
+        void put_Location(IfcURIReference value) { RDF_EXPRESS_PROBE(498); sdaiPutAttr(m_instance, getAttrDefinition(498), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Location_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(498); return buffer.GetAttr(m_instance, "Location"); }
+        const char* get_Location_utf8() { return get_Location_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Purpose() { RDF_EXPRESS_PROBE(499); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(499), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Purpose_view() { return TextView(get_Purpose()); }
+#endif
+        void put_Purpose(IfcText value) { RDF_EXPRESS_PROBE(499); sdaiPutAttr(m_instance, getAttrDefinition(499), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Purpose_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(499); return buffer.GetAttr(m_instance, "Purpose"); }
+        const char* get_Purpose_utf8() { return get_Purpose_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_IntendedUse() { RDF_EXPRESS_PROBE(500); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(500), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_IntendedUse_view() { return TextView(get_IntendedUse()); }
+#endif
+        void put_IntendedUse(IfcText value) { RDF_EXPRESS_PROBE(500); sdaiPutAttr(m_instance, getAttrDefinition(500), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_IntendedUse_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(500); return buffer.GetAttr(m_instance, "IntendedUse"); }
+        const char* get_IntendedUse_utf8() { return get_IntendedUse_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Scope() { RDF_EXPRESS_PROBE(501); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(501), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Scope_view() { return TextView(get_Scope()); }
+#endif
+        void put_Scope(IfcText value) { RDF_EXPRESS_PROBE(501); sdaiPutAttr(m_instance, getAttrDefinition(501), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Scope_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(501); return buffer.GetAttr(m_instance, "Scope"); }
+        const char* get_Scope_utf8() { return get_Scope_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Revision() { RDF_EXPRESS_PROBE(502); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(502), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Revision_view() { return TextView(get_Revision()); }
+#endif
+        void put_Revision(IfcLabel value) { RDF_EXPRESS_PROBE(502); sdaiPutAttr(m_instance, getAttrDefinition(502), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Revision_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(502); return buffer.GetAttr(m_instance, "Revision"); }
+        const char* get_Revision_utf8() { return get_Revision_utf8(ThreadUtf8Buffer()); }
+
+        IfcActorSelect_get get_DocumentOwner() { return IfcActorSelect_get(m_instance, 503); }
+        IfcActorSelect_put put_DocumentOwner() { return IfcActorSelect_put(m_instance, 503); }
+
+        //TList may be SetOfIfcActorSelect or list of convertible elements
+        template <typename TList> void get_Editors(TList& lst) { RDF_EXPRESS_PROBE(504); SetOfIfcActorSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(504)); }
+
+        //TList may be SetOfIfcActorSelect or list of convertible elements
+        template <typename TList> void put_Editors(TList& lst) { RDF_EXPRESS_PROBE(504); SetOfIfcActorSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(504)); }
+
+        IfcDateTime get_CreationTime() { RDF_EXPRESS_PROBE(505); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(505), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_CreationTime_view() { return TextView(get_CreationTime()); }
+#endif
+        void put_CreationTime(IfcDateTime value) { RDF_EXPRESS_PROBE(505); sdaiPutAttr(m_instance, getAttrDefinition(505), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_CreationTime_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(505); return buffer.GetAttr(m_instance, "CreationTime"); }
+        const char* get_CreationTime_utf8() { return get_CreationTime_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_LastRevisionTime() { RDF_EXPRESS_PROBE(506); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(506), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LastRevisionTime_view() { return TextView(get_LastRevisionTime()); }
+#endif
+        void put_LastRevisionTime(IfcDateTime value) { RDF_EXPRESS_PROBE(506); sdaiPutAttr(m_instance, getAttrDefinition(506), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LastRevisionTime_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(506); return buffer.GetAttr(m_instance, "LastRevisionTime"); }
+        const char* get_LastRevisionTime_utf8() { return get_LastRevisionTime_utf8(ThreadUtf8Buffer()); }
+
+        IfcIdentifier get_ElectronicFormat() { RDF_EXPRESS_PROBE(507); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(507), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ElectronicFormat_view() { return TextView(get_ElectronicFormat()); }
+#endif
+        void put_ElectronicFormat(IfcIdentifier value) { RDF_EXPRESS_PROBE(507); sdaiPutAttr(m_instance, getAttrDefinition(507), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ElectronicFormat_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(507); return buffer.GetAttr(m_instance, "ElectronicFormat"); }
+        const char* get_ElectronicFormat_utf8() { return get_ElectronicFormat_utf8(ThreadUtf8Buffer()); }
+
+        IfcDate get_ValidFrom() { RDF_EXPRESS_PROBE(508); IfcDate val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(508), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ValidFrom_view() { return TextView(get_ValidFrom()); }
+#endif
+        void put_ValidFrom(IfcDate value) { RDF_EXPRESS_PROBE(508); sdaiPutAttr(m_instance, getAttrDefinition(508), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ValidFrom_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(508); return buffer.GetAttr(m_instance, "ValidFrom"); }
+        const char* get_ValidFrom_utf8() { return get_ValidFrom_utf8(ThreadUtf8Buffer()); }
+
+        IfcDate get_ValidUntil() { RDF_EXPRESS_PROBE(509); IfcDate val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(509), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ValidUntil_view() { return TextView(get_ValidUntil()); }
+#endif
+        void put_ValidUntil(IfcDate value) { RDF_EXPRESS_PROBE(509); sdaiPutAttr(m_instance, getAttrDefinition(509), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ValidUntil_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(509); return buffer.GetAttr(m_instance, "ValidUntil"); }
+        const char* get_ValidUntil_utf8() { return get_ValidUntil_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcDocumentConfidentialityEnum> get_Confidentiality() { RDF_EXPRESS_PROBE(510); int v = getENUM(510, IfcDocumentConfidentialityEnum_hash); if (v >= 0) return (IfcDocumentConfidentialityEnum) v; else return Nullable<IfcDocumentConfidentialityEnum>(); }
+        void put_Confidentiality(IfcDocumentConfidentialityEnum value) { RDF_EXPRESS_PROBE(510); TextValue val = IfcDocumentConfidentialityEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(510), sdaiENUM, val); }
+
+        Nullable<IfcDocumentStatusEnum> get_Status() { RDF_EXPRESS_PROBE(511); int v = getENUM(511, IfcDocumentStatusEnum_hash); if (v >= 0) return (IfcDocumentStatusEnum) v; else return Nullable<IfcDocumentStatusEnum>(); }
+        void put_Status(IfcDocumentStatusEnum value) { RDF_EXPRESS_PROBE(511); TextValue val = IfcDocumentStatusEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(511), sdaiENUM, val); }
+
+        //TList may be SetOfIfcRelAssociatesDocument or list of convertible elements
+        template <typename TList> void get_DocumentInfoForObjects(TList& lst) { RDF_EXPRESS_PROBE(512); SetOfIfcRelAssociatesDocumentSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(512)); }
+
+        //TList may be SetOfIfcDocumentReference or list of convertible elements
+        template <typename TList> void get_HasDocumentReferences(TList& lst) { RDF_EXPRESS_PROBE(513); SetOfIfcDocumentReferenceSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(513)); }
+
+        //TList may be SetOfIfcDocumentInformationRelationship or list of convertible elements
+        template <typename TList> void get_IsPointedTo(TList& lst) { RDF_EXPRESS_PROBE(514); SetOfIfcDocumentInformationRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(514)); }
+
+        //TList may be SetOfIfcDocumentInformationRelationship or list of convertible elements
+        template <typename TList> void get_IsPointer(TList& lst) { RDF_EXPRESS_PROBE(515); SetOfIfcDocumentInformationRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(515)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcExternalInformation::attr
+        {
+            static constexpr IntValue Identification = 495;
+            static constexpr IntValue Name = 496;
+            static constexpr IntValue Description = 497;
+            static constexpr IntValue Location = 498;
+            static constexpr IntValue Purpose = 499;
+            static constexpr IntValue IntendedUse = 500;
+            static constexpr IntValue Scope = 501;
+            static constexpr IntValue Revision = 502;
+            static constexpr IntValue DocumentOwner = 503;
+            static constexpr IntValue Editors = 504;
+            static constexpr IntValue CreationTime = 505;
+            static constexpr IntValue LastRevisionTime = 506;
+            static constexpr IntValue ElectronicFormat = 507;
+            static constexpr IntValue ValidFrom = 508;
+            static constexpr IntValue ValidUntil = 509;
+            static constexpr IntValue Confidentiality = 510;
+            static constexpr IntValue Status = 511;
+            static constexpr IntValue DocumentInfoForObjects = 512;
+            static constexpr IntValue HasDocumentReferences = 513;
+            static constexpr IntValue IsPointedTo = 514;
+            static constexpr IntValue IsPointer = 515;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDocumentInformation_CLASS_H
@@ -0,0 +1,85 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDocumentInformationRelationship_CLASS_H
+#define __RDF_LTD__IFC4_IfcDocumentInformationRelationship_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcResourceLevelRelationship.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDocumentInformationRelationship
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDocumentInformationRelationship : public RDF_EXPRESS_VIRTUAL IfcResourceLevelRelationship
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDocumentInformationRelationship
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDocumentInformationRelationship(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 189);
+        }
+
+        /// <summary>
+        /// Instances of IfcDocumentInformationRelationship in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDocumentInformationRelationship> Extent(SdaiModel model) { return ExtentRange<IfcDocumentInformationRelationship>(model, 189, false); }
+        static ExtentRange<IfcDocumentInformationRelationship> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDocumentInformationRelationship>(model, 189, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDocumentInformationRelationship and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDocumentInformationRelationship Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDocumentInformationRelationship"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDocumentInformationRelationship if the actual type of SdaiInstance is IfcDocumentInformationRelationship or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDocumentInformationRelationship CreateExactEntity(SdaiInstance instance) { return IfcDocumentInformationRelationship(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDocumentInformationRelationship or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDocumentInformationRelationship(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDocumentInformation get_RelatingDocument();
+        void put_RelatingDocument(IfcDocumentInformation inst);
+
+        //TList may be SetOfIfcDocumentInformation or list of convertible elements
+        template <typename TList> void get_RelatedDocuments(TList& lst) { RDF_EXPRESS_PROBE(517); SetOfIfcDocumentInformationSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(517)); }
+
+        //TList may be SetOfIfcDocumentInformation or list of convertible elements
+        template <typename TList> void put_RelatedDocuments(TList& lst) { RDF_EXPRESS_PROBE(517); SetOfIfcDocumentInformationSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(517)); }
+
+        //TArrayElem[] may be IfcDocumentInformation[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedDocuments(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(517); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcDocumentInformationSerializer<SetOfIfcDocumentInformation> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(517)); }
+
+        IfcLabel get_RelationshipType() { RDF_EXPRESS_PROBE(518); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(518), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_RelationshipType_view() { return TextView(get_RelationshipType()); }
+#endif
+        void put_RelationshipType(IfcLabel value) { RDF_EXPRESS_PROBE(518); sdaiPutAttr(m_instance, getAttrDefinition(518), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_RelationshipType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(518); return buffer.GetAttr(m_instance, "RelationshipType"); }
+        const char* get_RelationshipType_utf8() { return get_RelationshipType_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcResourceLevelRelationship::attr
+        {
+            static constexpr IntValue RelatingDocument = 516;
+            static constexpr IntValue RelatedDocuments = 517;
+            static constexpr IntValue RelationshipType = 518;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDocumentInformationRelationship_CLASS_H
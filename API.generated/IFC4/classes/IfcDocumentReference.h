@@ -0,0 +1,79 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDocumentReference_CLASS_H
+#define __RDF_LTD__IFC4_IfcDocumentReference_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcExternalReference.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDocumentReference
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDocumentReference : public RDF_EXPRESS_VIRTUAL IfcExternalReference
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDocumentReference
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDocumentReference(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 190);
+        }
+
+        /// <summary>
+        /// Instances of IfcDocumentReference in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDocumentReference> Extent(SdaiModel model) { return ExtentRange<IfcDocumentReference>(model, 190, false); }
+        static ExtentRange<IfcDocumentReference> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDocumentReference>(model, 190, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDocumentReference and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDocumentReference Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDocumentReference"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDocumentReference if the actual type of SdaiInstance is IfcDocumentReference or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDocumentReference CreateExactEntity(SdaiInstance instance) { return IfcDocumentReference(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDocumentReference or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDocumentReference(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(519); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(519), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(519); sdaiPutAttr(m_instance, getAttrDefinition(519), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(519); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcDocumentInformation get_ReferencedDocument();
+        void put_ReferencedDocument(IfcDocumentInformation inst);
+
+        //TList may be SetOfIfcRelAssociatesDocument or list of convertible elements
+        template <typename TList> void get_DocumentRefForObjects(TList& lst) { RDF_EXPRESS_PROBE(521); SetOfIfcRelAssociatesDocumentSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(521)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcExternalReference::attr
+        {
+            static constexpr IntValue Description = 519;
+            static constexpr IntValue ReferencedDocument = 520;
+            static constexpr IntValue DocumentRefForObjects = 521;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDocumentReference_CLASS_H
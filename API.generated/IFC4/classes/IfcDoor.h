@@ -0,0 +1,87 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDoor_CLASS_H
+#define __RDF_LTD__IFC4_IfcDoor_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDoor
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDoor : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDoor
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDoor(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 191);
+        }
+
+        /// <summary>
+        /// Instances of IfcDoor in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDoor> Extent(SdaiModel model) { return ExtentRange<IfcDoor>(model, 191, false); }
+        static ExtentRange<IfcDoor> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDoor>(model, 191, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDoor and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDoor Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDoor"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDoor if the actual type of SdaiInstance is IfcDoor or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDoor CreateExactEntity(SdaiInstance instance) { return IfcDoor(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDoor or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDoor(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_OverallHeight() { RDF_EXPRESS_PROBE(522); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(522), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_OverallHeight(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(522); sdaiPutAttr(m_instance, getAttrDefinition(522), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_OverallWidth() { RDF_EXPRESS_PROBE(523); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(523), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_OverallWidth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(523); sdaiPutAttr(m_instance, getAttrDefinition(523), sdaiREAL, &value); }
+
+        Nullable<IfcDoorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(524); int v = getENUM(524, IfcDoorTypeEnum_hash); if (v >= 0) return (IfcDoorTypeEnum) v; else return Nullable<IfcDoorTypeEnum>(); }
+        void put_PredefinedType(IfcDoorTypeEnum value) { RDF_EXPRESS_PROBE(524); TextValue val = IfcDoorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(524), sdaiENUM, val); }
+
+        Nullable<IfcDoorTypeOperationEnum> get_OperationType() { RDF_EXPRESS_PROBE(525); int v = getENUM(525, IfcDoorTypeOperationEnum_hash); if (v >= 0) return (IfcDoorTypeOperationEnum) v; else return Nullable<IfcDoorTypeOperationEnum>(); }
+        void put_OperationType(IfcDoorTypeOperationEnum value) { RDF_EXPRESS_PROBE(525); TextValue val = IfcDoorTypeOperationEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(525), sdaiENUM, val); }
+
+        IfcLabel get_UserDefinedOperationType() { RDF_EXPRESS_PROBE(526); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(526), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedOperationType_view() { return TextView(get_UserDefinedOperationType()); }
+#endif
+        void put_UserDefinedOperationType(IfcLabel value) { RDF_EXPRESS_PROBE(526); sdaiPutAttr(m_instance, getAttrDefinition(526), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedOperationType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(526); return buffer.GetAttr(m_instance, "UserDefinedOperationType"); }
+        const char* get_UserDefinedOperationType_utf8() { return get_UserDefinedOperationType_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue OverallHeight = 522;
+            static constexpr IntValue OverallWidth = 523;
+            static constexpr IntValue PredefinedType = 524;
+            static constexpr IntValue OperationType = 525;
+            static constexpr IntValue UserDefinedOperationType = 526;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDoor_CLASS_H
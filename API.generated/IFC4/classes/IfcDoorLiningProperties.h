@@ -0,0 +1,112 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDoorLiningProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcDoorLiningProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedPropertySet.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDoorLiningProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDoorLiningProperties : public RDF_EXPRESS_VIRTUAL IfcPreDefinedPropertySet
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDoorLiningProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDoorLiningProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 192);
+        }
+
+        /// <summary>
+        /// Instances of IfcDoorLiningProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDoorLiningProperties> Extent(SdaiModel model) { return ExtentRange<IfcDoorLiningProperties>(model, 192, false); }
+        static ExtentRange<IfcDoorLiningProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDoorLiningProperties>(model, 192, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDoorLiningProperties and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDoorLiningProperties Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDoorLiningProperties"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDoorLiningProperties if the actual type of SdaiInstance is IfcDoorLiningProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDoorLiningProperties CreateExactEntity(SdaiInstance instance) { return IfcDoorLiningProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDoorLiningProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDoorLiningProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_LiningDepth() { RDF_EXPRESS_PROBE(530); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(530), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_LiningDepth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(530); sdaiPutAttr(m_instance, getAttrDefinition(530), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_LiningThickness() { RDF_EXPRESS_PROBE(531); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(531), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_LiningThickness(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(531); sdaiPutAttr(m_instance, getAttrDefinition(531), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_ThresholdDepth() { RDF_EXPRESS_PROBE(532); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(532), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_ThresholdDepth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(532); sdaiPutAttr(m_instance, getAttrDefinition(532), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_ThresholdThickness() { RDF_EXPRESS_PROBE(533); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(533), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_ThresholdThickness(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(533); sdaiPutAttr(m_instance, getAttrDefinition(533), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_TransomThickness() { RDF_EXPRESS_PROBE(534); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(534), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_TransomThickness(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(534); sdaiPutAttr(m_instance, getAttrDefinition(534), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_TransomOffset() { RDF_EXPRESS_PROBE(535); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(535), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_TransomOffset(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(535); sdaiPutAttr(m_instance, getAttrDefinition(535), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_LiningOffset() { RDF_EXPRESS_PROBE(536); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(536), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_LiningOffset(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(536); sdaiPutAttr(m_instance, getAttrDefinition(536), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_ThresholdOffset() { RDF_EXPRESS_PROBE(537); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(537), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_ThresholdOffset(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(537); sdaiPutAttr(m_instance, getAttrDefinition(537), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_CasingThickness() { RDF_EXPRESS_PROBE(538); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(538), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_CasingThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(538); sdaiPutAttr(m_instance, getAttrDefinition(538), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_CasingDepth() { RDF_EXPRESS_PROBE(539); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(539), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_CasingDepth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(539); sdaiPutAttr(m_instance, getAttrDefinition(539), sdaiREAL, &value); }
+
+        IfcShapeAspect get_ShapeAspectStyle();
+        void put_ShapeAspectStyle(IfcShapeAspect inst);
+
+        Nullable<IfcLengthMeasure> get_LiningToPanelOffsetX() { RDF_EXPRESS_PROBE(541); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(541), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_LiningToPanelOffsetX(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(541); sdaiPutAttr(m_instance, getAttrDefinition(541), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_LiningToPanelOffsetY() { RDF_EXPRESS_PROBE(542); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(542), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_LiningToPanelOffsetY(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(542); sdaiPutAttr(m_instance, getAttrDefinition(542), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedPropertySet::attr
+        {
+            static constexpr IntValue LiningDepth = 530;
+            static constexpr IntValue LiningThickness = 531;
+            static constexpr IntValue ThresholdDepth = 532;
+            static constexpr IntValue ThresholdThickness = 533;
+            static constexpr IntValue TransomThickness = 534;
+            static constexpr IntValue TransomOffset = 535;
+            static constexpr IntValue LiningOffset = 536;
+            static constexpr IntValue ThresholdOffset = 537;
+            static constexpr IntValue CasingThickness = 538;
+            static constexpr IntValue CasingDepth = 539;
+            static constexpr IntValue ShapeAspectStyle = 540;
+            static constexpr IntValue LiningToPanelOffsetX = 541;
+            static constexpr IntValue LiningToPanelOffsetY = 542;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDoorLiningProperties_CLASS_H
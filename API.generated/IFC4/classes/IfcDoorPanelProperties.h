@@ -0,0 +1,80 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDoorPanelProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcDoorPanelProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedPropertySet.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDoorPanelProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDoorPanelProperties : public RDF_EXPRESS_VIRTUAL IfcPreDefinedPropertySet
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDoorPanelProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDoorPanelProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 193);
+        }
+
+        /// <summary>
+        /// Instances of IfcDoorPanelProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDoorPanelProperties> Extent(SdaiModel model) { return ExtentRange<IfcDoorPanelProperties>(model, 193, false); }
+        static ExtentRange<IfcDoorPanelProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDoorPanelProperties>(model, 193, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDoorPanelProperties and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDoorPanelProperties Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDoorPanelProperties"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDoorPanelProperties if the actual type of SdaiInstance is IfcDoorPanelProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDoorPanelProperties CreateExactEntity(SdaiInstance instance) { return IfcDoorPanelProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDoorPanelProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDoorPanelProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_PanelDepth() { RDF_EXPRESS_PROBE(543); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(543), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_PanelDepth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(543); sdaiPutAttr(m_instance, getAttrDefinition(543), sdaiREAL, &value); }
+
+        Nullable<IfcDoorPanelOperationEnum> get_PanelOperation() { RDF_EXPRESS_PROBE(544); int v = getENUM(544, IfcDoorPanelOperationEnum_hash); if (v >= 0) return (IfcDoorPanelOperationEnum) v; else return Nullable<IfcDoorPanelOperationEnum>(); }
+        void put_PanelOperation(IfcDoorPanelOperationEnum value) { RDF_EXPRESS_PROBE(544); TextValue val = IfcDoorPanelOperationEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(544), sdaiENUM, val); }
+
+        Nullable<IfcNormalisedRatioMeasure> get_PanelWidth() { RDF_EXPRESS_PROBE(545); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(545), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_PanelWidth(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(545); sdaiPutAttr(m_instance, getAttrDefinition(545), sdaiREAL, &value); }
+
+        Nullable<IfcDoorPanelPositionEnum> get_PanelPosition() { RDF_EXPRESS_PROBE(546); int v = getENUM(546, IfcDoorPanelPositionEnum_hash); if (v >= 0) return (IfcDoorPanelPositionEnum) v; else return Nullable<IfcDoorPanelPositionEnum>(); }
+        void put_PanelPosition(IfcDoorPanelPositionEnum value) { RDF_EXPRESS_PROBE(546); TextValue val = IfcDoorPanelPositionEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(546), sdaiENUM, val); }
+
+        IfcShapeAspect get_ShapeAspectStyle();
+        void put_ShapeAspectStyle(IfcShapeAspect inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedPropertySet::attr
+        {
+            static constexpr IntValue PanelDepth = 543;
+            static constexpr IntValue PanelOperation = 544;
+            static constexpr IntValue PanelWidth = 545;
+            static constexpr IntValue PanelPosition = 546;
+            static constexpr IntValue ShapeAspectStyle = 547;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDoorPanelProperties_CLASS_H
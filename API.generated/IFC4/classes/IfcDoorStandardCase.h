@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDoorStandardCase_CLASS_H
+#define __RDF_LTD__IFC4_IfcDoorStandardCase_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDoor.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDoorStandardCase
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDoorStandardCase : public RDF_EXPRESS_VIRTUAL IfcDoor
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDoorStandardCase
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDoorStandardCase(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 194);
+        }
+
+        /// <summary>
+        /// Instances of IfcDoorStandardCase in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDoorStandardCase> Extent(SdaiModel model) { return ExtentRange<IfcDoorStandardCase>(model, 194, false); }
+        static ExtentRange<IfcDoorStandardCase> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDoorStandardCase>(model, 194, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDoorStandardCase and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDoorStandardCase Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDoorStandardCase"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDoorStandardCase if the actual type of SdaiInstance is IfcDoorStandardCase or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDoorStandardCase CreateExactEntity(SdaiInstance instance) { return IfcDoorStandardCase(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDoorStandardCase or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDoorStandardCase(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDoor::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDoorStandardCase_CLASS_H
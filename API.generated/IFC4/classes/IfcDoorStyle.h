@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDoorStyle_CLASS_H
+#define __RDF_LTD__IFC4_IfcDoorStyle_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTypeProduct.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDoorStyle
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDoorStyle : public RDF_EXPRESS_VIRTUAL IfcTypeProduct
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDoorStyle
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDoorStyle(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 195);
+        }
+
+        /// <summary>
+        /// Instances of IfcDoorStyle in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDoorStyle> Extent(SdaiModel model) { return ExtentRange<IfcDoorStyle>(model, 195, false); }
+        static ExtentRange<IfcDoorStyle> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDoorStyle>(model, 195, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDoorStyle and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDoorStyle Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDoorStyle"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDoorStyle if the actual type of SdaiInstance is IfcDoorStyle or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDoorStyle CreateExactEntity(SdaiInstance instance) { return IfcDoorStyle(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDoorStyle or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDoorStyle(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDoorStyleOperationEnum> get_OperationType() { RDF_EXPRESS_PROBE(548); int v = getENUM(548, IfcDoorStyleOperationEnum_hash); if (v >= 0) return (IfcDoorStyleOperationEnum) v; else return Nullable<IfcDoorStyleOperationEnum>(); }
+        void put_OperationType(IfcDoorStyleOperationEnum value) { RDF_EXPRESS_PROBE(548); TextValue val = IfcDoorStyleOperationEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(548), sdaiENUM, val); }
+
+        Nullable<IfcDoorStyleConstructionEnum> get_ConstructionType() { RDF_EXPRESS_PROBE(549); int v = getENUM(549, IfcDoorStyleConstructionEnum_hash); if (v >= 0) return (IfcDoorStyleConstructionEnum) v; else return Nullable<IfcDoorStyleConstructionEnum>(); }
+        void put_ConstructionType(IfcDoorStyleConstructionEnum value) { RDF_EXPRESS_PROBE(549); TextValue val = IfcDoorStyleConstructionEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(549), sdaiENUM, val); }
+
+        Nullable<IfcBoolean> get_ParameterTakesPrecedence() { RDF_EXPRESS_PROBE(550); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(550), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_ParameterTakesPrecedence(IfcBoolean value) { RDF_EXPRESS_PROBE(550); sdaiPutAttr(m_instance, getAttrDefinition(550), sdaiBOOLEAN, &value); }
+
+        Nullable<IfcBoolean> get_Sizeable() { RDF_EXPRESS_PROBE(551); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(551), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_Sizeable(IfcBoolean value) { RDF_EXPRESS_PROBE(551); sdaiPutAttr(m_instance, getAttrDefinition(551), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTypeProduct::attr
+        {
+            static constexpr IntValue OperationType = 548;
+            static constexpr IntValue ConstructionType = 549;
+            static constexpr IntValue ParameterTakesPrecedence = 550;
+            static constexpr IntValue Sizeable = 551;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDoorStyle_CLASS_H
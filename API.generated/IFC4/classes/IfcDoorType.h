@@ -0,0 +1,83 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDoorType_CLASS_H
+#define __RDF_LTD__IFC4_IfcDoorType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDoorType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDoorType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDoorType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDoorType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 196);
+        }
+
+        /// <summary>
+        /// Instances of IfcDoorType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDoorType> Extent(SdaiModel model) { return ExtentRange<IfcDoorType>(model, 196, false); }
+        static ExtentRange<IfcDoorType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDoorType>(model, 196, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDoorType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDoorType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDoorType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDoorType if the actual type of SdaiInstance is IfcDoorType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDoorType CreateExactEntity(SdaiInstance instance) { return IfcDoorType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDoorType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDoorType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDoorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(552); int v = getENUM(552, IfcDoorTypeEnum_hash); if (v >= 0) return (IfcDoorTypeEnum) v; else return Nullable<IfcDoorTypeEnum>(); }
+        void put_PredefinedType(IfcDoorTypeEnum value) { RDF_EXPRESS_PROBE(552); TextValue val = IfcDoorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(552), sdaiENUM, val); }
+
+        Nullable<IfcDoorTypeOperationEnum> get_OperationType() { RDF_EXPRESS_PROBE(553); int v = getENUM(553, IfcDoorTypeOperationEnum_hash); if (v >= 0) return (IfcDoorTypeOperationEnum) v; else return Nullable<IfcDoorTypeOperationEnum>(); }
+        void put_OperationType(IfcDoorTypeOperationEnum value) { RDF_EXPRESS_PROBE(553); TextValue val = IfcDoorTypeOperationEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(553), sdaiENUM, val); }
+
+        Nullable<IfcBoolean> get_ParameterTakesPrecedence() { RDF_EXPRESS_PROBE(554); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(554), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_ParameterTakesPrecedence(IfcBoolean value) { RDF_EXPRESS_PROBE(554); sdaiPutAttr(m_instance, getAttrDefinition(554), sdaiBOOLEAN, &value); }
+
+        IfcLabel get_UserDefinedOperationType() { RDF_EXPRESS_PROBE(555); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(555), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedOperationType_view() { return TextView(get_UserDefinedOperationType()); }
+#endif
+        void put_UserDefinedOperationType(IfcLabel value) { RDF_EXPRESS_PROBE(555); sdaiPutAttr(m_instance, getAttrDefinition(555), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedOperationType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(555); return buffer.GetAttr(m_instance, "UserDefinedOperationType"); }
+        const char* get_UserDefinedOperationType_utf8() { return get_UserDefinedOperationType_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 552;
+            static constexpr IntValue OperationType = 553;
+            static constexpr IntValue ParameterTakesPrecedence = 554;
+            static constexpr IntValue UserDefinedOperationType = 555;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDoorType_CLASS_H
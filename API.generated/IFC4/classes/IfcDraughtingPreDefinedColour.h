@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDraughtingPreDefinedColour_CLASS_H
+#define __RDF_LTD__IFC4_IfcDraughtingPreDefinedColour_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedColour.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDraughtingPreDefinedColour
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDraughtingPreDefinedColour : public RDF_EXPRESS_VIRTUAL IfcPreDefinedColour
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDraughtingPreDefinedColour
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDraughtingPreDefinedColour(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 197);
+        }
+
+        /// <summary>
+        /// Instances of IfcDraughtingPreDefinedColour in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDraughtingPreDefinedColour> Extent(SdaiModel model) { return ExtentRange<IfcDraughtingPreDefinedColour>(model, 197, false); }
+        static ExtentRange<IfcDraughtingPreDefinedColour> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDraughtingPreDefinedColour>(model, 197, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDraughtingPreDefinedColour and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDraughtingPreDefinedColour Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDraughtingPreDefinedColour"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDraughtingPreDefinedColour if the actual type of SdaiInstance is IfcDraughtingPreDefinedColour or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDraughtingPreDefinedColour CreateExactEntity(SdaiInstance instance) { return IfcDraughtingPreDefinedColour(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDraughtingPreDefinedColour or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDraughtingPreDefinedColour(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedColour::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDraughtingPreDefinedColour_CLASS_H
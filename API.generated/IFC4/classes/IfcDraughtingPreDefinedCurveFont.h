@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDraughtingPreDefinedCurveFont_CLASS_H
+#define __RDF_LTD__IFC4_IfcDraughtingPreDefinedCurveFont_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedCurveFont.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDraughtingPreDefinedCurveFont
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDraughtingPreDefinedCurveFont : public RDF_EXPRESS_VIRTUAL IfcPreDefinedCurveFont
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDraughtingPreDefinedCurveFont
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDraughtingPreDefinedCurveFont(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 198);
+        }
+
+        /// <summary>
+        /// Instances of IfcDraughtingPreDefinedCurveFont in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDraughtingPreDefinedCurveFont> Extent(SdaiModel model) { return ExtentRange<IfcDraughtingPreDefinedCurveFont>(model, 198, false); }
+        static ExtentRange<IfcDraughtingPreDefinedCurveFont> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDraughtingPreDefinedCurveFont>(model, 198, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDraughtingPreDefinedCurveFont and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDraughtingPreDefinedCurveFont Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDraughtingPreDefinedCurveFont"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDraughtingPreDefinedCurveFont if the actual type of SdaiInstance is IfcDraughtingPreDefinedCurveFont or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDraughtingPreDefinedCurveFont CreateExactEntity(SdaiInstance instance) { return IfcDraughtingPreDefinedCurveFont(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDraughtingPreDefinedCurveFont or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDraughtingPreDefinedCurveFont(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedCurveFont::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDraughtingPreDefinedCurveFont_CLASS_H
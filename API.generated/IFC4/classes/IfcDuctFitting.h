@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDuctFitting_CLASS_H
+#define __RDF_LTD__IFC4_IfcDuctFitting_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowFitting.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDuctFitting
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDuctFitting : public RDF_EXPRESS_VIRTUAL IfcFlowFitting
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDuctFitting
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDuctFitting(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 199);
+        }
+
+        /// <summary>
+        /// Instances of IfcDuctFitting in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDuctFitting> Extent(SdaiModel model) { return ExtentRange<IfcDuctFitting>(model, 199, false); }
+        static ExtentRange<IfcDuctFitting> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDuctFitting>(model, 199, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDuctFitting and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDuctFitting Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDuctFitting"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDuctFitting if the actual type of SdaiInstance is IfcDuctFitting or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDuctFitting CreateExactEntity(SdaiInstance instance) { return IfcDuctFitting(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDuctFitting or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDuctFitting(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDuctFittingTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(557); int v = getENUM(557, IfcDuctFittingTypeEnum_hash); if (v >= 0) return (IfcDuctFittingTypeEnum) v; else return Nullable<IfcDuctFittingTypeEnum>(); }
+        void put_PredefinedType(IfcDuctFittingTypeEnum value) { RDF_EXPRESS_PROBE(557); TextValue val = IfcDuctFittingTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(557), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowFitting::attr
+        {
+            static constexpr IntValue PredefinedType = 557;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDuctFitting_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDuctFittingType_CLASS_H
+#define __RDF_LTD__IFC4_IfcDuctFittingType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowFittingType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDuctFittingType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDuctFittingType : public RDF_EXPRESS_VIRTUAL IfcFlowFittingType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDuctFittingType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDuctFittingType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 200);
+        }
+
+        /// <summary>
+        /// Instances of IfcDuctFittingType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDuctFittingType> Extent(SdaiModel model) { return ExtentRange<IfcDuctFittingType>(model, 200, false); }
+        static ExtentRange<IfcDuctFittingType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDuctFittingType>(model, 200, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDuctFittingType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDuctFittingType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDuctFittingType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDuctFittingType if the actual type of SdaiInstance is IfcDuctFittingType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDuctFittingType CreateExactEntity(SdaiInstance instance) { return IfcDuctFittingType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDuctFittingType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDuctFittingType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDuctFittingTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(558); int v = getENUM(558, IfcDuctFittingTypeEnum_hash); if (v >= 0) return (IfcDuctFittingTypeEnum) v; else return Nullable<IfcDuctFittingTypeEnum>(); }
+        void put_PredefinedType(IfcDuctFittingTypeEnum value) { RDF_EXPRESS_PROBE(558); TextValue val = IfcDuctFittingTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(558), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowFittingType::attr
+        {
+            static constexpr IntValue PredefinedType = 558;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDuctFittingType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDuctSegment_CLASS_H
+#define __RDF_LTD__IFC4_IfcDuctSegment_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowSegment.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDuctSegment
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDuctSegment : public RDF_EXPRESS_VIRTUAL IfcFlowSegment
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDuctSegment
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDuctSegment(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 201);
+        }
+
+        /// <summary>
+        /// Instances of IfcDuctSegment in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDuctSegment> Extent(SdaiModel model) { return ExtentRange<IfcDuctSegment>(model, 201, false); }
+        static ExtentRange<IfcDuctSegment> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDuctSegment>(model, 201, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDuctSegment and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDuctSegment Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDuctSegment"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDuctSegment if the actual type of SdaiInstance is IfcDuctSegment or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDuctSegment CreateExactEntity(SdaiInstance instance) { return IfcDuctSegment(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDuctSegment or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDuctSegment(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDuctSegmentTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(559); int v = getENUM(559, IfcDuctSegmentTypeEnum_hash); if (v >= 0) return (IfcDuctSegmentTypeEnum) v; else return Nullable<IfcDuctSegmentTypeEnum>(); }
+        void put_PredefinedType(IfcDuctSegmentTypeEnum value) { RDF_EXPRESS_PROBE(559); TextValue val = IfcDuctSegmentTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(559), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowSegment::attr
+        {
+            static constexpr IntValue PredefinedType = 559;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDuctSegment_CLASS_H
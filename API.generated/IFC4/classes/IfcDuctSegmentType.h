@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDuctSegmentType_CLASS_H
+#define __RDF_LTD__IFC4_IfcDuctSegmentType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowSegmentType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDuctSegmentType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDuctSegmentType : public RDF_EXPRESS_VIRTUAL IfcFlowSegmentType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDuctSegmentType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDuctSegmentType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 202);
+        }
+
+        /// <summary>
+        /// Instances of IfcDuctSegmentType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDuctSegmentType> Extent(SdaiModel model) { return ExtentRange<IfcDuctSegmentType>(model, 202, false); }
+        static ExtentRange<IfcDuctSegmentType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDuctSegmentType>(model, 202, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDuctSegmentType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDuctSegmentType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDuctSegmentType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDuctSegmentType if the actual type of SdaiInstance is IfcDuctSegmentType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDuctSegmentType CreateExactEntity(SdaiInstance instance) { return IfcDuctSegmentType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDuctSegmentType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDuctSegmentType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDuctSegmentTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(560); int v = getENUM(560, IfcDuctSegmentTypeEnum_hash); if (v >= 0) return (IfcDuctSegmentTypeEnum) v; else return Nullable<IfcDuctSegmentTypeEnum>(); }
+        void put_PredefinedType(IfcDuctSegmentTypeEnum value) { RDF_EXPRESS_PROBE(560); TextValue val = IfcDuctSegmentTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(560), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowSegmentType::attr
+        {
+            static constexpr IntValue PredefinedType = 560;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDuctSegmentType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDuctSilencer_CLASS_H
+#define __RDF_LTD__IFC4_IfcDuctSilencer_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTreatmentDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDuctSilencer
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDuctSilencer : public RDF_EXPRESS_VIRTUAL IfcFlowTreatmentDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDuctSilencer
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDuctSilencer(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 203);
+        }
+
+        /// <summary>
+        /// Instances of IfcDuctSilencer in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDuctSilencer> Extent(SdaiModel model) { return ExtentRange<IfcDuctSilencer>(model, 203, false); }
+        static ExtentRange<IfcDuctSilencer> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDuctSilencer>(model, 203, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDuctSilencer and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDuctSilencer Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDuctSilencer"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDuctSilencer if the actual type of SdaiInstance is IfcDuctSilencer or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDuctSilencer CreateExactEntity(SdaiInstance instance) { return IfcDuctSilencer(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDuctSilencer or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDuctSilencer(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDuctSilencerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(561); int v = getENUM(561, IfcDuctSilencerTypeEnum_hash); if (v >= 0) return (IfcDuctSilencerTypeEnum) v; else return Nullable<IfcDuctSilencerTypeEnum>(); }
+        void put_PredefinedType(IfcDuctSilencerTypeEnum value) { RDF_EXPRESS_PROBE(561); TextValue val = IfcDuctSilencerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(561), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTreatmentDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 561;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDuctSilencer_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDuctSilencerType_CLASS_H
+#define __RDF_LTD__IFC4_IfcDuctSilencerType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTreatmentDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcDuctSilencerType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcDuctSilencerType : public RDF_EXPRESS_VIRTUAL IfcFlowTreatmentDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcDuctSilencerType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcDuctSilencerType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 204);
+        }
+
+        /// <summary>
+        /// Instances of IfcDuctSilencerType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcDuctSilencerType> Extent(SdaiModel model) { return ExtentRange<IfcDuctSilencerType>(model, 204, false); }
+        static ExtentRange<IfcDuctSilencerType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcDuctSilencerType>(model, 204, true); }
+
+        /// <summary>
+        /// Create new instance of IfcDuctSilencerType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcDuctSilencerType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcDuctSilencerType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcDuctSilencerType if the actual type of SdaiInstance is IfcDuctSilencerType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcDuctSilencerType CreateExactEntity(SdaiInstance instance) { return IfcDuctSilencerType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcDuctSilencerType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcDuctSilencerType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDuctSilencerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(562); int v = getENUM(562, IfcDuctSilencerTypeEnum_hash); if (v >= 0) return (IfcDuctSilencerTypeEnum) v; else return Nullable<IfcDuctSilencerTypeEnum>(); }
+        void put_PredefinedType(IfcDuctSilencerTypeEnum value) { RDF_EXPRESS_PROBE(562); TextValue val = IfcDuctSilencerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(562), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTreatmentDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 562;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcDuctSilencerType_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEdge_CLASS_H
+#define __RDF_LTD__IFC4_IfcEdge_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTopologicalRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEdge
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEdge : public RDF_EXPRESS_VIRTUAL IfcTopologicalRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEdge
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEdge(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 205);
+        }
+
+        /// <summary>
+        /// Instances of IfcEdge in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEdge> Extent(SdaiModel model) { return ExtentRange<IfcEdge>(model, 205, false); }
+        static ExtentRange<IfcEdge> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEdge>(model, 205, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEdge and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEdge Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEdge"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEdge if the actual type of SdaiInstance is IfcEdge or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEdge CreateExactEntity(SdaiInstance instance) { return IfcEdge(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEdge or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEdge(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcVertex get_EdgeStart();
+        void put_EdgeStart(IfcVertex inst);
+
+        IfcVertex get_EdgeEnd();
+        void put_EdgeEnd(IfcVertex inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTopologicalRepresentationItem::attr
+        {
+            static constexpr IntValue EdgeStart = 563;
+            static constexpr IntValue EdgeEnd = 564;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEdge_CLASS_H
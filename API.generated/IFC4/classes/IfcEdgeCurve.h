@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEdgeCurve_CLASS_H
+#define __RDF_LTD__IFC4_IfcEdgeCurve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEdge.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEdgeCurve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEdgeCurve : public RDF_EXPRESS_VIRTUAL IfcEdge
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEdgeCurve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEdgeCurve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 206);
+        }
+
+        /// <summary>
+        /// Instances of IfcEdgeCurve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEdgeCurve> Extent(SdaiModel model) { return ExtentRange<IfcEdgeCurve>(model, 206, false); }
+        static ExtentRange<IfcEdgeCurve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEdgeCurve>(model, 206, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEdgeCurve and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEdgeCurve Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEdgeCurve"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEdgeCurve if the actual type of SdaiInstance is IfcEdgeCurve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEdgeCurve CreateExactEntity(SdaiInstance instance) { return IfcEdgeCurve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEdgeCurve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEdgeCurve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurve get_EdgeGeometry();
+        void put_EdgeGeometry(IfcCurve inst);
+
+        Nullable<IfcBoolean> get_SameSense() { RDF_EXPRESS_PROBE(566); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(566), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_SameSense(IfcBoolean value) { RDF_EXPRESS_PROBE(566); sdaiPutAttr(m_instance, getAttrDefinition(566), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEdge::attr
+        {
+            static constexpr IntValue EdgeGeometry = 565;
+            static constexpr IntValue SameSense = 566;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEdgeCurve_CLASS_H
@@ -0,0 +1,73 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEdgeLoop_CLASS_H
+#define __RDF_LTD__IFC4_IfcEdgeLoop_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcLoop.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEdgeLoop
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEdgeLoop : public RDF_EXPRESS_VIRTUAL IfcLoop
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEdgeLoop
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEdgeLoop(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 207);
+        }
+
+        /// <summary>
+        /// Instances of IfcEdgeLoop in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEdgeLoop> Extent(SdaiModel model) { return ExtentRange<IfcEdgeLoop>(model, 207, false); }
+        static ExtentRange<IfcEdgeLoop> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEdgeLoop>(model, 207, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEdgeLoop and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEdgeLoop Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEdgeLoop"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEdgeLoop if the actual type of SdaiInstance is IfcEdgeLoop or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEdgeLoop CreateExactEntity(SdaiInstance instance) { return IfcEdgeLoop(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEdgeLoop or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEdgeLoop(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcOrientedEdge or list of convertible elements
+        template <typename TList> void get_EdgeList(TList& lst) { RDF_EXPRESS_PROBE(567); ListOfIfcOrientedEdgeSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(567)); }
+
+        //TList may be ListOfIfcOrientedEdge or list of convertible elements
+        template <typename TList> void put_EdgeList(TList& lst) { RDF_EXPRESS_PROBE(567); ListOfIfcOrientedEdgeSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(567)); }
+
+        //TArrayElem[] may be IfcOrientedEdge[] or array of convertible elements
+        template <typename TArrayElem> void put_EdgeList(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(567); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcOrientedEdgeSerializer<ListOfIfcOrientedEdge> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(567)); }
+
+        Nullable<IfcInteger> get_Ne() { RDF_EXPRESS_PROBE(568); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(568), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcLoop::attr
+        {
+            static constexpr IntValue EdgeList = 567;
+            static constexpr IntValue Ne = 568;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEdgeLoop_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricAppliance_CLASS_H
+#define __RDF_LTD__IFC4_IfcElectricAppliance_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElectricAppliance
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElectricAppliance : public RDF_EXPRESS_VIRTUAL IfcFlowTerminal
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElectricAppliance
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElectricAppliance(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 208);
+        }
+
+        /// <summary>
+        /// Instances of IfcElectricAppliance in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElectricAppliance> Extent(SdaiModel model) { return ExtentRange<IfcElectricAppliance>(model, 208, false); }
+        static ExtentRange<IfcElectricAppliance> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElectricAppliance>(model, 208, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElectricAppliance and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElectricAppliance Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElectricAppliance"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElectricAppliance if the actual type of SdaiInstance is IfcElectricAppliance or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElectricAppliance CreateExactEntity(SdaiInstance instance) { return IfcElectricAppliance(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElectricAppliance or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElectricAppliance(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElectricApplianceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(569); int v = getENUM(569, IfcElectricApplianceTypeEnum_hash); if (v >= 0) return (IfcElectricApplianceTypeEnum) v; else return Nullable<IfcElectricApplianceTypeEnum>(); }
+        void put_PredefinedType(IfcElectricApplianceTypeEnum value) { RDF_EXPRESS_PROBE(569); TextValue val = IfcElectricApplianceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(569), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminal::attr
+        {
+            static constexpr IntValue PredefinedType = 569;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricAppliance_CLASS_H
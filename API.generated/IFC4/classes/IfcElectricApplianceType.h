@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricApplianceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcElectricApplianceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElectricApplianceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElectricApplianceType : public RDF_EXPRESS_VIRTUAL IfcFlowTerminalType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElectricApplianceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElectricApplianceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 209);
+        }
+
+        /// <summary>
+        /// Instances of IfcElectricApplianceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElectricApplianceType> Extent(SdaiModel model) { return ExtentRange<IfcElectricApplianceType>(model, 209, false); }
+        static ExtentRange<IfcElectricApplianceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElectricApplianceType>(model, 209, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElectricApplianceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElectricApplianceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElectricApplianceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElectricApplianceType if the actual type of SdaiInstance is IfcElectricApplianceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElectricApplianceType CreateExactEntity(SdaiInstance instance) { return IfcElectricApplianceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElectricApplianceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElectricApplianceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElectricApplianceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(570); int v = getENUM(570, IfcElectricApplianceTypeEnum_hash); if (v >= 0) return (IfcElectricApplianceTypeEnum) v; else return Nullable<IfcElectricApplianceTypeEnum>(); }
+        void put_PredefinedType(IfcElectricApplianceTypeEnum value) { RDF_EXPRESS_PROBE(570); TextValue val = IfcElectricApplianceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(570), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminalType::attr
+        {
+            static constexpr IntValue PredefinedType = 570;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricApplianceType_CLASS_H
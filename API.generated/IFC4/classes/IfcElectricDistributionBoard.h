@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricDistributionBoard_CLASS_H
+#define __RDF_LTD__IFC4_IfcElectricDistributionBoard_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElectricDistributionBoard
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElectricDistributionBoard : public RDF_EXPRESS_VIRTUAL IfcFlowController
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElectricDistributionBoard
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElectricDistributionBoard(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 210);
+        }
+
+        /// <summary>
+        /// Instances of IfcElectricDistributionBoard in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElectricDistributionBoard> Extent(SdaiModel model) { return ExtentRange<IfcElectricDistributionBoard>(model, 210, false); }
+        static ExtentRange<IfcElectricDistributionBoard> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElectricDistributionBoard>(model, 210, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElectricDistributionBoard and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElectricDistributionBoard Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElectricDistributionBoard"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElectricDistributionBoard if the actual type of SdaiInstance is IfcElectricDistributionBoard or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElectricDistributionBoard CreateExactEntity(SdaiInstance instance) { return IfcElectricDistributionBoard(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElectricDistributionBoard or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElectricDistributionBoard(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElectricDistributionBoardTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(571); int v = getENUM(571, IfcElectricDistributionBoardTypeEnum_hash); if (v >= 0) return (IfcElectricDistributionBoardTypeEnum) v; else return Nullable<IfcElectricDistributionBoardTypeEnum>(); }
+        void put_PredefinedType(IfcElectricDistributionBoardTypeEnum value) { RDF_EXPRESS_PROBE(571); TextValue val = IfcElectricDistributionBoardTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(571), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowController::attr
+        {
+            static constexpr IntValue PredefinedType = 571;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricDistributionBoard_CLASS_H
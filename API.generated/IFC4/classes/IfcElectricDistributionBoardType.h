@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricDistributionBoardType_CLASS_H
+#define __RDF_LTD__IFC4_IfcElectricDistributionBoardType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElectricDistributionBoardType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElectricDistributionBoardType : public RDF_EXPRESS_VIRTUAL IfcFlowControllerType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElectricDistributionBoardType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElectricDistributionBoardType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 211);
+        }
+
+        /// <summary>
+        /// Instances of IfcElectricDistributionBoardType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElectricDistributionBoardType> Extent(SdaiModel model) { return ExtentRange<IfcElectricDistributionBoardType>(model, 211, false); }
+        static ExtentRange<IfcElectricDistributionBoardType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElectricDistributionBoardType>(model, 211, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElectricDistributionBoardType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElectricDistributionBoardType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElectricDistributionBoardType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElectricDistributionBoardType if the actual type of SdaiInstance is IfcElectricDistributionBoardType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElectricDistributionBoardType CreateExactEntity(SdaiInstance instance) { return IfcElectricDistributionBoardType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElectricDistributionBoardType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElectricDistributionBoardType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElectricDistributionBoardTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(572); int v = getENUM(572, IfcElectricDistributionBoardTypeEnum_hash); if (v >= 0) return (IfcElectricDistributionBoardTypeEnum) v; else return Nullable<IfcElectricDistributionBoardTypeEnum>(); }
+        void put_PredefinedType(IfcElectricDistributionBoardTypeEnum value) { RDF_EXPRESS_PROBE(572); TextValue val = IfcElectricDistributionBoardTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(572), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowControllerType::attr
+        {
+            static constexpr IntValue PredefinedType = 572;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricDistributionBoardType_CLASS_H
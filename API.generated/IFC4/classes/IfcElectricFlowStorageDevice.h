@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricFlowStorageDevice_CLASS_H
+#define __RDF_LTD__IFC4_IfcElectricFlowStorageDevice_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowStorageDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElectricFlowStorageDevice
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElectricFlowStorageDevice : public RDF_EXPRESS_VIRTUAL IfcFlowStorageDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElectricFlowStorageDevice
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElectricFlowStorageDevice(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 212);
+        }
+
+        /// <summary>
+        /// Instances of IfcElectricFlowStorageDevice in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElectricFlowStorageDevice> Extent(SdaiModel model) { return ExtentRange<IfcElectricFlowStorageDevice>(model, 212, false); }
+        static ExtentRange<IfcElectricFlowStorageDevice> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElectricFlowStorageDevice>(model, 212, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElectricFlowStorageDevice and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElectricFlowStorageDevice Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElectricFlowStorageDevice"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElectricFlowStorageDevice if the actual type of SdaiInstance is IfcElectricFlowStorageDevice or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElectricFlowStorageDevice CreateExactEntity(SdaiInstance instance) { return IfcElectricFlowStorageDevice(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElectricFlowStorageDevice or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElectricFlowStorageDevice(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElectricFlowStorageDeviceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(573); int v = getENUM(573, IfcElectricFlowStorageDeviceTypeEnum_hash); if (v >= 0) return (IfcElectricFlowStorageDeviceTypeEnum) v; else return Nullable<IfcElectricFlowStorageDeviceTypeEnum>(); }
+        void put_PredefinedType(IfcElectricFlowStorageDeviceTypeEnum value) { RDF_EXPRESS_PROBE(573); TextValue val = IfcElectricFlowStorageDeviceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(573), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowStorageDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 573;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricFlowStorageDevice_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricFlowStorageDeviceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcElectricFlowStorageDeviceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowStorageDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElectricFlowStorageDeviceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElectricFlowStorageDeviceType : public RDF_EXPRESS_VIRTUAL IfcFlowStorageDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElectricFlowStorageDeviceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElectricFlowStorageDeviceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 213);
+        }
+
+        /// <summary>
+        /// Instances of IfcElectricFlowStorageDeviceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElectricFlowStorageDeviceType> Extent(SdaiModel model) { return ExtentRange<IfcElectricFlowStorageDeviceType>(model, 213, false); }
+        static ExtentRange<IfcElectricFlowStorageDeviceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElectricFlowStorageDeviceType>(model, 213, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElectricFlowStorageDeviceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElectricFlowStorageDeviceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElectricFlowStorageDeviceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElectricFlowStorageDeviceType if the actual type of SdaiInstance is IfcElectricFlowStorageDeviceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElectricFlowStorageDeviceType CreateExactEntity(SdaiInstance instance) { return IfcElectricFlowStorageDeviceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElectricFlowStorageDeviceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElectricFlowStorageDeviceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElectricFlowStorageDeviceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(574); int v = getENUM(574, IfcElectricFlowStorageDeviceTypeEnum_hash); if (v >= 0) return (IfcElectricFlowStorageDeviceTypeEnum) v; else return Nullable<IfcElectricFlowStorageDeviceTypeEnum>(); }
+        void put_PredefinedType(IfcElectricFlowStorageDeviceTypeEnum value) { RDF_EXPRESS_PROBE(574); TextValue val = IfcElectricFlowStorageDeviceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(574), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowStorageDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 574;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricFlowStorageDeviceType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricGenerator_CLASS_H
+#define __RDF_LTD__IFC4_IfcElectricGenerator_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElectricGenerator
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElectricGenerator : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElectricGenerator
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElectricGenerator(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 214);
+        }
+
+        /// <summary>
+        /// Instances of IfcElectricGenerator in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElectricGenerator> Extent(SdaiModel model) { return ExtentRange<IfcElectricGenerator>(model, 214, false); }
+        static ExtentRange<IfcElectricGenerator> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElectricGenerator>(model, 214, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElectricGenerator and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElectricGenerator Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElectricGenerator"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElectricGenerator if the actual type of SdaiInstance is IfcElectricGenerator or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElectricGenerator CreateExactEntity(SdaiInstance instance) { return IfcElectricGenerator(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElectricGenerator or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElectricGenerator(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElectricGeneratorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(575); int v = getENUM(575, IfcElectricGeneratorTypeEnum_hash); if (v >= 0) return (IfcElectricGeneratorTypeEnum) v; else return Nullable<IfcElectricGeneratorTypeEnum>(); }
+        void put_PredefinedType(IfcElectricGeneratorTypeEnum value) { RDF_EXPRESS_PROBE(575); TextValue val = IfcElectricGeneratorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(575), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 575;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricGenerator_CLASS_H
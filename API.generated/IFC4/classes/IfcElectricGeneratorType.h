@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricGeneratorType_CLASS_H
+#define __RDF_LTD__IFC4_IfcElectricGeneratorType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElectricGeneratorType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElectricGeneratorType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElectricGeneratorType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElectricGeneratorType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 215);
+        }
+
+        /// <summary>
+        /// Instances of IfcElectricGeneratorType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElectricGeneratorType> Extent(SdaiModel model) { return ExtentRange<IfcElectricGeneratorType>(model, 215, false); }
+        static ExtentRange<IfcElectricGeneratorType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElectricGeneratorType>(model, 215, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElectricGeneratorType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElectricGeneratorType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElectricGeneratorType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElectricGeneratorType if the actual type of SdaiInstance is IfcElectricGeneratorType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElectricGeneratorType CreateExactEntity(SdaiInstance instance) { return IfcElectricGeneratorType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElectricGeneratorType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElectricGeneratorType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElectricGeneratorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(576); int v = getENUM(576, IfcElectricGeneratorTypeEnum_hash); if (v >= 0) return (IfcElectricGeneratorTypeEnum) v; else return Nullable<IfcElectricGeneratorTypeEnum>(); }
+        void put_PredefinedType(IfcElectricGeneratorTypeEnum value) { RDF_EXPRESS_PROBE(576); TextValue val = IfcElectricGeneratorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(576), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 576;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricGeneratorType_CLASS_H
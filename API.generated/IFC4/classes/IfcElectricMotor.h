@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricMotor_CLASS_H
+#define __RDF_LTD__IFC4_IfcElectricMotor_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElectricMotor
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElectricMotor : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElectricMotor
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElectricMotor(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 216);
+        }
+
+        /// <summary>
+        /// Instances of IfcElectricMotor in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElectricMotor> Extent(SdaiModel model) { return ExtentRange<IfcElectricMotor>(model, 216, false); }
+        static ExtentRange<IfcElectricMotor> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElectricMotor>(model, 216, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElectricMotor and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElectricMotor Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElectricMotor"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElectricMotor if the actual type of SdaiInstance is IfcElectricMotor or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElectricMotor CreateExactEntity(SdaiInstance instance) { return IfcElectricMotor(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElectricMotor or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElectricMotor(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElectricMotorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(577); int v = getENUM(577, IfcElectricMotorTypeEnum_hash); if (v >= 0) return (IfcElectricMotorTypeEnum) v; else return Nullable<IfcElectricMotorTypeEnum>(); }
+        void put_PredefinedType(IfcElectricMotorTypeEnum value) { RDF_EXPRESS_PROBE(577); TextValue val = IfcElectricMotorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(577), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 577;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricMotor_CLASS_H
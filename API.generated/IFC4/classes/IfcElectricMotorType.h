@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricMotorType_CLASS_H
+#define __RDF_LTD__IFC4_IfcElectricMotorType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElectricMotorType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElectricMotorType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElectricMotorType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElectricMotorType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 217);
+        }
+
+        /// <summary>
+        /// Instances of IfcElectricMotorType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElectricMotorType> Extent(SdaiModel model) { return ExtentRange<IfcElectricMotorType>(model, 217, false); }
+        static ExtentRange<IfcElectricMotorType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElectricMotorType>(model, 217, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElectricMotorType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElectricMotorType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElectricMotorType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElectricMotorType if the actual type of SdaiInstance is IfcElectricMotorType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElectricMotorType CreateExactEntity(SdaiInstance instance) { return IfcElectricMotorType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElectricMotorType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElectricMotorType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElectricMotorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(578); int v = getENUM(578, IfcElectricMotorTypeEnum_hash); if (v >= 0) return (IfcElectricMotorTypeEnum) v; else return Nullable<IfcElectricMotorTypeEnum>(); }
+        void put_PredefinedType(IfcElectricMotorTypeEnum value) { RDF_EXPRESS_PROBE(578); TextValue val = IfcElectricMotorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(578), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 578;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricMotorType_CLASS_H
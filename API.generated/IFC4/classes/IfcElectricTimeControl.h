@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricTimeControl_CLASS_H
+#define __RDF_LTD__IFC4_IfcElectricTimeControl_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElectricTimeControl
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElectricTimeControl : public RDF_EXPRESS_VIRTUAL IfcFlowController
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElectricTimeControl
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElectricTimeControl(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 218);
+        }
+
+        /// <summary>
+        /// Instances of IfcElectricTimeControl in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElectricTimeControl> Extent(SdaiModel model) { return ExtentRange<IfcElectricTimeControl>(model, 218, false); }
+        static ExtentRange<IfcElectricTimeControl> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElectricTimeControl>(model, 218, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElectricTimeControl and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElectricTimeControl Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElectricTimeControl"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElectricTimeControl if the actual type of SdaiInstance is IfcElectricTimeControl or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElectricTimeControl CreateExactEntity(SdaiInstance instance) { return IfcElectricTimeControl(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElectricTimeControl or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElectricTimeControl(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElectricTimeControlTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(579); int v = getENUM(579, IfcElectricTimeControlTypeEnum_hash); if (v >= 0) return (IfcElectricTimeControlTypeEnum) v; else return Nullable<IfcElectricTimeControlTypeEnum>(); }
+        void put_PredefinedType(IfcElectricTimeControlTypeEnum value) { RDF_EXPRESS_PROBE(579); TextValue val = IfcElectricTimeControlTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(579), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowController::attr
+        {
+            static constexpr IntValue PredefinedType = 579;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricTimeControl_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElectricTimeControlType_CLASS_H
+#define __RDF_LTD__IFC4_IfcElectricTimeControlType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElectricTimeControlType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElectricTimeControlType : public RDF_EXPRESS_VIRTUAL IfcFlowControllerType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElectricTimeControlType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElectricTimeControlType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 219);
+        }
+
+        /// <summary>
+        /// Instances of IfcElectricTimeControlType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElectricTimeControlType> Extent(SdaiModel model) { return ExtentRange<IfcElectricTimeControlType>(model, 219, false); }
+        static ExtentRange<IfcElectricTimeControlType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElectricTimeControlType>(model, 219, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElectricTimeControlType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElectricTimeControlType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElectricTimeControlType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElectricTimeControlType if the actual type of SdaiInstance is IfcElectricTimeControlType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElectricTimeControlType CreateExactEntity(SdaiInstance instance) { return IfcElectricTimeControlType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElectricTimeControlType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElectricTimeControlType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElectricTimeControlTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(580); int v = getENUM(580, IfcElectricTimeControlTypeEnum_hash); if (v >= 0) return (IfcElectricTimeControlTypeEnum) v; else return Nullable<IfcElectricTimeControlTypeEnum>(); }
+        void put_PredefinedType(IfcElectricTimeControlTypeEnum value) { RDF_EXPRESS_PROBE(580); TextValue val = IfcElectricTimeControlTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(580), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowControllerType::attr
+        {
+            static constexpr IntValue PredefinedType = 580;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElectricTimeControlType_CLASS_H
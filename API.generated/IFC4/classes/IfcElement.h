@@ -0,0 +1,115 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProduct.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElement : public RDF_EXPRESS_VIRTUAL IfcProduct
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 220);
+        }
+
+        /// <summary>
+        /// Instances of IfcElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElement> Extent(SdaiModel model) { return ExtentRange<IfcElement>(model, 220, false); }
+        static ExtentRange<IfcElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElement>(model, 220, true); }
+
+        /// <summary>
+        /// Returns object of IfcElement if the actual type of SdaiInstance is IfcElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElement CreateExactEntity(SdaiInstance instance) { return IfcElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Tag() { RDF_EXPRESS_PROBE(30); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(30), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Tag_view() { return TextView(get_Tag()); }
+#endif
+        void put_Tag(IfcIdentifier value) { RDF_EXPRESS_PROBE(30); sdaiPutAttr(m_instance, getAttrDefinition(30), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Tag_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(30); return buffer.GetAttr(m_instance, "Tag"); }
+        const char* get_Tag_utf8() { return get_Tag_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRelFillsElement or list of convertible elements
+        template <typename TList> void get_FillsVoids(TList& lst) { RDF_EXPRESS_PROBE(31); SetOfIfcRelFillsElementSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(31)); }
+
+        //TList may be SetOfIfcRelConnectsElements or list of convertible elements
+        template <typename TList> void get_ConnectedTo(TList& lst) { RDF_EXPRESS_PROBE(32); SetOfIfcRelConnectsElementsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(32)); }
+
+        //TList may be SetOfIfcRelInterferesElements or list of convertible elements
+        template <typename TList> void get_IsInterferedByElements(TList& lst) { RDF_EXPRESS_PROBE(33); SetOfIfcRelInterferesElementsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(33)); }
+
+        //TList may be SetOfIfcRelInterferesElements or list of convertible elements
+        template <typename TList> void get_InterferesElements(TList& lst) { RDF_EXPRESS_PROBE(34); SetOfIfcRelInterferesElementsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(34)); }
+
+        //TList may be SetOfIfcRelProjectsElement or list of convertible elements
+        template <typename TList> void get_HasProjections(TList& lst) { RDF_EXPRESS_PROBE(35); SetOfIfcRelProjectsElementSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(35)); }
+
+        //TList may be SetOfIfcRelReferencedInSpatialStructure or list of convertible elements
+        template <typename TList> void get_ReferencedInStructures(TList& lst) { RDF_EXPRESS_PROBE(36); SetOfIfcRelReferencedInSpatialStructureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(36)); }
+
+        //TList may be SetOfIfcRelVoidsElement or list of convertible elements
+        template <typename TList> void get_HasOpenings(TList& lst) { RDF_EXPRESS_PROBE(37); SetOfIfcRelVoidsElementSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(37)); }
+
+        //TList may be SetOfIfcRelConnectsWithRealizingElements or list of convertible elements
+        template <typename TList> void get_IsConnectionRealization(TList& lst) { RDF_EXPRESS_PROBE(38); SetOfIfcRelConnectsWithRealizingElementsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(38)); }
+
+        //TList may be SetOfIfcRelSpaceBoundary or list of convertible elements
+        template <typename TList> void get_ProvidesBoundaries(TList& lst) { RDF_EXPRESS_PROBE(39); SetOfIfcRelSpaceBoundarySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(39)); }
+
+        //TList may be SetOfIfcRelConnectsElements or list of convertible elements
+        template <typename TList> void get_ConnectedFrom(TList& lst) { RDF_EXPRESS_PROBE(40); SetOfIfcRelConnectsElementsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(40)); }
+
+        //TList may be SetOfIfcRelContainedInSpatialStructure or list of convertible elements
+        template <typename TList> void get_ContainedInStructure(TList& lst) { RDF_EXPRESS_PROBE(41); SetOfIfcRelContainedInSpatialStructureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(41)); }
+
+        //TList may be SetOfIfcRelCoversBldgElements or list of convertible elements
+        template <typename TList> void get_HasCoverings(TList& lst) { RDF_EXPRESS_PROBE(42); SetOfIfcRelCoversBldgElementsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(42)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProduct::attr
+        {
+            static constexpr IntValue Tag = 30;
+            static constexpr IntValue FillsVoids = 31;
+            static constexpr IntValue ConnectedTo = 32;
+            static constexpr IntValue IsInterferedByElements = 33;
+            static constexpr IntValue InterferesElements = 34;
+            static constexpr IntValue HasProjections = 35;
+            static constexpr IntValue ReferencedInStructures = 36;
+            static constexpr IntValue HasOpenings = 37;
+            static constexpr IntValue IsConnectionRealization = 38;
+            static constexpr IntValue ProvidesBoundaries = 39;
+            static constexpr IntValue ConnectedFrom = 40;
+            static constexpr IntValue ContainedInStructure = 41;
+            static constexpr IntValue HasCoverings = 42;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElement_CLASS_H
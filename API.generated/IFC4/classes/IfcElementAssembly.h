@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElementAssembly_CLASS_H
+#define __RDF_LTD__IFC4_IfcElementAssembly_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElementAssembly
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElementAssembly : public RDF_EXPRESS_VIRTUAL IfcElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElementAssembly
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElementAssembly(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 222);
+        }
+
+        /// <summary>
+        /// Instances of IfcElementAssembly in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElementAssembly> Extent(SdaiModel model) { return ExtentRange<IfcElementAssembly>(model, 222, false); }
+        static ExtentRange<IfcElementAssembly> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElementAssembly>(model, 222, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElementAssembly and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElementAssembly Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElementAssembly"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElementAssembly if the actual type of SdaiInstance is IfcElementAssembly or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElementAssembly CreateExactEntity(SdaiInstance instance) { return IfcElementAssembly(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElementAssembly or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElementAssembly(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAssemblyPlaceEnum> get_AssemblyPlace() { RDF_EXPRESS_PROBE(581); int v = getENUM(581, IfcAssemblyPlaceEnum_hash); if (v >= 0) return (IfcAssemblyPlaceEnum) v; else return Nullable<IfcAssemblyPlaceEnum>(); }
+        void put_AssemblyPlace(IfcAssemblyPlaceEnum value) { RDF_EXPRESS_PROBE(581); TextValue val = IfcAssemblyPlaceEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(581), sdaiENUM, val); }
+
+        Nullable<IfcElementAssemblyTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(582); int v = getENUM(582, IfcElementAssemblyTypeEnum_hash); if (v >= 0) return (IfcElementAssemblyTypeEnum) v; else return Nullable<IfcElementAssemblyTypeEnum>(); }
+        void put_PredefinedType(IfcElementAssemblyTypeEnum value) { RDF_EXPRESS_PROBE(582); TextValue val = IfcElementAssemblyTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(582), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElement::attr
+        {
+            static constexpr IntValue AssemblyPlace = 581;
+            static constexpr IntValue PredefinedType = 582;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElementAssembly_CLASS_H
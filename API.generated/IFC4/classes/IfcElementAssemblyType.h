@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElementAssemblyType_CLASS_H
+#define __RDF_LTD__IFC4_IfcElementAssemblyType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElementAssemblyType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElementAssemblyType : public RDF_EXPRESS_VIRTUAL IfcElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElementAssemblyType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElementAssemblyType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 223);
+        }
+
+        /// <summary>
+        /// Instances of IfcElementAssemblyType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElementAssemblyType> Extent(SdaiModel model) { return ExtentRange<IfcElementAssemblyType>(model, 223, false); }
+        static ExtentRange<IfcElementAssemblyType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElementAssemblyType>(model, 223, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElementAssemblyType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElementAssemblyType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElementAssemblyType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElementAssemblyType if the actual type of SdaiInstance is IfcElementAssemblyType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElementAssemblyType CreateExactEntity(SdaiInstance instance) { return IfcElementAssemblyType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElementAssemblyType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElementAssemblyType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElementAssemblyTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(583); int v = getENUM(583, IfcElementAssemblyTypeEnum_hash); if (v >= 0) return (IfcElementAssemblyTypeEnum) v; else return Nullable<IfcElementAssemblyTypeEnum>(); }
+        void put_PredefinedType(IfcElementAssemblyTypeEnum value) { RDF_EXPRESS_PROBE(583); TextValue val = IfcElementAssemblyTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(583), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 583;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElementAssemblyType_CLASS_H
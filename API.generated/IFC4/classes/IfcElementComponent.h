@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElementComponent_CLASS_H
+#define __RDF_LTD__IFC4_IfcElementComponent_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElementComponent
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElementComponent : public RDF_EXPRESS_VIRTUAL IfcElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElementComponent
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElementComponent(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 224);
+        }
+
+        /// <summary>
+        /// Instances of IfcElementComponent in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElementComponent> Extent(SdaiModel model) { return ExtentRange<IfcElementComponent>(model, 224, false); }
+        static ExtentRange<IfcElementComponent> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElementComponent>(model, 224, true); }
+
+        /// <summary>
+        /// Returns object of IfcElementComponent if the actual type of SdaiInstance is IfcElementComponent or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElementComponent CreateExactEntity(SdaiInstance instance) { return IfcElementComponent(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElementComponent or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElementComponent(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElement::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElementComponent_CLASS_H
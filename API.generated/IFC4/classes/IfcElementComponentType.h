@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElementComponentType_CLASS_H
+#define __RDF_LTD__IFC4_IfcElementComponentType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElementComponentType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElementComponentType : public RDF_EXPRESS_VIRTUAL IfcElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElementComponentType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElementComponentType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 225);
+        }
+
+        /// <summary>
+        /// Instances of IfcElementComponentType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElementComponentType> Extent(SdaiModel model) { return ExtentRange<IfcElementComponentType>(model, 225, false); }
+        static ExtentRange<IfcElementComponentType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElementComponentType>(model, 225, true); }
+
+        /// <summary>
+        /// Returns object of IfcElementComponentType if the actual type of SdaiInstance is IfcElementComponentType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElementComponentType CreateExactEntity(SdaiInstance instance) { return IfcElementComponentType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElementComponentType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElementComponentType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementType::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElementComponentType_CLASS_H
@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElementQuantity_CLASS_H
+#define __RDF_LTD__IFC4_IfcElementQuantity_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcQuantitySet.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElementQuantity
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElementQuantity : public RDF_EXPRESS_VIRTUAL IfcQuantitySet
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElementQuantity
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElementQuantity(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 226);
+        }
+
+        /// <summary>
+        /// Instances of IfcElementQuantity in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElementQuantity> Extent(SdaiModel model) { return ExtentRange<IfcElementQuantity>(model, 226, false); }
+        static ExtentRange<IfcElementQuantity> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElementQuantity>(model, 226, true); }
+
+        /// <summary>
+        /// Create new instance of IfcElementQuantity and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcElementQuantity Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcElementQuantity"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcElementQuantity if the actual type of SdaiInstance is IfcElementQuantity or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElementQuantity CreateExactEntity(SdaiInstance instance) { return IfcElementQuantity(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElementQuantity or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElementQuantity(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_MethodOfMeasurement() { RDF_EXPRESS_PROBE(584); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(584), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_MethodOfMeasurement_view() { return TextView(get_MethodOfMeasurement()); }
+#endif
+        void put_MethodOfMeasurement(IfcLabel value) { RDF_EXPRESS_PROBE(584); sdaiPutAttr(m_instance, getAttrDefinition(584), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_MethodOfMeasurement_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(584); return buffer.GetAttr(m_instance, "MethodOfMeasurement"); }
+        const char* get_MethodOfMeasurement_utf8() { return get_MethodOfMeasurement_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcPhysicalQuantity or list of convertible elements
+        template <typename TList> void get_Quantities(TList& lst) { RDF_EXPRESS_PROBE(585); SetOfIfcPhysicalQuantitySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(585)); }
+
+        //TList may be SetOfIfcPhysicalQuantity or list of convertible elements
+        template <typename TList> void put_Quantities(TList& lst) { RDF_EXPRESS_PROBE(585); SetOfIfcPhysicalQuantitySerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(585)); }
+
+        //TArrayElem[] may be IfcPhysicalQuantity[] or array of convertible elements
+        template <typename TArrayElem> void put_Quantities(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(585); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcPhysicalQuantitySerializer<SetOfIfcPhysicalQuantity> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(585)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcQuantitySet::attr
+        {
+            static constexpr IntValue MethodOfMeasurement = 584;
+            static constexpr IntValue Quantities = 585;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElementQuantity_CLASS_H
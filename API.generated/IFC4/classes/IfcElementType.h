@@ -0,0 +1,67 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTypeProduct.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElementType : public RDF_EXPRESS_VIRTUAL IfcTypeProduct
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 227);
+        }
+
+        /// <summary>
+        /// Instances of IfcElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElementType> Extent(SdaiModel model) { return ExtentRange<IfcElementType>(model, 227, false); }
+        static ExtentRange<IfcElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElementType>(model, 227, true); }
+
+        /// <summary>
+        /// Returns object of IfcElementType if the actual type of SdaiInstance is IfcElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElementType CreateExactEntity(SdaiInstance instance) { return IfcElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_ElementType() { RDF_EXPRESS_PROBE(52); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(52), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ElementType_view() { return TextView(get_ElementType()); }
+#endif
+        void put_ElementType(IfcLabel value) { RDF_EXPRESS_PROBE(52); sdaiPutAttr(m_instance, getAttrDefinition(52), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ElementType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(52); return buffer.GetAttr(m_instance, "ElementType"); }
+        const char* get_ElementType_utf8() { return get_ElementType_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTypeProduct::attr
+        {
+            static constexpr IntValue ElementType = 52;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElementType_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcElementarySurface_CLASS_H
+#define __RDF_LTD__IFC4_IfcElementarySurface_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcElementarySurface
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcElementarySurface : public RDF_EXPRESS_VIRTUAL IfcSurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcElementarySurface
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcElementarySurface(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 221);
+        }
+
+        /// <summary>
+        /// Instances of IfcElementarySurface in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcElementarySurface> Extent(SdaiModel model) { return ExtentRange<IfcElementarySurface>(model, 221, false); }
+        static ExtentRange<IfcElementarySurface> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcElementarySurface>(model, 221, true); }
+
+        /// <summary>
+        /// Returns object of IfcElementarySurface if the actual type of SdaiInstance is IfcElementarySurface or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcElementarySurface CreateExactEntity(SdaiInstance instance) { return IfcElementarySurface(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcElementarySurface or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcElementarySurface(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcAxis2Placement3D get_Position();
+        void put_Position(IfcAxis2Placement3D inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSurface::attr
+        {
+            static constexpr IntValue Position = 461;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcElementarySurface_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEllipse_CLASS_H
+#define __RDF_LTD__IFC4_IfcEllipse_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConic.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEllipse
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEllipse : public RDF_EXPRESS_VIRTUAL IfcConic
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEllipse
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEllipse(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 228);
+        }
+
+        /// <summary>
+        /// Instances of IfcEllipse in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEllipse> Extent(SdaiModel model) { return ExtentRange<IfcEllipse>(model, 228, false); }
+        static ExtentRange<IfcEllipse> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEllipse>(model, 228, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEllipse and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEllipse Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEllipse"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEllipse if the actual type of SdaiInstance is IfcEllipse or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEllipse CreateExactEntity(SdaiInstance instance) { return IfcEllipse(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEllipse or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEllipse(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_SemiAxis1() { RDF_EXPRESS_PROBE(586); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(586), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_SemiAxis1(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(586); sdaiPutAttr(m_instance, getAttrDefinition(586), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_SemiAxis2() { RDF_EXPRESS_PROBE(587); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(587), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_SemiAxis2(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(587); sdaiPutAttr(m_instance, getAttrDefinition(587), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConic::attr
+        {
+            static constexpr IntValue SemiAxis1 = 586;
+            static constexpr IntValue SemiAxis2 = 587;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEllipse_CLASS_H
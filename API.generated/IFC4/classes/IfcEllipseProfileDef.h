@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEllipseProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcEllipseProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEllipseProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEllipseProfileDef : public RDF_EXPRESS_VIRTUAL IfcParameterizedProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEllipseProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEllipseProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 229);
+        }
+
+        /// <summary>
+        /// Instances of IfcEllipseProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEllipseProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcEllipseProfileDef>(model, 229, false); }
+        static ExtentRange<IfcEllipseProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEllipseProfileDef>(model, 229, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEllipseProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEllipseProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEllipseProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEllipseProfileDef if the actual type of SdaiInstance is IfcEllipseProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEllipseProfileDef CreateExactEntity(SdaiInstance instance) { return IfcEllipseProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEllipseProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEllipseProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_SemiAxis1() { RDF_EXPRESS_PROBE(588); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(588), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_SemiAxis1(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(588); sdaiPutAttr(m_instance, getAttrDefinition(588), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_SemiAxis2() { RDF_EXPRESS_PROBE(589); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(589), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_SemiAxis2(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(589); sdaiPutAttr(m_instance, getAttrDefinition(589), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcParameterizedProfileDef::attr
+        {
+            static constexpr IntValue SemiAxis1 = 588;
+            static constexpr IntValue SemiAxis2 = 589;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEllipseProfileDef_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEnergyConversionDevice_CLASS_H
+#define __RDF_LTD__IFC4_IfcEnergyConversionDevice_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionFlowElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEnergyConversionDevice
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEnergyConversionDevice : public RDF_EXPRESS_VIRTUAL IfcDistributionFlowElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEnergyConversionDevice
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEnergyConversionDevice(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 230);
+        }
+
+        /// <summary>
+        /// Instances of IfcEnergyConversionDevice in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEnergyConversionDevice> Extent(SdaiModel model) { return ExtentRange<IfcEnergyConversionDevice>(model, 230, false); }
+        static ExtentRange<IfcEnergyConversionDevice> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEnergyConversionDevice>(model, 230, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEnergyConversionDevice and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEnergyConversionDevice Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEnergyConversionDevice"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEnergyConversionDevice if the actual type of SdaiInstance is IfcEnergyConversionDevice or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEnergyConversionDevice CreateExactEntity(SdaiInstance instance) { return IfcEnergyConversionDevice(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEnergyConversionDevice or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEnergyConversionDevice(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionFlowElement::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEnergyConversionDevice_CLASS_H
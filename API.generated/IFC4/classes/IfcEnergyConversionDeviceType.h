@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEnergyConversionDeviceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcEnergyConversionDeviceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionFlowElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEnergyConversionDeviceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEnergyConversionDeviceType : public RDF_EXPRESS_VIRTUAL IfcDistributionFlowElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEnergyConversionDeviceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEnergyConversionDeviceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 231);
+        }
+
+        /// <summary>
+        /// Instances of IfcEnergyConversionDeviceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEnergyConversionDeviceType> Extent(SdaiModel model) { return ExtentRange<IfcEnergyConversionDeviceType>(model, 231, false); }
+        static ExtentRange<IfcEnergyConversionDeviceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEnergyConversionDeviceType>(model, 231, true); }
+
+        /// <summary>
+        /// Returns object of IfcEnergyConversionDeviceType if the actual type of SdaiInstance is IfcEnergyConversionDeviceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEnergyConversionDeviceType CreateExactEntity(SdaiInstance instance) { return IfcEnergyConversionDeviceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEnergyConversionDeviceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEnergyConversionDeviceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionFlowElementType::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEnergyConversionDeviceType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEngine_CLASS_H
+#define __RDF_LTD__IFC4_IfcEngine_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEngine
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEngine : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEngine
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEngine(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 232);
+        }
+
+        /// <summary>
+        /// Instances of IfcEngine in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEngine> Extent(SdaiModel model) { return ExtentRange<IfcEngine>(model, 232, false); }
+        static ExtentRange<IfcEngine> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEngine>(model, 232, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEngine and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEngine Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEngine"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEngine if the actual type of SdaiInstance is IfcEngine or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEngine CreateExactEntity(SdaiInstance instance) { return IfcEngine(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEngine or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEngine(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcEngineTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(590); int v = getENUM(590, IfcEngineTypeEnum_hash); if (v >= 0) return (IfcEngineTypeEnum) v; else return Nullable<IfcEngineTypeEnum>(); }
+        void put_PredefinedType(IfcEngineTypeEnum value) { RDF_EXPRESS_PROBE(590); TextValue val = IfcEngineTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(590), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 590;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEngine_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEngineType_CLASS_H
+#define __RDF_LTD__IFC4_IfcEngineType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEngineType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEngineType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEngineType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEngineType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 233);
+        }
+
+        /// <summary>
+        /// Instances of IfcEngineType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEngineType> Extent(SdaiModel model) { return ExtentRange<IfcEngineType>(model, 233, false); }
+        static ExtentRange<IfcEngineType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEngineType>(model, 233, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEngineType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEngineType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEngineType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEngineType if the actual type of SdaiInstance is IfcEngineType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEngineType CreateExactEntity(SdaiInstance instance) { return IfcEngineType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEngineType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEngineType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcEngineTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(591); int v = getENUM(591, IfcEngineTypeEnum_hash); if (v >= 0) return (IfcEngineTypeEnum) v; else return Nullable<IfcEngineTypeEnum>(); }
+        void put_PredefinedType(IfcEngineTypeEnum value) { RDF_EXPRESS_PROBE(591); TextValue val = IfcEngineTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(591), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 591;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEngineType_CLASS_H
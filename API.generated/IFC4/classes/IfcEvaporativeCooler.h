@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEvaporativeCooler_CLASS_H
+#define __RDF_LTD__IFC4_IfcEvaporativeCooler_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEvaporativeCooler
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEvaporativeCooler : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEvaporativeCooler
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEvaporativeCooler(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 234);
+        }
+
+        /// <summary>
+        /// Instances of IfcEvaporativeCooler in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEvaporativeCooler> Extent(SdaiModel model) { return ExtentRange<IfcEvaporativeCooler>(model, 234, false); }
+        static ExtentRange<IfcEvaporativeCooler> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEvaporativeCooler>(model, 234, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEvaporativeCooler and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEvaporativeCooler Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEvaporativeCooler"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEvaporativeCooler if the actual type of SdaiInstance is IfcEvaporativeCooler or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEvaporativeCooler CreateExactEntity(SdaiInstance instance) { return IfcEvaporativeCooler(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEvaporativeCooler or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEvaporativeCooler(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcEvaporativeCoolerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(592); int v = getENUM(592, IfcEvaporativeCoolerTypeEnum_hash); if (v >= 0) return (IfcEvaporativeCoolerTypeEnum) v; else return Nullable<IfcEvaporativeCoolerTypeEnum>(); }
+        void put_PredefinedType(IfcEvaporativeCoolerTypeEnum value) { RDF_EXPRESS_PROBE(592); TextValue val = IfcEvaporativeCoolerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(592), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 592;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEvaporativeCooler_CLASS_H
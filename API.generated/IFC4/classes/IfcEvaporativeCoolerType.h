@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEvaporativeCoolerType_CLASS_H
+#define __RDF_LTD__IFC4_IfcEvaporativeCoolerType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEvaporativeCoolerType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEvaporativeCoolerType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEvaporativeCoolerType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEvaporativeCoolerType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 235);
+        }
+
+        /// <summary>
+        /// Instances of IfcEvaporativeCoolerType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEvaporativeCoolerType> Extent(SdaiModel model) { return ExtentRange<IfcEvaporativeCoolerType>(model, 235, false); }
+        static ExtentRange<IfcEvaporativeCoolerType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEvaporativeCoolerType>(model, 235, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEvaporativeCoolerType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEvaporativeCoolerType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEvaporativeCoolerType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEvaporativeCoolerType if the actual type of SdaiInstance is IfcEvaporativeCoolerType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEvaporativeCoolerType CreateExactEntity(SdaiInstance instance) { return IfcEvaporativeCoolerType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEvaporativeCoolerType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEvaporativeCoolerType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcEvaporativeCoolerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(593); int v = getENUM(593, IfcEvaporativeCoolerTypeEnum_hash); if (v >= 0) return (IfcEvaporativeCoolerTypeEnum) v; else return Nullable<IfcEvaporativeCoolerTypeEnum>(); }
+        void put_PredefinedType(IfcEvaporativeCoolerTypeEnum value) { RDF_EXPRESS_PROBE(593); TextValue val = IfcEvaporativeCoolerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(593), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 593;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEvaporativeCoolerType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEvaporator_CLASS_H
+#define __RDF_LTD__IFC4_IfcEvaporator_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEvaporator
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEvaporator : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEvaporator
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEvaporator(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 236);
+        }
+
+        /// <summary>
+        /// Instances of IfcEvaporator in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEvaporator> Extent(SdaiModel model) { return ExtentRange<IfcEvaporator>(model, 236, false); }
+        static ExtentRange<IfcEvaporator> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEvaporator>(model, 236, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEvaporator and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEvaporator Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEvaporator"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEvaporator if the actual type of SdaiInstance is IfcEvaporator or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEvaporator CreateExactEntity(SdaiInstance instance) { return IfcEvaporator(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEvaporator or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEvaporator(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcEvaporatorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(594); int v = getENUM(594, IfcEvaporatorTypeEnum_hash); if (v >= 0) return (IfcEvaporatorTypeEnum) v; else return Nullable<IfcEvaporatorTypeEnum>(); }
+        void put_PredefinedType(IfcEvaporatorTypeEnum value) { RDF_EXPRESS_PROBE(594); TextValue val = IfcEvaporatorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(594), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 594;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEvaporator_CLASS_H
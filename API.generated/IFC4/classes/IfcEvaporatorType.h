@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEvaporatorType_CLASS_H
+#define __RDF_LTD__IFC4_IfcEvaporatorType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEvaporatorType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEvaporatorType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEvaporatorType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEvaporatorType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 237);
+        }
+
+        /// <summary>
+        /// Instances of IfcEvaporatorType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEvaporatorType> Extent(SdaiModel model) { return ExtentRange<IfcEvaporatorType>(model, 237, false); }
+        static ExtentRange<IfcEvaporatorType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEvaporatorType>(model, 237, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEvaporatorType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEvaporatorType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEvaporatorType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEvaporatorType if the actual type of SdaiInstance is IfcEvaporatorType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEvaporatorType CreateExactEntity(SdaiInstance instance) { return IfcEvaporatorType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEvaporatorType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEvaporatorType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcEvaporatorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(595); int v = getENUM(595, IfcEvaporatorTypeEnum_hash); if (v >= 0) return (IfcEvaporatorTypeEnum) v; else return Nullable<IfcEvaporatorTypeEnum>(); }
+        void put_PredefinedType(IfcEvaporatorTypeEnum value) { RDF_EXPRESS_PROBE(595); TextValue val = IfcEvaporatorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(595), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 595;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEvaporatorType_CLASS_H
@@ -0,0 +1,83 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEvent_CLASS_H
+#define __RDF_LTD__IFC4_IfcEvent_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProcess.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEvent
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEvent : public RDF_EXPRESS_VIRTUAL IfcProcess
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEvent
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEvent(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 238);
+        }
+
+        /// <summary>
+        /// Instances of IfcEvent in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEvent> Extent(SdaiModel model) { return ExtentRange<IfcEvent>(model, 238, false); }
+        static ExtentRange<IfcEvent> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEvent>(model, 238, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEvent and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEvent Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEvent"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEvent if the actual type of SdaiInstance is IfcEvent or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEvent CreateExactEntity(SdaiInstance instance) { return IfcEvent(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEvent or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEvent(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcEventTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(601); int v = getENUM(601, IfcEventTypeEnum_hash); if (v >= 0) return (IfcEventTypeEnum) v; else return Nullable<IfcEventTypeEnum>(); }
+        void put_PredefinedType(IfcEventTypeEnum value) { RDF_EXPRESS_PROBE(601); TextValue val = IfcEventTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(601), sdaiENUM, val); }
+
+        Nullable<IfcEventTriggerTypeEnum> get_EventTriggerType() { RDF_EXPRESS_PROBE(602); int v = getENUM(602, IfcEventTriggerTypeEnum_hash); if (v >= 0) return (IfcEventTriggerTypeEnum) v; else return Nullable<IfcEventTriggerTypeEnum>(); }
+        void put_EventTriggerType(IfcEventTriggerTypeEnum value) { RDF_EXPRESS_PROBE(602); TextValue val = IfcEventTriggerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(602), sdaiENUM, val); }
+
+        IfcLabel get_UserDefinedEventTriggerType() { RDF_EXPRESS_PROBE(603); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(603), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedEventTriggerType_view() { return TextView(get_UserDefinedEventTriggerType()); }
+#endif
+        void put_UserDefinedEventTriggerType(IfcLabel value) { RDF_EXPRESS_PROBE(603); sdaiPutAttr(m_instance, getAttrDefinition(603), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedEventTriggerType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(603); return buffer.GetAttr(m_instance, "UserDefinedEventTriggerType"); }
+        const char* get_UserDefinedEventTriggerType_utf8() { return get_UserDefinedEventTriggerType_utf8(ThreadUtf8Buffer()); }
+
+        IfcEventTime get_EventOccurenceTime();
+        void put_EventOccurenceTime(IfcEventTime inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProcess::attr
+        {
+            static constexpr IntValue PredefinedType = 601;
+            static constexpr IntValue EventTriggerType = 602;
+            static constexpr IntValue UserDefinedEventTriggerType = 603;
+            static constexpr IntValue EventOccurenceTime = 604;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEvent_CLASS_H
@@ -0,0 +1,104 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEventTime_CLASS_H
+#define __RDF_LTD__IFC4_IfcEventTime_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSchedulingTime.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEventTime
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEventTime : public RDF_EXPRESS_VIRTUAL IfcSchedulingTime
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEventTime
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEventTime(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 239);
+        }
+
+        /// <summary>
+        /// Instances of IfcEventTime in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEventTime> Extent(SdaiModel model) { return ExtentRange<IfcEventTime>(model, 239, false); }
+        static ExtentRange<IfcEventTime> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEventTime>(model, 239, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEventTime and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEventTime Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEventTime"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEventTime if the actual type of SdaiInstance is IfcEventTime or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEventTime CreateExactEntity(SdaiInstance instance) { return IfcEventTime(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEventTime or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEventTime(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDateTime get_ActualDate() { RDF_EXPRESS_PROBE(608); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(608), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ActualDate_view() { return TextView(get_ActualDate()); }
+#endif
+        void put_ActualDate(IfcDateTime value) { RDF_EXPRESS_PROBE(608); sdaiPutAttr(m_instance, getAttrDefinition(608), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ActualDate_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(608); return buffer.GetAttr(m_instance, "ActualDate"); }
+        const char* get_ActualDate_utf8() { return get_ActualDate_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_EarlyDate() { RDF_EXPRESS_PROBE(609); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(609), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_EarlyDate_view() { return TextView(get_EarlyDate()); }
+#endif
+        void put_EarlyDate(IfcDateTime value) { RDF_EXPRESS_PROBE(609); sdaiPutAttr(m_instance, getAttrDefinition(609), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_EarlyDate_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(609); return buffer.GetAttr(m_instance, "EarlyDate"); }
+        const char* get_EarlyDate_utf8() { return get_EarlyDate_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_LateDate() { RDF_EXPRESS_PROBE(610); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(610), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LateDate_view() { return TextView(get_LateDate()); }
+#endif
+        void put_LateDate(IfcDateTime value) { RDF_EXPRESS_PROBE(610); sdaiPutAttr(m_instance, getAttrDefinition(610), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LateDate_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(610); return buffer.GetAttr(m_instance, "LateDate"); }
+        const char* get_LateDate_utf8() { return get_LateDate_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_ScheduleDate() { RDF_EXPRESS_PROBE(611); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(611), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ScheduleDate_view() { return TextView(get_ScheduleDate()); }
+#endif
+        void put_ScheduleDate(IfcDateTime value) { RDF_EXPRESS_PROBE(611); sdaiPutAttr(m_instance, getAttrDefinition(611), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ScheduleDate_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(611); return buffer.GetAttr(m_instance, "ScheduleDate"); }
+        const char* get_ScheduleDate_utf8() { return get_ScheduleDate_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSchedulingTime::attr
+        {
+            static constexpr IntValue ActualDate = 608;
+            static constexpr IntValue EarlyDate = 609;
+            static constexpr IntValue LateDate = 610;
+            static constexpr IntValue ScheduleDate = 611;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEventTime_CLASS_H
@@ -0,0 +1,79 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcEventType_CLASS_H
+#define __RDF_LTD__IFC4_IfcEventType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTypeProcess.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcEventType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcEventType : public RDF_EXPRESS_VIRTUAL IfcTypeProcess
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcEventType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcEventType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 240);
+        }
+
+        /// <summary>
+        /// Instances of IfcEventType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcEventType> Extent(SdaiModel model) { return ExtentRange<IfcEventType>(model, 240, false); }
+        static ExtentRange<IfcEventType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcEventType>(model, 240, true); }
+
+        /// <summary>
+        /// Create new instance of IfcEventType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcEventType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcEventType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcEventType if the actual type of SdaiInstance is IfcEventType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcEventType CreateExactEntity(SdaiInstance instance) { return IfcEventType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcEventType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcEventType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcEventTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(616); int v = getENUM(616, IfcEventTypeEnum_hash); if (v >= 0) return (IfcEventTypeEnum) v; else return Nullable<IfcEventTypeEnum>(); }
+        void put_PredefinedType(IfcEventTypeEnum value) { RDF_EXPRESS_PROBE(616); TextValue val = IfcEventTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(616), sdaiENUM, val); }
+
+        Nullable<IfcEventTriggerTypeEnum> get_EventTriggerType() { RDF_EXPRESS_PROBE(617); int v = getENUM(617, IfcEventTriggerTypeEnum_hash); if (v >= 0) return (IfcEventTriggerTypeEnum) v; else return Nullable<IfcEventTriggerTypeEnum>(); }
+        void put_EventTriggerType(IfcEventTriggerTypeEnum value) { RDF_EXPRESS_PROBE(617); TextValue val = IfcEventTriggerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(617), sdaiENUM, val); }
+
+        IfcLabel get_UserDefinedEventTriggerType() { RDF_EXPRESS_PROBE(618); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(618), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedEventTriggerType_view() { return TextView(get_UserDefinedEventTriggerType()); }
+#endif
+        void put_UserDefinedEventTriggerType(IfcLabel value) { RDF_EXPRESS_PROBE(618); sdaiPutAttr(m_instance, getAttrDefinition(618), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedEventTriggerType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(618); return buffer.GetAttr(m_instance, "UserDefinedEventTriggerType"); }
+        const char* get_UserDefinedEventTriggerType_utf8() { return get_UserDefinedEventTriggerType_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTypeProcess::attr
+        {
+            static constexpr IntValue PredefinedType = 616;
+            static constexpr IntValue EventTriggerType = 617;
+            static constexpr IntValue UserDefinedEventTriggerType = 618;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcEventType_CLASS_H
@@ -0,0 +1,88 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExtendedProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcExtendedProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPropertyAbstraction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcExtendedProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcExtendedProperties : public RDF_EXPRESS_VIRTUAL IfcPropertyAbstraction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcExtendedProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcExtendedProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 241);
+        }
+
+        /// <summary>
+        /// Instances of IfcExtendedProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcExtendedProperties> Extent(SdaiModel model) { return ExtentRange<IfcExtendedProperties>(model, 241, false); }
+        static ExtentRange<IfcExtendedProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcExtendedProperties>(model, 241, true); }
+
+        /// <summary>
+        /// Returns object of IfcExtendedProperties if the actual type of SdaiInstance is IfcExtendedProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcExtendedProperties CreateExactEntity(SdaiInstance instance) { return IfcExtendedProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcExtendedProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcExtendedProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Name() { RDF_EXPRESS_PROBE(619); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(619), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcIdentifier value) { RDF_EXPRESS_PROBE(619); sdaiPutAttr(m_instance, getAttrDefinition(619), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(619); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(620); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(620), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(620); sdaiPutAttr(m_instance, getAttrDefinition(620), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(620); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcProperty or list of convertible elements
+        template <typename TList> void get_Properties(TList& lst) { RDF_EXPRESS_PROBE(621); SetOfIfcPropertySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(621)); }
+
+        //TList may be SetOfIfcProperty or list of convertible elements
+        template <typename TList> void put_Properties(TList& lst) { RDF_EXPRESS_PROBE(621); SetOfIfcPropertySerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(621)); }
+
+        //TArrayElem[] may be IfcProperty[] or array of convertible elements
+        template <typename TArrayElem> void put_Properties(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(621); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcPropertySerializer<SetOfIfcProperty> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(621)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPropertyAbstraction::attr
+        {
+            static constexpr IntValue Name = 619;
+            static constexpr IntValue Description = 620;
+            static constexpr IntValue Properties = 621;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcExtendedProperties_CLASS_H
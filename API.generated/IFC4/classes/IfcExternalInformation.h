@@ -0,0 +1,55 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternalInformation_CLASS_H
+#define __RDF_LTD__IFC4_IfcExternalInformation_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcExternalInformation
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcExternalInformation : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcExternalInformation
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcExternalInformation(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 242);
+        }
+
+        /// <summary>
+        /// Instances of IfcExternalInformation in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcExternalInformation> Extent(SdaiModel model) { return ExtentRange<IfcExternalInformation>(model, 242, false); }
+        static ExtentRange<IfcExternalInformation> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcExternalInformation>(model, 242, true); }
+
+        /// <summary>
+        /// Returns object of IfcExternalInformation if the actual type of SdaiInstance is IfcExternalInformation or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcExternalInformation CreateExactEntity(SdaiInstance instance) { return IfcExternalInformation(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcExternalInformation or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcExternalInformation(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcExternalInformation_CLASS_H
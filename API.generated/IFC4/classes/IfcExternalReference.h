@@ -0,0 +1,92 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternalReference_CLASS_H
+#define __RDF_LTD__IFC4_IfcExternalReference_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcExternalReference
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcExternalReference : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcExternalReference
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcExternalReference(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 246);
+        }
+
+        /// <summary>
+        /// Instances of IfcExternalReference in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcExternalReference> Extent(SdaiModel model) { return ExtentRange<IfcExternalReference>(model, 246, false); }
+        static ExtentRange<IfcExternalReference> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcExternalReference>(model, 246, true); }
+
+        /// <summary>
+        /// Returns object of IfcExternalReference if the actual type of SdaiInstance is IfcExternalReference or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcExternalReference CreateExactEntity(SdaiInstance instance) { return IfcExternalReference(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcExternalReference or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcExternalReference(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcURIReference get_Location() { RDF_EXPRESS_PROBE(301); IfcURIReference val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(301), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Location_view() { return TextView(get_Location()); }
+#endif
+        void put_Location(IfcURIReference value) { RDF_EXPRESS_PROBE(301); sdaiPutAttr(m_instance, getAttrDefinition(301), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Location_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(301); return buffer.GetAttr(m_instance, "Location"); }
+        const char* get_Location_utf8() { return get_Location_utf8(ThreadUtf8Buffer()); }
+
+        IfcIdentifier get_Identification() { RDF_EXPRESS_PROBE(302); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(302), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Identification_view() { return TextView(get_Identification()); }
+#endif
+        void put_Identification(IfcIdentifier value) { RDF_EXPRESS_PROBE(302); sdaiPutAttr(m_instance, getAttrDefinition(302), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Identification_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(302); return buffer.GetAttr(m_instance, "Identification"); }
+        const char* get_Identification_utf8() { return get_Identification_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(303); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(303), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(303); sdaiPutAttr(m_instance, getAttrDefinition(303), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(303); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcExternalReferenceRelationship or list of convertible elements
+        template <typename TList> void get_ExternalReferenceForResources(TList& lst) { RDF_EXPRESS_PROBE(304); SetOfIfcExternalReferenceRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(304)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Location = 301;
+            static constexpr IntValue Identification = 302;
+            static constexpr IntValue Name = 303;
+            static constexpr IntValue ExternalReferenceForResources = 304;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcExternalReference_CLASS_H
@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternalReferenceRelationship_CLASS_H
+#define __RDF_LTD__IFC4_IfcExternalReferenceRelationship_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcResourceLevelRelationship.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcExternalReferenceRelationship
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcExternalReferenceRelationship : public RDF_EXPRESS_VIRTUAL IfcResourceLevelRelationship
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcExternalReferenceRelationship
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcExternalReferenceRelationship(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 247);
+        }
+
+        /// <summary>
+        /// Instances of IfcExternalReferenceRelationship in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcExternalReferenceRelationship> Extent(SdaiModel model) { return ExtentRange<IfcExternalReferenceRelationship>(model, 247, false); }
+        static ExtentRange<IfcExternalReferenceRelationship> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcExternalReferenceRelationship>(model, 247, true); }
+
+        /// <summary>
+        /// Create new instance of IfcExternalReferenceRelationship and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcExternalReferenceRelationship Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcExternalReferenceRelationship"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcExternalReferenceRelationship if the actual type of SdaiInstance is IfcExternalReferenceRelationship or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcExternalReferenceRelationship CreateExactEntity(SdaiInstance instance) { return IfcExternalReferenceRelationship(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcExternalReferenceRelationship or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcExternalReferenceRelationship(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcExternalReference get_RelatingReference();
+        void put_RelatingReference(IfcExternalReference inst);
+
+        //TList may be SetOfIfcResourceObjectSelect or list of convertible elements
+        template <typename TList> void get_RelatedResourceObjects(TList& lst) { RDF_EXPRESS_PROBE(623); SetOfIfcResourceObjectSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(623)); }
+
+        //TList may be SetOfIfcResourceObjectSelect or list of convertible elements
+        template <typename TList> void put_RelatedResourceObjects(TList& lst) { RDF_EXPRESS_PROBE(623); SetOfIfcResourceObjectSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(623)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcResourceLevelRelationship::attr
+        {
+            static constexpr IntValue RelatingReference = 622;
+            static constexpr IntValue RelatedResourceObjects = 623;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcExternalReferenceRelationship_CLASS_H
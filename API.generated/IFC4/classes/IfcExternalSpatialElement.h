@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternalSpatialElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcExternalSpatialElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcExternalSpatialStructureElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcExternalSpatialElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcExternalSpatialElement : public RDF_EXPRESS_VIRTUAL IfcExternalSpatialStructureElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcExternalSpatialElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcExternalSpatialElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 248);
+        }
+
+        /// <summary>
+        /// Instances of IfcExternalSpatialElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcExternalSpatialElement> Extent(SdaiModel model) { return ExtentRange<IfcExternalSpatialElement>(model, 248, false); }
+        static ExtentRange<IfcExternalSpatialElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcExternalSpatialElement>(model, 248, true); }
+
+        /// <summary>
+        /// Create new instance of IfcExternalSpatialElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcExternalSpatialElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcExternalSpatialElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcExternalSpatialElement if the actual type of SdaiInstance is IfcExternalSpatialElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcExternalSpatialElement CreateExactEntity(SdaiInstance instance) { return IfcExternalSpatialElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcExternalSpatialElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcExternalSpatialElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcExternalSpatialElementTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(624); int v = getENUM(624, IfcExternalSpatialElementTypeEnum_hash); if (v >= 0) return (IfcExternalSpatialElementTypeEnum) v; else return Nullable<IfcExternalSpatialElementTypeEnum>(); }
+        void put_PredefinedType(IfcExternalSpatialElementTypeEnum value) { RDF_EXPRESS_PROBE(624); TextValue val = IfcExternalSpatialElementTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(624), sdaiENUM, val); }
+
+        //TList may be SetOfIfcRelSpaceBoundary or list of convertible elements
+        template <typename TList> void get_BoundedBy(TList& lst) { RDF_EXPRESS_PROBE(625); SetOfIfcRelSpaceBoundarySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(625)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcExternalSpatialStructureElement::attr
+        {
+            static constexpr IntValue PredefinedType = 624;
+            static constexpr IntValue BoundedBy = 625;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcExternalSpatialElement_CLASS_H
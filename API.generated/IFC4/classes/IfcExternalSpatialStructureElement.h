@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternalSpatialStructureElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcExternalSpatialStructureElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSpatialElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcExternalSpatialStructureElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcExternalSpatialStructureElement : public RDF_EXPRESS_VIRTUAL IfcSpatialElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcExternalSpatialStructureElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcExternalSpatialStructureElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 249);
+        }
+
+        /// <summary>
+        /// Instances of IfcExternalSpatialStructureElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcExternalSpatialStructureElement> Extent(SdaiModel model) { return ExtentRange<IfcExternalSpatialStructureElement>(model, 249, false); }
+        static ExtentRange<IfcExternalSpatialStructureElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcExternalSpatialStructureElement>(model, 249, true); }
+
+        /// <summary>
+        /// Returns object of IfcExternalSpatialStructureElement if the actual type of SdaiInstance is IfcExternalSpatialStructureElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcExternalSpatialStructureElement CreateExactEntity(SdaiInstance instance) { return IfcExternalSpatialStructureElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcExternalSpatialStructureElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcExternalSpatialStructureElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSpatialElement::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcExternalSpatialStructureElement_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternallyDefinedHatchStyle_CLASS_H
+#define __RDF_LTD__IFC4_IfcExternallyDefinedHatchStyle_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcExternalReference.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcExternallyDefinedHatchStyle
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcExternallyDefinedHatchStyle : public RDF_EXPRESS_VIRTUAL IfcExternalReference
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcExternallyDefinedHatchStyle
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcExternallyDefinedHatchStyle(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 243);
+        }
+
+        /// <summary>
+        /// Instances of IfcExternallyDefinedHatchStyle in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcExternallyDefinedHatchStyle> Extent(SdaiModel model) { return ExtentRange<IfcExternallyDefinedHatchStyle>(model, 243, false); }
+        static ExtentRange<IfcExternallyDefinedHatchStyle> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcExternallyDefinedHatchStyle>(model, 243, true); }
+
+        /// <summary>
+        /// Create new instance of IfcExternallyDefinedHatchStyle and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcExternallyDefinedHatchStyle Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcExternallyDefinedHatchStyle"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcExternallyDefinedHatchStyle if the actual type of SdaiInstance is IfcExternallyDefinedHatchStyle or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcExternallyDefinedHatchStyle CreateExactEntity(SdaiInstance instance) { return IfcExternallyDefinedHatchStyle(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcExternallyDefinedHatchStyle or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcExternallyDefinedHatchStyle(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcExternalReference::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcExternallyDefinedHatchStyle_CLASS_H
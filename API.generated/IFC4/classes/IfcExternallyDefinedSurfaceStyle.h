@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternallyDefinedSurfaceStyle_CLASS_H
+#define __RDF_LTD__IFC4_IfcExternallyDefinedSurfaceStyle_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcExternalReference.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcExternallyDefinedSurfaceStyle
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcExternallyDefinedSurfaceStyle : public RDF_EXPRESS_VIRTUAL IfcExternalReference
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcExternallyDefinedSurfaceStyle
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcExternallyDefinedSurfaceStyle(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 244);
+        }
+
+        /// <summary>
+        /// Instances of IfcExternallyDefinedSurfaceStyle in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcExternallyDefinedSurfaceStyle> Extent(SdaiModel model) { return ExtentRange<IfcExternallyDefinedSurfaceStyle>(model, 244, false); }
+        static ExtentRange<IfcExternallyDefinedSurfaceStyle> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcExternallyDefinedSurfaceStyle>(model, 244, true); }
+
+        /// <summary>
+        /// Create new instance of IfcExternallyDefinedSurfaceStyle and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcExternallyDefinedSurfaceStyle Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcExternallyDefinedSurfaceStyle"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcExternallyDefinedSurfaceStyle if the actual type of SdaiInstance is IfcExternallyDefinedSurfaceStyle or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcExternallyDefinedSurfaceStyle CreateExactEntity(SdaiInstance instance) { return IfcExternallyDefinedSurfaceStyle(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcExternallyDefinedSurfaceStyle or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcExternallyDefinedSurfaceStyle(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcExternalReference::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcExternallyDefinedSurfaceStyle_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExternallyDefinedTextFont_CLASS_H
+#define __RDF_LTD__IFC4_IfcExternallyDefinedTextFont_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcExternalReference.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcExternallyDefinedTextFont
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcExternallyDefinedTextFont : public RDF_EXPRESS_VIRTUAL IfcExternalReference
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcExternallyDefinedTextFont
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcExternallyDefinedTextFont(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 245);
+        }
+
+        /// <summary>
+        /// Instances of IfcExternallyDefinedTextFont in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcExternallyDefinedTextFont> Extent(SdaiModel model) { return ExtentRange<IfcExternallyDefinedTextFont>(model, 245, false); }
+        static ExtentRange<IfcExternallyDefinedTextFont> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcExternallyDefinedTextFont>(model, 245, true); }
+
+        /// <summary>
+        /// Create new instance of IfcExternallyDefinedTextFont and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcExternallyDefinedTextFont Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcExternallyDefinedTextFont"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcExternallyDefinedTextFont if the actual type of SdaiInstance is IfcExternallyDefinedTextFont or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcExternallyDefinedTextFont CreateExactEntity(SdaiInstance instance) { return IfcExternallyDefinedTextFont(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcExternallyDefinedTextFont or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcExternallyDefinedTextFont(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcExternalReference::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcExternallyDefinedTextFont_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExtrudedAreaSolid_CLASS_H
+#define __RDF_LTD__IFC4_IfcExtrudedAreaSolid_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSweptAreaSolid.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcExtrudedAreaSolid
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcExtrudedAreaSolid : public RDF_EXPRESS_VIRTUAL IfcSweptAreaSolid
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcExtrudedAreaSolid
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcExtrudedAreaSolid(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 250);
+        }
+
+        /// <summary>
+        /// Instances of IfcExtrudedAreaSolid in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcExtrudedAreaSolid> Extent(SdaiModel model) { return ExtentRange<IfcExtrudedAreaSolid>(model, 250, false); }
+        static ExtentRange<IfcExtrudedAreaSolid> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcExtrudedAreaSolid>(model, 250, true); }
+
+        /// <summary>
+        /// Create new instance of IfcExtrudedAreaSolid and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcExtrudedAreaSolid Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcExtrudedAreaSolid"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcExtrudedAreaSolid if the actual type of SdaiInstance is IfcExtrudedAreaSolid or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcExtrudedAreaSolid CreateExactEntity(SdaiInstance instance) { return IfcExtrudedAreaSolid(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcExtrudedAreaSolid or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcExtrudedAreaSolid(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDirection get_ExtrudedDirection();
+        void put_ExtrudedDirection(IfcDirection inst);
+
+        Nullable<IfcPositiveLengthMeasure> get_Depth() { RDF_EXPRESS_PROBE(629); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(629), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Depth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(629); sdaiPutAttr(m_instance, getAttrDefinition(629), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSweptAreaSolid::attr
+        {
+            static constexpr IntValue ExtrudedDirection = 628;
+            static constexpr IntValue Depth = 629;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcExtrudedAreaSolid_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcExtrudedAreaSolidTapered_CLASS_H
+#define __RDF_LTD__IFC4_IfcExtrudedAreaSolidTapered_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcExtrudedAreaSolid.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcExtrudedAreaSolidTapered
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcExtrudedAreaSolidTapered : public RDF_EXPRESS_VIRTUAL IfcExtrudedAreaSolid
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcExtrudedAreaSolidTapered
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcExtrudedAreaSolidTapered(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 251);
+        }
+
+        /// <summary>
+        /// Instances of IfcExtrudedAreaSolidTapered in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcExtrudedAreaSolidTapered> Extent(SdaiModel model) { return ExtentRange<IfcExtrudedAreaSolidTapered>(model, 251, false); }
+        static ExtentRange<IfcExtrudedAreaSolidTapered> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcExtrudedAreaSolidTapered>(model, 251, true); }
+
+        /// <summary>
+        /// Create new instance of IfcExtrudedAreaSolidTapered and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcExtrudedAreaSolidTapered Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcExtrudedAreaSolidTapered"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcExtrudedAreaSolidTapered if the actual type of SdaiInstance is IfcExtrudedAreaSolidTapered or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcExtrudedAreaSolidTapered CreateExactEntity(SdaiInstance instance) { return IfcExtrudedAreaSolidTapered(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcExtrudedAreaSolidTapered or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcExtrudedAreaSolidTapered(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcProfileDef get_EndSweptArea();
+        void put_EndSweptArea(IfcProfileDef inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcExtrudedAreaSolid::attr
+        {
+            static constexpr IntValue EndSweptArea = 630;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcExtrudedAreaSolidTapered_CLASS_H
@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFace_CLASS_H
+#define __RDF_LTD__IFC4_IfcFace_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTopologicalRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFace
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFace : public RDF_EXPRESS_VIRTUAL IfcTopologicalRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFace
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFace(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 252);
+        }
+
+        /// <summary>
+        /// Instances of IfcFace in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFace> Extent(SdaiModel model) { return ExtentRange<IfcFace>(model, 252, false); }
+        static ExtentRange<IfcFace> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFace>(model, 252, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFace and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFace Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFace"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFace if the actual type of SdaiInstance is IfcFace or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFace CreateExactEntity(SdaiInstance instance) { return IfcFace(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFace or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFace(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcFaceBound or list of convertible elements
+        template <typename TList> void get_Bounds(TList& lst) { RDF_EXPRESS_PROBE(64); SetOfIfcFaceBoundSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(64)); }
+
+        //TList may be SetOfIfcFaceBound or list of convertible elements
+        template <typename TList> void put_Bounds(TList& lst) { RDF_EXPRESS_PROBE(64); SetOfIfcFaceBoundSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(64)); }
+
+        //TArrayElem[] may be IfcFaceBound[] or array of convertible elements
+        template <typename TArrayElem> void put_Bounds(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(64); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcFaceBoundSerializer<SetOfIfcFaceBound> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(64)); }
+
+        //TList may be SetOfIfcTextureMap or list of convertible elements
+        template <typename TList> void get_HasTextureMaps(TList& lst) { RDF_EXPRESS_PROBE(65); SetOfIfcTextureMapSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(65)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTopologicalRepresentationItem::attr
+        {
+            static constexpr IntValue Bounds = 64;
+            static constexpr IntValue HasTextureMaps = 65;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFace_CLASS_H
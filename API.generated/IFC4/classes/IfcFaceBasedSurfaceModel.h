@@ -0,0 +1,73 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFaceBasedSurfaceModel_CLASS_H
+#define __RDF_LTD__IFC4_IfcFaceBasedSurfaceModel_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFaceBasedSurfaceModel
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFaceBasedSurfaceModel : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFaceBasedSurfaceModel
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFaceBasedSurfaceModel(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 253);
+        }
+
+        /// <summary>
+        /// Instances of IfcFaceBasedSurfaceModel in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFaceBasedSurfaceModel> Extent(SdaiModel model) { return ExtentRange<IfcFaceBasedSurfaceModel>(model, 253, false); }
+        static ExtentRange<IfcFaceBasedSurfaceModel> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFaceBasedSurfaceModel>(model, 253, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFaceBasedSurfaceModel and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFaceBasedSurfaceModel Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFaceBasedSurfaceModel"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFaceBasedSurfaceModel if the actual type of SdaiInstance is IfcFaceBasedSurfaceModel or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFaceBasedSurfaceModel CreateExactEntity(SdaiInstance instance) { return IfcFaceBasedSurfaceModel(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFaceBasedSurfaceModel or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFaceBasedSurfaceModel(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcConnectedFaceSet or list of convertible elements
+        template <typename TList> void get_FbsmFaces(TList& lst) { RDF_EXPRESS_PROBE(631); SetOfIfcConnectedFaceSetSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(631)); }
+
+        //TList may be SetOfIfcConnectedFaceSet or list of convertible elements
+        template <typename TList> void put_FbsmFaces(TList& lst) { RDF_EXPRESS_PROBE(631); SetOfIfcConnectedFaceSetSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(631)); }
+
+        //TArrayElem[] may be IfcConnectedFaceSet[] or array of convertible elements
+        template <typename TArrayElem> void put_FbsmFaces(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(631); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcConnectedFaceSetSerializer<SetOfIfcConnectedFaceSet> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(631)); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(632); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(632), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue FbsmFaces = 631;
+            static constexpr IntValue Dim = 632;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFaceBasedSurfaceModel_CLASS_H
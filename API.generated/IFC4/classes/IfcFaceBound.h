@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFaceBound_CLASS_H
+#define __RDF_LTD__IFC4_IfcFaceBound_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTopologicalRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFaceBound
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFaceBound : public RDF_EXPRESS_VIRTUAL IfcTopologicalRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFaceBound
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFaceBound(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 254);
+        }
+
+        /// <summary>
+        /// Instances of IfcFaceBound in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFaceBound> Extent(SdaiModel model) { return ExtentRange<IfcFaceBound>(model, 254, false); }
+        static ExtentRange<IfcFaceBound> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFaceBound>(model, 254, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFaceBound and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFaceBound Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFaceBound"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFaceBound if the actual type of SdaiInstance is IfcFaceBound or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFaceBound CreateExactEntity(SdaiInstance instance) { return IfcFaceBound(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFaceBound or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFaceBound(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLoop get_Bound();
+        void put_Bound(IfcLoop inst);
+
+        Nullable<IfcBoolean> get_Orientation() { RDF_EXPRESS_PROBE(634); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(634), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_Orientation(IfcBoolean value) { RDF_EXPRESS_PROBE(634); sdaiPutAttr(m_instance, getAttrDefinition(634), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTopologicalRepresentationItem::attr
+        {
+            static constexpr IntValue Bound = 633;
+            static constexpr IntValue Orientation = 634;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFaceBound_CLASS_H
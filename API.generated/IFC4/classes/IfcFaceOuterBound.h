@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFaceOuterBound_CLASS_H
+#define __RDF_LTD__IFC4_IfcFaceOuterBound_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFaceBound.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFaceOuterBound
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFaceOuterBound : public RDF_EXPRESS_VIRTUAL IfcFaceBound
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFaceOuterBound
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFaceOuterBound(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 255);
+        }
+
+        /// <summary>
+        /// Instances of IfcFaceOuterBound in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFaceOuterBound> Extent(SdaiModel model) { return ExtentRange<IfcFaceOuterBound>(model, 255, false); }
+        static ExtentRange<IfcFaceOuterBound> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFaceOuterBound>(model, 255, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFaceOuterBound and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFaceOuterBound Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFaceOuterBound"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFaceOuterBound if the actual type of SdaiInstance is IfcFaceOuterBound or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFaceOuterBound CreateExactEntity(SdaiInstance instance) { return IfcFaceOuterBound(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFaceOuterBound or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFaceOuterBound(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFaceBound::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFaceOuterBound_CLASS_H
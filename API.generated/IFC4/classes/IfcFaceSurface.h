@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFaceSurface_CLASS_H
+#define __RDF_LTD__IFC4_IfcFaceSurface_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFace.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFaceSurface
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFaceSurface : public RDF_EXPRESS_VIRTUAL IfcFace
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFaceSurface
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFaceSurface(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 256);
+        }
+
+        /// <summary>
+        /// Instances of IfcFaceSurface in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFaceSurface> Extent(SdaiModel model) { return ExtentRange<IfcFaceSurface>(model, 256, false); }
+        static ExtentRange<IfcFaceSurface> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFaceSurface>(model, 256, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFaceSurface and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFaceSurface Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFaceSurface"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFaceSurface if the actual type of SdaiInstance is IfcFaceSurface or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFaceSurface CreateExactEntity(SdaiInstance instance) { return IfcFaceSurface(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFaceSurface or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFaceSurface(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcSurface get_FaceSurface();
+        void put_FaceSurface(IfcSurface inst);
+
+        Nullable<IfcBoolean> get_SameSense() { RDF_EXPRESS_PROBE(67); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(67), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_SameSense(IfcBoolean value) { RDF_EXPRESS_PROBE(67); sdaiPutAttr(m_instance, getAttrDefinition(67), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFace::attr
+        {
+            static constexpr IntValue FaceSurface = 66;
+            static constexpr IntValue SameSense = 67;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFaceSurface_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFacetedBrep_CLASS_H
+#define __RDF_LTD__IFC4_IfcFacetedBrep_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcManifoldSolidBrep.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFacetedBrep
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFacetedBrep : public RDF_EXPRESS_VIRTUAL IfcManifoldSolidBrep
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFacetedBrep
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFacetedBrep(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 257);
+        }
+
+        /// <summary>
+        /// Instances of IfcFacetedBrep in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFacetedBrep> Extent(SdaiModel model) { return ExtentRange<IfcFacetedBrep>(model, 257, false); }
+        static ExtentRange<IfcFacetedBrep> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFacetedBrep>(model, 257, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFacetedBrep and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFacetedBrep Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFacetedBrep"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFacetedBrep if the actual type of SdaiInstance is IfcFacetedBrep or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFacetedBrep CreateExactEntity(SdaiInstance instance) { return IfcFacetedBrep(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFacetedBrep or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFacetedBrep(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcManifoldSolidBrep::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFacetedBrep_CLASS_H
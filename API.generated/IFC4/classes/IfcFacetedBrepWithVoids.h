@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFacetedBrepWithVoids_CLASS_H
+#define __RDF_LTD__IFC4_IfcFacetedBrepWithVoids_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFacetedBrep.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFacetedBrepWithVoids
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFacetedBrepWithVoids : public RDF_EXPRESS_VIRTUAL IfcFacetedBrep
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFacetedBrepWithVoids
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFacetedBrepWithVoids(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 258);
+        }
+
+        /// <summary>
+        /// Instances of IfcFacetedBrepWithVoids in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFacetedBrepWithVoids> Extent(SdaiModel model) { return ExtentRange<IfcFacetedBrepWithVoids>(model, 258, false); }
+        static ExtentRange<IfcFacetedBrepWithVoids> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFacetedBrepWithVoids>(model, 258, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFacetedBrepWithVoids and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFacetedBrepWithVoids Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFacetedBrepWithVoids"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFacetedBrepWithVoids if the actual type of SdaiInstance is IfcFacetedBrepWithVoids or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFacetedBrepWithVoids CreateExactEntity(SdaiInstance instance) { return IfcFacetedBrepWithVoids(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFacetedBrepWithVoids or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFacetedBrepWithVoids(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcClosedShell or list of convertible elements
+        template <typename TList> void get_Voids(TList& lst) { RDF_EXPRESS_PROBE(635); SetOfIfcClosedShellSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(635)); }
+
+        //TList may be SetOfIfcClosedShell or list of convertible elements
+        template <typename TList> void put_Voids(TList& lst) { RDF_EXPRESS_PROBE(635); SetOfIfcClosedShellSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(635)); }
+
+        //TArrayElem[] may be IfcClosedShell[] or array of convertible elements
+        template <typename TArrayElem> void put_Voids(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(635); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcClosedShellSerializer<SetOfIfcClosedShell> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(635)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFacetedBrep::attr
+        {
+            static constexpr IntValue Voids = 635;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFacetedBrepWithVoids_CLASS_H
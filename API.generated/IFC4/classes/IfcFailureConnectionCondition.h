@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFailureConnectionCondition_CLASS_H
+#define __RDF_LTD__IFC4_IfcFailureConnectionCondition_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralConnectionCondition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFailureConnectionCondition
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFailureConnectionCondition : public RDF_EXPRESS_VIRTUAL IfcStructuralConnectionCondition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFailureConnectionCondition
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFailureConnectionCondition(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 259);
+        }
+
+        /// <summary>
+        /// Instances of IfcFailureConnectionCondition in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFailureConnectionCondition> Extent(SdaiModel model) { return ExtentRange<IfcFailureConnectionCondition>(model, 259, false); }
+        static ExtentRange<IfcFailureConnectionCondition> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFailureConnectionCondition>(model, 259, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFailureConnectionCondition and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFailureConnectionCondition Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFailureConnectionCondition"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFailureConnectionCondition if the actual type of SdaiInstance is IfcFailureConnectionCondition or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFailureConnectionCondition CreateExactEntity(SdaiInstance instance) { return IfcFailureConnectionCondition(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFailureConnectionCondition or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFailureConnectionCondition(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcForceMeasure> get_TensionFailureX() { RDF_EXPRESS_PROBE(637); IfcForceMeasure val = (IfcForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(637), sdaiREAL, &val)) return val; else return Nullable<IfcForceMeasure>(); }
+        void put_TensionFailureX(IfcForceMeasure value) { RDF_EXPRESS_PROBE(637); sdaiPutAttr(m_instance, getAttrDefinition(637), sdaiREAL, &value); }
+
+        Nullable<IfcForceMeasure> get_TensionFailureY() { RDF_EXPRESS_PROBE(638); IfcForceMeasure val = (IfcForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(638), sdaiREAL, &val)) return val; else return Nullable<IfcForceMeasure>(); }
+        void put_TensionFailureY(IfcForceMeasure value) { RDF_EXPRESS_PROBE(638); sdaiPutAttr(m_instance, getAttrDefinition(638), sdaiREAL, &value); }
+
+        Nullable<IfcForceMeasure> get_TensionFailureZ() { RDF_EXPRESS_PROBE(639); IfcForceMeasure val = (IfcForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(639), sdaiREAL, &val)) return val; else return Nullable<IfcForceMeasure>(); }
+        void put_TensionFailureZ(IfcForceMeasure value) { RDF_EXPRESS_PROBE(639); sdaiPutAttr(m_instance, getAttrDefinition(639), sdaiREAL, &value); }
+
+        Nullable<IfcForceMeasure> get_CompressionFailureX() { RDF_EXPRESS_PROBE(640); IfcForceMeasure val = (IfcForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(640), sdaiREAL, &val)) return val; else return Nullable<IfcForceMeasure>(); }
+        void put_CompressionFailureX(IfcForceMeasure value) { RDF_EXPRESS_PROBE(640); sdaiPutAttr(m_instance, getAttrDefinition(640), sdaiREAL, &value); }
+
+        Nullable<IfcForceMeasure> get_CompressionFailureY() { RDF_EXPRESS_PROBE(641); IfcForceMeasure val = (IfcForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(641), sdaiREAL, &val)) return val; else return Nullable<IfcForceMeasure>(); }
+        void put_CompressionFailureY(IfcForceMeasure value) { RDF_EXPRESS_PROBE(641); sdaiPutAttr(m_instance, getAttrDefinition(641), sdaiREAL, &value); }
+
+        Nullable<IfcForceMeasure> get_CompressionFailureZ() { RDF_EXPRESS_PROBE(642); IfcForceMeasure val = (IfcForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(642), sdaiREAL, &val)) return val; else return Nullable<IfcForceMeasure>(); }
+        void put_CompressionFailureZ(IfcForceMeasure value) { RDF_EXPRESS_PROBE(642); sdaiPutAttr(m_instance, getAttrDefinition(642), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralConnectionCondition::attr
+        {
+            static constexpr IntValue TensionFailureX = 637;
+            static constexpr IntValue TensionFailureY = 638;
+            static constexpr IntValue TensionFailureZ = 639;
+            static constexpr IntValue CompressionFailureX = 640;
+            static constexpr IntValue CompressionFailureY = 641;
+            static constexpr IntValue CompressionFailureZ = 642;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFailureConnectionCondition_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFan_CLASS_H
+#define __RDF_LTD__IFC4_IfcFan_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowMovingDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFan
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFan : public RDF_EXPRESS_VIRTUAL IfcFlowMovingDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFan
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFan(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 260);
+        }
+
+        /// <summary>
+        /// Instances of IfcFan in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFan> Extent(SdaiModel model) { return ExtentRange<IfcFan>(model, 260, false); }
+        static ExtentRange<IfcFan> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFan>(model, 260, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFan and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFan Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFan"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFan if the actual type of SdaiInstance is IfcFan or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFan CreateExactEntity(SdaiInstance instance) { return IfcFan(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFan or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFan(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFanTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(643); int v = getENUM(643, IfcFanTypeEnum_hash); if (v >= 0) return (IfcFanTypeEnum) v; else return Nullable<IfcFanTypeEnum>(); }
+        void put_PredefinedType(IfcFanTypeEnum value) { RDF_EXPRESS_PROBE(643); TextValue val = IfcFanTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(643), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowMovingDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 643;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFan_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFanType_CLASS_H
+#define __RDF_LTD__IFC4_IfcFanType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowMovingDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFanType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFanType : public RDF_EXPRESS_VIRTUAL IfcFlowMovingDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFanType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFanType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 261);
+        }
+
+        /// <summary>
+        /// Instances of IfcFanType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFanType> Extent(SdaiModel model) { return ExtentRange<IfcFanType>(model, 261, false); }
+        static ExtentRange<IfcFanType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFanType>(model, 261, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFanType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFanType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFanType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFanType if the actual type of SdaiInstance is IfcFanType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFanType CreateExactEntity(SdaiInstance instance) { return IfcFanType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFanType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFanType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFanTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(644); int v = getENUM(644, IfcFanTypeEnum_hash); if (v >= 0) return (IfcFanTypeEnum) v; else return Nullable<IfcFanTypeEnum>(); }
+        void put_PredefinedType(IfcFanTypeEnum value) { RDF_EXPRESS_PROBE(644); TextValue val = IfcFanTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(644), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowMovingDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 644;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFanType_CLASS_H
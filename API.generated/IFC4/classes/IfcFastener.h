@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFastener_CLASS_H
+#define __RDF_LTD__IFC4_IfcFastener_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementComponent.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFastener
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFastener : public RDF_EXPRESS_VIRTUAL IfcElementComponent
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFastener
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFastener(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 262);
+        }
+
+        /// <summary>
+        /// Instances of IfcFastener in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFastener> Extent(SdaiModel model) { return ExtentRange<IfcFastener>(model, 262, false); }
+        static ExtentRange<IfcFastener> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFastener>(model, 262, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFastener and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFastener Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFastener"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFastener if the actual type of SdaiInstance is IfcFastener or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFastener CreateExactEntity(SdaiInstance instance) { return IfcFastener(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFastener or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFastener(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFastenerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(645); int v = getENUM(645, IfcFastenerTypeEnum_hash); if (v >= 0) return (IfcFastenerTypeEnum) v; else return Nullable<IfcFastenerTypeEnum>(); }
+        void put_PredefinedType(IfcFastenerTypeEnum value) { RDF_EXPRESS_PROBE(645); TextValue val = IfcFastenerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(645), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementComponent::attr
+        {
+            static constexpr IntValue PredefinedType = 645;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFastener_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFastenerType_CLASS_H
+#define __RDF_LTD__IFC4_IfcFastenerType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementComponentType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFastenerType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFastenerType : public RDF_EXPRESS_VIRTUAL IfcElementComponentType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFastenerType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFastenerType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 263);
+        }
+
+        /// <summary>
+        /// Instances of IfcFastenerType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFastenerType> Extent(SdaiModel model) { return ExtentRange<IfcFastenerType>(model, 263, false); }
+        static ExtentRange<IfcFastenerType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFastenerType>(model, 263, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFastenerType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFastenerType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFastenerType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFastenerType if the actual type of SdaiInstance is IfcFastenerType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFastenerType CreateExactEntity(SdaiInstance instance) { return IfcFastenerType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFastenerType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFastenerType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFastenerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(646); int v = getENUM(646, IfcFastenerTypeEnum_hash); if (v >= 0) return (IfcFastenerTypeEnum) v; else return Nullable<IfcFastenerTypeEnum>(); }
+        void put_PredefinedType(IfcFastenerTypeEnum value) { RDF_EXPRESS_PROBE(646); TextValue val = IfcFastenerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(646), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementComponentType::attr
+        {
+            static constexpr IntValue PredefinedType = 646;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFastenerType_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFeatureElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcFeatureElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFeatureElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFeatureElement : public RDF_EXPRESS_VIRTUAL IfcElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFeatureElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFeatureElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 264);
+        }
+
+        /// <summary>
+        /// Instances of IfcFeatureElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFeatureElement> Extent(SdaiModel model) { return ExtentRange<IfcFeatureElement>(model, 264, false); }
+        static ExtentRange<IfcFeatureElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFeatureElement>(model, 264, true); }
+
+        /// <summary>
+        /// Returns object of IfcFeatureElement if the actual type of SdaiInstance is IfcFeatureElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFeatureElement CreateExactEntity(SdaiInstance instance) { return IfcFeatureElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFeatureElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFeatureElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElement::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFeatureElement_CLASS_H
@@ -0,0 +1,59 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFeatureElementAddition_CLASS_H
+#define __RDF_LTD__IFC4_IfcFeatureElementAddition_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFeatureElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFeatureElementAddition
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFeatureElementAddition : public RDF_EXPRESS_VIRTUAL IfcFeatureElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFeatureElementAddition
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFeatureElementAddition(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 265);
+        }
+
+        /// <summary>
+        /// Instances of IfcFeatureElementAddition in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFeatureElementAddition> Extent(SdaiModel model) { return ExtentRange<IfcFeatureElementAddition>(model, 265, false); }
+        static ExtentRange<IfcFeatureElementAddition> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFeatureElementAddition>(model, 265, true); }
+
+        /// <summary>
+        /// Returns object of IfcFeatureElementAddition if the actual type of SdaiInstance is IfcFeatureElementAddition or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFeatureElementAddition CreateExactEntity(SdaiInstance instance) { return IfcFeatureElementAddition(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFeatureElementAddition or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFeatureElementAddition(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcRelProjectsElement get_ProjectsElements();
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFeatureElement::attr
+        {
+            static constexpr IntValue ProjectsElements = 647;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFeatureElementAddition_CLASS_H
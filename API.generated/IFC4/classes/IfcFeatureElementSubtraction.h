@@ -0,0 +1,59 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFeatureElementSubtraction_CLASS_H
+#define __RDF_LTD__IFC4_IfcFeatureElementSubtraction_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFeatureElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFeatureElementSubtraction
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFeatureElementSubtraction : public RDF_EXPRESS_VIRTUAL IfcFeatureElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFeatureElementSubtraction
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFeatureElementSubtraction(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 266);
+        }
+
+        /// <summary>
+        /// Instances of IfcFeatureElementSubtraction in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFeatureElementSubtraction> Extent(SdaiModel model) { return ExtentRange<IfcFeatureElementSubtraction>(model, 266, false); }
+        static ExtentRange<IfcFeatureElementSubtraction> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFeatureElementSubtraction>(model, 266, true); }
+
+        /// <summary>
+        /// Returns object of IfcFeatureElementSubtraction if the actual type of SdaiInstance is IfcFeatureElementSubtraction or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFeatureElementSubtraction CreateExactEntity(SdaiInstance instance) { return IfcFeatureElementSubtraction(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFeatureElementSubtraction or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFeatureElementSubtraction(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcRelVoidsElement get_VoidsElements();
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFeatureElement::attr
+        {
+            static constexpr IntValue VoidsElements = 648;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFeatureElementSubtraction_CLASS_H
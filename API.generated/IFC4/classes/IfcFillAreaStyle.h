@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFillAreaStyle_CLASS_H
+#define __RDF_LTD__IFC4_IfcFillAreaStyle_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationStyle.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFillAreaStyle
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFillAreaStyle : public RDF_EXPRESS_VIRTUAL IfcPresentationStyle
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFillAreaStyle
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFillAreaStyle(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 267);
+        }
+
+        /// <summary>
+        /// Instances of IfcFillAreaStyle in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFillAreaStyle> Extent(SdaiModel model) { return ExtentRange<IfcFillAreaStyle>(model, 267, false); }
+        static ExtentRange<IfcFillAreaStyle> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFillAreaStyle>(model, 267, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFillAreaStyle and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFillAreaStyle Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFillAreaStyle"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFillAreaStyle if the actual type of SdaiInstance is IfcFillAreaStyle or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFillAreaStyle CreateExactEntity(SdaiInstance instance) { return IfcFillAreaStyle(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFillAreaStyle or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFillAreaStyle(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcFillStyleSelect or list of convertible elements
+        template <typename TList> void get_FillStyles(TList& lst) { RDF_EXPRESS_PROBE(649); SetOfIfcFillStyleSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(649)); }
+
+        //TList may be SetOfIfcFillStyleSelect or list of convertible elements
+        template <typename TList> void put_FillStyles(TList& lst) { RDF_EXPRESS_PROBE(649); SetOfIfcFillStyleSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(649)); }
+
+        Nullable<IfcBoolean> get_ModelorDraughting() { RDF_EXPRESS_PROBE(650); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(650), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_ModelorDraughting(IfcBoolean value) { RDF_EXPRESS_PROBE(650); sdaiPutAttr(m_instance, getAttrDefinition(650), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationStyle::attr
+        {
+            static constexpr IntValue FillStyles = 649;
+            static constexpr IntValue ModelorDraughting = 650;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFillAreaStyle_CLASS_H
@@ -0,0 +1,80 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFillAreaStyleHatching_CLASS_H
+#define __RDF_LTD__IFC4_IfcFillAreaStyleHatching_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFillAreaStyleHatching
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFillAreaStyleHatching : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFillAreaStyleHatching
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFillAreaStyleHatching(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 268);
+        }
+
+        /// <summary>
+        /// Instances of IfcFillAreaStyleHatching in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFillAreaStyleHatching> Extent(SdaiModel model) { return ExtentRange<IfcFillAreaStyleHatching>(model, 268, false); }
+        static ExtentRange<IfcFillAreaStyleHatching> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFillAreaStyleHatching>(model, 268, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFillAreaStyleHatching and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFillAreaStyleHatching Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFillAreaStyleHatching"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFillAreaStyleHatching if the actual type of SdaiInstance is IfcFillAreaStyleHatching or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFillAreaStyleHatching CreateExactEntity(SdaiInstance instance) { return IfcFillAreaStyleHatching(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFillAreaStyleHatching or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFillAreaStyleHatching(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurveStyle get_HatchLineAppearance();
+        void put_HatchLineAppearance(IfcCurveStyle inst);
+
+        IfcHatchLineDistanceSelect_get get_StartOfNextHatchLine() { return IfcHatchLineDistanceSelect_get(m_instance, 652); }
+        IfcHatchLineDistanceSelect_put put_StartOfNextHatchLine() { return IfcHatchLineDistanceSelect_put(m_instance, 652); }
+
+        IfcCartesianPoint get_PointOfReferenceHatchLine();
+        void put_PointOfReferenceHatchLine(IfcCartesianPoint inst);
+
+        IfcCartesianPoint get_PatternStart();
+        void put_PatternStart(IfcCartesianPoint inst);
+
+        Nullable<IfcPlaneAngleMeasure> get_HatchLineAngle() { RDF_EXPRESS_PROBE(655); IfcPlaneAngleMeasure val = (IfcPlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(655), sdaiREAL, &val)) return val; else return Nullable<IfcPlaneAngleMeasure>(); }
+        void put_HatchLineAngle(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(655); sdaiPutAttr(m_instance, getAttrDefinition(655), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue HatchLineAppearance = 651;
+            static constexpr IntValue StartOfNextHatchLine = 652;
+            static constexpr IntValue PointOfReferenceHatchLine = 653;
+            static constexpr IntValue PatternStart = 654;
+            static constexpr IntValue HatchLineAngle = 655;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFillAreaStyleHatching_CLASS_H
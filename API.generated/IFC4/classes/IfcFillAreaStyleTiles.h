@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFillAreaStyleTiles_CLASS_H
+#define __RDF_LTD__IFC4_IfcFillAreaStyleTiles_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFillAreaStyleTiles
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFillAreaStyleTiles : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFillAreaStyleTiles
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFillAreaStyleTiles(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 269);
+        }
+
+        /// <summary>
+        /// Instances of IfcFillAreaStyleTiles in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFillAreaStyleTiles> Extent(SdaiModel model) { return ExtentRange<IfcFillAreaStyleTiles>(model, 269, false); }
+        static ExtentRange<IfcFillAreaStyleTiles> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFillAreaStyleTiles>(model, 269, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFillAreaStyleTiles and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFillAreaStyleTiles Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFillAreaStyleTiles"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFillAreaStyleTiles if the actual type of SdaiInstance is IfcFillAreaStyleTiles or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFillAreaStyleTiles CreateExactEntity(SdaiInstance instance) { return IfcFillAreaStyleTiles(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFillAreaStyleTiles or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFillAreaStyleTiles(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcVector or list of convertible elements
+        template <typename TList> void get_TilingPattern(TList& lst) { RDF_EXPRESS_PROBE(656); ListOfIfcVectorSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(656)); }
+
+        //TList may be ListOfIfcVector or list of convertible elements
+        template <typename TList> void put_TilingPattern(TList& lst) { RDF_EXPRESS_PROBE(656); ListOfIfcVectorSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(656)); }
+
+        //TArrayElem[] may be IfcVector[] or array of convertible elements
+        template <typename TArrayElem> void put_TilingPattern(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(656); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcVectorSerializer<ListOfIfcVector> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(656)); }
+
+        //TList may be SetOfIfcStyledItem or list of convertible elements
+        template <typename TList> void get_Tiles(TList& lst) { RDF_EXPRESS_PROBE(657); SetOfIfcStyledItemSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(657)); }
+
+        //TList may be SetOfIfcStyledItem or list of convertible elements
+        template <typename TList> void put_Tiles(TList& lst) { RDF_EXPRESS_PROBE(657); SetOfIfcStyledItemSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(657)); }
+
+        //TArrayElem[] may be IfcStyledItem[] or array of convertible elements
+        template <typename TArrayElem> void put_Tiles(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(657); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcStyledItemSerializer<SetOfIfcStyledItem> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(657)); }
+
+        Nullable<IfcPositiveRatioMeasure> get_TilingScale() { RDF_EXPRESS_PROBE(658); IfcPositiveRatioMeasure val = (IfcPositiveRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(658), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveRatioMeasure>(); }
+        void put_TilingScale(IfcPositiveRatioMeasure value) { RDF_EXPRESS_PROBE(658); sdaiPutAttr(m_instance, getAttrDefinition(658), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue TilingPattern = 656;
+            static constexpr IntValue Tiles = 657;
+            static constexpr IntValue TilingScale = 658;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFillAreaStyleTiles_CLASS_H
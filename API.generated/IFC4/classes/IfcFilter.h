@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFilter_CLASS_H
+#define __RDF_LTD__IFC4_IfcFilter_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTreatmentDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFilter
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFilter : public RDF_EXPRESS_VIRTUAL IfcFlowTreatmentDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFilter
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFilter(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 270);
+        }
+
+        /// <summary>
+        /// Instances of IfcFilter in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFilter> Extent(SdaiModel model) { return ExtentRange<IfcFilter>(model, 270, false); }
+        static ExtentRange<IfcFilter> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFilter>(model, 270, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFilter and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFilter Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFilter"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFilter if the actual type of SdaiInstance is IfcFilter or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFilter CreateExactEntity(SdaiInstance instance) { return IfcFilter(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFilter or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFilter(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFilterTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(659); int v = getENUM(659, IfcFilterTypeEnum_hash); if (v >= 0) return (IfcFilterTypeEnum) v; else return Nullable<IfcFilterTypeEnum>(); }
+        void put_PredefinedType(IfcFilterTypeEnum value) { RDF_EXPRESS_PROBE(659); TextValue val = IfcFilterTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(659), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTreatmentDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 659;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFilter_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFilterType_CLASS_H
+#define __RDF_LTD__IFC4_IfcFilterType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTreatmentDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFilterType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFilterType : public RDF_EXPRESS_VIRTUAL IfcFlowTreatmentDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFilterType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFilterType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 271);
+        }
+
+        /// <summary>
+        /// Instances of IfcFilterType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFilterType> Extent(SdaiModel model) { return ExtentRange<IfcFilterType>(model, 271, false); }
+        static ExtentRange<IfcFilterType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFilterType>(model, 271, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFilterType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFilterType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFilterType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFilterType if the actual type of SdaiInstance is IfcFilterType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFilterType CreateExactEntity(SdaiInstance instance) { return IfcFilterType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFilterType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFilterType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFilterTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(660); int v = getENUM(660, IfcFilterTypeEnum_hash); if (v >= 0) return (IfcFilterTypeEnum) v; else return Nullable<IfcFilterTypeEnum>(); }
+        void put_PredefinedType(IfcFilterTypeEnum value) { RDF_EXPRESS_PROBE(660); TextValue val = IfcFilterTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(660), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTreatmentDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 660;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFilterType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFireSuppressionTerminal_CLASS_H
+#define __RDF_LTD__IFC4_IfcFireSuppressionTerminal_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFireSuppressionTerminal
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFireSuppressionTerminal : public RDF_EXPRESS_VIRTUAL IfcFlowTerminal
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFireSuppressionTerminal
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFireSuppressionTerminal(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 272);
+        }
+
+        /// <summary>
+        /// Instances of IfcFireSuppressionTerminal in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFireSuppressionTerminal> Extent(SdaiModel model) { return ExtentRange<IfcFireSuppressionTerminal>(model, 272, false); }
+        static ExtentRange<IfcFireSuppressionTerminal> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFireSuppressionTerminal>(model, 272, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFireSuppressionTerminal and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFireSuppressionTerminal Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFireSuppressionTerminal"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFireSuppressionTerminal if the actual type of SdaiInstance is IfcFireSuppressionTerminal or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFireSuppressionTerminal CreateExactEntity(SdaiInstance instance) { return IfcFireSuppressionTerminal(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFireSuppressionTerminal or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFireSuppressionTerminal(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFireSuppressionTerminalTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(661); int v = getENUM(661, IfcFireSuppressionTerminalTypeEnum_hash); if (v >= 0) return (IfcFireSuppressionTerminalTypeEnum) v; else return Nullable<IfcFireSuppressionTerminalTypeEnum>(); }
+        void put_PredefinedType(IfcFireSuppressionTerminalTypeEnum value) { RDF_EXPRESS_PROBE(661); TextValue val = IfcFireSuppressionTerminalTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(661), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminal::attr
+        {
+            static constexpr IntValue PredefinedType = 661;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFireSuppressionTerminal_CLASS_H
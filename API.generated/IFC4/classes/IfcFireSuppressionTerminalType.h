@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFireSuppressionTerminalType_CLASS_H
+#define __RDF_LTD__IFC4_IfcFireSuppressionTerminalType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFireSuppressionTerminalType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFireSuppressionTerminalType : public RDF_EXPRESS_VIRTUAL IfcFlowTerminalType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFireSuppressionTerminalType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFireSuppressionTerminalType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 273);
+        }
+
+        /// <summary>
+        /// Instances of IfcFireSuppressionTerminalType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFireSuppressionTerminalType> Extent(SdaiModel model) { return ExtentRange<IfcFireSuppressionTerminalType>(model, 273, false); }
+        static ExtentRange<IfcFireSuppressionTerminalType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFireSuppressionTerminalType>(model, 273, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFireSuppressionTerminalType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFireSuppressionTerminalType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFireSuppressionTerminalType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFireSuppressionTerminalType if the actual type of SdaiInstance is IfcFireSuppressionTerminalType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFireSuppressionTerminalType CreateExactEntity(SdaiInstance instance) { return IfcFireSuppressionTerminalType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFireSuppressionTerminalType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFireSuppressionTerminalType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFireSuppressionTerminalTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(662); int v = getENUM(662, IfcFireSuppressionTerminalTypeEnum_hash); if (v >= 0) return (IfcFireSuppressionTerminalTypeEnum) v; else return Nullable<IfcFireSuppressionTerminalTypeEnum>(); }
+        void put_PredefinedType(IfcFireSuppressionTerminalTypeEnum value) { RDF_EXPRESS_PROBE(662); TextValue val = IfcFireSuppressionTerminalTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(662), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminalType::attr
+        {
+            static constexpr IntValue PredefinedType = 662;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFireSuppressionTerminalType_CLASS_H
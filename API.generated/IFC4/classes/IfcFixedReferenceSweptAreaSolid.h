@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFixedReferenceSweptAreaSolid_CLASS_H
+#define __RDF_LTD__IFC4_IfcFixedReferenceSweptAreaSolid_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSweptAreaSolid.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFixedReferenceSweptAreaSolid
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFixedReferenceSweptAreaSolid : public RDF_EXPRESS_VIRTUAL IfcSweptAreaSolid
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFixedReferenceSweptAreaSolid
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFixedReferenceSweptAreaSolid(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 274);
+        }
+
+        /// <summary>
+        /// Instances of IfcFixedReferenceSweptAreaSolid in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFixedReferenceSweptAreaSolid> Extent(SdaiModel model) { return ExtentRange<IfcFixedReferenceSweptAreaSolid>(model, 274, false); }
+        static ExtentRange<IfcFixedReferenceSweptAreaSolid> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFixedReferenceSweptAreaSolid>(model, 274, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFixedReferenceSweptAreaSolid and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFixedReferenceSweptAreaSolid Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFixedReferenceSweptAreaSolid"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFixedReferenceSweptAreaSolid if the actual type of SdaiInstance is IfcFixedReferenceSweptAreaSolid or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFixedReferenceSweptAreaSolid CreateExactEntity(SdaiInstance instance) { return IfcFixedReferenceSweptAreaSolid(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFixedReferenceSweptAreaSolid or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFixedReferenceSweptAreaSolid(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurve get_Directrix();
+        void put_Directrix(IfcCurve inst);
+
+        Nullable<IfcParameterValue> get_StartParam() { RDF_EXPRESS_PROBE(664); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(664), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_StartParam(IfcParameterValue value) { RDF_EXPRESS_PROBE(664); sdaiPutAttr(m_instance, getAttrDefinition(664), sdaiREAL, &value); }
+
+        Nullable<IfcParameterValue> get_EndParam() { RDF_EXPRESS_PROBE(665); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(665), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_EndParam(IfcParameterValue value) { RDF_EXPRESS_PROBE(665); sdaiPutAttr(m_instance, getAttrDefinition(665), sdaiREAL, &value); }
+
+        IfcDirection get_FixedReference();
+        void put_FixedReference(IfcDirection inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSweptAreaSolid::attr
+        {
+            static constexpr IntValue Directrix = 663;
+            static constexpr IntValue StartParam = 664;
+            static constexpr IntValue EndParam = 665;
+            static constexpr IntValue FixedReference = 666;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFixedReferenceSweptAreaSolid_CLASS_H
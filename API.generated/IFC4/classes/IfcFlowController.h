@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowController_CLASS_H
+#define __RDF_LTD__IFC4_IfcFlowController_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionFlowElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFlowController
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFlowController : public RDF_EXPRESS_VIRTUAL IfcDistributionFlowElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFlowController
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFlowController(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 275);
+        }
+
+        /// <summary>
+        /// Instances of IfcFlowController in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFlowController> Extent(SdaiModel model) { return ExtentRange<IfcFlowController>(model, 275, false); }
+        static ExtentRange<IfcFlowController> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFlowController>(model, 275, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFlowController and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFlowController Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFlowController"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFlowController if the actual type of SdaiInstance is IfcFlowController or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFlowController CreateExactEntity(SdaiInstance instance) { return IfcFlowController(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFlowController or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFlowController(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionFlowElement::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowController_CLASS_H
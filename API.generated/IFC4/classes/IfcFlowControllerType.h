@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowControllerType_CLASS_H
+#define __RDF_LTD__IFC4_IfcFlowControllerType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionFlowElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFlowControllerType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFlowControllerType : public RDF_EXPRESS_VIRTUAL IfcDistributionFlowElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFlowControllerType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFlowControllerType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 276);
+        }
+
+        /// <summary>
+        /// Instances of IfcFlowControllerType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFlowControllerType> Extent(SdaiModel model) { return ExtentRange<IfcFlowControllerType>(model, 276, false); }
+        static ExtentRange<IfcFlowControllerType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFlowControllerType>(model, 276, true); }
+
+        /// <summary>
+        /// Returns object of IfcFlowControllerType if the actual type of SdaiInstance is IfcFlowControllerType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFlowControllerType CreateExactEntity(SdaiInstance instance) { return IfcFlowControllerType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFlowControllerType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFlowControllerType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionFlowElementType::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowControllerType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowInstrument_CLASS_H
+#define __RDF_LTD__IFC4_IfcFlowInstrument_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFlowInstrument
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFlowInstrument : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFlowInstrument
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFlowInstrument(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 279);
+        }
+
+        /// <summary>
+        /// Instances of IfcFlowInstrument in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFlowInstrument> Extent(SdaiModel model) { return ExtentRange<IfcFlowInstrument>(model, 279, false); }
+        static ExtentRange<IfcFlowInstrument> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFlowInstrument>(model, 279, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFlowInstrument and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFlowInstrument Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFlowInstrument"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFlowInstrument if the actual type of SdaiInstance is IfcFlowInstrument or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFlowInstrument CreateExactEntity(SdaiInstance instance) { return IfcFlowInstrument(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFlowInstrument or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFlowInstrument(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFlowInstrumentTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(667); int v = getENUM(667, IfcFlowInstrumentTypeEnum_hash); if (v >= 0) return (IfcFlowInstrumentTypeEnum) v; else return Nullable<IfcFlowInstrumentTypeEnum>(); }
+        void put_PredefinedType(IfcFlowInstrumentTypeEnum value) { RDF_EXPRESS_PROBE(667); TextValue val = IfcFlowInstrumentTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(667), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElement::attr
+        {
+            static constexpr IntValue PredefinedType = 667;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowInstrument_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowInstrumentType_CLASS_H
+#define __RDF_LTD__IFC4_IfcFlowInstrumentType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFlowInstrumentType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFlowInstrumentType : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFlowInstrumentType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFlowInstrumentType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 280);
+        }
+
+        /// <summary>
+        /// Instances of IfcFlowInstrumentType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFlowInstrumentType> Extent(SdaiModel model) { return ExtentRange<IfcFlowInstrumentType>(model, 280, false); }
+        static ExtentRange<IfcFlowInstrumentType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFlowInstrumentType>(model, 280, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFlowInstrumentType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFlowInstrumentType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFlowInstrumentType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFlowInstrumentType if the actual type of SdaiInstance is IfcFlowInstrumentType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFlowInstrumentType CreateExactEntity(SdaiInstance instance) { return IfcFlowInstrumentType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFlowInstrumentType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFlowInstrumentType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFlowInstrumentTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(668); int v = getENUM(668, IfcFlowInstrumentTypeEnum_hash); if (v >= 0) return (IfcFlowInstrumentTypeEnum) v; else return Nullable<IfcFlowInstrumentTypeEnum>(); }
+        void put_PredefinedType(IfcFlowInstrumentTypeEnum value) { RDF_EXPRESS_PROBE(668); TextValue val = IfcFlowInstrumentTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(668), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 668;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowInstrumentType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowMeter_CLASS_H
+#define __RDF_LTD__IFC4_IfcFlowMeter_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFlowMeter
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFlowMeter : public RDF_EXPRESS_VIRTUAL IfcFlowController
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFlowMeter
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFlowMeter(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 281);
+        }
+
+        /// <summary>
+        /// Instances of IfcFlowMeter in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFlowMeter> Extent(SdaiModel model) { return ExtentRange<IfcFlowMeter>(model, 281, false); }
+        static ExtentRange<IfcFlowMeter> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFlowMeter>(model, 281, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFlowMeter and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFlowMeter Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFlowMeter"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFlowMeter if the actual type of SdaiInstance is IfcFlowMeter or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFlowMeter CreateExactEntity(SdaiInstance instance) { return IfcFlowMeter(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFlowMeter or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFlowMeter(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFlowMeterTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(669); int v = getENUM(669, IfcFlowMeterTypeEnum_hash); if (v >= 0) return (IfcFlowMeterTypeEnum) v; else return Nullable<IfcFlowMeterTypeEnum>(); }
+        void put_PredefinedType(IfcFlowMeterTypeEnum value) { RDF_EXPRESS_PROBE(669); TextValue val = IfcFlowMeterTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(669), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowController::attr
+        {
+            static constexpr IntValue PredefinedType = 669;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowMeter_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowMeterType_CLASS_H
+#define __RDF_LTD__IFC4_IfcFlowMeterType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFlowMeterType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFlowMeterType : public RDF_EXPRESS_VIRTUAL IfcFlowControllerType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFlowMeterType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFlowMeterType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 282);
+        }
+
+        /// <summary>
+        /// Instances of IfcFlowMeterType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFlowMeterType> Extent(SdaiModel model) { return ExtentRange<IfcFlowMeterType>(model, 282, false); }
+        static ExtentRange<IfcFlowMeterType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFlowMeterType>(model, 282, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFlowMeterType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFlowMeterType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFlowMeterType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFlowMeterType if the actual type of SdaiInstance is IfcFlowMeterType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFlowMeterType CreateExactEntity(SdaiInstance instance) { return IfcFlowMeterType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFlowMeterType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFlowMeterType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFlowMeterTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(670); int v = getENUM(670, IfcFlowMeterTypeEnum_hash); if (v >= 0) return (IfcFlowMeterTypeEnum) v; else return Nullable<IfcFlowMeterTypeEnum>(); }
+        void put_PredefinedType(IfcFlowMeterTypeEnum value) { RDF_EXPRESS_PROBE(670); TextValue val = IfcFlowMeterTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(670), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowControllerType::attr
+        {
+            static constexpr IntValue PredefinedType = 670;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowMeterType_CLASS_H
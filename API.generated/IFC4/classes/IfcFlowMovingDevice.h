@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowMovingDevice_CLASS_H
+#define __RDF_LTD__IFC4_IfcFlowMovingDevice_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionFlowElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFlowMovingDevice
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFlowMovingDevice : public RDF_EXPRESS_VIRTUAL IfcDistributionFlowElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFlowMovingDevice
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFlowMovingDevice(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 283);
+        }
+
+        /// <summary>
+        /// Instances of IfcFlowMovingDevice in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFlowMovingDevice> Extent(SdaiModel model) { return ExtentRange<IfcFlowMovingDevice>(model, 283, false); }
+        static ExtentRange<IfcFlowMovingDevice> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFlowMovingDevice>(model, 283, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFlowMovingDevice and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFlowMovingDevice Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFlowMovingDevice"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFlowMovingDevice if the actual type of SdaiInstance is IfcFlowMovingDevice or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFlowMovingDevice CreateExactEntity(SdaiInstance instance) { return IfcFlowMovingDevice(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFlowMovingDevice or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFlowMovingDevice(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionFlowElement::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowMovingDevice_CLASS_H
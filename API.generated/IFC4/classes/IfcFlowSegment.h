@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowSegment_CLASS_H
+#define __RDF_LTD__IFC4_IfcFlowSegment_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionFlowElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFlowSegment
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFlowSegment : public RDF_EXPRESS_VIRTUAL IfcDistributionFlowElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFlowSegment
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFlowSegment(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 285);
+        }
+
+        /// <summary>
+        /// Instances of IfcFlowSegment in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFlowSegment> Extent(SdaiModel model) { return ExtentRange<IfcFlowSegment>(model, 285, false); }
+        static ExtentRange<IfcFlowSegment> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFlowSegment>(model, 285, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFlowSegment and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFlowSegment Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFlowSegment"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFlowSegment if the actual type of SdaiInstance is IfcFlowSegment or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFlowSegment CreateExactEntity(SdaiInstance instance) { return IfcFlowSegment(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFlowSegment or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFlowSegment(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionFlowElement::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowSegment_CLASS_H
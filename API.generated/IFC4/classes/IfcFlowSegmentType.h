@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowSegmentType_CLASS_H
+#define __RDF_LTD__IFC4_IfcFlowSegmentType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionFlowElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFlowSegmentType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFlowSegmentType : public RDF_EXPRESS_VIRTUAL IfcDistributionFlowElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFlowSegmentType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFlowSegmentType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 286);
+        }
+
+        /// <summary>
+        /// Instances of IfcFlowSegmentType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFlowSegmentType> Extent(SdaiModel model) { return ExtentRange<IfcFlowSegmentType>(model, 286, false); }
+        static ExtentRange<IfcFlowSegmentType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFlowSegmentType>(model, 286, true); }
+
+        /// <summary>
+        /// Returns object of IfcFlowSegmentType if the actual type of SdaiInstance is IfcFlowSegmentType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFlowSegmentType CreateExactEntity(SdaiInstance instance) { return IfcFlowSegmentType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFlowSegmentType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFlowSegmentType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionFlowElementType::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowSegmentType_CLASS_H
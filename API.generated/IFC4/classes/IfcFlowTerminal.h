@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowTerminal_CLASS_H
+#define __RDF_LTD__IFC4_IfcFlowTerminal_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionFlowElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFlowTerminal
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFlowTerminal : public RDF_EXPRESS_VIRTUAL IfcDistributionFlowElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFlowTerminal
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFlowTerminal(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 289);
+        }
+
+        /// <summary>
+        /// Instances of IfcFlowTerminal in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFlowTerminal> Extent(SdaiModel model) { return ExtentRange<IfcFlowTerminal>(model, 289, false); }
+        static ExtentRange<IfcFlowTerminal> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFlowTerminal>(model, 289, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFlowTerminal and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFlowTerminal Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFlowTerminal"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFlowTerminal if the actual type of SdaiInstance is IfcFlowTerminal or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFlowTerminal CreateExactEntity(SdaiInstance instance) { return IfcFlowTerminal(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFlowTerminal or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFlowTerminal(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionFlowElement::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowTerminal_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFlowTerminalType_CLASS_H
+#define __RDF_LTD__IFC4_IfcFlowTerminalType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionFlowElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFlowTerminalType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFlowTerminalType : public RDF_EXPRESS_VIRTUAL IfcDistributionFlowElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFlowTerminalType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFlowTerminalType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 290);
+        }
+
+        /// <summary>
+        /// Instances of IfcFlowTerminalType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFlowTerminalType> Extent(SdaiModel model) { return ExtentRange<IfcFlowTerminalType>(model, 290, false); }
+        static ExtentRange<IfcFlowTerminalType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFlowTerminalType>(model, 290, true); }
+
+        /// <summary>
+        /// Returns object of IfcFlowTerminalType if the actual type of SdaiInstance is IfcFlowTerminalType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFlowTerminalType CreateExactEntity(SdaiInstance instance) { return IfcFlowTerminalType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFlowTerminalType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFlowTerminalType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionFlowElementType::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFlowTerminalType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFooting_CLASS_H
+#define __RDF_LTD__IFC4_IfcFooting_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFooting
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFooting : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFooting
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFooting(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 293);
+        }
+
+        /// <summary>
+        /// Instances of IfcFooting in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFooting> Extent(SdaiModel model) { return ExtentRange<IfcFooting>(model, 293, false); }
+        static ExtentRange<IfcFooting> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFooting>(model, 293, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFooting and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFooting Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFooting"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFooting if the actual type of SdaiInstance is IfcFooting or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFooting CreateExactEntity(SdaiInstance instance) { return IfcFooting(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFooting or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFooting(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFootingTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(671); int v = getENUM(671, IfcFootingTypeEnum_hash); if (v >= 0) return (IfcFootingTypeEnum) v; else return Nullable<IfcFootingTypeEnum>(); }
+        void put_PredefinedType(IfcFootingTypeEnum value) { RDF_EXPRESS_PROBE(671); TextValue val = IfcFootingTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(671), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 671;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFooting_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFootingType_CLASS_H
+#define __RDF_LTD__IFC4_IfcFootingType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFootingType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFootingType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFootingType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFootingType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 294);
+        }
+
+        /// <summary>
+        /// Instances of IfcFootingType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFootingType> Extent(SdaiModel model) { return ExtentRange<IfcFootingType>(model, 294, false); }
+        static ExtentRange<IfcFootingType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFootingType>(model, 294, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFootingType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFootingType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFootingType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFootingType if the actual type of SdaiInstance is IfcFootingType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFootingType CreateExactEntity(SdaiInstance instance) { return IfcFootingType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFootingType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFootingType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFootingTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(672); int v = getENUM(672, IfcFootingTypeEnum_hash); if (v >= 0) return (IfcFootingTypeEnum) v; else return Nullable<IfcFootingTypeEnum>(); }
+        void put_PredefinedType(IfcFootingTypeEnum value) { RDF_EXPRESS_PROBE(672); TextValue val = IfcFootingTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(672), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 672;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFootingType_CLASS_H
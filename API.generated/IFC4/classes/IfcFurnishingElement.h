@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFurnishingElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcFurnishingElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFurnishingElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFurnishingElement : public RDF_EXPRESS_VIRTUAL IfcElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFurnishingElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFurnishingElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 295);
+        }
+
+        /// <summary>
+        /// Instances of IfcFurnishingElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFurnishingElement> Extent(SdaiModel model) { return ExtentRange<IfcFurnishingElement>(model, 295, false); }
+        static ExtentRange<IfcFurnishingElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFurnishingElement>(model, 295, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFurnishingElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFurnishingElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFurnishingElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFurnishingElement if the actual type of SdaiInstance is IfcFurnishingElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFurnishingElement CreateExactEntity(SdaiInstance instance) { return IfcFurnishingElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFurnishingElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFurnishingElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElement::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFurnishingElement_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFurnishingElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcFurnishingElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFurnishingElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFurnishingElementType : public RDF_EXPRESS_VIRTUAL IfcElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFurnishingElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFurnishingElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 296);
+        }
+
+        /// <summary>
+        /// Instances of IfcFurnishingElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFurnishingElementType> Extent(SdaiModel model) { return ExtentRange<IfcFurnishingElementType>(model, 296, false); }
+        static ExtentRange<IfcFurnishingElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFurnishingElementType>(model, 296, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFurnishingElementType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFurnishingElementType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFurnishingElementType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFurnishingElementType if the actual type of SdaiInstance is IfcFurnishingElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFurnishingElementType CreateExactEntity(SdaiInstance instance) { return IfcFurnishingElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFurnishingElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFurnishingElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementType::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFurnishingElementType_CLASS_H
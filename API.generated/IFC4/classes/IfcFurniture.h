@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFurniture_CLASS_H
+#define __RDF_LTD__IFC4_IfcFurniture_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFurnishingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFurniture
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFurniture : public RDF_EXPRESS_VIRTUAL IfcFurnishingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFurniture
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFurniture(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 297);
+        }
+
+        /// <summary>
+        /// Instances of IfcFurniture in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFurniture> Extent(SdaiModel model) { return ExtentRange<IfcFurniture>(model, 297, false); }
+        static ExtentRange<IfcFurniture> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFurniture>(model, 297, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFurniture and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFurniture Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFurniture"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFurniture if the actual type of SdaiInstance is IfcFurniture or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFurniture CreateExactEntity(SdaiInstance instance) { return IfcFurniture(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFurniture or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFurniture(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcFurnitureTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(673); int v = getENUM(673, IfcFurnitureTypeEnum_hash); if (v >= 0) return (IfcFurnitureTypeEnum) v; else return Nullable<IfcFurnitureTypeEnum>(); }
+        void put_PredefinedType(IfcFurnitureTypeEnum value) { RDF_EXPRESS_PROBE(673); TextValue val = IfcFurnitureTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(673), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFurnishingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 673;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFurniture_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFurnitureType_CLASS_H
+#define __RDF_LTD__IFC4_IfcFurnitureType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFurnishingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcFurnitureType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcFurnitureType : public RDF_EXPRESS_VIRTUAL IfcFurnishingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcFurnitureType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcFurnitureType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 298);
+        }
+
+        /// <summary>
+        /// Instances of IfcFurnitureType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcFurnitureType> Extent(SdaiModel model) { return ExtentRange<IfcFurnitureType>(model, 298, false); }
+        static ExtentRange<IfcFurnitureType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcFurnitureType>(model, 298, true); }
+
+        /// <summary>
+        /// Create new instance of IfcFurnitureType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcFurnitureType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcFurnitureType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcFurnitureType if the actual type of SdaiInstance is IfcFurnitureType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcFurnitureType CreateExactEntity(SdaiInstance instance) { return IfcFurnitureType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcFurnitureType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcFurnitureType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAssemblyPlaceEnum> get_AssemblyPlace() { RDF_EXPRESS_PROBE(674); int v = getENUM(674, IfcAssemblyPlaceEnum_hash); if (v >= 0) return (IfcAssemblyPlaceEnum) v; else return Nullable<IfcAssemblyPlaceEnum>(); }
+        void put_AssemblyPlace(IfcAssemblyPlaceEnum value) { RDF_EXPRESS_PROBE(674); TextValue val = IfcAssemblyPlaceEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(674), sdaiENUM, val); }
+
+        Nullable<IfcFurnitureTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(675); int v = getENUM(675, IfcFurnitureTypeEnum_hash); if (v >= 0) return (IfcFurnitureTypeEnum) v; else return Nullable<IfcFurnitureTypeEnum>(); }
+        void put_PredefinedType(IfcFurnitureTypeEnum value) { RDF_EXPRESS_PROBE(675); TextValue val = IfcFurnitureTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(675), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFurnishingElementType::attr
+        {
+            static constexpr IntValue AssemblyPlace = 674;
+            static constexpr IntValue PredefinedType = 675;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcFurnitureType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeographicElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcGeographicElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcGeographicElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcGeographicElement : public RDF_EXPRESS_VIRTUAL IfcElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcGeographicElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcGeographicElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 299);
+        }
+
+        /// <summary>
+        /// Instances of IfcGeographicElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcGeographicElement> Extent(SdaiModel model) { return ExtentRange<IfcGeographicElement>(model, 299, false); }
+        static ExtentRange<IfcGeographicElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcGeographicElement>(model, 299, true); }
+
+        /// <summary>
+        /// Create new instance of IfcGeographicElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcGeographicElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcGeographicElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcGeographicElement if the actual type of SdaiInstance is IfcGeographicElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcGeographicElement CreateExactEntity(SdaiInstance instance) { return IfcGeographicElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcGeographicElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcGeographicElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcGeographicElementTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(676); int v = getENUM(676, IfcGeographicElementTypeEnum_hash); if (v >= 0) return (IfcGeographicElementTypeEnum) v; else return Nullable<IfcGeographicElementTypeEnum>(); }
+        void put_PredefinedType(IfcGeographicElementTypeEnum value) { RDF_EXPRESS_PROBE(676); TextValue val = IfcGeographicElementTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(676), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElement::attr
+        {
+            static constexpr IntValue PredefinedType = 676;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcGeographicElement_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeographicElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcGeographicElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcGeographicElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcGeographicElementType : public RDF_EXPRESS_VIRTUAL IfcElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcGeographicElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcGeographicElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 300);
+        }
+
+        /// <summary>
+        /// Instances of IfcGeographicElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcGeographicElementType> Extent(SdaiModel model) { return ExtentRange<IfcGeographicElementType>(model, 300, false); }
+        static ExtentRange<IfcGeographicElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcGeographicElementType>(model, 300, true); }
+
+        /// <summary>
+        /// Create new instance of IfcGeographicElementType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcGeographicElementType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcGeographicElementType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcGeographicElementType if the actual type of SdaiInstance is IfcGeographicElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcGeographicElementType CreateExactEntity(SdaiInstance instance) { return IfcGeographicElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcGeographicElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcGeographicElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcGeographicElementTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(677); int v = getENUM(677, IfcGeographicElementTypeEnum_hash); if (v >= 0) return (IfcGeographicElementTypeEnum) v; else return Nullable<IfcGeographicElementTypeEnum>(); }
+        void put_PredefinedType(IfcGeographicElementTypeEnum value) { RDF_EXPRESS_PROBE(677); TextValue val = IfcGeographicElementTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(677), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 677;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcGeographicElementType_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeometricCurveSet_CLASS_H
+#define __RDF_LTD__IFC4_IfcGeometricCurveSet_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricSet.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcGeometricCurveSet
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcGeometricCurveSet : public RDF_EXPRESS_VIRTUAL IfcGeometricSet
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcGeometricCurveSet
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcGeometricCurveSet(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 301);
+        }
+
+        /// <summary>
+        /// Instances of IfcGeometricCurveSet in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcGeometricCurveSet> Extent(SdaiModel model) { return ExtentRange<IfcGeometricCurveSet>(model, 301, false); }
+        static ExtentRange<IfcGeometricCurveSet> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcGeometricCurveSet>(model, 301, true); }
+
+        /// <summary>
+        /// Create new instance of IfcGeometricCurveSet and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcGeometricCurveSet Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcGeometricCurveSet"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcGeometricCurveSet if the actual type of SdaiInstance is IfcGeometricCurveSet or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcGeometricCurveSet CreateExactEntity(SdaiInstance instance) { return IfcGeometricCurveSet(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcGeometricCurveSet or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcGeometricCurveSet(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricSet::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcGeometricCurveSet_CLASS_H
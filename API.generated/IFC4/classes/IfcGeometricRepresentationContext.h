@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeometricRepresentationContext_CLASS_H
+#define __RDF_LTD__IFC4_IfcGeometricRepresentationContext_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRepresentationContext.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcGeometricRepresentationContext
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcGeometricRepresentationContext : public RDF_EXPRESS_VIRTUAL IfcRepresentationContext
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcGeometricRepresentationContext
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcGeometricRepresentationContext(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 302);
+        }
+
+        /// <summary>
+        /// Instances of IfcGeometricRepresentationContext in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcGeometricRepresentationContext> Extent(SdaiModel model) { return ExtentRange<IfcGeometricRepresentationContext>(model, 302, false); }
+        static ExtentRange<IfcGeometricRepresentationContext> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcGeometricRepresentationContext>(model, 302, true); }
+
+        /// <summary>
+        /// Create new instance of IfcGeometricRepresentationContext and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcGeometricRepresentationContext Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcGeometricRepresentationContext"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcGeometricRepresentationContext if the actual type of SdaiInstance is IfcGeometricRepresentationContext or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcGeometricRepresentationContext CreateExactEntity(SdaiInstance instance) { return IfcGeometricRepresentationContext(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcGeometricRepresentationContext or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcGeometricRepresentationContext(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcDimensionCount> get_CoordinateSpaceDimension() { RDF_EXPRESS_PROBE(683); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(683), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+        void put_CoordinateSpaceDimension(IfcDimensionCount value) { RDF_EXPRESS_PROBE(683); sdaiPutAttr(m_instance, getAttrDefinition(683), sdaiINTEGER, &value); }
+
+        Nullable<IfcReal> get_Precision() { RDF_EXPRESS_PROBE(684); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(684), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_Precision(IfcReal value) { RDF_EXPRESS_PROBE(684); sdaiPutAttr(m_instance, getAttrDefinition(684), sdaiREAL, &value); }
+
+        IfcAxis2Placement_get get_WorldCoordinateSystem() { return IfcAxis2Placement_get(m_instance, 685); }
+        IfcAxis2Placement_put put_WorldCoordinateSystem() { return IfcAxis2Placement_put(m_instance, 685); }
+
+        IfcDirection get_TrueNorth();
+        void put_TrueNorth(IfcDirection inst);
+
+        //TList may be SetOfIfcGeometricRepresentationSubContext or list of convertible elements
+        template <typename TList> void get_HasSubContexts(TList& lst) { RDF_EXPRESS_PROBE(687); SetOfIfcGeometricRepresentationSubContextSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(687)); }
+
+        //TList may be SetOfIfcCoordinateOperation or list of convertible elements
+        template <typename TList> void get_HasCoordinateOperation(TList& lst) { RDF_EXPRESS_PROBE(688); SetOfIfcCoordinateOperationSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(688)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRepresentationContext::attr
+        {
+            static constexpr IntValue CoordinateSpaceDimension = 683;
+            static constexpr IntValue Precision = 684;
+            static constexpr IntValue WorldCoordinateSystem = 685;
+            static constexpr IntValue TrueNorth = 686;
+            static constexpr IntValue HasSubContexts = 687;
+            static constexpr IntValue HasCoordinateOperation = 688;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcGeometricRepresentationContext_CLASS_H
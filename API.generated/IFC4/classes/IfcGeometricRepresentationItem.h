@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeometricRepresentationItem_CLASS_H
+#define __RDF_LTD__IFC4_IfcGeometricRepresentationItem_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcGeometricRepresentationItem
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcGeometricRepresentationItem : public RDF_EXPRESS_VIRTUAL IfcRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcGeometricRepresentationItem
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcGeometricRepresentationItem(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 303);
+        }
+
+        /// <summary>
+        /// Instances of IfcGeometricRepresentationItem in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcGeometricRepresentationItem> Extent(SdaiModel model) { return ExtentRange<IfcGeometricRepresentationItem>(model, 303, false); }
+        static ExtentRange<IfcGeometricRepresentationItem> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcGeometricRepresentationItem>(model, 303, true); }
+
+        /// <summary>
+        /// Returns object of IfcGeometricRepresentationItem if the actual type of SdaiInstance is IfcGeometricRepresentationItem or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcGeometricRepresentationItem CreateExactEntity(SdaiInstance instance) { return IfcGeometricRepresentationItem(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcGeometricRepresentationItem or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcGeometricRepresentationItem(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRepresentationItem::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcGeometricRepresentationItem_CLASS_H
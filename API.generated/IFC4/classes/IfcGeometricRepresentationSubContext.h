@@ -0,0 +1,83 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeometricRepresentationSubContext_CLASS_H
+#define __RDF_LTD__IFC4_IfcGeometricRepresentationSubContext_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationContext.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcGeometricRepresentationSubContext
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcGeometricRepresentationSubContext : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationContext
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcGeometricRepresentationSubContext
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcGeometricRepresentationSubContext(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 304);
+        }
+
+        /// <summary>
+        /// Instances of IfcGeometricRepresentationSubContext in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcGeometricRepresentationSubContext> Extent(SdaiModel model) { return ExtentRange<IfcGeometricRepresentationSubContext>(model, 304, false); }
+        static ExtentRange<IfcGeometricRepresentationSubContext> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcGeometricRepresentationSubContext>(model, 304, true); }
+
+        /// <summary>
+        /// Create new instance of IfcGeometricRepresentationSubContext and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcGeometricRepresentationSubContext Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcGeometricRepresentationSubContext"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcGeometricRepresentationSubContext if the actual type of SdaiInstance is IfcGeometricRepresentationSubContext or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcGeometricRepresentationSubContext CreateExactEntity(SdaiInstance instance) { return IfcGeometricRepresentationSubContext(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcGeometricRepresentationSubContext or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcGeometricRepresentationSubContext(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcGeometricRepresentationContext get_ParentContext();
+        void put_ParentContext(IfcGeometricRepresentationContext inst);
+
+        Nullable<IfcPositiveRatioMeasure> get_TargetScale() { RDF_EXPRESS_PROBE(690); IfcPositiveRatioMeasure val = (IfcPositiveRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(690), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveRatioMeasure>(); }
+        void put_TargetScale(IfcPositiveRatioMeasure value) { RDF_EXPRESS_PROBE(690); sdaiPutAttr(m_instance, getAttrDefinition(690), sdaiREAL, &value); }
+
+        Nullable<IfcGeometricProjectionEnum> get_TargetView() { RDF_EXPRESS_PROBE(691); int v = getENUM(691, IfcGeometricProjectionEnum_hash); if (v >= 0) return (IfcGeometricProjectionEnum) v; else return Nullable<IfcGeometricProjectionEnum>(); }
+        void put_TargetView(IfcGeometricProjectionEnum value) { RDF_EXPRESS_PROBE(691); TextValue val = IfcGeometricProjectionEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(691), sdaiENUM, val); }
+
+        IfcLabel get_UserDefinedTargetView() { RDF_EXPRESS_PROBE(692); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(692), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedTargetView_view() { return TextView(get_UserDefinedTargetView()); }
+#endif
+        void put_UserDefinedTargetView(IfcLabel value) { RDF_EXPRESS_PROBE(692); sdaiPutAttr(m_instance, getAttrDefinition(692), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedTargetView_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(692); return buffer.GetAttr(m_instance, "UserDefinedTargetView"); }
+        const char* get_UserDefinedTargetView_utf8() { return get_UserDefinedTargetView_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationContext::attr
+        {
+            static constexpr IntValue ParentContext = 689;
+            static constexpr IntValue TargetScale = 690;
+            static constexpr IntValue TargetView = 691;
+            static constexpr IntValue UserDefinedTargetView = 692;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcGeometricRepresentationSubContext_CLASS_H
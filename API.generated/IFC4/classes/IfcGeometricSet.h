@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeometricSet_CLASS_H
+#define __RDF_LTD__IFC4_IfcGeometricSet_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcGeometricSet
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcGeometricSet : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcGeometricSet
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcGeometricSet(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 305);
+        }
+
+        /// <summary>
+        /// Instances of IfcGeometricSet in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcGeometricSet> Extent(SdaiModel model) { return ExtentRange<IfcGeometricSet>(model, 305, false); }
+        static ExtentRange<IfcGeometricSet> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcGeometricSet>(model, 305, true); }
+
+        /// <summary>
+        /// Create new instance of IfcGeometricSet and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcGeometricSet Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcGeometricSet"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcGeometricSet if the actual type of SdaiInstance is IfcGeometricSet or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcGeometricSet CreateExactEntity(SdaiInstance instance) { return IfcGeometricSet(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcGeometricSet or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcGeometricSet(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcGeometricSetSelect or list of convertible elements
+        template <typename TList> void get_Elements(TList& lst) { RDF_EXPRESS_PROBE(678); SetOfIfcGeometricSetSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(678)); }
+
+        //TList may be SetOfIfcGeometricSetSelect or list of convertible elements
+        template <typename TList> void put_Elements(TList& lst) { RDF_EXPRESS_PROBE(678); SetOfIfcGeometricSetSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(678)); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(679); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(679), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue Elements = 678;
+            static constexpr IntValue Dim = 679;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcGeometricSet_CLASS_H
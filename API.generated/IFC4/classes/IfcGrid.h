@@ -0,0 +1,98 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGrid_CLASS_H
+#define __RDF_LTD__IFC4_IfcGrid_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProduct.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcGrid
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcGrid : public RDF_EXPRESS_VIRTUAL IfcProduct
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcGrid
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcGrid(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 306);
+        }
+
+        /// <summary>
+        /// Instances of IfcGrid in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcGrid> Extent(SdaiModel model) { return ExtentRange<IfcGrid>(model, 306, false); }
+        static ExtentRange<IfcGrid> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcGrid>(model, 306, true); }
+
+        /// <summary>
+        /// Create new instance of IfcGrid and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcGrid Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcGrid"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcGrid if the actual type of SdaiInstance is IfcGrid or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcGrid CreateExactEntity(SdaiInstance instance) { return IfcGrid(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcGrid or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcGrid(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcGridAxis or list of convertible elements
+        template <typename TList> void get_UAxes(TList& lst) { RDF_EXPRESS_PROBE(693); ListOfIfcGridAxisSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(693)); }
+
+        //TList may be ListOfIfcGridAxis or list of convertible elements
+        template <typename TList> void put_UAxes(TList& lst) { RDF_EXPRESS_PROBE(693); ListOfIfcGridAxisSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(693)); }
+
+        //TArrayElem[] may be IfcGridAxis[] or array of convertible elements
+        template <typename TArrayElem> void put_UAxes(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(693); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcGridAxisSerializer<ListOfIfcGridAxis> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(693)); }
+
+        //TList may be ListOfIfcGridAxis or list of convertible elements
+        template <typename TList> void get_VAxes(TList& lst) { RDF_EXPRESS_PROBE(694); ListOfIfcGridAxisSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(694)); }
+
+        //TList may be ListOfIfcGridAxis or list of convertible elements
+        template <typename TList> void put_VAxes(TList& lst) { RDF_EXPRESS_PROBE(694); ListOfIfcGridAxisSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(694)); }
+
+        //TArrayElem[] may be IfcGridAxis[] or array of convertible elements
+        template <typename TArrayElem> void put_VAxes(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(694); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcGridAxisSerializer<ListOfIfcGridAxis> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(694)); }
+
+        //TList may be ListOfIfcGridAxis or list of convertible elements
+        template <typename TList> void get_WAxes(TList& lst) { RDF_EXPRESS_PROBE(695); ListOfIfcGridAxisSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(695)); }
+
+        //TList may be ListOfIfcGridAxis or list of convertible elements
+        template <typename TList> void put_WAxes(TList& lst) { RDF_EXPRESS_PROBE(695); ListOfIfcGridAxisSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(695)); }
+
+        //TArrayElem[] may be IfcGridAxis[] or array of convertible elements
+        template <typename TArrayElem> void put_WAxes(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(695); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcGridAxisSerializer<ListOfIfcGridAxis> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(695)); }
+
+        Nullable<IfcGridTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(696); int v = getENUM(696, IfcGridTypeEnum_hash); if (v >= 0) return (IfcGridTypeEnum) v; else return Nullable<IfcGridTypeEnum>(); }
+        void put_PredefinedType(IfcGridTypeEnum value) { RDF_EXPRESS_PROBE(696); TextValue val = IfcGridTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(696), sdaiENUM, val); }
+
+        //TList may be SetOfIfcRelContainedInSpatialStructure or list of convertible elements
+        template <typename TList> void get_ContainedInStructure(TList& lst) { RDF_EXPRESS_PROBE(697); SetOfIfcRelContainedInSpatialStructureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(697)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProduct::attr
+        {
+            static constexpr IntValue UAxes = 693;
+            static constexpr IntValue VAxes = 694;
+            static constexpr IntValue WAxes = 695;
+            static constexpr IntValue PredefinedType = 696;
+            static constexpr IntValue ContainedInStructure = 697;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcGrid_CLASS_H
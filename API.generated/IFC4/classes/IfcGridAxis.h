@@ -0,0 +1,94 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGridAxis_CLASS_H
+#define __RDF_LTD__IFC4_IfcGridAxis_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcGridAxis
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcGridAxis : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcGridAxis
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcGridAxis(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 307);
+        }
+
+        /// <summary>
+        /// Instances of IfcGridAxis in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcGridAxis> Extent(SdaiModel model) { return ExtentRange<IfcGridAxis>(model, 307, false); }
+        static ExtentRange<IfcGridAxis> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcGridAxis>(model, 307, true); }
+
+        /// <summary>
+        /// Create new instance of IfcGridAxis and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcGridAxis Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcGridAxis"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcGridAxis if the actual type of SdaiInstance is IfcGridAxis or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcGridAxis CreateExactEntity(SdaiInstance instance) { return IfcGridAxis(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcGridAxis or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcGridAxis(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_AxisTag() { RDF_EXPRESS_PROBE(698); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(698), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_AxisTag_view() { return TextView(get_AxisTag()); }
+#endif
+        void put_AxisTag(IfcLabel value) { RDF_EXPRESS_PROBE(698); sdaiPutAttr(m_instance, getAttrDefinition(698), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_AxisTag_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(698); return buffer.GetAttr(m_instance, "AxisTag"); }
+        const char* get_AxisTag_utf8() { return get_AxisTag_utf8(ThreadUtf8Buffer()); }
+
+        IfcCurve get_AxisCurve();
+        void put_AxisCurve(IfcCurve inst);
+
+        Nullable<IfcBoolean> get_SameSense() { RDF_EXPRESS_PROBE(700); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(700), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_SameSense(IfcBoolean value) { RDF_EXPRESS_PROBE(700); sdaiPutAttr(m_instance, getAttrDefinition(700), sdaiBOOLEAN, &value); }
+
+        //TList may be SetOfIfcGrid or list of convertible elements
+        template <typename TList> void get_PartOfW(TList& lst) { RDF_EXPRESS_PROBE(701); SetOfIfcGridSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(701)); }
+
+        //TList may be SetOfIfcGrid or list of convertible elements
+        template <typename TList> void get_PartOfV(TList& lst) { RDF_EXPRESS_PROBE(702); SetOfIfcGridSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(702)); }
+
+        //TList may be SetOfIfcGrid or list of convertible elements
+        template <typename TList> void get_PartOfU(TList& lst) { RDF_EXPRESS_PROBE(703); SetOfIfcGridSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(703)); }
+
+        //TList may be SetOfIfcVirtualGridIntersection or list of convertible elements
+        template <typename TList> void get_HasIntersections(TList& lst) { RDF_EXPRESS_PROBE(704); SetOfIfcVirtualGridIntersectionSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(704)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue AxisTag = 698;
+            static constexpr IntValue AxisCurve = 699;
+            static constexpr IntValue SameSense = 700;
+            static constexpr IntValue PartOfW = 701;
+            static constexpr IntValue PartOfV = 702;
+            static constexpr IntValue PartOfU = 703;
+            static constexpr IntValue HasIntersections = 704;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcGridAxis_CLASS_H
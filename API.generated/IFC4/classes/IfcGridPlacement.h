@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGridPlacement_CLASS_H
+#define __RDF_LTD__IFC4_IfcGridPlacement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcObjectPlacement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcGridPlacement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcGridPlacement : public RDF_EXPRESS_VIRTUAL IfcObjectPlacement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcGridPlacement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcGridPlacement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 308);
+        }
+
+        /// <summary>
+        /// Instances of IfcGridPlacement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcGridPlacement> Extent(SdaiModel model) { return ExtentRange<IfcGridPlacement>(model, 308, false); }
+        static ExtentRange<IfcGridPlacement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcGridPlacement>(model, 308, true); }
+
+        /// <summary>
+        /// Create new instance of IfcGridPlacement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcGridPlacement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcGridPlacement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcGridPlacement if the actual type of SdaiInstance is IfcGridPlacement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcGridPlacement CreateExactEntity(SdaiInstance instance) { return IfcGridPlacement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcGridPlacement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcGridPlacement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcVirtualGridIntersection get_PlacementLocation();
+        void put_PlacementLocation(IfcVirtualGridIntersection inst);
+
+        IfcGridPlacementDirectionSelect_get get_PlacementRefDirection() { return IfcGridPlacementDirectionSelect_get(m_instance, 708); }
+        IfcGridPlacementDirectionSelect_put put_PlacementRefDirection() { return IfcGridPlacementDirectionSelect_put(m_instance, 708); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcObjectPlacement::attr
+        {
+            static constexpr IntValue PlacementLocation = 707;
+            static constexpr IntValue PlacementRefDirection = 708;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcGridPlacement_CLASS_H
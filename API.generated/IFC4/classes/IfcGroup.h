@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGroup_CLASS_H
+#define __RDF_LTD__IFC4_IfcGroup_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcObject.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcGroup
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcGroup : public RDF_EXPRESS_VIRTUAL IfcObject
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcGroup
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcGroup(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 309);
+        }
+
+        /// <summary>
+        /// Instances of IfcGroup in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcGroup> Extent(SdaiModel model) { return ExtentRange<IfcGroup>(model, 309, false); }
+        static ExtentRange<IfcGroup> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcGroup>(model, 309, true); }
+
+        /// <summary>
+        /// Create new instance of IfcGroup and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcGroup Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcGroup"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcGroup if the actual type of SdaiInstance is IfcGroup or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcGroup CreateExactEntity(SdaiInstance instance) { return IfcGroup(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcGroup or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcGroup(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcRelAssignsToGroup or list of convertible elements
+        template <typename TList> void get_IsGroupedBy(TList& lst) { RDF_EXPRESS_PROBE(120); SetOfIfcRelAssignsToGroupSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(120)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcObject::attr
+        {
+            static constexpr IntValue IsGroupedBy = 120;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcGroup_CLASS_H
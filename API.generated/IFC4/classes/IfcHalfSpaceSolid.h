@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcHalfSpaceSolid_CLASS_H
+#define __RDF_LTD__IFC4_IfcHalfSpaceSolid_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcHalfSpaceSolid
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcHalfSpaceSolid : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcHalfSpaceSolid
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcHalfSpaceSolid(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 310);
+        }
+
+        /// <summary>
+        /// Instances of IfcHalfSpaceSolid in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcHalfSpaceSolid> Extent(SdaiModel model) { return ExtentRange<IfcHalfSpaceSolid>(model, 310, false); }
+        static ExtentRange<IfcHalfSpaceSolid> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcHalfSpaceSolid>(model, 310, true); }
+
+        /// <summary>
+        /// Create new instance of IfcHalfSpaceSolid and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcHalfSpaceSolid Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcHalfSpaceSolid"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcHalfSpaceSolid if the actual type of SdaiInstance is IfcHalfSpaceSolid or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcHalfSpaceSolid CreateExactEntity(SdaiInstance instance) { return IfcHalfSpaceSolid(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcHalfSpaceSolid or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcHalfSpaceSolid(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcSurface get_BaseSurface();
+        void put_BaseSurface(IfcSurface inst);
+
+        Nullable<IfcBoolean> get_AgreementFlag() { RDF_EXPRESS_PROBE(206); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(206), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_AgreementFlag(IfcBoolean value) { RDF_EXPRESS_PROBE(206); sdaiPutAttr(m_instance, getAttrDefinition(206), sdaiBOOLEAN, &value); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(207); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(207), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue BaseSurface = 205;
+            static constexpr IntValue AgreementFlag = 206;
+            static constexpr IntValue Dim = 207;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcHalfSpaceSolid_CLASS_H
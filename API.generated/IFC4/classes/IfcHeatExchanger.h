@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcHeatExchanger_CLASS_H
+#define __RDF_LTD__IFC4_IfcHeatExchanger_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcHeatExchanger
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcHeatExchanger : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcHeatExchanger
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcHeatExchanger(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 311);
+        }
+
+        /// <summary>
+        /// Instances of IfcHeatExchanger in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcHeatExchanger> Extent(SdaiModel model) { return ExtentRange<IfcHeatExchanger>(model, 311, false); }
+        static ExtentRange<IfcHeatExchanger> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcHeatExchanger>(model, 311, true); }
+
+        /// <summary>
+        /// Create new instance of IfcHeatExchanger and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcHeatExchanger Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcHeatExchanger"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcHeatExchanger if the actual type of SdaiInstance is IfcHeatExchanger or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcHeatExchanger CreateExactEntity(SdaiInstance instance) { return IfcHeatExchanger(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcHeatExchanger or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcHeatExchanger(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcHeatExchangerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(709); int v = getENUM(709, IfcHeatExchangerTypeEnum_hash); if (v >= 0) return (IfcHeatExchangerTypeEnum) v; else return Nullable<IfcHeatExchangerTypeEnum>(); }
+        void put_PredefinedType(IfcHeatExchangerTypeEnum value) { RDF_EXPRESS_PROBE(709); TextValue val = IfcHeatExchangerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(709), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 709;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcHeatExchanger_CLASS_H
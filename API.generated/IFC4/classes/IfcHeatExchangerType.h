@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcHeatExchangerType_CLASS_H
+#define __RDF_LTD__IFC4_IfcHeatExchangerType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcHeatExchangerType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcHeatExchangerType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcHeatExchangerType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcHeatExchangerType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 312);
+        }
+
+        /// <summary>
+        /// Instances of IfcHeatExchangerType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcHeatExchangerType> Extent(SdaiModel model) { return ExtentRange<IfcHeatExchangerType>(model, 312, false); }
+        static ExtentRange<IfcHeatExchangerType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcHeatExchangerType>(model, 312, true); }
+
+        /// <summary>
+        /// Create new instance of IfcHeatExchangerType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcHeatExchangerType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcHeatExchangerType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcHeatExchangerType if the actual type of SdaiInstance is IfcHeatExchangerType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcHeatExchangerType CreateExactEntity(SdaiInstance instance) { return IfcHeatExchangerType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcHeatExchangerType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcHeatExchangerType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcHeatExchangerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(710); int v = getENUM(710, IfcHeatExchangerTypeEnum_hash); if (v >= 0) return (IfcHeatExchangerTypeEnum) v; else return Nullable<IfcHeatExchangerTypeEnum>(); }
+        void put_PredefinedType(IfcHeatExchangerTypeEnum value) { RDF_EXPRESS_PROBE(710); TextValue val = IfcHeatExchangerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(710), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 710;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcHeatExchangerType_CLASS_H
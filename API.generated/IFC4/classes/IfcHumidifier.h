@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcHumidifier_CLASS_H
+#define __RDF_LTD__IFC4_IfcHumidifier_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcHumidifier
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcHumidifier : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcHumidifier
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcHumidifier(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 313);
+        }
+
+        /// <summary>
+        /// Instances of IfcHumidifier in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcHumidifier> Extent(SdaiModel model) { return ExtentRange<IfcHumidifier>(model, 313, false); }
+        static ExtentRange<IfcHumidifier> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcHumidifier>(model, 313, true); }
+
+        /// <summary>
+        /// Create new instance of IfcHumidifier and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcHumidifier Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcHumidifier"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcHumidifier if the actual type of SdaiInstance is IfcHumidifier or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcHumidifier CreateExactEntity(SdaiInstance instance) { return IfcHumidifier(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcHumidifier or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcHumidifier(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcHumidifierTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(711); int v = getENUM(711, IfcHumidifierTypeEnum_hash); if (v >= 0) return (IfcHumidifierTypeEnum) v; else return Nullable<IfcHumidifierTypeEnum>(); }
+        void put_PredefinedType(IfcHumidifierTypeEnum value) { RDF_EXPRESS_PROBE(711); TextValue val = IfcHumidifierTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(711), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 711;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcHumidifier_CLASS_H
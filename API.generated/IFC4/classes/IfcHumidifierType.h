@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcHumidifierType_CLASS_H
+#define __RDF_LTD__IFC4_IfcHumidifierType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcHumidifierType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcHumidifierType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcHumidifierType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcHumidifierType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 314);
+        }
+
+        /// <summary>
+        /// Instances of IfcHumidifierType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcHumidifierType> Extent(SdaiModel model) { return ExtentRange<IfcHumidifierType>(model, 314, false); }
+        static ExtentRange<IfcHumidifierType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcHumidifierType>(model, 314, true); }
+
+        /// <summary>
+        /// Create new instance of IfcHumidifierType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcHumidifierType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcHumidifierType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcHumidifierType if the actual type of SdaiInstance is IfcHumidifierType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcHumidifierType CreateExactEntity(SdaiInstance instance) { return IfcHumidifierType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcHumidifierType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcHumidifierType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcHumidifierTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(712); int v = getENUM(712, IfcHumidifierTypeEnum_hash); if (v >= 0) return (IfcHumidifierTypeEnum) v; else return Nullable<IfcHumidifierTypeEnum>(); }
+        void put_PredefinedType(IfcHumidifierTypeEnum value) { RDF_EXPRESS_PROBE(712); TextValue val = IfcHumidifierTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(712), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 712;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcHumidifierType_CLASS_H
@@ -0,0 +1,88 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIShapeProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcIShapeProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcIShapeProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcIShapeProfileDef : public RDF_EXPRESS_VIRTUAL IfcParameterizedProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcIShapeProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcIShapeProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 328);
+        }
+
+        /// <summary>
+        /// Instances of IfcIShapeProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcIShapeProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcIShapeProfileDef>(model, 328, false); }
+        static ExtentRange<IfcIShapeProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcIShapeProfileDef>(model, 328, true); }
+
+        /// <summary>
+        /// Create new instance of IfcIShapeProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcIShapeProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcIShapeProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcIShapeProfileDef if the actual type of SdaiInstance is IfcIShapeProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcIShapeProfileDef CreateExactEntity(SdaiInstance instance) { return IfcIShapeProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcIShapeProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcIShapeProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_OverallWidth() { RDF_EXPRESS_PROBE(752); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(752), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_OverallWidth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(752); sdaiPutAttr(m_instance, getAttrDefinition(752), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_OverallDepth() { RDF_EXPRESS_PROBE(753); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(753), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_OverallDepth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(753); sdaiPutAttr(m_instance, getAttrDefinition(753), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_WebThickness() { RDF_EXPRESS_PROBE(754); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(754), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_WebThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(754); sdaiPutAttr(m_instance, getAttrDefinition(754), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_FlangeThickness() { RDF_EXPRESS_PROBE(755); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(755), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_FlangeThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(755); sdaiPutAttr(m_instance, getAttrDefinition(755), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_FilletRadius() { RDF_EXPRESS_PROBE(756); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(756), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_FilletRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(756); sdaiPutAttr(m_instance, getAttrDefinition(756), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_FlangeEdgeRadius() { RDF_EXPRESS_PROBE(757); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(757), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_FlangeEdgeRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(757); sdaiPutAttr(m_instance, getAttrDefinition(757), sdaiREAL, &value); }
+
+        Nullable<IfcPlaneAngleMeasure> get_FlangeSlope() { RDF_EXPRESS_PROBE(758); IfcPlaneAngleMeasure val = (IfcPlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(758), sdaiREAL, &val)) return val; else return Nullable<IfcPlaneAngleMeasure>(); }
+        void put_FlangeSlope(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(758); sdaiPutAttr(m_instance, getAttrDefinition(758), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcParameterizedProfileDef::attr
+        {
+            static constexpr IntValue OverallWidth = 752;
+            static constexpr IntValue OverallDepth = 753;
+            static constexpr IntValue WebThickness = 754;
+            static constexpr IntValue FlangeThickness = 755;
+            static constexpr IntValue FilletRadius = 756;
+            static constexpr IntValue FlangeEdgeRadius = 757;
+            static constexpr IntValue FlangeSlope = 758;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcIShapeProfileDef_CLASS_H
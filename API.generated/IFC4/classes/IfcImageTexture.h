@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcImageTexture_CLASS_H
+#define __RDF_LTD__IFC4_IfcImageTexture_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSurfaceTexture.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcImageTexture
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcImageTexture : public RDF_EXPRESS_VIRTUAL IfcSurfaceTexture
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcImageTexture
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcImageTexture(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 315);
+        }
+
+        /// <summary>
+        /// Instances of IfcImageTexture in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcImageTexture> Extent(SdaiModel model) { return ExtentRange<IfcImageTexture>(model, 315, false); }
+        static ExtentRange<IfcImageTexture> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcImageTexture>(model, 315, true); }
+
+        /// <summary>
+        /// Create new instance of IfcImageTexture and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcImageTexture Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcImageTexture"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcImageTexture if the actual type of SdaiInstance is IfcImageTexture or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcImageTexture CreateExactEntity(SdaiInstance instance) { return IfcImageTexture(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcImageTexture or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcImageTexture(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcURIReference get_URLReference() { RDF_EXPRESS_PROBE(713); IfcURIReference val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(713), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_URLReference_view() { return TextView(get_URLReference()); }
+#endif
+        void put_URLReference(IfcURIReference value) { RDF_EXPRESS_PROBE(713); sdaiPutAttr(m_instance, getAttrDefinition(713), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_URLReference_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(713); return buffer.GetAttr(m_instance, "URLReference"); }
+        const char* get_URLReference_utf8() { return get_URLReference_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSurfaceTexture::attr
+        {
+            static constexpr IntValue URLReference = 713;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcImageTexture_CLASS_H
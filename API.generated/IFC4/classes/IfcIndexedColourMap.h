@@ -0,0 +1,82 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIndexedColourMap_CLASS_H
+#define __RDF_LTD__IFC4_IfcIndexedColourMap_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcIndexedColourMap
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcIndexedColourMap : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcIndexedColourMap
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcIndexedColourMap(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 316);
+        }
+
+        /// <summary>
+        /// Instances of IfcIndexedColourMap in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcIndexedColourMap> Extent(SdaiModel model) { return ExtentRange<IfcIndexedColourMap>(model, 316, false); }
+        static ExtentRange<IfcIndexedColourMap> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcIndexedColourMap>(model, 316, true); }
+
+        /// <summary>
+        /// Create new instance of IfcIndexedColourMap and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcIndexedColourMap Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcIndexedColourMap"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcIndexedColourMap if the actual type of SdaiInstance is IfcIndexedColourMap or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcIndexedColourMap CreateExactEntity(SdaiInstance instance) { return IfcIndexedColourMap(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcIndexedColourMap or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcIndexedColourMap(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcTessellatedFaceSet get_MappedTo();
+        void put_MappedTo(IfcTessellatedFaceSet inst);
+
+        Nullable<IfcNormalisedRatioMeasure> get_Opacity() { RDF_EXPRESS_PROBE(715); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(715), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_Opacity(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(715); sdaiPutAttr(m_instance, getAttrDefinition(715), sdaiREAL, &value); }
+
+        IfcColourRgbList get_Colours();
+        void put_Colours(IfcColourRgbList inst);
+
+        //TList may be ListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void get_ColourIndex(TList& lst) { RDF_EXPRESS_PROBE(717); ListOfIfcPositiveIntegerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(717)); }
+
+        //TList may be ListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void put_ColourIndex(TList& lst) { RDF_EXPRESS_PROBE(717); ListOfIfcPositiveIntegerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(717)); }
+
+        //TArrayElem[] may be IfcPositiveInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_ColourIndex(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(717); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcPositiveIntegerSerializer<ListOfIfcPositiveInteger> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(717)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue MappedTo = 714;
+            static constexpr IntValue Opacity = 715;
+            static constexpr IntValue Colours = 716;
+            static constexpr IntValue ColourIndex = 717;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcIndexedColourMap_CLASS_H
@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIndexedPolyCurve_CLASS_H
+#define __RDF_LTD__IFC4_IfcIndexedPolyCurve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundedCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcIndexedPolyCurve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcIndexedPolyCurve : public RDF_EXPRESS_VIRTUAL IfcBoundedCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcIndexedPolyCurve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcIndexedPolyCurve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 317);
+        }
+
+        /// <summary>
+        /// Instances of IfcIndexedPolyCurve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcIndexedPolyCurve> Extent(SdaiModel model) { return ExtentRange<IfcIndexedPolyCurve>(model, 317, false); }
+        static ExtentRange<IfcIndexedPolyCurve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcIndexedPolyCurve>(model, 317, true); }
+
+        /// <summary>
+        /// Create new instance of IfcIndexedPolyCurve and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcIndexedPolyCurve Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcIndexedPolyCurve"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcIndexedPolyCurve if the actual type of SdaiInstance is IfcIndexedPolyCurve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcIndexedPolyCurve CreateExactEntity(SdaiInstance instance) { return IfcIndexedPolyCurve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcIndexedPolyCurve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcIndexedPolyCurve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCartesianPointList get_Points();
+        void put_Points(IfcCartesianPointList inst);
+
+        //TList may be ListOfIfcSegmentIndexSelect or list of convertible elements
+        template <typename TList> void get_Segments(TList& lst) { RDF_EXPRESS_PROBE(719); ListOfIfcSegmentIndexSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(719)); }
+
+        //TList may be ListOfIfcSegmentIndexSelect or list of convertible elements
+        template <typename TList> void put_Segments(TList& lst) { RDF_EXPRESS_PROBE(719); ListOfIfcSegmentIndexSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(719)); }
+
+        Nullable<IfcBoolean> get_SelfIntersect() { RDF_EXPRESS_PROBE(720); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(720), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_SelfIntersect(IfcBoolean value) { RDF_EXPRESS_PROBE(720); sdaiPutAttr(m_instance, getAttrDefinition(720), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundedCurve::attr
+        {
+            static constexpr IntValue Points = 718;
+            static constexpr IntValue Segments = 719;
+            static constexpr IntValue SelfIntersect = 720;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcIndexedPolyCurve_CLASS_H
@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIndexedPolygonalFace_CLASS_H
+#define __RDF_LTD__IFC4_IfcIndexedPolygonalFace_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTessellatedItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcIndexedPolygonalFace
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcIndexedPolygonalFace : public RDF_EXPRESS_VIRTUAL IfcTessellatedItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcIndexedPolygonalFace
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcIndexedPolygonalFace(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 318);
+        }
+
+        /// <summary>
+        /// Instances of IfcIndexedPolygonalFace in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcIndexedPolygonalFace> Extent(SdaiModel model) { return ExtentRange<IfcIndexedPolygonalFace>(model, 318, false); }
+        static ExtentRange<IfcIndexedPolygonalFace> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcIndexedPolygonalFace>(model, 318, true); }
+
+        /// <summary>
+        /// Create new instance of IfcIndexedPolygonalFace and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcIndexedPolygonalFace Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcIndexedPolygonalFace"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcIndexedPolygonalFace if the actual type of SdaiInstance is IfcIndexedPolygonalFace or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcIndexedPolygonalFace CreateExactEntity(SdaiInstance instance) { return IfcIndexedPolygonalFace(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcIndexedPolygonalFace or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcIndexedPolygonalFace(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void get_CoordIndex(TList& lst) { RDF_EXPRESS_PROBE(721); ListOfIfcPositiveIntegerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(721)); }
+
+        //TList may be ListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void put_CoordIndex(TList& lst) { RDF_EXPRESS_PROBE(721); ListOfIfcPositiveIntegerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(721)); }
+
+        //TArrayElem[] may be IfcPositiveInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_CoordIndex(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(721); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcPositiveIntegerSerializer<ListOfIfcPositiveInteger> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(721)); }
+
+        //TList may be SetOfIfcPolygonalFaceSet or list of convertible elements
+        template <typename TList> void get_ToFaceSet(TList& lst) { RDF_EXPRESS_PROBE(722); SetOfIfcPolygonalFaceSetSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(722)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTessellatedItem::attr
+        {
+            static constexpr IntValue CoordIndex = 721;
+            static constexpr IntValue ToFaceSet = 722;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcIndexedPolygonalFace_CLASS_H
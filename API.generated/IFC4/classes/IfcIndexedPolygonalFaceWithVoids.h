@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIndexedPolygonalFaceWithVoids_CLASS_H
+#define __RDF_LTD__IFC4_IfcIndexedPolygonalFaceWithVoids_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcIndexedPolygonalFace.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcIndexedPolygonalFaceWithVoids
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcIndexedPolygonalFaceWithVoids : public RDF_EXPRESS_VIRTUAL IfcIndexedPolygonalFace
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcIndexedPolygonalFaceWithVoids
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcIndexedPolygonalFaceWithVoids(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 319);
+        }
+
+        /// <summary>
+        /// Instances of IfcIndexedPolygonalFaceWithVoids in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcIndexedPolygonalFaceWithVoids> Extent(SdaiModel model) { return ExtentRange<IfcIndexedPolygonalFaceWithVoids>(model, 319, false); }
+        static ExtentRange<IfcIndexedPolygonalFaceWithVoids> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcIndexedPolygonalFaceWithVoids>(model, 319, true); }
+
+        /// <summary>
+        /// Create new instance of IfcIndexedPolygonalFaceWithVoids and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcIndexedPolygonalFaceWithVoids Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcIndexedPolygonalFaceWithVoids"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcIndexedPolygonalFaceWithVoids if the actual type of SdaiInstance is IfcIndexedPolygonalFaceWithVoids or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcIndexedPolygonalFaceWithVoids CreateExactEntity(SdaiInstance instance) { return IfcIndexedPolygonalFaceWithVoids(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcIndexedPolygonalFaceWithVoids or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcIndexedPolygonalFaceWithVoids(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void get_InnerCoordIndices(TList& lst) { RDF_EXPRESS_PROBE(723); ListOfListOfIfcPositiveIntegerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(723)); }
+
+        //TList may be ListOfListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void put_InnerCoordIndices(TList& lst) { RDF_EXPRESS_PROBE(723); ListOfListOfIfcPositiveIntegerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(723)); }
+
+        //reads inner aggregations into flat buffer, stride elements each (e.g. xyz of points), returns number of inner aggregations
+        template <typename TElem> IntValue get_InnerCoordIndices(TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(723); return FlatAggrFromAttr<TElem, IfcPositiveInteger, sdaiINTEGER>(m_instance, getAttrDefinition(723), buffer, size, stride); }
+        template <typename TElem> IntValue get_InnerCoordIndices(std::vector<TElem>& flat, size_t stride) { RDF_EXPRESS_PROBE(723); return FlatAggrFromAttr<TElem, IfcPositiveInteger, sdaiINTEGER>(m_instance, getAttrDefinition(723), flat, stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> IntValue get_InnerCoordIndices(std::span<TElem> buffer, size_t stride) { return get_InnerCoordIndices(buffer.data(), buffer.size(), stride); }
+#endif
+
+        //writes flat buffer as inner aggregations of stride elements each (e.g. xyz of points), no intermediate lists
+        template <typename TElem> void put_InnerCoordIndices(const TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(723); FlatAggrToAttr<TElem, IfcPositiveInteger, sdaiINTEGER>(m_instance, getAttrDefinition(723), buffer, size, stride); }
+        template <typename TElem> void put_InnerCoordIndices(const std::vector<TElem>& flat, size_t stride) { put_InnerCoordIndices(flat.data(), flat.size(), stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> void put_InnerCoordIndices(std::span<const TElem> buffer, size_t stride) { put_InnerCoordIndices(buffer.data(), buffer.size(), stride); }
+#endif
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcIndexedPolygonalFace::attr
+        {
+            static constexpr IntValue InnerCoordIndices = 723;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcIndexedPolygonalFaceWithVoids_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIndexedTextureMap_CLASS_H
+#define __RDF_LTD__IFC4_IfcIndexedTextureMap_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTextureCoordinate.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcIndexedTextureMap
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcIndexedTextureMap : public RDF_EXPRESS_VIRTUAL IfcTextureCoordinate
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcIndexedTextureMap
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcIndexedTextureMap(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 320);
+        }
+
+        /// <summary>
+        /// Instances of IfcIndexedTextureMap in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcIndexedTextureMap> Extent(SdaiModel model) { return ExtentRange<IfcIndexedTextureMap>(model, 320, false); }
+        static ExtentRange<IfcIndexedTextureMap> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcIndexedTextureMap>(model, 320, true); }
+
+        /// <summary>
+        /// Returns object of IfcIndexedTextureMap if the actual type of SdaiInstance is IfcIndexedTextureMap or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcIndexedTextureMap CreateExactEntity(SdaiInstance instance) { return IfcIndexedTextureMap(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcIndexedTextureMap or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcIndexedTextureMap(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcTessellatedFaceSet get_MappedTo();
+        void put_MappedTo(IfcTessellatedFaceSet inst);
+
+        IfcTextureVertexList get_TexCoords();
+        void put_TexCoords(IfcTextureVertexList inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTextureCoordinate::attr
+        {
+            static constexpr IntValue MappedTo = 725;
+            static constexpr IntValue TexCoords = 726;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcIndexedTextureMap_CLASS_H
@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIndexedTriangleTextureMap_CLASS_H
+#define __RDF_LTD__IFC4_IfcIndexedTriangleTextureMap_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcIndexedTextureMap.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcIndexedTriangleTextureMap
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcIndexedTriangleTextureMap : public RDF_EXPRESS_VIRTUAL IfcIndexedTextureMap
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcIndexedTriangleTextureMap
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcIndexedTriangleTextureMap(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 321);
+        }
+
+        /// <summary>
+        /// Instances of IfcIndexedTriangleTextureMap in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcIndexedTriangleTextureMap> Extent(SdaiModel model) { return ExtentRange<IfcIndexedTriangleTextureMap>(model, 321, false); }
+        static ExtentRange<IfcIndexedTriangleTextureMap> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcIndexedTriangleTextureMap>(model, 321, true); }
+
+        /// <summary>
+        /// Create new instance of IfcIndexedTriangleTextureMap and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcIndexedTriangleTextureMap Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcIndexedTriangleTextureMap"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcIndexedTriangleTextureMap if the actual type of SdaiInstance is IfcIndexedTriangleTextureMap or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcIndexedTriangleTextureMap CreateExactEntity(SdaiInstance instance) { return IfcIndexedTriangleTextureMap(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcIndexedTriangleTextureMap or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcIndexedTriangleTextureMap(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void get_TexCoordIndex(TList& lst) { RDF_EXPRESS_PROBE(727); ListOfListOfIfcPositiveIntegerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(727)); }
+
+        //TList may be ListOfListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void put_TexCoordIndex(TList& lst) { RDF_EXPRESS_PROBE(727); ListOfListOfIfcPositiveIntegerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(727)); }
+
+        //reads inner aggregations into flat buffer, stride elements each (e.g. xyz of points), returns number of inner aggregations
+        template <typename TElem> IntValue get_TexCoordIndex(TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(727); return FlatAggrFromAttr<TElem, IfcPositiveInteger, sdaiINTEGER>(m_instance, getAttrDefinition(727), buffer, size, stride); }
+        template <typename TElem> IntValue get_TexCoordIndex(std::vector<TElem>& flat, size_t stride) { RDF_EXPRESS_PROBE(727); return FlatAggrFromAttr<TElem, IfcPositiveInteger, sdaiINTEGER>(m_instance, getAttrDefinition(727), flat, stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> IntValue get_TexCoordIndex(std::span<TElem> buffer, size_t stride) { return get_TexCoordIndex(buffer.data(), buffer.size(), stride); }
+#endif
+
+        //writes flat buffer as inner aggregations of stride elements each (e.g. xyz of points), no intermediate lists
+        template <typename TElem> void put_TexCoordIndex(const TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(727); FlatAggrToAttr<TElem, IfcPositiveInteger, sdaiINTEGER>(m_instance, getAttrDefinition(727), buffer, size, stride); }
+        template <typename TElem> void put_TexCoordIndex(const std::vector<TElem>& flat, size_t stride) { put_TexCoordIndex(flat.data(), flat.size(), stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> void put_TexCoordIndex(std::span<const TElem> buffer, size_t stride) { put_TexCoordIndex(buffer.data(), buffer.size(), stride); }
+#endif
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcIndexedTextureMap::attr
+        {
+            static constexpr IntValue TexCoordIndex = 727;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcIndexedTriangleTextureMap_CLASS_H
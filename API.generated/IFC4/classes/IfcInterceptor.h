@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcInterceptor_CLASS_H
+#define __RDF_LTD__IFC4_IfcInterceptor_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTreatmentDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcInterceptor
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcInterceptor : public RDF_EXPRESS_VIRTUAL IfcFlowTreatmentDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcInterceptor
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcInterceptor(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 322);
+        }
+
+        /// <summary>
+        /// Instances of IfcInterceptor in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcInterceptor> Extent(SdaiModel model) { return ExtentRange<IfcInterceptor>(model, 322, false); }
+        static ExtentRange<IfcInterceptor> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcInterceptor>(model, 322, true); }
+
+        /// <summary>
+        /// Create new instance of IfcInterceptor and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcInterceptor Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcInterceptor"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcInterceptor if the actual type of SdaiInstance is IfcInterceptor or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcInterceptor CreateExactEntity(SdaiInstance instance) { return IfcInterceptor(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcInterceptor or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcInterceptor(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcInterceptorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(728); int v = getENUM(728, IfcInterceptorTypeEnum_hash); if (v >= 0) return (IfcInterceptorTypeEnum) v; else return Nullable<IfcInterceptorTypeEnum>(); }
+        void put_PredefinedType(IfcInterceptorTypeEnum value) { RDF_EXPRESS_PROBE(728); TextValue val = IfcInterceptorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(728), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTreatmentDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 728;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcInterceptor_CLASS_H
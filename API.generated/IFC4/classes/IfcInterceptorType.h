@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcInterceptorType_CLASS_H
+#define __RDF_LTD__IFC4_IfcInterceptorType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTreatmentDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcInterceptorType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcInterceptorType : public RDF_EXPRESS_VIRTUAL IfcFlowTreatmentDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcInterceptorType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcInterceptorType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 323);
+        }
+
+        /// <summary>
+        /// Instances of IfcInterceptorType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcInterceptorType> Extent(SdaiModel model) { return ExtentRange<IfcInterceptorType>(model, 323, false); }
+        static ExtentRange<IfcInterceptorType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcInterceptorType>(model, 323, true); }
+
+        /// <summary>
+        /// Create new instance of IfcInterceptorType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcInterceptorType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcInterceptorType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcInterceptorType if the actual type of SdaiInstance is IfcInterceptorType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcInterceptorType CreateExactEntity(SdaiInstance instance) { return IfcInterceptorType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcInterceptorType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcInterceptorType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcInterceptorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(729); int v = getENUM(729, IfcInterceptorTypeEnum_hash); if (v >= 0) return (IfcInterceptorTypeEnum) v; else return Nullable<IfcInterceptorTypeEnum>(); }
+        void put_PredefinedType(IfcInterceptorTypeEnum value) { RDF_EXPRESS_PROBE(729); TextValue val = IfcInterceptorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(729), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTreatmentDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 729;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcInterceptorType_CLASS_H
@@ -0,0 +1,97 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcInventory_CLASS_H
+#define __RDF_LTD__IFC4_IfcInventory_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGroup.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcInventory
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcInventory : public RDF_EXPRESS_VIRTUAL IfcGroup
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcInventory
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcInventory(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 325);
+        }
+
+        /// <summary>
+        /// Instances of IfcInventory in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcInventory> Extent(SdaiModel model) { return ExtentRange<IfcInventory>(model, 325, false); }
+        static ExtentRange<IfcInventory> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcInventory>(model, 325, true); }
+
+        /// <summary>
+        /// Create new instance of IfcInventory and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcInventory Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcInventory"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcInventory if the actual type of SdaiInstance is IfcInventory or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcInventory CreateExactEntity(SdaiInstance instance) { return IfcInventory(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcInventory or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcInventory(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcInventoryTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(734); int v = getENUM(734, IfcInventoryTypeEnum_hash); if (v >= 0) return (IfcInventoryTypeEnum) v; else return Nullable<IfcInventoryTypeEnum>(); }
+        void put_PredefinedType(IfcInventoryTypeEnum value) { RDF_EXPRESS_PROBE(734); TextValue val = IfcInventoryTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(734), sdaiENUM, val); }
+
+        IfcActorSelect_get get_Jurisdiction() { return IfcActorSelect_get(m_instance, 735); }
+        IfcActorSelect_put put_Jurisdiction() { return IfcActorSelect_put(m_instance, 735); }
+
+        //TList may be SetOfIfcPerson or list of convertible elements
+        template <typename TList> void get_ResponsiblePersons(TList& lst) { RDF_EXPRESS_PROBE(736); SetOfIfcPersonSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(736)); }
+
+        //TList may be SetOfIfcPerson or list of convertible elements
+        template <typename TList> void put_ResponsiblePersons(TList& lst) { RDF_EXPRESS_PROBE(736); SetOfIfcPersonSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(736)); }
+
+        //TArrayElem[] may be IfcPerson[] or array of convertible elements
+        template <typename TArrayElem> void put_ResponsiblePersons(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(736); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcPersonSerializer<SetOfIfcPerson> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(736)); }
+
+        IfcDate get_LastUpdateDate() { RDF_EXPRESS_PROBE(737); IfcDate val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(737), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LastUpdateDate_view() { return TextView(get_LastUpdateDate()); }
+#endif
+        void put_LastUpdateDate(IfcDate value) { RDF_EXPRESS_PROBE(737); sdaiPutAttr(m_instance, getAttrDefinition(737), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LastUpdateDate_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(737); return buffer.GetAttr(m_instance, "LastUpdateDate"); }
+        const char* get_LastUpdateDate_utf8() { return get_LastUpdateDate_utf8(ThreadUtf8Buffer()); }
+
+        IfcCostValue get_CurrentValue();
+        void put_CurrentValue(IfcCostValue inst);
+
+        IfcCostValue get_OriginalValue();
+        void put_OriginalValue(IfcCostValue inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGroup::attr
+        {
+            static constexpr IntValue PredefinedType = 734;
+            static constexpr IntValue Jurisdiction = 735;
+            static constexpr IntValue ResponsiblePersons = 736;
+            static constexpr IntValue LastUpdateDate = 737;
+            static constexpr IntValue CurrentValue = 738;
+            static constexpr IntValue OriginalValue = 739;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcInventory_CLASS_H
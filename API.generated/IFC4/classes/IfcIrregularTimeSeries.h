@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIrregularTimeSeries_CLASS_H
+#define __RDF_LTD__IFC4_IfcIrregularTimeSeries_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTimeSeries.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcIrregularTimeSeries
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcIrregularTimeSeries : public RDF_EXPRESS_VIRTUAL IfcTimeSeries
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcIrregularTimeSeries
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcIrregularTimeSeries(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 326);
+        }
+
+        /// <summary>
+        /// Instances of IfcIrregularTimeSeries in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcIrregularTimeSeries> Extent(SdaiModel model) { return ExtentRange<IfcIrregularTimeSeries>(model, 326, false); }
+        static ExtentRange<IfcIrregularTimeSeries> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcIrregularTimeSeries>(model, 326, true); }
+
+        /// <summary>
+        /// Create new instance of IfcIrregularTimeSeries and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcIrregularTimeSeries Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcIrregularTimeSeries"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcIrregularTimeSeries if the actual type of SdaiInstance is IfcIrregularTimeSeries or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcIrregularTimeSeries CreateExactEntity(SdaiInstance instance) { return IfcIrregularTimeSeries(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcIrregularTimeSeries or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcIrregularTimeSeries(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcIrregularTimeSeriesValue or list of convertible elements
+        template <typename TList> void get_Values(TList& lst) { RDF_EXPRESS_PROBE(749); ListOfIfcIrregularTimeSeriesValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(749)); }
+
+        //TList may be ListOfIfcIrregularTimeSeriesValue or list of convertible elements
+        template <typename TList> void put_Values(TList& lst) { RDF_EXPRESS_PROBE(749); ListOfIfcIrregularTimeSeriesValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(749)); }
+
+        //TArrayElem[] may be IfcIrregularTimeSeriesValue[] or array of convertible elements
+        template <typename TArrayElem> void put_Values(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(749); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcIrregularTimeSeriesValueSerializer<ListOfIfcIrregularTimeSeriesValue> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(749)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTimeSeries::attr
+        {
+            static constexpr IntValue Values = 749;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcIrregularTimeSeries_CLASS_H
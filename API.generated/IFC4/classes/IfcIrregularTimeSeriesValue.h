@@ -0,0 +1,77 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcIrregularTimeSeriesValue_CLASS_H
+#define __RDF_LTD__IFC4_IfcIrregularTimeSeriesValue_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcIrregularTimeSeriesValue
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcIrregularTimeSeriesValue : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcIrregularTimeSeriesValue
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcIrregularTimeSeriesValue(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 327);
+        }
+
+        /// <summary>
+        /// Instances of IfcIrregularTimeSeriesValue in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcIrregularTimeSeriesValue> Extent(SdaiModel model) { return ExtentRange<IfcIrregularTimeSeriesValue>(model, 327, false); }
+        static ExtentRange<IfcIrregularTimeSeriesValue> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcIrregularTimeSeriesValue>(model, 327, true); }
+
+        /// <summary>
+        /// Create new instance of IfcIrregularTimeSeriesValue and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcIrregularTimeSeriesValue Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcIrregularTimeSeriesValue"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcIrregularTimeSeriesValue if the actual type of SdaiInstance is IfcIrregularTimeSeriesValue or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcIrregularTimeSeriesValue CreateExactEntity(SdaiInstance instance) { return IfcIrregularTimeSeriesValue(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcIrregularTimeSeriesValue or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcIrregularTimeSeriesValue(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDateTime get_TimeStamp() { RDF_EXPRESS_PROBE(750); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(750), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_TimeStamp_view() { return TextView(get_TimeStamp()); }
+#endif
+        void put_TimeStamp(IfcDateTime value) { RDF_EXPRESS_PROBE(750); sdaiPutAttr(m_instance, getAttrDefinition(750), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_TimeStamp_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(750); return buffer.GetAttr(m_instance, "TimeStamp"); }
+        const char* get_TimeStamp_utf8() { return get_TimeStamp_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void get_ListValues(TList& lst) { RDF_EXPRESS_PROBE(751); ListOfIfcValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(751)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void put_ListValues(TList& lst) { RDF_EXPRESS_PROBE(751); ListOfIfcValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(751)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue TimeStamp = 750;
+            static constexpr IntValue ListValues = 751;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcIrregularTimeSeriesValue_CLASS_H
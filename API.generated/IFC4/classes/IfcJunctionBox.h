@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcJunctionBox_CLASS_H
+#define __RDF_LTD__IFC4_IfcJunctionBox_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowFitting.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcJunctionBox
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcJunctionBox : public RDF_EXPRESS_VIRTUAL IfcFlowFitting
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcJunctionBox
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcJunctionBox(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 329);
+        }
+
+        /// <summary>
+        /// Instances of IfcJunctionBox in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcJunctionBox> Extent(SdaiModel model) { return ExtentRange<IfcJunctionBox>(model, 329, false); }
+        static ExtentRange<IfcJunctionBox> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcJunctionBox>(model, 329, true); }
+
+        /// <summary>
+        /// Create new instance of IfcJunctionBox and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcJunctionBox Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcJunctionBox"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcJunctionBox if the actual type of SdaiInstance is IfcJunctionBox or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcJunctionBox CreateExactEntity(SdaiInstance instance) { return IfcJunctionBox(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcJunctionBox or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcJunctionBox(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcJunctionBoxTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(759); int v = getENUM(759, IfcJunctionBoxTypeEnum_hash); if (v >= 0) return (IfcJunctionBoxTypeEnum) v; else return Nullable<IfcJunctionBoxTypeEnum>(); }
+        void put_PredefinedType(IfcJunctionBoxTypeEnum value) { RDF_EXPRESS_PROBE(759); TextValue val = IfcJunctionBoxTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(759), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowFitting::attr
+        {
+            static constexpr IntValue PredefinedType = 759;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcJunctionBox_CLASS_H
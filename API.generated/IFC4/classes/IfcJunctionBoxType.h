@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcJunctionBoxType_CLASS_H
+#define __RDF_LTD__IFC4_IfcJunctionBoxType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowFittingType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcJunctionBoxType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcJunctionBoxType : public RDF_EXPRESS_VIRTUAL IfcFlowFittingType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcJunctionBoxType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcJunctionBoxType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 330);
+        }
+
+        /// <summary>
+        /// Instances of IfcJunctionBoxType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcJunctionBoxType> Extent(SdaiModel model) { return ExtentRange<IfcJunctionBoxType>(model, 330, false); }
+        static ExtentRange<IfcJunctionBoxType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcJunctionBoxType>(model, 330, true); }
+
+        /// <summary>
+        /// Create new instance of IfcJunctionBoxType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcJunctionBoxType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcJunctionBoxType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcJunctionBoxType if the actual type of SdaiInstance is IfcJunctionBoxType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcJunctionBoxType CreateExactEntity(SdaiInstance instance) { return IfcJunctionBoxType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcJunctionBoxType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcJunctionBoxType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcJunctionBoxTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(760); int v = getENUM(760, IfcJunctionBoxTypeEnum_hash); if (v >= 0) return (IfcJunctionBoxTypeEnum) v; else return Nullable<IfcJunctionBoxTypeEnum>(); }
+        void put_PredefinedType(IfcJunctionBoxTypeEnum value) { RDF_EXPRESS_PROBE(760); TextValue val = IfcJunctionBoxTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(760), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowFittingType::attr
+        {
+            static constexpr IntValue PredefinedType = 760;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcJunctionBoxType_CLASS_H
@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLShapeProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcLShapeProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLShapeProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLShapeProfileDef : public RDF_EXPRESS_VIRTUAL IfcParameterizedProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLShapeProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLShapeProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 351);
+        }
+
+        /// <summary>
+        /// Instances of IfcLShapeProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLShapeProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcLShapeProfileDef>(model, 351, false); }
+        static ExtentRange<IfcLShapeProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLShapeProfileDef>(model, 351, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLShapeProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLShapeProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLShapeProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLShapeProfileDef if the actual type of SdaiInstance is IfcLShapeProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLShapeProfileDef CreateExactEntity(SdaiInstance instance) { return IfcLShapeProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLShapeProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLShapeProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Depth() { RDF_EXPRESS_PROBE(810); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(810), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Depth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(810); sdaiPutAttr(m_instance, getAttrDefinition(810), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Width() { RDF_EXPRESS_PROBE(811); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(811), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Width(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(811); sdaiPutAttr(m_instance, getAttrDefinition(811), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Thickness() { RDF_EXPRESS_PROBE(812); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(812), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Thickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(812); sdaiPutAttr(m_instance, getAttrDefinition(812), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_FilletRadius() { RDF_EXPRESS_PROBE(813); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(813), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_FilletRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(813); sdaiPutAttr(m_instance, getAttrDefinition(813), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_EdgeRadius() { RDF_EXPRESS_PROBE(814); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(814), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_EdgeRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(814); sdaiPutAttr(m_instance, getAttrDefinition(814), sdaiREAL, &value); }
+
+        Nullable<IfcPlaneAngleMeasure> get_LegSlope() { RDF_EXPRESS_PROBE(815); IfcPlaneAngleMeasure val = (IfcPlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(815), sdaiREAL, &val)) return val; else return Nullable<IfcPlaneAngleMeasure>(); }
+        void put_LegSlope(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(815); sdaiPutAttr(m_instance, getAttrDefinition(815), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcParameterizedProfileDef::attr
+        {
+            static constexpr IntValue Depth = 810;
+            static constexpr IntValue Width = 811;
+            static constexpr IntValue Thickness = 812;
+            static constexpr IntValue FilletRadius = 813;
+            static constexpr IntValue EdgeRadius = 814;
+            static constexpr IntValue LegSlope = 815;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLShapeProfileDef_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLaborResource_CLASS_H
+#define __RDF_LTD__IFC4_IfcLaborResource_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstructionResource.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLaborResource
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLaborResource : public RDF_EXPRESS_VIRTUAL IfcConstructionResource
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLaborResource
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLaborResource(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 331);
+        }
+
+        /// <summary>
+        /// Instances of IfcLaborResource in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLaborResource> Extent(SdaiModel model) { return ExtentRange<IfcLaborResource>(model, 331, false); }
+        static ExtentRange<IfcLaborResource> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLaborResource>(model, 331, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLaborResource and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLaborResource Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLaborResource"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLaborResource if the actual type of SdaiInstance is IfcLaborResource or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLaborResource CreateExactEntity(SdaiInstance instance) { return IfcLaborResource(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLaborResource or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLaborResource(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLaborResourceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(761); int v = getENUM(761, IfcLaborResourceTypeEnum_hash); if (v >= 0) return (IfcLaborResourceTypeEnum) v; else return Nullable<IfcLaborResourceTypeEnum>(); }
+        void put_PredefinedType(IfcLaborResourceTypeEnum value) { RDF_EXPRESS_PROBE(761); TextValue val = IfcLaborResourceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(761), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstructionResource::attr
+        {
+            static constexpr IntValue PredefinedType = 761;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLaborResource_CLASS_H
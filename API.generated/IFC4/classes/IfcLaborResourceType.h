@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLaborResourceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcLaborResourceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstructionResourceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLaborResourceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLaborResourceType : public RDF_EXPRESS_VIRTUAL IfcConstructionResourceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLaborResourceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLaborResourceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 332);
+        }
+
+        /// <summary>
+        /// Instances of IfcLaborResourceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLaborResourceType> Extent(SdaiModel model) { return ExtentRange<IfcLaborResourceType>(model, 332, false); }
+        static ExtentRange<IfcLaborResourceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLaborResourceType>(model, 332, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLaborResourceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLaborResourceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLaborResourceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLaborResourceType if the actual type of SdaiInstance is IfcLaborResourceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLaborResourceType CreateExactEntity(SdaiInstance instance) { return IfcLaborResourceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLaborResourceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLaborResourceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLaborResourceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(762); int v = getENUM(762, IfcLaborResourceTypeEnum_hash); if (v >= 0) return (IfcLaborResourceTypeEnum) v; else return Nullable<IfcLaborResourceTypeEnum>(); }
+        void put_PredefinedType(IfcLaborResourceTypeEnum value) { RDF_EXPRESS_PROBE(762); TextValue val = IfcLaborResourceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(762), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstructionResourceType::attr
+        {
+            static constexpr IntValue PredefinedType = 762;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLaborResourceType_CLASS_H
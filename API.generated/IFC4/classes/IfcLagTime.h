@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLagTime_CLASS_H
+#define __RDF_LTD__IFC4_IfcLagTime_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSchedulingTime.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLagTime
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLagTime : public RDF_EXPRESS_VIRTUAL IfcSchedulingTime
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLagTime
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLagTime(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 333);
+        }
+
+        /// <summary>
+        /// Instances of IfcLagTime in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLagTime> Extent(SdaiModel model) { return ExtentRange<IfcLagTime>(model, 333, false); }
+        static ExtentRange<IfcLagTime> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLagTime>(model, 333, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLagTime and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLagTime Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLagTime"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLagTime if the actual type of SdaiInstance is IfcLagTime or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLagTime CreateExactEntity(SdaiInstance instance) { return IfcLagTime(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLagTime or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLagTime(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcTimeOrRatioSelect_get get_LagValue() { return IfcTimeOrRatioSelect_get(m_instance, 763); }
+        IfcTimeOrRatioSelect_put put_LagValue() { return IfcTimeOrRatioSelect_put(m_instance, 763); }
+
+        Nullable<IfcTaskDurationEnum> get_DurationType() { RDF_EXPRESS_PROBE(764); int v = getENUM(764, IfcTaskDurationEnum_hash); if (v >= 0) return (IfcTaskDurationEnum) v; else return Nullable<IfcTaskDurationEnum>(); }
+        void put_DurationType(IfcTaskDurationEnum value) { RDF_EXPRESS_PROBE(764); TextValue val = IfcTaskDurationEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(764), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSchedulingTime::attr
+        {
+            static constexpr IntValue LagValue = 763;
+            static constexpr IntValue DurationType = 764;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLagTime_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLamp_CLASS_H
+#define __RDF_LTD__IFC4_IfcLamp_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLamp
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLamp : public RDF_EXPRESS_VIRTUAL IfcFlowTerminal
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLamp
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLamp(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 334);
+        }
+
+        /// <summary>
+        /// Instances of IfcLamp in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLamp> Extent(SdaiModel model) { return ExtentRange<IfcLamp>(model, 334, false); }
+        static ExtentRange<IfcLamp> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLamp>(model, 334, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLamp and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLamp Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLamp"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLamp if the actual type of SdaiInstance is IfcLamp or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLamp CreateExactEntity(SdaiInstance instance) { return IfcLamp(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLamp or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLamp(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLampTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(765); int v = getENUM(765, IfcLampTypeEnum_hash); if (v >= 0) return (IfcLampTypeEnum) v; else return Nullable<IfcLampTypeEnum>(); }
+        void put_PredefinedType(IfcLampTypeEnum value) { RDF_EXPRESS_PROBE(765); TextValue val = IfcLampTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(765), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminal::attr
+        {
+            static constexpr IntValue PredefinedType = 765;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLamp_CLASS_H
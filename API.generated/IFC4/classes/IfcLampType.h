@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLampType_CLASS_H
+#define __RDF_LTD__IFC4_IfcLampType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLampType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLampType : public RDF_EXPRESS_VIRTUAL IfcFlowTerminalType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLampType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLampType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 335);
+        }
+
+        /// <summary>
+        /// Instances of IfcLampType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLampType> Extent(SdaiModel model) { return ExtentRange<IfcLampType>(model, 335, false); }
+        static ExtentRange<IfcLampType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLampType>(model, 335, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLampType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLampType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLampType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLampType if the actual type of SdaiInstance is IfcLampType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLampType CreateExactEntity(SdaiInstance instance) { return IfcLampType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLampType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLampType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLampTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(766); int v = getENUM(766, IfcLampTypeEnum_hash); if (v >= 0) return (IfcLampTypeEnum) v; else return Nullable<IfcLampTypeEnum>(); }
+        void put_PredefinedType(IfcLampTypeEnum value) { RDF_EXPRESS_PROBE(766); TextValue val = IfcLampTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(766), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminalType::attr
+        {
+            static constexpr IntValue PredefinedType = 766;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLampType_CLASS_H
@@ -0,0 +1,127 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLibraryInformation_CLASS_H
+#define __RDF_LTD__IFC4_IfcLibraryInformation_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcExternalInformation.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLibraryInformation
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLibraryInformation : public RDF_EXPRESS_VIRTUAL IfcExternalInformation
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLibraryInformation
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLibraryInformation(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 336);
+        }
+
+        /// <summary>
+        /// Instances of IfcLibraryInformation in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLibraryInformation> Extent(SdaiModel model) { return ExtentRange<IfcLibraryInformation>(model, 336, false); }
+        static ExtentRange<IfcLibraryInformation> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLibraryInformation>(model, 336, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLibraryInformation and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLibraryInformation Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLibraryInformation"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLibraryInformation if the actual type of SdaiInstance is IfcLibraryInformation or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLibraryInformation CreateExactEntity(SdaiInstance instance) { return IfcLibraryInformation(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLibraryInformation or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLibraryInformation(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(767); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(767), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(767); sdaiPutAttr(m_instance, getAttrDefinition(767), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(767); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Version() { RDF_EXPRESS_PROBE(768); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(768), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Version_view() { return TextView(get_Version()); }
+#endif
+        void put_Version(IfcLabel value) { RDF_EXPRESS_PROBE(768); sdaiPutAttr(m_instance, getAttrDefinition(768), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Version_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(768); return buffer.GetAttr(m_instance, "Version"); }
+        const char* get_Version_utf8() { return get_Version_utf8(ThreadUtf8Buffer()); }
+
+        IfcActorSelect_get get_Publisher() { return IfcActorSelect_get(m_instance, 769); }
+        IfcActorSelect_put put_Publisher() { return IfcActorSelect_put(m_instance, 769); }
+
+        IfcDateTime get_VersionDate() { RDF_EXPRESS_PROBE(770); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(770), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_VersionDate_view() { return TextView(get_VersionDate()); }
+#endif
+        void put_VersionDate(IfcDateTime value) { RDF_EXPRESS_PROBE(770); sdaiPutAttr(m_instance, getAttrDefinition(770), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_VersionDate_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(770); return buffer.GetAttr(m_instance, "VersionDate"); }
+        const char* get_VersionDate_utf8() { return get_VersionDate_utf8(ThreadUtf8Buffer()); }
+
+        IfcURIReference get_Location() { RDF_EXPRESS_PROBE(771); IfcURIReference val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(771), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Location_view() { return TextView(get_Location()); }
+#endif
+        void put_Location(IfcURIReference value) { RDF_EXPRESS_PROBE(771); sdaiPutAttr(m_instance, getAttrDefinition(771), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Location_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(771); return buffer.GetAttr(m_instance, "Location"); }
+        const char* get_Location_utf8() { return get_Location_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(772); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(772), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(772); sdaiPutAttr(m_instance, getAttrDefinition(772), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(772); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRelAssociatesLibrary or list of convertible elements
+        template <typename TList> void get_LibraryInfoForObjects(TList& lst) { RDF_EXPRESS_PROBE(773); SetOfIfcRelAssociatesLibrarySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(773)); }
+
+        //TList may be SetOfIfcLibraryReference or list of convertible elements
+        template <typename TList> void get_HasLibraryReferences(TList& lst) { RDF_EXPRESS_PROBE(774); SetOfIfcLibraryReferenceSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(774)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcExternalInformation::attr
+        {
+            static constexpr IntValue Name = 767;
+            static constexpr IntValue Version = 768;
+            static constexpr IntValue Publisher = 769;
+            static constexpr IntValue VersionDate = 770;
+            static constexpr IntValue Location = 771;
+            static constexpr IntValue Description = 772;
+            static constexpr IntValue LibraryInfoForObjects = 773;
+            static constexpr IntValue HasLibraryReferences = 774;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLibraryInformation_CLASS_H
@@ -0,0 +1,90 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLibraryReference_CLASS_H
+#define __RDF_LTD__IFC4_IfcLibraryReference_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcExternalReference.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLibraryReference
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLibraryReference : public RDF_EXPRESS_VIRTUAL IfcExternalReference
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLibraryReference
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLibraryReference(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 337);
+        }
+
+        /// <summary>
+        /// Instances of IfcLibraryReference in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLibraryReference> Extent(SdaiModel model) { return ExtentRange<IfcLibraryReference>(model, 337, false); }
+        static ExtentRange<IfcLibraryReference> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLibraryReference>(model, 337, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLibraryReference and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLibraryReference Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLibraryReference"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLibraryReference if the actual type of SdaiInstance is IfcLibraryReference or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLibraryReference CreateExactEntity(SdaiInstance instance) { return IfcLibraryReference(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLibraryReference or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLibraryReference(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(775); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(775), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(775); sdaiPutAttr(m_instance, getAttrDefinition(775), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(775); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcLanguageId get_Language() { RDF_EXPRESS_PROBE(776); IfcLanguageId val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(776), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Language_view() { return TextView(get_Language()); }
+#endif
+        void put_Language(IfcLanguageId value) { RDF_EXPRESS_PROBE(776); sdaiPutAttr(m_instance, getAttrDefinition(776), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Language_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(776); return buffer.GetAttr(m_instance, "Language"); }
+        const char* get_Language_utf8() { return get_Language_utf8(ThreadUtf8Buffer()); }
+
+        IfcLibraryInformation get_ReferencedLibrary();
+        void put_ReferencedLibrary(IfcLibraryInformation inst);
+
+        //TList may be SetOfIfcRelAssociatesLibrary or list of convertible elements
+        template <typename TList> void get_LibraryRefForObjects(TList& lst) { RDF_EXPRESS_PROBE(778); SetOfIfcRelAssociatesLibrarySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(778)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcExternalReference::attr
+        {
+            static constexpr IntValue Description = 775;
+            static constexpr IntValue Language = 776;
+            static constexpr IntValue ReferencedLibrary = 777;
+            static constexpr IntValue LibraryRefForObjects = 778;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLibraryReference_CLASS_H
@@ -0,0 +1,83 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightDistributionData_CLASS_H
+#define __RDF_LTD__IFC4_IfcLightDistributionData_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLightDistributionData
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLightDistributionData : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLightDistributionData
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLightDistributionData(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 338);
+        }
+
+        /// <summary>
+        /// Instances of IfcLightDistributionData in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLightDistributionData> Extent(SdaiModel model) { return ExtentRange<IfcLightDistributionData>(model, 338, false); }
+        static ExtentRange<IfcLightDistributionData> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLightDistributionData>(model, 338, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLightDistributionData and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLightDistributionData Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLightDistributionData"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLightDistributionData if the actual type of SdaiInstance is IfcLightDistributionData or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLightDistributionData CreateExactEntity(SdaiInstance instance) { return IfcLightDistributionData(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLightDistributionData or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLightDistributionData(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPlaneAngleMeasure> get_MainPlaneAngle() { RDF_EXPRESS_PROBE(779); IfcPlaneAngleMeasure val = (IfcPlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(779), sdaiREAL, &val)) return val; else return Nullable<IfcPlaneAngleMeasure>(); }
+        void put_MainPlaneAngle(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(779); sdaiPutAttr(m_instance, getAttrDefinition(779), sdaiREAL, &value); }
+
+        //TList may be ListOfIfcPlaneAngleMeasure or list of convertible elements
+        template <typename TList> void get_SecondaryPlaneAngle(TList& lst) { RDF_EXPRESS_PROBE(780); ListOfIfcPlaneAngleMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(780)); }
+
+        //TList may be ListOfIfcPlaneAngleMeasure or list of convertible elements
+        template <typename TList> void put_SecondaryPlaneAngle(TList& lst) { RDF_EXPRESS_PROBE(780); ListOfIfcPlaneAngleMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(780)); }
+
+        //TArrayElem[] may be IfcPlaneAngleMeasure[] or array of convertible elements
+        template <typename TArrayElem> void put_SecondaryPlaneAngle(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(780); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcPlaneAngleMeasureSerializer<ListOfIfcPlaneAngleMeasure> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(780)); }
+
+        //TList may be ListOfIfcLuminousIntensityDistributionMeasure or list of convertible elements
+        template <typename TList> void get_LuminousIntensity(TList& lst) { RDF_EXPRESS_PROBE(781); ListOfIfcLuminousIntensityDistributionMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(781)); }
+
+        //TList may be ListOfIfcLuminousIntensityDistributionMeasure or list of convertible elements
+        template <typename TList> void put_LuminousIntensity(TList& lst) { RDF_EXPRESS_PROBE(781); ListOfIfcLuminousIntensityDistributionMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(781)); }
+
+        //TArrayElem[] may be IfcLuminousIntensityDistributionMeasure[] or array of convertible elements
+        template <typename TArrayElem> void put_LuminousIntensity(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(781); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcLuminousIntensityDistributionMeasureSerializer<ListOfIfcLuminousIntensityDistributionMeasure> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(781)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue MainPlaneAngle = 779;
+            static constexpr IntValue SecondaryPlaneAngle = 780;
+            static constexpr IntValue LuminousIntensity = 781;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightDistributionData_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightFixture_CLASS_H
+#define __RDF_LTD__IFC4_IfcLightFixture_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLightFixture
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLightFixture : public RDF_EXPRESS_VIRTUAL IfcFlowTerminal
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLightFixture
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLightFixture(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 339);
+        }
+
+        /// <summary>
+        /// Instances of IfcLightFixture in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLightFixture> Extent(SdaiModel model) { return ExtentRange<IfcLightFixture>(model, 339, false); }
+        static ExtentRange<IfcLightFixture> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLightFixture>(model, 339, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLightFixture and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLightFixture Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLightFixture"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLightFixture if the actual type of SdaiInstance is IfcLightFixture or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLightFixture CreateExactEntity(SdaiInstance instance) { return IfcLightFixture(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLightFixture or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLightFixture(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLightFixtureTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(782); int v = getENUM(782, IfcLightFixtureTypeEnum_hash); if (v >= 0) return (IfcLightFixtureTypeEnum) v; else return Nullable<IfcLightFixtureTypeEnum>(); }
+        void put_PredefinedType(IfcLightFixtureTypeEnum value) { RDF_EXPRESS_PROBE(782); TextValue val = IfcLightFixtureTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(782), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminal::attr
+        {
+            static constexpr IntValue PredefinedType = 782;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightFixture_CLASS_H
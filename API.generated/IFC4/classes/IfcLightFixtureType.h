@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightFixtureType_CLASS_H
+#define __RDF_LTD__IFC4_IfcLightFixtureType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLightFixtureType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLightFixtureType : public RDF_EXPRESS_VIRTUAL IfcFlowTerminalType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLightFixtureType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLightFixtureType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 340);
+        }
+
+        /// <summary>
+        /// Instances of IfcLightFixtureType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLightFixtureType> Extent(SdaiModel model) { return ExtentRange<IfcLightFixtureType>(model, 340, false); }
+        static ExtentRange<IfcLightFixtureType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLightFixtureType>(model, 340, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLightFixtureType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLightFixtureType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLightFixtureType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLightFixtureType if the actual type of SdaiInstance is IfcLightFixtureType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLightFixtureType CreateExactEntity(SdaiInstance instance) { return IfcLightFixtureType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLightFixtureType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLightFixtureType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLightFixtureTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(783); int v = getENUM(783, IfcLightFixtureTypeEnum_hash); if (v >= 0) return (IfcLightFixtureTypeEnum) v; else return Nullable<IfcLightFixtureTypeEnum>(); }
+        void put_PredefinedType(IfcLightFixtureTypeEnum value) { RDF_EXPRESS_PROBE(783); TextValue val = IfcLightFixtureTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(783), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminalType::attr
+        {
+            static constexpr IntValue PredefinedType = 783;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightFixtureType_CLASS_H
@@ -0,0 +1,73 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightIntensityDistribution_CLASS_H
+#define __RDF_LTD__IFC4_IfcLightIntensityDistribution_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLightIntensityDistribution
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLightIntensityDistribution : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLightIntensityDistribution
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLightIntensityDistribution(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 341);
+        }
+
+        /// <summary>
+        /// Instances of IfcLightIntensityDistribution in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLightIntensityDistribution> Extent(SdaiModel model) { return ExtentRange<IfcLightIntensityDistribution>(model, 341, false); }
+        static ExtentRange<IfcLightIntensityDistribution> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLightIntensityDistribution>(model, 341, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLightIntensityDistribution and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLightIntensityDistribution Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLightIntensityDistribution"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLightIntensityDistribution if the actual type of SdaiInstance is IfcLightIntensityDistribution or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLightIntensityDistribution CreateExactEntity(SdaiInstance instance) { return IfcLightIntensityDistribution(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLightIntensityDistribution or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLightIntensityDistribution(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLightDistributionCurveEnum> get_LightDistributionCurve() { RDF_EXPRESS_PROBE(784); int v = getENUM(784, IfcLightDistributionCurveEnum_hash); if (v >= 0) return (IfcLightDistributionCurveEnum) v; else return Nullable<IfcLightDistributionCurveEnum>(); }
+        void put_LightDistributionCurve(IfcLightDistributionCurveEnum value) { RDF_EXPRESS_PROBE(784); TextValue val = IfcLightDistributionCurveEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(784), sdaiENUM, val); }
+
+        //TList may be ListOfIfcLightDistributionData or list of convertible elements
+        template <typename TList> void get_DistributionData(TList& lst) { RDF_EXPRESS_PROBE(785); ListOfIfcLightDistributionDataSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(785)); }
+
+        //TList may be ListOfIfcLightDistributionData or list of convertible elements
+        template <typename TList> void put_DistributionData(TList& lst) { RDF_EXPRESS_PROBE(785); ListOfIfcLightDistributionDataSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(785)); }
+
+        //TArrayElem[] may be IfcLightDistributionData[] or array of convertible elements
+        template <typename TArrayElem> void put_DistributionData(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(785); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcLightDistributionDataSerializer<ListOfIfcLightDistributionData> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(785)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue LightDistributionCurve = 784;
+            static constexpr IntValue DistributionData = 785;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightIntensityDistribution_CLASS_H
@@ -0,0 +1,79 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightSource_CLASS_H
+#define __RDF_LTD__IFC4_IfcLightSource_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLightSource
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLightSource : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLightSource
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLightSource(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 342);
+        }
+
+        /// <summary>
+        /// Instances of IfcLightSource in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLightSource> Extent(SdaiModel model) { return ExtentRange<IfcLightSource>(model, 342, false); }
+        static ExtentRange<IfcLightSource> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLightSource>(model, 342, true); }
+
+        /// <summary>
+        /// Returns object of IfcLightSource if the actual type of SdaiInstance is IfcLightSource or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLightSource CreateExactEntity(SdaiInstance instance) { return IfcLightSource(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLightSource or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLightSource(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(786); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(786), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(786); sdaiPutAttr(m_instance, getAttrDefinition(786), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(786); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcColourRgb get_LightColour();
+        void put_LightColour(IfcColourRgb inst);
+
+        Nullable<IfcNormalisedRatioMeasure> get_AmbientIntensity() { RDF_EXPRESS_PROBE(788); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(788), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_AmbientIntensity(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(788); sdaiPutAttr(m_instance, getAttrDefinition(788), sdaiREAL, &value); }
+
+        Nullable<IfcNormalisedRatioMeasure> get_Intensity() { RDF_EXPRESS_PROBE(789); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(789), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_Intensity(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(789); sdaiPutAttr(m_instance, getAttrDefinition(789), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue Name = 786;
+            static constexpr IntValue LightColour = 787;
+            static constexpr IntValue AmbientIntensity = 788;
+            static constexpr IntValue Intensity = 789;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightSource_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightSourceAmbient_CLASS_H
+#define __RDF_LTD__IFC4_IfcLightSourceAmbient_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcLightSource.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLightSourceAmbient
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLightSourceAmbient : public RDF_EXPRESS_VIRTUAL IfcLightSource
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLightSourceAmbient
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLightSourceAmbient(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 343);
+        }
+
+        /// <summary>
+        /// Instances of IfcLightSourceAmbient in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLightSourceAmbient> Extent(SdaiModel model) { return ExtentRange<IfcLightSourceAmbient>(model, 343, false); }
+        static ExtentRange<IfcLightSourceAmbient> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLightSourceAmbient>(model, 343, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLightSourceAmbient and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLightSourceAmbient Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLightSourceAmbient"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLightSourceAmbient if the actual type of SdaiInstance is IfcLightSourceAmbient or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLightSourceAmbient CreateExactEntity(SdaiInstance instance) { return IfcLightSourceAmbient(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLightSourceAmbient or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLightSourceAmbient(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcLightSource::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightSourceAmbient_CLASS_H
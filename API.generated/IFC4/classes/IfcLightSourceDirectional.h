@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightSourceDirectional_CLASS_H
+#define __RDF_LTD__IFC4_IfcLightSourceDirectional_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcLightSource.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLightSourceDirectional
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLightSourceDirectional : public RDF_EXPRESS_VIRTUAL IfcLightSource
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLightSourceDirectional
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLightSourceDirectional(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 344);
+        }
+
+        /// <summary>
+        /// Instances of IfcLightSourceDirectional in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLightSourceDirectional> Extent(SdaiModel model) { return ExtentRange<IfcLightSourceDirectional>(model, 344, false); }
+        static ExtentRange<IfcLightSourceDirectional> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLightSourceDirectional>(model, 344, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLightSourceDirectional and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLightSourceDirectional Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLightSourceDirectional"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLightSourceDirectional if the actual type of SdaiInstance is IfcLightSourceDirectional or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLightSourceDirectional CreateExactEntity(SdaiInstance instance) { return IfcLightSourceDirectional(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLightSourceDirectional or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLightSourceDirectional(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDirection get_Orientation();
+        void put_Orientation(IfcDirection inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcLightSource::attr
+        {
+            static constexpr IntValue Orientation = 790;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightSourceDirectional_CLASS_H
@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightSourceGoniometric_CLASS_H
+#define __RDF_LTD__IFC4_IfcLightSourceGoniometric_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcLightSource.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLightSourceGoniometric
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLightSourceGoniometric : public RDF_EXPRESS_VIRTUAL IfcLightSource
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLightSourceGoniometric
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLightSourceGoniometric(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 345);
+        }
+
+        /// <summary>
+        /// Instances of IfcLightSourceGoniometric in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLightSourceGoniometric> Extent(SdaiModel model) { return ExtentRange<IfcLightSourceGoniometric>(model, 345, false); }
+        static ExtentRange<IfcLightSourceGoniometric> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLightSourceGoniometric>(model, 345, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLightSourceGoniometric and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLightSourceGoniometric Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLightSourceGoniometric"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLightSourceGoniometric if the actual type of SdaiInstance is IfcLightSourceGoniometric or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLightSourceGoniometric CreateExactEntity(SdaiInstance instance) { return IfcLightSourceGoniometric(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLightSourceGoniometric or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLightSourceGoniometric(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcAxis2Placement3D get_Position();
+        void put_Position(IfcAxis2Placement3D inst);
+
+        IfcColourRgb get_ColourAppearance();
+        void put_ColourAppearance(IfcColourRgb inst);
+
+        Nullable<IfcThermodynamicTemperatureMeasure> get_ColourTemperature() { RDF_EXPRESS_PROBE(793); IfcThermodynamicTemperatureMeasure val = (IfcThermodynamicTemperatureMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(793), sdaiREAL, &val)) return val; else return Nullable<IfcThermodynamicTemperatureMeasure>(); }
+        void put_ColourTemperature(IfcThermodynamicTemperatureMeasure value) { RDF_EXPRESS_PROBE(793); sdaiPutAttr(m_instance, getAttrDefinition(793), sdaiREAL, &value); }
+
+        Nullable<IfcLuminousFluxMeasure> get_LuminousFlux() { RDF_EXPRESS_PROBE(794); IfcLuminousFluxMeasure val = (IfcLuminousFluxMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(794), sdaiREAL, &val)) return val; else return Nullable<IfcLuminousFluxMeasure>(); }
+        void put_LuminousFlux(IfcLuminousFluxMeasure value) { RDF_EXPRESS_PROBE(794); sdaiPutAttr(m_instance, getAttrDefinition(794), sdaiREAL, &value); }
+
+        Nullable<IfcLightEmissionSourceEnum> get_LightEmissionSource() { RDF_EXPRESS_PROBE(795); int v = getENUM(795, IfcLightEmissionSourceEnum_hash); if (v >= 0) return (IfcLightEmissionSourceEnum) v; else return Nullable<IfcLightEmissionSourceEnum>(); }
+        void put_LightEmissionSource(IfcLightEmissionSourceEnum value) { RDF_EXPRESS_PROBE(795); TextValue val = IfcLightEmissionSourceEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(795), sdaiENUM, val); }
+
+        IfcLightDistributionDataSourceSelect_get get_LightDistributionDataSource() { return IfcLightDistributionDataSourceSelect_get(m_instance, 796); }
+        IfcLightDistributionDataSourceSelect_put put_LightDistributionDataSource() { return IfcLightDistributionDataSourceSelect_put(m_instance, 796); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcLightSource::attr
+        {
+            static constexpr IntValue Position = 791;
+            static constexpr IntValue ColourAppearance = 792;
+            static constexpr IntValue ColourTemperature = 793;
+            static constexpr IntValue LuminousFlux = 794;
+            static constexpr IntValue LightEmissionSource = 795;
+            static constexpr IntValue LightDistributionDataSource = 796;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightSourceGoniometric_CLASS_H
@@ -0,0 +1,80 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightSourcePositional_CLASS_H
+#define __RDF_LTD__IFC4_IfcLightSourcePositional_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcLightSource.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLightSourcePositional
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLightSourcePositional : public RDF_EXPRESS_VIRTUAL IfcLightSource
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLightSourcePositional
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLightSourcePositional(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 346);
+        }
+
+        /// <summary>
+        /// Instances of IfcLightSourcePositional in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLightSourcePositional> Extent(SdaiModel model) { return ExtentRange<IfcLightSourcePositional>(model, 346, false); }
+        static ExtentRange<IfcLightSourcePositional> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLightSourcePositional>(model, 346, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLightSourcePositional and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLightSourcePositional Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLightSourcePositional"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLightSourcePositional if the actual type of SdaiInstance is IfcLightSourcePositional or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLightSourcePositional CreateExactEntity(SdaiInstance instance) { return IfcLightSourcePositional(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLightSourcePositional or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLightSourcePositional(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCartesianPoint get_Position();
+        void put_Position(IfcCartesianPoint inst);
+
+        Nullable<IfcPositiveLengthMeasure> get_Radius() { RDF_EXPRESS_PROBE(798); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(798), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Radius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(798); sdaiPutAttr(m_instance, getAttrDefinition(798), sdaiREAL, &value); }
+
+        Nullable<IfcReal> get_ConstantAttenuation() { RDF_EXPRESS_PROBE(799); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(799), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_ConstantAttenuation(IfcReal value) { RDF_EXPRESS_PROBE(799); sdaiPutAttr(m_instance, getAttrDefinition(799), sdaiREAL, &value); }
+
+        Nullable<IfcReal> get_DistanceAttenuation() { RDF_EXPRESS_PROBE(800); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(800), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_DistanceAttenuation(IfcReal value) { RDF_EXPRESS_PROBE(800); sdaiPutAttr(m_instance, getAttrDefinition(800), sdaiREAL, &value); }
+
+        Nullable<IfcReal> get_QuadricAttenuation() { RDF_EXPRESS_PROBE(801); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(801), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_QuadricAttenuation(IfcReal value) { RDF_EXPRESS_PROBE(801); sdaiPutAttr(m_instance, getAttrDefinition(801), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcLightSource::attr
+        {
+            static constexpr IntValue Position = 797;
+            static constexpr IntValue Radius = 798;
+            static constexpr IntValue ConstantAttenuation = 799;
+            static constexpr IntValue DistanceAttenuation = 800;
+            static constexpr IntValue QuadricAttenuation = 801;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightSourcePositional_CLASS_H
@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightSourceSpot_CLASS_H
+#define __RDF_LTD__IFC4_IfcLightSourceSpot_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcLightSourcePositional.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLightSourceSpot
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLightSourceSpot : public RDF_EXPRESS_VIRTUAL IfcLightSourcePositional
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLightSourceSpot
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLightSourceSpot(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 347);
+        }
+
+        /// <summary>
+        /// Instances of IfcLightSourceSpot in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLightSourceSpot> Extent(SdaiModel model) { return ExtentRange<IfcLightSourceSpot>(model, 347, false); }
+        static ExtentRange<IfcLightSourceSpot> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLightSourceSpot>(model, 347, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLightSourceSpot and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLightSourceSpot Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLightSourceSpot"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLightSourceSpot if the actual type of SdaiInstance is IfcLightSourceSpot or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLightSourceSpot CreateExactEntity(SdaiInstance instance) { return IfcLightSourceSpot(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLightSourceSpot or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLightSourceSpot(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDirection get_Orientation();
+        void put_Orientation(IfcDirection inst);
+
+        Nullable<IfcReal> get_ConcentrationExponent() { RDF_EXPRESS_PROBE(803); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(803), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_ConcentrationExponent(IfcReal value) { RDF_EXPRESS_PROBE(803); sdaiPutAttr(m_instance, getAttrDefinition(803), sdaiREAL, &value); }
+
+        Nullable<IfcPositivePlaneAngleMeasure> get_SpreadAngle() { RDF_EXPRESS_PROBE(804); IfcPositivePlaneAngleMeasure val = (IfcPositivePlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(804), sdaiREAL, &val)) return val; else return Nullable<IfcPositivePlaneAngleMeasure>(); }
+        void put_SpreadAngle(IfcPositivePlaneAngleMeasure value) { RDF_EXPRESS_PROBE(804); sdaiPutAttr(m_instance, getAttrDefinition(804), sdaiREAL, &value); }
+
+        Nullable<IfcPositivePlaneAngleMeasure> get_BeamWidthAngle() { RDF_EXPRESS_PROBE(805); IfcPositivePlaneAngleMeasure val = (IfcPositivePlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(805), sdaiREAL, &val)) return val; else return Nullable<IfcPositivePlaneAngleMeasure>(); }
+        void put_BeamWidthAngle(IfcPositivePlaneAngleMeasure value) { RDF_EXPRESS_PROBE(805); sdaiPutAttr(m_instance, getAttrDefinition(805), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcLightSourcePositional::attr
+        {
+            static constexpr IntValue Orientation = 802;
+            static constexpr IntValue ConcentrationExponent = 803;
+            static constexpr IntValue SpreadAngle = 804;
+            static constexpr IntValue BeamWidthAngle = 805;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightSourceSpot_CLASS_H
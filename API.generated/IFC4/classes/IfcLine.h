@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLine_CLASS_H
+#define __RDF_LTD__IFC4_IfcLine_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLine
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLine : public RDF_EXPRESS_VIRTUAL IfcCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLine
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLine(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 348);
+        }
+
+        /// <summary>
+        /// Instances of IfcLine in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLine> Extent(SdaiModel model) { return ExtentRange<IfcLine>(model, 348, false); }
+        static ExtentRange<IfcLine> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLine>(model, 348, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLine and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLine Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLine"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLine if the actual type of SdaiInstance is IfcLine or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLine CreateExactEntity(SdaiInstance instance) { return IfcLine(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLine or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLine(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCartesianPoint get_Pnt();
+        void put_Pnt(IfcCartesianPoint inst);
+
+        IfcVector get_Dir();
+        void put_Dir(IfcVector inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCurve::attr
+        {
+            static constexpr IntValue Pnt = 806;
+            static constexpr IntValue Dir = 807;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLine_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLocalPlacement_CLASS_H
+#define __RDF_LTD__IFC4_IfcLocalPlacement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcObjectPlacement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLocalPlacement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLocalPlacement : public RDF_EXPRESS_VIRTUAL IfcObjectPlacement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLocalPlacement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLocalPlacement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 349);
+        }
+
+        /// <summary>
+        /// Instances of IfcLocalPlacement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLocalPlacement> Extent(SdaiModel model) { return ExtentRange<IfcLocalPlacement>(model, 349, false); }
+        static ExtentRange<IfcLocalPlacement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLocalPlacement>(model, 349, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLocalPlacement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLocalPlacement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLocalPlacement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLocalPlacement if the actual type of SdaiInstance is IfcLocalPlacement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLocalPlacement CreateExactEntity(SdaiInstance instance) { return IfcLocalPlacement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLocalPlacement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLocalPlacement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcObjectPlacement get_PlacementRelTo();
+        void put_PlacementRelTo(IfcObjectPlacement inst);
+
+        IfcAxis2Placement_get get_RelativePlacement() { return IfcAxis2Placement_get(m_instance, 809); }
+        IfcAxis2Placement_put put_RelativePlacement() { return IfcAxis2Placement_put(m_instance, 809); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcObjectPlacement::attr
+        {
+            static constexpr IntValue PlacementRelTo = 808;
+            static constexpr IntValue RelativePlacement = 809;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLocalPlacement_CLASS_H
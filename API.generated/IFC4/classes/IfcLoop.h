@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLoop_CLASS_H
+#define __RDF_LTD__IFC4_IfcLoop_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTopologicalRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcLoop
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcLoop : public RDF_EXPRESS_VIRTUAL IfcTopologicalRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcLoop
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcLoop(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 350);
+        }
+
+        /// <summary>
+        /// Instances of IfcLoop in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcLoop> Extent(SdaiModel model) { return ExtentRange<IfcLoop>(model, 350, false); }
+        static ExtentRange<IfcLoop> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcLoop>(model, 350, true); }
+
+        /// <summary>
+        /// Create new instance of IfcLoop and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcLoop Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcLoop"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcLoop if the actual type of SdaiInstance is IfcLoop or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcLoop CreateExactEntity(SdaiInstance instance) { return IfcLoop(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcLoop or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcLoop(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTopologicalRepresentationItem::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcLoop_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcManifoldSolidBrep_CLASS_H
+#define __RDF_LTD__IFC4_IfcManifoldSolidBrep_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSolidModel.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcManifoldSolidBrep
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcManifoldSolidBrep : public RDF_EXPRESS_VIRTUAL IfcSolidModel
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcManifoldSolidBrep
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcManifoldSolidBrep(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 352);
+        }
+
+        /// <summary>
+        /// Instances of IfcManifoldSolidBrep in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcManifoldSolidBrep> Extent(SdaiModel model) { return ExtentRange<IfcManifoldSolidBrep>(model, 352, false); }
+        static ExtentRange<IfcManifoldSolidBrep> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcManifoldSolidBrep>(model, 352, true); }
+
+        /// <summary>
+        /// Returns object of IfcManifoldSolidBrep if the actual type of SdaiInstance is IfcManifoldSolidBrep or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcManifoldSolidBrep CreateExactEntity(SdaiInstance instance) { return IfcManifoldSolidBrep(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcManifoldSolidBrep or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcManifoldSolidBrep(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcClosedShell get_Outer();
+        void put_Outer(IfcClosedShell inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSolidModel::attr
+        {
+            static constexpr IntValue Outer = 62;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcManifoldSolidBrep_CLASS_H
@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMapConversion_CLASS_H
+#define __RDF_LTD__IFC4_IfcMapConversion_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCoordinateOperation.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMapConversion
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMapConversion : public RDF_EXPRESS_VIRTUAL IfcCoordinateOperation
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMapConversion
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMapConversion(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 353);
+        }
+
+        /// <summary>
+        /// Instances of IfcMapConversion in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMapConversion> Extent(SdaiModel model) { return ExtentRange<IfcMapConversion>(model, 353, false); }
+        static ExtentRange<IfcMapConversion> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMapConversion>(model, 353, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMapConversion and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMapConversion Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMapConversion"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMapConversion if the actual type of SdaiInstance is IfcMapConversion or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMapConversion CreateExactEntity(SdaiInstance instance) { return IfcMapConversion(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMapConversion or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMapConversion(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLengthMeasure> get_Eastings() { RDF_EXPRESS_PROBE(816); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(816), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_Eastings(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(816); sdaiPutAttr(m_instance, getAttrDefinition(816), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_Northings() { RDF_EXPRESS_PROBE(817); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(817), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_Northings(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(817); sdaiPutAttr(m_instance, getAttrDefinition(817), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_OrthogonalHeight() { RDF_EXPRESS_PROBE(818); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(818), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_OrthogonalHeight(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(818); sdaiPutAttr(m_instance, getAttrDefinition(818), sdaiREAL, &value); }
+
+        Nullable<IfcReal> get_XAxisAbscissa() { RDF_EXPRESS_PROBE(819); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(819), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_XAxisAbscissa(IfcReal value) { RDF_EXPRESS_PROBE(819); sdaiPutAttr(m_instance, getAttrDefinition(819), sdaiREAL, &value); }
+
+        Nullable<IfcReal> get_XAxisOrdinate() { RDF_EXPRESS_PROBE(820); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(820), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_XAxisOrdinate(IfcReal value) { RDF_EXPRESS_PROBE(820); sdaiPutAttr(m_instance, getAttrDefinition(820), sdaiREAL, &value); }
+
+        Nullable<IfcReal> get_Scale() { RDF_EXPRESS_PROBE(821); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(821), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_Scale(IfcReal value) { RDF_EXPRESS_PROBE(821); sdaiPutAttr(m_instance, getAttrDefinition(821), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCoordinateOperation::attr
+        {
+            static constexpr IntValue Eastings = 816;
+            static constexpr IntValue Northings = 817;
+            static constexpr IntValue OrthogonalHeight = 818;
+            static constexpr IntValue XAxisAbscissa = 819;
+            static constexpr IntValue XAxisOrdinate = 820;
+            static constexpr IntValue Scale = 821;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMapConversion_CLASS_H
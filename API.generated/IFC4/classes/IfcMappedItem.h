@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMappedItem_CLASS_H
+#define __RDF_LTD__IFC4_IfcMappedItem_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMappedItem
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMappedItem : public RDF_EXPRESS_VIRTUAL IfcRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMappedItem
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMappedItem(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 354);
+        }
+
+        /// <summary>
+        /// Instances of IfcMappedItem in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMappedItem> Extent(SdaiModel model) { return ExtentRange<IfcMappedItem>(model, 354, false); }
+        static ExtentRange<IfcMappedItem> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMappedItem>(model, 354, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMappedItem and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMappedItem Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMappedItem"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMappedItem if the actual type of SdaiInstance is IfcMappedItem or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMappedItem CreateExactEntity(SdaiInstance instance) { return IfcMappedItem(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMappedItem or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMappedItem(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcRepresentationMap get_MappingSource();
+        void put_MappingSource(IfcRepresentationMap inst);
+
+        IfcCartesianTransformationOperator get_MappingTarget();
+        void put_MappingTarget(IfcCartesianTransformationOperator inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRepresentationItem::attr
+        {
+            static constexpr IntValue MappingSource = 822;
+            static constexpr IntValue MappingTarget = 823;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMappedItem_CLASS_H
@@ -0,0 +1,105 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterial_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterial_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcMaterialDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterial
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterial : public RDF_EXPRESS_VIRTUAL IfcMaterialDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterial
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterial(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 355);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterial in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterial> Extent(SdaiModel model) { return ExtentRange<IfcMaterial>(model, 355, false); }
+        static ExtentRange<IfcMaterial> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterial>(model, 355, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterial and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterial Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterial"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterial if the actual type of SdaiInstance is IfcMaterial or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterial CreateExactEntity(SdaiInstance instance) { return IfcMaterial(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterial or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterial(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(827); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(827), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(827); sdaiPutAttr(m_instance, getAttrDefinition(827), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(827); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(828); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(828), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(828); sdaiPutAttr(m_instance, getAttrDefinition(828), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(828); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Category() { RDF_EXPRESS_PROBE(829); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(829), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Category_view() { return TextView(get_Category()); }
+#endif
+        void put_Category(IfcLabel value) { RDF_EXPRESS_PROBE(829); sdaiPutAttr(m_instance, getAttrDefinition(829), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Category_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(829); return buffer.GetAttr(m_instance, "Category"); }
+        const char* get_Category_utf8() { return get_Category_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcMaterialDefinitionRepresentation or list of convertible elements
+        template <typename TList> void get_HasRepresentation(TList& lst) { RDF_EXPRESS_PROBE(830); SetOfIfcMaterialDefinitionRepresentationSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(830)); }
+
+        //TList may be SetOfIfcMaterialRelationship or list of convertible elements
+        template <typename TList> void get_IsRelatedWith(TList& lst) { RDF_EXPRESS_PROBE(831); SetOfIfcMaterialRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(831)); }
+
+        //TList may be SetOfIfcMaterialRelationship or list of convertible elements
+        template <typename TList> void get_RelatesTo(TList& lst) { RDF_EXPRESS_PROBE(832); SetOfIfcMaterialRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(832)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcMaterialDefinition::attr
+        {
+            static constexpr IntValue Name = 827;
+            static constexpr IntValue Description = 828;
+            static constexpr IntValue Category = 829;
+            static constexpr IntValue HasRepresentation = 830;
+            static constexpr IntValue IsRelatedWith = 831;
+            static constexpr IntValue RelatesTo = 832;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterial_CLASS_H
@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialClassificationRelationship_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialClassificationRelationship_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialClassificationRelationship
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialClassificationRelationship : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialClassificationRelationship
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialClassificationRelationship(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 356);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialClassificationRelationship in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialClassificationRelationship> Extent(SdaiModel model) { return ExtentRange<IfcMaterialClassificationRelationship>(model, 356, false); }
+        static ExtentRange<IfcMaterialClassificationRelationship> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialClassificationRelationship>(model, 356, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialClassificationRelationship and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialClassificationRelationship Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialClassificationRelationship"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialClassificationRelationship if the actual type of SdaiInstance is IfcMaterialClassificationRelationship or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialClassificationRelationship CreateExactEntity(SdaiInstance instance) { return IfcMaterialClassificationRelationship(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialClassificationRelationship or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialClassificationRelationship(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcClassificationSelect or list of convertible elements
+        template <typename TList> void get_MaterialClassifications(TList& lst) { RDF_EXPRESS_PROBE(833); SetOfIfcClassificationSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(833)); }
+
+        //TList may be SetOfIfcClassificationSelect or list of convertible elements
+        template <typename TList> void put_MaterialClassifications(TList& lst) { RDF_EXPRESS_PROBE(833); SetOfIfcClassificationSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(833)); }
+
+        IfcMaterial get_ClassifiedMaterial();
+        void put_ClassifiedMaterial(IfcMaterial inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue MaterialClassifications = 833;
+            static constexpr IntValue ClassifiedMaterial = 834;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialClassificationRelationship_CLASS_H
@@ -0,0 +1,104 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialConstituent_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialConstituent_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcMaterialDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialConstituent
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialConstituent : public RDF_EXPRESS_VIRTUAL IfcMaterialDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialConstituent
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialConstituent(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 357);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialConstituent in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialConstituent> Extent(SdaiModel model) { return ExtentRange<IfcMaterialConstituent>(model, 357, false); }
+        static ExtentRange<IfcMaterialConstituent> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialConstituent>(model, 357, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialConstituent and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialConstituent Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialConstituent"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialConstituent if the actual type of SdaiInstance is IfcMaterialConstituent or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialConstituent CreateExactEntity(SdaiInstance instance) { return IfcMaterialConstituent(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialConstituent or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialConstituent(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(835); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(835), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(835); sdaiPutAttr(m_instance, getAttrDefinition(835), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(835); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(836); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(836), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(836); sdaiPutAttr(m_instance, getAttrDefinition(836), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(836); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcMaterial get_Material();
+        void put_Material(IfcMaterial inst);
+
+        Nullable<IfcNormalisedRatioMeasure> get_Fraction() { RDF_EXPRESS_PROBE(838); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(838), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_Fraction(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(838); sdaiPutAttr(m_instance, getAttrDefinition(838), sdaiREAL, &value); }
+
+        IfcLabel get_Category() { RDF_EXPRESS_PROBE(839); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(839), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Category_view() { return TextView(get_Category()); }
+#endif
+        void put_Category(IfcLabel value) { RDF_EXPRESS_PROBE(839); sdaiPutAttr(m_instance, getAttrDefinition(839), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Category_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(839); return buffer.GetAttr(m_instance, "Category"); }
+        const char* get_Category_utf8() { return get_Category_utf8(ThreadUtf8Buffer()); }
+
+        IfcMaterialConstituentSet get_ToMaterialConstituentSet();
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcMaterialDefinition::attr
+        {
+            static constexpr IntValue Name = 835;
+            static constexpr IntValue Description = 836;
+            static constexpr IntValue Material = 837;
+            static constexpr IntValue Fraction = 838;
+            static constexpr IntValue Category = 839;
+            static constexpr IntValue ToMaterialConstituentSet = 840;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialConstituent_CLASS_H
@@ -0,0 +1,92 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialConstituentSet_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialConstituentSet_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcMaterialDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialConstituentSet
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialConstituentSet : public RDF_EXPRESS_VIRTUAL IfcMaterialDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialConstituentSet
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialConstituentSet(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 358);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialConstituentSet in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialConstituentSet> Extent(SdaiModel model) { return ExtentRange<IfcMaterialConstituentSet>(model, 358, false); }
+        static ExtentRange<IfcMaterialConstituentSet> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialConstituentSet>(model, 358, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialConstituentSet and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialConstituentSet Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialConstituentSet"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialConstituentSet if the actual type of SdaiInstance is IfcMaterialConstituentSet or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialConstituentSet CreateExactEntity(SdaiInstance instance) { return IfcMaterialConstituentSet(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialConstituentSet or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialConstituentSet(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(841); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(841), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(841); sdaiPutAttr(m_instance, getAttrDefinition(841), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(841); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(842); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(842), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(842); sdaiPutAttr(m_instance, getAttrDefinition(842), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(842); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcMaterialConstituent or list of convertible elements
+        template <typename TList> void get_MaterialConstituents(TList& lst) { RDF_EXPRESS_PROBE(843); SetOfIfcMaterialConstituentSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(843)); }
+
+        //TList may be SetOfIfcMaterialConstituent or list of convertible elements
+        template <typename TList> void put_MaterialConstituents(TList& lst) { RDF_EXPRESS_PROBE(843); SetOfIfcMaterialConstituentSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(843)); }
+
+        //TArrayElem[] may be IfcMaterialConstituent[] or array of convertible elements
+        template <typename TArrayElem> void put_MaterialConstituents(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(843); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcMaterialConstituentSerializer<SetOfIfcMaterialConstituent> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(843)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcMaterialDefinition::attr
+        {
+            static constexpr IntValue Name = 841;
+            static constexpr IntValue Description = 842;
+            static constexpr IntValue MaterialConstituents = 843;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialConstituentSet_CLASS_H
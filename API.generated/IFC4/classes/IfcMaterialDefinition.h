@@ -0,0 +1,67 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialDefinition_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialDefinition_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialDefinition
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialDefinition : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialDefinition
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialDefinition(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 359);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialDefinition in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialDefinition> Extent(SdaiModel model) { return ExtentRange<IfcMaterialDefinition>(model, 359, false); }
+        static ExtentRange<IfcMaterialDefinition> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialDefinition>(model, 359, true); }
+
+        /// <summary>
+        /// Returns object of IfcMaterialDefinition if the actual type of SdaiInstance is IfcMaterialDefinition or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialDefinition CreateExactEntity(SdaiInstance instance) { return IfcMaterialDefinition(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialDefinition or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialDefinition(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcRelAssociatesMaterial or list of convertible elements
+        template <typename TList> void get_AssociatedTo(TList& lst) { RDF_EXPRESS_PROBE(824); SetOfIfcRelAssociatesMaterialSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(824)); }
+
+        //TList may be SetOfIfcExternalReferenceRelationship or list of convertible elements
+        template <typename TList> void get_HasExternalReferences(TList& lst) { RDF_EXPRESS_PROBE(825); SetOfIfcExternalReferenceRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(825)); }
+
+        //TList may be SetOfIfcMaterialProperties or list of convertible elements
+        template <typename TList> void get_HasProperties(TList& lst) { RDF_EXPRESS_PROBE(826); SetOfIfcMaterialPropertiesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(826)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue AssociatedTo = 824;
+            static constexpr IntValue HasExternalReferences = 825;
+            static constexpr IntValue HasProperties = 826;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialDefinition_CLASS_H
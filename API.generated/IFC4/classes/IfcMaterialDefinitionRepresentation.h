@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialDefinitionRepresentation_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialDefinitionRepresentation_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProductRepresentation.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialDefinitionRepresentation
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialDefinitionRepresentation : public RDF_EXPRESS_VIRTUAL IfcProductRepresentation
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialDefinitionRepresentation
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialDefinitionRepresentation(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 360);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialDefinitionRepresentation in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialDefinitionRepresentation> Extent(SdaiModel model) { return ExtentRange<IfcMaterialDefinitionRepresentation>(model, 360, false); }
+        static ExtentRange<IfcMaterialDefinitionRepresentation> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialDefinitionRepresentation>(model, 360, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialDefinitionRepresentation and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialDefinitionRepresentation Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialDefinitionRepresentation"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialDefinitionRepresentation if the actual type of SdaiInstance is IfcMaterialDefinitionRepresentation or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialDefinitionRepresentation CreateExactEntity(SdaiInstance instance) { return IfcMaterialDefinitionRepresentation(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialDefinitionRepresentation or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialDefinitionRepresentation(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcMaterial get_RepresentedMaterial();
+        void put_RepresentedMaterial(IfcMaterial inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProductRepresentation::attr
+        {
+            static constexpr IntValue RepresentedMaterial = 847;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialDefinitionRepresentation_CLASS_H
@@ -0,0 +1,112 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialLayer_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialLayer_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcMaterialDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialLayer
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialLayer : public RDF_EXPRESS_VIRTUAL IfcMaterialDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialLayer
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialLayer(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 361);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialLayer in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialLayer> Extent(SdaiModel model) { return ExtentRange<IfcMaterialLayer>(model, 361, false); }
+        static ExtentRange<IfcMaterialLayer> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialLayer>(model, 361, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialLayer and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialLayer Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialLayer"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialLayer if the actual type of SdaiInstance is IfcMaterialLayer or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialLayer CreateExactEntity(SdaiInstance instance) { return IfcMaterialLayer(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialLayer or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialLayer(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcMaterial get_Material();
+        void put_Material(IfcMaterial inst);
+
+        Nullable<IfcNonNegativeLengthMeasure> get_LayerThickness() { RDF_EXPRESS_PROBE(849); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(849), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_LayerThickness(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(849); sdaiPutAttr(m_instance, getAttrDefinition(849), sdaiREAL, &value); }
+
+        Nullable<IfcLogical> get_IsVentilated() { RDF_EXPRESS_PROBE(850); int v = getENUM(850, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_IsVentilated(IfcLogical value) { RDF_EXPRESS_PROBE(850); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(850), sdaiENUM, val); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(851); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(851), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(851); sdaiPutAttr(m_instance, getAttrDefinition(851), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(851); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(852); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(852), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(852); sdaiPutAttr(m_instance, getAttrDefinition(852), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(852); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Category() { RDF_EXPRESS_PROBE(853); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(853), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Category_view() { return TextView(get_Category()); }
+#endif
+        void put_Category(IfcLabel value) { RDF_EXPRESS_PROBE(853); sdaiPutAttr(m_instance, getAttrDefinition(853), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Category_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(853); return buffer.GetAttr(m_instance, "Category"); }
+        const char* get_Category_utf8() { return get_Category_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcInteger> get_Priority() { RDF_EXPRESS_PROBE(854); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(854), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_Priority(IfcInteger value) { RDF_EXPRESS_PROBE(854); sdaiPutAttr(m_instance, getAttrDefinition(854), sdaiINTEGER, &value); }
+
+        IfcMaterialLayerSet get_ToMaterialLayerSet();
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcMaterialDefinition::attr
+        {
+            static constexpr IntValue Material = 848;
+            static constexpr IntValue LayerThickness = 849;
+            static constexpr IntValue IsVentilated = 850;
+            static constexpr IntValue Name = 851;
+            static constexpr IntValue Description = 852;
+            static constexpr IntValue Category = 853;
+            static constexpr IntValue Priority = 854;
+            static constexpr IntValue ToMaterialLayerSet = 855;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialLayer_CLASS_H
@@ -0,0 +1,95 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialLayerSet_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialLayerSet_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcMaterialDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialLayerSet
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialLayerSet : public RDF_EXPRESS_VIRTUAL IfcMaterialDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialLayerSet
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialLayerSet(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 362);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialLayerSet in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialLayerSet> Extent(SdaiModel model) { return ExtentRange<IfcMaterialLayerSet>(model, 362, false); }
+        static ExtentRange<IfcMaterialLayerSet> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialLayerSet>(model, 362, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialLayerSet and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialLayerSet Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialLayerSet"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialLayerSet if the actual type of SdaiInstance is IfcMaterialLayerSet or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialLayerSet CreateExactEntity(SdaiInstance instance) { return IfcMaterialLayerSet(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialLayerSet or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialLayerSet(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcMaterialLayer or list of convertible elements
+        template <typename TList> void get_MaterialLayers(TList& lst) { RDF_EXPRESS_PROBE(856); ListOfIfcMaterialLayerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(856)); }
+
+        //TList may be ListOfIfcMaterialLayer or list of convertible elements
+        template <typename TList> void put_MaterialLayers(TList& lst) { RDF_EXPRESS_PROBE(856); ListOfIfcMaterialLayerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(856)); }
+
+        //TArrayElem[] may be IfcMaterialLayer[] or array of convertible elements
+        template <typename TArrayElem> void put_MaterialLayers(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(856); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcMaterialLayerSerializer<ListOfIfcMaterialLayer> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(856)); }
+
+        IfcLabel get_LayerSetName() { RDF_EXPRESS_PROBE(857); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(857), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LayerSetName_view() { return TextView(get_LayerSetName()); }
+#endif
+        void put_LayerSetName(IfcLabel value) { RDF_EXPRESS_PROBE(857); sdaiPutAttr(m_instance, getAttrDefinition(857), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LayerSetName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(857); return buffer.GetAttr(m_instance, "LayerSetName"); }
+        const char* get_LayerSetName_utf8() { return get_LayerSetName_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(858); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(858), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(858); sdaiPutAttr(m_instance, getAttrDefinition(858), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(858); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcLengthMeasure> get_TotalThickness() { RDF_EXPRESS_PROBE(859); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(859), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcMaterialDefinition::attr
+        {
+            static constexpr IntValue MaterialLayers = 856;
+            static constexpr IntValue LayerSetName = 857;
+            static constexpr IntValue Description = 858;
+            static constexpr IntValue TotalThickness = 859;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialLayerSet_CLASS_H
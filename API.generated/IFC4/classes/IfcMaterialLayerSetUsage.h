@@ -0,0 +1,80 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialLayerSetUsage_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialLayerSetUsage_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcMaterialUsageDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialLayerSetUsage
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialLayerSetUsage : public RDF_EXPRESS_VIRTUAL IfcMaterialUsageDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialLayerSetUsage
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialLayerSetUsage(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 363);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialLayerSetUsage in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialLayerSetUsage> Extent(SdaiModel model) { return ExtentRange<IfcMaterialLayerSetUsage>(model, 363, false); }
+        static ExtentRange<IfcMaterialLayerSetUsage> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialLayerSetUsage>(model, 363, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialLayerSetUsage and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialLayerSetUsage Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialLayerSetUsage"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialLayerSetUsage if the actual type of SdaiInstance is IfcMaterialLayerSetUsage or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialLayerSetUsage CreateExactEntity(SdaiInstance instance) { return IfcMaterialLayerSetUsage(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialLayerSetUsage or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialLayerSetUsage(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcMaterialLayerSet get_ForLayerSet();
+        void put_ForLayerSet(IfcMaterialLayerSet inst);
+
+        Nullable<IfcLayerSetDirectionEnum> get_LayerSetDirection() { RDF_EXPRESS_PROBE(862); int v = getENUM(862, IfcLayerSetDirectionEnum_hash); if (v >= 0) return (IfcLayerSetDirectionEnum) v; else return Nullable<IfcLayerSetDirectionEnum>(); }
+        void put_LayerSetDirection(IfcLayerSetDirectionEnum value) { RDF_EXPRESS_PROBE(862); TextValue val = IfcLayerSetDirectionEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(862), sdaiENUM, val); }
+
+        Nullable<IfcDirectionSenseEnum> get_DirectionSense() { RDF_EXPRESS_PROBE(863); int v = getENUM(863, IfcDirectionSenseEnum_hash); if (v >= 0) return (IfcDirectionSenseEnum) v; else return Nullable<IfcDirectionSenseEnum>(); }
+        void put_DirectionSense(IfcDirectionSenseEnum value) { RDF_EXPRESS_PROBE(863); TextValue val = IfcDirectionSenseEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(863), sdaiENUM, val); }
+
+        Nullable<IfcLengthMeasure> get_OffsetFromReferenceLine() { RDF_EXPRESS_PROBE(864); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(864), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_OffsetFromReferenceLine(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(864); sdaiPutAttr(m_instance, getAttrDefinition(864), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_ReferenceExtent() { RDF_EXPRESS_PROBE(865); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(865), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_ReferenceExtent(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(865); sdaiPutAttr(m_instance, getAttrDefinition(865), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcMaterialUsageDefinition::attr
+        {
+            static constexpr IntValue ForLayerSet = 861;
+            static constexpr IntValue LayerSetDirection = 862;
+            static constexpr IntValue DirectionSense = 863;
+            static constexpr IntValue OffsetFromReferenceLine = 864;
+            static constexpr IntValue ReferenceExtent = 865;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialLayerSetUsage_CLASS_H
@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialLayerWithOffsets_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialLayerWithOffsets_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcMaterialLayer.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialLayerWithOffsets
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialLayerWithOffsets : public RDF_EXPRESS_VIRTUAL IfcMaterialLayer
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialLayerWithOffsets
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialLayerWithOffsets(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 364);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialLayerWithOffsets in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialLayerWithOffsets> Extent(SdaiModel model) { return ExtentRange<IfcMaterialLayerWithOffsets>(model, 364, false); }
+        static ExtentRange<IfcMaterialLayerWithOffsets> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialLayerWithOffsets>(model, 364, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialLayerWithOffsets and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialLayerWithOffsets Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialLayerWithOffsets"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialLayerWithOffsets if the actual type of SdaiInstance is IfcMaterialLayerWithOffsets or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialLayerWithOffsets CreateExactEntity(SdaiInstance instance) { return IfcMaterialLayerWithOffsets(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialLayerWithOffsets or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialLayerWithOffsets(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLayerSetDirectionEnum> get_OffsetDirection() { RDF_EXPRESS_PROBE(866); int v = getENUM(866, IfcLayerSetDirectionEnum_hash); if (v >= 0) return (IfcLayerSetDirectionEnum) v; else return Nullable<IfcLayerSetDirectionEnum>(); }
+        void put_OffsetDirection(IfcLayerSetDirectionEnum value) { RDF_EXPRESS_PROBE(866); TextValue val = IfcLayerSetDirectionEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(866), sdaiENUM, val); }
+
+        //TList may be ArrayOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void get_OffsetValues(TList& lst) { RDF_EXPRESS_PROBE(867); ArrayOfIfcLengthMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(867)); }
+
+        //TList may be ArrayOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void put_OffsetValues(TList& lst) { RDF_EXPRESS_PROBE(867); ArrayOfIfcLengthMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(867)); }
+
+        //TArrayElem[] may be IfcLengthMeasure[] or array of convertible elements
+        template <typename TArrayElem> void put_OffsetValues(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(867); ArrayRange<TArrayElem> range = {arr, n}; ArrayOfIfcLengthMeasureSerializer<ArrayOfIfcLengthMeasure> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(867)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcMaterialLayer::attr
+        {
+            static constexpr IntValue OffsetDirection = 866;
+            static constexpr IntValue OffsetValues = 867;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialLayerWithOffsets_CLASS_H
@@ -0,0 +1,69 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialList_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialList_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialList
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialList : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialList
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialList(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 365);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialList in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialList> Extent(SdaiModel model) { return ExtentRange<IfcMaterialList>(model, 365, false); }
+        static ExtentRange<IfcMaterialList> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialList>(model, 365, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialList and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialList Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialList"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialList if the actual type of SdaiInstance is IfcMaterialList or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialList CreateExactEntity(SdaiInstance instance) { return IfcMaterialList(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialList or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialList(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcMaterial or list of convertible elements
+        template <typename TList> void get_Materials(TList& lst) { RDF_EXPRESS_PROBE(868); ListOfIfcMaterialSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(868)); }
+
+        //TList may be ListOfIfcMaterial or list of convertible elements
+        template <typename TList> void put_Materials(TList& lst) { RDF_EXPRESS_PROBE(868); ListOfIfcMaterialSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(868)); }
+
+        //TArrayElem[] may be IfcMaterial[] or array of convertible elements
+        template <typename TArrayElem> void put_Materials(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(868); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcMaterialSerializer<ListOfIfcMaterial> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(868)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Materials = 868;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialList_CLASS_H
@@ -0,0 +1,108 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialProfile_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialProfile_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcMaterialDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialProfile
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialProfile : public RDF_EXPRESS_VIRTUAL IfcMaterialDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialProfile
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialProfile(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 366);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialProfile in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialProfile> Extent(SdaiModel model) { return ExtentRange<IfcMaterialProfile>(model, 366, false); }
+        static ExtentRange<IfcMaterialProfile> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialProfile>(model, 366, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialProfile and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialProfile Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialProfile"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialProfile if the actual type of SdaiInstance is IfcMaterialProfile or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialProfile CreateExactEntity(SdaiInstance instance) { return IfcMaterialProfile(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialProfile or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialProfile(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(869); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(869), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(869); sdaiPutAttr(m_instance, getAttrDefinition(869), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(869); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(870); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(870), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(870); sdaiPutAttr(m_instance, getAttrDefinition(870), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(870); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcMaterial get_Material();
+        void put_Material(IfcMaterial inst);
+
+        IfcProfileDef get_Profile();
+        void put_Profile(IfcProfileDef inst);
+
+        Nullable<IfcInteger> get_Priority() { RDF_EXPRESS_PROBE(873); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(873), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_Priority(IfcInteger value) { RDF_EXPRESS_PROBE(873); sdaiPutAttr(m_instance, getAttrDefinition(873), sdaiINTEGER, &value); }
+
+        IfcLabel get_Category() { RDF_EXPRESS_PROBE(874); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(874), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Category_view() { return TextView(get_Category()); }
+#endif
+        void put_Category(IfcLabel value) { RDF_EXPRESS_PROBE(874); sdaiPutAttr(m_instance, getAttrDefinition(874), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Category_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(874); return buffer.GetAttr(m_instance, "Category"); }
+        const char* get_Category_utf8() { return get_Category_utf8(ThreadUtf8Buffer()); }
+
+        IfcMaterialProfileSet get_ToMaterialProfileSet();
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcMaterialDefinition::attr
+        {
+            static constexpr IntValue Name = 869;
+            static constexpr IntValue Description = 870;
+            static constexpr IntValue Material = 871;
+            static constexpr IntValue Profile = 872;
+            static constexpr IntValue Priority = 873;
+            static constexpr IntValue Category = 874;
+            static constexpr IntValue ToMaterialProfileSet = 875;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialProfile_CLASS_H
@@ -0,0 +1,96 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialProfileSet_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialProfileSet_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcMaterialDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialProfileSet
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialProfileSet : public RDF_EXPRESS_VIRTUAL IfcMaterialDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialProfileSet
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialProfileSet(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 367);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialProfileSet in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialProfileSet> Extent(SdaiModel model) { return ExtentRange<IfcMaterialProfileSet>(model, 367, false); }
+        static ExtentRange<IfcMaterialProfileSet> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialProfileSet>(model, 367, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialProfileSet and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialProfileSet Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialProfileSet"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialProfileSet if the actual type of SdaiInstance is IfcMaterialProfileSet or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialProfileSet CreateExactEntity(SdaiInstance instance) { return IfcMaterialProfileSet(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialProfileSet or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialProfileSet(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(876); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(876), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(876); sdaiPutAttr(m_instance, getAttrDefinition(876), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(876); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(877); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(877), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(877); sdaiPutAttr(m_instance, getAttrDefinition(877), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(877); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcMaterialProfile or list of convertible elements
+        template <typename TList> void get_MaterialProfiles(TList& lst) { RDF_EXPRESS_PROBE(878); ListOfIfcMaterialProfileSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(878)); }
+
+        //TList may be ListOfIfcMaterialProfile or list of convertible elements
+        template <typename TList> void put_MaterialProfiles(TList& lst) { RDF_EXPRESS_PROBE(878); ListOfIfcMaterialProfileSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(878)); }
+
+        //TArrayElem[] may be IfcMaterialProfile[] or array of convertible elements
+        template <typename TArrayElem> void put_MaterialProfiles(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(878); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcMaterialProfileSerializer<ListOfIfcMaterialProfile> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(878)); }
+
+        IfcCompositeProfileDef get_CompositeProfile();
+        void put_CompositeProfile(IfcCompositeProfileDef inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcMaterialDefinition::attr
+        {
+            static constexpr IntValue Name = 876;
+            static constexpr IntValue Description = 877;
+            static constexpr IntValue MaterialProfiles = 878;
+            static constexpr IntValue CompositeProfile = 879;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialProfileSet_CLASS_H
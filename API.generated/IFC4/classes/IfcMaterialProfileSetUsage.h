@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialProfileSetUsage_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialProfileSetUsage_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcMaterialUsageDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialProfileSetUsage
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialProfileSetUsage : public RDF_EXPRESS_VIRTUAL IfcMaterialUsageDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialProfileSetUsage
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialProfileSetUsage(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 368);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialProfileSetUsage in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialProfileSetUsage> Extent(SdaiModel model) { return ExtentRange<IfcMaterialProfileSetUsage>(model, 368, false); }
+        static ExtentRange<IfcMaterialProfileSetUsage> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialProfileSetUsage>(model, 368, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialProfileSetUsage and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialProfileSetUsage Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialProfileSetUsage"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialProfileSetUsage if the actual type of SdaiInstance is IfcMaterialProfileSetUsage or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialProfileSetUsage CreateExactEntity(SdaiInstance instance) { return IfcMaterialProfileSetUsage(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialProfileSetUsage or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialProfileSetUsage(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcMaterialProfileSet get_ForProfileSet();
+        void put_ForProfileSet(IfcMaterialProfileSet inst);
+
+        Nullable<IfcCardinalPointReference> get_CardinalPoint() { RDF_EXPRESS_PROBE(881); IfcCardinalPointReference val = (IfcCardinalPointReference) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(881), sdaiINTEGER, &val)) return val; else return Nullable<IfcCardinalPointReference>(); }
+        void put_CardinalPoint(IfcCardinalPointReference value) { RDF_EXPRESS_PROBE(881); sdaiPutAttr(m_instance, getAttrDefinition(881), sdaiINTEGER, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_ReferenceExtent() { RDF_EXPRESS_PROBE(882); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(882), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_ReferenceExtent(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(882); sdaiPutAttr(m_instance, getAttrDefinition(882), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcMaterialUsageDefinition::attr
+        {
+            static constexpr IntValue ForProfileSet = 880;
+            static constexpr IntValue CardinalPoint = 881;
+            static constexpr IntValue ReferenceExtent = 882;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialProfileSetUsage_CLASS_H
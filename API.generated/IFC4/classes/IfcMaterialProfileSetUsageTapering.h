@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialProfileSetUsageTapering_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialProfileSetUsageTapering_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcMaterialProfileSetUsage.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialProfileSetUsageTapering
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialProfileSetUsageTapering : public RDF_EXPRESS_VIRTUAL IfcMaterialProfileSetUsage
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialProfileSetUsageTapering
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialProfileSetUsageTapering(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 369);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialProfileSetUsageTapering in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialProfileSetUsageTapering> Extent(SdaiModel model) { return ExtentRange<IfcMaterialProfileSetUsageTapering>(model, 369, false); }
+        static ExtentRange<IfcMaterialProfileSetUsageTapering> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialProfileSetUsageTapering>(model, 369, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialProfileSetUsageTapering and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialProfileSetUsageTapering Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialProfileSetUsageTapering"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialProfileSetUsageTapering if the actual type of SdaiInstance is IfcMaterialProfileSetUsageTapering or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialProfileSetUsageTapering CreateExactEntity(SdaiInstance instance) { return IfcMaterialProfileSetUsageTapering(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialProfileSetUsageTapering or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialProfileSetUsageTapering(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcMaterialProfileSet get_ForProfileEndSet();
+        void put_ForProfileEndSet(IfcMaterialProfileSet inst);
+
+        Nullable<IfcCardinalPointReference> get_CardinalEndPoint() { RDF_EXPRESS_PROBE(884); IfcCardinalPointReference val = (IfcCardinalPointReference) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(884), sdaiINTEGER, &val)) return val; else return Nullable<IfcCardinalPointReference>(); }
+        void put_CardinalEndPoint(IfcCardinalPointReference value) { RDF_EXPRESS_PROBE(884); sdaiPutAttr(m_instance, getAttrDefinition(884), sdaiINTEGER, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcMaterialProfileSetUsage::attr
+        {
+            static constexpr IntValue ForProfileEndSet = 883;
+            static constexpr IntValue CardinalEndPoint = 884;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialProfileSetUsageTapering_CLASS_H
@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialProfileWithOffsets_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialProfileWithOffsets_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcMaterialProfile.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialProfileWithOffsets
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialProfileWithOffsets : public RDF_EXPRESS_VIRTUAL IfcMaterialProfile
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialProfileWithOffsets
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialProfileWithOffsets(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 370);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialProfileWithOffsets in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialProfileWithOffsets> Extent(SdaiModel model) { return ExtentRange<IfcMaterialProfileWithOffsets>(model, 370, false); }
+        static ExtentRange<IfcMaterialProfileWithOffsets> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialProfileWithOffsets>(model, 370, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialProfileWithOffsets and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialProfileWithOffsets Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialProfileWithOffsets"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialProfileWithOffsets if the actual type of SdaiInstance is IfcMaterialProfileWithOffsets or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialProfileWithOffsets CreateExactEntity(SdaiInstance instance) { return IfcMaterialProfileWithOffsets(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialProfileWithOffsets or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialProfileWithOffsets(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ArrayOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void get_OffsetValues(TList& lst) { RDF_EXPRESS_PROBE(885); ArrayOfIfcLengthMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(885)); }
+
+        //TList may be ArrayOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void put_OffsetValues(TList& lst) { RDF_EXPRESS_PROBE(885); ArrayOfIfcLengthMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(885)); }
+
+        //TArrayElem[] may be IfcLengthMeasure[] or array of convertible elements
+        template <typename TArrayElem> void put_OffsetValues(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(885); ArrayRange<TArrayElem> range = {arr, n}; ArrayOfIfcLengthMeasureSerializer<ArrayOfIfcLengthMeasure> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(885)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcMaterialProfile::attr
+        {
+            static constexpr IntValue OffsetValues = 885;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialProfileWithOffsets_CLASS_H
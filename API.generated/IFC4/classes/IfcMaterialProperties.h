@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcExtendedProperties.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialProperties : public RDF_EXPRESS_VIRTUAL IfcExtendedProperties
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 371);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialProperties> Extent(SdaiModel model) { return ExtentRange<IfcMaterialProperties>(model, 371, false); }
+        static ExtentRange<IfcMaterialProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialProperties>(model, 371, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialProperties and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialProperties Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialProperties"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialProperties if the actual type of SdaiInstance is IfcMaterialProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialProperties CreateExactEntity(SdaiInstance instance) { return IfcMaterialProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcMaterialDefinition get_Material();
+        void put_Material(IfcMaterialDefinition inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcExtendedProperties::attr
+        {
+            static constexpr IntValue Material = 886;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialProperties_CLASS_H
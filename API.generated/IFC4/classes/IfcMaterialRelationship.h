@@ -0,0 +1,85 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialRelationship_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialRelationship_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcResourceLevelRelationship.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialRelationship
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialRelationship : public RDF_EXPRESS_VIRTUAL IfcResourceLevelRelationship
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialRelationship
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialRelationship(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 372);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialRelationship in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialRelationship> Extent(SdaiModel model) { return ExtentRange<IfcMaterialRelationship>(model, 372, false); }
+        static ExtentRange<IfcMaterialRelationship> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialRelationship>(model, 372, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMaterialRelationship and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMaterialRelationship Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMaterialRelationship"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMaterialRelationship if the actual type of SdaiInstance is IfcMaterialRelationship or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialRelationship CreateExactEntity(SdaiInstance instance) { return IfcMaterialRelationship(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialRelationship or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialRelationship(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcMaterial get_RelatingMaterial();
+        void put_RelatingMaterial(IfcMaterial inst);
+
+        //TList may be SetOfIfcMaterial or list of convertible elements
+        template <typename TList> void get_RelatedMaterials(TList& lst) { RDF_EXPRESS_PROBE(888); SetOfIfcMaterialSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(888)); }
+
+        //TList may be SetOfIfcMaterial or list of convertible elements
+        template <typename TList> void put_RelatedMaterials(TList& lst) { RDF_EXPRESS_PROBE(888); SetOfIfcMaterialSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(888)); }
+
+        //TArrayElem[] may be IfcMaterial[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedMaterials(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(888); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcMaterialSerializer<SetOfIfcMaterial> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(888)); }
+
+        IfcLabel get_Expression() { RDF_EXPRESS_PROBE(889); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(889), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Expression_view() { return TextView(get_Expression()); }
+#endif
+        void put_Expression(IfcLabel value) { RDF_EXPRESS_PROBE(889); sdaiPutAttr(m_instance, getAttrDefinition(889), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Expression_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(889); return buffer.GetAttr(m_instance, "Expression"); }
+        const char* get_Expression_utf8() { return get_Expression_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcResourceLevelRelationship::attr
+        {
+            static constexpr IntValue RelatingMaterial = 887;
+            static constexpr IntValue RelatedMaterials = 888;
+            static constexpr IntValue Expression = 889;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialRelationship_CLASS_H
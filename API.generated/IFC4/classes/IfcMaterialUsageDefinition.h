@@ -0,0 +1,59 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialUsageDefinition_CLASS_H
+#define __RDF_LTD__IFC4_IfcMaterialUsageDefinition_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMaterialUsageDefinition
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMaterialUsageDefinition : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMaterialUsageDefinition
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMaterialUsageDefinition(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 373);
+        }
+
+        /// <summary>
+        /// Instances of IfcMaterialUsageDefinition in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMaterialUsageDefinition> Extent(SdaiModel model) { return ExtentRange<IfcMaterialUsageDefinition>(model, 373, false); }
+        static ExtentRange<IfcMaterialUsageDefinition> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMaterialUsageDefinition>(model, 373, true); }
+
+        /// <summary>
+        /// Returns object of IfcMaterialUsageDefinition if the actual type of SdaiInstance is IfcMaterialUsageDefinition or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMaterialUsageDefinition CreateExactEntity(SdaiInstance instance) { return IfcMaterialUsageDefinition(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMaterialUsageDefinition or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMaterialUsageDefinition(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcRelAssociatesMaterial or list of convertible elements
+        template <typename TList> void get_AssociatedTo(TList& lst) { RDF_EXPRESS_PROBE(860); SetOfIfcRelAssociatesMaterialSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(860)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue AssociatedTo = 860;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialUsageDefinition_CLASS_H
@@ -0,0 +1,67 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMeasureWithUnit_CLASS_H
+#define __RDF_LTD__IFC4_IfcMeasureWithUnit_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMeasureWithUnit
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMeasureWithUnit : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMeasureWithUnit
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMeasureWithUnit(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 374);
+        }
+
+        /// <summary>
+        /// Instances of IfcMeasureWithUnit in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMeasureWithUnit> Extent(SdaiModel model) { return ExtentRange<IfcMeasureWithUnit>(model, 374, false); }
+        static ExtentRange<IfcMeasureWithUnit> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMeasureWithUnit>(model, 374, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMeasureWithUnit and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMeasureWithUnit Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMeasureWithUnit"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMeasureWithUnit if the actual type of SdaiInstance is IfcMeasureWithUnit or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMeasureWithUnit CreateExactEntity(SdaiInstance instance) { return IfcMeasureWithUnit(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMeasureWithUnit or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMeasureWithUnit(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcValue_get get_ValueComponent() { return IfcValue_get(m_instance, 890); }
+        IfcValue_put put_ValueComponent() { return IfcValue_put(m_instance, 890); }
+
+        IfcUnit_get get_UnitComponent() { return IfcUnit_get(m_instance, 891); }
+        IfcUnit_put put_UnitComponent() { return IfcUnit_put(m_instance, 891); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue ValueComponent = 890;
+            static constexpr IntValue UnitComponent = 891;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMeasureWithUnit_CLASS_H
@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMechanicalFastener_CLASS_H
+#define __RDF_LTD__IFC4_IfcMechanicalFastener_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementComponent.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMechanicalFastener
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMechanicalFastener : public RDF_EXPRESS_VIRTUAL IfcElementComponent
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMechanicalFastener
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMechanicalFastener(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 375);
+        }
+
+        /// <summary>
+        /// Instances of IfcMechanicalFastener in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMechanicalFastener> Extent(SdaiModel model) { return ExtentRange<IfcMechanicalFastener>(model, 375, false); }
+        static ExtentRange<IfcMechanicalFastener> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMechanicalFastener>(model, 375, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMechanicalFastener and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMechanicalFastener Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMechanicalFastener"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMechanicalFastener if the actual type of SdaiInstance is IfcMechanicalFastener or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMechanicalFastener CreateExactEntity(SdaiInstance instance) { return IfcMechanicalFastener(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMechanicalFastener or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMechanicalFastener(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_NominalDiameter() { RDF_EXPRESS_PROBE(892); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(892), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_NominalDiameter(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(892); sdaiPutAttr(m_instance, getAttrDefinition(892), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_NominalLength() { RDF_EXPRESS_PROBE(893); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(893), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_NominalLength(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(893); sdaiPutAttr(m_instance, getAttrDefinition(893), sdaiREAL, &value); }
+
+        Nullable<IfcMechanicalFastenerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(894); int v = getENUM(894, IfcMechanicalFastenerTypeEnum_hash); if (v >= 0) return (IfcMechanicalFastenerTypeEnum) v; else return Nullable<IfcMechanicalFastenerTypeEnum>(); }
+        void put_PredefinedType(IfcMechanicalFastenerTypeEnum value) { RDF_EXPRESS_PROBE(894); TextValue val = IfcMechanicalFastenerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(894), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementComponent::attr
+        {
+            static constexpr IntValue NominalDiameter = 892;
+            static constexpr IntValue NominalLength = 893;
+            static constexpr IntValue PredefinedType = 894;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMechanicalFastener_CLASS_H
@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMechanicalFastenerType_CLASS_H
+#define __RDF_LTD__IFC4_IfcMechanicalFastenerType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementComponentType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMechanicalFastenerType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMechanicalFastenerType : public RDF_EXPRESS_VIRTUAL IfcElementComponentType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMechanicalFastenerType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMechanicalFastenerType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 376);
+        }
+
+        /// <summary>
+        /// Instances of IfcMechanicalFastenerType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMechanicalFastenerType> Extent(SdaiModel model) { return ExtentRange<IfcMechanicalFastenerType>(model, 376, false); }
+        static ExtentRange<IfcMechanicalFastenerType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMechanicalFastenerType>(model, 376, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMechanicalFastenerType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMechanicalFastenerType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMechanicalFastenerType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMechanicalFastenerType if the actual type of SdaiInstance is IfcMechanicalFastenerType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMechanicalFastenerType CreateExactEntity(SdaiInstance instance) { return IfcMechanicalFastenerType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMechanicalFastenerType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMechanicalFastenerType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcMechanicalFastenerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(895); int v = getENUM(895, IfcMechanicalFastenerTypeEnum_hash); if (v >= 0) return (IfcMechanicalFastenerTypeEnum) v; else return Nullable<IfcMechanicalFastenerTypeEnum>(); }
+        void put_PredefinedType(IfcMechanicalFastenerTypeEnum value) { RDF_EXPRESS_PROBE(895); TextValue val = IfcMechanicalFastenerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(895), sdaiENUM, val); }
+
+        Nullable<IfcPositiveLengthMeasure> get_NominalDiameter() { RDF_EXPRESS_PROBE(896); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(896), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_NominalDiameter(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(896); sdaiPutAttr(m_instance, getAttrDefinition(896), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_NominalLength() { RDF_EXPRESS_PROBE(897); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(897), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_NominalLength(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(897); sdaiPutAttr(m_instance, getAttrDefinition(897), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementComponentType::attr
+        {
+            static constexpr IntValue PredefinedType = 895;
+            static constexpr IntValue NominalDiameter = 896;
+            static constexpr IntValue NominalLength = 897;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMechanicalFastenerType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMedicalDevice_CLASS_H
+#define __RDF_LTD__IFC4_IfcMedicalDevice_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMedicalDevice
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMedicalDevice : public RDF_EXPRESS_VIRTUAL IfcFlowTerminal
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMedicalDevice
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMedicalDevice(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 377);
+        }
+
+        /// <summary>
+        /// Instances of IfcMedicalDevice in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMedicalDevice> Extent(SdaiModel model) { return ExtentRange<IfcMedicalDevice>(model, 377, false); }
+        static ExtentRange<IfcMedicalDevice> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMedicalDevice>(model, 377, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMedicalDevice and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMedicalDevice Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMedicalDevice"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMedicalDevice if the actual type of SdaiInstance is IfcMedicalDevice or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMedicalDevice CreateExactEntity(SdaiInstance instance) { return IfcMedicalDevice(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMedicalDevice or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMedicalDevice(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcMedicalDeviceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(898); int v = getENUM(898, IfcMedicalDeviceTypeEnum_hash); if (v >= 0) return (IfcMedicalDeviceTypeEnum) v; else return Nullable<IfcMedicalDeviceTypeEnum>(); }
+        void put_PredefinedType(IfcMedicalDeviceTypeEnum value) { RDF_EXPRESS_PROBE(898); TextValue val = IfcMedicalDeviceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(898), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminal::attr
+        {
+            static constexpr IntValue PredefinedType = 898;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMedicalDevice_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMedicalDeviceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcMedicalDeviceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMedicalDeviceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMedicalDeviceType : public RDF_EXPRESS_VIRTUAL IfcFlowTerminalType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMedicalDeviceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMedicalDeviceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 378);
+        }
+
+        /// <summary>
+        /// Instances of IfcMedicalDeviceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMedicalDeviceType> Extent(SdaiModel model) { return ExtentRange<IfcMedicalDeviceType>(model, 378, false); }
+        static ExtentRange<IfcMedicalDeviceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMedicalDeviceType>(model, 378, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMedicalDeviceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMedicalDeviceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMedicalDeviceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMedicalDeviceType if the actual type of SdaiInstance is IfcMedicalDeviceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMedicalDeviceType CreateExactEntity(SdaiInstance instance) { return IfcMedicalDeviceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMedicalDeviceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMedicalDeviceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcMedicalDeviceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(899); int v = getENUM(899, IfcMedicalDeviceTypeEnum_hash); if (v >= 0) return (IfcMedicalDeviceTypeEnum) v; else return Nullable<IfcMedicalDeviceTypeEnum>(); }
+        void put_PredefinedType(IfcMedicalDeviceTypeEnum value) { RDF_EXPRESS_PROBE(899); TextValue val = IfcMedicalDeviceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(899), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminalType::attr
+        {
+            static constexpr IntValue PredefinedType = 899;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMedicalDeviceType_CLASS_H
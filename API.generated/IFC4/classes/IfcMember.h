@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMember_CLASS_H
+#define __RDF_LTD__IFC4_IfcMember_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMember
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMember : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMember
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMember(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 379);
+        }
+
+        /// <summary>
+        /// Instances of IfcMember in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMember> Extent(SdaiModel model) { return ExtentRange<IfcMember>(model, 379, false); }
+        static ExtentRange<IfcMember> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMember>(model, 379, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMember and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMember Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMember"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMember if the actual type of SdaiInstance is IfcMember or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMember CreateExactEntity(SdaiInstance instance) { return IfcMember(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMember or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMember(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcMemberTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(900); int v = getENUM(900, IfcMemberTypeEnum_hash); if (v >= 0) return (IfcMemberTypeEnum) v; else return Nullable<IfcMemberTypeEnum>(); }
+        void put_PredefinedType(IfcMemberTypeEnum value) { RDF_EXPRESS_PROBE(900); TextValue val = IfcMemberTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(900), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 900;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMember_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMemberStandardCase_CLASS_H
+#define __RDF_LTD__IFC4_IfcMemberStandardCase_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcMember.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMemberStandardCase
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMemberStandardCase : public RDF_EXPRESS_VIRTUAL IfcMember
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMemberStandardCase
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMemberStandardCase(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 380);
+        }
+
+        /// <summary>
+        /// Instances of IfcMemberStandardCase in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMemberStandardCase> Extent(SdaiModel model) { return ExtentRange<IfcMemberStandardCase>(model, 380, false); }
+        static ExtentRange<IfcMemberStandardCase> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMemberStandardCase>(model, 380, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMemberStandardCase and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMemberStandardCase Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMemberStandardCase"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMemberStandardCase if the actual type of SdaiInstance is IfcMemberStandardCase or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMemberStandardCase CreateExactEntity(SdaiInstance instance) { return IfcMemberStandardCase(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMemberStandardCase or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMemberStandardCase(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcMember::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMemberStandardCase_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMemberType_CLASS_H
+#define __RDF_LTD__IFC4_IfcMemberType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMemberType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMemberType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMemberType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMemberType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 381);
+        }
+
+        /// <summary>
+        /// Instances of IfcMemberType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMemberType> Extent(SdaiModel model) { return ExtentRange<IfcMemberType>(model, 381, false); }
+        static ExtentRange<IfcMemberType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMemberType>(model, 381, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMemberType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMemberType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMemberType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMemberType if the actual type of SdaiInstance is IfcMemberType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMemberType CreateExactEntity(SdaiInstance instance) { return IfcMemberType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMemberType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMemberType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcMemberTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(901); int v = getENUM(901, IfcMemberTypeEnum_hash); if (v >= 0) return (IfcMemberTypeEnum) v; else return Nullable<IfcMemberTypeEnum>(); }
+        void put_PredefinedType(IfcMemberTypeEnum value) { RDF_EXPRESS_PROBE(901); TextValue val = IfcMemberTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(901), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 901;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMemberType_CLASS_H
@@ -0,0 +1,83 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMetric_CLASS_H
+#define __RDF_LTD__IFC4_IfcMetric_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstraint.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMetric
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMetric : public RDF_EXPRESS_VIRTUAL IfcConstraint
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMetric
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMetric(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 382);
+        }
+
+        /// <summary>
+        /// Instances of IfcMetric in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMetric> Extent(SdaiModel model) { return ExtentRange<IfcMetric>(model, 382, false); }
+        static ExtentRange<IfcMetric> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMetric>(model, 382, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMetric and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMetric Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMetric"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMetric if the actual type of SdaiInstance is IfcMetric or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMetric CreateExactEntity(SdaiInstance instance) { return IfcMetric(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMetric or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMetric(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBenchmarkEnum> get_Benchmark() { RDF_EXPRESS_PROBE(902); int v = getENUM(902, IfcBenchmarkEnum_hash); if (v >= 0) return (IfcBenchmarkEnum) v; else return Nullable<IfcBenchmarkEnum>(); }
+        void put_Benchmark(IfcBenchmarkEnum value) { RDF_EXPRESS_PROBE(902); TextValue val = IfcBenchmarkEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(902), sdaiENUM, val); }
+
+        IfcLabel get_ValueSource() { RDF_EXPRESS_PROBE(903); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(903), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ValueSource_view() { return TextView(get_ValueSource()); }
+#endif
+        void put_ValueSource(IfcLabel value) { RDF_EXPRESS_PROBE(903); sdaiPutAttr(m_instance, getAttrDefinition(903), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ValueSource_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(903); return buffer.GetAttr(m_instance, "ValueSource"); }
+        const char* get_ValueSource_utf8() { return get_ValueSource_utf8(ThreadUtf8Buffer()); }
+
+        IfcMetricValueSelect_get get_DataValue() { return IfcMetricValueSelect_get(m_instance, 904); }
+        IfcMetricValueSelect_put put_DataValue() { return IfcMetricValueSelect_put(m_instance, 904); }
+
+        IfcReference get_ReferencePath();
+        void put_ReferencePath(IfcReference inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstraint::attr
+        {
+            static constexpr IntValue Benchmark = 902;
+            static constexpr IntValue ValueSource = 903;
+            static constexpr IntValue DataValue = 904;
+            static constexpr IntValue ReferencePath = 905;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMetric_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMirroredProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcMirroredProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDerivedProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMirroredProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMirroredProfileDef : public RDF_EXPRESS_VIRTUAL IfcDerivedProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMirroredProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMirroredProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 383);
+        }
+
+        /// <summary>
+        /// Instances of IfcMirroredProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMirroredProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcMirroredProfileDef>(model, 383, false); }
+        static ExtentRange<IfcMirroredProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMirroredProfileDef>(model, 383, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMirroredProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMirroredProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMirroredProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMirroredProfileDef if the actual type of SdaiInstance is IfcMirroredProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMirroredProfileDef CreateExactEntity(SdaiInstance instance) { return IfcMirroredProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMirroredProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMirroredProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDerivedProfileDef::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMirroredProfileDef_CLASS_H
@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMonetaryUnit_CLASS_H
+#define __RDF_LTD__IFC4_IfcMonetaryUnit_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMonetaryUnit
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMonetaryUnit : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMonetaryUnit
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMonetaryUnit(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 384);
+        }
+
+        /// <summary>
+        /// Instances of IfcMonetaryUnit in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMonetaryUnit> Extent(SdaiModel model) { return ExtentRange<IfcMonetaryUnit>(model, 384, false); }
+        static ExtentRange<IfcMonetaryUnit> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMonetaryUnit>(model, 384, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMonetaryUnit and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMonetaryUnit Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMonetaryUnit"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMonetaryUnit if the actual type of SdaiInstance is IfcMonetaryUnit or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMonetaryUnit CreateExactEntity(SdaiInstance instance) { return IfcMonetaryUnit(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMonetaryUnit or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMonetaryUnit(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Currency() { RDF_EXPRESS_PROBE(906); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(906), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Currency_view() { return TextView(get_Currency()); }
+#endif
+        void put_Currency(IfcLabel value) { RDF_EXPRESS_PROBE(906); sdaiPutAttr(m_instance, getAttrDefinition(906), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Currency_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(906); return buffer.GetAttr(m_instance, "Currency"); }
+        const char* get_Currency_utf8() { return get_Currency_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Currency = 906;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMonetaryUnit_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMotorConnection_CLASS_H
+#define __RDF_LTD__IFC4_IfcMotorConnection_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMotorConnection
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMotorConnection : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMotorConnection
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMotorConnection(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 385);
+        }
+
+        /// <summary>
+        /// Instances of IfcMotorConnection in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMotorConnection> Extent(SdaiModel model) { return ExtentRange<IfcMotorConnection>(model, 385, false); }
+        static ExtentRange<IfcMotorConnection> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMotorConnection>(model, 385, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMotorConnection and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMotorConnection Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMotorConnection"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMotorConnection if the actual type of SdaiInstance is IfcMotorConnection or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMotorConnection CreateExactEntity(SdaiInstance instance) { return IfcMotorConnection(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMotorConnection or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMotorConnection(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcMotorConnectionTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(907); int v = getENUM(907, IfcMotorConnectionTypeEnum_hash); if (v >= 0) return (IfcMotorConnectionTypeEnum) v; else return Nullable<IfcMotorConnectionTypeEnum>(); }
+        void put_PredefinedType(IfcMotorConnectionTypeEnum value) { RDF_EXPRESS_PROBE(907); TextValue val = IfcMotorConnectionTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(907), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 907;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMotorConnection_CLASS_H
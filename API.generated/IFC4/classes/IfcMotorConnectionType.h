@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMotorConnectionType_CLASS_H
+#define __RDF_LTD__IFC4_IfcMotorConnectionType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcMotorConnectionType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcMotorConnectionType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcMotorConnectionType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcMotorConnectionType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 386);
+        }
+
+        /// <summary>
+        /// Instances of IfcMotorConnectionType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcMotorConnectionType> Extent(SdaiModel model) { return ExtentRange<IfcMotorConnectionType>(model, 386, false); }
+        static ExtentRange<IfcMotorConnectionType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcMotorConnectionType>(model, 386, true); }
+
+        /// <summary>
+        /// Create new instance of IfcMotorConnectionType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcMotorConnectionType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcMotorConnectionType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcMotorConnectionType if the actual type of SdaiInstance is IfcMotorConnectionType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcMotorConnectionType CreateExactEntity(SdaiInstance instance) { return IfcMotorConnectionType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcMotorConnectionType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcMotorConnectionType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcMotorConnectionTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(908); int v = getENUM(908, IfcMotorConnectionTypeEnum_hash); if (v >= 0) return (IfcMotorConnectionTypeEnum) v; else return Nullable<IfcMotorConnectionTypeEnum>(); }
+        void put_PredefinedType(IfcMotorConnectionTypeEnum value) { RDF_EXPRESS_PROBE(908); TextValue val = IfcMotorConnectionTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(908), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 908;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcMotorConnectionType_CLASS_H
@@ -0,0 +1,63 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcNamedUnit_CLASS_H
+#define __RDF_LTD__IFC4_IfcNamedUnit_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcNamedUnit
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcNamedUnit : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcNamedUnit
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcNamedUnit(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 387);
+        }
+
+        /// <summary>
+        /// Instances of IfcNamedUnit in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcNamedUnit> Extent(SdaiModel model) { return ExtentRange<IfcNamedUnit>(model, 387, false); }
+        static ExtentRange<IfcNamedUnit> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcNamedUnit>(model, 387, true); }
+
+        /// <summary>
+        /// Returns object of IfcNamedUnit if the actual type of SdaiInstance is IfcNamedUnit or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcNamedUnit CreateExactEntity(SdaiInstance instance) { return IfcNamedUnit(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcNamedUnit or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcNamedUnit(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDimensionalExponents get_Dimensions();
+        void put_Dimensions(IfcDimensionalExponents inst);
+
+        Nullable<IfcUnitEnum> get_UnitType() { RDF_EXPRESS_PROBE(397); int v = getENUM(397, IfcUnitEnum_hash); if (v >= 0) return (IfcUnitEnum) v; else return Nullable<IfcUnitEnum>(); }
+        void put_UnitType(IfcUnitEnum value) { RDF_EXPRESS_PROBE(397); TextValue val = IfcUnitEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(397), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Dimensions = 396;
+            static constexpr IntValue UnitType = 397;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcNamedUnit_CLASS_H
@@ -0,0 +1,83 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcObject_CLASS_H
+#define __RDF_LTD__IFC4_IfcObject_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcObjectDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcObject
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcObject : public RDF_EXPRESS_VIRTUAL IfcObjectDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcObject
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcObject(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 388);
+        }
+
+        /// <summary>
+        /// Instances of IfcObject in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcObject> Extent(SdaiModel model) { return ExtentRange<IfcObject>(model, 388, false); }
+        static ExtentRange<IfcObject> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcObject>(model, 388, true); }
+
+        /// <summary>
+        /// Returns object of IfcObject if the actual type of SdaiInstance is IfcObject or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcObject CreateExactEntity(SdaiInstance instance) { return IfcObject(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcObject or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcObject(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_ObjectType() { RDF_EXPRESS_PROBE(11); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(11), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ObjectType_view() { return TextView(get_ObjectType()); }
+#endif
+        void put_ObjectType(IfcLabel value) { RDF_EXPRESS_PROBE(11); sdaiPutAttr(m_instance, getAttrDefinition(11), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ObjectType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(11); return buffer.GetAttr(m_instance, "ObjectType"); }
+        const char* get_ObjectType_utf8() { return get_ObjectType_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRelDefinesByObject or list of convertible elements
+        template <typename TList> void get_IsDeclaredBy(TList& lst) { RDF_EXPRESS_PROBE(12); SetOfIfcRelDefinesByObjectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(12)); }
+
+        //TList may be SetOfIfcRelDefinesByObject or list of convertible elements
+        template <typename TList> void get_Declares(TList& lst) { RDF_EXPRESS_PROBE(13); SetOfIfcRelDefinesByObjectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(13)); }
+
+        //TList may be SetOfIfcRelDefinesByType or list of convertible elements
+        template <typename TList> void get_IsTypedBy(TList& lst) { RDF_EXPRESS_PROBE(14); SetOfIfcRelDefinesByTypeSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(14)); }
+
+        //TList may be SetOfIfcRelDefinesByProperties or list of convertible elements
+        template <typename TList> void get_IsDefinedBy(TList& lst) { RDF_EXPRESS_PROBE(15); SetOfIfcRelDefinesByPropertiesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(15)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcObjectDefinition::attr
+        {
+            static constexpr IntValue ObjectType = 11;
+            static constexpr IntValue IsDeclaredBy = 12;
+            static constexpr IntValue Declares = 13;
+            static constexpr IntValue IsTypedBy = 14;
+            static constexpr IntValue IsDefinedBy = 15;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcObject_CLASS_H
@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcObjectDefinition_CLASS_H
+#define __RDF_LTD__IFC4_IfcObjectDefinition_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRoot.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcObjectDefinition
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcObjectDefinition : public RDF_EXPRESS_VIRTUAL IfcRoot
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcObjectDefinition
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcObjectDefinition(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 389);
+        }
+
+        /// <summary>
+        /// Instances of IfcObjectDefinition in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcObjectDefinition> Extent(SdaiModel model) { return ExtentRange<IfcObjectDefinition>(model, 389, false); }
+        static ExtentRange<IfcObjectDefinition> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcObjectDefinition>(model, 389, true); }
+
+        /// <summary>
+        /// Returns object of IfcObjectDefinition if the actual type of SdaiInstance is IfcObjectDefinition or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcObjectDefinition CreateExactEntity(SdaiInstance instance) { return IfcObjectDefinition(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcObjectDefinition or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcObjectDefinition(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcRelAssigns or list of convertible elements
+        template <typename TList> void get_HasAssignments(TList& lst) { RDF_EXPRESS_PROBE(4); SetOfIfcRelAssignsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(4)); }
+
+        //TList may be SetOfIfcRelNests or list of convertible elements
+        template <typename TList> void get_Nests(TList& lst) { RDF_EXPRESS_PROBE(5); SetOfIfcRelNestsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(5)); }
+
+        //TList may be SetOfIfcRelNests or list of convertible elements
+        template <typename TList> void get_IsNestedBy(TList& lst) { RDF_EXPRESS_PROBE(6); SetOfIfcRelNestsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(6)); }
+
+        //TList may be SetOfIfcRelDeclares or list of convertible elements
+        template <typename TList> void get_HasContext(TList& lst) { RDF_EXPRESS_PROBE(7); SetOfIfcRelDeclaresSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(7)); }
+
+        //TList may be SetOfIfcRelAggregates or list of convertible elements
+        template <typename TList> void get_IsDecomposedBy(TList& lst) { RDF_EXPRESS_PROBE(8); SetOfIfcRelAggregatesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(8)); }
+
+        //TList may be SetOfIfcRelAggregates or list of convertible elements
+        template <typename TList> void get_Decomposes(TList& lst) { RDF_EXPRESS_PROBE(9); SetOfIfcRelAggregatesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(9)); }
+
+        //TList may be SetOfIfcRelAssociates or list of convertible elements
+        template <typename TList> void get_HasAssociations(TList& lst) { RDF_EXPRESS_PROBE(10); SetOfIfcRelAssociatesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(10)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRoot::attr
+        {
+            static constexpr IntValue HasAssignments = 4;
+            static constexpr IntValue Nests = 5;
+            static constexpr IntValue IsNestedBy = 6;
+            static constexpr IntValue HasContext = 7;
+            static constexpr IntValue IsDecomposedBy = 8;
+            static constexpr IntValue Decomposes = 9;
+            static constexpr IntValue HasAssociations = 10;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcObjectDefinition_CLASS_H
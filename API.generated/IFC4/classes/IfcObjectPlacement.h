@@ -0,0 +1,63 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcObjectPlacement_CLASS_H
+#define __RDF_LTD__IFC4_IfcObjectPlacement_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcObjectPlacement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcObjectPlacement : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcObjectPlacement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcObjectPlacement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 391);
+        }
+
+        /// <summary>
+        /// Instances of IfcObjectPlacement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcObjectPlacement> Extent(SdaiModel model) { return ExtentRange<IfcObjectPlacement>(model, 391, false); }
+        static ExtentRange<IfcObjectPlacement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcObjectPlacement>(model, 391, true); }
+
+        /// <summary>
+        /// Returns object of IfcObjectPlacement if the actual type of SdaiInstance is IfcObjectPlacement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcObjectPlacement CreateExactEntity(SdaiInstance instance) { return IfcObjectPlacement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcObjectPlacement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcObjectPlacement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcProduct or list of convertible elements
+        template <typename TList> void get_PlacesObject(TList& lst) { RDF_EXPRESS_PROBE(705); SetOfIfcProductSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(705)); }
+
+        //TList may be SetOfIfcLocalPlacement or list of convertible elements
+        template <typename TList> void get_ReferencedByPlacements(TList& lst) { RDF_EXPRESS_PROBE(706); SetOfIfcLocalPlacementSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(706)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue PlacesObject = 705;
+            static constexpr IntValue ReferencedByPlacements = 706;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcObjectPlacement_CLASS_H
@@ -0,0 +1,89 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcObjective_CLASS_H
+#define __RDF_LTD__IFC4_IfcObjective_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstraint.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcObjective
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcObjective : public RDF_EXPRESS_VIRTUAL IfcConstraint
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcObjective
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcObjective(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 390);
+        }
+
+        /// <summary>
+        /// Instances of IfcObjective in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcObjective> Extent(SdaiModel model) { return ExtentRange<IfcObjective>(model, 390, false); }
+        static ExtentRange<IfcObjective> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcObjective>(model, 390, true); }
+
+        /// <summary>
+        /// Create new instance of IfcObjective and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcObjective Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcObjective"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcObjective if the actual type of SdaiInstance is IfcObjective or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcObjective CreateExactEntity(SdaiInstance instance) { return IfcObjective(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcObjective or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcObjective(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcConstraint or list of convertible elements
+        template <typename TList> void get_BenchmarkValues(TList& lst) { RDF_EXPRESS_PROBE(909); ListOfIfcConstraintSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(909)); }
+
+        //TList may be ListOfIfcConstraint or list of convertible elements
+        template <typename TList> void put_BenchmarkValues(TList& lst) { RDF_EXPRESS_PROBE(909); ListOfIfcConstraintSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(909)); }
+
+        //TArrayElem[] may be IfcConstraint[] or array of convertible elements
+        template <typename TArrayElem> void put_BenchmarkValues(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(909); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcConstraintSerializer<ListOfIfcConstraint> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(909)); }
+
+        Nullable<IfcLogicalOperatorEnum> get_LogicalAggregator() { RDF_EXPRESS_PROBE(910); int v = getENUM(910, IfcLogicalOperatorEnum_hash); if (v >= 0) return (IfcLogicalOperatorEnum) v; else return Nullable<IfcLogicalOperatorEnum>(); }
+        void put_LogicalAggregator(IfcLogicalOperatorEnum value) { RDF_EXPRESS_PROBE(910); TextValue val = IfcLogicalOperatorEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(910), sdaiENUM, val); }
+
+        Nullable<IfcObjectiveEnum> get_ObjectiveQualifier() { RDF_EXPRESS_PROBE(911); int v = getENUM(911, IfcObjectiveEnum_hash); if (v >= 0) return (IfcObjectiveEnum) v; else return Nullable<IfcObjectiveEnum>(); }
+        void put_ObjectiveQualifier(IfcObjectiveEnum value) { RDF_EXPRESS_PROBE(911); TextValue val = IfcObjectiveEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(911), sdaiENUM, val); }
+
+        IfcLabel get_UserDefinedQualifier() { RDF_EXPRESS_PROBE(912); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(912), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedQualifier_view() { return TextView(get_UserDefinedQualifier()); }
+#endif
+        void put_UserDefinedQualifier(IfcLabel value) { RDF_EXPRESS_PROBE(912); sdaiPutAttr(m_instance, getAttrDefinition(912), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedQualifier_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(912); return buffer.GetAttr(m_instance, "UserDefinedQualifier"); }
+        const char* get_UserDefinedQualifier_utf8() { return get_UserDefinedQualifier_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstraint::attr
+        {
+            static constexpr IntValue BenchmarkValues = 909;
+            static constexpr IntValue LogicalAggregator = 910;
+            static constexpr IntValue ObjectiveQualifier = 911;
+            static constexpr IntValue UserDefinedQualifier = 912;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcObjective_CLASS_H
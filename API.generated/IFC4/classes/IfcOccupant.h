@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOccupant_CLASS_H
+#define __RDF_LTD__IFC4_IfcOccupant_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcActor.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcOccupant
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcOccupant : public RDF_EXPRESS_VIRTUAL IfcActor
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcOccupant
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcOccupant(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 392);
+        }
+
+        /// <summary>
+        /// Instances of IfcOccupant in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcOccupant> Extent(SdaiModel model) { return ExtentRange<IfcOccupant>(model, 392, false); }
+        static ExtentRange<IfcOccupant> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcOccupant>(model, 392, true); }
+
+        /// <summary>
+        /// Create new instance of IfcOccupant and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcOccupant Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcOccupant"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcOccupant if the actual type of SdaiInstance is IfcOccupant or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcOccupant CreateExactEntity(SdaiInstance instance) { return IfcOccupant(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcOccupant or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcOccupant(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcOccupantTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(913); int v = getENUM(913, IfcOccupantTypeEnum_hash); if (v >= 0) return (IfcOccupantTypeEnum) v; else return Nullable<IfcOccupantTypeEnum>(); }
+        void put_PredefinedType(IfcOccupantTypeEnum value) { RDF_EXPRESS_PROBE(913); TextValue val = IfcOccupantTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(913), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcActor::attr
+        {
+            static constexpr IntValue PredefinedType = 913;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcOccupant_CLASS_H
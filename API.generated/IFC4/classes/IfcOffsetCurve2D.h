@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOffsetCurve2D_CLASS_H
+#define __RDF_LTD__IFC4_IfcOffsetCurve2D_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcOffsetCurve2D
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcOffsetCurve2D : public RDF_EXPRESS_VIRTUAL IfcCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcOffsetCurve2D
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcOffsetCurve2D(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 393);
+        }
+
+        /// <summary>
+        /// Instances of IfcOffsetCurve2D in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcOffsetCurve2D> Extent(SdaiModel model) { return ExtentRange<IfcOffsetCurve2D>(model, 393, false); }
+        static ExtentRange<IfcOffsetCurve2D> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcOffsetCurve2D>(model, 393, true); }
+
+        /// <summary>
+        /// Create new instance of IfcOffsetCurve2D and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcOffsetCurve2D Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcOffsetCurve2D"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcOffsetCurve2D if the actual type of SdaiInstance is IfcOffsetCurve2D or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcOffsetCurve2D CreateExactEntity(SdaiInstance instance) { return IfcOffsetCurve2D(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcOffsetCurve2D or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcOffsetCurve2D(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurve get_BasisCurve();
+        void put_BasisCurve(IfcCurve inst);
+
+        Nullable<IfcLengthMeasure> get_Distance() { RDF_EXPRESS_PROBE(915); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(915), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_Distance(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(915); sdaiPutAttr(m_instance, getAttrDefinition(915), sdaiREAL, &value); }
+
+        Nullable<IfcLogical> get_SelfIntersect() { RDF_EXPRESS_PROBE(916); int v = getENUM(916, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_SelfIntersect(IfcLogical value) { RDF_EXPRESS_PROBE(916); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(916), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCurve::attr
+        {
+            static constexpr IntValue BasisCurve = 914;
+            static constexpr IntValue Distance = 915;
+            static constexpr IntValue SelfIntersect = 916;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcOffsetCurve2D_CLASS_H
@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOffsetCurve3D_CLASS_H
+#define __RDF_LTD__IFC4_IfcOffsetCurve3D_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcOffsetCurve3D
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcOffsetCurve3D : public RDF_EXPRESS_VIRTUAL IfcCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcOffsetCurve3D
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcOffsetCurve3D(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 394);
+        }
+
+        /// <summary>
+        /// Instances of IfcOffsetCurve3D in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcOffsetCurve3D> Extent(SdaiModel model) { return ExtentRange<IfcOffsetCurve3D>(model, 394, false); }
+        static ExtentRange<IfcOffsetCurve3D> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcOffsetCurve3D>(model, 394, true); }
+
+        /// <summary>
+        /// Create new instance of IfcOffsetCurve3D and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcOffsetCurve3D Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcOffsetCurve3D"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcOffsetCurve3D if the actual type of SdaiInstance is IfcOffsetCurve3D or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcOffsetCurve3D CreateExactEntity(SdaiInstance instance) { return IfcOffsetCurve3D(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcOffsetCurve3D or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcOffsetCurve3D(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurve get_BasisCurve();
+        void put_BasisCurve(IfcCurve inst);
+
+        Nullable<IfcLengthMeasure> get_Distance() { RDF_EXPRESS_PROBE(918); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(918), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_Distance(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(918); sdaiPutAttr(m_instance, getAttrDefinition(918), sdaiREAL, &value); }
+
+        Nullable<IfcLogical> get_SelfIntersect() { RDF_EXPRESS_PROBE(919); int v = getENUM(919, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_SelfIntersect(IfcLogical value) { RDF_EXPRESS_PROBE(919); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(919), sdaiENUM, val); }
+
+        IfcDirection get_RefDirection();
+        void put_RefDirection(IfcDirection inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCurve::attr
+        {
+            static constexpr IntValue BasisCurve = 917;
+            static constexpr IntValue Distance = 918;
+            static constexpr IntValue SelfIntersect = 919;
+            static constexpr IntValue RefDirection = 920;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcOffsetCurve3D_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOpenShell_CLASS_H
+#define __RDF_LTD__IFC4_IfcOpenShell_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConnectedFaceSet.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcOpenShell
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcOpenShell : public RDF_EXPRESS_VIRTUAL IfcConnectedFaceSet
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcOpenShell
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcOpenShell(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 397);
+        }
+
+        /// <summary>
+        /// Instances of IfcOpenShell in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcOpenShell> Extent(SdaiModel model) { return ExtentRange<IfcOpenShell>(model, 397, false); }
+        static ExtentRange<IfcOpenShell> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcOpenShell>(model, 397, true); }
+
+        /// <summary>
+        /// Create new instance of IfcOpenShell and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcOpenShell Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcOpenShell"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcOpenShell if the actual type of SdaiInstance is IfcOpenShell or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcOpenShell CreateExactEntity(SdaiInstance instance) { return IfcOpenShell(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcOpenShell or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcOpenShell(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConnectedFaceSet::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcOpenShell_CLASS_H
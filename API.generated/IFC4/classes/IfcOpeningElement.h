@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOpeningElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcOpeningElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFeatureElementSubtraction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcOpeningElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcOpeningElement : public RDF_EXPRESS_VIRTUAL IfcFeatureElementSubtraction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcOpeningElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcOpeningElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 395);
+        }
+
+        /// <summary>
+        /// Instances of IfcOpeningElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcOpeningElement> Extent(SdaiModel model) { return ExtentRange<IfcOpeningElement>(model, 395, false); }
+        static ExtentRange<IfcOpeningElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcOpeningElement>(model, 395, true); }
+
+        /// <summary>
+        /// Create new instance of IfcOpeningElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcOpeningElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcOpeningElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcOpeningElement if the actual type of SdaiInstance is IfcOpeningElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcOpeningElement CreateExactEntity(SdaiInstance instance) { return IfcOpeningElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcOpeningElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcOpeningElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcOpeningElementTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(921); int v = getENUM(921, IfcOpeningElementTypeEnum_hash); if (v >= 0) return (IfcOpeningElementTypeEnum) v; else return Nullable<IfcOpeningElementTypeEnum>(); }
+        void put_PredefinedType(IfcOpeningElementTypeEnum value) { RDF_EXPRESS_PROBE(921); TextValue val = IfcOpeningElementTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(921), sdaiENUM, val); }
+
+        //TList may be SetOfIfcRelFillsElement or list of convertible elements
+        template <typename TList> void get_HasFillings(TList& lst) { RDF_EXPRESS_PROBE(922); SetOfIfcRelFillsElementSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(922)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFeatureElementSubtraction::attr
+        {
+            static constexpr IntValue PredefinedType = 921;
+            static constexpr IntValue HasFillings = 922;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcOpeningElement_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOpeningStandardCase_CLASS_H
+#define __RDF_LTD__IFC4_IfcOpeningStandardCase_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcOpeningElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcOpeningStandardCase
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcOpeningStandardCase : public RDF_EXPRESS_VIRTUAL IfcOpeningElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcOpeningStandardCase
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcOpeningStandardCase(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 396);
+        }
+
+        /// <summary>
+        /// Instances of IfcOpeningStandardCase in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcOpeningStandardCase> Extent(SdaiModel model) { return ExtentRange<IfcOpeningStandardCase>(model, 396, false); }
+        static ExtentRange<IfcOpeningStandardCase> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcOpeningStandardCase>(model, 396, true); }
+
+        /// <summary>
+        /// Create new instance of IfcOpeningStandardCase and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcOpeningStandardCase Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcOpeningStandardCase"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcOpeningStandardCase if the actual type of SdaiInstance is IfcOpeningStandardCase or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcOpeningStandardCase CreateExactEntity(SdaiInstance instance) { return IfcOpeningStandardCase(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcOpeningStandardCase or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcOpeningStandardCase(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcOpeningElement::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcOpeningStandardCase_CLASS_H
@@ -0,0 +1,124 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOrganization_CLASS_H
+#define __RDF_LTD__IFC4_IfcOrganization_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcOrganization
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcOrganization : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcOrganization
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcOrganization(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 398);
+        }
+
+        /// <summary>
+        /// Instances of IfcOrganization in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcOrganization> Extent(SdaiModel model) { return ExtentRange<IfcOrganization>(model, 398, false); }
+        static ExtentRange<IfcOrganization> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcOrganization>(model, 398, true); }
+
+        /// <summary>
+        /// Create new instance of IfcOrganization and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcOrganization Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcOrganization"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcOrganization if the actual type of SdaiInstance is IfcOrganization or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcOrganization CreateExactEntity(SdaiInstance instance) { return IfcOrganization(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcOrganization or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcOrganization(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Identification() { RDF_EXPRESS_PROBE(923); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(923), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Identification_view() { return TextView(get_Identification()); }
+#endif
+        void put_Identification(IfcIdentifier value) { RDF_EXPRESS_PROBE(923); sdaiPutAttr(m_instance, getAttrDefinition(923), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Identification_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(923); return buffer.GetAttr(m_instance, "Identification"); }
+        const char* get_Identification_utf8() { return get_Identification_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(924); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(924), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(924); sdaiPutAttr(m_instance, getAttrDefinition(924), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(924); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(925); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(925), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(925); sdaiPutAttr(m_instance, getAttrDefinition(925), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(925); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcActorRole or list of convertible elements
+        template <typename TList> void get_Roles(TList& lst) { RDF_EXPRESS_PROBE(926); ListOfIfcActorRoleSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(926)); }
+
+        //TList may be ListOfIfcActorRole or list of convertible elements
+        template <typename TList> void put_Roles(TList& lst) { RDF_EXPRESS_PROBE(926); ListOfIfcActorRoleSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(926)); }
+
+        //TArrayElem[] may be IfcActorRole[] or array of convertible elements
+        template <typename TArrayElem> void put_Roles(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(926); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcActorRoleSerializer<ListOfIfcActorRole> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(926)); }
+
+        //TList may be ListOfIfcAddress or list of convertible elements
+        template <typename TList> void get_Addresses(TList& lst) { RDF_EXPRESS_PROBE(927); ListOfIfcAddressSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(927)); }
+
+        //TList may be ListOfIfcAddress or list of convertible elements
+        template <typename TList> void put_Addresses(TList& lst) { RDF_EXPRESS_PROBE(927); ListOfIfcAddressSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(927)); }
+
+        //TArrayElem[] may be IfcAddress[] or array of convertible elements
+        template <typename TArrayElem> void put_Addresses(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(927); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcAddressSerializer<ListOfIfcAddress> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(927)); }
+
+        //TList may be SetOfIfcOrganizationRelationship or list of convertible elements
+        template <typename TList> void get_IsRelatedBy(TList& lst) { RDF_EXPRESS_PROBE(928); SetOfIfcOrganizationRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(928)); }
+
+        //TList may be SetOfIfcOrganizationRelationship or list of convertible elements
+        template <typename TList> void get_Relates(TList& lst) { RDF_EXPRESS_PROBE(929); SetOfIfcOrganizationRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(929)); }
+
+        //TList may be SetOfIfcPersonAndOrganization or list of convertible elements
+        template <typename TList> void get_Engages(TList& lst) { RDF_EXPRESS_PROBE(930); SetOfIfcPersonAndOrganizationSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(930)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Identification = 923;
+            static constexpr IntValue Name = 924;
+            static constexpr IntValue Description = 925;
+            static constexpr IntValue Roles = 926;
+            static constexpr IntValue Addresses = 927;
+            static constexpr IntValue IsRelatedBy = 928;
+            static constexpr IntValue Relates = 929;
+            static constexpr IntValue Engages = 930;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcOrganization_CLASS_H
@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOrganizationRelationship_CLASS_H
+#define __RDF_LTD__IFC4_IfcOrganizationRelationship_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcResourceLevelRelationship.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcOrganizationRelationship
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcOrganizationRelationship : public RDF_EXPRESS_VIRTUAL IfcResourceLevelRelationship
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcOrganizationRelationship
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcOrganizationRelationship(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 399);
+        }
+
+        /// <summary>
+        /// Instances of IfcOrganizationRelationship in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcOrganizationRelationship> Extent(SdaiModel model) { return ExtentRange<IfcOrganizationRelationship>(model, 399, false); }
+        static ExtentRange<IfcOrganizationRelationship> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcOrganizationRelationship>(model, 399, true); }
+
+        /// <summary>
+        /// Create new instance of IfcOrganizationRelationship and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcOrganizationRelationship Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcOrganizationRelationship"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcOrganizationRelationship if the actual type of SdaiInstance is IfcOrganizationRelationship or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcOrganizationRelationship CreateExactEntity(SdaiInstance instance) { return IfcOrganizationRelationship(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcOrganizationRelationship or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcOrganizationRelationship(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcOrganization get_RelatingOrganization();
+        void put_RelatingOrganization(IfcOrganization inst);
+
+        //TList may be SetOfIfcOrganization or list of convertible elements
+        template <typename TList> void get_RelatedOrganizations(TList& lst) { RDF_EXPRESS_PROBE(932); SetOfIfcOrganizationSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(932)); }
+
+        //TList may be SetOfIfcOrganization or list of convertible elements
+        template <typename TList> void put_RelatedOrganizations(TList& lst) { RDF_EXPRESS_PROBE(932); SetOfIfcOrganizationSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(932)); }
+
+        //TArrayElem[] may be IfcOrganization[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedOrganizations(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(932); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcOrganizationSerializer<SetOfIfcOrganization> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(932)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcResourceLevelRelationship::attr
+        {
+            static constexpr IntValue RelatingOrganization = 931;
+            static constexpr IntValue RelatedOrganizations = 932;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcOrganizationRelationship_CLASS_H
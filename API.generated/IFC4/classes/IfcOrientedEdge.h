@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOrientedEdge_CLASS_H
+#define __RDF_LTD__IFC4_IfcOrientedEdge_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEdge.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcOrientedEdge
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcOrientedEdge : public RDF_EXPRESS_VIRTUAL IfcEdge
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcOrientedEdge
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcOrientedEdge(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 400);
+        }
+
+        /// <summary>
+        /// Instances of IfcOrientedEdge in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcOrientedEdge> Extent(SdaiModel model) { return ExtentRange<IfcOrientedEdge>(model, 400, false); }
+        static ExtentRange<IfcOrientedEdge> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcOrientedEdge>(model, 400, true); }
+
+        /// <summary>
+        /// Create new instance of IfcOrientedEdge and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcOrientedEdge Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcOrientedEdge"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcOrientedEdge if the actual type of SdaiInstance is IfcOrientedEdge or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcOrientedEdge CreateExactEntity(SdaiInstance instance) { return IfcOrientedEdge(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcOrientedEdge or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcOrientedEdge(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcEdge get_EdgeElement();
+        void put_EdgeElement(IfcEdge inst);
+
+        Nullable<IfcBoolean> get_Orientation() { RDF_EXPRESS_PROBE(934); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(934), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_Orientation(IfcBoolean value) { RDF_EXPRESS_PROBE(934); sdaiPutAttr(m_instance, getAttrDefinition(934), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEdge::attr
+        {
+            static constexpr IntValue EdgeElement = 933;
+            static constexpr IntValue Orientation = 934;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcOrientedEdge_CLASS_H
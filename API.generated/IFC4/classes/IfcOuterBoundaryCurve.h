@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOuterBoundaryCurve_CLASS_H
+#define __RDF_LTD__IFC4_IfcOuterBoundaryCurve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundaryCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcOuterBoundaryCurve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcOuterBoundaryCurve : public RDF_EXPRESS_VIRTUAL IfcBoundaryCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcOuterBoundaryCurve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcOuterBoundaryCurve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 401);
+        }
+
+        /// <summary>
+        /// Instances of IfcOuterBoundaryCurve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcOuterBoundaryCurve> Extent(SdaiModel model) { return ExtentRange<IfcOuterBoundaryCurve>(model, 401, false); }
+        static ExtentRange<IfcOuterBoundaryCurve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcOuterBoundaryCurve>(model, 401, true); }
+
+        /// <summary>
+        /// Create new instance of IfcOuterBoundaryCurve and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcOuterBoundaryCurve Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcOuterBoundaryCurve"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcOuterBoundaryCurve if the actual type of SdaiInstance is IfcOuterBoundaryCurve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcOuterBoundaryCurve CreateExactEntity(SdaiInstance instance) { return IfcOuterBoundaryCurve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcOuterBoundaryCurve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcOuterBoundaryCurve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundaryCurve::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcOuterBoundaryCurve_CLASS_H
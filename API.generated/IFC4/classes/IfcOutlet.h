@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOutlet_CLASS_H
+#define __RDF_LTD__IFC4_IfcOutlet_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcOutlet
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcOutlet : public RDF_EXPRESS_VIRTUAL IfcFlowTerminal
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcOutlet
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcOutlet(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 402);
+        }
+
+        /// <summary>
+        /// Instances of IfcOutlet in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcOutlet> Extent(SdaiModel model) { return ExtentRange<IfcOutlet>(model, 402, false); }
+        static ExtentRange<IfcOutlet> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcOutlet>(model, 402, true); }
+
+        /// <summary>
+        /// Create new instance of IfcOutlet and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcOutlet Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcOutlet"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcOutlet if the actual type of SdaiInstance is IfcOutlet or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcOutlet CreateExactEntity(SdaiInstance instance) { return IfcOutlet(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcOutlet or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcOutlet(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcOutletTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(935); int v = getENUM(935, IfcOutletTypeEnum_hash); if (v >= 0) return (IfcOutletTypeEnum) v; else return Nullable<IfcOutletTypeEnum>(); }
+        void put_PredefinedType(IfcOutletTypeEnum value) { RDF_EXPRESS_PROBE(935); TextValue val = IfcOutletTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(935), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminal::attr
+        {
+            static constexpr IntValue PredefinedType = 935;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcOutlet_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOutletType_CLASS_H
+#define __RDF_LTD__IFC4_IfcOutletType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcOutletType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcOutletType : public RDF_EXPRESS_VIRTUAL IfcFlowTerminalType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcOutletType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcOutletType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 403);
+        }
+
+        /// <summary>
+        /// Instances of IfcOutletType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcOutletType> Extent(SdaiModel model) { return ExtentRange<IfcOutletType>(model, 403, false); }
+        static ExtentRange<IfcOutletType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcOutletType>(model, 403, true); }
+
+        /// <summary>
+        /// Create new instance of IfcOutletType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcOutletType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcOutletType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcOutletType if the actual type of SdaiInstance is IfcOutletType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcOutletType CreateExactEntity(SdaiInstance instance) { return IfcOutletType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcOutletType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcOutletType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcOutletTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(936); int v = getENUM(936, IfcOutletTypeEnum_hash); if (v >= 0) return (IfcOutletTypeEnum) v; else return Nullable<IfcOutletTypeEnum>(); }
+        void put_PredefinedType(IfcOutletTypeEnum value) { RDF_EXPRESS_PROBE(936); TextValue val = IfcOutletTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(936), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminalType::attr
+        {
+            static constexpr IntValue PredefinedType = 936;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcOutletType_CLASS_H
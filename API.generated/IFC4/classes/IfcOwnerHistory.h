@@ -0,0 +1,91 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcOwnerHistory_CLASS_H
+#define __RDF_LTD__IFC4_IfcOwnerHistory_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcOwnerHistory
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcOwnerHistory : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcOwnerHistory
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcOwnerHistory(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 404);
+        }
+
+        /// <summary>
+        /// Instances of IfcOwnerHistory in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcOwnerHistory> Extent(SdaiModel model) { return ExtentRange<IfcOwnerHistory>(model, 404, false); }
+        static ExtentRange<IfcOwnerHistory> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcOwnerHistory>(model, 404, true); }
+
+        /// <summary>
+        /// Create new instance of IfcOwnerHistory and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcOwnerHistory Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcOwnerHistory"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcOwnerHistory if the actual type of SdaiInstance is IfcOwnerHistory or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcOwnerHistory CreateExactEntity(SdaiInstance instance) { return IfcOwnerHistory(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcOwnerHistory or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcOwnerHistory(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcPersonAndOrganization get_OwningUser();
+        void put_OwningUser(IfcPersonAndOrganization inst);
+
+        IfcApplication get_OwningApplication();
+        void put_OwningApplication(IfcApplication inst);
+
+        Nullable<IfcStateEnum> get_State() { RDF_EXPRESS_PROBE(939); int v = getENUM(939, IfcStateEnum_hash); if (v >= 0) return (IfcStateEnum) v; else return Nullable<IfcStateEnum>(); }
+        void put_State(IfcStateEnum value) { RDF_EXPRESS_PROBE(939); TextValue val = IfcStateEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(939), sdaiENUM, val); }
+
+        Nullable<IfcChangeActionEnum> get_ChangeAction() { RDF_EXPRESS_PROBE(940); int v = getENUM(940, IfcChangeActionEnum_hash); if (v >= 0) return (IfcChangeActionEnum) v; else return Nullable<IfcChangeActionEnum>(); }
+        void put_ChangeAction(IfcChangeActionEnum value) { RDF_EXPRESS_PROBE(940); TextValue val = IfcChangeActionEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(940), sdaiENUM, val); }
+
+        Nullable<IfcTimeStamp> get_LastModifiedDate() { RDF_EXPRESS_PROBE(941); IfcTimeStamp val = (IfcTimeStamp) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(941), sdaiINTEGER, &val)) return val; else return Nullable<IfcTimeStamp>(); }
+        void put_LastModifiedDate(IfcTimeStamp value) { RDF_EXPRESS_PROBE(941); sdaiPutAttr(m_instance, getAttrDefinition(941), sdaiINTEGER, &value); }
+
+        IfcPersonAndOrganization get_LastModifyingUser();
+        void put_LastModifyingUser(IfcPersonAndOrganization inst);
+
+        IfcApplication get_LastModifyingApplication();
+        void put_LastModifyingApplication(IfcApplication inst);
+
+        Nullable<IfcTimeStamp> get_CreationDate() { RDF_EXPRESS_PROBE(944); IfcTimeStamp val = (IfcTimeStamp) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(944), sdaiINTEGER, &val)) return val; else return Nullable<IfcTimeStamp>(); }
+        void put_CreationDate(IfcTimeStamp value) { RDF_EXPRESS_PROBE(944); sdaiPutAttr(m_instance, getAttrDefinition(944), sdaiINTEGER, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue OwningUser = 937;
+            static constexpr IntValue OwningApplication = 938;
+            static constexpr IntValue State = 939;
+            static constexpr IntValue ChangeAction = 940;
+            static constexpr IntValue LastModifiedDate = 941;
+            static constexpr IntValue LastModifyingUser = 942;
+            static constexpr IntValue LastModifyingApplication = 943;
+            static constexpr IntValue CreationDate = 944;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcOwnerHistory_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcParameterizedProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcParameterizedProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcParameterizedProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcParameterizedProfileDef : public RDF_EXPRESS_VIRTUAL IfcProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcParameterizedProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcParameterizedProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 405);
+        }
+
+        /// <summary>
+        /// Instances of IfcParameterizedProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcParameterizedProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcParameterizedProfileDef>(model, 405, false); }
+        static ExtentRange<IfcParameterizedProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcParameterizedProfileDef>(model, 405, true); }
+
+        /// <summary>
+        /// Returns object of IfcParameterizedProfileDef if the actual type of SdaiInstance is IfcParameterizedProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcParameterizedProfileDef CreateExactEntity(SdaiInstance instance) { return IfcParameterizedProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcParameterizedProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcParameterizedProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcAxis2Placement2D get_Position();
+        void put_Position(IfcAxis2Placement2D inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProfileDef::attr
+        {
+            static constexpr IntValue Position = 130;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcParameterizedProfileDef_CLASS_H
@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPath_CLASS_H
+#define __RDF_LTD__IFC4_IfcPath_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTopologicalRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPath
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPath : public RDF_EXPRESS_VIRTUAL IfcTopologicalRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPath
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPath(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 406);
+        }
+
+        /// <summary>
+        /// Instances of IfcPath in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPath> Extent(SdaiModel model) { return ExtentRange<IfcPath>(model, 406, false); }
+        static ExtentRange<IfcPath> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPath>(model, 406, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPath and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPath Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPath"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPath if the actual type of SdaiInstance is IfcPath or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPath CreateExactEntity(SdaiInstance instance) { return IfcPath(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPath or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPath(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcOrientedEdge or list of convertible elements
+        template <typename TList> void get_EdgeList(TList& lst) { RDF_EXPRESS_PROBE(945); ListOfIfcOrientedEdgeSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(945)); }
+
+        //TList may be ListOfIfcOrientedEdge or list of convertible elements
+        template <typename TList> void put_EdgeList(TList& lst) { RDF_EXPRESS_PROBE(945); ListOfIfcOrientedEdgeSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(945)); }
+
+        //TArrayElem[] may be IfcOrientedEdge[] or array of convertible elements
+        template <typename TArrayElem> void put_EdgeList(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(945); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcOrientedEdgeSerializer<ListOfIfcOrientedEdge> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(945)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTopologicalRepresentationItem::attr
+        {
+            static constexpr IntValue EdgeList = 945;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPath_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPcurve_CLASS_H
+#define __RDF_LTD__IFC4_IfcPcurve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPcurve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPcurve : public RDF_EXPRESS_VIRTUAL IfcCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPcurve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPcurve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 407);
+        }
+
+        /// <summary>
+        /// Instances of IfcPcurve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPcurve> Extent(SdaiModel model) { return ExtentRange<IfcPcurve>(model, 407, false); }
+        static ExtentRange<IfcPcurve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPcurve>(model, 407, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPcurve and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPcurve Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPcurve"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPcurve if the actual type of SdaiInstance is IfcPcurve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPcurve CreateExactEntity(SdaiInstance instance) { return IfcPcurve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPcurve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPcurve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcSurface get_BasisSurface();
+        void put_BasisSurface(IfcSurface inst);
+
+        IfcCurve get_ReferenceCurve();
+        void put_ReferenceCurve(IfcCurve inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCurve::attr
+        {
+            static constexpr IntValue BasisSurface = 946;
+            static constexpr IntValue ReferenceCurve = 947;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPcurve_CLASS_H
@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPerformanceHistory_CLASS_H
+#define __RDF_LTD__IFC4_IfcPerformanceHistory_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcControl.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPerformanceHistory
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPerformanceHistory : public RDF_EXPRESS_VIRTUAL IfcControl
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPerformanceHistory
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPerformanceHistory(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 408);
+        }
+
+        /// <summary>
+        /// Instances of IfcPerformanceHistory in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPerformanceHistory> Extent(SdaiModel model) { return ExtentRange<IfcPerformanceHistory>(model, 408, false); }
+        static ExtentRange<IfcPerformanceHistory> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPerformanceHistory>(model, 408, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPerformanceHistory and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPerformanceHistory Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPerformanceHistory"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPerformanceHistory if the actual type of SdaiInstance is IfcPerformanceHistory or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPerformanceHistory CreateExactEntity(SdaiInstance instance) { return IfcPerformanceHistory(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPerformanceHistory or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPerformanceHistory(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_LifeCyclePhase() { RDF_EXPRESS_PROBE(948); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(948), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LifeCyclePhase_view() { return TextView(get_LifeCyclePhase()); }
+#endif
+        void put_LifeCyclePhase(IfcLabel value) { RDF_EXPRESS_PROBE(948); sdaiPutAttr(m_instance, getAttrDefinition(948), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LifeCyclePhase_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(948); return buffer.GetAttr(m_instance, "LifeCyclePhase"); }
+        const char* get_LifeCyclePhase_utf8() { return get_LifeCyclePhase_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcPerformanceHistoryTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(949); int v = getENUM(949, IfcPerformanceHistoryTypeEnum_hash); if (v >= 0) return (IfcPerformanceHistoryTypeEnum) v; else return Nullable<IfcPerformanceHistoryTypeEnum>(); }
+        void put_PredefinedType(IfcPerformanceHistoryTypeEnum value) { RDF_EXPRESS_PROBE(949); TextValue val = IfcPerformanceHistoryTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(949), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcControl::attr
+        {
+            static constexpr IntValue LifeCyclePhase = 948;
+            static constexpr IntValue PredefinedType = 949;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPerformanceHistory_CLASS_H
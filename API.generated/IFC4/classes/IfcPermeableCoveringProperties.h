@@ -0,0 +1,80 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPermeableCoveringProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcPermeableCoveringProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedPropertySet.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPermeableCoveringProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPermeableCoveringProperties : public RDF_EXPRESS_VIRTUAL IfcPreDefinedPropertySet
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPermeableCoveringProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPermeableCoveringProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 409);
+        }
+
+        /// <summary>
+        /// Instances of IfcPermeableCoveringProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPermeableCoveringProperties> Extent(SdaiModel model) { return ExtentRange<IfcPermeableCoveringProperties>(model, 409, false); }
+        static ExtentRange<IfcPermeableCoveringProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPermeableCoveringProperties>(model, 409, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPermeableCoveringProperties and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPermeableCoveringProperties Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPermeableCoveringProperties"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPermeableCoveringProperties if the actual type of SdaiInstance is IfcPermeableCoveringProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPermeableCoveringProperties CreateExactEntity(SdaiInstance instance) { return IfcPermeableCoveringProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPermeableCoveringProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPermeableCoveringProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPermeableCoveringOperationEnum> get_OperationType() { RDF_EXPRESS_PROBE(950); int v = getENUM(950, IfcPermeableCoveringOperationEnum_hash); if (v >= 0) return (IfcPermeableCoveringOperationEnum) v; else return Nullable<IfcPermeableCoveringOperationEnum>(); }
+        void put_OperationType(IfcPermeableCoveringOperationEnum value) { RDF_EXPRESS_PROBE(950); TextValue val = IfcPermeableCoveringOperationEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(950), sdaiENUM, val); }
+
+        Nullable<IfcWindowPanelPositionEnum> get_PanelPosition() { RDF_EXPRESS_PROBE(951); int v = getENUM(951, IfcWindowPanelPositionEnum_hash); if (v >= 0) return (IfcWindowPanelPositionEnum) v; else return Nullable<IfcWindowPanelPositionEnum>(); }
+        void put_PanelPosition(IfcWindowPanelPositionEnum value) { RDF_EXPRESS_PROBE(951); TextValue val = IfcWindowPanelPositionEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(951), sdaiENUM, val); }
+
+        Nullable<IfcPositiveLengthMeasure> get_FrameDepth() { RDF_EXPRESS_PROBE(952); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(952), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_FrameDepth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(952); sdaiPutAttr(m_instance, getAttrDefinition(952), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_FrameThickness() { RDF_EXPRESS_PROBE(953); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(953), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_FrameThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(953); sdaiPutAttr(m_instance, getAttrDefinition(953), sdaiREAL, &value); }
+
+        IfcShapeAspect get_ShapeAspectStyle();
+        void put_ShapeAspectStyle(IfcShapeAspect inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedPropertySet::attr
+        {
+            static constexpr IntValue OperationType = 950;
+            static constexpr IntValue PanelPosition = 951;
+            static constexpr IntValue FrameDepth = 952;
+            static constexpr IntValue FrameThickness = 953;
+            static constexpr IntValue ShapeAspectStyle = 954;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPermeableCoveringProperties_CLASS_H
@@ -0,0 +1,146 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPerson_CLASS_H
+#define __RDF_LTD__IFC4_IfcPerson_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPerson
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPerson : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPerson
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPerson(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 411);
+        }
+
+        /// <summary>
+        /// Instances of IfcPerson in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPerson> Extent(SdaiModel model) { return ExtentRange<IfcPerson>(model, 411, false); }
+        static ExtentRange<IfcPerson> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPerson>(model, 411, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPerson and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPerson Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPerson"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPerson if the actual type of SdaiInstance is IfcPerson or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPerson CreateExactEntity(SdaiInstance instance) { return IfcPerson(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPerson or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPerson(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Identification() { RDF_EXPRESS_PROBE(958); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(958), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Identification_view() { return TextView(get_Identification()); }
+#endif
+        void put_Identification(IfcIdentifier value) { RDF_EXPRESS_PROBE(958); sdaiPutAttr(m_instance, getAttrDefinition(958), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Identification_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(958); return buffer.GetAttr(m_instance, "Identification"); }
+        const char* get_Identification_utf8() { return get_Identification_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_FamilyName() { RDF_EXPRESS_PROBE(959); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(959), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_FamilyName_view() { return TextView(get_FamilyName()); }
+#endif
+        void put_FamilyName(IfcLabel value) { RDF_EXPRESS_PROBE(959); sdaiPutAttr(m_instance, getAttrDefinition(959), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_FamilyName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(959); return buffer.GetAttr(m_instance, "FamilyName"); }
+        const char* get_FamilyName_utf8() { return get_FamilyName_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_GivenName() { RDF_EXPRESS_PROBE(960); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(960), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_GivenName_view() { return TextView(get_GivenName()); }
+#endif
+        void put_GivenName(IfcLabel value) { RDF_EXPRESS_PROBE(960); sdaiPutAttr(m_instance, getAttrDefinition(960), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_GivenName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(960); return buffer.GetAttr(m_instance, "GivenName"); }
+        const char* get_GivenName_utf8() { return get_GivenName_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void get_MiddleNames(TList& lst) { RDF_EXPRESS_PROBE(961); ListOfIfcLabelSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(961)); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void put_MiddleNames(TList& lst) { RDF_EXPRESS_PROBE(961); ListOfIfcLabelSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(961)); }
+
+        //TArrayElem[] may be IfcLabel[] or array of convertible elements
+        template <typename TArrayElem> void put_MiddleNames(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(961); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcLabelSerializer<ListOfIfcLabel> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(961)); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void get_PrefixTitles(TList& lst) { RDF_EXPRESS_PROBE(962); ListOfIfcLabelSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(962)); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void put_PrefixTitles(TList& lst) { RDF_EXPRESS_PROBE(962); ListOfIfcLabelSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(962)); }
+
+        //TArrayElem[] may be IfcLabel[] or array of convertible elements
+        template <typename TArrayElem> void put_PrefixTitles(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(962); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcLabelSerializer<ListOfIfcLabel> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(962)); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void get_SuffixTitles(TList& lst) { RDF_EXPRESS_PROBE(963); ListOfIfcLabelSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(963)); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void put_SuffixTitles(TList& lst) { RDF_EXPRESS_PROBE(963); ListOfIfcLabelSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(963)); }
+
+        //TArrayElem[] may be IfcLabel[] or array of convertible elements
+        template <typename TArrayElem> void put_SuffixTitles(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(963); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcLabelSerializer<ListOfIfcLabel> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(963)); }
+
+        //TList may be ListOfIfcActorRole or list of convertible elements
+        template <typename TList> void get_Roles(TList& lst) { RDF_EXPRESS_PROBE(964); ListOfIfcActorRoleSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(964)); }
+
+        //TList may be ListOfIfcActorRole or list of convertible elements
+        template <typename TList> void put_Roles(TList& lst) { RDF_EXPRESS_PROBE(964); ListOfIfcActorRoleSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(964)); }
+
+        //TArrayElem[] may be IfcActorRole[] or array of convertible elements
+        template <typename TArrayElem> void put_Roles(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(964); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcActorRoleSerializer<ListOfIfcActorRole> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(964)); }
+
+        //TList may be ListOfIfcAddress or list of convertible elements
+        template <typename TList> void get_Addresses(TList& lst) { RDF_EXPRESS_PROBE(965); ListOfIfcAddressSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(965)); }
+
+        //TList may be ListOfIfcAddress or list of convertible elements
+        template <typename TList> void put_Addresses(TList& lst) { RDF_EXPRESS_PROBE(965); ListOfIfcAddressSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(965)); }
+
+        //TArrayElem[] may be IfcAddress[] or array of convertible elements
+        template <typename TArrayElem> void put_Addresses(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(965); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcAddressSerializer<ListOfIfcAddress> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(965)); }
+
+        //TList may be SetOfIfcPersonAndOrganization or list of convertible elements
+        template <typename TList> void get_EngagedIn(TList& lst) { RDF_EXPRESS_PROBE(966); SetOfIfcPersonAndOrganizationSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(966)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Identification = 958;
+            static constexpr IntValue FamilyName = 959;
+            static constexpr IntValue GivenName = 960;
+            static constexpr IntValue MiddleNames = 961;
+            static constexpr IntValue PrefixTitles = 962;
+            static constexpr IntValue SuffixTitles = 963;
+            static constexpr IntValue Roles = 964;
+            static constexpr IntValue Addresses = 965;
+            static constexpr IntValue EngagedIn = 966;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPerson_CLASS_H
@@ -0,0 +1,77 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPersonAndOrganization_CLASS_H
+#define __RDF_LTD__IFC4_IfcPersonAndOrganization_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPersonAndOrganization
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPersonAndOrganization : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPersonAndOrganization
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPersonAndOrganization(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 412);
+        }
+
+        /// <summary>
+        /// Instances of IfcPersonAndOrganization in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPersonAndOrganization> Extent(SdaiModel model) { return ExtentRange<IfcPersonAndOrganization>(model, 412, false); }
+        static ExtentRange<IfcPersonAndOrganization> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPersonAndOrganization>(model, 412, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPersonAndOrganization and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPersonAndOrganization Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPersonAndOrganization"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPersonAndOrganization if the actual type of SdaiInstance is IfcPersonAndOrganization or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPersonAndOrganization CreateExactEntity(SdaiInstance instance) { return IfcPersonAndOrganization(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPersonAndOrganization or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPersonAndOrganization(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcPerson get_ThePerson();
+        void put_ThePerson(IfcPerson inst);
+
+        IfcOrganization get_TheOrganization();
+        void put_TheOrganization(IfcOrganization inst);
+
+        //TList may be ListOfIfcActorRole or list of convertible elements
+        template <typename TList> void get_Roles(TList& lst) { RDF_EXPRESS_PROBE(969); ListOfIfcActorRoleSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(969)); }
+
+        //TList may be ListOfIfcActorRole or list of convertible elements
+        template <typename TList> void put_Roles(TList& lst) { RDF_EXPRESS_PROBE(969); ListOfIfcActorRoleSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(969)); }
+
+        //TArrayElem[] may be IfcActorRole[] or array of convertible elements
+        template <typename TArrayElem> void put_Roles(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(969); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcActorRoleSerializer<ListOfIfcActorRole> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(969)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue ThePerson = 967;
+            static constexpr IntValue TheOrganization = 968;
+            static constexpr IntValue Roles = 969;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPersonAndOrganization_CLASS_H
@@ -0,0 +1,103 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPhysicalComplexQuantity_CLASS_H
+#define __RDF_LTD__IFC4_IfcPhysicalComplexQuantity_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPhysicalQuantity.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPhysicalComplexQuantity
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPhysicalComplexQuantity : public RDF_EXPRESS_VIRTUAL IfcPhysicalQuantity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPhysicalComplexQuantity
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPhysicalComplexQuantity(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 413);
+        }
+
+        /// <summary>
+        /// Instances of IfcPhysicalComplexQuantity in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPhysicalComplexQuantity> Extent(SdaiModel model) { return ExtentRange<IfcPhysicalComplexQuantity>(model, 413, false); }
+        static ExtentRange<IfcPhysicalComplexQuantity> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPhysicalComplexQuantity>(model, 413, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPhysicalComplexQuantity and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPhysicalComplexQuantity Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPhysicalComplexQuantity"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPhysicalComplexQuantity if the actual type of SdaiInstance is IfcPhysicalComplexQuantity or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPhysicalComplexQuantity CreateExactEntity(SdaiInstance instance) { return IfcPhysicalComplexQuantity(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPhysicalComplexQuantity or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPhysicalComplexQuantity(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcPhysicalQuantity or list of convertible elements
+        template <typename TList> void get_HasQuantities(TList& lst) { RDF_EXPRESS_PROBE(974); SetOfIfcPhysicalQuantitySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(974)); }
+
+        //TList may be SetOfIfcPhysicalQuantity or list of convertible elements
+        template <typename TList> void put_HasQuantities(TList& lst) { RDF_EXPRESS_PROBE(974); SetOfIfcPhysicalQuantitySerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(974)); }
+
+        //TArrayElem[] may be IfcPhysicalQuantity[] or array of convertible elements
+        template <typename TArrayElem> void put_HasQuantities(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(974); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcPhysicalQuantitySerializer<SetOfIfcPhysicalQuantity> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(974)); }
+
+        IfcLabel get_Discrimination() { RDF_EXPRESS_PROBE(975); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(975), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Discrimination_view() { return TextView(get_Discrimination()); }
+#endif
+        void put_Discrimination(IfcLabel value) { RDF_EXPRESS_PROBE(975); sdaiPutAttr(m_instance, getAttrDefinition(975), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Discrimination_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(975); return buffer.GetAttr(m_instance, "Discrimination"); }
+        const char* get_Discrimination_utf8() { return get_Discrimination_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Quality() { RDF_EXPRESS_PROBE(976); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(976), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Quality_view() { return TextView(get_Quality()); }
+#endif
+        void put_Quality(IfcLabel value) { RDF_EXPRESS_PROBE(976); sdaiPutAttr(m_instance, getAttrDefinition(976), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Quality_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(976); return buffer.GetAttr(m_instance, "Quality"); }
+        const char* get_Quality_utf8() { return get_Quality_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Usage() { RDF_EXPRESS_PROBE(977); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(977), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Usage_view() { return TextView(get_Usage()); }
+#endif
+        void put_Usage(IfcLabel value) { RDF_EXPRESS_PROBE(977); sdaiPutAttr(m_instance, getAttrDefinition(977), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Usage_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(977); return buffer.GetAttr(m_instance, "Usage"); }
+        const char* get_Usage_utf8() { return get_Usage_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPhysicalQuantity::attr
+        {
+            static constexpr IntValue HasQuantities = 974;
+            static constexpr IntValue Discrimination = 975;
+            static constexpr IntValue Quality = 976;
+            static constexpr IntValue Usage = 977;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPhysicalComplexQuantity_CLASS_H
@@ -0,0 +1,85 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPhysicalQuantity_CLASS_H
+#define __RDF_LTD__IFC4_IfcPhysicalQuantity_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPhysicalQuantity
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPhysicalQuantity : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPhysicalQuantity
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPhysicalQuantity(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 414);
+        }
+
+        /// <summary>
+        /// Instances of IfcPhysicalQuantity in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPhysicalQuantity> Extent(SdaiModel model) { return ExtentRange<IfcPhysicalQuantity>(model, 414, false); }
+        static ExtentRange<IfcPhysicalQuantity> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPhysicalQuantity>(model, 414, true); }
+
+        /// <summary>
+        /// Returns object of IfcPhysicalQuantity if the actual type of SdaiInstance is IfcPhysicalQuantity or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPhysicalQuantity CreateExactEntity(SdaiInstance instance) { return IfcPhysicalQuantity(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPhysicalQuantity or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPhysicalQuantity(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(970); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(970), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(970); sdaiPutAttr(m_instance, getAttrDefinition(970), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(970); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(971); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(971), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(971); sdaiPutAttr(m_instance, getAttrDefinition(971), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(971); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcExternalReferenceRelationship or list of convertible elements
+        template <typename TList> void get_HasExternalReferences(TList& lst) { RDF_EXPRESS_PROBE(972); SetOfIfcExternalReferenceRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(972)); }
+
+        //TList may be SetOfIfcPhysicalComplexQuantity or list of convertible elements
+        template <typename TList> void get_PartOfComplex(TList& lst) { RDF_EXPRESS_PROBE(973); SetOfIfcPhysicalComplexQuantitySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(973)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Name = 970;
+            static constexpr IntValue Description = 971;
+            static constexpr IntValue HasExternalReferences = 972;
+            static constexpr IntValue PartOfComplex = 973;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPhysicalQuantity_CLASS_H
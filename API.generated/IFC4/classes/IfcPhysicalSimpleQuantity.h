@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPhysicalSimpleQuantity_CLASS_H
+#define __RDF_LTD__IFC4_IfcPhysicalSimpleQuantity_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPhysicalQuantity.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPhysicalSimpleQuantity
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPhysicalSimpleQuantity : public RDF_EXPRESS_VIRTUAL IfcPhysicalQuantity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPhysicalSimpleQuantity
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPhysicalSimpleQuantity(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 415);
+        }
+
+        /// <summary>
+        /// Instances of IfcPhysicalSimpleQuantity in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPhysicalSimpleQuantity> Extent(SdaiModel model) { return ExtentRange<IfcPhysicalSimpleQuantity>(model, 415, false); }
+        static ExtentRange<IfcPhysicalSimpleQuantity> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPhysicalSimpleQuantity>(model, 415, true); }
+
+        /// <summary>
+        /// Returns object of IfcPhysicalSimpleQuantity if the actual type of SdaiInstance is IfcPhysicalSimpleQuantity or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPhysicalSimpleQuantity CreateExactEntity(SdaiInstance instance) { return IfcPhysicalSimpleQuantity(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPhysicalSimpleQuantity or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPhysicalSimpleQuantity(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcNamedUnit get_Unit();
+        void put_Unit(IfcNamedUnit inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPhysicalQuantity::attr
+        {
+            static constexpr IntValue Unit = 978;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPhysicalSimpleQuantity_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPile_CLASS_H
+#define __RDF_LTD__IFC4_IfcPile_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPile
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPile : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPile
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPile(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 416);
+        }
+
+        /// <summary>
+        /// Instances of IfcPile in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPile> Extent(SdaiModel model) { return ExtentRange<IfcPile>(model, 416, false); }
+        static ExtentRange<IfcPile> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPile>(model, 416, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPile and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPile Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPile"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPile if the actual type of SdaiInstance is IfcPile or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPile CreateExactEntity(SdaiInstance instance) { return IfcPile(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPile or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPile(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPileTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(979); int v = getENUM(979, IfcPileTypeEnum_hash); if (v >= 0) return (IfcPileTypeEnum) v; else return Nullable<IfcPileTypeEnum>(); }
+        void put_PredefinedType(IfcPileTypeEnum value) { RDF_EXPRESS_PROBE(979); TextValue val = IfcPileTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(979), sdaiENUM, val); }
+
+        Nullable<IfcPileConstructionEnum> get_ConstructionType() { RDF_EXPRESS_PROBE(980); int v = getENUM(980, IfcPileConstructionEnum_hash); if (v >= 0) return (IfcPileConstructionEnum) v; else return Nullable<IfcPileConstructionEnum>(); }
+        void put_ConstructionType(IfcPileConstructionEnum value) { RDF_EXPRESS_PROBE(980); TextValue val = IfcPileConstructionEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(980), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 979;
+            static constexpr IntValue ConstructionType = 980;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPile_CLASS_H
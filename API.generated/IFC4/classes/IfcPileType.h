@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPileType_CLASS_H
+#define __RDF_LTD__IFC4_IfcPileType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPileType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPileType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPileType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPileType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 417);
+        }
+
+        /// <summary>
+        /// Instances of IfcPileType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPileType> Extent(SdaiModel model) { return ExtentRange<IfcPileType>(model, 417, false); }
+        static ExtentRange<IfcPileType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPileType>(model, 417, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPileType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPileType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPileType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPileType if the actual type of SdaiInstance is IfcPileType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPileType CreateExactEntity(SdaiInstance instance) { return IfcPileType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPileType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPileType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPileTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(981); int v = getENUM(981, IfcPileTypeEnum_hash); if (v >= 0) return (IfcPileTypeEnum) v; else return Nullable<IfcPileTypeEnum>(); }
+        void put_PredefinedType(IfcPileTypeEnum value) { RDF_EXPRESS_PROBE(981); TextValue val = IfcPileTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(981), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 981;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPileType_CLASS_H
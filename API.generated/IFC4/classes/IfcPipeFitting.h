@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPipeFitting_CLASS_H
+#define __RDF_LTD__IFC4_IfcPipeFitting_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowFitting.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPipeFitting
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPipeFitting : public RDF_EXPRESS_VIRTUAL IfcFlowFitting
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPipeFitting
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPipeFitting(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 418);
+        }
+
+        /// <summary>
+        /// Instances of IfcPipeFitting in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPipeFitting> Extent(SdaiModel model) { return ExtentRange<IfcPipeFitting>(model, 418, false); }
+        static ExtentRange<IfcPipeFitting> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPipeFitting>(model, 418, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPipeFitting and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPipeFitting Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPipeFitting"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPipeFitting if the actual type of SdaiInstance is IfcPipeFitting or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPipeFitting CreateExactEntity(SdaiInstance instance) { return IfcPipeFitting(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPipeFitting or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPipeFitting(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPipeFittingTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(982); int v = getENUM(982, IfcPipeFittingTypeEnum_hash); if (v >= 0) return (IfcPipeFittingTypeEnum) v; else return Nullable<IfcPipeFittingTypeEnum>(); }
+        void put_PredefinedType(IfcPipeFittingTypeEnum value) { RDF_EXPRESS_PROBE(982); TextValue val = IfcPipeFittingTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(982), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowFitting::attr
+        {
+            static constexpr IntValue PredefinedType = 982;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPipeFitting_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPipeFittingType_CLASS_H
+#define __RDF_LTD__IFC4_IfcPipeFittingType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowFittingType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPipeFittingType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPipeFittingType : public RDF_EXPRESS_VIRTUAL IfcFlowFittingType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPipeFittingType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPipeFittingType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 419);
+        }
+
+        /// <summary>
+        /// Instances of IfcPipeFittingType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPipeFittingType> Extent(SdaiModel model) { return ExtentRange<IfcPipeFittingType>(model, 419, false); }
+        static ExtentRange<IfcPipeFittingType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPipeFittingType>(model, 419, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPipeFittingType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPipeFittingType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPipeFittingType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPipeFittingType if the actual type of SdaiInstance is IfcPipeFittingType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPipeFittingType CreateExactEntity(SdaiInstance instance) { return IfcPipeFittingType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPipeFittingType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPipeFittingType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPipeFittingTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(983); int v = getENUM(983, IfcPipeFittingTypeEnum_hash); if (v >= 0) return (IfcPipeFittingTypeEnum) v; else return Nullable<IfcPipeFittingTypeEnum>(); }
+        void put_PredefinedType(IfcPipeFittingTypeEnum value) { RDF_EXPRESS_PROBE(983); TextValue val = IfcPipeFittingTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(983), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowFittingType::attr
+        {
+            static constexpr IntValue PredefinedType = 983;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPipeFittingType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPipeSegment_CLASS_H
+#define __RDF_LTD__IFC4_IfcPipeSegment_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowSegment.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPipeSegment
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPipeSegment : public RDF_EXPRESS_VIRTUAL IfcFlowSegment
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPipeSegment
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPipeSegment(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 420);
+        }
+
+        /// <summary>
+        /// Instances of IfcPipeSegment in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPipeSegment> Extent(SdaiModel model) { return ExtentRange<IfcPipeSegment>(model, 420, false); }
+        static ExtentRange<IfcPipeSegment> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPipeSegment>(model, 420, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPipeSegment and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPipeSegment Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPipeSegment"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPipeSegment if the actual type of SdaiInstance is IfcPipeSegment or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPipeSegment CreateExactEntity(SdaiInstance instance) { return IfcPipeSegment(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPipeSegment or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPipeSegment(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPipeSegmentTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(984); int v = getENUM(984, IfcPipeSegmentTypeEnum_hash); if (v >= 0) return (IfcPipeSegmentTypeEnum) v; else return Nullable<IfcPipeSegmentTypeEnum>(); }
+        void put_PredefinedType(IfcPipeSegmentTypeEnum value) { RDF_EXPRESS_PROBE(984); TextValue val = IfcPipeSegmentTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(984), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowSegment::attr
+        {
+            static constexpr IntValue PredefinedType = 984;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPipeSegment_CLASS_H
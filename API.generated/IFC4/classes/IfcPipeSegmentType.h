@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPipeSegmentType_CLASS_H
+#define __RDF_LTD__IFC4_IfcPipeSegmentType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowSegmentType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPipeSegmentType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPipeSegmentType : public RDF_EXPRESS_VIRTUAL IfcFlowSegmentType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPipeSegmentType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPipeSegmentType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 421);
+        }
+
+        /// <summary>
+        /// Instances of IfcPipeSegmentType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPipeSegmentType> Extent(SdaiModel model) { return ExtentRange<IfcPipeSegmentType>(model, 421, false); }
+        static ExtentRange<IfcPipeSegmentType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPipeSegmentType>(model, 421, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPipeSegmentType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPipeSegmentType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPipeSegmentType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPipeSegmentType if the actual type of SdaiInstance is IfcPipeSegmentType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPipeSegmentType CreateExactEntity(SdaiInstance instance) { return IfcPipeSegmentType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPipeSegmentType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPipeSegmentType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPipeSegmentTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(985); int v = getENUM(985, IfcPipeSegmentTypeEnum_hash); if (v >= 0) return (IfcPipeSegmentTypeEnum) v; else return Nullable<IfcPipeSegmentTypeEnum>(); }
+        void put_PredefinedType(IfcPipeSegmentTypeEnum value) { RDF_EXPRESS_PROBE(985); TextValue val = IfcPipeSegmentTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(985), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowSegmentType::attr
+        {
+            static constexpr IntValue PredefinedType = 985;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPipeSegmentType_CLASS_H
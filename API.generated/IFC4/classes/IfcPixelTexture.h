@@ -0,0 +1,82 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPixelTexture_CLASS_H
+#define __RDF_LTD__IFC4_IfcPixelTexture_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSurfaceTexture.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPixelTexture
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPixelTexture : public RDF_EXPRESS_VIRTUAL IfcSurfaceTexture
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPixelTexture
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPixelTexture(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 422);
+        }
+
+        /// <summary>
+        /// Instances of IfcPixelTexture in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPixelTexture> Extent(SdaiModel model) { return ExtentRange<IfcPixelTexture>(model, 422, false); }
+        static ExtentRange<IfcPixelTexture> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPixelTexture>(model, 422, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPixelTexture and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPixelTexture Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPixelTexture"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPixelTexture if the actual type of SdaiInstance is IfcPixelTexture or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPixelTexture CreateExactEntity(SdaiInstance instance) { return IfcPixelTexture(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPixelTexture or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPixelTexture(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcInteger> get_Width() { RDF_EXPRESS_PROBE(986); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(986), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_Width(IfcInteger value) { RDF_EXPRESS_PROBE(986); sdaiPutAttr(m_instance, getAttrDefinition(986), sdaiINTEGER, &value); }
+
+        Nullable<IfcInteger> get_Height() { RDF_EXPRESS_PROBE(987); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(987), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_Height(IfcInteger value) { RDF_EXPRESS_PROBE(987); sdaiPutAttr(m_instance, getAttrDefinition(987), sdaiINTEGER, &value); }
+
+        Nullable<IfcInteger> get_ColourComponents() { RDF_EXPRESS_PROBE(988); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(988), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_ColourComponents(IfcInteger value) { RDF_EXPRESS_PROBE(988); sdaiPutAttr(m_instance, getAttrDefinition(988), sdaiINTEGER, &value); }
+
+        //TList may be ListOfIfcBinary or list of convertible elements
+        template <typename TList> void get_Pixel(TList& lst) { RDF_EXPRESS_PROBE(989); ListOfIfcBinarySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(989)); }
+
+        //TList may be ListOfIfcBinary or list of convertible elements
+        template <typename TList> void put_Pixel(TList& lst) { RDF_EXPRESS_PROBE(989); ListOfIfcBinarySerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(989)); }
+
+        //TArrayElem[] may be IfcBinary[] or array of convertible elements
+        template <typename TArrayElem> void put_Pixel(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(989); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcBinarySerializer<ListOfIfcBinary> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(989)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSurfaceTexture::attr
+        {
+            static constexpr IntValue Width = 986;
+            static constexpr IntValue Height = 987;
+            static constexpr IntValue ColourComponents = 988;
+            static constexpr IntValue Pixel = 989;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPixelTexture_CLASS_H
@@ -0,0 +1,63 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPlacement_CLASS_H
+#define __RDF_LTD__IFC4_IfcPlacement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPlacement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPlacement : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPlacement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPlacement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 423);
+        }
+
+        /// <summary>
+        /// Instances of IfcPlacement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPlacement> Extent(SdaiModel model) { return ExtentRange<IfcPlacement>(model, 423, false); }
+        static ExtentRange<IfcPlacement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPlacement>(model, 423, true); }
+
+        /// <summary>
+        /// Returns object of IfcPlacement if the actual type of SdaiInstance is IfcPlacement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPlacement CreateExactEntity(SdaiInstance instance) { return IfcPlacement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPlacement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPlacement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCartesianPoint get_Location();
+        void put_Location(IfcCartesianPoint inst);
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(146); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(146), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue Location = 145;
+            static constexpr IntValue Dim = 146;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPlacement_CLASS_H
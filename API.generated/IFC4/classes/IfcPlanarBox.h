@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPlanarBox_CLASS_H
+#define __RDF_LTD__IFC4_IfcPlanarBox_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPlanarExtent.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPlanarBox
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPlanarBox : public RDF_EXPRESS_VIRTUAL IfcPlanarExtent
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPlanarBox
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPlanarBox(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 424);
+        }
+
+        /// <summary>
+        /// Instances of IfcPlanarBox in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPlanarBox> Extent(SdaiModel model) { return ExtentRange<IfcPlanarBox>(model, 424, false); }
+        static ExtentRange<IfcPlanarBox> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPlanarBox>(model, 424, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPlanarBox and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPlanarBox Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPlanarBox"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPlanarBox if the actual type of SdaiInstance is IfcPlanarBox or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPlanarBox CreateExactEntity(SdaiInstance instance) { return IfcPlanarBox(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPlanarBox or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPlanarBox(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcAxis2Placement_get get_Placement() { return IfcAxis2Placement_get(m_instance, 992); }
+        IfcAxis2Placement_put put_Placement() { return IfcAxis2Placement_put(m_instance, 992); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPlanarExtent::attr
+        {
+            static constexpr IntValue Placement = 992;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPlanarBox_CLASS_H
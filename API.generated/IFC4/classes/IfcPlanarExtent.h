@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPlanarExtent_CLASS_H
+#define __RDF_LTD__IFC4_IfcPlanarExtent_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPlanarExtent
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPlanarExtent : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPlanarExtent
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPlanarExtent(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 425);
+        }
+
+        /// <summary>
+        /// Instances of IfcPlanarExtent in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPlanarExtent> Extent(SdaiModel model) { return ExtentRange<IfcPlanarExtent>(model, 425, false); }
+        static ExtentRange<IfcPlanarExtent> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPlanarExtent>(model, 425, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPlanarExtent and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPlanarExtent Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPlanarExtent"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPlanarExtent if the actual type of SdaiInstance is IfcPlanarExtent or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPlanarExtent CreateExactEntity(SdaiInstance instance) { return IfcPlanarExtent(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPlanarExtent or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPlanarExtent(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLengthMeasure> get_SizeInX() { RDF_EXPRESS_PROBE(990); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(990), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_SizeInX(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(990); sdaiPutAttr(m_instance, getAttrDefinition(990), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_SizeInY() { RDF_EXPRESS_PROBE(991); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(991), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_SizeInY(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(991); sdaiPutAttr(m_instance, getAttrDefinition(991), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue SizeInX = 990;
+            static constexpr IntValue SizeInY = 991;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPlanarExtent_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPlane_CLASS_H
+#define __RDF_LTD__IFC4_IfcPlane_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementarySurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPlane
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPlane : public RDF_EXPRESS_VIRTUAL IfcElementarySurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPlane
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPlane(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 426);
+        }
+
+        /// <summary>
+        /// Instances of IfcPlane in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPlane> Extent(SdaiModel model) { return ExtentRange<IfcPlane>(model, 426, false); }
+        static ExtentRange<IfcPlane> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPlane>(model, 426, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPlane and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPlane Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPlane"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPlane if the actual type of SdaiInstance is IfcPlane or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPlane CreateExactEntity(SdaiInstance instance) { return IfcPlane(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPlane or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPlane(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementarySurface::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPlane_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPlate_CLASS_H
+#define __RDF_LTD__IFC4_IfcPlate_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPlate
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPlate : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPlate
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPlate(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 427);
+        }
+
+        /// <summary>
+        /// Instances of IfcPlate in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPlate> Extent(SdaiModel model) { return ExtentRange<IfcPlate>(model, 427, false); }
+        static ExtentRange<IfcPlate> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPlate>(model, 427, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPlate and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPlate Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPlate"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPlate if the actual type of SdaiInstance is IfcPlate or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPlate CreateExactEntity(SdaiInstance instance) { return IfcPlate(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPlate or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPlate(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPlateTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(993); int v = getENUM(993, IfcPlateTypeEnum_hash); if (v >= 0) return (IfcPlateTypeEnum) v; else return Nullable<IfcPlateTypeEnum>(); }
+        void put_PredefinedType(IfcPlateTypeEnum value) { RDF_EXPRESS_PROBE(993); TextValue val = IfcPlateTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(993), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 993;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPlate_CLASS_H
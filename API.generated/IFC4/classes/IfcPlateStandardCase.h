@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPlateStandardCase_CLASS_H
+#define __RDF_LTD__IFC4_IfcPlateStandardCase_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPlate.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPlateStandardCase
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPlateStandardCase : public RDF_EXPRESS_VIRTUAL IfcPlate
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPlateStandardCase
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPlateStandardCase(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 428);
+        }
+
+        /// <summary>
+        /// Instances of IfcPlateStandardCase in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPlateStandardCase> Extent(SdaiModel model) { return ExtentRange<IfcPlateStandardCase>(model, 428, false); }
+        static ExtentRange<IfcPlateStandardCase> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPlateStandardCase>(model, 428, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPlateStandardCase and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPlateStandardCase Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPlateStandardCase"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPlateStandardCase if the actual type of SdaiInstance is IfcPlateStandardCase or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPlateStandardCase CreateExactEntity(SdaiInstance instance) { return IfcPlateStandardCase(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPlateStandardCase or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPlateStandardCase(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPlate::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPlateStandardCase_CLASS_H
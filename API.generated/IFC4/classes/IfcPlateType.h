@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPlateType_CLASS_H
+#define __RDF_LTD__IFC4_IfcPlateType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPlateType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPlateType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPlateType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPlateType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 429);
+        }
+
+        /// <summary>
+        /// Instances of IfcPlateType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPlateType> Extent(SdaiModel model) { return ExtentRange<IfcPlateType>(model, 429, false); }
+        static ExtentRange<IfcPlateType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPlateType>(model, 429, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPlateType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPlateType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPlateType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPlateType if the actual type of SdaiInstance is IfcPlateType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPlateType CreateExactEntity(SdaiInstance instance) { return IfcPlateType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPlateType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPlateType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPlateTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(994); int v = getENUM(994, IfcPlateTypeEnum_hash); if (v >= 0) return (IfcPlateTypeEnum) v; else return Nullable<IfcPlateTypeEnum>(); }
+        void put_PredefinedType(IfcPlateTypeEnum value) { RDF_EXPRESS_PROBE(994); TextValue val = IfcPlateTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(994), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 994;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPlateType_CLASS_H
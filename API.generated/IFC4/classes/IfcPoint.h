@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPoint_CLASS_H
+#define __RDF_LTD__IFC4_IfcPoint_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPoint
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPoint : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPoint
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPoint(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 430);
+        }
+
+        /// <summary>
+        /// Instances of IfcPoint in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPoint> Extent(SdaiModel model) { return ExtentRange<IfcPoint>(model, 430, false); }
+        static ExtentRange<IfcPoint> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPoint>(model, 430, true); }
+
+        /// <summary>
+        /// Returns object of IfcPoint if the actual type of SdaiInstance is IfcPoint or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPoint CreateExactEntity(SdaiInstance instance) { return IfcPoint(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPoint or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPoint(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPoint_CLASS_H
@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPointOnCurve_CLASS_H
+#define __RDF_LTD__IFC4_IfcPointOnCurve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPoint.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPointOnCurve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPointOnCurve : public RDF_EXPRESS_VIRTUAL IfcPoint
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPointOnCurve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPointOnCurve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 431);
+        }
+
+        /// <summary>
+        /// Instances of IfcPointOnCurve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPointOnCurve> Extent(SdaiModel model) { return ExtentRange<IfcPointOnCurve>(model, 431, false); }
+        static ExtentRange<IfcPointOnCurve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPointOnCurve>(model, 431, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPointOnCurve and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPointOnCurve Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPointOnCurve"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPointOnCurve if the actual type of SdaiInstance is IfcPointOnCurve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPointOnCurve CreateExactEntity(SdaiInstance instance) { return IfcPointOnCurve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPointOnCurve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPointOnCurve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurve get_BasisCurve();
+        void put_BasisCurve(IfcCurve inst);
+
+        Nullable<IfcParameterValue> get_PointParameter() { RDF_EXPRESS_PROBE(996); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(996), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_PointParameter(IfcParameterValue value) { RDF_EXPRESS_PROBE(996); sdaiPutAttr(m_instance, getAttrDefinition(996), sdaiREAL, &value); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(997); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(997), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPoint::attr
+        {
+            static constexpr IntValue BasisCurve = 995;
+            static constexpr IntValue PointParameter = 996;
+            static constexpr IntValue Dim = 997;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPointOnCurve_CLASS_H
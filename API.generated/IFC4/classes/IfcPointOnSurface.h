@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPointOnSurface_CLASS_H
+#define __RDF_LTD__IFC4_IfcPointOnSurface_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPoint.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPointOnSurface
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPointOnSurface : public RDF_EXPRESS_VIRTUAL IfcPoint
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPointOnSurface
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPointOnSurface(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 432);
+        }
+
+        /// <summary>
+        /// Instances of IfcPointOnSurface in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPointOnSurface> Extent(SdaiModel model) { return ExtentRange<IfcPointOnSurface>(model, 432, false); }
+        static ExtentRange<IfcPointOnSurface> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPointOnSurface>(model, 432, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPointOnSurface and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPointOnSurface Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPointOnSurface"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPointOnSurface if the actual type of SdaiInstance is IfcPointOnSurface or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPointOnSurface CreateExactEntity(SdaiInstance instance) { return IfcPointOnSurface(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPointOnSurface or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPointOnSurface(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcSurface get_BasisSurface();
+        void put_BasisSurface(IfcSurface inst);
+
+        Nullable<IfcParameterValue> get_PointParameterU() { RDF_EXPRESS_PROBE(999); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(999), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_PointParameterU(IfcParameterValue value) { RDF_EXPRESS_PROBE(999); sdaiPutAttr(m_instance, getAttrDefinition(999), sdaiREAL, &value); }
+
+        Nullable<IfcParameterValue> get_PointParameterV() { RDF_EXPRESS_PROBE(1000); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1000), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_PointParameterV(IfcParameterValue value) { RDF_EXPRESS_PROBE(1000); sdaiPutAttr(m_instance, getAttrDefinition(1000), sdaiREAL, &value); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(1001); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1001), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPoint::attr
+        {
+            static constexpr IntValue BasisSurface = 998;
+            static constexpr IntValue PointParameterU = 999;
+            static constexpr IntValue PointParameterV = 1000;
+            static constexpr IntValue Dim = 1001;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPointOnSurface_CLASS_H
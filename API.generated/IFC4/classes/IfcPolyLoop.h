@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPolyLoop_CLASS_H
+#define __RDF_LTD__IFC4_IfcPolyLoop_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcLoop.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPolyLoop
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPolyLoop : public RDF_EXPRESS_VIRTUAL IfcLoop
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPolyLoop
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPolyLoop(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 436);
+        }
+
+        /// <summary>
+        /// Instances of IfcPolyLoop in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPolyLoop> Extent(SdaiModel model) { return ExtentRange<IfcPolyLoop>(model, 436, false); }
+        static ExtentRange<IfcPolyLoop> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPolyLoop>(model, 436, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPolyLoop and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPolyLoop Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPolyLoop"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPolyLoop if the actual type of SdaiInstance is IfcPolyLoop or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPolyLoop CreateExactEntity(SdaiInstance instance) { return IfcPolyLoop(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPolyLoop or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPolyLoop(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcCartesianPoint or list of convertible elements
+        template <typename TList> void get_Polygon(TList& lst) { RDF_EXPRESS_PROBE(1012); ListOfIfcCartesianPointSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1012)); }
+
+        //TList may be ListOfIfcCartesianPoint or list of convertible elements
+        template <typename TList> void put_Polygon(TList& lst) { RDF_EXPRESS_PROBE(1012); ListOfIfcCartesianPointSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1012)); }
+
+        //TArrayElem[] may be IfcCartesianPoint[] or array of convertible elements
+        template <typename TArrayElem> void put_Polygon(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1012); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcCartesianPointSerializer<ListOfIfcCartesianPoint> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1012)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcLoop::attr
+        {
+            static constexpr IntValue Polygon = 1012;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPolyLoop_CLASS_H
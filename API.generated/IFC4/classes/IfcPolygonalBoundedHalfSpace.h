@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPolygonalBoundedHalfSpace_CLASS_H
+#define __RDF_LTD__IFC4_IfcPolygonalBoundedHalfSpace_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcHalfSpaceSolid.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPolygonalBoundedHalfSpace
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPolygonalBoundedHalfSpace : public RDF_EXPRESS_VIRTUAL IfcHalfSpaceSolid
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPolygonalBoundedHalfSpace
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPolygonalBoundedHalfSpace(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 433);
+        }
+
+        /// <summary>
+        /// Instances of IfcPolygonalBoundedHalfSpace in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPolygonalBoundedHalfSpace> Extent(SdaiModel model) { return ExtentRange<IfcPolygonalBoundedHalfSpace>(model, 433, false); }
+        static ExtentRange<IfcPolygonalBoundedHalfSpace> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPolygonalBoundedHalfSpace>(model, 433, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPolygonalBoundedHalfSpace and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPolygonalBoundedHalfSpace Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPolygonalBoundedHalfSpace"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPolygonalBoundedHalfSpace if the actual type of SdaiInstance is IfcPolygonalBoundedHalfSpace or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPolygonalBoundedHalfSpace CreateExactEntity(SdaiInstance instance) { return IfcPolygonalBoundedHalfSpace(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPolygonalBoundedHalfSpace or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPolygonalBoundedHalfSpace(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcAxis2Placement3D get_Position();
+        void put_Position(IfcAxis2Placement3D inst);
+
+        IfcBoundedCurve get_PolygonalBoundary();
+        void put_PolygonalBoundary(IfcBoundedCurve inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcHalfSpaceSolid::attr
+        {
+            static constexpr IntValue Position = 1002;
+            static constexpr IntValue PolygonalBoundary = 1003;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPolygonalBoundedHalfSpace_CLASS_H
@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPolygonalFaceSet_CLASS_H
+#define __RDF_LTD__IFC4_IfcPolygonalFaceSet_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTessellatedFaceSet.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPolygonalFaceSet
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPolygonalFaceSet : public RDF_EXPRESS_VIRTUAL IfcTessellatedFaceSet
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPolygonalFaceSet
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPolygonalFaceSet(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 434);
+        }
+
+        /// <summary>
+        /// Instances of IfcPolygonalFaceSet in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPolygonalFaceSet> Extent(SdaiModel model) { return ExtentRange<IfcPolygonalFaceSet>(model, 434, false); }
+        static ExtentRange<IfcPolygonalFaceSet> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPolygonalFaceSet>(model, 434, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPolygonalFaceSet and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPolygonalFaceSet Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPolygonalFaceSet"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPolygonalFaceSet if the actual type of SdaiInstance is IfcPolygonalFaceSet or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPolygonalFaceSet CreateExactEntity(SdaiInstance instance) { return IfcPolygonalFaceSet(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPolygonalFaceSet or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPolygonalFaceSet(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBoolean> get_Closed() { RDF_EXPRESS_PROBE(1008); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1008), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_Closed(IfcBoolean value) { RDF_EXPRESS_PROBE(1008); sdaiPutAttr(m_instance, getAttrDefinition(1008), sdaiBOOLEAN, &value); }
+
+        //TList may be ListOfIfcIndexedPolygonalFace or list of convertible elements
+        template <typename TList> void get_Faces(TList& lst) { RDF_EXPRESS_PROBE(1009); ListOfIfcIndexedPolygonalFaceSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1009)); }
+
+        //TList may be ListOfIfcIndexedPolygonalFace or list of convertible elements
+        template <typename TList> void put_Faces(TList& lst) { RDF_EXPRESS_PROBE(1009); ListOfIfcIndexedPolygonalFaceSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1009)); }
+
+        //TArrayElem[] may be IfcIndexedPolygonalFace[] or array of convertible elements
+        template <typename TArrayElem> void put_Faces(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1009); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcIndexedPolygonalFaceSerializer<ListOfIfcIndexedPolygonalFace> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1009)); }
+
+        //TList may be ListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void get_PnIndex(TList& lst) { RDF_EXPRESS_PROBE(1010); ListOfIfcPositiveIntegerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1010)); }
+
+        //TList may be ListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void put_PnIndex(TList& lst) { RDF_EXPRESS_PROBE(1010); ListOfIfcPositiveIntegerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1010)); }
+
+        //TArrayElem[] may be IfcPositiveInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_PnIndex(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1010); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcPositiveIntegerSerializer<ListOfIfcPositiveInteger> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1010)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTessellatedFaceSet::attr
+        {
+            static constexpr IntValue Closed = 1008;
+            static constexpr IntValue Faces = 1009;
+            static constexpr IntValue PnIndex = 1010;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPolygonalFaceSet_CLASS_H
@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPolyline_CLASS_H
+#define __RDF_LTD__IFC4_IfcPolyline_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundedCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPolyline
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPolyline : public RDF_EXPRESS_VIRTUAL IfcBoundedCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPolyline
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPolyline(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 435);
+        }
+
+        /// <summary>
+        /// Instances of IfcPolyline in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPolyline> Extent(SdaiModel model) { return ExtentRange<IfcPolyline>(model, 435, false); }
+        static ExtentRange<IfcPolyline> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPolyline>(model, 435, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPolyline and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPolyline Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPolyline"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPolyline if the actual type of SdaiInstance is IfcPolyline or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPolyline CreateExactEntity(SdaiInstance instance) { return IfcPolyline(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPolyline or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPolyline(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcCartesianPoint or list of convertible elements
+        template <typename TList> void get_Points(TList& lst) { RDF_EXPRESS_PROBE(1011); ListOfIfcCartesianPointSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1011)); }
+
+        //TList may be ListOfIfcCartesianPoint or list of convertible elements
+        template <typename TList> void put_Points(TList& lst) { RDF_EXPRESS_PROBE(1011); ListOfIfcCartesianPointSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1011)); }
+
+        //TArrayElem[] may be IfcCartesianPoint[] or array of convertible elements
+        template <typename TArrayElem> void put_Points(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1011); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcCartesianPointSerializer<ListOfIfcCartesianPoint> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1011)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundedCurve::attr
+        {
+            static constexpr IntValue Points = 1011;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPolyline_CLASS_H
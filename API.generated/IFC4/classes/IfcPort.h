@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPort_CLASS_H
+#define __RDF_LTD__IFC4_IfcPort_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProduct.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPort
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPort : public RDF_EXPRESS_VIRTUAL IfcProduct
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPort
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPort(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 437);
+        }
+
+        /// <summary>
+        /// Instances of IfcPort in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPort> Extent(SdaiModel model) { return ExtentRange<IfcPort>(model, 437, false); }
+        static ExtentRange<IfcPort> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPort>(model, 437, true); }
+
+        /// <summary>
+        /// Returns object of IfcPort if the actual type of SdaiInstance is IfcPort or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPort CreateExactEntity(SdaiInstance instance) { return IfcPort(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPort or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPort(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcRelConnectsPortToElement or list of convertible elements
+        template <typename TList> void get_ContainedIn(TList& lst) { RDF_EXPRESS_PROBE(489); SetOfIfcRelConnectsPortToElementSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(489)); }
+
+        //TList may be SetOfIfcRelConnectsPorts or list of convertible elements
+        template <typename TList> void get_ConnectedFrom(TList& lst) { RDF_EXPRESS_PROBE(490); SetOfIfcRelConnectsPortsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(490)); }
+
+        //TList may be SetOfIfcRelConnectsPorts or list of convertible elements
+        template <typename TList> void get_ConnectedTo(TList& lst) { RDF_EXPRESS_PROBE(491); SetOfIfcRelConnectsPortsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(491)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProduct::attr
+        {
+            static constexpr IntValue ContainedIn = 489;
+            static constexpr IntValue ConnectedFrom = 490;
+            static constexpr IntValue ConnectedTo = 491;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPort_CLASS_H
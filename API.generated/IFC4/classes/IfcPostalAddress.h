@@ -0,0 +1,136 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPostalAddress_CLASS_H
+#define __RDF_LTD__IFC4_IfcPostalAddress_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcAddress.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPostalAddress
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPostalAddress : public RDF_EXPRESS_VIRTUAL IfcAddress
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPostalAddress
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPostalAddress(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 438);
+        }
+
+        /// <summary>
+        /// Instances of IfcPostalAddress in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPostalAddress> Extent(SdaiModel model) { return ExtentRange<IfcPostalAddress>(model, 438, false); }
+        static ExtentRange<IfcPostalAddress> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPostalAddress>(model, 438, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPostalAddress and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPostalAddress Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPostalAddress"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPostalAddress if the actual type of SdaiInstance is IfcPostalAddress or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPostalAddress CreateExactEntity(SdaiInstance instance) { return IfcPostalAddress(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPostalAddress or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPostalAddress(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_InternalLocation() { RDF_EXPRESS_PROBE(1013); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1013), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_InternalLocation_view() { return TextView(get_InternalLocation()); }
+#endif
+        void put_InternalLocation(IfcLabel value) { RDF_EXPRESS_PROBE(1013); sdaiPutAttr(m_instance, getAttrDefinition(1013), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_InternalLocation_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1013); return buffer.GetAttr(m_instance, "InternalLocation"); }
+        const char* get_InternalLocation_utf8() { return get_InternalLocation_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void get_AddressLines(TList& lst) { RDF_EXPRESS_PROBE(1014); ListOfIfcLabelSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1014)); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void put_AddressLines(TList& lst) { RDF_EXPRESS_PROBE(1014); ListOfIfcLabelSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1014)); }
+
+        //TArrayElem[] may be IfcLabel[] or array of convertible elements
+        template <typename TArrayElem> void put_AddressLines(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1014); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcLabelSerializer<ListOfIfcLabel> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1014)); }
+
+        IfcLabel get_PostalBox() { RDF_EXPRESS_PROBE(1015); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1015), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_PostalBox_view() { return TextView(get_PostalBox()); }
+#endif
+        void put_PostalBox(IfcLabel value) { RDF_EXPRESS_PROBE(1015); sdaiPutAttr(m_instance, getAttrDefinition(1015), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_PostalBox_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1015); return buffer.GetAttr(m_instance, "PostalBox"); }
+        const char* get_PostalBox_utf8() { return get_PostalBox_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Town() { RDF_EXPRESS_PROBE(1016); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1016), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Town_view() { return TextView(get_Town()); }
+#endif
+        void put_Town(IfcLabel value) { RDF_EXPRESS_PROBE(1016); sdaiPutAttr(m_instance, getAttrDefinition(1016), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Town_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1016); return buffer.GetAttr(m_instance, "Town"); }
+        const char* get_Town_utf8() { return get_Town_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Region() { RDF_EXPRESS_PROBE(1017); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1017), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Region_view() { return TextView(get_Region()); }
+#endif
+        void put_Region(IfcLabel value) { RDF_EXPRESS_PROBE(1017); sdaiPutAttr(m_instance, getAttrDefinition(1017), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Region_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1017); return buffer.GetAttr(m_instance, "Region"); }
+        const char* get_Region_utf8() { return get_Region_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_PostalCode() { RDF_EXPRESS_PROBE(1018); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1018), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_PostalCode_view() { return TextView(get_PostalCode()); }
+#endif
+        void put_PostalCode(IfcLabel value) { RDF_EXPRESS_PROBE(1018); sdaiPutAttr(m_instance, getAttrDefinition(1018), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_PostalCode_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1018); return buffer.GetAttr(m_instance, "PostalCode"); }
+        const char* get_PostalCode_utf8() { return get_PostalCode_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Country() { RDF_EXPRESS_PROBE(1019); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1019), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Country_view() { return TextView(get_Country()); }
+#endif
+        void put_Country(IfcLabel value) { RDF_EXPRESS_PROBE(1019); sdaiPutAttr(m_instance, getAttrDefinition(1019), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Country_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1019); return buffer.GetAttr(m_instance, "Country"); }
+        const char* get_Country_utf8() { return get_Country_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcAddress::attr
+        {
+            static constexpr IntValue InternalLocation = 1013;
+            static constexpr IntValue AddressLines = 1014;
+            static constexpr IntValue PostalBox = 1015;
+            static constexpr IntValue Town = 1016;
+            static constexpr IntValue Region = 1017;
+            static constexpr IntValue PostalCode = 1018;
+            static constexpr IntValue Country = 1019;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPostalAddress_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPreDefinedColour_CLASS_H
+#define __RDF_LTD__IFC4_IfcPreDefinedColour_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPreDefinedColour
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPreDefinedColour : public RDF_EXPRESS_VIRTUAL IfcPreDefinedItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPreDefinedColour
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPreDefinedColour(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 439);
+        }
+
+        /// <summary>
+        /// Instances of IfcPreDefinedColour in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPreDefinedColour> Extent(SdaiModel model) { return ExtentRange<IfcPreDefinedColour>(model, 439, false); }
+        static ExtentRange<IfcPreDefinedColour> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPreDefinedColour>(model, 439, true); }
+
+        /// <summary>
+        /// Returns object of IfcPreDefinedColour if the actual type of SdaiInstance is IfcPreDefinedColour or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPreDefinedColour CreateExactEntity(SdaiInstance instance) { return IfcPreDefinedColour(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPreDefinedColour or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPreDefinedColour(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedItem::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPreDefinedColour_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPreDefinedCurveFont_CLASS_H
+#define __RDF_LTD__IFC4_IfcPreDefinedCurveFont_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPreDefinedCurveFont
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPreDefinedCurveFont : public RDF_EXPRESS_VIRTUAL IfcPreDefinedItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPreDefinedCurveFont
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPreDefinedCurveFont(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 440);
+        }
+
+        /// <summary>
+        /// Instances of IfcPreDefinedCurveFont in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPreDefinedCurveFont> Extent(SdaiModel model) { return ExtentRange<IfcPreDefinedCurveFont>(model, 440, false); }
+        static ExtentRange<IfcPreDefinedCurveFont> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPreDefinedCurveFont>(model, 440, true); }
+
+        /// <summary>
+        /// Returns object of IfcPreDefinedCurveFont if the actual type of SdaiInstance is IfcPreDefinedCurveFont or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPreDefinedCurveFont CreateExactEntity(SdaiInstance instance) { return IfcPreDefinedCurveFont(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPreDefinedCurveFont or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPreDefinedCurveFont(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedItem::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPreDefinedCurveFont_CLASS_H
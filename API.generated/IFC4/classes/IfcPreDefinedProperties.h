@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPreDefinedProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcPreDefinedProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPropertyAbstraction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPreDefinedProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPreDefinedProperties : public RDF_EXPRESS_VIRTUAL IfcPropertyAbstraction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPreDefinedProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPreDefinedProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 442);
+        }
+
+        /// <summary>
+        /// Instances of IfcPreDefinedProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPreDefinedProperties> Extent(SdaiModel model) { return ExtentRange<IfcPreDefinedProperties>(model, 442, false); }
+        static ExtentRange<IfcPreDefinedProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPreDefinedProperties>(model, 442, true); }
+
+        /// <summary>
+        /// Returns object of IfcPreDefinedProperties if the actual type of SdaiInstance is IfcPreDefinedProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPreDefinedProperties CreateExactEntity(SdaiInstance instance) { return IfcPreDefinedProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPreDefinedProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPreDefinedProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPropertyAbstraction::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPreDefinedProperties_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPreDefinedTextFont_CLASS_H
+#define __RDF_LTD__IFC4_IfcPreDefinedTextFont_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPreDefinedTextFont
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPreDefinedTextFont : public RDF_EXPRESS_VIRTUAL IfcPreDefinedItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPreDefinedTextFont
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPreDefinedTextFont(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 444);
+        }
+
+        /// <summary>
+        /// Instances of IfcPreDefinedTextFont in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPreDefinedTextFont> Extent(SdaiModel model) { return ExtentRange<IfcPreDefinedTextFont>(model, 444, false); }
+        static ExtentRange<IfcPreDefinedTextFont> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPreDefinedTextFont>(model, 444, true); }
+
+        /// <summary>
+        /// Returns object of IfcPreDefinedTextFont if the actual type of SdaiInstance is IfcPreDefinedTextFont or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPreDefinedTextFont CreateExactEntity(SdaiInstance instance) { return IfcPreDefinedTextFont(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPreDefinedTextFont or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPreDefinedTextFont(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedItem::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPreDefinedTextFont_CLASS_H
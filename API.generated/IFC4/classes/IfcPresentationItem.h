@@ -0,0 +1,55 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPresentationItem_CLASS_H
+#define __RDF_LTD__IFC4_IfcPresentationItem_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPresentationItem
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPresentationItem : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPresentationItem
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPresentationItem(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 445);
+        }
+
+        /// <summary>
+        /// Instances of IfcPresentationItem in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPresentationItem> Extent(SdaiModel model) { return ExtentRange<IfcPresentationItem>(model, 445, false); }
+        static ExtentRange<IfcPresentationItem> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPresentationItem>(model, 445, true); }
+
+        /// <summary>
+        /// Returns object of IfcPresentationItem if the actual type of SdaiInstance is IfcPresentationItem or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPresentationItem CreateExactEntity(SdaiInstance instance) { return IfcPresentationItem(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPresentationItem or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPresentationItem(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPresentationItem_CLASS_H
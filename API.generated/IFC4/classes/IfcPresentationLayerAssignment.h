@@ -0,0 +1,99 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPresentationLayerAssignment_CLASS_H
+#define __RDF_LTD__IFC4_IfcPresentationLayerAssignment_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPresentationLayerAssignment
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPresentationLayerAssignment : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPresentationLayerAssignment
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPresentationLayerAssignment(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 446);
+        }
+
+        /// <summary>
+        /// Instances of IfcPresentationLayerAssignment in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPresentationLayerAssignment> Extent(SdaiModel model) { return ExtentRange<IfcPresentationLayerAssignment>(model, 446, false); }
+        static ExtentRange<IfcPresentationLayerAssignment> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPresentationLayerAssignment>(model, 446, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPresentationLayerAssignment and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPresentationLayerAssignment Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPresentationLayerAssignment"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPresentationLayerAssignment if the actual type of SdaiInstance is IfcPresentationLayerAssignment or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPresentationLayerAssignment CreateExactEntity(SdaiInstance instance) { return IfcPresentationLayerAssignment(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPresentationLayerAssignment or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPresentationLayerAssignment(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(1020); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1020), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(1020); sdaiPutAttr(m_instance, getAttrDefinition(1020), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1020); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(1021); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1021), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(1021); sdaiPutAttr(m_instance, getAttrDefinition(1021), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1021); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcLayeredItem or list of convertible elements
+        template <typename TList> void get_AssignedItems(TList& lst) { RDF_EXPRESS_PROBE(1022); SetOfIfcLayeredItemSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1022)); }
+
+        //TList may be SetOfIfcLayeredItem or list of convertible elements
+        template <typename TList> void put_AssignedItems(TList& lst) { RDF_EXPRESS_PROBE(1022); SetOfIfcLayeredItemSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1022)); }
+
+        IfcIdentifier get_Identifier() { RDF_EXPRESS_PROBE(1023); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1023), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Identifier_view() { return TextView(get_Identifier()); }
+#endif
+        void put_Identifier(IfcIdentifier value) { RDF_EXPRESS_PROBE(1023); sdaiPutAttr(m_instance, getAttrDefinition(1023), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Identifier_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1023); return buffer.GetAttr(m_instance, "Identifier"); }
+        const char* get_Identifier_utf8() { return get_Identifier_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Name = 1020;
+            static constexpr IntValue Description = 1021;
+            static constexpr IntValue AssignedItems = 1022;
+            static constexpr IntValue Identifier = 1023;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPresentationLayerAssignment_CLASS_H
@@ -0,0 +1,82 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPresentationLayerWithStyle_CLASS_H
+#define __RDF_LTD__IFC4_IfcPresentationLayerWithStyle_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationLayerAssignment.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPresentationLayerWithStyle
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPresentationLayerWithStyle : public RDF_EXPRESS_VIRTUAL IfcPresentationLayerAssignment
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPresentationLayerWithStyle
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPresentationLayerWithStyle(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 447);
+        }
+
+        /// <summary>
+        /// Instances of IfcPresentationLayerWithStyle in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPresentationLayerWithStyle> Extent(SdaiModel model) { return ExtentRange<IfcPresentationLayerWithStyle>(model, 447, false); }
+        static ExtentRange<IfcPresentationLayerWithStyle> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPresentationLayerWithStyle>(model, 447, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPresentationLayerWithStyle and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPresentationLayerWithStyle Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPresentationLayerWithStyle"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPresentationLayerWithStyle if the actual type of SdaiInstance is IfcPresentationLayerWithStyle or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPresentationLayerWithStyle CreateExactEntity(SdaiInstance instance) { return IfcPresentationLayerWithStyle(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPresentationLayerWithStyle or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPresentationLayerWithStyle(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLogical> get_LayerOn() { RDF_EXPRESS_PROBE(1024); int v = getENUM(1024, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_LayerOn(IfcLogical value) { RDF_EXPRESS_PROBE(1024); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1024), sdaiENUM, val); }
+
+        Nullable<IfcLogical> get_LayerFrozen() { RDF_EXPRESS_PROBE(1025); int v = getENUM(1025, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_LayerFrozen(IfcLogical value) { RDF_EXPRESS_PROBE(1025); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1025), sdaiENUM, val); }
+
+        Nullable<IfcLogical> get_LayerBlocked() { RDF_EXPRESS_PROBE(1026); int v = getENUM(1026, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_LayerBlocked(IfcLogical value) { RDF_EXPRESS_PROBE(1026); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1026), sdaiENUM, val); }
+
+        //TList may be SetOfIfcPresentationStyle or list of convertible elements
+        template <typename TList> void get_LayerStyles(TList& lst) { RDF_EXPRESS_PROBE(1027); SetOfIfcPresentationStyleSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1027)); }
+
+        //TList may be SetOfIfcPresentationStyle or list of convertible elements
+        template <typename TList> void put_LayerStyles(TList& lst) { RDF_EXPRESS_PROBE(1027); SetOfIfcPresentationStyleSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1027)); }
+
+        //TArrayElem[] may be IfcPresentationStyle[] or array of convertible elements
+        template <typename TArrayElem> void put_LayerStyles(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1027); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcPresentationStyleSerializer<SetOfIfcPresentationStyle> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1027)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationLayerAssignment::attr
+        {
+            static constexpr IntValue LayerOn = 1024;
+            static constexpr IntValue LayerFrozen = 1025;
+            static constexpr IntValue LayerBlocked = 1026;
+            static constexpr IntValue LayerStyles = 1027;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPresentationLayerWithStyle_CLASS_H
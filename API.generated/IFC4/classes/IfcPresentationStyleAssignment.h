@@ -0,0 +1,66 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPresentationStyleAssignment_CLASS_H
+#define __RDF_LTD__IFC4_IfcPresentationStyleAssignment_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPresentationStyleAssignment
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPresentationStyleAssignment : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPresentationStyleAssignment
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPresentationStyleAssignment(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 449);
+        }
+
+        /// <summary>
+        /// Instances of IfcPresentationStyleAssignment in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPresentationStyleAssignment> Extent(SdaiModel model) { return ExtentRange<IfcPresentationStyleAssignment>(model, 449, false); }
+        static ExtentRange<IfcPresentationStyleAssignment> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPresentationStyleAssignment>(model, 449, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPresentationStyleAssignment and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPresentationStyleAssignment Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPresentationStyleAssignment"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPresentationStyleAssignment if the actual type of SdaiInstance is IfcPresentationStyleAssignment or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPresentationStyleAssignment CreateExactEntity(SdaiInstance instance) { return IfcPresentationStyleAssignment(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPresentationStyleAssignment or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPresentationStyleAssignment(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcPresentationStyleSelect or list of convertible elements
+        template <typename TList> void get_Styles(TList& lst) { RDF_EXPRESS_PROBE(1028); SetOfIfcPresentationStyleSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1028)); }
+
+        //TList may be SetOfIfcPresentationStyleSelect or list of convertible elements
+        template <typename TList> void put_Styles(TList& lst) { RDF_EXPRESS_PROBE(1028); SetOfIfcPresentationStyleSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1028)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Styles = 1028;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPresentationStyleAssignment_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProcedure_CLASS_H
+#define __RDF_LTD__IFC4_IfcProcedure_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProcess.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProcedure
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProcedure : public RDF_EXPRESS_VIRTUAL IfcProcess
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProcedure
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProcedure(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 450);
+        }
+
+        /// <summary>
+        /// Instances of IfcProcedure in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProcedure> Extent(SdaiModel model) { return ExtentRange<IfcProcedure>(model, 450, false); }
+        static ExtentRange<IfcProcedure> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProcedure>(model, 450, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProcedure and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProcedure Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProcedure"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProcedure if the actual type of SdaiInstance is IfcProcedure or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProcedure CreateExactEntity(SdaiInstance instance) { return IfcProcedure(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProcedure or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProcedure(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcProcedureTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1029); int v = getENUM(1029, IfcProcedureTypeEnum_hash); if (v >= 0) return (IfcProcedureTypeEnum) v; else return Nullable<IfcProcedureTypeEnum>(); }
+        void put_PredefinedType(IfcProcedureTypeEnum value) { RDF_EXPRESS_PROBE(1029); TextValue val = IfcProcedureTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1029), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProcess::attr
+        {
+            static constexpr IntValue PredefinedType = 1029;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProcedure_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProcedureType_CLASS_H
+#define __RDF_LTD__IFC4_IfcProcedureType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTypeProcess.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProcedureType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProcedureType : public RDF_EXPRESS_VIRTUAL IfcTypeProcess
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProcedureType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProcedureType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 451);
+        }
+
+        /// <summary>
+        /// Instances of IfcProcedureType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProcedureType> Extent(SdaiModel model) { return ExtentRange<IfcProcedureType>(model, 451, false); }
+        static ExtentRange<IfcProcedureType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProcedureType>(model, 451, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProcedureType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProcedureType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProcedureType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProcedureType if the actual type of SdaiInstance is IfcProcedureType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProcedureType CreateExactEntity(SdaiInstance instance) { return IfcProcedureType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProcedureType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProcedureType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcProcedureTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1030); int v = getENUM(1030, IfcProcedureTypeEnum_hash); if (v >= 0) return (IfcProcedureTypeEnum) v; else return Nullable<IfcProcedureTypeEnum>(); }
+        void put_PredefinedType(IfcProcedureTypeEnum value) { RDF_EXPRESS_PROBE(1030); TextValue val = IfcProcedureTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1030), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTypeProcess::attr
+        {
+            static constexpr IntValue PredefinedType = 1030;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProcedureType_CLASS_H
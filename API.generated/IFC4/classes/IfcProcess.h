@@ -0,0 +1,90 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProcess_CLASS_H
+#define __RDF_LTD__IFC4_IfcProcess_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcObject.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProcess
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProcess : public RDF_EXPRESS_VIRTUAL IfcObject
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProcess
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProcess(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 452);
+        }
+
+        /// <summary>
+        /// Instances of IfcProcess in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProcess> Extent(SdaiModel model) { return ExtentRange<IfcProcess>(model, 452, false); }
+        static ExtentRange<IfcProcess> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProcess>(model, 452, true); }
+
+        /// <summary>
+        /// Returns object of IfcProcess if the actual type of SdaiInstance is IfcProcess or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProcess CreateExactEntity(SdaiInstance instance) { return IfcProcess(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProcess or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProcess(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Identification() { RDF_EXPRESS_PROBE(596); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(596), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Identification_view() { return TextView(get_Identification()); }
+#endif
+        void put_Identification(IfcIdentifier value) { RDF_EXPRESS_PROBE(596); sdaiPutAttr(m_instance, getAttrDefinition(596), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Identification_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(596); return buffer.GetAttr(m_instance, "Identification"); }
+        const char* get_Identification_utf8() { return get_Identification_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_LongDescription() { RDF_EXPRESS_PROBE(597); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(597), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LongDescription_view() { return TextView(get_LongDescription()); }
+#endif
+        void put_LongDescription(IfcText value) { RDF_EXPRESS_PROBE(597); sdaiPutAttr(m_instance, getAttrDefinition(597), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LongDescription_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(597); return buffer.GetAttr(m_instance, "LongDescription"); }
+        const char* get_LongDescription_utf8() { return get_LongDescription_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRelSequence or list of convertible elements
+        template <typename TList> void get_IsPredecessorTo(TList& lst) { RDF_EXPRESS_PROBE(598); SetOfIfcRelSequenceSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(598)); }
+
+        //TList may be SetOfIfcRelSequence or list of convertible elements
+        template <typename TList> void get_IsSuccessorFrom(TList& lst) { RDF_EXPRESS_PROBE(599); SetOfIfcRelSequenceSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(599)); }
+
+        //TList may be SetOfIfcRelAssignsToProcess or list of convertible elements
+        template <typename TList> void get_OperatesOn(TList& lst) { RDF_EXPRESS_PROBE(600); SetOfIfcRelAssignsToProcessSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(600)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcObject::attr
+        {
+            static constexpr IntValue Identification = 596;
+            static constexpr IntValue LongDescription = 597;
+            static constexpr IntValue IsPredecessorTo = 598;
+            static constexpr IntValue IsSuccessorFrom = 599;
+            static constexpr IntValue OperatesOn = 600;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProcess_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProduct_CLASS_H
+#define __RDF_LTD__IFC4_IfcProduct_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcObject.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProduct
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProduct : public RDF_EXPRESS_VIRTUAL IfcObject
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProduct
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProduct(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 453);
+        }
+
+        /// <summary>
+        /// Instances of IfcProduct in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProduct> Extent(SdaiModel model) { return ExtentRange<IfcProduct>(model, 453, false); }
+        static ExtentRange<IfcProduct> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProduct>(model, 453, true); }
+
+        /// <summary>
+        /// Returns object of IfcProduct if the actual type of SdaiInstance is IfcProduct or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProduct CreateExactEntity(SdaiInstance instance) { return IfcProduct(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProduct or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProduct(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcObjectPlacement get_ObjectPlacement();
+        void put_ObjectPlacement(IfcObjectPlacement inst);
+
+        IfcProductRepresentation get_Representation();
+        void put_Representation(IfcProductRepresentation inst);
+
+        //TList may be SetOfIfcRelAssignsToProduct or list of convertible elements
+        template <typename TList> void get_ReferencedBy(TList& lst) { RDF_EXPRESS_PROBE(29); SetOfIfcRelAssignsToProductSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(29)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcObject::attr
+        {
+            static constexpr IntValue ObjectPlacement = 27;
+            static constexpr IntValue Representation = 28;
+            static constexpr IntValue ReferencedBy = 29;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProduct_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProductDefinitionShape_CLASS_H
+#define __RDF_LTD__IFC4_IfcProductDefinitionShape_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProductRepresentation.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProductDefinitionShape
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProductDefinitionShape : public RDF_EXPRESS_VIRTUAL IfcProductRepresentation
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProductDefinitionShape
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProductDefinitionShape(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 454);
+        }
+
+        /// <summary>
+        /// Instances of IfcProductDefinitionShape in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProductDefinitionShape> Extent(SdaiModel model) { return ExtentRange<IfcProductDefinitionShape>(model, 454, false); }
+        static ExtentRange<IfcProductDefinitionShape> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProductDefinitionShape>(model, 454, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProductDefinitionShape and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProductDefinitionShape Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProductDefinitionShape"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProductDefinitionShape if the actual type of SdaiInstance is IfcProductDefinitionShape or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProductDefinitionShape CreateExactEntity(SdaiInstance instance) { return IfcProductDefinitionShape(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProductDefinitionShape or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProductDefinitionShape(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcProduct or list of convertible elements
+        template <typename TList> void get_ShapeOfProduct(TList& lst) { RDF_EXPRESS_PROBE(1031); SetOfIfcProductSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1031)); }
+
+        //TList may be SetOfIfcShapeAspect or list of convertible elements
+        template <typename TList> void get_HasShapeAspects(TList& lst) { RDF_EXPRESS_PROBE(1032); SetOfIfcShapeAspectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1032)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProductRepresentation::attr
+        {
+            static constexpr IntValue ShapeOfProduct = 1031;
+            static constexpr IntValue HasShapeAspects = 1032;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProductDefinitionShape_CLASS_H
@@ -0,0 +1,87 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProductRepresentation_CLASS_H
+#define __RDF_LTD__IFC4_IfcProductRepresentation_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProductRepresentation
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProductRepresentation : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProductRepresentation
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProductRepresentation(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 455);
+        }
+
+        /// <summary>
+        /// Instances of IfcProductRepresentation in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProductRepresentation> Extent(SdaiModel model) { return ExtentRange<IfcProductRepresentation>(model, 455, false); }
+        static ExtentRange<IfcProductRepresentation> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProductRepresentation>(model, 455, true); }
+
+        /// <summary>
+        /// Returns object of IfcProductRepresentation if the actual type of SdaiInstance is IfcProductRepresentation or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProductRepresentation CreateExactEntity(SdaiInstance instance) { return IfcProductRepresentation(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProductRepresentation or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProductRepresentation(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(844); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(844), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(844); sdaiPutAttr(m_instance, getAttrDefinition(844), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(844); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(845); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(845), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(845); sdaiPutAttr(m_instance, getAttrDefinition(845), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(845); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcRepresentation or list of convertible elements
+        template <typename TList> void get_Representations(TList& lst) { RDF_EXPRESS_PROBE(846); ListOfIfcRepresentationSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(846)); }
+
+        //TList may be ListOfIfcRepresentation or list of convertible elements
+        template <typename TList> void put_Representations(TList& lst) { RDF_EXPRESS_PROBE(846); ListOfIfcRepresentationSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(846)); }
+
+        //TArrayElem[] may be IfcRepresentation[] or array of convertible elements
+        template <typename TArrayElem> void put_Representations(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(846); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcRepresentationSerializer<ListOfIfcRepresentation> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(846)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Name = 844;
+            static constexpr IntValue Description = 845;
+            static constexpr IntValue Representations = 846;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProductRepresentation_CLASS_H
@@ -0,0 +1,82 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProfileDef : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 456);
+        }
+
+        /// <summary>
+        /// Instances of IfcProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcProfileDef>(model, 456, false); }
+        static ExtentRange<IfcProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProfileDef>(model, 456, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProfileDef if the actual type of SdaiInstance is IfcProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProfileDef CreateExactEntity(SdaiInstance instance) { return IfcProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcProfileTypeEnum> get_ProfileType() { RDF_EXPRESS_PROBE(113); int v = getENUM(113, IfcProfileTypeEnum_hash); if (v >= 0) return (IfcProfileTypeEnum) v; else return Nullable<IfcProfileTypeEnum>(); }
+        void put_ProfileType(IfcProfileTypeEnum value) { RDF_EXPRESS_PROBE(113); TextValue val = IfcProfileTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(113), sdaiENUM, val); }
+
+        IfcLabel get_ProfileName() { RDF_EXPRESS_PROBE(114); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(114), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ProfileName_view() { return TextView(get_ProfileName()); }
+#endif
+        void put_ProfileName(IfcLabel value) { RDF_EXPRESS_PROBE(114); sdaiPutAttr(m_instance, getAttrDefinition(114), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ProfileName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(114); return buffer.GetAttr(m_instance, "ProfileName"); }
+        const char* get_ProfileName_utf8() { return get_ProfileName_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcExternalReferenceRelationship or list of convertible elements
+        template <typename TList> void get_HasExternalReference(TList& lst) { RDF_EXPRESS_PROBE(115); SetOfIfcExternalReferenceRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(115)); }
+
+        //TList may be SetOfIfcProfileProperties or list of convertible elements
+        template <typename TList> void get_HasProperties(TList& lst) { RDF_EXPRESS_PROBE(116); SetOfIfcProfilePropertiesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(116)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue ProfileType = 113;
+            static constexpr IntValue ProfileName = 114;
+            static constexpr IntValue HasExternalReference = 115;
+            static constexpr IntValue HasProperties = 116;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProfileDef_CLASS_H
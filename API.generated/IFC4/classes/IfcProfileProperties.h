@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProfileProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcProfileProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcExtendedProperties.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProfileProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProfileProperties : public RDF_EXPRESS_VIRTUAL IfcExtendedProperties
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProfileProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProfileProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 457);
+        }
+
+        /// <summary>
+        /// Instances of IfcProfileProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProfileProperties> Extent(SdaiModel model) { return ExtentRange<IfcProfileProperties>(model, 457, false); }
+        static ExtentRange<IfcProfileProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProfileProperties>(model, 457, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProfileProperties and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProfileProperties Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProfileProperties"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProfileProperties if the actual type of SdaiInstance is IfcProfileProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProfileProperties CreateExactEntity(SdaiInstance instance) { return IfcProfileProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProfileProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProfileProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcProfileDef get_ProfileDefinition();
+        void put_ProfileDefinition(IfcProfileDef inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcExtendedProperties::attr
+        {
+            static constexpr IntValue ProfileDefinition = 1033;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProfileProperties_CLASS_H
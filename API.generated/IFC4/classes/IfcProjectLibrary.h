@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProjectLibrary_CLASS_H
+#define __RDF_LTD__IFC4_IfcProjectLibrary_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcContext.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProjectLibrary
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProjectLibrary : public RDF_EXPRESS_VIRTUAL IfcContext
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProjectLibrary
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProjectLibrary(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 461);
+        }
+
+        /// <summary>
+        /// Instances of IfcProjectLibrary in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProjectLibrary> Extent(SdaiModel model) { return ExtentRange<IfcProjectLibrary>(model, 461, false); }
+        static ExtentRange<IfcProjectLibrary> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProjectLibrary>(model, 461, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProjectLibrary and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProjectLibrary Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProjectLibrary"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProjectLibrary if the actual type of SdaiInstance is IfcProjectLibrary or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProjectLibrary CreateExactEntity(SdaiInstance instance) { return IfcProjectLibrary(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProjectLibrary or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProjectLibrary(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcContext::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProjectLibrary_CLASS_H
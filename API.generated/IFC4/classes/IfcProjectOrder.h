@@ -0,0 +1,86 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProjectOrder_CLASS_H
+#define __RDF_LTD__IFC4_IfcProjectOrder_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcControl.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProjectOrder
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProjectOrder : public RDF_EXPRESS_VIRTUAL IfcControl
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProjectOrder
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProjectOrder(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 462);
+        }
+
+        /// <summary>
+        /// Instances of IfcProjectOrder in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProjectOrder> Extent(SdaiModel model) { return ExtentRange<IfcProjectOrder>(model, 462, false); }
+        static ExtentRange<IfcProjectOrder> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProjectOrder>(model, 462, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProjectOrder and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProjectOrder Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProjectOrder"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProjectOrder if the actual type of SdaiInstance is IfcProjectOrder or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProjectOrder CreateExactEntity(SdaiInstance instance) { return IfcProjectOrder(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProjectOrder or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProjectOrder(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcProjectOrderTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1038); int v = getENUM(1038, IfcProjectOrderTypeEnum_hash); if (v >= 0) return (IfcProjectOrderTypeEnum) v; else return Nullable<IfcProjectOrderTypeEnum>(); }
+        void put_PredefinedType(IfcProjectOrderTypeEnum value) { RDF_EXPRESS_PROBE(1038); TextValue val = IfcProjectOrderTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1038), sdaiENUM, val); }
+
+        IfcLabel get_Status() { RDF_EXPRESS_PROBE(1039); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1039), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Status_view() { return TextView(get_Status()); }
+#endif
+        void put_Status(IfcLabel value) { RDF_EXPRESS_PROBE(1039); sdaiPutAttr(m_instance, getAttrDefinition(1039), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Status_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1039); return buffer.GetAttr(m_instance, "Status"); }
+        const char* get_Status_utf8() { return get_Status_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_LongDescription() { RDF_EXPRESS_PROBE(1040); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1040), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LongDescription_view() { return TextView(get_LongDescription()); }
+#endif
+        void put_LongDescription(IfcText value) { RDF_EXPRESS_PROBE(1040); sdaiPutAttr(m_instance, getAttrDefinition(1040), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LongDescription_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1040); return buffer.GetAttr(m_instance, "LongDescription"); }
+        const char* get_LongDescription_utf8() { return get_LongDescription_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcControl::attr
+        {
+            static constexpr IntValue PredefinedType = 1038;
+            static constexpr IntValue Status = 1039;
+            static constexpr IntValue LongDescription = 1040;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProjectOrder_CLASS_H
@@ -0,0 +1,86 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProjectedCRS_CLASS_H
+#define __RDF_LTD__IFC4_IfcProjectedCRS_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCoordinateReferenceSystem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProjectedCRS
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProjectedCRS : public RDF_EXPRESS_VIRTUAL IfcCoordinateReferenceSystem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProjectedCRS
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProjectedCRS(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 459);
+        }
+
+        /// <summary>
+        /// Instances of IfcProjectedCRS in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProjectedCRS> Extent(SdaiModel model) { return ExtentRange<IfcProjectedCRS>(model, 459, false); }
+        static ExtentRange<IfcProjectedCRS> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProjectedCRS>(model, 459, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProjectedCRS and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProjectedCRS Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProjectedCRS"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProjectedCRS if the actual type of SdaiInstance is IfcProjectedCRS or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProjectedCRS CreateExactEntity(SdaiInstance instance) { return IfcProjectedCRS(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProjectedCRS or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProjectedCRS(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_MapProjection() { RDF_EXPRESS_PROBE(1034); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1034), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_MapProjection_view() { return TextView(get_MapProjection()); }
+#endif
+        void put_MapProjection(IfcIdentifier value) { RDF_EXPRESS_PROBE(1034); sdaiPutAttr(m_instance, getAttrDefinition(1034), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_MapProjection_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1034); return buffer.GetAttr(m_instance, "MapProjection"); }
+        const char* get_MapProjection_utf8() { return get_MapProjection_utf8(ThreadUtf8Buffer()); }
+
+        IfcIdentifier get_MapZone() { RDF_EXPRESS_PROBE(1035); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1035), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_MapZone_view() { return TextView(get_MapZone()); }
+#endif
+        void put_MapZone(IfcIdentifier value) { RDF_EXPRESS_PROBE(1035); sdaiPutAttr(m_instance, getAttrDefinition(1035), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_MapZone_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1035); return buffer.GetAttr(m_instance, "MapZone"); }
+        const char* get_MapZone_utf8() { return get_MapZone_utf8(ThreadUtf8Buffer()); }
+
+        IfcNamedUnit get_MapUnit();
+        void put_MapUnit(IfcNamedUnit inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCoordinateReferenceSystem::attr
+        {
+            static constexpr IntValue MapProjection = 1034;
+            static constexpr IntValue MapZone = 1035;
+            static constexpr IntValue MapUnit = 1036;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProjectedCRS_CLASS_H
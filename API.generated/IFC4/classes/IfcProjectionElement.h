@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProjectionElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcProjectionElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFeatureElementAddition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProjectionElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProjectionElement : public RDF_EXPRESS_VIRTUAL IfcFeatureElementAddition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProjectionElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProjectionElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 460);
+        }
+
+        /// <summary>
+        /// Instances of IfcProjectionElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProjectionElement> Extent(SdaiModel model) { return ExtentRange<IfcProjectionElement>(model, 460, false); }
+        static ExtentRange<IfcProjectionElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProjectionElement>(model, 460, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProjectionElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProjectionElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProjectionElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProjectionElement if the actual type of SdaiInstance is IfcProjectionElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProjectionElement CreateExactEntity(SdaiInstance instance) { return IfcProjectionElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProjectionElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProjectionElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcProjectionElementTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1037); int v = getENUM(1037, IfcProjectionElementTypeEnum_hash); if (v >= 0) return (IfcProjectionElementTypeEnum) v; else return Nullable<IfcProjectionElementTypeEnum>(); }
+        void put_PredefinedType(IfcProjectionElementTypeEnum value) { RDF_EXPRESS_PROBE(1037); TextValue val = IfcProjectionElementTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1037), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFeatureElementAddition::attr
+        {
+            static constexpr IntValue PredefinedType = 1037;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProjectionElement_CLASS_H
@@ -0,0 +1,102 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProperty_CLASS_H
+#define __RDF_LTD__IFC4_IfcProperty_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPropertyAbstraction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProperty
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProperty : public RDF_EXPRESS_VIRTUAL IfcPropertyAbstraction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProperty
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProperty(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 463);
+        }
+
+        /// <summary>
+        /// Instances of IfcProperty in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProperty> Extent(SdaiModel model) { return ExtentRange<IfcProperty>(model, 463, false); }
+        static ExtentRange<IfcProperty> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProperty>(model, 463, true); }
+
+        /// <summary>
+        /// Returns object of IfcProperty if the actual type of SdaiInstance is IfcProperty or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProperty CreateExactEntity(SdaiInstance instance) { return IfcProperty(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProperty or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProperty(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Name() { RDF_EXPRESS_PROBE(323); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(323), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcIdentifier value) { RDF_EXPRESS_PROBE(323); sdaiPutAttr(m_instance, getAttrDefinition(323), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(323); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(324); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(324), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(324); sdaiPutAttr(m_instance, getAttrDefinition(324), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(324); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcPropertySet or list of convertible elements
+        template <typename TList> void get_PartOfPset(TList& lst) { RDF_EXPRESS_PROBE(325); SetOfIfcPropertySetSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(325)); }
+
+        //TList may be SetOfIfcPropertyDependencyRelationship or list of convertible elements
+        template <typename TList> void get_PropertyForDependance(TList& lst) { RDF_EXPRESS_PROBE(326); SetOfIfcPropertyDependencyRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(326)); }
+
+        //TList may be SetOfIfcPropertyDependencyRelationship or list of convertible elements
+        template <typename TList> void get_PropertyDependsOn(TList& lst) { RDF_EXPRESS_PROBE(327); SetOfIfcPropertyDependencyRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(327)); }
+
+        //TList may be SetOfIfcComplexProperty or list of convertible elements
+        template <typename TList> void get_PartOfComplex(TList& lst) { RDF_EXPRESS_PROBE(328); SetOfIfcComplexPropertySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(328)); }
+
+        //TList may be SetOfIfcResourceConstraintRelationship or list of convertible elements
+        template <typename TList> void get_HasConstraints(TList& lst) { RDF_EXPRESS_PROBE(329); SetOfIfcResourceConstraintRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(329)); }
+
+        //TList may be SetOfIfcResourceApprovalRelationship or list of convertible elements
+        template <typename TList> void get_HasApprovals(TList& lst) { RDF_EXPRESS_PROBE(330); SetOfIfcResourceApprovalRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(330)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPropertyAbstraction::attr
+        {
+            static constexpr IntValue Name = 323;
+            static constexpr IntValue Description = 324;
+            static constexpr IntValue PartOfPset = 325;
+            static constexpr IntValue PropertyForDependance = 326;
+            static constexpr IntValue PropertyDependsOn = 327;
+            static constexpr IntValue PartOfComplex = 328;
+            static constexpr IntValue HasConstraints = 329;
+            static constexpr IntValue HasApprovals = 330;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProperty_CLASS_H
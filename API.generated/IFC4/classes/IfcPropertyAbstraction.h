@@ -0,0 +1,59 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyAbstraction_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertyAbstraction_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertyAbstraction
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertyAbstraction : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertyAbstraction
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertyAbstraction(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 464);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertyAbstraction in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertyAbstraction> Extent(SdaiModel model) { return ExtentRange<IfcPropertyAbstraction>(model, 464, false); }
+        static ExtentRange<IfcPropertyAbstraction> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertyAbstraction>(model, 464, true); }
+
+        /// <summary>
+        /// Returns object of IfcPropertyAbstraction if the actual type of SdaiInstance is IfcPropertyAbstraction or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertyAbstraction CreateExactEntity(SdaiInstance instance) { return IfcPropertyAbstraction(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertyAbstraction or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertyAbstraction(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcExternalReferenceRelationship or list of convertible elements
+        template <typename TList> void get_HasExternalReferences(TList& lst) { RDF_EXPRESS_PROBE(322); SetOfIfcExternalReferenceRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(322)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue HasExternalReferences = 322;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyAbstraction_CLASS_H
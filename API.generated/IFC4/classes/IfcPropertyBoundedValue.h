@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyBoundedValue_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertyBoundedValue_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSimpleProperty.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertyBoundedValue
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertyBoundedValue : public RDF_EXPRESS_VIRTUAL IfcSimpleProperty
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertyBoundedValue
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertyBoundedValue(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 465);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertyBoundedValue in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertyBoundedValue> Extent(SdaiModel model) { return ExtentRange<IfcPropertyBoundedValue>(model, 465, false); }
+        static ExtentRange<IfcPropertyBoundedValue> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertyBoundedValue>(model, 465, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPropertyBoundedValue and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPropertyBoundedValue Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPropertyBoundedValue"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPropertyBoundedValue if the actual type of SdaiInstance is IfcPropertyBoundedValue or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertyBoundedValue CreateExactEntity(SdaiInstance instance) { return IfcPropertyBoundedValue(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertyBoundedValue or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertyBoundedValue(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcValue_get get_UpperBoundValue() { return IfcValue_get(m_instance, 1041); }
+        IfcValue_put put_UpperBoundValue() { return IfcValue_put(m_instance, 1041); }
+
+        IfcValue_get get_LowerBoundValue() { return IfcValue_get(m_instance, 1042); }
+        IfcValue_put put_LowerBoundValue() { return IfcValue_put(m_instance, 1042); }
+
+        IfcUnit_get get_Unit() { return IfcUnit_get(m_instance, 1043); }
+        IfcUnit_put put_Unit() { return IfcUnit_put(m_instance, 1043); }
+
+        IfcValue_get get_SetPointValue() { return IfcValue_get(m_instance, 1044); }
+        IfcValue_put put_SetPointValue() { return IfcValue_put(m_instance, 1044); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSimpleProperty::attr
+        {
+            static constexpr IntValue UpperBoundValue = 1041;
+            static constexpr IntValue LowerBoundValue = 1042;
+            static constexpr IntValue Unit = 1043;
+            static constexpr IntValue SetPointValue = 1044;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyBoundedValue_CLASS_H
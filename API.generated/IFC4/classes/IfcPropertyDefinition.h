@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyDefinition_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertyDefinition_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRoot.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertyDefinition
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertyDefinition : public RDF_EXPRESS_VIRTUAL IfcRoot
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertyDefinition
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertyDefinition(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 466);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertyDefinition in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertyDefinition> Extent(SdaiModel model) { return ExtentRange<IfcPropertyDefinition>(model, 466, false); }
+        static ExtentRange<IfcPropertyDefinition> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertyDefinition>(model, 466, true); }
+
+        /// <summary>
+        /// Returns object of IfcPropertyDefinition if the actual type of SdaiInstance is IfcPropertyDefinition or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertyDefinition CreateExactEntity(SdaiInstance instance) { return IfcPropertyDefinition(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertyDefinition or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertyDefinition(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcRelDeclares or list of convertible elements
+        template <typename TList> void get_HasContext(TList& lst) { RDF_EXPRESS_PROBE(333); SetOfIfcRelDeclaresSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(333)); }
+
+        //TList may be SetOfIfcRelAssociates or list of convertible elements
+        template <typename TList> void get_HasAssociations(TList& lst) { RDF_EXPRESS_PROBE(334); SetOfIfcRelAssociatesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(334)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRoot::attr
+        {
+            static constexpr IntValue HasContext = 333;
+            static constexpr IntValue HasAssociations = 334;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyDefinition_CLASS_H
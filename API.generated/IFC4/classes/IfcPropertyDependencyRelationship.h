@@ -0,0 +1,79 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyDependencyRelationship_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertyDependencyRelationship_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcResourceLevelRelationship.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertyDependencyRelationship
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertyDependencyRelationship : public RDF_EXPRESS_VIRTUAL IfcResourceLevelRelationship
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertyDependencyRelationship
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertyDependencyRelationship(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 467);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertyDependencyRelationship in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertyDependencyRelationship> Extent(SdaiModel model) { return ExtentRange<IfcPropertyDependencyRelationship>(model, 467, false); }
+        static ExtentRange<IfcPropertyDependencyRelationship> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertyDependencyRelationship>(model, 467, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPropertyDependencyRelationship and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPropertyDependencyRelationship Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPropertyDependencyRelationship"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPropertyDependencyRelationship if the actual type of SdaiInstance is IfcPropertyDependencyRelationship or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertyDependencyRelationship CreateExactEntity(SdaiInstance instance) { return IfcPropertyDependencyRelationship(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertyDependencyRelationship or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertyDependencyRelationship(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcProperty get_DependingProperty();
+        void put_DependingProperty(IfcProperty inst);
+
+        IfcProperty get_DependantProperty();
+        void put_DependantProperty(IfcProperty inst);
+
+        IfcText get_Expression() { RDF_EXPRESS_PROBE(1047); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1047), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Expression_view() { return TextView(get_Expression()); }
+#endif
+        void put_Expression(IfcText value) { RDF_EXPRESS_PROBE(1047); sdaiPutAttr(m_instance, getAttrDefinition(1047), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Expression_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1047); return buffer.GetAttr(m_instance, "Expression"); }
+        const char* get_Expression_utf8() { return get_Expression_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcResourceLevelRelationship::attr
+        {
+            static constexpr IntValue DependingProperty = 1045;
+            static constexpr IntValue DependantProperty = 1046;
+            static constexpr IntValue Expression = 1047;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyDependencyRelationship_CLASS_H
@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyEnumeratedValue_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertyEnumeratedValue_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSimpleProperty.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertyEnumeratedValue
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertyEnumeratedValue : public RDF_EXPRESS_VIRTUAL IfcSimpleProperty
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertyEnumeratedValue
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertyEnumeratedValue(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 468);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertyEnumeratedValue in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertyEnumeratedValue> Extent(SdaiModel model) { return ExtentRange<IfcPropertyEnumeratedValue>(model, 468, false); }
+        static ExtentRange<IfcPropertyEnumeratedValue> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertyEnumeratedValue>(model, 468, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPropertyEnumeratedValue and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPropertyEnumeratedValue Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPropertyEnumeratedValue"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPropertyEnumeratedValue if the actual type of SdaiInstance is IfcPropertyEnumeratedValue or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertyEnumeratedValue CreateExactEntity(SdaiInstance instance) { return IfcPropertyEnumeratedValue(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertyEnumeratedValue or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertyEnumeratedValue(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void get_EnumerationValues(TList& lst) { RDF_EXPRESS_PROBE(1048); ListOfIfcValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1048)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void put_EnumerationValues(TList& lst) { RDF_EXPRESS_PROBE(1048); ListOfIfcValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1048)); }
+
+        IfcPropertyEnumeration get_EnumerationReference();
+        void put_EnumerationReference(IfcPropertyEnumeration inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSimpleProperty::attr
+        {
+            static constexpr IntValue EnumerationValues = 1048;
+            static constexpr IntValue EnumerationReference = 1049;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyEnumeratedValue_CLASS_H
@@ -0,0 +1,82 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyEnumeration_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertyEnumeration_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPropertyAbstraction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertyEnumeration
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertyEnumeration : public RDF_EXPRESS_VIRTUAL IfcPropertyAbstraction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertyEnumeration
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertyEnumeration(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 469);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertyEnumeration in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertyEnumeration> Extent(SdaiModel model) { return ExtentRange<IfcPropertyEnumeration>(model, 469, false); }
+        static ExtentRange<IfcPropertyEnumeration> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertyEnumeration>(model, 469, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPropertyEnumeration and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPropertyEnumeration Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPropertyEnumeration"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPropertyEnumeration if the actual type of SdaiInstance is IfcPropertyEnumeration or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertyEnumeration CreateExactEntity(SdaiInstance instance) { return IfcPropertyEnumeration(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertyEnumeration or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertyEnumeration(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(1050); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1050), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(1050); sdaiPutAttr(m_instance, getAttrDefinition(1050), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1050); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void get_EnumerationValues(TList& lst) { RDF_EXPRESS_PROBE(1051); ListOfIfcValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1051)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void put_EnumerationValues(TList& lst) { RDF_EXPRESS_PROBE(1051); ListOfIfcValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1051)); }
+
+        IfcUnit_get get_Unit() { return IfcUnit_get(m_instance, 1052); }
+        IfcUnit_put put_Unit() { return IfcUnit_put(m_instance, 1052); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPropertyAbstraction::attr
+        {
+            static constexpr IntValue Name = 1050;
+            static constexpr IntValue EnumerationValues = 1051;
+            static constexpr IntValue Unit = 1052;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyEnumeration_CLASS_H
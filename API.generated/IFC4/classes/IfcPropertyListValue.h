@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyListValue_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertyListValue_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSimpleProperty.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertyListValue
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertyListValue : public RDF_EXPRESS_VIRTUAL IfcSimpleProperty
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertyListValue
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertyListValue(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 470);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertyListValue in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertyListValue> Extent(SdaiModel model) { return ExtentRange<IfcPropertyListValue>(model, 470, false); }
+        static ExtentRange<IfcPropertyListValue> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertyListValue>(model, 470, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPropertyListValue and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPropertyListValue Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPropertyListValue"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPropertyListValue if the actual type of SdaiInstance is IfcPropertyListValue or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertyListValue CreateExactEntity(SdaiInstance instance) { return IfcPropertyListValue(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertyListValue or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertyListValue(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void get_ListValues(TList& lst) { RDF_EXPRESS_PROBE(1053); ListOfIfcValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1053)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void put_ListValues(TList& lst) { RDF_EXPRESS_PROBE(1053); ListOfIfcValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1053)); }
+
+        IfcUnit_get get_Unit() { return IfcUnit_get(m_instance, 1054); }
+        IfcUnit_put put_Unit() { return IfcUnit_put(m_instance, 1054); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSimpleProperty::attr
+        {
+            static constexpr IntValue ListValues = 1053;
+            static constexpr IntValue Unit = 1054;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyListValue_CLASS_H
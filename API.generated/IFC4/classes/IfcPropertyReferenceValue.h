@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyReferenceValue_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertyReferenceValue_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSimpleProperty.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertyReferenceValue
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertyReferenceValue : public RDF_EXPRESS_VIRTUAL IfcSimpleProperty
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertyReferenceValue
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertyReferenceValue(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 471);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertyReferenceValue in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertyReferenceValue> Extent(SdaiModel model) { return ExtentRange<IfcPropertyReferenceValue>(model, 471, false); }
+        static ExtentRange<IfcPropertyReferenceValue> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertyReferenceValue>(model, 471, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPropertyReferenceValue and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPropertyReferenceValue Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPropertyReferenceValue"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPropertyReferenceValue if the actual type of SdaiInstance is IfcPropertyReferenceValue or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertyReferenceValue CreateExactEntity(SdaiInstance instance) { return IfcPropertyReferenceValue(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertyReferenceValue or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertyReferenceValue(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcText get_UsageName() { RDF_EXPRESS_PROBE(1055); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1055), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UsageName_view() { return TextView(get_UsageName()); }
+#endif
+        void put_UsageName(IfcText value) { RDF_EXPRESS_PROBE(1055); sdaiPutAttr(m_instance, getAttrDefinition(1055), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UsageName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1055); return buffer.GetAttr(m_instance, "UsageName"); }
+        const char* get_UsageName_utf8() { return get_UsageName_utf8(ThreadUtf8Buffer()); }
+
+        IfcObjectReferenceSelect_get get_PropertyReference() { return IfcObjectReferenceSelect_get(m_instance, 1056); }
+        IfcObjectReferenceSelect_put put_PropertyReference() { return IfcObjectReferenceSelect_put(m_instance, 1056); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSimpleProperty::attr
+        {
+            static constexpr IntValue UsageName = 1055;
+            static constexpr IntValue PropertyReference = 1056;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyReferenceValue_CLASS_H
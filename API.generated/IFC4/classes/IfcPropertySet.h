@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertySet_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertySet_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPropertySetDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertySet
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertySet : public RDF_EXPRESS_VIRTUAL IfcPropertySetDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertySet
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertySet(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 472);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertySet in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertySet> Extent(SdaiModel model) { return ExtentRange<IfcPropertySet>(model, 472, false); }
+        static ExtentRange<IfcPropertySet> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertySet>(model, 472, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPropertySet and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPropertySet Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPropertySet"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPropertySet if the actual type of SdaiInstance is IfcPropertySet or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertySet CreateExactEntity(SdaiInstance instance) { return IfcPropertySet(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertySet or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertySet(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcProperty or list of convertible elements
+        template <typename TList> void get_HasProperties(TList& lst) { RDF_EXPRESS_PROBE(1057); SetOfIfcPropertySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1057)); }
+
+        //TList may be SetOfIfcProperty or list of convertible elements
+        template <typename TList> void put_HasProperties(TList& lst) { RDF_EXPRESS_PROBE(1057); SetOfIfcPropertySerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1057)); }
+
+        //TArrayElem[] may be IfcProperty[] or array of convertible elements
+        template <typename TArrayElem> void put_HasProperties(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1057); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcPropertySerializer<SetOfIfcProperty> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1057)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPropertySetDefinition::attr
+        {
+            static constexpr IntValue HasProperties = 1057;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertySet_CLASS_H
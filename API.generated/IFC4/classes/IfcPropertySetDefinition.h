@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertySetDefinition_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertySetDefinition_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPropertyDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertySetDefinition
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertySetDefinition : public RDF_EXPRESS_VIRTUAL IfcPropertyDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertySetDefinition
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertySetDefinition(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 473);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertySetDefinition in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertySetDefinition> Extent(SdaiModel model) { return ExtentRange<IfcPropertySetDefinition>(model, 473, false); }
+        static ExtentRange<IfcPropertySetDefinition> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertySetDefinition>(model, 473, true); }
+
+        /// <summary>
+        /// Returns object of IfcPropertySetDefinition if the actual type of SdaiInstance is IfcPropertySetDefinition or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertySetDefinition CreateExactEntity(SdaiInstance instance) { return IfcPropertySetDefinition(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertySetDefinition or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertySetDefinition(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcTypeObject or list of convertible elements
+        template <typename TList> void get_DefinesType(TList& lst) { RDF_EXPRESS_PROBE(527); SetOfIfcTypeObjectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(527)); }
+
+        //TList may be SetOfIfcRelDefinesByTemplate or list of convertible elements
+        template <typename TList> void get_IsDefinedBy(TList& lst) { RDF_EXPRESS_PROBE(528); SetOfIfcRelDefinesByTemplateSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(528)); }
+
+        //TList may be SetOfIfcRelDefinesByProperties or list of convertible elements
+        template <typename TList> void get_DefinesOccurrence(TList& lst) { RDF_EXPRESS_PROBE(529); SetOfIfcRelDefinesByPropertiesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(529)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPropertyDefinition::attr
+        {
+            static constexpr IntValue DefinesType = 527;
+            static constexpr IntValue IsDefinedBy = 528;
+            static constexpr IntValue DefinesOccurrence = 529;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertySetDefinition_CLASS_H
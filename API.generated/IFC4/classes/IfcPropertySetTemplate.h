@@ -0,0 +1,89 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertySetTemplate_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertySetTemplate_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPropertyTemplateDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertySetTemplate
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertySetTemplate : public RDF_EXPRESS_VIRTUAL IfcPropertyTemplateDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertySetTemplate
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertySetTemplate(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 474);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertySetTemplate in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertySetTemplate> Extent(SdaiModel model) { return ExtentRange<IfcPropertySetTemplate>(model, 474, false); }
+        static ExtentRange<IfcPropertySetTemplate> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertySetTemplate>(model, 474, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPropertySetTemplate and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPropertySetTemplate Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPropertySetTemplate"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPropertySetTemplate if the actual type of SdaiInstance is IfcPropertySetTemplate or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertySetTemplate CreateExactEntity(SdaiInstance instance) { return IfcPropertySetTemplate(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertySetTemplate or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertySetTemplate(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPropertySetTemplateTypeEnum> get_TemplateType() { RDF_EXPRESS_PROBE(1058); int v = getENUM(1058, IfcPropertySetTemplateTypeEnum_hash); if (v >= 0) return (IfcPropertySetTemplateTypeEnum) v; else return Nullable<IfcPropertySetTemplateTypeEnum>(); }
+        void put_TemplateType(IfcPropertySetTemplateTypeEnum value) { RDF_EXPRESS_PROBE(1058); TextValue val = IfcPropertySetTemplateTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1058), sdaiENUM, val); }
+
+        IfcIdentifier get_ApplicableEntity() { RDF_EXPRESS_PROBE(1059); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1059), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ApplicableEntity_view() { return TextView(get_ApplicableEntity()); }
+#endif
+        void put_ApplicableEntity(IfcIdentifier value) { RDF_EXPRESS_PROBE(1059); sdaiPutAttr(m_instance, getAttrDefinition(1059), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ApplicableEntity_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1059); return buffer.GetAttr(m_instance, "ApplicableEntity"); }
+        const char* get_ApplicableEntity_utf8() { return get_ApplicableEntity_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcPropertyTemplate or list of convertible elements
+        template <typename TList> void get_HasPropertyTemplates(TList& lst) { RDF_EXPRESS_PROBE(1060); SetOfIfcPropertyTemplateSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1060)); }
+
+        //TList may be SetOfIfcPropertyTemplate or list of convertible elements
+        template <typename TList> void put_HasPropertyTemplates(TList& lst) { RDF_EXPRESS_PROBE(1060); SetOfIfcPropertyTemplateSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1060)); }
+
+        //TArrayElem[] may be IfcPropertyTemplate[] or array of convertible elements
+        template <typename TArrayElem> void put_HasPropertyTemplates(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1060); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcPropertyTemplateSerializer<SetOfIfcPropertyTemplate> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1060)); }
+
+        //TList may be SetOfIfcRelDefinesByTemplate or list of convertible elements
+        template <typename TList> void get_Defines(TList& lst) { RDF_EXPRESS_PROBE(1061); SetOfIfcRelDefinesByTemplateSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1061)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPropertyTemplateDefinition::attr
+        {
+            static constexpr IntValue TemplateType = 1058;
+            static constexpr IntValue ApplicableEntity = 1059;
+            static constexpr IntValue HasPropertyTemplates = 1060;
+            static constexpr IntValue Defines = 1061;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertySetTemplate_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertySingleValue_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertySingleValue_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSimpleProperty.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertySingleValue
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertySingleValue : public RDF_EXPRESS_VIRTUAL IfcSimpleProperty
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertySingleValue
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertySingleValue(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 475);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertySingleValue in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertySingleValue> Extent(SdaiModel model) { return ExtentRange<IfcPropertySingleValue>(model, 475, false); }
+        static ExtentRange<IfcPropertySingleValue> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertySingleValue>(model, 475, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPropertySingleValue and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPropertySingleValue Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPropertySingleValue"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPropertySingleValue if the actual type of SdaiInstance is IfcPropertySingleValue or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertySingleValue CreateExactEntity(SdaiInstance instance) { return IfcPropertySingleValue(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertySingleValue or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertySingleValue(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcValue_get get_NominalValue() { return IfcValue_get(m_instance, 1062); }
+        IfcValue_put put_NominalValue() { return IfcValue_put(m_instance, 1062); }
+
+        IfcUnit_get get_Unit() { return IfcUnit_get(m_instance, 1063); }
+        IfcUnit_put put_Unit() { return IfcUnit_put(m_instance, 1063); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSimpleProperty::attr
+        {
+            static constexpr IntValue NominalValue = 1062;
+            static constexpr IntValue Unit = 1063;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertySingleValue_CLASS_H
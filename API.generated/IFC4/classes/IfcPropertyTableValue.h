@@ -0,0 +1,97 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyTableValue_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertyTableValue_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSimpleProperty.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertyTableValue
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertyTableValue : public RDF_EXPRESS_VIRTUAL IfcSimpleProperty
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertyTableValue
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertyTableValue(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 476);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertyTableValue in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertyTableValue> Extent(SdaiModel model) { return ExtentRange<IfcPropertyTableValue>(model, 476, false); }
+        static ExtentRange<IfcPropertyTableValue> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertyTableValue>(model, 476, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPropertyTableValue and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPropertyTableValue Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPropertyTableValue"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPropertyTableValue if the actual type of SdaiInstance is IfcPropertyTableValue or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertyTableValue CreateExactEntity(SdaiInstance instance) { return IfcPropertyTableValue(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertyTableValue or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertyTableValue(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void get_DefiningValues(TList& lst) { RDF_EXPRESS_PROBE(1064); ListOfIfcValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1064)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void put_DefiningValues(TList& lst) { RDF_EXPRESS_PROBE(1064); ListOfIfcValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1064)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void get_DefinedValues(TList& lst) { RDF_EXPRESS_PROBE(1065); ListOfIfcValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1065)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void put_DefinedValues(TList& lst) { RDF_EXPRESS_PROBE(1065); ListOfIfcValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1065)); }
+
+        IfcText get_Expression() { RDF_EXPRESS_PROBE(1066); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1066), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Expression_view() { return TextView(get_Expression()); }
+#endif
+        void put_Expression(IfcText value) { RDF_EXPRESS_PROBE(1066); sdaiPutAttr(m_instance, getAttrDefinition(1066), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Expression_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1066); return buffer.GetAttr(m_instance, "Expression"); }
+        const char* get_Expression_utf8() { return get_Expression_utf8(ThreadUtf8Buffer()); }
+
+        IfcUnit_get get_DefiningUnit() { return IfcUnit_get(m_instance, 1067); }
+        IfcUnit_put put_DefiningUnit() { return IfcUnit_put(m_instance, 1067); }
+
+        IfcUnit_get get_DefinedUnit() { return IfcUnit_get(m_instance, 1068); }
+        IfcUnit_put put_DefinedUnit() { return IfcUnit_put(m_instance, 1068); }
+
+        Nullable<IfcCurveInterpolationEnum> get_CurveInterpolation() { RDF_EXPRESS_PROBE(1069); int v = getENUM(1069, IfcCurveInterpolationEnum_hash); if (v >= 0) return (IfcCurveInterpolationEnum) v; else return Nullable<IfcCurveInterpolationEnum>(); }
+        void put_CurveInterpolation(IfcCurveInterpolationEnum value) { RDF_EXPRESS_PROBE(1069); TextValue val = IfcCurveInterpolationEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1069), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSimpleProperty::attr
+        {
+            static constexpr IntValue DefiningValues = 1064;
+            static constexpr IntValue DefinedValues = 1065;
+            static constexpr IntValue Expression = 1066;
+            static constexpr IntValue DefiningUnit = 1067;
+            static constexpr IntValue DefinedUnit = 1068;
+            static constexpr IntValue CurveInterpolation = 1069;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyTableValue_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyTemplate_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertyTemplate_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPropertyTemplateDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertyTemplate
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertyTemplate : public RDF_EXPRESS_VIRTUAL IfcPropertyTemplateDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertyTemplate
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertyTemplate(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 477);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertyTemplate in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertyTemplate> Extent(SdaiModel model) { return ExtentRange<IfcPropertyTemplate>(model, 477, false); }
+        static ExtentRange<IfcPropertyTemplate> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertyTemplate>(model, 477, true); }
+
+        /// <summary>
+        /// Returns object of IfcPropertyTemplate if the actual type of SdaiInstance is IfcPropertyTemplate or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertyTemplate CreateExactEntity(SdaiInstance instance) { return IfcPropertyTemplate(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertyTemplate or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertyTemplate(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcComplexPropertyTemplate or list of convertible elements
+        template <typename TList> void get_PartOfComplexTemplate(TList& lst) { RDF_EXPRESS_PROBE(335); SetOfIfcComplexPropertyTemplateSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(335)); }
+
+        //TList may be SetOfIfcPropertySetTemplate or list of convertible elements
+        template <typename TList> void get_PartOfPsetTemplate(TList& lst) { RDF_EXPRESS_PROBE(336); SetOfIfcPropertySetTemplateSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(336)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPropertyTemplateDefinition::attr
+        {
+            static constexpr IntValue PartOfComplexTemplate = 335;
+            static constexpr IntValue PartOfPsetTemplate = 336;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyTemplate_CLASS_H
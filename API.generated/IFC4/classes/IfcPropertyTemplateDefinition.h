@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertyTemplateDefinition_CLASS_H
+#define __RDF_LTD__IFC4_IfcPropertyTemplateDefinition_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPropertyDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPropertyTemplateDefinition
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPropertyTemplateDefinition : public RDF_EXPRESS_VIRTUAL IfcPropertyDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPropertyTemplateDefinition
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPropertyTemplateDefinition(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 478);
+        }
+
+        /// <summary>
+        /// Instances of IfcPropertyTemplateDefinition in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPropertyTemplateDefinition> Extent(SdaiModel model) { return ExtentRange<IfcPropertyTemplateDefinition>(model, 478, false); }
+        static ExtentRange<IfcPropertyTemplateDefinition> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPropertyTemplateDefinition>(model, 478, true); }
+
+        /// <summary>
+        /// Returns object of IfcPropertyTemplateDefinition if the actual type of SdaiInstance is IfcPropertyTemplateDefinition or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPropertyTemplateDefinition CreateExactEntity(SdaiInstance instance) { return IfcPropertyTemplateDefinition(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPropertyTemplateDefinition or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPropertyTemplateDefinition(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPropertyDefinition::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertyTemplateDefinition_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProtectiveDevice_CLASS_H
+#define __RDF_LTD__IFC4_IfcProtectiveDevice_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProtectiveDevice
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProtectiveDevice : public RDF_EXPRESS_VIRTUAL IfcFlowController
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProtectiveDevice
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProtectiveDevice(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 479);
+        }
+
+        /// <summary>
+        /// Instances of IfcProtectiveDevice in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProtectiveDevice> Extent(SdaiModel model) { return ExtentRange<IfcProtectiveDevice>(model, 479, false); }
+        static ExtentRange<IfcProtectiveDevice> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProtectiveDevice>(model, 479, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProtectiveDevice and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProtectiveDevice Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProtectiveDevice"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProtectiveDevice if the actual type of SdaiInstance is IfcProtectiveDevice or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProtectiveDevice CreateExactEntity(SdaiInstance instance) { return IfcProtectiveDevice(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProtectiveDevice or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProtectiveDevice(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcProtectiveDeviceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1070); int v = getENUM(1070, IfcProtectiveDeviceTypeEnum_hash); if (v >= 0) return (IfcProtectiveDeviceTypeEnum) v; else return Nullable<IfcProtectiveDeviceTypeEnum>(); }
+        void put_PredefinedType(IfcProtectiveDeviceTypeEnum value) { RDF_EXPRESS_PROBE(1070); TextValue val = IfcProtectiveDeviceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1070), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowController::attr
+        {
+            static constexpr IntValue PredefinedType = 1070;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProtectiveDevice_CLASS_H
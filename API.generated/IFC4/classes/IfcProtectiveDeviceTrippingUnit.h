@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProtectiveDeviceTrippingUnit_CLASS_H
+#define __RDF_LTD__IFC4_IfcProtectiveDeviceTrippingUnit_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProtectiveDeviceTrippingUnit
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProtectiveDeviceTrippingUnit : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProtectiveDeviceTrippingUnit
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProtectiveDeviceTrippingUnit(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 480);
+        }
+
+        /// <summary>
+        /// Instances of IfcProtectiveDeviceTrippingUnit in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProtectiveDeviceTrippingUnit> Extent(SdaiModel model) { return ExtentRange<IfcProtectiveDeviceTrippingUnit>(model, 480, false); }
+        static ExtentRange<IfcProtectiveDeviceTrippingUnit> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProtectiveDeviceTrippingUnit>(model, 480, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProtectiveDeviceTrippingUnit and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProtectiveDeviceTrippingUnit Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProtectiveDeviceTrippingUnit"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProtectiveDeviceTrippingUnit if the actual type of SdaiInstance is IfcProtectiveDeviceTrippingUnit or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProtectiveDeviceTrippingUnit CreateExactEntity(SdaiInstance instance) { return IfcProtectiveDeviceTrippingUnit(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProtectiveDeviceTrippingUnit or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProtectiveDeviceTrippingUnit(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcProtectiveDeviceTrippingUnitTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1071); int v = getENUM(1071, IfcProtectiveDeviceTrippingUnitTypeEnum_hash); if (v >= 0) return (IfcProtectiveDeviceTrippingUnitTypeEnum) v; else return Nullable<IfcProtectiveDeviceTrippingUnitTypeEnum>(); }
+        void put_PredefinedType(IfcProtectiveDeviceTrippingUnitTypeEnum value) { RDF_EXPRESS_PROBE(1071); TextValue val = IfcProtectiveDeviceTrippingUnitTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1071), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1071;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProtectiveDeviceTrippingUnit_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProtectiveDeviceTrippingUnitType_CLASS_H
+#define __RDF_LTD__IFC4_IfcProtectiveDeviceTrippingUnitType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProtectiveDeviceTrippingUnitType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProtectiveDeviceTrippingUnitType : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProtectiveDeviceTrippingUnitType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProtectiveDeviceTrippingUnitType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 481);
+        }
+
+        /// <summary>
+        /// Instances of IfcProtectiveDeviceTrippingUnitType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProtectiveDeviceTrippingUnitType> Extent(SdaiModel model) { return ExtentRange<IfcProtectiveDeviceTrippingUnitType>(model, 481, false); }
+        static ExtentRange<IfcProtectiveDeviceTrippingUnitType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProtectiveDeviceTrippingUnitType>(model, 481, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProtectiveDeviceTrippingUnitType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProtectiveDeviceTrippingUnitType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProtectiveDeviceTrippingUnitType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProtectiveDeviceTrippingUnitType if the actual type of SdaiInstance is IfcProtectiveDeviceTrippingUnitType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProtectiveDeviceTrippingUnitType CreateExactEntity(SdaiInstance instance) { return IfcProtectiveDeviceTrippingUnitType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProtectiveDeviceTrippingUnitType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProtectiveDeviceTrippingUnitType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcProtectiveDeviceTrippingUnitTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1072); int v = getENUM(1072, IfcProtectiveDeviceTrippingUnitTypeEnum_hash); if (v >= 0) return (IfcProtectiveDeviceTrippingUnitTypeEnum) v; else return Nullable<IfcProtectiveDeviceTrippingUnitTypeEnum>(); }
+        void put_PredefinedType(IfcProtectiveDeviceTrippingUnitTypeEnum value) { RDF_EXPRESS_PROBE(1072); TextValue val = IfcProtectiveDeviceTrippingUnitTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1072), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1072;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProtectiveDeviceTrippingUnitType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProtectiveDeviceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcProtectiveDeviceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProtectiveDeviceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProtectiveDeviceType : public RDF_EXPRESS_VIRTUAL IfcFlowControllerType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProtectiveDeviceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProtectiveDeviceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 482);
+        }
+
+        /// <summary>
+        /// Instances of IfcProtectiveDeviceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProtectiveDeviceType> Extent(SdaiModel model) { return ExtentRange<IfcProtectiveDeviceType>(model, 482, false); }
+        static ExtentRange<IfcProtectiveDeviceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProtectiveDeviceType>(model, 482, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProtectiveDeviceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProtectiveDeviceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProtectiveDeviceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProtectiveDeviceType if the actual type of SdaiInstance is IfcProtectiveDeviceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProtectiveDeviceType CreateExactEntity(SdaiInstance instance) { return IfcProtectiveDeviceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProtectiveDeviceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProtectiveDeviceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcProtectiveDeviceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1073); int v = getENUM(1073, IfcProtectiveDeviceTypeEnum_hash); if (v >= 0) return (IfcProtectiveDeviceTypeEnum) v; else return Nullable<IfcProtectiveDeviceTypeEnum>(); }
+        void put_PredefinedType(IfcProtectiveDeviceTypeEnum value) { RDF_EXPRESS_PROBE(1073); TextValue val = IfcProtectiveDeviceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1073), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowControllerType::attr
+        {
+            static constexpr IntValue PredefinedType = 1073;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProtectiveDeviceType_CLASS_H
@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProxy_CLASS_H
+#define __RDF_LTD__IFC4_IfcProxy_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProduct.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcProxy
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcProxy : public RDF_EXPRESS_VIRTUAL IfcProduct
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcProxy
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcProxy(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 483);
+        }
+
+        /// <summary>
+        /// Instances of IfcProxy in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcProxy> Extent(SdaiModel model) { return ExtentRange<IfcProxy>(model, 483, false); }
+        static ExtentRange<IfcProxy> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcProxy>(model, 483, true); }
+
+        /// <summary>
+        /// Create new instance of IfcProxy and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcProxy Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcProxy"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcProxy if the actual type of SdaiInstance is IfcProxy or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcProxy CreateExactEntity(SdaiInstance instance) { return IfcProxy(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcProxy or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcProxy(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcObjectTypeEnum> get_ProxyType() { RDF_EXPRESS_PROBE(1074); int v = getENUM(1074, IfcObjectTypeEnum_hash); if (v >= 0) return (IfcObjectTypeEnum) v; else return Nullable<IfcObjectTypeEnum>(); }
+        void put_ProxyType(IfcObjectTypeEnum value) { RDF_EXPRESS_PROBE(1074); TextValue val = IfcObjectTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1074), sdaiENUM, val); }
+
+        IfcLabel get_Tag() { RDF_EXPRESS_PROBE(1075); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1075), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Tag_view() { return TextView(get_Tag()); }
+#endif
+        void put_Tag(IfcLabel value) { RDF_EXPRESS_PROBE(1075); sdaiPutAttr(m_instance, getAttrDefinition(1075), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Tag_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1075); return buffer.GetAttr(m_instance, "Tag"); }
+        const char* get_Tag_utf8() { return get_Tag_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProduct::attr
+        {
+            static constexpr IntValue ProxyType = 1074;
+            static constexpr IntValue Tag = 1075;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcProxy_CLASS_H
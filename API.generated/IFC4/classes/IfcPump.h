@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPump_CLASS_H
+#define __RDF_LTD__IFC4_IfcPump_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowMovingDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPump
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPump : public RDF_EXPRESS_VIRTUAL IfcFlowMovingDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPump
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPump(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 484);
+        }
+
+        /// <summary>
+        /// Instances of IfcPump in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPump> Extent(SdaiModel model) { return ExtentRange<IfcPump>(model, 484, false); }
+        static ExtentRange<IfcPump> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPump>(model, 484, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPump and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPump Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPump"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPump if the actual type of SdaiInstance is IfcPump or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPump CreateExactEntity(SdaiInstance instance) { return IfcPump(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPump or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPump(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPumpTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1076); int v = getENUM(1076, IfcPumpTypeEnum_hash); if (v >= 0) return (IfcPumpTypeEnum) v; else return Nullable<IfcPumpTypeEnum>(); }
+        void put_PredefinedType(IfcPumpTypeEnum value) { RDF_EXPRESS_PROBE(1076); TextValue val = IfcPumpTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1076), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowMovingDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 1076;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPump_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPumpType_CLASS_H
+#define __RDF_LTD__IFC4_IfcPumpType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowMovingDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcPumpType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcPumpType : public RDF_EXPRESS_VIRTUAL IfcFlowMovingDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcPumpType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcPumpType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 485);
+        }
+
+        /// <summary>
+        /// Instances of IfcPumpType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcPumpType> Extent(SdaiModel model) { return ExtentRange<IfcPumpType>(model, 485, false); }
+        static ExtentRange<IfcPumpType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcPumpType>(model, 485, true); }
+
+        /// <summary>
+        /// Create new instance of IfcPumpType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcPumpType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcPumpType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcPumpType if the actual type of SdaiInstance is IfcPumpType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcPumpType CreateExactEntity(SdaiInstance instance) { return IfcPumpType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcPumpType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcPumpType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPumpTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1077); int v = getENUM(1077, IfcPumpTypeEnum_hash); if (v >= 0) return (IfcPumpTypeEnum) v; else return Nullable<IfcPumpTypeEnum>(); }
+        void put_PredefinedType(IfcPumpTypeEnum value) { RDF_EXPRESS_PROBE(1077); TextValue val = IfcPumpTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1077), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowMovingDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 1077;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcPumpType_CLASS_H
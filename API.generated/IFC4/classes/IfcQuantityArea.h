@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcQuantityArea_CLASS_H
+#define __RDF_LTD__IFC4_IfcQuantityArea_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPhysicalSimpleQuantity.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcQuantityArea
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcQuantityArea : public RDF_EXPRESS_VIRTUAL IfcPhysicalSimpleQuantity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcQuantityArea
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcQuantityArea(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 486);
+        }
+
+        /// <summary>
+        /// Instances of IfcQuantityArea in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcQuantityArea> Extent(SdaiModel model) { return ExtentRange<IfcQuantityArea>(model, 486, false); }
+        static ExtentRange<IfcQuantityArea> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcQuantityArea>(model, 486, true); }
+
+        /// <summary>
+        /// Create new instance of IfcQuantityArea and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcQuantityArea Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcQuantityArea"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcQuantityArea if the actual type of SdaiInstance is IfcQuantityArea or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcQuantityArea CreateExactEntity(SdaiInstance instance) { return IfcQuantityArea(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcQuantityArea or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcQuantityArea(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAreaMeasure> get_AreaValue() { RDF_EXPRESS_PROBE(1078); IfcAreaMeasure val = (IfcAreaMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1078), sdaiREAL, &val)) return val; else return Nullable<IfcAreaMeasure>(); }
+        void put_AreaValue(IfcAreaMeasure value) { RDF_EXPRESS_PROBE(1078); sdaiPutAttr(m_instance, getAttrDefinition(1078), sdaiREAL, &value); }
+
+        IfcLabel get_Formula() { RDF_EXPRESS_PROBE(1079); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1079), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Formula_view() { return TextView(get_Formula()); }
+#endif
+        void put_Formula(IfcLabel value) { RDF_EXPRESS_PROBE(1079); sdaiPutAttr(m_instance, getAttrDefinition(1079), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Formula_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1079); return buffer.GetAttr(m_instance, "Formula"); }
+        const char* get_Formula_utf8() { return get_Formula_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPhysicalSimpleQuantity::attr
+        {
+            static constexpr IntValue AreaValue = 1078;
+            static constexpr IntValue Formula = 1079;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcQuantityArea_CLASS_H
@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcQuantityLength_CLASS_H
+#define __RDF_LTD__IFC4_IfcQuantityLength_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPhysicalSimpleQuantity.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcQuantityLength
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcQuantityLength : public RDF_EXPRESS_VIRTUAL IfcPhysicalSimpleQuantity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcQuantityLength
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcQuantityLength(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 488);
+        }
+
+        /// <summary>
+        /// Instances of IfcQuantityLength in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcQuantityLength> Extent(SdaiModel model) { return ExtentRange<IfcQuantityLength>(model, 488, false); }
+        static ExtentRange<IfcQuantityLength> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcQuantityLength>(model, 488, true); }
+
+        /// <summary>
+        /// Create new instance of IfcQuantityLength and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcQuantityLength Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcQuantityLength"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcQuantityLength if the actual type of SdaiInstance is IfcQuantityLength or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcQuantityLength CreateExactEntity(SdaiInstance instance) { return IfcQuantityLength(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcQuantityLength or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcQuantityLength(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLengthMeasure> get_LengthValue() { RDF_EXPRESS_PROBE(1082); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1082), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_LengthValue(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1082); sdaiPutAttr(m_instance, getAttrDefinition(1082), sdaiREAL, &value); }
+
+        IfcLabel get_Formula() { RDF_EXPRESS_PROBE(1083); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1083), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Formula_view() { return TextView(get_Formula()); }
+#endif
+        void put_Formula(IfcLabel value) { RDF_EXPRESS_PROBE(1083); sdaiPutAttr(m_instance, getAttrDefinition(1083), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Formula_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1083); return buffer.GetAttr(m_instance, "Formula"); }
+        const char* get_Formula_utf8() { return get_Formula_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPhysicalSimpleQuantity::attr
+        {
+            static constexpr IntValue LengthValue = 1082;
+            static constexpr IntValue Formula = 1083;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcQuantityLength_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcQuantitySet_CLASS_H
+#define __RDF_LTD__IFC4_IfcQuantitySet_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPropertySetDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcQuantitySet
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcQuantitySet : public RDF_EXPRESS_VIRTUAL IfcPropertySetDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcQuantitySet
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcQuantitySet(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 489);
+        }
+
+        /// <summary>
+        /// Instances of IfcQuantitySet in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcQuantitySet> Extent(SdaiModel model) { return ExtentRange<IfcQuantitySet>(model, 489, false); }
+        static ExtentRange<IfcQuantitySet> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcQuantitySet>(model, 489, true); }
+
+        /// <summary>
+        /// Returns object of IfcQuantitySet if the actual type of SdaiInstance is IfcQuantitySet or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcQuantitySet CreateExactEntity(SdaiInstance instance) { return IfcQuantitySet(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcQuantitySet or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcQuantitySet(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPropertySetDefinition::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcQuantitySet_CLASS_H
@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcQuantityVolume_CLASS_H
+#define __RDF_LTD__IFC4_IfcQuantityVolume_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPhysicalSimpleQuantity.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcQuantityVolume
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcQuantityVolume : public RDF_EXPRESS_VIRTUAL IfcPhysicalSimpleQuantity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcQuantityVolume
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcQuantityVolume(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 491);
+        }
+
+        /// <summary>
+        /// Instances of IfcQuantityVolume in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcQuantityVolume> Extent(SdaiModel model) { return ExtentRange<IfcQuantityVolume>(model, 491, false); }
+        static ExtentRange<IfcQuantityVolume> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcQuantityVolume>(model, 491, true); }
+
+        /// <summary>
+        /// Create new instance of IfcQuantityVolume and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcQuantityVolume Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcQuantityVolume"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcQuantityVolume if the actual type of SdaiInstance is IfcQuantityVolume or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcQuantityVolume CreateExactEntity(SdaiInstance instance) { return IfcQuantityVolume(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcQuantityVolume or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcQuantityVolume(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcVolumeMeasure> get_VolumeValue() { RDF_EXPRESS_PROBE(1086); IfcVolumeMeasure val = (IfcVolumeMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1086), sdaiREAL, &val)) return val; else return Nullable<IfcVolumeMeasure>(); }
+        void put_VolumeValue(IfcVolumeMeasure value) { RDF_EXPRESS_PROBE(1086); sdaiPutAttr(m_instance, getAttrDefinition(1086), sdaiREAL, &value); }
+
+        IfcLabel get_Formula() { RDF_EXPRESS_PROBE(1087); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1087), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Formula_view() { return TextView(get_Formula()); }
+#endif
+        void put_Formula(IfcLabel value) { RDF_EXPRESS_PROBE(1087); sdaiPutAttr(m_instance, getAttrDefinition(1087), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Formula_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1087); return buffer.GetAttr(m_instance, "Formula"); }
+        const char* get_Formula_utf8() { return get_Formula_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPhysicalSimpleQuantity::attr
+        {
+            static constexpr IntValue VolumeValue = 1086;
+            static constexpr IntValue Formula = 1087;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcQuantityVolume_CLASS_H
@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcQuantityWeight_CLASS_H
+#define __RDF_LTD__IFC4_IfcQuantityWeight_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPhysicalSimpleQuantity.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcQuantityWeight
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcQuantityWeight : public RDF_EXPRESS_VIRTUAL IfcPhysicalSimpleQuantity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcQuantityWeight
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcQuantityWeight(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 492);
+        }
+
+        /// <summary>
+        /// Instances of IfcQuantityWeight in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcQuantityWeight> Extent(SdaiModel model) { return ExtentRange<IfcQuantityWeight>(model, 492, false); }
+        static ExtentRange<IfcQuantityWeight> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcQuantityWeight>(model, 492, true); }
+
+        /// <summary>
+        /// Create new instance of IfcQuantityWeight and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcQuantityWeight Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcQuantityWeight"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcQuantityWeight if the actual type of SdaiInstance is IfcQuantityWeight or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcQuantityWeight CreateExactEntity(SdaiInstance instance) { return IfcQuantityWeight(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcQuantityWeight or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcQuantityWeight(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcMassMeasure> get_WeightValue() { RDF_EXPRESS_PROBE(1088); IfcMassMeasure val = (IfcMassMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1088), sdaiREAL, &val)) return val; else return Nullable<IfcMassMeasure>(); }
+        void put_WeightValue(IfcMassMeasure value) { RDF_EXPRESS_PROBE(1088); sdaiPutAttr(m_instance, getAttrDefinition(1088), sdaiREAL, &value); }
+
+        IfcLabel get_Formula() { RDF_EXPRESS_PROBE(1089); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1089), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Formula_view() { return TextView(get_Formula()); }
+#endif
+        void put_Formula(IfcLabel value) { RDF_EXPRESS_PROBE(1089); sdaiPutAttr(m_instance, getAttrDefinition(1089), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Formula_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1089); return buffer.GetAttr(m_instance, "Formula"); }
+        const char* get_Formula_utf8() { return get_Formula_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPhysicalSimpleQuantity::attr
+        {
+            static constexpr IntValue WeightValue = 1088;
+            static constexpr IntValue Formula = 1089;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcQuantityWeight_CLASS_H
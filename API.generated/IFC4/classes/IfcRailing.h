@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRailing_CLASS_H
+#define __RDF_LTD__IFC4_IfcRailing_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRailing
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRailing : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRailing
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRailing(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 493);
+        }
+
+        /// <summary>
+        /// Instances of IfcRailing in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRailing> Extent(SdaiModel model) { return ExtentRange<IfcRailing>(model, 493, false); }
+        static ExtentRange<IfcRailing> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRailing>(model, 493, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRailing and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRailing Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRailing"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRailing if the actual type of SdaiInstance is IfcRailing or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRailing CreateExactEntity(SdaiInstance instance) { return IfcRailing(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRailing or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRailing(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcRailingTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1090); int v = getENUM(1090, IfcRailingTypeEnum_hash); if (v >= 0) return (IfcRailingTypeEnum) v; else return Nullable<IfcRailingTypeEnum>(); }
+        void put_PredefinedType(IfcRailingTypeEnum value) { RDF_EXPRESS_PROBE(1090); TextValue val = IfcRailingTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1090), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1090;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRailing_CLASS_H
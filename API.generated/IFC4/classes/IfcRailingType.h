@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRailingType_CLASS_H
+#define __RDF_LTD__IFC4_IfcRailingType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRailingType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRailingType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRailingType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRailingType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 494);
+        }
+
+        /// <summary>
+        /// Instances of IfcRailingType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRailingType> Extent(SdaiModel model) { return ExtentRange<IfcRailingType>(model, 494, false); }
+        static ExtentRange<IfcRailingType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRailingType>(model, 494, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRailingType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRailingType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRailingType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRailingType if the actual type of SdaiInstance is IfcRailingType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRailingType CreateExactEntity(SdaiInstance instance) { return IfcRailingType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRailingType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRailingType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcRailingTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1091); int v = getENUM(1091, IfcRailingTypeEnum_hash); if (v >= 0) return (IfcRailingTypeEnum) v; else return Nullable<IfcRailingTypeEnum>(); }
+        void put_PredefinedType(IfcRailingTypeEnum value) { RDF_EXPRESS_PROBE(1091); TextValue val = IfcRailingTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1091), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1091;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRailingType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRamp_CLASS_H
+#define __RDF_LTD__IFC4_IfcRamp_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRamp
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRamp : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRamp
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRamp(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 495);
+        }
+
+        /// <summary>
+        /// Instances of IfcRamp in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRamp> Extent(SdaiModel model) { return ExtentRange<IfcRamp>(model, 495, false); }
+        static ExtentRange<IfcRamp> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRamp>(model, 495, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRamp and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRamp Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRamp"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRamp if the actual type of SdaiInstance is IfcRamp or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRamp CreateExactEntity(SdaiInstance instance) { return IfcRamp(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRamp or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRamp(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcRampTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1092); int v = getENUM(1092, IfcRampTypeEnum_hash); if (v >= 0) return (IfcRampTypeEnum) v; else return Nullable<IfcRampTypeEnum>(); }
+        void put_PredefinedType(IfcRampTypeEnum value) { RDF_EXPRESS_PROBE(1092); TextValue val = IfcRampTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1092), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1092;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRamp_CLASS_H
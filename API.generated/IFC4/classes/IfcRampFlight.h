@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRampFlight_CLASS_H
+#define __RDF_LTD__IFC4_IfcRampFlight_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRampFlight
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRampFlight : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRampFlight
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRampFlight(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 496);
+        }
+
+        /// <summary>
+        /// Instances of IfcRampFlight in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRampFlight> Extent(SdaiModel model) { return ExtentRange<IfcRampFlight>(model, 496, false); }
+        static ExtentRange<IfcRampFlight> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRampFlight>(model, 496, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRampFlight and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRampFlight Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRampFlight"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRampFlight if the actual type of SdaiInstance is IfcRampFlight or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRampFlight CreateExactEntity(SdaiInstance instance) { return IfcRampFlight(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRampFlight or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRampFlight(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcRampFlightTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1093); int v = getENUM(1093, IfcRampFlightTypeEnum_hash); if (v >= 0) return (IfcRampFlightTypeEnum) v; else return Nullable<IfcRampFlightTypeEnum>(); }
+        void put_PredefinedType(IfcRampFlightTypeEnum value) { RDF_EXPRESS_PROBE(1093); TextValue val = IfcRampFlightTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1093), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1093;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRampFlight_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRampFlightType_CLASS_H
+#define __RDF_LTD__IFC4_IfcRampFlightType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRampFlightType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRampFlightType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRampFlightType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRampFlightType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 497);
+        }
+
+        /// <summary>
+        /// Instances of IfcRampFlightType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRampFlightType> Extent(SdaiModel model) { return ExtentRange<IfcRampFlightType>(model, 497, false); }
+        static ExtentRange<IfcRampFlightType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRampFlightType>(model, 497, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRampFlightType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRampFlightType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRampFlightType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRampFlightType if the actual type of SdaiInstance is IfcRampFlightType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRampFlightType CreateExactEntity(SdaiInstance instance) { return IfcRampFlightType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRampFlightType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRampFlightType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcRampFlightTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1094); int v = getENUM(1094, IfcRampFlightTypeEnum_hash); if (v >= 0) return (IfcRampFlightTypeEnum) v; else return Nullable<IfcRampFlightTypeEnum>(); }
+        void put_PredefinedType(IfcRampFlightTypeEnum value) { RDF_EXPRESS_PROBE(1094); TextValue val = IfcRampFlightTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1094), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1094;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRampFlightType_CLASS_H
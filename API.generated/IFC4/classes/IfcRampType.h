@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRampType_CLASS_H
+#define __RDF_LTD__IFC4_IfcRampType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRampType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRampType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRampType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRampType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 498);
+        }
+
+        /// <summary>
+        /// Instances of IfcRampType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRampType> Extent(SdaiModel model) { return ExtentRange<IfcRampType>(model, 498, false); }
+        static ExtentRange<IfcRampType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRampType>(model, 498, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRampType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRampType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRampType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRampType if the actual type of SdaiInstance is IfcRampType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRampType CreateExactEntity(SdaiInstance instance) { return IfcRampType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRampType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRampType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcRampTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1095); int v = getENUM(1095, IfcRampTypeEnum_hash); if (v >= 0) return (IfcRampTypeEnum) v; else return Nullable<IfcRampTypeEnum>(); }
+        void put_PredefinedType(IfcRampTypeEnum value) { RDF_EXPRESS_PROBE(1095); TextValue val = IfcRampTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1095), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1095;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRampType_CLASS_H
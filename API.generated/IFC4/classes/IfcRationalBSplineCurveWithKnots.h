@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRationalBSplineCurveWithKnots_CLASS_H
+#define __RDF_LTD__IFC4_IfcRationalBSplineCurveWithKnots_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBSplineCurveWithKnots.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRationalBSplineCurveWithKnots
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRationalBSplineCurveWithKnots : public RDF_EXPRESS_VIRTUAL IfcBSplineCurveWithKnots
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRationalBSplineCurveWithKnots
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRationalBSplineCurveWithKnots(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 499);
+        }
+
+        /// <summary>
+        /// Instances of IfcRationalBSplineCurveWithKnots in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRationalBSplineCurveWithKnots> Extent(SdaiModel model) { return ExtentRange<IfcRationalBSplineCurveWithKnots>(model, 499, false); }
+        static ExtentRange<IfcRationalBSplineCurveWithKnots> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRationalBSplineCurveWithKnots>(model, 499, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRationalBSplineCurveWithKnots and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRationalBSplineCurveWithKnots Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRationalBSplineCurveWithKnots"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRationalBSplineCurveWithKnots if the actual type of SdaiInstance is IfcRationalBSplineCurveWithKnots or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRationalBSplineCurveWithKnots CreateExactEntity(SdaiInstance instance) { return IfcRationalBSplineCurveWithKnots(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRationalBSplineCurveWithKnots or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRationalBSplineCurveWithKnots(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcReal or list of convertible elements
+        template <typename TList> void get_WeightsData(TList& lst) { RDF_EXPRESS_PROBE(1096); ListOfIfcRealSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1096)); }
+
+        //TList may be ListOfIfcReal or list of convertible elements
+        template <typename TList> void put_WeightsData(TList& lst) { RDF_EXPRESS_PROBE(1096); ListOfIfcRealSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1096)); }
+
+        //TArrayElem[] may be IfcReal[] or array of convertible elements
+        template <typename TArrayElem> void put_WeightsData(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1096); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcRealSerializer<ListOfIfcReal> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1096)); }
+
+        //TList may be ArrayOfIfcReal or list of convertible elements
+        template <typename TList> void get_Weights(TList& lst) { RDF_EXPRESS_PROBE(1097); ArrayOfIfcRealSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1097)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBSplineCurveWithKnots::attr
+        {
+            static constexpr IntValue WeightsData = 1096;
+            static constexpr IntValue Weights = 1097;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRationalBSplineCurveWithKnots_CLASS_H
@@ -0,0 +1,92 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRationalBSplineSurfaceWithKnots_CLASS_H
+#define __RDF_LTD__IFC4_IfcRationalBSplineSurfaceWithKnots_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBSplineSurfaceWithKnots.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRationalBSplineSurfaceWithKnots
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRationalBSplineSurfaceWithKnots : public RDF_EXPRESS_VIRTUAL IfcBSplineSurfaceWithKnots
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRationalBSplineSurfaceWithKnots
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRationalBSplineSurfaceWithKnots(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 500);
+        }
+
+        /// <summary>
+        /// Instances of IfcRationalBSplineSurfaceWithKnots in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRationalBSplineSurfaceWithKnots> Extent(SdaiModel model) { return ExtentRange<IfcRationalBSplineSurfaceWithKnots>(model, 500, false); }
+        static ExtentRange<IfcRationalBSplineSurfaceWithKnots> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRationalBSplineSurfaceWithKnots>(model, 500, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRationalBSplineSurfaceWithKnots and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRationalBSplineSurfaceWithKnots Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRationalBSplineSurfaceWithKnots"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRationalBSplineSurfaceWithKnots if the actual type of SdaiInstance is IfcRationalBSplineSurfaceWithKnots or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRationalBSplineSurfaceWithKnots CreateExactEntity(SdaiInstance instance) { return IfcRationalBSplineSurfaceWithKnots(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRationalBSplineSurfaceWithKnots or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRationalBSplineSurfaceWithKnots(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfListOfIfcReal or list of convertible elements
+        template <typename TList> void get_WeightsData(TList& lst) { RDF_EXPRESS_PROBE(1098); ListOfListOfIfcRealSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1098)); }
+
+        //TList may be ListOfListOfIfcReal or list of convertible elements
+        template <typename TList> void put_WeightsData(TList& lst) { RDF_EXPRESS_PROBE(1098); ListOfListOfIfcRealSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1098)); }
+
+        //reads inner aggregations into flat buffer, stride elements each (e.g. xyz of points), returns number of inner aggregations
+        template <typename TElem> IntValue get_WeightsData(TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(1098); return FlatAggrFromAttr<TElem, IfcReal, sdaiREAL>(m_instance, getAttrDefinition(1098), buffer, size, stride); }
+        template <typename TElem> IntValue get_WeightsData(std::vector<TElem>& flat, size_t stride) { RDF_EXPRESS_PROBE(1098); return FlatAggrFromAttr<TElem, IfcReal, sdaiREAL>(m_instance, getAttrDefinition(1098), flat, stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> IntValue get_WeightsData(std::span<TElem> buffer, size_t stride) { return get_WeightsData(buffer.data(), buffer.size(), stride); }
+#endif
+
+        //writes flat buffer as inner aggregations of stride elements each (e.g. xyz of points), no intermediate lists
+        template <typename TElem> void put_WeightsData(const TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(1098); FlatAggrToAttr<TElem, IfcReal, sdaiREAL>(m_instance, getAttrDefinition(1098), buffer, size, stride); }
+        template <typename TElem> void put_WeightsData(const std::vector<TElem>& flat, size_t stride) { put_WeightsData(flat.data(), flat.size(), stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> void put_WeightsData(std::span<const TElem> buffer, size_t stride) { put_WeightsData(buffer.data(), buffer.size(), stride); }
+#endif
+
+        //TList may be ArrayOfArrayOfIfcReal or list of convertible elements
+        template <typename TList> void get_Weights(TList& lst) { RDF_EXPRESS_PROBE(1099); ArrayOfArrayOfIfcRealSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1099)); }
+
+        //reads inner aggregations into flat buffer, stride elements each (e.g. xyz of points), returns number of inner aggregations
+        template <typename TElem> IntValue get_Weights(TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(1099); return FlatAggrFromAttr<TElem, IfcReal, sdaiREAL>(m_instance, getAttrDefinition(1099), buffer, size, stride); }
+        template <typename TElem> IntValue get_Weights(std::vector<TElem>& flat, size_t stride) { RDF_EXPRESS_PROBE(1099); return FlatAggrFromAttr<TElem, IfcReal, sdaiREAL>(m_instance, getAttrDefinition(1099), flat, stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> IntValue get_Weights(std::span<TElem> buffer, size_t stride) { return get_Weights(buffer.data(), buffer.size(), stride); }
+#endif
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBSplineSurfaceWithKnots::attr
+        {
+            static constexpr IntValue WeightsData = 1098;
+            static constexpr IntValue Weights = 1099;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRationalBSplineSurfaceWithKnots_CLASS_H
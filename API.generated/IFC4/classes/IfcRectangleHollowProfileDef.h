@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRectangleHollowProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcRectangleHollowProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRectangleProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRectangleHollowProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRectangleHollowProfileDef : public RDF_EXPRESS_VIRTUAL IfcRectangleProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRectangleHollowProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRectangleHollowProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 501);
+        }
+
+        /// <summary>
+        /// Instances of IfcRectangleHollowProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRectangleHollowProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcRectangleHollowProfileDef>(model, 501, false); }
+        static ExtentRange<IfcRectangleHollowProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRectangleHollowProfileDef>(model, 501, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRectangleHollowProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRectangleHollowProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRectangleHollowProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRectangleHollowProfileDef if the actual type of SdaiInstance is IfcRectangleHollowProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRectangleHollowProfileDef CreateExactEntity(SdaiInstance instance) { return IfcRectangleHollowProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRectangleHollowProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRectangleHollowProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_WallThickness() { RDF_EXPRESS_PROBE(1102); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1102), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_WallThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1102); sdaiPutAttr(m_instance, getAttrDefinition(1102), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_InnerFilletRadius() { RDF_EXPRESS_PROBE(1103); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1103), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_InnerFilletRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(1103); sdaiPutAttr(m_instance, getAttrDefinition(1103), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_OuterFilletRadius() { RDF_EXPRESS_PROBE(1104); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1104), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_OuterFilletRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(1104); sdaiPutAttr(m_instance, getAttrDefinition(1104), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRectangleProfileDef::attr
+        {
+            static constexpr IntValue WallThickness = 1102;
+            static constexpr IntValue InnerFilletRadius = 1103;
+            static constexpr IntValue OuterFilletRadius = 1104;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRectangleHollowProfileDef_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRectangleProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcRectangleProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRectangleProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRectangleProfileDef : public RDF_EXPRESS_VIRTUAL IfcParameterizedProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRectangleProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRectangleProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 502);
+        }
+
+        /// <summary>
+        /// Instances of IfcRectangleProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRectangleProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcRectangleProfileDef>(model, 502, false); }
+        static ExtentRange<IfcRectangleProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRectangleProfileDef>(model, 502, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRectangleProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRectangleProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRectangleProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRectangleProfileDef if the actual type of SdaiInstance is IfcRectangleProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRectangleProfileDef CreateExactEntity(SdaiInstance instance) { return IfcRectangleProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRectangleProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRectangleProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_XDim() { RDF_EXPRESS_PROBE(1100); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1100), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_XDim(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1100); sdaiPutAttr(m_instance, getAttrDefinition(1100), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_YDim() { RDF_EXPRESS_PROBE(1101); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1101), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_YDim(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1101); sdaiPutAttr(m_instance, getAttrDefinition(1101), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcParameterizedProfileDef::attr
+        {
+            static constexpr IntValue XDim = 1100;
+            static constexpr IntValue YDim = 1101;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRectangleProfileDef_CLASS_H
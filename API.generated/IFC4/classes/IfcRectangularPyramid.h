@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRectangularPyramid_CLASS_H
+#define __RDF_LTD__IFC4_IfcRectangularPyramid_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCsgPrimitive3D.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRectangularPyramid
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRectangularPyramid : public RDF_EXPRESS_VIRTUAL IfcCsgPrimitive3D
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRectangularPyramid
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRectangularPyramid(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 503);
+        }
+
+        /// <summary>
+        /// Instances of IfcRectangularPyramid in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRectangularPyramid> Extent(SdaiModel model) { return ExtentRange<IfcRectangularPyramid>(model, 503, false); }
+        static ExtentRange<IfcRectangularPyramid> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRectangularPyramid>(model, 503, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRectangularPyramid and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRectangularPyramid Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRectangularPyramid"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRectangularPyramid if the actual type of SdaiInstance is IfcRectangularPyramid or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRectangularPyramid CreateExactEntity(SdaiInstance instance) { return IfcRectangularPyramid(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRectangularPyramid or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRectangularPyramid(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_XLength() { RDF_EXPRESS_PROBE(1105); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1105), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_XLength(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1105); sdaiPutAttr(m_instance, getAttrDefinition(1105), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_YLength() { RDF_EXPRESS_PROBE(1106); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1106), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_YLength(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1106); sdaiPutAttr(m_instance, getAttrDefinition(1106), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Height() { RDF_EXPRESS_PROBE(1107); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1107), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Height(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1107); sdaiPutAttr(m_instance, getAttrDefinition(1107), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCsgPrimitive3D::attr
+        {
+            static constexpr IntValue XLength = 1105;
+            static constexpr IntValue YLength = 1106;
+            static constexpr IntValue Height = 1107;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRectangularPyramid_CLASS_H
@@ -0,0 +1,88 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRectangularTrimmedSurface_CLASS_H
+#define __RDF_LTD__IFC4_IfcRectangularTrimmedSurface_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundedSurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRectangularTrimmedSurface
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRectangularTrimmedSurface : public RDF_EXPRESS_VIRTUAL IfcBoundedSurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRectangularTrimmedSurface
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRectangularTrimmedSurface(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 504);
+        }
+
+        /// <summary>
+        /// Instances of IfcRectangularTrimmedSurface in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRectangularTrimmedSurface> Extent(SdaiModel model) { return ExtentRange<IfcRectangularTrimmedSurface>(model, 504, false); }
+        static ExtentRange<IfcRectangularTrimmedSurface> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRectangularTrimmedSurface>(model, 504, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRectangularTrimmedSurface and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRectangularTrimmedSurface Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRectangularTrimmedSurface"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRectangularTrimmedSurface if the actual type of SdaiInstance is IfcRectangularTrimmedSurface or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRectangularTrimmedSurface CreateExactEntity(SdaiInstance instance) { return IfcRectangularTrimmedSurface(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRectangularTrimmedSurface or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRectangularTrimmedSurface(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcSurface get_BasisSurface();
+        void put_BasisSurface(IfcSurface inst);
+
+        Nullable<IfcParameterValue> get_U1() { RDF_EXPRESS_PROBE(1109); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1109), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_U1(IfcParameterValue value) { RDF_EXPRESS_PROBE(1109); sdaiPutAttr(m_instance, getAttrDefinition(1109), sdaiREAL, &value); }
+
+        Nullable<IfcParameterValue> get_V1() { RDF_EXPRESS_PROBE(1110); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1110), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_V1(IfcParameterValue value) { RDF_EXPRESS_PROBE(1110); sdaiPutAttr(m_instance, getAttrDefinition(1110), sdaiREAL, &value); }
+
+        Nullable<IfcParameterValue> get_U2() { RDF_EXPRESS_PROBE(1111); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1111), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_U2(IfcParameterValue value) { RDF_EXPRESS_PROBE(1111); sdaiPutAttr(m_instance, getAttrDefinition(1111), sdaiREAL, &value); }
+
+        Nullable<IfcParameterValue> get_V2() { RDF_EXPRESS_PROBE(1112); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1112), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_V2(IfcParameterValue value) { RDF_EXPRESS_PROBE(1112); sdaiPutAttr(m_instance, getAttrDefinition(1112), sdaiREAL, &value); }
+
+        Nullable<IfcBoolean> get_Usense() { RDF_EXPRESS_PROBE(1113); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1113), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_Usense(IfcBoolean value) { RDF_EXPRESS_PROBE(1113); sdaiPutAttr(m_instance, getAttrDefinition(1113), sdaiBOOLEAN, &value); }
+
+        Nullable<IfcBoolean> get_Vsense() { RDF_EXPRESS_PROBE(1114); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1114), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_Vsense(IfcBoolean value) { RDF_EXPRESS_PROBE(1114); sdaiPutAttr(m_instance, getAttrDefinition(1114), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundedSurface::attr
+        {
+            static constexpr IntValue BasisSurface = 1108;
+            static constexpr IntValue U1 = 1109;
+            static constexpr IntValue V1 = 1110;
+            static constexpr IntValue U2 = 1111;
+            static constexpr IntValue V2 = 1112;
+            static constexpr IntValue Usense = 1113;
+            static constexpr IntValue Vsense = 1114;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRectangularTrimmedSurface_CLASS_H
@@ -0,0 +1,115 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRecurrencePattern_CLASS_H
+#define __RDF_LTD__IFC4_IfcRecurrencePattern_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRecurrencePattern
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRecurrencePattern : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRecurrencePattern
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRecurrencePattern(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 505);
+        }
+
+        /// <summary>
+        /// Instances of IfcRecurrencePattern in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRecurrencePattern> Extent(SdaiModel model) { return ExtentRange<IfcRecurrencePattern>(model, 505, false); }
+        static ExtentRange<IfcRecurrencePattern> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRecurrencePattern>(model, 505, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRecurrencePattern and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRecurrencePattern Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRecurrencePattern"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRecurrencePattern if the actual type of SdaiInstance is IfcRecurrencePattern or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRecurrencePattern CreateExactEntity(SdaiInstance instance) { return IfcRecurrencePattern(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRecurrencePattern or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRecurrencePattern(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcRecurrenceTypeEnum> get_RecurrenceType() { RDF_EXPRESS_PROBE(1115); int v = getENUM(1115, IfcRecurrenceTypeEnum_hash); if (v >= 0) return (IfcRecurrenceTypeEnum) v; else return Nullable<IfcRecurrenceTypeEnum>(); }
+        void put_RecurrenceType(IfcRecurrenceTypeEnum value) { RDF_EXPRESS_PROBE(1115); TextValue val = IfcRecurrenceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1115), sdaiENUM, val); }
+
+        //TList may be SetOfIfcDayInMonthNumber or list of convertible elements
+        template <typename TList> void get_DayComponent(TList& lst) { RDF_EXPRESS_PROBE(1116); SetOfIfcDayInMonthNumberSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1116)); }
+
+        //TList may be SetOfIfcDayInMonthNumber or list of convertible elements
+        template <typename TList> void put_DayComponent(TList& lst) { RDF_EXPRESS_PROBE(1116); SetOfIfcDayInMonthNumberSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1116)); }
+
+        //TArrayElem[] may be IfcDayInMonthNumber[] or array of convertible elements
+        template <typename TArrayElem> void put_DayComponent(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1116); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcDayInMonthNumberSerializer<SetOfIfcDayInMonthNumber> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1116)); }
+
+        //TList may be SetOfIfcDayInWeekNumber or list of convertible elements
+        template <typename TList> void get_WeekdayComponent(TList& lst) { RDF_EXPRESS_PROBE(1117); SetOfIfcDayInWeekNumberSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1117)); }
+
+        //TList may be SetOfIfcDayInWeekNumber or list of convertible elements
+        template <typename TList> void put_WeekdayComponent(TList& lst) { RDF_EXPRESS_PROBE(1117); SetOfIfcDayInWeekNumberSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1117)); }
+
+        //TArrayElem[] may be IfcDayInWeekNumber[] or array of convertible elements
+        template <typename TArrayElem> void put_WeekdayComponent(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1117); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcDayInWeekNumberSerializer<SetOfIfcDayInWeekNumber> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1117)); }
+
+        //TList may be SetOfIfcMonthInYearNumber or list of convertible elements
+        template <typename TList> void get_MonthComponent(TList& lst) { RDF_EXPRESS_PROBE(1118); SetOfIfcMonthInYearNumberSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1118)); }
+
+        //TList may be SetOfIfcMonthInYearNumber or list of convertible elements
+        template <typename TList> void put_MonthComponent(TList& lst) { RDF_EXPRESS_PROBE(1118); SetOfIfcMonthInYearNumberSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1118)); }
+
+        //TArrayElem[] may be IfcMonthInYearNumber[] or array of convertible elements
+        template <typename TArrayElem> void put_MonthComponent(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1118); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcMonthInYearNumberSerializer<SetOfIfcMonthInYearNumber> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1118)); }
+
+        Nullable<IfcInteger> get_Position() { RDF_EXPRESS_PROBE(1119); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1119), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_Position(IfcInteger value) { RDF_EXPRESS_PROBE(1119); sdaiPutAttr(m_instance, getAttrDefinition(1119), sdaiINTEGER, &value); }
+
+        Nullable<IfcInteger> get_Interval() { RDF_EXPRESS_PROBE(1120); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1120), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_Interval(IfcInteger value) { RDF_EXPRESS_PROBE(1120); sdaiPutAttr(m_instance, getAttrDefinition(1120), sdaiINTEGER, &value); }
+
+        Nullable<IfcInteger> get_Occurrences() { RDF_EXPRESS_PROBE(1121); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1121), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_Occurrences(IfcInteger value) { RDF_EXPRESS_PROBE(1121); sdaiPutAttr(m_instance, getAttrDefinition(1121), sdaiINTEGER, &value); }
+
+        //TList may be ListOfIfcTimePeriod or list of convertible elements
+        template <typename TList> void get_TimePeriods(TList& lst) { RDF_EXPRESS_PROBE(1122); ListOfIfcTimePeriodSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1122)); }
+
+        //TList may be ListOfIfcTimePeriod or list of convertible elements
+        template <typename TList> void put_TimePeriods(TList& lst) { RDF_EXPRESS_PROBE(1122); ListOfIfcTimePeriodSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1122)); }
+
+        //TArrayElem[] may be IfcTimePeriod[] or array of convertible elements
+        template <typename TArrayElem> void put_TimePeriods(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1122); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcTimePeriodSerializer<ListOfIfcTimePeriod> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1122)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue RecurrenceType = 1115;
+            static constexpr IntValue DayComponent = 1116;
+            static constexpr IntValue WeekdayComponent = 1117;
+            static constexpr IntValue MonthComponent = 1118;
+            static constexpr IntValue Position = 1119;
+            static constexpr IntValue Interval = 1120;
+            static constexpr IntValue Occurrences = 1121;
+            static constexpr IntValue TimePeriods = 1122;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRecurrencePattern_CLASS_H
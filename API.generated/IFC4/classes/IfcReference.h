@@ -0,0 +1,106 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReference_CLASS_H
+#define __RDF_LTD__IFC4_IfcReference_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcReference
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcReference : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcReference
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcReference(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 506);
+        }
+
+        /// <summary>
+        /// Instances of IfcReference in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcReference> Extent(SdaiModel model) { return ExtentRange<IfcReference>(model, 506, false); }
+        static ExtentRange<IfcReference> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcReference>(model, 506, true); }
+
+        /// <summary>
+        /// Create new instance of IfcReference and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcReference Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcReference"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcReference if the actual type of SdaiInstance is IfcReference or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcReference CreateExactEntity(SdaiInstance instance) { return IfcReference(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcReference or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcReference(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_TypeIdentifier() { RDF_EXPRESS_PROBE(1123); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1123), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_TypeIdentifier_view() { return TextView(get_TypeIdentifier()); }
+#endif
+        void put_TypeIdentifier(IfcIdentifier value) { RDF_EXPRESS_PROBE(1123); sdaiPutAttr(m_instance, getAttrDefinition(1123), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_TypeIdentifier_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1123); return buffer.GetAttr(m_instance, "TypeIdentifier"); }
+        const char* get_TypeIdentifier_utf8() { return get_TypeIdentifier_utf8(ThreadUtf8Buffer()); }
+
+        IfcIdentifier get_AttributeIdentifier() { RDF_EXPRESS_PROBE(1124); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1124), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_AttributeIdentifier_view() { return TextView(get_AttributeIdentifier()); }
+#endif
+        void put_AttributeIdentifier(IfcIdentifier value) { RDF_EXPRESS_PROBE(1124); sdaiPutAttr(m_instance, getAttrDefinition(1124), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_AttributeIdentifier_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1124); return buffer.GetAttr(m_instance, "AttributeIdentifier"); }
+        const char* get_AttributeIdentifier_utf8() { return get_AttributeIdentifier_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_InstanceName() { RDF_EXPRESS_PROBE(1125); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1125), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_InstanceName_view() { return TextView(get_InstanceName()); }
+#endif
+        void put_InstanceName(IfcLabel value) { RDF_EXPRESS_PROBE(1125); sdaiPutAttr(m_instance, getAttrDefinition(1125), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_InstanceName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1125); return buffer.GetAttr(m_instance, "InstanceName"); }
+        const char* get_InstanceName_utf8() { return get_InstanceName_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcInteger or list of convertible elements
+        template <typename TList> void get_ListPositions(TList& lst) { RDF_EXPRESS_PROBE(1126); ListOfIfcIntegerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1126)); }
+
+        //TList may be ListOfIfcInteger or list of convertible elements
+        template <typename TList> void put_ListPositions(TList& lst) { RDF_EXPRESS_PROBE(1126); ListOfIfcIntegerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1126)); }
+
+        //TArrayElem[] may be IfcInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_ListPositions(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1126); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcIntegerSerializer<ListOfIfcInteger> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1126)); }
+
+        IfcReference get_InnerReference();
+        void put_InnerReference(IfcReference inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue TypeIdentifier = 1123;
+            static constexpr IntValue AttributeIdentifier = 1124;
+            static constexpr IntValue InstanceName = 1125;
+            static constexpr IntValue ListPositions = 1126;
+            static constexpr IntValue InnerReference = 1127;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcReference_CLASS_H
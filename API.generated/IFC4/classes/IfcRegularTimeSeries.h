@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRegularTimeSeries_CLASS_H
+#define __RDF_LTD__IFC4_IfcRegularTimeSeries_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTimeSeries.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRegularTimeSeries
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRegularTimeSeries : public RDF_EXPRESS_VIRTUAL IfcTimeSeries
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRegularTimeSeries
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRegularTimeSeries(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 507);
+        }
+
+        /// <summary>
+        /// Instances of IfcRegularTimeSeries in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRegularTimeSeries> Extent(SdaiModel model) { return ExtentRange<IfcRegularTimeSeries>(model, 507, false); }
+        static ExtentRange<IfcRegularTimeSeries> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRegularTimeSeries>(model, 507, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRegularTimeSeries and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRegularTimeSeries Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRegularTimeSeries"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRegularTimeSeries if the actual type of SdaiInstance is IfcRegularTimeSeries or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRegularTimeSeries CreateExactEntity(SdaiInstance instance) { return IfcRegularTimeSeries(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRegularTimeSeries or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRegularTimeSeries(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTimeMeasure> get_TimeStep() { RDF_EXPRESS_PROBE(1128); IfcTimeMeasure val = (IfcTimeMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1128), sdaiREAL, &val)) return val; else return Nullable<IfcTimeMeasure>(); }
+        void put_TimeStep(IfcTimeMeasure value) { RDF_EXPRESS_PROBE(1128); sdaiPutAttr(m_instance, getAttrDefinition(1128), sdaiREAL, &value); }
+
+        //TList may be ListOfIfcTimeSeriesValue or list of convertible elements
+        template <typename TList> void get_Values(TList& lst) { RDF_EXPRESS_PROBE(1129); ListOfIfcTimeSeriesValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1129)); }
+
+        //TList may be ListOfIfcTimeSeriesValue or list of convertible elements
+        template <typename TList> void put_Values(TList& lst) { RDF_EXPRESS_PROBE(1129); ListOfIfcTimeSeriesValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1129)); }
+
+        //TArrayElem[] may be IfcTimeSeriesValue[] or array of convertible elements
+        template <typename TArrayElem> void put_Values(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1129); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcTimeSeriesValueSerializer<ListOfIfcTimeSeriesValue> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1129)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTimeSeries::attr
+        {
+            static constexpr IntValue TimeStep = 1128;
+            static constexpr IntValue Values = 1129;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRegularTimeSeries_CLASS_H
@@ -0,0 +1,91 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcementBarProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcReinforcementBarProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedProperties.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcReinforcementBarProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcReinforcementBarProperties : public RDF_EXPRESS_VIRTUAL IfcPreDefinedProperties
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcReinforcementBarProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcReinforcementBarProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 508);
+        }
+
+        /// <summary>
+        /// Instances of IfcReinforcementBarProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcReinforcementBarProperties> Extent(SdaiModel model) { return ExtentRange<IfcReinforcementBarProperties>(model, 508, false); }
+        static ExtentRange<IfcReinforcementBarProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcReinforcementBarProperties>(model, 508, true); }
+
+        /// <summary>
+        /// Create new instance of IfcReinforcementBarProperties and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcReinforcementBarProperties Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcReinforcementBarProperties"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcReinforcementBarProperties if the actual type of SdaiInstance is IfcReinforcementBarProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcReinforcementBarProperties CreateExactEntity(SdaiInstance instance) { return IfcReinforcementBarProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcReinforcementBarProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcReinforcementBarProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAreaMeasure> get_TotalCrossSectionArea() { RDF_EXPRESS_PROBE(1130); IfcAreaMeasure val = (IfcAreaMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1130), sdaiREAL, &val)) return val; else return Nullable<IfcAreaMeasure>(); }
+        void put_TotalCrossSectionArea(IfcAreaMeasure value) { RDF_EXPRESS_PROBE(1130); sdaiPutAttr(m_instance, getAttrDefinition(1130), sdaiREAL, &value); }
+
+        IfcLabel get_SteelGrade() { RDF_EXPRESS_PROBE(1131); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1131), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_SteelGrade_view() { return TextView(get_SteelGrade()); }
+#endif
+        void put_SteelGrade(IfcLabel value) { RDF_EXPRESS_PROBE(1131); sdaiPutAttr(m_instance, getAttrDefinition(1131), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_SteelGrade_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1131); return buffer.GetAttr(m_instance, "SteelGrade"); }
+        const char* get_SteelGrade_utf8() { return get_SteelGrade_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcReinforcingBarSurfaceEnum> get_BarSurface() { RDF_EXPRESS_PROBE(1132); int v = getENUM(1132, IfcReinforcingBarSurfaceEnum_hash); if (v >= 0) return (IfcReinforcingBarSurfaceEnum) v; else return Nullable<IfcReinforcingBarSurfaceEnum>(); }
+        void put_BarSurface(IfcReinforcingBarSurfaceEnum value) { RDF_EXPRESS_PROBE(1132); TextValue val = IfcReinforcingBarSurfaceEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1132), sdaiENUM, val); }
+
+        Nullable<IfcLengthMeasure> get_EffectiveDepth() { RDF_EXPRESS_PROBE(1133); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1133), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_EffectiveDepth(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1133); sdaiPutAttr(m_instance, getAttrDefinition(1133), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_NominalBarDiameter() { RDF_EXPRESS_PROBE(1134); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1134), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_NominalBarDiameter(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1134); sdaiPutAttr(m_instance, getAttrDefinition(1134), sdaiREAL, &value); }
+
+        Nullable<IfcCountMeasure> get_BarCount() { RDF_EXPRESS_PROBE(1135); IfcCountMeasure val = (IfcCountMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1135), sdaiREAL, &val)) return val; else return Nullable<IfcCountMeasure>(); }
+        void put_BarCount(IfcCountMeasure value) { RDF_EXPRESS_PROBE(1135); sdaiPutAttr(m_instance, getAttrDefinition(1135), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedProperties::attr
+        {
+            static constexpr IntValue TotalCrossSectionArea = 1130;
+            static constexpr IntValue SteelGrade = 1131;
+            static constexpr IntValue BarSurface = 1132;
+            static constexpr IntValue EffectiveDepth = 1133;
+            static constexpr IntValue NominalBarDiameter = 1134;
+            static constexpr IntValue BarCount = 1135;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcementBarProperties_CLASS_H
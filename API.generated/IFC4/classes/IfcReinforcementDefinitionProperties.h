@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcementDefinitionProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcReinforcementDefinitionProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedPropertySet.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcReinforcementDefinitionProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcReinforcementDefinitionProperties : public RDF_EXPRESS_VIRTUAL IfcPreDefinedPropertySet
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcReinforcementDefinitionProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcReinforcementDefinitionProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 509);
+        }
+
+        /// <summary>
+        /// Instances of IfcReinforcementDefinitionProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcReinforcementDefinitionProperties> Extent(SdaiModel model) { return ExtentRange<IfcReinforcementDefinitionProperties>(model, 509, false); }
+        static ExtentRange<IfcReinforcementDefinitionProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcReinforcementDefinitionProperties>(model, 509, true); }
+
+        /// <summary>
+        /// Create new instance of IfcReinforcementDefinitionProperties and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcReinforcementDefinitionProperties Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcReinforcementDefinitionProperties"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcReinforcementDefinitionProperties if the actual type of SdaiInstance is IfcReinforcementDefinitionProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcReinforcementDefinitionProperties CreateExactEntity(SdaiInstance instance) { return IfcReinforcementDefinitionProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcReinforcementDefinitionProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcReinforcementDefinitionProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_DefinitionType() { RDF_EXPRESS_PROBE(1136); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1136), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_DefinitionType_view() { return TextView(get_DefinitionType()); }
+#endif
+        void put_DefinitionType(IfcLabel value) { RDF_EXPRESS_PROBE(1136); sdaiPutAttr(m_instance, getAttrDefinition(1136), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_DefinitionType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1136); return buffer.GetAttr(m_instance, "DefinitionType"); }
+        const char* get_DefinitionType_utf8() { return get_DefinitionType_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcSectionReinforcementProperties or list of convertible elements
+        template <typename TList> void get_ReinforcementSectionDefinitions(TList& lst) { RDF_EXPRESS_PROBE(1137); ListOfIfcSectionReinforcementPropertiesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1137)); }
+
+        //TList may be ListOfIfcSectionReinforcementProperties or list of convertible elements
+        template <typename TList> void put_ReinforcementSectionDefinitions(TList& lst) { RDF_EXPRESS_PROBE(1137); ListOfIfcSectionReinforcementPropertiesSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1137)); }
+
+        //TArrayElem[] may be IfcSectionReinforcementProperties[] or array of convertible elements
+        template <typename TArrayElem> void put_ReinforcementSectionDefinitions(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1137); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcSectionReinforcementPropertiesSerializer<ListOfIfcSectionReinforcementProperties> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1137)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedPropertySet::attr
+        {
+            static constexpr IntValue DefinitionType = 1136;
+            static constexpr IntValue ReinforcementSectionDefinitions = 1137;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcementDefinitionProperties_CLASS_H
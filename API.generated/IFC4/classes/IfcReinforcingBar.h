@@ -0,0 +1,80 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcingBar_CLASS_H
+#define __RDF_LTD__IFC4_IfcReinforcingBar_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcReinforcingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcReinforcingBar
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcReinforcingBar : public RDF_EXPRESS_VIRTUAL IfcReinforcingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcReinforcingBar
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcReinforcingBar(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 510);
+        }
+
+        /// <summary>
+        /// Instances of IfcReinforcingBar in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcReinforcingBar> Extent(SdaiModel model) { return ExtentRange<IfcReinforcingBar>(model, 510, false); }
+        static ExtentRange<IfcReinforcingBar> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcReinforcingBar>(model, 510, true); }
+
+        /// <summary>
+        /// Create new instance of IfcReinforcingBar and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcReinforcingBar Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcReinforcingBar"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcReinforcingBar if the actual type of SdaiInstance is IfcReinforcingBar or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcReinforcingBar CreateExactEntity(SdaiInstance instance) { return IfcReinforcingBar(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcReinforcingBar or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcReinforcingBar(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_NominalDiameter() { RDF_EXPRESS_PROBE(1139); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1139), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_NominalDiameter(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1139); sdaiPutAttr(m_instance, getAttrDefinition(1139), sdaiREAL, &value); }
+
+        Nullable<IfcAreaMeasure> get_CrossSectionArea() { RDF_EXPRESS_PROBE(1140); IfcAreaMeasure val = (IfcAreaMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1140), sdaiREAL, &val)) return val; else return Nullable<IfcAreaMeasure>(); }
+        void put_CrossSectionArea(IfcAreaMeasure value) { RDF_EXPRESS_PROBE(1140); sdaiPutAttr(m_instance, getAttrDefinition(1140), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_BarLength() { RDF_EXPRESS_PROBE(1141); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1141), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_BarLength(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1141); sdaiPutAttr(m_instance, getAttrDefinition(1141), sdaiREAL, &value); }
+
+        Nullable<IfcReinforcingBarTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1142); int v = getENUM(1142, IfcReinforcingBarTypeEnum_hash); if (v >= 0) return (IfcReinforcingBarTypeEnum) v; else return Nullable<IfcReinforcingBarTypeEnum>(); }
+        void put_PredefinedType(IfcReinforcingBarTypeEnum value) { RDF_EXPRESS_PROBE(1142); TextValue val = IfcReinforcingBarTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1142), sdaiENUM, val); }
+
+        Nullable<IfcReinforcingBarSurfaceEnum> get_BarSurface() { RDF_EXPRESS_PROBE(1143); int v = getENUM(1143, IfcReinforcingBarSurfaceEnum_hash); if (v >= 0) return (IfcReinforcingBarSurfaceEnum) v; else return Nullable<IfcReinforcingBarSurfaceEnum>(); }
+        void put_BarSurface(IfcReinforcingBarSurfaceEnum value) { RDF_EXPRESS_PROBE(1143); TextValue val = IfcReinforcingBarSurfaceEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1143), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcReinforcingElement::attr
+        {
+            static constexpr IntValue NominalDiameter = 1139;
+            static constexpr IntValue CrossSectionArea = 1140;
+            static constexpr IntValue BarLength = 1141;
+            static constexpr IntValue PredefinedType = 1142;
+            static constexpr IntValue BarSurface = 1143;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcingBar_CLASS_H
@@ -0,0 +1,98 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcingBarType_CLASS_H
+#define __RDF_LTD__IFC4_IfcReinforcingBarType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcReinforcingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcReinforcingBarType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcReinforcingBarType : public RDF_EXPRESS_VIRTUAL IfcReinforcingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcReinforcingBarType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcReinforcingBarType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 511);
+        }
+
+        /// <summary>
+        /// Instances of IfcReinforcingBarType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcReinforcingBarType> Extent(SdaiModel model) { return ExtentRange<IfcReinforcingBarType>(model, 511, false); }
+        static ExtentRange<IfcReinforcingBarType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcReinforcingBarType>(model, 511, true); }
+
+        /// <summary>
+        /// Create new instance of IfcReinforcingBarType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcReinforcingBarType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcReinforcingBarType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcReinforcingBarType if the actual type of SdaiInstance is IfcReinforcingBarType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcReinforcingBarType CreateExactEntity(SdaiInstance instance) { return IfcReinforcingBarType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcReinforcingBarType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcReinforcingBarType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcReinforcingBarTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1144); int v = getENUM(1144, IfcReinforcingBarTypeEnum_hash); if (v >= 0) return (IfcReinforcingBarTypeEnum) v; else return Nullable<IfcReinforcingBarTypeEnum>(); }
+        void put_PredefinedType(IfcReinforcingBarTypeEnum value) { RDF_EXPRESS_PROBE(1144); TextValue val = IfcReinforcingBarTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1144), sdaiENUM, val); }
+
+        Nullable<IfcPositiveLengthMeasure> get_NominalDiameter() { RDF_EXPRESS_PROBE(1145); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1145), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_NominalDiameter(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1145); sdaiPutAttr(m_instance, getAttrDefinition(1145), sdaiREAL, &value); }
+
+        Nullable<IfcAreaMeasure> get_CrossSectionArea() { RDF_EXPRESS_PROBE(1146); IfcAreaMeasure val = (IfcAreaMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1146), sdaiREAL, &val)) return val; else return Nullable<IfcAreaMeasure>(); }
+        void put_CrossSectionArea(IfcAreaMeasure value) { RDF_EXPRESS_PROBE(1146); sdaiPutAttr(m_instance, getAttrDefinition(1146), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_BarLength() { RDF_EXPRESS_PROBE(1147); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1147), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_BarLength(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1147); sdaiPutAttr(m_instance, getAttrDefinition(1147), sdaiREAL, &value); }
+
+        Nullable<IfcReinforcingBarSurfaceEnum> get_BarSurface() { RDF_EXPRESS_PROBE(1148); int v = getENUM(1148, IfcReinforcingBarSurfaceEnum_hash); if (v >= 0) return (IfcReinforcingBarSurfaceEnum) v; else return Nullable<IfcReinforcingBarSurfaceEnum>(); }
+        void put_BarSurface(IfcReinforcingBarSurfaceEnum value) { RDF_EXPRESS_PROBE(1148); TextValue val = IfcReinforcingBarSurfaceEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1148), sdaiENUM, val); }
+
+        IfcLabel get_BendingShapeCode() { RDF_EXPRESS_PROBE(1149); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1149), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_BendingShapeCode_view() { return TextView(get_BendingShapeCode()); }
+#endif
+        void put_BendingShapeCode(IfcLabel value) { RDF_EXPRESS_PROBE(1149); sdaiPutAttr(m_instance, getAttrDefinition(1149), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_BendingShapeCode_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1149); return buffer.GetAttr(m_instance, "BendingShapeCode"); }
+        const char* get_BendingShapeCode_utf8() { return get_BendingShapeCode_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcBendingParameterSelect or list of convertible elements
+        template <typename TList> void get_BendingParameters(TList& lst) { RDF_EXPRESS_PROBE(1150); ListOfIfcBendingParameterSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1150)); }
+
+        //TList may be ListOfIfcBendingParameterSelect or list of convertible elements
+        template <typename TList> void put_BendingParameters(TList& lst) { RDF_EXPRESS_PROBE(1150); ListOfIfcBendingParameterSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1150)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcReinforcingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1144;
+            static constexpr IntValue NominalDiameter = 1145;
+            static constexpr IntValue CrossSectionArea = 1146;
+            static constexpr IntValue BarLength = 1147;
+            static constexpr IntValue BarSurface = 1148;
+            static constexpr IntValue BendingShapeCode = 1149;
+            static constexpr IntValue BendingParameters = 1150;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcingBarType_CLASS_H
@@ -0,0 +1,67 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcingElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcReinforcingElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementComponent.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcReinforcingElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcReinforcingElement : public RDF_EXPRESS_VIRTUAL IfcElementComponent
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcReinforcingElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcReinforcingElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 512);
+        }
+
+        /// <summary>
+        /// Instances of IfcReinforcingElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcReinforcingElement> Extent(SdaiModel model) { return ExtentRange<IfcReinforcingElement>(model, 512, false); }
+        static ExtentRange<IfcReinforcingElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcReinforcingElement>(model, 512, true); }
+
+        /// <summary>
+        /// Returns object of IfcReinforcingElement if the actual type of SdaiInstance is IfcReinforcingElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcReinforcingElement CreateExactEntity(SdaiInstance instance) { return IfcReinforcingElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcReinforcingElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcReinforcingElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_SteelGrade() { RDF_EXPRESS_PROBE(1138); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1138), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_SteelGrade_view() { return TextView(get_SteelGrade()); }
+#endif
+        void put_SteelGrade(IfcLabel value) { RDF_EXPRESS_PROBE(1138); sdaiPutAttr(m_instance, getAttrDefinition(1138), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_SteelGrade_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1138); return buffer.GetAttr(m_instance, "SteelGrade"); }
+        const char* get_SteelGrade_utf8() { return get_SteelGrade_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementComponent::attr
+        {
+            static constexpr IntValue SteelGrade = 1138;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcingElement_CLASS_H
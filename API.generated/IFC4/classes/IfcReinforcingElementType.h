@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcingElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcReinforcingElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementComponentType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcReinforcingElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcReinforcingElementType : public RDF_EXPRESS_VIRTUAL IfcElementComponentType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcReinforcingElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcReinforcingElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 513);
+        }
+
+        /// <summary>
+        /// Instances of IfcReinforcingElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcReinforcingElementType> Extent(SdaiModel model) { return ExtentRange<IfcReinforcingElementType>(model, 513, false); }
+        static ExtentRange<IfcReinforcingElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcReinforcingElementType>(model, 513, true); }
+
+        /// <summary>
+        /// Returns object of IfcReinforcingElementType if the actual type of SdaiInstance is IfcReinforcingElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcReinforcingElementType CreateExactEntity(SdaiInstance instance) { return IfcReinforcingElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcReinforcingElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcReinforcingElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementComponentType::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcingElementType_CLASS_H
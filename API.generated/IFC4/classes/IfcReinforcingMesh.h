@@ -0,0 +1,96 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcingMesh_CLASS_H
+#define __RDF_LTD__IFC4_IfcReinforcingMesh_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcReinforcingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcReinforcingMesh
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcReinforcingMesh : public RDF_EXPRESS_VIRTUAL IfcReinforcingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcReinforcingMesh
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcReinforcingMesh(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 514);
+        }
+
+        /// <summary>
+        /// Instances of IfcReinforcingMesh in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcReinforcingMesh> Extent(SdaiModel model) { return ExtentRange<IfcReinforcingMesh>(model, 514, false); }
+        static ExtentRange<IfcReinforcingMesh> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcReinforcingMesh>(model, 514, true); }
+
+        /// <summary>
+        /// Create new instance of IfcReinforcingMesh and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcReinforcingMesh Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcReinforcingMesh"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcReinforcingMesh if the actual type of SdaiInstance is IfcReinforcingMesh or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcReinforcingMesh CreateExactEntity(SdaiInstance instance) { return IfcReinforcingMesh(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcReinforcingMesh or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcReinforcingMesh(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_MeshLength() { RDF_EXPRESS_PROBE(1151); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1151), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_MeshLength(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1151); sdaiPutAttr(m_instance, getAttrDefinition(1151), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_MeshWidth() { RDF_EXPRESS_PROBE(1152); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1152), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_MeshWidth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1152); sdaiPutAttr(m_instance, getAttrDefinition(1152), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_LongitudinalBarNominalDiameter() { RDF_EXPRESS_PROBE(1153); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1153), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_LongitudinalBarNominalDiameter(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1153); sdaiPutAttr(m_instance, getAttrDefinition(1153), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_TransverseBarNominalDiameter() { RDF_EXPRESS_PROBE(1154); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1154), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_TransverseBarNominalDiameter(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1154); sdaiPutAttr(m_instance, getAttrDefinition(1154), sdaiREAL, &value); }
+
+        Nullable<IfcAreaMeasure> get_LongitudinalBarCrossSectionArea() { RDF_EXPRESS_PROBE(1155); IfcAreaMeasure val = (IfcAreaMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1155), sdaiREAL, &val)) return val; else return Nullable<IfcAreaMeasure>(); }
+        void put_LongitudinalBarCrossSectionArea(IfcAreaMeasure value) { RDF_EXPRESS_PROBE(1155); sdaiPutAttr(m_instance, getAttrDefinition(1155), sdaiREAL, &value); }
+
+        Nullable<IfcAreaMeasure> get_TransverseBarCrossSectionArea() { RDF_EXPRESS_PROBE(1156); IfcAreaMeasure val = (IfcAreaMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1156), sdaiREAL, &val)) return val; else return Nullable<IfcAreaMeasure>(); }
+        void put_TransverseBarCrossSectionArea(IfcAreaMeasure value) { RDF_EXPRESS_PROBE(1156); sdaiPutAttr(m_instance, getAttrDefinition(1156), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_LongitudinalBarSpacing() { RDF_EXPRESS_PROBE(1157); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1157), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_LongitudinalBarSpacing(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1157); sdaiPutAttr(m_instance, getAttrDefinition(1157), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_TransverseBarSpacing() { RDF_EXPRESS_PROBE(1158); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1158), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_TransverseBarSpacing(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1158); sdaiPutAttr(m_instance, getAttrDefinition(1158), sdaiREAL, &value); }
+
+        Nullable<IfcReinforcingMeshTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1159); int v = getENUM(1159, IfcReinforcingMeshTypeEnum_hash); if (v >= 0) return (IfcReinforcingMeshTypeEnum) v; else return Nullable<IfcReinforcingMeshTypeEnum>(); }
+        void put_PredefinedType(IfcReinforcingMeshTypeEnum value) { RDF_EXPRESS_PROBE(1159); TextValue val = IfcReinforcingMeshTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1159), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcReinforcingElement::attr
+        {
+            static constexpr IntValue MeshLength = 1151;
+            static constexpr IntValue MeshWidth = 1152;
+            static constexpr IntValue LongitudinalBarNominalDiameter = 1153;
+            static constexpr IntValue TransverseBarNominalDiameter = 1154;
+            static constexpr IntValue LongitudinalBarCrossSectionArea = 1155;
+            static constexpr IntValue TransverseBarCrossSectionArea = 1156;
+            static constexpr IntValue LongitudinalBarSpacing = 1157;
+            static constexpr IntValue TransverseBarSpacing = 1158;
+            static constexpr IntValue PredefinedType = 1159;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcingMesh_CLASS_H
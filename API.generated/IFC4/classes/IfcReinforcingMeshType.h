@@ -0,0 +1,114 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReinforcingMeshType_CLASS_H
+#define __RDF_LTD__IFC4_IfcReinforcingMeshType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcReinforcingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcReinforcingMeshType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcReinforcingMeshType : public RDF_EXPRESS_VIRTUAL IfcReinforcingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcReinforcingMeshType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcReinforcingMeshType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 515);
+        }
+
+        /// <summary>
+        /// Instances of IfcReinforcingMeshType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcReinforcingMeshType> Extent(SdaiModel model) { return ExtentRange<IfcReinforcingMeshType>(model, 515, false); }
+        static ExtentRange<IfcReinforcingMeshType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcReinforcingMeshType>(model, 515, true); }
+
+        /// <summary>
+        /// Create new instance of IfcReinforcingMeshType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcReinforcingMeshType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcReinforcingMeshType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcReinforcingMeshType if the actual type of SdaiInstance is IfcReinforcingMeshType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcReinforcingMeshType CreateExactEntity(SdaiInstance instance) { return IfcReinforcingMeshType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcReinforcingMeshType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcReinforcingMeshType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcReinforcingMeshTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1160); int v = getENUM(1160, IfcReinforcingMeshTypeEnum_hash); if (v >= 0) return (IfcReinforcingMeshTypeEnum) v; else return Nullable<IfcReinforcingMeshTypeEnum>(); }
+        void put_PredefinedType(IfcReinforcingMeshTypeEnum value) { RDF_EXPRESS_PROBE(1160); TextValue val = IfcReinforcingMeshTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1160), sdaiENUM, val); }
+
+        Nullable<IfcPositiveLengthMeasure> get_MeshLength() { RDF_EXPRESS_PROBE(1161); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1161), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_MeshLength(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1161); sdaiPutAttr(m_instance, getAttrDefinition(1161), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_MeshWidth() { RDF_EXPRESS_PROBE(1162); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1162), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_MeshWidth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1162); sdaiPutAttr(m_instance, getAttrDefinition(1162), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_LongitudinalBarNominalDiameter() { RDF_EXPRESS_PROBE(1163); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1163), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_LongitudinalBarNominalDiameter(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1163); sdaiPutAttr(m_instance, getAttrDefinition(1163), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_TransverseBarNominalDiameter() { RDF_EXPRESS_PROBE(1164); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1164), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_TransverseBarNominalDiameter(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1164); sdaiPutAttr(m_instance, getAttrDefinition(1164), sdaiREAL, &value); }
+
+        Nullable<IfcAreaMeasure> get_LongitudinalBarCrossSectionArea() { RDF_EXPRESS_PROBE(1165); IfcAreaMeasure val = (IfcAreaMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1165), sdaiREAL, &val)) return val; else return Nullable<IfcAreaMeasure>(); }
+        void put_LongitudinalBarCrossSectionArea(IfcAreaMeasure value) { RDF_EXPRESS_PROBE(1165); sdaiPutAttr(m_instance, getAttrDefinition(1165), sdaiREAL, &value); }
+
+        Nullable<IfcAreaMeasure> get_TransverseBarCrossSectionArea() { RDF_EXPRESS_PROBE(1166); IfcAreaMeasure val = (IfcAreaMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1166), sdaiREAL, &val)) return val; else return Nullable<IfcAreaMeasure>(); }
+        void put_TransverseBarCrossSectionArea(IfcAreaMeasure value) { RDF_EXPRESS_PROBE(1166); sdaiPutAttr(m_instance, getAttrDefinition(1166), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_LongitudinalBarSpacing() { RDF_EXPRESS_PROBE(1167); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1167), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_LongitudinalBarSpacing(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1167); sdaiPutAttr(m_instance, getAttrDefinition(1167), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_TransverseBarSpacing() { RDF_EXPRESS_PROBE(1168); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1168), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_TransverseBarSpacing(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1168); sdaiPutAttr(m_instance, getAttrDefinition(1168), sdaiREAL, &value); }
+
+        IfcLabel get_BendingShapeCode() { RDF_EXPRESS_PROBE(1169); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1169), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_BendingShapeCode_view() { return TextView(get_BendingShapeCode()); }
+#endif
+        void put_BendingShapeCode(IfcLabel value) { RDF_EXPRESS_PROBE(1169); sdaiPutAttr(m_instance, getAttrDefinition(1169), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_BendingShapeCode_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1169); return buffer.GetAttr(m_instance, "BendingShapeCode"); }
+        const char* get_BendingShapeCode_utf8() { return get_BendingShapeCode_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcBendingParameterSelect or list of convertible elements
+        template <typename TList> void get_BendingParameters(TList& lst) { RDF_EXPRESS_PROBE(1170); ListOfIfcBendingParameterSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1170)); }
+
+        //TList may be ListOfIfcBendingParameterSelect or list of convertible elements
+        template <typename TList> void put_BendingParameters(TList& lst) { RDF_EXPRESS_PROBE(1170); ListOfIfcBendingParameterSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1170)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcReinforcingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1160;
+            static constexpr IntValue MeshLength = 1161;
+            static constexpr IntValue MeshWidth = 1162;
+            static constexpr IntValue LongitudinalBarNominalDiameter = 1163;
+            static constexpr IntValue TransverseBarNominalDiameter = 1164;
+            static constexpr IntValue LongitudinalBarCrossSectionArea = 1165;
+            static constexpr IntValue TransverseBarCrossSectionArea = 1166;
+            static constexpr IntValue LongitudinalBarSpacing = 1167;
+            static constexpr IntValue TransverseBarSpacing = 1168;
+            static constexpr IntValue BendingShapeCode = 1169;
+            static constexpr IntValue BendingParameters = 1170;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcReinforcingMeshType_CLASS_H
@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAggregates_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAggregates_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelDecomposes.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAggregates
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAggregates : public RDF_EXPRESS_VIRTUAL IfcRelDecomposes
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAggregates
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAggregates(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 516);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAggregates in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAggregates> Extent(SdaiModel model) { return ExtentRange<IfcRelAggregates>(model, 516, false); }
+        static ExtentRange<IfcRelAggregates> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAggregates>(model, 516, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAggregates and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAggregates Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAggregates"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAggregates if the actual type of SdaiInstance is IfcRelAggregates or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAggregates CreateExactEntity(SdaiInstance instance) { return IfcRelAggregates(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAggregates or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAggregates(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcObjectDefinition get_RelatingObject();
+        void put_RelatingObject(IfcObjectDefinition inst);
+
+        //TList may be SetOfIfcObjectDefinition or list of convertible elements
+        template <typename TList> void get_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1172); SetOfIfcObjectDefinitionSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1172)); }
+
+        //TList may be SetOfIfcObjectDefinition or list of convertible elements
+        template <typename TList> void put_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1172); SetOfIfcObjectDefinitionSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1172)); }
+
+        //TArrayElem[] may be IfcObjectDefinition[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedObjects(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1172); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcObjectDefinitionSerializer<SetOfIfcObjectDefinition> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1172)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelDecomposes::attr
+        {
+            static constexpr IntValue RelatingObject = 1171;
+            static constexpr IntValue RelatedObjects = 1172;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAggregates_CLASS_H
@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssigns_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssigns_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelationship.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssigns
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssigns : public RDF_EXPRESS_VIRTUAL IfcRelationship
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssigns
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssigns(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 517);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssigns in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssigns> Extent(SdaiModel model) { return ExtentRange<IfcRelAssigns>(model, 517, false); }
+        static ExtentRange<IfcRelAssigns> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssigns>(model, 517, true); }
+
+        /// <summary>
+        /// Returns object of IfcRelAssigns if the actual type of SdaiInstance is IfcRelAssigns or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssigns CreateExactEntity(SdaiInstance instance) { return IfcRelAssigns(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssigns or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssigns(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcObjectDefinition or list of convertible elements
+        template <typename TList> void get_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1173); SetOfIfcObjectDefinitionSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1173)); }
+
+        //TList may be SetOfIfcObjectDefinition or list of convertible elements
+        template <typename TList> void put_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1173); SetOfIfcObjectDefinitionSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1173)); }
+
+        //TArrayElem[] may be IfcObjectDefinition[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedObjects(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1173); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcObjectDefinitionSerializer<SetOfIfcObjectDefinition> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1173)); }
+
+        Nullable<IfcObjectTypeEnum> get_RelatedObjectsType() { RDF_EXPRESS_PROBE(1174); int v = getENUM(1174, IfcObjectTypeEnum_hash); if (v >= 0) return (IfcObjectTypeEnum) v; else return Nullable<IfcObjectTypeEnum>(); }
+        void put_RelatedObjectsType(IfcObjectTypeEnum value) { RDF_EXPRESS_PROBE(1174); TextValue val = IfcObjectTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1174), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelationship::attr
+        {
+            static constexpr IntValue RelatedObjects = 1173;
+            static constexpr IntValue RelatedObjectsType = 1174;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssigns_CLASS_H
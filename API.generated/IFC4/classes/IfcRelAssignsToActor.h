@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToActor_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToActor_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelAssigns.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssignsToActor
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssignsToActor : public RDF_EXPRESS_VIRTUAL IfcRelAssigns
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssignsToActor
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssignsToActor(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 518);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssignsToActor in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssignsToActor> Extent(SdaiModel model) { return ExtentRange<IfcRelAssignsToActor>(model, 518, false); }
+        static ExtentRange<IfcRelAssignsToActor> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssignsToActor>(model, 518, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAssignsToActor and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAssignsToActor Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAssignsToActor"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAssignsToActor if the actual type of SdaiInstance is IfcRelAssignsToActor or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssignsToActor CreateExactEntity(SdaiInstance instance) { return IfcRelAssignsToActor(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssignsToActor or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssignsToActor(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcActor get_RelatingActor();
+        void put_RelatingActor(IfcActor inst);
+
+        IfcActorRole get_ActingRole();
+        void put_ActingRole(IfcActorRole inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelAssigns::attr
+        {
+            static constexpr IntValue RelatingActor = 1175;
+            static constexpr IntValue ActingRole = 1176;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToActor_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToControl_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToControl_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelAssigns.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssignsToControl
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssignsToControl : public RDF_EXPRESS_VIRTUAL IfcRelAssigns
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssignsToControl
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssignsToControl(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 519);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssignsToControl in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssignsToControl> Extent(SdaiModel model) { return ExtentRange<IfcRelAssignsToControl>(model, 519, false); }
+        static ExtentRange<IfcRelAssignsToControl> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssignsToControl>(model, 519, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAssignsToControl and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAssignsToControl Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAssignsToControl"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAssignsToControl if the actual type of SdaiInstance is IfcRelAssignsToControl or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssignsToControl CreateExactEntity(SdaiInstance instance) { return IfcRelAssignsToControl(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssignsToControl or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssignsToControl(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcControl get_RelatingControl();
+        void put_RelatingControl(IfcControl inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelAssigns::attr
+        {
+            static constexpr IntValue RelatingControl = 1177;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToControl_CLASS_H
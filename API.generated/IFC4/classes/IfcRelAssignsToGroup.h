@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToGroup_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToGroup_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelAssigns.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssignsToGroup
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssignsToGroup : public RDF_EXPRESS_VIRTUAL IfcRelAssigns
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssignsToGroup
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssignsToGroup(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 520);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssignsToGroup in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssignsToGroup> Extent(SdaiModel model) { return ExtentRange<IfcRelAssignsToGroup>(model, 520, false); }
+        static ExtentRange<IfcRelAssignsToGroup> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssignsToGroup>(model, 520, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAssignsToGroup and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAssignsToGroup Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAssignsToGroup"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAssignsToGroup if the actual type of SdaiInstance is IfcRelAssignsToGroup or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssignsToGroup CreateExactEntity(SdaiInstance instance) { return IfcRelAssignsToGroup(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssignsToGroup or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssignsToGroup(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcGroup get_RelatingGroup();
+        void put_RelatingGroup(IfcGroup inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelAssigns::attr
+        {
+            static constexpr IntValue RelatingGroup = 1178;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToGroup_CLASS_H
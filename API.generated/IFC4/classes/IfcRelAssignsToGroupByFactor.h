@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToGroupByFactor_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToGroupByFactor_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelAssignsToGroup.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssignsToGroupByFactor
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssignsToGroupByFactor : public RDF_EXPRESS_VIRTUAL IfcRelAssignsToGroup
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssignsToGroupByFactor
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssignsToGroupByFactor(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 521);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssignsToGroupByFactor in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssignsToGroupByFactor> Extent(SdaiModel model) { return ExtentRange<IfcRelAssignsToGroupByFactor>(model, 521, false); }
+        static ExtentRange<IfcRelAssignsToGroupByFactor> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssignsToGroupByFactor>(model, 521, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAssignsToGroupByFactor and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAssignsToGroupByFactor Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAssignsToGroupByFactor"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAssignsToGroupByFactor if the actual type of SdaiInstance is IfcRelAssignsToGroupByFactor or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssignsToGroupByFactor CreateExactEntity(SdaiInstance instance) { return IfcRelAssignsToGroupByFactor(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssignsToGroupByFactor or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssignsToGroupByFactor(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcRatioMeasure> get_Factor() { RDF_EXPRESS_PROBE(1179); IfcRatioMeasure val = (IfcRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1179), sdaiREAL, &val)) return val; else return Nullable<IfcRatioMeasure>(); }
+        void put_Factor(IfcRatioMeasure value) { RDF_EXPRESS_PROBE(1179); sdaiPutAttr(m_instance, getAttrDefinition(1179), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelAssignsToGroup::attr
+        {
+            static constexpr IntValue Factor = 1179;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToGroupByFactor_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToProcess_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToProcess_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelAssigns.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssignsToProcess
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssignsToProcess : public RDF_EXPRESS_VIRTUAL IfcRelAssigns
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssignsToProcess
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssignsToProcess(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 522);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssignsToProcess in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssignsToProcess> Extent(SdaiModel model) { return ExtentRange<IfcRelAssignsToProcess>(model, 522, false); }
+        static ExtentRange<IfcRelAssignsToProcess> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssignsToProcess>(model, 522, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAssignsToProcess and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAssignsToProcess Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAssignsToProcess"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAssignsToProcess if the actual type of SdaiInstance is IfcRelAssignsToProcess or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssignsToProcess CreateExactEntity(SdaiInstance instance) { return IfcRelAssignsToProcess(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssignsToProcess or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssignsToProcess(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcProcessSelect_get get_RelatingProcess() { return IfcProcessSelect_get(m_instance, 1180); }
+        IfcProcessSelect_put put_RelatingProcess() { return IfcProcessSelect_put(m_instance, 1180); }
+
+        IfcMeasureWithUnit get_QuantityInProcess();
+        void put_QuantityInProcess(IfcMeasureWithUnit inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelAssigns::attr
+        {
+            static constexpr IntValue RelatingProcess = 1180;
+            static constexpr IntValue QuantityInProcess = 1181;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToProcess_CLASS_H
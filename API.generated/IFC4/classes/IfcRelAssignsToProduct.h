@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToProduct_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToProduct_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelAssigns.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssignsToProduct
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssignsToProduct : public RDF_EXPRESS_VIRTUAL IfcRelAssigns
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssignsToProduct
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssignsToProduct(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 523);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssignsToProduct in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssignsToProduct> Extent(SdaiModel model) { return ExtentRange<IfcRelAssignsToProduct>(model, 523, false); }
+        static ExtentRange<IfcRelAssignsToProduct> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssignsToProduct>(model, 523, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAssignsToProduct and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAssignsToProduct Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAssignsToProduct"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAssignsToProduct if the actual type of SdaiInstance is IfcRelAssignsToProduct or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssignsToProduct CreateExactEntity(SdaiInstance instance) { return IfcRelAssignsToProduct(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssignsToProduct or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssignsToProduct(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcProductSelect_get get_RelatingProduct() { return IfcProductSelect_get(m_instance, 1182); }
+        IfcProductSelect_put put_RelatingProduct() { return IfcProductSelect_put(m_instance, 1182); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelAssigns::attr
+        {
+            static constexpr IntValue RelatingProduct = 1182;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToProduct_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssignsToResource_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssignsToResource_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelAssigns.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssignsToResource
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssignsToResource : public RDF_EXPRESS_VIRTUAL IfcRelAssigns
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssignsToResource
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssignsToResource(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 524);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssignsToResource in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssignsToResource> Extent(SdaiModel model) { return ExtentRange<IfcRelAssignsToResource>(model, 524, false); }
+        static ExtentRange<IfcRelAssignsToResource> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssignsToResource>(model, 524, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAssignsToResource and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAssignsToResource Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAssignsToResource"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAssignsToResource if the actual type of SdaiInstance is IfcRelAssignsToResource or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssignsToResource CreateExactEntity(SdaiInstance instance) { return IfcRelAssignsToResource(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssignsToResource or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssignsToResource(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcResourceSelect_get get_RelatingResource() { return IfcResourceSelect_get(m_instance, 1183); }
+        IfcResourceSelect_put put_RelatingResource() { return IfcResourceSelect_put(m_instance, 1183); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelAssigns::attr
+        {
+            static constexpr IntValue RelatingResource = 1183;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssignsToResource_CLASS_H
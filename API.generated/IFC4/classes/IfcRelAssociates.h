@@ -0,0 +1,63 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociates_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssociates_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelationship.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssociates
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssociates : public RDF_EXPRESS_VIRTUAL IfcRelationship
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssociates
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssociates(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 525);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssociates in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssociates> Extent(SdaiModel model) { return ExtentRange<IfcRelAssociates>(model, 525, false); }
+        static ExtentRange<IfcRelAssociates> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssociates>(model, 525, true); }
+
+        /// <summary>
+        /// Returns object of IfcRelAssociates if the actual type of SdaiInstance is IfcRelAssociates or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssociates CreateExactEntity(SdaiInstance instance) { return IfcRelAssociates(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssociates or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssociates(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcDefinitionSelect or list of convertible elements
+        template <typename TList> void get_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1184); SetOfIfcDefinitionSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1184)); }
+
+        //TList may be SetOfIfcDefinitionSelect or list of convertible elements
+        template <typename TList> void put_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1184); SetOfIfcDefinitionSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1184)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelationship::attr
+        {
+            static constexpr IntValue RelatedObjects = 1184;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociates_CLASS_H
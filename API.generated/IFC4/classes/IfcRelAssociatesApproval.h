@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociatesApproval_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssociatesApproval_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelAssociates.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssociatesApproval
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssociatesApproval : public RDF_EXPRESS_VIRTUAL IfcRelAssociates
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssociatesApproval
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssociatesApproval(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 526);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssociatesApproval in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssociatesApproval> Extent(SdaiModel model) { return ExtentRange<IfcRelAssociatesApproval>(model, 526, false); }
+        static ExtentRange<IfcRelAssociatesApproval> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssociatesApproval>(model, 526, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAssociatesApproval and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAssociatesApproval Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAssociatesApproval"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAssociatesApproval if the actual type of SdaiInstance is IfcRelAssociatesApproval or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssociatesApproval CreateExactEntity(SdaiInstance instance) { return IfcRelAssociatesApproval(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssociatesApproval or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssociatesApproval(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcApproval get_RelatingApproval();
+        void put_RelatingApproval(IfcApproval inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelAssociates::attr
+        {
+            static constexpr IntValue RelatingApproval = 1185;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociatesApproval_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociatesClassification_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssociatesClassification_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelAssociates.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssociatesClassification
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssociatesClassification : public RDF_EXPRESS_VIRTUAL IfcRelAssociates
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssociatesClassification
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssociatesClassification(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 527);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssociatesClassification in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssociatesClassification> Extent(SdaiModel model) { return ExtentRange<IfcRelAssociatesClassification>(model, 527, false); }
+        static ExtentRange<IfcRelAssociatesClassification> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssociatesClassification>(model, 527, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAssociatesClassification and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAssociatesClassification Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAssociatesClassification"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAssociatesClassification if the actual type of SdaiInstance is IfcRelAssociatesClassification or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssociatesClassification CreateExactEntity(SdaiInstance instance) { return IfcRelAssociatesClassification(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssociatesClassification or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssociatesClassification(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcClassificationSelect_get get_RelatingClassification() { return IfcClassificationSelect_get(m_instance, 1186); }
+        IfcClassificationSelect_put put_RelatingClassification() { return IfcClassificationSelect_put(m_instance, 1186); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelAssociates::attr
+        {
+            static constexpr IntValue RelatingClassification = 1186;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociatesClassification_CLASS_H
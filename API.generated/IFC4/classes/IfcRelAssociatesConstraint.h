@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociatesConstraint_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssociatesConstraint_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelAssociates.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssociatesConstraint
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssociatesConstraint : public RDF_EXPRESS_VIRTUAL IfcRelAssociates
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssociatesConstraint
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssociatesConstraint(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 528);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssociatesConstraint in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssociatesConstraint> Extent(SdaiModel model) { return ExtentRange<IfcRelAssociatesConstraint>(model, 528, false); }
+        static ExtentRange<IfcRelAssociatesConstraint> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssociatesConstraint>(model, 528, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAssociatesConstraint and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAssociatesConstraint Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAssociatesConstraint"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAssociatesConstraint if the actual type of SdaiInstance is IfcRelAssociatesConstraint or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssociatesConstraint CreateExactEntity(SdaiInstance instance) { return IfcRelAssociatesConstraint(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssociatesConstraint or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssociatesConstraint(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Intent() { RDF_EXPRESS_PROBE(1187); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1187), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Intent_view() { return TextView(get_Intent()); }
+#endif
+        void put_Intent(IfcLabel value) { RDF_EXPRESS_PROBE(1187); sdaiPutAttr(m_instance, getAttrDefinition(1187), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Intent_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1187); return buffer.GetAttr(m_instance, "Intent"); }
+        const char* get_Intent_utf8() { return get_Intent_utf8(ThreadUtf8Buffer()); }
+
+        IfcConstraint get_RelatingConstraint();
+        void put_RelatingConstraint(IfcConstraint inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelAssociates::attr
+        {
+            static constexpr IntValue Intent = 1187;
+            static constexpr IntValue RelatingConstraint = 1188;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociatesConstraint_CLASS_H
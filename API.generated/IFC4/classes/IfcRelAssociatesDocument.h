@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociatesDocument_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssociatesDocument_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelAssociates.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssociatesDocument
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssociatesDocument : public RDF_EXPRESS_VIRTUAL IfcRelAssociates
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssociatesDocument
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssociatesDocument(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 529);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssociatesDocument in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssociatesDocument> Extent(SdaiModel model) { return ExtentRange<IfcRelAssociatesDocument>(model, 529, false); }
+        static ExtentRange<IfcRelAssociatesDocument> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssociatesDocument>(model, 529, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAssociatesDocument and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAssociatesDocument Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAssociatesDocument"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAssociatesDocument if the actual type of SdaiInstance is IfcRelAssociatesDocument or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssociatesDocument CreateExactEntity(SdaiInstance instance) { return IfcRelAssociatesDocument(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssociatesDocument or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssociatesDocument(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDocumentSelect_get get_RelatingDocument() { return IfcDocumentSelect_get(m_instance, 1189); }
+        IfcDocumentSelect_put put_RelatingDocument() { return IfcDocumentSelect_put(m_instance, 1189); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelAssociates::attr
+        {
+            static constexpr IntValue RelatingDocument = 1189;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociatesDocument_CLASS_H
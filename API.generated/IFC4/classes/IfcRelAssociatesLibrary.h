@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociatesLibrary_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssociatesLibrary_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelAssociates.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssociatesLibrary
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssociatesLibrary : public RDF_EXPRESS_VIRTUAL IfcRelAssociates
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssociatesLibrary
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssociatesLibrary(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 530);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssociatesLibrary in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssociatesLibrary> Extent(SdaiModel model) { return ExtentRange<IfcRelAssociatesLibrary>(model, 530, false); }
+        static ExtentRange<IfcRelAssociatesLibrary> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssociatesLibrary>(model, 530, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAssociatesLibrary and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAssociatesLibrary Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAssociatesLibrary"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAssociatesLibrary if the actual type of SdaiInstance is IfcRelAssociatesLibrary or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssociatesLibrary CreateExactEntity(SdaiInstance instance) { return IfcRelAssociatesLibrary(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssociatesLibrary or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssociatesLibrary(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLibrarySelect_get get_RelatingLibrary() { return IfcLibrarySelect_get(m_instance, 1190); }
+        IfcLibrarySelect_put put_RelatingLibrary() { return IfcLibrarySelect_put(m_instance, 1190); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelAssociates::attr
+        {
+            static constexpr IntValue RelatingLibrary = 1190;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociatesLibrary_CLASS_H
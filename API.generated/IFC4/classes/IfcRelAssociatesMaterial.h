@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelAssociatesMaterial_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelAssociatesMaterial_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelAssociates.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelAssociatesMaterial
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelAssociatesMaterial : public RDF_EXPRESS_VIRTUAL IfcRelAssociates
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelAssociatesMaterial
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelAssociatesMaterial(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 531);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelAssociatesMaterial in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelAssociatesMaterial> Extent(SdaiModel model) { return ExtentRange<IfcRelAssociatesMaterial>(model, 531, false); }
+        static ExtentRange<IfcRelAssociatesMaterial> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelAssociatesMaterial>(model, 531, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelAssociatesMaterial and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelAssociatesMaterial Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelAssociatesMaterial"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelAssociatesMaterial if the actual type of SdaiInstance is IfcRelAssociatesMaterial or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelAssociatesMaterial CreateExactEntity(SdaiInstance instance) { return IfcRelAssociatesMaterial(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelAssociatesMaterial or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelAssociatesMaterial(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcMaterialSelect_get get_RelatingMaterial() { return IfcMaterialSelect_get(m_instance, 1191); }
+        IfcMaterialSelect_put put_RelatingMaterial() { return IfcMaterialSelect_put(m_instance, 1191); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelAssociates::attr
+        {
+            static constexpr IntValue RelatingMaterial = 1191;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelAssociatesMaterial_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnects_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelConnects_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelationship.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelConnects
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelConnects : public RDF_EXPRESS_VIRTUAL IfcRelationship
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelConnects
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelConnects(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 533);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelConnects in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelConnects> Extent(SdaiModel model) { return ExtentRange<IfcRelConnects>(model, 533, false); }
+        static ExtentRange<IfcRelConnects> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelConnects>(model, 533, true); }
+
+        /// <summary>
+        /// Returns object of IfcRelConnects if the actual type of SdaiInstance is IfcRelConnects or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelConnects CreateExactEntity(SdaiInstance instance) { return IfcRelConnects(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelConnects or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelConnects(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelationship::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnects_CLASS_H
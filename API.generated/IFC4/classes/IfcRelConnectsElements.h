@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsElements_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelConnectsElements_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelConnectsElements
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelConnectsElements : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelConnectsElements
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelConnectsElements(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 534);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelConnectsElements in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelConnectsElements> Extent(SdaiModel model) { return ExtentRange<IfcRelConnectsElements>(model, 534, false); }
+        static ExtentRange<IfcRelConnectsElements> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelConnectsElements>(model, 534, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelConnectsElements and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelConnectsElements Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelConnectsElements"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelConnectsElements if the actual type of SdaiInstance is IfcRelConnectsElements or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelConnectsElements CreateExactEntity(SdaiInstance instance) { return IfcRelConnectsElements(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelConnectsElements or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelConnectsElements(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcConnectionGeometry get_ConnectionGeometry();
+        void put_ConnectionGeometry(IfcConnectionGeometry inst);
+
+        IfcElement get_RelatingElement();
+        void put_RelatingElement(IfcElement inst);
+
+        IfcElement get_RelatedElement();
+        void put_RelatedElement(IfcElement inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue ConnectionGeometry = 1192;
+            static constexpr IntValue RelatingElement = 1193;
+            static constexpr IntValue RelatedElement = 1194;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsElements_CLASS_H
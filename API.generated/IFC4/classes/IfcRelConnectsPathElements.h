@@ -0,0 +1,88 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsPathElements_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelConnectsPathElements_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnectsElements.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelConnectsPathElements
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelConnectsPathElements : public RDF_EXPRESS_VIRTUAL IfcRelConnectsElements
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelConnectsPathElements
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelConnectsPathElements(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 535);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelConnectsPathElements in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelConnectsPathElements> Extent(SdaiModel model) { return ExtentRange<IfcRelConnectsPathElements>(model, 535, false); }
+        static ExtentRange<IfcRelConnectsPathElements> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelConnectsPathElements>(model, 535, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelConnectsPathElements and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelConnectsPathElements Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelConnectsPathElements"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelConnectsPathElements if the actual type of SdaiInstance is IfcRelConnectsPathElements or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelConnectsPathElements CreateExactEntity(SdaiInstance instance) { return IfcRelConnectsPathElements(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelConnectsPathElements or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelConnectsPathElements(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcInteger or list of convertible elements
+        template <typename TList> void get_RelatingPriorities(TList& lst) { RDF_EXPRESS_PROBE(1195); ListOfIfcIntegerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1195)); }
+
+        //TList may be ListOfIfcInteger or list of convertible elements
+        template <typename TList> void put_RelatingPriorities(TList& lst) { RDF_EXPRESS_PROBE(1195); ListOfIfcIntegerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1195)); }
+
+        //TArrayElem[] may be IfcInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatingPriorities(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1195); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcIntegerSerializer<ListOfIfcInteger> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1195)); }
+
+        //TList may be ListOfIfcInteger or list of convertible elements
+        template <typename TList> void get_RelatedPriorities(TList& lst) { RDF_EXPRESS_PROBE(1196); ListOfIfcIntegerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1196)); }
+
+        //TList may be ListOfIfcInteger or list of convertible elements
+        template <typename TList> void put_RelatedPriorities(TList& lst) { RDF_EXPRESS_PROBE(1196); ListOfIfcIntegerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1196)); }
+
+        //TArrayElem[] may be IfcInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedPriorities(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1196); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcIntegerSerializer<ListOfIfcInteger> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1196)); }
+
+        Nullable<IfcConnectionTypeEnum> get_RelatedConnectionType() { RDF_EXPRESS_PROBE(1197); int v = getENUM(1197, IfcConnectionTypeEnum_hash); if (v >= 0) return (IfcConnectionTypeEnum) v; else return Nullable<IfcConnectionTypeEnum>(); }
+        void put_RelatedConnectionType(IfcConnectionTypeEnum value) { RDF_EXPRESS_PROBE(1197); TextValue val = IfcConnectionTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1197), sdaiENUM, val); }
+
+        Nullable<IfcConnectionTypeEnum> get_RelatingConnectionType() { RDF_EXPRESS_PROBE(1198); int v = getENUM(1198, IfcConnectionTypeEnum_hash); if (v >= 0) return (IfcConnectionTypeEnum) v; else return Nullable<IfcConnectionTypeEnum>(); }
+        void put_RelatingConnectionType(IfcConnectionTypeEnum value) { RDF_EXPRESS_PROBE(1198); TextValue val = IfcConnectionTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1198), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnectsElements::attr
+        {
+            static constexpr IntValue RelatingPriorities = 1195;
+            static constexpr IntValue RelatedPriorities = 1196;
+            static constexpr IntValue RelatedConnectionType = 1197;
+            static constexpr IntValue RelatingConnectionType = 1198;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsPathElements_CLASS_H
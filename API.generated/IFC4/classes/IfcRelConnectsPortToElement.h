@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsPortToElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelConnectsPortToElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelConnectsPortToElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelConnectsPortToElement : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelConnectsPortToElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelConnectsPortToElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 537);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelConnectsPortToElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelConnectsPortToElement> Extent(SdaiModel model) { return ExtentRange<IfcRelConnectsPortToElement>(model, 537, false); }
+        static ExtentRange<IfcRelConnectsPortToElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelConnectsPortToElement>(model, 537, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelConnectsPortToElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelConnectsPortToElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelConnectsPortToElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelConnectsPortToElement if the actual type of SdaiInstance is IfcRelConnectsPortToElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelConnectsPortToElement CreateExactEntity(SdaiInstance instance) { return IfcRelConnectsPortToElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelConnectsPortToElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelConnectsPortToElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcPort get_RelatingPort();
+        void put_RelatingPort(IfcPort inst);
+
+        IfcDistributionElement get_RelatedElement();
+        void put_RelatedElement(IfcDistributionElement inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatingPort = 1202;
+            static constexpr IntValue RelatedElement = 1203;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsPortToElement_CLASS_H
@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsPorts_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelConnectsPorts_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelConnectsPorts
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelConnectsPorts : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelConnectsPorts
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelConnectsPorts(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 536);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelConnectsPorts in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelConnectsPorts> Extent(SdaiModel model) { return ExtentRange<IfcRelConnectsPorts>(model, 536, false); }
+        static ExtentRange<IfcRelConnectsPorts> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelConnectsPorts>(model, 536, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelConnectsPorts and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelConnectsPorts Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelConnectsPorts"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelConnectsPorts if the actual type of SdaiInstance is IfcRelConnectsPorts or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelConnectsPorts CreateExactEntity(SdaiInstance instance) { return IfcRelConnectsPorts(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelConnectsPorts or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelConnectsPorts(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcPort get_RelatingPort();
+        void put_RelatingPort(IfcPort inst);
+
+        IfcPort get_RelatedPort();
+        void put_RelatedPort(IfcPort inst);
+
+        IfcElement get_RealizingElement();
+        void put_RealizingElement(IfcElement inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatingPort = 1199;
+            static constexpr IntValue RelatedPort = 1200;
+            static constexpr IntValue RealizingElement = 1201;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsPorts_CLASS_H
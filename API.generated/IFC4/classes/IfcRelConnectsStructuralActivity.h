@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsStructuralActivity_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelConnectsStructuralActivity_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelConnectsStructuralActivity
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelConnectsStructuralActivity : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelConnectsStructuralActivity
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelConnectsStructuralActivity(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 538);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelConnectsStructuralActivity in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelConnectsStructuralActivity> Extent(SdaiModel model) { return ExtentRange<IfcRelConnectsStructuralActivity>(model, 538, false); }
+        static ExtentRange<IfcRelConnectsStructuralActivity> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelConnectsStructuralActivity>(model, 538, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelConnectsStructuralActivity and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelConnectsStructuralActivity Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelConnectsStructuralActivity"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelConnectsStructuralActivity if the actual type of SdaiInstance is IfcRelConnectsStructuralActivity or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelConnectsStructuralActivity CreateExactEntity(SdaiInstance instance) { return IfcRelConnectsStructuralActivity(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelConnectsStructuralActivity or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelConnectsStructuralActivity(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcStructuralActivityAssignmentSelect_get get_RelatingElement() { return IfcStructuralActivityAssignmentSelect_get(m_instance, 1204); }
+        IfcStructuralActivityAssignmentSelect_put put_RelatingElement() { return IfcStructuralActivityAssignmentSelect_put(m_instance, 1204); }
+
+        IfcStructuralActivity get_RelatedStructuralActivity();
+        void put_RelatedStructuralActivity(IfcStructuralActivity inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatingElement = 1204;
+            static constexpr IntValue RelatedStructuralActivity = 1205;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsStructuralActivity_CLASS_H
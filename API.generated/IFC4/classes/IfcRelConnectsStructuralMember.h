@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsStructuralMember_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelConnectsStructuralMember_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelConnectsStructuralMember
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelConnectsStructuralMember : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelConnectsStructuralMember
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelConnectsStructuralMember(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 539);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelConnectsStructuralMember in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelConnectsStructuralMember> Extent(SdaiModel model) { return ExtentRange<IfcRelConnectsStructuralMember>(model, 539, false); }
+        static ExtentRange<IfcRelConnectsStructuralMember> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelConnectsStructuralMember>(model, 539, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelConnectsStructuralMember and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelConnectsStructuralMember Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelConnectsStructuralMember"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelConnectsStructuralMember if the actual type of SdaiInstance is IfcRelConnectsStructuralMember or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelConnectsStructuralMember CreateExactEntity(SdaiInstance instance) { return IfcRelConnectsStructuralMember(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelConnectsStructuralMember or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelConnectsStructuralMember(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcStructuralMember get_RelatingStructuralMember();
+        void put_RelatingStructuralMember(IfcStructuralMember inst);
+
+        IfcStructuralConnection get_RelatedStructuralConnection();
+        void put_RelatedStructuralConnection(IfcStructuralConnection inst);
+
+        IfcBoundaryCondition get_AppliedCondition();
+        void put_AppliedCondition(IfcBoundaryCondition inst);
+
+        IfcStructuralConnectionCondition get_AdditionalConditions();
+        void put_AdditionalConditions(IfcStructuralConnectionCondition inst);
+
+        Nullable<IfcLengthMeasure> get_SupportedLength() { RDF_EXPRESS_PROBE(1210); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1210), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_SupportedLength(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1210); sdaiPutAttr(m_instance, getAttrDefinition(1210), sdaiREAL, &value); }
+
+        IfcAxis2Placement3D get_ConditionCoordinateSystem();
+        void put_ConditionCoordinateSystem(IfcAxis2Placement3D inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatingStructuralMember = 1206;
+            static constexpr IntValue RelatedStructuralConnection = 1207;
+            static constexpr IntValue AppliedCondition = 1208;
+            static constexpr IntValue AdditionalConditions = 1209;
+            static constexpr IntValue SupportedLength = 1210;
+            static constexpr IntValue ConditionCoordinateSystem = 1211;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsStructuralMember_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsWithEccentricity_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelConnectsWithEccentricity_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnectsStructuralMember.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelConnectsWithEccentricity
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelConnectsWithEccentricity : public RDF_EXPRESS_VIRTUAL IfcRelConnectsStructuralMember
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelConnectsWithEccentricity
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelConnectsWithEccentricity(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 540);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelConnectsWithEccentricity in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelConnectsWithEccentricity> Extent(SdaiModel model) { return ExtentRange<IfcRelConnectsWithEccentricity>(model, 540, false); }
+        static ExtentRange<IfcRelConnectsWithEccentricity> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelConnectsWithEccentricity>(model, 540, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelConnectsWithEccentricity and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelConnectsWithEccentricity Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelConnectsWithEccentricity"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelConnectsWithEccentricity if the actual type of SdaiInstance is IfcRelConnectsWithEccentricity or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelConnectsWithEccentricity CreateExactEntity(SdaiInstance instance) { return IfcRelConnectsWithEccentricity(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelConnectsWithEccentricity or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelConnectsWithEccentricity(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcConnectionGeometry get_ConnectionConstraint();
+        void put_ConnectionConstraint(IfcConnectionGeometry inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnectsStructuralMember::attr
+        {
+            static constexpr IntValue ConnectionConstraint = 1212;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsWithEccentricity_CLASS_H
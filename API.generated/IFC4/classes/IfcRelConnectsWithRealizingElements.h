@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelConnectsWithRealizingElements_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelConnectsWithRealizingElements_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnectsElements.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelConnectsWithRealizingElements
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelConnectsWithRealizingElements : public RDF_EXPRESS_VIRTUAL IfcRelConnectsElements
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelConnectsWithRealizingElements
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelConnectsWithRealizingElements(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 541);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelConnectsWithRealizingElements in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelConnectsWithRealizingElements> Extent(SdaiModel model) { return ExtentRange<IfcRelConnectsWithRealizingElements>(model, 541, false); }
+        static ExtentRange<IfcRelConnectsWithRealizingElements> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelConnectsWithRealizingElements>(model, 541, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelConnectsWithRealizingElements and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelConnectsWithRealizingElements Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelConnectsWithRealizingElements"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelConnectsWithRealizingElements if the actual type of SdaiInstance is IfcRelConnectsWithRealizingElements or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelConnectsWithRealizingElements CreateExactEntity(SdaiInstance instance) { return IfcRelConnectsWithRealizingElements(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelConnectsWithRealizingElements or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelConnectsWithRealizingElements(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcElement or list of convertible elements
+        template <typename TList> void get_RealizingElements(TList& lst) { RDF_EXPRESS_PROBE(1213); SetOfIfcElementSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1213)); }
+
+        //TList may be SetOfIfcElement or list of convertible elements
+        template <typename TList> void put_RealizingElements(TList& lst) { RDF_EXPRESS_PROBE(1213); SetOfIfcElementSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1213)); }
+
+        //TArrayElem[] may be IfcElement[] or array of convertible elements
+        template <typename TArrayElem> void put_RealizingElements(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1213); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcElementSerializer<SetOfIfcElement> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1213)); }
+
+        IfcLabel get_ConnectionType() { RDF_EXPRESS_PROBE(1214); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1214), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ConnectionType_view() { return TextView(get_ConnectionType()); }
+#endif
+        void put_ConnectionType(IfcLabel value) { RDF_EXPRESS_PROBE(1214); sdaiPutAttr(m_instance, getAttrDefinition(1214), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ConnectionType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1214); return buffer.GetAttr(m_instance, "ConnectionType"); }
+        const char* get_ConnectionType_utf8() { return get_ConnectionType_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnectsElements::attr
+        {
+            static constexpr IntValue RealizingElements = 1213;
+            static constexpr IntValue ConnectionType = 1214;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelConnectsWithRealizingElements_CLASS_H
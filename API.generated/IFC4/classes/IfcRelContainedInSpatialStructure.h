@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelContainedInSpatialStructure_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelContainedInSpatialStructure_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelContainedInSpatialStructure
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelContainedInSpatialStructure : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelContainedInSpatialStructure
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelContainedInSpatialStructure(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 542);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelContainedInSpatialStructure in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelContainedInSpatialStructure> Extent(SdaiModel model) { return ExtentRange<IfcRelContainedInSpatialStructure>(model, 542, false); }
+        static ExtentRange<IfcRelContainedInSpatialStructure> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelContainedInSpatialStructure>(model, 542, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelContainedInSpatialStructure and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelContainedInSpatialStructure Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelContainedInSpatialStructure"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelContainedInSpatialStructure if the actual type of SdaiInstance is IfcRelContainedInSpatialStructure or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelContainedInSpatialStructure CreateExactEntity(SdaiInstance instance) { return IfcRelContainedInSpatialStructure(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelContainedInSpatialStructure or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelContainedInSpatialStructure(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcProduct or list of convertible elements
+        template <typename TList> void get_RelatedElements(TList& lst) { RDF_EXPRESS_PROBE(1215); SetOfIfcProductSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1215)); }
+
+        //TList may be SetOfIfcProduct or list of convertible elements
+        template <typename TList> void put_RelatedElements(TList& lst) { RDF_EXPRESS_PROBE(1215); SetOfIfcProductSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1215)); }
+
+        //TArrayElem[] may be IfcProduct[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedElements(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1215); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcProductSerializer<SetOfIfcProduct> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1215)); }
+
+        IfcSpatialElement get_RelatingStructure();
+        void put_RelatingStructure(IfcSpatialElement inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatedElements = 1215;
+            static constexpr IntValue RelatingStructure = 1216;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelContainedInSpatialStructure_CLASS_H
@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelCoversBldgElements_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelCoversBldgElements_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelCoversBldgElements
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelCoversBldgElements : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelCoversBldgElements
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelCoversBldgElements(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 543);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelCoversBldgElements in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelCoversBldgElements> Extent(SdaiModel model) { return ExtentRange<IfcRelCoversBldgElements>(model, 543, false); }
+        static ExtentRange<IfcRelCoversBldgElements> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelCoversBldgElements>(model, 543, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelCoversBldgElements and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelCoversBldgElements Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelCoversBldgElements"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelCoversBldgElements if the actual type of SdaiInstance is IfcRelCoversBldgElements or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelCoversBldgElements CreateExactEntity(SdaiInstance instance) { return IfcRelCoversBldgElements(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelCoversBldgElements or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelCoversBldgElements(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcElement get_RelatingBuildingElement();
+        void put_RelatingBuildingElement(IfcElement inst);
+
+        //TList may be SetOfIfcCovering or list of convertible elements
+        template <typename TList> void get_RelatedCoverings(TList& lst) { RDF_EXPRESS_PROBE(1218); SetOfIfcCoveringSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1218)); }
+
+        //TList may be SetOfIfcCovering or list of convertible elements
+        template <typename TList> void put_RelatedCoverings(TList& lst) { RDF_EXPRESS_PROBE(1218); SetOfIfcCoveringSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1218)); }
+
+        //TArrayElem[] may be IfcCovering[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedCoverings(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1218); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcCoveringSerializer<SetOfIfcCovering> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1218)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatingBuildingElement = 1217;
+            static constexpr IntValue RelatedCoverings = 1218;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelCoversBldgElements_CLASS_H
@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelCoversSpaces_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelCoversSpaces_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelCoversSpaces
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelCoversSpaces : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelCoversSpaces
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelCoversSpaces(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 544);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelCoversSpaces in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelCoversSpaces> Extent(SdaiModel model) { return ExtentRange<IfcRelCoversSpaces>(model, 544, false); }
+        static ExtentRange<IfcRelCoversSpaces> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelCoversSpaces>(model, 544, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelCoversSpaces and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelCoversSpaces Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelCoversSpaces"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelCoversSpaces if the actual type of SdaiInstance is IfcRelCoversSpaces or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelCoversSpaces CreateExactEntity(SdaiInstance instance) { return IfcRelCoversSpaces(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelCoversSpaces or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelCoversSpaces(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcSpace get_RelatingSpace();
+        void put_RelatingSpace(IfcSpace inst);
+
+        //TList may be SetOfIfcCovering or list of convertible elements
+        template <typename TList> void get_RelatedCoverings(TList& lst) { RDF_EXPRESS_PROBE(1220); SetOfIfcCoveringSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1220)); }
+
+        //TList may be SetOfIfcCovering or list of convertible elements
+        template <typename TList> void put_RelatedCoverings(TList& lst) { RDF_EXPRESS_PROBE(1220); SetOfIfcCoveringSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1220)); }
+
+        //TArrayElem[] may be IfcCovering[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedCoverings(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1220); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcCoveringSerializer<SetOfIfcCovering> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1220)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatingSpace = 1219;
+            static constexpr IntValue RelatedCoverings = 1220;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelCoversSpaces_CLASS_H
@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelDeclares_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelDeclares_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelationship.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelDeclares
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelDeclares : public RDF_EXPRESS_VIRTUAL IfcRelationship
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelDeclares
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelDeclares(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 545);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelDeclares in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelDeclares> Extent(SdaiModel model) { return ExtentRange<IfcRelDeclares>(model, 545, false); }
+        static ExtentRange<IfcRelDeclares> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelDeclares>(model, 545, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelDeclares and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelDeclares Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelDeclares"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelDeclares if the actual type of SdaiInstance is IfcRelDeclares or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelDeclares CreateExactEntity(SdaiInstance instance) { return IfcRelDeclares(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelDeclares or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelDeclares(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcContext get_RelatingContext();
+        void put_RelatingContext(IfcContext inst);
+
+        //TList may be SetOfIfcDefinitionSelect or list of convertible elements
+        template <typename TList> void get_RelatedDefinitions(TList& lst) { RDF_EXPRESS_PROBE(1222); SetOfIfcDefinitionSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1222)); }
+
+        //TList may be SetOfIfcDefinitionSelect or list of convertible elements
+        template <typename TList> void put_RelatedDefinitions(TList& lst) { RDF_EXPRESS_PROBE(1222); SetOfIfcDefinitionSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1222)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelationship::attr
+        {
+            static constexpr IntValue RelatingContext = 1221;
+            static constexpr IntValue RelatedDefinitions = 1222;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelDeclares_CLASS_H
@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelDefinesByObject_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelDefinesByObject_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelDefines.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelDefinesByObject
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelDefinesByObject : public RDF_EXPRESS_VIRTUAL IfcRelDefines
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelDefinesByObject
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelDefinesByObject(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 548);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelDefinesByObject in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelDefinesByObject> Extent(SdaiModel model) { return ExtentRange<IfcRelDefinesByObject>(model, 548, false); }
+        static ExtentRange<IfcRelDefinesByObject> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelDefinesByObject>(model, 548, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelDefinesByObject and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelDefinesByObject Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelDefinesByObject"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelDefinesByObject if the actual type of SdaiInstance is IfcRelDefinesByObject or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelDefinesByObject CreateExactEntity(SdaiInstance instance) { return IfcRelDefinesByObject(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelDefinesByObject or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelDefinesByObject(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcObject or list of convertible elements
+        template <typename TList> void get_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1223); SetOfIfcObjectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1223)); }
+
+        //TList may be SetOfIfcObject or list of convertible elements
+        template <typename TList> void put_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1223); SetOfIfcObjectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1223)); }
+
+        //TArrayElem[] may be IfcObject[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedObjects(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1223); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcObjectSerializer<SetOfIfcObject> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1223)); }
+
+        IfcObject get_RelatingObject();
+        void put_RelatingObject(IfcObject inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelDefines::attr
+        {
+            static constexpr IntValue RelatedObjects = 1223;
+            static constexpr IntValue RelatingObject = 1224;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelDefinesByObject_CLASS_H
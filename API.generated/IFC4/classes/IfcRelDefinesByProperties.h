@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelDefinesByProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelDefinesByProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelDefines.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelDefinesByProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelDefinesByProperties : public RDF_EXPRESS_VIRTUAL IfcRelDefines
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelDefinesByProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelDefinesByProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 549);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelDefinesByProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelDefinesByProperties> Extent(SdaiModel model) { return ExtentRange<IfcRelDefinesByProperties>(model, 549, false); }
+        static ExtentRange<IfcRelDefinesByProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelDefinesByProperties>(model, 549, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelDefinesByProperties and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelDefinesByProperties Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelDefinesByProperties"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelDefinesByProperties if the actual type of SdaiInstance is IfcRelDefinesByProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelDefinesByProperties CreateExactEntity(SdaiInstance instance) { return IfcRelDefinesByProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelDefinesByProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelDefinesByProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcObjectDefinition or list of convertible elements
+        template <typename TList> void get_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1225); SetOfIfcObjectDefinitionSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1225)); }
+
+        //TList may be SetOfIfcObjectDefinition or list of convertible elements
+        template <typename TList> void put_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1225); SetOfIfcObjectDefinitionSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1225)); }
+
+        //TArrayElem[] may be IfcObjectDefinition[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedObjects(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1225); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcObjectDefinitionSerializer<SetOfIfcObjectDefinition> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1225)); }
+
+        IfcPropertySetDefinitionSelect_get get_RelatingPropertyDefinition() { return IfcPropertySetDefinitionSelect_get(m_instance, 1226); }
+        IfcPropertySetDefinitionSelect_put put_RelatingPropertyDefinition() { return IfcPropertySetDefinitionSelect_put(m_instance, 1226); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelDefines::attr
+        {
+            static constexpr IntValue RelatedObjects = 1225;
+            static constexpr IntValue RelatingPropertyDefinition = 1226;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelDefinesByProperties_CLASS_H
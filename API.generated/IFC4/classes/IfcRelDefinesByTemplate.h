@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelDefinesByTemplate_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelDefinesByTemplate_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelDefines.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelDefinesByTemplate
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelDefinesByTemplate : public RDF_EXPRESS_VIRTUAL IfcRelDefines
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelDefinesByTemplate
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelDefinesByTemplate(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 550);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelDefinesByTemplate in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelDefinesByTemplate> Extent(SdaiModel model) { return ExtentRange<IfcRelDefinesByTemplate>(model, 550, false); }
+        static ExtentRange<IfcRelDefinesByTemplate> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelDefinesByTemplate>(model, 550, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelDefinesByTemplate and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelDefinesByTemplate Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelDefinesByTemplate"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelDefinesByTemplate if the actual type of SdaiInstance is IfcRelDefinesByTemplate or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelDefinesByTemplate CreateExactEntity(SdaiInstance instance) { return IfcRelDefinesByTemplate(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelDefinesByTemplate or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelDefinesByTemplate(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcPropertySetDefinition or list of convertible elements
+        template <typename TList> void get_RelatedPropertySets(TList& lst) { RDF_EXPRESS_PROBE(1227); SetOfIfcPropertySetDefinitionSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1227)); }
+
+        //TList may be SetOfIfcPropertySetDefinition or list of convertible elements
+        template <typename TList> void put_RelatedPropertySets(TList& lst) { RDF_EXPRESS_PROBE(1227); SetOfIfcPropertySetDefinitionSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1227)); }
+
+        //TArrayElem[] may be IfcPropertySetDefinition[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedPropertySets(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1227); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcPropertySetDefinitionSerializer<SetOfIfcPropertySetDefinition> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1227)); }
+
+        IfcPropertySetTemplate get_RelatingTemplate();
+        void put_RelatingTemplate(IfcPropertySetTemplate inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelDefines::attr
+        {
+            static constexpr IntValue RelatedPropertySets = 1227;
+            static constexpr IntValue RelatingTemplate = 1228;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelDefinesByTemplate_CLASS_H
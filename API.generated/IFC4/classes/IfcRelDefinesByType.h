@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelDefinesByType_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelDefinesByType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelDefines.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelDefinesByType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelDefinesByType : public RDF_EXPRESS_VIRTUAL IfcRelDefines
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelDefinesByType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelDefinesByType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 551);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelDefinesByType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelDefinesByType> Extent(SdaiModel model) { return ExtentRange<IfcRelDefinesByType>(model, 551, false); }
+        static ExtentRange<IfcRelDefinesByType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelDefinesByType>(model, 551, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelDefinesByType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelDefinesByType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelDefinesByType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelDefinesByType if the actual type of SdaiInstance is IfcRelDefinesByType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelDefinesByType CreateExactEntity(SdaiInstance instance) { return IfcRelDefinesByType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelDefinesByType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelDefinesByType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcObject or list of convertible elements
+        template <typename TList> void get_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1229); SetOfIfcObjectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1229)); }
+
+        //TList may be SetOfIfcObject or list of convertible elements
+        template <typename TList> void put_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1229); SetOfIfcObjectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1229)); }
+
+        //TArrayElem[] may be IfcObject[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedObjects(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1229); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcObjectSerializer<SetOfIfcObject> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1229)); }
+
+        IfcTypeObject get_RelatingType();
+        void put_RelatingType(IfcTypeObject inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelDefines::attr
+        {
+            static constexpr IntValue RelatedObjects = 1229;
+            static constexpr IntValue RelatingType = 1230;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelDefinesByType_CLASS_H
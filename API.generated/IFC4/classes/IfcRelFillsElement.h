@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelFillsElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelFillsElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelFillsElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelFillsElement : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelFillsElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelFillsElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 552);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelFillsElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelFillsElement> Extent(SdaiModel model) { return ExtentRange<IfcRelFillsElement>(model, 552, false); }
+        static ExtentRange<IfcRelFillsElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelFillsElement>(model, 552, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelFillsElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelFillsElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelFillsElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelFillsElement if the actual type of SdaiInstance is IfcRelFillsElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelFillsElement CreateExactEntity(SdaiInstance instance) { return IfcRelFillsElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelFillsElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelFillsElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcOpeningElement get_RelatingOpeningElement();
+        void put_RelatingOpeningElement(IfcOpeningElement inst);
+
+        IfcElement get_RelatedBuildingElement();
+        void put_RelatedBuildingElement(IfcElement inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatingOpeningElement = 1231;
+            static constexpr IntValue RelatedBuildingElement = 1232;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelFillsElement_CLASS_H
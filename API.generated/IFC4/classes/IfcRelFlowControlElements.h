@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelFlowControlElements_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelFlowControlElements_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelFlowControlElements
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelFlowControlElements : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelFlowControlElements
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelFlowControlElements(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 553);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelFlowControlElements in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelFlowControlElements> Extent(SdaiModel model) { return ExtentRange<IfcRelFlowControlElements>(model, 553, false); }
+        static ExtentRange<IfcRelFlowControlElements> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelFlowControlElements>(model, 553, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelFlowControlElements and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelFlowControlElements Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelFlowControlElements"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelFlowControlElements if the actual type of SdaiInstance is IfcRelFlowControlElements or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelFlowControlElements CreateExactEntity(SdaiInstance instance) { return IfcRelFlowControlElements(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelFlowControlElements or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelFlowControlElements(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcDistributionControlElement or list of convertible elements
+        template <typename TList> void get_RelatedControlElements(TList& lst) { RDF_EXPRESS_PROBE(1233); SetOfIfcDistributionControlElementSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1233)); }
+
+        //TList may be SetOfIfcDistributionControlElement or list of convertible elements
+        template <typename TList> void put_RelatedControlElements(TList& lst) { RDF_EXPRESS_PROBE(1233); SetOfIfcDistributionControlElementSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1233)); }
+
+        //TArrayElem[] may be IfcDistributionControlElement[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedControlElements(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1233); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcDistributionControlElementSerializer<SetOfIfcDistributionControlElement> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1233)); }
+
+        IfcDistributionFlowElement get_RelatingFlowElement();
+        void put_RelatingFlowElement(IfcDistributionFlowElement inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatedControlElements = 1233;
+            static constexpr IntValue RelatingFlowElement = 1234;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelFlowControlElements_CLASS_H
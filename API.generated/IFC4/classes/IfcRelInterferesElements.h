@@ -0,0 +1,87 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelInterferesElements_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelInterferesElements_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelInterferesElements
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelInterferesElements : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelInterferesElements
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelInterferesElements(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 554);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelInterferesElements in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelInterferesElements> Extent(SdaiModel model) { return ExtentRange<IfcRelInterferesElements>(model, 554, false); }
+        static ExtentRange<IfcRelInterferesElements> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelInterferesElements>(model, 554, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelInterferesElements and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelInterferesElements Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelInterferesElements"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelInterferesElements if the actual type of SdaiInstance is IfcRelInterferesElements or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelInterferesElements CreateExactEntity(SdaiInstance instance) { return IfcRelInterferesElements(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelInterferesElements or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelInterferesElements(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcElement get_RelatingElement();
+        void put_RelatingElement(IfcElement inst);
+
+        IfcElement get_RelatedElement();
+        void put_RelatedElement(IfcElement inst);
+
+        IfcConnectionGeometry get_InterferenceGeometry();
+        void put_InterferenceGeometry(IfcConnectionGeometry inst);
+
+        IfcIdentifier get_InterferenceType() { RDF_EXPRESS_PROBE(1238); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1238), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_InterferenceType_view() { return TextView(get_InterferenceType()); }
+#endif
+        void put_InterferenceType(IfcIdentifier value) { RDF_EXPRESS_PROBE(1238); sdaiPutAttr(m_instance, getAttrDefinition(1238), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_InterferenceType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1238); return buffer.GetAttr(m_instance, "InterferenceType"); }
+        const char* get_InterferenceType_utf8() { return get_InterferenceType_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<LOGICAL_VALUE> get_ImpliedOrder() { RDF_EXPRESS_PROBE(1239); int v = getENUM(1239, LOGICAL_VALUE_hash); if (v >= 0) return (LOGICAL_VALUE) v; else return Nullable<LOGICAL_VALUE>(); }
+        void put_ImpliedOrder(LOGICAL_VALUE value) { RDF_EXPRESS_PROBE(1239); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1239), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatingElement = 1235;
+            static constexpr IntValue RelatedElement = 1236;
+            static constexpr IntValue InterferenceGeometry = 1237;
+            static constexpr IntValue InterferenceType = 1238;
+            static constexpr IntValue ImpliedOrder = 1239;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelInterferesElements_CLASS_H
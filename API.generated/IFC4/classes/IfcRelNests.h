@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelNests_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelNests_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelDecomposes.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelNests
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelNests : public RDF_EXPRESS_VIRTUAL IfcRelDecomposes
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelNests
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelNests(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 555);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelNests in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelNests> Extent(SdaiModel model) { return ExtentRange<IfcRelNests>(model, 555, false); }
+        static ExtentRange<IfcRelNests> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelNests>(model, 555, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelNests and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelNests Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelNests"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelNests if the actual type of SdaiInstance is IfcRelNests or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelNests CreateExactEntity(SdaiInstance instance) { return IfcRelNests(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelNests or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelNests(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcObjectDefinition get_RelatingObject();
+        void put_RelatingObject(IfcObjectDefinition inst);
+
+        //TList may be ListOfIfcObjectDefinition or list of convertible elements
+        template <typename TList> void get_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1241); ListOfIfcObjectDefinitionSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1241)); }
+
+        //TList may be ListOfIfcObjectDefinition or list of convertible elements
+        template <typename TList> void put_RelatedObjects(TList& lst) { RDF_EXPRESS_PROBE(1241); ListOfIfcObjectDefinitionSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1241)); }
+
+        //TArrayElem[] may be IfcObjectDefinition[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedObjects(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1241); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcObjectDefinitionSerializer<ListOfIfcObjectDefinition> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1241)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelDecomposes::attr
+        {
+            static constexpr IntValue RelatingObject = 1240;
+            static constexpr IntValue RelatedObjects = 1241;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelNests_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelProjectsElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelProjectsElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelDecomposes.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelProjectsElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelProjectsElement : public RDF_EXPRESS_VIRTUAL IfcRelDecomposes
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelProjectsElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelProjectsElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 556);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelProjectsElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelProjectsElement> Extent(SdaiModel model) { return ExtentRange<IfcRelProjectsElement>(model, 556, false); }
+        static ExtentRange<IfcRelProjectsElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelProjectsElement>(model, 556, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelProjectsElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelProjectsElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelProjectsElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelProjectsElement if the actual type of SdaiInstance is IfcRelProjectsElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelProjectsElement CreateExactEntity(SdaiInstance instance) { return IfcRelProjectsElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelProjectsElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelProjectsElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcElement get_RelatingElement();
+        void put_RelatingElement(IfcElement inst);
+
+        IfcFeatureElementAddition get_RelatedFeatureElement();
+        void put_RelatedFeatureElement(IfcFeatureElementAddition inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelDecomposes::attr
+        {
+            static constexpr IntValue RelatingElement = 1242;
+            static constexpr IntValue RelatedFeatureElement = 1243;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelProjectsElement_CLASS_H
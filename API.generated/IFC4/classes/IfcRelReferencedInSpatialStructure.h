@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelReferencedInSpatialStructure_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelReferencedInSpatialStructure_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelReferencedInSpatialStructure
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelReferencedInSpatialStructure : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelReferencedInSpatialStructure
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelReferencedInSpatialStructure(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 557);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelReferencedInSpatialStructure in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelReferencedInSpatialStructure> Extent(SdaiModel model) { return ExtentRange<IfcRelReferencedInSpatialStructure>(model, 557, false); }
+        static ExtentRange<IfcRelReferencedInSpatialStructure> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelReferencedInSpatialStructure>(model, 557, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelReferencedInSpatialStructure and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelReferencedInSpatialStructure Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelReferencedInSpatialStructure"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelReferencedInSpatialStructure if the actual type of SdaiInstance is IfcRelReferencedInSpatialStructure or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelReferencedInSpatialStructure CreateExactEntity(SdaiInstance instance) { return IfcRelReferencedInSpatialStructure(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelReferencedInSpatialStructure or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelReferencedInSpatialStructure(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcProduct or list of convertible elements
+        template <typename TList> void get_RelatedElements(TList& lst) { RDF_EXPRESS_PROBE(1244); SetOfIfcProductSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1244)); }
+
+        //TList may be SetOfIfcProduct or list of convertible elements
+        template <typename TList> void put_RelatedElements(TList& lst) { RDF_EXPRESS_PROBE(1244); SetOfIfcProductSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1244)); }
+
+        //TArrayElem[] may be IfcProduct[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedElements(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1244); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcProductSerializer<SetOfIfcProduct> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1244)); }
+
+        IfcSpatialElement get_RelatingStructure();
+        void put_RelatingStructure(IfcSpatialElement inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatedElements = 1244;
+            static constexpr IntValue RelatingStructure = 1245;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelReferencedInSpatialStructure_CLASS_H
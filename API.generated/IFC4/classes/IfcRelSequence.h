@@ -0,0 +1,87 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelSequence_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelSequence_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelSequence
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelSequence : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelSequence
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelSequence(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 558);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelSequence in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelSequence> Extent(SdaiModel model) { return ExtentRange<IfcRelSequence>(model, 558, false); }
+        static ExtentRange<IfcRelSequence> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelSequence>(model, 558, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelSequence and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelSequence Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelSequence"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelSequence if the actual type of SdaiInstance is IfcRelSequence or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelSequence CreateExactEntity(SdaiInstance instance) { return IfcRelSequence(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelSequence or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelSequence(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcProcess get_RelatingProcess();
+        void put_RelatingProcess(IfcProcess inst);
+
+        IfcProcess get_RelatedProcess();
+        void put_RelatedProcess(IfcProcess inst);
+
+        IfcLagTime get_TimeLag();
+        void put_TimeLag(IfcLagTime inst);
+
+        Nullable<IfcSequenceEnum> get_SequenceType() { RDF_EXPRESS_PROBE(1249); int v = getENUM(1249, IfcSequenceEnum_hash); if (v >= 0) return (IfcSequenceEnum) v; else return Nullable<IfcSequenceEnum>(); }
+        void put_SequenceType(IfcSequenceEnum value) { RDF_EXPRESS_PROBE(1249); TextValue val = IfcSequenceEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1249), sdaiENUM, val); }
+
+        IfcLabel get_UserDefinedSequenceType() { RDF_EXPRESS_PROBE(1250); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1250), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedSequenceType_view() { return TextView(get_UserDefinedSequenceType()); }
+#endif
+        void put_UserDefinedSequenceType(IfcLabel value) { RDF_EXPRESS_PROBE(1250); sdaiPutAttr(m_instance, getAttrDefinition(1250), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedSequenceType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1250); return buffer.GetAttr(m_instance, "UserDefinedSequenceType"); }
+        const char* get_UserDefinedSequenceType_utf8() { return get_UserDefinedSequenceType_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatingProcess = 1246;
+            static constexpr IntValue RelatedProcess = 1247;
+            static constexpr IntValue TimeLag = 1248;
+            static constexpr IntValue SequenceType = 1249;
+            static constexpr IntValue UserDefinedSequenceType = 1250;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelSequence_CLASS_H
@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelServicesBuildings_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelServicesBuildings_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelServicesBuildings
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelServicesBuildings : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelServicesBuildings
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelServicesBuildings(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 559);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelServicesBuildings in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelServicesBuildings> Extent(SdaiModel model) { return ExtentRange<IfcRelServicesBuildings>(model, 559, false); }
+        static ExtentRange<IfcRelServicesBuildings> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelServicesBuildings>(model, 559, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelServicesBuildings and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelServicesBuildings Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelServicesBuildings"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelServicesBuildings if the actual type of SdaiInstance is IfcRelServicesBuildings or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelServicesBuildings CreateExactEntity(SdaiInstance instance) { return IfcRelServicesBuildings(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelServicesBuildings or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelServicesBuildings(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcSystem get_RelatingSystem();
+        void put_RelatingSystem(IfcSystem inst);
+
+        //TList may be SetOfIfcSpatialElement or list of convertible elements
+        template <typename TList> void get_RelatedBuildings(TList& lst) { RDF_EXPRESS_PROBE(1252); SetOfIfcSpatialElementSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1252)); }
+
+        //TList may be SetOfIfcSpatialElement or list of convertible elements
+        template <typename TList> void put_RelatedBuildings(TList& lst) { RDF_EXPRESS_PROBE(1252); SetOfIfcSpatialElementSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1252)); }
+
+        //TArrayElem[] may be IfcSpatialElement[] or array of convertible elements
+        template <typename TArrayElem> void put_RelatedBuildings(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1252); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcSpatialElementSerializer<SetOfIfcSpatialElement> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1252)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatingSystem = 1251;
+            static constexpr IntValue RelatedBuildings = 1252;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelServicesBuildings_CLASS_H
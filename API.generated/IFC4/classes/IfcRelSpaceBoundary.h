@@ -0,0 +1,80 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelSpaceBoundary_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelSpaceBoundary_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelConnects.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelSpaceBoundary
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelSpaceBoundary : public RDF_EXPRESS_VIRTUAL IfcRelConnects
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelSpaceBoundary
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelSpaceBoundary(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 560);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelSpaceBoundary in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelSpaceBoundary> Extent(SdaiModel model) { return ExtentRange<IfcRelSpaceBoundary>(model, 560, false); }
+        static ExtentRange<IfcRelSpaceBoundary> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelSpaceBoundary>(model, 560, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelSpaceBoundary and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelSpaceBoundary Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelSpaceBoundary"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelSpaceBoundary if the actual type of SdaiInstance is IfcRelSpaceBoundary or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelSpaceBoundary CreateExactEntity(SdaiInstance instance) { return IfcRelSpaceBoundary(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelSpaceBoundary or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelSpaceBoundary(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcSpaceBoundarySelect_get get_RelatingSpace() { return IfcSpaceBoundarySelect_get(m_instance, 1253); }
+        IfcSpaceBoundarySelect_put put_RelatingSpace() { return IfcSpaceBoundarySelect_put(m_instance, 1253); }
+
+        IfcElement get_RelatedBuildingElement();
+        void put_RelatedBuildingElement(IfcElement inst);
+
+        IfcConnectionGeometry get_ConnectionGeometry();
+        void put_ConnectionGeometry(IfcConnectionGeometry inst);
+
+        Nullable<IfcPhysicalOrVirtualEnum> get_PhysicalOrVirtualBoundary() { RDF_EXPRESS_PROBE(1256); int v = getENUM(1256, IfcPhysicalOrVirtualEnum_hash); if (v >= 0) return (IfcPhysicalOrVirtualEnum) v; else return Nullable<IfcPhysicalOrVirtualEnum>(); }
+        void put_PhysicalOrVirtualBoundary(IfcPhysicalOrVirtualEnum value) { RDF_EXPRESS_PROBE(1256); TextValue val = IfcPhysicalOrVirtualEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1256), sdaiENUM, val); }
+
+        Nullable<IfcInternalOrExternalEnum> get_InternalOrExternalBoundary() { RDF_EXPRESS_PROBE(1257); int v = getENUM(1257, IfcInternalOrExternalEnum_hash); if (v >= 0) return (IfcInternalOrExternalEnum) v; else return Nullable<IfcInternalOrExternalEnum>(); }
+        void put_InternalOrExternalBoundary(IfcInternalOrExternalEnum value) { RDF_EXPRESS_PROBE(1257); TextValue val = IfcInternalOrExternalEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1257), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelConnects::attr
+        {
+            static constexpr IntValue RelatingSpace = 1253;
+            static constexpr IntValue RelatedBuildingElement = 1254;
+            static constexpr IntValue ConnectionGeometry = 1255;
+            static constexpr IntValue PhysicalOrVirtualBoundary = 1256;
+            static constexpr IntValue InternalOrExternalBoundary = 1257;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelSpaceBoundary_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelSpaceBoundary1stLevel_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelSpaceBoundary1stLevel_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelSpaceBoundary.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelSpaceBoundary1stLevel
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelSpaceBoundary1stLevel : public RDF_EXPRESS_VIRTUAL IfcRelSpaceBoundary
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelSpaceBoundary1stLevel
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelSpaceBoundary1stLevel(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 561);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelSpaceBoundary1stLevel in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelSpaceBoundary1stLevel> Extent(SdaiModel model) { return ExtentRange<IfcRelSpaceBoundary1stLevel>(model, 561, false); }
+        static ExtentRange<IfcRelSpaceBoundary1stLevel> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelSpaceBoundary1stLevel>(model, 561, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelSpaceBoundary1stLevel and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelSpaceBoundary1stLevel Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelSpaceBoundary1stLevel"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelSpaceBoundary1stLevel if the actual type of SdaiInstance is IfcRelSpaceBoundary1stLevel or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelSpaceBoundary1stLevel CreateExactEntity(SdaiInstance instance) { return IfcRelSpaceBoundary1stLevel(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelSpaceBoundary1stLevel or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelSpaceBoundary1stLevel(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcRelSpaceBoundary1stLevel get_ParentBoundary();
+        void put_ParentBoundary(IfcRelSpaceBoundary1stLevel inst);
+
+        //TList may be SetOfIfcRelSpaceBoundary1stLevel or list of convertible elements
+        template <typename TList> void get_InnerBoundaries(TList& lst) { RDF_EXPRESS_PROBE(1259); SetOfIfcRelSpaceBoundary1stLevelSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1259)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelSpaceBoundary::attr
+        {
+            static constexpr IntValue ParentBoundary = 1258;
+            static constexpr IntValue InnerBoundaries = 1259;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelSpaceBoundary1stLevel_CLASS_H
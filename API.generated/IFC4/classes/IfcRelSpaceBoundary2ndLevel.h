@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelSpaceBoundary2ndLevel_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelSpaceBoundary2ndLevel_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelSpaceBoundary1stLevel.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelSpaceBoundary2ndLevel
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelSpaceBoundary2ndLevel : public RDF_EXPRESS_VIRTUAL IfcRelSpaceBoundary1stLevel
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelSpaceBoundary2ndLevel
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelSpaceBoundary2ndLevel(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 562);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelSpaceBoundary2ndLevel in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelSpaceBoundary2ndLevel> Extent(SdaiModel model) { return ExtentRange<IfcRelSpaceBoundary2ndLevel>(model, 562, false); }
+        static ExtentRange<IfcRelSpaceBoundary2ndLevel> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelSpaceBoundary2ndLevel>(model, 562, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelSpaceBoundary2ndLevel and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelSpaceBoundary2ndLevel Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelSpaceBoundary2ndLevel"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelSpaceBoundary2ndLevel if the actual type of SdaiInstance is IfcRelSpaceBoundary2ndLevel or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelSpaceBoundary2ndLevel CreateExactEntity(SdaiInstance instance) { return IfcRelSpaceBoundary2ndLevel(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelSpaceBoundary2ndLevel or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelSpaceBoundary2ndLevel(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcRelSpaceBoundary2ndLevel get_CorrespondingBoundary();
+        void put_CorrespondingBoundary(IfcRelSpaceBoundary2ndLevel inst);
+
+        //TList may be SetOfIfcRelSpaceBoundary2ndLevel or list of convertible elements
+        template <typename TList> void get_Corresponds(TList& lst) { RDF_EXPRESS_PROBE(1261); SetOfIfcRelSpaceBoundary2ndLevelSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1261)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelSpaceBoundary1stLevel::attr
+        {
+            static constexpr IntValue CorrespondingBoundary = 1260;
+            static constexpr IntValue Corresponds = 1261;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelSpaceBoundary2ndLevel_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelVoidsElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelVoidsElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRelDecomposes.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelVoidsElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelVoidsElement : public RDF_EXPRESS_VIRTUAL IfcRelDecomposes
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelVoidsElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelVoidsElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 563);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelVoidsElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelVoidsElement> Extent(SdaiModel model) { return ExtentRange<IfcRelVoidsElement>(model, 563, false); }
+        static ExtentRange<IfcRelVoidsElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelVoidsElement>(model, 563, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRelVoidsElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRelVoidsElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRelVoidsElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRelVoidsElement if the actual type of SdaiInstance is IfcRelVoidsElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelVoidsElement CreateExactEntity(SdaiInstance instance) { return IfcRelVoidsElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelVoidsElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelVoidsElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcElement get_RelatingBuildingElement();
+        void put_RelatingBuildingElement(IfcElement inst);
+
+        IfcFeatureElementSubtraction get_RelatedOpeningElement();
+        void put_RelatedOpeningElement(IfcFeatureElementSubtraction inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRelDecomposes::attr
+        {
+            static constexpr IntValue RelatingBuildingElement = 1262;
+            static constexpr IntValue RelatedOpeningElement = 1263;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelVoidsElement_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRelationship_CLASS_H
+#define __RDF_LTD__IFC4_IfcRelationship_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRoot.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRelationship
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRelationship : public RDF_EXPRESS_VIRTUAL IfcRoot
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRelationship
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRelationship(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 532);
+        }
+
+        /// <summary>
+        /// Instances of IfcRelationship in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRelationship> Extent(SdaiModel model) { return ExtentRange<IfcRelationship>(model, 532, false); }
+        static ExtentRange<IfcRelationship> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRelationship>(model, 532, true); }
+
+        /// <summary>
+        /// Returns object of IfcRelationship if the actual type of SdaiInstance is IfcRelationship or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRelationship CreateExactEntity(SdaiInstance instance) { return IfcRelationship(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRelationship or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRelationship(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRoot::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRelationship_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcReparametrisedCompositeCurveSegment_CLASS_H
+#define __RDF_LTD__IFC4_IfcReparametrisedCompositeCurveSegment_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCompositeCurveSegment.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcReparametrisedCompositeCurveSegment
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcReparametrisedCompositeCurveSegment : public RDF_EXPRESS_VIRTUAL IfcCompositeCurveSegment
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcReparametrisedCompositeCurveSegment
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcReparametrisedCompositeCurveSegment(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 564);
+        }
+
+        /// <summary>
+        /// Instances of IfcReparametrisedCompositeCurveSegment in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcReparametrisedCompositeCurveSegment> Extent(SdaiModel model) { return ExtentRange<IfcReparametrisedCompositeCurveSegment>(model, 564, false); }
+        static ExtentRange<IfcReparametrisedCompositeCurveSegment> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcReparametrisedCompositeCurveSegment>(model, 564, true); }
+
+        /// <summary>
+        /// Create new instance of IfcReparametrisedCompositeCurveSegment and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcReparametrisedCompositeCurveSegment Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcReparametrisedCompositeCurveSegment"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcReparametrisedCompositeCurveSegment if the actual type of SdaiInstance is IfcReparametrisedCompositeCurveSegment or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcReparametrisedCompositeCurveSegment CreateExactEntity(SdaiInstance instance) { return IfcReparametrisedCompositeCurveSegment(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcReparametrisedCompositeCurveSegment or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcReparametrisedCompositeCurveSegment(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcParameterValue> get_ParamLength() { RDF_EXPRESS_PROBE(1264); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1264), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_ParamLength(IfcParameterValue value) { RDF_EXPRESS_PROBE(1264); sdaiPutAttr(m_instance, getAttrDefinition(1264), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCompositeCurveSegment::attr
+        {
+            static constexpr IntValue ParamLength = 1264;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcReparametrisedCompositeCurveSegment_CLASS_H
@@ -0,0 +1,103 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRepresentation_CLASS_H
+#define __RDF_LTD__IFC4_IfcRepresentation_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRepresentation
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRepresentation : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRepresentation
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRepresentation(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 565);
+        }
+
+        /// <summary>
+        /// Instances of IfcRepresentation in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRepresentation> Extent(SdaiModel model) { return ExtentRange<IfcRepresentation>(model, 565, false); }
+        static ExtentRange<IfcRepresentation> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRepresentation>(model, 565, true); }
+
+        /// <summary>
+        /// Returns object of IfcRepresentation if the actual type of SdaiInstance is IfcRepresentation or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRepresentation CreateExactEntity(SdaiInstance instance) { return IfcRepresentation(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRepresentation or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRepresentation(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcRepresentationContext get_ContextOfItems();
+        void put_ContextOfItems(IfcRepresentationContext inst);
+
+        IfcLabel get_RepresentationIdentifier() { RDF_EXPRESS_PROBE(1266); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1266), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_RepresentationIdentifier_view() { return TextView(get_RepresentationIdentifier()); }
+#endif
+        void put_RepresentationIdentifier(IfcLabel value) { RDF_EXPRESS_PROBE(1266); sdaiPutAttr(m_instance, getAttrDefinition(1266), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_RepresentationIdentifier_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1266); return buffer.GetAttr(m_instance, "RepresentationIdentifier"); }
+        const char* get_RepresentationIdentifier_utf8() { return get_RepresentationIdentifier_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_RepresentationType() { RDF_EXPRESS_PROBE(1267); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1267), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_RepresentationType_view() { return TextView(get_RepresentationType()); }
+#endif
+        void put_RepresentationType(IfcLabel value) { RDF_EXPRESS_PROBE(1267); sdaiPutAttr(m_instance, getAttrDefinition(1267), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_RepresentationType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1267); return buffer.GetAttr(m_instance, "RepresentationType"); }
+        const char* get_RepresentationType_utf8() { return get_RepresentationType_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRepresentationItem or list of convertible elements
+        template <typename TList> void get_Items(TList& lst) { RDF_EXPRESS_PROBE(1268); SetOfIfcRepresentationItemSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1268)); }
+
+        //TList may be SetOfIfcRepresentationItem or list of convertible elements
+        template <typename TList> void put_Items(TList& lst) { RDF_EXPRESS_PROBE(1268); SetOfIfcRepresentationItemSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1268)); }
+
+        //TArrayElem[] may be IfcRepresentationItem[] or array of convertible elements
+        template <typename TArrayElem> void put_Items(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1268); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcRepresentationItemSerializer<SetOfIfcRepresentationItem> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1268)); }
+
+        //TList may be SetOfIfcRepresentationMap or list of convertible elements
+        template <typename TList> void get_RepresentationMap(TList& lst) { RDF_EXPRESS_PROBE(1269); SetOfIfcRepresentationMapSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1269)); }
+
+        //TList may be SetOfIfcPresentationLayerAssignment or list of convertible elements
+        template <typename TList> void get_LayerAssignments(TList& lst) { RDF_EXPRESS_PROBE(1270); SetOfIfcPresentationLayerAssignmentSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1270)); }
+
+        //TList may be SetOfIfcProductRepresentation or list of convertible elements
+        template <typename TList> void get_OfProductRepresentation(TList& lst) { RDF_EXPRESS_PROBE(1271); SetOfIfcProductRepresentationSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1271)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue ContextOfItems = 1265;
+            static constexpr IntValue RepresentationIdentifier = 1266;
+            static constexpr IntValue RepresentationType = 1267;
+            static constexpr IntValue Items = 1268;
+            static constexpr IntValue RepresentationMap = 1269;
+            static constexpr IntValue LayerAssignments = 1270;
+            static constexpr IntValue OfProductRepresentation = 1271;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRepresentation_CLASS_H
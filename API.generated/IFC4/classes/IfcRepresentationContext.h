@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRepresentationContext_CLASS_H
+#define __RDF_LTD__IFC4_IfcRepresentationContext_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRepresentationContext
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRepresentationContext : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRepresentationContext
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRepresentationContext(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 566);
+        }
+
+        /// <summary>
+        /// Instances of IfcRepresentationContext in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRepresentationContext> Extent(SdaiModel model) { return ExtentRange<IfcRepresentationContext>(model, 566, false); }
+        static ExtentRange<IfcRepresentationContext> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRepresentationContext>(model, 566, true); }
+
+        /// <summary>
+        /// Returns object of IfcRepresentationContext if the actual type of SdaiInstance is IfcRepresentationContext or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRepresentationContext CreateExactEntity(SdaiInstance instance) { return IfcRepresentationContext(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRepresentationContext or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRepresentationContext(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_ContextIdentifier() { RDF_EXPRESS_PROBE(680); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(680), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ContextIdentifier_view() { return TextView(get_ContextIdentifier()); }
+#endif
+        void put_ContextIdentifier(IfcLabel value) { RDF_EXPRESS_PROBE(680); sdaiPutAttr(m_instance, getAttrDefinition(680), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ContextIdentifier_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(680); return buffer.GetAttr(m_instance, "ContextIdentifier"); }
+        const char* get_ContextIdentifier_utf8() { return get_ContextIdentifier_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_ContextType() { RDF_EXPRESS_PROBE(681); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(681), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ContextType_view() { return TextView(get_ContextType()); }
+#endif
+        void put_ContextType(IfcLabel value) { RDF_EXPRESS_PROBE(681); sdaiPutAttr(m_instance, getAttrDefinition(681), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ContextType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(681); return buffer.GetAttr(m_instance, "ContextType"); }
+        const char* get_ContextType_utf8() { return get_ContextType_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRepresentation or list of convertible elements
+        template <typename TList> void get_RepresentationsInContext(TList& lst) { RDF_EXPRESS_PROBE(682); SetOfIfcRepresentationSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(682)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue ContextIdentifier = 680;
+            static constexpr IntValue ContextType = 681;
+            static constexpr IntValue RepresentationsInContext = 682;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRepresentationContext_CLASS_H
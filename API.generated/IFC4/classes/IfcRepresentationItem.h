@@ -0,0 +1,63 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRepresentationItem_CLASS_H
+#define __RDF_LTD__IFC4_IfcRepresentationItem_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRepresentationItem
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRepresentationItem : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRepresentationItem
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRepresentationItem(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 567);
+        }
+
+        /// <summary>
+        /// Instances of IfcRepresentationItem in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRepresentationItem> Extent(SdaiModel model) { return ExtentRange<IfcRepresentationItem>(model, 567, false); }
+        static ExtentRange<IfcRepresentationItem> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRepresentationItem>(model, 567, true); }
+
+        /// <summary>
+        /// Returns object of IfcRepresentationItem if the actual type of SdaiInstance is IfcRepresentationItem or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRepresentationItem CreateExactEntity(SdaiInstance instance) { return IfcRepresentationItem(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRepresentationItem or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRepresentationItem(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcPresentationLayerAssignment or list of convertible elements
+        template <typename TList> void get_LayerAssignment(TList& lst) { RDF_EXPRESS_PROBE(59); SetOfIfcPresentationLayerAssignmentSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(59)); }
+
+        //TList may be SetOfIfcStyledItem or list of convertible elements
+        template <typename TList> void get_StyledByItem(TList& lst) { RDF_EXPRESS_PROBE(60); SetOfIfcStyledItemSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(60)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue LayerAssignment = 59;
+            static constexpr IntValue StyledByItem = 60;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRepresentationItem_CLASS_H
@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRepresentationMap_CLASS_H
+#define __RDF_LTD__IFC4_IfcRepresentationMap_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRepresentationMap
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRepresentationMap : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRepresentationMap
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRepresentationMap(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 568);
+        }
+
+        /// <summary>
+        /// Instances of IfcRepresentationMap in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRepresentationMap> Extent(SdaiModel model) { return ExtentRange<IfcRepresentationMap>(model, 568, false); }
+        static ExtentRange<IfcRepresentationMap> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRepresentationMap>(model, 568, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRepresentationMap and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRepresentationMap Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRepresentationMap"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRepresentationMap if the actual type of SdaiInstance is IfcRepresentationMap or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRepresentationMap CreateExactEntity(SdaiInstance instance) { return IfcRepresentationMap(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRepresentationMap or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRepresentationMap(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcAxis2Placement_get get_MappingOrigin() { return IfcAxis2Placement_get(m_instance, 1272); }
+        IfcAxis2Placement_put put_MappingOrigin() { return IfcAxis2Placement_put(m_instance, 1272); }
+
+        IfcRepresentation get_MappedRepresentation();
+        void put_MappedRepresentation(IfcRepresentation inst);
+
+        //TList may be SetOfIfcShapeAspect or list of convertible elements
+        template <typename TList> void get_HasShapeAspects(TList& lst) { RDF_EXPRESS_PROBE(1274); SetOfIfcShapeAspectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1274)); }
+
+        //TList may be SetOfIfcMappedItem or list of convertible elements
+        template <typename TList> void get_MapUsage(TList& lst) { RDF_EXPRESS_PROBE(1275); SetOfIfcMappedItemSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1275)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue MappingOrigin = 1272;
+            static constexpr IntValue MappedRepresentation = 1273;
+            static constexpr IntValue HasShapeAspects = 1274;
+            static constexpr IntValue MapUsage = 1275;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRepresentationMap_CLASS_H
@@ -0,0 +1,82 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcResource_CLASS_H
+#define __RDF_LTD__IFC4_IfcResource_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcObject.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcResource
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcResource : public RDF_EXPRESS_VIRTUAL IfcObject
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcResource
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcResource(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 569);
+        }
+
+        /// <summary>
+        /// Instances of IfcResource in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcResource> Extent(SdaiModel model) { return ExtentRange<IfcResource>(model, 569, false); }
+        static ExtentRange<IfcResource> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcResource>(model, 569, true); }
+
+        /// <summary>
+        /// Returns object of IfcResource if the actual type of SdaiInstance is IfcResource or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcResource CreateExactEntity(SdaiInstance instance) { return IfcResource(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcResource or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcResource(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Identification() { RDF_EXPRESS_PROBE(371); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(371), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Identification_view() { return TextView(get_Identification()); }
+#endif
+        void put_Identification(IfcIdentifier value) { RDF_EXPRESS_PROBE(371); sdaiPutAttr(m_instance, getAttrDefinition(371), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Identification_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(371); return buffer.GetAttr(m_instance, "Identification"); }
+        const char* get_Identification_utf8() { return get_Identification_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_LongDescription() { RDF_EXPRESS_PROBE(372); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(372), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LongDescription_view() { return TextView(get_LongDescription()); }
+#endif
+        void put_LongDescription(IfcText value) { RDF_EXPRESS_PROBE(372); sdaiPutAttr(m_instance, getAttrDefinition(372), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LongDescription_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(372); return buffer.GetAttr(m_instance, "LongDescription"); }
+        const char* get_LongDescription_utf8() { return get_LongDescription_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRelAssignsToResource or list of convertible elements
+        template <typename TList> void get_ResourceOf(TList& lst) { RDF_EXPRESS_PROBE(373); SetOfIfcRelAssignsToResourceSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(373)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcObject::attr
+        {
+            static constexpr IntValue Identification = 371;
+            static constexpr IntValue LongDescription = 372;
+            static constexpr IntValue ResourceOf = 373;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcResource_CLASS_H
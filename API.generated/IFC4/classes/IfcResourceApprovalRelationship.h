@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcResourceApprovalRelationship_CLASS_H
+#define __RDF_LTD__IFC4_IfcResourceApprovalRelationship_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcResourceLevelRelationship.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcResourceApprovalRelationship
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcResourceApprovalRelationship : public RDF_EXPRESS_VIRTUAL IfcResourceLevelRelationship
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcResourceApprovalRelationship
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcResourceApprovalRelationship(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 570);
+        }
+
+        /// <summary>
+        /// Instances of IfcResourceApprovalRelationship in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcResourceApprovalRelationship> Extent(SdaiModel model) { return ExtentRange<IfcResourceApprovalRelationship>(model, 570, false); }
+        static ExtentRange<IfcResourceApprovalRelationship> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcResourceApprovalRelationship>(model, 570, true); }
+
+        /// <summary>
+        /// Create new instance of IfcResourceApprovalRelationship and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcResourceApprovalRelationship Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcResourceApprovalRelationship"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcResourceApprovalRelationship if the actual type of SdaiInstance is IfcResourceApprovalRelationship or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcResourceApprovalRelationship CreateExactEntity(SdaiInstance instance) { return IfcResourceApprovalRelationship(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcResourceApprovalRelationship or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcResourceApprovalRelationship(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcResourceObjectSelect or list of convertible elements
+        template <typename TList> void get_RelatedResourceObjects(TList& lst) { RDF_EXPRESS_PROBE(1276); SetOfIfcResourceObjectSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1276)); }
+
+        //TList may be SetOfIfcResourceObjectSelect or list of convertible elements
+        template <typename TList> void put_RelatedResourceObjects(TList& lst) { RDF_EXPRESS_PROBE(1276); SetOfIfcResourceObjectSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1276)); }
+
+        IfcApproval get_RelatingApproval();
+        void put_RelatingApproval(IfcApproval inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcResourceLevelRelationship::attr
+        {
+            static constexpr IntValue RelatedResourceObjects = 1276;
+            static constexpr IntValue RelatingApproval = 1277;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcResourceApprovalRelationship_CLASS_H
@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcResourceConstraintRelationship_CLASS_H
+#define __RDF_LTD__IFC4_IfcResourceConstraintRelationship_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcResourceLevelRelationship.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcResourceConstraintRelationship
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcResourceConstraintRelationship : public RDF_EXPRESS_VIRTUAL IfcResourceLevelRelationship
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcResourceConstraintRelationship
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcResourceConstraintRelationship(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 571);
+        }
+
+        /// <summary>
+        /// Instances of IfcResourceConstraintRelationship in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcResourceConstraintRelationship> Extent(SdaiModel model) { return ExtentRange<IfcResourceConstraintRelationship>(model, 571, false); }
+        static ExtentRange<IfcResourceConstraintRelationship> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcResourceConstraintRelationship>(model, 571, true); }
+
+        /// <summary>
+        /// Create new instance of IfcResourceConstraintRelationship and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcResourceConstraintRelationship Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcResourceConstraintRelationship"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcResourceConstraintRelationship if the actual type of SdaiInstance is IfcResourceConstraintRelationship or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcResourceConstraintRelationship CreateExactEntity(SdaiInstance instance) { return IfcResourceConstraintRelationship(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcResourceConstraintRelationship or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcResourceConstraintRelationship(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcConstraint get_RelatingConstraint();
+        void put_RelatingConstraint(IfcConstraint inst);
+
+        //TList may be SetOfIfcResourceObjectSelect or list of convertible elements
+        template <typename TList> void get_RelatedResourceObjects(TList& lst) { RDF_EXPRESS_PROBE(1279); SetOfIfcResourceObjectSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1279)); }
+
+        //TList may be SetOfIfcResourceObjectSelect or list of convertible elements
+        template <typename TList> void put_RelatedResourceObjects(TList& lst) { RDF_EXPRESS_PROBE(1279); SetOfIfcResourceObjectSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1279)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcResourceLevelRelationship::attr
+        {
+            static constexpr IntValue RelatingConstraint = 1278;
+            static constexpr IntValue RelatedResourceObjects = 1279;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcResourceConstraintRelationship_CLASS_H
@@ -0,0 +1,190 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcResourceTime_CLASS_H
+#define __RDF_LTD__IFC4_IfcResourceTime_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSchedulingTime.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcResourceTime
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcResourceTime : public RDF_EXPRESS_VIRTUAL IfcSchedulingTime
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcResourceTime
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcResourceTime(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 573);
+        }
+
+        /// <summary>
+        /// Instances of IfcResourceTime in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcResourceTime> Extent(SdaiModel model) { return ExtentRange<IfcResourceTime>(model, 573, false); }
+        static ExtentRange<IfcResourceTime> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcResourceTime>(model, 573, true); }
+
+        /// <summary>
+        /// Create new instance of IfcResourceTime and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcResourceTime Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcResourceTime"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcResourceTime if the actual type of SdaiInstance is IfcResourceTime or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcResourceTime CreateExactEntity(SdaiInstance instance) { return IfcResourceTime(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcResourceTime or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcResourceTime(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDuration get_ScheduleWork() { RDF_EXPRESS_PROBE(1280); IfcDuration val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1280), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ScheduleWork_view() { return TextView(get_ScheduleWork()); }
+#endif
+        void put_ScheduleWork(IfcDuration value) { RDF_EXPRESS_PROBE(1280); sdaiPutAttr(m_instance, getAttrDefinition(1280), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ScheduleWork_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1280); return buffer.GetAttr(m_instance, "ScheduleWork"); }
+        const char* get_ScheduleWork_utf8() { return get_ScheduleWork_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcPositiveRatioMeasure> get_ScheduleUsage() { RDF_EXPRESS_PROBE(1281); IfcPositiveRatioMeasure val = (IfcPositiveRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1281), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveRatioMeasure>(); }
+        void put_ScheduleUsage(IfcPositiveRatioMeasure value) { RDF_EXPRESS_PROBE(1281); sdaiPutAttr(m_instance, getAttrDefinition(1281), sdaiREAL, &value); }
+
+        IfcDateTime get_ScheduleStart() { RDF_EXPRESS_PROBE(1282); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1282), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ScheduleStart_view() { return TextView(get_ScheduleStart()); }
+#endif
+        void put_ScheduleStart(IfcDateTime value) { RDF_EXPRESS_PROBE(1282); sdaiPutAttr(m_instance, getAttrDefinition(1282), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ScheduleStart_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1282); return buffer.GetAttr(m_instance, "ScheduleStart"); }
+        const char* get_ScheduleStart_utf8() { return get_ScheduleStart_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_ScheduleFinish() { RDF_EXPRESS_PROBE(1283); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1283), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ScheduleFinish_view() { return TextView(get_ScheduleFinish()); }
+#endif
+        void put_ScheduleFinish(IfcDateTime value) { RDF_EXPRESS_PROBE(1283); sdaiPutAttr(m_instance, getAttrDefinition(1283), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ScheduleFinish_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1283); return buffer.GetAttr(m_instance, "ScheduleFinish"); }
+        const char* get_ScheduleFinish_utf8() { return get_ScheduleFinish_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_ScheduleContour() { RDF_EXPRESS_PROBE(1284); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1284), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ScheduleContour_view() { return TextView(get_ScheduleContour()); }
+#endif
+        void put_ScheduleContour(IfcLabel value) { RDF_EXPRESS_PROBE(1284); sdaiPutAttr(m_instance, getAttrDefinition(1284), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ScheduleContour_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1284); return buffer.GetAttr(m_instance, "ScheduleContour"); }
+        const char* get_ScheduleContour_utf8() { return get_ScheduleContour_utf8(ThreadUtf8Buffer()); }
+
+        IfcDuration get_LevelingDelay() { RDF_EXPRESS_PROBE(1285); IfcDuration val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1285), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LevelingDelay_view() { return TextView(get_LevelingDelay()); }
+#endif
+        void put_LevelingDelay(IfcDuration value) { RDF_EXPRESS_PROBE(1285); sdaiPutAttr(m_instance, getAttrDefinition(1285), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LevelingDelay_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1285); return buffer.GetAttr(m_instance, "LevelingDelay"); }
+        const char* get_LevelingDelay_utf8() { return get_LevelingDelay_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcBoolean> get_IsOverAllocated() { RDF_EXPRESS_PROBE(1286); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1286), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_IsOverAllocated(IfcBoolean value) { RDF_EXPRESS_PROBE(1286); sdaiPutAttr(m_instance, getAttrDefinition(1286), sdaiBOOLEAN, &value); }
+
+        IfcDateTime get_StatusTime() { RDF_EXPRESS_PROBE(1287); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1287), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_StatusTime_view() { return TextView(get_StatusTime()); }
+#endif
+        void put_StatusTime(IfcDateTime value) { RDF_EXPRESS_PROBE(1287); sdaiPutAttr(m_instance, getAttrDefinition(1287), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_StatusTime_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1287); return buffer.GetAttr(m_instance, "StatusTime"); }
+        const char* get_StatusTime_utf8() { return get_StatusTime_utf8(ThreadUtf8Buffer()); }
+
+        IfcDuration get_ActualWork() { RDF_EXPRESS_PROBE(1288); IfcDuration val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1288), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ActualWork_view() { return TextView(get_ActualWork()); }
+#endif
+        void put_ActualWork(IfcDuration value) { RDF_EXPRESS_PROBE(1288); sdaiPutAttr(m_instance, getAttrDefinition(1288), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ActualWork_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1288); return buffer.GetAttr(m_instance, "ActualWork"); }
+        const char* get_ActualWork_utf8() { return get_ActualWork_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcPositiveRatioMeasure> get_ActualUsage() { RDF_EXPRESS_PROBE(1289); IfcPositiveRatioMeasure val = (IfcPositiveRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1289), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveRatioMeasure>(); }
+        void put_ActualUsage(IfcPositiveRatioMeasure value) { RDF_EXPRESS_PROBE(1289); sdaiPutAttr(m_instance, getAttrDefinition(1289), sdaiREAL, &value); }
+
+        IfcDateTime get_ActualStart() { RDF_EXPRESS_PROBE(1290); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1290), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ActualStart_view() { return TextView(get_ActualStart()); }
+#endif
+        void put_ActualStart(IfcDateTime value) { RDF_EXPRESS_PROBE(1290); sdaiPutAttr(m_instance, getAttrDefinition(1290), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ActualStart_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1290); return buffer.GetAttr(m_instance, "ActualStart"); }
+        const char* get_ActualStart_utf8() { return get_ActualStart_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_ActualFinish() { RDF_EXPRESS_PROBE(1291); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1291), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ActualFinish_view() { return TextView(get_ActualFinish()); }
+#endif
+        void put_ActualFinish(IfcDateTime value) { RDF_EXPRESS_PROBE(1291); sdaiPutAttr(m_instance, getAttrDefinition(1291), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ActualFinish_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1291); return buffer.GetAttr(m_instance, "ActualFinish"); }
+        const char* get_ActualFinish_utf8() { return get_ActualFinish_utf8(ThreadUtf8Buffer()); }
+
+        IfcDuration get_RemainingWork() { RDF_EXPRESS_PROBE(1292); IfcDuration val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1292), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_RemainingWork_view() { return TextView(get_RemainingWork()); }
+#endif
+        void put_RemainingWork(IfcDuration value) { RDF_EXPRESS_PROBE(1292); sdaiPutAttr(m_instance, getAttrDefinition(1292), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_RemainingWork_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1292); return buffer.GetAttr(m_instance, "RemainingWork"); }
+        const char* get_RemainingWork_utf8() { return get_RemainingWork_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcPositiveRatioMeasure> get_RemainingUsage() { RDF_EXPRESS_PROBE(1293); IfcPositiveRatioMeasure val = (IfcPositiveRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1293), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveRatioMeasure>(); }
+        void put_RemainingUsage(IfcPositiveRatioMeasure value) { RDF_EXPRESS_PROBE(1293); sdaiPutAttr(m_instance, getAttrDefinition(1293), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveRatioMeasure> get_Completion() { RDF_EXPRESS_PROBE(1294); IfcPositiveRatioMeasure val = (IfcPositiveRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1294), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveRatioMeasure>(); }
+        void put_Completion(IfcPositiveRatioMeasure value) { RDF_EXPRESS_PROBE(1294); sdaiPutAttr(m_instance, getAttrDefinition(1294), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSchedulingTime::attr
+        {
+            static constexpr IntValue ScheduleWork = 1280;
+            static constexpr IntValue ScheduleUsage = 1281;
+            static constexpr IntValue ScheduleStart = 1282;
+            static constexpr IntValue ScheduleFinish = 1283;
+            static constexpr IntValue ScheduleContour = 1284;
+            static constexpr IntValue LevelingDelay = 1285;
+            static constexpr IntValue IsOverAllocated = 1286;
+            static constexpr IntValue StatusTime = 1287;
+            static constexpr IntValue ActualWork = 1288;
+            static constexpr IntValue ActualUsage = 1289;
+            static constexpr IntValue ActualStart = 1290;
+            static constexpr IntValue ActualFinish = 1291;
+            static constexpr IntValue RemainingWork = 1292;
+            static constexpr IntValue RemainingUsage = 1293;
+            static constexpr IntValue Completion = 1294;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcResourceTime_CLASS_H
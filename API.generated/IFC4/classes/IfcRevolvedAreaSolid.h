@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRevolvedAreaSolid_CLASS_H
+#define __RDF_LTD__IFC4_IfcRevolvedAreaSolid_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSweptAreaSolid.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRevolvedAreaSolid
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRevolvedAreaSolid : public RDF_EXPRESS_VIRTUAL IfcSweptAreaSolid
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRevolvedAreaSolid
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRevolvedAreaSolid(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 574);
+        }
+
+        /// <summary>
+        /// Instances of IfcRevolvedAreaSolid in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRevolvedAreaSolid> Extent(SdaiModel model) { return ExtentRange<IfcRevolvedAreaSolid>(model, 574, false); }
+        static ExtentRange<IfcRevolvedAreaSolid> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRevolvedAreaSolid>(model, 574, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRevolvedAreaSolid and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRevolvedAreaSolid Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRevolvedAreaSolid"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRevolvedAreaSolid if the actual type of SdaiInstance is IfcRevolvedAreaSolid or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRevolvedAreaSolid CreateExactEntity(SdaiInstance instance) { return IfcRevolvedAreaSolid(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRevolvedAreaSolid or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRevolvedAreaSolid(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcAxis1Placement get_Axis();
+        void put_Axis(IfcAxis1Placement inst);
+
+        Nullable<IfcPlaneAngleMeasure> get_Angle() { RDF_EXPRESS_PROBE(1296); IfcPlaneAngleMeasure val = (IfcPlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1296), sdaiREAL, &val)) return val; else return Nullable<IfcPlaneAngleMeasure>(); }
+        void put_Angle(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(1296); sdaiPutAttr(m_instance, getAttrDefinition(1296), sdaiREAL, &value); }
+
+        IfcLine get_AxisLine();
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSweptAreaSolid::attr
+        {
+            static constexpr IntValue Axis = 1295;
+            static constexpr IntValue Angle = 1296;
+            static constexpr IntValue AxisLine = 1297;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRevolvedAreaSolid_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRevolvedAreaSolidTapered_CLASS_H
+#define __RDF_LTD__IFC4_IfcRevolvedAreaSolidTapered_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRevolvedAreaSolid.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRevolvedAreaSolidTapered
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRevolvedAreaSolidTapered : public RDF_EXPRESS_VIRTUAL IfcRevolvedAreaSolid
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRevolvedAreaSolidTapered
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRevolvedAreaSolidTapered(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 575);
+        }
+
+        /// <summary>
+        /// Instances of IfcRevolvedAreaSolidTapered in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRevolvedAreaSolidTapered> Extent(SdaiModel model) { return ExtentRange<IfcRevolvedAreaSolidTapered>(model, 575, false); }
+        static ExtentRange<IfcRevolvedAreaSolidTapered> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRevolvedAreaSolidTapered>(model, 575, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRevolvedAreaSolidTapered and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRevolvedAreaSolidTapered Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRevolvedAreaSolidTapered"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRevolvedAreaSolidTapered if the actual type of SdaiInstance is IfcRevolvedAreaSolidTapered or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRevolvedAreaSolidTapered CreateExactEntity(SdaiInstance instance) { return IfcRevolvedAreaSolidTapered(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRevolvedAreaSolidTapered or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRevolvedAreaSolidTapered(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcProfileDef get_EndSweptArea();
+        void put_EndSweptArea(IfcProfileDef inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRevolvedAreaSolid::attr
+        {
+            static constexpr IntValue EndSweptArea = 1298;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRevolvedAreaSolidTapered_CLASS_H
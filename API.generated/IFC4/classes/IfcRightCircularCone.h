@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRightCircularCone_CLASS_H
+#define __RDF_LTD__IFC4_IfcRightCircularCone_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCsgPrimitive3D.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRightCircularCone
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRightCircularCone : public RDF_EXPRESS_VIRTUAL IfcCsgPrimitive3D
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRightCircularCone
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRightCircularCone(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 576);
+        }
+
+        /// <summary>
+        /// Instances of IfcRightCircularCone in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRightCircularCone> Extent(SdaiModel model) { return ExtentRange<IfcRightCircularCone>(model, 576, false); }
+        static ExtentRange<IfcRightCircularCone> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRightCircularCone>(model, 576, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRightCircularCone and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRightCircularCone Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRightCircularCone"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRightCircularCone if the actual type of SdaiInstance is IfcRightCircularCone or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRightCircularCone CreateExactEntity(SdaiInstance instance) { return IfcRightCircularCone(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRightCircularCone or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRightCircularCone(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Height() { RDF_EXPRESS_PROBE(1299); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1299), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Height(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1299); sdaiPutAttr(m_instance, getAttrDefinition(1299), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_BottomRadius() { RDF_EXPRESS_PROBE(1300); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1300), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_BottomRadius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1300); sdaiPutAttr(m_instance, getAttrDefinition(1300), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCsgPrimitive3D::attr
+        {
+            static constexpr IntValue Height = 1299;
+            static constexpr IntValue BottomRadius = 1300;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRightCircularCone_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRightCircularCylinder_CLASS_H
+#define __RDF_LTD__IFC4_IfcRightCircularCylinder_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCsgPrimitive3D.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRightCircularCylinder
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRightCircularCylinder : public RDF_EXPRESS_VIRTUAL IfcCsgPrimitive3D
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRightCircularCylinder
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRightCircularCylinder(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 577);
+        }
+
+        /// <summary>
+        /// Instances of IfcRightCircularCylinder in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRightCircularCylinder> Extent(SdaiModel model) { return ExtentRange<IfcRightCircularCylinder>(model, 577, false); }
+        static ExtentRange<IfcRightCircularCylinder> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRightCircularCylinder>(model, 577, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRightCircularCylinder and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRightCircularCylinder Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRightCircularCylinder"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRightCircularCylinder if the actual type of SdaiInstance is IfcRightCircularCylinder or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRightCircularCylinder CreateExactEntity(SdaiInstance instance) { return IfcRightCircularCylinder(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRightCircularCylinder or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRightCircularCylinder(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Height() { RDF_EXPRESS_PROBE(1301); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1301), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Height(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1301); sdaiPutAttr(m_instance, getAttrDefinition(1301), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Radius() { RDF_EXPRESS_PROBE(1302); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1302), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Radius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1302); sdaiPutAttr(m_instance, getAttrDefinition(1302), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCsgPrimitive3D::attr
+        {
+            static constexpr IntValue Height = 1301;
+            static constexpr IntValue Radius = 1302;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRightCircularCylinder_CLASS_H
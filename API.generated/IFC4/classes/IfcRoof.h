@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRoof_CLASS_H
+#define __RDF_LTD__IFC4_IfcRoof_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRoof
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRoof : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRoof
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRoof(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 578);
+        }
+
+        /// <summary>
+        /// Instances of IfcRoof in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRoof> Extent(SdaiModel model) { return ExtentRange<IfcRoof>(model, 578, false); }
+        static ExtentRange<IfcRoof> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRoof>(model, 578, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRoof and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRoof Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRoof"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRoof if the actual type of SdaiInstance is IfcRoof or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRoof CreateExactEntity(SdaiInstance instance) { return IfcRoof(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRoof or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRoof(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcRoofTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1303); int v = getENUM(1303, IfcRoofTypeEnum_hash); if (v >= 0) return (IfcRoofTypeEnum) v; else return Nullable<IfcRoofTypeEnum>(); }
+        void put_PredefinedType(IfcRoofTypeEnum value) { RDF_EXPRESS_PROBE(1303); TextValue val = IfcRoofTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1303), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1303;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRoof_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRoofType_CLASS_H
+#define __RDF_LTD__IFC4_IfcRoofType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRoofType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRoofType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRoofType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRoofType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 579);
+        }
+
+        /// <summary>
+        /// Instances of IfcRoofType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRoofType> Extent(SdaiModel model) { return ExtentRange<IfcRoofType>(model, 579, false); }
+        static ExtentRange<IfcRoofType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRoofType>(model, 579, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRoofType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRoofType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRoofType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRoofType if the actual type of SdaiInstance is IfcRoofType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRoofType CreateExactEntity(SdaiInstance instance) { return IfcRoofType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRoofType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRoofType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcRoofTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1304); int v = getENUM(1304, IfcRoofTypeEnum_hash); if (v >= 0) return (IfcRoofTypeEnum) v; else return Nullable<IfcRoofTypeEnum>(); }
+        void put_PredefinedType(IfcRoofTypeEnum value) { RDF_EXPRESS_PROBE(1304); TextValue val = IfcRoofTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1304), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1304;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRoofType_CLASS_H
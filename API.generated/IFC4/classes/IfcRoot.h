@@ -0,0 +1,92 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRoot_CLASS_H
+#define __RDF_LTD__IFC4_IfcRoot_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRoot
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRoot : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRoot
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRoot(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 580);
+        }
+
+        /// <summary>
+        /// Instances of IfcRoot in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRoot> Extent(SdaiModel model) { return ExtentRange<IfcRoot>(model, 580, false); }
+        static ExtentRange<IfcRoot> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRoot>(model, 580, true); }
+
+        /// <summary>
+        /// Returns object of IfcRoot if the actual type of SdaiInstance is IfcRoot or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRoot CreateExactEntity(SdaiInstance instance) { return IfcRoot(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRoot or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRoot(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcGloballyUniqueId get_GlobalId() { RDF_EXPRESS_PROBE(0); IfcGloballyUniqueId val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(0), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_GlobalId_view() { return TextView(get_GlobalId()); }
+#endif
+        void put_GlobalId(IfcGloballyUniqueId value) { RDF_EXPRESS_PROBE(0); if (GlobalIdTable::Active()) { GlobalIdTable::OnPut(m_instance, get_GlobalId(), value); } sdaiPutAttr(m_instance, getAttrDefinition(0), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_GlobalId_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(0); return buffer.GetAttr(m_instance, "GlobalId"); }
+        const char* get_GlobalId_utf8() { return get_GlobalId_utf8(ThreadUtf8Buffer()); }
+
+        IfcOwnerHistory get_OwnerHistory();
+        void put_OwnerHistory(IfcOwnerHistory inst);
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(2); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(2), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(2); sdaiPutAttr(m_instance, getAttrDefinition(2), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(2); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(3); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(3), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(3); sdaiPutAttr(m_instance, getAttrDefinition(3), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(3); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue GlobalId = 0;
+            static constexpr IntValue OwnerHistory = 1;
+            static constexpr IntValue Name = 2;
+            static constexpr IntValue Description = 3;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRoot_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcRoundedRectangleProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcRoundedRectangleProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRectangleProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcRoundedRectangleProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcRoundedRectangleProfileDef : public RDF_EXPRESS_VIRTUAL IfcRectangleProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcRoundedRectangleProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcRoundedRectangleProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 581);
+        }
+
+        /// <summary>
+        /// Instances of IfcRoundedRectangleProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcRoundedRectangleProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcRoundedRectangleProfileDef>(model, 581, false); }
+        static ExtentRange<IfcRoundedRectangleProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcRoundedRectangleProfileDef>(model, 581, true); }
+
+        /// <summary>
+        /// Create new instance of IfcRoundedRectangleProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcRoundedRectangleProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcRoundedRectangleProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcRoundedRectangleProfileDef if the actual type of SdaiInstance is IfcRoundedRectangleProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcRoundedRectangleProfileDef CreateExactEntity(SdaiInstance instance) { return IfcRoundedRectangleProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcRoundedRectangleProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcRoundedRectangleProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_RoundingRadius() { RDF_EXPRESS_PROBE(1305); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1305), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_RoundingRadius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1305); sdaiPutAttr(m_instance, getAttrDefinition(1305), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRectangleProfileDef::attr
+        {
+            static constexpr IntValue RoundingRadius = 1305;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcRoundedRectangleProfileDef_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSIUnit_CLASS_H
+#define __RDF_LTD__IFC4_IfcSIUnit_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcNamedUnit.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSIUnit
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSIUnit : public RDF_EXPRESS_VIRTUAL IfcNamedUnit
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSIUnit
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSIUnit(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 600);
+        }
+
+        /// <summary>
+        /// Instances of IfcSIUnit in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSIUnit> Extent(SdaiModel model) { return ExtentRange<IfcSIUnit>(model, 600, false); }
+        static ExtentRange<IfcSIUnit> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSIUnit>(model, 600, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSIUnit and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSIUnit Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSIUnit"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSIUnit if the actual type of SdaiInstance is IfcSIUnit or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSIUnit CreateExactEntity(SdaiInstance instance) { return IfcSIUnit(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSIUnit or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSIUnit(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSIPrefix> get_Prefix() { RDF_EXPRESS_PROBE(1346); int v = getENUM(1346, IfcSIPrefix_hash); if (v >= 0) return (IfcSIPrefix) v; else return Nullable<IfcSIPrefix>(); }
+        void put_Prefix(IfcSIPrefix value) { RDF_EXPRESS_PROBE(1346); TextValue val = IfcSIPrefix_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1346), sdaiENUM, val); }
+
+        Nullable<IfcSIUnitName> get_Name() { RDF_EXPRESS_PROBE(1347); int v = getENUM(1347, IfcSIUnitName_hash); if (v >= 0) return (IfcSIUnitName) v; else return Nullable<IfcSIUnitName>(); }
+        void put_Name(IfcSIUnitName value) { RDF_EXPRESS_PROBE(1347); TextValue val = IfcSIUnitName_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1347), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcNamedUnit::attr
+        {
+            static constexpr IntValue Prefix = 1346;
+            static constexpr IntValue Name = 1347;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSIUnit_CLASS_H
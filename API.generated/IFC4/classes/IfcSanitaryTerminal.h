@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSanitaryTerminal_CLASS_H
+#define __RDF_LTD__IFC4_IfcSanitaryTerminal_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSanitaryTerminal
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSanitaryTerminal : public RDF_EXPRESS_VIRTUAL IfcFlowTerminal
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSanitaryTerminal
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSanitaryTerminal(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 582);
+        }
+
+        /// <summary>
+        /// Instances of IfcSanitaryTerminal in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSanitaryTerminal> Extent(SdaiModel model) { return ExtentRange<IfcSanitaryTerminal>(model, 582, false); }
+        static ExtentRange<IfcSanitaryTerminal> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSanitaryTerminal>(model, 582, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSanitaryTerminal and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSanitaryTerminal Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSanitaryTerminal"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSanitaryTerminal if the actual type of SdaiInstance is IfcSanitaryTerminal or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSanitaryTerminal CreateExactEntity(SdaiInstance instance) { return IfcSanitaryTerminal(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSanitaryTerminal or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSanitaryTerminal(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSanitaryTerminalTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1306); int v = getENUM(1306, IfcSanitaryTerminalTypeEnum_hash); if (v >= 0) return (IfcSanitaryTerminalTypeEnum) v; else return Nullable<IfcSanitaryTerminalTypeEnum>(); }
+        void put_PredefinedType(IfcSanitaryTerminalTypeEnum value) { RDF_EXPRESS_PROBE(1306); TextValue val = IfcSanitaryTerminalTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1306), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminal::attr
+        {
+            static constexpr IntValue PredefinedType = 1306;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSanitaryTerminal_CLASS_H
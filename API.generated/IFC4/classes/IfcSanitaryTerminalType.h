@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSanitaryTerminalType_CLASS_H
+#define __RDF_LTD__IFC4_IfcSanitaryTerminalType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSanitaryTerminalType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSanitaryTerminalType : public RDF_EXPRESS_VIRTUAL IfcFlowTerminalType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSanitaryTerminalType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSanitaryTerminalType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 583);
+        }
+
+        /// <summary>
+        /// Instances of IfcSanitaryTerminalType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSanitaryTerminalType> Extent(SdaiModel model) { return ExtentRange<IfcSanitaryTerminalType>(model, 583, false); }
+        static ExtentRange<IfcSanitaryTerminalType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSanitaryTerminalType>(model, 583, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSanitaryTerminalType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSanitaryTerminalType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSanitaryTerminalType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSanitaryTerminalType if the actual type of SdaiInstance is IfcSanitaryTerminalType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSanitaryTerminalType CreateExactEntity(SdaiInstance instance) { return IfcSanitaryTerminalType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSanitaryTerminalType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSanitaryTerminalType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSanitaryTerminalTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1307); int v = getENUM(1307, IfcSanitaryTerminalTypeEnum_hash); if (v >= 0) return (IfcSanitaryTerminalTypeEnum) v; else return Nullable<IfcSanitaryTerminalTypeEnum>(); }
+        void put_PredefinedType(IfcSanitaryTerminalTypeEnum value) { RDF_EXPRESS_PROBE(1307); TextValue val = IfcSanitaryTerminalTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1307), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminalType::attr
+        {
+            static constexpr IntValue PredefinedType = 1307;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSanitaryTerminalType_CLASS_H
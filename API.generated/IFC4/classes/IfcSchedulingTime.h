@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSchedulingTime_CLASS_H
+#define __RDF_LTD__IFC4_IfcSchedulingTime_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSchedulingTime
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSchedulingTime : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSchedulingTime
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSchedulingTime(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 584);
+        }
+
+        /// <summary>
+        /// Instances of IfcSchedulingTime in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSchedulingTime> Extent(SdaiModel model) { return ExtentRange<IfcSchedulingTime>(model, 584, false); }
+        static ExtentRange<IfcSchedulingTime> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSchedulingTime>(model, 584, true); }
+
+        /// <summary>
+        /// Returns object of IfcSchedulingTime if the actual type of SdaiInstance is IfcSchedulingTime or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSchedulingTime CreateExactEntity(SdaiInstance instance) { return IfcSchedulingTime(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSchedulingTime or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSchedulingTime(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(605); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(605), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(605); sdaiPutAttr(m_instance, getAttrDefinition(605), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(605); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcDataOriginEnum> get_DataOrigin() { RDF_EXPRESS_PROBE(606); int v = getENUM(606, IfcDataOriginEnum_hash); if (v >= 0) return (IfcDataOriginEnum) v; else return Nullable<IfcDataOriginEnum>(); }
+        void put_DataOrigin(IfcDataOriginEnum value) { RDF_EXPRESS_PROBE(606); TextValue val = IfcDataOriginEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(606), sdaiENUM, val); }
+
+        IfcLabel get_UserDefinedDataOrigin() { RDF_EXPRESS_PROBE(607); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(607), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedDataOrigin_view() { return TextView(get_UserDefinedDataOrigin()); }
+#endif
+        void put_UserDefinedDataOrigin(IfcLabel value) { RDF_EXPRESS_PROBE(607); sdaiPutAttr(m_instance, getAttrDefinition(607), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedDataOrigin_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(607); return buffer.GetAttr(m_instance, "UserDefinedDataOrigin"); }
+        const char* get_UserDefinedDataOrigin_utf8() { return get_UserDefinedDataOrigin_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Name = 605;
+            static constexpr IntValue DataOrigin = 606;
+            static constexpr IntValue UserDefinedDataOrigin = 607;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSchedulingTime_CLASS_H
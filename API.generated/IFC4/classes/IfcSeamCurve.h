@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSeamCurve_CLASS_H
+#define __RDF_LTD__IFC4_IfcSeamCurve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSurfaceCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSeamCurve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSeamCurve : public RDF_EXPRESS_VIRTUAL IfcSurfaceCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSeamCurve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSeamCurve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 585);
+        }
+
+        /// <summary>
+        /// Instances of IfcSeamCurve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSeamCurve> Extent(SdaiModel model) { return ExtentRange<IfcSeamCurve>(model, 585, false); }
+        static ExtentRange<IfcSeamCurve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSeamCurve>(model, 585, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSeamCurve and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSeamCurve Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSeamCurve"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSeamCurve if the actual type of SdaiInstance is IfcSeamCurve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSeamCurve CreateExactEntity(SdaiInstance instance) { return IfcSeamCurve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSeamCurve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSeamCurve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSurfaceCurve::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSeamCurve_CLASS_H
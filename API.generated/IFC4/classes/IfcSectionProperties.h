@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSectionProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcSectionProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedProperties.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSectionProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSectionProperties : public RDF_EXPRESS_VIRTUAL IfcPreDefinedProperties
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSectionProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSectionProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 587);
+        }
+
+        /// <summary>
+        /// Instances of IfcSectionProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSectionProperties> Extent(SdaiModel model) { return ExtentRange<IfcSectionProperties>(model, 587, false); }
+        static ExtentRange<IfcSectionProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSectionProperties>(model, 587, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSectionProperties and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSectionProperties Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSectionProperties"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSectionProperties if the actual type of SdaiInstance is IfcSectionProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSectionProperties CreateExactEntity(SdaiInstance instance) { return IfcSectionProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSectionProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSectionProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSectionTypeEnum> get_SectionType() { RDF_EXPRESS_PROBE(1312); int v = getENUM(1312, IfcSectionTypeEnum_hash); if (v >= 0) return (IfcSectionTypeEnum) v; else return Nullable<IfcSectionTypeEnum>(); }
+        void put_SectionType(IfcSectionTypeEnum value) { RDF_EXPRESS_PROBE(1312); TextValue val = IfcSectionTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1312), sdaiENUM, val); }
+
+        IfcProfileDef get_StartProfile();
+        void put_StartProfile(IfcProfileDef inst);
+
+        IfcProfileDef get_EndProfile();
+        void put_EndProfile(IfcProfileDef inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedProperties::attr
+        {
+            static constexpr IntValue SectionType = 1312;
+            static constexpr IntValue StartProfile = 1313;
+            static constexpr IntValue EndProfile = 1314;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSectionProperties_CLASS_H
@@ -0,0 +1,90 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSectionReinforcementProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcSectionReinforcementProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedProperties.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSectionReinforcementProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSectionReinforcementProperties : public RDF_EXPRESS_VIRTUAL IfcPreDefinedProperties
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSectionReinforcementProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSectionReinforcementProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 588);
+        }
+
+        /// <summary>
+        /// Instances of IfcSectionReinforcementProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSectionReinforcementProperties> Extent(SdaiModel model) { return ExtentRange<IfcSectionReinforcementProperties>(model, 588, false); }
+        static ExtentRange<IfcSectionReinforcementProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSectionReinforcementProperties>(model, 588, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSectionReinforcementProperties and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSectionReinforcementProperties Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSectionReinforcementProperties"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSectionReinforcementProperties if the actual type of SdaiInstance is IfcSectionReinforcementProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSectionReinforcementProperties CreateExactEntity(SdaiInstance instance) { return IfcSectionReinforcementProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSectionReinforcementProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSectionReinforcementProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLengthMeasure> get_LongitudinalStartPosition() { RDF_EXPRESS_PROBE(1315); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1315), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_LongitudinalStartPosition(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1315); sdaiPutAttr(m_instance, getAttrDefinition(1315), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_LongitudinalEndPosition() { RDF_EXPRESS_PROBE(1316); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1316), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_LongitudinalEndPosition(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1316); sdaiPutAttr(m_instance, getAttrDefinition(1316), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_TransversePosition() { RDF_EXPRESS_PROBE(1317); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1317), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_TransversePosition(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1317); sdaiPutAttr(m_instance, getAttrDefinition(1317), sdaiREAL, &value); }
+
+        Nullable<IfcReinforcingBarRoleEnum> get_ReinforcementRole() { RDF_EXPRESS_PROBE(1318); int v = getENUM(1318, IfcReinforcingBarRoleEnum_hash); if (v >= 0) return (IfcReinforcingBarRoleEnum) v; else return Nullable<IfcReinforcingBarRoleEnum>(); }
+        void put_ReinforcementRole(IfcReinforcingBarRoleEnum value) { RDF_EXPRESS_PROBE(1318); TextValue val = IfcReinforcingBarRoleEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1318), sdaiENUM, val); }
+
+        IfcSectionProperties get_SectionDefinition();
+        void put_SectionDefinition(IfcSectionProperties inst);
+
+        //TList may be SetOfIfcReinforcementBarProperties or list of convertible elements
+        template <typename TList> void get_CrossSectionReinforcementDefinitions(TList& lst) { RDF_EXPRESS_PROBE(1320); SetOfIfcReinforcementBarPropertiesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1320)); }
+
+        //TList may be SetOfIfcReinforcementBarProperties or list of convertible elements
+        template <typename TList> void put_CrossSectionReinforcementDefinitions(TList& lst) { RDF_EXPRESS_PROBE(1320); SetOfIfcReinforcementBarPropertiesSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1320)); }
+
+        //TArrayElem[] may be IfcReinforcementBarProperties[] or array of convertible elements
+        template <typename TArrayElem> void put_CrossSectionReinforcementDefinitions(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1320); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcReinforcementBarPropertiesSerializer<SetOfIfcReinforcementBarProperties> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1320)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedProperties::attr
+        {
+            static constexpr IntValue LongitudinalStartPosition = 1315;
+            static constexpr IntValue LongitudinalEndPosition = 1316;
+            static constexpr IntValue TransversePosition = 1317;
+            static constexpr IntValue ReinforcementRole = 1318;
+            static constexpr IntValue SectionDefinition = 1319;
+            static constexpr IntValue CrossSectionReinforcementDefinitions = 1320;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSectionReinforcementProperties_CLASS_H
@@ -0,0 +1,87 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSectionedSpine_CLASS_H
+#define __RDF_LTD__IFC4_IfcSectionedSpine_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSectionedSpine
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSectionedSpine : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSectionedSpine
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSectionedSpine(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 586);
+        }
+
+        /// <summary>
+        /// Instances of IfcSectionedSpine in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSectionedSpine> Extent(SdaiModel model) { return ExtentRange<IfcSectionedSpine>(model, 586, false); }
+        static ExtentRange<IfcSectionedSpine> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSectionedSpine>(model, 586, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSectionedSpine and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSectionedSpine Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSectionedSpine"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSectionedSpine if the actual type of SdaiInstance is IfcSectionedSpine or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSectionedSpine CreateExactEntity(SdaiInstance instance) { return IfcSectionedSpine(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSectionedSpine or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSectionedSpine(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCompositeCurve get_SpineCurve();
+        void put_SpineCurve(IfcCompositeCurve inst);
+
+        //TList may be ListOfIfcProfileDef or list of convertible elements
+        template <typename TList> void get_CrossSections(TList& lst) { RDF_EXPRESS_PROBE(1309); ListOfIfcProfileDefSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1309)); }
+
+        //TList may be ListOfIfcProfileDef or list of convertible elements
+        template <typename TList> void put_CrossSections(TList& lst) { RDF_EXPRESS_PROBE(1309); ListOfIfcProfileDefSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1309)); }
+
+        //TArrayElem[] may be IfcProfileDef[] or array of convertible elements
+        template <typename TArrayElem> void put_CrossSections(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1309); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcProfileDefSerializer<ListOfIfcProfileDef> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1309)); }
+
+        //TList may be ListOfIfcAxis2Placement3D or list of convertible elements
+        template <typename TList> void get_CrossSectionPositions(TList& lst) { RDF_EXPRESS_PROBE(1310); ListOfIfcAxis2Placement3DSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1310)); }
+
+        //TList may be ListOfIfcAxis2Placement3D or list of convertible elements
+        template <typename TList> void put_CrossSectionPositions(TList& lst) { RDF_EXPRESS_PROBE(1310); ListOfIfcAxis2Placement3DSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1310)); }
+
+        //TArrayElem[] may be IfcAxis2Placement3D[] or array of convertible elements
+        template <typename TArrayElem> void put_CrossSectionPositions(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1310); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcAxis2Placement3DSerializer<ListOfIfcAxis2Placement3D> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1310)); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(1311); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1311), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue SpineCurve = 1308;
+            static constexpr IntValue CrossSections = 1309;
+            static constexpr IntValue CrossSectionPositions = 1310;
+            static constexpr IntValue Dim = 1311;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSectionedSpine_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSensor_CLASS_H
+#define __RDF_LTD__IFC4_IfcSensor_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSensor
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSensor : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSensor
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSensor(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 589);
+        }
+
+        /// <summary>
+        /// Instances of IfcSensor in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSensor> Extent(SdaiModel model) { return ExtentRange<IfcSensor>(model, 589, false); }
+        static ExtentRange<IfcSensor> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSensor>(model, 589, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSensor and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSensor Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSensor"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSensor if the actual type of SdaiInstance is IfcSensor or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSensor CreateExactEntity(SdaiInstance instance) { return IfcSensor(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSensor or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSensor(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSensorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1321); int v = getENUM(1321, IfcSensorTypeEnum_hash); if (v >= 0) return (IfcSensorTypeEnum) v; else return Nullable<IfcSensorTypeEnum>(); }
+        void put_PredefinedType(IfcSensorTypeEnum value) { RDF_EXPRESS_PROBE(1321); TextValue val = IfcSensorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1321), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1321;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSensor_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSensorType_CLASS_H
+#define __RDF_LTD__IFC4_IfcSensorType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSensorType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSensorType : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSensorType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSensorType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 590);
+        }
+
+        /// <summary>
+        /// Instances of IfcSensorType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSensorType> Extent(SdaiModel model) { return ExtentRange<IfcSensorType>(model, 590, false); }
+        static ExtentRange<IfcSensorType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSensorType>(model, 590, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSensorType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSensorType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSensorType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSensorType if the actual type of SdaiInstance is IfcSensorType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSensorType CreateExactEntity(SdaiInstance instance) { return IfcSensorType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSensorType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSensorType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSensorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1322); int v = getENUM(1322, IfcSensorTypeEnum_hash); if (v >= 0) return (IfcSensorTypeEnum) v; else return Nullable<IfcSensorTypeEnum>(); }
+        void put_PredefinedType(IfcSensorTypeEnum value) { RDF_EXPRESS_PROBE(1322); TextValue val = IfcSensorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1322), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1322;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSensorType_CLASS_H
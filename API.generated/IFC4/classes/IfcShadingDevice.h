@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcShadingDevice_CLASS_H
+#define __RDF_LTD__IFC4_IfcShadingDevice_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcShadingDevice
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcShadingDevice : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcShadingDevice
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcShadingDevice(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 591);
+        }
+
+        /// <summary>
+        /// Instances of IfcShadingDevice in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcShadingDevice> Extent(SdaiModel model) { return ExtentRange<IfcShadingDevice>(model, 591, false); }
+        static ExtentRange<IfcShadingDevice> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcShadingDevice>(model, 591, true); }
+
+        /// <summary>
+        /// Create new instance of IfcShadingDevice and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcShadingDevice Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcShadingDevice"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcShadingDevice if the actual type of SdaiInstance is IfcShadingDevice or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcShadingDevice CreateExactEntity(SdaiInstance instance) { return IfcShadingDevice(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcShadingDevice or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcShadingDevice(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcShadingDeviceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1323); int v = getENUM(1323, IfcShadingDeviceTypeEnum_hash); if (v >= 0) return (IfcShadingDeviceTypeEnum) v; else return Nullable<IfcShadingDeviceTypeEnum>(); }
+        void put_PredefinedType(IfcShadingDeviceTypeEnum value) { RDF_EXPRESS_PROBE(1323); TextValue val = IfcShadingDeviceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1323), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1323;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcShadingDevice_CLASS_H
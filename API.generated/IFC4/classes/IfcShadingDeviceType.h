@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcShadingDeviceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcShadingDeviceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcShadingDeviceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcShadingDeviceType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcShadingDeviceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcShadingDeviceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 592);
+        }
+
+        /// <summary>
+        /// Instances of IfcShadingDeviceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcShadingDeviceType> Extent(SdaiModel model) { return ExtentRange<IfcShadingDeviceType>(model, 592, false); }
+        static ExtentRange<IfcShadingDeviceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcShadingDeviceType>(model, 592, true); }
+
+        /// <summary>
+        /// Create new instance of IfcShadingDeviceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcShadingDeviceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcShadingDeviceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcShadingDeviceType if the actual type of SdaiInstance is IfcShadingDeviceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcShadingDeviceType CreateExactEntity(SdaiInstance instance) { return IfcShadingDeviceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcShadingDeviceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcShadingDeviceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcShadingDeviceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1324); int v = getENUM(1324, IfcShadingDeviceTypeEnum_hash); if (v >= 0) return (IfcShadingDeviceTypeEnum) v; else return Nullable<IfcShadingDeviceTypeEnum>(); }
+        void put_PredefinedType(IfcShadingDeviceTypeEnum value) { RDF_EXPRESS_PROBE(1324); TextValue val = IfcShadingDeviceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1324), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1324;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcShadingDeviceType_CLASS_H
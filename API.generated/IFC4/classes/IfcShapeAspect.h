@@ -0,0 +1,99 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcShapeAspect_CLASS_H
+#define __RDF_LTD__IFC4_IfcShapeAspect_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcShapeAspect
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcShapeAspect : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcShapeAspect
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcShapeAspect(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 593);
+        }
+
+        /// <summary>
+        /// Instances of IfcShapeAspect in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcShapeAspect> Extent(SdaiModel model) { return ExtentRange<IfcShapeAspect>(model, 593, false); }
+        static ExtentRange<IfcShapeAspect> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcShapeAspect>(model, 593, true); }
+
+        /// <summary>
+        /// Create new instance of IfcShapeAspect and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcShapeAspect Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcShapeAspect"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcShapeAspect if the actual type of SdaiInstance is IfcShapeAspect or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcShapeAspect CreateExactEntity(SdaiInstance instance) { return IfcShapeAspect(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcShapeAspect or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcShapeAspect(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcShapeModel or list of convertible elements
+        template <typename TList> void get_ShapeRepresentations(TList& lst) { RDF_EXPRESS_PROBE(1325); ListOfIfcShapeModelSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1325)); }
+
+        //TList may be ListOfIfcShapeModel or list of convertible elements
+        template <typename TList> void put_ShapeRepresentations(TList& lst) { RDF_EXPRESS_PROBE(1325); ListOfIfcShapeModelSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1325)); }
+
+        //TArrayElem[] may be IfcShapeModel[] or array of convertible elements
+        template <typename TArrayElem> void put_ShapeRepresentations(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1325); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcShapeModelSerializer<ListOfIfcShapeModel> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1325)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(1326); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1326), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(1326); sdaiPutAttr(m_instance, getAttrDefinition(1326), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1326); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(1327); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1327), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(1327); sdaiPutAttr(m_instance, getAttrDefinition(1327), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1327); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcLogical> get_ProductDefinitional() { RDF_EXPRESS_PROBE(1328); int v = getENUM(1328, LOGICAL_VALUE_hash); if (v >= 0) return (IfcLogical) v; else return Nullable<IfcLogical>(); }
+        void put_ProductDefinitional(IfcLogical value) { RDF_EXPRESS_PROBE(1328); TextValue val = LOGICAL_VALUE_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1328), sdaiENUM, val); }
+
+        IfcProductRepresentationSelect_get get_PartOfProductDefinitionShape() { return IfcProductRepresentationSelect_get(m_instance, 1329); }
+        IfcProductRepresentationSelect_put put_PartOfProductDefinitionShape() { return IfcProductRepresentationSelect_put(m_instance, 1329); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue ShapeRepresentations = 1325;
+            static constexpr IntValue Name = 1326;
+            static constexpr IntValue Description = 1327;
+            static constexpr IntValue ProductDefinitional = 1328;
+            static constexpr IntValue PartOfProductDefinitionShape = 1329;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcShapeAspect_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcShapeModel_CLASS_H
+#define __RDF_LTD__IFC4_IfcShapeModel_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRepresentation.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcShapeModel
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcShapeModel : public RDF_EXPRESS_VIRTUAL IfcRepresentation
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcShapeModel
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcShapeModel(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 594);
+        }
+
+        /// <summary>
+        /// Instances of IfcShapeModel in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcShapeModel> Extent(SdaiModel model) { return ExtentRange<IfcShapeModel>(model, 594, false); }
+        static ExtentRange<IfcShapeModel> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcShapeModel>(model, 594, true); }
+
+        /// <summary>
+        /// Returns object of IfcShapeModel if the actual type of SdaiInstance is IfcShapeModel or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcShapeModel CreateExactEntity(SdaiInstance instance) { return IfcShapeModel(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcShapeModel or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcShapeModel(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcShapeAspect or list of convertible elements
+        template <typename TList> void get_OfShapeAspect(TList& lst) { RDF_EXPRESS_PROBE(1330); SetOfIfcShapeAspectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1330)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRepresentation::attr
+        {
+            static constexpr IntValue OfShapeAspect = 1330;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcShapeModel_CLASS_H
@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcShellBasedSurfaceModel_CLASS_H
+#define __RDF_LTD__IFC4_IfcShellBasedSurfaceModel_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcShellBasedSurfaceModel
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcShellBasedSurfaceModel : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcShellBasedSurfaceModel
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcShellBasedSurfaceModel(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 596);
+        }
+
+        /// <summary>
+        /// Instances of IfcShellBasedSurfaceModel in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcShellBasedSurfaceModel> Extent(SdaiModel model) { return ExtentRange<IfcShellBasedSurfaceModel>(model, 596, false); }
+        static ExtentRange<IfcShellBasedSurfaceModel> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcShellBasedSurfaceModel>(model, 596, true); }
+
+        /// <summary>
+        /// Create new instance of IfcShellBasedSurfaceModel and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcShellBasedSurfaceModel Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcShellBasedSurfaceModel"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcShellBasedSurfaceModel if the actual type of SdaiInstance is IfcShellBasedSurfaceModel or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcShellBasedSurfaceModel CreateExactEntity(SdaiInstance instance) { return IfcShellBasedSurfaceModel(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcShellBasedSurfaceModel or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcShellBasedSurfaceModel(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcShell or list of convertible elements
+        template <typename TList> void get_SbsmBoundary(TList& lst) { RDF_EXPRESS_PROBE(1331); SetOfIfcShellSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1331)); }
+
+        //TList may be SetOfIfcShell or list of convertible elements
+        template <typename TList> void put_SbsmBoundary(TList& lst) { RDF_EXPRESS_PROBE(1331); SetOfIfcShellSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1331)); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(1332); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1332), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue SbsmBoundary = 1331;
+            static constexpr IntValue Dim = 1332;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcShellBasedSurfaceModel_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSimpleProperty_CLASS_H
+#define __RDF_LTD__IFC4_IfcSimpleProperty_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProperty.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSimpleProperty
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSimpleProperty : public RDF_EXPRESS_VIRTUAL IfcProperty
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSimpleProperty
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSimpleProperty(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 597);
+        }
+
+        /// <summary>
+        /// Instances of IfcSimpleProperty in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSimpleProperty> Extent(SdaiModel model) { return ExtentRange<IfcSimpleProperty>(model, 597, false); }
+        static ExtentRange<IfcSimpleProperty> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSimpleProperty>(model, 597, true); }
+
+        /// <summary>
+        /// Returns object of IfcSimpleProperty if the actual type of SdaiInstance is IfcSimpleProperty or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSimpleProperty CreateExactEntity(SdaiInstance instance) { return IfcSimpleProperty(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSimpleProperty or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSimpleProperty(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProperty::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSimpleProperty_CLASS_H
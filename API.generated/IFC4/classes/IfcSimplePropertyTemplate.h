@@ -0,0 +1,113 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSimplePropertyTemplate_CLASS_H
+#define __RDF_LTD__IFC4_IfcSimplePropertyTemplate_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPropertyTemplate.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSimplePropertyTemplate
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSimplePropertyTemplate : public RDF_EXPRESS_VIRTUAL IfcPropertyTemplate
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSimplePropertyTemplate
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSimplePropertyTemplate(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 598);
+        }
+
+        /// <summary>
+        /// Instances of IfcSimplePropertyTemplate in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSimplePropertyTemplate> Extent(SdaiModel model) { return ExtentRange<IfcSimplePropertyTemplate>(model, 598, false); }
+        static ExtentRange<IfcSimplePropertyTemplate> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSimplePropertyTemplate>(model, 598, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSimplePropertyTemplate and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSimplePropertyTemplate Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSimplePropertyTemplate"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSimplePropertyTemplate if the actual type of SdaiInstance is IfcSimplePropertyTemplate or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSimplePropertyTemplate CreateExactEntity(SdaiInstance instance) { return IfcSimplePropertyTemplate(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSimplePropertyTemplate or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSimplePropertyTemplate(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSimplePropertyTemplateTypeEnum> get_TemplateType() { RDF_EXPRESS_PROBE(1333); int v = getENUM(1333, IfcSimplePropertyTemplateTypeEnum_hash); if (v >= 0) return (IfcSimplePropertyTemplateTypeEnum) v; else return Nullable<IfcSimplePropertyTemplateTypeEnum>(); }
+        void put_TemplateType(IfcSimplePropertyTemplateTypeEnum value) { RDF_EXPRESS_PROBE(1333); TextValue val = IfcSimplePropertyTemplateTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1333), sdaiENUM, val); }
+
+        IfcLabel get_PrimaryMeasureType() { RDF_EXPRESS_PROBE(1334); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1334), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_PrimaryMeasureType_view() { return TextView(get_PrimaryMeasureType()); }
+#endif
+        void put_PrimaryMeasureType(IfcLabel value) { RDF_EXPRESS_PROBE(1334); sdaiPutAttr(m_instance, getAttrDefinition(1334), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_PrimaryMeasureType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1334); return buffer.GetAttr(m_instance, "PrimaryMeasureType"); }
+        const char* get_PrimaryMeasureType_utf8() { return get_PrimaryMeasureType_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_SecondaryMeasureType() { RDF_EXPRESS_PROBE(1335); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1335), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_SecondaryMeasureType_view() { return TextView(get_SecondaryMeasureType()); }
+#endif
+        void put_SecondaryMeasureType(IfcLabel value) { RDF_EXPRESS_PROBE(1335); sdaiPutAttr(m_instance, getAttrDefinition(1335), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_SecondaryMeasureType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1335); return buffer.GetAttr(m_instance, "SecondaryMeasureType"); }
+        const char* get_SecondaryMeasureType_utf8() { return get_SecondaryMeasureType_utf8(ThreadUtf8Buffer()); }
+
+        IfcPropertyEnumeration get_Enumerators();
+        void put_Enumerators(IfcPropertyEnumeration inst);
+
+        IfcUnit_get get_PrimaryUnit() { return IfcUnit_get(m_instance, 1337); }
+        IfcUnit_put put_PrimaryUnit() { return IfcUnit_put(m_instance, 1337); }
+
+        IfcUnit_get get_SecondaryUnit() { return IfcUnit_get(m_instance, 1338); }
+        IfcUnit_put put_SecondaryUnit() { return IfcUnit_put(m_instance, 1338); }
+
+        IfcLabel get_Expression() { RDF_EXPRESS_PROBE(1339); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1339), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Expression_view() { return TextView(get_Expression()); }
+#endif
+        void put_Expression(IfcLabel value) { RDF_EXPRESS_PROBE(1339); sdaiPutAttr(m_instance, getAttrDefinition(1339), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Expression_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1339); return buffer.GetAttr(m_instance, "Expression"); }
+        const char* get_Expression_utf8() { return get_Expression_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcStateEnum> get_AccessState() { RDF_EXPRESS_PROBE(1340); int v = getENUM(1340, IfcStateEnum_hash); if (v >= 0) return (IfcStateEnum) v; else return Nullable<IfcStateEnum>(); }
+        void put_AccessState(IfcStateEnum value) { RDF_EXPRESS_PROBE(1340); TextValue val = IfcStateEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1340), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPropertyTemplate::attr
+        {
+            static constexpr IntValue TemplateType = 1333;
+            static constexpr IntValue PrimaryMeasureType = 1334;
+            static constexpr IntValue SecondaryMeasureType = 1335;
+            static constexpr IntValue Enumerators = 1336;
+            static constexpr IntValue PrimaryUnit = 1337;
+            static constexpr IntValue SecondaryUnit = 1338;
+            static constexpr IntValue Expression = 1339;
+            static constexpr IntValue AccessState = 1340;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSimplePropertyTemplate_CLASS_H
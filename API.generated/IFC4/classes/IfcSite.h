@@ -0,0 +1,99 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSite_CLASS_H
+#define __RDF_LTD__IFC4_IfcSite_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSpatialStructureElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSite
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSite : public RDF_EXPRESS_VIRTUAL IfcSpatialStructureElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSite
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSite(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 599);
+        }
+
+        /// <summary>
+        /// Instances of IfcSite in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSite> Extent(SdaiModel model) { return ExtentRange<IfcSite>(model, 599, false); }
+        static ExtentRange<IfcSite> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSite>(model, 599, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSite and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSite Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSite"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSite if the actual type of SdaiInstance is IfcSite or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSite CreateExactEntity(SdaiInstance instance) { return IfcSite(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSite or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSite(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be IfcCompoundPlaneAngleMeasure or list of convertible elements
+        template <typename TList> void get_RefLatitude(TList& lst) { RDF_EXPRESS_PROBE(1341); IfcCompoundPlaneAngleMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1341)); }
+
+        //TList may be IfcCompoundPlaneAngleMeasure or list of convertible elements
+        template <typename TList> void put_RefLatitude(TList& lst) { RDF_EXPRESS_PROBE(1341); IfcCompoundPlaneAngleMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1341)); }
+
+        //TArrayElem[] may be IntValue[] or array of convertible elements
+        template <typename TArrayElem> void put_RefLatitude(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1341); ArrayRange<TArrayElem> range = {arr, n}; IfcCompoundPlaneAngleMeasureSerializer<IfcCompoundPlaneAngleMeasure> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1341)); }
+
+        //TList may be IfcCompoundPlaneAngleMeasure or list of convertible elements
+        template <typename TList> void get_RefLongitude(TList& lst) { RDF_EXPRESS_PROBE(1342); IfcCompoundPlaneAngleMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1342)); }
+
+        //TList may be IfcCompoundPlaneAngleMeasure or list of convertible elements
+        template <typename TList> void put_RefLongitude(TList& lst) { RDF_EXPRESS_PROBE(1342); IfcCompoundPlaneAngleMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1342)); }
+
+        //TArrayElem[] may be IntValue[] or array of convertible elements
+        template <typename TArrayElem> void put_RefLongitude(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1342); ArrayRange<TArrayElem> range = {arr, n}; IfcCompoundPlaneAngleMeasureSerializer<IfcCompoundPlaneAngleMeasure> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1342)); }
+
+        Nullable<IfcLengthMeasure> get_RefElevation() { RDF_EXPRESS_PROBE(1343); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1343), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_RefElevation(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1343); sdaiPutAttr(m_instance, getAttrDefinition(1343), sdaiREAL, &value); }
+
+        IfcLabel get_LandTitleNumber() { RDF_EXPRESS_PROBE(1344); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1344), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LandTitleNumber_view() { return TextView(get_LandTitleNumber()); }
+#endif
+        void put_LandTitleNumber(IfcLabel value) { RDF_EXPRESS_PROBE(1344); sdaiPutAttr(m_instance, getAttrDefinition(1344), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LandTitleNumber_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1344); return buffer.GetAttr(m_instance, "LandTitleNumber"); }
+        const char* get_LandTitleNumber_utf8() { return get_LandTitleNumber_utf8(ThreadUtf8Buffer()); }
+
+        IfcPostalAddress get_SiteAddress();
+        void put_SiteAddress(IfcPostalAddress inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSpatialStructureElement::attr
+        {
+            static constexpr IntValue RefLatitude = 1341;
+            static constexpr IntValue RefLongitude = 1342;
+            static constexpr IntValue RefElevation = 1343;
+            static constexpr IntValue LandTitleNumber = 1344;
+            static constexpr IntValue SiteAddress = 1345;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSite_CLASS_H
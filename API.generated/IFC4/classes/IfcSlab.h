@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSlab_CLASS_H
+#define __RDF_LTD__IFC4_IfcSlab_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSlab
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSlab : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSlab
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSlab(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 601);
+        }
+
+        /// <summary>
+        /// Instances of IfcSlab in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSlab> Extent(SdaiModel model) { return ExtentRange<IfcSlab>(model, 601, false); }
+        static ExtentRange<IfcSlab> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSlab>(model, 601, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSlab and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSlab Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSlab"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSlab if the actual type of SdaiInstance is IfcSlab or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSlab CreateExactEntity(SdaiInstance instance) { return IfcSlab(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSlab or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSlab(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSlabTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1348); int v = getENUM(1348, IfcSlabTypeEnum_hash); if (v >= 0) return (IfcSlabTypeEnum) v; else return Nullable<IfcSlabTypeEnum>(); }
+        void put_PredefinedType(IfcSlabTypeEnum value) { RDF_EXPRESS_PROBE(1348); TextValue val = IfcSlabTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1348), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1348;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSlab_CLASS_H
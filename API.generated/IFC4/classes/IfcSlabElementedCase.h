@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSlabElementedCase_CLASS_H
+#define __RDF_LTD__IFC4_IfcSlabElementedCase_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSlab.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSlabElementedCase
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSlabElementedCase : public RDF_EXPRESS_VIRTUAL IfcSlab
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSlabElementedCase
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSlabElementedCase(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 602);
+        }
+
+        /// <summary>
+        /// Instances of IfcSlabElementedCase in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSlabElementedCase> Extent(SdaiModel model) { return ExtentRange<IfcSlabElementedCase>(model, 602, false); }
+        static ExtentRange<IfcSlabElementedCase> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSlabElementedCase>(model, 602, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSlabElementedCase and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSlabElementedCase Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSlabElementedCase"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSlabElementedCase if the actual type of SdaiInstance is IfcSlabElementedCase or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSlabElementedCase CreateExactEntity(SdaiInstance instance) { return IfcSlabElementedCase(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSlabElementedCase or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSlabElementedCase(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSlab::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSlabElementedCase_CLASS_H
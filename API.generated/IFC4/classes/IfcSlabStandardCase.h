@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSlabStandardCase_CLASS_H
+#define __RDF_LTD__IFC4_IfcSlabStandardCase_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSlab.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSlabStandardCase
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSlabStandardCase : public RDF_EXPRESS_VIRTUAL IfcSlab
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSlabStandardCase
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSlabStandardCase(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 603);
+        }
+
+        /// <summary>
+        /// Instances of IfcSlabStandardCase in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSlabStandardCase> Extent(SdaiModel model) { return ExtentRange<IfcSlabStandardCase>(model, 603, false); }
+        static ExtentRange<IfcSlabStandardCase> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSlabStandardCase>(model, 603, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSlabStandardCase and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSlabStandardCase Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSlabStandardCase"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSlabStandardCase if the actual type of SdaiInstance is IfcSlabStandardCase or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSlabStandardCase CreateExactEntity(SdaiInstance instance) { return IfcSlabStandardCase(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSlabStandardCase or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSlabStandardCase(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSlab::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSlabStandardCase_CLASS_H
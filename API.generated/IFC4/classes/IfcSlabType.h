@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSlabType_CLASS_H
+#define __RDF_LTD__IFC4_IfcSlabType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSlabType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSlabType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSlabType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSlabType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 604);
+        }
+
+        /// <summary>
+        /// Instances of IfcSlabType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSlabType> Extent(SdaiModel model) { return ExtentRange<IfcSlabType>(model, 604, false); }
+        static ExtentRange<IfcSlabType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSlabType>(model, 604, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSlabType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSlabType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSlabType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSlabType if the actual type of SdaiInstance is IfcSlabType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSlabType CreateExactEntity(SdaiInstance instance) { return IfcSlabType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSlabType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSlabType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSlabTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1349); int v = getENUM(1349, IfcSlabTypeEnum_hash); if (v >= 0) return (IfcSlabTypeEnum) v; else return Nullable<IfcSlabTypeEnum>(); }
+        void put_PredefinedType(IfcSlabTypeEnum value) { RDF_EXPRESS_PROBE(1349); TextValue val = IfcSlabTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1349), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1349;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSlabType_CLASS_H
@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSlippageConnectionCondition_CLASS_H
+#define __RDF_LTD__IFC4_IfcSlippageConnectionCondition_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralConnectionCondition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSlippageConnectionCondition
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSlippageConnectionCondition : public RDF_EXPRESS_VIRTUAL IfcStructuralConnectionCondition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSlippageConnectionCondition
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSlippageConnectionCondition(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 605);
+        }
+
+        /// <summary>
+        /// Instances of IfcSlippageConnectionCondition in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSlippageConnectionCondition> Extent(SdaiModel model) { return ExtentRange<IfcSlippageConnectionCondition>(model, 605, false); }
+        static ExtentRange<IfcSlippageConnectionCondition> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSlippageConnectionCondition>(model, 605, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSlippageConnectionCondition and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSlippageConnectionCondition Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSlippageConnectionCondition"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSlippageConnectionCondition if the actual type of SdaiInstance is IfcSlippageConnectionCondition or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSlippageConnectionCondition CreateExactEntity(SdaiInstance instance) { return IfcSlippageConnectionCondition(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSlippageConnectionCondition or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSlippageConnectionCondition(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLengthMeasure> get_SlippageX() { RDF_EXPRESS_PROBE(1350); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1350), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_SlippageX(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1350); sdaiPutAttr(m_instance, getAttrDefinition(1350), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_SlippageY() { RDF_EXPRESS_PROBE(1351); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1351), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_SlippageY(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1351); sdaiPutAttr(m_instance, getAttrDefinition(1351), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_SlippageZ() { RDF_EXPRESS_PROBE(1352); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1352), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_SlippageZ(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1352); sdaiPutAttr(m_instance, getAttrDefinition(1352), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralConnectionCondition::attr
+        {
+            static constexpr IntValue SlippageX = 1350;
+            static constexpr IntValue SlippageY = 1351;
+            static constexpr IntValue SlippageZ = 1352;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSlippageConnectionCondition_CLASS_H
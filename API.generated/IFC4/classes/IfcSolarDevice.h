@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSolarDevice_CLASS_H
+#define __RDF_LTD__IFC4_IfcSolarDevice_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSolarDevice
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSolarDevice : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSolarDevice
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSolarDevice(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 606);
+        }
+
+        /// <summary>
+        /// Instances of IfcSolarDevice in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSolarDevice> Extent(SdaiModel model) { return ExtentRange<IfcSolarDevice>(model, 606, false); }
+        static ExtentRange<IfcSolarDevice> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSolarDevice>(model, 606, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSolarDevice and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSolarDevice Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSolarDevice"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSolarDevice if the actual type of SdaiInstance is IfcSolarDevice or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSolarDevice CreateExactEntity(SdaiInstance instance) { return IfcSolarDevice(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSolarDevice or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSolarDevice(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSolarDeviceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1353); int v = getENUM(1353, IfcSolarDeviceTypeEnum_hash); if (v >= 0) return (IfcSolarDeviceTypeEnum) v; else return Nullable<IfcSolarDeviceTypeEnum>(); }
+        void put_PredefinedType(IfcSolarDeviceTypeEnum value) { RDF_EXPRESS_PROBE(1353); TextValue val = IfcSolarDeviceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1353), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 1353;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSolarDevice_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSolarDeviceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcSolarDeviceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSolarDeviceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSolarDeviceType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSolarDeviceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSolarDeviceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 607);
+        }
+
+        /// <summary>
+        /// Instances of IfcSolarDeviceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSolarDeviceType> Extent(SdaiModel model) { return ExtentRange<IfcSolarDeviceType>(model, 607, false); }
+        static ExtentRange<IfcSolarDeviceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSolarDeviceType>(model, 607, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSolarDeviceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSolarDeviceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSolarDeviceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSolarDeviceType if the actual type of SdaiInstance is IfcSolarDeviceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSolarDeviceType CreateExactEntity(SdaiInstance instance) { return IfcSolarDeviceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSolarDeviceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSolarDeviceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSolarDeviceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1354); int v = getENUM(1354, IfcSolarDeviceTypeEnum_hash); if (v >= 0) return (IfcSolarDeviceTypeEnum) v; else return Nullable<IfcSolarDeviceTypeEnum>(); }
+        void put_PredefinedType(IfcSolarDeviceTypeEnum value) { RDF_EXPRESS_PROBE(1354); TextValue val = IfcSolarDeviceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1354), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 1354;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSolarDeviceType_CLASS_H
@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpace_CLASS_H
+#define __RDF_LTD__IFC4_IfcSpace_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSpatialStructureElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSpace
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSpace : public RDF_EXPRESS_VIRTUAL IfcSpatialStructureElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSpace
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSpace(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 609);
+        }
+
+        /// <summary>
+        /// Instances of IfcSpace in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSpace> Extent(SdaiModel model) { return ExtentRange<IfcSpace>(model, 609, false); }
+        static ExtentRange<IfcSpace> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSpace>(model, 609, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSpace and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSpace Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSpace"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSpace if the actual type of SdaiInstance is IfcSpace or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSpace CreateExactEntity(SdaiInstance instance) { return IfcSpace(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSpace or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSpace(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSpaceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1355); int v = getENUM(1355, IfcSpaceTypeEnum_hash); if (v >= 0) return (IfcSpaceTypeEnum) v; else return Nullable<IfcSpaceTypeEnum>(); }
+        void put_PredefinedType(IfcSpaceTypeEnum value) { RDF_EXPRESS_PROBE(1355); TextValue val = IfcSpaceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1355), sdaiENUM, val); }
+
+        Nullable<IfcLengthMeasure> get_ElevationWithFlooring() { RDF_EXPRESS_PROBE(1356); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1356), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_ElevationWithFlooring(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1356); sdaiPutAttr(m_instance, getAttrDefinition(1356), sdaiREAL, &value); }
+
+        //TList may be SetOfIfcRelCoversSpaces or list of convertible elements
+        template <typename TList> void get_HasCoverings(TList& lst) { RDF_EXPRESS_PROBE(1357); SetOfIfcRelCoversSpacesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1357)); }
+
+        //TList may be SetOfIfcRelSpaceBoundary or list of convertible elements
+        template <typename TList> void get_BoundedBy(TList& lst) { RDF_EXPRESS_PROBE(1358); SetOfIfcRelSpaceBoundarySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1358)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSpatialStructureElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1355;
+            static constexpr IntValue ElevationWithFlooring = 1356;
+            static constexpr IntValue HasCoverings = 1357;
+            static constexpr IntValue BoundedBy = 1358;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpace_CLASS_H
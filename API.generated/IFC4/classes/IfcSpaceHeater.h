@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpaceHeater_CLASS_H
+#define __RDF_LTD__IFC4_IfcSpaceHeater_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSpaceHeater
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSpaceHeater : public RDF_EXPRESS_VIRTUAL IfcFlowTerminal
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSpaceHeater
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSpaceHeater(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 610);
+        }
+
+        /// <summary>
+        /// Instances of IfcSpaceHeater in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSpaceHeater> Extent(SdaiModel model) { return ExtentRange<IfcSpaceHeater>(model, 610, false); }
+        static ExtentRange<IfcSpaceHeater> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSpaceHeater>(model, 610, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSpaceHeater and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSpaceHeater Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSpaceHeater"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSpaceHeater if the actual type of SdaiInstance is IfcSpaceHeater or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSpaceHeater CreateExactEntity(SdaiInstance instance) { return IfcSpaceHeater(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSpaceHeater or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSpaceHeater(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSpaceHeaterTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1359); int v = getENUM(1359, IfcSpaceHeaterTypeEnum_hash); if (v >= 0) return (IfcSpaceHeaterTypeEnum) v; else return Nullable<IfcSpaceHeaterTypeEnum>(); }
+        void put_PredefinedType(IfcSpaceHeaterTypeEnum value) { RDF_EXPRESS_PROBE(1359); TextValue val = IfcSpaceHeaterTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1359), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminal::attr
+        {
+            static constexpr IntValue PredefinedType = 1359;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpaceHeater_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpaceHeaterType_CLASS_H
+#define __RDF_LTD__IFC4_IfcSpaceHeaterType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSpaceHeaterType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSpaceHeaterType : public RDF_EXPRESS_VIRTUAL IfcFlowTerminalType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSpaceHeaterType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSpaceHeaterType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 611);
+        }
+
+        /// <summary>
+        /// Instances of IfcSpaceHeaterType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSpaceHeaterType> Extent(SdaiModel model) { return ExtentRange<IfcSpaceHeaterType>(model, 611, false); }
+        static ExtentRange<IfcSpaceHeaterType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSpaceHeaterType>(model, 611, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSpaceHeaterType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSpaceHeaterType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSpaceHeaterType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSpaceHeaterType if the actual type of SdaiInstance is IfcSpaceHeaterType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSpaceHeaterType CreateExactEntity(SdaiInstance instance) { return IfcSpaceHeaterType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSpaceHeaterType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSpaceHeaterType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSpaceHeaterTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1360); int v = getENUM(1360, IfcSpaceHeaterTypeEnum_hash); if (v >= 0) return (IfcSpaceHeaterTypeEnum) v; else return Nullable<IfcSpaceHeaterTypeEnum>(); }
+        void put_PredefinedType(IfcSpaceHeaterTypeEnum value) { RDF_EXPRESS_PROBE(1360); TextValue val = IfcSpaceHeaterTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1360), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminalType::attr
+        {
+            static constexpr IntValue PredefinedType = 1360;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpaceHeaterType_CLASS_H
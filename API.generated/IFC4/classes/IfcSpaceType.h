@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpaceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcSpaceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSpatialStructureElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSpaceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSpaceType : public RDF_EXPRESS_VIRTUAL IfcSpatialStructureElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSpaceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSpaceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 612);
+        }
+
+        /// <summary>
+        /// Instances of IfcSpaceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSpaceType> Extent(SdaiModel model) { return ExtentRange<IfcSpaceType>(model, 612, false); }
+        static ExtentRange<IfcSpaceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSpaceType>(model, 612, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSpaceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSpaceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSpaceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSpaceType if the actual type of SdaiInstance is IfcSpaceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSpaceType CreateExactEntity(SdaiInstance instance) { return IfcSpaceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSpaceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSpaceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSpaceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1362); int v = getENUM(1362, IfcSpaceTypeEnum_hash); if (v >= 0) return (IfcSpaceTypeEnum) v; else return Nullable<IfcSpaceTypeEnum>(); }
+        void put_PredefinedType(IfcSpaceTypeEnum value) { RDF_EXPRESS_PROBE(1362); TextValue val = IfcSpaceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1362), sdaiENUM, val); }
+
+        IfcLabel get_LongName() { RDF_EXPRESS_PROBE(1363); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1363), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LongName_view() { return TextView(get_LongName()); }
+#endif
+        void put_LongName(IfcLabel value) { RDF_EXPRESS_PROBE(1363); sdaiPutAttr(m_instance, getAttrDefinition(1363), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LongName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1363); return buffer.GetAttr(m_instance, "LongName"); }
+        const char* get_LongName_utf8() { return get_LongName_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSpatialStructureElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1362;
+            static constexpr IntValue LongName = 1363;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpaceType_CLASS_H
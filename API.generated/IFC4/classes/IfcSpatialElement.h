@@ -0,0 +1,79 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpatialElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcSpatialElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProduct.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSpatialElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSpatialElement : public RDF_EXPRESS_VIRTUAL IfcProduct
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSpatialElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSpatialElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 613);
+        }
+
+        /// <summary>
+        /// Instances of IfcSpatialElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSpatialElement> Extent(SdaiModel model) { return ExtentRange<IfcSpatialElement>(model, 613, false); }
+        static ExtentRange<IfcSpatialElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSpatialElement>(model, 613, true); }
+
+        /// <summary>
+        /// Returns object of IfcSpatialElement if the actual type of SdaiInstance is IfcSpatialElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSpatialElement CreateExactEntity(SdaiInstance instance) { return IfcSpatialElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSpatialElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSpatialElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_LongName() { RDF_EXPRESS_PROBE(237); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(237), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LongName_view() { return TextView(get_LongName()); }
+#endif
+        void put_LongName(IfcLabel value) { RDF_EXPRESS_PROBE(237); sdaiPutAttr(m_instance, getAttrDefinition(237), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LongName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(237); return buffer.GetAttr(m_instance, "LongName"); }
+        const char* get_LongName_utf8() { return get_LongName_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRelContainedInSpatialStructure or list of convertible elements
+        template <typename TList> void get_ContainsElements(TList& lst) { RDF_EXPRESS_PROBE(238); SetOfIfcRelContainedInSpatialStructureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(238)); }
+
+        //TList may be SetOfIfcRelServicesBuildings or list of convertible elements
+        template <typename TList> void get_ServicedBySystems(TList& lst) { RDF_EXPRESS_PROBE(239); SetOfIfcRelServicesBuildingsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(239)); }
+
+        //TList may be SetOfIfcRelReferencedInSpatialStructure or list of convertible elements
+        template <typename TList> void get_ReferencesElements(TList& lst) { RDF_EXPRESS_PROBE(240); SetOfIfcRelReferencedInSpatialStructureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(240)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProduct::attr
+        {
+            static constexpr IntValue LongName = 237;
+            static constexpr IntValue ContainsElements = 238;
+            static constexpr IntValue ServicedBySystems = 239;
+            static constexpr IntValue ReferencesElements = 240;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpatialElement_CLASS_H
@@ -0,0 +1,67 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpatialElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcSpatialElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTypeProduct.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSpatialElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSpatialElementType : public RDF_EXPRESS_VIRTUAL IfcTypeProduct
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSpatialElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSpatialElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 614);
+        }
+
+        /// <summary>
+        /// Instances of IfcSpatialElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSpatialElementType> Extent(SdaiModel model) { return ExtentRange<IfcSpatialElementType>(model, 614, false); }
+        static ExtentRange<IfcSpatialElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSpatialElementType>(model, 614, true); }
+
+        /// <summary>
+        /// Returns object of IfcSpatialElementType if the actual type of SdaiInstance is IfcSpatialElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSpatialElementType CreateExactEntity(SdaiInstance instance) { return IfcSpatialElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSpatialElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSpatialElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_ElementType() { RDF_EXPRESS_PROBE(1361); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1361), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ElementType_view() { return TextView(get_ElementType()); }
+#endif
+        void put_ElementType(IfcLabel value) { RDF_EXPRESS_PROBE(1361); sdaiPutAttr(m_instance, getAttrDefinition(1361), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ElementType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1361); return buffer.GetAttr(m_instance, "ElementType"); }
+        const char* get_ElementType_utf8() { return get_ElementType_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTypeProduct::attr
+        {
+            static constexpr IntValue ElementType = 1361;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpatialElementType_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpatialStructureElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcSpatialStructureElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSpatialElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSpatialStructureElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSpatialStructureElement : public RDF_EXPRESS_VIRTUAL IfcSpatialElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSpatialStructureElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSpatialStructureElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 615);
+        }
+
+        /// <summary>
+        /// Instances of IfcSpatialStructureElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSpatialStructureElement> Extent(SdaiModel model) { return ExtentRange<IfcSpatialStructureElement>(model, 615, false); }
+        static ExtentRange<IfcSpatialStructureElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSpatialStructureElement>(model, 615, true); }
+
+        /// <summary>
+        /// Returns object of IfcSpatialStructureElement if the actual type of SdaiInstance is IfcSpatialStructureElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSpatialStructureElement CreateExactEntity(SdaiInstance instance) { return IfcSpatialStructureElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSpatialStructureElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSpatialStructureElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcElementCompositionEnum> get_CompositionType() { RDF_EXPRESS_PROBE(241); int v = getENUM(241, IfcElementCompositionEnum_hash); if (v >= 0) return (IfcElementCompositionEnum) v; else return Nullable<IfcElementCompositionEnum>(); }
+        void put_CompositionType(IfcElementCompositionEnum value) { RDF_EXPRESS_PROBE(241); TextValue val = IfcElementCompositionEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(241), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSpatialElement::attr
+        {
+            static constexpr IntValue CompositionType = 241;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpatialStructureElement_CLASS_H
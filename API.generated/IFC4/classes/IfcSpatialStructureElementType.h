@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpatialStructureElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcSpatialStructureElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSpatialElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSpatialStructureElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSpatialStructureElementType : public RDF_EXPRESS_VIRTUAL IfcSpatialElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSpatialStructureElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSpatialStructureElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 616);
+        }
+
+        /// <summary>
+        /// Instances of IfcSpatialStructureElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSpatialStructureElementType> Extent(SdaiModel model) { return ExtentRange<IfcSpatialStructureElementType>(model, 616, false); }
+        static ExtentRange<IfcSpatialStructureElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSpatialStructureElementType>(model, 616, true); }
+
+        /// <summary>
+        /// Returns object of IfcSpatialStructureElementType if the actual type of SdaiInstance is IfcSpatialStructureElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSpatialStructureElementType CreateExactEntity(SdaiInstance instance) { return IfcSpatialStructureElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSpatialStructureElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSpatialStructureElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSpatialElementType::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpatialStructureElementType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpatialZone_CLASS_H
+#define __RDF_LTD__IFC4_IfcSpatialZone_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSpatialElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSpatialZone
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSpatialZone : public RDF_EXPRESS_VIRTUAL IfcSpatialElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSpatialZone
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSpatialZone(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 617);
+        }
+
+        /// <summary>
+        /// Instances of IfcSpatialZone in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSpatialZone> Extent(SdaiModel model) { return ExtentRange<IfcSpatialZone>(model, 617, false); }
+        static ExtentRange<IfcSpatialZone> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSpatialZone>(model, 617, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSpatialZone and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSpatialZone Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSpatialZone"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSpatialZone if the actual type of SdaiInstance is IfcSpatialZone or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSpatialZone CreateExactEntity(SdaiInstance instance) { return IfcSpatialZone(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSpatialZone or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSpatialZone(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSpatialZoneTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1364); int v = getENUM(1364, IfcSpatialZoneTypeEnum_hash); if (v >= 0) return (IfcSpatialZoneTypeEnum) v; else return Nullable<IfcSpatialZoneTypeEnum>(); }
+        void put_PredefinedType(IfcSpatialZoneTypeEnum value) { RDF_EXPRESS_PROBE(1364); TextValue val = IfcSpatialZoneTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1364), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSpatialElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1364;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpatialZone_CLASS_H
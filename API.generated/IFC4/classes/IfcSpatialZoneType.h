@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpatialZoneType_CLASS_H
+#define __RDF_LTD__IFC4_IfcSpatialZoneType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSpatialElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSpatialZoneType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSpatialZoneType : public RDF_EXPRESS_VIRTUAL IfcSpatialElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSpatialZoneType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSpatialZoneType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 618);
+        }
+
+        /// <summary>
+        /// Instances of IfcSpatialZoneType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSpatialZoneType> Extent(SdaiModel model) { return ExtentRange<IfcSpatialZoneType>(model, 618, false); }
+        static ExtentRange<IfcSpatialZoneType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSpatialZoneType>(model, 618, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSpatialZoneType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSpatialZoneType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSpatialZoneType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSpatialZoneType if the actual type of SdaiInstance is IfcSpatialZoneType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSpatialZoneType CreateExactEntity(SdaiInstance instance) { return IfcSpatialZoneType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSpatialZoneType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSpatialZoneType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSpatialZoneTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1365); int v = getENUM(1365, IfcSpatialZoneTypeEnum_hash); if (v >= 0) return (IfcSpatialZoneTypeEnum) v; else return Nullable<IfcSpatialZoneTypeEnum>(); }
+        void put_PredefinedType(IfcSpatialZoneTypeEnum value) { RDF_EXPRESS_PROBE(1365); TextValue val = IfcSpatialZoneTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1365), sdaiENUM, val); }
+
+        IfcLabel get_LongName() { RDF_EXPRESS_PROBE(1366); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1366), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LongName_view() { return TextView(get_LongName()); }
+#endif
+        void put_LongName(IfcLabel value) { RDF_EXPRESS_PROBE(1366); sdaiPutAttr(m_instance, getAttrDefinition(1366), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LongName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1366); return buffer.GetAttr(m_instance, "LongName"); }
+        const char* get_LongName_utf8() { return get_LongName_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSpatialElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1365;
+            static constexpr IntValue LongName = 1366;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpatialZoneType_CLASS_H
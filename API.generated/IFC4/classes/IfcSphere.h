@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSphere_CLASS_H
+#define __RDF_LTD__IFC4_IfcSphere_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCsgPrimitive3D.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSphere
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSphere : public RDF_EXPRESS_VIRTUAL IfcCsgPrimitive3D
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSphere
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSphere(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 619);
+        }
+
+        /// <summary>
+        /// Instances of IfcSphere in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSphere> Extent(SdaiModel model) { return ExtentRange<IfcSphere>(model, 619, false); }
+        static ExtentRange<IfcSphere> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSphere>(model, 619, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSphere and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSphere Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSphere"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSphere if the actual type of SdaiInstance is IfcSphere or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSphere CreateExactEntity(SdaiInstance instance) { return IfcSphere(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSphere or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSphere(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Radius() { RDF_EXPRESS_PROBE(1367); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1367), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Radius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1367); sdaiPutAttr(m_instance, getAttrDefinition(1367), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCsgPrimitive3D::attr
+        {
+            static constexpr IntValue Radius = 1367;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSphere_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSphericalSurface_CLASS_H
+#define __RDF_LTD__IFC4_IfcSphericalSurface_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementarySurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSphericalSurface
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSphericalSurface : public RDF_EXPRESS_VIRTUAL IfcElementarySurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSphericalSurface
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSphericalSurface(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 620);
+        }
+
+        /// <summary>
+        /// Instances of IfcSphericalSurface in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSphericalSurface> Extent(SdaiModel model) { return ExtentRange<IfcSphericalSurface>(model, 620, false); }
+        static ExtentRange<IfcSphericalSurface> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSphericalSurface>(model, 620, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSphericalSurface and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSphericalSurface Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSphericalSurface"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSphericalSurface if the actual type of SdaiInstance is IfcSphericalSurface or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSphericalSurface CreateExactEntity(SdaiInstance instance) { return IfcSphericalSurface(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSphericalSurface or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSphericalSurface(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Radius() { RDF_EXPRESS_PROBE(1368); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1368), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Radius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1368); sdaiPutAttr(m_instance, getAttrDefinition(1368), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementarySurface::attr
+        {
+            static constexpr IntValue Radius = 1368;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSphericalSurface_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStackTerminal_CLASS_H
+#define __RDF_LTD__IFC4_IfcStackTerminal_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStackTerminal
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStackTerminal : public RDF_EXPRESS_VIRTUAL IfcFlowTerminal
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStackTerminal
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStackTerminal(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 621);
+        }
+
+        /// <summary>
+        /// Instances of IfcStackTerminal in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStackTerminal> Extent(SdaiModel model) { return ExtentRange<IfcStackTerminal>(model, 621, false); }
+        static ExtentRange<IfcStackTerminal> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStackTerminal>(model, 621, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStackTerminal and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStackTerminal Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStackTerminal"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStackTerminal if the actual type of SdaiInstance is IfcStackTerminal or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStackTerminal CreateExactEntity(SdaiInstance instance) { return IfcStackTerminal(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStackTerminal or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStackTerminal(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcStackTerminalTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1369); int v = getENUM(1369, IfcStackTerminalTypeEnum_hash); if (v >= 0) return (IfcStackTerminalTypeEnum) v; else return Nullable<IfcStackTerminalTypeEnum>(); }
+        void put_PredefinedType(IfcStackTerminalTypeEnum value) { RDF_EXPRESS_PROBE(1369); TextValue val = IfcStackTerminalTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1369), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminal::attr
+        {
+            static constexpr IntValue PredefinedType = 1369;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStackTerminal_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStackTerminalType_CLASS_H
+#define __RDF_LTD__IFC4_IfcStackTerminalType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStackTerminalType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStackTerminalType : public RDF_EXPRESS_VIRTUAL IfcFlowTerminalType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStackTerminalType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStackTerminalType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 622);
+        }
+
+        /// <summary>
+        /// Instances of IfcStackTerminalType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStackTerminalType> Extent(SdaiModel model) { return ExtentRange<IfcStackTerminalType>(model, 622, false); }
+        static ExtentRange<IfcStackTerminalType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStackTerminalType>(model, 622, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStackTerminalType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStackTerminalType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStackTerminalType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStackTerminalType if the actual type of SdaiInstance is IfcStackTerminalType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStackTerminalType CreateExactEntity(SdaiInstance instance) { return IfcStackTerminalType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStackTerminalType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStackTerminalType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcStackTerminalTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1370); int v = getENUM(1370, IfcStackTerminalTypeEnum_hash); if (v >= 0) return (IfcStackTerminalTypeEnum) v; else return Nullable<IfcStackTerminalTypeEnum>(); }
+        void put_PredefinedType(IfcStackTerminalTypeEnum value) { RDF_EXPRESS_PROBE(1370); TextValue val = IfcStackTerminalTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1370), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminalType::attr
+        {
+            static constexpr IntValue PredefinedType = 1370;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStackTerminalType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStair_CLASS_H
+#define __RDF_LTD__IFC4_IfcStair_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStair
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStair : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStair
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStair(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 623);
+        }
+
+        /// <summary>
+        /// Instances of IfcStair in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStair> Extent(SdaiModel model) { return ExtentRange<IfcStair>(model, 623, false); }
+        static ExtentRange<IfcStair> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStair>(model, 623, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStair and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStair Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStair"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStair if the actual type of SdaiInstance is IfcStair or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStair CreateExactEntity(SdaiInstance instance) { return IfcStair(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStair or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStair(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcStairTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1371); int v = getENUM(1371, IfcStairTypeEnum_hash); if (v >= 0) return (IfcStairTypeEnum) v; else return Nullable<IfcStairTypeEnum>(); }
+        void put_PredefinedType(IfcStairTypeEnum value) { RDF_EXPRESS_PROBE(1371); TextValue val = IfcStairTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1371), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1371;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStair_CLASS_H
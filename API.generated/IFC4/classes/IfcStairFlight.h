@@ -0,0 +1,80 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStairFlight_CLASS_H
+#define __RDF_LTD__IFC4_IfcStairFlight_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStairFlight
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStairFlight : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStairFlight
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStairFlight(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 624);
+        }
+
+        /// <summary>
+        /// Instances of IfcStairFlight in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStairFlight> Extent(SdaiModel model) { return ExtentRange<IfcStairFlight>(model, 624, false); }
+        static ExtentRange<IfcStairFlight> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStairFlight>(model, 624, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStairFlight and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStairFlight Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStairFlight"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStairFlight if the actual type of SdaiInstance is IfcStairFlight or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStairFlight CreateExactEntity(SdaiInstance instance) { return IfcStairFlight(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStairFlight or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStairFlight(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcInteger> get_NumberOfRisers() { RDF_EXPRESS_PROBE(1372); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1372), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_NumberOfRisers(IfcInteger value) { RDF_EXPRESS_PROBE(1372); sdaiPutAttr(m_instance, getAttrDefinition(1372), sdaiINTEGER, &value); }
+
+        Nullable<IfcInteger> get_NumberOfTreads() { RDF_EXPRESS_PROBE(1373); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1373), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_NumberOfTreads(IfcInteger value) { RDF_EXPRESS_PROBE(1373); sdaiPutAttr(m_instance, getAttrDefinition(1373), sdaiINTEGER, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_RiserHeight() { RDF_EXPRESS_PROBE(1374); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1374), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_RiserHeight(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1374); sdaiPutAttr(m_instance, getAttrDefinition(1374), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_TreadLength() { RDF_EXPRESS_PROBE(1375); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1375), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_TreadLength(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1375); sdaiPutAttr(m_instance, getAttrDefinition(1375), sdaiREAL, &value); }
+
+        Nullable<IfcStairFlightTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1376); int v = getENUM(1376, IfcStairFlightTypeEnum_hash); if (v >= 0) return (IfcStairFlightTypeEnum) v; else return Nullable<IfcStairFlightTypeEnum>(); }
+        void put_PredefinedType(IfcStairFlightTypeEnum value) { RDF_EXPRESS_PROBE(1376); TextValue val = IfcStairFlightTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1376), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue NumberOfRisers = 1372;
+            static constexpr IntValue NumberOfTreads = 1373;
+            static constexpr IntValue RiserHeight = 1374;
+            static constexpr IntValue TreadLength = 1375;
+            static constexpr IntValue PredefinedType = 1376;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStairFlight_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStairFlightType_CLASS_H
+#define __RDF_LTD__IFC4_IfcStairFlightType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStairFlightType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStairFlightType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStairFlightType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStairFlightType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 625);
+        }
+
+        /// <summary>
+        /// Instances of IfcStairFlightType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStairFlightType> Extent(SdaiModel model) { return ExtentRange<IfcStairFlightType>(model, 625, false); }
+        static ExtentRange<IfcStairFlightType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStairFlightType>(model, 625, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStairFlightType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStairFlightType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStairFlightType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStairFlightType if the actual type of SdaiInstance is IfcStairFlightType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStairFlightType CreateExactEntity(SdaiInstance instance) { return IfcStairFlightType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStairFlightType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStairFlightType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcStairFlightTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1377); int v = getENUM(1377, IfcStairFlightTypeEnum_hash); if (v >= 0) return (IfcStairFlightTypeEnum) v; else return Nullable<IfcStairFlightTypeEnum>(); }
+        void put_PredefinedType(IfcStairFlightTypeEnum value) { RDF_EXPRESS_PROBE(1377); TextValue val = IfcStairFlightTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1377), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1377;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStairFlightType_CLASS_H
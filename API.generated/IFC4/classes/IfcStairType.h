@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStairType_CLASS_H
+#define __RDF_LTD__IFC4_IfcStairType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStairType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStairType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStairType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStairType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 626);
+        }
+
+        /// <summary>
+        /// Instances of IfcStairType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStairType> Extent(SdaiModel model) { return ExtentRange<IfcStairType>(model, 626, false); }
+        static ExtentRange<IfcStairType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStairType>(model, 626, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStairType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStairType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStairType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStairType if the actual type of SdaiInstance is IfcStairType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStairType CreateExactEntity(SdaiInstance instance) { return IfcStairType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStairType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStairType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcStairTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1378); int v = getENUM(1378, IfcStairTypeEnum_hash); if (v >= 0) return (IfcStairTypeEnum) v; else return Nullable<IfcStairTypeEnum>(); }
+        void put_PredefinedType(IfcStairTypeEnum value) { RDF_EXPRESS_PROBE(1378); TextValue val = IfcStairTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1378), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1378;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStairType_CLASS_H
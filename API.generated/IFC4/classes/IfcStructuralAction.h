@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralAction_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralAction_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralActivity.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralAction
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralAction : public RDF_EXPRESS_VIRTUAL IfcStructuralActivity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralAction
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralAction(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 627);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralAction in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralAction> Extent(SdaiModel model) { return ExtentRange<IfcStructuralAction>(model, 627, false); }
+        static ExtentRange<IfcStructuralAction> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralAction>(model, 627, true); }
+
+        /// <summary>
+        /// Returns object of IfcStructuralAction if the actual type of SdaiInstance is IfcStructuralAction or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralAction CreateExactEntity(SdaiInstance instance) { return IfcStructuralAction(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralAction or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralAction(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBoolean> get_DestabilizingLoad() { RDF_EXPRESS_PROBE(1382); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1382), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_DestabilizingLoad(IfcBoolean value) { RDF_EXPRESS_PROBE(1382); sdaiPutAttr(m_instance, getAttrDefinition(1382), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralActivity::attr
+        {
+            static constexpr IntValue DestabilizingLoad = 1382;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralAction_CLASS_H
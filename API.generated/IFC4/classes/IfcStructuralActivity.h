@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralActivity_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralActivity_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProduct.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralActivity
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralActivity : public RDF_EXPRESS_VIRTUAL IfcProduct
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralActivity
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralActivity(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 628);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralActivity in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralActivity> Extent(SdaiModel model) { return ExtentRange<IfcStructuralActivity>(model, 628, false); }
+        static ExtentRange<IfcStructuralActivity> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralActivity>(model, 628, true); }
+
+        /// <summary>
+        /// Returns object of IfcStructuralActivity if the actual type of SdaiInstance is IfcStructuralActivity or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralActivity CreateExactEntity(SdaiInstance instance) { return IfcStructuralActivity(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralActivity or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralActivity(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcStructuralLoad get_AppliedLoad();
+        void put_AppliedLoad(IfcStructuralLoad inst);
+
+        Nullable<IfcGlobalOrLocalEnum> get_GlobalOrLocal() { RDF_EXPRESS_PROBE(1380); int v = getENUM(1380, IfcGlobalOrLocalEnum_hash); if (v >= 0) return (IfcGlobalOrLocalEnum) v; else return Nullable<IfcGlobalOrLocalEnum>(); }
+        void put_GlobalOrLocal(IfcGlobalOrLocalEnum value) { RDF_EXPRESS_PROBE(1380); TextValue val = IfcGlobalOrLocalEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1380), sdaiENUM, val); }
+
+        //TList may be SetOfIfcRelConnectsStructuralActivity or list of convertible elements
+        template <typename TList> void get_AssignedToStructuralItem(TList& lst) { RDF_EXPRESS_PROBE(1381); SetOfIfcRelConnectsStructuralActivitySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1381)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProduct::attr
+        {
+            static constexpr IntValue AppliedLoad = 1379;
+            static constexpr IntValue GlobalOrLocal = 1380;
+            static constexpr IntValue AssignedToStructuralItem = 1381;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralActivity_CLASS_H
@@ -0,0 +1,92 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralAnalysisModel_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralAnalysisModel_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSystem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralAnalysisModel
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralAnalysisModel : public RDF_EXPRESS_VIRTUAL IfcSystem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralAnalysisModel
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralAnalysisModel(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 629);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralAnalysisModel in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralAnalysisModel> Extent(SdaiModel model) { return ExtentRange<IfcStructuralAnalysisModel>(model, 629, false); }
+        static ExtentRange<IfcStructuralAnalysisModel> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralAnalysisModel>(model, 629, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralAnalysisModel and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralAnalysisModel Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralAnalysisModel"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralAnalysisModel if the actual type of SdaiInstance is IfcStructuralAnalysisModel or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralAnalysisModel CreateExactEntity(SdaiInstance instance) { return IfcStructuralAnalysisModel(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralAnalysisModel or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralAnalysisModel(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAnalysisModelTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1383); int v = getENUM(1383, IfcAnalysisModelTypeEnum_hash); if (v >= 0) return (IfcAnalysisModelTypeEnum) v; else return Nullable<IfcAnalysisModelTypeEnum>(); }
+        void put_PredefinedType(IfcAnalysisModelTypeEnum value) { RDF_EXPRESS_PROBE(1383); TextValue val = IfcAnalysisModelTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1383), sdaiENUM, val); }
+
+        IfcAxis2Placement3D get_OrientationOf2DPlane();
+        void put_OrientationOf2DPlane(IfcAxis2Placement3D inst);
+
+        //TList may be SetOfIfcStructuralLoadGroup or list of convertible elements
+        template <typename TList> void get_LoadedBy(TList& lst) { RDF_EXPRESS_PROBE(1385); SetOfIfcStructuralLoadGroupSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1385)); }
+
+        //TList may be SetOfIfcStructuralLoadGroup or list of convertible elements
+        template <typename TList> void put_LoadedBy(TList& lst) { RDF_EXPRESS_PROBE(1385); SetOfIfcStructuralLoadGroupSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1385)); }
+
+        //TArrayElem[] may be IfcStructuralLoadGroup[] or array of convertible elements
+        template <typename TArrayElem> void put_LoadedBy(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1385); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcStructuralLoadGroupSerializer<SetOfIfcStructuralLoadGroup> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1385)); }
+
+        //TList may be SetOfIfcStructuralResultGroup or list of convertible elements
+        template <typename TList> void get_HasResults(TList& lst) { RDF_EXPRESS_PROBE(1386); SetOfIfcStructuralResultGroupSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1386)); }
+
+        //TList may be SetOfIfcStructuralResultGroup or list of convertible elements
+        template <typename TList> void put_HasResults(TList& lst) { RDF_EXPRESS_PROBE(1386); SetOfIfcStructuralResultGroupSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1386)); }
+
+        //TArrayElem[] may be IfcStructuralResultGroup[] or array of convertible elements
+        template <typename TArrayElem> void put_HasResults(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1386); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcStructuralResultGroupSerializer<SetOfIfcStructuralResultGroup> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1386)); }
+
+        IfcObjectPlacement get_SharedPlacement();
+        void put_SharedPlacement(IfcObjectPlacement inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSystem::attr
+        {
+            static constexpr IntValue PredefinedType = 1383;
+            static constexpr IntValue OrientationOf2DPlane = 1384;
+            static constexpr IntValue LoadedBy = 1385;
+            static constexpr IntValue HasResults = 1386;
+            static constexpr IntValue SharedPlacement = 1387;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralAnalysisModel_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralConnection_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralConnection_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralConnection
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralConnection : public RDF_EXPRESS_VIRTUAL IfcStructuralItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralConnection
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralConnection(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 630);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralConnection in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralConnection> Extent(SdaiModel model) { return ExtentRange<IfcStructuralConnection>(model, 630, false); }
+        static ExtentRange<IfcStructuralConnection> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralConnection>(model, 630, true); }
+
+        /// <summary>
+        /// Returns object of IfcStructuralConnection if the actual type of SdaiInstance is IfcStructuralConnection or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralConnection CreateExactEntity(SdaiInstance instance) { return IfcStructuralConnection(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralConnection or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralConnection(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcBoundaryCondition get_AppliedCondition();
+        void put_AppliedCondition(IfcBoundaryCondition inst);
+
+        //TList may be SetOfIfcRelConnectsStructuralMember or list of convertible elements
+        template <typename TList> void get_ConnectsStructuralMembers(TList& lst) { RDF_EXPRESS_PROBE(1390); SetOfIfcRelConnectsStructuralMemberSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1390)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralItem::attr
+        {
+            static constexpr IntValue AppliedCondition = 1389;
+            static constexpr IntValue ConnectsStructuralMembers = 1390;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralConnection_CLASS_H
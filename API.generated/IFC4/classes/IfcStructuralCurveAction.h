@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralCurveAction_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralCurveAction_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralAction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralCurveAction
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralCurveAction : public RDF_EXPRESS_VIRTUAL IfcStructuralAction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralCurveAction
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralCurveAction(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 632);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralCurveAction in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralCurveAction> Extent(SdaiModel model) { return ExtentRange<IfcStructuralCurveAction>(model, 632, false); }
+        static ExtentRange<IfcStructuralCurveAction> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralCurveAction>(model, 632, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralCurveAction and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralCurveAction Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralCurveAction"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralCurveAction if the actual type of SdaiInstance is IfcStructuralCurveAction or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralCurveAction CreateExactEntity(SdaiInstance instance) { return IfcStructuralCurveAction(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralCurveAction or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralCurveAction(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcProjectedOrTrueLengthEnum> get_ProjectedOrTrue() { RDF_EXPRESS_PROBE(1391); int v = getENUM(1391, IfcProjectedOrTrueLengthEnum_hash); if (v >= 0) return (IfcProjectedOrTrueLengthEnum) v; else return Nullable<IfcProjectedOrTrueLengthEnum>(); }
+        void put_ProjectedOrTrue(IfcProjectedOrTrueLengthEnum value) { RDF_EXPRESS_PROBE(1391); TextValue val = IfcProjectedOrTrueLengthEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1391), sdaiENUM, val); }
+
+        Nullable<IfcStructuralCurveActivityTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1392); int v = getENUM(1392, IfcStructuralCurveActivityTypeEnum_hash); if (v >= 0) return (IfcStructuralCurveActivityTypeEnum) v; else return Nullable<IfcStructuralCurveActivityTypeEnum>(); }
+        void put_PredefinedType(IfcStructuralCurveActivityTypeEnum value) { RDF_EXPRESS_PROBE(1392); TextValue val = IfcStructuralCurveActivityTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1392), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralAction::attr
+        {
+            static constexpr IntValue ProjectedOrTrue = 1391;
+            static constexpr IntValue PredefinedType = 1392;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralCurveAction_CLASS_H
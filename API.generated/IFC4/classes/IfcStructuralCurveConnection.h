@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralCurveConnection_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralCurveConnection_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralConnection.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralCurveConnection
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralCurveConnection : public RDF_EXPRESS_VIRTUAL IfcStructuralConnection
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralCurveConnection
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralCurveConnection(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 633);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralCurveConnection in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralCurveConnection> Extent(SdaiModel model) { return ExtentRange<IfcStructuralCurveConnection>(model, 633, false); }
+        static ExtentRange<IfcStructuralCurveConnection> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralCurveConnection>(model, 633, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralCurveConnection and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralCurveConnection Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralCurveConnection"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralCurveConnection if the actual type of SdaiInstance is IfcStructuralCurveConnection or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralCurveConnection CreateExactEntity(SdaiInstance instance) { return IfcStructuralCurveConnection(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralCurveConnection or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralCurveConnection(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDirection get_Axis();
+        void put_Axis(IfcDirection inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralConnection::attr
+        {
+            static constexpr IntValue Axis = 1393;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralCurveConnection_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralCurveMember_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralCurveMember_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralMember.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralCurveMember
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralCurveMember : public RDF_EXPRESS_VIRTUAL IfcStructuralMember
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralCurveMember
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralCurveMember(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 634);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralCurveMember in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralCurveMember> Extent(SdaiModel model) { return ExtentRange<IfcStructuralCurveMember>(model, 634, false); }
+        static ExtentRange<IfcStructuralCurveMember> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralCurveMember>(model, 634, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralCurveMember and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralCurveMember Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralCurveMember"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralCurveMember if the actual type of SdaiInstance is IfcStructuralCurveMember or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralCurveMember CreateExactEntity(SdaiInstance instance) { return IfcStructuralCurveMember(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralCurveMember or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralCurveMember(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcStructuralCurveMemberTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1395); int v = getENUM(1395, IfcStructuralCurveMemberTypeEnum_hash); if (v >= 0) return (IfcStructuralCurveMemberTypeEnum) v; else return Nullable<IfcStructuralCurveMemberTypeEnum>(); }
+        void put_PredefinedType(IfcStructuralCurveMemberTypeEnum value) { RDF_EXPRESS_PROBE(1395); TextValue val = IfcStructuralCurveMemberTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1395), sdaiENUM, val); }
+
+        IfcDirection get_Axis();
+        void put_Axis(IfcDirection inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralMember::attr
+        {
+            static constexpr IntValue PredefinedType = 1395;
+            static constexpr IntValue Axis = 1396;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralCurveMember_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralCurveMemberVarying_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralCurveMemberVarying_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralCurveMember.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralCurveMemberVarying
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralCurveMemberVarying : public RDF_EXPRESS_VIRTUAL IfcStructuralCurveMember
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralCurveMemberVarying
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralCurveMemberVarying(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 635);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralCurveMemberVarying in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralCurveMemberVarying> Extent(SdaiModel model) { return ExtentRange<IfcStructuralCurveMemberVarying>(model, 635, false); }
+        static ExtentRange<IfcStructuralCurveMemberVarying> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralCurveMemberVarying>(model, 635, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralCurveMemberVarying and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralCurveMemberVarying Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralCurveMemberVarying"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralCurveMemberVarying if the actual type of SdaiInstance is IfcStructuralCurveMemberVarying or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralCurveMemberVarying CreateExactEntity(SdaiInstance instance) { return IfcStructuralCurveMemberVarying(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralCurveMemberVarying or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralCurveMemberVarying(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralCurveMember::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralCurveMemberVarying_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralCurveReaction_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralCurveReaction_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralReaction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralCurveReaction
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralCurveReaction : public RDF_EXPRESS_VIRTUAL IfcStructuralReaction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralCurveReaction
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralCurveReaction(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 636);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralCurveReaction in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralCurveReaction> Extent(SdaiModel model) { return ExtentRange<IfcStructuralCurveReaction>(model, 636, false); }
+        static ExtentRange<IfcStructuralCurveReaction> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralCurveReaction>(model, 636, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralCurveReaction and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralCurveReaction Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralCurveReaction"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralCurveReaction if the actual type of SdaiInstance is IfcStructuralCurveReaction or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralCurveReaction CreateExactEntity(SdaiInstance instance) { return IfcStructuralCurveReaction(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralCurveReaction or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralCurveReaction(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcStructuralCurveActivityTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1397); int v = getENUM(1397, IfcStructuralCurveActivityTypeEnum_hash); if (v >= 0) return (IfcStructuralCurveActivityTypeEnum) v; else return Nullable<IfcStructuralCurveActivityTypeEnum>(); }
+        void put_PredefinedType(IfcStructuralCurveActivityTypeEnum value) { RDF_EXPRESS_PROBE(1397); TextValue val = IfcStructuralCurveActivityTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1397), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralReaction::attr
+        {
+            static constexpr IntValue PredefinedType = 1397;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralCurveReaction_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralItem_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralItem_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProduct.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralItem
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralItem : public RDF_EXPRESS_VIRTUAL IfcProduct
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralItem
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralItem(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 637);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralItem in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralItem> Extent(SdaiModel model) { return ExtentRange<IfcStructuralItem>(model, 637, false); }
+        static ExtentRange<IfcStructuralItem> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralItem>(model, 637, true); }
+
+        /// <summary>
+        /// Returns object of IfcStructuralItem if the actual type of SdaiInstance is IfcStructuralItem or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralItem CreateExactEntity(SdaiInstance instance) { return IfcStructuralItem(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralItem or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralItem(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcRelConnectsStructuralActivity or list of convertible elements
+        template <typename TList> void get_AssignedStructuralActivity(TList& lst) { RDF_EXPRESS_PROBE(1388); SetOfIfcRelConnectsStructuralActivitySerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1388)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProduct::attr
+        {
+            static constexpr IntValue AssignedStructuralActivity = 1388;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralItem_CLASS_H
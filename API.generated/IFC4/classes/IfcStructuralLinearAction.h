@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLinearAction_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLinearAction_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralCurveAction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLinearAction
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLinearAction : public RDF_EXPRESS_VIRTUAL IfcStructuralCurveAction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLinearAction
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLinearAction(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 638);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLinearAction in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLinearAction> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLinearAction>(model, 638, false); }
+        static ExtentRange<IfcStructuralLinearAction> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLinearAction>(model, 638, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralLinearAction and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralLinearAction Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralLinearAction"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralLinearAction if the actual type of SdaiInstance is IfcStructuralLinearAction or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLinearAction CreateExactEntity(SdaiInstance instance) { return IfcStructuralLinearAction(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLinearAction or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLinearAction(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralCurveAction::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLinearAction_CLASS_H
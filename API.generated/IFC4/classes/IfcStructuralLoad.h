@@ -0,0 +1,66 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoad_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLoad_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLoad
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLoad : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLoad
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLoad(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 639);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLoad in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLoad> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLoad>(model, 639, false); }
+        static ExtentRange<IfcStructuralLoad> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLoad>(model, 639, true); }
+
+        /// <summary>
+        /// Returns object of IfcStructuralLoad if the actual type of SdaiInstance is IfcStructuralLoad or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLoad CreateExactEntity(SdaiInstance instance) { return IfcStructuralLoad(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLoad or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLoad(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(1398); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1398), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(1398); sdaiPutAttr(m_instance, getAttrDefinition(1398), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1398); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Name = 1398;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoad_CLASS_H
@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadCase_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadCase_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralLoadGroup.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLoadCase
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLoadCase : public RDF_EXPRESS_VIRTUAL IfcStructuralLoadGroup
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLoadCase
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLoadCase(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 640);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLoadCase in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLoadCase> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLoadCase>(model, 640, false); }
+        static ExtentRange<IfcStructuralLoadCase> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLoadCase>(model, 640, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralLoadCase and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralLoadCase Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralLoadCase"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralLoadCase if the actual type of SdaiInstance is IfcStructuralLoadCase or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLoadCase CreateExactEntity(SdaiInstance instance) { return IfcStructuralLoadCase(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLoadCase or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLoadCase(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcRatioMeasure or list of convertible elements
+        template <typename TList> void get_SelfWeightCoefficients(TList& lst) { RDF_EXPRESS_PROBE(1406); ListOfIfcRatioMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1406)); }
+
+        //TList may be ListOfIfcRatioMeasure or list of convertible elements
+        template <typename TList> void put_SelfWeightCoefficients(TList& lst) { RDF_EXPRESS_PROBE(1406); ListOfIfcRatioMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1406)); }
+
+        //TArrayElem[] may be IfcRatioMeasure[] or array of convertible elements
+        template <typename TArrayElem> void put_SelfWeightCoefficients(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1406); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcRatioMeasureSerializer<ListOfIfcRatioMeasure> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1406)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralLoadGroup::attr
+        {
+            static constexpr IntValue SelfWeightCoefficients = 1406;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadCase_CLASS_H
@@ -0,0 +1,91 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadConfiguration_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadConfiguration_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralLoad.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLoadConfiguration
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLoadConfiguration : public RDF_EXPRESS_VIRTUAL IfcStructuralLoad
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLoadConfiguration
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLoadConfiguration(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 641);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLoadConfiguration in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLoadConfiguration> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLoadConfiguration>(model, 641, false); }
+        static ExtentRange<IfcStructuralLoadConfiguration> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLoadConfiguration>(model, 641, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralLoadConfiguration and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralLoadConfiguration Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralLoadConfiguration"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralLoadConfiguration if the actual type of SdaiInstance is IfcStructuralLoadConfiguration or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLoadConfiguration CreateExactEntity(SdaiInstance instance) { return IfcStructuralLoadConfiguration(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLoadConfiguration or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLoadConfiguration(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcStructuralLoadOrResult or list of convertible elements
+        template <typename TList> void get_Values(TList& lst) { RDF_EXPRESS_PROBE(1407); ListOfIfcStructuralLoadOrResultSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1407)); }
+
+        //TList may be ListOfIfcStructuralLoadOrResult or list of convertible elements
+        template <typename TList> void put_Values(TList& lst) { RDF_EXPRESS_PROBE(1407); ListOfIfcStructuralLoadOrResultSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1407)); }
+
+        //TArrayElem[] may be IfcStructuralLoadOrResult[] or array of convertible elements
+        template <typename TArrayElem> void put_Values(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1407); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcStructuralLoadOrResultSerializer<ListOfIfcStructuralLoadOrResult> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1407)); }
+
+        //TList may be ListOfListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void get_Locations(TList& lst) { RDF_EXPRESS_PROBE(1408); ListOfListOfIfcLengthMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1408)); }
+
+        //TList may be ListOfListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void put_Locations(TList& lst) { RDF_EXPRESS_PROBE(1408); ListOfListOfIfcLengthMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1408)); }
+
+        //reads inner aggregations into flat buffer, stride elements each (e.g. xyz of points), returns number of inner aggregations
+        template <typename TElem> IntValue get_Locations(TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(1408); return FlatAggrFromAttr<TElem, IfcLengthMeasure, sdaiREAL>(m_instance, getAttrDefinition(1408), buffer, size, stride); }
+        template <typename TElem> IntValue get_Locations(std::vector<TElem>& flat, size_t stride) { RDF_EXPRESS_PROBE(1408); return FlatAggrFromAttr<TElem, IfcLengthMeasure, sdaiREAL>(m_instance, getAttrDefinition(1408), flat, stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> IntValue get_Locations(std::span<TElem> buffer, size_t stride) { return get_Locations(buffer.data(), buffer.size(), stride); }
+#endif
+
+        //writes flat buffer as inner aggregations of stride elements each (e.g. xyz of points), no intermediate lists
+        template <typename TElem> void put_Locations(const TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(1408); FlatAggrToAttr<TElem, IfcLengthMeasure, sdaiREAL>(m_instance, getAttrDefinition(1408), buffer, size, stride); }
+        template <typename TElem> void put_Locations(const std::vector<TElem>& flat, size_t stride) { put_Locations(flat.data(), flat.size(), stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> void put_Locations(std::span<const TElem> buffer, size_t stride) { put_Locations(buffer.data(), buffer.size(), stride); }
+#endif
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralLoad::attr
+        {
+            static constexpr IntValue Values = 1407;
+            static constexpr IntValue Locations = 1408;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadConfiguration_CLASS_H
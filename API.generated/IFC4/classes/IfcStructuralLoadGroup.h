@@ -0,0 +1,95 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadGroup_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadGroup_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGroup.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLoadGroup
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLoadGroup : public RDF_EXPRESS_VIRTUAL IfcGroup
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLoadGroup
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLoadGroup(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 642);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLoadGroup in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLoadGroup> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLoadGroup>(model, 642, false); }
+        static ExtentRange<IfcStructuralLoadGroup> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLoadGroup>(model, 642, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralLoadGroup and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralLoadGroup Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralLoadGroup"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralLoadGroup if the actual type of SdaiInstance is IfcStructuralLoadGroup or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLoadGroup CreateExactEntity(SdaiInstance instance) { return IfcStructuralLoadGroup(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLoadGroup or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLoadGroup(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLoadGroupTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1399); int v = getENUM(1399, IfcLoadGroupTypeEnum_hash); if (v >= 0) return (IfcLoadGroupTypeEnum) v; else return Nullable<IfcLoadGroupTypeEnum>(); }
+        void put_PredefinedType(IfcLoadGroupTypeEnum value) { RDF_EXPRESS_PROBE(1399); TextValue val = IfcLoadGroupTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1399), sdaiENUM, val); }
+
+        Nullable<IfcActionTypeEnum> get_ActionType() { RDF_EXPRESS_PROBE(1400); int v = getENUM(1400, IfcActionTypeEnum_hash); if (v >= 0) return (IfcActionTypeEnum) v; else return Nullable<IfcActionTypeEnum>(); }
+        void put_ActionType(IfcActionTypeEnum value) { RDF_EXPRESS_PROBE(1400); TextValue val = IfcActionTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1400), sdaiENUM, val); }
+
+        Nullable<IfcActionSourceTypeEnum> get_ActionSource() { RDF_EXPRESS_PROBE(1401); int v = getENUM(1401, IfcActionSourceTypeEnum_hash); if (v >= 0) return (IfcActionSourceTypeEnum) v; else return Nullable<IfcActionSourceTypeEnum>(); }
+        void put_ActionSource(IfcActionSourceTypeEnum value) { RDF_EXPRESS_PROBE(1401); TextValue val = IfcActionSourceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1401), sdaiENUM, val); }
+
+        Nullable<IfcRatioMeasure> get_Coefficient() { RDF_EXPRESS_PROBE(1402); IfcRatioMeasure val = (IfcRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1402), sdaiREAL, &val)) return val; else return Nullable<IfcRatioMeasure>(); }
+        void put_Coefficient(IfcRatioMeasure value) { RDF_EXPRESS_PROBE(1402); sdaiPutAttr(m_instance, getAttrDefinition(1402), sdaiREAL, &value); }
+
+        IfcLabel get_Purpose() { RDF_EXPRESS_PROBE(1403); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1403), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Purpose_view() { return TextView(get_Purpose()); }
+#endif
+        void put_Purpose(IfcLabel value) { RDF_EXPRESS_PROBE(1403); sdaiPutAttr(m_instance, getAttrDefinition(1403), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Purpose_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1403); return buffer.GetAttr(m_instance, "Purpose"); }
+        const char* get_Purpose_utf8() { return get_Purpose_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcStructuralResultGroup or list of convertible elements
+        template <typename TList> void get_SourceOfResultGroup(TList& lst) { RDF_EXPRESS_PROBE(1404); SetOfIfcStructuralResultGroupSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1404)); }
+
+        //TList may be SetOfIfcStructuralAnalysisModel or list of convertible elements
+        template <typename TList> void get_LoadGroupFor(TList& lst) { RDF_EXPRESS_PROBE(1405); SetOfIfcStructuralAnalysisModelSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1405)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGroup::attr
+        {
+            static constexpr IntValue PredefinedType = 1399;
+            static constexpr IntValue ActionType = 1400;
+            static constexpr IntValue ActionSource = 1401;
+            static constexpr IntValue Coefficient = 1402;
+            static constexpr IntValue Purpose = 1403;
+            static constexpr IntValue SourceOfResultGroup = 1404;
+            static constexpr IntValue LoadGroupFor = 1405;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadGroup_CLASS_H
@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadLinearForce_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadLinearForce_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralLoadStatic.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLoadLinearForce
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLoadLinearForce : public RDF_EXPRESS_VIRTUAL IfcStructuralLoadStatic
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLoadLinearForce
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLoadLinearForce(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 643);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLoadLinearForce in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLoadLinearForce> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLoadLinearForce>(model, 643, false); }
+        static ExtentRange<IfcStructuralLoadLinearForce> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLoadLinearForce>(model, 643, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralLoadLinearForce and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralLoadLinearForce Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralLoadLinearForce"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralLoadLinearForce if the actual type of SdaiInstance is IfcStructuralLoadLinearForce or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLoadLinearForce CreateExactEntity(SdaiInstance instance) { return IfcStructuralLoadLinearForce(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLoadLinearForce or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLoadLinearForce(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLinearForceMeasure> get_LinearForceX() { RDF_EXPRESS_PROBE(1409); IfcLinearForceMeasure val = (IfcLinearForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1409), sdaiREAL, &val)) return val; else return Nullable<IfcLinearForceMeasure>(); }
+        void put_LinearForceX(IfcLinearForceMeasure value) { RDF_EXPRESS_PROBE(1409); sdaiPutAttr(m_instance, getAttrDefinition(1409), sdaiREAL, &value); }
+
+        Nullable<IfcLinearForceMeasure> get_LinearForceY() { RDF_EXPRESS_PROBE(1410); IfcLinearForceMeasure val = (IfcLinearForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1410), sdaiREAL, &val)) return val; else return Nullable<IfcLinearForceMeasure>(); }
+        void put_LinearForceY(IfcLinearForceMeasure value) { RDF_EXPRESS_PROBE(1410); sdaiPutAttr(m_instance, getAttrDefinition(1410), sdaiREAL, &value); }
+
+        Nullable<IfcLinearForceMeasure> get_LinearForceZ() { RDF_EXPRESS_PROBE(1411); IfcLinearForceMeasure val = (IfcLinearForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1411), sdaiREAL, &val)) return val; else return Nullable<IfcLinearForceMeasure>(); }
+        void put_LinearForceZ(IfcLinearForceMeasure value) { RDF_EXPRESS_PROBE(1411); sdaiPutAttr(m_instance, getAttrDefinition(1411), sdaiREAL, &value); }
+
+        Nullable<IfcLinearMomentMeasure> get_LinearMomentX() { RDF_EXPRESS_PROBE(1412); IfcLinearMomentMeasure val = (IfcLinearMomentMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1412), sdaiREAL, &val)) return val; else return Nullable<IfcLinearMomentMeasure>(); }
+        void put_LinearMomentX(IfcLinearMomentMeasure value) { RDF_EXPRESS_PROBE(1412); sdaiPutAttr(m_instance, getAttrDefinition(1412), sdaiREAL, &value); }
+
+        Nullable<IfcLinearMomentMeasure> get_LinearMomentY() { RDF_EXPRESS_PROBE(1413); IfcLinearMomentMeasure val = (IfcLinearMomentMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1413), sdaiREAL, &val)) return val; else return Nullable<IfcLinearMomentMeasure>(); }
+        void put_LinearMomentY(IfcLinearMomentMeasure value) { RDF_EXPRESS_PROBE(1413); sdaiPutAttr(m_instance, getAttrDefinition(1413), sdaiREAL, &value); }
+
+        Nullable<IfcLinearMomentMeasure> get_LinearMomentZ() { RDF_EXPRESS_PROBE(1414); IfcLinearMomentMeasure val = (IfcLinearMomentMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1414), sdaiREAL, &val)) return val; else return Nullable<IfcLinearMomentMeasure>(); }
+        void put_LinearMomentZ(IfcLinearMomentMeasure value) { RDF_EXPRESS_PROBE(1414); sdaiPutAttr(m_instance, getAttrDefinition(1414), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralLoadStatic::attr
+        {
+            static constexpr IntValue LinearForceX = 1409;
+            static constexpr IntValue LinearForceY = 1410;
+            static constexpr IntValue LinearForceZ = 1411;
+            static constexpr IntValue LinearMomentX = 1412;
+            static constexpr IntValue LinearMomentY = 1413;
+            static constexpr IntValue LinearMomentZ = 1414;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadLinearForce_CLASS_H
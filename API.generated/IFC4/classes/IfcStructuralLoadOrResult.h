@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadOrResult_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadOrResult_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralLoad.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLoadOrResult
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLoadOrResult : public RDF_EXPRESS_VIRTUAL IfcStructuralLoad
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLoadOrResult
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLoadOrResult(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 644);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLoadOrResult in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLoadOrResult> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLoadOrResult>(model, 644, false); }
+        static ExtentRange<IfcStructuralLoadOrResult> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLoadOrResult>(model, 644, true); }
+
+        /// <summary>
+        /// Returns object of IfcStructuralLoadOrResult if the actual type of SdaiInstance is IfcStructuralLoadOrResult or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLoadOrResult CreateExactEntity(SdaiInstance instance) { return IfcStructuralLoadOrResult(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLoadOrResult or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLoadOrResult(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralLoad::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadOrResult_CLASS_H
@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadPlanarForce_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadPlanarForce_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralLoadStatic.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLoadPlanarForce
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLoadPlanarForce : public RDF_EXPRESS_VIRTUAL IfcStructuralLoadStatic
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLoadPlanarForce
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLoadPlanarForce(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 645);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLoadPlanarForce in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLoadPlanarForce> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLoadPlanarForce>(model, 645, false); }
+        static ExtentRange<IfcStructuralLoadPlanarForce> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLoadPlanarForce>(model, 645, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralLoadPlanarForce and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralLoadPlanarForce Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralLoadPlanarForce"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralLoadPlanarForce if the actual type of SdaiInstance is IfcStructuralLoadPlanarForce or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLoadPlanarForce CreateExactEntity(SdaiInstance instance) { return IfcStructuralLoadPlanarForce(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLoadPlanarForce or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLoadPlanarForce(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPlanarForceMeasure> get_PlanarForceX() { RDF_EXPRESS_PROBE(1415); IfcPlanarForceMeasure val = (IfcPlanarForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1415), sdaiREAL, &val)) return val; else return Nullable<IfcPlanarForceMeasure>(); }
+        void put_PlanarForceX(IfcPlanarForceMeasure value) { RDF_EXPRESS_PROBE(1415); sdaiPutAttr(m_instance, getAttrDefinition(1415), sdaiREAL, &value); }
+
+        Nullable<IfcPlanarForceMeasure> get_PlanarForceY() { RDF_EXPRESS_PROBE(1416); IfcPlanarForceMeasure val = (IfcPlanarForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1416), sdaiREAL, &val)) return val; else return Nullable<IfcPlanarForceMeasure>(); }
+        void put_PlanarForceY(IfcPlanarForceMeasure value) { RDF_EXPRESS_PROBE(1416); sdaiPutAttr(m_instance, getAttrDefinition(1416), sdaiREAL, &value); }
+
+        Nullable<IfcPlanarForceMeasure> get_PlanarForceZ() { RDF_EXPRESS_PROBE(1417); IfcPlanarForceMeasure val = (IfcPlanarForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1417), sdaiREAL, &val)) return val; else return Nullable<IfcPlanarForceMeasure>(); }
+        void put_PlanarForceZ(IfcPlanarForceMeasure value) { RDF_EXPRESS_PROBE(1417); sdaiPutAttr(m_instance, getAttrDefinition(1417), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralLoadStatic::attr
+        {
+            static constexpr IntValue PlanarForceX = 1415;
+            static constexpr IntValue PlanarForceY = 1416;
+            static constexpr IntValue PlanarForceZ = 1417;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadPlanarForce_CLASS_H
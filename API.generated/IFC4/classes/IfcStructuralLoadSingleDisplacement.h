@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadSingleDisplacement_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadSingleDisplacement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralLoadStatic.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLoadSingleDisplacement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLoadSingleDisplacement : public RDF_EXPRESS_VIRTUAL IfcStructuralLoadStatic
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLoadSingleDisplacement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLoadSingleDisplacement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 646);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLoadSingleDisplacement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLoadSingleDisplacement> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLoadSingleDisplacement>(model, 646, false); }
+        static ExtentRange<IfcStructuralLoadSingleDisplacement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLoadSingleDisplacement>(model, 646, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralLoadSingleDisplacement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralLoadSingleDisplacement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralLoadSingleDisplacement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralLoadSingleDisplacement if the actual type of SdaiInstance is IfcStructuralLoadSingleDisplacement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLoadSingleDisplacement CreateExactEntity(SdaiInstance instance) { return IfcStructuralLoadSingleDisplacement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLoadSingleDisplacement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLoadSingleDisplacement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcLengthMeasure> get_DisplacementX() { RDF_EXPRESS_PROBE(1418); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1418), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_DisplacementX(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1418); sdaiPutAttr(m_instance, getAttrDefinition(1418), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_DisplacementY() { RDF_EXPRESS_PROBE(1419); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1419), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_DisplacementY(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1419); sdaiPutAttr(m_instance, getAttrDefinition(1419), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_DisplacementZ() { RDF_EXPRESS_PROBE(1420); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1420), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_DisplacementZ(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1420); sdaiPutAttr(m_instance, getAttrDefinition(1420), sdaiREAL, &value); }
+
+        Nullable<IfcPlaneAngleMeasure> get_RotationalDisplacementRX() { RDF_EXPRESS_PROBE(1421); IfcPlaneAngleMeasure val = (IfcPlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1421), sdaiREAL, &val)) return val; else return Nullable<IfcPlaneAngleMeasure>(); }
+        void put_RotationalDisplacementRX(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(1421); sdaiPutAttr(m_instance, getAttrDefinition(1421), sdaiREAL, &value); }
+
+        Nullable<IfcPlaneAngleMeasure> get_RotationalDisplacementRY() { RDF_EXPRESS_PROBE(1422); IfcPlaneAngleMeasure val = (IfcPlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1422), sdaiREAL, &val)) return val; else return Nullable<IfcPlaneAngleMeasure>(); }
+        void put_RotationalDisplacementRY(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(1422); sdaiPutAttr(m_instance, getAttrDefinition(1422), sdaiREAL, &value); }
+
+        Nullable<IfcPlaneAngleMeasure> get_RotationalDisplacementRZ() { RDF_EXPRESS_PROBE(1423); IfcPlaneAngleMeasure val = (IfcPlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1423), sdaiREAL, &val)) return val; else return Nullable<IfcPlaneAngleMeasure>(); }
+        void put_RotationalDisplacementRZ(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(1423); sdaiPutAttr(m_instance, getAttrDefinition(1423), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralLoadStatic::attr
+        {
+            static constexpr IntValue DisplacementX = 1418;
+            static constexpr IntValue DisplacementY = 1419;
+            static constexpr IntValue DisplacementZ = 1420;
+            static constexpr IntValue RotationalDisplacementRX = 1421;
+            static constexpr IntValue RotationalDisplacementRY = 1422;
+            static constexpr IntValue RotationalDisplacementRZ = 1423;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadSingleDisplacement_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadSingleDisplacementDistortion_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadSingleDisplacementDistortion_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralLoadSingleDisplacement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLoadSingleDisplacementDistortion
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLoadSingleDisplacementDistortion : public RDF_EXPRESS_VIRTUAL IfcStructuralLoadSingleDisplacement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLoadSingleDisplacementDistortion
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLoadSingleDisplacementDistortion(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 647);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLoadSingleDisplacementDistortion in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLoadSingleDisplacementDistortion> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLoadSingleDisplacementDistortion>(model, 647, false); }
+        static ExtentRange<IfcStructuralLoadSingleDisplacementDistortion> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLoadSingleDisplacementDistortion>(model, 647, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralLoadSingleDisplacementDistortion and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralLoadSingleDisplacementDistortion Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralLoadSingleDisplacementDistortion"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralLoadSingleDisplacementDistortion if the actual type of SdaiInstance is IfcStructuralLoadSingleDisplacementDistortion or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLoadSingleDisplacementDistortion CreateExactEntity(SdaiInstance instance) { return IfcStructuralLoadSingleDisplacementDistortion(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLoadSingleDisplacementDistortion or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLoadSingleDisplacementDistortion(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcCurvatureMeasure> get_Distortion() { RDF_EXPRESS_PROBE(1424); IfcCurvatureMeasure val = (IfcCurvatureMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1424), sdaiREAL, &val)) return val; else return Nullable<IfcCurvatureMeasure>(); }
+        void put_Distortion(IfcCurvatureMeasure value) { RDF_EXPRESS_PROBE(1424); sdaiPutAttr(m_instance, getAttrDefinition(1424), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralLoadSingleDisplacement::attr
+        {
+            static constexpr IntValue Distortion = 1424;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadSingleDisplacementDistortion_CLASS_H
@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadSingleForce_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadSingleForce_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralLoadStatic.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLoadSingleForce
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLoadSingleForce : public RDF_EXPRESS_VIRTUAL IfcStructuralLoadStatic
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLoadSingleForce
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLoadSingleForce(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 648);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLoadSingleForce in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLoadSingleForce> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLoadSingleForce>(model, 648, false); }
+        static ExtentRange<IfcStructuralLoadSingleForce> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLoadSingleForce>(model, 648, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralLoadSingleForce and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralLoadSingleForce Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralLoadSingleForce"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralLoadSingleForce if the actual type of SdaiInstance is IfcStructuralLoadSingleForce or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLoadSingleForce CreateExactEntity(SdaiInstance instance) { return IfcStructuralLoadSingleForce(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLoadSingleForce or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLoadSingleForce(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcForceMeasure> get_ForceX() { RDF_EXPRESS_PROBE(1425); IfcForceMeasure val = (IfcForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1425), sdaiREAL, &val)) return val; else return Nullable<IfcForceMeasure>(); }
+        void put_ForceX(IfcForceMeasure value) { RDF_EXPRESS_PROBE(1425); sdaiPutAttr(m_instance, getAttrDefinition(1425), sdaiREAL, &value); }
+
+        Nullable<IfcForceMeasure> get_ForceY() { RDF_EXPRESS_PROBE(1426); IfcForceMeasure val = (IfcForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1426), sdaiREAL, &val)) return val; else return Nullable<IfcForceMeasure>(); }
+        void put_ForceY(IfcForceMeasure value) { RDF_EXPRESS_PROBE(1426); sdaiPutAttr(m_instance, getAttrDefinition(1426), sdaiREAL, &value); }
+
+        Nullable<IfcForceMeasure> get_ForceZ() { RDF_EXPRESS_PROBE(1427); IfcForceMeasure val = (IfcForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1427), sdaiREAL, &val)) return val; else return Nullable<IfcForceMeasure>(); }
+        void put_ForceZ(IfcForceMeasure value) { RDF_EXPRESS_PROBE(1427); sdaiPutAttr(m_instance, getAttrDefinition(1427), sdaiREAL, &value); }
+
+        Nullable<IfcTorqueMeasure> get_MomentX() { RDF_EXPRESS_PROBE(1428); IfcTorqueMeasure val = (IfcTorqueMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1428), sdaiREAL, &val)) return val; else return Nullable<IfcTorqueMeasure>(); }
+        void put_MomentX(IfcTorqueMeasure value) { RDF_EXPRESS_PROBE(1428); sdaiPutAttr(m_instance, getAttrDefinition(1428), sdaiREAL, &value); }
+
+        Nullable<IfcTorqueMeasure> get_MomentY() { RDF_EXPRESS_PROBE(1429); IfcTorqueMeasure val = (IfcTorqueMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1429), sdaiREAL, &val)) return val; else return Nullable<IfcTorqueMeasure>(); }
+        void put_MomentY(IfcTorqueMeasure value) { RDF_EXPRESS_PROBE(1429); sdaiPutAttr(m_instance, getAttrDefinition(1429), sdaiREAL, &value); }
+
+        Nullable<IfcTorqueMeasure> get_MomentZ() { RDF_EXPRESS_PROBE(1430); IfcTorqueMeasure val = (IfcTorqueMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1430), sdaiREAL, &val)) return val; else return Nullable<IfcTorqueMeasure>(); }
+        void put_MomentZ(IfcTorqueMeasure value) { RDF_EXPRESS_PROBE(1430); sdaiPutAttr(m_instance, getAttrDefinition(1430), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralLoadStatic::attr
+        {
+            static constexpr IntValue ForceX = 1425;
+            static constexpr IntValue ForceY = 1426;
+            static constexpr IntValue ForceZ = 1427;
+            static constexpr IntValue MomentX = 1428;
+            static constexpr IntValue MomentY = 1429;
+            static constexpr IntValue MomentZ = 1430;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadSingleForce_CLASS_H
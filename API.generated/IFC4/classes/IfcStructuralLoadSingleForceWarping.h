@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadSingleForceWarping_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadSingleForceWarping_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralLoadSingleForce.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLoadSingleForceWarping
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLoadSingleForceWarping : public RDF_EXPRESS_VIRTUAL IfcStructuralLoadSingleForce
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLoadSingleForceWarping
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLoadSingleForceWarping(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 649);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLoadSingleForceWarping in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLoadSingleForceWarping> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLoadSingleForceWarping>(model, 649, false); }
+        static ExtentRange<IfcStructuralLoadSingleForceWarping> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLoadSingleForceWarping>(model, 649, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralLoadSingleForceWarping and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralLoadSingleForceWarping Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralLoadSingleForceWarping"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralLoadSingleForceWarping if the actual type of SdaiInstance is IfcStructuralLoadSingleForceWarping or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLoadSingleForceWarping CreateExactEntity(SdaiInstance instance) { return IfcStructuralLoadSingleForceWarping(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLoadSingleForceWarping or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLoadSingleForceWarping(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcWarpingMomentMeasure> get_WarpingMoment() { RDF_EXPRESS_PROBE(1431); IfcWarpingMomentMeasure val = (IfcWarpingMomentMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1431), sdaiREAL, &val)) return val; else return Nullable<IfcWarpingMomentMeasure>(); }
+        void put_WarpingMoment(IfcWarpingMomentMeasure value) { RDF_EXPRESS_PROBE(1431); sdaiPutAttr(m_instance, getAttrDefinition(1431), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralLoadSingleForce::attr
+        {
+            static constexpr IntValue WarpingMoment = 1431;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadSingleForceWarping_CLASS_H
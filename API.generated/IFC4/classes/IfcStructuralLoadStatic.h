@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadStatic_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadStatic_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralLoadOrResult.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLoadStatic
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLoadStatic : public RDF_EXPRESS_VIRTUAL IfcStructuralLoadOrResult
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLoadStatic
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLoadStatic(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 650);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLoadStatic in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLoadStatic> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLoadStatic>(model, 650, false); }
+        static ExtentRange<IfcStructuralLoadStatic> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLoadStatic>(model, 650, true); }
+
+        /// <summary>
+        /// Returns object of IfcStructuralLoadStatic if the actual type of SdaiInstance is IfcStructuralLoadStatic or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLoadStatic CreateExactEntity(SdaiInstance instance) { return IfcStructuralLoadStatic(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLoadStatic or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLoadStatic(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralLoadOrResult::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadStatic_CLASS_H
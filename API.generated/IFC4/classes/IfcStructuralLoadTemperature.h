@@ -0,0 +1,72 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralLoadTemperature_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralLoadTemperature_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralLoadStatic.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralLoadTemperature
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralLoadTemperature : public RDF_EXPRESS_VIRTUAL IfcStructuralLoadStatic
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralLoadTemperature
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralLoadTemperature(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 651);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralLoadTemperature in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralLoadTemperature> Extent(SdaiModel model) { return ExtentRange<IfcStructuralLoadTemperature>(model, 651, false); }
+        static ExtentRange<IfcStructuralLoadTemperature> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralLoadTemperature>(model, 651, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralLoadTemperature and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralLoadTemperature Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralLoadTemperature"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralLoadTemperature if the actual type of SdaiInstance is IfcStructuralLoadTemperature or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralLoadTemperature CreateExactEntity(SdaiInstance instance) { return IfcStructuralLoadTemperature(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralLoadTemperature or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralLoadTemperature(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcThermodynamicTemperatureMeasure> get_DeltaTConstant() { RDF_EXPRESS_PROBE(1432); IfcThermodynamicTemperatureMeasure val = (IfcThermodynamicTemperatureMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1432), sdaiREAL, &val)) return val; else return Nullable<IfcThermodynamicTemperatureMeasure>(); }
+        void put_DeltaTConstant(IfcThermodynamicTemperatureMeasure value) { RDF_EXPRESS_PROBE(1432); sdaiPutAttr(m_instance, getAttrDefinition(1432), sdaiREAL, &value); }
+
+        Nullable<IfcThermodynamicTemperatureMeasure> get_DeltaTY() { RDF_EXPRESS_PROBE(1433); IfcThermodynamicTemperatureMeasure val = (IfcThermodynamicTemperatureMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1433), sdaiREAL, &val)) return val; else return Nullable<IfcThermodynamicTemperatureMeasure>(); }
+        void put_DeltaTY(IfcThermodynamicTemperatureMeasure value) { RDF_EXPRESS_PROBE(1433); sdaiPutAttr(m_instance, getAttrDefinition(1433), sdaiREAL, &value); }
+
+        Nullable<IfcThermodynamicTemperatureMeasure> get_DeltaTZ() { RDF_EXPRESS_PROBE(1434); IfcThermodynamicTemperatureMeasure val = (IfcThermodynamicTemperatureMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1434), sdaiREAL, &val)) return val; else return Nullable<IfcThermodynamicTemperatureMeasure>(); }
+        void put_DeltaTZ(IfcThermodynamicTemperatureMeasure value) { RDF_EXPRESS_PROBE(1434); sdaiPutAttr(m_instance, getAttrDefinition(1434), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralLoadStatic::attr
+        {
+            static constexpr IntValue DeltaTConstant = 1432;
+            static constexpr IntValue DeltaTY = 1433;
+            static constexpr IntValue DeltaTZ = 1434;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralLoadTemperature_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralMember_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralMember_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralMember
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralMember : public RDF_EXPRESS_VIRTUAL IfcStructuralItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralMember
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralMember(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 652);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralMember in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralMember> Extent(SdaiModel model) { return ExtentRange<IfcStructuralMember>(model, 652, false); }
+        static ExtentRange<IfcStructuralMember> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralMember>(model, 652, true); }
+
+        /// <summary>
+        /// Returns object of IfcStructuralMember if the actual type of SdaiInstance is IfcStructuralMember or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralMember CreateExactEntity(SdaiInstance instance) { return IfcStructuralMember(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralMember or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralMember(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcRelConnectsStructuralMember or list of convertible elements
+        template <typename TList> void get_ConnectedBy(TList& lst) { RDF_EXPRESS_PROBE(1394); SetOfIfcRelConnectsStructuralMemberSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1394)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralItem::attr
+        {
+            static constexpr IntValue ConnectedBy = 1394;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralMember_CLASS_H
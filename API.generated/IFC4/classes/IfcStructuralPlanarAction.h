@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralPlanarAction_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralPlanarAction_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralSurfaceAction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralPlanarAction
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralPlanarAction : public RDF_EXPRESS_VIRTUAL IfcStructuralSurfaceAction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralPlanarAction
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralPlanarAction(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 653);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralPlanarAction in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralPlanarAction> Extent(SdaiModel model) { return ExtentRange<IfcStructuralPlanarAction>(model, 653, false); }
+        static ExtentRange<IfcStructuralPlanarAction> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralPlanarAction>(model, 653, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralPlanarAction and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralPlanarAction Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralPlanarAction"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralPlanarAction if the actual type of SdaiInstance is IfcStructuralPlanarAction or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralPlanarAction CreateExactEntity(SdaiInstance instance) { return IfcStructuralPlanarAction(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralPlanarAction or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralPlanarAction(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralSurfaceAction::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralPlanarAction_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralPointAction_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralPointAction_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralAction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralPointAction
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralPointAction : public RDF_EXPRESS_VIRTUAL IfcStructuralAction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralPointAction
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralPointAction(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 654);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralPointAction in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralPointAction> Extent(SdaiModel model) { return ExtentRange<IfcStructuralPointAction>(model, 654, false); }
+        static ExtentRange<IfcStructuralPointAction> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralPointAction>(model, 654, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralPointAction and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralPointAction Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralPointAction"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralPointAction if the actual type of SdaiInstance is IfcStructuralPointAction or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralPointAction CreateExactEntity(SdaiInstance instance) { return IfcStructuralPointAction(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralPointAction or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralPointAction(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralAction::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralPointAction_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralPointConnection_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralPointConnection_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralConnection.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralPointConnection
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralPointConnection : public RDF_EXPRESS_VIRTUAL IfcStructuralConnection
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralPointConnection
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralPointConnection(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 655);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralPointConnection in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralPointConnection> Extent(SdaiModel model) { return ExtentRange<IfcStructuralPointConnection>(model, 655, false); }
+        static ExtentRange<IfcStructuralPointConnection> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralPointConnection>(model, 655, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralPointConnection and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralPointConnection Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralPointConnection"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralPointConnection if the actual type of SdaiInstance is IfcStructuralPointConnection or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralPointConnection CreateExactEntity(SdaiInstance instance) { return IfcStructuralPointConnection(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralPointConnection or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralPointConnection(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcAxis2Placement3D get_ConditionCoordinateSystem();
+        void put_ConditionCoordinateSystem(IfcAxis2Placement3D inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralConnection::attr
+        {
+            static constexpr IntValue ConditionCoordinateSystem = 1437;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralPointConnection_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralPointReaction_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralPointReaction_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralReaction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralPointReaction
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralPointReaction : public RDF_EXPRESS_VIRTUAL IfcStructuralReaction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralPointReaction
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralPointReaction(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 656);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralPointReaction in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralPointReaction> Extent(SdaiModel model) { return ExtentRange<IfcStructuralPointReaction>(model, 656, false); }
+        static ExtentRange<IfcStructuralPointReaction> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralPointReaction>(model, 656, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralPointReaction and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralPointReaction Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralPointReaction"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralPointReaction if the actual type of SdaiInstance is IfcStructuralPointReaction or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralPointReaction CreateExactEntity(SdaiInstance instance) { return IfcStructuralPointReaction(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralPointReaction or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralPointReaction(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralReaction::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralPointReaction_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralReaction_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralReaction_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralActivity.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralReaction
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralReaction : public RDF_EXPRESS_VIRTUAL IfcStructuralActivity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralReaction
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralReaction(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 657);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralReaction in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralReaction> Extent(SdaiModel model) { return ExtentRange<IfcStructuralReaction>(model, 657, false); }
+        static ExtentRange<IfcStructuralReaction> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralReaction>(model, 657, true); }
+
+        /// <summary>
+        /// Returns object of IfcStructuralReaction if the actual type of SdaiInstance is IfcStructuralReaction or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralReaction CreateExactEntity(SdaiInstance instance) { return IfcStructuralReaction(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralReaction or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralReaction(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralActivity::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralReaction_CLASS_H
@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralResultGroup_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralResultGroup_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGroup.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralResultGroup
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralResultGroup : public RDF_EXPRESS_VIRTUAL IfcGroup
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralResultGroup
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralResultGroup(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 658);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralResultGroup in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralResultGroup> Extent(SdaiModel model) { return ExtentRange<IfcStructuralResultGroup>(model, 658, false); }
+        static ExtentRange<IfcStructuralResultGroup> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralResultGroup>(model, 658, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralResultGroup and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralResultGroup Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralResultGroup"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralResultGroup if the actual type of SdaiInstance is IfcStructuralResultGroup or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralResultGroup CreateExactEntity(SdaiInstance instance) { return IfcStructuralResultGroup(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralResultGroup or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralResultGroup(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcAnalysisTheoryTypeEnum> get_TheoryType() { RDF_EXPRESS_PROBE(1438); int v = getENUM(1438, IfcAnalysisTheoryTypeEnum_hash); if (v >= 0) return (IfcAnalysisTheoryTypeEnum) v; else return Nullable<IfcAnalysisTheoryTypeEnum>(); }
+        void put_TheoryType(IfcAnalysisTheoryTypeEnum value) { RDF_EXPRESS_PROBE(1438); TextValue val = IfcAnalysisTheoryTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1438), sdaiENUM, val); }
+
+        IfcStructuralLoadGroup get_ResultForLoadGroup();
+        void put_ResultForLoadGroup(IfcStructuralLoadGroup inst);
+
+        Nullable<IfcBoolean> get_IsLinear() { RDF_EXPRESS_PROBE(1440); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1440), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_IsLinear(IfcBoolean value) { RDF_EXPRESS_PROBE(1440); sdaiPutAttr(m_instance, getAttrDefinition(1440), sdaiBOOLEAN, &value); }
+
+        //TList may be SetOfIfcStructuralAnalysisModel or list of convertible elements
+        template <typename TList> void get_ResultGroupFor(TList& lst) { RDF_EXPRESS_PROBE(1441); SetOfIfcStructuralAnalysisModelSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1441)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGroup::attr
+        {
+            static constexpr IntValue TheoryType = 1438;
+            static constexpr IntValue ResultForLoadGroup = 1439;
+            static constexpr IntValue IsLinear = 1440;
+            static constexpr IntValue ResultGroupFor = 1441;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralResultGroup_CLASS_H
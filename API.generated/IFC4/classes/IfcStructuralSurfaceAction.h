@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralSurfaceAction_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralSurfaceAction_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralAction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralSurfaceAction
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralSurfaceAction : public RDF_EXPRESS_VIRTUAL IfcStructuralAction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralSurfaceAction
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralSurfaceAction(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 659);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralSurfaceAction in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralSurfaceAction> Extent(SdaiModel model) { return ExtentRange<IfcStructuralSurfaceAction>(model, 659, false); }
+        static ExtentRange<IfcStructuralSurfaceAction> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralSurfaceAction>(model, 659, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralSurfaceAction and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralSurfaceAction Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralSurfaceAction"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralSurfaceAction if the actual type of SdaiInstance is IfcStructuralSurfaceAction or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralSurfaceAction CreateExactEntity(SdaiInstance instance) { return IfcStructuralSurfaceAction(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralSurfaceAction or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralSurfaceAction(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcProjectedOrTrueLengthEnum> get_ProjectedOrTrue() { RDF_EXPRESS_PROBE(1435); int v = getENUM(1435, IfcProjectedOrTrueLengthEnum_hash); if (v >= 0) return (IfcProjectedOrTrueLengthEnum) v; else return Nullable<IfcProjectedOrTrueLengthEnum>(); }
+        void put_ProjectedOrTrue(IfcProjectedOrTrueLengthEnum value) { RDF_EXPRESS_PROBE(1435); TextValue val = IfcProjectedOrTrueLengthEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1435), sdaiENUM, val); }
+
+        Nullable<IfcStructuralSurfaceActivityTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1436); int v = getENUM(1436, IfcStructuralSurfaceActivityTypeEnum_hash); if (v >= 0) return (IfcStructuralSurfaceActivityTypeEnum) v; else return Nullable<IfcStructuralSurfaceActivityTypeEnum>(); }
+        void put_PredefinedType(IfcStructuralSurfaceActivityTypeEnum value) { RDF_EXPRESS_PROBE(1436); TextValue val = IfcStructuralSurfaceActivityTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1436), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralAction::attr
+        {
+            static constexpr IntValue ProjectedOrTrue = 1435;
+            static constexpr IntValue PredefinedType = 1436;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralSurfaceAction_CLASS_H
@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralSurfaceConnection_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralSurfaceConnection_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralConnection.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralSurfaceConnection
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralSurfaceConnection : public RDF_EXPRESS_VIRTUAL IfcStructuralConnection
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralSurfaceConnection
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralSurfaceConnection(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 660);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralSurfaceConnection in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralSurfaceConnection> Extent(SdaiModel model) { return ExtentRange<IfcStructuralSurfaceConnection>(model, 660, false); }
+        static ExtentRange<IfcStructuralSurfaceConnection> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralSurfaceConnection>(model, 660, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralSurfaceConnection and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralSurfaceConnection Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralSurfaceConnection"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralSurfaceConnection if the actual type of SdaiInstance is IfcStructuralSurfaceConnection or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralSurfaceConnection CreateExactEntity(SdaiInstance instance) { return IfcStructuralSurfaceConnection(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralSurfaceConnection or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralSurfaceConnection(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralConnection::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralSurfaceConnection_CLASS_H
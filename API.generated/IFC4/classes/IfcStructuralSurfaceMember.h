@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralSurfaceMember_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralSurfaceMember_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralMember.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralSurfaceMember
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralSurfaceMember : public RDF_EXPRESS_VIRTUAL IfcStructuralMember
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralSurfaceMember
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralSurfaceMember(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 661);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralSurfaceMember in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralSurfaceMember> Extent(SdaiModel model) { return ExtentRange<IfcStructuralSurfaceMember>(model, 661, false); }
+        static ExtentRange<IfcStructuralSurfaceMember> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralSurfaceMember>(model, 661, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralSurfaceMember and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralSurfaceMember Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralSurfaceMember"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralSurfaceMember if the actual type of SdaiInstance is IfcStructuralSurfaceMember or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralSurfaceMember CreateExactEntity(SdaiInstance instance) { return IfcStructuralSurfaceMember(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralSurfaceMember or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralSurfaceMember(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcStructuralSurfaceMemberTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1442); int v = getENUM(1442, IfcStructuralSurfaceMemberTypeEnum_hash); if (v >= 0) return (IfcStructuralSurfaceMemberTypeEnum) v; else return Nullable<IfcStructuralSurfaceMemberTypeEnum>(); }
+        void put_PredefinedType(IfcStructuralSurfaceMemberTypeEnum value) { RDF_EXPRESS_PROBE(1442); TextValue val = IfcStructuralSurfaceMemberTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1442), sdaiENUM, val); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Thickness() { RDF_EXPRESS_PROBE(1443); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1443), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Thickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1443); sdaiPutAttr(m_instance, getAttrDefinition(1443), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralMember::attr
+        {
+            static constexpr IntValue PredefinedType = 1442;
+            static constexpr IntValue Thickness = 1443;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralSurfaceMember_CLASS_H
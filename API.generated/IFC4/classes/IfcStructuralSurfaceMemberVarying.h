@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralSurfaceMemberVarying_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralSurfaceMemberVarying_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralSurfaceMember.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralSurfaceMemberVarying
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralSurfaceMemberVarying : public RDF_EXPRESS_VIRTUAL IfcStructuralSurfaceMember
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralSurfaceMemberVarying
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralSurfaceMemberVarying(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 662);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralSurfaceMemberVarying in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralSurfaceMemberVarying> Extent(SdaiModel model) { return ExtentRange<IfcStructuralSurfaceMemberVarying>(model, 662, false); }
+        static ExtentRange<IfcStructuralSurfaceMemberVarying> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralSurfaceMemberVarying>(model, 662, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralSurfaceMemberVarying and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralSurfaceMemberVarying Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralSurfaceMemberVarying"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralSurfaceMemberVarying if the actual type of SdaiInstance is IfcStructuralSurfaceMemberVarying or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralSurfaceMemberVarying CreateExactEntity(SdaiInstance instance) { return IfcStructuralSurfaceMemberVarying(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralSurfaceMemberVarying or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralSurfaceMemberVarying(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralSurfaceMember::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralSurfaceMemberVarying_CLASS_H
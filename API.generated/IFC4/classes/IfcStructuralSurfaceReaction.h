@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralSurfaceReaction_CLASS_H
+#define __RDF_LTD__IFC4_IfcStructuralSurfaceReaction_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralReaction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStructuralSurfaceReaction
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStructuralSurfaceReaction : public RDF_EXPRESS_VIRTUAL IfcStructuralReaction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStructuralSurfaceReaction
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStructuralSurfaceReaction(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 663);
+        }
+
+        /// <summary>
+        /// Instances of IfcStructuralSurfaceReaction in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStructuralSurfaceReaction> Extent(SdaiModel model) { return ExtentRange<IfcStructuralSurfaceReaction>(model, 663, false); }
+        static ExtentRange<IfcStructuralSurfaceReaction> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStructuralSurfaceReaction>(model, 663, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStructuralSurfaceReaction and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStructuralSurfaceReaction Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStructuralSurfaceReaction"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStructuralSurfaceReaction if the actual type of SdaiInstance is IfcStructuralSurfaceReaction or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStructuralSurfaceReaction CreateExactEntity(SdaiInstance instance) { return IfcStructuralSurfaceReaction(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStructuralSurfaceReaction or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStructuralSurfaceReaction(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcStructuralSurfaceActivityTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1444); int v = getENUM(1444, IfcStructuralSurfaceActivityTypeEnum_hash); if (v >= 0) return (IfcStructuralSurfaceActivityTypeEnum) v; else return Nullable<IfcStructuralSurfaceActivityTypeEnum>(); }
+        void put_PredefinedType(IfcStructuralSurfaceActivityTypeEnum value) { RDF_EXPRESS_PROBE(1444); TextValue val = IfcStructuralSurfaceActivityTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1444), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralReaction::attr
+        {
+            static constexpr IntValue PredefinedType = 1444;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralSurfaceReaction_CLASS_H
@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStyleModel_CLASS_H
+#define __RDF_LTD__IFC4_IfcStyleModel_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRepresentation.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStyleModel
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStyleModel : public RDF_EXPRESS_VIRTUAL IfcRepresentation
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStyleModel
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStyleModel(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 666);
+        }
+
+        /// <summary>
+        /// Instances of IfcStyleModel in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStyleModel> Extent(SdaiModel model) { return ExtentRange<IfcStyleModel>(model, 666, false); }
+        static ExtentRange<IfcStyleModel> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStyleModel>(model, 666, true); }
+
+        /// <summary>
+        /// Returns object of IfcStyleModel if the actual type of SdaiInstance is IfcStyleModel or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStyleModel CreateExactEntity(SdaiInstance instance) { return IfcStyleModel(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStyleModel or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStyleModel(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRepresentation::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStyleModel_CLASS_H
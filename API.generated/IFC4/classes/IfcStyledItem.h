@@ -0,0 +1,82 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStyledItem_CLASS_H
+#define __RDF_LTD__IFC4_IfcStyledItem_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStyledItem
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStyledItem : public RDF_EXPRESS_VIRTUAL IfcRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStyledItem
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStyledItem(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 664);
+        }
+
+        /// <summary>
+        /// Instances of IfcStyledItem in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStyledItem> Extent(SdaiModel model) { return ExtentRange<IfcStyledItem>(model, 664, false); }
+        static ExtentRange<IfcStyledItem> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStyledItem>(model, 664, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStyledItem and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStyledItem Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStyledItem"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStyledItem if the actual type of SdaiInstance is IfcStyledItem or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStyledItem CreateExactEntity(SdaiInstance instance) { return IfcStyledItem(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStyledItem or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStyledItem(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcRepresentationItem get_Item();
+        void put_Item(IfcRepresentationItem inst);
+
+        //TList may be SetOfIfcStyleAssignmentSelect or list of convertible elements
+        template <typename TList> void get_Styles(TList& lst) { RDF_EXPRESS_PROBE(1446); SetOfIfcStyleAssignmentSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1446)); }
+
+        //TList may be SetOfIfcStyleAssignmentSelect or list of convertible elements
+        template <typename TList> void put_Styles(TList& lst) { RDF_EXPRESS_PROBE(1446); SetOfIfcStyleAssignmentSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1446)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(1447); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1447), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(1447); sdaiPutAttr(m_instance, getAttrDefinition(1447), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1447); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRepresentationItem::attr
+        {
+            static constexpr IntValue Item = 1445;
+            static constexpr IntValue Styles = 1446;
+            static constexpr IntValue Name = 1447;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStyledItem_CLASS_H
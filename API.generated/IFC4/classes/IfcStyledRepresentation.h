@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStyledRepresentation_CLASS_H
+#define __RDF_LTD__IFC4_IfcStyledRepresentation_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStyleModel.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcStyledRepresentation
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcStyledRepresentation : public RDF_EXPRESS_VIRTUAL IfcStyleModel
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcStyledRepresentation
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcStyledRepresentation(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 665);
+        }
+
+        /// <summary>
+        /// Instances of IfcStyledRepresentation in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcStyledRepresentation> Extent(SdaiModel model) { return ExtentRange<IfcStyledRepresentation>(model, 665, false); }
+        static ExtentRange<IfcStyledRepresentation> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcStyledRepresentation>(model, 665, true); }
+
+        /// <summary>
+        /// Create new instance of IfcStyledRepresentation and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcStyledRepresentation Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcStyledRepresentation"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcStyledRepresentation if the actual type of SdaiInstance is IfcStyledRepresentation or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcStyledRepresentation CreateExactEntity(SdaiInstance instance) { return IfcStyledRepresentation(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcStyledRepresentation or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcStyledRepresentation(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStyleModel::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcStyledRepresentation_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSubContractResource_CLASS_H
+#define __RDF_LTD__IFC4_IfcSubContractResource_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstructionResource.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSubContractResource
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSubContractResource : public RDF_EXPRESS_VIRTUAL IfcConstructionResource
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSubContractResource
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSubContractResource(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 667);
+        }
+
+        /// <summary>
+        /// Instances of IfcSubContractResource in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSubContractResource> Extent(SdaiModel model) { return ExtentRange<IfcSubContractResource>(model, 667, false); }
+        static ExtentRange<IfcSubContractResource> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSubContractResource>(model, 667, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSubContractResource and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSubContractResource Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSubContractResource"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSubContractResource if the actual type of SdaiInstance is IfcSubContractResource or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSubContractResource CreateExactEntity(SdaiInstance instance) { return IfcSubContractResource(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSubContractResource or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSubContractResource(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSubContractResourceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1448); int v = getENUM(1448, IfcSubContractResourceTypeEnum_hash); if (v >= 0) return (IfcSubContractResourceTypeEnum) v; else return Nullable<IfcSubContractResourceTypeEnum>(); }
+        void put_PredefinedType(IfcSubContractResourceTypeEnum value) { RDF_EXPRESS_PROBE(1448); TextValue val = IfcSubContractResourceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1448), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstructionResource::attr
+        {
+            static constexpr IntValue PredefinedType = 1448;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSubContractResource_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSubContractResourceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcSubContractResourceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcConstructionResourceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSubContractResourceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSubContractResourceType : public RDF_EXPRESS_VIRTUAL IfcConstructionResourceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSubContractResourceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSubContractResourceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 668);
+        }
+
+        /// <summary>
+        /// Instances of IfcSubContractResourceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSubContractResourceType> Extent(SdaiModel model) { return ExtentRange<IfcSubContractResourceType>(model, 668, false); }
+        static ExtentRange<IfcSubContractResourceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSubContractResourceType>(model, 668, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSubContractResourceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSubContractResourceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSubContractResourceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSubContractResourceType if the actual type of SdaiInstance is IfcSubContractResourceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSubContractResourceType CreateExactEntity(SdaiInstance instance) { return IfcSubContractResourceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSubContractResourceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSubContractResourceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSubContractResourceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1449); int v = getENUM(1449, IfcSubContractResourceTypeEnum_hash); if (v >= 0) return (IfcSubContractResourceTypeEnum) v; else return Nullable<IfcSubContractResourceTypeEnum>(); }
+        void put_PredefinedType(IfcSubContractResourceTypeEnum value) { RDF_EXPRESS_PROBE(1449); TextValue val = IfcSubContractResourceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1449), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcConstructionResourceType::attr
+        {
+            static constexpr IntValue PredefinedType = 1449;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSubContractResourceType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSubedge_CLASS_H
+#define __RDF_LTD__IFC4_IfcSubedge_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEdge.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSubedge
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSubedge : public RDF_EXPRESS_VIRTUAL IfcEdge
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSubedge
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSubedge(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 669);
+        }
+
+        /// <summary>
+        /// Instances of IfcSubedge in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSubedge> Extent(SdaiModel model) { return ExtentRange<IfcSubedge>(model, 669, false); }
+        static ExtentRange<IfcSubedge> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSubedge>(model, 669, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSubedge and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSubedge Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSubedge"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSubedge if the actual type of SdaiInstance is IfcSubedge or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSubedge CreateExactEntity(SdaiInstance instance) { return IfcSubedge(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSubedge or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSubedge(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcEdge get_ParentEdge();
+        void put_ParentEdge(IfcEdge inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEdge::attr
+        {
+            static constexpr IntValue ParentEdge = 1450;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSubedge_CLASS_H
@@ -0,0 +1,82 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceCurve_CLASS_H
+#define __RDF_LTD__IFC4_IfcSurfaceCurve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSurfaceCurve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSurfaceCurve : public RDF_EXPRESS_VIRTUAL IfcCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSurfaceCurve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSurfaceCurve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 671);
+        }
+
+        /// <summary>
+        /// Instances of IfcSurfaceCurve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSurfaceCurve> Extent(SdaiModel model) { return ExtentRange<IfcSurfaceCurve>(model, 671, false); }
+        static ExtentRange<IfcSurfaceCurve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSurfaceCurve>(model, 671, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSurfaceCurve and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSurfaceCurve Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSurfaceCurve"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSurfaceCurve if the actual type of SdaiInstance is IfcSurfaceCurve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSurfaceCurve CreateExactEntity(SdaiInstance instance) { return IfcSurfaceCurve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSurfaceCurve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSurfaceCurve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurve get_Curve3D();
+        void put_Curve3D(IfcCurve inst);
+
+        //TList may be ListOfIfcPcurve or list of convertible elements
+        template <typename TList> void get_AssociatedGeometry(TList& lst) { RDF_EXPRESS_PROBE(731); ListOfIfcPcurveSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(731)); }
+
+        //TList may be ListOfIfcPcurve or list of convertible elements
+        template <typename TList> void put_AssociatedGeometry(TList& lst) { RDF_EXPRESS_PROBE(731); ListOfIfcPcurveSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(731)); }
+
+        //TArrayElem[] may be IfcPcurve[] or array of convertible elements
+        template <typename TArrayElem> void put_AssociatedGeometry(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(731); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcPcurveSerializer<ListOfIfcPcurve> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(731)); }
+
+        Nullable<IfcPreferredSurfaceCurveRepresentation> get_MasterRepresentation() { RDF_EXPRESS_PROBE(732); int v = getENUM(732, IfcPreferredSurfaceCurveRepresentation_hash); if (v >= 0) return (IfcPreferredSurfaceCurveRepresentation) v; else return Nullable<IfcPreferredSurfaceCurveRepresentation>(); }
+        void put_MasterRepresentation(IfcPreferredSurfaceCurveRepresentation value) { RDF_EXPRESS_PROBE(732); TextValue val = IfcPreferredSurfaceCurveRepresentation_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(732), sdaiENUM, val); }
+
+        //TList may be SetOfIfcSurface or list of convertible elements
+        template <typename TList> void get_BasisSurface(TList& lst) { RDF_EXPRESS_PROBE(733); SetOfIfcSurfaceSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(733)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcCurve::attr
+        {
+            static constexpr IntValue Curve3D = 730;
+            static constexpr IntValue AssociatedGeometry = 731;
+            static constexpr IntValue MasterRepresentation = 732;
+            static constexpr IntValue BasisSurface = 733;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceCurve_CLASS_H
@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceCurveSweptAreaSolid_CLASS_H
+#define __RDF_LTD__IFC4_IfcSurfaceCurveSweptAreaSolid_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSweptAreaSolid.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSurfaceCurveSweptAreaSolid
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSurfaceCurveSweptAreaSolid : public RDF_EXPRESS_VIRTUAL IfcSweptAreaSolid
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSurfaceCurveSweptAreaSolid
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSurfaceCurveSweptAreaSolid(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 672);
+        }
+
+        /// <summary>
+        /// Instances of IfcSurfaceCurveSweptAreaSolid in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSurfaceCurveSweptAreaSolid> Extent(SdaiModel model) { return ExtentRange<IfcSurfaceCurveSweptAreaSolid>(model, 672, false); }
+        static ExtentRange<IfcSurfaceCurveSweptAreaSolid> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSurfaceCurveSweptAreaSolid>(model, 672, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSurfaceCurveSweptAreaSolid and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSurfaceCurveSweptAreaSolid Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSurfaceCurveSweptAreaSolid"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSurfaceCurveSweptAreaSolid if the actual type of SdaiInstance is IfcSurfaceCurveSweptAreaSolid or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSurfaceCurveSweptAreaSolid CreateExactEntity(SdaiInstance instance) { return IfcSurfaceCurveSweptAreaSolid(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSurfaceCurveSweptAreaSolid or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSurfaceCurveSweptAreaSolid(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurve get_Directrix();
+        void put_Directrix(IfcCurve inst);
+
+        Nullable<IfcParameterValue> get_StartParam() { RDF_EXPRESS_PROBE(1452); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1452), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_StartParam(IfcParameterValue value) { RDF_EXPRESS_PROBE(1452); sdaiPutAttr(m_instance, getAttrDefinition(1452), sdaiREAL, &value); }
+
+        Nullable<IfcParameterValue> get_EndParam() { RDF_EXPRESS_PROBE(1453); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1453), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_EndParam(IfcParameterValue value) { RDF_EXPRESS_PROBE(1453); sdaiPutAttr(m_instance, getAttrDefinition(1453), sdaiREAL, &value); }
+
+        IfcSurface get_ReferenceSurface();
+        void put_ReferenceSurface(IfcSurface inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSweptAreaSolid::attr
+        {
+            static constexpr IntValue Directrix = 1451;
+            static constexpr IntValue StartParam = 1452;
+            static constexpr IntValue EndParam = 1453;
+            static constexpr IntValue ReferenceSurface = 1454;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceCurveSweptAreaSolid_CLASS_H
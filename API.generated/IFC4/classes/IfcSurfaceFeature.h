@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceFeature_CLASS_H
+#define __RDF_LTD__IFC4_IfcSurfaceFeature_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFeatureElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSurfaceFeature
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSurfaceFeature : public RDF_EXPRESS_VIRTUAL IfcFeatureElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSurfaceFeature
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSurfaceFeature(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 673);
+        }
+
+        /// <summary>
+        /// Instances of IfcSurfaceFeature in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSurfaceFeature> Extent(SdaiModel model) { return ExtentRange<IfcSurfaceFeature>(model, 673, false); }
+        static ExtentRange<IfcSurfaceFeature> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSurfaceFeature>(model, 673, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSurfaceFeature and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSurfaceFeature Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSurfaceFeature"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSurfaceFeature if the actual type of SdaiInstance is IfcSurfaceFeature or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSurfaceFeature CreateExactEntity(SdaiInstance instance) { return IfcSurfaceFeature(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSurfaceFeature or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSurfaceFeature(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSurfaceFeatureTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1455); int v = getENUM(1455, IfcSurfaceFeatureTypeEnum_hash); if (v >= 0) return (IfcSurfaceFeatureTypeEnum) v; else return Nullable<IfcSurfaceFeatureTypeEnum>(); }
+        void put_PredefinedType(IfcSurfaceFeatureTypeEnum value) { RDF_EXPRESS_PROBE(1455); TextValue val = IfcSurfaceFeatureTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1455), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFeatureElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1455;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceFeature_CLASS_H
@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceOfLinearExtrusion_CLASS_H
+#define __RDF_LTD__IFC4_IfcSurfaceOfLinearExtrusion_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSweptSurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSurfaceOfLinearExtrusion
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSurfaceOfLinearExtrusion : public RDF_EXPRESS_VIRTUAL IfcSweptSurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSurfaceOfLinearExtrusion
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSurfaceOfLinearExtrusion(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 674);
+        }
+
+        /// <summary>
+        /// Instances of IfcSurfaceOfLinearExtrusion in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSurfaceOfLinearExtrusion> Extent(SdaiModel model) { return ExtentRange<IfcSurfaceOfLinearExtrusion>(model, 674, false); }
+        static ExtentRange<IfcSurfaceOfLinearExtrusion> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSurfaceOfLinearExtrusion>(model, 674, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSurfaceOfLinearExtrusion and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSurfaceOfLinearExtrusion Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSurfaceOfLinearExtrusion"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSurfaceOfLinearExtrusion if the actual type of SdaiInstance is IfcSurfaceOfLinearExtrusion or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSurfaceOfLinearExtrusion CreateExactEntity(SdaiInstance instance) { return IfcSurfaceOfLinearExtrusion(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSurfaceOfLinearExtrusion or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSurfaceOfLinearExtrusion(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDirection get_ExtrudedDirection();
+        void put_ExtrudedDirection(IfcDirection inst);
+
+        Nullable<IfcLengthMeasure> get_Depth() { RDF_EXPRESS_PROBE(1459); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1459), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_Depth(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1459); sdaiPutAttr(m_instance, getAttrDefinition(1459), sdaiREAL, &value); }
+
+        IfcVector get_ExtrusionAxis();
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSweptSurface::attr
+        {
+            static constexpr IntValue ExtrudedDirection = 1458;
+            static constexpr IntValue Depth = 1459;
+            static constexpr IntValue ExtrusionAxis = 1460;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceOfLinearExtrusion_CLASS_H
@@ -0,0 +1,67 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceOfRevolution_CLASS_H
+#define __RDF_LTD__IFC4_IfcSurfaceOfRevolution_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSweptSurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSurfaceOfRevolution
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSurfaceOfRevolution : public RDF_EXPRESS_VIRTUAL IfcSweptSurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSurfaceOfRevolution
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSurfaceOfRevolution(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 675);
+        }
+
+        /// <summary>
+        /// Instances of IfcSurfaceOfRevolution in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSurfaceOfRevolution> Extent(SdaiModel model) { return ExtentRange<IfcSurfaceOfRevolution>(model, 675, false); }
+        static ExtentRange<IfcSurfaceOfRevolution> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSurfaceOfRevolution>(model, 675, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSurfaceOfRevolution and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSurfaceOfRevolution Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSurfaceOfRevolution"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSurfaceOfRevolution if the actual type of SdaiInstance is IfcSurfaceOfRevolution or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSurfaceOfRevolution CreateExactEntity(SdaiInstance instance) { return IfcSurfaceOfRevolution(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSurfaceOfRevolution or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSurfaceOfRevolution(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcAxis1Placement get_AxisPosition();
+        void put_AxisPosition(IfcAxis1Placement inst);
+
+        IfcLine get_AxisLine();
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSweptSurface::attr
+        {
+            static constexpr IntValue AxisPosition = 1461;
+            static constexpr IntValue AxisLine = 1462;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceOfRevolution_CLASS_H
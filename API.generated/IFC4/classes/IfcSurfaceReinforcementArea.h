@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceReinforcementArea_CLASS_H
+#define __RDF_LTD__IFC4_IfcSurfaceReinforcementArea_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcStructuralLoadOrResult.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSurfaceReinforcementArea
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSurfaceReinforcementArea : public RDF_EXPRESS_VIRTUAL IfcStructuralLoadOrResult
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSurfaceReinforcementArea
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSurfaceReinforcementArea(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 676);
+        }
+
+        /// <summary>
+        /// Instances of IfcSurfaceReinforcementArea in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSurfaceReinforcementArea> Extent(SdaiModel model) { return ExtentRange<IfcSurfaceReinforcementArea>(model, 676, false); }
+        static ExtentRange<IfcSurfaceReinforcementArea> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSurfaceReinforcementArea>(model, 676, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSurfaceReinforcementArea and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSurfaceReinforcementArea Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSurfaceReinforcementArea"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSurfaceReinforcementArea if the actual type of SdaiInstance is IfcSurfaceReinforcementArea or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSurfaceReinforcementArea CreateExactEntity(SdaiInstance instance) { return IfcSurfaceReinforcementArea(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSurfaceReinforcementArea or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSurfaceReinforcementArea(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void get_SurfaceReinforcement1(TList& lst) { RDF_EXPRESS_PROBE(1463); ListOfIfcLengthMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1463)); }
+
+        //TList may be ListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void put_SurfaceReinforcement1(TList& lst) { RDF_EXPRESS_PROBE(1463); ListOfIfcLengthMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1463)); }
+
+        //TArrayElem[] may be IfcLengthMeasure[] or array of convertible elements
+        template <typename TArrayElem> void put_SurfaceReinforcement1(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1463); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcLengthMeasureSerializer<ListOfIfcLengthMeasure> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1463)); }
+
+        //TList may be ListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void get_SurfaceReinforcement2(TList& lst) { RDF_EXPRESS_PROBE(1464); ListOfIfcLengthMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1464)); }
+
+        //TList may be ListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void put_SurfaceReinforcement2(TList& lst) { RDF_EXPRESS_PROBE(1464); ListOfIfcLengthMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1464)); }
+
+        //TArrayElem[] may be IfcLengthMeasure[] or array of convertible elements
+        template <typename TArrayElem> void put_SurfaceReinforcement2(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1464); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcLengthMeasureSerializer<ListOfIfcLengthMeasure> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1464)); }
+
+        Nullable<IfcRatioMeasure> get_ShearReinforcement() { RDF_EXPRESS_PROBE(1465); IfcRatioMeasure val = (IfcRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1465), sdaiREAL, &val)) return val; else return Nullable<IfcRatioMeasure>(); }
+        void put_ShearReinforcement(IfcRatioMeasure value) { RDF_EXPRESS_PROBE(1465); sdaiPutAttr(m_instance, getAttrDefinition(1465), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcStructuralLoadOrResult::attr
+        {
+            static constexpr IntValue SurfaceReinforcement1 = 1463;
+            static constexpr IntValue SurfaceReinforcement2 = 1464;
+            static constexpr IntValue ShearReinforcement = 1465;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceReinforcementArea_CLASS_H
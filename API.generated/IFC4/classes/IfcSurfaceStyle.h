@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceStyle_CLASS_H
+#define __RDF_LTD__IFC4_IfcSurfaceStyle_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationStyle.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSurfaceStyle
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSurfaceStyle : public RDF_EXPRESS_VIRTUAL IfcPresentationStyle
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSurfaceStyle
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSurfaceStyle(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 677);
+        }
+
+        /// <summary>
+        /// Instances of IfcSurfaceStyle in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSurfaceStyle> Extent(SdaiModel model) { return ExtentRange<IfcSurfaceStyle>(model, 677, false); }
+        static ExtentRange<IfcSurfaceStyle> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSurfaceStyle>(model, 677, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSurfaceStyle and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSurfaceStyle Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSurfaceStyle"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSurfaceStyle if the actual type of SdaiInstance is IfcSurfaceStyle or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSurfaceStyle CreateExactEntity(SdaiInstance instance) { return IfcSurfaceStyle(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSurfaceStyle or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSurfaceStyle(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSurfaceSide> get_Side() { RDF_EXPRESS_PROBE(1466); int v = getENUM(1466, IfcSurfaceSide_hash); if (v >= 0) return (IfcSurfaceSide) v; else return Nullable<IfcSurfaceSide>(); }
+        void put_Side(IfcSurfaceSide value) { RDF_EXPRESS_PROBE(1466); TextValue val = IfcSurfaceSide_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1466), sdaiENUM, val); }
+
+        //TList may be SetOfIfcSurfaceStyleElementSelect or list of convertible elements
+        template <typename TList> void get_Styles(TList& lst) { RDF_EXPRESS_PROBE(1467); SetOfIfcSurfaceStyleElementSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1467)); }
+
+        //TList may be SetOfIfcSurfaceStyleElementSelect or list of convertible elements
+        template <typename TList> void put_Styles(TList& lst) { RDF_EXPRESS_PROBE(1467); SetOfIfcSurfaceStyleElementSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1467)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationStyle::attr
+        {
+            static constexpr IntValue Side = 1466;
+            static constexpr IntValue Styles = 1467;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceStyle_CLASS_H
@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceStyleLighting_CLASS_H
+#define __RDF_LTD__IFC4_IfcSurfaceStyleLighting_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSurfaceStyleLighting
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSurfaceStyleLighting : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSurfaceStyleLighting
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSurfaceStyleLighting(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 678);
+        }
+
+        /// <summary>
+        /// Instances of IfcSurfaceStyleLighting in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSurfaceStyleLighting> Extent(SdaiModel model) { return ExtentRange<IfcSurfaceStyleLighting>(model, 678, false); }
+        static ExtentRange<IfcSurfaceStyleLighting> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSurfaceStyleLighting>(model, 678, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSurfaceStyleLighting and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSurfaceStyleLighting Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSurfaceStyleLighting"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSurfaceStyleLighting if the actual type of SdaiInstance is IfcSurfaceStyleLighting or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSurfaceStyleLighting CreateExactEntity(SdaiInstance instance) { return IfcSurfaceStyleLighting(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSurfaceStyleLighting or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSurfaceStyleLighting(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcColourRgb get_DiffuseTransmissionColour();
+        void put_DiffuseTransmissionColour(IfcColourRgb inst);
+
+        IfcColourRgb get_DiffuseReflectionColour();
+        void put_DiffuseReflectionColour(IfcColourRgb inst);
+
+        IfcColourRgb get_TransmissionColour();
+        void put_TransmissionColour(IfcColourRgb inst);
+
+        IfcColourRgb get_ReflectanceColour();
+        void put_ReflectanceColour(IfcColourRgb inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue DiffuseTransmissionColour = 1468;
+            static constexpr IntValue DiffuseReflectionColour = 1469;
+            static constexpr IntValue TransmissionColour = 1470;
+            static constexpr IntValue ReflectanceColour = 1471;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceStyleLighting_CLASS_H
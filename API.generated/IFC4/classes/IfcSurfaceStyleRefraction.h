@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceStyleRefraction_CLASS_H
+#define __RDF_LTD__IFC4_IfcSurfaceStyleRefraction_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSurfaceStyleRefraction
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSurfaceStyleRefraction : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSurfaceStyleRefraction
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSurfaceStyleRefraction(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 679);
+        }
+
+        /// <summary>
+        /// Instances of IfcSurfaceStyleRefraction in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSurfaceStyleRefraction> Extent(SdaiModel model) { return ExtentRange<IfcSurfaceStyleRefraction>(model, 679, false); }
+        static ExtentRange<IfcSurfaceStyleRefraction> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSurfaceStyleRefraction>(model, 679, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSurfaceStyleRefraction and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSurfaceStyleRefraction Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSurfaceStyleRefraction"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSurfaceStyleRefraction if the actual type of SdaiInstance is IfcSurfaceStyleRefraction or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSurfaceStyleRefraction CreateExactEntity(SdaiInstance instance) { return IfcSurfaceStyleRefraction(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSurfaceStyleRefraction or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSurfaceStyleRefraction(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcReal> get_RefractionIndex() { RDF_EXPRESS_PROBE(1472); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1472), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_RefractionIndex(IfcReal value) { RDF_EXPRESS_PROBE(1472); sdaiPutAttr(m_instance, getAttrDefinition(1472), sdaiREAL, &value); }
+
+        Nullable<IfcReal> get_DispersionFactor() { RDF_EXPRESS_PROBE(1473); IfcReal val = (IfcReal) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1473), sdaiREAL, &val)) return val; else return Nullable<IfcReal>(); }
+        void put_DispersionFactor(IfcReal value) { RDF_EXPRESS_PROBE(1473); sdaiPutAttr(m_instance, getAttrDefinition(1473), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue RefractionIndex = 1472;
+            static constexpr IntValue DispersionFactor = 1473;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceStyleRefraction_CLASS_H
@@ -0,0 +1,88 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceStyleRendering_CLASS_H
+#define __RDF_LTD__IFC4_IfcSurfaceStyleRendering_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSurfaceStyleShading.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSurfaceStyleRendering
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSurfaceStyleRendering : public RDF_EXPRESS_VIRTUAL IfcSurfaceStyleShading
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSurfaceStyleRendering
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSurfaceStyleRendering(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 680);
+        }
+
+        /// <summary>
+        /// Instances of IfcSurfaceStyleRendering in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSurfaceStyleRendering> Extent(SdaiModel model) { return ExtentRange<IfcSurfaceStyleRendering>(model, 680, false); }
+        static ExtentRange<IfcSurfaceStyleRendering> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSurfaceStyleRendering>(model, 680, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSurfaceStyleRendering and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSurfaceStyleRendering Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSurfaceStyleRendering"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSurfaceStyleRendering if the actual type of SdaiInstance is IfcSurfaceStyleRendering or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSurfaceStyleRendering CreateExactEntity(SdaiInstance instance) { return IfcSurfaceStyleRendering(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSurfaceStyleRendering or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSurfaceStyleRendering(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcColourOrFactor_get get_DiffuseColour() { return IfcColourOrFactor_get(m_instance, 1476); }
+        IfcColourOrFactor_put put_DiffuseColour() { return IfcColourOrFactor_put(m_instance, 1476); }
+
+        IfcColourOrFactor_get get_TransmissionColour() { return IfcColourOrFactor_get(m_instance, 1477); }
+        IfcColourOrFactor_put put_TransmissionColour() { return IfcColourOrFactor_put(m_instance, 1477); }
+
+        IfcColourOrFactor_get get_DiffuseTransmissionColour() { return IfcColourOrFactor_get(m_instance, 1478); }
+        IfcColourOrFactor_put put_DiffuseTransmissionColour() { return IfcColourOrFactor_put(m_instance, 1478); }
+
+        IfcColourOrFactor_get get_ReflectionColour() { return IfcColourOrFactor_get(m_instance, 1479); }
+        IfcColourOrFactor_put put_ReflectionColour() { return IfcColourOrFactor_put(m_instance, 1479); }
+
+        IfcColourOrFactor_get get_SpecularColour() { return IfcColourOrFactor_get(m_instance, 1480); }
+        IfcColourOrFactor_put put_SpecularColour() { return IfcColourOrFactor_put(m_instance, 1480); }
+
+        IfcSpecularHighlightSelect_get get_SpecularHighlight() { return IfcSpecularHighlightSelect_get(m_instance, 1481); }
+        IfcSpecularHighlightSelect_put put_SpecularHighlight() { return IfcSpecularHighlightSelect_put(m_instance, 1481); }
+
+        Nullable<IfcReflectanceMethodEnum> get_ReflectanceMethod() { RDF_EXPRESS_PROBE(1482); int v = getENUM(1482, IfcReflectanceMethodEnum_hash); if (v >= 0) return (IfcReflectanceMethodEnum) v; else return Nullable<IfcReflectanceMethodEnum>(); }
+        void put_ReflectanceMethod(IfcReflectanceMethodEnum value) { RDF_EXPRESS_PROBE(1482); TextValue val = IfcReflectanceMethodEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1482), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSurfaceStyleShading::attr
+        {
+            static constexpr IntValue DiffuseColour = 1476;
+            static constexpr IntValue TransmissionColour = 1477;
+            static constexpr IntValue DiffuseTransmissionColour = 1478;
+            static constexpr IntValue ReflectionColour = 1479;
+            static constexpr IntValue SpecularColour = 1480;
+            static constexpr IntValue SpecularHighlight = 1481;
+            static constexpr IntValue ReflectanceMethod = 1482;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceStyleRendering_CLASS_H
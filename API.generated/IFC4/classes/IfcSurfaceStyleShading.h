@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceStyleShading_CLASS_H
+#define __RDF_LTD__IFC4_IfcSurfaceStyleShading_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSurfaceStyleShading
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSurfaceStyleShading : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSurfaceStyleShading
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSurfaceStyleShading(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 681);
+        }
+
+        /// <summary>
+        /// Instances of IfcSurfaceStyleShading in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSurfaceStyleShading> Extent(SdaiModel model) { return ExtentRange<IfcSurfaceStyleShading>(model, 681, false); }
+        static ExtentRange<IfcSurfaceStyleShading> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSurfaceStyleShading>(model, 681, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSurfaceStyleShading and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSurfaceStyleShading Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSurfaceStyleShading"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSurfaceStyleShading if the actual type of SdaiInstance is IfcSurfaceStyleShading or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSurfaceStyleShading CreateExactEntity(SdaiInstance instance) { return IfcSurfaceStyleShading(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSurfaceStyleShading or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSurfaceStyleShading(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcColourRgb get_SurfaceColour();
+        void put_SurfaceColour(IfcColourRgb inst);
+
+        Nullable<IfcNormalisedRatioMeasure> get_Transparency() { RDF_EXPRESS_PROBE(1475); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1475), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_Transparency(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(1475); sdaiPutAttr(m_instance, getAttrDefinition(1475), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue SurfaceColour = 1474;
+            static constexpr IntValue Transparency = 1475;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceStyleShading_CLASS_H
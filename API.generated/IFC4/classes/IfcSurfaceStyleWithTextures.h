@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceStyleWithTextures_CLASS_H
+#define __RDF_LTD__IFC4_IfcSurfaceStyleWithTextures_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSurfaceStyleWithTextures
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSurfaceStyleWithTextures : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSurfaceStyleWithTextures
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSurfaceStyleWithTextures(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 682);
+        }
+
+        /// <summary>
+        /// Instances of IfcSurfaceStyleWithTextures in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSurfaceStyleWithTextures> Extent(SdaiModel model) { return ExtentRange<IfcSurfaceStyleWithTextures>(model, 682, false); }
+        static ExtentRange<IfcSurfaceStyleWithTextures> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSurfaceStyleWithTextures>(model, 682, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSurfaceStyleWithTextures and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSurfaceStyleWithTextures Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSurfaceStyleWithTextures"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSurfaceStyleWithTextures if the actual type of SdaiInstance is IfcSurfaceStyleWithTextures or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSurfaceStyleWithTextures CreateExactEntity(SdaiInstance instance) { return IfcSurfaceStyleWithTextures(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSurfaceStyleWithTextures or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSurfaceStyleWithTextures(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcSurfaceTexture or list of convertible elements
+        template <typename TList> void get_Textures(TList& lst) { RDF_EXPRESS_PROBE(1483); ListOfIfcSurfaceTextureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1483)); }
+
+        //TList may be ListOfIfcSurfaceTexture or list of convertible elements
+        template <typename TList> void put_Textures(TList& lst) { RDF_EXPRESS_PROBE(1483); ListOfIfcSurfaceTextureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1483)); }
+
+        //TArrayElem[] may be IfcSurfaceTexture[] or array of convertible elements
+        template <typename TArrayElem> void put_Textures(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1483); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcSurfaceTextureSerializer<ListOfIfcSurfaceTexture> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1483)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue Textures = 1483;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceStyleWithTextures_CLASS_H
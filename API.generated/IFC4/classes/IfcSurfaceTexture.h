@@ -0,0 +1,97 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceTexture_CLASS_H
+#define __RDF_LTD__IFC4_IfcSurfaceTexture_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSurfaceTexture
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSurfaceTexture : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSurfaceTexture
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSurfaceTexture(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 683);
+        }
+
+        /// <summary>
+        /// Instances of IfcSurfaceTexture in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSurfaceTexture> Extent(SdaiModel model) { return ExtentRange<IfcSurfaceTexture>(model, 683, false); }
+        static ExtentRange<IfcSurfaceTexture> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSurfaceTexture>(model, 683, true); }
+
+        /// <summary>
+        /// Returns object of IfcSurfaceTexture if the actual type of SdaiInstance is IfcSurfaceTexture or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSurfaceTexture CreateExactEntity(SdaiInstance instance) { return IfcSurfaceTexture(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSurfaceTexture or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSurfaceTexture(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcBoolean> get_RepeatS() { RDF_EXPRESS_PROBE(156); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(156), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_RepeatS(IfcBoolean value) { RDF_EXPRESS_PROBE(156); sdaiPutAttr(m_instance, getAttrDefinition(156), sdaiBOOLEAN, &value); }
+
+        Nullable<IfcBoolean> get_RepeatT() { RDF_EXPRESS_PROBE(157); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(157), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_RepeatT(IfcBoolean value) { RDF_EXPRESS_PROBE(157); sdaiPutAttr(m_instance, getAttrDefinition(157), sdaiBOOLEAN, &value); }
+
+        IfcIdentifier get_Mode() { RDF_EXPRESS_PROBE(158); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(158), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Mode_view() { return TextView(get_Mode()); }
+#endif
+        void put_Mode(IfcIdentifier value) { RDF_EXPRESS_PROBE(158); sdaiPutAttr(m_instance, getAttrDefinition(158), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Mode_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(158); return buffer.GetAttr(m_instance, "Mode"); }
+        const char* get_Mode_utf8() { return get_Mode_utf8(ThreadUtf8Buffer()); }
+
+        IfcCartesianTransformationOperator2D get_TextureTransform();
+        void put_TextureTransform(IfcCartesianTransformationOperator2D inst);
+
+        //TList may be ListOfIfcIdentifier or list of convertible elements
+        template <typename TList> void get_Parameter(TList& lst) { RDF_EXPRESS_PROBE(160); ListOfIfcIdentifierSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(160)); }
+
+        //TList may be ListOfIfcIdentifier or list of convertible elements
+        template <typename TList> void put_Parameter(TList& lst) { RDF_EXPRESS_PROBE(160); ListOfIfcIdentifierSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(160)); }
+
+        //TArrayElem[] may be IfcIdentifier[] or array of convertible elements
+        template <typename TArrayElem> void put_Parameter(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(160); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcIdentifierSerializer<ListOfIfcIdentifier> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(160)); }
+
+        //TList may be SetOfIfcTextureCoordinate or list of convertible elements
+        template <typename TList> void get_IsMappedBy(TList& lst) { RDF_EXPRESS_PROBE(161); SetOfIfcTextureCoordinateSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(161)); }
+
+        //TList may be SetOfIfcSurfaceStyleWithTextures or list of convertible elements
+        template <typename TList> void get_UsedInStyles(TList& lst) { RDF_EXPRESS_PROBE(162); SetOfIfcSurfaceStyleWithTexturesSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(162)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue RepeatS = 156;
+            static constexpr IntValue RepeatT = 157;
+            static constexpr IntValue Mode = 158;
+            static constexpr IntValue TextureTransform = 159;
+            static constexpr IntValue Parameter = 160;
+            static constexpr IntValue IsMappedBy = 161;
+            static constexpr IntValue UsedInStyles = 162;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceTexture_CLASS_H
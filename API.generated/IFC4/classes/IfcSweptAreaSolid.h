@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSweptAreaSolid_CLASS_H
+#define __RDF_LTD__IFC4_IfcSweptAreaSolid_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSolidModel.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSweptAreaSolid
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSweptAreaSolid : public RDF_EXPRESS_VIRTUAL IfcSolidModel
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSweptAreaSolid
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSweptAreaSolid(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 684);
+        }
+
+        /// <summary>
+        /// Instances of IfcSweptAreaSolid in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSweptAreaSolid> Extent(SdaiModel model) { return ExtentRange<IfcSweptAreaSolid>(model, 684, false); }
+        static ExtentRange<IfcSweptAreaSolid> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSweptAreaSolid>(model, 684, true); }
+
+        /// <summary>
+        /// Returns object of IfcSweptAreaSolid if the actual type of SdaiInstance is IfcSweptAreaSolid or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSweptAreaSolid CreateExactEntity(SdaiInstance instance) { return IfcSweptAreaSolid(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSweptAreaSolid or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSweptAreaSolid(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcProfileDef get_SweptArea();
+        void put_SweptArea(IfcProfileDef inst);
+
+        IfcAxis2Placement3D get_Position();
+        void put_Position(IfcAxis2Placement3D inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSolidModel::attr
+        {
+            static constexpr IntValue SweptArea = 626;
+            static constexpr IntValue Position = 627;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSweptAreaSolid_CLASS_H
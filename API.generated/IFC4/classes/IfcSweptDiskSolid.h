@@ -0,0 +1,80 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSweptDiskSolid_CLASS_H
+#define __RDF_LTD__IFC4_IfcSweptDiskSolid_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSolidModel.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSweptDiskSolid
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSweptDiskSolid : public RDF_EXPRESS_VIRTUAL IfcSolidModel
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSweptDiskSolid
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSweptDiskSolid(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 685);
+        }
+
+        /// <summary>
+        /// Instances of IfcSweptDiskSolid in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSweptDiskSolid> Extent(SdaiModel model) { return ExtentRange<IfcSweptDiskSolid>(model, 685, false); }
+        static ExtentRange<IfcSweptDiskSolid> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSweptDiskSolid>(model, 685, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSweptDiskSolid and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSweptDiskSolid Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSweptDiskSolid"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSweptDiskSolid if the actual type of SdaiInstance is IfcSweptDiskSolid or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSweptDiskSolid CreateExactEntity(SdaiInstance instance) { return IfcSweptDiskSolid(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSweptDiskSolid or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSweptDiskSolid(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurve get_Directrix();
+        void put_Directrix(IfcCurve inst);
+
+        Nullable<IfcPositiveLengthMeasure> get_Radius() { RDF_EXPRESS_PROBE(1485); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1485), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Radius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1485); sdaiPutAttr(m_instance, getAttrDefinition(1485), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_InnerRadius() { RDF_EXPRESS_PROBE(1486); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1486), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_InnerRadius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1486); sdaiPutAttr(m_instance, getAttrDefinition(1486), sdaiREAL, &value); }
+
+        Nullable<IfcParameterValue> get_StartParam() { RDF_EXPRESS_PROBE(1487); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1487), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_StartParam(IfcParameterValue value) { RDF_EXPRESS_PROBE(1487); sdaiPutAttr(m_instance, getAttrDefinition(1487), sdaiREAL, &value); }
+
+        Nullable<IfcParameterValue> get_EndParam() { RDF_EXPRESS_PROBE(1488); IfcParameterValue val = (IfcParameterValue) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1488), sdaiREAL, &val)) return val; else return Nullable<IfcParameterValue>(); }
+        void put_EndParam(IfcParameterValue value) { RDF_EXPRESS_PROBE(1488); sdaiPutAttr(m_instance, getAttrDefinition(1488), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSolidModel::attr
+        {
+            static constexpr IntValue Directrix = 1484;
+            static constexpr IntValue Radius = 1485;
+            static constexpr IntValue InnerRadius = 1486;
+            static constexpr IntValue StartParam = 1487;
+            static constexpr IntValue EndParam = 1488;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSweptDiskSolid_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSweptDiskSolidPolygonal_CLASS_H
+#define __RDF_LTD__IFC4_IfcSweptDiskSolidPolygonal_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSweptDiskSolid.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSweptDiskSolidPolygonal
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSweptDiskSolidPolygonal : public RDF_EXPRESS_VIRTUAL IfcSweptDiskSolid
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSweptDiskSolidPolygonal
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSweptDiskSolidPolygonal(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 686);
+        }
+
+        /// <summary>
+        /// Instances of IfcSweptDiskSolidPolygonal in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSweptDiskSolidPolygonal> Extent(SdaiModel model) { return ExtentRange<IfcSweptDiskSolidPolygonal>(model, 686, false); }
+        static ExtentRange<IfcSweptDiskSolidPolygonal> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSweptDiskSolidPolygonal>(model, 686, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSweptDiskSolidPolygonal and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSweptDiskSolidPolygonal Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSweptDiskSolidPolygonal"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSweptDiskSolidPolygonal if the actual type of SdaiInstance is IfcSweptDiskSolidPolygonal or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSweptDiskSolidPolygonal CreateExactEntity(SdaiInstance instance) { return IfcSweptDiskSolidPolygonal(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSweptDiskSolidPolygonal or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSweptDiskSolidPolygonal(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_FilletRadius() { RDF_EXPRESS_PROBE(1489); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1489), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_FilletRadius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1489); sdaiPutAttr(m_instance, getAttrDefinition(1489), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSweptDiskSolid::attr
+        {
+            static constexpr IntValue FilletRadius = 1489;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSweptDiskSolidPolygonal_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSweptSurface_CLASS_H
+#define __RDF_LTD__IFC4_IfcSweptSurface_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSweptSurface
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSweptSurface : public RDF_EXPRESS_VIRTUAL IfcSurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSweptSurface
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSweptSurface(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 687);
+        }
+
+        /// <summary>
+        /// Instances of IfcSweptSurface in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSweptSurface> Extent(SdaiModel model) { return ExtentRange<IfcSweptSurface>(model, 687, false); }
+        static ExtentRange<IfcSweptSurface> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSweptSurface>(model, 687, true); }
+
+        /// <summary>
+        /// Returns object of IfcSweptSurface if the actual type of SdaiInstance is IfcSweptSurface or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSweptSurface CreateExactEntity(SdaiInstance instance) { return IfcSweptSurface(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSweptSurface or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSweptSurface(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcProfileDef get_SweptCurve();
+        void put_SweptCurve(IfcProfileDef inst);
+
+        IfcAxis2Placement3D get_Position();
+        void put_Position(IfcAxis2Placement3D inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSurface::attr
+        {
+            static constexpr IntValue SweptCurve = 1456;
+            static constexpr IntValue Position = 1457;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSweptSurface_CLASS_H
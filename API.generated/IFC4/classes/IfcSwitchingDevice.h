@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSwitchingDevice_CLASS_H
+#define __RDF_LTD__IFC4_IfcSwitchingDevice_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSwitchingDevice
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSwitchingDevice : public RDF_EXPRESS_VIRTUAL IfcFlowController
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSwitchingDevice
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSwitchingDevice(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 688);
+        }
+
+        /// <summary>
+        /// Instances of IfcSwitchingDevice in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSwitchingDevice> Extent(SdaiModel model) { return ExtentRange<IfcSwitchingDevice>(model, 688, false); }
+        static ExtentRange<IfcSwitchingDevice> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSwitchingDevice>(model, 688, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSwitchingDevice and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSwitchingDevice Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSwitchingDevice"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSwitchingDevice if the actual type of SdaiInstance is IfcSwitchingDevice or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSwitchingDevice CreateExactEntity(SdaiInstance instance) { return IfcSwitchingDevice(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSwitchingDevice or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSwitchingDevice(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSwitchingDeviceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1490); int v = getENUM(1490, IfcSwitchingDeviceTypeEnum_hash); if (v >= 0) return (IfcSwitchingDeviceTypeEnum) v; else return Nullable<IfcSwitchingDeviceTypeEnum>(); }
+        void put_PredefinedType(IfcSwitchingDeviceTypeEnum value) { RDF_EXPRESS_PROBE(1490); TextValue val = IfcSwitchingDeviceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1490), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowController::attr
+        {
+            static constexpr IntValue PredefinedType = 1490;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSwitchingDevice_CLASS_H
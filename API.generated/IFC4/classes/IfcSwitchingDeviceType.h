@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSwitchingDeviceType_CLASS_H
+#define __RDF_LTD__IFC4_IfcSwitchingDeviceType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSwitchingDeviceType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSwitchingDeviceType : public RDF_EXPRESS_VIRTUAL IfcFlowControllerType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSwitchingDeviceType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSwitchingDeviceType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 689);
+        }
+
+        /// <summary>
+        /// Instances of IfcSwitchingDeviceType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSwitchingDeviceType> Extent(SdaiModel model) { return ExtentRange<IfcSwitchingDeviceType>(model, 689, false); }
+        static ExtentRange<IfcSwitchingDeviceType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSwitchingDeviceType>(model, 689, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSwitchingDeviceType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSwitchingDeviceType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSwitchingDeviceType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSwitchingDeviceType if the actual type of SdaiInstance is IfcSwitchingDeviceType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSwitchingDeviceType CreateExactEntity(SdaiInstance instance) { return IfcSwitchingDeviceType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSwitchingDeviceType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSwitchingDeviceType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSwitchingDeviceTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1491); int v = getENUM(1491, IfcSwitchingDeviceTypeEnum_hash); if (v >= 0) return (IfcSwitchingDeviceTypeEnum) v; else return Nullable<IfcSwitchingDeviceTypeEnum>(); }
+        void put_PredefinedType(IfcSwitchingDeviceTypeEnum value) { RDF_EXPRESS_PROBE(1491); TextValue val = IfcSwitchingDeviceTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1491), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowControllerType::attr
+        {
+            static constexpr IntValue PredefinedType = 1491;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSwitchingDeviceType_CLASS_H
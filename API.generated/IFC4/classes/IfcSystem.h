@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSystem_CLASS_H
+#define __RDF_LTD__IFC4_IfcSystem_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGroup.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSystem
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSystem : public RDF_EXPRESS_VIRTUAL IfcGroup
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSystem
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSystem(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 690);
+        }
+
+        /// <summary>
+        /// Instances of IfcSystem in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSystem> Extent(SdaiModel model) { return ExtentRange<IfcSystem>(model, 690, false); }
+        static ExtentRange<IfcSystem> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSystem>(model, 690, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSystem and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSystem Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSystem"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSystem if the actual type of SdaiInstance is IfcSystem or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSystem CreateExactEntity(SdaiInstance instance) { return IfcSystem(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSystem or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSystem(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcRelServicesBuildings or list of convertible elements
+        template <typename TList> void get_ServicesBuildings(TList& lst) { RDF_EXPRESS_PROBE(250); SetOfIfcRelServicesBuildingsSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(250)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGroup::attr
+        {
+            static constexpr IntValue ServicesBuildings = 250;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSystem_CLASS_H
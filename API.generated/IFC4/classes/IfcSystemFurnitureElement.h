@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSystemFurnitureElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcSystemFurnitureElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFurnishingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSystemFurnitureElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSystemFurnitureElement : public RDF_EXPRESS_VIRTUAL IfcFurnishingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSystemFurnitureElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSystemFurnitureElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 691);
+        }
+
+        /// <summary>
+        /// Instances of IfcSystemFurnitureElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSystemFurnitureElement> Extent(SdaiModel model) { return ExtentRange<IfcSystemFurnitureElement>(model, 691, false); }
+        static ExtentRange<IfcSystemFurnitureElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSystemFurnitureElement>(model, 691, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSystemFurnitureElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSystemFurnitureElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSystemFurnitureElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSystemFurnitureElement if the actual type of SdaiInstance is IfcSystemFurnitureElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSystemFurnitureElement CreateExactEntity(SdaiInstance instance) { return IfcSystemFurnitureElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSystemFurnitureElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSystemFurnitureElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSystemFurnitureElementTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1492); int v = getENUM(1492, IfcSystemFurnitureElementTypeEnum_hash); if (v >= 0) return (IfcSystemFurnitureElementTypeEnum) v; else return Nullable<IfcSystemFurnitureElementTypeEnum>(); }
+        void put_PredefinedType(IfcSystemFurnitureElementTypeEnum value) { RDF_EXPRESS_PROBE(1492); TextValue val = IfcSystemFurnitureElementTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1492), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFurnishingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1492;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSystemFurnitureElement_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSystemFurnitureElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcSystemFurnitureElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFurnishingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcSystemFurnitureElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcSystemFurnitureElementType : public RDF_EXPRESS_VIRTUAL IfcFurnishingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcSystemFurnitureElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcSystemFurnitureElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 692);
+        }
+
+        /// <summary>
+        /// Instances of IfcSystemFurnitureElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcSystemFurnitureElementType> Extent(SdaiModel model) { return ExtentRange<IfcSystemFurnitureElementType>(model, 692, false); }
+        static ExtentRange<IfcSystemFurnitureElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcSystemFurnitureElementType>(model, 692, true); }
+
+        /// <summary>
+        /// Create new instance of IfcSystemFurnitureElementType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcSystemFurnitureElementType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcSystemFurnitureElementType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcSystemFurnitureElementType if the actual type of SdaiInstance is IfcSystemFurnitureElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcSystemFurnitureElementType CreateExactEntity(SdaiInstance instance) { return IfcSystemFurnitureElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcSystemFurnitureElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcSystemFurnitureElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcSystemFurnitureElementTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1493); int v = getENUM(1493, IfcSystemFurnitureElementTypeEnum_hash); if (v >= 0) return (IfcSystemFurnitureElementTypeEnum) v; else return Nullable<IfcSystemFurnitureElementTypeEnum>(); }
+        void put_PredefinedType(IfcSystemFurnitureElementTypeEnum value) { RDF_EXPRESS_PROBE(1493); TextValue val = IfcSystemFurnitureElementTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1493), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFurnishingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1493;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcSystemFurnitureElementType_CLASS_H
@@ -0,0 +1,96 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTShapeProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcTShapeProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTShapeProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTShapeProfileDef : public RDF_EXPRESS_VIRTUAL IfcParameterizedProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTShapeProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTShapeProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 733);
+        }
+
+        /// <summary>
+        /// Instances of IfcTShapeProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTShapeProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcTShapeProfileDef>(model, 733, false); }
+        static ExtentRange<IfcTShapeProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTShapeProfileDef>(model, 733, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTShapeProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTShapeProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTShapeProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTShapeProfileDef if the actual type of SdaiInstance is IfcTShapeProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTShapeProfileDef CreateExactEntity(SdaiInstance instance) { return IfcTShapeProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTShapeProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTShapeProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Depth() { RDF_EXPRESS_PROBE(1607); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1607), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Depth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1607); sdaiPutAttr(m_instance, getAttrDefinition(1607), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_FlangeWidth() { RDF_EXPRESS_PROBE(1608); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1608), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_FlangeWidth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1608); sdaiPutAttr(m_instance, getAttrDefinition(1608), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_WebThickness() { RDF_EXPRESS_PROBE(1609); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1609), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_WebThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1609); sdaiPutAttr(m_instance, getAttrDefinition(1609), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_FlangeThickness() { RDF_EXPRESS_PROBE(1610); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1610), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_FlangeThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1610); sdaiPutAttr(m_instance, getAttrDefinition(1610), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_FilletRadius() { RDF_EXPRESS_PROBE(1611); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1611), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_FilletRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(1611); sdaiPutAttr(m_instance, getAttrDefinition(1611), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_FlangeEdgeRadius() { RDF_EXPRESS_PROBE(1612); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1612), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_FlangeEdgeRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(1612); sdaiPutAttr(m_instance, getAttrDefinition(1612), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_WebEdgeRadius() { RDF_EXPRESS_PROBE(1613); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1613), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_WebEdgeRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(1613); sdaiPutAttr(m_instance, getAttrDefinition(1613), sdaiREAL, &value); }
+
+        Nullable<IfcPlaneAngleMeasure> get_WebSlope() { RDF_EXPRESS_PROBE(1614); IfcPlaneAngleMeasure val = (IfcPlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1614), sdaiREAL, &val)) return val; else return Nullable<IfcPlaneAngleMeasure>(); }
+        void put_WebSlope(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(1614); sdaiPutAttr(m_instance, getAttrDefinition(1614), sdaiREAL, &value); }
+
+        Nullable<IfcPlaneAngleMeasure> get_FlangeSlope() { RDF_EXPRESS_PROBE(1615); IfcPlaneAngleMeasure val = (IfcPlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1615), sdaiREAL, &val)) return val; else return Nullable<IfcPlaneAngleMeasure>(); }
+        void put_FlangeSlope(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(1615); sdaiPutAttr(m_instance, getAttrDefinition(1615), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcParameterizedProfileDef::attr
+        {
+            static constexpr IntValue Depth = 1607;
+            static constexpr IntValue FlangeWidth = 1608;
+            static constexpr IntValue WebThickness = 1609;
+            static constexpr IntValue FlangeThickness = 1610;
+            static constexpr IntValue FilletRadius = 1611;
+            static constexpr IntValue FlangeEdgeRadius = 1612;
+            static constexpr IntValue WebEdgeRadius = 1613;
+            static constexpr IntValue WebSlope = 1614;
+            static constexpr IntValue FlangeSlope = 1615;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTShapeProfileDef_CLASS_H
@@ -0,0 +1,99 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTable_CLASS_H
+#define __RDF_LTD__IFC4_IfcTable_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTable
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTable : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTable
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTable(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 693);
+        }
+
+        /// <summary>
+        /// Instances of IfcTable in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTable> Extent(SdaiModel model) { return ExtentRange<IfcTable>(model, 693, false); }
+        static ExtentRange<IfcTable> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTable>(model, 693, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTable and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTable Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTable"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTable if the actual type of SdaiInstance is IfcTable or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTable CreateExactEntity(SdaiInstance instance) { return IfcTable(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTable or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTable(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(1494); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1494), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(1494); sdaiPutAttr(m_instance, getAttrDefinition(1494), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1494); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcTableRow or list of convertible elements
+        template <typename TList> void get_Rows(TList& lst) { RDF_EXPRESS_PROBE(1495); ListOfIfcTableRowSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1495)); }
+
+        //TList may be ListOfIfcTableRow or list of convertible elements
+        template <typename TList> void put_Rows(TList& lst) { RDF_EXPRESS_PROBE(1495); ListOfIfcTableRowSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1495)); }
+
+        //TArrayElem[] may be IfcTableRow[] or array of convertible elements
+        template <typename TArrayElem> void put_Rows(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1495); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcTableRowSerializer<ListOfIfcTableRow> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1495)); }
+
+        //TList may be ListOfIfcTableColumn or list of convertible elements
+        template <typename TList> void get_Columns(TList& lst) { RDF_EXPRESS_PROBE(1496); ListOfIfcTableColumnSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1496)); }
+
+        //TList may be ListOfIfcTableColumn or list of convertible elements
+        template <typename TList> void put_Columns(TList& lst) { RDF_EXPRESS_PROBE(1496); ListOfIfcTableColumnSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1496)); }
+
+        //TArrayElem[] may be IfcTableColumn[] or array of convertible elements
+        template <typename TArrayElem> void put_Columns(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1496); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcTableColumnSerializer<ListOfIfcTableColumn> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1496)); }
+
+        Nullable<IfcInteger> get_NumberOfCellsInRow() { RDF_EXPRESS_PROBE(1497); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1497), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+
+        Nullable<IfcInteger> get_NumberOfHeadings() { RDF_EXPRESS_PROBE(1498); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1498), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+
+        Nullable<IfcInteger> get_NumberOfDataRows() { RDF_EXPRESS_PROBE(1499); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1499), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Name = 1494;
+            static constexpr IntValue Rows = 1495;
+            static constexpr IntValue Columns = 1496;
+            static constexpr IntValue NumberOfCellsInRow = 1497;
+            static constexpr IntValue NumberOfHeadings = 1498;
+            static constexpr IntValue NumberOfDataRows = 1499;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTable_CLASS_H
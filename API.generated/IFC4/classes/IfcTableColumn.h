@@ -0,0 +1,100 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTableColumn_CLASS_H
+#define __RDF_LTD__IFC4_IfcTableColumn_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTableColumn
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTableColumn : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTableColumn
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTableColumn(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 694);
+        }
+
+        /// <summary>
+        /// Instances of IfcTableColumn in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTableColumn> Extent(SdaiModel model) { return ExtentRange<IfcTableColumn>(model, 694, false); }
+        static ExtentRange<IfcTableColumn> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTableColumn>(model, 694, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTableColumn and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTableColumn Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTableColumn"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTableColumn if the actual type of SdaiInstance is IfcTableColumn or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTableColumn CreateExactEntity(SdaiInstance instance) { return IfcTableColumn(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTableColumn or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTableColumn(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Identifier() { RDF_EXPRESS_PROBE(1500); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1500), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Identifier_view() { return TextView(get_Identifier()); }
+#endif
+        void put_Identifier(IfcIdentifier value) { RDF_EXPRESS_PROBE(1500); sdaiPutAttr(m_instance, getAttrDefinition(1500), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Identifier_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1500); return buffer.GetAttr(m_instance, "Identifier"); }
+        const char* get_Identifier_utf8() { return get_Identifier_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(1501); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1501), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(1501); sdaiPutAttr(m_instance, getAttrDefinition(1501), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1501); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(1502); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1502), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(1502); sdaiPutAttr(m_instance, getAttrDefinition(1502), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1502); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcUnit_get get_Unit() { return IfcUnit_get(m_instance, 1503); }
+        IfcUnit_put put_Unit() { return IfcUnit_put(m_instance, 1503); }
+
+        IfcReference get_ReferencePath();
+        void put_ReferencePath(IfcReference inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Identifier = 1500;
+            static constexpr IntValue Name = 1501;
+            static constexpr IntValue Description = 1502;
+            static constexpr IntValue Unit = 1503;
+            static constexpr IntValue ReferencePath = 1504;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTableColumn_CLASS_H
@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTableRow_CLASS_H
+#define __RDF_LTD__IFC4_IfcTableRow_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTableRow
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTableRow : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTableRow
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTableRow(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 695);
+        }
+
+        /// <summary>
+        /// Instances of IfcTableRow in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTableRow> Extent(SdaiModel model) { return ExtentRange<IfcTableRow>(model, 695, false); }
+        static ExtentRange<IfcTableRow> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTableRow>(model, 695, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTableRow and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTableRow Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTableRow"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTableRow if the actual type of SdaiInstance is IfcTableRow or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTableRow CreateExactEntity(SdaiInstance instance) { return IfcTableRow(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTableRow or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTableRow(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void get_RowCells(TList& lst) { RDF_EXPRESS_PROBE(1505); ListOfIfcValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1505)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void put_RowCells(TList& lst) { RDF_EXPRESS_PROBE(1505); ListOfIfcValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1505)); }
+
+        Nullable<IfcBoolean> get_IsHeading() { RDF_EXPRESS_PROBE(1506); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1506), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_IsHeading(IfcBoolean value) { RDF_EXPRESS_PROBE(1506); sdaiPutAttr(m_instance, getAttrDefinition(1506), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue RowCells = 1505;
+            static constexpr IntValue IsHeading = 1506;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTableRow_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTank_CLASS_H
+#define __RDF_LTD__IFC4_IfcTank_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowStorageDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTank
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTank : public RDF_EXPRESS_VIRTUAL IfcFlowStorageDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTank
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTank(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 696);
+        }
+
+        /// <summary>
+        /// Instances of IfcTank in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTank> Extent(SdaiModel model) { return ExtentRange<IfcTank>(model, 696, false); }
+        static ExtentRange<IfcTank> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTank>(model, 696, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTank and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTank Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTank"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTank if the actual type of SdaiInstance is IfcTank or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTank CreateExactEntity(SdaiInstance instance) { return IfcTank(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTank or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTank(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTankTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1507); int v = getENUM(1507, IfcTankTypeEnum_hash); if (v >= 0) return (IfcTankTypeEnum) v; else return Nullable<IfcTankTypeEnum>(); }
+        void put_PredefinedType(IfcTankTypeEnum value) { RDF_EXPRESS_PROBE(1507); TextValue val = IfcTankTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1507), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowStorageDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 1507;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTank_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTankType_CLASS_H
+#define __RDF_LTD__IFC4_IfcTankType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowStorageDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTankType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTankType : public RDF_EXPRESS_VIRTUAL IfcFlowStorageDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTankType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTankType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 697);
+        }
+
+        /// <summary>
+        /// Instances of IfcTankType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTankType> Extent(SdaiModel model) { return ExtentRange<IfcTankType>(model, 697, false); }
+        static ExtentRange<IfcTankType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTankType>(model, 697, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTankType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTankType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTankType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTankType if the actual type of SdaiInstance is IfcTankType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTankType CreateExactEntity(SdaiInstance instance) { return IfcTankType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTankType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTankType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTankTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1508); int v = getENUM(1508, IfcTankTypeEnum_hash); if (v >= 0) return (IfcTankTypeEnum) v; else return Nullable<IfcTankTypeEnum>(); }
+        void put_PredefinedType(IfcTankTypeEnum value) { RDF_EXPRESS_PROBE(1508); TextValue val = IfcTankTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1508), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowStorageDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 1508;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTankType_CLASS_H
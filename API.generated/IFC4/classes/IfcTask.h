@@ -0,0 +1,98 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTask_CLASS_H
+#define __RDF_LTD__IFC4_IfcTask_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcProcess.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTask
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTask : public RDF_EXPRESS_VIRTUAL IfcProcess
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTask
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTask(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 698);
+        }
+
+        /// <summary>
+        /// Instances of IfcTask in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTask> Extent(SdaiModel model) { return ExtentRange<IfcTask>(model, 698, false); }
+        static ExtentRange<IfcTask> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTask>(model, 698, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTask and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTask Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTask"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTask if the actual type of SdaiInstance is IfcTask or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTask CreateExactEntity(SdaiInstance instance) { return IfcTask(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTask or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTask(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Status() { RDF_EXPRESS_PROBE(1509); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1509), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Status_view() { return TextView(get_Status()); }
+#endif
+        void put_Status(IfcLabel value) { RDF_EXPRESS_PROBE(1509); sdaiPutAttr(m_instance, getAttrDefinition(1509), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Status_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1509); return buffer.GetAttr(m_instance, "Status"); }
+        const char* get_Status_utf8() { return get_Status_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_WorkMethod() { RDF_EXPRESS_PROBE(1510); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1510), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_WorkMethod_view() { return TextView(get_WorkMethod()); }
+#endif
+        void put_WorkMethod(IfcLabel value) { RDF_EXPRESS_PROBE(1510); sdaiPutAttr(m_instance, getAttrDefinition(1510), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_WorkMethod_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1510); return buffer.GetAttr(m_instance, "WorkMethod"); }
+        const char* get_WorkMethod_utf8() { return get_WorkMethod_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcBoolean> get_IsMilestone() { RDF_EXPRESS_PROBE(1511); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1511), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_IsMilestone(IfcBoolean value) { RDF_EXPRESS_PROBE(1511); sdaiPutAttr(m_instance, getAttrDefinition(1511), sdaiBOOLEAN, &value); }
+
+        Nullable<IfcInteger> get_Priority() { RDF_EXPRESS_PROBE(1512); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1512), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+        void put_Priority(IfcInteger value) { RDF_EXPRESS_PROBE(1512); sdaiPutAttr(m_instance, getAttrDefinition(1512), sdaiINTEGER, &value); }
+
+        IfcTaskTime get_TaskTime();
+        void put_TaskTime(IfcTaskTime inst);
+
+        Nullable<IfcTaskTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1514); int v = getENUM(1514, IfcTaskTypeEnum_hash); if (v >= 0) return (IfcTaskTypeEnum) v; else return Nullable<IfcTaskTypeEnum>(); }
+        void put_PredefinedType(IfcTaskTypeEnum value) { RDF_EXPRESS_PROBE(1514); TextValue val = IfcTaskTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1514), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcProcess::attr
+        {
+            static constexpr IntValue Status = 1509;
+            static constexpr IntValue WorkMethod = 1510;
+            static constexpr IntValue IsMilestone = 1511;
+            static constexpr IntValue Priority = 1512;
+            static constexpr IntValue TaskTime = 1513;
+            static constexpr IntValue PredefinedType = 1514;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTask_CLASS_H
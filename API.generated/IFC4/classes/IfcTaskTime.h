@@ -0,0 +1,226 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTaskTime_CLASS_H
+#define __RDF_LTD__IFC4_IfcTaskTime_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSchedulingTime.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTaskTime
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTaskTime : public RDF_EXPRESS_VIRTUAL IfcSchedulingTime
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTaskTime
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTaskTime(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 699);
+        }
+
+        /// <summary>
+        /// Instances of IfcTaskTime in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTaskTime> Extent(SdaiModel model) { return ExtentRange<IfcTaskTime>(model, 699, false); }
+        static ExtentRange<IfcTaskTime> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTaskTime>(model, 699, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTaskTime and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTaskTime Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTaskTime"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTaskTime if the actual type of SdaiInstance is IfcTaskTime or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTaskTime CreateExactEntity(SdaiInstance instance) { return IfcTaskTime(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTaskTime or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTaskTime(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTaskDurationEnum> get_DurationType() { RDF_EXPRESS_PROBE(1515); int v = getENUM(1515, IfcTaskDurationEnum_hash); if (v >= 0) return (IfcTaskDurationEnum) v; else return Nullable<IfcTaskDurationEnum>(); }
+        void put_DurationType(IfcTaskDurationEnum value) { RDF_EXPRESS_PROBE(1515); TextValue val = IfcTaskDurationEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1515), sdaiENUM, val); }
+
+        IfcDuration get_ScheduleDuration() { RDF_EXPRESS_PROBE(1516); IfcDuration val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1516), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ScheduleDuration_view() { return TextView(get_ScheduleDuration()); }
+#endif
+        void put_ScheduleDuration(IfcDuration value) { RDF_EXPRESS_PROBE(1516); sdaiPutAttr(m_instance, getAttrDefinition(1516), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ScheduleDuration_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1516); return buffer.GetAttr(m_instance, "ScheduleDuration"); }
+        const char* get_ScheduleDuration_utf8() { return get_ScheduleDuration_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_ScheduleStart() { RDF_EXPRESS_PROBE(1517); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1517), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ScheduleStart_view() { return TextView(get_ScheduleStart()); }
+#endif
+        void put_ScheduleStart(IfcDateTime value) { RDF_EXPRESS_PROBE(1517); sdaiPutAttr(m_instance, getAttrDefinition(1517), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ScheduleStart_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1517); return buffer.GetAttr(m_instance, "ScheduleStart"); }
+        const char* get_ScheduleStart_utf8() { return get_ScheduleStart_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_ScheduleFinish() { RDF_EXPRESS_PROBE(1518); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1518), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ScheduleFinish_view() { return TextView(get_ScheduleFinish()); }
+#endif
+        void put_ScheduleFinish(IfcDateTime value) { RDF_EXPRESS_PROBE(1518); sdaiPutAttr(m_instance, getAttrDefinition(1518), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ScheduleFinish_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1518); return buffer.GetAttr(m_instance, "ScheduleFinish"); }
+        const char* get_ScheduleFinish_utf8() { return get_ScheduleFinish_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_EarlyStart() { RDF_EXPRESS_PROBE(1519); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1519), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_EarlyStart_view() { return TextView(get_EarlyStart()); }
+#endif
+        void put_EarlyStart(IfcDateTime value) { RDF_EXPRESS_PROBE(1519); sdaiPutAttr(m_instance, getAttrDefinition(1519), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_EarlyStart_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1519); return buffer.GetAttr(m_instance, "EarlyStart"); }
+        const char* get_EarlyStart_utf8() { return get_EarlyStart_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_EarlyFinish() { RDF_EXPRESS_PROBE(1520); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1520), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_EarlyFinish_view() { return TextView(get_EarlyFinish()); }
+#endif
+        void put_EarlyFinish(IfcDateTime value) { RDF_EXPRESS_PROBE(1520); sdaiPutAttr(m_instance, getAttrDefinition(1520), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_EarlyFinish_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1520); return buffer.GetAttr(m_instance, "EarlyFinish"); }
+        const char* get_EarlyFinish_utf8() { return get_EarlyFinish_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_LateStart() { RDF_EXPRESS_PROBE(1521); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1521), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LateStart_view() { return TextView(get_LateStart()); }
+#endif
+        void put_LateStart(IfcDateTime value) { RDF_EXPRESS_PROBE(1521); sdaiPutAttr(m_instance, getAttrDefinition(1521), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LateStart_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1521); return buffer.GetAttr(m_instance, "LateStart"); }
+        const char* get_LateStart_utf8() { return get_LateStart_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_LateFinish() { RDF_EXPRESS_PROBE(1522); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1522), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LateFinish_view() { return TextView(get_LateFinish()); }
+#endif
+        void put_LateFinish(IfcDateTime value) { RDF_EXPRESS_PROBE(1522); sdaiPutAttr(m_instance, getAttrDefinition(1522), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LateFinish_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1522); return buffer.GetAttr(m_instance, "LateFinish"); }
+        const char* get_LateFinish_utf8() { return get_LateFinish_utf8(ThreadUtf8Buffer()); }
+
+        IfcDuration get_FreeFloat() { RDF_EXPRESS_PROBE(1523); IfcDuration val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1523), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_FreeFloat_view() { return TextView(get_FreeFloat()); }
+#endif
+        void put_FreeFloat(IfcDuration value) { RDF_EXPRESS_PROBE(1523); sdaiPutAttr(m_instance, getAttrDefinition(1523), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_FreeFloat_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1523); return buffer.GetAttr(m_instance, "FreeFloat"); }
+        const char* get_FreeFloat_utf8() { return get_FreeFloat_utf8(ThreadUtf8Buffer()); }
+
+        IfcDuration get_TotalFloat() { RDF_EXPRESS_PROBE(1524); IfcDuration val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1524), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_TotalFloat_view() { return TextView(get_TotalFloat()); }
+#endif
+        void put_TotalFloat(IfcDuration value) { RDF_EXPRESS_PROBE(1524); sdaiPutAttr(m_instance, getAttrDefinition(1524), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_TotalFloat_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1524); return buffer.GetAttr(m_instance, "TotalFloat"); }
+        const char* get_TotalFloat_utf8() { return get_TotalFloat_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcBoolean> get_IsCritical() { RDF_EXPRESS_PROBE(1525); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1525), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_IsCritical(IfcBoolean value) { RDF_EXPRESS_PROBE(1525); sdaiPutAttr(m_instance, getAttrDefinition(1525), sdaiBOOLEAN, &value); }
+
+        IfcDateTime get_StatusTime() { RDF_EXPRESS_PROBE(1526); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1526), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_StatusTime_view() { return TextView(get_StatusTime()); }
+#endif
+        void put_StatusTime(IfcDateTime value) { RDF_EXPRESS_PROBE(1526); sdaiPutAttr(m_instance, getAttrDefinition(1526), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_StatusTime_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1526); return buffer.GetAttr(m_instance, "StatusTime"); }
+        const char* get_StatusTime_utf8() { return get_StatusTime_utf8(ThreadUtf8Buffer()); }
+
+        IfcDuration get_ActualDuration() { RDF_EXPRESS_PROBE(1527); IfcDuration val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1527), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ActualDuration_view() { return TextView(get_ActualDuration()); }
+#endif
+        void put_ActualDuration(IfcDuration value) { RDF_EXPRESS_PROBE(1527); sdaiPutAttr(m_instance, getAttrDefinition(1527), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ActualDuration_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1527); return buffer.GetAttr(m_instance, "ActualDuration"); }
+        const char* get_ActualDuration_utf8() { return get_ActualDuration_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_ActualStart() { RDF_EXPRESS_PROBE(1528); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1528), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ActualStart_view() { return TextView(get_ActualStart()); }
+#endif
+        void put_ActualStart(IfcDateTime value) { RDF_EXPRESS_PROBE(1528); sdaiPutAttr(m_instance, getAttrDefinition(1528), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ActualStart_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1528); return buffer.GetAttr(m_instance, "ActualStart"); }
+        const char* get_ActualStart_utf8() { return get_ActualStart_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_ActualFinish() { RDF_EXPRESS_PROBE(1529); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1529), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ActualFinish_view() { return TextView(get_ActualFinish()); }
+#endif
+        void put_ActualFinish(IfcDateTime value) { RDF_EXPRESS_PROBE(1529); sdaiPutAttr(m_instance, getAttrDefinition(1529), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ActualFinish_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1529); return buffer.GetAttr(m_instance, "ActualFinish"); }
+        const char* get_ActualFinish_utf8() { return get_ActualFinish_utf8(ThreadUtf8Buffer()); }
+
+        IfcDuration get_RemainingTime() { RDF_EXPRESS_PROBE(1530); IfcDuration val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1530), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_RemainingTime_view() { return TextView(get_RemainingTime()); }
+#endif
+        void put_RemainingTime(IfcDuration value) { RDF_EXPRESS_PROBE(1530); sdaiPutAttr(m_instance, getAttrDefinition(1530), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_RemainingTime_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1530); return buffer.GetAttr(m_instance, "RemainingTime"); }
+        const char* get_RemainingTime_utf8() { return get_RemainingTime_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcPositiveRatioMeasure> get_Completion() { RDF_EXPRESS_PROBE(1531); IfcPositiveRatioMeasure val = (IfcPositiveRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1531), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveRatioMeasure>(); }
+        void put_Completion(IfcPositiveRatioMeasure value) { RDF_EXPRESS_PROBE(1531); sdaiPutAttr(m_instance, getAttrDefinition(1531), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSchedulingTime::attr
+        {
+            static constexpr IntValue DurationType = 1515;
+            static constexpr IntValue ScheduleDuration = 1516;
+            static constexpr IntValue ScheduleStart = 1517;
+            static constexpr IntValue ScheduleFinish = 1518;
+            static constexpr IntValue EarlyStart = 1519;
+            static constexpr IntValue EarlyFinish = 1520;
+            static constexpr IntValue LateStart = 1521;
+            static constexpr IntValue LateFinish = 1522;
+            static constexpr IntValue FreeFloat = 1523;
+            static constexpr IntValue TotalFloat = 1524;
+            static constexpr IntValue IsCritical = 1525;
+            static constexpr IntValue StatusTime = 1526;
+            static constexpr IntValue ActualDuration = 1527;
+            static constexpr IntValue ActualStart = 1528;
+            static constexpr IntValue ActualFinish = 1529;
+            static constexpr IntValue RemainingTime = 1530;
+            static constexpr IntValue Completion = 1531;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTaskTime_CLASS_H
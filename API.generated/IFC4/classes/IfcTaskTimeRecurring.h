@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTaskTimeRecurring_CLASS_H
+#define __RDF_LTD__IFC4_IfcTaskTimeRecurring_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTaskTime.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTaskTimeRecurring
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTaskTimeRecurring : public RDF_EXPRESS_VIRTUAL IfcTaskTime
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTaskTimeRecurring
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTaskTimeRecurring(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 700);
+        }
+
+        /// <summary>
+        /// Instances of IfcTaskTimeRecurring in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTaskTimeRecurring> Extent(SdaiModel model) { return ExtentRange<IfcTaskTimeRecurring>(model, 700, false); }
+        static ExtentRange<IfcTaskTimeRecurring> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTaskTimeRecurring>(model, 700, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTaskTimeRecurring and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTaskTimeRecurring Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTaskTimeRecurring"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTaskTimeRecurring if the actual type of SdaiInstance is IfcTaskTimeRecurring or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTaskTimeRecurring CreateExactEntity(SdaiInstance instance) { return IfcTaskTimeRecurring(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTaskTimeRecurring or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTaskTimeRecurring(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcRecurrencePattern get_Recurrence();
+        void put_Recurrence(IfcRecurrencePattern inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTaskTime::attr
+        {
+            static constexpr IntValue Recurrence = 1532;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTaskTimeRecurring_CLASS_H
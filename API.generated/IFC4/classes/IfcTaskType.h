@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTaskType_CLASS_H
+#define __RDF_LTD__IFC4_IfcTaskType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTypeProcess.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTaskType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTaskType : public RDF_EXPRESS_VIRTUAL IfcTypeProcess
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTaskType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTaskType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 701);
+        }
+
+        /// <summary>
+        /// Instances of IfcTaskType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTaskType> Extent(SdaiModel model) { return ExtentRange<IfcTaskType>(model, 701, false); }
+        static ExtentRange<IfcTaskType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTaskType>(model, 701, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTaskType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTaskType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTaskType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTaskType if the actual type of SdaiInstance is IfcTaskType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTaskType CreateExactEntity(SdaiInstance instance) { return IfcTaskType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTaskType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTaskType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTaskTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1533); int v = getENUM(1533, IfcTaskTypeEnum_hash); if (v >= 0) return (IfcTaskTypeEnum) v; else return Nullable<IfcTaskTypeEnum>(); }
+        void put_PredefinedType(IfcTaskTypeEnum value) { RDF_EXPRESS_PROBE(1533); TextValue val = IfcTaskTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1533), sdaiENUM, val); }
+
+        IfcLabel get_WorkMethod() { RDF_EXPRESS_PROBE(1534); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1534), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_WorkMethod_view() { return TextView(get_WorkMethod()); }
+#endif
+        void put_WorkMethod(IfcLabel value) { RDF_EXPRESS_PROBE(1534); sdaiPutAttr(m_instance, getAttrDefinition(1534), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_WorkMethod_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1534); return buffer.GetAttr(m_instance, "WorkMethod"); }
+        const char* get_WorkMethod_utf8() { return get_WorkMethod_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTypeProcess::attr
+        {
+            static constexpr IntValue PredefinedType = 1533;
+            static constexpr IntValue WorkMethod = 1534;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTaskType_CLASS_H
@@ -0,0 +1,122 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTelecomAddress_CLASS_H
+#define __RDF_LTD__IFC4_IfcTelecomAddress_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcAddress.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTelecomAddress
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTelecomAddress : public RDF_EXPRESS_VIRTUAL IfcAddress
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTelecomAddress
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTelecomAddress(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 702);
+        }
+
+        /// <summary>
+        /// Instances of IfcTelecomAddress in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTelecomAddress> Extent(SdaiModel model) { return ExtentRange<IfcTelecomAddress>(model, 702, false); }
+        static ExtentRange<IfcTelecomAddress> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTelecomAddress>(model, 702, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTelecomAddress and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTelecomAddress Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTelecomAddress"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTelecomAddress if the actual type of SdaiInstance is IfcTelecomAddress or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTelecomAddress CreateExactEntity(SdaiInstance instance) { return IfcTelecomAddress(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTelecomAddress or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTelecomAddress(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void get_TelephoneNumbers(TList& lst) { RDF_EXPRESS_PROBE(1535); ListOfIfcLabelSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1535)); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void put_TelephoneNumbers(TList& lst) { RDF_EXPRESS_PROBE(1535); ListOfIfcLabelSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1535)); }
+
+        //TArrayElem[] may be IfcLabel[] or array of convertible elements
+        template <typename TArrayElem> void put_TelephoneNumbers(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1535); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcLabelSerializer<ListOfIfcLabel> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1535)); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void get_FacsimileNumbers(TList& lst) { RDF_EXPRESS_PROBE(1536); ListOfIfcLabelSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1536)); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void put_FacsimileNumbers(TList& lst) { RDF_EXPRESS_PROBE(1536); ListOfIfcLabelSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1536)); }
+
+        //TArrayElem[] may be IfcLabel[] or array of convertible elements
+        template <typename TArrayElem> void put_FacsimileNumbers(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1536); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcLabelSerializer<ListOfIfcLabel> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1536)); }
+
+        IfcLabel get_PagerNumber() { RDF_EXPRESS_PROBE(1537); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1537), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_PagerNumber_view() { return TextView(get_PagerNumber()); }
+#endif
+        void put_PagerNumber(IfcLabel value) { RDF_EXPRESS_PROBE(1537); sdaiPutAttr(m_instance, getAttrDefinition(1537), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_PagerNumber_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1537); return buffer.GetAttr(m_instance, "PagerNumber"); }
+        const char* get_PagerNumber_utf8() { return get_PagerNumber_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void get_ElectronicMailAddresses(TList& lst) { RDF_EXPRESS_PROBE(1538); ListOfIfcLabelSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1538)); }
+
+        //TList may be ListOfIfcLabel or list of convertible elements
+        template <typename TList> void put_ElectronicMailAddresses(TList& lst) { RDF_EXPRESS_PROBE(1538); ListOfIfcLabelSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1538)); }
+
+        //TArrayElem[] may be IfcLabel[] or array of convertible elements
+        template <typename TArrayElem> void put_ElectronicMailAddresses(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1538); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcLabelSerializer<ListOfIfcLabel> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1538)); }
+
+        IfcURIReference get_WWWHomePageURL() { RDF_EXPRESS_PROBE(1539); IfcURIReference val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1539), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_WWWHomePageURL_view() { return TextView(get_WWWHomePageURL()); }
+#endif
+        void put_WWWHomePageURL(IfcURIReference value) { RDF_EXPRESS_PROBE(1539); sdaiPutAttr(m_instance, getAttrDefinition(1539), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_WWWHomePageURL_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1539); return buffer.GetAttr(m_instance, "WWWHomePageURL"); }
+        const char* get_WWWHomePageURL_utf8() { return get_WWWHomePageURL_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcURIReference or list of convertible elements
+        template <typename TList> void get_MessagingIDs(TList& lst) { RDF_EXPRESS_PROBE(1540); ListOfIfcURIReferenceSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1540)); }
+
+        //TList may be ListOfIfcURIReference or list of convertible elements
+        template <typename TList> void put_MessagingIDs(TList& lst) { RDF_EXPRESS_PROBE(1540); ListOfIfcURIReferenceSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1540)); }
+
+        //TArrayElem[] may be IfcURIReference[] or array of convertible elements
+        template <typename TArrayElem> void put_MessagingIDs(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1540); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcURIReferenceSerializer<ListOfIfcURIReference> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1540)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcAddress::attr
+        {
+            static constexpr IntValue TelephoneNumbers = 1535;
+            static constexpr IntValue FacsimileNumbers = 1536;
+            static constexpr IntValue PagerNumber = 1537;
+            static constexpr IntValue ElectronicMailAddresses = 1538;
+            static constexpr IntValue WWWHomePageURL = 1539;
+            static constexpr IntValue MessagingIDs = 1540;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTelecomAddress_CLASS_H
@@ -0,0 +1,92 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTendon_CLASS_H
+#define __RDF_LTD__IFC4_IfcTendon_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcReinforcingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTendon
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTendon : public RDF_EXPRESS_VIRTUAL IfcReinforcingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTendon
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTendon(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 703);
+        }
+
+        /// <summary>
+        /// Instances of IfcTendon in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTendon> Extent(SdaiModel model) { return ExtentRange<IfcTendon>(model, 703, false); }
+        static ExtentRange<IfcTendon> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTendon>(model, 703, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTendon and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTendon Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTendon"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTendon if the actual type of SdaiInstance is IfcTendon or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTendon CreateExactEntity(SdaiInstance instance) { return IfcTendon(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTendon or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTendon(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTendonTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1541); int v = getENUM(1541, IfcTendonTypeEnum_hash); if (v >= 0) return (IfcTendonTypeEnum) v; else return Nullable<IfcTendonTypeEnum>(); }
+        void put_PredefinedType(IfcTendonTypeEnum value) { RDF_EXPRESS_PROBE(1541); TextValue val = IfcTendonTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1541), sdaiENUM, val); }
+
+        Nullable<IfcPositiveLengthMeasure> get_NominalDiameter() { RDF_EXPRESS_PROBE(1542); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1542), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_NominalDiameter(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1542); sdaiPutAttr(m_instance, getAttrDefinition(1542), sdaiREAL, &value); }
+
+        Nullable<IfcAreaMeasure> get_CrossSectionArea() { RDF_EXPRESS_PROBE(1543); IfcAreaMeasure val = (IfcAreaMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1543), sdaiREAL, &val)) return val; else return Nullable<IfcAreaMeasure>(); }
+        void put_CrossSectionArea(IfcAreaMeasure value) { RDF_EXPRESS_PROBE(1543); sdaiPutAttr(m_instance, getAttrDefinition(1543), sdaiREAL, &value); }
+
+        Nullable<IfcForceMeasure> get_TensionForce() { RDF_EXPRESS_PROBE(1544); IfcForceMeasure val = (IfcForceMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1544), sdaiREAL, &val)) return val; else return Nullable<IfcForceMeasure>(); }
+        void put_TensionForce(IfcForceMeasure value) { RDF_EXPRESS_PROBE(1544); sdaiPutAttr(m_instance, getAttrDefinition(1544), sdaiREAL, &value); }
+
+        Nullable<IfcPressureMeasure> get_PreStress() { RDF_EXPRESS_PROBE(1545); IfcPressureMeasure val = (IfcPressureMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1545), sdaiREAL, &val)) return val; else return Nullable<IfcPressureMeasure>(); }
+        void put_PreStress(IfcPressureMeasure value) { RDF_EXPRESS_PROBE(1545); sdaiPutAttr(m_instance, getAttrDefinition(1545), sdaiREAL, &value); }
+
+        Nullable<IfcNormalisedRatioMeasure> get_FrictionCoefficient() { RDF_EXPRESS_PROBE(1546); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1546), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_FrictionCoefficient(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(1546); sdaiPutAttr(m_instance, getAttrDefinition(1546), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_AnchorageSlip() { RDF_EXPRESS_PROBE(1547); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1547), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_AnchorageSlip(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1547); sdaiPutAttr(m_instance, getAttrDefinition(1547), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_MinCurvatureRadius() { RDF_EXPRESS_PROBE(1548); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1548), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_MinCurvatureRadius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1548); sdaiPutAttr(m_instance, getAttrDefinition(1548), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcReinforcingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1541;
+            static constexpr IntValue NominalDiameter = 1542;
+            static constexpr IntValue CrossSectionArea = 1543;
+            static constexpr IntValue TensionForce = 1544;
+            static constexpr IntValue PreStress = 1545;
+            static constexpr IntValue FrictionCoefficient = 1546;
+            static constexpr IntValue AnchorageSlip = 1547;
+            static constexpr IntValue MinCurvatureRadius = 1548;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTendon_CLASS_H
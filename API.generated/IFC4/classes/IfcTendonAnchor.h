@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTendonAnchor_CLASS_H
+#define __RDF_LTD__IFC4_IfcTendonAnchor_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcReinforcingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTendonAnchor
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTendonAnchor : public RDF_EXPRESS_VIRTUAL IfcReinforcingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTendonAnchor
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTendonAnchor(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 704);
+        }
+
+        /// <summary>
+        /// Instances of IfcTendonAnchor in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTendonAnchor> Extent(SdaiModel model) { return ExtentRange<IfcTendonAnchor>(model, 704, false); }
+        static ExtentRange<IfcTendonAnchor> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTendonAnchor>(model, 704, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTendonAnchor and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTendonAnchor Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTendonAnchor"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTendonAnchor if the actual type of SdaiInstance is IfcTendonAnchor or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTendonAnchor CreateExactEntity(SdaiInstance instance) { return IfcTendonAnchor(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTendonAnchor or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTendonAnchor(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTendonAnchorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1549); int v = getENUM(1549, IfcTendonAnchorTypeEnum_hash); if (v >= 0) return (IfcTendonAnchorTypeEnum) v; else return Nullable<IfcTendonAnchorTypeEnum>(); }
+        void put_PredefinedType(IfcTendonAnchorTypeEnum value) { RDF_EXPRESS_PROBE(1549); TextValue val = IfcTendonAnchorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1549), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcReinforcingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1549;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTendonAnchor_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTendonAnchorType_CLASS_H
+#define __RDF_LTD__IFC4_IfcTendonAnchorType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcReinforcingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTendonAnchorType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTendonAnchorType : public RDF_EXPRESS_VIRTUAL IfcReinforcingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTendonAnchorType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTendonAnchorType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 705);
+        }
+
+        /// <summary>
+        /// Instances of IfcTendonAnchorType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTendonAnchorType> Extent(SdaiModel model) { return ExtentRange<IfcTendonAnchorType>(model, 705, false); }
+        static ExtentRange<IfcTendonAnchorType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTendonAnchorType>(model, 705, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTendonAnchorType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTendonAnchorType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTendonAnchorType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTendonAnchorType if the actual type of SdaiInstance is IfcTendonAnchorType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTendonAnchorType CreateExactEntity(SdaiInstance instance) { return IfcTendonAnchorType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTendonAnchorType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTendonAnchorType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTendonAnchorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1550); int v = getENUM(1550, IfcTendonAnchorTypeEnum_hash); if (v >= 0) return (IfcTendonAnchorTypeEnum) v; else return Nullable<IfcTendonAnchorTypeEnum>(); }
+        void put_PredefinedType(IfcTendonAnchorTypeEnum value) { RDF_EXPRESS_PROBE(1550); TextValue val = IfcTendonAnchorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1550), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcReinforcingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1550;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTendonAnchorType_CLASS_H
@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTendonType_CLASS_H
+#define __RDF_LTD__IFC4_IfcTendonType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcReinforcingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTendonType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTendonType : public RDF_EXPRESS_VIRTUAL IfcReinforcingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTendonType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTendonType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 706);
+        }
+
+        /// <summary>
+        /// Instances of IfcTendonType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTendonType> Extent(SdaiModel model) { return ExtentRange<IfcTendonType>(model, 706, false); }
+        static ExtentRange<IfcTendonType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTendonType>(model, 706, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTendonType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTendonType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTendonType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTendonType if the actual type of SdaiInstance is IfcTendonType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTendonType CreateExactEntity(SdaiInstance instance) { return IfcTendonType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTendonType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTendonType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTendonTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1551); int v = getENUM(1551, IfcTendonTypeEnum_hash); if (v >= 0) return (IfcTendonTypeEnum) v; else return Nullable<IfcTendonTypeEnum>(); }
+        void put_PredefinedType(IfcTendonTypeEnum value) { RDF_EXPRESS_PROBE(1551); TextValue val = IfcTendonTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1551), sdaiENUM, val); }
+
+        Nullable<IfcPositiveLengthMeasure> get_NominalDiameter() { RDF_EXPRESS_PROBE(1552); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1552), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_NominalDiameter(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1552); sdaiPutAttr(m_instance, getAttrDefinition(1552), sdaiREAL, &value); }
+
+        Nullable<IfcAreaMeasure> get_CrossSectionArea() { RDF_EXPRESS_PROBE(1553); IfcAreaMeasure val = (IfcAreaMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1553), sdaiREAL, &val)) return val; else return Nullable<IfcAreaMeasure>(); }
+        void put_CrossSectionArea(IfcAreaMeasure value) { RDF_EXPRESS_PROBE(1553); sdaiPutAttr(m_instance, getAttrDefinition(1553), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_SheathDiameter() { RDF_EXPRESS_PROBE(1554); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1554), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_SheathDiameter(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1554); sdaiPutAttr(m_instance, getAttrDefinition(1554), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcReinforcingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1551;
+            static constexpr IntValue NominalDiameter = 1552;
+            static constexpr IntValue CrossSectionArea = 1553;
+            static constexpr IntValue SheathDiameter = 1554;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTendonType_CLASS_H
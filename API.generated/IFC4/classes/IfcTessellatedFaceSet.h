@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTessellatedFaceSet_CLASS_H
+#define __RDF_LTD__IFC4_IfcTessellatedFaceSet_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTessellatedItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTessellatedFaceSet
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTessellatedFaceSet : public RDF_EXPRESS_VIRTUAL IfcTessellatedItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTessellatedFaceSet
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTessellatedFaceSet(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 707);
+        }
+
+        /// <summary>
+        /// Instances of IfcTessellatedFaceSet in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTessellatedFaceSet> Extent(SdaiModel model) { return ExtentRange<IfcTessellatedFaceSet>(model, 707, false); }
+        static ExtentRange<IfcTessellatedFaceSet> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTessellatedFaceSet>(model, 707, true); }
+
+        /// <summary>
+        /// Returns object of IfcTessellatedFaceSet if the actual type of SdaiInstance is IfcTessellatedFaceSet or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTessellatedFaceSet CreateExactEntity(SdaiInstance instance) { return IfcTessellatedFaceSet(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTessellatedFaceSet or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTessellatedFaceSet(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCartesianPointList3D get_Coordinates();
+        void put_Coordinates(IfcCartesianPointList3D inst);
+
+        //TList may be SetOfIfcIndexedColourMap or list of convertible elements
+        template <typename TList> void get_HasColours(TList& lst) { RDF_EXPRESS_PROBE(1005); SetOfIfcIndexedColourMapSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1005)); }
+
+        //TList may be SetOfIfcIndexedTextureMap or list of convertible elements
+        template <typename TList> void get_HasTextures(TList& lst) { RDF_EXPRESS_PROBE(1006); SetOfIfcIndexedTextureMapSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1006)); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(1007); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1007), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTessellatedItem::attr
+        {
+            static constexpr IntValue Coordinates = 1004;
+            static constexpr IntValue HasColours = 1005;
+            static constexpr IntValue HasTextures = 1006;
+            static constexpr IntValue Dim = 1007;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTessellatedFaceSet_CLASS_H
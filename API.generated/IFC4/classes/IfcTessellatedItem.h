@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTessellatedItem_CLASS_H
+#define __RDF_LTD__IFC4_IfcTessellatedItem_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTessellatedItem
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTessellatedItem : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTessellatedItem
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTessellatedItem(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 708);
+        }
+
+        /// <summary>
+        /// Instances of IfcTessellatedItem in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTessellatedItem> Extent(SdaiModel model) { return ExtentRange<IfcTessellatedItem>(model, 708, false); }
+        static ExtentRange<IfcTessellatedItem> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTessellatedItem>(model, 708, true); }
+
+        /// <summary>
+        /// Returns object of IfcTessellatedItem if the actual type of SdaiInstance is IfcTessellatedItem or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTessellatedItem CreateExactEntity(SdaiInstance instance) { return IfcTessellatedItem(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTessellatedItem or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTessellatedItem(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTessellatedItem_CLASS_H
@@ -0,0 +1,79 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextLiteral_CLASS_H
+#define __RDF_LTD__IFC4_IfcTextLiteral_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTextLiteral
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTextLiteral : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTextLiteral
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTextLiteral(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 709);
+        }
+
+        /// <summary>
+        /// Instances of IfcTextLiteral in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTextLiteral> Extent(SdaiModel model) { return ExtentRange<IfcTextLiteral>(model, 709, false); }
+        static ExtentRange<IfcTextLiteral> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTextLiteral>(model, 709, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTextLiteral and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTextLiteral Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTextLiteral"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTextLiteral if the actual type of SdaiInstance is IfcTextLiteral or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTextLiteral CreateExactEntity(SdaiInstance instance) { return IfcTextLiteral(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTextLiteral or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTextLiteral(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcPresentableText get_Literal() { RDF_EXPRESS_PROBE(1555); IfcPresentableText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1555), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Literal_view() { return TextView(get_Literal()); }
+#endif
+        void put_Literal(IfcPresentableText value) { RDF_EXPRESS_PROBE(1555); sdaiPutAttr(m_instance, getAttrDefinition(1555), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Literal_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1555); return buffer.GetAttr(m_instance, "Literal"); }
+        const char* get_Literal_utf8() { return get_Literal_utf8(ThreadUtf8Buffer()); }
+
+        IfcAxis2Placement_get get_Placement() { return IfcAxis2Placement_get(m_instance, 1556); }
+        IfcAxis2Placement_put put_Placement() { return IfcAxis2Placement_put(m_instance, 1556); }
+
+        Nullable<IfcTextPath> get_Path() { RDF_EXPRESS_PROBE(1557); int v = getENUM(1557, IfcTextPath_hash); if (v >= 0) return (IfcTextPath) v; else return Nullable<IfcTextPath>(); }
+        void put_Path(IfcTextPath value) { RDF_EXPRESS_PROBE(1557); TextValue val = IfcTextPath_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1557), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue Literal = 1555;
+            static constexpr IntValue Placement = 1556;
+            static constexpr IntValue Path = 1557;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextLiteral_CLASS_H
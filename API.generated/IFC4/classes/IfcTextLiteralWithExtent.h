@@ -0,0 +1,75 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextLiteralWithExtent_CLASS_H
+#define __RDF_LTD__IFC4_IfcTextLiteralWithExtent_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTextLiteral.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTextLiteralWithExtent
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTextLiteralWithExtent : public RDF_EXPRESS_VIRTUAL IfcTextLiteral
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTextLiteralWithExtent
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTextLiteralWithExtent(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 710);
+        }
+
+        /// <summary>
+        /// Instances of IfcTextLiteralWithExtent in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTextLiteralWithExtent> Extent(SdaiModel model) { return ExtentRange<IfcTextLiteralWithExtent>(model, 710, false); }
+        static ExtentRange<IfcTextLiteralWithExtent> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTextLiteralWithExtent>(model, 710, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTextLiteralWithExtent and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTextLiteralWithExtent Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTextLiteralWithExtent"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTextLiteralWithExtent if the actual type of SdaiInstance is IfcTextLiteralWithExtent or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTextLiteralWithExtent CreateExactEntity(SdaiInstance instance) { return IfcTextLiteralWithExtent(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTextLiteralWithExtent or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTextLiteralWithExtent(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcPlanarExtent get_Extent();
+        void put_Extent(IfcPlanarExtent inst);
+
+        IfcBoxAlignment get_BoxAlignment() { RDF_EXPRESS_PROBE(1559); IfcBoxAlignment val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1559), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_BoxAlignment_view() { return TextView(get_BoxAlignment()); }
+#endif
+        void put_BoxAlignment(IfcBoxAlignment value) { RDF_EXPRESS_PROBE(1559); sdaiPutAttr(m_instance, getAttrDefinition(1559), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_BoxAlignment_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1559); return buffer.GetAttr(m_instance, "BoxAlignment"); }
+        const char* get_BoxAlignment_utf8() { return get_BoxAlignment_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTextLiteral::attr
+        {
+            static constexpr IntValue Extent = 1558;
+            static constexpr IntValue BoxAlignment = 1559;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextLiteralWithExtent_CLASS_H
@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextStyle_CLASS_H
+#define __RDF_LTD__IFC4_IfcTextStyle_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationStyle.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTextStyle
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTextStyle : public RDF_EXPRESS_VIRTUAL IfcPresentationStyle
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTextStyle
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTextStyle(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 711);
+        }
+
+        /// <summary>
+        /// Instances of IfcTextStyle in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTextStyle> Extent(SdaiModel model) { return ExtentRange<IfcTextStyle>(model, 711, false); }
+        static ExtentRange<IfcTextStyle> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTextStyle>(model, 711, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTextStyle and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTextStyle Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTextStyle"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTextStyle if the actual type of SdaiInstance is IfcTextStyle or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTextStyle CreateExactEntity(SdaiInstance instance) { return IfcTextStyle(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTextStyle or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTextStyle(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcTextStyleForDefinedFont get_TextCharacterAppearance();
+        void put_TextCharacterAppearance(IfcTextStyleForDefinedFont inst);
+
+        IfcTextStyleTextModel get_TextStyle();
+        void put_TextStyle(IfcTextStyleTextModel inst);
+
+        IfcTextFontSelect_get get_TextFontStyle() { return IfcTextFontSelect_get(m_instance, 1562); }
+        IfcTextFontSelect_put put_TextFontStyle() { return IfcTextFontSelect_put(m_instance, 1562); }
+
+        Nullable<IfcBoolean> get_ModelOrDraughting() { RDF_EXPRESS_PROBE(1563); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1563), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_ModelOrDraughting(IfcBoolean value) { RDF_EXPRESS_PROBE(1563); sdaiPutAttr(m_instance, getAttrDefinition(1563), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationStyle::attr
+        {
+            static constexpr IntValue TextCharacterAppearance = 1560;
+            static constexpr IntValue TextStyle = 1561;
+            static constexpr IntValue TextFontStyle = 1562;
+            static constexpr IntValue ModelOrDraughting = 1563;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextStyle_CLASS_H
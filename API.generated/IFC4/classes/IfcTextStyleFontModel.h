@@ -0,0 +1,107 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextStyleFontModel_CLASS_H
+#define __RDF_LTD__IFC4_IfcTextStyleFontModel_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedTextFont.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTextStyleFontModel
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTextStyleFontModel : public RDF_EXPRESS_VIRTUAL IfcPreDefinedTextFont
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTextStyleFontModel
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTextStyleFontModel(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 712);
+        }
+
+        /// <summary>
+        /// Instances of IfcTextStyleFontModel in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTextStyleFontModel> Extent(SdaiModel model) { return ExtentRange<IfcTextStyleFontModel>(model, 712, false); }
+        static ExtentRange<IfcTextStyleFontModel> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTextStyleFontModel>(model, 712, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTextStyleFontModel and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTextStyleFontModel Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTextStyleFontModel"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTextStyleFontModel if the actual type of SdaiInstance is IfcTextStyleFontModel or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTextStyleFontModel CreateExactEntity(SdaiInstance instance) { return IfcTextStyleFontModel(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTextStyleFontModel or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTextStyleFontModel(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcTextFontName or list of convertible elements
+        template <typename TList> void get_FontFamily(TList& lst) { RDF_EXPRESS_PROBE(1564); ListOfIfcTextFontNameSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1564)); }
+
+        //TList may be ListOfIfcTextFontName or list of convertible elements
+        template <typename TList> void put_FontFamily(TList& lst) { RDF_EXPRESS_PROBE(1564); ListOfIfcTextFontNameSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1564)); }
+
+        //TArrayElem[] may be IfcTextFontName[] or array of convertible elements
+        template <typename TArrayElem> void put_FontFamily(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1564); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcTextFontNameSerializer<ListOfIfcTextFontName> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1564)); }
+
+        IfcFontStyle get_FontStyle() { RDF_EXPRESS_PROBE(1565); IfcFontStyle val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1565), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_FontStyle_view() { return TextView(get_FontStyle()); }
+#endif
+        void put_FontStyle(IfcFontStyle value) { RDF_EXPRESS_PROBE(1565); sdaiPutAttr(m_instance, getAttrDefinition(1565), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_FontStyle_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1565); return buffer.GetAttr(m_instance, "FontStyle"); }
+        const char* get_FontStyle_utf8() { return get_FontStyle_utf8(ThreadUtf8Buffer()); }
+
+        IfcFontVariant get_FontVariant() { RDF_EXPRESS_PROBE(1566); IfcFontVariant val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1566), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_FontVariant_view() { return TextView(get_FontVariant()); }
+#endif
+        void put_FontVariant(IfcFontVariant value) { RDF_EXPRESS_PROBE(1566); sdaiPutAttr(m_instance, getAttrDefinition(1566), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_FontVariant_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1566); return buffer.GetAttr(m_instance, "FontVariant"); }
+        const char* get_FontVariant_utf8() { return get_FontVariant_utf8(ThreadUtf8Buffer()); }
+
+        IfcFontWeight get_FontWeight() { RDF_EXPRESS_PROBE(1567); IfcFontWeight val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1567), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_FontWeight_view() { return TextView(get_FontWeight()); }
+#endif
+        void put_FontWeight(IfcFontWeight value) { RDF_EXPRESS_PROBE(1567); sdaiPutAttr(m_instance, getAttrDefinition(1567), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_FontWeight_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1567); return buffer.GetAttr(m_instance, "FontWeight"); }
+        const char* get_FontWeight_utf8() { return get_FontWeight_utf8(ThreadUtf8Buffer()); }
+
+        IfcSizeSelect_get get_FontSize() { return IfcSizeSelect_get(m_instance, 1568); }
+        IfcSizeSelect_put put_FontSize() { return IfcSizeSelect_put(m_instance, 1568); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedTextFont::attr
+        {
+            static constexpr IntValue FontFamily = 1564;
+            static constexpr IntValue FontStyle = 1565;
+            static constexpr IntValue FontVariant = 1566;
+            static constexpr IntValue FontWeight = 1567;
+            static constexpr IntValue FontSize = 1568;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextStyleFontModel_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextStyleForDefinedFont_CLASS_H
+#define __RDF_LTD__IFC4_IfcTextStyleForDefinedFont_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTextStyleForDefinedFont
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTextStyleForDefinedFont : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTextStyleForDefinedFont
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTextStyleForDefinedFont(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 713);
+        }
+
+        /// <summary>
+        /// Instances of IfcTextStyleForDefinedFont in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTextStyleForDefinedFont> Extent(SdaiModel model) { return ExtentRange<IfcTextStyleForDefinedFont>(model, 713, false); }
+        static ExtentRange<IfcTextStyleForDefinedFont> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTextStyleForDefinedFont>(model, 713, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTextStyleForDefinedFont and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTextStyleForDefinedFont Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTextStyleForDefinedFont"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTextStyleForDefinedFont if the actual type of SdaiInstance is IfcTextStyleForDefinedFont or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTextStyleForDefinedFont CreateExactEntity(SdaiInstance instance) { return IfcTextStyleForDefinedFont(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTextStyleForDefinedFont or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTextStyleForDefinedFont(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcColour_get get_Colour() { return IfcColour_get(m_instance, 1569); }
+        IfcColour_put put_Colour() { return IfcColour_put(m_instance, 1569); }
+
+        IfcColour_get get_BackgroundColour() { return IfcColour_get(m_instance, 1570); }
+        IfcColour_put put_BackgroundColour() { return IfcColour_put(m_instance, 1570); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue Colour = 1569;
+            static constexpr IntValue BackgroundColour = 1570;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextStyleForDefinedFont_CLASS_H
@@ -0,0 +1,109 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextStyleTextModel_CLASS_H
+#define __RDF_LTD__IFC4_IfcTextStyleTextModel_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTextStyleTextModel
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTextStyleTextModel : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTextStyleTextModel
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTextStyleTextModel(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 714);
+        }
+
+        /// <summary>
+        /// Instances of IfcTextStyleTextModel in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTextStyleTextModel> Extent(SdaiModel model) { return ExtentRange<IfcTextStyleTextModel>(model, 714, false); }
+        static ExtentRange<IfcTextStyleTextModel> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTextStyleTextModel>(model, 714, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTextStyleTextModel and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTextStyleTextModel Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTextStyleTextModel"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTextStyleTextModel if the actual type of SdaiInstance is IfcTextStyleTextModel or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTextStyleTextModel CreateExactEntity(SdaiInstance instance) { return IfcTextStyleTextModel(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTextStyleTextModel or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTextStyleTextModel(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcSizeSelect_get get_TextIndent() { return IfcSizeSelect_get(m_instance, 1571); }
+        IfcSizeSelect_put put_TextIndent() { return IfcSizeSelect_put(m_instance, 1571); }
+
+        IfcTextAlignment get_TextAlign() { RDF_EXPRESS_PROBE(1572); IfcTextAlignment val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1572), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_TextAlign_view() { return TextView(get_TextAlign()); }
+#endif
+        void put_TextAlign(IfcTextAlignment value) { RDF_EXPRESS_PROBE(1572); sdaiPutAttr(m_instance, getAttrDefinition(1572), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_TextAlign_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1572); return buffer.GetAttr(m_instance, "TextAlign"); }
+        const char* get_TextAlign_utf8() { return get_TextAlign_utf8(ThreadUtf8Buffer()); }
+
+        IfcTextDecoration get_TextDecoration() { RDF_EXPRESS_PROBE(1573); IfcTextDecoration val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1573), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_TextDecoration_view() { return TextView(get_TextDecoration()); }
+#endif
+        void put_TextDecoration(IfcTextDecoration value) { RDF_EXPRESS_PROBE(1573); sdaiPutAttr(m_instance, getAttrDefinition(1573), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_TextDecoration_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1573); return buffer.GetAttr(m_instance, "TextDecoration"); }
+        const char* get_TextDecoration_utf8() { return get_TextDecoration_utf8(ThreadUtf8Buffer()); }
+
+        IfcSizeSelect_get get_LetterSpacing() { return IfcSizeSelect_get(m_instance, 1574); }
+        IfcSizeSelect_put put_LetterSpacing() { return IfcSizeSelect_put(m_instance, 1574); }
+
+        IfcSizeSelect_get get_WordSpacing() { return IfcSizeSelect_get(m_instance, 1575); }
+        IfcSizeSelect_put put_WordSpacing() { return IfcSizeSelect_put(m_instance, 1575); }
+
+        IfcTextTransformation get_TextTransform() { RDF_EXPRESS_PROBE(1576); IfcTextTransformation val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1576), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_TextTransform_view() { return TextView(get_TextTransform()); }
+#endif
+        void put_TextTransform(IfcTextTransformation value) { RDF_EXPRESS_PROBE(1576); sdaiPutAttr(m_instance, getAttrDefinition(1576), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_TextTransform_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1576); return buffer.GetAttr(m_instance, "TextTransform"); }
+        const char* get_TextTransform_utf8() { return get_TextTransform_utf8(ThreadUtf8Buffer()); }
+
+        IfcSizeSelect_get get_LineHeight() { return IfcSizeSelect_get(m_instance, 1577); }
+        IfcSizeSelect_put put_LineHeight() { return IfcSizeSelect_put(m_instance, 1577); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue TextIndent = 1571;
+            static constexpr IntValue TextAlign = 1572;
+            static constexpr IntValue TextDecoration = 1573;
+            static constexpr IntValue LetterSpacing = 1574;
+            static constexpr IntValue WordSpacing = 1575;
+            static constexpr IntValue TextTransform = 1576;
+            static constexpr IntValue LineHeight = 1577;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextStyleTextModel_CLASS_H
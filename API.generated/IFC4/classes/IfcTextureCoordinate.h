@@ -0,0 +1,66 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextureCoordinate_CLASS_H
+#define __RDF_LTD__IFC4_IfcTextureCoordinate_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTextureCoordinate
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTextureCoordinate : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTextureCoordinate
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTextureCoordinate(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 715);
+        }
+
+        /// <summary>
+        /// Instances of IfcTextureCoordinate in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTextureCoordinate> Extent(SdaiModel model) { return ExtentRange<IfcTextureCoordinate>(model, 715, false); }
+        static ExtentRange<IfcTextureCoordinate> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTextureCoordinate>(model, 715, true); }
+
+        /// <summary>
+        /// Returns object of IfcTextureCoordinate if the actual type of SdaiInstance is IfcTextureCoordinate or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTextureCoordinate CreateExactEntity(SdaiInstance instance) { return IfcTextureCoordinate(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTextureCoordinate or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTextureCoordinate(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcSurfaceTexture or list of convertible elements
+        template <typename TList> void get_Maps(TList& lst) { RDF_EXPRESS_PROBE(724); ListOfIfcSurfaceTextureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(724)); }
+
+        //TList may be ListOfIfcSurfaceTexture or list of convertible elements
+        template <typename TList> void put_Maps(TList& lst) { RDF_EXPRESS_PROBE(724); ListOfIfcSurfaceTextureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(724)); }
+
+        //TArrayElem[] may be IfcSurfaceTexture[] or array of convertible elements
+        template <typename TArrayElem> void put_Maps(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(724); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcSurfaceTextureSerializer<ListOfIfcSurfaceTexture> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(724)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue Maps = 724;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextureCoordinate_CLASS_H
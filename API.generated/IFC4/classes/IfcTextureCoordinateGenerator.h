@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextureCoordinateGenerator_CLASS_H
+#define __RDF_LTD__IFC4_IfcTextureCoordinateGenerator_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTextureCoordinate.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTextureCoordinateGenerator
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTextureCoordinateGenerator : public RDF_EXPRESS_VIRTUAL IfcTextureCoordinate
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTextureCoordinateGenerator
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTextureCoordinateGenerator(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 716);
+        }
+
+        /// <summary>
+        /// Instances of IfcTextureCoordinateGenerator in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTextureCoordinateGenerator> Extent(SdaiModel model) { return ExtentRange<IfcTextureCoordinateGenerator>(model, 716, false); }
+        static ExtentRange<IfcTextureCoordinateGenerator> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTextureCoordinateGenerator>(model, 716, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTextureCoordinateGenerator and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTextureCoordinateGenerator Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTextureCoordinateGenerator"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTextureCoordinateGenerator if the actual type of SdaiInstance is IfcTextureCoordinateGenerator or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTextureCoordinateGenerator CreateExactEntity(SdaiInstance instance) { return IfcTextureCoordinateGenerator(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTextureCoordinateGenerator or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTextureCoordinateGenerator(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Mode() { RDF_EXPRESS_PROBE(1578); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1578), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Mode_view() { return TextView(get_Mode()); }
+#endif
+        void put_Mode(IfcLabel value) { RDF_EXPRESS_PROBE(1578); sdaiPutAttr(m_instance, getAttrDefinition(1578), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Mode_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1578); return buffer.GetAttr(m_instance, "Mode"); }
+        const char* get_Mode_utf8() { return get_Mode_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be ListOfIfcReal or list of convertible elements
+        template <typename TList> void get_Parameter(TList& lst) { RDF_EXPRESS_PROBE(1579); ListOfIfcRealSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1579)); }
+
+        //TList may be ListOfIfcReal or list of convertible elements
+        template <typename TList> void put_Parameter(TList& lst) { RDF_EXPRESS_PROBE(1579); ListOfIfcRealSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1579)); }
+
+        //TArrayElem[] may be IfcReal[] or array of convertible elements
+        template <typename TArrayElem> void put_Parameter(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1579); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcRealSerializer<ListOfIfcReal> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1579)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTextureCoordinate::attr
+        {
+            static constexpr IntValue Mode = 1578;
+            static constexpr IntValue Parameter = 1579;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextureCoordinateGenerator_CLASS_H
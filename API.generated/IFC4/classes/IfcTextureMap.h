@@ -0,0 +1,74 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextureMap_CLASS_H
+#define __RDF_LTD__IFC4_IfcTextureMap_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTextureCoordinate.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTextureMap
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTextureMap : public RDF_EXPRESS_VIRTUAL IfcTextureCoordinate
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTextureMap
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTextureMap(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 717);
+        }
+
+        /// <summary>
+        /// Instances of IfcTextureMap in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTextureMap> Extent(SdaiModel model) { return ExtentRange<IfcTextureMap>(model, 717, false); }
+        static ExtentRange<IfcTextureMap> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTextureMap>(model, 717, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTextureMap and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTextureMap Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTextureMap"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTextureMap if the actual type of SdaiInstance is IfcTextureMap or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTextureMap CreateExactEntity(SdaiInstance instance) { return IfcTextureMap(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTextureMap or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTextureMap(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcTextureVertex or list of convertible elements
+        template <typename TList> void get_Vertices(TList& lst) { RDF_EXPRESS_PROBE(1580); ListOfIfcTextureVertexSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1580)); }
+
+        //TList may be ListOfIfcTextureVertex or list of convertible elements
+        template <typename TList> void put_Vertices(TList& lst) { RDF_EXPRESS_PROBE(1580); ListOfIfcTextureVertexSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1580)); }
+
+        //TArrayElem[] may be IfcTextureVertex[] or array of convertible elements
+        template <typename TArrayElem> void put_Vertices(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1580); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcTextureVertexSerializer<ListOfIfcTextureVertex> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1580)); }
+
+        IfcFace get_MappedTo();
+        void put_MappedTo(IfcFace inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTextureCoordinate::attr
+        {
+            static constexpr IntValue Vertices = 1580;
+            static constexpr IntValue MappedTo = 1581;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextureMap_CLASS_H
@@ -0,0 +1,70 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextureVertex_CLASS_H
+#define __RDF_LTD__IFC4_IfcTextureVertex_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTextureVertex
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTextureVertex : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTextureVertex
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTextureVertex(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 718);
+        }
+
+        /// <summary>
+        /// Instances of IfcTextureVertex in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTextureVertex> Extent(SdaiModel model) { return ExtentRange<IfcTextureVertex>(model, 718, false); }
+        static ExtentRange<IfcTextureVertex> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTextureVertex>(model, 718, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTextureVertex and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTextureVertex Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTextureVertex"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTextureVertex if the actual type of SdaiInstance is IfcTextureVertex or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTextureVertex CreateExactEntity(SdaiInstance instance) { return IfcTextureVertex(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTextureVertex or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTextureVertex(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcParameterValue or list of convertible elements
+        template <typename TList> void get_Coordinates(TList& lst) { RDF_EXPRESS_PROBE(1582); ListOfIfcParameterValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1582)); }
+
+        //TList may be ListOfIfcParameterValue or list of convertible elements
+        template <typename TList> void put_Coordinates(TList& lst) { RDF_EXPRESS_PROBE(1582); ListOfIfcParameterValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1582)); }
+
+        //TArrayElem[] may be IfcParameterValue[] or array of convertible elements
+        template <typename TArrayElem> void put_Coordinates(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1582); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcParameterValueSerializer<ListOfIfcParameterValue> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1582)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue Coordinates = 1582;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextureVertex_CLASS_H
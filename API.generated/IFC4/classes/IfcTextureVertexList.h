@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextureVertexList_CLASS_H
+#define __RDF_LTD__IFC4_IfcTextureVertexList_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTextureVertexList
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTextureVertexList : public RDF_EXPRESS_VIRTUAL IfcPresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTextureVertexList
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTextureVertexList(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 719);
+        }
+
+        /// <summary>
+        /// Instances of IfcTextureVertexList in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTextureVertexList> Extent(SdaiModel model) { return ExtentRange<IfcTextureVertexList>(model, 719, false); }
+        static ExtentRange<IfcTextureVertexList> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTextureVertexList>(model, 719, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTextureVertexList and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTextureVertexList Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTextureVertexList"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTextureVertexList if the actual type of SdaiInstance is IfcTextureVertexList or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTextureVertexList CreateExactEntity(SdaiInstance instance) { return IfcTextureVertexList(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTextureVertexList or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTextureVertexList(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfListOfIfcParameterValue or list of convertible elements
+        template <typename TList> void get_TexCoordsList(TList& lst) { RDF_EXPRESS_PROBE(1583); ListOfListOfIfcParameterValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1583)); }
+
+        //TList may be ListOfListOfIfcParameterValue or list of convertible elements
+        template <typename TList> void put_TexCoordsList(TList& lst) { RDF_EXPRESS_PROBE(1583); ListOfListOfIfcParameterValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1583)); }
+
+        //reads inner aggregations into flat buffer, stride elements each (e.g. xyz of points), returns number of inner aggregations
+        template <typename TElem> IntValue get_TexCoordsList(TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(1583); return FlatAggrFromAttr<TElem, IfcParameterValue, sdaiREAL>(m_instance, getAttrDefinition(1583), buffer, size, stride); }
+        template <typename TElem> IntValue get_TexCoordsList(std::vector<TElem>& flat, size_t stride) { RDF_EXPRESS_PROBE(1583); return FlatAggrFromAttr<TElem, IfcParameterValue, sdaiREAL>(m_instance, getAttrDefinition(1583), flat, stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> IntValue get_TexCoordsList(std::span<TElem> buffer, size_t stride) { return get_TexCoordsList(buffer.data(), buffer.size(), stride); }
+#endif
+
+        //writes flat buffer as inner aggregations of stride elements each (e.g. xyz of points), no intermediate lists
+        template <typename TElem> void put_TexCoordsList(const TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(1583); FlatAggrToAttr<TElem, IfcParameterValue, sdaiREAL>(m_instance, getAttrDefinition(1583), buffer, size, stride); }
+        template <typename TElem> void put_TexCoordsList(const std::vector<TElem>& flat, size_t stride) { put_TexCoordsList(flat.data(), flat.size(), stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> void put_TexCoordsList(std::span<const TElem> buffer, size_t stride) { put_TexCoordsList(buffer.data(), buffer.size(), stride); }
+#endif
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPresentationItem::attr
+        {
+            static constexpr IntValue TexCoordsList = 1583;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextureVertexList_CLASS_H
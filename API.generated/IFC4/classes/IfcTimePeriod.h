@@ -0,0 +1,81 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTimePeriod_CLASS_H
+#define __RDF_LTD__IFC4_IfcTimePeriod_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTimePeriod
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTimePeriod : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTimePeriod
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTimePeriod(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 720);
+        }
+
+        /// <summary>
+        /// Instances of IfcTimePeriod in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTimePeriod> Extent(SdaiModel model) { return ExtentRange<IfcTimePeriod>(model, 720, false); }
+        static ExtentRange<IfcTimePeriod> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTimePeriod>(model, 720, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTimePeriod and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTimePeriod Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTimePeriod"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTimePeriod if the actual type of SdaiInstance is IfcTimePeriod or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTimePeriod CreateExactEntity(SdaiInstance instance) { return IfcTimePeriod(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTimePeriod or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTimePeriod(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcTime get_StartTime() { RDF_EXPRESS_PROBE(1584); IfcTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1584), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_StartTime_view() { return TextView(get_StartTime()); }
+#endif
+        void put_StartTime(IfcTime value) { RDF_EXPRESS_PROBE(1584); sdaiPutAttr(m_instance, getAttrDefinition(1584), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_StartTime_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1584); return buffer.GetAttr(m_instance, "StartTime"); }
+        const char* get_StartTime_utf8() { return get_StartTime_utf8(ThreadUtf8Buffer()); }
+
+        IfcTime get_EndTime() { RDF_EXPRESS_PROBE(1585); IfcTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1585), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_EndTime_view() { return TextView(get_EndTime()); }
+#endif
+        void put_EndTime(IfcTime value) { RDF_EXPRESS_PROBE(1585); sdaiPutAttr(m_instance, getAttrDefinition(1585), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_EndTime_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1585); return buffer.GetAttr(m_instance, "EndTime"); }
+        const char* get_EndTime_utf8() { return get_EndTime_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue StartTime = 1584;
+            static constexpr IntValue EndTime = 1585;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTimePeriod_CLASS_H
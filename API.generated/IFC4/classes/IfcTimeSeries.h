@@ -0,0 +1,126 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTimeSeries_CLASS_H
+#define __RDF_LTD__IFC4_IfcTimeSeries_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTimeSeries
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTimeSeries : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTimeSeries
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTimeSeries(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 721);
+        }
+
+        /// <summary>
+        /// Instances of IfcTimeSeries in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTimeSeries> Extent(SdaiModel model) { return ExtentRange<IfcTimeSeries>(model, 721, false); }
+        static ExtentRange<IfcTimeSeries> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTimeSeries>(model, 721, true); }
+
+        /// <summary>
+        /// Returns object of IfcTimeSeries if the actual type of SdaiInstance is IfcTimeSeries or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTimeSeries CreateExactEntity(SdaiInstance instance) { return IfcTimeSeries(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTimeSeries or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTimeSeries(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_Name() { RDF_EXPRESS_PROBE(740); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(740), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Name_view() { return TextView(get_Name()); }
+#endif
+        void put_Name(IfcLabel value) { RDF_EXPRESS_PROBE(740); sdaiPutAttr(m_instance, getAttrDefinition(740), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Name_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(740); return buffer.GetAttr(m_instance, "Name"); }
+        const char* get_Name_utf8() { return get_Name_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_Description() { RDF_EXPRESS_PROBE(741); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(741), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Description_view() { return TextView(get_Description()); }
+#endif
+        void put_Description(IfcText value) { RDF_EXPRESS_PROBE(741); sdaiPutAttr(m_instance, getAttrDefinition(741), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Description_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(741); return buffer.GetAttr(m_instance, "Description"); }
+        const char* get_Description_utf8() { return get_Description_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_StartTime() { RDF_EXPRESS_PROBE(742); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(742), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_StartTime_view() { return TextView(get_StartTime()); }
+#endif
+        void put_StartTime(IfcDateTime value) { RDF_EXPRESS_PROBE(742); sdaiPutAttr(m_instance, getAttrDefinition(742), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_StartTime_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(742); return buffer.GetAttr(m_instance, "StartTime"); }
+        const char* get_StartTime_utf8() { return get_StartTime_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_EndTime() { RDF_EXPRESS_PROBE(743); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(743), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_EndTime_view() { return TextView(get_EndTime()); }
+#endif
+        void put_EndTime(IfcDateTime value) { RDF_EXPRESS_PROBE(743); sdaiPutAttr(m_instance, getAttrDefinition(743), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_EndTime_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(743); return buffer.GetAttr(m_instance, "EndTime"); }
+        const char* get_EndTime_utf8() { return get_EndTime_utf8(ThreadUtf8Buffer()); }
+
+        Nullable<IfcTimeSeriesDataTypeEnum> get_TimeSeriesDataType() { RDF_EXPRESS_PROBE(744); int v = getENUM(744, IfcTimeSeriesDataTypeEnum_hash); if (v >= 0) return (IfcTimeSeriesDataTypeEnum) v; else return Nullable<IfcTimeSeriesDataTypeEnum>(); }
+        void put_TimeSeriesDataType(IfcTimeSeriesDataTypeEnum value) { RDF_EXPRESS_PROBE(744); TextValue val = IfcTimeSeriesDataTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(744), sdaiENUM, val); }
+
+        Nullable<IfcDataOriginEnum> get_DataOrigin() { RDF_EXPRESS_PROBE(745); int v = getENUM(745, IfcDataOriginEnum_hash); if (v >= 0) return (IfcDataOriginEnum) v; else return Nullable<IfcDataOriginEnum>(); }
+        void put_DataOrigin(IfcDataOriginEnum value) { RDF_EXPRESS_PROBE(745); TextValue val = IfcDataOriginEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(745), sdaiENUM, val); }
+
+        IfcLabel get_UserDefinedDataOrigin() { RDF_EXPRESS_PROBE(746); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(746), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedDataOrigin_view() { return TextView(get_UserDefinedDataOrigin()); }
+#endif
+        void put_UserDefinedDataOrigin(IfcLabel value) { RDF_EXPRESS_PROBE(746); sdaiPutAttr(m_instance, getAttrDefinition(746), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedDataOrigin_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(746); return buffer.GetAttr(m_instance, "UserDefinedDataOrigin"); }
+        const char* get_UserDefinedDataOrigin_utf8() { return get_UserDefinedDataOrigin_utf8(ThreadUtf8Buffer()); }
+
+        IfcUnit_get get_Unit() { return IfcUnit_get(m_instance, 747); }
+        IfcUnit_put put_Unit() { return IfcUnit_put(m_instance, 747); }
+
+        //TList may be SetOfIfcExternalReferenceRelationship or list of convertible elements
+        template <typename TList> void get_HasExternalReference(TList& lst) { RDF_EXPRESS_PROBE(748); SetOfIfcExternalReferenceRelationshipSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(748)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Name = 740;
+            static constexpr IntValue Description = 741;
+            static constexpr IntValue StartTime = 742;
+            static constexpr IntValue EndTime = 743;
+            static constexpr IntValue TimeSeriesDataType = 744;
+            static constexpr IntValue DataOrigin = 745;
+            static constexpr IntValue UserDefinedDataOrigin = 746;
+            static constexpr IntValue Unit = 747;
+            static constexpr IntValue HasExternalReference = 748;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTimeSeries_CLASS_H
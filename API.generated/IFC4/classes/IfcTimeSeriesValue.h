@@ -0,0 +1,66 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTimeSeriesValue_CLASS_H
+#define __RDF_LTD__IFC4_IfcTimeSeriesValue_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTimeSeriesValue
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTimeSeriesValue : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTimeSeriesValue
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTimeSeriesValue(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 722);
+        }
+
+        /// <summary>
+        /// Instances of IfcTimeSeriesValue in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTimeSeriesValue> Extent(SdaiModel model) { return ExtentRange<IfcTimeSeriesValue>(model, 722, false); }
+        static ExtentRange<IfcTimeSeriesValue> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTimeSeriesValue>(model, 722, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTimeSeriesValue and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTimeSeriesValue Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTimeSeriesValue"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTimeSeriesValue if the actual type of SdaiInstance is IfcTimeSeriesValue or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTimeSeriesValue CreateExactEntity(SdaiInstance instance) { return IfcTimeSeriesValue(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTimeSeriesValue or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTimeSeriesValue(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void get_ListValues(TList& lst) { RDF_EXPRESS_PROBE(1586); ListOfIfcValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1586)); }
+
+        //TList may be ListOfIfcValue or list of convertible elements
+        template <typename TList> void put_ListValues(TList& lst) { RDF_EXPRESS_PROBE(1586); ListOfIfcValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1586)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue ListValues = 1586;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTimeSeriesValue_CLASS_H
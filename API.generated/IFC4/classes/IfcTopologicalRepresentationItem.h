@@ -0,0 +1,56 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTopologicalRepresentationItem_CLASS_H
+#define __RDF_LTD__IFC4_IfcTopologicalRepresentationItem_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTopologicalRepresentationItem
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTopologicalRepresentationItem : public RDF_EXPRESS_VIRTUAL IfcRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTopologicalRepresentationItem
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTopologicalRepresentationItem(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 723);
+        }
+
+        /// <summary>
+        /// Instances of IfcTopologicalRepresentationItem in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTopologicalRepresentationItem> Extent(SdaiModel model) { return ExtentRange<IfcTopologicalRepresentationItem>(model, 723, false); }
+        static ExtentRange<IfcTopologicalRepresentationItem> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTopologicalRepresentationItem>(model, 723, true); }
+
+        /// <summary>
+        /// Returns object of IfcTopologicalRepresentationItem if the actual type of SdaiInstance is IfcTopologicalRepresentationItem or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTopologicalRepresentationItem CreateExactEntity(SdaiInstance instance) { return IfcTopologicalRepresentationItem(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTopologicalRepresentationItem or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTopologicalRepresentationItem(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcRepresentationItem::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTopologicalRepresentationItem_CLASS_H
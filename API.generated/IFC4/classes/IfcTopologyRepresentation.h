@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTopologyRepresentation_CLASS_H
+#define __RDF_LTD__IFC4_IfcTopologyRepresentation_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcShapeModel.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTopologyRepresentation
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTopologyRepresentation : public RDF_EXPRESS_VIRTUAL IfcShapeModel
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTopologyRepresentation
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTopologyRepresentation(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 724);
+        }
+
+        /// <summary>
+        /// Instances of IfcTopologyRepresentation in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTopologyRepresentation> Extent(SdaiModel model) { return ExtentRange<IfcTopologyRepresentation>(model, 724, false); }
+        static ExtentRange<IfcTopologyRepresentation> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTopologyRepresentation>(model, 724, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTopologyRepresentation and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTopologyRepresentation Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTopologyRepresentation"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTopologyRepresentation if the actual type of SdaiInstance is IfcTopologyRepresentation or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTopologyRepresentation CreateExactEntity(SdaiInstance instance) { return IfcTopologyRepresentation(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTopologyRepresentation or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTopologyRepresentation(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcShapeModel::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTopologyRepresentation_CLASS_H
@@ -0,0 +1,68 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcToroidalSurface_CLASS_H
+#define __RDF_LTD__IFC4_IfcToroidalSurface_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementarySurface.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcToroidalSurface
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcToroidalSurface : public RDF_EXPRESS_VIRTUAL IfcElementarySurface
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcToroidalSurface
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcToroidalSurface(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 725);
+        }
+
+        /// <summary>
+        /// Instances of IfcToroidalSurface in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcToroidalSurface> Extent(SdaiModel model) { return ExtentRange<IfcToroidalSurface>(model, 725, false); }
+        static ExtentRange<IfcToroidalSurface> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcToroidalSurface>(model, 725, true); }
+
+        /// <summary>
+        /// Create new instance of IfcToroidalSurface and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcToroidalSurface Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcToroidalSurface"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcToroidalSurface if the actual type of SdaiInstance is IfcToroidalSurface or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcToroidalSurface CreateExactEntity(SdaiInstance instance) { return IfcToroidalSurface(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcToroidalSurface or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcToroidalSurface(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_MajorRadius() { RDF_EXPRESS_PROBE(1587); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1587), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_MajorRadius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1587); sdaiPutAttr(m_instance, getAttrDefinition(1587), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_MinorRadius() { RDF_EXPRESS_PROBE(1588); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1588), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_MinorRadius(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1588); sdaiPutAttr(m_instance, getAttrDefinition(1588), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementarySurface::attr
+        {
+            static constexpr IntValue MajorRadius = 1587;
+            static constexpr IntValue MinorRadius = 1588;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcToroidalSurface_CLASS_H
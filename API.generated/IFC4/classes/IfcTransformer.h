@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTransformer_CLASS_H
+#define __RDF_LTD__IFC4_IfcTransformer_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTransformer
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTransformer : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTransformer
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTransformer(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 726);
+        }
+
+        /// <summary>
+        /// Instances of IfcTransformer in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTransformer> Extent(SdaiModel model) { return ExtentRange<IfcTransformer>(model, 726, false); }
+        static ExtentRange<IfcTransformer> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTransformer>(model, 726, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTransformer and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTransformer Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTransformer"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTransformer if the actual type of SdaiInstance is IfcTransformer or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTransformer CreateExactEntity(SdaiInstance instance) { return IfcTransformer(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTransformer or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTransformer(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTransformerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1589); int v = getENUM(1589, IfcTransformerTypeEnum_hash); if (v >= 0) return (IfcTransformerTypeEnum) v; else return Nullable<IfcTransformerTypeEnum>(); }
+        void put_PredefinedType(IfcTransformerTypeEnum value) { RDF_EXPRESS_PROBE(1589); TextValue val = IfcTransformerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1589), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 1589;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTransformer_CLASS_H
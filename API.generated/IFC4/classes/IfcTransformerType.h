@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTransformerType_CLASS_H
+#define __RDF_LTD__IFC4_IfcTransformerType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTransformerType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTransformerType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTransformerType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTransformerType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 727);
+        }
+
+        /// <summary>
+        /// Instances of IfcTransformerType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTransformerType> Extent(SdaiModel model) { return ExtentRange<IfcTransformerType>(model, 727, false); }
+        static ExtentRange<IfcTransformerType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTransformerType>(model, 727, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTransformerType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTransformerType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTransformerType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTransformerType if the actual type of SdaiInstance is IfcTransformerType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTransformerType CreateExactEntity(SdaiInstance instance) { return IfcTransformerType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTransformerType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTransformerType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTransformerTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1590); int v = getENUM(1590, IfcTransformerTypeEnum_hash); if (v >= 0) return (IfcTransformerTypeEnum) v; else return Nullable<IfcTransformerTypeEnum>(); }
+        void put_PredefinedType(IfcTransformerTypeEnum value) { RDF_EXPRESS_PROBE(1590); TextValue val = IfcTransformerTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1590), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 1590;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTransformerType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTransportElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcTransportElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTransportElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTransportElement : public RDF_EXPRESS_VIRTUAL IfcElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTransportElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTransportElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 728);
+        }
+
+        /// <summary>
+        /// Instances of IfcTransportElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTransportElement> Extent(SdaiModel model) { return ExtentRange<IfcTransportElement>(model, 728, false); }
+        static ExtentRange<IfcTransportElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTransportElement>(model, 728, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTransportElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTransportElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTransportElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTransportElement if the actual type of SdaiInstance is IfcTransportElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTransportElement CreateExactEntity(SdaiInstance instance) { return IfcTransportElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTransportElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTransportElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTransportElementTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1591); int v = getENUM(1591, IfcTransportElementTypeEnum_hash); if (v >= 0) return (IfcTransportElementTypeEnum) v; else return Nullable<IfcTransportElementTypeEnum>(); }
+        void put_PredefinedType(IfcTransportElementTypeEnum value) { RDF_EXPRESS_PROBE(1591); TextValue val = IfcTransportElementTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1591), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1591;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTransportElement_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTransportElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcTransportElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTransportElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTransportElementType : public RDF_EXPRESS_VIRTUAL IfcElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTransportElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTransportElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 729);
+        }
+
+        /// <summary>
+        /// Instances of IfcTransportElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTransportElementType> Extent(SdaiModel model) { return ExtentRange<IfcTransportElementType>(model, 729, false); }
+        static ExtentRange<IfcTransportElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTransportElementType>(model, 729, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTransportElementType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTransportElementType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTransportElementType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTransportElementType if the actual type of SdaiInstance is IfcTransportElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTransportElementType CreateExactEntity(SdaiInstance instance) { return IfcTransportElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTransportElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTransportElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTransportElementTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1592); int v = getENUM(1592, IfcTransportElementTypeEnum_hash); if (v >= 0) return (IfcTransportElementTypeEnum) v; else return Nullable<IfcTransportElementTypeEnum>(); }
+        void put_PredefinedType(IfcTransportElementTypeEnum value) { RDF_EXPRESS_PROBE(1592); TextValue val = IfcTransportElementTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1592), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1592;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTransportElementType_CLASS_H
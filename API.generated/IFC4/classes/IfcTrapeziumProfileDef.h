@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTrapeziumProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcTrapeziumProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTrapeziumProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTrapeziumProfileDef : public RDF_EXPRESS_VIRTUAL IfcParameterizedProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTrapeziumProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTrapeziumProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 730);
+        }
+
+        /// <summary>
+        /// Instances of IfcTrapeziumProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTrapeziumProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcTrapeziumProfileDef>(model, 730, false); }
+        static ExtentRange<IfcTrapeziumProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTrapeziumProfileDef>(model, 730, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTrapeziumProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTrapeziumProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTrapeziumProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTrapeziumProfileDef if the actual type of SdaiInstance is IfcTrapeziumProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTrapeziumProfileDef CreateExactEntity(SdaiInstance instance) { return IfcTrapeziumProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTrapeziumProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTrapeziumProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_BottomXDim() { RDF_EXPRESS_PROBE(1593); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1593), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_BottomXDim(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1593); sdaiPutAttr(m_instance, getAttrDefinition(1593), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_TopXDim() { RDF_EXPRESS_PROBE(1594); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1594), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_TopXDim(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1594); sdaiPutAttr(m_instance, getAttrDefinition(1594), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_YDim() { RDF_EXPRESS_PROBE(1595); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1595), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_YDim(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1595); sdaiPutAttr(m_instance, getAttrDefinition(1595), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_TopXOffset() { RDF_EXPRESS_PROBE(1596); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1596), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_TopXOffset(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1596); sdaiPutAttr(m_instance, getAttrDefinition(1596), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcParameterizedProfileDef::attr
+        {
+            static constexpr IntValue BottomXDim = 1593;
+            static constexpr IntValue TopXDim = 1594;
+            static constexpr IntValue YDim = 1595;
+            static constexpr IntValue TopXOffset = 1596;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTrapeziumProfileDef_CLASS_H
@@ -0,0 +1,119 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTriangulatedFaceSet_CLASS_H
+#define __RDF_LTD__IFC4_IfcTriangulatedFaceSet_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTessellatedFaceSet.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTriangulatedFaceSet
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTriangulatedFaceSet : public RDF_EXPRESS_VIRTUAL IfcTessellatedFaceSet
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTriangulatedFaceSet
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTriangulatedFaceSet(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 731);
+        }
+
+        /// <summary>
+        /// Instances of IfcTriangulatedFaceSet in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTriangulatedFaceSet> Extent(SdaiModel model) { return ExtentRange<IfcTriangulatedFaceSet>(model, 731, false); }
+        static ExtentRange<IfcTriangulatedFaceSet> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTriangulatedFaceSet>(model, 731, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTriangulatedFaceSet and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTriangulatedFaceSet Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTriangulatedFaceSet"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTriangulatedFaceSet if the actual type of SdaiInstance is IfcTriangulatedFaceSet or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTriangulatedFaceSet CreateExactEntity(SdaiInstance instance) { return IfcTriangulatedFaceSet(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTriangulatedFaceSet or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTriangulatedFaceSet(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfListOfIfcParameterValue or list of convertible elements
+        template <typename TList> void get_Normals(TList& lst) { RDF_EXPRESS_PROBE(1597); ListOfListOfIfcParameterValueSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1597)); }
+
+        //TList may be ListOfListOfIfcParameterValue or list of convertible elements
+        template <typename TList> void put_Normals(TList& lst) { RDF_EXPRESS_PROBE(1597); ListOfListOfIfcParameterValueSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1597)); }
+
+        //reads inner aggregations into flat buffer, stride elements each (e.g. xyz of points), returns number of inner aggregations
+        template <typename TElem> IntValue get_Normals(TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(1597); return FlatAggrFromAttr<TElem, IfcParameterValue, sdaiREAL>(m_instance, getAttrDefinition(1597), buffer, size, stride); }
+        template <typename TElem> IntValue get_Normals(std::vector<TElem>& flat, size_t stride) { RDF_EXPRESS_PROBE(1597); return FlatAggrFromAttr<TElem, IfcParameterValue, sdaiREAL>(m_instance, getAttrDefinition(1597), flat, stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> IntValue get_Normals(std::span<TElem> buffer, size_t stride) { return get_Normals(buffer.data(), buffer.size(), stride); }
+#endif
+
+        //writes flat buffer as inner aggregations of stride elements each (e.g. xyz of points), no intermediate lists
+        template <typename TElem> void put_Normals(const TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(1597); FlatAggrToAttr<TElem, IfcParameterValue, sdaiREAL>(m_instance, getAttrDefinition(1597), buffer, size, stride); }
+        template <typename TElem> void put_Normals(const std::vector<TElem>& flat, size_t stride) { put_Normals(flat.data(), flat.size(), stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> void put_Normals(std::span<const TElem> buffer, size_t stride) { put_Normals(buffer.data(), buffer.size(), stride); }
+#endif
+
+        Nullable<IfcBoolean> get_Closed() { RDF_EXPRESS_PROBE(1598); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1598), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_Closed(IfcBoolean value) { RDF_EXPRESS_PROBE(1598); sdaiPutAttr(m_instance, getAttrDefinition(1598), sdaiBOOLEAN, &value); }
+
+        //TList may be ListOfListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void get_CoordIndex(TList& lst) { RDF_EXPRESS_PROBE(1599); ListOfListOfIfcPositiveIntegerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1599)); }
+
+        //TList may be ListOfListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void put_CoordIndex(TList& lst) { RDF_EXPRESS_PROBE(1599); ListOfListOfIfcPositiveIntegerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1599)); }
+
+        //reads inner aggregations into flat buffer, stride elements each (e.g. xyz of points), returns number of inner aggregations
+        template <typename TElem> IntValue get_CoordIndex(TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(1599); return FlatAggrFromAttr<TElem, IfcPositiveInteger, sdaiINTEGER>(m_instance, getAttrDefinition(1599), buffer, size, stride); }
+        template <typename TElem> IntValue get_CoordIndex(std::vector<TElem>& flat, size_t stride) { RDF_EXPRESS_PROBE(1599); return FlatAggrFromAttr<TElem, IfcPositiveInteger, sdaiINTEGER>(m_instance, getAttrDefinition(1599), flat, stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> IntValue get_CoordIndex(std::span<TElem> buffer, size_t stride) { return get_CoordIndex(buffer.data(), buffer.size(), stride); }
+#endif
+
+        //writes flat buffer as inner aggregations of stride elements each (e.g. xyz of points), no intermediate lists
+        template <typename TElem> void put_CoordIndex(const TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(1599); FlatAggrToAttr<TElem, IfcPositiveInteger, sdaiINTEGER>(m_instance, getAttrDefinition(1599), buffer, size, stride); }
+        template <typename TElem> void put_CoordIndex(const std::vector<TElem>& flat, size_t stride) { put_CoordIndex(flat.data(), flat.size(), stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> void put_CoordIndex(std::span<const TElem> buffer, size_t stride) { put_CoordIndex(buffer.data(), buffer.size(), stride); }
+#endif
+
+        //TList may be ListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void get_PnIndex(TList& lst) { RDF_EXPRESS_PROBE(1600); ListOfIfcPositiveIntegerSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1600)); }
+
+        //TList may be ListOfIfcPositiveInteger or list of convertible elements
+        template <typename TList> void put_PnIndex(TList& lst) { RDF_EXPRESS_PROBE(1600); ListOfIfcPositiveIntegerSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1600)); }
+
+        //TArrayElem[] may be IfcPositiveInteger[] or array of convertible elements
+        template <typename TArrayElem> void put_PnIndex(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1600); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcPositiveIntegerSerializer<ListOfIfcPositiveInteger> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1600)); }
+
+        Nullable<IfcInteger> get_NumberOfTriangles() { RDF_EXPRESS_PROBE(1601); IfcInteger val = (IfcInteger) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1601), sdaiINTEGER, &val)) return val; else return Nullable<IfcInteger>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTessellatedFaceSet::attr
+        {
+            static constexpr IntValue Normals = 1597;
+            static constexpr IntValue Closed = 1598;
+            static constexpr IntValue CoordIndex = 1599;
+            static constexpr IntValue PnIndex = 1600;
+            static constexpr IntValue NumberOfTriangles = 1601;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTriangulatedFaceSet_CLASS_H
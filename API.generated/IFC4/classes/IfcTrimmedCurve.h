@@ -0,0 +1,86 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTrimmedCurve_CLASS_H
+#define __RDF_LTD__IFC4_IfcTrimmedCurve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBoundedCurve.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTrimmedCurve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTrimmedCurve : public RDF_EXPRESS_VIRTUAL IfcBoundedCurve
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTrimmedCurve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTrimmedCurve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 732);
+        }
+
+        /// <summary>
+        /// Instances of IfcTrimmedCurve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTrimmedCurve> Extent(SdaiModel model) { return ExtentRange<IfcTrimmedCurve>(model, 732, false); }
+        static ExtentRange<IfcTrimmedCurve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTrimmedCurve>(model, 732, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTrimmedCurve and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTrimmedCurve Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTrimmedCurve"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTrimmedCurve if the actual type of SdaiInstance is IfcTrimmedCurve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTrimmedCurve CreateExactEntity(SdaiInstance instance) { return IfcTrimmedCurve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTrimmedCurve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTrimmedCurve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcCurve get_BasisCurve();
+        void put_BasisCurve(IfcCurve inst);
+
+        //TList may be SetOfIfcTrimmingSelect or list of convertible elements
+        template <typename TList> void get_Trim1(TList& lst) { RDF_EXPRESS_PROBE(1603); SetOfIfcTrimmingSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1603)); }
+
+        //TList may be SetOfIfcTrimmingSelect or list of convertible elements
+        template <typename TList> void put_Trim1(TList& lst) { RDF_EXPRESS_PROBE(1603); SetOfIfcTrimmingSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1603)); }
+
+        //TList may be SetOfIfcTrimmingSelect or list of convertible elements
+        template <typename TList> void get_Trim2(TList& lst) { RDF_EXPRESS_PROBE(1604); SetOfIfcTrimmingSelectSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1604)); }
+
+        //TList may be SetOfIfcTrimmingSelect or list of convertible elements
+        template <typename TList> void put_Trim2(TList& lst) { RDF_EXPRESS_PROBE(1604); SetOfIfcTrimmingSelectSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1604)); }
+
+        Nullable<IfcBoolean> get_SenseAgreement() { RDF_EXPRESS_PROBE(1605); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1605), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_SenseAgreement(IfcBoolean value) { RDF_EXPRESS_PROBE(1605); sdaiPutAttr(m_instance, getAttrDefinition(1605), sdaiBOOLEAN, &value); }
+
+        Nullable<IfcTrimmingPreference> get_MasterRepresentation() { RDF_EXPRESS_PROBE(1606); int v = getENUM(1606, IfcTrimmingPreference_hash); if (v >= 0) return (IfcTrimmingPreference) v; else return Nullable<IfcTrimmingPreference>(); }
+        void put_MasterRepresentation(IfcTrimmingPreference value) { RDF_EXPRESS_PROBE(1606); TextValue val = IfcTrimmingPreference_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1606), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBoundedCurve::attr
+        {
+            static constexpr IntValue BasisCurve = 1602;
+            static constexpr IntValue Trim1 = 1603;
+            static constexpr IntValue Trim2 = 1604;
+            static constexpr IntValue SenseAgreement = 1605;
+            static constexpr IntValue MasterRepresentation = 1606;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTrimmedCurve_CLASS_H
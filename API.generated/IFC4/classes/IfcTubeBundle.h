@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTubeBundle_CLASS_H
+#define __RDF_LTD__IFC4_IfcTubeBundle_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTubeBundle
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTubeBundle : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTubeBundle
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTubeBundle(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 734);
+        }
+
+        /// <summary>
+        /// Instances of IfcTubeBundle in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTubeBundle> Extent(SdaiModel model) { return ExtentRange<IfcTubeBundle>(model, 734, false); }
+        static ExtentRange<IfcTubeBundle> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTubeBundle>(model, 734, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTubeBundle and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTubeBundle Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTubeBundle"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTubeBundle if the actual type of SdaiInstance is IfcTubeBundle or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTubeBundle CreateExactEntity(SdaiInstance instance) { return IfcTubeBundle(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTubeBundle or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTubeBundle(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTubeBundleTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1616); int v = getENUM(1616, IfcTubeBundleTypeEnum_hash); if (v >= 0) return (IfcTubeBundleTypeEnum) v; else return Nullable<IfcTubeBundleTypeEnum>(); }
+        void put_PredefinedType(IfcTubeBundleTypeEnum value) { RDF_EXPRESS_PROBE(1616); TextValue val = IfcTubeBundleTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1616), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 1616;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTubeBundle_CLASS_H
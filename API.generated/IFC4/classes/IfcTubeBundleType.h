@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTubeBundleType_CLASS_H
+#define __RDF_LTD__IFC4_IfcTubeBundleType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTubeBundleType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTubeBundleType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTubeBundleType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTubeBundleType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 735);
+        }
+
+        /// <summary>
+        /// Instances of IfcTubeBundleType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTubeBundleType> Extent(SdaiModel model) { return ExtentRange<IfcTubeBundleType>(model, 735, false); }
+        static ExtentRange<IfcTubeBundleType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTubeBundleType>(model, 735, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTubeBundleType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTubeBundleType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTubeBundleType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTubeBundleType if the actual type of SdaiInstance is IfcTubeBundleType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTubeBundleType CreateExactEntity(SdaiInstance instance) { return IfcTubeBundleType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTubeBundleType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTubeBundleType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcTubeBundleTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1617); int v = getENUM(1617, IfcTubeBundleTypeEnum_hash); if (v >= 0) return (IfcTubeBundleTypeEnum) v; else return Nullable<IfcTubeBundleTypeEnum>(); }
+        void put_PredefinedType(IfcTubeBundleTypeEnum value) { RDF_EXPRESS_PROBE(1617); TextValue val = IfcTubeBundleTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1617), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 1617;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTubeBundleType_CLASS_H
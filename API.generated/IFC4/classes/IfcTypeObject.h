@@ -0,0 +1,85 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTypeObject_CLASS_H
+#define __RDF_LTD__IFC4_IfcTypeObject_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcObjectDefinition.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTypeObject
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTypeObject : public RDF_EXPRESS_VIRTUAL IfcObjectDefinition
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTypeObject
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTypeObject(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 736);
+        }
+
+        /// <summary>
+        /// Instances of IfcTypeObject in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTypeObject> Extent(SdaiModel model) { return ExtentRange<IfcTypeObject>(model, 736, false); }
+        static ExtentRange<IfcTypeObject> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTypeObject>(model, 736, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTypeObject and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTypeObject Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTypeObject"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTypeObject if the actual type of SdaiInstance is IfcTypeObject or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTypeObject CreateExactEntity(SdaiInstance instance) { return IfcTypeObject(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTypeObject or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTypeObject(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_ApplicableOccurrence() { RDF_EXPRESS_PROBE(46); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(46), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ApplicableOccurrence_view() { return TextView(get_ApplicableOccurrence()); }
+#endif
+        void put_ApplicableOccurrence(IfcIdentifier value) { RDF_EXPRESS_PROBE(46); sdaiPutAttr(m_instance, getAttrDefinition(46), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ApplicableOccurrence_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(46); return buffer.GetAttr(m_instance, "ApplicableOccurrence"); }
+        const char* get_ApplicableOccurrence_utf8() { return get_ApplicableOccurrence_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcPropertySetDefinition or list of convertible elements
+        template <typename TList> void get_HasPropertySets(TList& lst) { RDF_EXPRESS_PROBE(47); SetOfIfcPropertySetDefinitionSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(47)); }
+
+        //TList may be SetOfIfcPropertySetDefinition or list of convertible elements
+        template <typename TList> void put_HasPropertySets(TList& lst) { RDF_EXPRESS_PROBE(47); SetOfIfcPropertySetDefinitionSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(47)); }
+
+        //TArrayElem[] may be IfcPropertySetDefinition[] or array of convertible elements
+        template <typename TArrayElem> void put_HasPropertySets(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(47); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcPropertySetDefinitionSerializer<SetOfIfcPropertySetDefinition> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(47)); }
+
+        //TList may be SetOfIfcRelDefinesByType or list of convertible elements
+        template <typename TList> void get_Types(TList& lst) { RDF_EXPRESS_PROBE(48); SetOfIfcRelDefinesByTypeSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(48)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcObjectDefinition::attr
+        {
+            static constexpr IntValue ApplicableOccurrence = 46;
+            static constexpr IntValue HasPropertySets = 47;
+            static constexpr IntValue Types = 48;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTypeObject_CLASS_H
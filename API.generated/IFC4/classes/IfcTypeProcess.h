@@ -0,0 +1,93 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTypeProcess_CLASS_H
+#define __RDF_LTD__IFC4_IfcTypeProcess_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTypeObject.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTypeProcess
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTypeProcess : public RDF_EXPRESS_VIRTUAL IfcTypeObject
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTypeProcess
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTypeProcess(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 737);
+        }
+
+        /// <summary>
+        /// Instances of IfcTypeProcess in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTypeProcess> Extent(SdaiModel model) { return ExtentRange<IfcTypeProcess>(model, 737, false); }
+        static ExtentRange<IfcTypeProcess> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTypeProcess>(model, 737, true); }
+
+        /// <summary>
+        /// Returns object of IfcTypeProcess if the actual type of SdaiInstance is IfcTypeProcess or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTypeProcess CreateExactEntity(SdaiInstance instance) { return IfcTypeProcess(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTypeProcess or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTypeProcess(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Identification() { RDF_EXPRESS_PROBE(612); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(612), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Identification_view() { return TextView(get_Identification()); }
+#endif
+        void put_Identification(IfcIdentifier value) { RDF_EXPRESS_PROBE(612); sdaiPutAttr(m_instance, getAttrDefinition(612), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Identification_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(612); return buffer.GetAttr(m_instance, "Identification"); }
+        const char* get_Identification_utf8() { return get_Identification_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_LongDescription() { RDF_EXPRESS_PROBE(613); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(613), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LongDescription_view() { return TextView(get_LongDescription()); }
+#endif
+        void put_LongDescription(IfcText value) { RDF_EXPRESS_PROBE(613); sdaiPutAttr(m_instance, getAttrDefinition(613), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LongDescription_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(613); return buffer.GetAttr(m_instance, "LongDescription"); }
+        const char* get_LongDescription_utf8() { return get_LongDescription_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_ProcessType() { RDF_EXPRESS_PROBE(614); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(614), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ProcessType_view() { return TextView(get_ProcessType()); }
+#endif
+        void put_ProcessType(IfcLabel value) { RDF_EXPRESS_PROBE(614); sdaiPutAttr(m_instance, getAttrDefinition(614), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ProcessType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(614); return buffer.GetAttr(m_instance, "ProcessType"); }
+        const char* get_ProcessType_utf8() { return get_ProcessType_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRelAssignsToProcess or list of convertible elements
+        template <typename TList> void get_OperatesOn(TList& lst) { RDF_EXPRESS_PROBE(615); SetOfIfcRelAssignsToProcessSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(615)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTypeObject::attr
+        {
+            static constexpr IntValue Identification = 612;
+            static constexpr IntValue LongDescription = 613;
+            static constexpr IntValue ProcessType = 614;
+            static constexpr IntValue OperatesOn = 615;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTypeProcess_CLASS_H
@@ -0,0 +1,85 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTypeProduct_CLASS_H
+#define __RDF_LTD__IFC4_IfcTypeProduct_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTypeObject.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTypeProduct
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTypeProduct : public RDF_EXPRESS_VIRTUAL IfcTypeObject
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTypeProduct
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTypeProduct(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 738);
+        }
+
+        /// <summary>
+        /// Instances of IfcTypeProduct in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTypeProduct> Extent(SdaiModel model) { return ExtentRange<IfcTypeProduct>(model, 738, false); }
+        static ExtentRange<IfcTypeProduct> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTypeProduct>(model, 738, true); }
+
+        /// <summary>
+        /// Create new instance of IfcTypeProduct and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcTypeProduct Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcTypeProduct"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcTypeProduct if the actual type of SdaiInstance is IfcTypeProduct or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTypeProduct CreateExactEntity(SdaiInstance instance) { return IfcTypeProduct(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTypeProduct or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTypeProduct(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcRepresentationMap or list of convertible elements
+        template <typename TList> void get_RepresentationMaps(TList& lst) { RDF_EXPRESS_PROBE(49); ListOfIfcRepresentationMapSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(49)); }
+
+        //TList may be ListOfIfcRepresentationMap or list of convertible elements
+        template <typename TList> void put_RepresentationMaps(TList& lst) { RDF_EXPRESS_PROBE(49); ListOfIfcRepresentationMapSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(49)); }
+
+        //TArrayElem[] may be IfcRepresentationMap[] or array of convertible elements
+        template <typename TArrayElem> void put_RepresentationMaps(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(49); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcRepresentationMapSerializer<ListOfIfcRepresentationMap> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(49)); }
+
+        IfcLabel get_Tag() { RDF_EXPRESS_PROBE(50); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(50), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Tag_view() { return TextView(get_Tag()); }
+#endif
+        void put_Tag(IfcLabel value) { RDF_EXPRESS_PROBE(50); sdaiPutAttr(m_instance, getAttrDefinition(50), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Tag_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(50); return buffer.GetAttr(m_instance, "Tag"); }
+        const char* get_Tag_utf8() { return get_Tag_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRelAssignsToProduct or list of convertible elements
+        template <typename TList> void get_ReferencedBy(TList& lst) { RDF_EXPRESS_PROBE(51); SetOfIfcRelAssignsToProductSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(51)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTypeObject::attr
+        {
+            static constexpr IntValue RepresentationMaps = 49;
+            static constexpr IntValue Tag = 50;
+            static constexpr IntValue ReferencedBy = 51;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTypeProduct_CLASS_H
@@ -0,0 +1,93 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTypeResource_CLASS_H
+#define __RDF_LTD__IFC4_IfcTypeResource_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTypeObject.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcTypeResource
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcTypeResource : public RDF_EXPRESS_VIRTUAL IfcTypeObject
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcTypeResource
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcTypeResource(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 739);
+        }
+
+        /// <summary>
+        /// Instances of IfcTypeResource in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcTypeResource> Extent(SdaiModel model) { return ExtentRange<IfcTypeResource>(model, 739, false); }
+        static ExtentRange<IfcTypeResource> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcTypeResource>(model, 739, true); }
+
+        /// <summary>
+        /// Returns object of IfcTypeResource if the actual type of SdaiInstance is IfcTypeResource or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcTypeResource CreateExactEntity(SdaiInstance instance) { return IfcTypeResource(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcTypeResource or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcTypeResource(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcIdentifier get_Identification() { RDF_EXPRESS_PROBE(378); IfcIdentifier val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(378), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Identification_view() { return TextView(get_Identification()); }
+#endif
+        void put_Identification(IfcIdentifier value) { RDF_EXPRESS_PROBE(378); sdaiPutAttr(m_instance, getAttrDefinition(378), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Identification_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(378); return buffer.GetAttr(m_instance, "Identification"); }
+        const char* get_Identification_utf8() { return get_Identification_utf8(ThreadUtf8Buffer()); }
+
+        IfcText get_LongDescription() { RDF_EXPRESS_PROBE(379); IfcText val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(379), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LongDescription_view() { return TextView(get_LongDescription()); }
+#endif
+        void put_LongDescription(IfcText value) { RDF_EXPRESS_PROBE(379); sdaiPutAttr(m_instance, getAttrDefinition(379), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LongDescription_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(379); return buffer.GetAttr(m_instance, "LongDescription"); }
+        const char* get_LongDescription_utf8() { return get_LongDescription_utf8(ThreadUtf8Buffer()); }
+
+        IfcLabel get_ResourceType() { RDF_EXPRESS_PROBE(380); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(380), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_ResourceType_view() { return TextView(get_ResourceType()); }
+#endif
+        void put_ResourceType(IfcLabel value) { RDF_EXPRESS_PROBE(380); sdaiPutAttr(m_instance, getAttrDefinition(380), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_ResourceType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(380); return buffer.GetAttr(m_instance, "ResourceType"); }
+        const char* get_ResourceType_utf8() { return get_ResourceType_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcRelAssignsToResource or list of convertible elements
+        template <typename TList> void get_ResourceOf(TList& lst) { RDF_EXPRESS_PROBE(381); SetOfIfcRelAssignsToResourceSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(381)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTypeObject::attr
+        {
+            static constexpr IntValue Identification = 378;
+            static constexpr IntValue LongDescription = 379;
+            static constexpr IntValue ResourceType = 380;
+            static constexpr IntValue ResourceOf = 381;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcTypeResource_CLASS_H
@@ -0,0 +1,88 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcUShapeProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcUShapeProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcUShapeProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcUShapeProfileDef : public RDF_EXPRESS_VIRTUAL IfcParameterizedProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcUShapeProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcUShapeProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 745);
+        }
+
+        /// <summary>
+        /// Instances of IfcUShapeProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcUShapeProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcUShapeProfileDef>(model, 745, false); }
+        static ExtentRange<IfcUShapeProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcUShapeProfileDef>(model, 745, true); }
+
+        /// <summary>
+        /// Create new instance of IfcUShapeProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcUShapeProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcUShapeProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcUShapeProfileDef if the actual type of SdaiInstance is IfcUShapeProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcUShapeProfileDef CreateExactEntity(SdaiInstance instance) { return IfcUShapeProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcUShapeProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcUShapeProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Depth() { RDF_EXPRESS_PROBE(1623); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1623), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Depth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1623); sdaiPutAttr(m_instance, getAttrDefinition(1623), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_FlangeWidth() { RDF_EXPRESS_PROBE(1624); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1624), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_FlangeWidth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1624); sdaiPutAttr(m_instance, getAttrDefinition(1624), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_WebThickness() { RDF_EXPRESS_PROBE(1625); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1625), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_WebThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1625); sdaiPutAttr(m_instance, getAttrDefinition(1625), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_FlangeThickness() { RDF_EXPRESS_PROBE(1626); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1626), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_FlangeThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1626); sdaiPutAttr(m_instance, getAttrDefinition(1626), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_FilletRadius() { RDF_EXPRESS_PROBE(1627); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1627), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_FilletRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(1627); sdaiPutAttr(m_instance, getAttrDefinition(1627), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_EdgeRadius() { RDF_EXPRESS_PROBE(1628); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1628), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_EdgeRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(1628); sdaiPutAttr(m_instance, getAttrDefinition(1628), sdaiREAL, &value); }
+
+        Nullable<IfcPlaneAngleMeasure> get_FlangeSlope() { RDF_EXPRESS_PROBE(1629); IfcPlaneAngleMeasure val = (IfcPlaneAngleMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1629), sdaiREAL, &val)) return val; else return Nullable<IfcPlaneAngleMeasure>(); }
+        void put_FlangeSlope(IfcPlaneAngleMeasure value) { RDF_EXPRESS_PROBE(1629); sdaiPutAttr(m_instance, getAttrDefinition(1629), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcParameterizedProfileDef::attr
+        {
+            static constexpr IntValue Depth = 1623;
+            static constexpr IntValue FlangeWidth = 1624;
+            static constexpr IntValue WebThickness = 1625;
+            static constexpr IntValue FlangeThickness = 1626;
+            static constexpr IntValue FilletRadius = 1627;
+            static constexpr IntValue EdgeRadius = 1628;
+            static constexpr IntValue FlangeSlope = 1629;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcUShapeProfileDef_CLASS_H
@@ -0,0 +1,66 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcUnitAssignment_CLASS_H
+#define __RDF_LTD__IFC4_IfcUnitAssignment_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcUnitAssignment
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcUnitAssignment : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcUnitAssignment
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcUnitAssignment(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 744);
+        }
+
+        /// <summary>
+        /// Instances of IfcUnitAssignment in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcUnitAssignment> Extent(SdaiModel model) { return ExtentRange<IfcUnitAssignment>(model, 744, false); }
+        static ExtentRange<IfcUnitAssignment> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcUnitAssignment>(model, 744, true); }
+
+        /// <summary>
+        /// Create new instance of IfcUnitAssignment and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcUnitAssignment Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcUnitAssignment"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcUnitAssignment if the actual type of SdaiInstance is IfcUnitAssignment or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcUnitAssignment CreateExactEntity(SdaiInstance instance) { return IfcUnitAssignment(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcUnitAssignment or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcUnitAssignment(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcUnit or list of convertible elements
+        template <typename TList> void get_Units(TList& lst) { RDF_EXPRESS_PROBE(1622); SetOfIfcUnitSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1622)); }
+
+        //TList may be SetOfIfcUnit or list of convertible elements
+        template <typename TList> void put_Units(TList& lst) { RDF_EXPRESS_PROBE(1622); SetOfIfcUnitSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1622)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue Units = 1622;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcUnitAssignment_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcUnitaryControlElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcUnitaryControlElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcUnitaryControlElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcUnitaryControlElement : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcUnitaryControlElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcUnitaryControlElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 740);
+        }
+
+        /// <summary>
+        /// Instances of IfcUnitaryControlElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcUnitaryControlElement> Extent(SdaiModel model) { return ExtentRange<IfcUnitaryControlElement>(model, 740, false); }
+        static ExtentRange<IfcUnitaryControlElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcUnitaryControlElement>(model, 740, true); }
+
+        /// <summary>
+        /// Create new instance of IfcUnitaryControlElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcUnitaryControlElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcUnitaryControlElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcUnitaryControlElement if the actual type of SdaiInstance is IfcUnitaryControlElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcUnitaryControlElement CreateExactEntity(SdaiInstance instance) { return IfcUnitaryControlElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcUnitaryControlElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcUnitaryControlElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcUnitaryControlElementTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1618); int v = getENUM(1618, IfcUnitaryControlElementTypeEnum_hash); if (v >= 0) return (IfcUnitaryControlElementTypeEnum) v; else return Nullable<IfcUnitaryControlElementTypeEnum>(); }
+        void put_PredefinedType(IfcUnitaryControlElementTypeEnum value) { RDF_EXPRESS_PROBE(1618); TextValue val = IfcUnitaryControlElementTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1618), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1618;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcUnitaryControlElement_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcUnitaryControlElementType_CLASS_H
+#define __RDF_LTD__IFC4_IfcUnitaryControlElementType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDistributionControlElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcUnitaryControlElementType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcUnitaryControlElementType : public RDF_EXPRESS_VIRTUAL IfcDistributionControlElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcUnitaryControlElementType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcUnitaryControlElementType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 741);
+        }
+
+        /// <summary>
+        /// Instances of IfcUnitaryControlElementType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcUnitaryControlElementType> Extent(SdaiModel model) { return ExtentRange<IfcUnitaryControlElementType>(model, 741, false); }
+        static ExtentRange<IfcUnitaryControlElementType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcUnitaryControlElementType>(model, 741, true); }
+
+        /// <summary>
+        /// Create new instance of IfcUnitaryControlElementType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcUnitaryControlElementType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcUnitaryControlElementType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcUnitaryControlElementType if the actual type of SdaiInstance is IfcUnitaryControlElementType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcUnitaryControlElementType CreateExactEntity(SdaiInstance instance) { return IfcUnitaryControlElementType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcUnitaryControlElementType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcUnitaryControlElementType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcUnitaryControlElementTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1619); int v = getENUM(1619, IfcUnitaryControlElementTypeEnum_hash); if (v >= 0) return (IfcUnitaryControlElementTypeEnum) v; else return Nullable<IfcUnitaryControlElementTypeEnum>(); }
+        void put_PredefinedType(IfcUnitaryControlElementTypeEnum value) { RDF_EXPRESS_PROBE(1619); TextValue val = IfcUnitaryControlElementTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1619), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcDistributionControlElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1619;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcUnitaryControlElementType_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcUnitaryEquipment_CLASS_H
+#define __RDF_LTD__IFC4_IfcUnitaryEquipment_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDevice.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcUnitaryEquipment
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcUnitaryEquipment : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDevice
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcUnitaryEquipment
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcUnitaryEquipment(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 742);
+        }
+
+        /// <summary>
+        /// Instances of IfcUnitaryEquipment in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcUnitaryEquipment> Extent(SdaiModel model) { return ExtentRange<IfcUnitaryEquipment>(model, 742, false); }
+        static ExtentRange<IfcUnitaryEquipment> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcUnitaryEquipment>(model, 742, true); }
+
+        /// <summary>
+        /// Create new instance of IfcUnitaryEquipment and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcUnitaryEquipment Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcUnitaryEquipment"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcUnitaryEquipment if the actual type of SdaiInstance is IfcUnitaryEquipment or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcUnitaryEquipment CreateExactEntity(SdaiInstance instance) { return IfcUnitaryEquipment(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcUnitaryEquipment or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcUnitaryEquipment(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcUnitaryEquipmentTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1620); int v = getENUM(1620, IfcUnitaryEquipmentTypeEnum_hash); if (v >= 0) return (IfcUnitaryEquipmentTypeEnum) v; else return Nullable<IfcUnitaryEquipmentTypeEnum>(); }
+        void put_PredefinedType(IfcUnitaryEquipmentTypeEnum value) { RDF_EXPRESS_PROBE(1620); TextValue val = IfcUnitaryEquipmentTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1620), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDevice::attr
+        {
+            static constexpr IntValue PredefinedType = 1620;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcUnitaryEquipment_CLASS_H
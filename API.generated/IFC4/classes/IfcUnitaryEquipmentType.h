@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcUnitaryEquipmentType_CLASS_H
+#define __RDF_LTD__IFC4_IfcUnitaryEquipmentType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcEnergyConversionDeviceType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcUnitaryEquipmentType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcUnitaryEquipmentType : public RDF_EXPRESS_VIRTUAL IfcEnergyConversionDeviceType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcUnitaryEquipmentType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcUnitaryEquipmentType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 743);
+        }
+
+        /// <summary>
+        /// Instances of IfcUnitaryEquipmentType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcUnitaryEquipmentType> Extent(SdaiModel model) { return ExtentRange<IfcUnitaryEquipmentType>(model, 743, false); }
+        static ExtentRange<IfcUnitaryEquipmentType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcUnitaryEquipmentType>(model, 743, true); }
+
+        /// <summary>
+        /// Create new instance of IfcUnitaryEquipmentType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcUnitaryEquipmentType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcUnitaryEquipmentType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcUnitaryEquipmentType if the actual type of SdaiInstance is IfcUnitaryEquipmentType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcUnitaryEquipmentType CreateExactEntity(SdaiInstance instance) { return IfcUnitaryEquipmentType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcUnitaryEquipmentType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcUnitaryEquipmentType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcUnitaryEquipmentTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1621); int v = getENUM(1621, IfcUnitaryEquipmentTypeEnum_hash); if (v >= 0) return (IfcUnitaryEquipmentTypeEnum) v; else return Nullable<IfcUnitaryEquipmentTypeEnum>(); }
+        void put_PredefinedType(IfcUnitaryEquipmentTypeEnum value) { RDF_EXPRESS_PROBE(1621); TextValue val = IfcUnitaryEquipmentTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1621), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcEnergyConversionDeviceType::attr
+        {
+            static constexpr IntValue PredefinedType = 1621;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcUnitaryEquipmentType_CLASS_H
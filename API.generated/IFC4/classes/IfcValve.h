@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcValve_CLASS_H
+#define __RDF_LTD__IFC4_IfcValve_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowController.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcValve
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcValve : public RDF_EXPRESS_VIRTUAL IfcFlowController
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcValve
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcValve(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 746);
+        }
+
+        /// <summary>
+        /// Instances of IfcValve in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcValve> Extent(SdaiModel model) { return ExtentRange<IfcValve>(model, 746, false); }
+        static ExtentRange<IfcValve> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcValve>(model, 746, true); }
+
+        /// <summary>
+        /// Create new instance of IfcValve and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcValve Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcValve"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcValve if the actual type of SdaiInstance is IfcValve or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcValve CreateExactEntity(SdaiInstance instance) { return IfcValve(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcValve or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcValve(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcValveTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1630); int v = getENUM(1630, IfcValveTypeEnum_hash); if (v >= 0) return (IfcValveTypeEnum) v; else return Nullable<IfcValveTypeEnum>(); }
+        void put_PredefinedType(IfcValveTypeEnum value) { RDF_EXPRESS_PROBE(1630); TextValue val = IfcValveTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1630), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowController::attr
+        {
+            static constexpr IntValue PredefinedType = 1630;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcValve_CLASS_H
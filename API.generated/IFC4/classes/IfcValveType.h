@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcValveType_CLASS_H
+#define __RDF_LTD__IFC4_IfcValveType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowControllerType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcValveType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcValveType : public RDF_EXPRESS_VIRTUAL IfcFlowControllerType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcValveType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcValveType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 747);
+        }
+
+        /// <summary>
+        /// Instances of IfcValveType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcValveType> Extent(SdaiModel model) { return ExtentRange<IfcValveType>(model, 747, false); }
+        static ExtentRange<IfcValveType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcValveType>(model, 747, true); }
+
+        /// <summary>
+        /// Create new instance of IfcValveType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcValveType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcValveType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcValveType if the actual type of SdaiInstance is IfcValveType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcValveType CreateExactEntity(SdaiInstance instance) { return IfcValveType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcValveType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcValveType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcValveTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1631); int v = getENUM(1631, IfcValveTypeEnum_hash); if (v >= 0) return (IfcValveTypeEnum) v; else return Nullable<IfcValveTypeEnum>(); }
+        void put_PredefinedType(IfcValveTypeEnum value) { RDF_EXPRESS_PROBE(1631); TextValue val = IfcValveTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1631), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowControllerType::attr
+        {
+            static constexpr IntValue PredefinedType = 1631;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcValveType_CLASS_H
@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVector_CLASS_H
+#define __RDF_LTD__IFC4_IfcVector_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcGeometricRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcVector
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcVector : public RDF_EXPRESS_VIRTUAL IfcGeometricRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcVector
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcVector(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 748);
+        }
+
+        /// <summary>
+        /// Instances of IfcVector in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcVector> Extent(SdaiModel model) { return ExtentRange<IfcVector>(model, 748, false); }
+        static ExtentRange<IfcVector> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcVector>(model, 748, true); }
+
+        /// <summary>
+        /// Create new instance of IfcVector and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcVector Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcVector"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcVector if the actual type of SdaiInstance is IfcVector or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcVector CreateExactEntity(SdaiInstance instance) { return IfcVector(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcVector or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcVector(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDirection get_Orientation();
+        void put_Orientation(IfcDirection inst);
+
+        Nullable<IfcLengthMeasure> get_Magnitude() { RDF_EXPRESS_PROBE(1633); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1633), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_Magnitude(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1633); sdaiPutAttr(m_instance, getAttrDefinition(1633), sdaiREAL, &value); }
+
+        Nullable<IfcDimensionCount> get_Dim() { RDF_EXPRESS_PROBE(1634); IfcDimensionCount val = (IfcDimensionCount) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1634), sdaiINTEGER, &val)) return val; else return Nullable<IfcDimensionCount>(); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcGeometricRepresentationItem::attr
+        {
+            static constexpr IntValue Orientation = 1632;
+            static constexpr IntValue Magnitude = 1633;
+            static constexpr IntValue Dim = 1634;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcVector_CLASS_H
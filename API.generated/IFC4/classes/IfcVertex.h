@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVertex_CLASS_H
+#define __RDF_LTD__IFC4_IfcVertex_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTopologicalRepresentationItem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcVertex
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcVertex : public RDF_EXPRESS_VIRTUAL IfcTopologicalRepresentationItem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcVertex
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcVertex(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 749);
+        }
+
+        /// <summary>
+        /// Instances of IfcVertex in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcVertex> Extent(SdaiModel model) { return ExtentRange<IfcVertex>(model, 749, false); }
+        static ExtentRange<IfcVertex> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcVertex>(model, 749, true); }
+
+        /// <summary>
+        /// Create new instance of IfcVertex and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcVertex Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcVertex"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcVertex if the actual type of SdaiInstance is IfcVertex or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcVertex CreateExactEntity(SdaiInstance instance) { return IfcVertex(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcVertex or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcVertex(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTopologicalRepresentationItem::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcVertex_CLASS_H
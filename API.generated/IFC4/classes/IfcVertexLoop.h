@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVertexLoop_CLASS_H
+#define __RDF_LTD__IFC4_IfcVertexLoop_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcLoop.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcVertexLoop
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcVertexLoop : public RDF_EXPRESS_VIRTUAL IfcLoop
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcVertexLoop
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcVertexLoop(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 750);
+        }
+
+        /// <summary>
+        /// Instances of IfcVertexLoop in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcVertexLoop> Extent(SdaiModel model) { return ExtentRange<IfcVertexLoop>(model, 750, false); }
+        static ExtentRange<IfcVertexLoop> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcVertexLoop>(model, 750, true); }
+
+        /// <summary>
+        /// Create new instance of IfcVertexLoop and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcVertexLoop Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcVertexLoop"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcVertexLoop if the actual type of SdaiInstance is IfcVertexLoop or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcVertexLoop CreateExactEntity(SdaiInstance instance) { return IfcVertexLoop(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcVertexLoop or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcVertexLoop(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcVertex get_LoopVertex();
+        void put_LoopVertex(IfcVertex inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcLoop::attr
+        {
+            static constexpr IntValue LoopVertex = 1635;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcVertexLoop_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVertexPoint_CLASS_H
+#define __RDF_LTD__IFC4_IfcVertexPoint_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcVertex.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcVertexPoint
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcVertexPoint : public RDF_EXPRESS_VIRTUAL IfcVertex
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcVertexPoint
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcVertexPoint(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 751);
+        }
+
+        /// <summary>
+        /// Instances of IfcVertexPoint in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcVertexPoint> Extent(SdaiModel model) { return ExtentRange<IfcVertexPoint>(model, 751, false); }
+        static ExtentRange<IfcVertexPoint> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcVertexPoint>(model, 751, true); }
+
+        /// <summary>
+        /// Create new instance of IfcVertexPoint and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcVertexPoint Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcVertexPoint"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcVertexPoint if the actual type of SdaiInstance is IfcVertexPoint or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcVertexPoint CreateExactEntity(SdaiInstance instance) { return IfcVertexPoint(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcVertexPoint or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcVertexPoint(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcPoint get_VertexGeometry();
+        void put_VertexGeometry(IfcPoint inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcVertex::attr
+        {
+            static constexpr IntValue VertexGeometry = 1636;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcVertexPoint_CLASS_H
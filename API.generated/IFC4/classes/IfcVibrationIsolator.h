@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVibrationIsolator_CLASS_H
+#define __RDF_LTD__IFC4_IfcVibrationIsolator_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementComponent.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcVibrationIsolator
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcVibrationIsolator : public RDF_EXPRESS_VIRTUAL IfcElementComponent
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcVibrationIsolator
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcVibrationIsolator(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 752);
+        }
+
+        /// <summary>
+        /// Instances of IfcVibrationIsolator in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcVibrationIsolator> Extent(SdaiModel model) { return ExtentRange<IfcVibrationIsolator>(model, 752, false); }
+        static ExtentRange<IfcVibrationIsolator> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcVibrationIsolator>(model, 752, true); }
+
+        /// <summary>
+        /// Create new instance of IfcVibrationIsolator and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcVibrationIsolator Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcVibrationIsolator"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcVibrationIsolator if the actual type of SdaiInstance is IfcVibrationIsolator or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcVibrationIsolator CreateExactEntity(SdaiInstance instance) { return IfcVibrationIsolator(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcVibrationIsolator or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcVibrationIsolator(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcVibrationIsolatorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1637); int v = getENUM(1637, IfcVibrationIsolatorTypeEnum_hash); if (v >= 0) return (IfcVibrationIsolatorTypeEnum) v; else return Nullable<IfcVibrationIsolatorTypeEnum>(); }
+        void put_PredefinedType(IfcVibrationIsolatorTypeEnum value) { RDF_EXPRESS_PROBE(1637); TextValue val = IfcVibrationIsolatorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1637), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementComponent::attr
+        {
+            static constexpr IntValue PredefinedType = 1637;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcVibrationIsolator_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVibrationIsolatorType_CLASS_H
+#define __RDF_LTD__IFC4_IfcVibrationIsolatorType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElementComponentType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcVibrationIsolatorType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcVibrationIsolatorType : public RDF_EXPRESS_VIRTUAL IfcElementComponentType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcVibrationIsolatorType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcVibrationIsolatorType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 753);
+        }
+
+        /// <summary>
+        /// Instances of IfcVibrationIsolatorType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcVibrationIsolatorType> Extent(SdaiModel model) { return ExtentRange<IfcVibrationIsolatorType>(model, 753, false); }
+        static ExtentRange<IfcVibrationIsolatorType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcVibrationIsolatorType>(model, 753, true); }
+
+        /// <summary>
+        /// Create new instance of IfcVibrationIsolatorType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcVibrationIsolatorType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcVibrationIsolatorType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcVibrationIsolatorType if the actual type of SdaiInstance is IfcVibrationIsolatorType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcVibrationIsolatorType CreateExactEntity(SdaiInstance instance) { return IfcVibrationIsolatorType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcVibrationIsolatorType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcVibrationIsolatorType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcVibrationIsolatorTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1638); int v = getENUM(1638, IfcVibrationIsolatorTypeEnum_hash); if (v >= 0) return (IfcVibrationIsolatorTypeEnum) v; else return Nullable<IfcVibrationIsolatorTypeEnum>(); }
+        void put_PredefinedType(IfcVibrationIsolatorTypeEnum value) { RDF_EXPRESS_PROBE(1638); TextValue val = IfcVibrationIsolatorTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1638), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElementComponentType::attr
+        {
+            static constexpr IntValue PredefinedType = 1638;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcVibrationIsolatorType_CLASS_H
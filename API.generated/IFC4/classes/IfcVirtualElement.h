@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVirtualElement_CLASS_H
+#define __RDF_LTD__IFC4_IfcVirtualElement_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcVirtualElement
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcVirtualElement : public RDF_EXPRESS_VIRTUAL IfcElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcVirtualElement
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcVirtualElement(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 754);
+        }
+
+        /// <summary>
+        /// Instances of IfcVirtualElement in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcVirtualElement> Extent(SdaiModel model) { return ExtentRange<IfcVirtualElement>(model, 754, false); }
+        static ExtentRange<IfcVirtualElement> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcVirtualElement>(model, 754, true); }
+
+        /// <summary>
+        /// Create new instance of IfcVirtualElement and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcVirtualElement Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcVirtualElement"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcVirtualElement if the actual type of SdaiInstance is IfcVirtualElement or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcVirtualElement CreateExactEntity(SdaiInstance instance) { return IfcVirtualElement(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcVirtualElement or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcVirtualElement(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcElement::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcVirtualElement_CLASS_H
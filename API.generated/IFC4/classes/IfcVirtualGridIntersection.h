@@ -0,0 +1,79 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVirtualGridIntersection_CLASS_H
+#define __RDF_LTD__IFC4_IfcVirtualGridIntersection_CLASS_H
+
+#include    "../IFC4_core.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcVirtualGridIntersection
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcVirtualGridIntersection : public RDF_EXPRESS_VIRTUAL Entity
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcVirtualGridIntersection
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcVirtualGridIntersection(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 755);
+        }
+
+        /// <summary>
+        /// Instances of IfcVirtualGridIntersection in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcVirtualGridIntersection> Extent(SdaiModel model) { return ExtentRange<IfcVirtualGridIntersection>(model, 755, false); }
+        static ExtentRange<IfcVirtualGridIntersection> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcVirtualGridIntersection>(model, 755, true); }
+
+        /// <summary>
+        /// Create new instance of IfcVirtualGridIntersection and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcVirtualGridIntersection Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcVirtualGridIntersection"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcVirtualGridIntersection if the actual type of SdaiInstance is IfcVirtualGridIntersection or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcVirtualGridIntersection CreateExactEntity(SdaiInstance instance) { return IfcVirtualGridIntersection(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcVirtualGridIntersection or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcVirtualGridIntersection(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be ListOfIfcGridAxis or list of convertible elements
+        template <typename TList> void get_IntersectingAxes(TList& lst) { RDF_EXPRESS_PROBE(1639); ListOfIfcGridAxisSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1639)); }
+
+        //TList may be ListOfIfcGridAxis or list of convertible elements
+        template <typename TList> void put_IntersectingAxes(TList& lst) { RDF_EXPRESS_PROBE(1639); ListOfIfcGridAxisSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1639)); }
+
+        //TArrayElem[] may be IfcGridAxis[] or array of convertible elements
+        template <typename TArrayElem> void put_IntersectingAxes(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1639); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcGridAxisSerializer<ListOfIfcGridAxis> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1639)); }
+
+        //TList may be ListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void get_OffsetDistances(TList& lst) { RDF_EXPRESS_PROBE(1640); ListOfIfcLengthMeasureSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1640)); }
+
+        //TList may be ListOfIfcLengthMeasure or list of convertible elements
+        template <typename TList> void put_OffsetDistances(TList& lst) { RDF_EXPRESS_PROBE(1640); ListOfIfcLengthMeasureSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1640)); }
+
+        //TArrayElem[] may be IfcLengthMeasure[] or array of convertible elements
+        template <typename TArrayElem> void put_OffsetDistances(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1640); ArrayRange<TArrayElem> range = {arr, n}; ListOfIfcLengthMeasureSerializer<ListOfIfcLengthMeasure> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1640)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : Entity::attr
+        {
+            static constexpr IntValue IntersectingAxes = 1639;
+            static constexpr IntValue OffsetDistances = 1640;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcVirtualGridIntersection_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVoidingFeature_CLASS_H
+#define __RDF_LTD__IFC4_IfcVoidingFeature_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFeatureElementSubtraction.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcVoidingFeature
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcVoidingFeature : public RDF_EXPRESS_VIRTUAL IfcFeatureElementSubtraction
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcVoidingFeature
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcVoidingFeature(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 756);
+        }
+
+        /// <summary>
+        /// Instances of IfcVoidingFeature in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcVoidingFeature> Extent(SdaiModel model) { return ExtentRange<IfcVoidingFeature>(model, 756, false); }
+        static ExtentRange<IfcVoidingFeature> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcVoidingFeature>(model, 756, true); }
+
+        /// <summary>
+        /// Create new instance of IfcVoidingFeature and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcVoidingFeature Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcVoidingFeature"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcVoidingFeature if the actual type of SdaiInstance is IfcVoidingFeature or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcVoidingFeature CreateExactEntity(SdaiInstance instance) { return IfcVoidingFeature(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcVoidingFeature or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcVoidingFeature(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcVoidingFeatureTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1641); int v = getENUM(1641, IfcVoidingFeatureTypeEnum_hash); if (v >= 0) return (IfcVoidingFeatureTypeEnum) v; else return Nullable<IfcVoidingFeatureTypeEnum>(); }
+        void put_PredefinedType(IfcVoidingFeatureTypeEnum value) { RDF_EXPRESS_PROBE(1641); TextValue val = IfcVoidingFeatureTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1641), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFeatureElementSubtraction::attr
+        {
+            static constexpr IntValue PredefinedType = 1641;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcVoidingFeature_CLASS_H
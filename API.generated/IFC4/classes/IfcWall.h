@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWall_CLASS_H
+#define __RDF_LTD__IFC4_IfcWall_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWall
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWall : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWall
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWall(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 757);
+        }
+
+        /// <summary>
+        /// Instances of IfcWall in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWall> Extent(SdaiModel model) { return ExtentRange<IfcWall>(model, 757, false); }
+        static ExtentRange<IfcWall> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWall>(model, 757, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWall and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWall Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWall"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWall if the actual type of SdaiInstance is IfcWall or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWall CreateExactEntity(SdaiInstance instance) { return IfcWall(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWall or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWall(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcWallTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1642); int v = getENUM(1642, IfcWallTypeEnum_hash); if (v >= 0) return (IfcWallTypeEnum) v; else return Nullable<IfcWallTypeEnum>(); }
+        void put_PredefinedType(IfcWallTypeEnum value) { RDF_EXPRESS_PROBE(1642); TextValue val = IfcWallTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1642), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue PredefinedType = 1642;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWall_CLASS_H
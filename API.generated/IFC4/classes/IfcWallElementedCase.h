@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWallElementedCase_CLASS_H
+#define __RDF_LTD__IFC4_IfcWallElementedCase_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcWall.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWallElementedCase
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWallElementedCase : public RDF_EXPRESS_VIRTUAL IfcWall
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWallElementedCase
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWallElementedCase(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 758);
+        }
+
+        /// <summary>
+        /// Instances of IfcWallElementedCase in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWallElementedCase> Extent(SdaiModel model) { return ExtentRange<IfcWallElementedCase>(model, 758, false); }
+        static ExtentRange<IfcWallElementedCase> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWallElementedCase>(model, 758, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWallElementedCase and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWallElementedCase Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWallElementedCase"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWallElementedCase if the actual type of SdaiInstance is IfcWallElementedCase or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWallElementedCase CreateExactEntity(SdaiInstance instance) { return IfcWallElementedCase(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWallElementedCase or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWallElementedCase(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcWall::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWallElementedCase_CLASS_H
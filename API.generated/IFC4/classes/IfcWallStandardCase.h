@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWallStandardCase_CLASS_H
+#define __RDF_LTD__IFC4_IfcWallStandardCase_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcWall.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWallStandardCase
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWallStandardCase : public RDF_EXPRESS_VIRTUAL IfcWall
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWallStandardCase
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWallStandardCase(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 759);
+        }
+
+        /// <summary>
+        /// Instances of IfcWallStandardCase in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWallStandardCase> Extent(SdaiModel model) { return ExtentRange<IfcWallStandardCase>(model, 759, false); }
+        static ExtentRange<IfcWallStandardCase> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWallStandardCase>(model, 759, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWallStandardCase and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWallStandardCase Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWallStandardCase"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWallStandardCase if the actual type of SdaiInstance is IfcWallStandardCase or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWallStandardCase CreateExactEntity(SdaiInstance instance) { return IfcWallStandardCase(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWallStandardCase or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWallStandardCase(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcWall::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWallStandardCase_CLASS_H
@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWallType_CLASS_H
+#define __RDF_LTD__IFC4_IfcWallType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWallType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWallType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWallType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWallType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 760);
+        }
+
+        /// <summary>
+        /// Instances of IfcWallType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWallType> Extent(SdaiModel model) { return ExtentRange<IfcWallType>(model, 760, false); }
+        static ExtentRange<IfcWallType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWallType>(model, 760, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWallType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWallType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWallType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWallType if the actual type of SdaiInstance is IfcWallType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWallType CreateExactEntity(SdaiInstance instance) { return IfcWallType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWallType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWallType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcWallTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1643); int v = getENUM(1643, IfcWallTypeEnum_hash); if (v >= 0) return (IfcWallTypeEnum) v; else return Nullable<IfcWallTypeEnum>(); }
+        void put_PredefinedType(IfcWallTypeEnum value) { RDF_EXPRESS_PROBE(1643); TextValue val = IfcWallTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1643), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1643;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWallType_CLASS_H
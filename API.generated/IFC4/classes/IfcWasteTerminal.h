@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWasteTerminal_CLASS_H
+#define __RDF_LTD__IFC4_IfcWasteTerminal_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminal.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWasteTerminal
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWasteTerminal : public RDF_EXPRESS_VIRTUAL IfcFlowTerminal
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWasteTerminal
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWasteTerminal(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 761);
+        }
+
+        /// <summary>
+        /// Instances of IfcWasteTerminal in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWasteTerminal> Extent(SdaiModel model) { return ExtentRange<IfcWasteTerminal>(model, 761, false); }
+        static ExtentRange<IfcWasteTerminal> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWasteTerminal>(model, 761, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWasteTerminal and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWasteTerminal Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWasteTerminal"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWasteTerminal if the actual type of SdaiInstance is IfcWasteTerminal or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWasteTerminal CreateExactEntity(SdaiInstance instance) { return IfcWasteTerminal(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWasteTerminal or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWasteTerminal(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcWasteTerminalTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1644); int v = getENUM(1644, IfcWasteTerminalTypeEnum_hash); if (v >= 0) return (IfcWasteTerminalTypeEnum) v; else return Nullable<IfcWasteTerminalTypeEnum>(); }
+        void put_PredefinedType(IfcWasteTerminalTypeEnum value) { RDF_EXPRESS_PROBE(1644); TextValue val = IfcWasteTerminalTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1644), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminal::attr
+        {
+            static constexpr IntValue PredefinedType = 1644;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWasteTerminal_CLASS_H
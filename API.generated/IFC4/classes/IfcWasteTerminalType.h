@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWasteTerminalType_CLASS_H
+#define __RDF_LTD__IFC4_IfcWasteTerminalType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcFlowTerminalType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWasteTerminalType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWasteTerminalType : public RDF_EXPRESS_VIRTUAL IfcFlowTerminalType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWasteTerminalType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWasteTerminalType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 762);
+        }
+
+        /// <summary>
+        /// Instances of IfcWasteTerminalType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWasteTerminalType> Extent(SdaiModel model) { return ExtentRange<IfcWasteTerminalType>(model, 762, false); }
+        static ExtentRange<IfcWasteTerminalType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWasteTerminalType>(model, 762, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWasteTerminalType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWasteTerminalType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWasteTerminalType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWasteTerminalType if the actual type of SdaiInstance is IfcWasteTerminalType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWasteTerminalType CreateExactEntity(SdaiInstance instance) { return IfcWasteTerminalType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWasteTerminalType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWasteTerminalType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcWasteTerminalTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1645); int v = getENUM(1645, IfcWasteTerminalTypeEnum_hash); if (v >= 0) return (IfcWasteTerminalTypeEnum) v; else return Nullable<IfcWasteTerminalTypeEnum>(); }
+        void put_PredefinedType(IfcWasteTerminalTypeEnum value) { RDF_EXPRESS_PROBE(1645); TextValue val = IfcWasteTerminalTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1645), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcFlowTerminalType::attr
+        {
+            static constexpr IntValue PredefinedType = 1645;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWasteTerminalType_CLASS_H
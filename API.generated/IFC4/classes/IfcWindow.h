@@ -0,0 +1,87 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWindow_CLASS_H
+#define __RDF_LTD__IFC4_IfcWindow_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElement.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWindow
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWindow : public RDF_EXPRESS_VIRTUAL IfcBuildingElement
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWindow
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWindow(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 763);
+        }
+
+        /// <summary>
+        /// Instances of IfcWindow in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWindow> Extent(SdaiModel model) { return ExtentRange<IfcWindow>(model, 763, false); }
+        static ExtentRange<IfcWindow> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWindow>(model, 763, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWindow and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWindow Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWindow"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWindow if the actual type of SdaiInstance is IfcWindow or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWindow CreateExactEntity(SdaiInstance instance) { return IfcWindow(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWindow or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWindow(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_OverallHeight() { RDF_EXPRESS_PROBE(1646); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1646), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_OverallHeight(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1646); sdaiPutAttr(m_instance, getAttrDefinition(1646), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_OverallWidth() { RDF_EXPRESS_PROBE(1647); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1647), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_OverallWidth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1647); sdaiPutAttr(m_instance, getAttrDefinition(1647), sdaiREAL, &value); }
+
+        Nullable<IfcWindowTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1648); int v = getENUM(1648, IfcWindowTypeEnum_hash); if (v >= 0) return (IfcWindowTypeEnum) v; else return Nullable<IfcWindowTypeEnum>(); }
+        void put_PredefinedType(IfcWindowTypeEnum value) { RDF_EXPRESS_PROBE(1648); TextValue val = IfcWindowTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1648), sdaiENUM, val); }
+
+        Nullable<IfcWindowTypePartitioningEnum> get_PartitioningType() { RDF_EXPRESS_PROBE(1649); int v = getENUM(1649, IfcWindowTypePartitioningEnum_hash); if (v >= 0) return (IfcWindowTypePartitioningEnum) v; else return Nullable<IfcWindowTypePartitioningEnum>(); }
+        void put_PartitioningType(IfcWindowTypePartitioningEnum value) { RDF_EXPRESS_PROBE(1649); TextValue val = IfcWindowTypePartitioningEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1649), sdaiENUM, val); }
+
+        IfcLabel get_UserDefinedPartitioningType() { RDF_EXPRESS_PROBE(1650); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1650), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedPartitioningType_view() { return TextView(get_UserDefinedPartitioningType()); }
+#endif
+        void put_UserDefinedPartitioningType(IfcLabel value) { RDF_EXPRESS_PROBE(1650); sdaiPutAttr(m_instance, getAttrDefinition(1650), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedPartitioningType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1650); return buffer.GetAttr(m_instance, "UserDefinedPartitioningType"); }
+        const char* get_UserDefinedPartitioningType_utf8() { return get_UserDefinedPartitioningType_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElement::attr
+        {
+            static constexpr IntValue OverallHeight = 1646;
+            static constexpr IntValue OverallWidth = 1647;
+            static constexpr IntValue PredefinedType = 1648;
+            static constexpr IntValue PartitioningType = 1649;
+            static constexpr IntValue UserDefinedPartitioningType = 1650;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWindow_CLASS_H
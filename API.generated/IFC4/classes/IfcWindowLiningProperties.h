@@ -0,0 +1,108 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWindowLiningProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcWindowLiningProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedPropertySet.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWindowLiningProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWindowLiningProperties : public RDF_EXPRESS_VIRTUAL IfcPreDefinedPropertySet
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWindowLiningProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWindowLiningProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 764);
+        }
+
+        /// <summary>
+        /// Instances of IfcWindowLiningProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWindowLiningProperties> Extent(SdaiModel model) { return ExtentRange<IfcWindowLiningProperties>(model, 764, false); }
+        static ExtentRange<IfcWindowLiningProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWindowLiningProperties>(model, 764, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWindowLiningProperties and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWindowLiningProperties Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWindowLiningProperties"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWindowLiningProperties if the actual type of SdaiInstance is IfcWindowLiningProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWindowLiningProperties CreateExactEntity(SdaiInstance instance) { return IfcWindowLiningProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWindowLiningProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWindowLiningProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_LiningDepth() { RDF_EXPRESS_PROBE(1651); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1651), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_LiningDepth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1651); sdaiPutAttr(m_instance, getAttrDefinition(1651), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_LiningThickness() { RDF_EXPRESS_PROBE(1652); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1652), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_LiningThickness(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(1652); sdaiPutAttr(m_instance, getAttrDefinition(1652), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_TransomThickness() { RDF_EXPRESS_PROBE(1653); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1653), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_TransomThickness(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(1653); sdaiPutAttr(m_instance, getAttrDefinition(1653), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_MullionThickness() { RDF_EXPRESS_PROBE(1654); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1654), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_MullionThickness(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(1654); sdaiPutAttr(m_instance, getAttrDefinition(1654), sdaiREAL, &value); }
+
+        Nullable<IfcNormalisedRatioMeasure> get_FirstTransomOffset() { RDF_EXPRESS_PROBE(1655); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1655), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_FirstTransomOffset(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(1655); sdaiPutAttr(m_instance, getAttrDefinition(1655), sdaiREAL, &value); }
+
+        Nullable<IfcNormalisedRatioMeasure> get_SecondTransomOffset() { RDF_EXPRESS_PROBE(1656); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1656), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_SecondTransomOffset(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(1656); sdaiPutAttr(m_instance, getAttrDefinition(1656), sdaiREAL, &value); }
+
+        Nullable<IfcNormalisedRatioMeasure> get_FirstMullionOffset() { RDF_EXPRESS_PROBE(1657); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1657), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_FirstMullionOffset(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(1657); sdaiPutAttr(m_instance, getAttrDefinition(1657), sdaiREAL, &value); }
+
+        Nullable<IfcNormalisedRatioMeasure> get_SecondMullionOffset() { RDF_EXPRESS_PROBE(1658); IfcNormalisedRatioMeasure val = (IfcNormalisedRatioMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1658), sdaiREAL, &val)) return val; else return Nullable<IfcNormalisedRatioMeasure>(); }
+        void put_SecondMullionOffset(IfcNormalisedRatioMeasure value) { RDF_EXPRESS_PROBE(1658); sdaiPutAttr(m_instance, getAttrDefinition(1658), sdaiREAL, &value); }
+
+        IfcShapeAspect get_ShapeAspectStyle();
+        void put_ShapeAspectStyle(IfcShapeAspect inst);
+
+        Nullable<IfcLengthMeasure> get_LiningOffset() { RDF_EXPRESS_PROBE(1660); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1660), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_LiningOffset(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1660); sdaiPutAttr(m_instance, getAttrDefinition(1660), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_LiningToPanelOffsetX() { RDF_EXPRESS_PROBE(1661); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1661), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_LiningToPanelOffsetX(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1661); sdaiPutAttr(m_instance, getAttrDefinition(1661), sdaiREAL, &value); }
+
+        Nullable<IfcLengthMeasure> get_LiningToPanelOffsetY() { RDF_EXPRESS_PROBE(1662); IfcLengthMeasure val = (IfcLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1662), sdaiREAL, &val)) return val; else return Nullable<IfcLengthMeasure>(); }
+        void put_LiningToPanelOffsetY(IfcLengthMeasure value) { RDF_EXPRESS_PROBE(1662); sdaiPutAttr(m_instance, getAttrDefinition(1662), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedPropertySet::attr
+        {
+            static constexpr IntValue LiningDepth = 1651;
+            static constexpr IntValue LiningThickness = 1652;
+            static constexpr IntValue TransomThickness = 1653;
+            static constexpr IntValue MullionThickness = 1654;
+            static constexpr IntValue FirstTransomOffset = 1655;
+            static constexpr IntValue SecondTransomOffset = 1656;
+            static constexpr IntValue FirstMullionOffset = 1657;
+            static constexpr IntValue SecondMullionOffset = 1658;
+            static constexpr IntValue ShapeAspectStyle = 1659;
+            static constexpr IntValue LiningOffset = 1660;
+            static constexpr IntValue LiningToPanelOffsetX = 1661;
+            static constexpr IntValue LiningToPanelOffsetY = 1662;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWindowLiningProperties_CLASS_H
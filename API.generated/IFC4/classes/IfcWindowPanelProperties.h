@@ -0,0 +1,80 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWindowPanelProperties_CLASS_H
+#define __RDF_LTD__IFC4_IfcWindowPanelProperties_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcPreDefinedPropertySet.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWindowPanelProperties
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWindowPanelProperties : public RDF_EXPRESS_VIRTUAL IfcPreDefinedPropertySet
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWindowPanelProperties
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWindowPanelProperties(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 765);
+        }
+
+        /// <summary>
+        /// Instances of IfcWindowPanelProperties in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWindowPanelProperties> Extent(SdaiModel model) { return ExtentRange<IfcWindowPanelProperties>(model, 765, false); }
+        static ExtentRange<IfcWindowPanelProperties> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWindowPanelProperties>(model, 765, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWindowPanelProperties and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWindowPanelProperties Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWindowPanelProperties"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWindowPanelProperties if the actual type of SdaiInstance is IfcWindowPanelProperties or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWindowPanelProperties CreateExactEntity(SdaiInstance instance) { return IfcWindowPanelProperties(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWindowPanelProperties or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWindowPanelProperties(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcWindowPanelOperationEnum> get_OperationType() { RDF_EXPRESS_PROBE(1663); int v = getENUM(1663, IfcWindowPanelOperationEnum_hash); if (v >= 0) return (IfcWindowPanelOperationEnum) v; else return Nullable<IfcWindowPanelOperationEnum>(); }
+        void put_OperationType(IfcWindowPanelOperationEnum value) { RDF_EXPRESS_PROBE(1663); TextValue val = IfcWindowPanelOperationEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1663), sdaiENUM, val); }
+
+        Nullable<IfcWindowPanelPositionEnum> get_PanelPosition() { RDF_EXPRESS_PROBE(1664); int v = getENUM(1664, IfcWindowPanelPositionEnum_hash); if (v >= 0) return (IfcWindowPanelPositionEnum) v; else return Nullable<IfcWindowPanelPositionEnum>(); }
+        void put_PanelPosition(IfcWindowPanelPositionEnum value) { RDF_EXPRESS_PROBE(1664); TextValue val = IfcWindowPanelPositionEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1664), sdaiENUM, val); }
+
+        Nullable<IfcPositiveLengthMeasure> get_FrameDepth() { RDF_EXPRESS_PROBE(1665); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1665), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_FrameDepth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1665); sdaiPutAttr(m_instance, getAttrDefinition(1665), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_FrameThickness() { RDF_EXPRESS_PROBE(1666); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1666), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_FrameThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1666); sdaiPutAttr(m_instance, getAttrDefinition(1666), sdaiREAL, &value); }
+
+        IfcShapeAspect get_ShapeAspectStyle();
+        void put_ShapeAspectStyle(IfcShapeAspect inst);
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcPreDefinedPropertySet::attr
+        {
+            static constexpr IntValue OperationType = 1663;
+            static constexpr IntValue PanelPosition = 1664;
+            static constexpr IntValue FrameDepth = 1665;
+            static constexpr IntValue FrameThickness = 1666;
+            static constexpr IntValue ShapeAspectStyle = 1667;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWindowPanelProperties_CLASS_H
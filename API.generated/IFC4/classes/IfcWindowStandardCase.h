@@ -0,0 +1,60 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWindowStandardCase_CLASS_H
+#define __RDF_LTD__IFC4_IfcWindowStandardCase_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcWindow.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWindowStandardCase
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWindowStandardCase : public RDF_EXPRESS_VIRTUAL IfcWindow
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWindowStandardCase
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWindowStandardCase(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 766);
+        }
+
+        /// <summary>
+        /// Instances of IfcWindowStandardCase in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWindowStandardCase> Extent(SdaiModel model) { return ExtentRange<IfcWindowStandardCase>(model, 766, false); }
+        static ExtentRange<IfcWindowStandardCase> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWindowStandardCase>(model, 766, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWindowStandardCase and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWindowStandardCase Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWindowStandardCase"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWindowStandardCase if the actual type of SdaiInstance is IfcWindowStandardCase or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWindowStandardCase CreateExactEntity(SdaiInstance instance) { return IfcWindowStandardCase(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWindowStandardCase or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWindowStandardCase(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcWindow::attr
+        {
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWindowStandardCase_CLASS_H
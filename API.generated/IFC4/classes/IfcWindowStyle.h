@@ -0,0 +1,76 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWindowStyle_CLASS_H
+#define __RDF_LTD__IFC4_IfcWindowStyle_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcTypeProduct.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWindowStyle
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWindowStyle : public RDF_EXPRESS_VIRTUAL IfcTypeProduct
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWindowStyle
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWindowStyle(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 767);
+        }
+
+        /// <summary>
+        /// Instances of IfcWindowStyle in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWindowStyle> Extent(SdaiModel model) { return ExtentRange<IfcWindowStyle>(model, 767, false); }
+        static ExtentRange<IfcWindowStyle> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWindowStyle>(model, 767, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWindowStyle and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWindowStyle Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWindowStyle"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWindowStyle if the actual type of SdaiInstance is IfcWindowStyle or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWindowStyle CreateExactEntity(SdaiInstance instance) { return IfcWindowStyle(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWindowStyle or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWindowStyle(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcWindowStyleConstructionEnum> get_ConstructionType() { RDF_EXPRESS_PROBE(1668); int v = getENUM(1668, IfcWindowStyleConstructionEnum_hash); if (v >= 0) return (IfcWindowStyleConstructionEnum) v; else return Nullable<IfcWindowStyleConstructionEnum>(); }
+        void put_ConstructionType(IfcWindowStyleConstructionEnum value) { RDF_EXPRESS_PROBE(1668); TextValue val = IfcWindowStyleConstructionEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1668), sdaiENUM, val); }
+
+        Nullable<IfcWindowStyleOperationEnum> get_OperationType() { RDF_EXPRESS_PROBE(1669); int v = getENUM(1669, IfcWindowStyleOperationEnum_hash); if (v >= 0) return (IfcWindowStyleOperationEnum) v; else return Nullable<IfcWindowStyleOperationEnum>(); }
+        void put_OperationType(IfcWindowStyleOperationEnum value) { RDF_EXPRESS_PROBE(1669); TextValue val = IfcWindowStyleOperationEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1669), sdaiENUM, val); }
+
+        Nullable<IfcBoolean> get_ParameterTakesPrecedence() { RDF_EXPRESS_PROBE(1670); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1670), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_ParameterTakesPrecedence(IfcBoolean value) { RDF_EXPRESS_PROBE(1670); sdaiPutAttr(m_instance, getAttrDefinition(1670), sdaiBOOLEAN, &value); }
+
+        Nullable<IfcBoolean> get_Sizeable() { RDF_EXPRESS_PROBE(1671); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1671), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_Sizeable(IfcBoolean value) { RDF_EXPRESS_PROBE(1671); sdaiPutAttr(m_instance, getAttrDefinition(1671), sdaiBOOLEAN, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcTypeProduct::attr
+        {
+            static constexpr IntValue ConstructionType = 1668;
+            static constexpr IntValue OperationType = 1669;
+            static constexpr IntValue ParameterTakesPrecedence = 1670;
+            static constexpr IntValue Sizeable = 1671;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWindowStyle_CLASS_H
@@ -0,0 +1,83 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWindowType_CLASS_H
+#define __RDF_LTD__IFC4_IfcWindowType_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcBuildingElementType.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWindowType
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWindowType : public RDF_EXPRESS_VIRTUAL IfcBuildingElementType
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWindowType
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWindowType(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 768);
+        }
+
+        /// <summary>
+        /// Instances of IfcWindowType in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWindowType> Extent(SdaiModel model) { return ExtentRange<IfcWindowType>(model, 768, false); }
+        static ExtentRange<IfcWindowType> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWindowType>(model, 768, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWindowType and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWindowType Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWindowType"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWindowType if the actual type of SdaiInstance is IfcWindowType or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWindowType CreateExactEntity(SdaiInstance instance) { return IfcWindowType(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWindowType or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWindowType(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcWindowTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1672); int v = getENUM(1672, IfcWindowTypeEnum_hash); if (v >= 0) return (IfcWindowTypeEnum) v; else return Nullable<IfcWindowTypeEnum>(); }
+        void put_PredefinedType(IfcWindowTypeEnum value) { RDF_EXPRESS_PROBE(1672); TextValue val = IfcWindowTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1672), sdaiENUM, val); }
+
+        Nullable<IfcWindowTypePartitioningEnum> get_PartitioningType() { RDF_EXPRESS_PROBE(1673); int v = getENUM(1673, IfcWindowTypePartitioningEnum_hash); if (v >= 0) return (IfcWindowTypePartitioningEnum) v; else return Nullable<IfcWindowTypePartitioningEnum>(); }
+        void put_PartitioningType(IfcWindowTypePartitioningEnum value) { RDF_EXPRESS_PROBE(1673); TextValue val = IfcWindowTypePartitioningEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1673), sdaiENUM, val); }
+
+        Nullable<IfcBoolean> get_ParameterTakesPrecedence() { RDF_EXPRESS_PROBE(1674); IfcBoolean val = (IfcBoolean) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1674), sdaiBOOLEAN, &val)) return val; else return Nullable<IfcBoolean>(); }
+        void put_ParameterTakesPrecedence(IfcBoolean value) { RDF_EXPRESS_PROBE(1674); sdaiPutAttr(m_instance, getAttrDefinition(1674), sdaiBOOLEAN, &value); }
+
+        IfcLabel get_UserDefinedPartitioningType() { RDF_EXPRESS_PROBE(1675); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1675), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_UserDefinedPartitioningType_view() { return TextView(get_UserDefinedPartitioningType()); }
+#endif
+        void put_UserDefinedPartitioningType(IfcLabel value) { RDF_EXPRESS_PROBE(1675); sdaiPutAttr(m_instance, getAttrDefinition(1675), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_UserDefinedPartitioningType_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1675); return buffer.GetAttr(m_instance, "UserDefinedPartitioningType"); }
+        const char* get_UserDefinedPartitioningType_utf8() { return get_UserDefinedPartitioningType_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcBuildingElementType::attr
+        {
+            static constexpr IntValue PredefinedType = 1672;
+            static constexpr IntValue PartitioningType = 1673;
+            static constexpr IntValue ParameterTakesPrecedence = 1674;
+            static constexpr IntValue UserDefinedPartitioningType = 1675;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWindowType_CLASS_H
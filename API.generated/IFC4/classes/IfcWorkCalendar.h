@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWorkCalendar_CLASS_H
+#define __RDF_LTD__IFC4_IfcWorkCalendar_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcControl.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWorkCalendar
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWorkCalendar : public RDF_EXPRESS_VIRTUAL IfcControl
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWorkCalendar
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWorkCalendar(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 769);
+        }
+
+        /// <summary>
+        /// Instances of IfcWorkCalendar in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWorkCalendar> Extent(SdaiModel model) { return ExtentRange<IfcWorkCalendar>(model, 769, false); }
+        static ExtentRange<IfcWorkCalendar> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWorkCalendar>(model, 769, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWorkCalendar and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWorkCalendar Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWorkCalendar"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWorkCalendar if the actual type of SdaiInstance is IfcWorkCalendar or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWorkCalendar CreateExactEntity(SdaiInstance instance) { return IfcWorkCalendar(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWorkCalendar or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWorkCalendar(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        //TList may be SetOfIfcWorkTime or list of convertible elements
+        template <typename TList> void get_WorkingTimes(TList& lst) { RDF_EXPRESS_PROBE(1676); SetOfIfcWorkTimeSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1676)); }
+
+        //TList may be SetOfIfcWorkTime or list of convertible elements
+        template <typename TList> void put_WorkingTimes(TList& lst) { RDF_EXPRESS_PROBE(1676); SetOfIfcWorkTimeSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1676)); }
+
+        //TArrayElem[] may be IfcWorkTime[] or array of convertible elements
+        template <typename TArrayElem> void put_WorkingTimes(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1676); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcWorkTimeSerializer<SetOfIfcWorkTime> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1676)); }
+
+        //TList may be SetOfIfcWorkTime or list of convertible elements
+        template <typename TList> void get_ExceptionTimes(TList& lst) { RDF_EXPRESS_PROBE(1677); SetOfIfcWorkTimeSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1677)); }
+
+        //TList may be SetOfIfcWorkTime or list of convertible elements
+        template <typename TList> void put_ExceptionTimes(TList& lst) { RDF_EXPRESS_PROBE(1677); SetOfIfcWorkTimeSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1677)); }
+
+        //TArrayElem[] may be IfcWorkTime[] or array of convertible elements
+        template <typename TArrayElem> void put_ExceptionTimes(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1677); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcWorkTimeSerializer<SetOfIfcWorkTime> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1677)); }
+
+        Nullable<IfcWorkCalendarTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1678); int v = getENUM(1678, IfcWorkCalendarTypeEnum_hash); if (v >= 0) return (IfcWorkCalendarTypeEnum) v; else return Nullable<IfcWorkCalendarTypeEnum>(); }
+        void put_PredefinedType(IfcWorkCalendarTypeEnum value) { RDF_EXPRESS_PROBE(1678); TextValue val = IfcWorkCalendarTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1678), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcControl::attr
+        {
+            static constexpr IntValue WorkingTimes = 1676;
+            static constexpr IntValue ExceptionTimes = 1677;
+            static constexpr IntValue PredefinedType = 1678;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWorkCalendar_CLASS_H
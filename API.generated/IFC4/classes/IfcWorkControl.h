@@ -0,0 +1,132 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWorkControl_CLASS_H
+#define __RDF_LTD__IFC4_IfcWorkControl_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcControl.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWorkControl
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWorkControl : public RDF_EXPRESS_VIRTUAL IfcControl
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWorkControl
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWorkControl(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 770);
+        }
+
+        /// <summary>
+        /// Instances of IfcWorkControl in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWorkControl> Extent(SdaiModel model) { return ExtentRange<IfcWorkControl>(model, 770, false); }
+        static ExtentRange<IfcWorkControl> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWorkControl>(model, 770, true); }
+
+        /// <summary>
+        /// Returns object of IfcWorkControl if the actual type of SdaiInstance is IfcWorkControl or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWorkControl CreateExactEntity(SdaiInstance instance) { return IfcWorkControl(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWorkControl or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWorkControl(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcDateTime get_CreationDate() { RDF_EXPRESS_PROBE(1679); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1679), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_CreationDate_view() { return TextView(get_CreationDate()); }
+#endif
+        void put_CreationDate(IfcDateTime value) { RDF_EXPRESS_PROBE(1679); sdaiPutAttr(m_instance, getAttrDefinition(1679), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_CreationDate_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1679); return buffer.GetAttr(m_instance, "CreationDate"); }
+        const char* get_CreationDate_utf8() { return get_CreationDate_utf8(ThreadUtf8Buffer()); }
+
+        //TList may be SetOfIfcPerson or list of convertible elements
+        template <typename TList> void get_Creators(TList& lst) { RDF_EXPRESS_PROBE(1680); SetOfIfcPersonSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(1680)); }
+
+        //TList may be SetOfIfcPerson or list of convertible elements
+        template <typename TList> void put_Creators(TList& lst) { RDF_EXPRESS_PROBE(1680); SetOfIfcPersonSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(1680)); }
+
+        //TArrayElem[] may be IfcPerson[] or array of convertible elements
+        template <typename TArrayElem> void put_Creators(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(1680); ArrayRange<TArrayElem> range = {arr, n}; SetOfIfcPersonSerializer<SetOfIfcPerson> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(1680)); }
+
+        IfcLabel get_Purpose() { RDF_EXPRESS_PROBE(1681); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1681), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Purpose_view() { return TextView(get_Purpose()); }
+#endif
+        void put_Purpose(IfcLabel value) { RDF_EXPRESS_PROBE(1681); sdaiPutAttr(m_instance, getAttrDefinition(1681), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Purpose_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1681); return buffer.GetAttr(m_instance, "Purpose"); }
+        const char* get_Purpose_utf8() { return get_Purpose_utf8(ThreadUtf8Buffer()); }
+
+        IfcDuration get_Duration() { RDF_EXPRESS_PROBE(1682); IfcDuration val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1682), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Duration_view() { return TextView(get_Duration()); }
+#endif
+        void put_Duration(IfcDuration value) { RDF_EXPRESS_PROBE(1682); sdaiPutAttr(m_instance, getAttrDefinition(1682), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Duration_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1682); return buffer.GetAttr(m_instance, "Duration"); }
+        const char* get_Duration_utf8() { return get_Duration_utf8(ThreadUtf8Buffer()); }
+
+        IfcDuration get_TotalFloat() { RDF_EXPRESS_PROBE(1683); IfcDuration val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1683), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_TotalFloat_view() { return TextView(get_TotalFloat()); }
+#endif
+        void put_TotalFloat(IfcDuration value) { RDF_EXPRESS_PROBE(1683); sdaiPutAttr(m_instance, getAttrDefinition(1683), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_TotalFloat_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1683); return buffer.GetAttr(m_instance, "TotalFloat"); }
+        const char* get_TotalFloat_utf8() { return get_TotalFloat_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_StartTime() { RDF_EXPRESS_PROBE(1684); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1684), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_StartTime_view() { return TextView(get_StartTime()); }
+#endif
+        void put_StartTime(IfcDateTime value) { RDF_EXPRESS_PROBE(1684); sdaiPutAttr(m_instance, getAttrDefinition(1684), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_StartTime_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1684); return buffer.GetAttr(m_instance, "StartTime"); }
+        const char* get_StartTime_utf8() { return get_StartTime_utf8(ThreadUtf8Buffer()); }
+
+        IfcDateTime get_FinishTime() { RDF_EXPRESS_PROBE(1685); IfcDateTime val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1685), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_FinishTime_view() { return TextView(get_FinishTime()); }
+#endif
+        void put_FinishTime(IfcDateTime value) { RDF_EXPRESS_PROBE(1685); sdaiPutAttr(m_instance, getAttrDefinition(1685), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_FinishTime_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1685); return buffer.GetAttr(m_instance, "FinishTime"); }
+        const char* get_FinishTime_utf8() { return get_FinishTime_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcControl::attr
+        {
+            static constexpr IntValue CreationDate = 1679;
+            static constexpr IntValue Creators = 1680;
+            static constexpr IntValue Purpose = 1681;
+            static constexpr IntValue Duration = 1682;
+            static constexpr IntValue TotalFloat = 1683;
+            static constexpr IntValue StartTime = 1684;
+            static constexpr IntValue FinishTime = 1685;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWorkControl_CLASS_H
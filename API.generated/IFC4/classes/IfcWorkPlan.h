@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWorkPlan_CLASS_H
+#define __RDF_LTD__IFC4_IfcWorkPlan_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcWorkControl.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWorkPlan
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWorkPlan : public RDF_EXPRESS_VIRTUAL IfcWorkControl
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWorkPlan
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWorkPlan(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 771);
+        }
+
+        /// <summary>
+        /// Instances of IfcWorkPlan in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWorkPlan> Extent(SdaiModel model) { return ExtentRange<IfcWorkPlan>(model, 771, false); }
+        static ExtentRange<IfcWorkPlan> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWorkPlan>(model, 771, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWorkPlan and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWorkPlan Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWorkPlan"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWorkPlan if the actual type of SdaiInstance is IfcWorkPlan or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWorkPlan CreateExactEntity(SdaiInstance instance) { return IfcWorkPlan(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWorkPlan or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWorkPlan(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcWorkPlanTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1686); int v = getENUM(1686, IfcWorkPlanTypeEnum_hash); if (v >= 0) return (IfcWorkPlanTypeEnum) v; else return Nullable<IfcWorkPlanTypeEnum>(); }
+        void put_PredefinedType(IfcWorkPlanTypeEnum value) { RDF_EXPRESS_PROBE(1686); TextValue val = IfcWorkPlanTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1686), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcWorkControl::attr
+        {
+            static constexpr IntValue PredefinedType = 1686;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWorkPlan_CLASS_H
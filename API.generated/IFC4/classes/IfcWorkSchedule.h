@@ -0,0 +1,64 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWorkSchedule_CLASS_H
+#define __RDF_LTD__IFC4_IfcWorkSchedule_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcWorkControl.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWorkSchedule
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWorkSchedule : public RDF_EXPRESS_VIRTUAL IfcWorkControl
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWorkSchedule
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWorkSchedule(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 772);
+        }
+
+        /// <summary>
+        /// Instances of IfcWorkSchedule in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWorkSchedule> Extent(SdaiModel model) { return ExtentRange<IfcWorkSchedule>(model, 772, false); }
+        static ExtentRange<IfcWorkSchedule> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWorkSchedule>(model, 772, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWorkSchedule and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWorkSchedule Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWorkSchedule"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWorkSchedule if the actual type of SdaiInstance is IfcWorkSchedule or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWorkSchedule CreateExactEntity(SdaiInstance instance) { return IfcWorkSchedule(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWorkSchedule or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWorkSchedule(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcWorkScheduleTypeEnum> get_PredefinedType() { RDF_EXPRESS_PROBE(1687); int v = getENUM(1687, IfcWorkScheduleTypeEnum_hash); if (v >= 0) return (IfcWorkScheduleTypeEnum) v; else return Nullable<IfcWorkScheduleTypeEnum>(); }
+        void put_PredefinedType(IfcWorkScheduleTypeEnum value) { RDF_EXPRESS_PROBE(1687); TextValue val = IfcWorkScheduleTypeEnum_[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(1687), sdaiENUM, val); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcWorkControl::attr
+        {
+            static constexpr IntValue PredefinedType = 1687;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWorkSchedule_CLASS_H
@@ -0,0 +1,86 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcWorkTime_CLASS_H
+#define __RDF_LTD__IFC4_IfcWorkTime_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSchedulingTime.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcWorkTime
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcWorkTime : public RDF_EXPRESS_VIRTUAL IfcSchedulingTime
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcWorkTime
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcWorkTime(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 773);
+        }
+
+        /// <summary>
+        /// Instances of IfcWorkTime in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcWorkTime> Extent(SdaiModel model) { return ExtentRange<IfcWorkTime>(model, 773, false); }
+        static ExtentRange<IfcWorkTime> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcWorkTime>(model, 773, true); }
+
+        /// <summary>
+        /// Create new instance of IfcWorkTime and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcWorkTime Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcWorkTime"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcWorkTime if the actual type of SdaiInstance is IfcWorkTime or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcWorkTime CreateExactEntity(SdaiInstance instance) { return IfcWorkTime(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcWorkTime or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcWorkTime(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcRecurrencePattern get_RecurrencePattern();
+        void put_RecurrencePattern(IfcRecurrencePattern inst);
+
+        IfcDate get_Start() { RDF_EXPRESS_PROBE(1689); IfcDate val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1689), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Start_view() { return TextView(get_Start()); }
+#endif
+        void put_Start(IfcDate value) { RDF_EXPRESS_PROBE(1689); sdaiPutAttr(m_instance, getAttrDefinition(1689), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Start_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1689); return buffer.GetAttr(m_instance, "Start"); }
+        const char* get_Start_utf8() { return get_Start_utf8(ThreadUtf8Buffer()); }
+
+        IfcDate get_Finish() { RDF_EXPRESS_PROBE(1690); IfcDate val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1690), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_Finish_view() { return TextView(get_Finish()); }
+#endif
+        void put_Finish(IfcDate value) { RDF_EXPRESS_PROBE(1690); sdaiPutAttr(m_instance, getAttrDefinition(1690), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_Finish_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1690); return buffer.GetAttr(m_instance, "Finish"); }
+        const char* get_Finish_utf8() { return get_Finish_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSchedulingTime::attr
+        {
+            static constexpr IntValue RecurrencePattern = 1688;
+            static constexpr IntValue Start = 1689;
+            static constexpr IntValue Finish = 1690;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcWorkTime_CLASS_H
@@ -0,0 +1,84 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcZShapeProfileDef_CLASS_H
+#define __RDF_LTD__IFC4_IfcZShapeProfileDef_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcParameterizedProfileDef.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcZShapeProfileDef
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcZShapeProfileDef : public RDF_EXPRESS_VIRTUAL IfcParameterizedProfileDef
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcZShapeProfileDef
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcZShapeProfileDef(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 775);
+        }
+
+        /// <summary>
+        /// Instances of IfcZShapeProfileDef in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcZShapeProfileDef> Extent(SdaiModel model) { return ExtentRange<IfcZShapeProfileDef>(model, 775, false); }
+        static ExtentRange<IfcZShapeProfileDef> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcZShapeProfileDef>(model, 775, true); }
+
+        /// <summary>
+        /// Create new instance of IfcZShapeProfileDef and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcZShapeProfileDef Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcZShapeProfileDef"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcZShapeProfileDef if the actual type of SdaiInstance is IfcZShapeProfileDef or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcZShapeProfileDef CreateExactEntity(SdaiInstance instance) { return IfcZShapeProfileDef(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcZShapeProfileDef or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcZShapeProfileDef(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        Nullable<IfcPositiveLengthMeasure> get_Depth() { RDF_EXPRESS_PROBE(1692); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1692), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_Depth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1692); sdaiPutAttr(m_instance, getAttrDefinition(1692), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_FlangeWidth() { RDF_EXPRESS_PROBE(1693); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1693), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_FlangeWidth(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1693); sdaiPutAttr(m_instance, getAttrDefinition(1693), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_WebThickness() { RDF_EXPRESS_PROBE(1694); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1694), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_WebThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1694); sdaiPutAttr(m_instance, getAttrDefinition(1694), sdaiREAL, &value); }
+
+        Nullable<IfcPositiveLengthMeasure> get_FlangeThickness() { RDF_EXPRESS_PROBE(1695); IfcPositiveLengthMeasure val = (IfcPositiveLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1695), sdaiREAL, &val)) return val; else return Nullable<IfcPositiveLengthMeasure>(); }
+        void put_FlangeThickness(IfcPositiveLengthMeasure value) { RDF_EXPRESS_PROBE(1695); sdaiPutAttr(m_instance, getAttrDefinition(1695), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_FilletRadius() { RDF_EXPRESS_PROBE(1696); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1696), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_FilletRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(1696); sdaiPutAttr(m_instance, getAttrDefinition(1696), sdaiREAL, &value); }
+
+        Nullable<IfcNonNegativeLengthMeasure> get_EdgeRadius() { RDF_EXPRESS_PROBE(1697); IfcNonNegativeLengthMeasure val = (IfcNonNegativeLengthMeasure) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(1697), sdaiREAL, &val)) return val; else return Nullable<IfcNonNegativeLengthMeasure>(); }
+        void put_EdgeRadius(IfcNonNegativeLengthMeasure value) { RDF_EXPRESS_PROBE(1697); sdaiPutAttr(m_instance, getAttrDefinition(1697), sdaiREAL, &value); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcParameterizedProfileDef::attr
+        {
+            static constexpr IntValue Depth = 1692;
+            static constexpr IntValue FlangeWidth = 1693;
+            static constexpr IntValue WebThickness = 1694;
+            static constexpr IntValue FlangeThickness = 1695;
+            static constexpr IntValue FilletRadius = 1696;
+            static constexpr IntValue EdgeRadius = 1697;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcZShapeProfileDef_CLASS_H
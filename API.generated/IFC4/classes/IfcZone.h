@@ -0,0 +1,71 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcZone_CLASS_H
+#define __RDF_LTD__IFC4_IfcZone_CLASS_H
+
+#include    "../IFC4_core.h"
+#include    "IfcSystem.h"
+
+namespace IFC4
+{
+
+        /// <summary>
+        /// Provides utility methods to interact with an instance of IfcZone
+        /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
+        /// </summary>
+    class IfcZone : public RDF_EXPRESS_VIRTUAL IfcSystem
+    {
+    public:
+        /// <summary>
+        /// Constructs object of this C++ class that wraps existing SdaiInstance of IfcZone
+        /// </summary>
+        /// <param name="instance">An instance to interact with</param>
+        IfcZone(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, 774);
+        }
+
+        /// <summary>
+        /// Instances of IfcZone in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<IfcZone> Extent(SdaiModel model) { return ExtentRange<IfcZone>(model, 774, false); }
+        static ExtentRange<IfcZone> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<IfcZone>(model, 774, true); }
+
+        /// <summary>
+        /// Create new instance of IfcZone and returns object of this C++ class to interact with
+        /// </summary>
+        static IfcZone Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "IfcZone"); assert(inst); return inst; }
+        /// <summary>
+        /// Returns object of IfcZone if the actual type of SdaiInstance is IfcZone or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
+        /// </summary>
+        static IfcZone CreateExactEntity(SdaiInstance instance) { return IfcZone(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is IfcZone or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return IfcZone(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
+
+        IfcLabel get_LongName() { RDF_EXPRESS_PROBE(1691); IfcLabel val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(1691), sdaiSTRING, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_LongName_view() { return TextView(get_LongName()); }
+#endif
+        void put_LongName(IfcLabel value) { RDF_EXPRESS_PROBE(1691); sdaiPutAttr(m_instance, getAttrDefinition(1691), sdaiSTRING, value); }
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_LongName_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(1691); return buffer.GetAttr(m_instance, "LongName"); }
+        const char* get_LongName_utf8() { return get_LongName_utf8(ThreadUtf8Buffer()); }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : IfcSystem::attr
+        {
+            static constexpr IntValue LongName = 1691;
+        };
+    };
+
+}
+
+#endif //__RDF_LTD__IFC4_IfcZone_CLASS_H
@@ -0,0 +1,28 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcActorSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcActorSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcOrganization.h"
+#include    "../classes/IfcPerson.h"
+#include    "../classes/IfcPersonAndOrganization.h"
+
+namespace IFC4
+{
+    inline IfcOrganization IfcActorSelect::get_IfcOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(398); }
+    inline void IfcActorSelect::put_IfcOrganization(IfcOrganization inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(398, inst); }
+    inline IfcPerson IfcActorSelect::get_IfcPerson() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(411); }
+    inline void IfcActorSelect::put_IfcPerson(IfcPerson inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(411, inst); }
+    inline IfcPersonAndOrganization IfcActorSelect::get_IfcPersonAndOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(412); }
+    inline void IfcActorSelect::put_IfcPersonAndOrganization(IfcPersonAndOrganization inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(412, inst); }
+    inline IfcOrganization IfcActorSelect_get::get_IfcOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(398); }
+    inline IfcPerson IfcActorSelect_get::get_IfcPerson() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(411); }
+    inline IfcPersonAndOrganization IfcActorSelect_get::get_IfcPersonAndOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(412); }
+    inline void IfcActorSelect_put::put_IfcOrganization(IfcOrganization inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(398, inst); }
+    inline void IfcActorSelect_put::put_IfcPerson(IfcPerson inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(411, inst); }
+    inline void IfcActorSelect_put::put_IfcPersonAndOrganization(IfcPersonAndOrganization inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(412, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcActorSelect_SELECT_H
@@ -0,0 +1,24 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAppliedValueSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcAppliedValueSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcMeasureWithUnit.h"
+#include    "../classes/IfcReference.h"
+#include    "IfcValue.h"
+
+namespace IFC4
+{
+    inline IfcMeasureWithUnit IfcAppliedValueSelect::get_IfcMeasureWithUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(374); }
+    inline void IfcAppliedValueSelect::put_IfcMeasureWithUnit(IfcMeasureWithUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(374, inst); }
+    inline IfcReference IfcAppliedValueSelect::get_IfcReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(506); }
+    inline void IfcAppliedValueSelect::put_IfcReference(IfcReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(506, inst); }
+    inline IfcMeasureWithUnit IfcAppliedValueSelect_get::get_IfcMeasureWithUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(374); }
+    inline IfcReference IfcAppliedValueSelect_get::get_IfcReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(506); }
+    inline void IfcAppliedValueSelect_put::put_IfcMeasureWithUnit(IfcMeasureWithUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(374, inst); }
+    inline void IfcAppliedValueSelect_put::put_IfcReference(IfcReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(506, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcAppliedValueSelect_SELECT_H
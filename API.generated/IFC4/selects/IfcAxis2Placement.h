@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcAxis2Placement_SELECT_H
+#define __RDF_LTD__IFC4_IfcAxis2Placement_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcAxis2Placement2D.h"
+#include    "../classes/IfcAxis2Placement3D.h"
+
+namespace IFC4
+{
+    inline IfcAxis2Placement2D IfcAxis2Placement::get_IfcAxis2Placement2D() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(31); }
+    inline void IfcAxis2Placement::put_IfcAxis2Placement2D(IfcAxis2Placement2D inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(31, inst); }
+    inline IfcAxis2Placement3D IfcAxis2Placement::get_IfcAxis2Placement3D() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(32); }
+    inline void IfcAxis2Placement::put_IfcAxis2Placement3D(IfcAxis2Placement3D inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(32, inst); }
+    inline IfcAxis2Placement2D IfcAxis2Placement_get::get_IfcAxis2Placement2D() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(31); }
+    inline IfcAxis2Placement3D IfcAxis2Placement_get::get_IfcAxis2Placement3D() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(32); }
+    inline void IfcAxis2Placement_put::put_IfcAxis2Placement2D(IfcAxis2Placement2D inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(31, inst); }
+    inline void IfcAxis2Placement_put::put_IfcAxis2Placement3D(IfcAxis2Placement3D inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(32, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcAxis2Placement_SELECT_H
@@ -0,0 +1,38 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcBooleanOperand_SELECT_H
+#define __RDF_LTD__IFC4_IfcBooleanOperand_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcBooleanResult.h"
+#include    "../classes/IfcCsgPrimitive3D.h"
+#include    "../classes/IfcHalfSpaceSolid.h"
+#include    "../classes/IfcSolidModel.h"
+#include    "../classes/IfcTessellatedFaceSet.h"
+
+namespace IFC4
+{
+    inline IfcBooleanResult IfcBooleanOperand::get_IfcBooleanResult() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(41); }
+    inline void IfcBooleanOperand::put_IfcBooleanResult(IfcBooleanResult inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(41, inst); }
+    inline IfcCsgPrimitive3D IfcBooleanOperand::get_IfcCsgPrimitive3D() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(154); }
+    inline void IfcBooleanOperand::put_IfcCsgPrimitive3D(IfcCsgPrimitive3D inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(154, inst); }
+    inline IfcHalfSpaceSolid IfcBooleanOperand::get_IfcHalfSpaceSolid() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(310); }
+    inline void IfcBooleanOperand::put_IfcHalfSpaceSolid(IfcHalfSpaceSolid inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(310, inst); }
+    inline IfcSolidModel IfcBooleanOperand::get_IfcSolidModel() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(608); }
+    inline void IfcBooleanOperand::put_IfcSolidModel(IfcSolidModel inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(608, inst); }
+    inline IfcTessellatedFaceSet IfcBooleanOperand::get_IfcTessellatedFaceSet() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(707); }
+    inline void IfcBooleanOperand::put_IfcTessellatedFaceSet(IfcTessellatedFaceSet inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(707, inst); }
+    inline IfcBooleanResult IfcBooleanOperand_get::get_IfcBooleanResult() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(41); }
+    inline IfcCsgPrimitive3D IfcBooleanOperand_get::get_IfcCsgPrimitive3D() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(154); }
+    inline IfcHalfSpaceSolid IfcBooleanOperand_get::get_IfcHalfSpaceSolid() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(310); }
+    inline IfcSolidModel IfcBooleanOperand_get::get_IfcSolidModel() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(608); }
+    inline IfcTessellatedFaceSet IfcBooleanOperand_get::get_IfcTessellatedFaceSet() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(707); }
+    inline void IfcBooleanOperand_put::put_IfcBooleanResult(IfcBooleanResult inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(41, inst); }
+    inline void IfcBooleanOperand_put::put_IfcCsgPrimitive3D(IfcCsgPrimitive3D inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(154, inst); }
+    inline void IfcBooleanOperand_put::put_IfcHalfSpaceSolid(IfcHalfSpaceSolid inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(310, inst); }
+    inline void IfcBooleanOperand_put::put_IfcSolidModel(IfcSolidModel inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(608, inst); }
+    inline void IfcBooleanOperand_put::put_IfcTessellatedFaceSet(IfcTessellatedFaceSet inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(707, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcBooleanOperand_SELECT_H
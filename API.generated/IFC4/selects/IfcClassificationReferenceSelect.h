@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcClassificationReferenceSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcClassificationReferenceSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcClassification.h"
+#include    "../classes/IfcClassificationReference.h"
+
+namespace IFC4
+{
+    inline IfcClassification IfcClassificationReferenceSelect::get_IfcClassification() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(94); }
+    inline void IfcClassificationReferenceSelect::put_IfcClassification(IfcClassification inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(94, inst); }
+    inline IfcClassificationReference IfcClassificationReferenceSelect::get_IfcClassificationReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(95); }
+    inline void IfcClassificationReferenceSelect::put_IfcClassificationReference(IfcClassificationReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(95, inst); }
+    inline IfcClassification IfcClassificationReferenceSelect_get::get_IfcClassification() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(94); }
+    inline IfcClassificationReference IfcClassificationReferenceSelect_get::get_IfcClassificationReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(95); }
+    inline void IfcClassificationReferenceSelect_put::put_IfcClassification(IfcClassification inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(94, inst); }
+    inline void IfcClassificationReferenceSelect_put::put_IfcClassificationReference(IfcClassificationReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(95, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcClassificationReferenceSelect_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcClassificationSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcClassificationSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcClassification.h"
+#include    "../classes/IfcClassificationReference.h"
+
+namespace IFC4
+{
+    inline IfcClassification IfcClassificationSelect::get_IfcClassification() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(94); }
+    inline void IfcClassificationSelect::put_IfcClassification(IfcClassification inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(94, inst); }
+    inline IfcClassificationReference IfcClassificationSelect::get_IfcClassificationReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(95); }
+    inline void IfcClassificationSelect::put_IfcClassificationReference(IfcClassificationReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(95, inst); }
+    inline IfcClassification IfcClassificationSelect_get::get_IfcClassification() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(94); }
+    inline IfcClassificationReference IfcClassificationSelect_get::get_IfcClassificationReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(95); }
+    inline void IfcClassificationSelect_put::put_IfcClassification(IfcClassification inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(94, inst); }
+    inline void IfcClassificationSelect_put::put_IfcClassificationReference(IfcClassificationReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(95, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcClassificationSelect_SELECT_H
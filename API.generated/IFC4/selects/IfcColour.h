@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcColour_SELECT_H
+#define __RDF_LTD__IFC4_IfcColour_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcColourSpecification.h"
+#include    "../classes/IfcPreDefinedColour.h"
+
+namespace IFC4
+{
+    inline IfcColourSpecification IfcColour::get_IfcColourSpecification() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(101); }
+    inline void IfcColour::put_IfcColourSpecification(IfcColourSpecification inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(101, inst); }
+    inline IfcPreDefinedColour IfcColour::get_IfcPreDefinedColour() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(439); }
+    inline void IfcColour::put_IfcPreDefinedColour(IfcPreDefinedColour inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(439, inst); }
+    inline IfcColourSpecification IfcColour_get::get_IfcColourSpecification() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(101); }
+    inline IfcPreDefinedColour IfcColour_get::get_IfcPreDefinedColour() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(439); }
+    inline void IfcColour_put::put_IfcColourSpecification(IfcColourSpecification inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(101, inst); }
+    inline void IfcColour_put::put_IfcPreDefinedColour(IfcPreDefinedColour inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(439, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcColour_SELECT_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcColourOrFactor_SELECT_H
+#define __RDF_LTD__IFC4_IfcColourOrFactor_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcColourRgb.h"
+
+namespace IFC4
+{
+    inline IfcColourRgb IfcColourOrFactor::get_IfcColourRgb() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(99); }
+    inline void IfcColourOrFactor::put_IfcColourRgb(IfcColourRgb inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(99, inst); }
+    inline IfcColourRgb IfcColourOrFactor_get::get_IfcColourRgb() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(99); }
+    inline void IfcColourOrFactor_put::put_IfcColourRgb(IfcColourRgb inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(99, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcColourOrFactor_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCoordinateReferenceSystemSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcCoordinateReferenceSystemSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcCoordinateReferenceSystem.h"
+#include    "../classes/IfcGeometricRepresentationContext.h"
+
+namespace IFC4
+{
+    inline IfcCoordinateReferenceSystem IfcCoordinateReferenceSystemSelect::get_IfcCoordinateReferenceSystem() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(146); }
+    inline void IfcCoordinateReferenceSystemSelect::put_IfcCoordinateReferenceSystem(IfcCoordinateReferenceSystem inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(146, inst); }
+    inline IfcGeometricRepresentationContext IfcCoordinateReferenceSystemSelect::get_IfcGeometricRepresentationContext() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(302); }
+    inline void IfcCoordinateReferenceSystemSelect::put_IfcGeometricRepresentationContext(IfcGeometricRepresentationContext inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(302, inst); }
+    inline IfcCoordinateReferenceSystem IfcCoordinateReferenceSystemSelect_get::get_IfcCoordinateReferenceSystem() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(146); }
+    inline IfcGeometricRepresentationContext IfcCoordinateReferenceSystemSelect_get::get_IfcGeometricRepresentationContext() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(302); }
+    inline void IfcCoordinateReferenceSystemSelect_put::put_IfcCoordinateReferenceSystem(IfcCoordinateReferenceSystem inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(146, inst); }
+    inline void IfcCoordinateReferenceSystemSelect_put::put_IfcGeometricRepresentationContext(IfcGeometricRepresentationContext inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(302, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcCoordinateReferenceSystemSelect_SELECT_H
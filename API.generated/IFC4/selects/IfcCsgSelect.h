@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCsgSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcCsgSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcBooleanResult.h"
+#include    "../classes/IfcCsgPrimitive3D.h"
+
+namespace IFC4
+{
+    inline IfcBooleanResult IfcCsgSelect::get_IfcBooleanResult() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(41); }
+    inline void IfcCsgSelect::put_IfcBooleanResult(IfcBooleanResult inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(41, inst); }
+    inline IfcCsgPrimitive3D IfcCsgSelect::get_IfcCsgPrimitive3D() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(154); }
+    inline void IfcCsgSelect::put_IfcCsgPrimitive3D(IfcCsgPrimitive3D inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(154, inst); }
+    inline IfcBooleanResult IfcCsgSelect_get::get_IfcBooleanResult() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(41); }
+    inline IfcCsgPrimitive3D IfcCsgSelect_get::get_IfcCsgPrimitive3D() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(154); }
+    inline void IfcCsgSelect_put::put_IfcBooleanResult(IfcBooleanResult inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(41, inst); }
+    inline void IfcCsgSelect_put::put_IfcCsgPrimitive3D(IfcCsgPrimitive3D inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(154, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcCsgSelect_SELECT_H
@@ -0,0 +1,19 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveFontOrScaledCurveFontSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcCurveFontOrScaledCurveFontSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcCurveStyleFontAndScaling.h"
+#include    "IfcCurveStyleFontSelect.h"
+
+namespace IFC4
+{
+    inline IfcCurveStyleFontAndScaling IfcCurveFontOrScaledCurveFontSelect::get_IfcCurveStyleFontAndScaling() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(165); }
+    inline void IfcCurveFontOrScaledCurveFontSelect::put_IfcCurveStyleFontAndScaling(IfcCurveStyleFontAndScaling inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(165, inst); }
+    inline IfcCurveStyleFontAndScaling IfcCurveFontOrScaledCurveFontSelect_get::get_IfcCurveStyleFontAndScaling() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(165); }
+    inline void IfcCurveFontOrScaledCurveFontSelect_put::put_IfcCurveStyleFontAndScaling(IfcCurveStyleFontAndScaling inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(165, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveFontOrScaledCurveFontSelect_SELECT_H
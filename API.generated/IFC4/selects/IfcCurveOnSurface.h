@@ -0,0 +1,28 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveOnSurface_SELECT_H
+#define __RDF_LTD__IFC4_IfcCurveOnSurface_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcCompositeCurveOnSurface.h"
+#include    "../classes/IfcPcurve.h"
+#include    "../classes/IfcSurfaceCurve.h"
+
+namespace IFC4
+{
+    inline IfcCompositeCurveOnSurface IfcCurveOnSurface::get_IfcCompositeCurveOnSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(110); }
+    inline void IfcCurveOnSurface::put_IfcCompositeCurveOnSurface(IfcCompositeCurveOnSurface inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(110, inst); }
+    inline IfcPcurve IfcCurveOnSurface::get_IfcPcurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(407); }
+    inline void IfcCurveOnSurface::put_IfcPcurve(IfcPcurve inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(407, inst); }
+    inline IfcSurfaceCurve IfcCurveOnSurface::get_IfcSurfaceCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(671); }
+    inline void IfcCurveOnSurface::put_IfcSurfaceCurve(IfcSurfaceCurve inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(671, inst); }
+    inline IfcCompositeCurveOnSurface IfcCurveOnSurface_get::get_IfcCompositeCurveOnSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(110); }
+    inline IfcPcurve IfcCurveOnSurface_get::get_IfcPcurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(407); }
+    inline IfcSurfaceCurve IfcCurveOnSurface_get::get_IfcSurfaceCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(671); }
+    inline void IfcCurveOnSurface_put::put_IfcCompositeCurveOnSurface(IfcCompositeCurveOnSurface inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(110, inst); }
+    inline void IfcCurveOnSurface_put::put_IfcPcurve(IfcPcurve inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(407, inst); }
+    inline void IfcCurveOnSurface_put::put_IfcSurfaceCurve(IfcSurfaceCurve inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(671, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveOnSurface_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveOrEdgeCurve_SELECT_H
+#define __RDF_LTD__IFC4_IfcCurveOrEdgeCurve_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcBoundedCurve.h"
+#include    "../classes/IfcEdgeCurve.h"
+
+namespace IFC4
+{
+    inline IfcBoundedCurve IfcCurveOrEdgeCurve::get_IfcBoundedCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(48); }
+    inline void IfcCurveOrEdgeCurve::put_IfcBoundedCurve(IfcBoundedCurve inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(48, inst); }
+    inline IfcEdgeCurve IfcCurveOrEdgeCurve::get_IfcEdgeCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(206); }
+    inline void IfcCurveOrEdgeCurve::put_IfcEdgeCurve(IfcEdgeCurve inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(206, inst); }
+    inline IfcBoundedCurve IfcCurveOrEdgeCurve_get::get_IfcBoundedCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(48); }
+    inline IfcEdgeCurve IfcCurveOrEdgeCurve_get::get_IfcEdgeCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(206); }
+    inline void IfcCurveOrEdgeCurve_put::put_IfcBoundedCurve(IfcBoundedCurve inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(48, inst); }
+    inline void IfcCurveOrEdgeCurve_put::put_IfcEdgeCurve(IfcEdgeCurve inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(206, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveOrEdgeCurve_SELECT_H
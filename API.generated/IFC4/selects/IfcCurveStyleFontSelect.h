@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcCurveStyleFontSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcCurveStyleFontSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcCurveStyleFont.h"
+#include    "../classes/IfcPreDefinedCurveFont.h"
+
+namespace IFC4
+{
+    inline IfcCurveStyleFont IfcCurveStyleFontSelect::get_IfcCurveStyleFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(164); }
+    inline void IfcCurveStyleFontSelect::put_IfcCurveStyleFont(IfcCurveStyleFont inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(164, inst); }
+    inline IfcPreDefinedCurveFont IfcCurveStyleFontSelect::get_IfcPreDefinedCurveFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(440); }
+    inline void IfcCurveStyleFontSelect::put_IfcPreDefinedCurveFont(IfcPreDefinedCurveFont inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(440, inst); }
+    inline IfcCurveStyleFont IfcCurveStyleFontSelect_get::get_IfcCurveStyleFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(164); }
+    inline IfcPreDefinedCurveFont IfcCurveStyleFontSelect_get::get_IfcPreDefinedCurveFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(440); }
+    inline void IfcCurveStyleFontSelect_put::put_IfcCurveStyleFont(IfcCurveStyleFont inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(164, inst); }
+    inline void IfcCurveStyleFontSelect_put::put_IfcPreDefinedCurveFont(IfcPreDefinedCurveFont inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(440, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcCurveStyleFontSelect_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDefinitionSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcDefinitionSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcObjectDefinition.h"
+#include    "../classes/IfcPropertyDefinition.h"
+
+namespace IFC4
+{
+    inline IfcObjectDefinition IfcDefinitionSelect::get_IfcObjectDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(389); }
+    inline void IfcDefinitionSelect::put_IfcObjectDefinition(IfcObjectDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(389, inst); }
+    inline IfcPropertyDefinition IfcDefinitionSelect::get_IfcPropertyDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(466); }
+    inline void IfcDefinitionSelect::put_IfcPropertyDefinition(IfcPropertyDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(466, inst); }
+    inline IfcObjectDefinition IfcDefinitionSelect_get::get_IfcObjectDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(389); }
+    inline IfcPropertyDefinition IfcDefinitionSelect_get::get_IfcPropertyDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(466); }
+    inline void IfcDefinitionSelect_put::put_IfcObjectDefinition(IfcObjectDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(389, inst); }
+    inline void IfcDefinitionSelect_put::put_IfcPropertyDefinition(IfcPropertyDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(466, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcDefinitionSelect_SELECT_H
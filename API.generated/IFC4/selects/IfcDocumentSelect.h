@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcDocumentSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcDocumentSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcDocumentInformation.h"
+#include    "../classes/IfcDocumentReference.h"
+
+namespace IFC4
+{
+    inline IfcDocumentInformation IfcDocumentSelect::get_IfcDocumentInformation() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(188); }
+    inline void IfcDocumentSelect::put_IfcDocumentInformation(IfcDocumentInformation inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(188, inst); }
+    inline IfcDocumentReference IfcDocumentSelect::get_IfcDocumentReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(190); }
+    inline void IfcDocumentSelect::put_IfcDocumentReference(IfcDocumentReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(190, inst); }
+    inline IfcDocumentInformation IfcDocumentSelect_get::get_IfcDocumentInformation() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(188); }
+    inline IfcDocumentReference IfcDocumentSelect_get::get_IfcDocumentReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(190); }
+    inline void IfcDocumentSelect_put::put_IfcDocumentInformation(IfcDocumentInformation inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(188, inst); }
+    inline void IfcDocumentSelect_put::put_IfcDocumentReference(IfcDocumentReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(190, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcDocumentSelect_SELECT_H
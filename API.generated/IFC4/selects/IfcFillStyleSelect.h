@@ -0,0 +1,29 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcFillStyleSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcFillStyleSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcExternallyDefinedHatchStyle.h"
+#include    "../classes/IfcFillAreaStyleHatching.h"
+#include    "../classes/IfcFillAreaStyleTiles.h"
+#include    "IfcColour.h"
+
+namespace IFC4
+{
+    inline IfcExternallyDefinedHatchStyle IfcFillStyleSelect::get_IfcExternallyDefinedHatchStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(243); }
+    inline void IfcFillStyleSelect::put_IfcExternallyDefinedHatchStyle(IfcExternallyDefinedHatchStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(243, inst); }
+    inline IfcFillAreaStyleHatching IfcFillStyleSelect::get_IfcFillAreaStyleHatching() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(268); }
+    inline void IfcFillStyleSelect::put_IfcFillAreaStyleHatching(IfcFillAreaStyleHatching inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(268, inst); }
+    inline IfcFillAreaStyleTiles IfcFillStyleSelect::get_IfcFillAreaStyleTiles() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(269); }
+    inline void IfcFillStyleSelect::put_IfcFillAreaStyleTiles(IfcFillAreaStyleTiles inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(269, inst); }
+    inline IfcExternallyDefinedHatchStyle IfcFillStyleSelect_get::get_IfcExternallyDefinedHatchStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(243); }
+    inline IfcFillAreaStyleHatching IfcFillStyleSelect_get::get_IfcFillAreaStyleHatching() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(268); }
+    inline IfcFillAreaStyleTiles IfcFillStyleSelect_get::get_IfcFillAreaStyleTiles() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(269); }
+    inline void IfcFillStyleSelect_put::put_IfcExternallyDefinedHatchStyle(IfcExternallyDefinedHatchStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(243, inst); }
+    inline void IfcFillStyleSelect_put::put_IfcFillAreaStyleHatching(IfcFillAreaStyleHatching inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(268, inst); }
+    inline void IfcFillStyleSelect_put::put_IfcFillAreaStyleTiles(IfcFillAreaStyleTiles inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(269, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcFillStyleSelect_SELECT_H
@@ -0,0 +1,28 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGeometricSetSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcGeometricSetSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcCurve.h"
+#include    "../classes/IfcPoint.h"
+#include    "../classes/IfcSurface.h"
+
+namespace IFC4
+{
+    inline IfcCurve IfcGeometricSetSelect::get_IfcCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(160); }
+    inline void IfcGeometricSetSelect::put_IfcCurve(IfcCurve inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(160, inst); }
+    inline IfcPoint IfcGeometricSetSelect::get_IfcPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(430); }
+    inline void IfcGeometricSetSelect::put_IfcPoint(IfcPoint inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(430, inst); }
+    inline IfcSurface IfcGeometricSetSelect::get_IfcSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(670); }
+    inline void IfcGeometricSetSelect::put_IfcSurface(IfcSurface inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(670, inst); }
+    inline IfcCurve IfcGeometricSetSelect_get::get_IfcCurve() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(160); }
+    inline IfcPoint IfcGeometricSetSelect_get::get_IfcPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(430); }
+    inline IfcSurface IfcGeometricSetSelect_get::get_IfcSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(670); }
+    inline void IfcGeometricSetSelect_put::put_IfcCurve(IfcCurve inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(160, inst); }
+    inline void IfcGeometricSetSelect_put::put_IfcPoint(IfcPoint inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(430, inst); }
+    inline void IfcGeometricSetSelect_put::put_IfcSurface(IfcSurface inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(670, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcGeometricSetSelect_SELECT_H
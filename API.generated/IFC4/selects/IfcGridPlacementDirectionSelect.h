@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcGridPlacementDirectionSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcGridPlacementDirectionSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcDirection.h"
+#include    "../classes/IfcVirtualGridIntersection.h"
+
+namespace IFC4
+{
+    inline IfcDirection IfcGridPlacementDirectionSelect::get_IfcDirection() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(174); }
+    inline void IfcGridPlacementDirectionSelect::put_IfcDirection(IfcDirection inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(174, inst); }
+    inline IfcVirtualGridIntersection IfcGridPlacementDirectionSelect::get_IfcVirtualGridIntersection() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(755); }
+    inline void IfcGridPlacementDirectionSelect::put_IfcVirtualGridIntersection(IfcVirtualGridIntersection inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(755, inst); }
+    inline IfcDirection IfcGridPlacementDirectionSelect_get::get_IfcDirection() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(174); }
+    inline IfcVirtualGridIntersection IfcGridPlacementDirectionSelect_get::get_IfcVirtualGridIntersection() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(755); }
+    inline void IfcGridPlacementDirectionSelect_put::put_IfcDirection(IfcDirection inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(174, inst); }
+    inline void IfcGridPlacementDirectionSelect_put::put_IfcVirtualGridIntersection(IfcVirtualGridIntersection inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(755, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcGridPlacementDirectionSelect_SELECT_H
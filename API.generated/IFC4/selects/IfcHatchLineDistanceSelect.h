@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcHatchLineDistanceSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcHatchLineDistanceSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcVector.h"
+
+namespace IFC4
+{
+    inline IfcVector IfcHatchLineDistanceSelect::get_IfcVector() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(748); }
+    inline void IfcHatchLineDistanceSelect::put_IfcVector(IfcVector inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(748, inst); }
+    inline IfcVector IfcHatchLineDistanceSelect_get::get_IfcVector() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(748); }
+    inline void IfcHatchLineDistanceSelect_put::put_IfcVector(IfcVector inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(748, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcHatchLineDistanceSelect_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLayeredItem_SELECT_H
+#define __RDF_LTD__IFC4_IfcLayeredItem_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcRepresentation.h"
+#include    "../classes/IfcRepresentationItem.h"
+
+namespace IFC4
+{
+    inline IfcRepresentation IfcLayeredItem::get_IfcRepresentation() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(565); }
+    inline void IfcLayeredItem::put_IfcRepresentation(IfcRepresentation inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(565, inst); }
+    inline IfcRepresentationItem IfcLayeredItem::get_IfcRepresentationItem() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(567); }
+    inline void IfcLayeredItem::put_IfcRepresentationItem(IfcRepresentationItem inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(567, inst); }
+    inline IfcRepresentation IfcLayeredItem_get::get_IfcRepresentation() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(565); }
+    inline IfcRepresentationItem IfcLayeredItem_get::get_IfcRepresentationItem() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(567); }
+    inline void IfcLayeredItem_put::put_IfcRepresentation(IfcRepresentation inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(565, inst); }
+    inline void IfcLayeredItem_put::put_IfcRepresentationItem(IfcRepresentationItem inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(567, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcLayeredItem_SELECT_H
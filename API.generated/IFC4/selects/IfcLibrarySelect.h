@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLibrarySelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcLibrarySelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcLibraryInformation.h"
+#include    "../classes/IfcLibraryReference.h"
+
+namespace IFC4
+{
+    inline IfcLibraryInformation IfcLibrarySelect::get_IfcLibraryInformation() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(336); }
+    inline void IfcLibrarySelect::put_IfcLibraryInformation(IfcLibraryInformation inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(336, inst); }
+    inline IfcLibraryReference IfcLibrarySelect::get_IfcLibraryReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(337); }
+    inline void IfcLibrarySelect::put_IfcLibraryReference(IfcLibraryReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(337, inst); }
+    inline IfcLibraryInformation IfcLibrarySelect_get::get_IfcLibraryInformation() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(336); }
+    inline IfcLibraryReference IfcLibrarySelect_get::get_IfcLibraryReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(337); }
+    inline void IfcLibrarySelect_put::put_IfcLibraryInformation(IfcLibraryInformation inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(336, inst); }
+    inline void IfcLibrarySelect_put::put_IfcLibraryReference(IfcLibraryReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(337, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcLibrarySelect_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightDistributionDataSourceSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcLightDistributionDataSourceSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcExternalReference.h"
+#include    "../classes/IfcLightIntensityDistribution.h"
+
+namespace IFC4
+{
+    inline IfcExternalReference IfcLightDistributionDataSourceSelect::get_IfcExternalReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(246); }
+    inline void IfcLightDistributionDataSourceSelect::put_IfcExternalReference(IfcExternalReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(246, inst); }
+    inline IfcLightIntensityDistribution IfcLightDistributionDataSourceSelect::get_IfcLightIntensityDistribution() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(341); }
+    inline void IfcLightDistributionDataSourceSelect::put_IfcLightIntensityDistribution(IfcLightIntensityDistribution inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(341, inst); }
+    inline IfcExternalReference IfcLightDistributionDataSourceSelect_get::get_IfcExternalReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(246); }
+    inline IfcLightIntensityDistribution IfcLightDistributionDataSourceSelect_get::get_IfcLightIntensityDistribution() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(341); }
+    inline void IfcLightDistributionDataSourceSelect_put::put_IfcExternalReference(IfcExternalReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(246, inst); }
+    inline void IfcLightDistributionDataSourceSelect_put::put_IfcLightIntensityDistribution(IfcLightIntensityDistribution inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(341, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcLightDistributionDataSourceSelect_SELECT_H
@@ -0,0 +1,9 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcLightDistributionDataSourceSelect_get_SELECT_H
+#define __RDF_LTD__IFC4_IfcLightDistributionDataSourceSelect_get_SELECT_H
+
+#include    "../IFC4_core.h"
+
+#endif //__RDF_LTD__IFC4_IfcLightDistributionDataSourceSelect_get_SELECT_H
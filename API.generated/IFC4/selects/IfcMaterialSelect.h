@@ -0,0 +1,28 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMaterialSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcMaterialSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcMaterialDefinition.h"
+#include    "../classes/IfcMaterialList.h"
+#include    "../classes/IfcMaterialUsageDefinition.h"
+
+namespace IFC4
+{
+    inline IfcMaterialDefinition IfcMaterialSelect::get_IfcMaterialDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(359); }
+    inline void IfcMaterialSelect::put_IfcMaterialDefinition(IfcMaterialDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(359, inst); }
+    inline IfcMaterialList IfcMaterialSelect::get_IfcMaterialList() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(365); }
+    inline void IfcMaterialSelect::put_IfcMaterialList(IfcMaterialList inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(365, inst); }
+    inline IfcMaterialUsageDefinition IfcMaterialSelect::get_IfcMaterialUsageDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(373); }
+    inline void IfcMaterialSelect::put_IfcMaterialUsageDefinition(IfcMaterialUsageDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(373, inst); }
+    inline IfcMaterialDefinition IfcMaterialSelect_get::get_IfcMaterialDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(359); }
+    inline IfcMaterialList IfcMaterialSelect_get::get_IfcMaterialList() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(365); }
+    inline IfcMaterialUsageDefinition IfcMaterialSelect_get::get_IfcMaterialUsageDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(373); }
+    inline void IfcMaterialSelect_put::put_IfcMaterialDefinition(IfcMaterialDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(359, inst); }
+    inline void IfcMaterialSelect_put::put_IfcMaterialList(IfcMaterialList inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(365, inst); }
+    inline void IfcMaterialSelect_put::put_IfcMaterialUsageDefinition(IfcMaterialUsageDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(373, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcMaterialSelect_SELECT_H
@@ -0,0 +1,39 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcMetricValueSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcMetricValueSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcAppliedValue.h"
+#include    "../classes/IfcMeasureWithUnit.h"
+#include    "../classes/IfcReference.h"
+#include    "../classes/IfcTable.h"
+#include    "../classes/IfcTimeSeries.h"
+#include    "IfcValue.h"
+
+namespace IFC4
+{
+    inline IfcAppliedValue IfcMetricValueSelect::get_IfcAppliedValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(20); }
+    inline void IfcMetricValueSelect::put_IfcAppliedValue(IfcAppliedValue inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(20, inst); }
+    inline IfcMeasureWithUnit IfcMetricValueSelect::get_IfcMeasureWithUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(374); }
+    inline void IfcMetricValueSelect::put_IfcMeasureWithUnit(IfcMeasureWithUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(374, inst); }
+    inline IfcReference IfcMetricValueSelect::get_IfcReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(506); }
+    inline void IfcMetricValueSelect::put_IfcReference(IfcReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(506, inst); }
+    inline IfcTable IfcMetricValueSelect::get_IfcTable() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(693); }
+    inline void IfcMetricValueSelect::put_IfcTable(IfcTable inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(693, inst); }
+    inline IfcTimeSeries IfcMetricValueSelect::get_IfcTimeSeries() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(721); }
+    inline void IfcMetricValueSelect::put_IfcTimeSeries(IfcTimeSeries inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(721, inst); }
+    inline IfcAppliedValue IfcMetricValueSelect_get::get_IfcAppliedValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(20); }
+    inline IfcMeasureWithUnit IfcMetricValueSelect_get::get_IfcMeasureWithUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(374); }
+    inline IfcReference IfcMetricValueSelect_get::get_IfcReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(506); }
+    inline IfcTable IfcMetricValueSelect_get::get_IfcTable() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(693); }
+    inline IfcTimeSeries IfcMetricValueSelect_get::get_IfcTimeSeries() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(721); }
+    inline void IfcMetricValueSelect_put::put_IfcAppliedValue(IfcAppliedValue inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(20, inst); }
+    inline void IfcMetricValueSelect_put::put_IfcMeasureWithUnit(IfcMeasureWithUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(374, inst); }
+    inline void IfcMetricValueSelect_put::put_IfcReference(IfcReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(506, inst); }
+    inline void IfcMetricValueSelect_put::put_IfcTable(IfcTable inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(693, inst); }
+    inline void IfcMetricValueSelect_put::put_IfcTimeSeries(IfcTimeSeries inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(721, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcMetricValueSelect_SELECT_H
@@ -0,0 +1,58 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcObjectReferenceSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcObjectReferenceSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcAddress.h"
+#include    "../classes/IfcAppliedValue.h"
+#include    "../classes/IfcExternalReference.h"
+#include    "../classes/IfcMaterialDefinition.h"
+#include    "../classes/IfcOrganization.h"
+#include    "../classes/IfcPerson.h"
+#include    "../classes/IfcPersonAndOrganization.h"
+#include    "../classes/IfcTable.h"
+#include    "../classes/IfcTimeSeries.h"
+
+namespace IFC4
+{
+    inline IfcAddress IfcObjectReferenceSelect::get_IfcAddress() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(5); }
+    inline void IfcObjectReferenceSelect::put_IfcAddress(IfcAddress inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(5, inst); }
+    inline IfcAppliedValue IfcObjectReferenceSelect::get_IfcAppliedValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(20); }
+    inline void IfcObjectReferenceSelect::put_IfcAppliedValue(IfcAppliedValue inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(20, inst); }
+    inline IfcExternalReference IfcObjectReferenceSelect::get_IfcExternalReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(246); }
+    inline void IfcObjectReferenceSelect::put_IfcExternalReference(IfcExternalReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(246, inst); }
+    inline IfcMaterialDefinition IfcObjectReferenceSelect::get_IfcMaterialDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(359); }
+    inline void IfcObjectReferenceSelect::put_IfcMaterialDefinition(IfcMaterialDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(359, inst); }
+    inline IfcOrganization IfcObjectReferenceSelect::get_IfcOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(398); }
+    inline void IfcObjectReferenceSelect::put_IfcOrganization(IfcOrganization inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(398, inst); }
+    inline IfcPerson IfcObjectReferenceSelect::get_IfcPerson() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(411); }
+    inline void IfcObjectReferenceSelect::put_IfcPerson(IfcPerson inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(411, inst); }
+    inline IfcPersonAndOrganization IfcObjectReferenceSelect::get_IfcPersonAndOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(412); }
+    inline void IfcObjectReferenceSelect::put_IfcPersonAndOrganization(IfcPersonAndOrganization inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(412, inst); }
+    inline IfcTable IfcObjectReferenceSelect::get_IfcTable() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(693); }
+    inline void IfcObjectReferenceSelect::put_IfcTable(IfcTable inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(693, inst); }
+    inline IfcTimeSeries IfcObjectReferenceSelect::get_IfcTimeSeries() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(721); }
+    inline void IfcObjectReferenceSelect::put_IfcTimeSeries(IfcTimeSeries inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(721, inst); }
+    inline IfcAddress IfcObjectReferenceSelect_get::get_IfcAddress() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(5); }
+    inline IfcAppliedValue IfcObjectReferenceSelect_get::get_IfcAppliedValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(20); }
+    inline IfcExternalReference IfcObjectReferenceSelect_get::get_IfcExternalReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(246); }
+    inline IfcMaterialDefinition IfcObjectReferenceSelect_get::get_IfcMaterialDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(359); }
+    inline IfcOrganization IfcObjectReferenceSelect_get::get_IfcOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(398); }
+    inline IfcPerson IfcObjectReferenceSelect_get::get_IfcPerson() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(411); }
+    inline IfcPersonAndOrganization IfcObjectReferenceSelect_get::get_IfcPersonAndOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(412); }
+    inline IfcTable IfcObjectReferenceSelect_get::get_IfcTable() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(693); }
+    inline IfcTimeSeries IfcObjectReferenceSelect_get::get_IfcTimeSeries() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(721); }
+    inline void IfcObjectReferenceSelect_put::put_IfcAddress(IfcAddress inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(5, inst); }
+    inline void IfcObjectReferenceSelect_put::put_IfcAppliedValue(IfcAppliedValue inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(20, inst); }
+    inline void IfcObjectReferenceSelect_put::put_IfcExternalReference(IfcExternalReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(246, inst); }
+    inline void IfcObjectReferenceSelect_put::put_IfcMaterialDefinition(IfcMaterialDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(359, inst); }
+    inline void IfcObjectReferenceSelect_put::put_IfcOrganization(IfcOrganization inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(398, inst); }
+    inline void IfcObjectReferenceSelect_put::put_IfcPerson(IfcPerson inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(411, inst); }
+    inline void IfcObjectReferenceSelect_put::put_IfcPersonAndOrganization(IfcPersonAndOrganization inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(412, inst); }
+    inline void IfcObjectReferenceSelect_put::put_IfcTable(IfcTable inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(693, inst); }
+    inline void IfcObjectReferenceSelect_put::put_IfcTimeSeries(IfcTimeSeries inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(721, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcObjectReferenceSelect_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPointOrVertexPoint_SELECT_H
+#define __RDF_LTD__IFC4_IfcPointOrVertexPoint_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcPoint.h"
+#include    "../classes/IfcVertexPoint.h"
+
+namespace IFC4
+{
+    inline IfcPoint IfcPointOrVertexPoint::get_IfcPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(430); }
+    inline void IfcPointOrVertexPoint::put_IfcPoint(IfcPoint inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(430, inst); }
+    inline IfcVertexPoint IfcPointOrVertexPoint::get_IfcVertexPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(751); }
+    inline void IfcPointOrVertexPoint::put_IfcVertexPoint(IfcVertexPoint inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(751, inst); }
+    inline IfcPoint IfcPointOrVertexPoint_get::get_IfcPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(430); }
+    inline IfcVertexPoint IfcPointOrVertexPoint_get::get_IfcVertexPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(751); }
+    inline void IfcPointOrVertexPoint_put::put_IfcPoint(IfcPoint inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(430, inst); }
+    inline void IfcPointOrVertexPoint_put::put_IfcVertexPoint(IfcVertexPoint inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(751, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcPointOrVertexPoint_SELECT_H
@@ -0,0 +1,33 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPresentationStyleSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcPresentationStyleSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcCurveStyle.h"
+#include    "../classes/IfcFillAreaStyle.h"
+#include    "../classes/IfcSurfaceStyle.h"
+#include    "../classes/IfcTextStyle.h"
+
+namespace IFC4
+{
+    inline IfcCurveStyle IfcPresentationStyleSelect::get_IfcCurveStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(163); }
+    inline void IfcPresentationStyleSelect::put_IfcCurveStyle(IfcCurveStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(163, inst); }
+    inline IfcFillAreaStyle IfcPresentationStyleSelect::get_IfcFillAreaStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(267); }
+    inline void IfcPresentationStyleSelect::put_IfcFillAreaStyle(IfcFillAreaStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(267, inst); }
+    inline IfcSurfaceStyle IfcPresentationStyleSelect::get_IfcSurfaceStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(677); }
+    inline void IfcPresentationStyleSelect::put_IfcSurfaceStyle(IfcSurfaceStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(677, inst); }
+    inline IfcTextStyle IfcPresentationStyleSelect::get_IfcTextStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(711); }
+    inline void IfcPresentationStyleSelect::put_IfcTextStyle(IfcTextStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(711, inst); }
+    inline IfcCurveStyle IfcPresentationStyleSelect_get::get_IfcCurveStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(163); }
+    inline IfcFillAreaStyle IfcPresentationStyleSelect_get::get_IfcFillAreaStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(267); }
+    inline IfcSurfaceStyle IfcPresentationStyleSelect_get::get_IfcSurfaceStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(677); }
+    inline IfcTextStyle IfcPresentationStyleSelect_get::get_IfcTextStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(711); }
+    inline void IfcPresentationStyleSelect_put::put_IfcCurveStyle(IfcCurveStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(163, inst); }
+    inline void IfcPresentationStyleSelect_put::put_IfcFillAreaStyle(IfcFillAreaStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(267, inst); }
+    inline void IfcPresentationStyleSelect_put::put_IfcSurfaceStyle(IfcSurfaceStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(677, inst); }
+    inline void IfcPresentationStyleSelect_put::put_IfcTextStyle(IfcTextStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(711, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcPresentationStyleSelect_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProcessSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcProcessSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcProcess.h"
+#include    "../classes/IfcTypeProcess.h"
+
+namespace IFC4
+{
+    inline IfcProcess IfcProcessSelect::get_IfcProcess() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(452); }
+    inline void IfcProcessSelect::put_IfcProcess(IfcProcess inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(452, inst); }
+    inline IfcTypeProcess IfcProcessSelect::get_IfcTypeProcess() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(737); }
+    inline void IfcProcessSelect::put_IfcTypeProcess(IfcTypeProcess inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(737, inst); }
+    inline IfcProcess IfcProcessSelect_get::get_IfcProcess() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(452); }
+    inline IfcTypeProcess IfcProcessSelect_get::get_IfcTypeProcess() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(737); }
+    inline void IfcProcessSelect_put::put_IfcProcess(IfcProcess inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(452, inst); }
+    inline void IfcProcessSelect_put::put_IfcTypeProcess(IfcTypeProcess inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(737, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcProcessSelect_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProductRepresentationSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcProductRepresentationSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcProductDefinitionShape.h"
+#include    "../classes/IfcRepresentationMap.h"
+
+namespace IFC4
+{
+    inline IfcProductDefinitionShape IfcProductRepresentationSelect::get_IfcProductDefinitionShape() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(454); }
+    inline void IfcProductRepresentationSelect::put_IfcProductDefinitionShape(IfcProductDefinitionShape inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(454, inst); }
+    inline IfcRepresentationMap IfcProductRepresentationSelect::get_IfcRepresentationMap() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(568); }
+    inline void IfcProductRepresentationSelect::put_IfcRepresentationMap(IfcRepresentationMap inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(568, inst); }
+    inline IfcProductDefinitionShape IfcProductRepresentationSelect_get::get_IfcProductDefinitionShape() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(454); }
+    inline IfcRepresentationMap IfcProductRepresentationSelect_get::get_IfcRepresentationMap() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(568); }
+    inline void IfcProductRepresentationSelect_put::put_IfcProductDefinitionShape(IfcProductDefinitionShape inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(454, inst); }
+    inline void IfcProductRepresentationSelect_put::put_IfcRepresentationMap(IfcRepresentationMap inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(568, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcProductRepresentationSelect_SELECT_H
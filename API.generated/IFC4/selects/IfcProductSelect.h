@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcProductSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcProductSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcProduct.h"
+#include    "../classes/IfcTypeProduct.h"
+
+namespace IFC4
+{
+    inline IfcProduct IfcProductSelect::get_IfcProduct() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(453); }
+    inline void IfcProductSelect::put_IfcProduct(IfcProduct inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(453, inst); }
+    inline IfcTypeProduct IfcProductSelect::get_IfcTypeProduct() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(738); }
+    inline void IfcProductSelect::put_IfcTypeProduct(IfcTypeProduct inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(738, inst); }
+    inline IfcProduct IfcProductSelect_get::get_IfcProduct() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(453); }
+    inline IfcTypeProduct IfcProductSelect_get::get_IfcTypeProduct() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(738); }
+    inline void IfcProductSelect_put::put_IfcProduct(IfcProduct inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(453, inst); }
+    inline void IfcProductSelect_put::put_IfcTypeProduct(IfcTypeProduct inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(738, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcProductSelect_SELECT_H
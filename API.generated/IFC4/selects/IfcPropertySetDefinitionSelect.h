@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcPropertySetDefinitionSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcPropertySetDefinitionSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcPropertySetDefinition.h"
+
+namespace IFC4
+{
+    inline IfcPropertySetDefinition IfcPropertySetDefinitionSelect::get_IfcPropertySetDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(473); }
+    inline void IfcPropertySetDefinitionSelect::put_IfcPropertySetDefinition(IfcPropertySetDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(473, inst); }
+    inline IfcPropertySetDefinition IfcPropertySetDefinitionSelect_get::get_IfcPropertySetDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(473); }
+    inline void IfcPropertySetDefinitionSelect_put::put_IfcPropertySetDefinition(IfcPropertySetDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(473, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcPropertySetDefinitionSelect_SELECT_H
@@ -0,0 +1,93 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcResourceObjectSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcResourceObjectSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcActorRole.h"
+#include    "../classes/IfcAppliedValue.h"
+#include    "../classes/IfcApproval.h"
+#include    "../classes/IfcConstraint.h"
+#include    "../classes/IfcContextDependentUnit.h"
+#include    "../classes/IfcConversionBasedUnit.h"
+#include    "../classes/IfcExternalInformation.h"
+#include    "../classes/IfcExternalReference.h"
+#include    "../classes/IfcMaterialDefinition.h"
+#include    "../classes/IfcOrganization.h"
+#include    "../classes/IfcPerson.h"
+#include    "../classes/IfcPersonAndOrganization.h"
+#include    "../classes/IfcPhysicalQuantity.h"
+#include    "../classes/IfcProfileDef.h"
+#include    "../classes/IfcPropertyAbstraction.h"
+#include    "../classes/IfcTimeSeries.h"
+
+namespace IFC4
+{
+    inline IfcActorRole IfcResourceObjectSelect::get_IfcActorRole() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(2); }
+    inline void IfcResourceObjectSelect::put_IfcActorRole(IfcActorRole inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(2, inst); }
+    inline IfcAppliedValue IfcResourceObjectSelect::get_IfcAppliedValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(20); }
+    inline void IfcResourceObjectSelect::put_IfcAppliedValue(IfcAppliedValue inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(20, inst); }
+    inline IfcApproval IfcResourceObjectSelect::get_IfcApproval() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(21); }
+    inline void IfcResourceObjectSelect::put_IfcApproval(IfcApproval inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(21, inst); }
+    inline IfcConstraint IfcResourceObjectSelect::get_IfcConstraint() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(125); }
+    inline void IfcResourceObjectSelect::put_IfcConstraint(IfcConstraint inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(125, inst); }
+    inline IfcContextDependentUnit IfcResourceObjectSelect::get_IfcContextDependentUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(135); }
+    inline void IfcResourceObjectSelect::put_IfcContextDependentUnit(IfcContextDependentUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(135, inst); }
+    inline IfcConversionBasedUnit IfcResourceObjectSelect::get_IfcConversionBasedUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(139); }
+    inline void IfcResourceObjectSelect::put_IfcConversionBasedUnit(IfcConversionBasedUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(139, inst); }
+    inline IfcExternalInformation IfcResourceObjectSelect::get_IfcExternalInformation() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(242); }
+    inline void IfcResourceObjectSelect::put_IfcExternalInformation(IfcExternalInformation inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(242, inst); }
+    inline IfcExternalReference IfcResourceObjectSelect::get_IfcExternalReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(246); }
+    inline void IfcResourceObjectSelect::put_IfcExternalReference(IfcExternalReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(246, inst); }
+    inline IfcMaterialDefinition IfcResourceObjectSelect::get_IfcMaterialDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(359); }
+    inline void IfcResourceObjectSelect::put_IfcMaterialDefinition(IfcMaterialDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(359, inst); }
+    inline IfcOrganization IfcResourceObjectSelect::get_IfcOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(398); }
+    inline void IfcResourceObjectSelect::put_IfcOrganization(IfcOrganization inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(398, inst); }
+    inline IfcPerson IfcResourceObjectSelect::get_IfcPerson() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(411); }
+    inline void IfcResourceObjectSelect::put_IfcPerson(IfcPerson inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(411, inst); }
+    inline IfcPersonAndOrganization IfcResourceObjectSelect::get_IfcPersonAndOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(412); }
+    inline void IfcResourceObjectSelect::put_IfcPersonAndOrganization(IfcPersonAndOrganization inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(412, inst); }
+    inline IfcPhysicalQuantity IfcResourceObjectSelect::get_IfcPhysicalQuantity() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(414); }
+    inline void IfcResourceObjectSelect::put_IfcPhysicalQuantity(IfcPhysicalQuantity inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(414, inst); }
+    inline IfcProfileDef IfcResourceObjectSelect::get_IfcProfileDef() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(456); }
+    inline void IfcResourceObjectSelect::put_IfcProfileDef(IfcProfileDef inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(456, inst); }
+    inline IfcPropertyAbstraction IfcResourceObjectSelect::get_IfcPropertyAbstraction() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(464); }
+    inline void IfcResourceObjectSelect::put_IfcPropertyAbstraction(IfcPropertyAbstraction inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(464, inst); }
+    inline IfcTimeSeries IfcResourceObjectSelect::get_IfcTimeSeries() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(721); }
+    inline void IfcResourceObjectSelect::put_IfcTimeSeries(IfcTimeSeries inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(721, inst); }
+    inline IfcActorRole IfcResourceObjectSelect_get::get_IfcActorRole() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(2); }
+    inline IfcAppliedValue IfcResourceObjectSelect_get::get_IfcAppliedValue() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(20); }
+    inline IfcApproval IfcResourceObjectSelect_get::get_IfcApproval() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(21); }
+    inline IfcConstraint IfcResourceObjectSelect_get::get_IfcConstraint() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(125); }
+    inline IfcContextDependentUnit IfcResourceObjectSelect_get::get_IfcContextDependentUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(135); }
+    inline IfcConversionBasedUnit IfcResourceObjectSelect_get::get_IfcConversionBasedUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(139); }
+    inline IfcExternalInformation IfcResourceObjectSelect_get::get_IfcExternalInformation() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(242); }
+    inline IfcExternalReference IfcResourceObjectSelect_get::get_IfcExternalReference() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(246); }
+    inline IfcMaterialDefinition IfcResourceObjectSelect_get::get_IfcMaterialDefinition() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(359); }
+    inline IfcOrganization IfcResourceObjectSelect_get::get_IfcOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(398); }
+    inline IfcPerson IfcResourceObjectSelect_get::get_IfcPerson() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(411); }
+    inline IfcPersonAndOrganization IfcResourceObjectSelect_get::get_IfcPersonAndOrganization() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(412); }
+    inline IfcPhysicalQuantity IfcResourceObjectSelect_get::get_IfcPhysicalQuantity() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(414); }
+    inline IfcProfileDef IfcResourceObjectSelect_get::get_IfcProfileDef() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(456); }
+    inline IfcPropertyAbstraction IfcResourceObjectSelect_get::get_IfcPropertyAbstraction() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(464); }
+    inline IfcTimeSeries IfcResourceObjectSelect_get::get_IfcTimeSeries() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(721); }
+    inline void IfcResourceObjectSelect_put::put_IfcActorRole(IfcActorRole inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(2, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcAppliedValue(IfcAppliedValue inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(20, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcApproval(IfcApproval inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(21, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcConstraint(IfcConstraint inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(125, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcContextDependentUnit(IfcContextDependentUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(135, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcConversionBasedUnit(IfcConversionBasedUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(139, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcExternalInformation(IfcExternalInformation inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(242, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcExternalReference(IfcExternalReference inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(246, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcMaterialDefinition(IfcMaterialDefinition inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(359, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcOrganization(IfcOrganization inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(398, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcPerson(IfcPerson inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(411, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcPersonAndOrganization(IfcPersonAndOrganization inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(412, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcPhysicalQuantity(IfcPhysicalQuantity inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(414, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcProfileDef(IfcProfileDef inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(456, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcPropertyAbstraction(IfcPropertyAbstraction inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(464, inst); }
+    inline void IfcResourceObjectSelect_put::put_IfcTimeSeries(IfcTimeSeries inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(721, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcResourceObjectSelect_SELECT_H
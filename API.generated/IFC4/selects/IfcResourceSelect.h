@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcResourceSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcResourceSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcResource.h"
+#include    "../classes/IfcTypeResource.h"
+
+namespace IFC4
+{
+    inline IfcResource IfcResourceSelect::get_IfcResource() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(569); }
+    inline void IfcResourceSelect::put_IfcResource(IfcResource inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(569, inst); }
+    inline IfcTypeResource IfcResourceSelect::get_IfcTypeResource() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(739); }
+    inline void IfcResourceSelect::put_IfcTypeResource(IfcTypeResource inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(739, inst); }
+    inline IfcResource IfcResourceSelect_get::get_IfcResource() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(569); }
+    inline IfcTypeResource IfcResourceSelect_get::get_IfcTypeResource() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(739); }
+    inline void IfcResourceSelect_put::put_IfcResource(IfcResource inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(569, inst); }
+    inline void IfcResourceSelect_put::put_IfcTypeResource(IfcTypeResource inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(739, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcResourceSelect_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcShell_SELECT_H
+#define __RDF_LTD__IFC4_IfcShell_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcClosedShell.h"
+#include    "../classes/IfcOpenShell.h"
+
+namespace IFC4
+{
+    inline IfcClosedShell IfcShell::get_IfcClosedShell() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(96); }
+    inline void IfcShell::put_IfcClosedShell(IfcClosedShell inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(96, inst); }
+    inline IfcOpenShell IfcShell::get_IfcOpenShell() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(397); }
+    inline void IfcShell::put_IfcOpenShell(IfcOpenShell inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(397, inst); }
+    inline IfcClosedShell IfcShell_get::get_IfcClosedShell() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(96); }
+    inline IfcOpenShell IfcShell_get::get_IfcOpenShell() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(397); }
+    inline void IfcShell_put::put_IfcClosedShell(IfcClosedShell inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(96, inst); }
+    inline void IfcShell_put::put_IfcOpenShell(IfcOpenShell inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(397, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcShell_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSolidOrShell_SELECT_H
+#define __RDF_LTD__IFC4_IfcSolidOrShell_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcClosedShell.h"
+#include    "../classes/IfcSolidModel.h"
+
+namespace IFC4
+{
+    inline IfcClosedShell IfcSolidOrShell::get_IfcClosedShell() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(96); }
+    inline void IfcSolidOrShell::put_IfcClosedShell(IfcClosedShell inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(96, inst); }
+    inline IfcSolidModel IfcSolidOrShell::get_IfcSolidModel() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(608); }
+    inline void IfcSolidOrShell::put_IfcSolidModel(IfcSolidModel inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(608, inst); }
+    inline IfcClosedShell IfcSolidOrShell_get::get_IfcClosedShell() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(96); }
+    inline IfcSolidModel IfcSolidOrShell_get::get_IfcSolidModel() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(608); }
+    inline void IfcSolidOrShell_put::put_IfcClosedShell(IfcClosedShell inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(96, inst); }
+    inline void IfcSolidOrShell_put::put_IfcSolidModel(IfcSolidModel inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(608, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcSolidOrShell_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSpaceBoundarySelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcSpaceBoundarySelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcExternalSpatialElement.h"
+#include    "../classes/IfcSpace.h"
+
+namespace IFC4
+{
+    inline IfcExternalSpatialElement IfcSpaceBoundarySelect::get_IfcExternalSpatialElement() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(248); }
+    inline void IfcSpaceBoundarySelect::put_IfcExternalSpatialElement(IfcExternalSpatialElement inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(248, inst); }
+    inline IfcSpace IfcSpaceBoundarySelect::get_IfcSpace() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(609); }
+    inline void IfcSpaceBoundarySelect::put_IfcSpace(IfcSpace inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(609, inst); }
+    inline IfcExternalSpatialElement IfcSpaceBoundarySelect_get::get_IfcExternalSpatialElement() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(248); }
+    inline IfcSpace IfcSpaceBoundarySelect_get::get_IfcSpace() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(609); }
+    inline void IfcSpaceBoundarySelect_put::put_IfcExternalSpatialElement(IfcExternalSpatialElement inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(248, inst); }
+    inline void IfcSpaceBoundarySelect_put::put_IfcSpace(IfcSpace inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(609, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcSpaceBoundarySelect_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStructuralActivityAssignmentSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcStructuralActivityAssignmentSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcElement.h"
+#include    "../classes/IfcStructuralItem.h"
+
+namespace IFC4
+{
+    inline IfcElement IfcStructuralActivityAssignmentSelect::get_IfcElement() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(220); }
+    inline void IfcStructuralActivityAssignmentSelect::put_IfcElement(IfcElement inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(220, inst); }
+    inline IfcStructuralItem IfcStructuralActivityAssignmentSelect::get_IfcStructuralItem() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(637); }
+    inline void IfcStructuralActivityAssignmentSelect::put_IfcStructuralItem(IfcStructuralItem inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(637, inst); }
+    inline IfcElement IfcStructuralActivityAssignmentSelect_get::get_IfcElement() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(220); }
+    inline IfcStructuralItem IfcStructuralActivityAssignmentSelect_get::get_IfcStructuralItem() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(637); }
+    inline void IfcStructuralActivityAssignmentSelect_put::put_IfcElement(IfcElement inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(220, inst); }
+    inline void IfcStructuralActivityAssignmentSelect_put::put_IfcStructuralItem(IfcStructuralItem inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(637, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcStructuralActivityAssignmentSelect_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcStyleAssignmentSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcStyleAssignmentSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcPresentationStyle.h"
+#include    "../classes/IfcPresentationStyleAssignment.h"
+
+namespace IFC4
+{
+    inline IfcPresentationStyle IfcStyleAssignmentSelect::get_IfcPresentationStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(448); }
+    inline void IfcStyleAssignmentSelect::put_IfcPresentationStyle(IfcPresentationStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(448, inst); }
+    inline IfcPresentationStyleAssignment IfcStyleAssignmentSelect::get_IfcPresentationStyleAssignment() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(449); }
+    inline void IfcStyleAssignmentSelect::put_IfcPresentationStyleAssignment(IfcPresentationStyleAssignment inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(449, inst); }
+    inline IfcPresentationStyle IfcStyleAssignmentSelect_get::get_IfcPresentationStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(448); }
+    inline IfcPresentationStyleAssignment IfcStyleAssignmentSelect_get::get_IfcPresentationStyleAssignment() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(449); }
+    inline void IfcStyleAssignmentSelect_put::put_IfcPresentationStyle(IfcPresentationStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(448, inst); }
+    inline void IfcStyleAssignmentSelect_put::put_IfcPresentationStyleAssignment(IfcPresentationStyleAssignment inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(449, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcStyleAssignmentSelect_SELECT_H
@@ -0,0 +1,28 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceOrFaceSurface_SELECT_H
+#define __RDF_LTD__IFC4_IfcSurfaceOrFaceSurface_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcFaceBasedSurfaceModel.h"
+#include    "../classes/IfcFaceSurface.h"
+#include    "../classes/IfcSurface.h"
+
+namespace IFC4
+{
+    inline IfcFaceBasedSurfaceModel IfcSurfaceOrFaceSurface::get_IfcFaceBasedSurfaceModel() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(253); }
+    inline void IfcSurfaceOrFaceSurface::put_IfcFaceBasedSurfaceModel(IfcFaceBasedSurfaceModel inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(253, inst); }
+    inline IfcFaceSurface IfcSurfaceOrFaceSurface::get_IfcFaceSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(256); }
+    inline void IfcSurfaceOrFaceSurface::put_IfcFaceSurface(IfcFaceSurface inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(256, inst); }
+    inline IfcSurface IfcSurfaceOrFaceSurface::get_IfcSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(670); }
+    inline void IfcSurfaceOrFaceSurface::put_IfcSurface(IfcSurface inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(670, inst); }
+    inline IfcFaceBasedSurfaceModel IfcSurfaceOrFaceSurface_get::get_IfcFaceBasedSurfaceModel() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(253); }
+    inline IfcFaceSurface IfcSurfaceOrFaceSurface_get::get_IfcFaceSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(256); }
+    inline IfcSurface IfcSurfaceOrFaceSurface_get::get_IfcSurface() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(670); }
+    inline void IfcSurfaceOrFaceSurface_put::put_IfcFaceBasedSurfaceModel(IfcFaceBasedSurfaceModel inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(253, inst); }
+    inline void IfcSurfaceOrFaceSurface_put::put_IfcFaceSurface(IfcFaceSurface inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(256, inst); }
+    inline void IfcSurfaceOrFaceSurface_put::put_IfcSurface(IfcSurface inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(670, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceOrFaceSurface_SELECT_H
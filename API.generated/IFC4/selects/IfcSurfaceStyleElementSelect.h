@@ -0,0 +1,38 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcSurfaceStyleElementSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcSurfaceStyleElementSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcExternallyDefinedSurfaceStyle.h"
+#include    "../classes/IfcSurfaceStyleLighting.h"
+#include    "../classes/IfcSurfaceStyleRefraction.h"
+#include    "../classes/IfcSurfaceStyleShading.h"
+#include    "../classes/IfcSurfaceStyleWithTextures.h"
+
+namespace IFC4
+{
+    inline IfcExternallyDefinedSurfaceStyle IfcSurfaceStyleElementSelect::get_IfcExternallyDefinedSurfaceStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(244); }
+    inline void IfcSurfaceStyleElementSelect::put_IfcExternallyDefinedSurfaceStyle(IfcExternallyDefinedSurfaceStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(244, inst); }
+    inline IfcSurfaceStyleLighting IfcSurfaceStyleElementSelect::get_IfcSurfaceStyleLighting() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(678); }
+    inline void IfcSurfaceStyleElementSelect::put_IfcSurfaceStyleLighting(IfcSurfaceStyleLighting inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(678, inst); }
+    inline IfcSurfaceStyleRefraction IfcSurfaceStyleElementSelect::get_IfcSurfaceStyleRefraction() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(679); }
+    inline void IfcSurfaceStyleElementSelect::put_IfcSurfaceStyleRefraction(IfcSurfaceStyleRefraction inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(679, inst); }
+    inline IfcSurfaceStyleShading IfcSurfaceStyleElementSelect::get_IfcSurfaceStyleShading() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(681); }
+    inline void IfcSurfaceStyleElementSelect::put_IfcSurfaceStyleShading(IfcSurfaceStyleShading inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(681, inst); }
+    inline IfcSurfaceStyleWithTextures IfcSurfaceStyleElementSelect::get_IfcSurfaceStyleWithTextures() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(682); }
+    inline void IfcSurfaceStyleElementSelect::put_IfcSurfaceStyleWithTextures(IfcSurfaceStyleWithTextures inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(682, inst); }
+    inline IfcExternallyDefinedSurfaceStyle IfcSurfaceStyleElementSelect_get::get_IfcExternallyDefinedSurfaceStyle() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(244); }
+    inline IfcSurfaceStyleLighting IfcSurfaceStyleElementSelect_get::get_IfcSurfaceStyleLighting() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(678); }
+    inline IfcSurfaceStyleRefraction IfcSurfaceStyleElementSelect_get::get_IfcSurfaceStyleRefraction() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(679); }
+    inline IfcSurfaceStyleShading IfcSurfaceStyleElementSelect_get::get_IfcSurfaceStyleShading() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(681); }
+    inline IfcSurfaceStyleWithTextures IfcSurfaceStyleElementSelect_get::get_IfcSurfaceStyleWithTextures() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(682); }
+    inline void IfcSurfaceStyleElementSelect_put::put_IfcExternallyDefinedSurfaceStyle(IfcExternallyDefinedSurfaceStyle inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(244, inst); }
+    inline void IfcSurfaceStyleElementSelect_put::put_IfcSurfaceStyleLighting(IfcSurfaceStyleLighting inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(678, inst); }
+    inline void IfcSurfaceStyleElementSelect_put::put_IfcSurfaceStyleRefraction(IfcSurfaceStyleRefraction inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(679, inst); }
+    inline void IfcSurfaceStyleElementSelect_put::put_IfcSurfaceStyleShading(IfcSurfaceStyleShading inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(681, inst); }
+    inline void IfcSurfaceStyleElementSelect_put::put_IfcSurfaceStyleWithTextures(IfcSurfaceStyleWithTextures inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(682, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcSurfaceStyleElementSelect_SELECT_H
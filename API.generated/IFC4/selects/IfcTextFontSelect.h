@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTextFontSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcTextFontSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcExternallyDefinedTextFont.h"
+#include    "../classes/IfcPreDefinedTextFont.h"
+
+namespace IFC4
+{
+    inline IfcExternallyDefinedTextFont IfcTextFontSelect::get_IfcExternallyDefinedTextFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(245); }
+    inline void IfcTextFontSelect::put_IfcExternallyDefinedTextFont(IfcExternallyDefinedTextFont inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(245, inst); }
+    inline IfcPreDefinedTextFont IfcTextFontSelect::get_IfcPreDefinedTextFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(444); }
+    inline void IfcTextFontSelect::put_IfcPreDefinedTextFont(IfcPreDefinedTextFont inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(444, inst); }
+    inline IfcExternallyDefinedTextFont IfcTextFontSelect_get::get_IfcExternallyDefinedTextFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(245); }
+    inline IfcPreDefinedTextFont IfcTextFontSelect_get::get_IfcPreDefinedTextFont() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(444); }
+    inline void IfcTextFontSelect_put::put_IfcExternallyDefinedTextFont(IfcExternallyDefinedTextFont inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(245, inst); }
+    inline void IfcTextFontSelect_put::put_IfcPreDefinedTextFont(IfcPreDefinedTextFont inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(444, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcTextFontSelect_SELECT_H
@@ -0,0 +1,18 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcTrimmingSelect_SELECT_H
+#define __RDF_LTD__IFC4_IfcTrimmingSelect_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcCartesianPoint.h"
+
+namespace IFC4
+{
+    inline IfcCartesianPoint IfcTrimmingSelect::get_IfcCartesianPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(75); }
+    inline void IfcTrimmingSelect::put_IfcCartesianPoint(IfcCartesianPoint inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(75, inst); }
+    inline IfcCartesianPoint IfcTrimmingSelect_get::get_IfcCartesianPoint() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(75); }
+    inline void IfcTrimmingSelect_put::put_IfcCartesianPoint(IfcCartesianPoint inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(75, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcTrimmingSelect_SELECT_H
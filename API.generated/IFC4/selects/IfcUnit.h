@@ -0,0 +1,28 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcUnit_SELECT_H
+#define __RDF_LTD__IFC4_IfcUnit_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcDerivedUnit.h"
+#include    "../classes/IfcMonetaryUnit.h"
+#include    "../classes/IfcNamedUnit.h"
+
+namespace IFC4
+{
+    inline IfcDerivedUnit IfcUnit::get_IfcDerivedUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(171); }
+    inline void IfcUnit::put_IfcDerivedUnit(IfcDerivedUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(171, inst); }
+    inline IfcMonetaryUnit IfcUnit::get_IfcMonetaryUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(384); }
+    inline void IfcUnit::put_IfcMonetaryUnit(IfcMonetaryUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(384, inst); }
+    inline IfcNamedUnit IfcUnit::get_IfcNamedUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(387); }
+    inline void IfcUnit::put_IfcNamedUnit(IfcNamedUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(387, inst); }
+    inline IfcDerivedUnit IfcUnit_get::get_IfcDerivedUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(171); }
+    inline IfcMonetaryUnit IfcUnit_get::get_IfcMonetaryUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(384); }
+    inline IfcNamedUnit IfcUnit_get::get_IfcNamedUnit() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(387); }
+    inline void IfcUnit_put::put_IfcDerivedUnit(IfcDerivedUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(171, inst); }
+    inline void IfcUnit_put::put_IfcMonetaryUnit(IfcMonetaryUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(384, inst); }
+    inline void IfcUnit_put::put_IfcNamedUnit(IfcNamedUnit inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(387, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcUnit_SELECT_H
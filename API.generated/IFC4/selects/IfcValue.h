@@ -0,0 +1,12 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcValue_SELECT_H
+#define __RDF_LTD__IFC4_IfcValue_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "IfcDerivedMeasureValue.h"
+#include    "IfcMeasureValue.h"
+#include    "IfcSimpleValue.h"
+
+#endif //__RDF_LTD__IFC4_IfcValue_SELECT_H
@@ -0,0 +1,23 @@
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__IFC4_IfcVectorOrDirection_SELECT_H
+#define __RDF_LTD__IFC4_IfcVectorOrDirection_SELECT_H
+
+#include    "../IFC4_core.h"
+#include    "../classes/IfcDirection.h"
+#include    "../classes/IfcVector.h"
+
+namespace IFC4
+{
+    inline IfcDirection IfcVectorOrDirection::get_IfcDirection() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(174); }
+    inline void IfcVectorOrDirection::put_IfcDirection(IfcDirection inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(174, inst); }
+    inline IfcVector IfcVectorOrDirection::get_IfcVector() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(748); }
+    inline void IfcVectorOrDirection::put_IfcVector(IfcVector inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(748, inst); }
+    inline IfcDirection IfcVectorOrDirection_get::get_IfcDirection() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(174); }
+    inline IfcVector IfcVectorOrDirection_get::get_IfcVector() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(748); }
+    inline void IfcVectorOrDirection_put::put_IfcDirection(IfcDirection inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(174, inst); }
+    inline void IfcVectorOrDirection_put::put_IfcVector(IfcVector inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(748, inst); }
+}
+
+#endif //__RDF_LTD__IFC4_IfcVectorOrDirection_SELECT_H
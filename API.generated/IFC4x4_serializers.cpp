@@ -0,0 +1,6 @@
+//
+// Explicit instantiations of aggregation serializers of IFC4x4.h
+// Compile this file once and define RDF_EXPRESS_EXTERN_SERIALIZERS in other translation units, so they do not instantiate serializers
+//
+#define RDF_EXPRESS_INSTANTIATE_SERIALIZERS
+#include    "IFC4x4.h"
@@ -106,6 +106,7 @@ namespace RDFWrappers
                         if (enumValues != null)
                             generator.m_replacements[Generator.KWD_ENUMERATION_VALUES_ARRAY] = enumValues;
                         generator.WriteByTemplate(template);
+                        generator.AddSerializer(template, SerializerKey(template, sdaiType, elemApiType));
                     }
 
                     //for outer aggregarion
@@ -121,6 +122,25 @@ namespace RDFWrappers
             return enum_express_aggr.__NONE;
         }
 
+        /// <summary>
+        /// Aggregation types with the same serializer key are the same C++ type, like lists of defined types based on double
+        /// </summary>
+        private string SerializerKey(Generator.Template template, string sdaiType, string elemApiType)
+        {
+            switch (template)
+            {
+                case Generator.Template.AggregationOfSimple:
+                case Generator.Template.AggregationOfText:
+                    return template.ToString() + " " + sdaiType; //elements are typedefs of C++ type of sdaiType
+
+                case Generator.Template.AggregationOfSelect:
+                    return template.ToString() + " " + generator.SelectOfType(elemApiType);
+
+                default:
+                    return template.ToString() + " " + elemApiType;
+            }
+        }
+
         private string MakeAggregationTypeName (enum_express_aggr aggrType, string elemType)
         {
             System.Diagnostics.Debug.Assert(elemType != null);
@@ -303,6 +323,8 @@ namespace RDFWrappers
             string enumValues = null;
             string sdaiType = null;
             Generator.Template template = Generator.Template.None;
+            int depth = 0;
+            string scalarType = null;
 
             if (typeDef.aggregation != 0)
             {
@@ -311,6 +333,7 @@ namespace RDFWrappers
                 if (template != Generator.Template.None)
                 {
                     aggrTypeName = elemIfcType;
+                    scalarType = elemApiType;
                     for (var aggregation = typeDef.aggregation; aggregation != 0;)
                     {
                         enum_express_aggr aggrType;
@@ -318,6 +341,7 @@ namespace RDFWrappers
                         bool optional, unique;
                         ifcengine.engiGetAggregationDefinition(aggregation, out aggrType, out crdMin, out crdMax, out optional, out unique, out aggregation);
                         aggrTypeName = MakeAggregationTypeName(aggrType, aggrTypeName);
+                        depth++;
                         if (aggregation != 0)
                         {
                             elemApiType = aggrTypeName;
@@ -338,6 +362,7 @@ namespace RDFWrappers
                     var definedType = new DefinedType(typeDef.domain);
                     aggrTypeName = definedType.name;
                     template = GetAggregatedType(definedType, out elemIfcType, out elemApiType, out sdaiType, out enumValues);
+                    scalarType = elemApiType;
                 }
                 else
                 {
@@ -361,10 +386,32 @@ namespace RDFWrappers
                     generator.m_replacements[Generator.KWD_TypeNameIFC] = elemIfcType;
 
                     generator.WriteGetPut(Generator.Template.AttributeAggregationGet, Generator.Template.AttributeAggregationPut, explicit_);
+
+                    //split header of the entity includes aggregated entities and selects
+                    if (template == Generator.Template.AggregationOfInstance)
+                    {
+                        generator.SplitReferenceEntity(scalarType);
+                    }
+                    else if (template == Generator.Template.AggregationOfSelect)
+                    {
+                        generator.SplitReferenceSelect(scalarType);
+                    }
                     if (!nested && sdaiType != null && explicit_)
                     {
                         generator.WriteByTemplate(Generator.Template.AttributeAggregationPutArray);
                     }
+
+                    //flat buffer access to aggregation of aggregations of numbers, like point lists
+                    if (depth == 2 && template == Generator.Template.AggregationOfSimple && (sdaiType == "sdaiREAL" || sdaiType == "sdaiINTEGER"))
+                    {
+                        generator.m_replacements[Generator.KWD_SimpleType] = scalarType;
+                        generator.m_replacements[Generator.KWD_sdaiTYPE] = sdaiType;
+                        generator.WriteByTemplate(Generator.Template.AttributeAggregationGetFlat);
+                        if (explicit_)
+                        {
+                            generator.WriteByTemplate(Generator.Template.AttributeAggregationPutFlat);
+                        }
+                    }
                 }
             }
         }
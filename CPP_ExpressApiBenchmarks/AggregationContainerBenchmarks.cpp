@@ -0,0 +1,145 @@
+//
+// Aggregation containers: generated vector based aggregations against the list based ones they replaced
+// List types are declared as the generator emitted them before, with std::list instead of AggrContainer
+//
+#include    <list>
+#include    <vector>
+#include    "IFC4.h"
+
+#include    "Benchmark.h"
+
+using namespace IFC4;
+using Benchmark::DoNotOptimize;
+
+namespace IFC4
+{
+    typedef std::list<IfcLengthMeasure> ListOfIfcLengthMeasure_List;
+    template <typename TList> class ListOfIfcLengthMeasure_ListSerializer : public AggrSerializerSimple<TList, IfcLengthMeasure, sdaiREAL> {};
+    typedef std::list<ListOfIfcLengthMeasure_List> ListOfListOfIfcLengthMeasure_List;
+    template <typename TList> class ListOfListOfIfcLengthMeasure_ListSerializer : public AggrSerializerAggr<TList, ListOfIfcLengthMeasure_List, ListOfIfcLengthMeasure_ListSerializer<ListOfIfcLengthMeasure_List>> {};
+}
+
+//
+// Point list of 100k xyz points and 10k cartesian points of 3 coordinates
+//
+struct ContainerModel
+{
+    static const int                    POINTS = 100000;
+    static const int                    CARTESIAN_POINTS = 10000;
+
+    SdaiModel                           model;
+    IfcCartesianPointList3D             pointList;
+    SdaiAttr                            coordList;
+    std::vector<IfcCartesianPoint>      points;
+    SdaiAttr                            coordinates;
+    ListOfListOfIfcLengthMeasure        vectorCoords;
+    ListOfListOfIfcLengthMeasure_List   listCoords;
+
+    ContainerModel()
+        : pointList(0)
+    {
+        model = sdaiCreateModelBN(0, NULL, "IFC4");
+        pointList = IfcCartesianPointList3D::Create(model);
+        coordList = sdaiGetAttrDefinition(sdaiGetEntity(model, "IfcCartesianPointList3D"), "CoordList");
+        coordinates = sdaiGetAttrDefinition(sdaiGetEntity(model, "IfcCartesianPoint"), "Coordinates");
+
+        for (int i = 0; i < POINTS; i++) {
+            ListOfIfcLengthMeasure point;
+            point.push_back(i);
+            point.push_back(i % 100);
+            point.push_back(0.5);
+            vectorCoords.push_back(point);
+            listCoords.push_back(ListOfIfcLengthMeasure_List(point.begin(), point.end()));
+        }
+        pointList.put_CoordList(vectorCoords);
+
+        for (int i = 0; i < CARTESIAN_POINTS; i++) {
+            IfcCartesianPoint point = IfcCartesianPoint::Create(model);
+            double xyz[] = {(double) i, 1, 2};
+            point.put_Coordinates(xyz, 3);
+            points.push_back(point);
+        }
+    }
+
+    ~ContainerModel()
+    {
+        CloseModel(model);
+    }
+};
+
+//
+// Read of the 100k points list
+//
+BENCHMARK(AggregationContainerGet_PointList100k_Vector)
+{
+    ContainerModel m;
+    while (state.KeepRunning()) {
+        ListOfListOfIfcLengthMeasure coords;
+        ListOfListOfIfcLengthMeasureSerializer<ListOfListOfIfcLengthMeasure>::FromAttr(coords, m.pointList, m.coordList);
+        assert(coords == m.vectorCoords);
+        DoNotOptimize(coords);
+    }
+}
+
+BENCHMARK(AggregationContainerGet_PointList100k_List)
+{
+    ContainerModel m;
+    while (state.KeepRunning()) {
+        ListOfListOfIfcLengthMeasure_List coords;
+        ListOfListOfIfcLengthMeasure_ListSerializer<ListOfListOfIfcLengthMeasure_List>::FromAttr(coords, m.pointList, m.coordList);
+        assert(coords == m.listCoords);
+        DoNotOptimize(coords);
+    }
+}
+
+//
+// Write of the 100k points list
+//
+BENCHMARK(AggregationContainerPut_PointList100k_Vector)
+{
+    ContainerModel m;
+    while (state.KeepRunning()) {
+        SdaiAggr aggr = ListOfListOfIfcLengthMeasureSerializer<ListOfListOfIfcLengthMeasure>::ToSdaiAggr(m.vectorCoords, m.pointList, m.coordList);
+        DoNotOptimize(aggr);
+    }
+}
+
+BENCHMARK(AggregationContainerPut_PointList100k_List)
+{
+    ContainerModel m;
+    while (state.KeepRunning()) {
+        SdaiAggr aggr = ListOfListOfIfcLengthMeasure_ListSerializer<ListOfListOfIfcLengthMeasure_List>::ToSdaiAggr(m.listCoords, m.pointList, m.coordList);
+        DoNotOptimize(aggr);
+    }
+}
+
+//
+// Read of 10k short tuples, coordinates of cartesian points
+//
+BENCHMARK(AggregationContainerGet_Points10k_Vector)
+{
+    ContainerModel m;
+    while (state.KeepRunning()) {
+        double sum = 0;
+        for (IfcCartesianPoint& point : m.points) {
+            ListOfIfcLengthMeasure xyz;
+            ListOfIfcLengthMeasureSerializer<ListOfIfcLengthMeasure>::FromAttr(xyz, point, m.coordinates);
+            sum += xyz.front();
+        }
+        DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(AggregationContainerGet_Points10k_List)
+{
+    ContainerModel m;
+    while (state.KeepRunning()) {
+        double sum = 0;
+        for (IfcCartesianPoint& point : m.points) {
+            ListOfIfcLengthMeasure_List xyz;
+            ListOfIfcLengthMeasure_ListSerializer<ListOfIfcLengthMeasure_List>::FromAttr(xyz, point, m.coordinates);
+            sum += xyz.front();
+        }
+        DoNotOptimize(sum);
+    }
+}
@@ -0,0 +1,113 @@
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <string.h>
+#include    <new>
+#include    <vector>
+
+#include    "Benchmark.h"
+
+//
+// Global operator new counts allocations of wrappers, containers and, when linked with the stand-in, the engine itself
+// Not thread safe, benchmarks are single-threaded
+//
+static uint64_t s_allocationCount = 0;
+static uint64_t s_allocationBytes = 0;
+
+void* operator new(size_t size)
+{
+    s_allocationCount++;
+    s_allocationBytes += size;
+    if (void* p = malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    free(p);
+}
+
+namespace Benchmark
+{
+    struct Entry
+    {
+        const char* name;
+        Function    function;
+    };
+
+    static std::vector<Entry>& Entries()
+    {
+        static std::vector<Entry> entries;
+        return entries;
+    }
+
+    Allocations Allocations::Current()
+    {
+        Allocations current;
+        current.count = s_allocationCount;
+        current.bytes = s_allocationBytes;
+        return current;
+    }
+
+    Registration::Registration(const char* name, Function function)
+    {
+        Entries().push_back({name, function});
+    }
+
+    void Run(const char* filter, double minSeconds)
+    {
+        printf("%-48s %12s %12s %12s %12s\n", "benchmark", "iterations", "ns/op", "allocs/op", "bytes/op");
+
+        for (auto& entry : Entries()) {
+            if (filter && !strstr(entry.name, filter)) {
+                continue;
+            }
+
+            uint64_t iterations = 1;
+            for (;;) {
+                State state(iterations);
+                entry.function(state);
+
+                if (state.Seconds() >= minSeconds || iterations >= 1000000000) {
+                    double n = (double) state.Iterations();
+                    printf("%-48s %12llu %12.1f %12.2f %12.1f\n",
+                        entry.name,
+                        (unsigned long long) state.Iterations(),
+                        state.Seconds() * 1e9 / n,
+                        (double) state.Allocated().count / n,
+                        (double) state.Allocated().bytes / n
+                    );
+                    break;
+                }
+
+                //aim at 1.5 of minimal time from the measured rate, but grow not more than 100 times per step
+                uint64_t next = state.Seconds() > 0 ? (uint64_t) (iterations * minSeconds * 1.5 / state.Seconds()) : iterations * 100;
+                if (next > iterations * 100) {
+                    next = iterations * 100;
+                }
+                iterations = next > iterations ? next : iterations + 1;
+            }
+        }
+    }
+}
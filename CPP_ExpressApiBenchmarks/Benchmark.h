@@ -0,0 +1,117 @@
+//
+// Self-contained micro-benchmark harness for early-binding wrappers
+// Reports time, operator new calls and allocated bytes per operation
+//
+#ifndef __RDF_LTD__BENCHMARK_H
+#define __RDF_LTD__BENCHMARK_H
+
+#include    <stddef.h>
+#include    <stdint.h>
+#include    <chrono>
+
+namespace Benchmark
+{
+    /// <summary>
+    /// Counters of global operator new, replaced in Benchmark.cpp
+    /// </summary>
+    struct Allocations
+    {
+        uint64_t    count;
+        uint64_t    bytes;
+
+        static Allocations Current();
+    };
+
+    /// <summary>
+    /// Drives the measured loop of a benchmark:
+    ///
+    ///     //setup, not measured
+    ///     while (state.KeepRunning()) {
+    ///         //operation
+    ///     }
+    ///
+    /// </summary>
+    class State
+    {
+    public:
+        State(uint64_t iterations) : m_iterations(iterations), m_done(0), m_seconds(0), m_allocations(), m_started(false) {}
+
+        bool KeepRunning()
+        {
+            if (!m_started) {
+                Start();
+            }
+            if (m_done < m_iterations) {
+                m_done++;
+                return true;
+            }
+            Stop();
+            return false;
+        }
+
+        uint64_t Iterations() const { return m_iterations; }
+        double Seconds() const { return m_seconds; }
+        const Allocations& Allocated() const { return m_allocations; }
+
+    private:
+        void Start()
+        {
+            m_started = true;
+            m_allocations = Allocations::Current();
+            m_start = std::chrono::steady_clock::now();
+        }
+
+        void Stop()
+        {
+            auto finish = std::chrono::steady_clock::now();
+            Allocations current = Allocations::Current();
+            m_seconds = std::chrono::duration<double>(finish - m_start).count();
+            m_allocations.count = current.count - m_allocations.count;
+            m_allocations.bytes = current.bytes - m_allocations.bytes;
+        }
+
+    private:
+        uint64_t                                m_iterations;
+        uint64_t                                m_done;
+        double                                  m_seconds;
+        Allocations                             m_allocations;
+        bool                                    m_started;
+        std::chrono::steady_clock::time_point   m_start;
+    };
+
+    typedef void (*Function)(State& state);
+
+    /// <summary>
+    /// Adds benchmark to the list run by Run, use BENCHMARK macro
+    /// </summary>
+    struct Registration
+    {
+        Registration(const char* name, Function function);
+    };
+
+    /// <summary>
+    /// Runs registered benchmarks whose names contain filter (all if NULL)
+    /// Number of iterations grows until a run takes minSeconds, minSeconds = 0 makes one iteration of each benchmark
+    /// </summary>
+    void Run(const char* filter, double minSeconds);
+
+    /// <summary>
+    /// Prevents compiler from optimizing away computation of the value
+    /// </summary>
+    template <typename T> inline void DoNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static const void* volatile sink;
+        sink = &value;
+#endif
+    }
+}
+
+#define BENCHMARK(name)                                                                 \
+    static void name(Benchmark::State& state);                                          \
+    static Benchmark::Registration name##_registration(#name, name);                    \
+    static void name(Benchmark::State& state)
+
+#endif //__RDF_LTD__BENCHMARK_H
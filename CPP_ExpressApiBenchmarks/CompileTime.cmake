@@ -0,0 +1,57 @@
+#
+# Compiles SOURCE with monolithic IFC4.h, with extern aggregation serializers (RDF_EXPRESS_EXTERN_SERIALIZERS)
+# and, if SPLIT_INCLUDE is set, with split headers (generator --split)
+# Prints best of REPEAT parse times (syntax check only) and build times, and size of object file of optimized build
+#
+#   cmake -DCXX=<compiler> -DCXX_ID=<GNU|Clang|MSVC> -DSOURCE=<file> -DENGINE_INCLUDE=<dir> -DMONOLITHIC_INCLUDE=<dir> [-DSPLIT_INCLUDE=<dir>] -DOUTPUT_DIR=<dir> [-DREPEAT=<n>] -P CompileTime.cmake
+#
+cmake_minimum_required(VERSION 3.23) #microseconds of string(TIMESTAMP)
+
+if(NOT REPEAT)
+    set(REPEAT 3)
+endif()
+
+function(compile_time name include define)
+    if(CXX_ID STREQUAL "MSVC")
+        set(common /nologo /w /std:c++17 /EHsc /I${ENGINE_INCLUDE} /I${include} ${define})
+        set(objectFile ${OUTPUT_DIR}/CompileTime${name}.obj)
+        set(parse ${common} /Zs ${SOURCE})
+        set(object ${common} /O2 /c ${SOURCE} /Fo${objectFile})
+    else()
+        set(common -std=c++17 -w -I${ENGINE_INCLUDE} -I${include} ${define})
+        set(objectFile ${OUTPUT_DIR}/CompileTime${name}.o)
+        set(parse ${common} -fsyntax-only ${SOURCE})
+        set(object ${common} -O2 -c ${SOURCE} -o ${objectFile})
+    endif()
+
+    best_time(parseTime "${parse}")
+    best_time(buildTime "${object}")
+    file(SIZE ${objectFile} size)
+
+    get_filename_component(sourceName ${SOURCE} NAME)
+    message("${sourceName} ${name}: parse ${parseTime} ms, build ${buildTime} ms, object ${size} bytes")
+endfunction()
+
+function(best_time var command)
+    set(best 0)
+    foreach(i RANGE 1 ${REPEAT})
+        string(TIMESTAMP start "%s%f")
+        execute_process(COMMAND ${CXX} ${command} RESULT_VARIABLE result)
+        string(TIMESTAMP finish "%s%f")
+        if(NOT result EQUAL 0)
+            message(FATAL_ERROR "failed to compile ${SOURCE}")
+        endif()
+        math(EXPR usec "${finish} - ${start}")
+        if(best EQUAL 0 OR usec LESS best)
+            set(best ${usec})
+        endif()
+    endforeach()
+    math(EXPR msec "${best} / 1000")
+    set(${var} ${msec} PARENT_SCOPE)
+endfunction()
+
+compile_time(Monolithic ${MONOLITHIC_INCLUDE} "")
+compile_time(ExternSerializers ${MONOLITHIC_INCLUDE} -DRDF_EXPRESS_EXTERN_SERIALIZERS)
+if(SPLIT_INCLUDE)
+    compile_time(Split ${SPLIT_INCLUDE} -DCOMPILE_TIME_SPLIT)
+endif()
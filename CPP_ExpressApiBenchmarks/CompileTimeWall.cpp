@@ -0,0 +1,18 @@
+//
+// Translation unit using one entity, CompileTime.cmake compiles it with monolithic and with split headers
+//
+#ifdef COMPILE_TIME_SPLIT
+#include    "IFC4/IfcWall.h"
+#else
+#include    "IFC4.h"
+#endif
+
+using namespace IFC4;
+
+extern IfcWall CreateWall(SdaiModel model)
+{
+    IfcWall wall = IfcWall::Create(model);
+    wall.put_Name("MyWall");
+    wall.put_PredefinedType(IfcWallTypeEnum::MOVABLE);
+    return wall;
+}
@@ -0,0 +1,81 @@
+//
+// Wrapping instance handles into entity classes: kind-of check by type table and supertype bitsets against sdaiIsKindOfBN
+//
+#include    <vector>
+#include    "IFC4.h"
+
+#include    "Benchmark.h"
+
+using namespace IFC4;
+using Benchmark::DoNotOptimize;
+
+//
+// 10M handles of walls, doors, slabs, spaces and property sets in mixed order
+//
+struct HandleModel
+{
+    static const int            INSTANCES = 1000;
+    static const int            HANDLES = 10000000;
+
+    SdaiModel                   model;
+    std::vector<SdaiInstance>   handles;
+    int                         elements;
+
+    HandleModel()
+    {
+        model = sdaiCreateModelBN(0, NULL, "IFC4");
+
+        std::vector<SdaiInstance> instances;
+        elements = 0;
+        for (int i = 0; i < INSTANCES; i++) {
+            switch (i % 5) {
+                case 0: instances.push_back(IfcWall::Create(model)); break;
+                case 1: instances.push_back(IfcDoor::Create(model)); break;
+                case 2: instances.push_back(IfcSlab::Create(model)); break;
+                case 3: instances.push_back(IfcSpace::Create(model)); break;
+                case 4: instances.push_back(IfcPropertySet::Create(model)); break;
+            }
+        }
+
+        handles.resize(HANDLES);
+        for (int i = 0; i < HANDLES; i++) {
+            handles[i] = instances[(i * 7) % INSTANCES];
+            elements += (i * 7) % 5 < 3;
+        }
+    }
+
+    ~HandleModel()
+    {
+        CloseModel(model);
+    }
+};
+
+BENCHMARK(WrapHandles10M)
+{
+    HandleModel m;
+    while (state.KeepRunning()) {
+        int elements = 0;
+        for (SdaiInstance handle : m.handles) {
+            IfcBuildingElement element(handle);
+            elements += (element != 0);
+        }
+        assert(elements == m.elements);
+        DoNotOptimize(elements);
+    }
+}
+
+//
+// Wrapper construction as it was before the type table
+//
+BENCHMARK(WrapHandles10M_IsKindOfBN)
+{
+    HandleModel m;
+    while (state.KeepRunning()) {
+        int elements = 0;
+        for (SdaiInstance handle : m.handles) {
+            elements += (sdaiIsKindOfBN(handle, "IfcBuildingElement") != 0);
+        }
+        assert(elements == m.elements);
+        DoNotOptimize(elements);
+    }
+}
@@ -0,0 +1,40 @@
+//
+// Aggregations of enumerations, IFC4 has none so IfcLogicalVoxelData of IFC4x4 is used
+//
+#include    <vector>
+#include    "IFC4x4.h"
+
+#include    "Benchmark.h"
+
+using namespace IFC4x4;
+using Benchmark::DoNotOptimize;
+
+BENCHMARK(AttributeAggregationGet_Enum)
+{
+    SdaiModel model = sdaiCreateModelBN(0, NULL, "IFC4x4");
+    IfcLogicalVoxelData voxels = IfcLogicalVoxelData::Create(model);
+    LOGICAL_VALUE values[] = {LOGICAL_VALUE::True, LOGICAL_VALUE::False, LOGICAL_VALUE::Unknown, LOGICAL_VALUE::True};
+    voxels.put_ValueData(values, 4);
+
+    ListOfIfcLogical data;
+    while (state.KeepRunning()) {
+        data.clear();
+        voxels.get_ValueData(data);
+        DoNotOptimize(data);
+    }
+
+    CloseModel(model);
+}
+
+BENCHMARK(AttributeAggregationPutArray_Enum)
+{
+    SdaiModel model = sdaiCreateModelBN(0, NULL, "IFC4x4");
+    IfcLogicalVoxelData voxels = IfcLogicalVoxelData::Create(model);
+    LOGICAL_VALUE values[] = {LOGICAL_VALUE::True, LOGICAL_VALUE::False, LOGICAL_VALUE::Unknown, LOGICAL_VALUE::True};
+
+    while (state.KeepRunning()) {
+        voxels.put_ValueData(values, 4);
+    }
+
+    CloseModel(model);
+}
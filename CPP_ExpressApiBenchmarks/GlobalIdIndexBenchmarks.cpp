@@ -0,0 +1,118 @@
+//
+// Lookup of instances by GlobalId: scan of the extent against GlobalIdIndex, and building of the index
+//
+#include    <string.h>
+#include    <string>
+#include    <vector>
+#include    "IFC4.h"
+
+#include    "Benchmark.h"
+
+using namespace IFC4;
+using Benchmark::DoNotOptimize;
+
+//
+// Walls with pseudo-random GlobalIds
+//
+struct GlobalIdModel
+{
+    static const int            COUNT = 20000;
+
+    SdaiModel                   model;
+    std::vector<IfcWall>        walls;
+    std::vector<std::string>    globalIds;
+
+    GlobalIdModel()
+    {
+        static const char digits[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz_$";
+
+        model = sdaiCreateModelBN(0, NULL, "IFC4");
+
+        uint64_t seed = 0x2545F4914F6CDD1Dull;
+        for (int i = 0; i < COUNT; i++) {
+            std::string globalId(22, '0');
+            for (int j = 0; j < 22; j++) {
+                seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+                globalId[j] = digits[(seed >> 58) & (j ? 63 : 3)];
+            }
+
+            IfcWall wall = IfcWall::Create(model);
+            wall.put_GlobalId(globalId.c_str());
+            walls.push_back(wall);
+            globalIds.push_back(globalId);
+        }
+    }
+
+    ~GlobalIdModel()
+    {
+        CloseModel(model);
+    }
+};
+
+BENCHMARK(GlobalIdFind_ExtentScan)
+{
+    GlobalIdModel m;
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        const char* globalId = m.globalIds[i++ % GlobalIdModel::COUNT].c_str();
+        IfcRoot found;
+        for (IfcRoot root : IfcRoot::ExtentWithSubtypes(m.model)) {
+            TextValue rootGlobalId = root.get_GlobalId();
+            if (rootGlobalId && !strcmp(rootGlobalId, globalId)) {
+                found = root;
+                break;
+            }
+        }
+        DoNotOptimize(found);
+    }
+}
+
+BENCHMARK(GlobalIdFind_Index)
+{
+    GlobalIdModel m;
+    GlobalIdIndex index(m.model);
+    assert(index.size() == GlobalIdModel::COUNT);
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        size_t k = i++ % GlobalIdModel::COUNT;
+        IfcRoot found = index.Find(m.globalIds[k].c_str());
+        assert(found == m.walls[k]);
+        DoNotOptimize(found);
+    }
+}
+
+BENCHMARK(GlobalIdIndexBuild)
+{
+    GlobalIdModel m;
+    while (state.KeepRunning()) {
+        GlobalIdIndex index(m.model);
+        DoNotOptimize(index.size());
+    }
+}
+
+BENCHMARK(GlobalIdIndexBuild_OneThread)
+{
+    GlobalIdModel m;
+    while (state.KeepRunning()) {
+        GlobalIdIndex index(m.model, 1);
+        DoNotOptimize(index.size());
+    }
+}
+
+BENCHMARK(GlobalIdPut_WithIndex)
+{
+    GlobalIdModel m;
+    std::vector<std::string> renamed(m.globalIds);
+    for (auto& globalId : renamed) {
+        globalId[21] = (globalId[21] == 'A') ? 'B' : 'A';
+    }
+
+    GlobalIdIndex index(m.model);
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        size_t k = i++ % GlobalIdModel::COUNT;
+        m.walls[k].put_GlobalId(renamed[k].c_str());
+        m.walls[k].put_GlobalId(m.globalIds[k].c_str());
+    }
+    assert(index.Find(m.globalIds[0].c_str()) == m.walls[0]);
+}
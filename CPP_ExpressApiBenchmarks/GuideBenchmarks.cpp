@@ -0,0 +1,568 @@
+//
+// Operations of GuideExample.cpp, one benchmark per accessor template of EngineEx_Template.h
+// Names are the template names, suffix tells element kind for aggregations
+// Sdai* benchmarks measure the engine calls the wrappers are built on
+//
+#include    <string>
+#include    <vector>
+#include    "IFC4.h"
+
+#include    "Benchmark.h"
+
+using namespace IFC4;
+using Benchmark::DoNotOptimize;
+
+//
+// Model with instances and values used by the benchmarks
+//
+struct GuideModel
+{
+    SdaiModel                   model;
+    IfcWall                     wall;
+    IfcDoor                     door;
+    IfcActor                    actor;
+    IfcPerson                   person;
+    IfcMeasureWithUnit          measure;
+    IfcSurfaceStyleRendering    rendering;
+    IfcSite                     site;
+    IfcGroup                    group;
+    IfcRelAssignsToGroup        relGroup;
+    IfcPropertyEnumeratedValue  propEnumValue;
+    IfcCartesianPointList3D     pointList;
+    IfcPropertySingleValue      prop;
+
+    GuideModel()
+    {
+        model = sdaiCreateModelBN(0, NULL, "IFC4");
+
+        SetTextEncoding(model, enum_string_encoding::UTF8);
+
+        wall = IfcWall::Create(model);
+        wall.put_Name("MyWall");
+        wall.put_Description("\xD0\x9D\xD0\xB0\xD1\x80\xD1\x83\xD0\xB6\xD0\xBD\xD0\xB0\xD1\x8F \xD1\x81\xD1\x82\xD0\xB5\xD0\xBD\xD0\xB0 / Au\xC3\x9F" "enwand mit W\xC3\xA4rmed\xC3\xA4mmung"); //non-ASCII text longer than SSO
+        wall.put_PredefinedType(IfcWallTypeEnum::MOVABLE);
+
+        door = IfcDoor::Create(model);
+        door.put_OverallWidth(900);
+
+        actor = IfcActor::Create(model);
+        person = IfcPerson::Create(model);
+        actor.put_TheActor().put_IfcPerson(person);
+        ListOfIfcLabel names;
+        for (int i = 0; i < 8; i++) {
+            names.push_back(i % 2 ? "Middle name longer than SSO" : "Another middle name of person");
+        }
+        person.put_MiddleNames(names);
+
+        measure = IfcMeasureWithUnit::Create(model);
+        measure.put_ValueComponent().put_IfcSimpleValue().put_IfcInteger(75);
+
+        rendering = IfcSurfaceStyleRendering::Create(model);
+        rendering.put_DiffuseColour().put_IfcNormalisedRatioMeasure(0.5);
+
+        site = IfcSite::Create(model);
+        int arrInt[] = {43, 17, 3, 4};
+        site.put_RefLongitude(arrInt, 4);
+
+        group = IfcGroup::Create(model);
+        relGroup = IfcRelAssignsToGroup::Create(model);
+        relGroup.put_RelatingGroup(group);
+        IfcObjectDefinition groupObjects[] = {wall, site};
+        relGroup.put_RelatedObjects(groupObjects, 2);
+
+        propEnumValue = IfcPropertyEnumeratedValue::Create(model);
+        ListOfIfcValue lstValue;
+        IfcValue value(propEnumValue);
+        value._IfcSimpleValue().put_IfcLabel("MyLabel");
+        lstValue.push_back(value);
+        value._IfcMeasureValue().put_IfcCountMeasure(4);
+        lstValue.push_back(value);
+        propEnumValue.put_EnumerationValues(lstValue);
+
+        pointList = IfcCartesianPointList3D::Create(model);
+        double coords[] = {1, 0, 1, 0, 1, 0};
+        pointList.put_CoordList(coords, 6, 3);
+
+        prop = IfcPropertySingleValue::Create(model);
+        double cplx[] = {2.1, 1.5};
+        prop.put_NominalValue().put_IfcMeasureValue().put_IfcComplexNumber(cplx, 2);
+    }
+
+    ~GuideModel()
+    {
+        CloseModel(model);
+    }
+};
+
+//
+// Engine calls
+//
+
+BENCHMARK(SdaiGetAttrBN_Real)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        double width = 0;
+        DoNotOptimize(sdaiGetAttrBN(m.door, "OverallWidth", sdaiREAL, &width));
+        DoNotOptimize(width);
+    }
+}
+
+BENCHMARK(SdaiGetAttr_Real)
+{
+    GuideModel m;
+    SdaiAttr attr = sdaiGetAttrDefinition(sdaiGetEntity(m.model, "IfcDoor"), "OverallWidth");
+    while (state.KeepRunning()) {
+        double width = 0;
+        DoNotOptimize(sdaiGetAttr(m.door, attr, sdaiREAL, &width));
+        DoNotOptimize(width);
+    }
+}
+
+//
+// Attributes
+//
+
+BENCHMARK(AttributeSimpleGet)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        Nullable<double> width = m.door.get_OverallWidth();
+        DoNotOptimize(width);
+    }
+}
+
+BENCHMARK(AttributeSimpleGet_ByOrdinal)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        Nullable<double> width = m.door.GetAttr<IfcDoor::attr::OverallWidth>();
+        DoNotOptimize(width);
+    }
+}
+
+BENCHMARK(AttributeSimpleGet_ByRuntimeOrdinal)
+{
+    GuideModel m;
+    IntValue ordinal = IfcDoor::attr::OverallWidth;
+    DoNotOptimize(ordinal);
+    while (state.KeepRunning()) {
+        double width = 0;
+        DoNotOptimize(m.door.GetAttr(ordinal, sdaiREAL, &width));
+        DoNotOptimize(width);
+    }
+}
+
+BENCHMARK(AttributeSimplePut)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        m.door.put_OverallWidth(900);
+    }
+}
+
+//
+// Accessors as generated before SdaiAttr handles were cached, the engine looks the attribute up by name on each call
+//
+BENCHMARK(AttributeSimpleGet_ByName)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        double val = 0;
+        Nullable<double> width = sdaiGetAttrBN(m.door, "OverallWidth", sdaiREAL, &val) ? Nullable<double>(val) : Nullable<double>();
+        DoNotOptimize(width);
+    }
+}
+
+BENCHMARK(AttributeSimplePut_ByName)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        double width = 900;
+        sdaiPutAttrBN(m.door, "OverallWidth", sdaiREAL, &width);
+    }
+}
+
+BENCHMARK(AttributeTextGet)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        IfcLabel name = m.wall.get_Name();
+        DoNotOptimize(name);
+    }
+}
+
+#ifdef __cpp_lib_string_view
+BENCHMARK(AttributeTextGetView)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        std::string_view name = m.wall.get_Name_view();
+        DoNotOptimize(name);
+    }
+}
+#endif
+
+//
+// Owned copy of non-ASCII text: std::string from the current getter, UTF-8 getters to reused buffer
+//
+BENCHMARK(AttributeTextGet_String)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        std::string description(m.wall.get_Description());
+        DoNotOptimize(description);
+    }
+}
+
+BENCHMARK(AttributeTextGetUtf8)
+{
+    GuideModel m;
+    Utf8Buffer buffer;
+    while (state.KeepRunning()) {
+        const char* description = m.wall.get_Description_utf8(buffer);
+        DoNotOptimize(description);
+    }
+    assert(buffer.size() > 32);
+}
+
+BENCHMARK(AttributeTextGetUtf8_ThreadBuffer)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        const char* description = m.wall.get_Description_utf8();
+        DoNotOptimize(description);
+    }
+}
+
+BENCHMARK(AttributeTextGet_ByOrdinal)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        IfcLabel name = m.wall.GetAttr<IfcWall::attr::Name>();
+        DoNotOptimize(name);
+    }
+}
+
+BENCHMARK(AttributeTextPut)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        m.wall.put_Name("MyWall");
+    }
+}
+
+BENCHMARK(AttributeEnumGet)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        Nullable<IfcWallTypeEnum> type = m.wall.get_PredefinedType();
+        DoNotOptimize(type);
+    }
+}
+
+BENCHMARK(AttributeEnumPut)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        m.wall.put_PredefinedType(IfcWallTypeEnum::MOVABLE);
+    }
+}
+
+BENCHMARK(AttributeEntityGet)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        IfcGroup group = m.relGroup.get_RelatingGroup();
+        DoNotOptimize(group);
+    }
+}
+
+BENCHMARK(AttributeEntityPut)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        m.relGroup.put_RelatingGroup(m.group);
+    }
+}
+
+//
+// Selects
+//
+
+BENCHMARK(SelectEntityGet)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        IfcPerson person = m.actor.get_TheActor().get_IfcPerson();
+        DoNotOptimize(person);
+    }
+}
+
+BENCHMARK(SelectEntityPut)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        m.actor.put_TheActor().put_IfcPerson(m.person);
+    }
+}
+
+BENCHMARK(SelectGetAsEntity)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        SdaiInstance inst = m.actor.get_TheActor().as_instance();
+        DoNotOptimize(inst);
+    }
+}
+
+BENCHMARK(SelectSimpleGet)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        Nullable<IfcNormalisedRatioMeasure> factor = m.rendering.get_DiffuseColour().get_IfcNormalisedRatioMeasure();
+        DoNotOptimize(factor);
+    }
+}
+
+BENCHMARK(SelectSimplePut)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        m.rendering.put_DiffuseColour().put_IfcNormalisedRatioMeasure(0.5);
+    }
+}
+
+BENCHMARK(SelectNestedGet)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        Nullable<IfcInteger> value = m.measure.get_ValueComponent().get_IfcSimpleValue().get_IfcInteger();
+        DoNotOptimize(value);
+    }
+}
+
+BENCHMARK(SelectNestedGet_Mismatch)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        Nullable<IfcAreaMeasure> value = m.measure.get_ValueComponent().get_IfcMeasureValue().get_IfcAreaMeasure();
+        DoNotOptimize(value);
+    }
+}
+
+BENCHMARK(SelectNestedPut)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        m.measure.put_ValueComponent().put_IfcSimpleValue().put_IfcInteger(75);
+    }
+}
+
+BENCHMARK(SelectGetAsInt)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        Nullable<IntValue> value = m.measure.get_ValueComponent().as_int();
+        DoNotOptimize(value);
+    }
+}
+
+BENCHMARK(SelectGetAsDouble)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        Nullable<double> value = m.measure.get_ValueComponent().as_double();
+        DoNotOptimize(value);
+    }
+}
+
+BENCHMARK(SelectGetAsText)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        TextValue value = m.measure.get_ValueComponent().as_text();
+        DoNotOptimize(value);
+    }
+}
+
+BENCHMARK(SelectGetAsTextUtf8)
+{
+    GuideModel m;
+    Utf8Buffer buffer;
+    while (state.KeepRunning()) {
+        const char* text = m.measure.get_ValueComponent().as_text_utf8(buffer);
+        DoNotOptimize(text);
+    }
+}
+
+BENCHMARK(SelectAggregationGet)
+{
+    GuideModel m;
+    IfcComplexNumber cplxNum;
+    while (state.KeepRunning()) {
+        cplxNum.clear();
+        m.prop.get_NominalValue().get_IfcMeasureValue().get_IfcComplexNumber(cplxNum);
+        DoNotOptimize(cplxNum);
+    }
+}
+
+BENCHMARK(SelectAggregationPutArray)
+{
+    GuideModel m;
+    double cplx[] = {2.1, 1.5};
+    while (state.KeepRunning()) {
+        m.prop.put_NominalValue().put_IfcMeasureValue().put_IfcComplexNumber(cplx, 2);
+    }
+}
+
+//
+// Aggregations
+//
+
+BENCHMARK(AttributeAggregationGet_Simple)
+{
+    GuideModel m;
+    std::vector<int_t> vector;
+    while (state.KeepRunning()) {
+        vector.clear();
+        m.site.get_RefLongitude(vector);
+        DoNotOptimize(vector);
+    }
+}
+
+BENCHMARK(AttributeAggregationPut_Simple)
+{
+    GuideModel m;
+    IfcCompoundPlaneAngleMeasure planeAngle;
+    planeAngle.push_back(44);
+    planeAngle.push_back(34);
+    planeAngle.push_back(3);
+    while (state.KeepRunning()) {
+        m.site.put_RefLatitude(planeAngle);
+    }
+}
+
+BENCHMARK(AttributeAggregationPutArray_Simple)
+{
+    GuideModel m;
+    int arrInt[] = {43, 17, 3, 4};
+    while (state.KeepRunning()) {
+        m.site.put_RefLongitude(arrInt, 4);
+    }
+}
+
+BENCHMARK(AttributeAggregationGet_Instance)
+{
+    GuideModel m;
+    SetOfIfcObjectDefinition objects;
+    while (state.KeepRunning()) {
+        objects.clear();
+        m.relGroup.get_RelatedObjects(objects);
+        DoNotOptimize(objects);
+    }
+}
+
+BENCHMARK(AttributeAggregationPutArray_Instance)
+{
+    GuideModel m;
+    IfcObjectDefinition groupObjects[] = {m.wall, m.site};
+    while (state.KeepRunning()) {
+        m.relGroup.put_RelatedObjects(groupObjects, 2);
+    }
+}
+
+BENCHMARK(AttributeAggregationGet_Text)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        ListOfIfcLabel names;
+        m.person.get_MiddleNames(names);
+        DoNotOptimize(names);
+    }
+}
+
+#ifdef __cpp_lib_string_view
+BENCHMARK(AttributeAggregationGet_TextView)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        std::vector<std::string_view> names;
+        m.person.get_MiddleNames(names);
+        DoNotOptimize(names);
+    }
+}
+
+BENCHMARK(AttributeAggregationGet_TextInterned)
+{
+    GuideModel m;
+    TextArena arena;
+    InternedTextList names(arena);
+    while (state.KeepRunning()) {
+        names.clear();
+        m.person.get_MiddleNames(names);
+        DoNotOptimize(names);
+    }
+}
+#endif
+
+BENCHMARK(AttributeAggregationGet_Select)
+{
+    GuideModel m;
+    while (state.KeepRunning()) {
+        ListOfIfcValue values;
+        m.propEnumValue.get_EnumerationValues(values);
+        DoNotOptimize(values);
+    }
+}
+
+BENCHMARK(AttributeAggregationPut_Select)
+{
+    GuideModel m;
+    ListOfIfcValue values;
+    m.propEnumValue.get_EnumerationValues(values);
+    while (state.KeepRunning()) {
+        m.propEnumValue.put_EnumerationValues(values);
+    }
+}
+
+BENCHMARK(AttributeAggregationGet_Aggregation)
+{
+    GuideModel m;
+    ListOfListOfIfcLengthMeasure coordList;
+    while (state.KeepRunning()) {
+        coordList.clear();
+        m.pointList.get_CoordList(coordList);
+        DoNotOptimize(coordList);
+    }
+}
+
+BENCHMARK(AttributeAggregationPut_Aggregation)
+{
+    GuideModel m;
+    ListOfListOfIfcLengthMeasure coordList;
+    m.pointList.get_CoordList(coordList);
+    while (state.KeepRunning()) {
+        m.pointList.put_CoordList(coordList);
+    }
+}
+
+BENCHMARK(AttributeAggregationGetFlat)
+{
+    GuideModel m;
+    double coords[6];
+    while (state.KeepRunning()) {
+        IntValue count = m.pointList.get_CoordList(coords, 6, 3);
+        DoNotOptimize(count);
+        DoNotOptimize(coords);
+    }
+}
+
+BENCHMARK(AttributeAggregationPutFlat)
+{
+    GuideModel m;
+    double coords[] = {1, 0, 1, 0, 1, 0};
+    while (state.KeepRunning()) {
+        m.pointList.put_CoordList(coords, 6, 3);
+    }
+}
@@ -0,0 +1,31 @@
+//
+// Usage: CPP_ExpressApiBenchmarks [--filter=<substring>] [--min-time=<seconds>]
+//
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <string.h>
+
+#include    "Benchmark.h"
+
+extern int main(int argc, char* argv[])
+{
+    const char* filter = NULL;
+    double minSeconds = 0.2;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strncmp(argv[i], "--filter=", 9)) {
+            filter = argv[i] + 9;
+        }
+        else if (!strncmp(argv[i], "--min-time=", 11)) {
+            minSeconds = atof(argv[i] + 11);
+        }
+        else {
+            printf("Usage: %s [--filter=<substring>] [--min-time=<seconds>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    Benchmark::Run(filter, minSeconds);
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+//
+// Aggregations of aggregations of aggregations, no IFC4 attribute has 3 levels so the type is declared as the generator would
+// and stored in CoordList of IfcCartesianPointList3D
+//
+#include    <vector>
+#include    "IFC4.h"
+
+#include    "Benchmark.h"
+
+using namespace IFC4;
+using Benchmark::DoNotOptimize;
+
+namespace IFC4
+{
+    typedef AggrContainer<ListOfListOfIfcLengthMeasure> ListOfListOfListOfIfcLengthMeasure;
+    template <typename TList> class ListOfListOfListOfIfcLengthMeasureSerializer : public AggrSerializerAggr<TList, ListOfListOfIfcLengthMeasure, ListOfListOfIfcLengthMeasureSerializer<ListOfListOfIfcLengthMeasure>> {};
+}
+
+//
+// 16 x 16 points of xyz
+//
+struct NestedModel
+{
+    SdaiModel                           model;
+    IfcCartesianPointList3D             pointList;
+    SdaiAttr                            attr;
+    ListOfListOfListOfIfcLengthMeasure  grid;
+
+    NestedModel()
+    {
+        model = sdaiCreateModelBN(0, NULL, "IFC4");
+        pointList = IfcCartesianPointList3D::Create(model);
+        attr = sdaiGetAttrDefinition(sdaiGetEntity(model, "IfcCartesianPointList3D"), "CoordList");
+
+        for (int i = 0; i < 16; i++) {
+            ListOfListOfIfcLengthMeasure row;
+            for (int j = 0; j < 16; j++) {
+                ListOfIfcLengthMeasure point;
+                point.push_back(i);
+                point.push_back(j);
+                point.push_back(0);
+                row.push_back(point);
+            }
+            grid.push_back(row);
+        }
+
+        ListOfListOfListOfIfcLengthMeasureSerializer<ListOfListOfListOfIfcLengthMeasure> sr;
+        sr.ToSdaiAggr(grid, pointList, attr);
+    }
+
+    ~NestedModel()
+    {
+        CloseModel(model);
+    }
+};
+
+BENCHMARK(AttributeAggregationGet_Aggregation3)
+{
+    NestedModel m;
+    ListOfListOfListOfIfcLengthMeasure grid;
+    while (state.KeepRunning()) {
+        grid.clear();
+        ListOfListOfListOfIfcLengthMeasureSerializer<ListOfListOfListOfIfcLengthMeasure> sr;
+        sr.FromAttr(grid, m.pointList, m.attr);
+        DoNotOptimize(grid);
+    }
+    assert(grid == m.grid);
+}
+
+BENCHMARK(AttributeAggregationPut_Aggregation3)
+{
+    NestedModel m;
+    while (state.KeepRunning()) {
+        ListOfListOfListOfIfcLengthMeasureSerializer<ListOfListOfListOfIfcLengthMeasure> sr;
+        sr.ToSdaiAggr(m.grid, m.pointList, m.attr);
+    }
+}
@@ -0,0 +1,211 @@
+//
+// World transforms of placements: PlacementResolver against walk of PlacementRelTo chain with the wrappers
+//
+#include    <math.h>
+#include    <vector>
+#include    "IFC4.h"
+
+#include    "Benchmark.h"
+
+using namespace IFC4;
+using Benchmark::DoNotOptimize;
+
+//
+// Site - building - storeys - walls, each placement is relative to the placement of its container
+//
+struct PlacementModel
+{
+    static const int                    STOREYS = 20;
+    static const int                    WALLS = 5000;
+
+    SdaiModel                           model;
+    std::vector<IfcLocalPlacement>      wallPlacements;
+
+    PlacementModel()
+    {
+        model = sdaiCreateModelBN(0, NULL, "IFC4");
+
+        IfcDirection z = Direction(0, 0, 1);
+        IfcLocalPlacement site = Placement(IfcObjectPlacement(0), 0, 0, 0, z, Direction(1, 0, 0));
+        IfcLocalPlacement building = Placement(site, 1000, 2000, 0, z, Direction(0.8, 0.6, 0));
+
+        for (int s = 0; s < STOREYS; s++) {
+            IfcLocalPlacement storey = Placement(building, 0, 0, 3000.0 * s, IfcDirection(0), IfcDirection(0));
+            for (int i = 0; i < WALLS / STOREYS; i++) {
+                IfcDirection x = (i % 2) ? Direction(cos(i * 0.1), sin(i * 0.1), 0) : IfcDirection(0);
+                wallPlacements.push_back(Placement(storey, 100.0 * i, 50.0 * (i % 7), 0, z, x));
+            }
+        }
+    }
+
+    ~PlacementModel()
+    {
+        CloseModel(model);
+    }
+
+    IfcDirection Direction(double x, double y, double z)
+    {
+        IfcDirection direction = IfcDirection::Create(model);
+        double ratios[] = {x, y, z};
+        direction.put_DirectionRatios(ratios, 3);
+        return direction;
+    }
+
+    IfcLocalPlacement Placement(IfcObjectPlacement relativeTo, double x, double y, double z, IfcDirection axis, IfcDirection refDirection)
+    {
+        IfcCartesianPoint location = IfcCartesianPoint::Create(model);
+        double coordinates[] = {x, y, z};
+        location.put_Coordinates(coordinates, 3);
+
+        IfcAxis2Placement3D axes = IfcAxis2Placement3D::Create(model);
+        axes.put_Location(location);
+        if (axis) {
+            axes.put_Axis(axis);
+        }
+        if (refDirection) {
+            axes.put_RefDirection(refDirection);
+        }
+
+        IfcLocalPlacement placement = IfcLocalPlacement::Create(model);
+        if (relativeTo) {
+            placement.put_PlacementRelTo(relativeTo);
+        }
+        placement.put_RelativePlacement().put_IfcAxis2Placement3D(axes);
+        return placement;
+    }
+};
+
+static void MultiplyScalar(const TransformMatrix& a, const TransformMatrix& b, TransformMatrix& result)
+{
+    TransformMatrix product;
+    for (int i = 0; i < 16; i += 4) {
+        for (int j = 0; j < 4; j++) {
+            product.m[i + j] = a.m[i] * b.m[j] + a.m[i + 1] * b.m[4 + j] + a.m[i + 2] * b.m[8 + j] + a.m[i + 3] * b.m[12 + j];
+        }
+    }
+    result = product;
+}
+
+static void Normalize(double v[3])
+{
+    double length = sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    v[0] /= length; v[1] /= length; v[2] /= length;
+}
+
+static TransformMatrix LocalTransform(IfcLocalPlacement placement)
+{
+    IfcAxis2Placement3D axes = placement.get_RelativePlacement().get_IfcAxis2Placement3D();
+
+    ListOfIfcLengthMeasure origin;
+    axes.get_Location().get_Coordinates(origin);
+
+    double z[3] = {0, 0, 1};
+    double x[3] = {1, 0, 0};
+    ListOfIfcReal ratios;
+    if (IfcDirection axis = axes.get_Axis()) {
+        axis.get_DirectionRatios(ratios);
+        z[0] = ratios[0]; z[1] = ratios[1]; z[2] = ratios[2];
+    }
+    ratios.clear();
+    if (IfcDirection refDirection = axes.get_RefDirection()) {
+        refDirection.get_DirectionRatios(ratios);
+        x[0] = ratios[0]; x[1] = ratios[1]; x[2] = ratios[2];
+    }
+
+    Normalize(z);
+    double dot = x[0] * z[0] + x[1] * z[1] + x[2] * z[2];
+    for (int j = 0; j < 3; j++) {
+        x[j] -= dot * z[j];
+    }
+    Normalize(x);
+    double y[3] = {z[1] * x[2] - z[2] * x[1], z[2] * x[0] - z[0] * x[2], z[0] * x[1] - z[1] * x[0]};
+
+    TransformMatrix local = TransformMatrix::Identity();
+    for (int j = 0; j < 3; j++) {
+        local.m[j] = x[j];
+        local.m[4 + j] = y[j];
+        local.m[8 + j] = z[j];
+        local.m[12 + j] = origin[j];
+    }
+    return local;
+}
+
+//
+// Reads every placement of the chain again for each element
+//
+static TransformMatrix WorldTransform(IfcObjectPlacement placement)
+{
+    TransformMatrix world = TransformMatrix::Identity();
+    for (IfcLocalPlacement local(placement); local != 0; local = IfcLocalPlacement(local.get_PlacementRelTo())) {
+        MultiplyScalar(world, LocalTransform(local), world);
+    }
+    return world;
+}
+
+//
+// Transforms of the resolver are checked by CPP_ExpressApiPlacements test
+//
+BENCHMARK(PlacementResolverBuild)
+{
+    PlacementModel m;
+    while (state.KeepRunning()) {
+        PlacementResolver resolver(m.model);
+        DoNotOptimize(resolver.size());
+    }
+}
+
+BENCHMARK(WallPlacement_WrapperWalk)
+{
+    PlacementModel m;
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        TransformMatrix world = WorldTransform(m.wallPlacements[i++ % PlacementModel::WALLS]);
+        DoNotOptimize(world);
+    }
+}
+
+BENCHMARK(WallPlacement_PlacementResolver)
+{
+    PlacementModel m;
+    PlacementResolver resolver(m.model);
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        const TransformMatrix* world = resolver.Transform(m.wallPlacements[i++ % PlacementModel::WALLS]);
+        DoNotOptimize(world);
+    }
+}
+
+//
+// Composition of all transforms with the parent transforms, as the resolver does it
+//
+BENCHMARK(ComposeTransforms_Scalar)
+{
+    PlacementModel m;
+    PlacementResolver resolver(m.model);
+    std::vector<TransformMatrix> transforms(resolver.Transforms());
+    while (state.KeepRunning()) {
+        for (size_t i = 0; i < transforms.size(); i++) {
+            int parent = resolver.Parents()[i];
+            if (parent >= 0) {
+                MultiplyScalar(resolver.Transforms()[i], transforms[parent], transforms[i]);
+            }
+        }
+        DoNotOptimize(transforms);
+    }
+}
+
+BENCHMARK(ComposeTransforms_MultiplyTransforms)
+{
+    PlacementModel m;
+    PlacementResolver resolver(m.model);
+    std::vector<TransformMatrix> transforms(resolver.Transforms());
+    while (state.KeepRunning()) {
+        for (size_t i = 0; i < transforms.size(); i++) {
+            int parent = resolver.Parents()[i];
+            if (parent >= 0) {
+                MultiplyTransforms(resolver.Transforms()[i], transforms[parent], transforms[i]);
+            }
+        }
+        DoNotOptimize(transforms);
+    }
+}
@@ -0,0 +1,164 @@
+//
+// Single-value properties of elements: PropertyTable against walk of property sets and selects with the wrappers
+//
+#include    <string.h>
+#include    <vector>
+#include    "IFC4.h"
+
+#include    "Benchmark.h"
+
+using namespace IFC4;
+using Benchmark::DoNotOptimize;
+
+//
+// Walls with own Pset_WallCommon of FireRating, IsExternal and ThermalTransmittance, and other property set
+//
+struct PropertyModel
+{
+    static const int            WALLS = 5000;
+
+    SdaiModel                   model;
+    std::vector<IfcWall>        walls;
+    std::vector<IfcPropertySet> wallCommon;
+
+    PropertyModel()
+    {
+        model = sdaiCreateModelBN(0, NULL, "IFC4");
+
+        for (int i = 0; i < WALLS; i++) {
+            IfcWall wall = IfcWall::Create(model);
+            walls.push_back(wall);
+
+            IfcPropertySingleValue fireRating = IfcPropertySingleValue::Create(model);
+            fireRating.put_Name("FireRating");
+            fireRating.put_NominalValue().put_IfcSimpleValue().put_IfcLabel((i % 3) ? "REI60" : "REI90");
+
+            IfcPropertySingleValue isExternal = IfcPropertySingleValue::Create(model);
+            isExternal.put_Name("IsExternal");
+            isExternal.put_NominalValue().put_IfcSimpleValue().put_IfcBoolean(i % 2 == 0);
+
+            IfcPropertySingleValue thermalTransmittance = IfcPropertySingleValue::Create(model);
+            thermalTransmittance.put_Name("ThermalTransmittance");
+            thermalTransmittance.put_NominalValue().put_IfcDerivedMeasureValue().put_IfcThermalTransmittanceMeasure(0.2 + i % 10 * 0.01);
+
+            IfcProperty properties[] = {thermalTransmittance, isExternal, fireRating};
+            Define(wall, "Pset_WallCommon", properties, 3);
+            wallCommon.push_back(IfcPropertySet(lastPropertySet));
+
+            IfcPropertySingleValue reference = IfcPropertySingleValue::Create(model);
+            reference.put_Name("Reference");
+            reference.put_NominalValue().put_IfcSimpleValue().put_IfcIdentifier("W-01");
+            IfcProperty other[] = {reference};
+            Define(wall, "Pset_Manufacturer", other, 1);
+        }
+    }
+
+    ~PropertyModel()
+    {
+        CloseModel(model);
+    }
+
+    void Define(IfcObjectDefinition object, const char* name, IfcProperty* properties, size_t count)
+    {
+        IfcPropertySet propertySet = IfcPropertySet::Create(model);
+        propertySet.put_Name(name);
+        propertySet.put_HasProperties(properties, count);
+
+        IfcRelDefinesByProperties defines = IfcRelDefinesByProperties::Create(model);
+        defines.put_RelatingPropertyDefinition().put_IfcPropertySetDefinition(propertySet);
+        IfcObjectDefinition objects[] = {object};
+        defines.put_RelatedObjects(objects, 1);
+
+        lastPropertySet = propertySet;
+    }
+
+    SdaiInstance lastPropertySet = 0;
+};
+
+BENCHMARK(PropertyTableBuild)
+{
+    PropertyModel m;
+    while (state.KeepRunning()) {
+        PropertyTable table(m.model);
+        DoNotOptimize(table.size());
+    }
+}
+
+BENCHMARK(PropertyTableBuild_Threads)
+{
+    PropertyModel m;
+    while (state.KeepRunning()) {
+        PropertyTable table(m.model, 0);
+        DoNotOptimize(table.size());
+    }
+}
+
+//
+// Property set of the wall is known, the walk reads its properties and the select of the value
+//
+BENCHMARK(WallFireRating_WrapperWalk)
+{
+    PropertyModel m;
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        size_t k = i++ % PropertyModel::WALLS;
+        SetOfIfcProperty properties;
+        m.wallCommon[k].get_HasProperties(properties);
+        IfcLabel rating = NULL;
+        for (IfcProperty property : properties) {
+            if (!strcmp(property.get_Name(), "FireRating")) {
+                rating = IfcPropertySingleValue(property).get_NominalValue().get_IfcSimpleValue().get_IfcLabel();
+                break;
+            }
+        }
+        assert(rating);
+        DoNotOptimize(rating);
+    }
+}
+
+BENCHMARK(WallFireRating_PropertyTable)
+{
+    PropertyModel m;
+    PropertyTable table(m.model);
+    assert(table.size() == 4 * PropertyModel::WALLS);
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        const PropertyValue* rating = table.Value(m.walls[i++ % PropertyModel::WALLS], "Pset_WallCommon", "FireRating");
+        assert(rating && rating->kind == PropertyValue::Text);
+        DoNotOptimize(rating);
+    }
+}
+
+BENCHMARK(WallFireRating_PropertyTableNameIds)
+{
+    PropertyModel m;
+    PropertyTable table(m.model);
+    uint32_t wallCommon = table.NameId("Pset_WallCommon");
+    uint32_t fireRating = table.NameId("FireRating");
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        ptrdiff_t row = table.Find(m.walls[i++ % PropertyModel::WALLS], wallCommon, fireRating);
+        assert(row >= 0);
+        DoNotOptimize(row);
+    }
+}
+
+//
+// Number of external walls, one pass over two columns
+//
+BENCHMARK(ExternalWalls_ColumnScan)
+{
+    PropertyModel m;
+    PropertyTable table(m.model);
+    uint32_t isExternal = table.NameId("IsExternal");
+    while (state.KeepRunning()) {
+        const uint32_t* names = table.PropertyNames().data();
+        const PropertyValue* values = table.Values().data();
+        size_t count = 0;
+        for (size_t row = 0; row < table.size(); row++) {
+            count += (names[row] == isExternal && values[row].integer == 1);
+        }
+        assert(count == PropertyModel::WALLS / 2);
+        DoNotOptimize(count);
+    }
+}
@@ -0,0 +1,121 @@
+//
+// Relating and related instances of objectified relationships: RelationshipIndex against reads of relationships with the wrappers
+//
+#include    <vector>
+#include    "IFC4.h"
+
+#include    "Benchmark.h"
+
+using namespace IFC4;
+using Benchmark::DoNotOptimize;
+
+//
+// Storeys containing walls, each wall is defined by its own property set
+//
+struct RelationshipModel
+{
+    static const int                STOREYS = 10;
+    static const int                WALLS = 2000;
+
+    SdaiModel                       model;
+    std::vector<IfcBuildingStorey>  storeys;
+    std::vector<IfcWall>            walls;
+
+    RelationshipModel()
+    {
+        model = sdaiCreateModelBN(0, NULL, "IFC4");
+
+        for (int s = 0; s < STOREYS; s++) {
+            storeys.push_back(IfcBuildingStorey::Create(model));
+        }
+
+        std::vector<SetOfIfcProduct> contained(STOREYS);
+        for (int i = 0; i < WALLS; i++) {
+            IfcWall wall = IfcWall::Create(model);
+            walls.push_back(wall);
+            contained[i % STOREYS].push_back(wall);
+
+            IfcPropertySet pset = IfcPropertySet::Create(model);
+            IfcRelDefinesByProperties defines = IfcRelDefinesByProperties::Create(model);
+            defines.put_RelatingPropertyDefinition().put_IfcPropertySetDefinition(pset);
+            SetOfIfcObjectDefinition objects;
+            objects.push_back(wall);
+            defines.put_RelatedObjects(objects);
+        }
+
+        for (int s = 0; s < STOREYS; s++) {
+            IfcRelContainedInSpatialStructure containment = IfcRelContainedInSpatialStructure::Create(model);
+            containment.put_RelatingStructure(storeys[s]);
+            containment.put_RelatedElements(contained[s]);
+        }
+    }
+
+    ~RelationshipModel()
+    {
+        CloseModel(model);
+    }
+};
+
+BENCHMARK(RelationshipIndexBuild)
+{
+    RelationshipModel m;
+    while (state.KeepRunning()) {
+        RelationshipIndex index(m.model);
+        DoNotOptimize(index.Pairs(RelationshipIndex::DefinesByProperties));
+    }
+}
+
+//
+// Stand-in engine never sets inverse attributes, so this is the cost of the engine call and the list without members
+//
+BENCHMARK(ElementPropertySets_InverseAttribute)
+{
+    RelationshipModel m;
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        SetOfIfcRelDefinesByProperties definedBy;
+        m.walls[i++ % RelationshipModel::WALLS].get_IsDefinedBy(definedBy);
+        DoNotOptimize(definedBy);
+    }
+}
+
+BENCHMARK(ElementPropertySets_RelationshipIndex)
+{
+    RelationshipModel m;
+    RelationshipIndex index(m.model);
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        auto psets = index.Relating(RelationshipIndex::DefinesByProperties, m.walls[i++ % RelationshipModel::WALLS]);
+        assert(psets.count == 1);
+        DoNotOptimize(psets);
+    }
+}
+
+BENCHMARK(StoreyElements_RelationshipScan)
+{
+    RelationshipModel m;
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        IfcBuildingStorey storey = m.storeys[i++ % RelationshipModel::STOREYS];
+        SetOfIfcProduct elements;
+        for (IfcRelContainedInSpatialStructure containment : IfcRelContainedInSpatialStructure::Extent(m.model)) {
+            if (containment.get_RelatingStructure() == storey) {
+                containment.get_RelatedElements(elements);
+            }
+        }
+        assert(elements.size() == RelationshipModel::WALLS / RelationshipModel::STOREYS);
+        DoNotOptimize(elements);
+    }
+}
+
+BENCHMARK(StoreyElements_RelationshipIndex)
+{
+    RelationshipModel m;
+    RelationshipIndex index(m.model);
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        auto elements = index.Related(RelationshipIndex::ContainedInSpatialStructure, m.storeys[i++ % RelationshipModel::STOREYS]);
+        assert(elements.count == RelationshipModel::WALLS / RelationshipModel::STOREYS);
+        DoNotOptimize(elements);
+    }
+}
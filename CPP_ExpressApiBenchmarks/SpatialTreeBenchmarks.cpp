@@ -0,0 +1,150 @@
+//
+// Elements of spatial structure: SpatialTree against recursive walk of relationships with the wrappers
+//
+#include    <vector>
+#include    "IFC4.h"
+
+#include    "Benchmark.h"
+
+using namespace IFC4;
+using Benchmark::DoNotOptimize;
+
+//
+// Project - site - building - storeys, each storey contains walls and doors
+//
+struct SpatialModel
+{
+    static const int                STOREYS = 10;
+    static const int                ELEMENTS = 2000;
+
+    SdaiModel                       model;
+    IfcProject                      project;
+    IfcBuilding                     building;
+    std::vector<IfcBuildingStorey>  storeys;
+
+    SpatialModel()
+    {
+        model = sdaiCreateModelBN(0, NULL, "IFC4");
+
+        project = IfcProject::Create(model);
+        IfcSite site = IfcSite::Create(model);
+        building = IfcBuilding::Create(model);
+        Aggregate(project, site);
+        Aggregate(site, building);
+
+        for (int s = 0; s < STOREYS; s++) {
+            IfcBuildingStorey storey = IfcBuildingStorey::Create(model);
+            storeys.push_back(storey);
+            Aggregate(building, storey);
+
+            SetOfIfcProduct elements;
+            for (int i = 0; i < ELEMENTS / STOREYS; i++) {
+                if (i % 4) {
+                    elements.push_back(IfcWall::Create(model));
+                }
+                else {
+                    elements.push_back(IfcDoor::Create(model));
+                }
+            }
+            Contain(storey, elements);
+        }
+    }
+
+    ~SpatialModel()
+    {
+        CloseModel(model);
+    }
+
+    void Aggregate(IfcObjectDefinition whole, IfcObjectDefinition part)
+    {
+        IfcRelAggregates aggregates = IfcRelAggregates::Create(model);
+        aggregates.put_RelatingObject(whole);
+        SetOfIfcObjectDefinition parts;
+        parts.push_back(part);
+        aggregates.put_RelatedObjects(parts);
+    }
+
+    void Contain(IfcSpatialElement structure, SetOfIfcProduct& elements)
+    {
+        IfcRelContainedInSpatialStructure containment = IfcRelContainedInSpatialStructure::Create(model);
+        containment.put_RelatingStructure(structure);
+        containment.put_RelatedElements(elements);
+    }
+};
+
+//
+// Without inverse attributes the walk scans relationships for each object of the structure
+//
+static void CollectElements(SdaiModel model, IfcObjectDefinition object, SetOfIfcProduct& elements)
+{
+    for (IfcRelContainedInSpatialStructure containment : IfcRelContainedInSpatialStructure::Extent(model)) {
+        if (containment.get_RelatingStructure() == object) {
+            containment.get_RelatedElements(elements);
+        }
+    }
+    for (IfcRelAggregates aggregates : IfcRelAggregates::Extent(model)) {
+        if (aggregates.get_RelatingObject() == object) {
+            SetOfIfcObjectDefinition parts;
+            aggregates.get_RelatedObjects(parts);
+            for (auto part : parts) {
+                CollectElements(model, part, elements);
+            }
+        }
+    }
+}
+
+BENCHMARK(SpatialTreeBuild)
+{
+    SpatialModel m;
+    while (state.KeepRunning()) {
+        SpatialTree tree(m.model);
+        DoNotOptimize(tree.size());
+    }
+}
+
+BENCHMARK(SpatialTreeUpdate)
+{
+    SpatialModel m;
+    SpatialTree tree(m.model);
+    while (state.KeepRunning()) {
+        SetOfIfcProduct elements;
+        elements.push_back(IfcWall::Create(m.model));
+        m.Contain(m.storeys[0], elements);
+        tree.Update();
+    }
+}
+
+BENCHMARK(BuildingElements_WrapperWalk)
+{
+    SpatialModel m;
+    while (state.KeepRunning()) {
+        SetOfIfcProduct elements;
+        CollectElements(m.model, m.building, elements);
+        assert(elements.size() == SpatialModel::ELEMENTS);
+        DoNotOptimize(elements);
+    }
+}
+
+BENCHMARK(BuildingElements_SpatialTree)
+{
+    SpatialModel m;
+    SpatialTree tree(m.model);
+    while (state.KeepRunning()) {
+        auto elements = tree.SubtreeElements(tree.Find(m.building));
+        assert(elements.count == SpatialModel::ELEMENTS);
+        DoNotOptimize(elements);
+    }
+}
+
+BENCHMARK(StoreyWalls_SpatialTree)
+{
+    SpatialModel m;
+    SpatialTree tree(m.model);
+    SdaiEntity wallEntity = sdaiGetEntity(m.model, "IfcWall");
+    size_t i = 0;
+    while (state.KeepRunning()) {
+        auto walls = tree.Elements(tree.Find(m.storeys[i++ % SpatialModel::STOREYS]), wallEntity);
+        assert(walls.count == SpatialModel::ELEMENTS / SpatialModel::STOREYS * 3 / 4);
+        DoNotOptimize(walls);
+    }
+}
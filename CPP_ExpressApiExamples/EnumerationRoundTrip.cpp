@@ -0,0 +1,21 @@
+//
+// Round trip of all enumeration values of all generated schemas through the generated perfect hashes
+// Every value decodes to its own index in original, lower and upper case, unknown names decode to -1
+// Per-schema checks are generated by CMake from EnumerationRoundTrip.cpp.in
+//
+#include    <stdio.h>
+
+#include    "EnumerationRoundTrip.h"
+
+extern int main()
+{
+    int failed = 0;
+    for (const EnumerationCheck* check = EnumerationChecks(); check->schema; check++) {
+        EnumerationResult result = check->run();
+        printf("%-8s %4d enumerations, %5d values, %d failed\n", check->schema, result.enumerations, result.values, result.failed);
+        if (result.enumerations == 0 || result.failed != 0) {
+            failed++;
+        }
+    }
+    return failed ? 1 : 0;
+}
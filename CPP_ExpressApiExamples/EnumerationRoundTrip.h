@@ -0,0 +1,23 @@
+//
+// Round trip of enumeration values per schema, see EnumerationRoundTrip.cpp
+//
+#ifndef __RDF_LTD__ENUMERATION_ROUND_TRIP_H
+#define __RDF_LTD__ENUMERATION_ROUND_TRIP_H
+
+struct EnumerationResult
+{
+    int     enumerations;   //enumerations checked
+    int     values;         //values checked
+    int     failed;         //values or tables that did not round trip
+};
+
+struct EnumerationCheck
+{
+    const char*         schema;
+    EnumerationResult   (*run)();
+};
+
+//list terminated by NULL schema, generated by CMake
+const EnumerationCheck* EnumerationChecks();
+
+#endif
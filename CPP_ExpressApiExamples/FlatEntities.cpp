@@ -0,0 +1,77 @@
+//
+// Entity classes without virtual inheritance (RDF_EXPRESS_FLAT_ENTITIES)
+// Built as separate program because the define changes layout of the classes
+//
+#define RDF_EXPRESS_FLAT_ENTITIES
+
+#include    <string.h>
+#include    <vector>
+#include    <type_traits>
+#include    "IFC4.h"
+
+using namespace IFC4;
+
+static_assert(sizeof(IfcRoot) == sizeof(SdaiInstance), "flat entity is instance handle");
+static_assert(sizeof(IfcProduct) == sizeof(SdaiInstance), "flat entity is instance handle");
+static_assert(sizeof(IfcWall) == sizeof(SdaiInstance), "flat entity is instance handle");
+static_assert(sizeof(IfcDoor) == sizeof(SdaiInstance), "flat entity is instance handle");
+static_assert(std::is_trivially_copyable<IfcProduct>::value, "flat entity is copied as instance handle");
+static_assert(std::is_trivially_copyable<IfcDoor>::value, "flat entity is copied as instance handle");
+static_assert(std::is_trivially_destructible<IfcDoor>::value, "flat entity has no destructor");
+static_assert(std::is_convertible<IfcDoor, IfcProduct>::value, "upcast");
+static_assert(std::is_standard_layout<IfcDoor>::value, "no virtual bases");
+
+static void PutName(IfcRoot root, TextValue name)
+{
+    root.put_Name(name);
+}
+
+extern int main()
+{
+    SdaiModel model = sdaiCreateModelBN(0, NULL, "IFC4");
+
+    IfcWall wall = IfcWall::Create(model);
+    IfcDoor door = IfcDoor::Create(model);
+    door.put_OverallWidth(900);
+
+    //upcast to base class, passed in register
+    PutName(wall, "MyWall");
+    PutName(door, "MyDoor");
+
+    std::vector<IfcProduct> products;
+    products.push_back(wall);
+    products.push_back(door);
+    assert(products.size() * sizeof(IfcProduct) == 2 * sizeof(SdaiInstance));
+
+    //trivially copyable objects are copied as handles
+    IfcProduct copy[2];
+    memcpy(copy, products.data(), sizeof(copy));
+    assert(copy[0] == wall && copy[1] == door);
+    assert(!strcmp(copy[1].get_Name(), "MyDoor"));
+
+    //kind-of check on construction
+    assert(IfcDoor(copy[1]) == door);
+    assert(IfcDoor(copy[0]) == 0);
+
+    int walls = 0;
+    for (IfcWall w : IfcWall::Extent(model)) {
+        assert(!strcmp(w.get_Name(), "MyWall"));
+        walls++;
+    }
+    assert(walls == 1);
+
+    IfcDoor byVisit;
+    Visit(door, [&](auto entity) { byVisit = IfcDoor(entity); });
+    assert(byVisit == door && byVisit.get_OverallWidth().Value() == 900);
+
+    //exact entity of supertype object
+    assert(IfcBuildingElement::CreateExactEntity(door) == door);
+    assert(IfcDoor::CreateExactEntity(wall) == 0);
+    bool exactDoor = false;
+    assert(IfcProduct::CreateExactEntity(copy[1], [&](auto entity) { exactDoor = std::is_same<decltype(entity), IfcDoor>::value; }));
+    assert(exactDoor && !IfcDoor::CreateExactEntity(wall, [](auto) {}));
+
+    CloseModel(model);
+
+    return 0;
+}
@@ -1,4 +1,5 @@
 
+#include <stdio.h>
 #include <vector>
 #include "IFC4.h"
 
@@ -6,6 +7,14 @@
 #define ASSERT(c) {if (!(c)) { printf ("ASSERT at LINE %d FILE %s\n", __LINE__, __FILE__); assert (false);}}
 #endif
 
+//
+// Copies text attributes listed at compile time, GetAttr and PutAttr are resolved to get_ and put_ accessors
+//
+template <IFC4::IntValue... attrOrdinals, typename TEntity> static void CopyAttributes(TEntity from, TEntity to)
+{
+    int expand[] = {0, (to.template PutAttr<attrOrdinals>(from.template GetAttr<attrOrdinals>()), 0)...};
+    (void) expand;
+}
 
 extern void GuideExamples()
 {
@@ -273,6 +282,98 @@ extern void GuideExamples()
     pointList.get_CoordList(coordListCheck);
     ASSERT(coordList == coordListCheck);
 
+    //
+    // FLAT AGGREGATION OF AGGREGATION
+    // Aggregation of aggregations of numbers can be got into and put from a flat buffer of rows with given stride, without list per row
+    // Short rows are padded with zeros, long rows are truncated to stride, rows that do not fit the buffer are not read
+    // Returned value is the count of rows in the model, pass NULL buffer to get it
+    //
+    auto flatPoints = IFC4::IfcCartesianPointList3D::Create(model);
+
+    IFC4::ListOfListOfIfcLengthMeasure raggedList;
+    raggedList.push_back({1, 2, 3});
+    raggedList.push_back({4, 5});          //short row
+    raggedList.push_back({6, 7, 8, 9});    //long row
+    flatPoints.put_CoordList(raggedList);
+
+    ASSERT(flatPoints.get_CoordList((double*) NULL, 0, 3) == 3);
+
+    double flatCoords[9];
+    ASSERT(flatPoints.get_CoordList(flatCoords, 9, 3) == 3);
+    double expectedCoords[] = {1, 2, 3, 4, 5, 0, 6, 7, 8};
+    for (int i = 0; i < 9; i++) {
+        ASSERT(flatCoords[i] == expectedCoords[i]);
+    }
+
+    double firstRow[5] = {-1, -1, -1, -1, -1};
+    ASSERT(flatPoints.get_CoordList(firstRow, 5, 3) == 3);
+    ASSERT(firstRow[0] == 1 && firstRow[1] == 2 && firstRow[2] == 3 && firstRow[3] == -1 && firstRow[4] == -1);
+
+    std::vector<double> flatVector;
+    ASSERT(flatPoints.get_CoordList(flatVector, 3) == 3);
+    ASSERT(flatVector.size() == 9 && flatVector[5] == 0 && flatVector[8] == 8);
+
+    ASSERT(pointList.get_CoordList((double*) NULL, 0, 3) == 2);
+
+    //integer and real aggregations can be read into buffer of any numeric type
+    auto faceSet = IFC4::IfcTriangulatedFaceSet::Create(model);
+
+    IFC4::ListOfListOfIfcPositiveInteger coordIndex;
+    coordIndex.push_back({1, 2, 3});
+    coordIndex.push_back({3, 2, 4});
+    faceSet.put_CoordIndex(coordIndex);
+
+    IFC4::ListOfListOfIfcParameterValue normals;
+    normals.push_back({0, 0, 1});
+    normals.push_back({0, -1, 0});
+    faceSet.put_Normals(normals);
+
+    int32_t triangles[6];
+    ASSERT(faceSet.get_CoordIndex(triangles, 6, 3) == 2);
+    ASSERT(triangles[0] == 1 && triangles[2] == 3 && triangles[3] == 3 && triangles[5] == 4);
+
+    int32_t intNormals[6];
+    ASSERT(faceSet.get_Normals(intNormals, 6, 3) == 2);
+    ASSERT(intNormals[0] == 0 && intNormals[2] == 1 && intNormals[4] == -1 && intNormals[5] == 0);
+
+    //flat buffer is put as rows of stride elements, trailing elements that do not fill a row are not written
+    double putCoords[] = {1, 2, 3, 4, 5, 6, 7};
+    flatPoints.put_CoordList(putCoords, 7, 3);
+
+    IFC4::ListOfListOfIfcLengthMeasure gotCoords;
+    flatPoints.get_CoordList(gotCoords);
+    ASSERT(gotCoords.size() == 2 && gotCoords.front() == IFC4::ListOfIfcLengthMeasure({1, 2, 3}) && gotCoords.back() == IFC4::ListOfIfcLengthMeasure({4, 5, 6}));
+
+    std::vector<float> putFloats = {0.5f, 1.5f, 2.5f};
+    flatPoints.put_CoordList(putFloats, 3);
+    double roundTrip[3];
+    ASSERT(flatPoints.get_CoordList(roundTrip, 3, 3) == 1);
+    ASSERT(roundTrip[0] == 0.5 && roundTrip[1] == 1.5 && roundTrip[2] == 2.5);
+
+    int32_t putTriangles[] = {5, 6, 7, 7, 6, 8};
+    faceSet.put_CoordIndex(putTriangles, 6, 3);
+
+    IFC4::ListOfListOfIfcPositiveInteger gotIndex;
+    faceSet.get_CoordIndex(gotIndex);
+    ASSERT(gotIndex.size() == 2 && gotIndex.front() == IFC4::ListOfIfcPositiveInteger({5, 6, 7}) && gotIndex.back() == IFC4::ListOfIfcPositiveInteger({7, 6, 8}));
+
+    //C-arrays of convertible elements are put as aggregation
+    auto cartesianPoint = IFC4::IfcCartesianPoint::Create(model);
+    float xyz[] = {0.25f, 0.5f, 4};
+    cartesianPoint.put_Coordinates(xyz, 3);
+
+    IFC4::ListOfIfcLengthMeasure gotXyz;
+    cartesianPoint.get_Coordinates(gotXyz);
+    ASSERT(gotXyz == IFC4::ListOfIfcLengthMeasure({0.25, 0.5, 4}));
+
+    auto polygonalFace = IFC4::IfcIndexedPolygonalFace::Create(model);
+    short faceIndex[] = {1, 2, 3, 4};
+    polygonalFace.put_CoordIndex(faceIndex, 4);
+
+    IFC4::ListOfIfcPositiveInteger gotFaceIndex;
+    polygonalFace.get_CoordIndex(gotFaceIndex);
+    ASSERT(gotFaceIndex == IFC4::ListOfIfcPositiveInteger({1, 2, 3, 4}));
+
     //
     // SELECT OF AGGREGATION
     //
@@ -285,4 +386,284 @@ extern void GuideExamples()
     prop.get_NominalValue().get_IfcMeasureValue().get_IfcComplexNumber(cplxNum);
     ASSERT(cplxNum.size() == 2 && cplxNum.front() == 2.1 && cplxNum.back() == 1.5);
 
+    //
+    // TEXT WITHOUT COPIES
+    // Text is owned by the engine and stays valid while the model is open and the attribute is not changed
+    // With C++17 get_*_view methods return std::string_view and aggregations of text can be got as list of std::string_view
+    // To keep texts longer intern them to TextArena, it does not allocate memory per text
+    //
+#ifdef __cpp_lib_string_view
+    std::string_view wallName = wall.get_Name_view();
+    ASSERT(wallName == "MyWall");
+
+    IFC4::ListOfIfcLabel middleNames;
+    middleNames.push_back("Middle");
+    middleNames.push_back("Names");
+    person.put_MiddleNames(middleNames);
+
+    std::vector<std::string_view> nameViews;
+    person.get_MiddleNames(nameViews);
+    ASSERT(nameViews.size() == 2 && nameViews.back() == "Names");
+
+    IFC4::TextArena arena;
+    IFC4::InternedTextList internedNames(arena);
+    person.get_MiddleNames(internedNames);
+    person.get_MiddleNames(internedNames);
+    ASSERT(internedNames.size() == 4 && arena.Count() == 2 && internedNames[1].data() == internedNames[3].data());
+#endif
+
+    //
+    // UTF-8 TEXT
+    // Set UTF-8 encoding of the model to put and get international texts without codepage conversion
+    // get_*_utf8 methods read UTF-8 with sdaiGetAttrBNUnicode in any encoding of the model
+    // and copy the text to growable buffer, reuse one buffer to read many texts without memory allocation per call
+    //
+    IFC4::SetTextEncoding(model, enum_string_encoding::UTF8);
+
+    const char* wallDescription = "Au\xC3\x9F" "enwand"; //Aussenwand with sharp s
+    wall.put_Description(wallDescription);
+
+    IFC4::Utf8Buffer utf8;
+    ASSERT(!strcmp(wall.get_Description_utf8(utf8), wallDescription) && utf8.size() == 10);
+
+    //without buffer argument the text is in buffer of the thread, valid until next UTF-8 get
+    ASSERT(!strcmp(wall.get_Name_utf8(), "MyWall"));
+    ASSERT(door.get_Name_utf8() == NULL);
+
+    //Utf8Buffer reads attributes by name too, the buffer grows to fit the text
+    IFC4::Utf8Buffer smallBuffer(4);
+    ASSERT(!strcmp(smallBuffer.GetAttr(wall, "Description"), wallDescription) && smallBuffer.size() == 10);
+    ASSERT(smallBuffer.GetAttr(door, "Name") == NULL);
+
+    door.put_Description("");
+    ASSERT(smallBuffer.GetAttr(door, "Description") != NULL && smallBuffer.size() == 0);
+    ASSERT(door.get_Description_utf8(utf8) != NULL && utf8.size() == 0);
+
+    //
+    // ATTRIBUTES BY ORDINAL
+    // ENTITY::attr has constexpr ordinals of attributes of the entity and its supertypes
+    // GetAttr<ordinal> and PutAttr<ordinal> are get_ and put_ accessors of the attribute, so code can be generic over attributes
+    // GetAttr and PutAttr with ordinal known at run time give SDAI access without name lookup
+    //
+    door.PutAttr<IFC4::IfcDoor::attr::OverallWidth>(1000);
+    ASSERT(door.GetAttr<IFC4::IfcDoor::attr::OverallWidth>().Value() == 1000);
+
+    IFC4::IfcWall wallCopy = IFC4::IfcWall::Create(model);
+    CopyAttributes<IFC4::IfcRoot::attr::Name, IFC4::IfcRoot::attr::Description>(wall, wallCopy);
+    ASSERT(!strcmp(wallCopy.get_Name(), "MyWall") && !strcmp(wallCopy.get_Description(), wallDescription));
+
+    double rawWidth = 0;
+    IFC4::IntValue widthOrdinal = IFC4::IfcDoor::attr::OverallWidth;
+    door.GetAttr(widthOrdinal, sdaiREAL, &rawWidth);
+    ASSERT(rawWidth == 1000);
+
+    //
+    // FIND BY GLOBALID
+    // GlobalIdIndex decodes GlobalIds of IfcRoot instances of the model to 128 bit keys for O(1) Find
+    // put_GlobalId keeps live indexes consistent
+    //
+    wall.put_GlobalId("2O2Fr$t4X7Zf8NOew3FLOH");
+    door.put_GlobalId("0uA6M8uJr1GvK3h6$D7LAL");
+
+    IFC4::GlobalIdIndex globalIds(model);
+    ASSERT(globalIds.Find("2O2Fr$t4X7Zf8NOew3FLOH") == wall);
+    ASSERT(IFC4::IfcDoor(globalIds.Find("0uA6M8uJr1GvK3h6$D7LAL")) == door);
+    ASSERT(globalIds.Find("not a GlobalId") == 0);
+
+    wallCopy.put_GlobalId("3vB2YO$MX4xv5uCqZZG05x");
+    door.put_GlobalId("1kTvXnbbzCWw8lcMd1dR4o");
+    ASSERT(globalIds.Find("3vB2YO$MX4xv5uCqZZG05x") == wallCopy);
+    ASSERT(globalIds.Find("1kTvXnbbzCWw8lcMd1dR4o") == door);
+    ASSERT(globalIds.Find("0uA6M8uJr1GvK3h6$D7LAL") == 0);
+
+    //
+    // RELATIONSHIPS
+    // RelationshipIndex reads objectified relationships of the model once,
+    // related instances of an instance are contiguous range instead of inverse attribute read for each instance
+    //
+    IFC4::IfcBuildingStorey storey = IFC4::IfcBuildingStorey::Create(model);
+    IFC4::IfcRelContainedInSpatialStructure containment = IFC4::IfcRelContainedInSpatialStructure::Create(model);
+    containment.put_RelatingStructure(storey);
+    IFC4::IfcProduct storeyElements[] = {wall, door};
+    containment.put_RelatedElements(storeyElements, 2);
+
+    IFC4::IfcPropertySet pset = IFC4::IfcPropertySet::Create(model);
+    IFC4::IfcRelDefinesByProperties definesByProperties = IFC4::IfcRelDefinesByProperties::Create(model);
+    definesByProperties.put_RelatingPropertyDefinition().put_IfcPropertySetDefinition(pset);
+    IFC4::IfcObjectDefinition psetObjects[] = {wall};
+    definesByProperties.put_RelatedObjects(psetObjects, 1);
+
+    IFC4::RelationshipIndex relationships(model);
+
+    auto elements = relationships.Related(IFC4::RelationshipIndex::ContainedInSpatialStructure, storey);
+    ASSERT(elements.count == 2 && elements.first[0] == wall && elements.first[1] == door);
+
+    auto wallProperties = relationships.Relating(IFC4::RelationshipIndex::DefinesByProperties, wall);
+    ASSERT(wallProperties.count == 1 && wallProperties.first[0] == pset);
+    ASSERT(relationships.Relating(IFC4::RelationshipIndex::DefinesByProperties, door).count == 0);
+
+    for (SdaiInstance element : relationships.Related(IFC4::RelationshipIndex::ContainedInSpatialStructure, storey)) {
+        ASSERT(relationships.Relating(IFC4::RelationshipIndex::ContainedInSpatialStructure, element).first[0] == storey);
+    }
+
+    //
+    // SPATIAL TREE
+    // SpatialTree keeps project, spatial structure and contained elements in flat arrays in depth-first order,
+    // elements of a subtree are contiguous and elements of a node are grouped by entity
+    //
+    IFC4::IfcProject project = IFC4::IfcProject::Create(model);
+    IFC4::IfcBuilding building = IFC4::IfcBuilding::Create(model);
+    IFC4::IfcRelAggregates projectParts = IFC4::IfcRelAggregates::Create(model);
+    projectParts.put_RelatingObject(project);
+    IFC4::IfcObjectDefinition projectBuildings[] = {building};
+    projectParts.put_RelatedObjects(projectBuildings, 1);
+    IFC4::IfcRelAggregates buildingParts = IFC4::IfcRelAggregates::Create(model);
+    buildingParts.put_RelatingObject(building);
+    IFC4::IfcObjectDefinition buildingStoreys[] = {storey};
+    buildingParts.put_RelatedObjects(buildingStoreys, 1);
+
+    IFC4::SpatialTree tree(model);
+    int storeyNode = tree.Find(storey);
+    ASSERT(tree[storeyNode].parent == tree.Find(building) && tree[tree.Find(building)].parent == tree.Find(project));
+    ASSERT(tree.SubtreeElements(tree.Find(project)).count == 2);
+
+    auto storeyWalls = tree.Elements(storeyNode, sdaiGetEntity(model, "IfcWall"));
+    ASSERT(storeyWalls.count == 1 && storeyWalls.first[0] == wall);
+    ASSERT(tree.Container(door) == storeyNode);
+
+    //relationships added with the wrappers after the tree was built are read by Update
+    IFC4::IfcBuildingStorey roof = IFC4::IfcBuildingStorey::Create(model);
+    IFC4::IfcRelAggregates roofParts = IFC4::IfcRelAggregates::Create(model);
+    roofParts.put_RelatingObject(building);
+    IFC4::IfcObjectDefinition roofStoreys[] = {roof};
+    roofParts.put_RelatedObjects(roofStoreys, 1);
+    IFC4::IfcRelContainedInSpatialStructure roofContainment = IFC4::IfcRelContainedInSpatialStructure::Create(model);
+    roofContainment.put_RelatingStructure(roof);
+    IFC4::IfcProduct roofElements[] = {wallCopy};
+    roofContainment.put_RelatedElements(roofElements, 1);
+
+    tree.Update();
+    ASSERT(tree[tree.Find(roof)].parent == tree.Find(building));
+    ASSERT(tree.SubtreeElements(tree.Find(building)).count == 3);
+    ASSERT(tree.Elements(tree.Find(roof), sdaiGetEntity(model, "IfcWall")).first[0] == wallCopy);
+
+    //relationships deleted after the tree was built are dropped by Update, relationships are told by instance handle
+    sdaiDeleteInstance(roofContainment);
+    tree.Update();
+    ASSERT(tree.Elements(tree.Find(roof)).count == 0 && tree.Container(wallCopy) == -1);
+    ASSERT(tree[tree.Find(roof)].parent == tree.Find(building));
+
+    //
+    // PROPERTY TABLE
+    // PropertyTable reads single-value properties of all objects into columns,
+    // a property of an object is one hash lookup and a column is a vector to scan
+    //
+    IFC4::IfcPropertySingleValue fireRating = IFC4::IfcPropertySingleValue::Create(model);
+    fireRating.put_Name("FireRating");
+    fireRating.put_NominalValue().put_IfcSimpleValue().put_IfcLabel("REI90");
+
+    IFC4::IfcPropertySingleValue isExternal = IFC4::IfcPropertySingleValue::Create(model);
+    isExternal.put_Name("IsExternal");
+    isExternal.put_NominalValue().put_IfcSimpleValue().put_IfcBoolean(true);
+
+    IFC4::IfcPropertySet wallCommon = IFC4::IfcPropertySet::Create(model);
+    wallCommon.put_Name("Pset_WallCommon");
+    IFC4::IfcProperty wallCommonProperties[] = {fireRating, isExternal};
+    wallCommon.put_HasProperties(wallCommonProperties, 2);
+
+    IFC4::IfcRelDefinesByProperties definesWallCommon = IFC4::IfcRelDefinesByProperties::Create(model);
+    definesWallCommon.put_RelatingPropertyDefinition().put_IfcPropertySetDefinition(wallCommon);
+    IFC4::IfcObjectDefinition wallCommonObjects[] = {wall, wallCopy};
+    definesWallCommon.put_RelatedObjects(wallCommonObjects, 2);
+
+    IFC4::PropertyTable properties(model);
+
+    auto rating = properties.Value(wallCopy, "Pset_WallCommon", "FireRating");
+    ASSERT(rating && rating->kind == IFC4::PropertyValue::Text && rating->AsText() == "REI90");
+    auto external = properties.Value(wall, "Pset_WallCommon", "IsExternal");
+    ASSERT(external && external->kind == IFC4::PropertyValue::Boolean && external->integer == 1);
+    ASSERT(!properties.Value(door, "Pset_WallCommon", "IsExternal"));
+
+    //whole-column scan
+    uint32_t isExternalName = properties.NameId("IsExternal");
+    int externalObjects = 0;
+    for (size_t row = 0; row < properties.size(); row++) {
+        if (properties.PropertyNames()[row] == isExternalName && properties.Values()[row].integer == 1) {
+            externalObjects++;
+        }
+    }
+    ASSERT(externalObjects == 2);
+
+    //
+    // PLACEMENTS
+    // PlacementResolver composes IfcLocalPlacement with placements it is relative to,
+    // transforms of all placements are computed in one pass and each shared parent once
+    //
+    IFC4::IfcDirection zAxis = IFC4::IfcDirection::Create(model);
+    double zRatios[] = {0, 0, 1};
+    zAxis.put_DirectionRatios(zRatios, 3);
+
+    IFC4::IfcDirection yAxis = IFC4::IfcDirection::Create(model);
+    double yRatios[] = {0, 1, 0};
+    yAxis.put_DirectionRatios(yRatios, 3);
+
+    //building at x = 1000 rotated by 90 degrees
+    IFC4::IfcCartesianPoint buildingOrigin = IFC4::IfcCartesianPoint::Create(model);
+    double buildingCoordinates[] = {1000, 0, 0};
+    buildingOrigin.put_Coordinates(buildingCoordinates, 3);
+    IFC4::IfcAxis2Placement3D buildingAxes = IFC4::IfcAxis2Placement3D::Create(model);
+    buildingAxes.put_Location(buildingOrigin);
+    buildingAxes.put_Axis(zAxis);
+    buildingAxes.put_RefDirection(yAxis);
+    IFC4::IfcLocalPlacement buildingPlacement = IFC4::IfcLocalPlacement::Create(model);
+    buildingPlacement.put_RelativePlacement().put_IfcAxis2Placement3D(buildingAxes);
+
+    //storey 3000 above the building
+    IFC4::IfcCartesianPoint storeyOrigin = IFC4::IfcCartesianPoint::Create(model);
+    double storeyCoordinates[] = {0, 0, 3000};
+    storeyOrigin.put_Coordinates(storeyCoordinates, 3);
+    IFC4::IfcAxis2Placement3D storeyAxes = IFC4::IfcAxis2Placement3D::Create(model);
+    storeyAxes.put_Location(storeyOrigin);
+    IFC4::IfcLocalPlacement storeyPlacement = IFC4::IfcLocalPlacement::Create(model);
+    storeyPlacement.put_PlacementRelTo(buildingPlacement);
+    storeyPlacement.put_RelativePlacement().put_IfcAxis2Placement3D(storeyAxes);
+
+    //wall at x = 500 in the storey
+    IFC4::IfcCartesianPoint wallOrigin = IFC4::IfcCartesianPoint::Create(model);
+    double wallCoordinates[] = {500, 0, 0};
+    wallOrigin.put_Coordinates(wallCoordinates, 3);
+    IFC4::IfcAxis2Placement3D wallAxes = IFC4::IfcAxis2Placement3D::Create(model);
+    wallAxes.put_Location(wallOrigin);
+    IFC4::IfcLocalPlacement wallPlacement = IFC4::IfcLocalPlacement::Create(model);
+    wallPlacement.put_PlacementRelTo(storeyPlacement);
+    wallPlacement.put_RelativePlacement().put_IfcAxis2Placement3D(wallAxes);
+    wall.put_ObjectPlacement(wallPlacement);
+
+    IFC4::PlacementResolver placements(model);
+
+    const IFC4::TransformMatrix* wallTransform = placements.Transform(wall.get_ObjectPlacement());
+    ASSERT(wallTransform);
+    double local[] = {0, 0, 0};
+    double world[3];
+    wallTransform->TransformPoint(local, world);
+    ASSERT(fabs(world[0] - 1000) < 1e-9 && fabs(world[1] - 500) < 1e-9 && fabs(world[2] - 3000) < 1e-9);
+    ASSERT(fabs(wallTransform->m[1] - 1) < 1e-9); //x axis of the wall is y of the world
+
+    //placement goes after the placement it is relative to
+    int wallIndex = placements.Find(wallPlacement);
+    ASSERT(placements.Parents()[wallIndex] == placements.Find(storeyPlacement));
+    ASSERT(placements.Find(buildingPlacement) < placements.Find(storeyPlacement) && placements.Find(storeyPlacement) < wallIndex);
+
+    //
+    // CLOSE MODEL
+    // CloseModel drops attribute and entity handles cached by the wrappers, the engine may give the handle of closed model to the next one
+    //
+    IFC4::CloseModel(model);
+
+    SdaiModel nextModel = sdaiCreateModelBN(0, NULL, "IFC4");
+    IFC4::IfcDoor nextDoor = IFC4::IfcDoor::Create(nextModel);
+    nextDoor.put_OverallWidth(1200);
+    ASSERT(nextDoor.get_OverallWidth().Value() == 1200);
+    ASSERT(IFC4::IfcProduct(nextDoor) && !IFC4::IfcWall(nextDoor));
+    IFC4::CloseModel(nextModel);
 }
\ No newline at end of file
@@ -46,7 +46,7 @@ extern void HelloWall()
     SetupContainment(model, ifcStory, wall);
 
     sdaiSaveModelBN(model, "HelloWall.ifc");
-    sdaiCloseModel(model);
+    CloseModel(model);
 }
 
 static void SetupAggregation(int_t model, IfcObjectDefinition aggregator, IfcObjectDefinition part)
@@ -0,0 +1,83 @@
+//
+// Accessor profile (RDF_EXPRESS_INSTRUMENT): generated accessors count calls per attribute
+// Built as separate program because the define adds probes to all accessors
+//
+#define RDF_EXPRESS_INSTRUMENT
+
+#include    <stdio.h>
+#include    <string.h>
+#include    <thread>
+#include    "IFC4.h"
+
+using namespace IFC4;
+
+static int s_failed = 0;
+
+#define CHECK(c) {if (!(c)) { printf ("CHECK failed at LINE %d: %s\n", __LINE__, #c); s_failed++;}}
+
+extern int main()
+{
+    SdaiModel model = sdaiCreateModelBN(0, NULL, "IFC4");
+
+    IfcWall wall = IfcWall::Create(model);
+    IfcDoor door = IfcDoor::Create(model);
+    IfcMeasureWithUnit measure = IfcMeasureWithUnit::Create(model);
+
+    CHECK(AccessorProfile::Calls(IfcWall::attr::Name) == 0);
+
+    //IfcWall and IfcDoor share the attribute of IfcRoot
+    wall.put_Name("MyWall");
+    door.put_Name("MyDoor");
+    for (int i = 0; i < 3; i++) {
+        CHECK(!strcmp(wall.get_Name(), "MyWall"));
+    }
+    CHECK(AccessorProfile::Calls(IfcWall::attr::Name) == 5);
+    CHECK(AccessorProfile::Calls(IfcDoor::attr::Name) == 5);
+
+    door.put_OverallWidth(900);
+    CHECK(door.GetAttr<IfcDoor::attr::OverallWidth>().Value() == 900);
+    CHECK(AccessorProfile::Calls(IfcDoor::attr::OverallWidth) == 2);
+    CHECK(AccessorProfile::Calls(IfcDoor::attr::OverallHeight) == 0);
+
+    //select attribute is counted by methods of the selector returned by the entity accessor
+    measure.put_ValueComponent().put_IfcSimpleValue().put_IfcInteger(75);
+    CHECK(measure.get_ValueComponent().get_IfcSimpleValue().get_IfcInteger().Value() == 75);
+    CHECK(measure.get_ValueComponent().as_double().Value() == 75);
+    CHECK(AccessorProfile::Calls(IfcMeasureWithUnit::attr::ValueComponent) == 3);
+
+    //threads count into own tables, calls of finished threads stay in the profile
+    std::thread worker([&]() {
+        for (int i = 0; i < 10; i++) {
+            door.get_Name();
+        }
+    });
+    worker.join();
+    CHECK(AccessorProfile::Calls(IfcDoor::attr::Name) == 15);
+
+    //profile is written most expensive first, only attributes with calls are listed
+    FILE* file = tmpfile();
+    CHECK(file != NULL);
+    if (file) {
+        DumpAccessorProfile(file);
+        rewind(file);
+
+        int lines = 0;
+        bool name = false;
+        bool height = false;
+        char line[512];
+        while (fgets(line, sizeof(line), file)) {
+            lines++;
+            name = name || !strncmp(line, "IfcRoot.Name ", 13);
+            height = height || !strncmp(line, "IfcDoor.OverallHeight ", 22);
+        }
+        fclose(file);
+
+        CHECK(lines == 4); //header, Name, OverallWidth, ValueComponent
+        CHECK(name && !height);
+    }
+
+    DumpAccessorProfile(stdout);
+
+    CloseModel(model);
+    return s_failed ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+//
+// World transforms of PlacementResolver against transforms worked out by hand
+// With ifcengine library (IFCENGINE_LIBRARY) they are also checked against getInstanceTransformationMatrix
+//
+#include    <math.h>
+#include    <stdio.h>
+#include    "IFC4.h"
+
+using namespace IFC4;
+
+static int s_failed = 0;
+
+#define CHECK(c) {if (!(c)) { printf ("CHECK failed at LINE %d: %s\n", __LINE__, #c); s_failed++;}}
+
+static SdaiModel s_model = 0;
+
+static IfcDirection Direction(double x, double y, double z)
+{
+    IfcDirection direction = IfcDirection::Create(s_model);
+    double ratios[] = {x, y, z};
+    direction.put_DirectionRatios(ratios, 3);
+    return direction;
+}
+
+static IfcLocalPlacement Placement(IfcObjectPlacement relativeTo, double x, double y, double z, IfcDirection axis, IfcDirection refDirection)
+{
+    IfcCartesianPoint location = IfcCartesianPoint::Create(s_model);
+    double coordinates[] = {x, y, z};
+    location.put_Coordinates(coordinates, 3);
+
+    IfcAxis2Placement3D axes = IfcAxis2Placement3D::Create(s_model);
+    axes.put_Location(location);
+    if (axis) {
+        axes.put_Axis(axis);
+    }
+    if (refDirection) {
+        axes.put_RefDirection(refDirection);
+    }
+
+    IfcLocalPlacement placement = IfcLocalPlacement::Create(s_model);
+    if (relativeTo) {
+        placement.put_PlacementRelTo(relativeTo);
+    }
+    placement.put_RelativePlacement().put_IfcAxis2Placement3D(axes);
+    return placement;
+}
+
+static bool Near(double a, double b)
+{
+    return fabs(a - b) < 1e-9 * (1 + fabs(b));
+}
+
+static bool Equal(const TransformMatrix& actual, const TransformMatrix& expected)
+{
+    for (int j = 0; j < 16; j++) {
+        if (!Near(actual.m[j], expected.m[j])) {
+            printf("    element %d is %.12g, expected %.12g\n", j, actual.m[j], expected.m[j]);
+            return false;
+        }
+    }
+    return true;
+}
+
+//rows x, y, z axis and origin
+static TransformMatrix Matrix(const double x[3], const double y[3], const double z[3], const double origin[3])
+{
+    TransformMatrix matrix = TransformMatrix::Identity();
+    for (int j = 0; j < 3; j++) {
+        matrix.m[j] = x[j];
+        matrix.m[4 + j] = y[j];
+        matrix.m[8 + j] = z[j];
+        matrix.m[12 + j] = origin[j];
+    }
+    return matrix;
+}
+
+#ifdef CHECK_ENGINE_TRANSFORMS
+static bool EqualToEngine(IfcObjectPlacement placement, const TransformMatrix& actual)
+{
+    TransformMatrix engine = TransformMatrix::Identity();
+    double* m = engine.m;
+    getInstanceTransformationMatrix(s_model, placement, &m[0], &m[1], &m[2], &m[3], &m[4], &m[5], &m[6], &m[7], &m[8], &m[9], &m[10], &m[11], &m[12], &m[13], &m[14], &m[15]);
+    return Equal(actual, engine);
+}
+#endif
+
+extern int main()
+{
+    s_model = sdaiCreateModelBN(0, NULL, "IFC4");
+
+    const double r = sqrt(0.5);
+    IfcDirection z = Direction(0, 0, 1);
+
+    //building is turned by 90 degrees, storey is lifted, wall is turned by 45 degrees more
+    IfcLocalPlacement site = Placement(IfcObjectPlacement(0), 0, 0, 0, IfcDirection(0), IfcDirection(0));
+    IfcLocalPlacement building = Placement(site, 1000, 2000, 0, z, Direction(0, 1, 0));
+    IfcLocalPlacement storey = Placement(building, 0, 0, 3000, IfcDirection(0), IfcDirection(0));
+    IfcLocalPlacement wall = Placement(storey, 100, 50, 0, z, Direction(1, 1, 0));
+
+    //column lies along x axis of the storey, reference direction is not normal to the axis
+    IfcLocalPlacement column = Placement(storey, 0, 0, 0, Direction(1, 0, 0), Direction(1, 1, 0));
+
+    //2D placement in the plane of the wall
+    IfcCartesianPoint opening2DLocation = IfcCartesianPoint::Create(s_model);
+    double opening2DCoordinates[] = {10, 20};
+    opening2DLocation.put_Coordinates(opening2DCoordinates, 2);
+    IfcDirection opening2DRefDirection = IfcDirection::Create(s_model);
+    double opening2DRatios[] = {0, -1};
+    opening2DRefDirection.put_DirectionRatios(opening2DRatios, 2);
+    IfcAxis2Placement2D opening2DAxes = IfcAxis2Placement2D::Create(s_model);
+    opening2DAxes.put_Location(opening2DLocation);
+    opening2DAxes.put_RefDirection(opening2DRefDirection);
+    IfcLocalPlacement opening = IfcLocalPlacement::Create(s_model);
+    opening.put_PlacementRelTo(wall);
+    opening.put_RelativePlacement().put_IfcAxis2Placement2D(opening2DAxes);
+
+    PlacementResolver resolver(s_model);
+    CHECK(resolver.size() == 6);
+    CHECK(!resolver.Transform(z));
+
+    struct Expected
+    {
+        IfcLocalPlacement   placement;
+        TransformMatrix     transform;
+    };
+
+    const double X[] = {1, 0, 0}, Y[] = {0, 1, 0}, Z[] = {0, 0, 1}, O[] = {0, 0, 0};
+    const double minusX[] = {-1, 0, 0};
+    const double buildingOrigin[] = {1000, 2000, 0};
+    const double storeyOrigin[] = {1000, 2000, 3000};
+    const double wallX[] = {-r, r, 0}, wallY[] = {-r, -r, 0}, wallOrigin[] = {950, 2100, 3000};
+    const double openingX[] = {r, r, 0}, openingOrigin[] = {950 - 30 * r, 2100 - 10 * r, 3000};
+
+    Expected expected[] = {
+        {site, Matrix(X, Y, Z, O)},
+        {building, Matrix(Y, minusX, Z, buildingOrigin)},
+        {storey, Matrix(Y, minusX, Z, storeyOrigin)},
+        {wall, Matrix(wallX, wallY, Z, wallOrigin)},
+        {column, Matrix(minusX, Z, Y, storeyOrigin)},
+        {opening, Matrix(openingX, wallX, Z, openingOrigin)}
+    };
+
+    for (auto const& e : expected) {
+        const TransformMatrix* actual = resolver.Transform(e.placement);
+        CHECK(actual);
+        if (actual) {
+            CHECK(Equal(*actual, e.transform));
+#ifdef CHECK_ENGINE_TRANSFORMS
+            CHECK(EqualToEngine(e.placement, *actual));
+#endif
+        }
+    }
+
+    CloseModel(s_model);
+    return s_failed ? 1 : 0;
+}
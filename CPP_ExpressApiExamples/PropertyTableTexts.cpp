@@ -0,0 +1,81 @@
+//
+// PropertyTable keeps texts and value types of all properties: ADB values are valid until the ADB is reused or deleted,
+// so each reading thread copies them before the next property is read
+//
+#include    <stdio.h>
+#include    <string.h>
+#include    <string>
+#include    <vector>
+#include    "IFC4.h"
+
+using namespace IFC4;
+
+static int s_failed = 0;
+
+#define CHECK(c) {if (!(c)) { printf ("CHECK failed at LINE %d: %s\n", __LINE__, #c); s_failed++;}}
+
+//enough property sets to read them in threads
+static const int PROPERTY_SETS = 2048;
+
+static std::string Label(int i)
+{
+    return "Label " + std::to_string(i);
+}
+
+static void CheckTable(const PropertyTable& table, const std::vector<IfcWall>& walls)
+{
+    CHECK(table.size() == 2 * walls.size());
+
+    for (int i = 0; i < (int) walls.size(); i++) {
+        auto label = table.Value(walls[i], "Pset_Texts", "Label");
+        CHECK(label && label->kind == PropertyValue::Text && label->AsText() == Label(i));
+
+        ptrdiff_t row = table.Find(walls[i], "Pset_Texts", "Identifier");
+        CHECK(row >= 0);
+        if (row >= 0) {
+            CHECK(table.Values()[row].AsText() == "ID-" + std::to_string(i));
+            CHECK(table.Name(table.ValueTypes()[row]) == "IFCIDENTIFIER");
+        }
+
+        row = table.Find(walls[i], "Pset_Texts", "Label");
+        CHECK(row >= 0 && table.Name(table.ValueTypes()[row]) == "IFCLABEL");
+    }
+}
+
+extern int main()
+{
+    SdaiModel model = sdaiCreateModelBN(0, NULL, "IFC4");
+
+    std::vector<IfcWall> walls;
+    for (int i = 0; i < PROPERTY_SETS; i++) {
+        IfcWall wall = IfcWall::Create(model);
+        walls.push_back(wall);
+
+        IfcPropertySingleValue label = IfcPropertySingleValue::Create(model);
+        label.put_Name("Label");
+        label.put_NominalValue().put_IfcSimpleValue().put_IfcLabel(Label(i).c_str());
+
+        IfcPropertySingleValue identifier = IfcPropertySingleValue::Create(model);
+        identifier.put_Name("Identifier");
+        identifier.put_NominalValue().put_IfcSimpleValue().put_IfcIdentifier(("ID-" + std::to_string(i)).c_str());
+
+        IfcPropertySet propertySet = IfcPropertySet::Create(model);
+        propertySet.put_Name("Pset_Texts");
+        IfcProperty properties[] = {label, identifier};
+        propertySet.put_HasProperties(properties, 2);
+
+        IfcRelDefinesByProperties defines = IfcRelDefinesByProperties::Create(model);
+        defines.put_RelatingPropertyDefinition().put_IfcPropertySetDefinition(propertySet);
+        IfcObjectDefinition objects[] = {wall};
+        defines.put_RelatedObjects(objects, 1);
+    }
+
+    PropertyTable threaded(model, 4);
+    CheckTable(threaded, walls);
+
+    PropertyTable single(model, 1);
+    CheckTable(single, walls);
+
+    CloseModel(model);
+    return s_failed ? 1 : 0;
+}
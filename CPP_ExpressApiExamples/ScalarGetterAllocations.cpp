@@ -0,0 +1,65 @@
+//
+// Heap allocations of scalar getters in all generated schemas
+// Global operator new is counted, every get_ returning Nullable of number, boolean or enumeration must not allocate
+// Per-schema checks are generated by CMake from ScalarGetterAllocations.cpp.in
+//
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <stdint.h>
+#include    <new>
+
+#include    "ScalarGetterAllocations.h"
+
+static uint64_t s_allocations = 0;
+
+void* operator new(size_t size)
+{
+    s_allocations++;
+    if (void* p = malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    free(p);
+}
+
+uint64_t AllocationCount()
+{
+    return s_allocations;
+}
+
+extern int main()
+{
+    int failed = 0;
+    for (const ScalarGetterCheck* check = ScalarGetterChecks(); check->schema; check++) {
+        ScalarGetterResult result = check->run();
+        printf("%-8s %6d scalar getters, %d allocating\n", check->schema, result.getters, result.allocating);
+        if (result.getters == 0 || result.allocating != 0) {
+            failed++;
+        }
+    }
+    return failed ? 1 : 0;
+}
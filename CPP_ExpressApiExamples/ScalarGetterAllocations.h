@@ -0,0 +1,27 @@
+//
+// Checks of scalar getters per schema, see ScalarGetterAllocations.cpp
+//
+#ifndef __RDF_LTD__SCALAR_GETTER_ALLOCATIONS_H
+#define __RDF_LTD__SCALAR_GETTER_ALLOCATIONS_H
+
+#include    <stdint.h>
+
+//number of global operator new calls so far
+uint64_t AllocationCount();
+
+struct ScalarGetterResult
+{
+    int     getters;    //scalar getters called
+    int     allocating; //getters that allocated memory
+};
+
+struct ScalarGetterCheck
+{
+    const char*         schema;
+    ScalarGetterResult  (*run)();
+};
+
+//list terminated by NULL schema, generated by CMake
+const ScalarGetterCheck* ScalarGetterChecks();
+
+#endif
@@ -0,0 +1,163 @@
+//
+// Stress run of SELECT accessors: 1M writes and reads of SELECT attributes and detached selects must keep the heap flat
+// Selects are created on worker threads and destroyed on other ones, before and after the creating thread has finished
+// Global operator new and delete are counted, live allocations are compared after each stage
+//
+#include    <stdio.h>
+#include    <stdlib.h>
+#include    <stdint.h>
+#include    <atomic>
+#include    <new>
+#include    <thread>
+#include    <vector>
+#include    "IFC4.h"
+
+using namespace IFC4;
+
+static std::atomic<int64_t> s_live(0);
+
+void* operator new(size_t size)
+{
+    s_live.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    if (p) {
+        s_live.fetch_sub(1, std::memory_order_relaxed);
+        free(p);
+    }
+}
+
+void operator delete[](void* p) noexcept
+{
+    operator delete(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    operator delete(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    operator delete(p);
+}
+
+static int s_failed = 0;
+
+#define CHECK(c) {if (!(c)) { printf ("CHECK failed at LINE %d: %s\n", __LINE__, #c); s_failed++;}}
+
+//
+// Write and read of a SELECT attribute and of detached selects owning their ADBs
+//
+static void WriteRead(IfcMeasureWithUnit measure, IfcPropertyEnumeratedValue propEnumValue, int iterations)
+{
+    for (int i = 0; i < iterations; i++) {
+        measure.put_ValueComponent().put_IfcSimpleValue().put_IfcInteger(i);
+        Nullable<IfcInteger> got = measure.get_ValueComponent().get_IfcSimpleValue().get_IfcInteger();
+        CHECK(!got.IsNull() && got.Value() == i);
+
+        IfcValue value(propEnumValue);
+        value._IfcMeasureValue().put_IfcCountMeasure(i);
+        IfcValue copy = value;
+        Nullable<IfcCountMeasure> count = copy._IfcMeasureValue().get_IfcCountMeasure();
+        CHECK(!count.IsNull() && count.Value() == i);
+    }
+}
+
+//
+// Selects owning read and put ADBs, created on one thread and destroyed on another
+//
+struct Selects
+{
+    std::vector<IfcValue_get>   read;
+    std::vector<IfcValue>       put;
+};
+
+static void CreateSelects(IfcMeasureWithUnit measure, IfcPropertyEnumeratedValue propEnumValue, int count, Selects& selects)
+{
+    for (int i = 0; i < count; i++) {
+        selects.read.push_back(measure.get_ValueComponent());
+        CHECK(selects.read.back().ADB() != NULL);
+
+        IfcValue value(propEnumValue);
+        value._IfcMeasureValue().put_IfcCountMeasure(i);
+        selects.put.push_back(value);
+    }
+}
+
+static void CrossThread(IfcMeasureWithUnit measure, IfcPropertyEnumeratedValue propEnumValue, int count)
+{
+    //created on a worker, destroyed here after the worker has finished
+    Selects fromWorker;
+    std::thread worker(CreateSelects, measure, propEnumValue, count, std::ref(fromWorker));
+    worker.join();
+    fromWorker = Selects();
+
+    //created on a worker, half destroyed on another worker while the creating one still runs
+    Selects created;
+    std::atomic<bool> destroyed(false);
+    std::thread creating([&]() {
+        CreateSelects(measure, propEnumValue, count, created);
+        std::thread destroying([&]() {
+            created.read.erase(created.read.begin() + count / 2, created.read.end());
+            created.put.erase(created.put.begin() + count / 2, created.put.end());
+            destroyed = true;
+        });
+        destroying.join();
+        //records released on the other thread are reused
+        Selects more;
+        CreateSelects(measure, propEnumValue, count / 2, more);
+    });
+    creating.join();
+    CHECK(destroyed);
+    created = Selects();
+
+    //created here, destroyed on a worker
+    Selects fromMain;
+    CreateSelects(measure, propEnumValue, count, fromMain);
+    std::thread destroying([&]() { fromMain = Selects(); });
+    destroying.join();
+}
+
+extern int main()
+{
+    const int ITERATIONS = 1000000;
+    const int SELECTS = 100000;
+
+    SdaiModel model = sdaiCreateModelBN(0, NULL, "IFC4");
+    IfcMeasureWithUnit measure = IfcMeasureWithUnit::Create(model);
+    IfcPropertyEnumeratedValue propEnumValue = IfcPropertyEnumeratedValue::Create(model);
+    measure.put_ValueComponent().put_IfcSimpleValue().put_IfcInteger(0);
+
+    //pools and caches of this thread are filled by a first run of each stage
+    CrossThread(measure, propEnumValue, SELECTS);
+    WriteRead(measure, propEnumValue, 1000);
+    int64_t live = s_live.load();
+
+    WriteRead(measure, propEnumValue, ITERATIONS);
+    printf("%d writes and reads of selects: %lld live allocations, %lld before\n", ITERATIONS, (long long) s_live.load(), (long long) live);
+    CHECK(s_live.load() == live);
+
+    CrossThread(measure, propEnumValue, SELECTS);
+    live = s_live.load();
+
+    for (int round = 0; round < 5; round++) {
+        CrossThread(measure, propEnumValue, SELECTS);
+    }
+    printf("%d selects destroyed on other threads 5 times: %lld live allocations, %lld before\n", SELECTS, (long long) s_live.load(), (long long) live);
+    CHECK(s_live.load() == live);
+
+    CloseModel(model);
+    return s_failed ? 1 : 0;
+}
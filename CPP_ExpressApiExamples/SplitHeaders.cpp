@@ -0,0 +1,46 @@
+//
+// Split IFC4 headers (generator --split, API.generated/IFC4): this translation unit includes headers of the entities it uses only
+// SplitHeadersAll.cpp includes all entities with IFC4/IFC4.h, IFC4/IFC4_serializers.cpp instantiates aggregation serializers
+//
+#include    <string.h>
+#include    "IFC4/IfcWall.h"
+#include    "IFC4/IfcLocalPlacement.h"
+#include    "IFC4/IfcCartesianPoint.h"
+
+using namespace IFC4;
+
+extern bool VisitWall(SdaiInstance instance);
+extern IfcProduct PlacedProduct(SdaiModel model, IfcObjectPlacement placement);
+
+extern int main()
+{
+    SdaiModel model = sdaiCreateModelBN(0, NULL, "IFC4");
+
+    IfcWall wall = IfcWall::Create(model);
+    wall.put_Name("MyWall");
+    wall.put_PredefinedType(IfcWallTypeEnum::MOVABLE);
+    assert(!strcmp(wall.get_Name(), "MyWall"));
+    assert(wall.get_PredefinedType().Value() == IfcWallTypeEnum::MOVABLE);
+
+    //entity attribute, class of its domain comes with IfcProduct.h
+    IfcLocalPlacement placement = IfcLocalPlacement::Create(model);
+    wall.put_ObjectPlacement(placement);
+    assert(wall.get_ObjectPlacement() == placement);
+    assert(IfcWall(IfcBuildingElement(wall)) == wall);
+
+    //aggregation
+    IfcCartesianPoint point = IfcCartesianPoint::Create(model);
+    double xyz[] = {1, 2, 3};
+    point.put_Coordinates(xyz, 3);
+    ListOfIfcLengthMeasure coordinates;
+    point.get_Coordinates(coordinates);
+    assert(coordinates.size() == 3 && coordinates.back() == 3);
+
+    //translation unit with all entities
+    assert(VisitWall(wall));
+    assert(!VisitWall(placement));
+    assert(PlacedProduct(model, placement) == wall);
+
+    sdaiCloseModel(model);
+    return 0;
+}
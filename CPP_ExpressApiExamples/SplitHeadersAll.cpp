@@ -0,0 +1,24 @@
+//
+// Split IFC4 headers: translation unit including all entities, see SplitHeaders.cpp
+//
+#include    <type_traits>
+#include    "IFC4/IFC4.h"
+
+using namespace IFC4;
+
+extern bool VisitWall(SdaiInstance instance)
+{
+    bool wall = false;
+    Visit(instance, [&](auto entity) { wall = std::is_same<decltype(entity), IfcWall>::value; });
+    return wall;
+}
+
+extern IfcProduct PlacedProduct(SdaiModel model, IfcObjectPlacement placement)
+{
+    for (IfcProduct product : IfcProduct::ExtentWithSubtypes(model)) {
+        if (product.get_ObjectPlacement() == placement) {
+            return product;
+        }
+    }
+    return 0;
+}
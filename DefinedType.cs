@@ -167,6 +167,8 @@ namespace RDFWrappers
 
                 if (foundation.declarationType == enum_express_declaration.__SELECT)
                 {
+                    generator.m_selectsOfDefinedTypes[name] = referTypeName;
+
                     if (!generator.m_cs)
                         {
                         generator.m_replacements[Generator.KWD_DEFINED_TYPE] = name + "_put";
@@ -810,6 +810,8 @@ namespace NAMESPACE_NAME
             return m_instance.GetHashCode();
             }
         }
+    //## TEMPLATE: IfcTables
+    //## TEMPLATE: ForwardDeclarationsBegin
     //## TEMPLATE: ClassForwardDeclaration
     //## TEMPLATE: DefinedTypesBegin
 
@@ -1044,6 +1046,7 @@ namespace NAMESPACE_NAME
 
         public static implicit operator ENTITY_NAME(SdaiInstance instance) => new ENTITY_NAME(instance);
 
+        //## EntitySupertypeConversion
         //## EntityCreateMethod
         /// <summary>
         /// Create new instance of ENTITY_NAME and returns object of this class to interact with
@@ -1086,6 +1089,8 @@ namespace NAMESPACE_NAME
             get { return get_string("ATTR_NAME", ifcengine.sdaiTYPE); }
             set { ifcengine.sdaiPutAttrBN(m_instance, "ATTR_NAME", ifcengine.sdaiTYPE, value); }
             }
+        //## AttributeGlobalIdPut
+        //## AttributeTextGetUtf8
         //## AttributeEntityGet
         public REF_ENTITY Attr_nAME { get { SdaiInstance inst = 0; ifcengine.sdaiGetAttrBN(m_instance, "ATTR_NAME", ifcengine.sdaiINSTANCE, out inst); return REF_ENTITY.CreateExactEntity(inst); } }
         //## AttributeEntityPut
@@ -1114,6 +1119,11 @@ namespace NAMESPACE_NAME
         public void put_ATTr_NAME(IEnumerable<SimpleType> lst) { (new AggregationTypeSerializer()).ToSdaiAggr(lst, m_instance, "ATTR_NAME"); }
         public void put_ATTr_NAME_untyped(IEnumerable lst) { (new AggregationTypeSerializer()).ToSdaiAggr(lst, m_instance, "ATTR_NAME"); }
         //## AttributeAggregationPutArray
+        //## AttributeAggregationGetFlat
+        //## AttributeAggregationPutFlat
+        //## EntityAttributesBegin
+        //## EntityAttribute
+        //## EntityAttributesEnd
         //## EntityEnd
 
         protected override TextValue WrapperEntityName() { return "ENTITY_NAME"; }
@@ -1125,6 +1135,40 @@ namespace NAMESPACE_NAME
     //## SelectEntityPutImplementation
     //## AttributeEntityGetImplementation
     //## AttributeEntityPutImplementation
+    //## AttributeOrdinalAccessor
+    //## GlobalIdIndex
+    //## SerializersBegin
+    //## SerializerOfSimple
+    //## SerializerOfText
+    //## SerializerOfInstance
+    //## SerializerOfEnum
+    //## SerializerOfAggregation
+    //## SerializerOfSelect
+    //## SerializersEnd
+    //## SchemaEntitiesBegin
+    //## SchemaEntity
+    //## SchemaSupertypesBegin
+    //## SchemaSupertypes
+    //## SchemaEntitiesEnd
+    //## SchemaAttributesBegin
+    //## SchemaAttribute
+    //## SchemaAttributesEnd
+    //## SchemaTypePathsBegin
+    //## SchemaTypePath
+    //## SchemaTypePathsEnd
+    //## RelationshipIndex
+    //## SpatialTree
+    //## PropertyTable
+    //## PlacementResolver
+    //## VisitBegin
+    //## VisitCase
+    //## VisitEnd
+    //## SplitHeaderBegin
+    //## SplitInclude
+    //## SplitNamespaceBegin
+    //## SplitNamespaceEnd
+    //## SplitHeaderEnd
+    //## SerializersSource
     //## TEMPLATE: EndFile template part
     }
 
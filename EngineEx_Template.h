@@ -5,11 +5,92 @@
 #define __RDF_LTD__NAMESPACE_NAME_H
 
 #include    <assert.h>
+#include    <stdint.h>
+#include    <stddef.h>
+#include    <stdio.h>
+#include    <string.h>
+#include    <math.h>
+#include    <iterator>
 #include    <list>
 #include    <string>
+#include    <vector>
+#include    <unordered_map>
+#include    <unordered_set>
+#include    <memory>
+#include    <type_traits>
+#include    <utility>
+#include    <atomic>
+#include    <mutex>
+#include    <thread>
+#include    <algorithm>
+#if __cplusplus >= 201703L || _MSVC_LANG >= 201703L
+#include    <optional>
+#include    <string_view>
+#endif
+#if __cplusplus >= 202002L || _MSVC_LANG >= 202002L
+#include    <span>
+#endif
 
 #include	"ifcengine.h"
 
+#if !defined(_WIN32) && !defined(_stricmp)
+#include    <strings.h>
+#define _stricmp strcasecmp
+#endif
+
+//
+// Container of generated aggregation types (ListOf..., SetOf...)
+// Define as std::list before including the header to get list based aggregations
+//
+#ifndef RDF_EXPRESS_AGGREGATION_CONTAINER
+#define RDF_EXPRESS_AGGREGATION_CONTAINER std::vector
+#endif
+
+//
+// Layout of entity classes
+// Define RDF_EXPRESS_FLAT_ENTITIES before including the header to derive entity classes from their first supertype without virtual inheritance,
+// objects then have size of SdaiInstance and are trivially copyable, other supertypes are reached by conversion operators
+// Define it the same way in all translation units of a program
+//
+#ifdef RDF_EXPRESS_FLAT_ENTITIES
+#define RDF_EXPRESS_VIRTUAL
+#define RDF_EXPRESS_SUPERTYPE(supertype)
+#else
+#define RDF_EXPRESS_VIRTUAL                 virtual
+#define RDF_EXPRESS_SUPERTYPE(supertype)    , public virtual supertype
+#endif
+
+//
+// Accessor instrumentation
+// Define RDF_EXPRESS_INSTRUMENT before including the header to count calls and cycles of generated accessors per attribute, see DumpAccessorProfile
+// Without it the probes expand to nothing
+//
+#ifdef RDF_EXPRESS_INSTRUMENT
+#if defined(_M_X64) || defined(_M_IX86)
+#include    <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include    <x86intrin.h>
+#else
+#include    <chrono>
+#endif
+#define RDF_EXPRESS_PROBE(attrOrdinal)                  AccessorProbe accessorProbe_(attrOrdinal)
+#else
+#define RDF_EXPRESS_PROBE(attrOrdinal)
+#endif
+
+//
+// Matrix composition of PlacementTable
+// Uses AVX when the compiler targets it (/arch:AVX, -mavx), SSE2 on other x86 and x64 targets
+// Define RDF_EXPRESS_NO_SIMD before including the header to compose matrices with scalar code
+//
+#if !defined(RDF_EXPRESS_NO_SIMD) && defined(__AVX__)
+#include    <immintrin.h>
+#define RDF_EXPRESS_SIMD_AVX
+#elif !defined(RDF_EXPRESS_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include    <emmintrin.h>
+#define RDF_EXPRESS_SIMD_SSE2
+#endif
+
 namespace NAMESPACE_NAME
 {
     ///
@@ -27,519 +108,3168 @@ namespace NAMESPACE_NAME
     };
 
     /// <summary>
-    /// 
+    /// Value or NULL, the value is stored inline without heap allocation
+    /// Copy and move are trivial when they are trivial for T
     /// </summary>
     template <typename T> class Nullable
     {
     protected:
-        T* m_value;
+        T    m_value;
+        bool m_hasValue;
 
     public:
-        Nullable<T>() : m_value(NULL) {}
-        Nullable<T>(T value) { m_value = new T(value); }
-        Nullable<T>(const Nullable<T>& src) { if (src.m_value) m_value = new T(*src.m_value); else m_value = NULL; }
+        Nullable() : m_value(), m_hasValue(false) {}
+        Nullable(T value) : m_value(value), m_hasValue(true) {}
+
+        bool IsNull() const { return !m_hasValue; }
+        T Value() const { assert(m_hasValue); if (m_hasValue) return m_value; else return (T) 0; }
+
+#if __cplusplus >= 201703L || _MSVC_LANG >= 201703L
+        Nullable(const std::optional<T>& value) : m_value(value ? *value : T()), m_hasValue(value.has_value()) {}
+        operator std::optional<T>() const { if (m_hasValue) return m_value; else return std::nullopt; }
+#endif
+    };
+
+    static_assert(std::is_trivially_copyable<Nullable<double>>::value, "Nullable of scalar must be trivially copyable");
+
+#ifdef __cpp_lib_string_view
+    /// <summary>
+    /// View of text returned by the engine, empty for NULL
+    /// The engine owns the text, it stays valid while the model is open and the attribute is not changed
+    /// Copy the text or intern it to TextArena to keep it longer
+    /// </summary>
+    inline std::string_view TextView(TextValue text) { return text ? std::string_view(text) : std::string_view(); }
 
-        virtual ~Nullable<T>() { if (m_value) { delete m_value; } };
+    /// <summary>
+    /// Keeps one copy of each distinct text in large blocks, so copying texts does not allocate memory per text
+    /// Views returned by Intern are NUL terminated and valid until the arena is destroyed
+    /// </summary>
+    class TextArena
+    {
+    public:
+        explicit TextArena(size_t blockSize = 64 * 1024) : m_blockSize(blockSize), m_next(NULL), m_free(0), m_count(0), m_slots(64) {}
+        TextArena(const TextArena&) = delete;
+        TextArena& operator=(const TextArena&) = delete;
 
-        bool IsNull() const { return !m_value; }
-        T Value() const { assert(m_value); if (m_value) return *m_value; else return (T) 0; }
+        std::string_view Intern(TextValue text) { return Intern(TextView(text)); }
 
-        virtual Nullable<T>& operator=(const Nullable<T>& src)
+        std::string_view Intern(std::string_view text)
         {
-            if (m_value) { delete m_value; }
-            m_value = NULL;
-            if (src.m_value) { m_value = new T(*(src.m_value)); }
-            return *this;
+            size_t mask = m_slots.size() - 1;
+            for (size_t i = std::hash<std::string_view>()(text) & mask; ; i = (i + 1) & mask) {
+                if (m_slots[i].data() == NULL) {
+                    std::string_view copy = Copy(text);
+                    m_slots[i] = copy;
+                    if (++m_count * 2 > m_slots.size()) {
+                        Rehash();
+                    }
+                    return copy;
+                }
+                if (m_slots[i] == text) {
+                    return m_slots[i];
+                }
+            }
+        }
+
+        /// <summary>
+        /// Number of distinct texts
+        /// </summary>
+        size_t Count() const { return m_count; }
+
+    private:
+        std::string_view Copy(std::string_view text)
+        {
+            size_t size = text.size() + 1;
+            if (size > m_free) {
+                size_t blockSize = size > m_blockSize ? size : m_blockSize;
+                m_blocks.push_back(std::unique_ptr<char[]>(new char[blockSize]));
+                m_next = m_blocks.back().get();
+                m_free = blockSize;
+            }
+            char* copy = m_next;
+            text.copy(copy, text.size());
+            copy[text.size()] = 0;
+            m_next += size;
+            m_free -= size;
+            return std::string_view(copy, text.size());
+        }
+
+        void Rehash()
+        {
+            std::vector<std::string_view> slots(m_slots.size() * 2);
+            size_t mask = slots.size() - 1;
+            for (auto const& text : m_slots) {
+                if (text.data() != NULL) {
+                    size_t i = std::hash<std::string_view>()(text) & mask;
+                    while (slots[i].data() != NULL) {
+                        i = (i + 1) & mask;
+                    }
+                    slots[i] = text;
+                }
+            }
+            m_slots.swap(slots);
+        }
+
+    private:
+        size_t                                  m_blockSize;
+        std::vector<std::unique_ptr<char[]>>    m_blocks;
+        char*                                   m_next;
+        size_t                                  m_free;
+        size_t                                  m_count;
+        std::vector<std::string_view>           m_slots;    //open addressing, empty slot has NULL data
+    };
+
+    /// <summary>
+    /// List of texts interned to TextArena, may be used as TList of text aggregation getters
+    /// </summary>
+    class InternedTextList : public std::vector<std::string_view>
+    {
+    public:
+        explicit InternedTextList(TextArena& arena) : m_arena(&arena) {}
+
+        void push_back(TextValue text) { std::vector<std::string_view>::push_back(m_arena->Intern(text)); }
+
+    private:
+        TextArena* m_arena;
+    };
+#endif
+
+    /// <summary>
+    /// Sets encoding of sdaiSTRING texts of the model, with UTF8 text getters and putters pass UTF-8 without codepage conversion
+    /// UTF-8 getters (get_*_utf8, Utf8Buffer) return UTF-8 with any encoding of the model
+    /// NULL model sets encoding of models created after the call
+    /// </summary>
+    inline bool SetTextEncoding(SdaiModel model, enum_string_encoding encoding = enum_string_encoding::UTF8) { return engiSetStringEncoding(model, encoding) != 0; }
+
+    /// <summary>
+    /// Growable buffer of UTF-8 text
+    /// Reuse one buffer to read many texts without memory allocation per call, the text is valid until the next read to the buffer
+    /// </summary>
+    class Utf8Buffer
+    {
+    public:
+        explicit Utf8Buffer(size_t capacity = 256) : m_data(capacity ? capacity : 1), m_size(0) {}
+
+        /// <summary>
+        /// Reads text attribute by name with sdaiGetAttrBNUnicode, the buffer grows when the text does not fit
+        /// sdaiGetAttrBNUnicode returns size of UTF-8 text with the terminating zero and writes the text if it fits, 0 if the attribute is not set
+        /// Returns NULL if the attribute is not set
+        /// </summary>
+        const char* GetAttr(SdaiInstance instance, TextValue attrName)
+        {
+            m_size = 0;
+            if (!instance || !attrName) {
+                return NULL;
+            }
+
+            int_t size = sdaiGetAttrBNUnicode(instance, attrName, m_data.data(), (int_t) m_data.size());
+            if (size > (int_t) m_data.size()) {
+                m_data.resize((size_t) size);
+                size = sdaiGetAttrBNUnicode(instance, attrName, m_data.data(), (int_t) m_data.size());
+            }
+            if (size <= 0 || size > (int_t) m_data.size()) {
+                return NULL;
+            }
+
+            m_size = (size_t) size - 1;
+            return c_str();
+        }
+
+        /// <summary>
+        /// Copies text to the buffer, returns NULL for NULL text
+        /// </summary>
+        const char* Assign(TextValue text)
+        {
+            if (!text) {
+                m_size = 0;
+                return NULL;
+            }
+            m_size = strlen(text);
+            if (m_size >= m_data.size()) {
+                m_data.resize(m_size + 1);
+            }
+            memcpy(m_data.data(), text, m_size + 1);
+            return c_str();
         }
+
+        const char* c_str() const { return (const char*) m_data.data(); }
+        size_t size() const { return m_size; }
+#ifdef __cpp_lib_string_view
+        std::string_view view() const { return std::string_view(c_str(), m_size); }
+#endif
+
+    private:
+        std::vector<unsigned char>  m_data;
+        size_t                      m_size;   //without terminating zero
+    };
+
+    /// <summary>
+    /// Buffer of the calling thread used by UTF-8 getters without buffer argument
+    /// </summary>
+    inline Utf8Buffer& ThreadUtf8Buffer() { static thread_local Utf8Buffer buffer; return buffer; }
+
+    /// <summary>
+    /// Perfect hash of enumeration values, computed by the generator
+    /// Each value falls into its own slot, so decoding takes one hash and one string compare
+    /// </summary>
+    struct EnumerationHash
+    {
+        TextValue*      values;
+        const short*    slots;  //index in values or -1, size is mask + 1
+        uint32_t        seed;
+        uint32_t        mask;
     };
 
+    //
+    // FNV-1a of upper case ASCII, the generator uses the same function to find the seed
+    //
+    constexpr uint32_t EnumerationHashSlot(TextValue value, uint32_t seed, uint32_t mask)
+    {
+        uint32_t h = 2166136261u ^ seed;
+        for (; *value; value++) {
+            unsigned char c = (unsigned char) *value;
+            if (c >= 'a' && c <= 'z') {
+                c = (unsigned char) (c - 'a' + 'A');
+            }
+            h = (h ^ c) * 16777619u;
+        }
+        return (h ^ (h >> 15)) & mask;
+    }
+
     //
     //
     enum class LOGICAL_VALUE { False = 0, True, Unknown };
-    static TextValue LOGICAL_VALUE_[] = {"F", "T", "U", NULL};
+    inline TextValue LOGICAL_VALUE_[] = {"F", "T", "U", NULL};
+    inline constexpr short LOGICAL_VALUE_slots[] = {2, -1, -1, 1, -1, -1, 0, -1};
+    inline constexpr EnumerationHash LOGICAL_VALUE_hash = {LOGICAL_VALUE_, LOGICAL_VALUE_slots, 0u, 7u};
 
     //
     //
-    static int EnumerationNameToIndex(TextValue rEnumValues[], TextValue value)
+    inline int EnumerationNameToIndex(const EnumerationHash& hash, TextValue value)
     {
         if (value) {
-            for (int i = 0; rEnumValues[i]; i++) {
-                if (0 == _stricmp(value, rEnumValues[i])) {
-                    return i;
-                }
+            int i = hash.slots[EnumerationHashSlot(value, hash.seed, hash.mask)];
+            if (i >= 0 && 0 == _stricmp(value, hash.values[i])) {
+                return i;
             }
         }
         return -1;
     }
 
     /// <summary>
-    /// Helper class to handle and access SELECT instance data
+    /// Entity and attribute names of generated accessors, indexed by attribute ordinal
     /// </summary>
-    class Select
+    struct AttributeName
     {
-    protected:
-        SdaiInstance m_instance;
-        TextValue m_attrName;
+        TextValue entityName;
+        TextValue attrName;
+    };
 
-    private:
-        void* m_adb;
-        Select* m_outerSelect;
+    inline const AttributeName* SchemaAttributes(IntValue& count); //generated after entities
+
+    /// <summary>
+    /// Generation of model handles, changes when a model is closed
+    /// The engine may give the handle of a closed model to a new model, per-model caches of generated wrappers are dropped when the generation changes
+    /// </summary>
+    inline std::atomic<uint32_t>& ModelGeneration() { static std::atomic<uint32_t> generation(0); return generation; }
+
+    /// <summary>
+    /// Drops attribute and entity handles cached by generated wrappers in all threads
+    /// CloseModel calls it, call it after sdaiCloseModel when a model is closed with the engine API
+    /// </summary>
+    inline void ForgetModels() { ModelGeneration().fetch_add(1); }
+
+    /// <summary>
+    /// Closes the model and drops handles cached for it by generated wrappers
+    /// </summary>
+    inline void CloseModel(SdaiModel model) { sdaiCloseModel(model); ForgetModels(); }
 
+    /// <summary>
+    /// Resolves SdaiAttr handles of generated accessors once per model, so accessors do not look up attributes by name on every call
+    /// Handles of all models are dropped when a model is closed, see ForgetModels
+    /// The cache is keyed by model handle: after sdaiCloseModel without ForgetModels the engine may give the handle to a new model
+    /// of another schema, and accessors would pass handles of the closed model's attributes to it
+    /// </summary>
+    class AttributeCache
+    {
     public:
-        void* ADB()
+        static SdaiAttr Get(SdaiInstance instance, IntValue ordinal)
         {
-            if (m_outerSelect) {
-                return m_outerSelect->ADB();
-            }
-
-            if (!m_adb && m_instance && m_attrName) {
-                if (!sdaiGetAttrBN(m_instance, m_attrName, sdaiADB, &m_adb)) {
-                    sdaiDeleteADB(m_adb);
-                    m_adb = NULL;
-                }
+            if (!instance) {
+                return NULL;
             }
 
-            return m_adb;
-        }
+            thread_local AttributeCache cache;
 
-    protected:
-        Select(SdaiInstance instance, TextValue attrName = NULL, void* adb = NULL)
-            : m_instance(instance), m_attrName(attrName), m_adb(adb), m_outerSelect(NULL)
-        {
-            assert(instance);
-        }
+            SdaiModel model = sdaiGetInstanceModel(instance);
+            uint32_t generation = ModelGeneration().load(std::memory_order_relaxed);
+            if (model != cache.m_model || generation != cache.m_generation) {
+                cache.SetModel(model, generation);
+            }
 
-        Select(Select* outer)
-            : m_instance(NULL), m_attrName(NULL), m_adb(NULL), m_outerSelect(outer)
-        {
-            assert(outer);
-            if (m_outerSelect) {
-                m_instance = m_outerSelect->m_instance;
+            SdaiAttr& attr = (*cache.m_attrs)[ordinal];
+            if (!attr) {
+                attr = cache.Resolve(ordinal);
             }
+            return attr;
         }
 
-        void SetADB(void* adb)
+    private:
+        AttributeCache() : m_model(0), m_generation(0), m_attrs(NULL) {}
+
+        void SetModel(SdaiModel model, uint32_t generation)
         {
-            if (m_outerSelect) {
-                m_outerSelect->SetADB(adb);
+            if (generation != m_generation) {
+                m_models.clear();
+                m_generation = generation;
             }
-            else {
-                //???sdaiDeleteADB(m_adb);
-                m_adb = adb;
 
-                if (m_instance && m_attrName) {
-                    sdaiPutAttrBN(m_instance, m_attrName, sdaiADB, m_adb);
-                }
+            m_model = model;
+            m_attrs = &m_models[model];
+            if (m_attrs->empty()) {
+                IntValue count = 0;
+                SchemaAttributes(count);
+                m_attrs->resize(count, NULL);
             }
         }
 
-        //
-        template <typename T> Nullable<T> getSimpleValue(TextValue typeName, IntValue sdaiType)
+        SdaiAttr Resolve(IntValue ordinal)
         {
-            Nullable<T> ret;
-            if (void* adb = ADB()) {
-                const char* path = sdaiGetADBTypePath(adb, 0);
-                if (typeName == NULL || path && 0 == _stricmp(path, typeName)) {
-                    T val = (T) 0;
-                    if (sdaiGetADBValue(adb, sdaiType, &val)) {
-                        ret = val;
-                    }
-                }
-            }
-            return ret;
+            IntValue count = 0;
+            const AttributeName& name = SchemaAttributes(count)[ordinal];
+            SdaiEntity entity = sdaiGetEntity(m_model, name.entityName);
+            return entity ? sdaiGetAttrDefinition(entity, name.attrName) : NULL;
         }
 
-        //
-        template <typename T> void putSimpleValue(TextValue typeName, IntValue sdaiType, T value)
+    private:
+        SdaiModel                                               m_model;
+        uint32_t                                                m_generation;
+        std::vector<SdaiAttr>*                                  m_attrs;
+        std::unordered_map<SdaiModel, std::vector<SdaiAttr>>    m_models;
+    };
+
+#ifdef RDF_EXPRESS_INSTRUMENT
+    /// <summary>
+    /// Calls and cycles of generated accessors by attribute ordinal, collected when RDF_EXPRESS_INSTRUMENT is defined
+    /// Each thread counts into its own table without locks, tables of finished threads are taken over by new threads
+    /// </summary>
+    class AccessorProfile
+    {
+    public:
+        static uint64_t Now()
         {
-            void* adb = sdaiCreateADB(sdaiType, &value);
-            sdaiPutADBTypePath(adb, 1, typeName);
-            SetADB(adb);
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
         }
 
-        //
-        TextValue getTextValue(TextValue typeName, IntValue sdaiType)
+        static void Add(IntValue attrOrdinal, uint64_t cycles)
         {
-            TextValue ret = NULL;
-            if (void* adb = ADB()) {
-                const char* path = sdaiGetADBTypePath(adb, 0);
-                if (typeName == NULL || path && 0 == _stricmp(path, typeName)) {
-                    if (!sdaiGetADBValue(adb, sdaiType, &ret)) {
-                        ret = NULL;
-                    }
-                }
-            }
-            return ret;
+            //only the owning thread writes, relaxed load and store is a plain increment
+            Counter& counter = ThreadTable().counters[attrOrdinal];
+            counter.calls.store(counter.calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            counter.cycles.store(counter.cycles.load(std::memory_order_relaxed) + cycles, std::memory_order_relaxed);
         }
 
-        //
-        void putTextValue(TextValue typeName, IntValue sdaiType, TextValue value)
+        //calls of accessors of the attribute counted by all threads so far
+        static uint64_t Calls(IntValue attrOrdinal)
         {
-            void* adb = sdaiCreateADB(sdaiType, value);
-            sdaiPutADBTypePath(adb, 1, typeName);
-            SetADB(adb);
+            uint64_t calls = 0;
+            Tables& tables = AllTables();
+            std::lock_guard<std::mutex> lock(tables.mutex);
+            for (auto& table : tables.list) {
+                calls += table->counters[attrOrdinal].calls.load(std::memory_order_relaxed);
+            }
+            return calls;
         }
 
-        //
-        int getEnumerationValue(TextValue typeName, TextValue rEnumValues[])
+        static void Dump(FILE* file)
         {
-            int ret = -1;
-            if (void* adb = ADB()) {
-                const char* path = sdaiGetADBTypePath(adb, 0);
-                if (typeName == NULL || path && 0 == _stricmp(path, typeName)) {
-                    TextValue value = NULL;
-                    if (sdaiGetADBValue(adb, sdaiENUM, &value)) {
-                        ret = EnumerationNameToIndex(rEnumValues, value);
+            IntValue count = 0;
+            const AttributeName* names = SchemaAttributes(count);
+
+            std::vector<uint64_t> calls(count, 0);
+            std::vector<uint64_t> cycles(count, 0);
+            {
+                Tables& tables = AllTables();
+                std::lock_guard<std::mutex> lock(tables.mutex);
+                for (auto& table : tables.list) {
+                    for (IntValue i = 0; i < count; i++) {
+                        calls[i] += table->counters[i].calls.load(std::memory_order_relaxed);
+                        cycles[i] += table->counters[i].cycles.load(std::memory_order_relaxed);
                     }
                 }
             }
-            return ret;
+
+            std::vector<IntValue> order;
+            for (IntValue i = 0; i < count; i++) {
+                if (calls[i]) {
+                    order.push_back(i);
+                }
+            }
+            std::sort(order.begin(), order.end(), [&](IntValue i1, IntValue i2) { return cycles[i1] > cycles[i2]; });
+
+            fprintf(file, "%-64s %14s %16s %12s\n", "attribute", "calls", "cycles", "cycles/call");
+            for (IntValue i : order) {
+                char name[256];
+                snprintf(name, sizeof(name), "%s.%s", names[i].entityName, names[i].attrName);
+                fprintf(file, "%-64s %14llu %16llu %12.1f\n", name, (unsigned long long) calls[i], (unsigned long long) cycles[i], (double) cycles[i] / (double) calls[i]);
+            }
         }
 
-        //
-        void putEnumerationValue(TextValue typeName, TextValue value)
+    private:
+        struct Counter
         {
-            void* adb = sdaiCreateADB(sdaiENUM, value);
-            sdaiPutADBTypePath(adb, 1, typeName);
-            SetADB(adb);
-        }
+            std::atomic<uint64_t>   calls;
+            std::atomic<uint64_t>   cycles;
+        };
 
-        //
-        SdaiInstance getEntityInstance(TextValue typeName)
+        struct Table
         {
-            SdaiInstance ret = 0;
-            if (auto adb = ADB()) {
-                SdaiInstance inst = 0;
-                if (sdaiGetADBValue(adb, sdaiINSTANCE, &inst)) {
-                    if (typeName == NULL || sdaiIsKindOfBN(inst, typeName)) {
-                        ret = inst;
-                    }
-                }
-            }
-            return ret;
-        }
+            std::unique_ptr<Counter[]>  counters;
+            bool                        inUse;
+        };
 
-        //
-        void putEntityInstance(TextValue typeName, SdaiInstance inst)
+        struct Tables
         {
-            if (inst == 0 || sdaiIsKindOfBN(inst, typeName)) {
-                auto adb = sdaiCreateADB(sdaiINSTANCE, (void*) inst);
-                SetADB(adb);
-            }
-            else {
-                assert(0);
-            }
-        }
+            std::mutex                              mutex;
+            std::vector<std::unique_ptr<Table>>     list;
+        };
 
-        //
-        SdaiAggr getAggrValue(TextValue typeName)
+        struct ThreadOwner
         {
-            SdaiAggr ret = NULL;
-            if (void* adb = ADB()) {
-                const char* path = sdaiGetADBTypePath(adb, 0);
-                if (typeName == NULL || path && 0 == _stricmp(path, typeName)) {
-                    if (!sdaiGetADBValue(adb, sdaiAGGR, &ret)) {
-                        ret = NULL;
-                    }
-                }
-            }
-            return ret;
+            Table* table;
+
+            ThreadOwner() : table(Acquire()) {}
+            ~ThreadOwner() { Release(table); }
+        };
+
+        static Tables& AllTables()
+        {
+            static Tables tables;
+            return tables;
         }
 
-        //
-        void putAggrValue(TextValue typeName, SdaiAggr value)
+        static Table& ThreadTable()
         {
-            void* adb = sdaiCreateADB(sdaiAGGR, value);
-            sdaiPutADBTypePath(adb, 1, typeName);
-            SetADB(adb);
+            thread_local ThreadOwner owner;
+            return *owner.table;
         }
 
-        //
-        bool IsADBType(TextValue typeName)
+        static Table* Acquire()
         {
-            if (void* adb = ADB()) {
-                const char* path = sdaiGetADBTypePath(adb, 0);
-                if (0 == _stricmp(path, typeName)) {
-                    return true;
+            Tables& tables = AllTables();
+            std::lock_guard<std::mutex> lock(tables.mutex);
+
+            for (auto& table : tables.list) {
+                if (!table->inUse) {
+                    table->inUse = true;
+                    return table.get();
                 }
             }
-            return false;
+
+            IntValue count = 0;
+            SchemaAttributes(count);
+
+            tables.list.push_back(std::unique_ptr<Table>(new Table()));
+            Table* table = tables.list.back().get();
+            table->counters.reset(new Counter[count]());
+            table->inUse = true;
+            return table;
         }
 
-        bool IsADBEntity(TextValue typeName)
+        static void Release(Table* table)
         {
-            if (void* adb = ADB()) {
-                IntValue inst = 0;
-                if (sdaiGetADBValue(adb, sdaiINSTANCE, &inst)) {
-                    if (sdaiIsKindOfBN(inst, typeName)) {
-                        return true;
-                    }
-                }
-            }
-            return false;
+            Tables& tables = AllTables();
+            std::lock_guard<std::mutex> lock(tables.mutex);
+            table->inUse = false;
         }
     };
 
     /// <summary>
-    /// Aggregations templates
+    /// Adds the call and cycles of enclosing accessor to AccessorProfile, see RDF_EXPRESS_PROBE
+    /// Attribute ordinal -1 is not counted, it is used by selectors not returned by entity accessors
     /// </summary>
-    /// 
+    class AccessorProbe
+    {
+    public:
+        AccessorProbe(IntValue attrOrdinal) : m_attrOrdinal(attrOrdinal), m_start(attrOrdinal >= 0 ? AccessorProfile::Now() : 0) {}
+        ~AccessorProbe() { if (m_attrOrdinal >= 0) { AccessorProfile::Add(m_attrOrdinal, AccessorProfile::Now() - m_start); } }
 
-    template <typename TArrayElem, typename TList> void ArrayToList(TArrayElem arrayElems[], IntValue numOfElems, TList& lst)
+        AccessorProbe(const AccessorProbe&) = delete;
+        AccessorProbe& operator=(const AccessorProbe&) = delete;
+
+    private:
+        IntValue    m_attrOrdinal;
+        uint64_t    m_start;
+    };
+#endif
+
+    /// <summary>
+    /// Writes calls and cycles of generated accessors per attribute, most expensive first
+    /// Cycles are time stamp counter ticks on x86 and nanoseconds elsewhere
+    /// Select attributes are counted by is_, get_, put_ and as_ methods of selectors returned by entity accessors
+    /// </summary>
+    inline void DumpAccessorProfile(FILE* file)
     {
-        for (IntValue i = 0; i < numOfElems; i++) {
-            lst.push_back(arrayElems[i]);
-        }
+#ifdef RDF_EXPRESS_INSTRUMENT
+        AccessorProfile::Dump(file);
+#else
+        fprintf(file, "Accessor profile is not collected, define RDF_EXPRESS_INSTRUMENT\n");
+#endif
     }
 
-    template <typename TList> class AggrSerializer
-    {
-    public:
-        //
-        void FromAttr(TList& lst, SdaiInstance instance, TextValue attrName)
+    /// <summary>
+    /// Entity of the schema and its direct supertypes, indexed by entity ordinal
+    /// </summary>
+    struct EntityDefinition
+    {
+        TextValue   name;
+        IntValue    supertypes; //index in SchemaSupertypes_ of the -1 terminated list of supertype ordinals
+    };
+
+    inline const EntityDefinition* SchemaEntities(IntValue& count); //generated after entities
+    inline const IntValue* SchemaSupertypes(); //generated after entities
+    template <typename TVisitor> bool Visit(SdaiInstance instance, TVisitor&& visitor); //generated after entities
+
+    /// <summary>
+    /// Answers kind-of questions by entity ordinals, using bitset of all supertypes of each schema entity
+    /// </summary>
+    class EntityLattice
+    {
+    public:
+        static const EntityLattice& Get()
+        {
+            static const EntityLattice lattice;
+            return lattice;
+        }
+
+        bool IsKindOf(IntValue typeOrdinal, IntValue entityOrdinal) const
+        {
+            return (m_bits[typeOrdinal * m_words + entityOrdinal / 64] >> (entityOrdinal % 64)) & 1;
+        }
+
+    private:
+        EntityLattice()
+        {
+            SchemaEntities(m_count);
+            m_words = (m_count + 63) / 64;
+            m_bits.resize(m_count * m_words, 0);
+
+            std::vector<bool> done(m_count, false);
+            for (IntValue i = 0; i < m_count; i++) {
+                AddSupertypes(i, done);
+            }
+        }
+
+        void AddSupertypes(IntValue ordinal, std::vector<bool>& done)
+        {
+            if (done[ordinal]) {
+                return;
+            }
+            done[ordinal] = true;
+
+            uint64_t* bits = &m_bits[ordinal * m_words];
+            bits[ordinal / 64] |= uint64_t(1) << (ordinal % 64);
+
+            IntValue count = 0;
+            for (const IntValue* parent = SchemaSupertypes() + SchemaEntities(count)[ordinal].supertypes; *parent >= 0; parent++) {
+                AddSupertypes(*parent, done);
+                const uint64_t* parentBits = &m_bits[*parent * m_words];
+                for (IntValue w = 0; w < m_words; w++) {
+                    bits[w] |= parentBits[w];
+                }
+            }
+        }
+
+    private:
+        IntValue                m_count;
+        IntValue                m_words;
+        std::vector<uint64_t>   m_bits;
+    };
+
+    /// <summary>
+    /// Maps SdaiEntity of instances to entity ordinals, built once per model
+    /// Entity handles are opaque to the wrappers, so the table is a vector indexed by hash of the handle, at most half full
+    /// Tables of all models are dropped when a model is closed, see ForgetModels
+    /// </summary>
+    class EntityTypeTable
+    {
+    public:
+        //ordinal of the exact entity of the instance, -1 if the entity is not from this schema
+        static IntValue GetTypeOrdinal(SdaiInstance instance)
+        {
+            thread_local EntityTypeTable table;
+
+            SdaiModel model = sdaiGetInstanceModel(instance);
+            uint32_t generation = ModelGeneration().load(std::memory_order_relaxed);
+            if (model != table.m_model || generation != table.m_generation) {
+                table.SetModel(model, generation);
+            }
+
+            return table.GetOrdinal(sdaiGetInstanceType(instance));
+        }
+
+        static bool IsKindOf(SdaiInstance instance, IntValue entityOrdinal)
+        {
+            IntValue typeOrdinal = GetTypeOrdinal(instance);
+            if (typeOrdinal < 0) {
+                //the instance type is not from this schema
+                IntValue count = 0;
+                return sdaiIsKindOfBN(instance, SchemaEntities(count)[entityOrdinal].name) != 0;
+            }
+
+            return EntityLattice::Get().IsKindOf(typeOrdinal, entityOrdinal);
+        }
+
+    private:
+        struct Slot
+        {
+            SdaiEntity  entity;     //0 for empty slot
+            IntValue    ordinal;    //-1 for empty slot
+        };
+
+        typedef std::vector<Slot> Ordinals;
+
+        EntityTypeTable() : m_model(0), m_generation(0), m_types(NULL), m_lastType(0), m_lastOrdinal(-1) {}
+
+        void SetModel(SdaiModel model, uint32_t generation)
+        {
+            if (generation != m_generation) {
+                m_models.clear();
+                m_generation = generation;
+            }
+
+            m_model = model;
+            m_lastType = 0;
+            m_lastOrdinal = -1;
+
+            m_types = &m_models[model];
+            if (m_types->empty()) {
+                IntValue count = 0;
+                const EntityDefinition* entities = SchemaEntities(count);
+                size_t size = 16;
+                while (size < 2 * (size_t) count) {
+                    size *= 2;
+                }
+                m_types->assign(size, Slot{ 0, -1 });
+                for (IntValue i = 0; i < count; i++) {
+                    SdaiEntity entity = sdaiGetEntity(model, entities[i].name);
+                    if (entity) {
+                        Slot& slot = Find(entity);
+                        slot.entity = entity;
+                        slot.ordinal = i;
+                    }
+                }
+            }
+        }
+
+        IntValue GetOrdinal(SdaiEntity type)
+        {
+            if (type != m_lastType) {
+                m_lastType = type;
+                m_lastOrdinal = Find(type).ordinal;
+            }
+            return m_lastOrdinal;
+        }
+
+        //slot of the entity or empty slot where it would be
+        Slot& Find(SdaiEntity entity)
+        {
+            size_t mask = m_types->size() - 1;
+            uint64_t h = (uint64_t) entity * 0x9E3779B97F4A7C15ull;
+            for (size_t i = (size_t) (h >> 32) & mask; ; i = (i + 1) & mask) {
+                Slot& slot = (*m_types)[i];
+                if (slot.entity == entity || slot.entity == 0) {
+                    return slot;
+                }
+            }
+        }
+
+    private:
+        SdaiModel                                   m_model;
+        uint32_t                                    m_generation;
+        Ordinals*                                   m_types;
+        SdaiEntity                                  m_lastType;
+        IntValue                                    m_lastOrdinal;
+        std::unordered_map<SdaiModel, Ordinals>     m_models;
+    };
+
+    inline const TextValue* SchemaTypePaths(IntValue& count); //generated after entities
+
+    /// <summary>
+    /// Maps ADB type paths to indices in SchemaTypePaths_, so SELECT probes compare integers
+    /// Paths are interned on first use, case-insensitive
+    /// </summary>
+    class TypePathTable
+    {
+    public:
+        static IntValue Get(TextValue path)
+        {
+            if (!path) {
+                return -1;
+            }
+
+            thread_local TypePathTable table;
+
+            auto it = table.m_ids.find(path);
+            return (it != table.m_ids.end()) ? it->second : -1;
+        }
+
+        static TextValue Name(IntValue typePath)
+        {
+            IntValue count = 0;
+            return SchemaTypePaths(count)[typePath];
+        }
+
+    private:
+        struct Hash
+        {
+            size_t operator()(TextValue path) const { return EnumerationHashSlot(path, 0, 0xFFFFFFFFu); }
+        };
+
+        struct Equal
+        {
+            bool operator()(TextValue path1, TextValue path2) const { return 0 == _stricmp(path1, path2); }
+        };
+
+        TypePathTable()
+        {
+            IntValue count = 0;
+            const TextValue* paths = SchemaTypePaths(count);
+            for (IntValue i = 0; i < count; i++) {
+                m_ids[paths[i]] = i;
+            }
+        }
+
+    private:
+        std::unordered_map<TextValue, IntValue, Hash, Equal> m_ids;
+    };
+
+    /// <summary>
+    /// Per-thread pool of ADBs owned by Select objects
+    /// Empty ADBs used to read SELECT values are reused, ADBs created to put a value are deleted when the last owner releases them
+    /// A Select object and its copies may be passed to another thread and destroyed there, but not used by two threads at once:
+    /// the ADB released on a foreign thread is deleted and its record goes back to the owning pool, which outlives its thread until all records are back
+    /// </summary>
+    class ADBPool
+    {
+    public:
+        struct Ref
+        {
+            void*       adb;
+            IntValue    refs;
+            bool        reusable;
+            ADBPool*    owner;
+            Ref*        next;
+        };
+
+        static ADBPool& Get()
+        {
+            struct ThreadPool
+            {
+                ADBPool* pool = new ADBPool();
+                ~ThreadPool() { pool->Detach(); }
+            };
+            thread_local ThreadPool threadPool;
+            return *threadPool.pool;
+        }
+
+        //
+        // Empty ADB to read a value into
+        //
+        Ref* Empty()
+        {
+            Ref* ref = m_emptyADBs;
+            if (ref) {
+                m_emptyADBs = ref->next;
+                m_issued++;
+            }
+            else {
+                ref = NewRef();
+                ref->adb = sdaiCreateEmptyADB();
+                ref->reusable = true;
+            }
+            ref->refs = 1;
+            ref->next = NULL;
+            return ref;
+        }
+
+        //
+        // Takes ownership of ADB created by sdaiCreateADB
+        //
+        Ref* Own(void* adb)
+        {
+            Ref* ref = NewRef();
+            ref->adb = adb;
+            ref->reusable = false;
+            ref->refs = 1;
+            ref->next = NULL;
+            return ref;
+        }
+
+        void Release(Ref* ref)
+        {
+            if (--ref->refs > 0) {
+                return;
+            }
+
+            if (ref->owner != this) {
+                ref->owner->ReleaseForeign(ref);
+            }
+            else if (ref->reusable) {
+                ref->next = m_emptyADBs;
+                m_emptyADBs = ref;
+                m_issued--;
+            }
+            else {
+                sdaiDeleteADB(ref->adb);
+                ref->adb = NULL;
+                ref->next = m_freeRefs;
+                m_freeRefs = ref;
+                m_issued--;
+            }
+        }
+
+    private:
+        ADBPool() : m_emptyADBs(NULL), m_freeRefs(NULL), m_issued(0), m_foreignRefs(NULL), m_pending(0) {}
+
+        //
+        // Called on the thread that released the last copy, the owner takes the record back in NewRef
+        //
+        void ReleaseForeign(Ref* ref)
+        {
+            sdaiDeleteADB(ref->adb);
+            ref->adb = NULL;
+
+            Ref* head = m_foreignRefs.load(std::memory_order_relaxed);
+            do {
+                ref->next = head;
+            } while (!m_foreignRefs.compare_exchange_weak(head, ref, std::memory_order_release, std::memory_order_relaxed));
+
+            //the pool is deleted by the last foreign release after its thread has finished
+            if (m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                delete this;
+            }
+        }
+
+        //
+        // Called when the thread finishes, m_pending counts records still owned by Select objects on other threads
+        //
+        void Detach()
+        {
+            for (Ref* ref = m_emptyADBs; ref; ref = ref->next) {
+                sdaiDeleteADB(ref->adb);
+            }
+            m_emptyADBs = NULL;
+
+            if (m_pending.fetch_add(m_issued, std::memory_order_acq_rel) + m_issued == 0) {
+                delete this;
+            }
+        }
+
+        Ref* NewRef()
+        {
+            if (!m_freeRefs) {
+                m_freeRefs = m_foreignRefs.exchange(NULL, std::memory_order_acquire);
+            }
+            if (!m_freeRefs) {
+                const int BLOCK_SIZE = 64;
+                m_blocks.push_back(std::unique_ptr<Ref[]>(new Ref[BLOCK_SIZE]));
+                for (int i = 0; i < BLOCK_SIZE; i++) {
+                    m_blocks.back()[i].next = m_freeRefs;
+                    m_freeRefs = &m_blocks.back()[i];
+                }
+            }
+
+            Ref* ref = m_freeRefs;
+            m_freeRefs = ref->next;
+            ref->owner = this;
+            m_issued++;
+            return ref;
+        }
+
+    private:
+        Ref*                                    m_emptyADBs;
+        Ref*                                    m_freeRefs;
+        std::vector<std::unique_ptr<Ref[]>>     m_blocks;
+        IntValue                                m_issued;       //records held by Select objects, counted on the owning thread only
+        std::atomic<Ref*>                       m_foreignRefs;  //records released on other threads
+        std::atomic<IntValue>                   m_pending;      //minus foreign releases, plus m_issued once the thread has finished
+    };
+
+    /// <summary>
+    /// Helper class to handle and access SELECT instance data
+    /// Type paths are passed as indices in SchemaTypePaths_ and entity types as entity ordinals, -1 means any type
+    /// </summary>
+    class Select
+    {
+    protected:
+        SdaiInstance m_instance;
+        IntValue m_attrOrdinal; //attribute of m_instance holding the value, -1 if the value is not read from an attribute
+
+    private:
+        void* m_adb;
+        ADBPool::Ref* m_adbRef;
+        IntValue m_typePath; //cached index of ADB type path, -2 if not known yet
+        Select* m_outerSelect;
+
+    public:
+        void* ADB()
+        {
+            if (m_outerSelect) {
+                return m_outerSelect->ADB();
+            }
+
+            if (!m_adb && m_instance && m_attrOrdinal >= 0) {
+                ADBPool::Ref* ref = ADBPool::Get().Empty();
+                if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiADB, ref->adb)) {
+                    m_adb = ref->adb;
+                    m_adbRef = ref;
+                    m_typePath = -2;
+                }
+                else {
+                    ADBPool::Get().Release(ref);
+                }
+            }
+
+            return m_adb;
+        }
+
+#ifdef RDF_EXPRESS_INSTRUMENT
+        //ordinal of the attribute whose entity accessor returned the selector, calls of the selector are counted for it
+        IntValue ProbeAttr() { return m_outerSelect ? m_outerSelect->ProbeAttr() : m_attrOrdinal; }
+#endif
+
+        Select(const Select& src)
+            : m_instance(src.m_instance), m_attrOrdinal(src.m_attrOrdinal), m_adb(src.m_adb), m_adbRef(src.m_adbRef), m_typePath(src.m_typePath), m_outerSelect(src.m_outerSelect)
+        {
+            if (m_adbRef) {
+                m_adbRef->refs++;
+            }
+        }
+
+        Select& operator=(const Select& src)
+        {
+            if (src.m_adbRef) {
+                src.m_adbRef->refs++;
+            }
+            ReleaseADB();
+
+            m_instance = src.m_instance;
+            m_attrOrdinal = src.m_attrOrdinal;
+            m_adb = src.m_adb;
+            m_adbRef = src.m_adbRef;
+            m_typePath = src.m_typePath;
+            m_outerSelect = src.m_outerSelect;
+            return *this;
+        }
+
+        ~Select()
+        {
+            ReleaseADB();
+        }
+
+    protected:
+        Select(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL)
+            : m_instance(instance), m_attrOrdinal(attrOrdinal), m_adb(adb), m_adbRef(NULL), m_typePath(-2), m_outerSelect(NULL)
+        {
+            assert(instance);
+        }
+
+        Select(Select* outer)
+            : m_instance(0), m_attrOrdinal(-1), m_adb(NULL), m_adbRef(NULL), m_typePath(-2), m_outerSelect(outer)
+        {
+            assert(outer);
+            if (m_outerSelect) {
+                m_instance = m_outerSelect->m_instance;
+            }
+        }
+
+        void SetADB(void* adb)
+        {
+            if (m_outerSelect) {
+                m_outerSelect->SetADB(adb);
+            }
+            else {
+                ReleaseADB();
+
+                if (m_instance && m_attrOrdinal >= 0) {
+                    //the value is copied to the attribute, next read will get it from there
+                    sdaiPutAttr(m_instance, getAttrDefinition(), sdaiADB, adb);
+                    sdaiDeleteADB(adb);
+                }
+                else {
+                    m_adb = adb;
+                    m_adbRef = ADBPool::Get().Own(adb);
+                }
+            }
+        }
+
+        //definition of the attribute holding the value, resolved once per model
+        SdaiAttr getAttrDefinition() { return (m_attrOrdinal >= 0) ? AttributeCache::Get(m_instance, m_attrOrdinal) : NULL; }
+
+        //name of the attribute holding the value, for by-name functions of the engine
+        TextValue getAttrName() { IntValue count = 0; return (m_attrOrdinal >= 0) ? SchemaAttributes(count)[m_attrOrdinal].attrName : NULL; }
+
+        void ReleaseADB()
+        {
+            if (m_adbRef) {
+                ADBPool::Get().Release(m_adbRef);
+                m_adbRef = NULL;
+            }
+            m_adb = NULL;
+            m_typePath = -2;
+        }
+
+        //
+        IntValue ADBTypePath()
+        {
+            if (m_outerSelect) {
+                return m_outerSelect->ADBTypePath();
+            }
+
+            void* adb = ADB();
+            if (m_typePath == -2) {
+                m_typePath = adb ? TypePathTable::Get(sdaiGetADBTypePath(adb, 0)) : -1;
+            }
+            return m_typePath;
+        }
+
+        //
+        bool IsTypePath(IntValue typePath)
+        {
+            return typePath < 0 || typePath == ADBTypePath();
+        }
+
+        //
+        void* CreateADB(IntValue sdaiType, const void* value, IntValue typePath)
+        {
+            void* adb = sdaiCreateADB(sdaiType, value);
+            sdaiPutADBTypePath(adb, 1, TypePathTable::Name(typePath));
+            return adb;
+        }
+
+        //
+        template <typename T> Nullable<T> getSimpleValue(IntValue typePath, IntValue sdaiType)
+        {
+            Nullable<T> ret;
+            if (void* adb = ADB()) {
+                if (IsTypePath(typePath)) {
+                    T val = (T) 0;
+                    if (sdaiGetADBValue(adb, sdaiType, &val)) {
+                        ret = val;
+                    }
+                }
+            }
+            return ret;
+        }
+
+        //
+        template <typename T> void putSimpleValue(IntValue typePath, IntValue sdaiType, T value)
+        {
+            SetADB(CreateADB(sdaiType, &value, typePath));
+        }
+
+        //
+        TextValue getTextValue(IntValue typePath, IntValue sdaiType)
+        {
+            TextValue ret = NULL;
+            if (void* adb = ADB()) {
+                if (IsTypePath(typePath)) {
+                    if (!sdaiGetADBValue(adb, sdaiType, &ret)) {
+                        ret = NULL;
+                    }
+                }
+            }
+            return ret;
+        }
+
+        //
+        void putTextValue(IntValue typePath, IntValue sdaiType, TextValue value)
+        {
+            SetADB(CreateADB(sdaiType, value, typePath));
+        }
+
+        //
+        int getEnumerationValue(IntValue typePath, const EnumerationHash& rEnumHash)
+        {
+            int ret = -1;
+            if (void* adb = ADB()) {
+                if (IsTypePath(typePath)) {
+                    TextValue value = NULL;
+                    if (sdaiGetADBValue(adb, sdaiENUM, &value)) {
+                        ret = EnumerationNameToIndex(rEnumHash, value);
+                    }
+                }
+            }
+            return ret;
+        }
+
+        //
+        void putEnumerationValue(IntValue typePath, TextValue value)
+        {
+            SetADB(CreateADB(sdaiENUM, value, typePath));
+        }
+
+        //
+        SdaiInstance getEntityInstance(IntValue entityOrdinal)
+        {
+            SdaiInstance ret = 0;
+            if (auto adb = ADB()) {
+                SdaiInstance inst = 0;
+                if (sdaiGetADBValue(adb, sdaiINSTANCE, &inst) && inst) {
+                    if (entityOrdinal < 0 || EntityTypeTable::IsKindOf(inst, entityOrdinal)) {
+                        ret = inst;
+                    }
+                }
+            }
+            return ret;
+        }
+
+        //
+        void putEntityInstance(IntValue entityOrdinal, SdaiInstance inst)
+        {
+            if (inst == 0 || EntityTypeTable::IsKindOf(inst, entityOrdinal)) {
+                auto adb = sdaiCreateADB(sdaiINSTANCE, (void*) inst);
+                SetADB(adb);
+            }
+            else {
+                assert(0);
+            }
+        }
+
+        //
+        SdaiAggr getAggrValue(IntValue typePath)
+        {
+            SdaiAggr ret = NULL;
+            if (void* adb = ADB()) {
+                if (IsTypePath(typePath)) {
+                    if (!sdaiGetADBValue(adb, sdaiAGGR, &ret)) {
+                        ret = NULL;
+                    }
+                }
+            }
+            return ret;
+        }
+
+        //
+        void putAggrValue(IntValue typePath, SdaiAggr value)
+        {
+            SetADB(CreateADB(sdaiAGGR, value, typePath));
+        }
+
+        //
+        bool IsADBType(IntValue typePath)
+        {
+            return ADB() && typePath == ADBTypePath();
+        }
+
+        bool IsADBEntity(IntValue entityOrdinal)
+        {
+            if (void* adb = ADB()) {
+                IntValue inst = 0;
+                if (sdaiGetADBValue(adb, sdaiINSTANCE, &inst) && inst) {
+                    if (EntityTypeTable::IsKindOf(inst, entityOrdinal)) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+    };
+
+    /// <summary>
+    /// Aggregations templates
+    /// </summary>
+    /// 
+
+    template <typename T> using AggrContainer = RDF_EXPRESS_AGGREGATION_CONTAINER<T>;
+
+    //
+    // Pre-sizes containers that support reserve(), no-op for others
+    //
+    template <typename TList> auto ReserveAggrImpl(TList& lst, IntValue count, int) -> decltype(lst.reserve(0), void())
+    {
+        lst.reserve(lst.size() + (size_t) count);
+    }
+
+    template <typename TList> void ReserveAggrImpl(TList&, IntValue, long) {}
+
+    template <typename TList> void ReserveAggr(TList& lst, IntValue count) { ReserveAggrImpl(lst, count, 0); }
+
+    template <typename TArrayElem, typename TList> void ArrayToList(TArrayElem arrayElems[], IntValue numOfElems, TList& lst)
+    {
+        ReserveAggr(lst, numOfElems);
+        for (IntValue i = 0; i < numOfElems; i++) {
+            lst.push_back(arrayElems[i]);
+        }
+    }
+
+    //
+    // Iterable view of C array, lets serializers write the array without copying it to a list
+    //
+    template <typename TArrayElem> struct ArrayRange
+    {
+        TArrayElem* first;
+        size_t      count;
+
+        TArrayElem* begin() const { return first; }
+        TArrayElem* end() const { return first + count; }
+    };
+
+    /// <summary>
+    /// Reads aggregation of aggregations of numbers into flat buffer, inner aggregation i goes to buffer[i * stride]...buffer[i * stride + stride - 1]
+    /// Shorter inner aggregations are padded with 0, longer ones are truncated, inner aggregations that do not fit the buffer are not read
+    /// Returns number of inner aggregations, call with NULL buffer to get the number only
+    /// </summary>
+    template <typename TElem, typename TSdaiElem, IntValue sdaiType> IntValue FlatAggrFromAttr(SdaiInstance instance, SdaiAttr attr, TElem* buffer, size_t size, size_t stride)
+    {
+        assert(sdaiType == sdaiINTEGER || sdaiType == sdaiREAL);
+
+        SdaiAggr aggr = NULL;
+        if (!sdaiGetAttr(instance, attr, sdaiAGGR, &aggr) || !aggr) {
+            return 0;
+        }
+
+        IntValue cnt = sdaiGetMemberCount(aggr);
+        if (!buffer || !stride) {
+            return cnt;
+        }
+
+        IntValue rows = (size / stride < (size_t) cnt) ? (IntValue) (size / stride) : cnt;
+        for (IntValue i = 0; i < rows; i++) {
+            SdaiAggr nested = NULL;
+            sdaiGetAggrByIndex(aggr, i, sdaiAGGR, &nested);
+            IntValue nestedCnt = nested ? sdaiGetMemberCount(nested) : 0;
+
+            TElem* row = buffer + i * stride;
+            for (size_t j = 0; j < stride; j++) {
+                TSdaiElem val = 0;
+                if ((IntValue) j < nestedCnt) {
+                    sdaiGetAggrByIndex(nested, (IntValue) j, sdaiType, &val);
+                }
+                row[j] = (TElem) val;
+            }
+        }
+
+        return cnt;
+    }
+
+    //
+    // Reads all inner aggregations into flat vector, see FlatAggrFromAttr
+    //
+    template <typename TElem, typename TSdaiElem, IntValue sdaiType> IntValue FlatAggrFromAttr(SdaiInstance instance, SdaiAttr attr, std::vector<TElem>& flat, size_t stride)
+    {
+        IntValue cnt = FlatAggrFromAttr<TElem, TSdaiElem, sdaiType>(instance, attr, (TElem*) NULL, 0, stride);
+        flat.resize(cnt * stride);
+        return FlatAggrFromAttr<TElem, TSdaiElem, sdaiType>(instance, attr, flat.data(), flat.size(), stride);
+    }
+
+    /// <summary>
+    /// Writes flat buffer as aggregation of aggregations of numbers, buffer[i * stride]...buffer[i * stride + stride - 1] go to inner aggregation i
+    /// Trailing elements that do not fill whole inner aggregation are not written
+    /// </summary>
+    template <typename TElem, typename TSdaiElem, IntValue sdaiType> SdaiAggr FlatAggrToAttr(SdaiInstance instance, SdaiAttr attr, const TElem* buffer, size_t size, size_t stride)
+    {
+        assert(sdaiType == sdaiINTEGER || sdaiType == sdaiREAL);
+
+        SdaiAggr aggr = sdaiCreateAggr(instance, attr);
+        if (!buffer || !stride) {
+            return aggr;
+        }
+
+        size_t rows = size / stride;
+        for (size_t i = 0; i < rows; i++) {
+            SdaiAggr nested = sdaiCreateAggr(instance, NULL);
+            const TElem* row = buffer + i * stride;
+            for (size_t j = 0; j < stride; j++) {
+                TSdaiElem val = (TSdaiElem) row[j];
+                sdaiAppend(nested, sdaiType, &val);
+            }
+            sdaiAppend(aggr, sdaiAGGR, nested);
+        }
+
+        return aggr;
+    }
+
+    /// <summary>
+    /// Base of aggregation serializers, TSerializer is the derived serializer class
+    /// Serializers have no state and no virtual methods, nested serializers are called directly and can be inlined into the loops of outer ones
+    /// </summary>
+    template <typename TList, typename TSerializer> class AggrSerializer
+    {
+    public:
+        //
+        static void FromAttr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+        {
+            SdaiAggr aggr = NULL;
+            sdaiGetAttr(instance, attr, sdaiAGGR, &aggr);
+            if (aggr) {
+                TSerializer::FromSdaiAggr(lst, instance, aggr);
+            }
+        }
+    };
+
+    /// <summary>
+    /// 
+    /// </summary>
+    template <typename TList, typename TElem, IntValue sdaiType> class AggrSerializerSimple : public AggrSerializer<TList, AggrSerializerSimple<TList, TElem, sdaiType>>
+    {
+        static_assert(sdaiType == sdaiINTEGER || sdaiType == sdaiREAL || sdaiType == sdaiBOOLEAN, "simple type");
+
+    public:
+
+        //
+        static void FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr);
+
+        //
+        static SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr);
+
+        //TRange may be TList or any range of convertible elements
+        template <typename TRange> static SdaiAggr RangeToSdaiAggr(TRange& range, SdaiInstance instance, SdaiAttr attr)
+        {
+            SdaiAggr aggr = sdaiCreateAggr(instance, attr);
+            for (auto const& v : range) {
+                TElem val = v;
+                sdaiAppend(aggr, sdaiType, &val);
+            }
+            return aggr;
+        }
+    };
+
+    template <typename TList, typename TElem, IntValue sdaiType> void AggrSerializerSimple<TList, TElem, sdaiType>::FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr)
+    {
+        IntValue  cnt = sdaiGetMemberCount(aggr);
+        ReserveAggr(lst, cnt);
+        for (IntValue i = 0; i < cnt; i++) {
+            TElem val = 0;
+            sdaiGetAggrByIndex(aggr, i, sdaiType, &val);
+            lst.push_back(val);
+        }
+    }
+
+    template <typename TList, typename TElem, IntValue sdaiType> SdaiAggr AggrSerializerSimple<TList, TElem, sdaiType>::ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+    {
+        return RangeToSdaiAggr(lst, instance, attr);
+    }
+
+    /// <summary>
+    /// 
+    /// </summary>
+    template <typename TList, typename TElem, IntValue sdaiType> class AggrSerializerText : public AggrSerializer<TList, AggrSerializerText<TList, TElem, sdaiType>>
+    {
+        static_assert(sdaiType == sdaiSTRING || sdaiType == sdaiBINARY, "text type");
+
+    public:
+
+        static void FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr);
+
+        static SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr);
+
+        //TRange may be TList or any range of convertible elements
+        template <typename TRange> static SdaiAggr RangeToSdaiAggr(TRange& range, SdaiInstance instance, SdaiAttr attr)
+        {
+            SdaiAggr aggr = sdaiCreateAggr(instance, attr);
+            for (auto& val : range) {
+                TextValue v = val;
+                sdaiAppend(aggr, sdaiType, v);
+            }
+            return aggr;
+        }
+    };
+
+    template <typename TList, typename TElem, IntValue sdaiType> void AggrSerializerText<TList, TElem, sdaiType>::FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr)
+    {
+        IntValue  cnt = sdaiGetMemberCount(aggr);
+        ReserveAggr(lst, cnt);
+        for (IntValue i = 0; i < cnt; i++) {
+            TextValue val;
+            sdaiGetAggrByIndex(aggr, i, sdaiType, &val);
+            lst.push_back(val);
+        }
+    }
+
+    template <typename TList, typename TElem, IntValue sdaiType> SdaiAggr AggrSerializerText<TList, TElem, sdaiType>::ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+    {
+        return RangeToSdaiAggr(lst, instance, attr);
+    }
+
+    /// <summary>
+    /// 
+    /// </summary>
+    template <typename TList, typename TElem> class AggrSerializerInstance : public AggrSerializer<TList, AggrSerializerInstance<TList, TElem>>
+    {
+    public:
+        //
+        static void FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr);
+
+        //
+        static SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr);
+
+        //TRange may be TList or any range of convertible elements
+        template <typename TRange> static SdaiAggr RangeToSdaiAggr(TRange& range, SdaiInstance instance, SdaiAttr attr)
+        {
+            auto aggr = sdaiCreateAggr(instance, attr);
+            for (auto& val : range) {
+                SdaiInstance v = val;
+                sdaiAppend(aggr, sdaiINSTANCE, (void*) v);
+            }
+            return aggr;
+        }
+    };
+
+    template <typename TList, typename TElem> void AggrSerializerInstance<TList, TElem>::FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr)
+    {
+        auto  cnt = sdaiGetMemberCount(aggr);
+        ReserveAggr(lst, cnt);
+        for (IntValue i = 0; i < cnt; i++) {
+            SdaiInstance val = 0;
+            sdaiGetAggrByIndex(aggr, i, sdaiINSTANCE, &val);
+            TElem elem(val);
+            if (val) {
+                lst.push_back(val);
+            }
+        }
+    }
+
+    template <typename TList, typename TElem> SdaiAggr AggrSerializerInstance<TList, TElem>::ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+    {
+        return RangeToSdaiAggr(lst, instance, attr);
+    }
+
+
+    /// <summary>
+    /// 
+    /// </summary>
+    template <typename TList, typename TElem, const EnumerationHash* rEnumHash, IntValue sdaiType> class AggrSerializerEnum : public AggrSerializer<TList, AggrSerializerEnum<TList, TElem, rEnumHash, sdaiType>>
+    {
+        static_assert(sdaiType == sdaiENUM || sdaiType == sdaiLOGICAL, "enumeration type");
+
+    public:
+
+        //
+        static void FromSdaiAggr(TList& lst, SdaiInstance /*instance*/, SdaiAggr aggr);
+
+        //
+        static SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr);
+
+        //TRange may be TList or any range of convertible elements
+        template <typename TRange> static SdaiAggr RangeToSdaiAggr(TRange& range, SdaiInstance instance, SdaiAttr attr)
+        {
+            SdaiAggr aggr = sdaiCreateAggr(instance, attr);
+            for (auto const& val : range) {
+                TextValue value = rEnumHash->values[(IntValue) val];
+                sdaiAppend(aggr, sdaiType, value);
+            }
+            return aggr;
+        }
+    };
+
+    template <typename TList, typename TElem, const EnumerationHash* rEnumHash, IntValue sdaiType> void AggrSerializerEnum<TList, TElem, rEnumHash, sdaiType>::FromSdaiAggr(TList& lst, SdaiInstance /*instance*/, SdaiAggr aggr)
+    {
+        IntValue  cnt = sdaiGetMemberCount(aggr);
+        ReserveAggr(lst, cnt);
+        for (IntValue i = 0; i < cnt; i++) {
+            TextValue value = NULL;
+            sdaiGetAggrByIndex(aggr, i, sdaiType, &value);
+            int val = EnumerationNameToIndex(*rEnumHash, value);
+            if (val >= 0) {
+                lst.push_back((TElem) val);
+            }
+        }
+    }
+
+    template <typename TList, typename TElem, const EnumerationHash* rEnumHash, IntValue sdaiType> SdaiAggr AggrSerializerEnum<TList, TElem, rEnumHash, sdaiType>::ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+    {
+        return RangeToSdaiAggr(lst, instance, attr);
+    }
+
+    /// <summary>
+    /// 
+    /// </summary>
+    template <typename TList, typename TNestedAggr, typename TNestedSerializer> class AggrSerializerAggr : public AggrSerializer<TList, AggrSerializerAggr<TList, TNestedAggr, TNestedSerializer>>
+    {
+    public:
+        //
+        static void FromSdaiAggr(TList& lst, SdaiInstance instance, SdaiAggr aggr);
+
+        //
+        static SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr);
+
+        //TRange may be TList or any range of convertible elements
+        template <typename TRange> static SdaiAggr RangeToSdaiAggr(TRange& range, SdaiInstance instance, SdaiAttr attr)
+        {
+            SdaiAggr aggr = sdaiCreateAggr(instance, attr);
+            for (auto& val : range) {
+                SdaiAggr nested = TNestedSerializer::RangeToSdaiAggr(val, instance, NULL);
+                sdaiAppend(aggr, sdaiAGGR, nested);
+            }
+            return aggr;
+        }
+    };
+
+    template <typename TList, typename TNestedAggr, typename TNestedSerializer> void AggrSerializerAggr<TList, TNestedAggr, TNestedSerializer>::FromSdaiAggr(TList& lst, SdaiInstance instance, SdaiAggr aggr)
+    {
+        IntValue  cnt = sdaiGetMemberCount(aggr);
+        ReserveAggr(lst, cnt);
+        for (IntValue i = 0; i < cnt; i++) {
+            SdaiAggr nested = 0;
+            sdaiGetAggrByIndex(aggr, i, sdaiAGGR, &nested);
+            if (nested) {
+                lst.push_back(TNestedAggr());
+                TNestedSerializer::FromSdaiAggr(lst.back(), instance, nested);
+            }
+        }
+    }
+
+    template <typename TList, typename TNestedAggr, typename TNestedSerializer> SdaiAggr AggrSerializerAggr<TList, TNestedAggr, TNestedSerializer>::ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+    {
+        return RangeToSdaiAggr(lst, instance, attr);
+    }
+
+    template <typename TList, typename TElem> class AggrSerializerSelect : public AggrSerializer<TList, AggrSerializerSelect<TList, TElem>>
+    {
+    public:
+        //
+        static void FromSdaiAggr(TList& lst, SdaiInstance instance, SdaiAggr aggr);
+
+        //
+        static SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr);
+
+        //TRange may be TList or any range of convertible elements
+        template <typename TRange> static SdaiAggr RangeToSdaiAggr(TRange& range, SdaiInstance instance, SdaiAttr attr)
+        {
+            SdaiAggr aggr = sdaiCreateAggr(instance, attr);
+            for (auto& val : range) {
+                void* adb = val.ADB();
+                if (adb) {
+                    sdaiAppend(aggr, sdaiADB, adb);
+                }
+            }
+            return aggr;
+        }
+    };
+
+    template <typename TList, typename TElem> void AggrSerializerSelect<TList, TElem>::FromSdaiAggr(TList& lst, SdaiInstance instance, SdaiAggr aggr)
+    {
+        IntValue  cnt = sdaiGetMemberCount(aggr);
+        ReserveAggr(lst, cnt);
+        for (IntValue i = 0; i < cnt; i++) {
+            void* adb = 0;
+            sdaiGetAggrByIndex(aggr, i, sdaiADB, &adb);
+            if (adb) {
+                lst.push_back(TElem(instance, -1, adb));
+            }
+        }
+    }
+
+    template <typename TList, typename TElem> SdaiAggr AggrSerializerSelect<TList, TElem>::ToSdaiAggr(TList& lst, SdaiInstance instance, SdaiAttr attr)
+    {
+        return RangeToSdaiAggr(lst, instance, attr);
+    }
+
+
+    /// <summary>
+    /// Access to attribute by ordinal, specialized for each attribute of generated entity classes, see Entity::GetAttr
+    /// </summary>
+    template <IntValue attrOrdinal> struct AttrAccessor;
+
+    template <typename TEntity, IntValue entityOrdinal_> struct AttrAccessorOf
+    {
+        typedef TEntity EntityType;
+        static constexpr IntValue entityOrdinal = entityOrdinal_;
+    };
+
+    //
+    // Specialization of AttrAccessor forwarding to get_ and put_ accessors of the attribute
+    // Define RDF_EXPRESS_NO_ATTR_ACCESSORS before including the header to skip them and save compile time when GetAttr<ordinal> and PutAttr<ordinal> are not used
+    //
+#ifdef RDF_EXPRESS_NO_ATTR_ACCESSORS
+#define RDF_EXPRESS_ATTR_ACCESSOR(attrOrdinal, entity, entityOrdinal, name)
+#else
+#define RDF_EXPRESS_ATTR_ACCESSOR(attrOrdinal, entity, entityOrdinal, name)                                                                                                     \
+    template <> struct AttrAccessor<attrOrdinal> : AttrAccessorOf<entity, entityOrdinal>                                                                                        \
+    {                                                                                                                                                                           \
+        template <typename TEntity, typename... TArgs> static auto Get(TEntity e, TArgs&&... args) -> decltype(e.get_##name(std::forward<TArgs>(args)...)) { return e.get_##name(std::forward<TArgs>(args)...); } \
+        template <typename TEntity, typename... TArgs> static auto Put(TEntity e, TArgs&&... args) -> decltype(e.put_##name(std::forward<TArgs>(args)...)) { return e.put_##name(std::forward<TArgs>(args)...); } \
+    };
+#endif
+
+    /// <summary>
+    /// Provides utility methods to interact with a generic SDAI instance
+    /// You also can use object of this class instead of SdaiInstance handle in any place where the handle is required
+    /// </summary>
+    class Entity
+    {
+    protected:
+        SdaiInstance m_instance;
+
+        Entity() : m_instance(0) {}
+
+    public:
+        Entity(SdaiInstance instance, TextValue entityName, IntValue entityOrdinal = -1)
+            : m_instance(KindOf(instance, entityName, entityOrdinal))
+        {}
+
+
+        /// <summary>
+        /// Conversion  to instance handle, so the object of the class can be used anywhere where a handle required
+        /// </summary>
+        operator SdaiInstance() const { return m_instance; }
+
+        /// <summary>
+        /// Wraps instance known to be of TEntity or its sub-entity, without kind-of check
+        /// </summary>
+        template <typename TEntity> static TEntity Unchecked(SdaiInstance instance)
+        {
+            TEntity entity;
+            static_cast<Entity&>(entity).m_instance = instance;
+            return entity;
+        }
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, entity classes declare attr with their attributes and attributes of supertypes
+        /// </summary>
+        struct attr {};
+
+        /// <summary>
+        /// Access to attribute by constexpr ordinal: door.GetAttr<IfcDoor::attr::OverallHeight>() is door.get_OverallHeight(), PutAttr is put_OverallHeight
+        /// Arguments and result are the ones of the accessors, so schema-generic code can go over attributes at compile time
+        /// </summary>
+        template <IntValue attrOrdinal, typename... TArgs> auto GetAttr(TArgs&&... args) -> decltype(AttrAccessor<attrOrdinal>::Get(std::declval<typename AttrAccessor<attrOrdinal>::EntityType>(), std::forward<TArgs>(args)...))
+        {
+            typedef AttrAccessor<attrOrdinal> Accessor;
+            assert(!m_instance || EntityTypeTable::IsKindOf(m_instance, Accessor::entityOrdinal));
+            return Accessor::Get(Unchecked<typename Accessor::EntityType>(m_instance), std::forward<TArgs>(args)...);
+        }
+
+        template <IntValue attrOrdinal, typename... TArgs> auto PutAttr(TArgs&&... args) -> decltype(AttrAccessor<attrOrdinal>::Put(std::declval<typename AttrAccessor<attrOrdinal>::EntityType>(), std::forward<TArgs>(args)...))
+        {
+            typedef AttrAccessor<attrOrdinal> Accessor;
+            assert(!m_instance || EntityTypeTable::IsKindOf(m_instance, Accessor::entityOrdinal));
+            return Accessor::Put(Unchecked<typename Accessor::EntityType>(m_instance), std::forward<TArgs>(args)...);
+        }
+
+        /// <summary>
+        /// SDAI access to attribute by ordinal known at run time, attribute definition is cached by ordinal, so there is no name lookup
+        /// </summary>
+        void* GetAttr(IntValue attrOrdinal, SdaiPrimitiveType valueType, void* value) { return sdaiGetAttr(m_instance, getAttrDefinition(attrOrdinal), valueType, value); }
+        void PutAttr(IntValue attrOrdinal, SdaiPrimitiveType valueType, const void* value) { sdaiPutAttr(m_instance, getAttrDefinition(attrOrdinal), valueType, value); }
+
+    protected:
+        //
+        // Returns instance if it is of entityName (or entityOrdinal when entityName is NULL) or its sub-entity, 0 otherwise
+        static SdaiInstance KindOf(SdaiInstance instance, TextValue entityName, IntValue entityOrdinal)
+        {
+            if (instance != 0) {
+                if (entityName != NULL) {
+                    if (!sdaiIsKindOfBN(instance, entityName)) {
+                        return 0;
+                    }
+                }
+                else if (entityOrdinal >= 0) {
+                    if (!EntityTypeTable::IsKindOf(instance, entityOrdinal)) {
+                        return 0;
+                    }
+                }
+            }
+            return instance;
+        }
+
+        //
+        //
+        SdaiAttr getAttrDefinition(IntValue attrOrdinal)
+        {
+            return AttributeCache::Get(m_instance, attrOrdinal);
+        }
+
+        //
+        //
+        int getENUM(IntValue attrOrdinal, const EnumerationHash& rEnumHash)
+        {
+            TextValue value = NULL;
+            sdaiGetAttr(m_instance, getAttrDefinition(attrOrdinal), sdaiENUM, (void*) &value);
+            return EnumerationNameToIndex(rEnumHash, value);
+        }
+    };
+
+    /// <summary>
+    /// Input range of TEntity objects over entity extent of a model, iterated by sdaiCreateIterator/sdaiNext
+    /// Members of the extent are known to be of the entity, so objects are created without kind-of check
+    /// </summary>
+    template <typename TEntity> class ExtentRange
+    {
+    public:
+        class iterator
+        {
+        public:
+            typedef std::input_iterator_tag iterator_category;
+            typedef TEntity                 value_type;
+            typedef ptrdiff_t               difference_type;
+            typedef const TEntity*          pointer;
+            typedef TEntity                 reference;
+
+            iterator(SdaiIterator it = NULL) : m_iterator(it), m_current(0) { if (m_iterator) { ++(*this); } }
+
+            TEntity operator*() const { return Entity::Unchecked<TEntity>(m_current); }
+            SdaiInstance instance() const { return m_current; }
+
+            iterator& operator++()
+            {
+                m_current = 0;
+                if (sdaiNext(m_iterator)) {
+                    sdaiGetAggrByIterator(m_iterator, sdaiINSTANCE, &m_current);
+                }
+                if (!m_current) {
+                    m_iterator = NULL;
+                }
+                return *this;
+            }
+            iterator operator++(int) { iterator prev = *this; ++(*this); return prev; }
+
+            bool operator==(const iterator& other) const { return m_iterator == other.m_iterator && m_current == other.m_current; }
+            bool operator!=(const iterator& other) const { return !(*this == other); }
+
+        private:
+            SdaiIterator m_iterator;
+            SdaiInstance m_current;
+        };
+
+    public:
+        ExtentRange(SdaiModel model, IntValue entityOrdinal, bool withSubtypes)
+            : m_extent(NULL), m_iterator(NULL)
+        {
+            IntValue count = 0;
+            SdaiEntity entity = sdaiGetEntity(model, SchemaEntities(count)[entityOrdinal].name);
+            if (entity) {
+                m_extent = withSubtypes ? xxxxGetEntityAndSubTypesExtent(model, entity) : sdaiGetEntityExtent(model, entity);
+            }
+        }
+
+        ExtentRange(ExtentRange&& other) : m_extent(other.m_extent), m_iterator(other.m_iterator) { other.m_iterator = NULL; }
+        ExtentRange(const ExtentRange&) = delete;
+        ExtentRange& operator=(const ExtentRange&) = delete;
+
+        ~ExtentRange() { if (m_iterator) { sdaiDeleteIterator(m_iterator); } }
+
+        //single pass, calling begin() again restarts the iteration
+        iterator begin()
+        {
+            if (!m_extent) {
+                return iterator();
+            }
+            if (m_iterator) {
+                sdaiBeginning(m_iterator);
+            }
+            else {
+                m_iterator = sdaiCreateIterator(m_extent);
+            }
+            return iterator(m_iterator);
+        }
+        iterator end() { return iterator(); }
+
+        //number of instances, to reserve containers before iteration
+        size_t size() const { return m_extent ? (size_t) sdaiGetMemberCount(m_extent) : 0; }
+        bool empty() const { return size() == 0; }
+
+        SdaiAggr extent() const { return m_extent; }
+
+    private:
+        SdaiAggr        m_extent;
+        SdaiIterator    m_iterator;
+    };
+    //## TEMPLATE: IfcTables
+
+    /// <summary>
+    /// IfcGloballyUniqueId decoded from 22 characters of IFC base64 to 128 bits
+    /// </summary>
+    struct GlobalIdKey
+    {
+        uint64_t hi;
+        uint64_t lo;
+
+        bool operator==(const GlobalIdKey& other) const { return hi == other.hi && lo == other.lo; }
+        bool operator!=(const GlobalIdKey& other) const { return !(*this == other); }
+
+        /// <summary>
+        /// Returns false if the text is not 22 characters of 0-9A-Za-z_$ with the first one 0-3
+        /// </summary>
+        static bool Decode(TextValue text, GlobalIdKey& key)
+        {
+            key.hi = key.lo = 0;
+            if (!text) {
+                return false;
+            }
+            for (int i = 0; i < 22; i++) {
+                int digit = Digit(text[i]);
+                if (digit < 0 || (i == 0 && digit > 3)) {
+                    return false;
+                }
+                key.hi = (key.hi << 6) | (key.lo >> 58);
+                key.lo = (key.lo << 6) | (uint64_t) digit;
+            }
+            return text[22] == 0;
+        }
+
+    private:
+        //table lookup, characters of GlobalIds are random so comparisons would mispredict
+        static int Digit(char c)
+        {
+            struct Digits
+            {
+                signed char value[256];
+
+                Digits()
+                {
+                    static const char digits[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz_$";
+                    memset(value, -1, sizeof(value));
+                    for (int i = 0; i < 64; i++) {
+                        value[(unsigned char) digits[i]] = (signed char) i;
+                    }
+                }
+            };
+            static const Digits table;
+            return table.value[(unsigned char) c];
+        }
+    };
+
+    /// <summary>
+    /// Open addressing table of instances of a model by decoded GlobalId, base of generated GlobalIdIndex
+    /// Live tables are updated by put_GlobalId of the wrappers, lookups are not synchronized with puts from other threads
+    /// </summary>
+    class GlobalIdTable
+    {
+    public:
+        GlobalIdTable(const GlobalIdTable&) = delete;
+        GlobalIdTable& operator=(const GlobalIdTable&) = delete;
+
+        SdaiModel Model() const { return m_model; }
+
+        /// <summary>
+        /// Number of indexed instances
+        /// </summary>
+        size_t size() const { return m_count; }
+
+        /// <summary>
+        /// Instances not indexed because GlobalId is not valid or is already indexed for another instance
+        /// </summary>
+        size_t Skipped() const { return m_skipped; }
+
+        SdaiInstance FindInstance(const GlobalIdKey& key) const
+        {
+            size_t mask = m_slots.size() - 1;
+            for (size_t i = Home(key, mask); ; i = (i + 1) & mask) {
+                const Slot& slot = m_slots[i];
+                if (slot.instance == 0) {
+                    return 0;
+                }
+                if (slot.instance != TOMBSTONE && slot.key == key) {
+                    return slot.instance;
+                }
+            }
+        }
+
+        SdaiInstance FindInstance(TextValue globalId) const
+        {
+            GlobalIdKey key;
+            return GlobalIdKey::Decode(globalId, key) ? FindInstance(key) : 0;
+        }
+
+        //
+        // put_GlobalId calls OnPut before the put when any table is alive
+        static bool Active() { return GetRegistry().count.load(std::memory_order_acquire) != 0; }
+
+        static void OnPut(SdaiInstance instance, TextValue oldGlobalId, TextValue newGlobalId)
+        {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            SdaiModel model = sdaiGetInstanceModel(instance);
+            for (auto table : registry.tables) {
+                if (table->m_model == model) {
+                    table->Remove(oldGlobalId, instance);
+                    table->Insert(newGlobalId, instance);
+                }
+            }
+        }
+
+    protected:
+        explicit GlobalIdTable(SdaiModel model) : m_model(model), m_count(0), m_used(0), m_skipped(0), m_slots(16)
+        {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.tables.push_back(this);
+            registry.count++;
+        }
+
+        ~GlobalIdTable()
+        {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (auto it = registry.tables.begin(); it != registry.tables.end(); it++) {
+                if (*it == this) {
+                    registry.tables.erase(it);
+                    registry.count--;
+                    break;
+                }
+            }
+        }
+
+        //
+        // Reads GlobalIds of instances on the calling thread, the engine is not called from other threads,
+        // then threads decode their parts of the copied texts and the keys are inserted
+        template <typename TGetGlobalId> void Build(const std::vector<SdaiInstance>& instances, TGetGlobalId getGlobalId, unsigned threads)
+        {
+            const size_t TEXT = 23; //22 characters and terminating zero, other texts are copied as empty
+
+            size_t count = instances.size();
+            std::vector<char> texts(count * TEXT);
+            std::vector<GlobalIdKey> keys(count);
+            std::vector<char> valid(count);
+
+            for (size_t i = 0; i < count; i++) {
+                TextValue globalId = getGlobalId(instances[i]);
+                if (globalId && strnlen(globalId, TEXT) < TEXT) {
+                    memcpy(&texts[i * TEXT], globalId, strlen(globalId));
+                }
+            }
+
+            auto decode = [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++) {
+                    valid[i] = GlobalIdKey::Decode(&texts[i * TEXT], keys[i]);
+                }
+            };
+
+            if (threads == 0) {
+                threads = std::thread::hardware_concurrency();
+            }
+            if (threads > 1 && count >= 4096) {
+                std::vector<std::thread> workers;
+                size_t part = (count + threads - 1) / threads;
+                for (size_t begin = part; begin < count; begin += part) {
+                    workers.emplace_back(decode, begin, (begin + part < count) ? begin + part : count);
+                }
+                decode(0, part);
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+            }
+            else {
+                decode(0, count);
+            }
+
+            Rehash(count);
+            for (size_t i = 0; i < count; i++) {
+                if (!valid[i] || !Insert(keys[i], instances[i])) {
+                    m_skipped++;
+                }
+            }
+        }
+
+    private:
+        struct Slot
+        {
+            GlobalIdKey     key;
+            SdaiInstance    instance;   //0 for empty slot
+        };
+
+        struct Registry
+        {
+            std::mutex                      mutex;
+            std::vector<GlobalIdTable*>     tables;
+            std::atomic<int>                count;
+
+            Registry() : count(0) {}
+        };
+
+        static Registry& GetRegistry() { static Registry registry; return registry; }
+
+        static const SdaiInstance TOMBSTONE = -1;
+
+        static size_t Home(const GlobalIdKey& key, size_t mask)
+        {
+            uint64_t h = (key.lo ^ key.hi) * 0x9E3779B97F4A7C15ull;
+            return (size_t) (h ^ (h >> 32)) & mask;
+        }
+
+        bool Insert(const GlobalIdKey& key, SdaiInstance instance)
+        {
+            if ((m_used + 1) * 2 > m_slots.size()) {
+                Rehash(m_count + 1);
+            }
+            size_t mask = m_slots.size() - 1;
+            for (size_t i = Home(key, mask); ; i = (i + 1) & mask) {
+                Slot& slot = m_slots[i];
+                if (slot.instance == 0) {
+                    slot.key = key;
+                    slot.instance = instance;
+                    m_count++;
+                    m_used++;
+                    return true;
+                }
+                if (slot.instance != TOMBSTONE && slot.key == key) {
+                    return slot.instance == instance;
+                }
+            }
+        }
+
+        void Insert(TextValue globalId, SdaiInstance instance)
+        {
+            GlobalIdKey key;
+            if (!GlobalIdKey::Decode(globalId, key) || !Insert(key, instance)) {
+                m_skipped++;
+            }
+        }
+
+        void Remove(TextValue globalId, SdaiInstance instance)
+        {
+            GlobalIdKey key;
+            if (!GlobalIdKey::Decode(globalId, key)) {
+                return;
+            }
+            size_t mask = m_slots.size() - 1;
+            for (size_t i = Home(key, mask); m_slots[i].instance != 0; i = (i + 1) & mask) {
+                Slot& slot = m_slots[i];
+                if (slot.instance == instance && slot.key == key) {
+                    slot.instance = TOMBSTONE;
+                    m_count--;
+                    return;
+                }
+            }
+        }
+
+        //
+        // Size for count instances at most half full, drops tombstones
+        void Rehash(size_t count)
+        {
+            size_t size = 16;
+            while (size < count * 2) {
+                size *= 2;
+            }
+            std::vector<Slot> slots(size);
+            slots.swap(m_slots);
+            m_used = 0;
+            m_count = 0;
+            for (auto const& slot : slots) {
+                if (slot.instance != 0 && slot.instance != TOMBSTONE) {
+                    Insert(slot.key, slot.instance);
+                }
+            }
+        }
+
+    private:
+        SdaiModel           m_model;
+        size_t              m_count;
+        size_t              m_used;     //with tombstones
+        size_t              m_skipped;
+        std::vector<Slot>   m_slots;
+    };
+
+    /// <summary>
+    /// Index of TRoot instances of a model by GlobalId with O(1) Find, stays consistent with put_GlobalId of the wrappers
+    /// Construction reads GlobalIds on the calling thread and decodes them in threads (hardware concurrency by default)
+    /// </summary>
+    template <typename TRoot> class GlobalIdIndexOf : public GlobalIdTable
+    {
+    public:
+        explicit GlobalIdIndexOf(SdaiModel model, unsigned threads = 0) : GlobalIdTable(model)
+        {
+            std::vector<SdaiInstance> instances;
+            auto extent = TRoot::ExtentWithSubtypes(model);
+            instances.reserve(extent.size());
+            for (auto it = extent.begin(); it != extent.end(); ++it) {
+                instances.push_back(it.instance());
+            }
+            Build(instances, [](SdaiInstance instance) { return Entity::Unchecked<TRoot>(instance).get_GlobalId(); }, threads);
+        }
+
+        TRoot Find(TextValue globalId) const { return Entity::Unchecked<TRoot>(FindInstance(globalId)); }
+        TRoot Find(const GlobalIdKey& key) const { return Entity::Unchecked<TRoot>(FindInstance(key)); }
+    };
+
+    /// <summary>
+    /// Objectified relationship: entity, attribute of relating instance and attribute of related instance or aggregation of instances
+    /// </summary>
+    struct RelationshipAttributes
+    {
+        const char* entityName;
+        const char* relatingAttrName;
+        const char* relatedAttrName;
+    };
+
+    /// <summary>
+    /// Appends relating-related pairs of relationships in the extent of the relationship entity
+    /// skip(relationship) is called for each relationship of the extent, relationships it returns true for are not read;
+    /// relationshipOf, if not NULL, gets the relationship of each appended pair
+    /// </summary>
+    template <typename TSkip> void ReadRelationshipPairs(SdaiModel model, const RelationshipAttributes& attributes, std::vector<SdaiInstance>& relating, std::vector<SdaiInstance>& related, std::vector<SdaiInstance>* relationshipOf, TSkip&& skip)
+    {
+        SdaiEntity entity = sdaiGetEntity(model, attributes.entityName);
+        SdaiAttr relatingAttr = entity ? sdaiGetAttrDefinition(entity, attributes.relatingAttrName) : NULL;
+        SdaiAttr relatedAttr = entity ? sdaiGetAttrDefinition(entity, attributes.relatedAttrName) : NULL;
+        if (!relatingAttr || !relatedAttr) {
+            return;
+        }
+
+        SdaiAggr extent = xxxxGetEntityAndSubTypesExtent(model, entity);
+        IntValue count = extent ? sdaiGetMemberCount(extent) : 0;
+        for (IntValue i = 0; i < count; i++) {
+            SdaiInstance relationship = 0;
+            sdaiGetAggrByIndex(extent, i, sdaiINSTANCE, &relationship);
+            if (!relationship || skip(relationship)) {
+                continue;
+            }
+
+            SdaiInstance relatingInstance = 0;
+            if (!sdaiGetAttr(relationship, relatingAttr, sdaiINSTANCE, &relatingInstance) || !relatingInstance) {
+                continue;
+            }
+
+            SdaiAggr aggr = NULL;
+            if (sdaiGetAttr(relationship, relatedAttr, sdaiAGGR, &aggr) && aggr) {
+                IntValue members = sdaiGetMemberCount(aggr);
+                for (IntValue j = 0; j < members; j++) {
+                    SdaiInstance relatedInstance = 0;
+                    if (sdaiGetAggrByIndex(aggr, j, sdaiINSTANCE, &relatedInstance) && relatedInstance) {
+                        relating.push_back(relatingInstance);
+                        related.push_back(relatedInstance);
+                    }
+                }
+            }
+            else {
+                SdaiInstance relatedInstance = 0;
+                if (sdaiGetAttr(relationship, relatedAttr, sdaiINSTANCE, &relatedInstance) && relatedInstance) {
+                    relating.push_back(relatingInstance);
+                    related.push_back(relatedInstance);
+                }
+            }
+
+            if (relationshipOf) {
+                relationshipOf->resize(related.size(), relationship);
+            }
+        }
+    }
+
+    /// <summary>
+    /// Appends relating-related pairs of all relationships in the extent of the relationship entity
+    /// </summary>
+    inline void ReadRelationshipPairs(SdaiModel model, const RelationshipAttributes& attributes, std::vector<SdaiInstance>& relating, std::vector<SdaiInstance>& related)
+    {
+        ReadRelationshipPairs(model, attributes, relating, related, NULL, [](SdaiInstance) { return false; });
+    }
+
+    /// <summary>
+    /// Compressed rows of pairs: columns of row of instance are contiguous in order of pairs, the row is found by one hash lookup
+    /// </summary>
+    template <typename TColumn> class InstanceRows
+    {
+    public:
+        typedef ArrayRange<const TColumn> Row;
+
+        //row from[i] gets column to[i]
+        void Build(const std::vector<SdaiInstance>& from, const std::vector<TColumn>& to)
+        {
+            std::vector<uint32_t> rowOf(from.size());
+            m_rows.clear();
+            m_rows.reserve(from.size());
+            m_offsets.assign(1, 0);
+            for (size_t i = 0; i < from.size(); i++) {
+                auto row = m_rows.emplace(from[i], (uint32_t) m_offsets.size() - 1);
+                if (row.second) {
+                    m_offsets.push_back(0);
+                }
+                rowOf[i] = row.first->second;
+                m_offsets[rowOf[i] + 1]++;
+            }
+            for (size_t r = 1; r < m_offsets.size(); r++) {
+                m_offsets[r] += m_offsets[r - 1];
+            }
+
+            std::vector<uint32_t> next(m_offsets.begin(), m_offsets.end() - 1);
+            m_columns.resize(to.size());
+            for (size_t i = 0; i < to.size(); i++) {
+                m_columns[next[rowOf[i]]++] = to[i];
+            }
+        }
+
+        Row Get(SdaiInstance instance) const
+        {
+            auto row = m_rows.find(instance);
+            if (row == m_rows.end()) {
+                return Row{ NULL, 0 };
+            }
+            uint32_t begin = m_offsets[row->second];
+            return Row{ m_columns.data() + begin, m_offsets[row->second + 1] - begin };
+        }
+
+        //number of pairs
+        size_t size() const { return m_columns.size(); }
+
+    private:
+        std::unordered_map<SdaiInstance, uint32_t>  m_rows;
+        std::vector<uint32_t>                       m_offsets;  //columns of row r are m_columns[m_offsets[r]]...m_columns[m_offsets[r + 1] - 1]
+        std::vector<TColumn>                        m_columns;
+    };
+
+    /// <summary>
+    /// Relating and related instances of objectified relationships of a model, read by one pass over extent of each relationship
+    /// Pairs are kept as compressed rows in both directions, instances related to an instance are contiguous range found by one hash lookup
+    /// The table is a snapshot of the model, build it again after relationships are added or changed
+    /// </summary>
+    class RelationshipTable
+    {
+    public:
+        typedef ArrayRange<const SdaiInstance> Instances;
+
+        RelationshipTable(SdaiModel model, const RelationshipAttributes* relationships, int count) : m_model(model), m_relations(count)
+        {
+            for (int i = 0; i < count; i++) {
+                std::vector<SdaiInstance> relating;
+                std::vector<SdaiInstance> related;
+                ReadRelationshipPairs(model, relationships[i], relating, related);
+                m_relations[i].related.Build(relating, related);
+                m_relations[i].relating.Build(related, relating);
+            }
+        }
+
+        SdaiModel Model() const { return m_model; }
+
+        //related instances of relationships where the instance is relating one
+        Instances Related(int relationship, SdaiInstance relating) const { return m_relations[relationship].related.Get(relating); }
+
+        //relating instances of relationships where the instance is related one
+        Instances Relating(int relationship, SdaiInstance related) const { return m_relations[relationship].relating.Get(related); }
+
+        //number of relating-related pairs of the relationship
+        size_t Pairs(int relationship) const { return m_relations[relationship].related.size(); }
+
+    private:
+        struct Relation
+        {
+            InstanceRows<SdaiInstance>  related;    //rows of relating instances
+            InstanceRows<SdaiInstance>  relating;   //rows of related instances
+        };
+
+    private:
+        SdaiModel               m_model;
+        std::vector<Relation>   m_relations;
+    };
+
+    /// <summary>
+    /// Tree of spatial structure in flat array: roots are instances of root entity, children are related by aggregation relationship,
+    /// elements are related to their nodes by containment relationship
+    /// Nodes are in depth-first order, so nodes and elements of a subtree are contiguous; elements of a node are grouped by entity
+    /// Update reads relationships added since construction or previous Update and drops pairs of deleted relationships, it tells
+    /// relationships by instance handle; changes of attributes of relationships read before need new tree
+    /// Update walks the relationship extents and lays the whole tree out again, it only saves reading relationships read before
+    /// </summary>
+    class SpatialTreeTable
+    {
+    public:
+        typedef ArrayRange<const SdaiInstance> Instances;
+
+        struct Node
+        {
+            SdaiInstance    instance;
+            int             parent;             //-1 for root
+            int             firstChild;         //-1 for leaf
+            int             nextSibling;        //-1 for last child
+            int             subtreeEnd;         //nodes of subtree are [this node, subtreeEnd)
+            uint32_t        elementsBegin;      //elements of the node are [elementsBegin, elementsEnd)
+            uint32_t        elementsEnd;
+            uint32_t        subtreeElementsEnd; //elements of subtree are [elementsBegin, subtreeElementsEnd)
+        };
+
+        SdaiModel Model() const { return m_model; }
+
+        size_t size() const { return m_nodes.size(); }
+        const Node& operator[](int node) const { return m_nodes[node]; }
+        const std::vector<Node>& Nodes() const { return m_nodes; }
+
+        //node of the instance, -1 if the instance is not in the tree
+        int Find(SdaiInstance instance) const
+        {
+            auto it = m_nodeOf.find(instance);
+            return (it != m_nodeOf.end()) ? it->second : -1;
+        }
+
+        //node containing the element, -1 if the element is not contained in the tree
+        int Container(SdaiInstance element) const
+        {
+            auto it = m_containerOf.find(element);
+            return (it != m_containerOf.end()) ? it->second : -1;
+        }
+
+        //elements contained in the node
+        Instances Elements(int node) const { return Range(m_nodes[node].elementsBegin, m_nodes[node].elementsEnd); }
+
+        //elements of the node with exact entity, e.g. sdaiGetEntity(model, "IfcWall")
+        Instances Elements(int node, SdaiEntity entity) const
+        {
+            auto begin = m_elementTypes.begin() + m_nodes[node].elementsBegin;
+            auto end = m_elementTypes.begin() + m_nodes[node].elementsEnd;
+            auto range = std::equal_range(begin, end, entity);
+            return Range((uint32_t) (range.first - m_elementTypes.begin()), (uint32_t) (range.second - m_elementTypes.begin()));
+        }
+
+        //elements contained in the node and its descendants
+        Instances SubtreeElements(int node) const { return Range(m_nodes[node].elementsBegin, m_nodes[node].subtreeElementsEnd); }
+
+        void Update()
+        {
+            Read(m_aggregation, m_aggregations, false);
+            Read(m_containment, m_containments, true);
+            Layout();
+        }
+
+    protected:
+        SpatialTreeTable(SdaiModel model, TextValue rootEntityName, const RelationshipAttributes& aggregation, const RelationshipAttributes& containment)
+            : m_model(model), m_rootEntityName(rootEntityName), m_aggregation(aggregation), m_containment(containment)
+        {
+            Update();
+        }
+
+    private:
+        //pairs of relationships read so far, positions of relationships in the extent change when instances are deleted
+        struct Relationships
+        {
+            std::unordered_set<SdaiInstance>    read;
+            std::vector<SdaiInstance>           relationship;   //of each pair
+            std::vector<SdaiInstance>           relating;
+            std::vector<SdaiInstance>           related;
+            std::vector<SdaiEntity>             relatedTypes;   //exact entities of related instances, if read
+        };
+
+    private:
+        Instances Range(uint32_t begin, uint32_t end) const { return Instances{ m_treeElements.data() + begin, end - begin }; }
+
+        //reads relationships not read before and drops pairs of relationships that are no longer in the extent
+        void Read(const RelationshipAttributes& attributes, Relationships& pairs, bool relatedTypes)
+        {
+            std::unordered_set<SdaiInstance> present;
+            size_t kept = 0;
+            size_t first = pairs.related.size();
+            ReadRelationshipPairs(m_model, attributes, pairs.relating, pairs.related, &pairs.relationship, [&](SdaiInstance relationship) {
+                present.insert(relationship);
+                bool read = pairs.read.count(relationship) != 0;
+                kept += read;
+                return read;
+            });
+            if (relatedTypes) {
+                for (size_t i = first; i < pairs.related.size(); i++) {
+                    pairs.relatedTypes.push_back(sdaiGetInstanceType(pairs.related[i]));
+                }
+            }
+
+            if (kept < pairs.read.size()) {
+                size_t count = 0;
+                for (size_t i = 0; i < pairs.related.size(); i++) {
+                    if (present.count(pairs.relationship[i])) {
+                        pairs.relationship[count] = pairs.relationship[i];
+                        pairs.relating[count] = pairs.relating[i];
+                        pairs.related[count] = pairs.related[i];
+                        if (relatedTypes) {
+                            pairs.relatedTypes[count] = pairs.relatedTypes[i];
+                        }
+                        count++;
+                    }
+                }
+                pairs.relationship.resize(count);
+                pairs.relating.resize(count);
+                pairs.related.resize(count);
+                if (relatedTypes) {
+                    pairs.relatedTypes.resize(count);
+                }
+            }
+
+            pairs.read.swap(present);
+        }
+
+        void Layout()
+        {
+            m_nodes.clear();
+            m_nodeOf.clear();
+            m_containerOf.clear();
+            m_treeElements.clear();
+            m_elementTypes.clear();
+
+            InstanceRows<SdaiInstance> children;
+            children.Build(m_aggregations.relating, m_aggregations.related);
+
+            std::vector<uint32_t> pairs(m_containments.related.size());
+            for (size_t i = 0; i < pairs.size(); i++) {
+                pairs[i] = (uint32_t) i;
+            }
+            InstanceRows<uint32_t> contained;
+            contained.Build(m_containments.relating, pairs);
+
+            SdaiEntity rootEntity = sdaiGetEntity(m_model, m_rootEntityName);
+            SdaiAggr roots = rootEntity ? xxxxGetEntityAndSubTypesExtent(m_model, rootEntity) : NULL;
+            IntValue count = roots ? sdaiGetMemberCount(roots) : 0;
+            for (IntValue i = 0; i < count; i++) {
+                SdaiInstance root = 0;
+                sdaiGetAggrByIndex(roots, i, sdaiINSTANCE, &root);
+                AddNode(root, -1, children, contained);
+            }
+        }
+
+        int AddNode(SdaiInstance instance, int parent, const InstanceRows<SdaiInstance>& children, const InstanceRows<uint32_t>& contained)
+        {
+            int index = (int) m_nodes.size();
+            if (!m_nodeOf.emplace(instance, index).second) {
+                return -1; //cycle or second parent
+            }
+
+            Node node = { instance, parent, -1, -1, 0, (uint32_t) m_treeElements.size(), 0, 0 };
+            m_nodes.push_back(node);
+
+            auto own = contained.Get(instance);
+            std::vector<uint32_t> order(own.begin(), own.end());
+            const auto& elements = m_containments.related;
+            const auto& types = m_containments.relatedTypes;
+            std::stable_sort(order.begin(), order.end(), [&types](uint32_t a, uint32_t b) { return types[a] < types[b]; });
+            for (auto i : order) {
+                if (m_containerOf.emplace(elements[i], index).second) {
+                    m_treeElements.push_back(elements[i]);
+                    m_elementTypes.push_back(types[i]);
+                }
+            }
+            m_nodes[index].elementsEnd = (uint32_t) m_treeElements.size();
+
+            int last = -1;
+            for (SdaiInstance child : children.Get(instance)) {
+                int childIndex = AddNode(child, index, children, contained);
+                if (childIndex >= 0) {
+                    if (last < 0) {
+                        m_nodes[index].firstChild = childIndex;
+                    }
+                    else {
+                        m_nodes[last].nextSibling = childIndex;
+                    }
+                    last = childIndex;
+                }
+            }
+
+            m_nodes[index].subtreeEnd = (int) m_nodes.size();
+            m_nodes[index].subtreeElementsEnd = (uint32_t) m_treeElements.size();
+            return index;
+        }
+
+    private:
+        SdaiModel                               m_model;
+        TextValue                               m_rootEntityName;
+        RelationshipAttributes                  m_aggregation;
+        RelationshipAttributes                  m_containment;
+
+        //parents and children, containers and elements
+        Relationships                           m_aggregations;
+        Relationships                           m_containments;
+
+        //layout
+        std::vector<Node>                       m_nodes;
+        std::vector<SdaiInstance>               m_treeElements;
+        std::vector<SdaiEntity>                 m_elementTypes;
+        std::unordered_map<SdaiInstance, int>   m_nodeOf;
+        std::unordered_map<SdaiInstance, int>   m_containerOf;
+    };
+
+#ifdef __cpp_lib_string_view
+    /// <summary>
+    /// Value of single-value property, kind tells the member that is set
+    /// </summary>
+    struct PropertyValue
+    {
+        enum Kind : uint8_t { None, Integer, Real, Boolean, Logical, Text };
+
+        Kind            kind;
+        union
+        {
+            int64_t     integer;    //Integer, Boolean 0 or 1, Logical 0, 1 or 2 for unknown
+            double      real;       //Real
+            TextValue   text;       //Text, NUL terminated and interned in the table
+        };
+
+        std::string_view AsText() const { return (kind == Text) ? std::string_view(text) : std::string_view(); }
+    };
+
+    /// <summary>
+    /// Entities and attributes read by PropertyValueTable: relationship of property sets to objects, property set and single-value property
+    /// </summary>
+    struct PropertyAttributes
+    {
+        RelationshipAttributes  definesByProperties;    //relating property set, related objects
+        const char*             propertySetEntityName;
+        const char*             propertySetNameAttrName;
+        const char*             propertiesAttrName;
+        const char*             singleValueEntityName;
+        const char*             propertyNameAttrName;
+        const char*             valueAttrName;
+        const char*             unitAttrName;
+    };
+
+    /// <summary>
+    /// Single-value properties of all objects of a model in columns: row i is property PropertyNames()[i] of property set PropertySetNames()[i]
+    /// of object Objects()[i], with value Values()[i] of type ValueTypes()[i] and unit Units()[i]
+    /// Names and texts are interned, name columns keep ids of Name(id); (object, property set, property) is found by one hash lookup
+    /// Property sets are read on the calling thread by default; threads > 1 (or 0 for hardware concurrency) read parts of them
+    /// in threads, which calls engine get-functions concurrently and needs an engine whose reads of one model are thread-safe
+    /// The table is a snapshot of the model, build it again after properties change
+    /// </summary>
+    class PropertyValueTable
+    {
+    public:
+        static const uint32_t NO_NAME = (uint32_t) -1;
+
+        PropertyValueTable(const PropertyValueTable&) = delete;
+        PropertyValueTable& operator=(const PropertyValueTable&) = delete;
+
+        SdaiModel Model() const { return m_model; }
+
+        size_t size() const { return m_objects.size(); }
+
+        const std::vector<SdaiInstance>& Objects() const { return m_objects; }
+        const std::vector<uint32_t>& PropertySetNames() const { return m_propertySetNames; }
+        const std::vector<uint32_t>& PropertyNames() const { return m_propertyNames; }
+        const std::vector<PropertyValue>& Values() const { return m_values; }
+        const std::vector<uint32_t>& ValueTypes() const { return m_valueTypes; }
+        const std::vector<SdaiInstance>& Units() const { return m_units; }
+
+        std::string_view Name(uint32_t id) const { return (id < m_names.size()) ? m_names[id] : std::string_view(); }
+
+        //id of the name, NO_NAME if the table has no such name
+        uint32_t NameId(std::string_view name) const
+        {
+            auto it = m_nameIds.find(name);
+            return (it != m_nameIds.end()) ? it->second : NO_NAME;
+        }
+
+        //row of the property, -1 if the object has no such property
+        ptrdiff_t Find(SdaiInstance object, uint32_t propertySetName, uint32_t propertyName) const
+        {
+            auto it = m_rows.find(Key{ object, propertySetName, propertyName });
+            return (it != m_rows.end()) ? (ptrdiff_t) it->second : -1;
+        }
+
+        ptrdiff_t Find(SdaiInstance object, std::string_view propertySetName, std::string_view propertyName) const
+        {
+            return Find(object, NameId(propertySetName), NameId(propertyName));
+        }
+
+        //value of the property, NULL if the object has no such property
+        const PropertyValue* Value(SdaiInstance object, std::string_view propertySetName, std::string_view propertyName) const
+        {
+            ptrdiff_t row = Find(object, propertySetName, propertyName);
+            return (row >= 0) ? &m_values[row] : NULL;
+        }
+
+    protected:
+        PropertyValueTable(SdaiModel model, const PropertyAttributes& attributes, unsigned threads) : m_model(model)
+        {
+            std::vector<SdaiInstance> definitions;
+            std::vector<SdaiInstance> objects;
+            ReadRelationshipPairs(model, attributes.definesByProperties, definitions, objects);
+
+            InstanceRows<SdaiInstance> objectsOf;
+            objectsOf.Build(definitions, objects);
+
+            std::vector<SdaiInstance> propertySets;
+            std::unordered_map<SdaiInstance, bool> seen;
+            for (auto definition : definitions) {
+                if (seen.emplace(definition, true).second) {
+                    propertySets.push_back(definition);
+                }
+            }
+
+            Reader reader(model, attributes);
+            if (!reader.valid) {
+                return;
+            }
+
+            if (threads == 0) {
+                threads = std::thread::hardware_concurrency();
+            }
+            size_t count = propertySets.size();
+            size_t parts = (threads > 1 && count >= 1024) ? threads : 1;
+            size_t part = (count + parts - 1) / parts;
+
+            std::vector<std::vector<Property>> properties(parts);
+            std::vector<TextValue> propertySetNames(count);
+            std::unique_ptr<TextArena[]> texts(new TextArena[parts]); //texts of ADB values copied by each thread until merged to m_texts
+            auto read = [&](size_t index) {
+                size_t end = (index + 1) * part < count ? (index + 1) * part : count;
+                reader.Read(propertySets, index * part, end, propertySetNames, properties[index], texts[index]);
+            };
+
+            std::vector<std::thread> workers;
+            for (size_t i = 1; i < parts; i++) {
+                workers.emplace_back(read, i);
+            }
+            read(0);
+            for (auto& worker : workers) {
+                worker.join();
+            }
+
+            for (auto const& list : properties) {
+                for (auto const& property : list) {
+                    uint32_t propertySetName = Intern(propertySetNames[property.propertySet]);
+                    uint32_t propertyName = Intern(property.name);
+                    uint32_t valueType = Intern(property.valueType);
+                    PropertyValue value = property.value;
+                    if (value.kind == PropertyValue::Text) {
+                        value.text = m_texts.Intern(value.text).data();
+                    }
+                    for (SdaiInstance object : objectsOf.Get(propertySets[property.propertySet])) {
+                        if (m_rows.emplace(Key{ object, propertySetName, propertyName }, m_objects.size()).second) {
+                            m_objects.push_back(object);
+                            m_propertySetNames.push_back(propertySetName);
+                            m_propertyNames.push_back(propertyName);
+                            m_values.push_back(value);
+                            m_valueTypes.push_back(valueType);
+                            m_units.push_back(property.unit);
+                        }
+                    }
+                }
+            }
+        }
+
+    private:
+        struct Key
+        {
+            SdaiInstance    object;
+            uint32_t        propertySet;
+            uint32_t        property;
+
+            bool operator==(const Key& other) const { return object == other.object && propertySet == other.propertySet && property == other.property; }
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key& key) const
+            {
+                uint64_t h = (uint64_t) key.object * 0x9E3779B97F4A7C15ull;
+                h ^= (((uint64_t) key.propertySet << 32) | key.property) * 0xC2B2AE3D27D4EB4Full;
+                return (size_t) (h ^ (h >> 29));
+            }
+        };
+
+        //single-value property read from the engine, names are owned by the engine, value type and text by the arena of the reading thread
+        struct Property
+        {
+            size_t          propertySet;    //index in property sets
+            TextValue       name;
+            PropertyValue   value;
+            TextValue       valueType;
+            SdaiInstance    unit;
+        };
+
+        //
+        // Reads properties of property sets, one ADB per thread
+        // Type path and text of ADB value are valid until the ADB is reused, they are copied to the arena of the thread
+        struct Reader
+        {
+            SdaiEntity  propertySetEntity;
+            SdaiAttr    propertySetNameAttr;
+            SdaiAttr    propertiesAttr;
+            SdaiEntity  singleValueEntity;
+            SdaiAttr    propertyNameAttr;
+            SdaiAttr    valueAttr;
+            SdaiAttr    unitAttr;
+            bool        valid;
+
+            Reader(SdaiModel model, const PropertyAttributes& attributes)
+            {
+                propertySetEntity = sdaiGetEntity(model, attributes.propertySetEntityName);
+                singleValueEntity = sdaiGetEntity(model, attributes.singleValueEntityName);
+                propertySetNameAttr = propertySetEntity ? sdaiGetAttrDefinition(propertySetEntity, attributes.propertySetNameAttrName) : NULL;
+                propertiesAttr = propertySetEntity ? sdaiGetAttrDefinition(propertySetEntity, attributes.propertiesAttrName) : NULL;
+                propertyNameAttr = singleValueEntity ? sdaiGetAttrDefinition(singleValueEntity, attributes.propertyNameAttrName) : NULL;
+                valueAttr = singleValueEntity ? sdaiGetAttrDefinition(singleValueEntity, attributes.valueAttrName) : NULL;
+                unitAttr = singleValueEntity ? sdaiGetAttrDefinition(singleValueEntity, attributes.unitAttrName) : NULL;
+                valid = propertySetNameAttr && propertiesAttr && propertyNameAttr && valueAttr && unitAttr;
+            }
+
+            void Read(const std::vector<SdaiInstance>& propertySets, size_t begin, size_t end, std::vector<TextValue>& propertySetNames, std::vector<Property>& properties, TextArena& texts) const
+            {
+                SdaiADB adb = sdaiCreateEmptyADB();
+
+                for (size_t i = begin; i < end; i++) {
+                    SdaiInstance propertySet = propertySets[i];
+                    if (sdaiGetInstanceType(propertySet) != propertySetEntity) {
+                        continue; //quantities and other property definitions
+                    }
+                    sdaiGetAttr(propertySet, propertySetNameAttr, sdaiSTRING, &propertySetNames[i]);
+
+                    SdaiAggr aggr = NULL;
+                    sdaiGetAttr(propertySet, propertiesAttr, sdaiAGGR, &aggr);
+                    IntValue count = aggr ? sdaiGetMemberCount(aggr) : 0;
+                    for (IntValue j = 0; j < count; j++) {
+                        SdaiInstance instance = 0;
+                        sdaiGetAggrByIndex(aggr, j, sdaiINSTANCE, &instance);
+                        if (!instance || sdaiGetInstanceType(instance) != singleValueEntity) {
+                            continue;
+                        }
+
+                        Property property = {};
+                        property.propertySet = i;
+                        sdaiGetAttr(instance, propertyNameAttr, sdaiSTRING, &property.name);
+                        sdaiGetAttr(instance, unitAttr, sdaiINSTANCE, &property.unit);
+                        if (sdaiGetAttr(instance, valueAttr, sdaiADB, adb)) {
+                            TextValue valueType = sdaiGetADBTypePath(adb, 0);
+                            property.valueType = valueType ? texts.Intern(valueType).data() : NULL;
+                            ReadValue(adb, property.value, texts);
+                        }
+                        properties.push_back(property);
+                    }
+                }
+
+                sdaiDeleteADB(adb);
+            }
+
+            //enumeration values of IfcValue are booleans and logicals
+            static void ReadValue(SdaiADB adb, PropertyValue& value, TextArena& texts)
+            {
+                value.kind = PropertyValue::None;
+                value.integer = 0;
+
+                switch (sdaiGetADBType(adb)) {
+                    case sdaiINTEGER:
+                    {
+                        int_t integer = 0;
+                        if (sdaiGetADBValue(adb, sdaiINTEGER, &integer)) {
+                            value.kind = PropertyValue::Integer;
+                            value.integer = integer;
+                        }
+                        break;
+                    }
+                    case sdaiREAL:
+                    case sdaiNUMBER:
+                        if (sdaiGetADBValue(adb, sdaiREAL, &value.real)) {
+                            value.kind = PropertyValue::Real;
+                        }
+                        break;
+                    case sdaiBOOLEAN:
+                    {
+                        SdaiBoolean boolean = sdaiFALSE;
+                        if (sdaiGetADBValue(adb, sdaiBOOLEAN, &boolean)) {
+                            value.kind = PropertyValue::Boolean;
+                            value.integer = (boolean == sdaiTRUE) ? 1 : 0;
+                        }
+                        break;
+                    }
+                    case sdaiLOGICAL:
+                    case sdaiENUM:
+                    {
+                        TextValue text = NULL;
+                        if (sdaiGetADBValue(adb, sdaiENUM, &text) && text) {
+                            if (!strcmp(text, "T") || !strcmp(text, "F")) {
+                                value.kind = PropertyValue::Boolean;
+                                value.integer = (text[0] == 'T') ? 1 : 0;
+                            }
+                            else if (!strcmp(text, "U")) {
+                                value.kind = PropertyValue::Logical;
+                                value.integer = 2;
+                            }
+                            else {
+                                value.kind = PropertyValue::Text;
+                                value.text = texts.Intern(text).data();
+                            }
+                        }
+                        break;
+                    }
+                    default:
+                    {
+                        TextValue text = NULL;
+                        if (sdaiGetADBValue(adb, sdaiSTRING, &text) && text) {
+                            value.kind = PropertyValue::Text;
+                            value.text = texts.Intern(text).data();
+                        }
+                        break;
+                    }
+                }
+            }
+        };
+
+        uint32_t Intern(TextValue text)
         {
-            SdaiAggr aggr = NULL;
-            sdaiGetAttrBN(instance, attrName, sdaiAGGR, &aggr);
-            if (aggr) {
-                FromSdaiAggr(lst, instance, aggr);
+            if (!text) {
+                return NO_NAME;
+            }
+            std::string_view name = m_texts.Intern(text);
+            auto it = m_nameIds.emplace(name, (uint32_t) m_names.size());
+            if (it.second) {
+                m_names.push_back(name);
             }
+            return it.first->second;
         }
 
-        //
-        virtual void FromSdaiAggr(TList& lst, SdaiInstance inst, SdaiAggr aggr) = 0; 
-        virtual SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, TextValue attrName) = 0;
+    private:
+        SdaiModel                                           m_model;
+
+        //columns
+        std::vector<SdaiInstance>                           m_objects;
+        std::vector<uint32_t>                               m_propertySetNames;
+        std::vector<uint32_t>                               m_propertyNames;
+        std::vector<PropertyValue>                          m_values;
+        std::vector<uint32_t>                               m_valueTypes;
+        std::vector<SdaiInstance>                           m_units;
+
+        TextArena                                           m_texts;
+        std::vector<std::string_view>                       m_names;
+        std::unordered_map<std::string_view, uint32_t>      m_nameIds;
+        std::unordered_map<Key, uint32_t, KeyHash>          m_rows;
     };
+#endif
 
     /// <summary>
-    /// 
+    /// Affine transform as 4x4 matrix in order of getInstanceTransformationMatrix _11, _12 ... _44:
+    /// rows are x axis, y axis, z axis and origin, point is transformed as row vector p * M
     /// </summary>
-    template <typename TList, typename TElem, IntValue sdaiType> class AggrSerializerSimple : public AggrSerializer<TList>
+    struct TransformMatrix
     {
-    public:
-        AggrSerializerSimple() { assert(sdaiType == sdaiINTEGER || sdaiType == sdaiREAL || sdaiType == sdaiBOOLEAN); }
+        double  m[16];
 
-        //
-        virtual void FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr) override
-        {
-            IntValue  cnt = sdaiGetMemberCount(aggr);
-            for (IntValue i = 0; i < cnt; i++) {
-                TElem val = 0;
-                sdaiGetAggrByIndex(aggr, i, sdaiType, &val);
-                lst.push_back(val);
-            }
-        }
+        static TransformMatrix Identity() { return TransformMatrix{ { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 } }; }
 
-        //
-        virtual SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, TextValue attrName) override
+        void TransformPoint(const double point[3], double result[3]) const
         {
-            SdaiAggr aggr = sdaiCreateAggrBN(instance, attrName);
-            for (auto const& v : lst) {
-                TElem val = v;
-                sdaiAppend(aggr, sdaiType, &val);
+            for (int j = 0; j < 3; j++) {
+                result[j] = point[0] * m[j] + point[1] * m[4 + j] + point[2] * m[8 + j] + m[12 + j];
             }
-            return aggr;
         }
     };
 
     /// <summary>
-    /// 
+    /// result = a * b, transform by a then by b: local transform times world transform of parent is world transform
+    /// result may be a or b
     /// </summary>
-    template <typename TList, typename TElem, IntValue sdaiType> class AggrSerializerText : public AggrSerializer<TList>
+    inline void MultiplyTransforms(const TransformMatrix& a, const TransformMatrix& b, TransformMatrix& result)
     {
-    public:
-        AggrSerializerText() { assert(sdaiType == sdaiSTRING || sdaiType == sdaiBINARY); }
-
-        virtual void FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr) override
-        {
-            IntValue  cnt = sdaiGetMemberCount(aggr);
-            for (IntValue i = 0; i < cnt; i++) {
-                TextValue val;
-                sdaiGetAggrByIndex(aggr, i, sdaiType, &val);
-                lst.push_back(val);
-            }
+#if defined(RDF_EXPRESS_SIMD_AVX)
+        __m256d b0 = _mm256_loadu_pd(b.m);
+        __m256d b1 = _mm256_loadu_pd(b.m + 4);
+        __m256d b2 = _mm256_loadu_pd(b.m + 8);
+        __m256d b3 = _mm256_loadu_pd(b.m + 12);
+        for (int i = 0; i < 16; i += 4) {
+            __m256d row = _mm256_mul_pd(_mm256_broadcast_sd(a.m + i), b0);
+            row = _mm256_add_pd(row, _mm256_mul_pd(_mm256_broadcast_sd(a.m + i + 1), b1));
+            row = _mm256_add_pd(row, _mm256_mul_pd(_mm256_broadcast_sd(a.m + i + 2), b2));
+            row = _mm256_add_pd(row, _mm256_mul_pd(_mm256_broadcast_sd(a.m + i + 3), b3));
+            _mm256_storeu_pd(result.m + i, row);
         }
-
-        virtual SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, TextValue attrName) override
-        {
-            SdaiAggr aggr = sdaiCreateAggrBN(instance, attrName);
-            for (auto& val : lst) {
-                TextValue v = val;
-                sdaiAppend(aggr, sdaiType, v);
+#elif defined(RDF_EXPRESS_SIMD_SSE2)
+        __m128d rows[8];
+        for (int k = 0; k < 8; k++) {
+            rows[k] = _mm_loadu_pd(b.m + 2 * k);
+        }
+        for (int i = 0; i < 16; i += 4) {
+            __m128d a0 = _mm_set1_pd(a.m[i]);
+            __m128d a1 = _mm_set1_pd(a.m[i + 1]);
+            __m128d a2 = _mm_set1_pd(a.m[i + 2]);
+            __m128d a3 = _mm_set1_pd(a.m[i + 3]);
+            __m128d low = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(a0, rows[0]), _mm_mul_pd(a1, rows[2])), _mm_mul_pd(a2, rows[4])), _mm_mul_pd(a3, rows[6]));
+            __m128d high = _mm_add_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(a0, rows[1]), _mm_mul_pd(a1, rows[3])), _mm_mul_pd(a2, rows[5])), _mm_mul_pd(a3, rows[7]));
+            _mm_storeu_pd(result.m + i, low);
+            _mm_storeu_pd(result.m + i + 2, high);
+        }
+#else
+        TransformMatrix product;
+        for (int i = 0; i < 16; i += 4) {
+            for (int j = 0; j < 4; j++) {
+                product.m[i + j] = a.m[i] * b.m[j] + a.m[i + 1] * b.m[4 + j] + a.m[i + 2] * b.m[8 + j] + a.m[i + 3] * b.m[12 + j];
             }
-            return aggr;
         }
-
-    };
+        result = product;
+#endif
+    }
 
     /// <summary>
-    /// 
+    /// Entities and attributes read by PlacementTable: object placements, local placement relative to other placement and axis placements
     /// </summary>
-    template <typename TList, typename TElem> class AggrSerializerInstance : public AggrSerializer <TList>
+    struct PlacementAttributes
     {
-    public:
-        //
-        virtual void FromSdaiAggr(TList& lst, SdaiInstance /*unused*/, SdaiAggr aggr) override
-        {
-            auto  cnt = sdaiGetMemberCount(aggr);
-            for (IntValue i = 0; i < cnt; i++) {
-                SdaiInstance val = 0;
-                sdaiGetAggrByIndex(aggr, i, sdaiINSTANCE, &val);
-                TElem elem(val);
-                if (val) {
-                    lst.push_back(val);
-                }
-            }
-        }
-
-        //
-        virtual SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, TextValue attrName) override
-        {
-            auto aggr = sdaiCreateAggrBN(instance, attrName);
-            for (auto& val : lst) {
-                SdaiInstance v = val;
-                sdaiAppend(aggr, sdaiINSTANCE, (void*) v);
-            }
-            return aggr;
-        }
+        const char*     objectPlacementEntityName;  //all placements
+        const char*     localPlacementEntityName;
+        const char*     relativeToAttrName;         //placement the local placement is relative to
+        const char*     relativePlacementAttrName;  //axis placement
+        const char*     axis3DEntityName;
+        const char*     axis3DLocationAttrName;
+        const char*     axis3DAxisAttrName;         //z axis
+        const char*     axis3DRefDirectionAttrName; //x axis
+        const char*     axis2DEntityName;
+        const char*     axis2DLocationAttrName;
+        const char*     axis2DRefDirectionAttrName;
+        const char*     pointEntityName;
+        const char*     coordinatesAttrName;
+        const char*     directionEntityName;
+        const char*     directionRatiosAttrName;
     };
 
-
     /// <summary>
-    /// 
+    /// World transforms of all object placements of a model, read and composed in one pass
+    /// Local placement is relative to the placement it refers to, placements are kept in topological order so the placement
+    /// it refers to comes first; every world transform is computed once from the world transform of its parent, shared parents are not read again
+    /// Transforms()[i] is the transform of Placements()[i], Find gives the index of a placement; placements of other kinds are identity
+    /// The table is a snapshot of the model, build it again after placements change
     /// </summary>
-    template <typename TList, typename TElem, TextValue* rEnumValues, IntValue sdaiType> class AggrSerializerEnum : public AggrSerializer<TList>
+    class PlacementTable
     {
     public:
-        AggrSerializerEnum() { assert(sdaiType == sdaiENUM || sdaiType == sdaiLOGICAL); }
+        PlacementTable(const PlacementTable&) = delete;
+        PlacementTable& operator=(const PlacementTable&) = delete;
 
-        //
-        virtual void FromSdaiAggr(TList& lst, SdaiInstance /*instance*/, SdaiAggr aggr) override
+        SdaiModel Model() const { return m_model; }
+
+        size_t size() const { return m_placements.size(); }
+
+        const std::vector<SdaiInstance>& Placements() const { return m_placements; }
+        const std::vector<TransformMatrix>& Transforms() const { return m_transforms; }
+
+        //index of placement the placement is relative to, -1 for placements in world coordinates
+        const std::vector<int>& Parents() const { return m_parents; }
+
+        //index of the placement, -1 if the instance is not placement of the model
+        int Find(SdaiInstance placement) const
         {
-            IntValue  cnt = sdaiGetMemberCount(aggr);
-            for (IntValue i = 0; i < cnt; i++) {
-                TextValue value = NULL;
-                sdaiGetAggrByIndex(aggr, i, sdaiType, &value);
-                int val = EnumerationNameToIndex(rEnumValues, value);
-                if (val >= 0) {
-                    lst.push_back((TElem) val);
-                }
-            }
+            auto it = m_indexOf.find(placement);
+            return (it != m_indexOf.end()) ? it->second : -1;
         }
 
-        //
-        virtual SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, TextValue attrName) override
+        //world transform of the placement, NULL if the instance is not placement of the model
+        const TransformMatrix* Transform(SdaiInstance placement) const
         {
-            SdaiAggr aggr = sdaiCreateAggrBN(instance, attrName);
-            for (auto const& val : lst) {
-                TextValue value = rEnumValues[(IntValue) val];
-                sdaiAppend(aggr, sdaiType, value);
-            }
-            return aggr;
+            int index = Find(placement);
+            return (index >= 0) ? &m_transforms[index] : NULL;
         }
-    };
 
-    /// <summary>
-    /// 
-    /// </summary>
-    template <typename TList, typename TNestedAggr, typename TNestedSerializer> class AggrSerializerAggr : public AggrSerializer<TList>
-    {
-    public:
-        //
-        virtual void FromSdaiAggr(TList& lst, SdaiInstance instance, SdaiAggr aggr) override
+    protected:
+        PlacementTable(SdaiModel model, const PlacementAttributes& attributes) : m_model(model)
         {
-            IntValue  cnt = sdaiGetMemberCount(aggr);
-            for (IntValue i = 0; i < cnt; i++) {
-                SdaiAggr nested = 0;
-                sdaiGetAggrByIndex(aggr, i, sdaiAGGR, &nested);
-                if (nested) {
-                    lst.push_back(TNestedAggr());
-                    TNestedSerializer nestedSerializer;
-                    nestedSerializer.FromSdaiAggr(lst.back(), instance, nested);
+            Reader reader(model, attributes);
+            SdaiEntity entity = sdaiGetEntity(model, attributes.objectPlacementEntityName);
+            SdaiAggr extent = entity ? xxxxGetEntityAndSubTypesExtent(model, entity) : NULL;
+            IntValue count = extent ? sdaiGetMemberCount(extent) : 0;
+
+            //read in order of extent
+            std::vector<SdaiInstance> instances((size_t) count);
+            std::vector<SdaiInstance> relativeTo((size_t) count);
+            std::vector<TransformMatrix> locals((size_t) count);
+            std::unordered_map<SdaiInstance, int> indexOf;
+            indexOf.reserve((size_t) count);
+            for (IntValue i = 0; i < count; i++) {
+                sdaiGetAggrByIndex(extent, i, sdaiINSTANCE, &instances[i]);
+                indexOf.emplace(instances[i], (int) i);
+                reader.Read(instances[i], relativeTo[i], locals[i]);
+            }
+
+            std::vector<int> parents((size_t) count);
+            for (IntValue i = 0; i < count; i++) {
+                auto it = relativeTo[i] ? indexOf.find(relativeTo[i]) : indexOf.end();
+                parents[i] = (it != indexOf.end()) ? it->second : -1;
+            }
+
+            //depth of placement in chain of placements it is relative to, placements of a cycle become roots
+            const int UNKNOWN = -1;
+            const int VISITING = -2;
+            std::vector<int> depths((size_t) count, UNKNOWN);
+            std::vector<int> chain;
+            int maxDepth = 0;
+            for (IntValue i = 0; i < count; i++) {
+                while (depths[i] == UNKNOWN) {
+                    int p = (int) i;
+                    while (p >= 0 && depths[p] == UNKNOWN) {
+                        depths[p] = VISITING;
+                        chain.push_back(p);
+                        p = parents[p];
+                    }
+                    if (p >= 0 && depths[p] == VISITING) {
+                        parents[p] = -1; //break the cycle and walk again
+                        for (int c : chain) {
+                            depths[c] = UNKNOWN;
+                        }
+                        chain.clear();
+                        continue;
+                    }
+                    int depth = (p >= 0) ? depths[p] : -1;
+                    while (chain.size()) {
+                        depths[chain.back()] = ++depth;
+                        chain.pop_back();
+                    }
+                    maxDepth = (depth > maxDepth) ? depth : maxDepth;
                 }
             }
-        }
 
-        //
-        virtual SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, TextValue attrName) override
-        {
-            SdaiAggr aggr = sdaiCreateAggrBN(instance, attrName);
-            for (TNestedAggr& val : lst) {
-                TNestedSerializer nestedSerializer;
-                SdaiAggr nested = nestedSerializer.ToSdaiAggr(val, instance, NULL);
-                sdaiAppend(aggr, sdaiAGGR, nested);
+            //counting sort by depth
+            std::vector<int> offsets((size_t) maxDepth + 2, 0);
+            for (IntValue i = 0; i < count; i++) {
+                offsets[depths[i] + 1]++;
+            }
+            for (size_t d = 1; d < offsets.size(); d++) {
+                offsets[d] += offsets[d - 1];
+            }
+            std::vector<int> positions((size_t) count);
+            for (IntValue i = 0; i < count; i++) {
+                positions[i] = offsets[depths[i]]++;
             }
-            return aggr;
-        }
-    };
 
-    template<typename TList, typename TElem> class AggrSerializerSelect : public AggrSerializer<TList>
-    {
-    public:
-        //
-        virtual void FromSdaiAggr(TList& lst, SdaiInstance instance, SdaiAggr aggr) override
-        {
-            IntValue  cnt = sdaiGetMemberCount(aggr);
-            for (IntValue i = 0; i < cnt; i++) {
-                void* adb = 0;
-                sdaiGetAggrByIndex(aggr, i, sdaiADB, &adb);
-                if (adb) {
-                    lst.push_back(TElem(instance, NULL, adb));
+            m_placements.resize((size_t) count);
+            m_transforms.resize((size_t) count);
+            m_parents.resize((size_t) count);
+            m_indexOf.reserve((size_t) count);
+            for (IntValue i = 0; i < count; i++) {
+                int position = positions[i];
+                m_placements[position] = instances[i];
+                m_transforms[position] = locals[i];
+                m_parents[position] = (parents[i] >= 0) ? positions[parents[i]] : -1;
+                m_indexOf.emplace(instances[i], position);
+            }
+
+            for (size_t i = 0; i < m_transforms.size(); i++) {
+                if (m_parents[i] >= 0) {
+                    MultiplyTransforms(m_transforms[i], m_transforms[m_parents[i]], m_transforms[i]);
                 }
             }
         }
 
+    private:
         //
-        virtual SdaiAggr ToSdaiAggr(TList& lst, SdaiInstance instance, TextValue attrName) override
+        // Reads local transforms of placements
+        struct Reader
         {
-            SdaiAggr aggr = sdaiCreateAggrBN(instance, attrName);
-            for (auto& val : lst) {
-                void* adb = val.ADB();
-                if (adb) {
-                    sdaiAppend(aggr, sdaiADB, adb);
-                }
+            SdaiEntity  localPlacementEntity;
+            SdaiAttr    relativeToAttr;
+            SdaiAttr    relativePlacementAttr;
+            SdaiEntity  axis3DEntity;
+            SdaiAttr    axis3DLocationAttr;
+            SdaiAttr    axis3DAxisAttr;
+            SdaiAttr    axis3DRefDirectionAttr;
+            SdaiEntity  axis2DEntity;
+            SdaiAttr    axis2DLocationAttr;
+            SdaiAttr    axis2DRefDirectionAttr;
+            SdaiEntity  pointEntity;
+            SdaiAttr    coordinatesAttr;
+            SdaiEntity  directionEntity;
+            SdaiAttr    directionRatiosAttr;
+
+            Reader(SdaiModel model, const PlacementAttributes& attributes)
+            {
+                localPlacementEntity = sdaiGetEntity(model, attributes.localPlacementEntityName);
+                relativeToAttr = localPlacementEntity ? sdaiGetAttrDefinition(localPlacementEntity, attributes.relativeToAttrName) : NULL;
+                relativePlacementAttr = localPlacementEntity ? sdaiGetAttrDefinition(localPlacementEntity, attributes.relativePlacementAttrName) : NULL;
+                axis3DEntity = sdaiGetEntity(model, attributes.axis3DEntityName);
+                axis3DLocationAttr = axis3DEntity ? sdaiGetAttrDefinition(axis3DEntity, attributes.axis3DLocationAttrName) : NULL;
+                axis3DAxisAttr = axis3DEntity ? sdaiGetAttrDefinition(axis3DEntity, attributes.axis3DAxisAttrName) : NULL;
+                axis3DRefDirectionAttr = axis3DEntity ? sdaiGetAttrDefinition(axis3DEntity, attributes.axis3DRefDirectionAttrName) : NULL;
+                axis2DEntity = sdaiGetEntity(model, attributes.axis2DEntityName);
+                axis2DLocationAttr = axis2DEntity ? sdaiGetAttrDefinition(axis2DEntity, attributes.axis2DLocationAttrName) : NULL;
+                axis2DRefDirectionAttr = axis2DEntity ? sdaiGetAttrDefinition(axis2DEntity, attributes.axis2DRefDirectionAttrName) : NULL;
+                pointEntity = sdaiGetEntity(model, attributes.pointEntityName);
+                coordinatesAttr = pointEntity ? sdaiGetAttrDefinition(pointEntity, attributes.coordinatesAttrName) : NULL;
+                directionEntity = sdaiGetEntity(model, attributes.directionEntityName);
+                directionRatiosAttr = directionEntity ? sdaiGetAttrDefinition(directionEntity, attributes.directionRatiosAttrName) : NULL;
             }
-            return aggr;
-        }
-    };
 
+            void Read(SdaiInstance placement, SdaiInstance& relativeTo, TransformMatrix& local) const
+            {
+                relativeTo = 0;
+                local = TransformMatrix::Identity();
+                if (!localPlacementEntity || !sdaiIsKindOf(placement, localPlacementEntity)) {
+                    return;
+                }
+                sdaiGetAttr(placement, relativeToAttr, sdaiINSTANCE, &relativeTo);
+
+                SdaiInstance axisPlacement = 0;
+                sdaiGetAttr(placement, relativePlacementAttr, sdaiINSTANCE, &axisPlacement);
+                SdaiEntity entity = axisPlacement ? sdaiGetInstanceType(axisPlacement) : NULL;
+
+                double origin[3] = { 0, 0, 0 };
+                double x[3] = { 1, 0, 0 };
+                double z[3] = { 0, 0, 1 };
+                if (entity && entity == axis3DEntity) {
+                    ReadPoint(axisPlacement, axis3DLocationAttr, origin);
+                    ReadDirection(axisPlacement, axis3DAxisAttr, z);
+                    ReadDirection(axisPlacement, axis3DRefDirectionAttr, x);
+                }
+                else if (entity && entity == axis2DEntity) {
+                    ReadPoint(axisPlacement, axis2DLocationAttr, origin);
+                    ReadDirection(axisPlacement, axis2DRefDirectionAttr, x);
+                }
+                else {
+                    return;
+                }
 
-    /// <summary>
-    /// Provides utility methods to interact with a generic SDAI instance
-    /// You also can use object of this class instead of SdaiInstance handle in any place where the handle is required
-    /// </summary>
-    class Entity
-    {
-    protected:
-        SdaiInstance m_instance;
+                //axes as IfcAxis2Placement3D derives them: x is projected to the plane normal to z
+                Normalize(z);
+                double dot = x[0] * z[0] + x[1] * z[1] + x[2] * z[2];
+                for (int j = 0; j < 3; j++) {
+                    x[j] -= dot * z[j];
+                }
+                if (!Normalize(x)) {
+                    x[0] = 1; x[1] = 0; x[2] = 0;
+                }
+                double y[3] = { z[1] * x[2] - z[2] * x[1], z[2] * x[0] - z[0] * x[2], z[0] * x[1] - z[1] * x[0] };
 
-    public:
-        Entity(SdaiInstance instance, TextValue entityName)
-        {
-            m_instance = instance;
+                for (int j = 0; j < 3; j++) {
+                    local.m[j] = x[j];
+                    local.m[4 + j] = y[j];
+                    local.m[8 + j] = z[j];
+                    local.m[12 + j] = origin[j];
+                }
+            }
 
-            if (m_instance != 0 && entityName != NULL) {
-                if (!sdaiIsKindOfBN(m_instance, entityName)) {
-                    m_instance = 0;
+            void ReadPoint(SdaiInstance axisPlacement, SdaiAttr attr, double point[3]) const
+            {
+                SdaiInstance instance = 0;
+                if (attr && sdaiGetAttr(axisPlacement, attr, sdaiINSTANCE, &instance) && instance && sdaiGetInstanceType(instance) == pointEntity) {
+                    ReadReals(instance, coordinatesAttr, point);
+                }
+            }
+
+            //direction is not changed when it is not set
+            void ReadDirection(SdaiInstance axisPlacement, SdaiAttr attr, double direction[3]) const
+            {
+                SdaiInstance instance = 0;
+                if (attr && sdaiGetAttr(axisPlacement, attr, sdaiINSTANCE, &instance) && instance && sdaiGetInstanceType(instance) == directionEntity) {
+                    double ratios[3] = { 0, 0, 0 };
+                    ReadReals(instance, directionRatiosAttr, ratios);
+                    if (ratios[0] != 0 || ratios[1] != 0 || ratios[2] != 0) {
+                        direction[0] = ratios[0]; direction[1] = ratios[1]; direction[2] = ratios[2];
+                    }
                 }
             }
-        }
 
+            //up to 3 values, 2D points and directions have z = 0
+            static void ReadReals(SdaiInstance instance, SdaiAttr attr, double values[3])
+            {
+                SdaiAggr aggr = NULL;
+                if (attr && sdaiGetAttr(instance, attr, sdaiAGGR, &aggr) && aggr) {
+                    IntValue count = sdaiGetMemberCount(aggr);
+                    for (IntValue j = 0; j < count && j < 3; j++) {
+                        sdaiGetAggrByIndex(aggr, j, sdaiREAL, &values[j]);
+                    }
+                }
+            }
 
-        /// <summary>
-        /// Conversion  to instance handle, so the object of the class can be used anywhere where a handle required
-        /// </summary>
-        operator SdaiInstance() const { return m_instance; }
+            static bool Normalize(double v[3])
+            {
+                double length = sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+                if (length < 1e-12) {
+                    return false;
+                }
+                v[0] /= length; v[1] /= length; v[2] /= length;
+                return true;
+            }
+        };
 
-    protected:
-        //
-        //
-        int getENUM(TextValue attrName, TextValue rEnumValues[])
-        {
-            TextValue value = NULL;
-            sdaiGetAttrBN(m_instance, attrName, sdaiENUM, (void*) &value);
-            return EnumerationNameToIndex(rEnumValues, value);
-        }
+    private:
+        SdaiModel                               m_model;
+        std::vector<SdaiInstance>               m_placements;
+        std::vector<TransformMatrix>            m_transforms;
+        std::vector<int>                        m_parents;
+        std::unordered_map<SdaiInstance, int>   m_indexOf;
     };
+    //## TEMPLATE: ForwardDeclarationsBegin
 
 
     //
@@ -586,7 +3316,9 @@ namespace NAMESPACE_NAME
     //## EnumerationNamesBegin
     //
             //## EnumerationNames
-    static TextValue ENUMERATION_NAME_[] = {"ENUMERATION_STRING_VALUES", NULL};
+    inline TextValue ENUMERATION_NAME_[] = {"ENUMERATION_STRING_VALUES", NULL};
+    inline constexpr short ENUMERATION_NAME_slots[] = {ENUMERATION_HASH_SLOTS};
+    inline constexpr EnumerationHash ENUMERATION_NAME_hash = {ENUMERATION_NAME_, ENUMERATION_NAME_slots, ENUMERATION_HASH_SEEDu, ENUMERATION_HASH_MASKu};
     //## TEMPLATE: EnumerationsEnd
     //## TEMPLATE: AggregationTypesBegin
 
@@ -594,22 +3326,22 @@ namespace NAMESPACE_NAME
         // Unnamed aggregations
         //
     //## AggregationOfSimple
-    typedef std::list<SimpleType> AggregationType;
+    typedef AggrContainer<SimpleType> AggregationType;
     template <typename TList> class AggregationTypeSerializer : public AggrSerializerSimple<TList, SimpleType, sdaiTYPE> {};
     //## AggregationOfText
-    typedef std::list<StringValue> Aggregationtype;
-    template <typename TList> class AggregationtypeSerializer : public AggrSerializerText<Aggregationtype, TextType, sdaiTYPE> {};
+    typedef AggrContainer<StringValue> Aggregationtype;
+    template <typename TList> class AggregationtypeSerializer : public AggrSerializerText<TList, TextType, sdaiTYPE> {};
     //## AggregationOfInstance
-    typedef std::list<SimpleType> AggregationTYpe;
+    typedef AggrContainer<SimpleType> AggregationTYpe;
     template <typename TList> class AggregationTYpeSerializer : public AggrSerializerInstance<TList, SimpleType> {};
     //## AggregationOfEnum
-    typedef std::list<TypeNameIFC> AggregationTyPe;
-    template <typename TList> class AggregationTyPeSerializer : public AggrSerializerEnum<TList, ENUMERATION_NAME, ENUMERATION_VALUES_ARRAY, sdaiTYPE> {};
+    typedef AggrContainer<TypeNameIFC> AggregationTyPe;
+    template <typename TList> class AggregationTyPeSerializer : public AggrSerializerEnum<TList, ENUMERATION_NAME, &ENUMERATION_VALUES_ARRAYhash, sdaiTYPE> {};
     //## AggregationOfAggregation
-    typedef std::list<SimpleType> AggregationTYPe;
+    typedef AggrContainer<SimpleType> AggregationTYPe;
     template <typename TList> class AggregationTYPeSerializer : public AggrSerializerAggr<TList, SimpleType, SimpleTypeSerializer<SimpleType>> {};
     //## AggregationOfSelect
-    typedef std::list<SimpleType> AggregationTYPE;
+    typedef AggrContainer<SimpleType> AggregationTYPE;
     template <typename TList> class AggregationTYPESerializer : public AggrSerializerSelect<TList, SimpleType> {};
     //## SelectsBegin
 
@@ -621,53 +3353,61 @@ namespace NAMESPACE_NAME
     class GEN_TYPE_NAME_accessor : public Select
     {
     public:
-        GEN_TYPE_NAME_accessor(SdaiInstance instance, TextValue attrName = NULL, void* adb = NULL) : Select(instance, attrName, adb) {}
+        GEN_TYPE_NAME_accessor(SdaiInstance instance, IntValue attrOrdinal = -1, void* adb = NULL) : Select(instance, attrOrdinal, adb) {}
         GEN_TYPE_NAME_accessor(Select* outer) : Select(outer) {}
         //## SelectSimpleGet
-        bool is_SimpleType() { return IsADBType("TypeNameUpper"); }
-        Nullable<SimpleType> get_SimpleType() { return getSimpleValue<SimpleType>("TypeNameUpper", sdaiTYPE); }
+        bool is_SimpleType() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(TYPE_PATH_ID); }
+        Nullable<SimpleType> get_SimpleType() { RDF_EXPRESS_PROBE(ProbeAttr()); return getSimpleValue<SimpleType>(TYPE_PATH_ID, sdaiTYPE); }
         //## SelectSimplePut
-        void put_SimpleType(SimpleType value) { putSimpleValue("TypeNameUpper", sdaiTYPE, value); }
+        void put_SimpleType(SimpleType value) { RDF_EXPRESS_PROBE(ProbeAttr()); putSimpleValue(TYPE_PATH_ID, sdaiTYPE, value); }
         //## SelectTextGet
-        bool is_TextType() { return IsADBType("TypeNameUpper"); }
-        TextType get_TextType() { return getTextValue("TypeNameUpper", sdaiTYPE); }
+        bool is_TextType() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(TYPE_PATH_ID); }
+        TextType get_TextType() { RDF_EXPRESS_PROBE(ProbeAttr()); return getTextValue(TYPE_PATH_ID, sdaiTYPE); }
+#ifdef __cpp_lib_string_view
+        std::string_view get_TextType_view() { return TextView(get_TextType()); }
+#endif
         //## SelectTextPut
-        void put_TextType(TextType value) { putTextValue("TypeNameUpper", sdaiTYPE, value); }
+        void put_TextType(TextType value) { RDF_EXPRESS_PROBE(ProbeAttr()); putTextValue(TYPE_PATH_ID, sdaiTYPE, value); }
         //## SelectEntityGet
-        bool is_REF_ENTITY() { return IsADBEntity("REF_ENTITY"); }
+        bool is_REF_ENTITY() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBEntity(ENTITY_ORDINAL); }
         REF_ENTITY get_REF_ENTITY();
         //## SelectEntityPut
         void put_REF_ENTITY(REF_ENTITY inst);
         //## SelectEnumerationGet
-        bool is_TypeNameIFC() { return IsADBType("TypeNameUpper"); }
-        Nullable<TypeNameIFC> get_TypeNameIFC() { int v = getEnumerationValue("TypeNameUpper", ENUMERATION_VALUES_ARRAY); if (v >= 0) return (TypeNameIFC) v; else return Nullable<TypeNameIFC>(); }
+        bool is_TypeNameIFC() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(TYPE_PATH_ID); }
+        Nullable<TypeNameIFC> get_TypeNameIFC() { RDF_EXPRESS_PROBE(ProbeAttr()); int v = getEnumerationValue(TYPE_PATH_ID, ENUMERATION_VALUES_ARRAYhash); if (v >= 0) return (TypeNameIFC) v; else return Nullable<TypeNameIFC>(); }
         //## SelectEnumerationPut
-        void put_TypeNameIFC(TypeNameIFC value) { TextValue val = ENUMERATION_VALUES_ARRAY[(int) value]; putEnumerationValue("TypeNameUpper", val); }
+        void put_TypeNameIFC(TypeNameIFC value) { RDF_EXPRESS_PROBE(ProbeAttr()); TextValue val = ENUMERATION_VALUES_ARRAY[(int) value]; putEnumerationValue(TYPE_PATH_ID, val); }
         //## SelectAggregationGet
-        bool is_AggregationType() { return IsADBType("TypeNameUpper"); }
+        bool is_AggregationType() { RDF_EXPRESS_PROBE(ProbeAttr()); return IsADBType(TYPE_PATH_ID); }
 
         //TList may be AggregationType or list of convertible elements
-        template <typename TList> void get_AggregationType(TList& lst) { SdaiAggr aggr = getAggrValue("TypeNameUpper"); AggregationTypeSerializer<TList> sr; sr.FromSdaiAggr(lst, m_instance, aggr); }
+        template <typename TList> void get_AggregationType(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); SdaiAggr aggr = getAggrValue(TYPE_PATH_ID); AggregationTypeSerializer<TList> sr; sr.FromSdaiAggr(lst, m_instance, aggr); }
         //## SelectAggregationPut
 
                 //TList may be AggregationType or list of convertible elements
-        template <typename TList> void put_AggregationType(TList& lst) { AggregationTypeSerializer<TList> sr; SdaiAggr aggr = sr.ToSdaiAggr(lst, m_instance, NULL); putAggrValue("TypeNameUpper", aggr); }
+        template <typename TList> void put_AggregationType(TList& lst) { RDF_EXPRESS_PROBE(ProbeAttr()); AggregationTypeSerializer<TList> sr; SdaiAggr aggr = sr.ToSdaiAggr(lst, m_instance, NULL); putAggrValue(TYPE_PATH_ID, aggr); }
         //## SelectAggregationPutArray
 
                 //TArrayElem[] may be SimpleType[] or array of convertible elements
-        template <typename TArrayElem> void put_AggregationType(TArrayElem arr[], size_t n) { AggregationType lst; ArrayToList(arr, n, lst); put_AggregationType(lst); }
+        template <typename TArrayElem> void put_AggregationType(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(ProbeAttr()); ArrayRange<TArrayElem> range = {arr, n}; AggregationTypeSerializer<AggregationType> sr; SdaiAggr aggr = sr.RangeToSdaiAggr(range, m_instance, NULL); putAggrValue(TYPE_PATH_ID, aggr); }
         //## SelectNested
         GEN_TYPE_NAME_accessor nestedSelectAccess_GEN_TYPE_NAME() { return GEN_TYPE_NAME_accessor(this); }
         //## SelectGetAsDouble
-        Nullable<double> as_double() { double val = 0; if (sdaiGetAttrBN(m_instance, m_attrName, sdaiREAL, &val)) return val; else return Nullable<double>(); }
+        Nullable<double> as_double() { RDF_EXPRESS_PROBE(ProbeAttr()); double val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiREAL, &val)) return val; else return Nullable<double>(); }
         //## SelectGetAsInt
-        Nullable<IntValue> as_int() { IntValue val = 0; if (sdaiGetAttrBN(m_instance, m_attrName, sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
+        Nullable<IntValue> as_int() { RDF_EXPRESS_PROBE(ProbeAttr()); IntValue val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiINTEGER, &val)) return val; else return Nullable<IntValue>(); }
         //## SelectGetAsBool
-        Nullable<bool> as_bool() { bool val = 0; if (sdaiGetAttrBN(m_instance, m_attrName, sdaiBOOLEAN, &val)) return val; else return Nullable<bool>(); }
+        Nullable<bool> as_bool() { RDF_EXPRESS_PROBE(ProbeAttr()); bool val = 0; if (sdaiGetAttr(m_instance, getAttrDefinition(), sdaiBOOLEAN, &val)) return val; else return Nullable<bool>(); }
         //## SelectGetAsText
-        TextValue as_text() { TextValue val = NULL; sdaiGetAttrBN(m_instance, m_attrName, sdaiSTRING, &val); return val; }
+        TextValue as_text() { RDF_EXPRESS_PROBE(ProbeAttr()); TextValue val = NULL; sdaiGetAttr(m_instance, getAttrDefinition(), sdaiSTRING, &val); return val; }
+#ifdef __cpp_lib_string_view
+        std::string_view as_text_view() { return TextView(as_text()); }
+#endif
+        const char* as_text_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(ProbeAttr()); return buffer.GetAttr(m_instance, getAttrName()); }
+        const char* as_text_utf8() { return as_text_utf8(ThreadUtf8Buffer()); }
         //## SelectGetAsEntity
-        SdaiInstance as_instance() { return getEntityInstance(NULL); }
+        SdaiInstance as_instance() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(-1); }
         //## SelectAccessorEnd
     };
 
@@ -683,39 +3423,70 @@ namespace NAMESPACE_NAME
         /// Provides utility methods to interact with an instance of ENTITY_NAME
         /// You also can use object of this C++ class instead of IntValue handle of the OWL instance in any place where the handle is required
         /// </summary>
-    class ENTITY_NAME : public virtual /*PARENT_NAME*/Entity
+    class ENTITY_NAME : public RDF_EXPRESS_VIRTUAL /*PARENT_NAME*/Entity
     {
     public:
         /// <summary>
         /// Constructs object of this C++ class that wraps existing SdaiInstance of ENTITY_NAME
         /// </summary>
         /// <param name="instance">An instance to interact with</param>
-        ENTITY_NAME(SdaiInstance instance = NULL, TextValue entityName = NULL)
-            : Entity(instance, entityName ? entityName : "ENTITY_NAME")
-        {}
+        ENTITY_NAME(SdaiInstance instance = 0, TextValue entityName = NULL)
+        {
+            m_instance = KindOf(instance, entityName, ENTITY_ORDINAL);
+        }
+
+        /// <summary>
+        /// Instances of ENTITY_NAME in the model, without or with instances of sub-entities
+        /// </summary>
+        static ExtentRange<ENTITY_NAME> Extent(SdaiModel model) { return ExtentRange<ENTITY_NAME>(model, ENTITY_ORDINAL, false); }
+        static ExtentRange<ENTITY_NAME> ExtentWithSubtypes(SdaiModel model) { return ExtentRange<ENTITY_NAME>(model, ENTITY_ORDINAL, true); }
+
+        //## EntitySupertypeConversion
+#ifdef RDF_EXPRESS_FLAT_ENTITIES
+        /// <summary>
+        /// Conversion to supertype REF_ENTITY, flat entity class derives from the first supertype only
+        /// </summary>
+        operator REF_ENTITY() const { return Entity::Unchecked<REF_ENTITY>(m_instance); }
+#endif
 
         //## EntityCreateMethod
         /// <summary>
         /// Create new instance of ENTITY_NAME and returns object of this C++ class to interact with
         /// </summary>
         static ENTITY_NAME Create(SdaiModel model) { SdaiInstance inst = sdaiCreateInstanceBN(model, "ENTITY_NAME"); assert(inst); return inst; }
+        //## CreateExactSubEntiyMethod
         /// <summary>
-        /// Create instance of ENTITY_NAME or its sub-entity based on the actual type of SdaiInstance
+        /// Returns object of ENTITY_NAME if the actual type of SdaiInstance is ENTITY_NAME or its sub-entity, empty object otherwise
+        /// The type is checked by entity ordinal of the instance; objects are values, pass visitor to get object of the exact sub-entity class
         /// </summary>
-        //## CreateExactSubEntiyMethod
-        static ENTITY_NAME CreateExactEntity (SdaiInstance instance); //not implemented yet
+        static ENTITY_NAME CreateExactEntity(SdaiInstance instance) { return ENTITY_NAME(instance); }
+
+        /// <summary>
+        /// Calls visitor with object of the exact entity class of the instance if it is ENTITY_NAME or its sub-entity, see Visit
+        /// </summary>
+        template <typename TVisitor> static bool CreateExactEntity(SdaiInstance instance, TVisitor&& visitor) { return ENTITY_NAME(instance) && Visit(instance, std::forward<TVisitor>(visitor)); }
         //## CreateExactSubEntiyCase
         //## CreateExactSubEntityEnd
         //## AttributeSimpleGet
 
-        Nullable<SimpleType> get_ATTR_NAME() { SimpleType val = (SimpleType) 0; if (sdaiGetAttrBN(m_instance, "ATTR_NAME", sdaiTYPE, &val)) return val; else return Nullable<SimpleType>(); }
+        Nullable<SimpleType> get_ATTR_NAME() { RDF_EXPRESS_PROBE(ATTR_ORDINAL); SimpleType val = (SimpleType) 0; if (sdaiGetAttr(m_instance, getAttrDefinition(ATTR_ORDINAL), sdaiTYPE, &val)) return val; else return Nullable<SimpleType>(); }
         //## AttributeSimplePut
-        void put_ATTR_NAME(SimpleType value) { sdaiPutAttrBN(m_instance, "ATTR_NAME", sdaiTYPE, &value); }
+        void put_ATTR_NAME(SimpleType value) { RDF_EXPRESS_PROBE(ATTR_ORDINAL); sdaiPutAttr(m_instance, getAttrDefinition(ATTR_ORDINAL), sdaiTYPE, &value); }
         //## AttributeTextGet
 
-        TextType get_attr_NAME() { TextType val = NULL; if (sdaiGetAttrBN(m_instance, "ATTR_NAME", sdaiTYPE, &val)) return val; else return NULL; }
+        TextType get_attr_NAME() { RDF_EXPRESS_PROBE(ATTR_ORDINAL); TextType val = NULL; if (sdaiGetAttr(m_instance, getAttrDefinition(ATTR_ORDINAL), sdaiTYPE, &val)) return val; else return NULL; }
+#ifdef __cpp_lib_string_view
+        std::string_view get_attr_NAME_view() { return TextView(get_attr_NAME()); }
+#endif
         //## AttributeTextPut
-        void put_ATTR_NAME(TextType value) { sdaiPutAttrBN(m_instance, "ATTR_NAME", sdaiTYPE, value); }
+        void put_ATTR_NAME(TextType value) { RDF_EXPRESS_PROBE(ATTR_ORDINAL); sdaiPutAttr(m_instance, getAttrDefinition(ATTR_ORDINAL), sdaiTYPE, value); }
+        //## AttributeGlobalIdPut
+        void put_ATTR_NAME(TextType value) { RDF_EXPRESS_PROBE(ATTR_ORDINAL); if (GlobalIdTable::Active()) { GlobalIdTable::OnPut(m_instance, get_ATTR_NAME(), value); } sdaiPutAttr(m_instance, getAttrDefinition(ATTR_ORDINAL), sdaiTYPE, value); }
+        //## AttributeTextGetUtf8
+
+        //UTF-8 text copied to the buffer, NULL if not set; without argument the text is valid until the next UTF-8 get in the thread
+        const char* get_attr_NAME_utf8(Utf8Buffer& buffer) { RDF_EXPRESS_PROBE(ATTR_ORDINAL); return buffer.GetAttr(m_instance, "ATTR_NAME"); }
+        const char* get_attr_NAME_utf8() { return get_attr_NAME_utf8(ThreadUtf8Buffer()); }
         //## AttributeEntityGet
 
         REF_ENTITY get_Attr_NAME();
@@ -723,34 +3494,312 @@ namespace NAMESPACE_NAME
         void put_Attr_NAME(REF_ENTITY inst);
         //## AttributeEnumGet
 
-        Nullable<TypeNameIFC> get_ATtr_NAME() { int v = getENUM("ATTR_NAME", ENUMERATION_VALUES_ARRAY); if (v >= 0) return (TypeNameIFC) v; else return Nullable<TypeNameIFC>(); }
+        Nullable<TypeNameIFC> get_ATtr_NAME() { RDF_EXPRESS_PROBE(ATTR_ORDINAL); int v = getENUM(ATTR_ORDINAL, ENUMERATION_VALUES_ARRAYhash); if (v >= 0) return (TypeNameIFC) v; else return Nullable<TypeNameIFC>(); }
         //## AttributeEnumPut
-        void put_ATTR_NAME(TypeNameIFC value) { TextValue val = ENUMERATION_VALUES_ARRAY[(int) value]; sdaiPutAttrBN(m_instance, "ATTR_NAME", sdaiENUM, val); }
+        void put_ATTR_NAME(TypeNameIFC value) { RDF_EXPRESS_PROBE(ATTR_ORDINAL); TextValue val = ENUMERATION_VALUES_ARRAY[(int) value]; sdaiPutAttr(m_instance, getAttrDefinition(ATTR_ORDINAL), sdaiENUM, val); }
         //## AttributeSelectAccessor
-        GEN_TYPE_NAME_accessor getOrPut_ATTR_NAME() { return GEN_TYPE_NAME_accessor(m_instance, "ATTR_NAME", NULL); }
+        GEN_TYPE_NAME_accessor getOrPut_ATTR_NAME() { return GEN_TYPE_NAME_accessor(m_instance, ATTR_ORDINAL); }
         //## AttributeAggregationGet
 
         //TList may be AggregationType or list of convertible elements
-        template <typename TList> void get_ATTr_NAME(TList& lst) { AggregationTypeSerializer<TList> sr; sr.FromAttr(lst, m_instance, "ATTR_NAME"); }
+        template <typename TList> void get_ATTr_NAME(TList& lst) { RDF_EXPRESS_PROBE(ATTR_ORDINAL); AggregationTypeSerializer<TList> sr; sr.FromAttr(lst, m_instance, getAttrDefinition(ATTR_ORDINAL)); }
         //## AttributeAggregationPut
 
         //TList may be AggregationType or list of convertible elements
-        template <typename TList> void put_ATTr_NAME(TList& lst) { AggregationTypeSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, "ATTR_NAME"); }
+        template <typename TList> void put_ATTr_NAME(TList& lst) { RDF_EXPRESS_PROBE(ATTR_ORDINAL); AggregationTypeSerializer<TList> sr;  sr.ToSdaiAggr(lst, m_instance, getAttrDefinition(ATTR_ORDINAL)); }
         //## AttributeAggregationPutArray
 
         //TArrayElem[] may be SimpleType[] or array of convertible elements
-        template <typename TArrayElem> void put_ATTr_NAME(TArrayElem arr[], size_t n) { AggregationType lst; ArrayToList(arr, n, lst); put_ATTr_NAME(lst); }
+        template <typename TArrayElem> void put_ATTr_NAME(TArrayElem arr[], size_t n) { RDF_EXPRESS_PROBE(ATTR_ORDINAL); ArrayRange<TArrayElem> range = {arr, n}; AggregationTypeSerializer<AggregationType> sr; sr.RangeToSdaiAggr(range, m_instance, getAttrDefinition(ATTR_ORDINAL)); }
+        //## AttributeAggregationGetFlat
+
+        //reads inner aggregations into flat buffer, stride elements each (e.g. xyz of points), returns number of inner aggregations
+        template <typename TElem> IntValue get_ATTR_NAME(TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(ATTR_ORDINAL); return FlatAggrFromAttr<TElem, SimpleType, sdaiTYPE>(m_instance, getAttrDefinition(ATTR_ORDINAL), buffer, size, stride); }
+        template <typename TElem> IntValue get_ATTR_NAME(std::vector<TElem>& flat, size_t stride) { RDF_EXPRESS_PROBE(ATTR_ORDINAL); return FlatAggrFromAttr<TElem, SimpleType, sdaiTYPE>(m_instance, getAttrDefinition(ATTR_ORDINAL), flat, stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> IntValue get_ATTR_NAME(std::span<TElem> buffer, size_t stride) { return get_ATTR_NAME(buffer.data(), buffer.size(), stride); }
+#endif
+        //## AttributeAggregationPutFlat
+
+        //writes flat buffer as inner aggregations of stride elements each (e.g. xyz of points), no intermediate lists
+        template <typename TElem> void put_ATTR_NAME(const TElem* buffer, size_t size, size_t stride) { RDF_EXPRESS_PROBE(ATTR_ORDINAL); FlatAggrToAttr<TElem, SimpleType, sdaiTYPE>(m_instance, getAttrDefinition(ATTR_ORDINAL), buffer, size, stride); }
+        template <typename TElem> void put_ATTR_NAME(const std::vector<TElem>& flat, size_t stride) { put_ATTR_NAME(flat.data(), flat.size(), stride); }
+#ifdef __cpp_lib_span
+        template <typename TElem> void put_ATTR_NAME(std::span<const TElem> buffer, size_t stride) { put_ATTR_NAME(buffer.data(), buffer.size(), stride); }
+#endif
+        //## EntityAttributesBegin
+
+        /// <summary>
+        /// Ordinals of attributes for GetAttr and PutAttr, with attributes of supertypes
+        /// </summary>
+        struct attr : SUPERTYPE_ATTRIBUTES
+        {
+        //## EntityAttribute
+            static constexpr IntValue ATTR_NAME = ATTR_ORDINAL;
+        //## EntityAttributesEnd
+        };
         //## EntityEnd
     };
 
     //## SelectEntityGetImplementation
-    inline REF_ENTITY GEN_TYPE_NAME_accessor::get_REF_ENTITY() { return getEntityInstance("TypeNameUpper"); }
+    inline REF_ENTITY GEN_TYPE_NAME_accessor::get_REF_ENTITY() { RDF_EXPRESS_PROBE(ProbeAttr()); return getEntityInstance(ENTITY_ORDINAL); }
     //## SelectEntityPutImplementation
-    inline void GEN_TYPE_NAME_accessor::put_REF_ENTITY(REF_ENTITY inst) { putEntityInstance("TypeNameUpper", inst); }
+    inline void GEN_TYPE_NAME_accessor::put_REF_ENTITY(REF_ENTITY inst) { RDF_EXPRESS_PROBE(ProbeAttr()); putEntityInstance(ENTITY_ORDINAL, inst); }
     //## AttributeEntityGetImplementation
-    inline REF_ENTITY ENTITY_NAME::get_Attr_NAME() { SdaiInstance inst = 0; sdaiGetAttrBN(m_instance, "ATTR_NAME", sdaiINSTANCE, &inst); return inst; }
+    inline REF_ENTITY ENTITY_NAME::get_Attr_NAME() { RDF_EXPRESS_PROBE(ATTR_ORDINAL); SdaiInstance inst = 0; sdaiGetAttr(m_instance, getAttrDefinition(ATTR_ORDINAL), sdaiINSTANCE, &inst); return inst; }
     //## AttributeEntityPutImplementation
-    inline void ENTITY_NAME::put_Attr_NAME(REF_ENTITY inst) { SdaiInstance i = inst;  sdaiPutAttrBN(m_instance, "ATTR_NAME", sdaiINSTANCE, (void*) i); }
+    inline void ENTITY_NAME::put_Attr_NAME(REF_ENTITY inst) { RDF_EXPRESS_PROBE(ATTR_ORDINAL); SdaiInstance i = inst;  sdaiPutAttr(m_instance, getAttrDefinition(ATTR_ORDINAL), sdaiINSTANCE, (void*) i); }
+    //## AttributeOrdinalAccessor
+    RDF_EXPRESS_ATTR_ACCESSOR(ATTR_ORDINAL, ENTITY_NAME, ENTITY_ORDINAL, ATTR_NAME)
+    //## GlobalIdIndex
+
+    /// <summary>
+    /// Index of ENTITY_NAME instances of a model by ATTR_NAME, see GlobalIdIndexOf
+    /// </summary>
+    typedef GlobalIdIndexOf<ENTITY_NAME> GlobalIdIndex;
+
+    //## SerializersBegin
+
+    //
+    // Explicit instantiations of aggregation serializers with generated aggregation types as TList
+    // Compile NAMESPACE_NAME_serializers.cpp once and define RDF_EXPRESS_EXTERN_SERIALIZERS in other translation units
+    //
+#if defined(RDF_EXPRESS_INSTANTIATE_SERIALIZERS)
+#define RDF_EXPRESS_SERIALIZER template class
+#elif defined(RDF_EXPRESS_EXTERN_SERIALIZERS)
+#define RDF_EXPRESS_SERIALIZER extern template class
+#endif
+#ifdef RDF_EXPRESS_SERIALIZER
+    //## SerializerOfSimple
+    RDF_EXPRESS_SERIALIZER AggrSerializerSimple<AggregationType, SimpleType, sdaiTYPE>;
+    //## SerializerOfText
+    RDF_EXPRESS_SERIALIZER AggrSerializerText<AggregationType, TextType, sdaiTYPE>;
+    //## SerializerOfInstance
+    RDF_EXPRESS_SERIALIZER AggrSerializerInstance<AggregationType, SimpleType>;
+    //## SerializerOfEnum
+    RDF_EXPRESS_SERIALIZER AggrSerializerEnum<AggregationTyPe, ENUMERATION_NAME, &ENUMERATION_VALUES_ARRAYhash, sdaiTYPE>;
+    //## SerializerOfAggregation
+    RDF_EXPRESS_SERIALIZER AggrSerializerAggr<AggregationType, SimpleType, SimpleTypeSerializer<SimpleType>>;
+    //## SerializerOfSelect
+    RDF_EXPRESS_SERIALIZER AggrSerializerSelect<AggregationType, SimpleType>;
+    //## SerializersEnd
+#undef RDF_EXPRESS_SERIALIZER
+#endif
+    //## SchemaEntitiesBegin
+
+    //
+    // Entities of the schema, indexed by entity ordinal
+    //
+    static constexpr EntityDefinition SchemaEntities_[] = {
+    //## SchemaEntity
+        {"ENTITY_NAME", SUPERTYPES_OFFSET},
+    //## SchemaSupertypesBegin
+        {NULL, -1}
+    };
+
+    //
+    // Direct supertypes of entities, -1 terminated list for each entity
+    //
+    static constexpr IntValue SchemaSupertypes_[] = {
+    //## SchemaSupertypes
+        SUPERTYPE_ORDINALS-1, //ENTITY_NAME
+    //## SchemaEntitiesEnd
+        -1
+    };
+
+    inline const EntityDefinition* SchemaEntities(IntValue& count)
+    {
+        count = sizeof(SchemaEntities_) / sizeof(SchemaEntities_[0]) - 1;
+        return SchemaEntities_;
+    }
+
+    inline const IntValue* SchemaSupertypes()
+    {
+        return SchemaSupertypes_;
+    }
+    //## SchemaAttributesBegin
+
+    //
+    // Attributes of generated accessors, indexed by attribute ordinal
+    //
+    static const AttributeName SchemaAttributes_[] = {
+    //## SchemaAttribute
+        {"ENTITY_NAME", "ATTR_NAME"},
+    //## SchemaAttributesEnd
+        {NULL, NULL}
+    };
+
+    inline const AttributeName* SchemaAttributes(IntValue& count)
+    {
+        count = sizeof(SchemaAttributes_) / sizeof(SchemaAttributes_[0]) - 1;
+        return SchemaAttributes_;
+    }
+    //## SchemaTypePathsBegin
+
+    //
+    // Type paths of SELECT values, indexed by type path id
+    //
+    static const TextValue SchemaTypePaths_[] = {
+    //## SchemaTypePath
+        "TypeNameUpper",
+    //## SchemaTypePathsEnd
+        NULL
+    };
+
+    inline const TextValue* SchemaTypePaths(IntValue& count)
+    {
+        count = sizeof(SchemaTypePaths_) / sizeof(SchemaTypePaths_[0]) - 1;
+        return SchemaTypePaths_;
+    }
+    //## RelationshipIndex
+
+    /// <summary>
+    /// Relationships of a model read in one pass, for example
+    ///     index.Related(RelationshipIndex::ContainedInSpatialStructure, storey) - elements contained in the storey
+    ///     index.Relating(RelationshipIndex::DefinesByProperties, wall) - property definitions of the wall
+    /// </summary>
+    class RelationshipIndex : public RelationshipTable
+    {
+    public:
+        enum Relationship
+        {
+            Aggregates,                     //RelatingObject - RelatedObjects
+            ContainedInSpatialStructure,    //RelatingStructure - RelatedElements
+            DefinesByProperties,            //RelatingPropertyDefinition - RelatedObjects
+            DefinesByType,                  //RelatingType - RelatedObjects
+            VoidsElement,                   //RelatingBuildingElement - RelatedOpeningElement
+            AssociatesMaterial              //RelatingMaterial - RelatedObjects
+        };
+
+        explicit RelationshipIndex(SdaiModel model) : RelationshipTable(model, Relationships(), AssociatesMaterial + 1) {}
+
+    private:
+        static const RelationshipAttributes* Relationships()
+        {
+            static const RelationshipAttributes relationships[] = {
+                {"IfcRelAggregates", "RelatingObject", "RelatedObjects"},
+                {"IfcRelContainedInSpatialStructure", "RelatingStructure", "RelatedElements"},
+                {"IfcRelDefinesByProperties", "RelatingPropertyDefinition", "RelatedObjects"},
+                {"IfcRelDefinesByType", "RelatingType", "RelatedObjects"},
+                {"IfcRelVoidsElement", "RelatingBuildingElement", "RelatedOpeningElement"},
+                {"IfcRelAssociatesMaterial", "RelatingMaterial", "RelatedObjects"}
+            };
+            return relationships;
+        }
+    };
+    //## SpatialTree
+
+    /// <summary>
+    /// Spatial structure of a model: IfcProject and objects decomposed by IfcRelAggregates, with elements contained by IfcRelContainedInSpatialStructure
+    ///     tree.SubtreeElements(tree.Find(building)) - elements of all storeys of the building
+    ///     tree.Elements(tree.Find(storey), sdaiGetEntity(model, "IfcWall")) - walls contained in the storey
+    /// Call Update after relationships are added or deleted, it lays the whole tree out again
+    /// </summary>
+    class SpatialTree : public SpatialTreeTable
+    {
+    public:
+        explicit SpatialTree(SdaiModel model)
+            : SpatialTreeTable(model, "IfcProject", { "IfcRelAggregates", "RelatingObject", "RelatedObjects" }, { "IfcRelContainedInSpatialStructure", "RelatingStructure", "RelatedElements" })
+        {}
+    };
+    //## PropertyTable
+#ifdef __cpp_lib_string_view
+
+    /// <summary>
+    /// Single-value properties of objects of a model from IfcPropertySet related by IfcRelDefinesByProperties, for example
+    ///     table.Value(wall, "Pset_WallCommon", "FireRating") - the value, NULL if the wall has no such property
+    ///     table.Values() - values of all properties for whole-column scans
+    /// </summary>
+    class PropertyTable : public PropertyValueTable
+    {
+    public:
+        explicit PropertyTable(SdaiModel model, unsigned threads = 1) : PropertyValueTable(model, Attributes(), threads) {}
+
+    private:
+        static const PropertyAttributes& Attributes()
+        {
+            static const PropertyAttributes attributes = {
+                {"IfcRelDefinesByProperties", "RelatingPropertyDefinition", "RelatedObjects"},
+                "IfcPropertySet", "Name", "HasProperties",
+                "IfcPropertySingleValue", "Name", "NominalValue", "Unit"
+            };
+            return attributes;
+        }
+    };
+#endif
+    //## PlacementResolver
+
+    /// <summary>
+    /// World transforms of IfcObjectPlacement of a model: IfcLocalPlacement composed with its PlacementRelTo chain, for example
+    ///     resolver.Transform(product.get_ObjectPlacement()) - transform of the product to world coordinates
+    ///     resolver.Transforms() - transforms of all placements, contiguous
+    /// </summary>
+    class PlacementResolver : public PlacementTable
+    {
+    public:
+        explicit PlacementResolver(SdaiModel model) : PlacementTable(model, Attributes()) {}
+
+    private:
+        static const PlacementAttributes& Attributes()
+        {
+            static const PlacementAttributes attributes = {
+                "IfcObjectPlacement",
+                "IfcLocalPlacement", "PlacementRelTo", "RelativePlacement",
+                "IfcAxis2Placement3D", "Location", "Axis", "RefDirection",
+                "IfcAxis2Placement2D", "Location", "RefDirection",
+                "IfcCartesianPoint", "Coordinates",
+                "IfcDirection", "DirectionRatios"
+            };
+            return attributes;
+        }
+    };
+    //## VisitBegin
+
+    /// <summary>
+    /// Calls visitor with object of the exact entity class of the instance: visitor(IfcWall), visitor(IfcDoor)...
+    /// Dispatches by entity ordinal, overloads of visitor for supertypes accept sub-entities by conversion
+    /// Returns false if the instance is NULL or its entity is not from this schema
+    /// </summary>
+    template <typename TVisitor> bool Visit(SdaiInstance instance, TVisitor&& visitor)
+    {
+        if (!instance) {
+            return false;
+        }
+
+        switch (EntityTypeTable::GetTypeOrdinal(instance)) {
+    //## VisitCase
+            case ENTITY_ORDINAL: visitor(Entity::Unchecked<ENTITY_NAME>(instance)); return true;
+    //## VisitEnd
+            default: return false;
+        }
+    }
+#if 0 //split headers and serializers source are separate files //## IGNORE
+//## SplitHeaderBegin
+//
+// Early-binding C++ API for SDAI (C++ wrappers), one of split headers
+//
+#ifndef __RDF_LTD__NAMESPACE_NAME_HEADER_GUARD_H
+#define __RDF_LTD__NAMESPACE_NAME_HEADER_GUARD_H
+
+//## SplitInclude
+#include    "INCLUDE_PATH"
+//## SplitNamespaceBegin
+
+namespace NAMESPACE_NAME
+{
+//## SplitNamespaceEnd
+}
+//## SplitHeaderEnd
+
+#endif //__RDF_LTD__NAMESPACE_NAME_HEADER_GUARD_H
+//## SerializersSource
+//
+// Explicit instantiations of aggregation serializers of INCLUDE_PATH
+// Compile this file once and define RDF_EXPRESS_EXTERN_SERIALIZERS in other translation units, so they do not instantiate serializers
+//
+#define RDF_EXPRESS_INSTANTIATE_SERIALIZERS
+#include    "INCLUDE_PATH"
+#endif //## IGNORE
     //## TEMPLATE: EndFile template part
 
 }
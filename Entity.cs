@@ -111,6 +111,36 @@ namespace RDFWrappers
             return false;
         }
 
+        /// <summary>
+        /// Returns true if sdaiAncestor is the entity or is reached from it through first parents
+        /// </summary>
+        public bool IsFirstParentsAncestor(ExpressHandle sdaiAncestor)
+        {
+            var entity = sdaiEntity;
+            while (entity != 0)
+            {
+                if (entity == sdaiAncestor)
+                    return true;
+                entity = ifcengine.engiGetEntityParentEx(entity, 0);
+            }
+            return false;
+        }
+
+        /// <summary>
+        /// Returns true if sdaiAncestor is the entity or is reached from it through any of supertypes
+        /// </summary>
+        public bool IsAncestor(ExpressHandle sdaiAncestor)
+        {
+            if (sdaiEntity == sdaiAncestor)
+                return true;
+            foreach (var parentId in GetSupertypes())
+            {
+                if (new Entity(parentId).IsAncestor(sdaiAncestor))
+                    return true;
+            }
+            return false;
+        }
+
         public List<Entity> GetSubTypesByFirstParent(Schema schema)
         {
             var ret = new List<Entity>();
@@ -38,6 +38,60 @@ namespace RDFWrappers
             return ret;
         }
 
+        /// <summary>
+        /// Finds seed and table size so that each value gets its own slot
+        /// Hash function must be the same as EnumerationHashSlot in EngineEx_Template.h
+        /// </summary>
+        /// <returns>slots: index of value or -1</returns>
+        public int[] GetPerfectHash(out uint seed, out uint mask)
+        {
+            var vals = GetValues();
+
+            uint size = 4;
+            while (size < 2 * vals.Count)
+            {
+                size *= 2;
+            }
+
+            while (true)
+            {
+                mask = size - 1;
+                for (seed = 0; seed < 1000; seed++)
+                {
+                    var slots = Enumerable.Repeat(-1, (int)size).ToArray();
+                    bool ok = true;
+                    for (int i = 0; i < vals.Count && ok; i++)
+                    {
+                        var slot = HashSlot(vals[i], seed, mask);
+                        if (slots[slot] >= 0)
+                            ok = false;
+                        else
+                            slots[slot] = i;
+                    }
+                    if (ok)
+                    {
+                        return slots;
+                    }
+                }
+                size *= 2;
+            }
+        }
+
+        private static uint HashSlot(string value, uint seed, uint mask)
+        {
+            uint h = 2166136261u ^ seed;
+            foreach (var ch in Encoding.ASCII.GetBytes(value))
+            {
+                uint c = ch;
+                if (c >= 'a' && c <= 'z')
+                {
+                    c = c - 'a' + 'A';
+                }
+                h = unchecked((h ^ c) * 16777619u);
+            }
+            return (h ^ (h >> 15)) & mask;
+        }
+
         public override string ToString()
         {
             var str = new StringBuilder();
@@ -23,6 +23,10 @@ namespace RDFWrappers
 
         public const string KWD_NAMESPACE = "NAMESPACE_NAME";
         public const string KWD_ENTITY_NAME = "ENTITY_NAME";
+        public const string KWD_ENTITY_ORDINAL = "ENTITY_ORDINAL";
+        public const string KWD_SUPERTYPES_OFFSET = "SUPERTYPES_OFFSET";
+        public const string KWD_SUPERTYPE_ORDINALS = "SUPERTYPE_ORDINALS";
+        public const string KWD_SUPERTYPE_ATTRIBUTES = "SUPERTYPE_ATTRIBUTES";
         public const string KWD_BASE_CLASS = "/*PARENT_NAME*/Entity";
         public const string KWD_SUB_CLASS = "SUBENTITY__NAME";
         public const string KWD_DEFINED_TYPE = "DEFINED_TYPE_NAME";
@@ -31,11 +35,16 @@ namespace RDFWrappers
         public const string KWD_TextType = "TextType";
         public const string KWD_TypeNameIFC = "TypeNameIFC";
         public const string KWD_TypeNameUpper = "TypeNameUpper";
+        public const string KWD_TYPE_PATH_ID = "TYPE_PATH_ID";
         public const string KWD_ENUMERATION_NAME = "ENUMERATION_NAME";
         public const string KWD_ENUMERATION_VALUES_ARRAY = "ENUMERATION_VALUES_ARRAY";
         public const string KWD_ENUMERATION_ELEMENT = "ENUMERATION_ELEMENT";
+        public const string KWD_ENUMERATION_HASH_SLOTS = "ENUMERATION_HASH_SLOTS";
+        public const string KWD_ENUMERATION_HASH_SEED = "ENUMERATION_HASH_SEED";
+        public const string KWD_ENUMERATION_HASH_MASK = "ENUMERATION_HASH_MASK";
         public const string KWD_NUMBER = "1234";
         public const string KWD_ATTR_NAME = "ATTR_NAME";
+        public const string KWD_ATTR_ORDINAL = "ATTR_ORDINAL";
         public const string KWD_sdaiTYPE = "sdaiTYPE";
         public const string KWD_asType = "asTYPE";
         public const string KWD_REF_ENTITY = "REF_ENTITY";
@@ -46,6 +55,8 @@ namespace RDFWrappers
         public const string KWD_GETPUT = "getOrPut";
         public const string KWD_AggregationType = "AggregationType";
         public const string KWD_suffix = "_suffix";
+        public const string KWD_HEADER_GUARD = "HEADER_GUARD";
+        public const string KWD_INCLUDE_PATH = "INCLUDE_PATH";
 
         /// <summary>
         /// 
@@ -54,6 +65,8 @@ namespace RDFWrappers
         { 
             None,
             BeginFile,
+            IfcTables,
+            ForwardDeclarationsBegin,
             ClassForwardDeclaration,
             DefinedTypesBegin,
             DefinedTypeSimple,
@@ -96,6 +109,7 @@ namespace RDFWrappers
             SelectAccessorEnd,
             EntitiesBegin,
             EntityBegin,
+            EntitySupertypeConversion,
             EntityCreateMethod,
             CreateExactSubEntiyMethod,
             CreateExactSubEntiyCase,
@@ -104,6 +118,8 @@ namespace RDFWrappers
             AttributeSimplePut,
             AttributeTextGet,
             AttributeTextPut,
+            AttributeGlobalIdPut,
+            AttributeTextGetUtf8,
             AttributeEntityGet,
             AttributeEntityPut,
             AttributeEnumGet,
@@ -112,16 +128,96 @@ namespace RDFWrappers
             AttributeAggregationGet,
             AttributeAggregationPut,
             AttributeAggregationPutArray,
+            AttributeAggregationGetFlat,
+            AttributeAggregationPutFlat,
+            EntityAttributesBegin,
+            EntityAttribute,
+            EntityAttributesEnd,
             EntityEnd,
             SelectEntityGetImplementation,
             SelectEntityPutImplementation,
             AttributeEntityGetImplementation,
             AttributeEntityPutImplementation,
+            AttributeOrdinalAccessor,
+            GlobalIdIndex,
+            SerializersBegin,
+            SerializerOfSimple,
+            SerializerOfText,
+            SerializerOfInstance,
+            SerializerOfEnum,
+            SerializerOfAggregation,
+            SerializerOfSelect,
+            SerializersEnd,
+            SchemaEntitiesBegin,
+            SchemaEntity,
+            SchemaSupertypesBegin,
+            SchemaSupertypes,
+            SchemaEntitiesEnd,
+            SchemaAttributesBegin,
+            SchemaAttribute,
+            SchemaAttributesEnd,
+            SchemaTypePathsBegin,
+            SchemaTypePath,
+            SchemaTypePathsEnd,
+            RelationshipIndex,
+            SpatialTree,
+            PropertyTable,
+            PlacementResolver,
+            VisitBegin,
+            VisitCase,
+            VisitEnd,
+            SplitHeaderBegin,
+            SplitInclude,
+            SplitNamespaceBegin,
+            SplitNamespaceEnd,
+            SplitHeaderEnd,
+            SerializersSource,
             EndFile
         }
 
         //
         public StringBuilder m_implementations = new StringBuilder ();
+        private bool m_ifcTables = false;
+
+        //index of entity in sorted list of schema entities
+        Dictionary<ExpressHandle, int> m_entityOrdinals = new Dictionary<ExpressHandle, int>();
+
+        //type paths of SELECT values, index is type path id
+        Dictionary<string, int> m_typePathIds = new Dictionary<string, int>();
+
+        //explicit instantiations of serializers of aggregation types, once for each specialization
+        StringBuilder m_serializers = new StringBuilder();
+        HashSet<string> m_serializerKeys = new HashSet<string>();
+
+        //attributes with generated accessors, index is attribute ordinal
+        StringBuilder m_schemaAttributes = new StringBuilder();
+        int m_attributeOrdinal = 0;
+
+        /// <summary>
+        /// Code of entity or select that goes to its own header when the wrapper is split, see WriteSplitWrapper
+        /// </summary>
+        public class SplitHeader
+        {
+            public string name;
+            public StringWriter definition; //class definition of entity, classes of selects are in the core header
+            public StringBuilder implementations = new StringBuilder();
+            public List<string> parents = new List<string>();
+            public SortedSet<string> entities = new SortedSet<string>(); //classes to be complete for the implementations
+            public SortedSet<string> selects = new SortedSet<string>(); //selects or their defined types, to include implementations of select accessors
+        }
+
+        const string SplitClassesFolder = "classes";
+        const string SplitSelectsFolder = "selects";
+
+        bool m_split = false;
+        TextWriter m_coreWriter;
+        StringBuilder m_coreImplementations;
+        SplitHeader m_splitHeader;
+        Dictionary<string, SplitHeader> m_splitEntities = new Dictionary<string, SplitHeader>();
+        Dictionary<string, SplitHeader> m_splitSelects = new Dictionary<string, SplitHeader>();
+
+        //defined types of selects, name of defined type to name of select or defined type it is based on
+        public Dictionary<string, string> m_selectsOfDefinedTypes = new Dictionary<string, string>();
 
         /// <summary>
         /// 
@@ -131,7 +227,7 @@ namespace RDFWrappers
 
         public Schema m_schema;
 
-        public StreamWriter m_writer;
+        public TextWriter m_writer;
 
         public Dictionary<ExpressHandle, DefinedType.Foundation> m_writtenDefinedTyes = new Dictionary<ExpressHandle, DefinedType.Foundation>();
 
@@ -169,26 +265,390 @@ namespace RDFWrappers
         {
             using (m_writer = new StreamWriter(outputFile))
             {
-                m_replacements[KWD_NAMESPACE] = m_namespace;
+                WriteDeclarations();
 
-                WriteByTemplate(Template.BeginFile);
+                m_writer.Write (m_implementations);
 
-                WriteForwardDeclarations();
+                WriteSerializers();
 
-                WriteEnumerations();
+                WriteSchemaTables();
 
-                WriteDefinedTypes();
+                WriteVisit();
 
-                WriteSelects();
+                WriteByTemplate(Template.EndFile);
+            }
+        }
 
-                Aggregation.WriteAttributesTypes(this);
+        /// <summary>
+        /// Writes the code of WriteWrapper split into headers in outputFolder, a translation unit includes headers of entities it uses only:
+        ///     baseName_core.h - all but entities and implementations of entity accessors
+        ///     classes/ENTITY.h - class of entity
+        ///     selects/SELECT.h - implementations of entity accessors of select
+        ///     ENTITY.h - class of entity with implementations and everything its accessors need
+        ///     baseName.h - all entities
+        /// </summary>
+        public void WriteSplitWrapper(string outputFolder, string baseName)
+        {
+            Directory.CreateDirectory(Path.Combine(outputFolder, SplitClassesFolder));
+            Directory.CreateDirectory(Path.Combine(outputFolder, SplitSelectsFolder));
 
-                WriteEntities();
+            m_split = true;
 
-                m_writer.Write (m_implementations);
+            string coreFile = baseName + "_core.h";
+
+            using (m_writer = new StreamWriter(Path.Combine(outputFolder, coreFile)))
+            {
+                m_coreWriter = m_writer;
+                m_coreImplementations = m_implementations;
+
+                WriteDeclarations(); //entities and implementations go to m_splitEntities and m_splitSelects
+
+                WriteSchemaTables();
 
                 WriteByTemplate(Template.EndFile);
             }
+
+            var entityHeaders = new List<string>();
+
+            foreach (var decl in m_schema.m_declarations[RDF.enum_express_declaration.__ENTITY])
+            {
+                var header = m_splitEntities[ValidateIdentifier(decl.Key)];
+                entityHeaders.Add(header.name + ".h");
+
+                var includes = new List<string>();
+                includes.Add("../" + coreFile);
+                foreach (var parent in header.parents)
+                {
+                    includes.Add(parent + ".h");
+                }
+                WriteSplitHeader(Path.Combine(outputFolder, SplitClassesFolder, header.name + ".h"), header.name + "_CLASS", includes, header.definition.ToString());
+
+                includes.Clear();
+                includes.Add(SplitClassesFolder + "/" + header.name + ".h");
+                foreach (var parent in header.parents)
+                {
+                    includes.Add(parent + ".h");
+                }
+                foreach (var entity in header.entities)
+                {
+                    if (entity != header.name && m_splitEntities.ContainsKey(entity))
+                    {
+                        includes.Add(SplitClassesFolder + "/" + entity + ".h");
+                    }
+                }
+                foreach (var select in SplitSelectHeaders(header))
+                {
+                    includes.Add(SplitSelectsFolder + "/" + select + ".h");
+                }
+                WriteSplitHeader(Path.Combine(outputFolder, header.name + ".h"), header.name, includes, header.implementations.ToString());
+            }
+
+            foreach (var header in m_splitSelects.Values)
+            {
+                var includes = new List<string>();
+                includes.Add("../" + coreFile);
+                foreach (var entity in header.entities)
+                {
+                    if (m_splitEntities.ContainsKey(entity))
+                    {
+                        includes.Add("../" + SplitClassesFolder + "/" + entity + ".h");
+                    }
+                }
+                foreach (var select in SplitSelectHeaders(header))
+                {
+                    if (select != header.name)
+                    {
+                        includes.Add(select + ".h");
+                    }
+                }
+                WriteSplitHeader(Path.Combine(outputFolder, SplitSelectsFolder, header.name + ".h"), header.name + "_SELECT", includes, header.implementations.ToString());
+            }
+
+            var code = new StringWriter();
+            m_writer = code;
+            WriteSerializers();
+            WriteVisit();
+
+            WriteSplitHeader(Path.Combine(outputFolder, baseName + ".h"), "SPLIT", entityHeaders, code.ToString());
+        }
+
+        /// <summary>
+        /// Writes source file with explicit instantiations of serializers, call after WriteWrapper or WriteSplitWrapper
+        /// </summary>
+        public void WriteSerializersSource(string outputFile, string headerFile)
+        {
+            using (m_writer = new StreamWriter(outputFile))
+            {
+                m_replacements[KWD_INCLUDE_PATH] = headerFile;
+                WriteByTemplate(Template.SerializersSource);
+            }
+        }
+
+        /// <summary>
+        /// Writes the code from the beginning of the file to the end of entity classes
+        /// </summary>
+        private void WriteDeclarations()
+        {
+            m_replacements[KWD_NAMESPACE] = m_namespace;
+
+            foreach (var decl in m_schema.m_declarations[RDF.enum_express_declaration.__ENTITY])
+            {
+                m_entityOrdinals.Add(decl.Value, m_entityOrdinals.Count);
+            }
+
+            WriteByTemplate(Template.BeginFile);
+
+            //GlobalId, relationship, property and placement tables read IFC entities and attributes by name
+            m_ifcTables = SchemaHasEntities("IfcRoot");
+            if (m_ifcTables)
+            {
+                WriteByTemplate(Template.IfcTables);
+            }
+            WriteByTemplate(Template.ForwardDeclarationsBegin);
+
+            WriteForwardDeclarations();
+
+            WriteEnumerations();
+
+            WriteDefinedTypes();
+
+            WriteSelects();
+
+            Aggregation.WriteAttributesTypes(this);
+
+            WriteEntities();
+        }
+
+        /// <summary>
+        /// Adds explicit instantiation of the serializer of aggregation type just written by aggregationTemplate
+        /// Aggregation types with the same key are the same C++ type and share the specialization
+        /// </summary>
+        public void AddSerializer(Template aggregationTemplate, string key)
+        {
+            Template template;
+            switch (aggregationTemplate)
+            {
+                case Template.AggregationOfSimple: template = Template.SerializerOfSimple; break;
+                case Template.AggregationOfText: template = Template.SerializerOfText; break;
+                case Template.AggregationOfInstance: template = Template.SerializerOfInstance; break;
+                case Template.AggregationOfEnum: template = Template.SerializerOfEnum; break;
+                case Template.AggregationOfAggregation: template = Template.SerializerOfAggregation; break;
+                case Template.AggregationOfSelect: template = Template.SerializerOfSelect; break;
+                default:
+                    return;
+            }
+
+            if (!m_cs && m_serializerKeys.Add(key))
+            {
+                m_serializers.Append(StringByTemplate(template));
+            }
+        }
+
+        private void WriteSerializers()
+        {
+            WriteByTemplate(Template.SerializersBegin);
+            m_writer.Write(m_serializers);
+            WriteByTemplate(Template.SerializersEnd);
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        private void WriteSchemaTables()
+        {
+            WriteSchemaEntities();
+
+            WriteByTemplate(Template.SchemaAttributesBegin);
+            m_writer.Write(m_schemaAttributes);
+            WriteByTemplate(Template.SchemaAttributesEnd);
+
+            WriteSchemaTypePaths();
+
+            if (!m_cs && m_ifcTables)
+            {
+                WriteRelationshipIndex();
+                WriteSpatialTree();
+                WritePropertyTable();
+                WritePlacementResolver();
+            }
+        }
+
+        /// <summary>
+        /// Writes RelationshipIndex of IFC schemas, it reads the relationships by names of entities and attributes
+        /// </summary>
+        private void WriteRelationshipIndex()
+        {
+            if (SchemaHasEntities("IfcRelAggregates", "IfcRelContainedInSpatialStructure", "IfcRelDefinesByProperties", "IfcRelDefinesByType", "IfcRelVoidsElement", "IfcRelAssociatesMaterial"))
+            {
+                WriteByTemplate(Template.RelationshipIndex);
+            }
+        }
+
+        /// <summary>
+        /// Writes SpatialTree of IFC schemas, it reads the project decomposition and containment by names of entities and attributes
+        /// </summary>
+        private void WriteSpatialTree()
+        {
+            if (SchemaHasEntities("IfcProject", "IfcRelAggregates", "IfcRelContainedInSpatialStructure"))
+            {
+                WriteByTemplate(Template.SpatialTree);
+            }
+        }
+
+        /// <summary>
+        /// Writes PropertyTable of IFC schemas, it reads single-value properties of property sets by names of entities and attributes
+        /// </summary>
+        private void WritePropertyTable()
+        {
+            if (SchemaHasEntities("IfcRelDefinesByProperties", "IfcPropertySet", "IfcPropertySingleValue"))
+            {
+                WriteByTemplate(Template.PropertyTable);
+            }
+        }
+
+        /// <summary>
+        /// Writes PlacementResolver of IFC schemas, it reads local placements and their axis placements by names of entities and attributes
+        /// </summary>
+        private void WritePlacementResolver()
+        {
+            if (SchemaHasEntities("IfcObjectPlacement", "IfcLocalPlacement", "IfcAxis2Placement3D", "IfcAxis2Placement2D", "IfcCartesianPoint", "IfcDirection"))
+            {
+                WriteByTemplate(Template.PlacementResolver);
+            }
+        }
+
+        private bool SchemaHasEntities(params string[] names)
+        {
+            var entities = m_schema.m_declarations[RDF.enum_express_declaration.__ENTITY];
+            return names.All(name => entities.Keys.Any(k => string.Equals(k, name, StringComparison.OrdinalIgnoreCase)));
+        }
+
+        /// <summary>
+        /// Following code of entity goes to its split header until EndSplitHeader, does nothing if the wrapper is not split
+        /// Returns the header to restore by EndSplitHeader
+        /// </summary>
+        public SplitHeader BeginSplitEntity(string name, List<string> parents)
+        {
+            var previous = BeginSplitHeader(m_splitEntities, name);
+            if (m_split)
+            {
+                m_splitHeader.definition = new StringWriter();
+                m_splitHeader.parents.AddRange(parents);
+                m_writer = m_splitHeader.definition;
+            }
+            return previous;
+        }
+
+        /// <summary>
+        /// Following implementations of select accessors go to its split header until EndSplitHeader, class of select goes to the core header
+        /// </summary>
+        public SplitHeader BeginSplitSelect(string name)
+        {
+            return BeginSplitHeader(m_splitSelects, name);
+        }
+
+        private SplitHeader BeginSplitHeader(Dictionary<string, SplitHeader> headers, string name)
+        {
+            if (!m_split)
+            {
+                return null;
+            }
+
+            var previous = m_splitHeader;
+
+            m_splitHeader = new SplitHeader();
+            m_splitHeader.name = name;
+            headers.Add(name, m_splitHeader);
+
+            m_implementations = m_splitHeader.implementations;
+
+            return previous;
+        }
+
+        public void EndSplitHeader(SplitHeader previous)
+        {
+            if (!m_split)
+            {
+                return;
+            }
+
+            m_splitHeader = previous;
+
+            m_implementations = (previous != null) ? previous.implementations : m_coreImplementations;
+            m_writer = (previous != null && previous.definition != null) ? previous.definition : m_coreWriter;
+        }
+
+        /// <summary>
+        /// Code of current split header uses entity class
+        /// </summary>
+        public void SplitReferenceEntity(string entityName)
+        {
+            if (m_splitHeader != null)
+            {
+                m_splitHeader.entities.Add(ValidateIdentifier(entityName));
+            }
+        }
+
+        /// <summary>
+        /// Code of current split header uses select or defined type of select
+        /// </summary>
+        public void SplitReferenceSelect(string typeName)
+        {
+            if (m_splitHeader != null)
+            {
+                m_splitHeader.selects.Add(typeName);
+            }
+        }
+
+        /// <summary>
+        /// Returns name of select for name of select or defined type based on select
+        /// </summary>
+        public string SelectOfType(string typeName)
+        {
+            string baseName;
+            while (m_selectsOfDefinedTypes.TryGetValue(typeName, out baseName))
+            {
+                typeName = baseName;
+            }
+            return typeName;
+        }
+
+        private List<string> SplitSelectHeaders(SplitHeader header)
+        {
+            var ret = new List<string>();
+            foreach (var typeName in header.selects)
+            {
+                string name = ValidateIdentifier(SelectOfType(typeName));
+                if (m_splitSelects.ContainsKey(name) && !ret.Contains(name))
+                {
+                    ret.Add(name);
+                }
+            }
+            return ret;
+        }
+
+        private void WriteSplitHeader(string outputFile, string guard, List<string> includes, string code)
+        {
+            using (m_writer = new StreamWriter(outputFile))
+            {
+                m_replacements[KWD_HEADER_GUARD] = guard;
+                WriteByTemplate(Template.SplitHeaderBegin);
+
+                foreach (var include in includes)
+                {
+                    m_replacements[KWD_INCLUDE_PATH] = include;
+                    WriteByTemplate(Template.SplitInclude);
+                }
+
+                if (code.Length > 0)
+                {
+                    WriteByTemplate(Template.SplitNamespaceBegin);
+                    m_writer.Write(code);
+                    WriteByTemplate(Template.SplitNamespaceEnd);
+                }
+
+                WriteByTemplate(Template.SplitHeaderEnd);
+            }
         }
 
         /// <summary>
@@ -305,6 +765,12 @@ namespace RDFWrappers
 
             m_replacements[KWD_ENUM_VALUES] = values.ToString();
 
+            uint seed, mask;
+            var slots = enumeraion.GetPerfectHash(out seed, out mask);
+            m_replacements[KWD_ENUMERATION_HASH_SLOTS] = string.Join(", ", slots);
+            m_replacements[KWD_ENUMERATION_HASH_SEED] = seed.ToString();
+            m_replacements[KWD_ENUMERATION_HASH_MASK] = mask.ToString();
+
             WriteByTemplate(Template.EnumerationNames);
         }
 
@@ -338,6 +804,107 @@ namespace RDFWrappers
             }
         }
 
+        /// <summary>
+        /// Writes entities of the schema with their direct supertypes, indexed by entity ordinal
+        /// </summary>
+        private void WriteSchemaEntities()
+        {
+            WriteByTemplate(Template.SchemaEntitiesBegin);
+
+            int offset = 0;
+            foreach (var decl in m_schema.m_declarations[RDF.enum_express_declaration.__ENTITY])
+            {
+                var entity = new Entity(decl.Value);
+                m_replacements[KWD_ENTITY_NAME] = entity.name; //schema name to look up SdaiEntity
+                m_replacements[KWD_SUPERTYPES_OFFSET] = offset.ToString();
+                WriteByTemplate(Template.SchemaEntity);
+
+                offset += entity.GetSupertypes().Count + 1;
+            }
+
+            WriteByTemplate(Template.SchemaSupertypesBegin);
+
+            foreach (var decl in m_schema.m_declarations[RDF.enum_express_declaration.__ENTITY])
+            {
+                var entity = new Entity(decl.Value);
+                var supertypes = new StringBuilder();
+                foreach (var parentId in entity.GetSupertypes())
+                {
+                    supertypes.Append(m_entityOrdinals[parentId]);
+                    supertypes.Append(", ");
+                }
+
+                m_replacements[KWD_ENTITY_NAME] = entity.name; //schema name to look up SdaiEntity
+                m_replacements[KWD_SUPERTYPE_ORDINALS] = supertypes.ToString();
+                WriteByTemplate(Template.SchemaSupertypes);
+            }
+
+            WriteByTemplate(Template.SchemaEntitiesEnd);
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public int EntityOrdinal(ExpressHandle entity)
+        {
+            return m_entityOrdinals[entity];
+        }
+
+        /// <summary>
+        /// Sets type name of SELECT value and its type path id
+        /// </summary>
+        public void SetSelectTypeName(string typeName)
+        {
+            var upper = typeName.ToUpper();
+
+            int id;
+            if (!m_typePathIds.TryGetValue(upper, out id))
+            {
+                id = m_typePathIds.Count;
+                m_typePathIds.Add(upper, id);
+            }
+
+            m_replacements[KWD_TypeNameUpper] = upper;
+            m_replacements[KWD_TYPE_PATH_ID] = id.ToString();
+        }
+
+        /// <summary>
+        /// Writes type paths of SELECT values, indexed by type path id
+        /// </summary>
+        private void WriteSchemaTypePaths()
+        {
+            WriteByTemplate(Template.SchemaTypePathsBegin);
+
+            foreach (var typePath in m_typePathIds.OrderBy(p => p.Value))
+            {
+                m_replacements[KWD_TypeNameUpper] = typePath.Key;
+                WriteByTemplate(Template.SchemaTypePath);
+            }
+
+            WriteByTemplate(Template.SchemaTypePathsEnd);
+        }
+
+        /// <summary>
+        /// Writes dispatch of instances to classes of their exact entities, by entity ordinal
+        /// </summary>
+        private void WriteVisit()
+        {
+            WriteByTemplate(Template.VisitBegin);
+
+            foreach (var decl in m_schema.m_declarations[RDF.enum_express_declaration.__ENTITY])
+            {
+                var entity = new Entity(decl.Value);
+                if (!entity.IsAbstract())
+                {
+                    m_replacements[KWD_ENTITY_NAME] = ValidateIdentifier(entity.name);
+                    m_replacements[KWD_ENTITY_ORDINAL] = m_entityOrdinals[decl.Value].ToString();
+                    WriteByTemplate(Template.VisitCase);
+                }
+            }
+
+            WriteByTemplate(Template.VisitEnd);
+        }
+
         /// <summary>
         /// 
         /// </summary>
@@ -369,6 +936,9 @@ namespace RDFWrappers
 
             string baseClass = "";
             var parentAttributes = new HashSet<string>();
+            var parentNames = new List<string>();
+            var attributeBases = new List<string>(); //attr derives from supertypes not reached through other supertypes, to avoid ambiguous bases
+            var supertypeConversions = new List<string>(); //flat entity class derives from the first supertype, others are reached by conversion
 
             foreach (var parentId in superTypes)
             {
@@ -376,11 +946,25 @@ namespace RDFWrappers
 
                 WriteEntity(parent, wroteEntities);
 
-                if (baseClass.Length != 0)
+                if (baseClass.Length == 0)
+                {
+                    baseClass = ValidateIdentifier(parent.name);
+                }
+                else
+                {
+                    baseClass += " RDF_EXPRESS_SUPERTYPE(" + ValidateIdentifier(parent.name) + ")";
+
+                    if (!new Entity(superTypes[0]).IsFirstParentsAncestor(parentId))
+                    {
+                        supertypeConversions.Add(ValidateIdentifier(parent.name));
+                    }
+                }
+                parentNames.Add(ValidateIdentifier(parent.name));
+
+                if (!superTypes.Any(otherId => otherId != parentId && new Entity(otherId).IsAncestor(parentId)))
                 {
-                    baseClass += ", public virtual ";
+                    attributeBases.Add(ValidateIdentifier(parent.name));
                 }
-                baseClass += ValidateIdentifier(parent.name);
 
                 GetAttributeNames(parentAttributes, parent);
             }
@@ -396,10 +980,19 @@ namespace RDFWrappers
             string clsName = ValidateIdentifier(entity.name);
             m_replacements[KWD_BASE_CLASS] = baseClass;
             m_replacements[KWD_ENTITY_NAME] = clsName;
+            m_replacements[KWD_ENTITY_ORDINAL] = m_entityOrdinals[entity.sdaiEntity].ToString();
+
+            var outerSplitHeader = BeginSplitEntity(clsName, parentNames);
 
             //
             WriteByTemplate(Template.EntityBegin);
 
+            foreach (var supertype in supertypeConversions)
+            {
+                m_replacements[KWD_REF_ENTITY] = supertype;
+                WriteByTemplate(Template.EntitySupertypeConversion);
+            }
+
             if (!entity.IsAbstract())
             {
                 WriteByTemplate(Template.EntityCreateMethod);
@@ -407,9 +1000,19 @@ namespace RDFWrappers
 
             WriteSubEntityesCreation(entity);
                 
-            WriteAttributes(entity, parentAttributes);
+            var attributeOrdinals = WriteAttributes(entity, parentAttributes);
+
+            if (!m_cs)
+            {
+                m_replacements[KWD_SUPERTYPE_ATTRIBUTES] = (attributeBases.Count > 0) ? string.Join(", ", attributeBases.Select(p => p + "::attr")) : "Entity::attr";
+                WriteByTemplate(Template.EntityAttributesBegin);
+                m_writer.Write(attributeOrdinals);
+                WriteByTemplate(Template.EntityAttributesEnd);
+            }
 
             WriteByTemplate(Template.EntityEnd);
+
+            EndSplitHeader(outerSplitHeader);
         }
 
         private void WriteSubEntityesCreation(Entity entity)
@@ -474,10 +1077,12 @@ namespace RDFWrappers
         }
 
         /// <summary>
-        /// 
+        /// Writes accessors of attributes not exported by supertypes, returns members of attr struct with their ordinals
         /// </summary>
-        private void WriteAttributes(Entity entity, HashSet<string> exportedAttributes)
+        private StringBuilder WriteAttributes(Entity entity, HashSet<string> exportedAttributes)
         {
+            var attributeOrdinals = new StringBuilder();
+
             var attribs = entity.GetAttributes();
             foreach (var attr in attribs)
             {
@@ -485,6 +1090,9 @@ namespace RDFWrappers
 
                 if (exportedAttributes.Add(attr.name))
                 {
+                    m_replacements[KWD_ATTR_ORDINAL] = (m_attributeOrdinal++).ToString();
+                    m_schemaAttributes.Append(StringByTemplate(Template.SchemaAttribute));
+
                     if (!attr.IsAggregation ())
                     {
                         WriteSingeAttribute(attr);
@@ -493,8 +1101,16 @@ namespace RDFWrappers
                     {
                         Aggregation.WriteAttribute(this, attr);
                     }
+
+                    if (!m_cs)
+                    {
+                        attributeOrdinals.Append(StringByTemplate(Template.EntityAttribute));
+                        m_implementations.Append(StringByTemplate(Template.AttributeOrdinalAccessor));
+                    }
                 }
             }
+
+            return attributeOrdinals;
         }
 
         /// <summary>
@@ -552,7 +1168,19 @@ namespace RDFWrappers
             Template tplGet = baseType == "TextValue" ? Template.AttributeTextGet : Template.AttributeSimpleGet;
             Template tplPut = baseType == "TextValue" ? Template.AttributeTextPut : Template.AttributeSimplePut;
 
+            if (!m_cs && m_ifcTables && definedType == "IfcGloballyUniqueId" && attr.name == "GlobalId")
+                {
+                //IfcRoot, put keeps live GlobalIdIndex consistent
+                tplPut = Template.AttributeGlobalIdPut;
+                m_implementations.Append(StringByTemplate(Template.GlobalIdIndex));
+                }
+
             WriteGetPut(tplGet, tplPut, attr.explicit_);
+
+            if (!m_cs && baseType == "TextValue" && sdaiType == "sdaiSTRING")
+                {
+                WriteByTemplate(Template.AttributeTextGetUtf8);
+                }
         }
 
         public void WriteGetPut(Template tplGet, Template tplPut, bool explicit_)
@@ -587,6 +1215,7 @@ namespace RDFWrappers
         private void WriteEntityReference (Attribute attr, string domain)
         {
             m_replacements[KWD_REF_ENTITY] = domain;
+            SplitReferenceEntity(domain);
 
             WriteGetPut(Template.AttributeEntityGet, Template.AttributeEntityPut, attr.explicit_);
 
@@ -619,6 +1248,7 @@ namespace RDFWrappers
             generator.m_writer.WriteLine();
 
             generator.m_replacements[Generator.KWD_TYPE_NAME] = Generator.ValidateIdentifier(selectName);
+            generator.SplitReferenceSelect(selectName);
 
             if (!m_cs || !attr.explicit_)
                 {
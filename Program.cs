@@ -28,6 +28,9 @@ namespace RDFWrappers
 
             [CommandLine.Option("printSchema", Default = false, HelpText = "Print parsed schema.")]
             public bool printSchema { get; set; }
+
+            [CommandLine.Option("split", Default = false, HelpText = "Also split c++ header into headers of entities, in the folder named as c++ header file.")]
+            public bool split { get; set; }
         }
 
         static int Main(string[] args)
@@ -149,6 +152,20 @@ namespace RDFWrappers
                 Console.WriteLine("Generate C++ header file " + options.hFile);
                 Generator cppgen = new Generator(schema, false, options.Namespace);
                 cppgen.WriteWrapper(options.hFile);
+
+                string hName = System.IO.Path.GetFileNameWithoutExtension(options.hFile);
+                string hDir = System.IO.Path.GetDirectoryName(options.hFile);
+
+                cppgen.WriteSerializersSource(System.IO.Path.Combine(hDir, hName + "_serializers.cpp"), hName + ".h");
+
+                if (options.split)
+                {
+                    string splitDir = System.IO.Path.Combine(hDir, hName);
+                    Console.WriteLine("Generate split C++ headers in " + splitDir);
+                    Generator splitgen = new Generator(schema, false, options.Namespace);
+                    splitgen.WriteSplitWrapper(splitDir, hName);
+                    splitgen.WriteSerializersSource(System.IO.Path.Combine(splitDir, hName + "_serializers.cpp"), hName + ".h");
+                }
             }
             else
             {
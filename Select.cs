@@ -154,11 +154,18 @@ namespace RDFWrappers
                 return;
             }
 
-            foreach (var nested in GetNestedSelects(generator))
+            var nestedSelects = GetNestedSelects(generator);
+            foreach (var nested in nestedSelects)
             {
                 WriteNestedSelect(generator, nested, visitedSelects);
             }
 
+            var outerSplitHeader = generator.BeginSplitSelect(Generator.ValidateIdentifier(name));
+            foreach (var nested in nestedSelects)
+            {
+                generator.SplitReferenceSelect(Schema.GetNameOfDeclaration(nested));
+            }
+
             generator.m_replacements[Generator.KWD_TYPE_NAME] = Generator.ValidateIdentifier (name);
 
             bool?[] gettypes = null;
@@ -213,6 +220,7 @@ namespace RDFWrappers
                 generator.WriteByTemplate(Generator.Template.SelectAccessorEnd);
             }
 
+            generator.EndSplitHeader(outerSplitHeader);
         }
 
         private void WriteAccessorMethod(Generator generator, ExpressHandle selectVariant, bool? bGet)
@@ -257,7 +265,7 @@ namespace RDFWrappers
         { 
             generator.m_replacements[Generator.KWD_ENUMERATION_NAME] = enumName;
             generator.m_replacements[Generator.KWD_TypeNameIFC] = ifcTypeName;
-            generator.m_replacements[Generator.KWD_TypeNameUpper] = ifcTypeName.ToUpper();
+            generator.SetSelectTypeName(ifcTypeName);
             generator.m_replacements[Generator.KWD_ENUMERATION_VALUES_ARRAY] = enumValuesArray;
 
             if (bGet.HasValue)
@@ -288,7 +296,9 @@ namespace RDFWrappers
             generator.m_replacements[Generator.KWD_REF_ENTITY] = Generator.ValidateIdentifier (entityType.name);
             generator.m_replacements[Generator.KWD_TypeNameIFC] = entityType.name;
             generator.m_replacements[Generator.KWD_TypeNameUpper] = entityType.name.ToUpper();
+            generator.m_replacements[Generator.KWD_ENTITY_ORDINAL] = generator.EntityOrdinal(entityType.sdaiEntity).ToString();
             generator.m_replacements[Generator.KWD_suffix] = GetPropNameSuffix(generator, entityType.name);
+            generator.SplitReferenceEntity(entityType.name);
 
             if (bGet.HasValue)
             {
@@ -361,7 +371,7 @@ namespace RDFWrappers
             generator.m_replacements[Generator.KWD_TextType] = definedType.name;
             generator.m_replacements[Generator.KWD_sdaiTYPE] = sdaiType;
             generator.m_replacements[Generator.KWD_TypeNameIFC] = definedType.name;
-            generator.m_replacements[Generator.KWD_TypeNameUpper] = definedType.name.ToUpper();
+            generator.SetSelectTypeName(definedType.name);
             generator.m_replacements[Generator.KWD_BaseCType] = baseType;
 
             Generator.Template tplGet;
@@ -408,7 +418,7 @@ namespace RDFWrappers
             generator.m_replacements[Generator.KWD_REF_ENTITY] = elemType;
             generator.m_replacements[Generator.KWD_sdaiTYPE] = sdaiType;
             generator.m_replacements[Generator.KWD_TypeNameIFC] = definedType.name;
-            generator.m_replacements[Generator.KWD_TypeNameUpper] = definedType.name.ToUpper();
+            generator.SetSelectTypeName(definedType.name);
 
             if (bGet.HasValue)
             {
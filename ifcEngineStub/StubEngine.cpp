@@ -0,0 +1,1075 @@
+//
+// In-memory stand-in for the subset of ifcengine API used by generated early-binding wrappers
+// Lets the wrappers and examples build, run and be measured where ifcengine library is not available
+// It is not STEP engine: no file reading or writing, no EXPRESS rules, inverse and derived attributes are never set
+// Get-functions may be called for one model from several threads, put-functions and instance creation may not
+//
+#include    <string.h>
+#include    <stdio.h>
+#include    <math.h>
+#include    <strings.h>
+#include    <string>
+#include    <vector>
+#include    <deque>
+#include    <memory>
+#include    <mutex>
+#include    <unordered_map>
+
+#include    "ifcengine.h"
+#include    "StubSchema.h"
+
+//ifcengine.h undefines its linkage macros at the end, stand-in is built as static library
+#define     DECL
+#define     STDC
+
+namespace ifcEngineStub
+{
+    struct Entity;
+    struct Model;
+    struct Instance;
+    struct Aggregation;
+
+    /// <summary>
+    /// Case-insensitive hash and comparison of names, keys point to names owned by the schema
+    /// </summary>
+    struct NameHash
+    {
+        size_t operator()(const char* name) const
+        {
+            size_t h = 2166136261u;
+            for (; *name; name++) {
+                h = (h ^ (unsigned char) toupper((unsigned char) *name)) * 16777619u;
+            }
+            return h;
+        }
+    };
+
+    struct NameEqual
+    {
+        bool operator()(const char* name1, const char* name2) const { return 0 == strcasecmp(name1, name2); }
+    };
+
+    template <typename T> using NameMap = std::unordered_map<const char*, T, NameHash, NameEqual>;
+
+    /// <summary>
+    /// Owns copies of strings for the lifetime of a model or ADB
+    /// </summary>
+    class TextArena
+    {
+    public:
+        TextArena() : m_used(0), m_size(0) {}
+
+        const char* Copy(const char* text) { return Copy(text, strlen(text)); }
+
+        const char* Copy(const char* text, size_t len)
+        {
+            char* buffer = Allocate(len + 1);
+            memcpy(buffer, text, len);
+            buffer[len] = 0;
+            return buffer;
+        }
+
+        //
+        // One copy per distinct text, for type paths which come from a small set and are put again with every value
+        //
+        const char* Intern(const char* text)
+        {
+            auto it = m_interned.find(text);
+            if (it == m_interned.end()) {
+                const char* copy = Copy(text);
+                it = m_interned.emplace(copy, copy).first;
+            }
+            return it->second;
+        }
+
+        void Clear()
+        {
+            m_blocks.clear();
+            m_interned.clear();
+            m_used = m_size = 0;
+        }
+
+        //
+        // Drops all texts but keeps the last block, following copies overwrite texts returned before
+        //
+        void Reuse()
+        {
+            if (m_blocks.size() > 1) {
+                m_blocks.erase(m_blocks.begin(), m_blocks.end() - 1);
+            }
+            m_interned.clear();
+            m_used = 0;
+        }
+
+    private:
+        char* Allocate(size_t size)
+        {
+            const size_t BLOCK_SIZE = 4096;
+            if (m_used + size > m_size) {
+                m_size = size > BLOCK_SIZE ? size : BLOCK_SIZE;
+                m_blocks.push_back(std::unique_ptr<char[]>(new char[m_size]));
+                m_used = 0;
+            }
+            char* buffer = m_blocks.back().get() + m_used;
+            m_used += size;
+            return buffer;
+        }
+
+    private:
+        std::vector<std::unique_ptr<char[]>>    m_blocks;
+        NameMap<const char*>                    m_interned;
+        size_t                                  m_used;
+        size_t                                  m_size;
+    };
+
+    /// <summary>
+    /// Attribute definition, SdaiAttr handle
+    /// </summary>
+    struct Attribute
+    {
+        const Entity*   entity;
+        std::string     name;
+    };
+
+    /// <summary>
+    /// Entity definition, SdaiEntity handle
+    /// </summary>
+    struct Entity
+    {
+        size_t                          index;
+        std::string                     name;
+        std::string                     upperName;      //type path of instances in ADB
+        std::vector<Entity*>            supertypes;
+        std::vector<bool>               kindOf;         //indexed by entity index, true for the entity itself and all its supertypes
+        NameMap<const Attribute*>       attributes;     //own and inherited
+        bool                            resolved;
+
+        bool IsKindOf(const Entity* other) const { return kindOf[other->index]; }
+    };
+
+    /// <summary>
+    ///
+    /// </summary>
+    struct Schema
+    {
+        std::string             name;
+        std::deque<Entity>      entities;
+        std::deque<Attribute>   attributes;
+        NameMap<Entity*>        entitiesByName;
+    };
+
+    /// <summary>
+    /// Value of attribute, aggregation member or ADB
+    /// BOOLEAN and LOGICAL values are kept as enumeration values "T", "F", "U"
+    /// </summary>
+    struct Value
+    {
+        enum class Kind : unsigned char { Unset, Integer, Real, Enum, String, Binary, Instance, Aggr };
+
+        Kind            kind;
+        union
+        {
+            int_t           integer;
+            double          real;
+            const char*     text;
+            Instance*       instance;
+            Aggregation*    aggr;
+        };
+        const char*     typePath;   //set when the value was put through ADB with type path
+
+        Value() : kind(Kind::Unset), integer(0), typePath(NULL) {}
+    };
+
+    /// <summary>
+    /// SdaiADB handle
+    /// ADBs created by sdaiCreateADB/sdaiCreateEmptyADB are deleted by sdaiDeleteADB, ADBs returned by get-functions belong to the model
+    /// </summary>
+    struct ADB
+    {
+        static const uint64_t MAGIC = 0x53444149414442ull;
+
+        uint64_t    magic;
+        Value       value;
+        Model*      model;
+        TextArena   texts;
+
+        ADB(Model* owner) : magic(MAGIC), model(owner) {}
+        ~ADB() { magic = 0; }
+
+        //
+        // Value got to ADB of caller: texts and type path are copies owned by the ADB, as in the engine
+        // they are valid until the ADB gets next value or is deleted
+        //
+        void Assign(const Value& src)
+        {
+            texts.Reuse();
+            value = src;
+            if (value.kind == Value::Kind::Enum || value.kind == Value::Kind::String || value.kind == Value::Kind::Binary) {
+                value.text = texts.Copy(value.text);
+            }
+            if (value.typePath) {
+                value.typePath = texts.Copy(value.typePath);
+            }
+        }
+
+        static ADB* FromHandle(const void* handle)
+        {
+            uint64_t magic = 0;
+            if (handle) {
+                memcpy(&magic, handle, sizeof(magic));
+            }
+            return magic == MAGIC ? (ADB*) handle : NULL;
+        }
+    };
+
+    /// <summary>
+    /// SdaiInstance handle
+    /// </summary>
+    struct Instance
+    {
+        Model*                                          model;
+        const Entity*                                   entity;
+        std::vector<std::pair<const Attribute*, Value>> values;
+
+        Value* Find(const Attribute* attr)
+        {
+            for (auto& v : values) {
+                if (v.first == attr) {
+                    return &v.second;
+                }
+            }
+            return NULL;
+        }
+    };
+
+    /// <summary>
+    /// SdaiAggr handle
+    /// </summary>
+    struct Aggregation
+    {
+        Model*              model;
+        std::vector<Value>  members;
+        size_t              version;    //model version the extent was collected at, extents only
+    };
+
+    /// <summary>
+    /// SdaiIterator handle
+    /// </summary>
+    struct Iterator
+    {
+        Aggregation*    aggr;
+        int_t           position;
+    };
+
+    /// <summary>
+    /// SdaiModel handle
+    /// Closed models are emptied but not freed, so model handles are never reused and caches keyed by model stay valid
+    /// </summary>
+    struct Model
+    {
+        const Schema*                   schema;
+        std::deque<Instance>            instances;
+        std::deque<Aggregation>         aggregations;
+        std::deque<ADB>                 adbs;
+        std::vector<Aggregation*>       extents;                //by entity index, instances of the exact entity
+        std::vector<Aggregation*>       extentsWithSubtypes;    //by entity index
+        size_t                          version;                //incremented when instance is created or deleted
+        TextArena                       texts;
+        enum_string_encoding            encoding;               //recorded only, texts are kept as put
+        std::mutex                      reads;                  //get-functions add converted texts, ADBs and extents under it
+
+        void Clear()
+        {
+            instances.clear();
+            aggregations.clear();
+            adbs.clear();
+            extents.clear();
+            extentsWithSubtypes.clear();
+            texts.Clear();
+            schema = NULL;
+        }
+
+        Aggregation* NewAggregation()
+        {
+            aggregations.emplace_back();
+            Aggregation* aggr = &aggregations.back();
+            aggr->model = this;
+            aggr->version = 0;
+            return aggr;
+        }
+    };
+
+    /// <summary>
+    ///
+    /// </summary>
+    struct Engine
+    {
+        std::mutex                              mutex;
+        std::deque<Schema>                      schemas;
+        std::vector<std::unique_ptr<Model>>     models;
+        std::vector<std::unique_ptr<Model>>     closedModels;
+        enum_string_encoding                    encoding = enum_string_encoding::IGNORE_DEFAULT;   //for models created later
+
+        static Engine& Get()
+        {
+            static Engine engine;
+            return engine;
+        }
+
+        const Schema* FindSchema(const char* name)
+        {
+            static std::once_flag registered;
+            std::call_once(registered, RegisterSchemas);
+
+            for (auto& schema : schemas) {
+                if (0 == strcasecmp(schema.name.c_str(), name)) {
+                    return &schema;
+                }
+            }
+            return NULL;
+        }
+    };
+
+    //
+    //
+    static void ResolveEntity(Schema& schema, Entity& entity)
+    {
+        if (entity.resolved) {
+            return;
+        }
+        entity.resolved = true;
+
+        entity.kindOf.resize(schema.entities.size(), false);
+        entity.kindOf[entity.index] = true;
+
+        for (auto parent : entity.supertypes) {
+            ResolveEntity(schema, *parent);
+            for (size_t i = 0; i < schema.entities.size(); i++) {
+                if (parent->kindOf[i]) {
+                    entity.kindOf[i] = true;
+                }
+            }
+            for (auto& attr : parent->attributes) {
+                entity.attributes.insert(attr);
+            }
+        }
+    }
+
+    void RegisterSchema(const char* schemaName, const SchemaEntity* entities, size_t entityCount, const SchemaAttribute* attributes, size_t attributeCount)
+    {
+        Engine::Get().schemas.emplace_back();
+        Schema& schema = Engine::Get().schemas.back();
+        schema.name = schemaName;
+
+        for (size_t i = 0; i < entityCount; i++) {
+            schema.entities.emplace_back();
+            Entity& entity = schema.entities.back();
+            entity.index = i;
+            entity.name = entities[i].name;
+            entity.upperName = entity.name;
+            for (auto& c : entity.upperName) {
+                c = (char) toupper((unsigned char) c);
+            }
+            entity.resolved = false;
+        }
+
+        for (size_t i = 0; i < entityCount; i++) {
+            Entity& entity = schema.entities[i];
+            schema.entitiesByName[entity.name.c_str()] = &entity;
+            for (const int_t* parent = entities[i].supertypes; *parent >= 0; parent++) {
+                entity.supertypes.push_back(&schema.entities[*parent]);
+            }
+        }
+
+        for (size_t i = 0; i < attributeCount; i++) {
+            auto it = schema.entitiesByName.find(attributes[i].entityName);
+            if (it != schema.entitiesByName.end()) {
+                schema.attributes.push_back({it->second, attributes[i].attrName});
+                Attribute& attr = schema.attributes.back();
+                it->second->attributes[attr.name.c_str()] = &attr;
+            }
+        }
+
+        for (auto& entity : schema.entities) {
+            ResolveEntity(schema, entity);
+        }
+    }
+
+    //
+    //
+    static const char* LogicalText(SdaiBoolean value)
+    {
+        return value ? "T" : "F";
+    }
+
+    //
+    // Sets dst from caller's value, conventions of put-functions: numbers by pointer, others by value
+    // Text is copied to the arena
+    //
+    static bool PutValue(Value& dst, SdaiPrimitiveType valueType, const void* value, TextArena& texts)
+    {
+        Value v;
+        switch (valueType) {
+            case sdaiINTEGER:
+                v.kind = Value::Kind::Integer;
+                v.integer = *(const int_t*) value;
+                break;
+            case sdaiREAL:
+            case sdaiNUMBER:
+                v.kind = Value::Kind::Real;
+                v.real = *(const double*) value;
+                break;
+            case sdaiBOOLEAN:
+                v.kind = Value::Kind::Enum;
+                v.text = LogicalText(*(const SdaiBoolean*) value);
+                break;
+            case sdaiLOGICAL:
+            case sdaiENUM:
+                if (!value) {
+                    return false;
+                }
+                v.kind = Value::Kind::Enum;
+                v.text = texts.Copy((const char*) value);
+                break;
+            case sdaiSTRING:
+            case sdaiEXPRESSSTRING:
+                if (!value) {
+                    break; //unset
+                }
+                v.kind = Value::Kind::String;
+                v.text = texts.Copy((const char*) value);
+                break;
+            case sdaiBINARY:
+                if (!value) {
+                    break; //unset
+                }
+                v.kind = Value::Kind::Binary;
+                v.text = texts.Copy((const char*) value);
+                break;
+            case sdaiINSTANCE:
+                if (value) {
+                    v.kind = Value::Kind::Instance;
+                    v.instance = (Instance*) value;
+                }
+                break;
+            case sdaiAGGR:
+                if (value) {
+                    v.kind = Value::Kind::Aggr;
+                    v.aggr = (Aggregation*) value;
+                }
+                break;
+            case sdaiADB:
+            {
+                ADB* adb = ADB::FromHandle(value);
+                if (!adb) {
+                    return false;
+                }
+                v = adb->value;
+                if (v.kind == Value::Kind::Enum || v.kind == Value::Kind::String || v.kind == Value::Kind::Binary) {
+                    v.text = texts.Copy(v.text);
+                }
+                if (v.typePath) {
+                    v.typePath = texts.Intern(v.typePath);
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+
+        dst = v;
+        return true;
+    }
+
+    //
+    // Writes src to caller's buffer, conventions of get-functions, returns NULL if the value can not be converted to valueType
+    // Converted text is placed to the arena
+    //
+    static void* GetValue(const Value& src, SdaiPrimitiveType valueType, void* value, TextArena& texts, Model* model)
+    {
+        switch (valueType) {
+            case sdaiINTEGER:
+                if (src.kind == Value::Kind::Integer) {
+                    *(int_t*) value = src.integer;
+                }
+                else if (src.kind == Value::Kind::Real) {
+                    *(int_t*) value = (int_t) llround(src.real);
+                }
+                else {
+                    return NULL;
+                }
+                return value;
+
+            case sdaiREAL:
+            case sdaiNUMBER:
+                if (src.kind == Value::Kind::Integer) {
+                    *(double*) value = (double) src.integer;
+                }
+                else if (src.kind == Value::Kind::Real) {
+                    *(double*) value = src.real;
+                }
+                else {
+                    return NULL;
+                }
+                return value;
+
+            case sdaiBOOLEAN:
+                if (src.kind == Value::Kind::Enum && (0 == strcmp(src.text, "T") || 0 == strcmp(src.text, "F"))) {
+                    *(SdaiBoolean*) value = (src.text[0] == 'T') ? sdaiTRUE : sdaiFALSE;
+                    return value;
+                }
+                return NULL;
+
+            case sdaiLOGICAL:
+                if (src.kind == Value::Kind::Enum && (0 == strcmp(src.text, "T") || 0 == strcmp(src.text, "F") || 0 == strcmp(src.text, "U"))) {
+                    *(const char**) value = src.text;
+                    return value;
+                }
+                return NULL;
+
+            case sdaiENUM:
+                if (src.kind == Value::Kind::Enum) {
+                    *(const char**) value = src.text;
+                    return value;
+                }
+                return NULL;
+
+            case sdaiBINARY:
+                if (src.kind == Value::Kind::Binary) {
+                    *(const char**) value = src.text;
+                    return value;
+                }
+                return NULL;
+
+            case sdaiSTRING:
+            case sdaiEXPRESSSTRING:
+                if (src.kind == Value::Kind::Enum || src.kind == Value::Kind::String || src.kind == Value::Kind::Binary) {
+                    *(const char**) value = src.text;
+                }
+                else if (src.kind == Value::Kind::Integer || src.kind == Value::Kind::Real) {
+                    char buffer[64];
+                    if (src.kind == Value::Kind::Integer) {
+                        snprintf(buffer, sizeof(buffer), "%lld", (long long) src.integer);
+                    }
+                    else {
+                        snprintf(buffer, sizeof(buffer), "%.15g", src.real);
+                    }
+                    std::unique_lock<std::mutex> lock;
+                    if (model) {
+                        lock = std::unique_lock<std::mutex>(model->reads);
+                    }
+                    *(const char**) value = texts.Copy(buffer);
+                }
+                else {
+                    return NULL;
+                }
+                return value;
+
+            case sdaiINSTANCE:
+                if (src.kind == Value::Kind::Instance) {
+                    *(SdaiInstance*) value = (SdaiInstance) src.instance;
+                    return src.instance;
+                }
+                return NULL;
+
+            case sdaiAGGR:
+                if (src.kind == Value::Kind::Aggr) {
+                    *(SdaiAggr*) value = (SdaiAggr) src.aggr;
+                    return src.aggr;
+                }
+                return NULL;
+
+            case sdaiADB:
+            {
+                if (src.kind == Value::Kind::Unset) {
+                    return NULL;
+                }
+                //either empty ADB created by caller or pointer to receive ADB owned by the model
+                ADB* adb = ADB::FromHandle(value);
+                if (!adb) {
+                    if (!model) {
+                        return NULL;
+                    }
+                    std::lock_guard<std::mutex> lock(model->reads);
+                    model->adbs.emplace_back(model);
+                    adb = &model->adbs.back();
+                    *(SdaiADB*) value = adb;
+                    adb->value = src;
+                    return adb;
+                }
+                adb->Assign(src);
+                return adb;
+            }
+        }
+        return NULL;
+    }
+
+    //
+    //
+    static Value* FindValue(SdaiInstance instance, const SdaiAttr attribute)
+    {
+        Instance* inst = (Instance*) instance;
+        const Attribute* attr = (const Attribute*) attribute;
+        if (!inst || !attr) {
+            return NULL;
+        }
+        return inst->Find(attr);
+    }
+
+    //
+    //
+    static Value* PrepareValue(SdaiInstance instance, const SdaiAttr attribute)
+    {
+        Instance* inst = (Instance*) instance;
+        const Attribute* attr = (const Attribute*) attribute;
+        if (!inst || !attr || !inst->model || !inst->entity->IsKindOf(attr->entity)) {
+            return NULL;
+        }
+        Value* v = inst->Find(attr);
+        if (!v) {
+            inst->values.emplace_back(attr, Value());
+            v = &inst->values.back().second;
+        }
+        return v;
+    }
+
+    //
+    //
+    static SdaiAttr FindAttribute(SdaiInstance instance, SdaiString attributeName)
+    {
+        Instance* inst = (Instance*) instance;
+        if (!inst || !inst->model || !attributeName) {
+            return NULL;
+        }
+        auto it = inst->entity->attributes.find(attributeName);
+        return it != inst->entity->attributes.end() ? (SdaiAttr) it->second : NULL;
+    }
+
+    //
+    //
+    static Aggregation* CollectExtent(Model* model, Entity* entity, bool withSubtypes)
+    {
+        std::vector<Aggregation*>& extents = withSubtypes ? model->extentsWithSubtypes : model->extents;
+        if (extents.empty()) {
+            extents.resize(model->schema->entities.size(), NULL);
+        }
+
+        Aggregation*& extent = extents[entity->index];
+        if (!extent) {
+            extent = model->NewAggregation();
+            extent->version = (size_t) -1;
+        }
+
+        if (withSubtypes && extent->version != model->version) {
+            extent->members.clear();
+            if (!model->extents.empty()) {
+                for (auto& sub : model->schema->entities) {
+                    if (sub.IsKindOf(entity) && model->extents[sub.index]) {
+                        auto& members = model->extents[sub.index]->members;
+                        extent->members.insert(extent->members.end(), members.begin(), members.end());
+                    }
+                }
+            }
+            extent->version = model->version;
+        }
+
+        return extent;
+    }
+}
+
+using namespace ifcEngineStub;
+
+//
+// Models
+//
+
+SdaiModel DECL STDC sdaiCreateModelBN(SdaiRep /*repository*/, SdaiString /*fileName*/, SdaiString schemaName)
+{
+    Engine& engine = Engine::Get();
+    std::lock_guard<std::mutex> lock(engine.mutex);
+
+    const Schema* schema = schemaName ? engine.FindSchema(schemaName) : NULL;
+    if (!schema) {
+        return 0;
+    }
+
+    engine.models.push_back(std::unique_ptr<Model>(new Model()));
+    Model* model = engine.models.back().get();
+    model->schema = schema;
+    model->version = 0;
+    model->encoding = engine.encoding;
+    return (SdaiModel) model;
+}
+
+void DECL STDC sdaiCloseModel(SdaiModel model)
+{
+    Engine& engine = Engine::Get();
+    std::lock_guard<std::mutex> lock(engine.mutex);
+
+    for (auto it = engine.models.begin(); it != engine.models.end(); it++) {
+        if ((SdaiModel) it->get() == model) {
+            (*it)->Clear();
+            engine.closedModels.push_back(std::move(*it));
+            engine.models.erase(it);
+            return;
+        }
+    }
+}
+
+void DECL STDC sdaiSaveModelBN(SdaiModel /*model*/, SdaiString /*fileName*/)
+{
+    //not supported by the stand-in
+}
+
+int_t DECL STDC engiSetStringEncoding(SdaiModel model, enum_string_encoding encoding)
+{
+    Engine& engine = Engine::Get();
+    std::lock_guard<std::mutex> lock(engine.mutex);
+
+    if (!model) {
+        engine.encoding = encoding;
+        return 1;
+    }
+
+    for (auto& m : engine.models) {
+        if ((SdaiModel) m.get() == model) {
+            m->encoding = encoding;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int_t DECL STDC SetSPFFHeaderItem(SdaiModel /*model*/, int_t /*itemIndex*/, int_t /*itemSubIndex*/, SdaiPrimitiveType /*valueType*/, const void* /*value*/)
+{
+    //not supported by the stand-in
+    return 0;
+}
+
+//
+// Schema
+//
+
+SdaiEntity DECL STDC sdaiGetEntity(SdaiModel model, SdaiString entityName)
+{
+    Model* m = (Model*) model;
+    if (!m || !m->schema || !entityName) {
+        return 0;
+    }
+    auto it = m->schema->entitiesByName.find(entityName);
+    return it != m->schema->entitiesByName.end() ? (SdaiEntity) it->second : 0;
+}
+
+SdaiAttr DECL STDC sdaiGetAttrDefinition(SdaiEntity entity, SdaiString attributeName)
+{
+    Entity* e = (Entity*) entity;
+    if (!e || !attributeName) {
+        return NULL;
+    }
+    auto it = e->attributes.find(attributeName);
+    return it != e->attributes.end() ? (SdaiAttr) it->second : NULL;
+}
+
+//
+// Instances
+//
+
+SdaiInstance DECL STDC sdaiCreateInstanceBN(SdaiModel model, SdaiString entityName)
+{
+    Model* m = (Model*) model;
+    Entity* entity = (Entity*) sdaiGetEntity(model, entityName);
+    if (!entity) {
+        return 0;
+    }
+
+    m->instances.emplace_back();
+    Instance* inst = &m->instances.back();
+    inst->model = m;
+    inst->entity = entity;
+
+    CollectExtent(m, entity, false)->members.emplace_back();
+    Value& member = m->extents[entity->index]->members.back();
+    member.kind = Value::Kind::Instance;
+    member.instance = inst;
+
+    m->version++;
+    return (SdaiInstance) inst;
+}
+
+void DECL STDC sdaiDeleteInstance(SdaiInstance instance)
+{
+    Instance* inst = (Instance*) instance;
+    if (!inst || !inst->model || inst->model->extents.empty()) {
+        return;
+    }
+
+    //the instance leaves the extent, its handle is not reused
+    auto& members = inst->model->extents[inst->entity->index]->members;
+    for (auto it = members.begin(); it != members.end(); ++it) {
+        if (it->instance == inst) {
+            members.erase(it);
+            break;
+        }
+    }
+    inst->values.clear();
+    inst->model->version++;
+}
+
+SdaiModel DECL STDC sdaiGetInstanceModel(SdaiInstance instance)
+{
+    Instance* inst = (Instance*) instance;
+    return inst ? (SdaiModel) inst->model : 0;
+}
+
+SdaiEntity DECL STDC sdaiGetInstanceType(SdaiInstance instance)
+{
+    Instance* inst = (Instance*) instance;
+    return inst ? (SdaiEntity) inst->entity : 0;
+}
+
+int_t DECL STDC sdaiIsKindOf(SdaiInstance instance, SdaiEntity entity)
+{
+    Instance* inst = (Instance*) instance;
+    return (inst && entity && inst->entity->IsKindOf((Entity*) entity)) ? 1 : 0;
+}
+
+int_t DECL STDC sdaiIsKindOfBN(SdaiInstance instance, SdaiString entityName)
+{
+    Instance* inst = (Instance*) instance;
+    if (!inst || !inst->model) {
+        return 0;
+    }
+    Entity* entity = (Entity*) sdaiGetEntity((SdaiModel) inst->model, entityName);
+    return (entity && inst->entity->IsKindOf(entity)) ? 1 : 0;
+}
+
+SdaiAggr DECL STDC sdaiGetEntityExtent(SdaiModel model, SdaiEntity entity)
+{
+    Model* m = (Model*) model;
+    if (!m || !entity) {
+        return NULL;
+    }
+    std::lock_guard<std::mutex> lock(m->reads);
+    return (SdaiAggr) CollectExtent(m, (Entity*) entity, false);
+}
+
+SdaiAggr DECL STDC xxxxGetEntityAndSubTypesExtent(SdaiModel model, SdaiEntity entity)
+{
+    Model* m = (Model*) model;
+    if (!m || !entity) {
+        return NULL;
+    }
+    std::lock_guard<std::mutex> lock(m->reads);
+    return (SdaiAggr) CollectExtent(m, (Entity*) entity, true);
+}
+
+//
+// Attributes
+//
+
+void DECL * STDC sdaiGetAttr(SdaiInstance instance, const SdaiAttr attribute, SdaiPrimitiveType valueType, void* value)
+{
+    Value* v = FindValue(instance, attribute);
+    if (!v) {
+        return NULL;
+    }
+    Model* model = ((Instance*) instance)->model;
+    return GetValue(*v, valueType, value, model->texts, model);
+}
+
+void DECL STDC sdaiPutAttr(SdaiInstance instance, const SdaiAttr attribute, SdaiPrimitiveType valueType, const void* value)
+{
+    if (Value* v = PrepareValue(instance, attribute)) {
+        PutValue(*v, valueType, value, ((Instance*) instance)->model->texts);
+    }
+}
+
+void DECL * STDC sdaiGetAttrBN(SdaiInstance instance, SdaiString attributeName, SdaiPrimitiveType valueType, void* value)
+{
+    return sdaiGetAttr(instance, FindAttribute(instance, attributeName), valueType, value);
+}
+
+//
+// Copies text to the buffer when it fits, returns size of the text with terminating zero or 0 if the attribute is not set
+// Texts are stored as put, so they are returned as is
+//
+int_t DECL STDC sdaiGetAttrBNUnicode(SdaiInstance instance, SdaiString attributeName, unsigned char* buffer, int_t bufferLength)
+{
+    const char* text = NULL;
+    if (!sdaiGetAttrBN(instance, attributeName, sdaiSTRING, &text) || !text) {
+        return 0;
+    }
+
+    int_t size = (int_t) strlen(text) + 1;
+    if (buffer && size <= bufferLength) {
+        memcpy(buffer, text, (size_t) size);
+    }
+    return size;
+}
+
+void DECL STDC sdaiPutAttrBN(SdaiInstance instance, SdaiString attributeName, SdaiPrimitiveType valueType, const void* value)
+{
+    sdaiPutAttr(instance, FindAttribute(instance, attributeName), valueType, value);
+}
+
+//
+// Aggregations
+//
+
+SdaiAggr DECL STDC sdaiCreateAggr(SdaiInstance instance, const SdaiAttr attribute)
+{
+    Instance* inst = (Instance*) instance;
+    if (!inst || !inst->model) {
+        return NULL;
+    }
+
+    Aggregation* aggr = inst->model->NewAggregation();
+    if (attribute) {
+        if (Value* v = PrepareValue(instance, attribute)) {
+            *v = Value();
+            v->kind = Value::Kind::Aggr;
+            v->aggr = aggr;
+        }
+    }
+    return (SdaiAggr) aggr;
+}
+
+void DECL STDC sdaiAppend(const SdaiAggr aggregate, SdaiPrimitiveType valueType, const void* value)
+{
+    Aggregation* aggr = (Aggregation*) aggregate;
+    if (!aggr) {
+        return;
+    }
+    Value v;
+    if (PutValue(v, valueType, value, aggr->model->texts) && v.kind != Value::Kind::Unset) {
+        aggr->members.push_back(v);
+    }
+}
+
+SdaiInteger DECL STDC sdaiGetMemberCount(SdaiAggr aggregate)
+{
+    Aggregation* aggr = (Aggregation*) aggregate;
+    return aggr ? (SdaiInteger) aggr->members.size() : 0;
+}
+
+void DECL * STDC sdaiGetAggrByIndex(const SdaiAggr aggregate, SdaiAggrIndex index, SdaiPrimitiveType valueType, void* value)
+{
+    Aggregation* aggr = (Aggregation*) aggregate;
+    if (!aggr || index < 0 || index >= (SdaiAggrIndex) aggr->members.size()) {
+        return NULL;
+    }
+    return GetValue(aggr->members[index], valueType, value, aggr->model->texts, aggr->model);
+}
+
+SdaiIterator DECL STDC sdaiCreateIterator(const SdaiAggr aggregate)
+{
+    if (!aggregate) {
+        return NULL;
+    }
+    return new Iterator{(Aggregation*) aggregate, -1};
+}
+
+void DECL STDC sdaiDeleteIterator(SdaiIterator iterator)
+{
+    delete (Iterator*) iterator;
+}
+
+void DECL STDC sdaiBeginning(SdaiIterator iterator)
+{
+    if (iterator) {
+        ((Iterator*) iterator)->position = -1;
+    }
+}
+
+SdaiBoolean DECL STDC sdaiNext(SdaiIterator iterator)
+{
+    Iterator* it = (Iterator*) iterator;
+    if (!it || it->position >= (int_t) it->aggr->members.size()) {
+        return sdaiFALSE;
+    }
+    it->position++;
+    return it->position < (int_t) it->aggr->members.size() ? sdaiTRUE : sdaiFALSE;
+}
+
+void DECL * STDC sdaiGetAggrByIterator(SdaiIterator iterator, SdaiPrimitiveType valueType, void* value)
+{
+    Iterator* it = (Iterator*) iterator;
+    if (!it) {
+        return NULL;
+    }
+    return sdaiGetAggrByIndex((SdaiAggr) it->aggr, it->position, valueType, value);
+}
+
+//
+// ADB
+//
+
+SdaiADB DECL STDC sdaiCreateEmptyADB()
+{
+    return new ADB(NULL);
+}
+
+SdaiADB DECL STDC sdaiCreateADB(SdaiPrimitiveType valueType, const void* value)
+{
+    ADB* adb = new ADB(NULL);
+    PutValue(adb->value, valueType, value, adb->texts);
+    return adb;
+}
+
+void DECL STDC sdaiDeleteADB(const SdaiADB ADB_)
+{
+    ADB* adb = ADB::FromHandle(ADB_);
+    if (adb && !adb->model) {
+        delete adb;
+    }
+}
+
+void DECL * STDC sdaiGetADBValue(const SdaiADB ADB_, SdaiPrimitiveType valueType, void* value)
+{
+    ADB* adb = ADB::FromHandle(ADB_);
+    if (!adb) {
+        return NULL;
+    }
+    return GetValue(adb->value, valueType, value, adb->model ? adb->model->texts : adb->texts, adb->model);
+}
+
+void DECL STDC sdaiPutADBTypePath(const SdaiADB ADB_, int_t /*pathCount*/, SdaiString path)
+{
+    ADB* adb = ADB::FromHandle(ADB_);
+    if (adb) {
+        adb->value.typePath = path ? adb->texts.Copy(path) : NULL;
+    }
+}
+
+SdaiPrimitiveType DECL STDC sdaiGetADBType(const SdaiADB ADB_)
+{
+    ADB* adb = ADB::FromHandle(ADB_);
+    if (!adb) {
+        return 0;
+    }
+    switch (adb->value.kind) {
+        case Value::Kind::Integer:  return sdaiINTEGER;
+        case Value::Kind::Real:     return sdaiREAL;
+        case Value::Kind::Enum:     return sdaiENUM;
+        case Value::Kind::String:   return sdaiSTRING;
+        case Value::Kind::Binary:   return sdaiBINARY;
+        case Value::Kind::Instance: return sdaiINSTANCE;
+        case Value::Kind::Aggr:     return sdaiAGGR;
+        default:                    return 0;
+    }
+}
+
+SdaiString DECL STDC sdaiGetADBTypePath(const SdaiADB ADB_, int_t /*typeNameNumber*/)
+{
+    ADB* adb = ADB::FromHandle(ADB_);
+    if (!adb) {
+        return NULL;
+    }
+    if (adb->value.typePath) {
+        return adb->value.typePath;
+    }
+    if (adb->value.kind == Value::Kind::Instance) {
+        return adb->value.instance->entity->upperName.c_str();
+    }
+    return NULL;
+}
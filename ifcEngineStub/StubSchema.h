@@ -0,0 +1,42 @@
+//
+// Schema registration of the in-memory stand-in engine
+// Tables come from generated headers (SchemaEntities, SchemaSupertypes, SchemaAttributes), see StubSchema.cpp.in
+//
+#ifndef __RDF_LTD__STUB_SCHEMA_H
+#define __RDF_LTD__STUB_SCHEMA_H
+
+#include    <stddef.h>
+#include    "ifcengine.h"
+
+namespace ifcEngineStub
+{
+    /// <summary>
+    /// Entity of the schema, supertypes are -1 terminated list of indices in the entities array
+    /// </summary>
+    struct SchemaEntity
+    {
+        const char*     name;
+        const int_t*    supertypes;
+    };
+
+    /// <summary>
+    /// Attribute of the schema and the entity declaring it
+    /// </summary>
+    struct SchemaAttribute
+    {
+        const char*     entityName;
+        const char*     attrName;
+    };
+
+    //
+    // Registers schema, sdaiCreateModelBN finds it by name, case-insensitive
+    //
+    void RegisterSchema(const char* schemaName, const SchemaEntity* entities, size_t entityCount, const SchemaAttribute* attributes, size_t attributeCount);
+
+    //
+    // Registers all schemas built into the stand-in, generated by CMake from IFCENGINE_STUB_SCHEMAS
+    //
+    void RegisterSchemas();
+}
+
+#endif //__RDF_LTD__STUB_SCHEMA_H